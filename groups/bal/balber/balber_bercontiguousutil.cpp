@@ -0,0 +1,91 @@
+// balber_bercontiguousutil.cpp                                       -*-C++-*-
+#include <balber_bercontiguousutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balber_bercontiguousutil_cpp, "$Id$ $CSID$")
+
+#include <bsl_algorithm.h>
+
+namespace BloombergLP {
+namespace balber {
+
+                       // ------------------------------
+                       // class BerContiguousInStreamBuf
+                       // ------------------------------
+
+// PROTECTED MANIPULATORS
+bsl::streamsize BerContiguousInStreamBuf::showmanyc()
+{
+    const bsl::streamsize numChars = egptr() - gptr();
+    return 0 < numChars ? numChars : -1;
+}
+
+bsl::streamsize BerContiguousInStreamBuf::xsgetn(char_type       *destination,
+                                                 bsl::streamsize  length)
+{
+    BSLS_ASSERT(destination || 0 == length);
+    BSLS_ASSERT(0 <= length);
+
+    const bsl::streamsize numChars =
+                           bsl::min<bsl::streamsize>(egptr() - gptr(), length);
+    if (0 < numChars) {
+        bsl::memcpy(destination, gptr(), static_cast<bsl::size_t>(numChars));
+        gbump(static_cast<int>(numChars));
+    }
+    return numChars;
+}
+
+// CREATORS
+BerContiguousInStreamBuf::~BerContiguousInStreamBuf()
+{
+}
+
+                      // -------------------------------
+                      // class BerContiguousOutStreamBuf
+                      // -------------------------------
+
+// PROTECTED MANIPULATORS
+BerContiguousOutStreamBuf::int_type
+BerContiguousOutStreamBuf::overflow(int_type)
+{
+    return traits_type::eof();
+}
+
+bsl::streamsize BerContiguousOutStreamBuf::xsputn(const char_type *source,
+                                                  bsl::streamsize  length)
+{
+    BSLS_ASSERT(source || 0 == length);
+    BSLS_ASSERT(0 <= length);
+
+    const bsl::streamsize numChars =
+                           bsl::min<bsl::streamsize>(epptr() - pptr(), length);
+    if (0 < numChars) {
+        bsl::memcpy(pptr(), source, static_cast<bsl::size_t>(numChars));
+        pbump(static_cast<int>(numChars));
+    }
+    return numChars;
+}
+
+// CREATORS
+BerContiguousOutStreamBuf::~BerContiguousOutStreamBuf()
+{
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,957 @@
+// balber_bercontiguousutil.h                                         -*-C++-*-
+#ifndef INCLUDED_BALBER_BERCONTIGUOUSUTIL
+#define INCLUDED_BALBER_BERCONTIGUOUSUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide fast BER primitive codecs over contiguous memory buffers.
+//
+//@CLASSES:
+//  balber::BerContiguousInStreamBuf: input stream buffer over contiguous data
+//  balber::BerContiguousOutStreamBuf: output stream buffer over a fixed buffer
+//  balber::BerContiguousUtil: fast-path BER primitive encoding and decoding
+//
+//@SEE_ALSO: balber_berutil, balber_berdecoder, balber_berencoder
+//
+//@DESCRIPTION: This component provides two stream buffers whose data is held
+// in a single contiguous buffer, 'balber::BerContiguousInStreamBuf' and
+// 'balber::BerContiguousOutStreamBuf', and a 'struct',
+// 'balber::BerContiguousUtil', that encodes and decodes the most common BER
+// primitives -- identifier octets, length octets, end-of-contents octets, and
+// the values of 'bool', integral types and 'bsl::string' -- by direct access
+// to the memory at the current position of those stream buffers, rather than
+// one virtual 'bsl::streambuf' call per octet as done by 'balber::BerUtil'.
+//
+// 'balber::BerDecoder' and 'balber::BerEncoder' use this component when the
+// stream buffer supplied to 'decode' or 'encode' is one of the stream buffers
+// provided here ('balber::BerDecoder' also uses it for a
+// 'bdlsb::FixedMemInStreamBuf'), and clients do not normally need to call the
+// functions of 'balber::BerContiguousUtil' directly.
+//
+///Fast Path and Fallback
+///----------------------
+// Each function of 'balber::BerContiguousUtil' handles only the forms that are
+// both common and cheap to check: single-octet tag numbers, short, indefinite,
+// and long (up to 4 octets) lengths, and values whose encoding lies entirely
+// within the buffer.  Every function returns 0 if it performed the operation,
+// and a non-zero value -- consuming or producing no data -- if it did not,
+// whether because the form is not supported, the data is malformed, or the
+// operation would cross the end of the buffer.  In that case the caller
+// performs the operation with the corresponding function of
+// 'balber::BerUtil' on the *same* stream buffer, which handles every form,
+// detects every error, and reports the same results.  The functions of this
+// component therefore never change the meaning of an encoding, only the cost
+// of producing or consuming it: for any input, the fast path followed by the
+// fallback consumes and produces exactly what 'balber::BerUtil' alone would.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding Primitives From a Buffer
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a buffer holding the BER encoding of a tagged integer, and
+// we want to decode it, falling back on 'balber::BerUtil' as needed.
+//
+// First, we encode the tag and the value into a buffer using a
+// 'balber::BerContiguousOutStreamBuf':
+//..
+//  char                              buffer[32];
+//  balber::BerContiguousOutStreamBuf osb(buffer, sizeof buffer);
+//
+//  int rc = balber::BerContiguousUtil::putIdentifierOctets(
+//                                        &osb,
+//                                        balber::BerConstants::e_UNIVERSAL,
+//                                        balber::BerConstants::e_PRIMITIVE,
+//                                        2);
+//  assert(0 == rc);
+//  rc = balber::BerContiguousUtil::putValue(&osb, 1234);
+//  assert(0 == rc);
+//  assert(4 == osb.length());
+//..
+// Then, we create a 'balber::BerContiguousInStreamBuf' over the encoded data,
+// and decode the tag header:
+//..
+//  balber::BerContiguousInStreamBuf isb(osb.data(), osb.length());
+//
+//  balber::BerConstants::TagClass tagClass;
+//  balber::BerConstants::TagType  tagType;
+//  int                            tagNumber;
+//  int                            length;
+//  int                            numBytesConsumed = 0;
+//
+//  rc = balber::BerContiguousUtil::getTagHeader(&isb,
+//                                               &tagClass,
+//                                               &tagType,
+//                                               &tagNumber,
+//                                               &length,
+//                                               &numBytesConsumed);
+//  if (0 != rc) {
+//      rc  = balber::BerUtil::getIdentifierOctets(&isb,
+//                                                 &tagClass,
+//                                                 &tagType,
+//                                                 &tagNumber,
+//                                                 &numBytesConsumed);
+//      rc |= balber::BerUtil::getLength(&isb, &length, &numBytesConsumed);
+//  }
+//  assert(0                                 == rc);
+//  assert(balber::BerConstants::e_UNIVERSAL == tagClass);
+//  assert(balber::BerConstants::e_PRIMITIVE == tagType);
+//  assert(2                                 == tagNumber);
+//  assert(2                                 == length);
+//  assert(2                                 == numBytesConsumed);
+//..
+// Finally, we decode the value, again with a fallback:
+//..
+//  int value;
+//  rc = balber::BerContiguousUtil::getValue(&isb, &value, length);
+//  if (0 != rc) {
+//      rc = balber::BerUtil::getValue(&isb, &value, length);
+//  }
+//  assert(0    == rc);
+//  assert(1234 == value);
+//  assert(0    == isb.numRemaining());
+//..
+
+#include <balscm_version.h>
+
+#include <balber_berconstants.h>
+#include <balber_berutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
+#include <bsl_ios.h>
+#include <bsl_streambuf.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace balber {
+
+                       // ==============================
+                       // class BerContiguousInStreamBuf
+                       // ==============================
+
+class BerContiguousInStreamBuf : public bsl::streambuf {
+    // This class implements the input functionality of the 'basic_streambuf'
+    // protocol over a client-supplied contiguous character buffer, and
+    // provides direct access to the unread portion of that buffer.
+
+    // NOT IMPLEMENTED
+    BerContiguousInStreamBuf(const BerContiguousInStreamBuf&);
+    BerContiguousInStreamBuf& operator=(const BerContiguousInStreamBuf&);
+
+  protected:
+    // PROTECTED MANIPULATORS
+    virtual bsl::streamsize showmanyc();
+        // Return the number of characters currently available for reading
+        // from this stream buffer, or -1 if there are none.
+
+    virtual bsl::streamsize xsgetn(char_type       *destination,
+                                   bsl::streamsize  length);
+        // Read at most the specified 'length' number of characters into the
+        // specified 'destination'.  Return the number of characters read.
+        // The behavior is undefined unless '0 <= length'.
+
+  public:
+    // CREATORS
+    BerContiguousInStreamBuf(const char *buffer, bsl::size_t length);
+        // Create a stream buffer providing access to the characters in the
+        // specified 'buffer' of the specified 'length', positioned at the
+        // start of 'buffer'.  The behavior is undefined unless 'buffer' or
+        // '0 == length'.  Note that 'buffer' is held but not owned.
+
+    virtual ~BerContiguousInStreamBuf();
+        // Destroy this stream buffer.
+
+    // MANIPULATORS
+    void advance(int numBytes);
+        // Skip the specified 'numBytes' characters of this stream buffer.  The
+        // behavior is undefined unless '0 <= numBytes <= numRemaining()'.
+
+    // ACCESSORS
+    const char *cursor() const;
+        // Return the address of the next character to be read from this
+        // stream buffer.
+
+    const char *end() const;
+        // Return the address one past the last character of this stream
+        // buffer.
+
+    bsl::size_t numConsumed() const;
+        // Return the number of characters read from, or skipped in, this
+        // stream buffer since its construction.
+
+    bsl::size_t numRemaining() const;
+        // Return the number of characters remaining to be read from this
+        // stream buffer.
+};
+
+                      // ===============================
+                      // class BerContiguousOutStreamBuf
+                      // ===============================
+
+class BerContiguousOutStreamBuf : public bsl::streambuf {
+    // This class implements the output functionality of the 'basic_streambuf'
+    // protocol into a client-supplied buffer of fixed capacity, and provides
+    // direct access to the unwritten portion of that buffer.  Output beyond
+    // the capacity of the buffer fails.
+
+    // NOT IMPLEMENTED
+    BerContiguousOutStreamBuf(const BerContiguousOutStreamBuf&);
+    BerContiguousOutStreamBuf& operator=(const BerContiguousOutStreamBuf&);
+
+  protected:
+    // PROTECTED MANIPULATORS
+    virtual int_type overflow(int_type character);
+        // Return 'traits_type::eof()'.  Note that this function is called only
+        // when the buffer is full.
+
+    virtual bsl::streamsize xsputn(const char_type *source,
+                                   bsl::streamsize  length);
+        // Write at most the specified 'length' characters from the specified
+        // 'source' to this stream buffer, stopping when the buffer is full.
+        // Return the number of characters written.  The behavior is undefined
+        // unless '0 <= length'.
+
+  public:
+    // CREATORS
+    BerContiguousOutStreamBuf(char *buffer, bsl::size_t capacity);
+        // Create a stream buffer writing into the specified 'buffer' having
+        // the specified 'capacity'.  The behavior is undefined unless 'buffer'
+        // or '0 == capacity'.  Note that 'buffer' is held but not owned.
+
+    virtual ~BerContiguousOutStreamBuf();
+        // Destroy this stream buffer.
+
+    // MANIPULATORS
+    void advance(int numBytes);
+        // Mark the specified 'numBytes' characters at 'cursor()' as written.
+        // The behavior is undefined unless '0 <= numBytes <= numRemaining()'.
+
+    char *cursor();
+        // Return the address of the next character to be written to this
+        // stream buffer.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the capacity of the buffer of this stream buffer.
+
+    const char *data() const;
+        // Return the address of the buffer of this stream buffer.
+
+    bsl::size_t length() const;
+        // Return the number of characters written to this stream buffer.
+
+    bsl::size_t numRemaining() const;
+        // Return the number of characters that can still be written to this
+        // stream buffer.
+};
+
+                          // ========================
+                          // struct BerContiguousUtil
+                          // ========================
+
+struct BerContiguousUtil {
+    // This 'struct' provides a namespace for functions that encode and decode
+    // common BER primitives by direct access to the memory of a contiguous
+    // stream buffer.  Each function returns 0 if it performed the operation,
+    // and a non-zero value, leaving the stream buffer and all output arguments
+    // unchanged, if the operation must instead be performed by the
+    // corresponding function of 'BerUtil' (see {Fast Path and Fallback}).
+
+  private:
+    // PRIVATE CLASS METHODS
+    template <class TYPE>
+    static int getIntegerValue(BerContiguousInStreamBuf *streamBuf,
+                               TYPE                     *value,
+                               int                       length);
+        // Decode into the specified 'value' the integer of the specified
+        // 'length' at the current position of the specified 'streamBuf'.
+
+    template <class TYPE>
+    static int putIntegerValue(BerContiguousOutStreamBuf *streamBuf,
+                               TYPE                       value);
+        // Encode the length and contents octets of the specified integer
+        // 'value' at the current position of the specified 'streamBuf'.
+
+  public:
+    // CLASS METHODS
+
+                               // Decoding
+
+    static int getTagHeader(BerContiguousInStreamBuf *streamBuf,
+                            BerConstants::TagClass   *tagClass,
+                            BerConstants::TagType    *tagType,
+                            int                      *tagNumber,
+                            int                      *length,
+                            int                      *accumNumBytesConsumed);
+        // Decode the identifier and length octets at the current position of
+        // the specified 'streamBuf', load the tag into the specified
+        // 'tagClass', 'tagType' and 'tagNumber', and the length into the
+        // specified 'length' ('BerUtil::k_INDEFINITE_LENGTH' for an indefinite
+        // length), and add the number of octets consumed to the specified
+        // 'accumNumBytesConsumed'.  Return 0 on success, and a non-zero value,
+        // with no effect, if the tag number does not fit in the identifier
+        // octet, the length is in long form of more than 4 octets, or the
+        // octets are not all available.
+
+    static int getEndOfContentOctets(
+                             BerContiguousInStreamBuf *streamBuf,
+                             int                      *accumNumBytesConsumed);
+        // Consume the end-of-contents octets at the current position of the
+        // specified 'streamBuf', and add 2 to the specified
+        // 'accumNumBytesConsumed'.  Return 0 on success, and a non-zero value,
+        // with no effect, if the next two octets are not available or are not
+        // end-of-contents octets.
+
+    static int getValue(BerContiguousInStreamBuf *streamBuf,
+                        bool                     *value,
+                        int                       length);
+    static int getValue(BerContiguousInStreamBuf *streamBuf,
+                        short                    *value,
+                        int                       length);
+    static int getValue(BerContiguousInStreamBuf *streamBuf,
+                        unsigned short           *value,
+                        int                       length);
+    static int getValue(BerContiguousInStreamBuf *streamBuf,
+                        int                      *value,
+                        int                       length);
+    static int getValue(BerContiguousInStreamBuf *streamBuf,
+                        unsigned int             *value,
+                        int                       length);
+    static int getValue(BerContiguousInStreamBuf *streamBuf,
+                        long                     *value,
+                        int                       length);
+    static int getValue(BerContiguousInStreamBuf *streamBuf,
+                        unsigned long            *value,
+                        int                       length);
+    static int getValue(BerContiguousInStreamBuf *streamBuf,
+                        bsls::Types::Int64       *value,
+                        int                       length);
+    static int getValue(BerContiguousInStreamBuf *streamBuf,
+                        bsls::Types::Uint64      *value,
+                        int                       length);
+    static int getValue(BerContiguousInStreamBuf *streamBuf,
+                        bsl::string              *value,
+                        int                       length);
+    template <class TYPE>
+    static int getValue(BerContiguousInStreamBuf *streamBuf,
+                        TYPE                     *value,
+                        int                       length);
+        // Decode into the specified 'value' the contents octets of the
+        // specified 'length' at the current position of the specified
+        // 'streamBuf'.  Return 0 on success, and a non-zero value, with no
+        // effect, if the contents octets are not all available, or do not
+        // have the common form of an encoding of 'value'.  Note that the
+        // function template returns a non-zero value for every other 'TYPE'.
+
+                               // Encoding
+
+    static int putIdentifierOctets(BerContiguousOutStreamBuf *streamBuf,
+                                   BerConstants::TagClass     tagClass,
+                                   BerConstants::TagType      tagType,
+                                   int                        tagNumber);
+        // Encode the identifier octets for the specified 'tagClass', 'tagType'
+        // and 'tagNumber' at the current position of the specified
+        // 'streamBuf'.  Return 0 on success, and a non-zero value, with no
+        // effect, if 'tagNumber' does not fit in a single identifier octet or
+        // 'streamBuf' is full.
+
+    static int putIndefiniteLengthOctet(BerContiguousOutStreamBuf *streamBuf);
+        // Encode the indefinite-length octet at the current position of the
+        // specified 'streamBuf'.  Return 0 on success, and a non-zero value,
+        // with no effect, if 'streamBuf' is full.
+
+    static int putEndOfContentOctets(BerContiguousOutStreamBuf *streamBuf);
+        // Encode the end-of-contents octets at the current position of the
+        // specified 'streamBuf'.  Return 0 on success, and a non-zero value,
+        // with no effect, if 'streamBuf' has room for fewer than 2 octets.
+
+    static int putValue(BerContiguousOutStreamBuf *streamBuf, bool value);
+    static int putValue(BerContiguousOutStreamBuf *streamBuf, short value);
+    static int putValue(BerContiguousOutStreamBuf *streamBuf,
+                        unsigned short             value);
+    static int putValue(BerContiguousOutStreamBuf *streamBuf, int value);
+    static int putValue(BerContiguousOutStreamBuf *streamBuf,
+                        unsigned int               value);
+    static int putValue(BerContiguousOutStreamBuf *streamBuf, long value);
+    static int putValue(BerContiguousOutStreamBuf *streamBuf,
+                        unsigned long              value);
+    static int putValue(BerContiguousOutStreamBuf *streamBuf,
+                        bsls::Types::Int64         value);
+    static int putValue(BerContiguousOutStreamBuf *streamBuf,
+                        bsls::Types::Uint64        value);
+    static int putValue(BerContiguousOutStreamBuf *streamBuf,
+                        const bsl::string&         value);
+    template <class TYPE>
+    static int putValue(BerContiguousOutStreamBuf *streamBuf,
+                        const TYPE&                value);
+        // Encode the length and contents octets of the specified 'value' at
+        // the current position of the specified 'streamBuf'.  Return 0 on
+        // success, and a non-zero value, with no effect, if the encoding does
+        // not fit in the remaining capacity of 'streamBuf', or (for strings)
+        // its length exceeds 'INT_MAX'.  Note that the
+        // function template returns a non-zero value for every other 'TYPE'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                       // ------------------------------
+                       // class BerContiguousInStreamBuf
+                       // ------------------------------
+
+// CREATORS
+inline
+BerContiguousInStreamBuf::BerContiguousInStreamBuf(const char  *buffer,
+                                                   bsl::size_t  length)
+{
+    BSLS_ASSERT(buffer || 0 == length);
+
+    char *begin = const_cast<char *>(buffer);
+    setg(begin, begin, begin + length);
+}
+
+// MANIPULATORS
+inline
+void BerContiguousInStreamBuf::advance(int numBytes)
+{
+    BSLS_ASSERT(0 <= numBytes);
+    BSLS_ASSERT(static_cast<bsl::size_t>(numBytes) <= numRemaining());
+
+    gbump(numBytes);
+}
+
+// ACCESSORS
+inline
+const char *BerContiguousInStreamBuf::cursor() const
+{
+    return gptr();
+}
+
+inline
+const char *BerContiguousInStreamBuf::end() const
+{
+    return egptr();
+}
+
+inline
+bsl::size_t BerContiguousInStreamBuf::numConsumed() const
+{
+    return gptr() - eback();
+}
+
+inline
+bsl::size_t BerContiguousInStreamBuf::numRemaining() const
+{
+    return egptr() - gptr();
+}
+
+                      // -------------------------------
+                      // class BerContiguousOutStreamBuf
+                      // -------------------------------
+
+// CREATORS
+inline
+BerContiguousOutStreamBuf::BerContiguousOutStreamBuf(char        *buffer,
+                                                     bsl::size_t  capacity)
+{
+    BSLS_ASSERT(buffer || 0 == capacity);
+
+    setp(buffer, buffer + capacity);
+}
+
+// MANIPULATORS
+inline
+void BerContiguousOutStreamBuf::advance(int numBytes)
+{
+    BSLS_ASSERT(0 <= numBytes);
+    BSLS_ASSERT(static_cast<bsl::size_t>(numBytes) <= numRemaining());
+
+    pbump(numBytes);
+}
+
+inline
+char *BerContiguousOutStreamBuf::cursor()
+{
+    return pptr();
+}
+
+// ACCESSORS
+inline
+bsl::size_t BerContiguousOutStreamBuf::capacity() const
+{
+    return epptr() - pbase();
+}
+
+inline
+const char *BerContiguousOutStreamBuf::data() const
+{
+    return pbase();
+}
+
+inline
+bsl::size_t BerContiguousOutStreamBuf::length() const
+{
+    return pptr() - pbase();
+}
+
+inline
+bsl::size_t BerContiguousOutStreamBuf::numRemaining() const
+{
+    return epptr() - pptr();
+}
+
+                          // ------------------------
+                          // struct BerContiguousUtil
+                          // ------------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+inline
+int BerContiguousUtil::getIntegerValue(BerContiguousInStreamBuf *streamBuf,
+                                       TYPE                     *value,
+                                       int                       length)
+{
+    const unsigned char *octet =
+               reinterpret_cast<const unsigned char *>(streamBuf->cursor());
+
+    if (length <= 0 || streamBuf->numRemaining() <
+                                       static_cast<bsl::size_t>(length)) {
+        return -1;                                                    // RETURN
+    }
+
+    int numValueOctets = length;
+    if (static_cast<bsl::size_t>(length) == sizeof(TYPE) + 1
+     && TYPE(-1) > TYPE(0)
+     && 0 == octet[0]) {
+        // A large unsigned value is preceded by a 0 octet, so that it does
+        // not appear negative.
+
+        ++octet;
+        --numValueOctets;
+    }
+
+    if (static_cast<bsl::size_t>(numValueOctets) > sizeof(TYPE)) {
+        return -1;                                                    // RETURN
+    }
+
+    bsls::Types::Uint64 result = octet[0] & 0x80 ? ~0ull : 0ull;
+    for (int i = 0; i < numValueOctets; ++i) {
+        result = (result << 8) | octet[i];
+    }
+
+    *value = static_cast<TYPE>(result);
+    streamBuf->advance(length);
+    return 0;
+}
+
+template <class TYPE>
+inline
+int BerContiguousUtil::putIntegerValue(BerContiguousOutStreamBuf *streamBuf,
+                                       TYPE                       value)
+{
+    const int length = BerUtil_IntegerImpUtil::getNumOctetsToStream(value);
+
+    if (streamBuf->numRemaining() < static_cast<bsl::size_t>(length) + 1) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsls::Types::Uint64 bits = static_cast<bsls::Types::Uint64>(value);
+
+    unsigned char *octet =
+                      reinterpret_cast<unsigned char *>(streamBuf->cursor());
+    octet[0] = static_cast<unsigned char>(length);
+    for (int i = 1; i <= length; ++i) {
+        const int shift = (length - i) * 8;
+        octet[i] = shift < static_cast<int>(sizeof(TYPE) * 8)
+                   ? static_cast<unsigned char>(bits >> shift)
+                   : 0;
+    }
+
+    streamBuf->advance(length + 1);
+    return 0;
+}
+
+// CLASS METHODS
+
+                               // Decoding
+
+inline
+int BerContiguousUtil::getTagHeader(
+                               BerContiguousInStreamBuf *streamBuf,
+                               BerConstants::TagClass   *tagClass,
+                               BerConstants::TagType    *tagType,
+                               int                      *tagNumber,
+                               int                      *length,
+                               int                      *accumNumBytesConsumed)
+{
+    enum {
+        k_TAG_CLASS_MASK         = 0xC0,
+        k_TAG_TYPE_MASK          = 0x20,
+        k_TAG_NUMBER_MASK        = 0x1F,
+        k_LONG_FORM_LENGTH_FLAG  = 0x80,
+        k_MAX_LENGTH_OCTETS      = 4
+    };
+
+    const bsl::size_t    numRemaining = streamBuf->numRemaining();
+    const unsigned char *octet        =
+               reinterpret_cast<const unsigned char *>(streamBuf->cursor());
+
+    if (numRemaining < 2
+     || k_TAG_NUMBER_MASK == (octet[0] & k_TAG_NUMBER_MASK)) {
+        return -1;                                                    // RETURN
+    }
+
+    int numHeaderOctets = 2;
+    int result          = octet[1];
+    if (result & k_LONG_FORM_LENGTH_FLAG) {
+        const int numLengthOctets = result & ~k_LONG_FORM_LENGTH_FLAG;
+        if (0 == numLengthOctets) {
+            result = BerUtil::k_INDEFINITE_LENGTH;
+        }
+        else {
+            if (numLengthOctets > k_MAX_LENGTH_OCTETS
+             || numRemaining < static_cast<bsl::size_t>(2 + numLengthOctets)) {
+                return -1;                                            // RETURN
+            }
+
+            unsigned int value = 0;
+            for (int i = 0; i < numLengthOctets; ++i) {
+                value = (value << 8) | octet[2 + i];
+            }
+            result           = static_cast<int>(value);
+            numHeaderOctets += numLengthOctets;
+        }
+    }
+
+    *tagClass  = static_cast<BerConstants::TagClass>(octet[0]
+                                                     & k_TAG_CLASS_MASK);
+    *tagType   = static_cast<BerConstants::TagType>(octet[0]
+                                                    & k_TAG_TYPE_MASK);
+    *tagNumber = octet[0] & k_TAG_NUMBER_MASK;
+    *length    = result;
+
+    *accumNumBytesConsumed += numHeaderOctets;
+    streamBuf->advance(numHeaderOctets);
+    return 0;
+}
+
+inline
+int BerContiguousUtil::getEndOfContentOctets(
+                               BerContiguousInStreamBuf *streamBuf,
+                               int                      *accumNumBytesConsumed)
+{
+    const char *octet = streamBuf->cursor();
+
+    if (streamBuf->numRemaining() < 2 || 0 != octet[0] || 0 != octet[1]) {
+        return -1;                                                    // RETURN
+    }
+
+    *accumNumBytesConsumed += 2;
+    streamBuf->advance(2);
+    return 0;
+}
+
+inline
+int BerContiguousUtil::getValue(BerContiguousInStreamBuf *streamBuf,
+                                bool                     *value,
+                                int                       length)
+{
+    if (1 != length || 0 == streamBuf->numRemaining()) {
+        return -1;                                                    // RETURN
+    }
+
+    *value = 0 != *streamBuf->cursor();
+    streamBuf->advance(1);
+    return 0;
+}
+
+inline
+int BerContiguousUtil::getValue(BerContiguousInStreamBuf *streamBuf,
+                                short                    *value,
+                                int                       length)
+{
+    return getIntegerValue(streamBuf, value, length);
+}
+
+inline
+int BerContiguousUtil::getValue(BerContiguousInStreamBuf *streamBuf,
+                                unsigned short           *value,
+                                int                       length)
+{
+    return getIntegerValue(streamBuf, value, length);
+}
+
+inline
+int BerContiguousUtil::getValue(BerContiguousInStreamBuf *streamBuf,
+                                int                      *value,
+                                int                       length)
+{
+    return getIntegerValue(streamBuf, value, length);
+}
+
+inline
+int BerContiguousUtil::getValue(BerContiguousInStreamBuf *streamBuf,
+                                unsigned int             *value,
+                                int                       length)
+{
+    return getIntegerValue(streamBuf, value, length);
+}
+
+inline
+int BerContiguousUtil::getValue(BerContiguousInStreamBuf *streamBuf,
+                                long                     *value,
+                                int                       length)
+{
+    return getIntegerValue(streamBuf, value, length);
+}
+
+inline
+int BerContiguousUtil::getValue(BerContiguousInStreamBuf *streamBuf,
+                                unsigned long            *value,
+                                int                       length)
+{
+    return getIntegerValue(streamBuf, value, length);
+}
+
+inline
+int BerContiguousUtil::getValue(BerContiguousInStreamBuf *streamBuf,
+                                bsls::Types::Int64       *value,
+                                int                       length)
+{
+    return getIntegerValue(streamBuf, value, length);
+}
+
+inline
+int BerContiguousUtil::getValue(BerContiguousInStreamBuf *streamBuf,
+                                bsls::Types::Uint64      *value,
+                                int                       length)
+{
+    return getIntegerValue(streamBuf, value, length);
+}
+
+inline
+int BerContiguousUtil::getValue(BerContiguousInStreamBuf *streamBuf,
+                                bsl::string              *value,
+                                int                       length)
+{
+    // An empty string is decoded according to the decoder options, which only
+    // 'BerUtil' consults.
+
+    if (length <= 0
+     || streamBuf->numRemaining() < static_cast<bsl::size_t>(length)) {
+        return -1;                                                    // RETURN
+    }
+
+    value->assign(streamBuf->cursor(), length);
+    streamBuf->advance(length);
+    return 0;
+}
+
+template <class TYPE>
+inline
+int BerContiguousUtil::getValue(BerContiguousInStreamBuf *,
+                                TYPE                     *,
+                                int                       )
+{
+    return -1;
+}
+
+                               // Encoding
+
+inline
+int BerContiguousUtil::putIdentifierOctets(
+                                         BerContiguousOutStreamBuf *streamBuf,
+                                         BerConstants::TagClass     tagClass,
+                                         BerConstants::TagType      tagType,
+                                         int                        tagNumber)
+{
+    enum { k_MAX_TAG_NUMBER_IN_ONE_OCTET = 30 };
+
+    if (static_cast<unsigned int>(tagNumber) > k_MAX_TAG_NUMBER_IN_ONE_OCTET
+     || 0 == streamBuf->numRemaining()) {
+        return -1;                                                    // RETURN
+    }
+
+    *streamBuf->cursor() = static_cast<char>(tagClass | tagType | tagNumber);
+    streamBuf->advance(1);
+    return 0;
+}
+
+inline
+int BerContiguousUtil::putIndefiniteLengthOctet(
+                                          BerContiguousOutStreamBuf *streamBuf)
+{
+    if (0 == streamBuf->numRemaining()) {
+        return -1;                                                    // RETURN
+    }
+
+    *streamBuf->cursor() = static_cast<char>(0x80);
+    streamBuf->advance(1);
+    return 0;
+}
+
+inline
+int BerContiguousUtil::putEndOfContentOctets(
+                                          BerContiguousOutStreamBuf *streamBuf)
+{
+    if (streamBuf->numRemaining() < 2) {
+        return -1;                                                    // RETURN
+    }
+
+    char *octet = streamBuf->cursor();
+    octet[0] = 0;
+    octet[1] = 0;
+    streamBuf->advance(2);
+    return 0;
+}
+
+inline
+int BerContiguousUtil::putValue(BerContiguousOutStreamBuf *streamBuf,
+                                bool                       value)
+{
+    // 'BerUtil' asserts that the object representation of 'value' is 0 or 1.
+
+    BSLS_ASSERT(0 == *static_cast<char *>(static_cast<void *>(&value)) ||
+                1 == *static_cast<char *>(static_cast<void *>(&value)));
+
+    if (streamBuf->numRemaining() < 2) {
+        return -1;                                                    // RETURN
+    }
+
+    char *octet = streamBuf->cursor();
+    octet[0] = 1;
+    octet[1] = value ? 1 : 0;
+    streamBuf->advance(2);
+    return 0;
+}
+
+inline
+int BerContiguousUtil::putValue(BerContiguousOutStreamBuf *streamBuf,
+                                short                      value)
+{
+    return putIntegerValue(streamBuf, value);
+}
+
+inline
+int BerContiguousUtil::putValue(BerContiguousOutStreamBuf *streamBuf,
+                                unsigned short             value)
+{
+    return putIntegerValue(streamBuf, value);
+}
+
+inline
+int BerContiguousUtil::putValue(BerContiguousOutStreamBuf *streamBuf,
+                                int                        value)
+{
+    return putIntegerValue(streamBuf, value);
+}
+
+inline
+int BerContiguousUtil::putValue(BerContiguousOutStreamBuf *streamBuf,
+                                unsigned int               value)
+{
+    return putIntegerValue(streamBuf, value);
+}
+
+inline
+int BerContiguousUtil::putValue(BerContiguousOutStreamBuf *streamBuf,
+                                long                       value)
+{
+    return putIntegerValue(streamBuf, value);
+}
+
+inline
+int BerContiguousUtil::putValue(BerContiguousOutStreamBuf *streamBuf,
+                                unsigned long              value)
+{
+    return putIntegerValue(streamBuf, value);
+}
+
+inline
+int BerContiguousUtil::putValue(BerContiguousOutStreamBuf *streamBuf,
+                                bsls::Types::Int64         value)
+{
+    return putIntegerValue(streamBuf, value);
+}
+
+inline
+int BerContiguousUtil::putValue(BerContiguousOutStreamBuf *streamBuf,
+                                bsls::Types::Uint64        value)
+{
+    return putIntegerValue(streamBuf, value);
+}
+
+inline
+int BerContiguousUtil::putValue(BerContiguousOutStreamBuf *streamBuf,
+                                const bsl::string&         value)
+{
+    const bsl::size_t length = value.length();
+    if (length > 0x7FFFFFFF) {
+        return -1;                                                    // RETURN
+    }
+
+    // The length octets are in short form for lengths up to 127, and
+    // otherwise in long form, using the minimal number of octets.
+
+    int numLengthOctets = 0;
+    if (length > 127) {
+        numLengthOctets = length > 0xFFFFFF ? 4
+                        : length > 0xFFFF   ? 3
+                        : length > 0xFF     ? 2
+                        :                     1;
+    }
+
+    if (streamBuf->numRemaining() < length + numLengthOctets + 1) {
+        return -1;                                                    // RETURN
+    }
+
+    char *octet = streamBuf->cursor();
+    if (0 == numLengthOctets) {
+        *octet++ = static_cast<char>(length);
+    }
+    else {
+        *octet++ = static_cast<char>(0x80 | numLengthOctets);
+        for (int i = numLengthOctets - 1; 0 <= i; --i) {
+            *octet++ = static_cast<char>(length >> (8 * i));
+        }
+    }
+    bsl::memcpy(octet, value.data(), length);
+    streamBuf->advance(static_cast<int>(length) + numLengthOctets + 1);
+    return 0;
+}
+
+template <class TYPE>
+inline
+int BerContiguousUtil::putValue(BerContiguousOutStreamBuf *, const TYPE&)
+{
+    return -1;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
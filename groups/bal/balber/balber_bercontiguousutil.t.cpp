@@ -0,0 +1,1533 @@
+// balber_bercontiguousutil.t.cpp                                     -*-C++-*-
+#include <balber_bercontiguousutil.h>
+
+#include <balber_berconstants.h>
+#include <balber_berutil.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslstl_stringref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// This component provides two stream buffers over contiguous memory and a
+// utility whose functions either perform a BER primitive operation directly
+// on that memory, or decline it with no effect.  The primary concern is that
+// the fast path is indistinguishable from 'balber::BerUtil': whenever a
+// function succeeds, it must have consumed or produced exactly the octets,
+// and loaded exactly the values, that 'balber::BerUtil' does for the same
+// input; and whenever it declines -- at every truncation of the input or
+// capacity of the output -- it must leave the stream buffer and its output
+// arguments untouched.  Each function is therefore tested against
+// 'balber::BerUtil' on tables of encodings and values, at every possible
+// buffer boundary.
+// ----------------------------------------------------------------------------
+// BerContiguousInStreamBuf
+// [ 2] BerContiguousInStreamBuf(const char *buffer, size_t length);
+// [ 2] ~BerContiguousInStreamBuf();
+// [ 2] void advance(int numBytes);
+// [ 2] const char *cursor() const;
+// [ 2] const char *end() const;
+// [ 2] size_t numConsumed() const;
+// [ 2] size_t numRemaining() const;
+// [ 2] streamsize showmanyc();
+// [ 2] streamsize xsgetn(char_type *destination, streamsize length);
+//
+// BerContiguousOutStreamBuf
+// [ 3] BerContiguousOutStreamBuf(char *buffer, size_t capacity);
+// [ 3] ~BerContiguousOutStreamBuf();
+// [ 3] void advance(int numBytes);
+// [ 3] char *cursor();
+// [ 3] size_t capacity() const;
+// [ 3] const char *data() const;
+// [ 3] size_t length() const;
+// [ 3] size_t numRemaining() const;
+// [ 3] int_type overflow(int_type character);
+// [ 3] streamsize xsputn(const char_type *source, streamsize length);
+//
+// BerContiguousUtil
+// [ 4] int getTagHeader(InBuf*, TagClass*, TagType*, int*, int*, int*);
+// [ 4] int getEndOfContentOctets(InBuf *, int *);
+// [ 5] int getValue(InBuf *, TYPE *value, int length);
+// [ 6] int putIdentifierOctets(OutBuf *, TagClass, TagType, int);
+// [ 6] int putIndefiniteLengthOctet(OutBuf *);
+// [ 6] int putEndOfContentOctets(OutBuf *);
+// [ 7] int putValue(OutBuf *, const TYPE& value);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balber::BerContiguousUtil         Util;
+typedef balber::BerContiguousInStreamBuf  InBuf;
+typedef balber::BerContiguousOutStreamBuf OutBuf;
+typedef balber::BerUtil                   BerUtil;
+typedef balber::BerConstants              Constants;
+typedef bsls::Types::Int64                Int64;
+typedef bsls::Types::Uint64               Uint64;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+const unsigned char k_FILL = 0xA5;  // value of octets not written
+
+// ============================================================================
+//                          HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bsl::string fromHex(const char *hex)
+    // Return the octets described by the specified 'hex' string of pairs of
+    // hexadecimal digits, optionally separated by spaces.
+{
+    bsl::string result;
+    while (*hex) {
+        if (' ' == *hex) {
+            ++hex;
+            continue;
+        }
+        const char digits[3] = { hex[0], hex[1], 0 };
+        result.push_back(static_cast<char>(bsl::strtol(digits, 0, 16)));
+        hex += 2;
+    }
+    return result;
+}
+
+bool isFilled(const char *buffer, int length)
+    // Return 'true' if the specified 'length' octets of the specified 'buffer'
+    // all have the value 'k_FILL', and 'false' otherwise.
+{
+    for (int i = 0; i < length; ++i) {
+        if (static_cast<char>(k_FILL) != buffer[i]) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class TYPE>
+void verifyGetValue(int line, const bsl::string& input, int length)
+    // Verify that 'balber::BerContiguousUtil::getValue' for the specified
+    // 'length' contents octets of the specified 'input', and every truncation
+    // of 'input', either decodes the same value and consumes the same number
+    // of octets as 'balber::BerUtil::getValue', or declines with no effect.
+    // Use the specified 'line' to report errors.
+{
+    const int INPUT_LENGTH = static_cast<int>(input.length());
+
+    for (int size = 0; size <= INPUT_LENGTH; ++size) {
+        TYPE                       expected = TYPE();
+        bdlsb::FixedMemInStreamBuf reference(input.data(), size);
+        const int                  expectedRc = BerUtil::getValue(&reference,
+                                                                  &expected,
+                                                                  length);
+
+        TYPE      value = TYPE();
+        InBuf     mX(input.data(), size);
+        const int rc = Util::getValue(&mX, &value, length);
+
+        if (0 == rc) {
+            ASSERTV(line, size, 0 == expectedRc);
+            ASSERTV(line, size, expected == value);
+            ASSERTV(line, size, reference.length() == mX.numRemaining());
+            ASSERTV(line, size, length == static_cast<int>(mX.numConsumed()));
+        }
+        else {
+            ASSERTV(line, size, TYPE() == value);
+            ASSERTV(line, size, 0 == mX.numConsumed());
+        }
+    }
+}
+
+template <class TYPE>
+bool isFastGetValue(const bsl::string& input, int length)
+    // Return 'true' if 'balber::BerContiguousUtil::getValue' decodes a 'TYPE'
+    // from the specified 'length' contents octets of the specified 'input',
+    // and 'false' otherwise.
+{
+    TYPE  value = TYPE();
+    InBuf mX(input.data(), input.length());
+    return 0 == Util::getValue(&mX, &value, length);
+}
+
+template <class TYPE>
+void verifyPutValue(int line, const TYPE& value, bool fast)
+    // Verify that 'balber::BerContiguousUtil::putValue' for the specified
+    // 'value', at every capacity from 0 to one more than the length of its
+    // encoding, either produces the same octets as 'balber::BerUtil::putValue'
+    // or declines with no effect, and that it declines only for capacities
+    // too small for the encoding if the specified 'fast' is 'true', and for
+    // every capacity otherwise.  Use the specified 'line' to report errors.
+{
+    bdlsb::MemOutStreamBuf reference;
+    ASSERTV(line, 0 == BerUtil::putValue(&reference, value));
+
+    const int REF_LENGTH = static_cast<int>(reference.length());
+
+    bsl::vector<int> capacities;
+    if (REF_LENGTH < 64) {
+        for (int capacity = 0; capacity <= REF_LENGTH + 1; ++capacity) {
+            capacities.push_back(capacity);
+        }
+    }
+    else {
+        const int CAPACITIES[] = { 0, 1, 2, 3, REF_LENGTH - 1, REF_LENGTH,
+                                   REF_LENGTH + 1 };
+        capacities.assign(CAPACITIES,
+                          CAPACITIES + sizeof CAPACITIES / sizeof *CAPACITIES);
+    }
+
+    for (bsl::size_t ci = 0; ci < capacities.size(); ++ci) {
+        const int CAPACITY = capacities[ci];
+
+        bsl::vector<char> buffer(CAPACITY + 1, static_cast<char>(k_FILL));
+        OutBuf            mX(buffer.data(), CAPACITY);
+
+        const int rc = Util::putValue(&mX, value);
+
+        if (!fast) {
+            ASSERTV(line, CAPACITY, 0 != rc);
+        }
+        else if (REF_LENGTH <= CAPACITY) {
+            ASSERTV(line, CAPACITY, 0 == rc);
+        }
+        if (0 == rc) {
+            ASSERTV(line, CAPACITY, REF_LENGTH == static_cast<int>(
+                                                                mX.length()));
+            ASSERTV(line, CAPACITY, 0 == bsl::memcmp(reference.data(),
+                                                     buffer.data(),
+                                                     REF_LENGTH));
+            ASSERTV(line, CAPACITY, isFilled(buffer.data() + REF_LENGTH,
+                                             CAPACITY + 1 - REF_LENGTH));
+        }
+        else {
+            ASSERTV(line, CAPACITY, 0 == mX.length());
+            ASSERTV(line, CAPACITY, isFilled(buffer.data(), CAPACITY + 1));
+        }
+    }
+}
+
+template <class TYPE>
+void loadIntegerValues(bsl::vector<TYPE> *values)
+    // Load into the specified 'values' a set of values of the integral 'TYPE'
+    // covering each encoded length, both signs, and the limits of 'TYPE'.
+{
+    values->clear();
+    values->push_back(bsl::numeric_limits<TYPE>::min());
+    values->push_back(bsl::numeric_limits<TYPE>::max());
+    for (int shift = 0; shift < static_cast<int>(sizeof(TYPE) * 8); ++shift) {
+        const Uint64 bit = 1ull << shift;
+        values->push_back(static_cast<TYPE>(bit));
+        values->push_back(static_cast<TYPE>(bit - 1));
+        values->push_back(static_cast<TYPE>(bit + 1));
+        values->push_back(static_cast<TYPE>(0 - bit));
+        values->push_back(static_cast<TYPE>(0 - bit - 1));
+    }
+}
+
+template <class TYPE>
+void verifyPutInteger(const char *typeName)
+    // Verify 'putValue' for the integral 'TYPE', identified by the specified
+    // 'typeName', on the values loaded by 'loadIntegerValues'.
+{
+    if (veryVerbose) cout << "\t" << typeName << endl;
+
+    bsl::vector<TYPE> values;
+    loadIntegerValues(&values);
+
+    for (bsl::size_t i = 0; i < values.size(); ++i) {
+        verifyPutValue(static_cast<int>(i), values[i], true);
+    }
+}
+
+template <class TYPE>
+void verifyGetInteger(const char *typeName)
+    // Verify 'getValue' for the integral 'TYPE', identified by the specified
+    // 'typeName', on the encodings of the values loaded by
+    // 'loadIntegerValues', and on a table of malformed and overlong contents.
+{
+    if (veryVerbose) cout << "\t" << typeName << endl;
+
+    bsl::vector<TYPE> values;
+    loadIntegerValues(&values);
+
+    for (bsl::size_t i = 0; i < values.size(); ++i) {
+        const TYPE VALUE = values[i];
+
+        // Decode the encoding of 'VALUE', without its length octet.
+
+        bdlsb::MemOutStreamBuf encoding;
+        BerUtil::putValue(&encoding, VALUE);
+
+        const bsl::string CONTENTS(encoding.data() + 1,
+                                   encoding.length() - 1);
+        const int         LENGTH = static_cast<int>(CONTENTS.length());
+
+        verifyGetValue<TYPE>(static_cast<int>(i), CONTENTS, LENGTH);
+        ASSERTV(typeName, i, isFastGetValue<TYPE>(CONTENTS, LENGTH));
+
+        TYPE  value = 0;
+        InBuf mX(CONTENTS.data(), CONTENTS.length());
+        ASSERTV(typeName, i, 0 == Util::getValue(&mX, &value, LENGTH));
+        ASSERTV(typeName, i, VALUE == value);
+    }
+
+    // Malformed and uncommon contents, including overlong encodings.
+
+    static const struct {
+        int         d_line;
+        const char *d_contents;
+    } DATA[] = {
+        { L_, ""                           },
+        { L_, "00"                         },
+        { L_, "FF"                         },
+        { L_, "00 80"                      },
+        { L_, "FF 7F"                      },
+        { L_, "01 02 03 04 05"             },
+        { L_, "00 FF FF FF FF"             },
+        { L_, "01 FF FF FF FF"             },
+        { L_, "00 FF FF FF FF FF FF FF FF" },
+        { L_, "01 FF FF FF FF FF FF FF FF" },
+        { L_, "00 01 02 03 04 05 06 07 08" },
+    };
+    const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int         LINE     = DATA[ti].d_line;
+        const bsl::string CONTENTS = fromHex(DATA[ti].d_contents);
+        const int         LENGTH   = static_cast<int>(CONTENTS.length());
+
+        verifyGetValue<TYPE>(LINE, CONTENTS, LENGTH);
+        verifyGetValue<TYPE>(LINE, CONTENTS, LENGTH + 1);
+        if (0 < LENGTH) {
+            verifyGetValue<TYPE>(LINE, CONTENTS, LENGTH - 1);
+        }
+    }
+}
+
+// ============================================================================
+//                          PERFORMANCE TEST HELPERS
+// ----------------------------------------------------------------------------
+
+static unsigned s_antiOptimization = 0;
+
+bsl::string makeIntegerElements(int numElements)
+    // Return the BER encoding of the specified 'numElements' context-specific
+    // primitive elements having tag numbers and integer values of various
+    // magnitudes.
+{
+    bdlsb::MemOutStreamBuf out;
+    for (int i = 0; i < numElements; ++i) {
+        BerUtil::putIdentifierOctets(&out,
+                                     Constants::e_CONTEXT_SPECIFIC,
+                                     Constants::e_PRIMITIVE,
+                                     i % 30);
+        BerUtil::putValue(&out, (i * 7919) % (1 << (i % 31)));
+    }
+    return bsl::string(out.data(), out.length());
+}
+
+double timeDecode(const bsl::string& input, bool fast, int numIterations)
+    // Decode the elements in the specified 'input' the specified
+    // 'numIterations' times, using 'balber::BerContiguousUtil' with a
+    // 'balber::BerUtil' fallback if the specified 'fast' is 'true', and
+    // 'balber::BerUtil' on a 'bdlsb::FixedMemInStreamBuf' otherwise, and
+    // return the elapsed time, in seconds, of the median of several trials.
+{
+    enum { k_NUM_TRIALS = 11 };
+
+    bsl::vector<double> times;
+    for (int trial = 0; trial < k_NUM_TRIALS; ++trial) {
+        bsls::Stopwatch timer;
+        timer.start();
+        for (int iteration = 0; iteration < numIterations; ++iteration) {
+            InBuf                      contiguous(input.data(),
+                                                  input.length());
+            bdlsb::FixedMemInStreamBuf fixed(input.data(), input.length());
+
+            bsl::streambuf *streamBuf = fast
+                                      ? static_cast<bsl::streambuf *>(
+                                                                  &contiguous)
+                                      : &fixed;
+
+            int numConsumed = 0;
+            while (0 < streamBuf->in_avail()) {
+                Constants::TagClass tagClass;
+                Constants::TagType  tagType;
+                int                 tagNumber;
+                int                 length;
+                int                 value;
+
+                if (!fast || 0 != Util::getTagHeader(&contiguous,
+                                                     &tagClass,
+                                                     &tagType,
+                                                     &tagNumber,
+                                                     &length,
+                                                     &numConsumed)) {
+                    BerUtil::getIdentifierOctets(streamBuf,
+                                                 &tagClass,
+                                                 &tagType,
+                                                 &tagNumber,
+                                                 &numConsumed);
+                    BerUtil::getLength(streamBuf, &length, &numConsumed);
+                }
+                if (!fast || 0 != Util::getValue(&contiguous,
+                                                 &value,
+                                                 length)) {
+                    BerUtil::getValue(streamBuf, &value, length);
+                }
+                s_antiOptimization += value + tagNumber;
+            }
+            s_antiOptimization += numConsumed;
+        }
+        timer.stop();
+        times.push_back(timer.accumulatedWallTime());
+    }
+    bsl::sort(times.begin(), times.end());
+    return times[k_NUM_TRIALS / 2];
+}
+
+double timeEncode(int numElements, bool fast, int numIterations)
+    // Encode the specified 'numElements' tagged integer elements the
+    // specified 'numIterations' times into a pre-sized buffer, using
+    // 'balber::BerContiguousUtil' with a 'balber::BerUtil' fallback if the
+    // specified 'fast' is 'true', and 'balber::BerUtil' otherwise, and return
+    // the elapsed time, in seconds, of the median of several trials.
+{
+    enum { k_NUM_TRIALS = 11 };
+
+    bsl::vector<char>   buffer(numElements * 8);
+    bsl::vector<double> times;
+    for (int trial = 0; trial < k_NUM_TRIALS; ++trial) {
+        bsls::Stopwatch timer;
+        timer.start();
+        for (int iteration = 0; iteration < numIterations; ++iteration) {
+            OutBuf out(buffer.data(), buffer.size());
+            for (int i = 0; i < numElements; ++i) {
+                const int value = (i * 7919) % (1 << (i % 31));
+                if (!fast || 0 != Util::putIdentifierOctets(
+                                                &out,
+                                                Constants::e_CONTEXT_SPECIFIC,
+                                                Constants::e_PRIMITIVE,
+                                                i % 30)) {
+                    BerUtil::putIdentifierOctets(
+                                                &out,
+                                                Constants::e_CONTEXT_SPECIFIC,
+                                                Constants::e_PRIMITIVE,
+                                                i % 30);
+                }
+                if (!fast || 0 != Util::putValue(&out, value)) {
+                    BerUtil::putValue(&out, value);
+                }
+            }
+            s_antiOptimization += static_cast<unsigned>(out.length());
+        }
+        timer.stop();
+        times.push_back(timer.accumulatedWallTime());
+    }
+    bsl::sort(times.begin(), times.end());
+    return times[k_NUM_TRIALS / 2];
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding Primitives From a Buffer
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a buffer holding the BER encoding of a tagged integer, and
+// we want to decode it, falling back on 'balber::BerUtil' as needed.
+//
+// First, we encode the tag and the value into a buffer using a
+// 'balber::BerContiguousOutStreamBuf':
+//..
+    char                              buffer[32];
+    balber::BerContiguousOutStreamBuf osb(buffer, sizeof buffer);
+
+    int rc = balber::BerContiguousUtil::putIdentifierOctets(
+                                          &osb,
+                                          balber::BerConstants::e_UNIVERSAL,
+                                          balber::BerConstants::e_PRIMITIVE,
+                                          2);
+    ASSERT(0 == rc);
+    rc = balber::BerContiguousUtil::putValue(&osb, 1234);
+    ASSERT(0 == rc);
+    ASSERT(4 == osb.length());
+//..
+// Then, we create a 'balber::BerContiguousInStreamBuf' over the encoded data,
+// and decode the tag header:
+//..
+    balber::BerContiguousInStreamBuf isb(osb.data(), osb.length());
+
+    balber::BerConstants::TagClass tagClass;
+    balber::BerConstants::TagType  tagType;
+    int                            tagNumber;
+    int                            length;
+    int                            numBytesConsumed = 0;
+
+    rc = balber::BerContiguousUtil::getTagHeader(&isb,
+                                                 &tagClass,
+                                                 &tagType,
+                                                 &tagNumber,
+                                                 &length,
+                                                 &numBytesConsumed);
+    if (0 != rc) {
+        rc  = balber::BerUtil::getIdentifierOctets(&isb,
+                                                   &tagClass,
+                                                   &tagType,
+                                                   &tagNumber,
+                                                   &numBytesConsumed);
+        rc |= balber::BerUtil::getLength(&isb, &length, &numBytesConsumed);
+    }
+    ASSERT(0                                 == rc);
+    ASSERT(balber::BerConstants::e_UNIVERSAL == tagClass);
+    ASSERT(balber::BerConstants::e_PRIMITIVE == tagType);
+    ASSERT(2                                 == tagNumber);
+    ASSERT(2                                 == length);
+    ASSERT(2                                 == numBytesConsumed);
+//..
+// Finally, we decode the value, again with a fallback:
+//..
+    int value;
+    rc = balber::BerContiguousUtil::getValue(&isb, &value, length);
+    if (0 != rc) {
+        rc = balber::BerUtil::getValue(&isb, &value, length);
+    }
+    ASSERT(0    == rc);
+    ASSERT(1234 == value);
+    ASSERT(0    == isb.numRemaining());
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // 'putValue'
+        //
+        // Concerns:
+        //: 1 For 'bool', every integral type other than character types, and
+        //:   'bsl::string', 'putValue' writes exactly the octets written by
+        //:   'BerUtil::putValue', whenever the capacity suffices.
+        //:
+        //: 2 Otherwise, 'putValue' returns a non-zero value and writes
+        //:   nothing.
+        //:
+        //: 3 Strings use short and long form length octets as 'BerUtil'
+        //:   does.
+        //:
+        //: 4 'putValue' declines every other type.
+        //
+        // Plan:
+        //: 1 For boundary values of each supported type, compare the output
+        //:   of 'putValue' with that of 'BerUtil::putValue' at every capacity
+        //:   up to one more than the length of the encoding.  (C-1..3)
+        //:
+        //: 2 Verify that 'putValue' declines 'char', 'double', and
+        //:   'bslstl::StringRef' values at any capacity.  (C-4)
+        //
+        // Testing:
+        //   int putValue(OutBuf *, const TYPE& value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'putValue'" << endl
+                          << "==========" << endl;
+
+        if (verbose) cout << "\nIntegral types." << endl;
+        {
+            verifyPutInteger<short>("short");
+            verifyPutInteger<unsigned short>("unsigned short");
+            verifyPutInteger<int>("int");
+            verifyPutInteger<unsigned int>("unsigned int");
+            verifyPutInteger<long>("long");
+            verifyPutInteger<unsigned long>("unsigned long");
+            verifyPutInteger<Int64>("Int64");
+            verifyPutInteger<Uint64>("Uint64");
+        }
+
+        if (verbose) cout << "\n'bool'." << endl;
+        {
+            verifyPutValue(L_, false, true);
+            verifyPutValue(L_, true,  true);
+        }
+
+        if (verbose) cout << "\n'bsl::string'." << endl;
+        {
+            static const int LENGTHS[] = {
+                0, 1, 2, 126, 127, 128, 129, 255, 256, 257, 65535, 65536,
+                65537, 1 << 24
+            };
+            const int NUM_LENGTHS = static_cast<int>(sizeof LENGTHS
+                                                     / sizeof *LENGTHS);
+
+            for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                const int LENGTH = LENGTHS[ti];
+
+                if (veryVerbose) { T_ P(LENGTH) }
+
+                bsl::string value(LENGTH, 'x');
+                for (int i = 0; i < LENGTH; i += 7) {
+                    value[i] = static_cast<char>(i);
+                }
+                verifyPutValue(LENGTH, value, true);
+            }
+        }
+
+        if (verbose) cout << "\nUnsupported types." << endl;
+        {
+            verifyPutValue(L_, 'a',                     false);
+            verifyPutValue(L_, 1.5,                     false);
+            verifyPutValue(L_, bslstl::StringRef("abc"), false);
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'putIdentifierOctets', 'putIndefiniteLengthOctet', AND
+        // 'putEndOfContentOctets'
+        //
+        // Concerns:
+        //: 1 'putIdentifierOctets' writes the same octet as
+        //:   'BerUtil::putIdentifierOctets' for every tag class, tag type,
+        //:   and tag number up to 30, and declines larger tag numbers.
+        //:
+        //: 2 'putIndefiniteLengthOctet' and 'putEndOfContentOctets' write the
+        //:   same octets as their 'BerUtil' counterparts.
+        //:
+        //: 3 Each function writes nothing, and returns a non-zero value, if
+        //:   the capacity is insufficient.
+        //
+        // Plan:
+        //: 1 For every tag class and type, and tag numbers up to 100, compare
+        //:   the output of 'putIdentifierOctets' at capacities 0 to 2 with
+        //:   that of 'BerUtil::putIdentifierOctets'.  (C-1, 3)
+        //:
+        //: 2 Compare the output of the other two functions with that of
+        //:   'BerUtil' at capacities 0 to 3.  (C-2..3)
+        //
+        // Testing:
+        //   int putIdentifierOctets(OutBuf *, TagClass, TagType, int);
+        //   int putIndefiniteLengthOctet(OutBuf *);
+        //   int putEndOfContentOctets(OutBuf *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'putIdentifierOctets', "
+                          << "'putIndefiniteLengthOctet', AND "
+                          << "'putEndOfContentOctets'" << endl
+                          << "=================================="
+                          << "=============================" << endl;
+
+        static const Constants::TagClass CLASSES[] = {
+            Constants::e_UNIVERSAL,
+            Constants::e_APPLICATION,
+            Constants::e_CONTEXT_SPECIFIC,
+            Constants::e_PRIVATE
+        };
+        static const Constants::TagType TYPES[] = {
+            Constants::e_PRIMITIVE,
+            Constants::e_CONSTRUCTED
+        };
+
+        if (verbose) cout << "\n'putIdentifierOctets'." << endl;
+
+        for (int ci = 0; ci < 4; ++ci) {
+        for (int ti = 0; ti < 2;   ++ti) {
+        for (int tag = 0; tag <= 100; ++tag) {
+            const Constants::TagClass CLASS = CLASSES[ci];
+            const Constants::TagType  TYPE  = TYPES[ti];
+
+            bdlsb::MemOutStreamBuf reference;
+            BerUtil::putIdentifierOctets(&reference, CLASS, TYPE, tag);
+
+            for (int capacity = 0; capacity <= 2; ++capacity) {
+                char   buffer[3] = { static_cast<char>(k_FILL),
+                                     static_cast<char>(k_FILL),
+                                     static_cast<char>(k_FILL) };
+                OutBuf mX(buffer, capacity);
+
+                const int rc = Util::putIdentifierOctets(&mX,
+                                                         CLASS,
+                                                         TYPE,
+                                                         tag);
+
+                if (tag <= 30 && 1 <= capacity) {
+                    ASSERTV(ci, ti, tag, capacity, 0 == rc);
+                    ASSERTV(ci, ti, tag, capacity, 1 == mX.length());
+                    ASSERTV(ci, ti, tag, capacity,
+                            1 == reference.length());
+                    ASSERTV(ci, ti, tag, capacity,
+                            reference.data()[0] == buffer[0]);
+                    ASSERTV(ci, ti, tag, capacity,
+                            isFilled(buffer + 1, 2));
+                }
+                else {
+                    ASSERTV(ci, ti, tag, capacity, 0 != rc);
+                    ASSERTV(ci, ti, tag, capacity, 0 == mX.length());
+                    ASSERTV(ci, ti, tag, capacity, isFilled(buffer, 3));
+                }
+            }
+        }
+        }
+        }
+
+        if (verbose) cout << "\nLength and end-of-contents octets." << endl;
+
+        for (int fi = 0; fi < 2; ++fi) {
+            bdlsb::MemOutStreamBuf reference;
+            if (0 == fi) {
+                BerUtil::putIndefiniteLengthOctet(&reference);
+            }
+            else {
+                BerUtil::putEndOfContentOctets(&reference);
+            }
+            const int REF_LENGTH = static_cast<int>(reference.length());
+
+            for (int capacity = 0; capacity <= 3; ++capacity) {
+                char   buffer[4];
+                bsl::memset(buffer, k_FILL, sizeof buffer);
+                OutBuf mX(buffer, capacity);
+
+                const int rc = 0 == fi ? Util::putIndefiniteLengthOctet(&mX)
+                                       : Util::putEndOfContentOctets(&mX);
+
+                if (REF_LENGTH <= capacity) {
+                    ASSERTV(fi, capacity, 0 == rc);
+                    ASSERTV(fi, capacity, REF_LENGTH == (int)mX.length());
+                    ASSERTV(fi, capacity, 0 == bsl::memcmp(reference.data(),
+                                                           buffer,
+                                                           REF_LENGTH));
+                    ASSERTV(fi, capacity, isFilled(buffer + REF_LENGTH,
+                                                   4 - REF_LENGTH));
+                }
+                else {
+                    ASSERTV(fi, capacity, 0 != rc);
+                    ASSERTV(fi, capacity, 0 == mX.length());
+                    ASSERTV(fi, capacity, isFilled(buffer, 4));
+                }
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'getValue'
+        //
+        // Concerns:
+        //: 1 For 'bool', every integral type other than character types, and
+        //:   'bsl::string', 'getValue' decodes the same value, and consumes
+        //:   the same octets, as 'BerUtil::getValue', or declines with no
+        //:   effect, for every length and truncation of the input.
+        //:
+        //: 2 'getValue' decodes every minimal encoding of an integer, and a
+        //:   large unsigned integer preceded by a 0 octet.
+        //:
+        //: 3 'getValue' declines empty contents, which 'BerUtil' decodes
+        //:   according to the decoder options or the following octets.
+        //:
+        //: 4 'getValue' declines every other type.
+        //
+        // Plan:
+        //: 1 For the integral types, decode the contents of the encodings of
+        //:   boundary values, and a table of malformed or overlong contents,
+        //:   comparing with 'BerUtil::getValue' at every truncation.  (C-1..3)
+        //:
+        //: 2 Repeat for a table of 'bool' and 'bsl::string' contents.  (C-1,
+        //:   3)
+        //:
+        //: 3 Verify that 'getValue' declines 'char' and 'double'.  (C-4)
+        //
+        // Testing:
+        //   int getValue(InBuf *, TYPE *value, int length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'getValue'" << endl
+                          << "==========" << endl;
+
+        if (verbose) cout << "\nIntegral types." << endl;
+        {
+            verifyGetInteger<short>("short");
+            verifyGetInteger<unsigned short>("unsigned short");
+            verifyGetInteger<int>("int");
+            verifyGetInteger<unsigned int>("unsigned int");
+            verifyGetInteger<long>("long");
+            verifyGetInteger<unsigned long>("unsigned long");
+            verifyGetInteger<Int64>("Int64");
+            verifyGetInteger<Uint64>("Uint64");
+
+            ASSERT(!isFastGetValue<int>(bsl::string(), 0));
+            ASSERT(!isFastGetValue<int>(fromHex("00"), 0));
+        }
+
+        if (verbose) cout << "\n'bool' and 'bsl::string'." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_contents;
+                int         d_length;
+                bool        d_fastBool;    // 'bool' fast path taken
+                bool        d_fastString;  // 'bsl::string' fast path taken
+            } DATA[] = {
+                //LINE  CONTENTS     LENGTH  FAST BOOL  FAST STRING
+                //----  --------     ------  ---------  -----------
+                { L_,   "",               0, false,     false       },
+                { L_,   "00",             0, false,     false       },
+                { L_,   "00",             1, true,      true        },
+                { L_,   "01",             1, true,      true        },
+                { L_,   "FF",             1, true,      true        },
+                { L_,   "00 00",          2, false,     true        },
+                { L_,   "41 42 43",       3, false,     true        },
+                { L_,   "41 42 43",       4, false,     false       },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE        = DATA[ti].d_line;
+                const bsl::string CONTENTS    = fromHex(DATA[ti].d_contents);
+                const int         LENGTH      = DATA[ti].d_length;
+                const bool        FAST_BOOL   = DATA[ti].d_fastBool;
+                const bool        FAST_STRING = DATA[ti].d_fastString;
+
+                if (veryVerbose) { T_ P_(LINE) P(LENGTH) }
+
+                verifyGetValue<bool>(LINE, CONTENTS, LENGTH);
+                verifyGetValue<bsl::string>(LINE, CONTENTS, LENGTH);
+
+                ASSERTV(LINE, FAST_BOOL   == isFastGetValue<bool>(CONTENTS,
+                                                                  LENGTH));
+                ASSERTV(LINE, FAST_STRING ==
+                                  isFastGetValue<bsl::string>(CONTENTS,
+                                                              LENGTH));
+            }
+        }
+
+        if (verbose) cout << "\nUnsupported types." << endl;
+        {
+            ASSERT(!isFastGetValue<char>(fromHex("41"), 1));
+            ASSERT(!isFastGetValue<double>(fromHex("80 00 01"), 3));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'getTagHeader' AND 'getEndOfContentOctets'
+        //
+        // Concerns:
+        //: 1 'getTagHeader' decodes single-octet identifiers followed by
+        //:   short, indefinite, or long form (up to 4 octets) lengths,
+        //:   consuming and loading exactly what 'BerUtil::getIdentifierOctets'
+        //:   followed by 'BerUtil::getLength' does.
+        //:
+        //: 2 'getTagHeader' declines multi-octet identifiers, long form
+        //:   lengths of more than 4 octets, and every truncated header, with
+        //:   no effect on the stream buffer or its arguments.
+        //:
+        //: 3 'getEndOfContentOctets' consumes two zero octets, adding 2 to
+        //:   the accumulator, and declines anything else with no effect.
+        //
+        // Plan:
+        //: 1 Using a table of headers, decode each header, at every
+        //:   truncation, both with 'getTagHeader' and with 'BerUtil', and
+        //:   compare.  Verify the expected fast path outcome for each whole
+        //:   header.  (C-1..2)
+        //:
+        //: 2 Repeat for a table of end-of-contents candidates.  (C-3)
+        //
+        // Testing:
+        //   int getTagHeader(InBuf*, TagClass*, TagType*, int*, int*, int*);
+        //   int getEndOfContentOctets(InBuf *, int *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'getTagHeader' AND 'getEndOfContentOctets'"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        if (verbose) cout << "\n'getTagHeader'." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_header;
+                bool        d_fast;    // fast path taken for whole header
+            } DATA[] = {
+                //LINE  HEADER                  FAST
+                //----  ------                  -----
+                { L_,   "",                     false },
+                { L_,   "02",                   false },
+                { L_,   "02 00",                true  },
+                { L_,   "02 01",                true  },
+                { L_,   "A1 7F",                true  },
+                { L_,   "30 80",                true  },
+                { L_,   "DE 05",                true  },
+                { L_,   "FF 05",                false },
+                { L_,   "1F 1F 05",             false },
+                { L_,   "BF 81 00 80",          false },
+                { L_,   "02 81 80",             true  },
+                { L_,   "02 81 FF",             true  },
+                { L_,   "02 82 01 00",          true  },
+                { L_,   "02 83 01 00 00",       true  },
+                { L_,   "02 84 7F FF FF FF",    true  },
+                { L_,   "02 84 80 00 00 00",    true  },
+                { L_,   "02 84 FF FF FF FF",    true  },
+                { L_,   "02 85 00 00 00 00 01", false },
+                { L_,   "02 FF",                false },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE   = DATA[ti].d_line;
+                const bsl::string HEADER = fromHex(DATA[ti].d_header);
+                const bool        FAST   = DATA[ti].d_fast;
+                const int         SIZE   = static_cast<int>(HEADER.length());
+
+                if (veryVerbose) { T_ P_(LINE) P(DATA[ti].d_header) }
+
+                for (int size = 0; size <= SIZE; ++size) {
+                    bdlsb::FixedMemInStreamBuf reference(HEADER.data(), size);
+
+                    Constants::TagClass expClass  = Constants::e_UNIVERSAL;
+                    Constants::TagType  expType   = Constants::e_PRIMITIVE;
+                    int                 expNumber = -1;
+                    int                 expLength = -2;
+                    int                 expAccum  = 10;
+
+                    int expRc = BerUtil::getIdentifierOctets(&reference,
+                                                             &expClass,
+                                                             &expType,
+                                                             &expNumber,
+                                                             &expAccum);
+                    if (0 == expRc) {
+                        expRc = BerUtil::getLength(&reference,
+                                                   &expLength,
+                                                   &expAccum);
+                    }
+
+                    Constants::TagClass tagClass  = Constants::e_UNIVERSAL;
+                    Constants::TagType  tagType   = Constants::e_PRIMITIVE;
+                    int                 tagNumber = -1;
+                    int                 length    = -2;
+                    int                 accum     = 10;
+
+                    InBuf     mX(HEADER.data(), size);
+                    const int rc = Util::getTagHeader(&mX,
+                                                      &tagClass,
+                                                      &tagType,
+                                                      &tagNumber,
+                                                      &length,
+                                                      &accum);
+
+                    if (size == SIZE) {
+                        ASSERTV(LINE, rc, FAST == (0 == rc));
+                    }
+
+                    if (0 == rc) {
+                        ASSERTV(LINE, size, 0         == expRc);
+                        ASSERTV(LINE, size, expClass  == tagClass);
+                        ASSERTV(LINE, size, expType   == tagType);
+                        ASSERTV(LINE, size, expNumber == tagNumber);
+                        ASSERTV(LINE, size, expLength == length);
+                        ASSERTV(LINE, size, expAccum  == accum);
+                        ASSERTV(LINE, size,
+                                reference.length() == mX.numRemaining());
+                        ASSERTV(LINE, size,
+                                accum - 10 == (int)mX.numConsumed());
+                    }
+                    else {
+                        ASSERTV(LINE, size, Constants::e_UNIVERSAL
+                                                                 == tagClass);
+                        ASSERTV(LINE, size, Constants::e_PRIMITIVE
+                                                                  == tagType);
+                        ASSERTV(LINE, size, -1 == tagNumber);
+                        ASSERTV(LINE, size, -2 == length);
+                        ASSERTV(LINE, size, 10 == accum);
+                        ASSERTV(LINE, size,  0 == mX.numConsumed());
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\n'getEndOfContentOctets'." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_input;
+                bool        d_fast;    // fast path taken for whole input
+            } DATA[] = {
+                //LINE  INPUT       FAST
+                //----  -----       -----
+                { L_,   "",         false },
+                { L_,   "00",       false },
+                { L_,   "00 00",    true  },
+                { L_,   "00 00 00", true  },
+                { L_,   "00 01",    false },
+                { L_,   "01 00",    false },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE  = DATA[ti].d_line;
+                const bsl::string INPUT = fromHex(DATA[ti].d_input);
+                const bool        FAST  = DATA[ti].d_fast;
+
+                int       accum = 3;
+                InBuf     mX(INPUT.data(), INPUT.length());
+                const int rc = Util::getEndOfContentOctets(&mX, &accum);
+
+                ASSERTV(LINE, FAST == (0 == rc));
+                ASSERTV(LINE, (FAST ? 5 : 3) == accum);
+                ASSERTV(LINE, (FAST ? 2 : 0) == mX.numConsumed());
+
+                if (FAST) {
+                    int                        expAccum = 3;
+                    bdlsb::FixedMemInStreamBuf reference(INPUT.data(),
+                                                         INPUT.length());
+                    ASSERTV(LINE, 0 == BerUtil::getEndOfContentOctets(
+                                                                 &reference,
+                                                                 &expAccum));
+                    ASSERTV(LINE, expAccum == accum);
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'BerContiguousOutStreamBuf'
+        //
+        // Concerns:
+        //: 1 A newly created stream buffer is empty, and writes into the
+        //:   supplied buffer, starting at its first octet.
+        //:
+        //: 2 'sputc' and 'sputn' write into the buffer until it is full, and
+        //:   fail, or write only what fits, beyond its capacity.
+        //:
+        //: 3 'advance' marks octets written directly at 'cursor' as written.
+        //:
+        //: 4 The accessors report the written length, the capacity, and the
+        //:   remaining capacity.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create stream buffers over buffers of several capacities, write
+        //:   to them with 'sputc', 'sputn', and 'cursor' and 'advance', and
+        //:   verify the contents of the buffer and the accessors.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   BerContiguousOutStreamBuf(char *buffer, size_t capacity);
+        //   ~BerContiguousOutStreamBuf();
+        //   void advance(int numBytes);
+        //   char *cursor();
+        //   size_t capacity() const;
+        //   const char *data() const;
+        //   size_t length() const;
+        //   size_t numRemaining() const;
+        //   int_type overflow(int_type character);
+        //   streamsize xsputn(const char_type *source, streamsize length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'BerContiguousOutStreamBuf'" << endl
+                          << "===========================" << endl;
+
+        const char SOURCE[] = "abcdefghijklmnopqrstuvwxyz";
+
+        for (int capacity = 0; capacity <= 8; ++capacity) {
+            char buffer[10];
+            bsl::memset(buffer, k_FILL, sizeof buffer);
+
+            OutBuf mX(buffer, capacity);  const OutBuf& X = mX;
+
+            ASSERTV(capacity, buffer   == X.data());
+            ASSERTV(capacity, buffer   == mX.cursor());
+            ASSERTV(capacity, 0        == X.length());
+            ASSERTV(capacity, capacity == (int)X.capacity());
+            ASSERTV(capacity, capacity == (int)X.numRemaining());
+
+            // 'sputc' up to 2 characters.
+
+            int numWritten = 0;
+            for (int i = 0; i < 2; ++i) {
+                const int rc = mX.sputc(SOURCE[numWritten]);
+                if (numWritten < capacity) {
+                    ASSERTV(capacity, i, SOURCE[numWritten] == rc);
+                    ++numWritten;
+                }
+                else {
+                    ASSERTV(capacity, i, OutBuf::traits_type::eof() == rc);
+                }
+            }
+
+            // 'cursor' and 'advance' for 1 character, if it fits.
+
+            if (numWritten < capacity) {
+                ASSERTV(capacity, buffer + numWritten == mX.cursor());
+                *mX.cursor() = SOURCE[numWritten];
+                mX.advance(1);
+                ++numWritten;
+            }
+
+            // 'sputn' of 4 characters.
+
+            const bsl::streamsize expected =
+                                        bsl::min(4, capacity - numWritten);
+            ASSERTV(capacity, expected == mX.sputn(SOURCE + numWritten, 4));
+            numWritten += static_cast<int>(expected);
+
+            ASSERTV(capacity, numWritten == (int)X.length());
+            ASSERTV(capacity, capacity - numWritten == (int)X.numRemaining());
+            ASSERTV(capacity, 0 == bsl::memcmp(buffer, SOURCE, numWritten));
+            ASSERTV(capacity, isFilled(buffer + numWritten,
+                                       (int)sizeof buffer - numWritten));
+
+            if (numWritten == capacity) {
+                ASSERTV(capacity, OutBuf::traits_type::eof() == mX.sputc('x'));
+                ASSERTV(capacity, 0 == mX.sputn(SOURCE, 3));
+                ASSERTV(capacity, numWritten == (int)X.length());
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char buffer[4];
+
+            ASSERT_PASS(OutBuf(0, 0));
+            ASSERT_FAIL(OutBuf(0, 1));
+
+            OutBuf mX(buffer, sizeof buffer);
+
+            ASSERT_FAIL(mX.advance(-1));
+            ASSERT_FAIL(mX.advance(5));
+            ASSERT_PASS(mX.advance(4));
+            ASSERT_FAIL(mX.advance(1));
+            ASSERT_PASS(mX.advance(0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'BerContiguousInStreamBuf'
+        //
+        // Concerns:
+        //: 1 A newly created stream buffer is positioned at the start of the
+        //:   supplied buffer, and reads its characters in order.
+        //:
+        //: 2 'sgetn' reads at most the remaining characters, and 'in_avail'
+        //:   reports the number of remaining characters, or -1 if there are
+        //:   none.
+        //:
+        //: 3 'advance' skips characters, and the accessors report the
+        //:   position in the buffer.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create stream buffers over every prefix of a buffer, read from
+        //:   them with 'sbumpc', 'advance', and 'sgetn', and verify the
+        //:   characters read and the accessors.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   BerContiguousInStreamBuf(const char *buffer, size_t length);
+        //   ~BerContiguousInStreamBuf();
+        //   void advance(int numBytes);
+        //   const char *cursor() const;
+        //   const char *end() const;
+        //   size_t numConsumed() const;
+        //   size_t numRemaining() const;
+        //   streamsize showmanyc();
+        //   streamsize xsgetn(char_type *destination, streamsize length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'BerContiguousInStreamBuf'" << endl
+                          << "==========================" << endl;
+
+        const char SOURCE[] = "abcdefgh";
+
+        for (int length = 0; length <= 8; ++length) {
+            InBuf mX(SOURCE, length);  const InBuf& X = mX;
+
+            ASSERTV(length, SOURCE          == X.cursor());
+            ASSERTV(length, SOURCE + length == X.end());
+            ASSERTV(length, 0               == X.numConsumed());
+            ASSERTV(length, length          == (int)X.numRemaining());
+            ASSERTV(length, (length ? length : -1) == mX.in_avail());
+
+            int position = 0;
+            if (position < length) {
+                ASSERTV(length, SOURCE[0] == mX.sbumpc());
+                ++position;
+            }
+            if (position < length) {
+                mX.advance(1);
+                ++position;
+            }
+            ASSERTV(length, SOURCE + position == X.cursor());
+            ASSERTV(length, position == (int)X.numConsumed());
+
+            char            destination[8];
+            const int       expected = bsl::min(4, length - position);
+            ASSERTV(length, expected == mX.sgetn(destination, 4));
+            ASSERTV(length, 0 == bsl::memcmp(destination,
+                                             SOURCE + position,
+                                             expected));
+            position += expected;
+
+            ASSERTV(length, SOURCE + position == X.cursor());
+            ASSERTV(length, position          == (int)X.numConsumed());
+            ASSERTV(length, length - position == (int)X.numRemaining());
+
+            if (position == length) {
+                ASSERTV(length, InBuf::traits_type::eof() == mX.sgetc());
+                ASSERTV(length, 0  == mX.sgetn(destination, 4));
+                ASSERTV(length, -1 == mX.in_avail());
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(InBuf(0, 0));
+            ASSERT_FAIL(InBuf(0, 1));
+
+            InBuf mX(SOURCE, 4);
+
+            ASSERT_FAIL(mX.advance(-1));
+            ASSERT_FAIL(mX.advance(5));
+            ASSERT_PASS(mX.advance(4));
+            ASSERT_FAIL(mX.advance(1));
+            ASSERT_PASS(mX.advance(0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Encode a constructed element holding a few primitive elements
+        //:   into a 'BerContiguousOutStreamBuf' with the fast path, decode it
+        //:   from a 'BerContiguousInStreamBuf' with the fast path, and verify
+        //:   the encoding against 'BerUtil'.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        char   buffer[64];
+        OutBuf out(buffer, sizeof buffer);
+
+        ASSERT(0 == Util::putIdentifierOctets(&out,
+                                              Constants::e_UNIVERSAL,
+                                              Constants::e_CONSTRUCTED,
+                                              16));
+        ASSERT(0 == Util::putIndefiniteLengthOctet(&out));
+        ASSERT(0 == Util::putIdentifierOctets(&out,
+                                              Constants::e_CONTEXT_SPECIFIC,
+                                              Constants::e_PRIMITIVE,
+                                              0));
+        ASSERT(0 == Util::putValue(&out, -300));
+        ASSERT(0 == Util::putIdentifierOctets(&out,
+                                              Constants::e_CONTEXT_SPECIFIC,
+                                              Constants::e_PRIMITIVE,
+                                              1));
+        ASSERT(0 == Util::putValue(&out, bsl::string("hello")));
+        ASSERT(0 == Util::putIdentifierOctets(&out,
+                                              Constants::e_CONTEXT_SPECIFIC,
+                                              Constants::e_PRIMITIVE,
+                                              2));
+        ASSERT(0 == Util::putValue(&out, true));
+        ASSERT(0 == Util::putEndOfContentOctets(&out));
+
+        ASSERT(fromHex("30 80 80 02 FE D4 81 05 68 65 6C 6C 6F 82 01 01 00 00")
+                                    == bsl::string(out.data(), out.length()));
+
+        bdlsb::MemOutStreamBuf reference;
+        BerUtil::putIdentifierOctets(&reference,
+                                     Constants::e_UNIVERSAL,
+                                     Constants::e_CONSTRUCTED,
+                                     16);
+        BerUtil::putIndefiniteLengthOctet(&reference);
+        BerUtil::putIdentifierOctets(&reference,
+                                     Constants::e_CONTEXT_SPECIFIC,
+                                     Constants::e_PRIMITIVE,
+                                     0);
+        BerUtil::putValue(&reference, -300);
+        BerUtil::putIdentifierOctets(&reference,
+                                     Constants::e_CONTEXT_SPECIFIC,
+                                     Constants::e_PRIMITIVE,
+                                     1);
+        BerUtil::putValue(&reference, bsl::string("hello"));
+        BerUtil::putIdentifierOctets(&reference,
+                                     Constants::e_CONTEXT_SPECIFIC,
+                                     Constants::e_PRIMITIVE,
+                                     2);
+        BerUtil::putValue(&reference, true);
+        BerUtil::putEndOfContentOctets(&reference);
+
+        ASSERT(reference.length() == out.length());
+        ASSERT(0 == bsl::memcmp(reference.data(), buffer, out.length()));
+
+        InBuf in(out.data(), out.length());
+
+        Constants::TagClass tagClass;
+        Constants::TagType  tagType;
+        int                 tagNumber;
+        int                 length;
+        int                 accum = 0;
+
+        ASSERT(0 == Util::getTagHeader(&in,
+                                       &tagClass,
+                                       &tagType,
+                                       &tagNumber,
+                                       &length,
+                                       &accum));
+        ASSERT(Constants::e_CONSTRUCTED      == tagType);
+        ASSERT(16                            == tagNumber);
+        ASSERT(BerUtil::k_INDEFINITE_LENGTH  == length);
+
+        int intValue = 0;
+        ASSERT(0 == Util::getTagHeader(&in,
+                                       &tagClass,
+                                       &tagType,
+                                       &tagNumber,
+                                       &length,
+                                       &accum));
+        ASSERT(Constants::e_CONTEXT_SPECIFIC == tagClass);
+        ASSERT(0 == Util::getValue(&in, &intValue, length));
+        ASSERT(-300 == intValue);
+
+        bsl::string stringValue;
+        ASSERT(0 == Util::getTagHeader(&in,
+                                       &tagClass,
+                                       &tagType,
+                                       &tagNumber,
+                                       &length,
+                                       &accum));
+        ASSERT(0 == Util::getValue(&in, &stringValue, length));
+        ASSERT("hello" == stringValue);
+
+        bool boolValue = false;
+        ASSERT(0 == Util::getTagHeader(&in,
+                                       &tagClass,
+                                       &tagType,
+                                       &tagNumber,
+                                       &length,
+                                       &accum));
+        ASSERT(0 == Util::getValue(&in, &boolValue, length));
+        ASSERT(true == boolValue);
+
+        ASSERT(0  == Util::getEndOfContentOctets(&in, &accum));
+        ASSERT(10 == accum);
+        ASSERT(0  == in.numRemaining());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Decoding and encoding tagged integers with the fast path is
+        //:   faster than with 'BerUtil' alone.
+        //
+        // Plan:
+        //: 1 Time decoding a buffer of tagged integer elements, and encoding
+        //:   them into a pre-sized buffer, both ways, and report the rate of
+        //:   each.  The number of elements may be given as the second
+        //:   command-line argument.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int ARG          = argc > 2 ? atoi(argv[2]) : 0;
+        const int NUM_ELEMENTS = 0 < ARG ? ARG : 100000;
+        const int ITERATIONS   = bsl::max(1, 10000000 / NUM_ELEMENTS);
+
+        const bsl::string INPUT = makeIntegerElements(NUM_ELEMENTS);
+
+        const double decodeSlow = timeDecode(INPUT, false, ITERATIONS);
+        const double decodeFast = timeDecode(INPUT, true,  ITERATIONS);
+        const double encodeSlow = timeEncode(NUM_ELEMENTS, false, ITERATIONS);
+        const double encodeFast = timeEncode(NUM_ELEMENTS, true,  ITERATIONS);
+
+        const double MILLIONS = static_cast<double>(NUM_ELEMENTS)
+                              * ITERATIONS / 1e6;
+
+        cout << "elements  operation  streambuf(M/s)  contiguous(M/s)" << endl
+             << NUM_ELEMENTS << "  decode  " << MILLIONS / decodeSlow
+             << "  " << MILLIONS / decodeFast << endl
+             << NUM_ELEMENTS << "  encode  " << MILLIONS / encodeSlow
+             << "  " << MILLIONS / encodeFast << endl;
+
+        if (veryVerbose) {
+            P(s_antiOptimization);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -40,6 +40,7 @@ BerDecoder::BerDecoder(const BerDecoderOptions *options,
 , d_logStream(0)
 , d_severity(e_BER_SUCCESS)
 , d_streamBuf(0)
+, d_contiguousBuf_p(0)
 , d_currentDepth(0)
 , d_numUnknownElementsSkipped(0)
 , d_topNode(0)
@@ -236,18 +237,28 @@ int BerDecoder_Node::readTagHeader()
         return logError("Max depth exceeded");                        // RETURN
     }
 
-    if (0 != BerUtil::getIdentifierOctets(d_decoder->d_streamBuf,
-                                          &d_tagClass,
-                                          &d_tagType,
-                                          &d_tagNumber,
-                                          &d_consumedHeaderBytes)) {
-        return logError("Error reading BER tag");                     // RETURN
-    }
+    BerContiguousInStreamBuf *contiguousBuf = d_decoder->d_contiguousBuf_p;
+
+    if (!contiguousBuf
+     || 0 != BerContiguousUtil::getTagHeader(contiguousBuf,
+                                             &d_tagClass,
+                                             &d_tagType,
+                                             &d_tagNumber,
+                                             &d_expectedLength,
+                                             &d_consumedHeaderBytes)) {
+        if (0 != BerUtil::getIdentifierOctets(d_decoder->d_streamBuf,
+                                              &d_tagClass,
+                                              &d_tagType,
+                                              &d_tagNumber,
+                                              &d_consumedHeaderBytes)) {
+            return logError("Error reading BER tag");                 // RETURN
+        }
 
-    if (0 != BerUtil::getLength(d_decoder->d_streamBuf,
-                                &d_expectedLength,
-                                &d_consumedHeaderBytes)) {
-        return logError("Error reading BER length");                  // RETURN
+        if (0 != BerUtil::getLength(d_decoder->d_streamBuf,
+                                    &d_expectedLength,
+                                    &d_consumedHeaderBytes)) {
+            return logError("Error reading BER length");              // RETURN
+        }
     }
 
     if (d_decoder->decoderOptions()->traceLevel() > 0) {
@@ -261,7 +272,14 @@ int BerDecoder_Node::readTagHeader()
 int BerDecoder_Node::readTagTrailer()
 {
     if (BerUtil::k_INDEFINITE_LENGTH == d_expectedLength) {
-        if (0 != BerUtil::getEndOfContentOctets(d_decoder->d_streamBuf,
+        BerContiguousInStreamBuf *contiguousBuf =
+                                                 d_decoder->d_contiguousBuf_p;
+
+        if ((!contiguousBuf
+          || 0 != BerContiguousUtil::getEndOfContentOctets(
+                                                      contiguousBuf,
+                                                      &d_consumedTailBytes))
+         && 0 != BerUtil::getEndOfContentOctets(d_decoder->d_streamBuf,
                                                 &d_consumedTailBytes)) {
             return logError("Error reading end-of-contents octets");  // RETURN
         }
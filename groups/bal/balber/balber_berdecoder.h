@@ -31,6 +31,20 @@ BSLS_IDENT("$Id: $")
 // This class decodes objects based on the X.690 BER specification and is
 // restricted to types supported by the 'bdlat' framework.
 //
+///Decoding From Contiguous Memory
+///-------------------------------
+// When the stream buffer supplied to 'decode' is a
+// 'balber::BerContiguousInStreamBuf' or a 'bdlsb::FixedMemInStreamBuf', i.e.,
+// the input is held in a single contiguous buffer, the decoder reads tag
+// headers, end-of-contents octets, and the values of 'bool', integral, and
+// 'bsl::string' elements directly from that buffer (see
+// 'balber_bercontiguousutil'), rather than with one virtual stream buffer call
+// per octet.  Elements not handled that way, including those straddling the
+// end of the buffer, are decoded as for any other stream buffer, and the
+// result of decoding is the same in either case.  On return, the position of
+// a 'bdlsb::FixedMemInStreamBuf' follows the data consumed, as for any other
+// stream buffer.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -90,6 +104,7 @@ BSLS_IDENT("$Id: $")
 #include <balscm_version.h>
 
 #include <balber_berconstants.h>
+#include <balber_bercontiguousutil.h>
 #include <balber_berdecoderoptions.h>
 #include <balber_beruniversaltagnumber.h>
 #include <balber_berutil.h>
@@ -110,6 +125,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlb_variant.h>
 
+#include <bdlsb_fixedmeminstreambuf.h>
 #include <bdlsb_memoutstreambuf.h>
 
 #include <bsls_assert.h>
@@ -206,6 +222,12 @@ class BerDecoder {
 
     ErrorSeverity                    d_severity;     // error severity level
     bsl::streambuf                  *d_streamBuf;    // held, not owned
+    BerContiguousInStreamBuf        *d_contiguousBuf_p;
+                                                     // 'd_streamBuf' if its
+                                                     // data is contiguous, and
+                                                     // 0 otherwise (held, not
+                                                     // owned)
+
     int                              d_currentDepth; // current depth
 
     int                              d_numUnknownElementsSkipped;
@@ -631,7 +653,36 @@ int BerDecoder::decode(bsl::streambuf *streamBuf, TYPE *variable)
 {
     BSLS_ASSERT(0 == d_streamBuf);
 
+    BerContiguousInStreamBuf *contiguousBuf =
+                         dynamic_cast<BerContiguousInStreamBuf *>(streamBuf);
+
+    if (!contiguousBuf) {
+        bdlsb::FixedMemInStreamBuf *fixedBuf =
+                       dynamic_cast<bdlsb::FixedMemInStreamBuf *>(streamBuf);
+
+        if (fixedBuf) {
+            // Decode the unread data of 'fixedBuf' through a contiguous stream
+            // buffer, and then skip the data consumed in 'fixedBuf'.
+
+            const bsl::streamoff position = fixedBuf->pubseekoff(
+                                                         0,
+                                                         bsl::ios_base::cur,
+                                                         bsl::ios_base::in);
+
+            BerContiguousInStreamBuf input(fixedBuf->data() + position,
+                                           fixedBuf->length());
+
+            const int rc = decode(&input, variable);
+
+            fixedBuf->pubseekoff(input.numConsumed(),
+                                 bsl::ios_base::cur,
+                                 bsl::ios_base::in);
+            return rc;                                                // RETURN
+        }
+    }
+
     d_streamBuf                 = streamBuf;
+    d_contiguousBuf_p           = contiguousBuf;
     d_currentDepth              = 0;
     d_severity                  = e_BER_SUCCESS;
     d_numUnknownElementsSkipped = 0;
@@ -658,7 +709,8 @@ int BerDecoder::decode(bsl::streambuf *streamBuf, TYPE *variable)
         rc = visitor(variable);
     }
 
-    d_streamBuf = 0;
+    d_streamBuf       = 0;
+    d_contiguousBuf_p = 0;
     return rc;
 }
 
@@ -1016,10 +1068,15 @@ int BerDecoder_Node::decode(TYPE *variable, bdlat_TypeCategory::Simple)
         return logError("Expected PRIMITIVE tag type for simple type");
     }
 
-    if (BerUtil::getValue(d_decoder->d_streamBuf,
-                          variable,
-                          d_expectedLength,
-                          *d_decoder->d_options) != 0) {
+    BerContiguousInStreamBuf *contiguousBuf = d_decoder->d_contiguousBuf_p;
+
+    if ((!contiguousBuf || 0 != BerContiguousUtil::getValue(contiguousBuf,
+                                                            variable,
+                                                            d_expectedLength))
+     && 0 != BerUtil::getValue(d_decoder->d_streamBuf,
+                               variable,
+                               d_expectedLength,
+                               *d_decoder->d_options)) {
         return logError("Error reading value for simple type");
     }
 
@@ -35,12 +35,13 @@ namespace balber {
 // CREATORS
 BerEncoder::BerEncoder(const BerEncoderOptions *options,
                        bslma::Allocator        *basicAllocator)
-: d_options      (options)
-, d_allocator    (bslma::Default::allocator(basicAllocator))
-, d_logStream    (0)
-, d_severity     (e_BER_SUCCESS)
-, d_streamBuf    (0)
-, d_currentDepth (0)
+: d_options         (options)
+, d_allocator       (bslma::Default::allocator(basicAllocator))
+, d_logStream       (0)
+, d_severity        (e_BER_SUCCESS)
+, d_streamBuf       (0)
+, d_contiguousBuf_p (0)
+, d_currentDepth    (0)
 {
 }
 
@@ -146,10 +147,9 @@ int BerEncoder::encodeImpl(const bsl::vector<char>&  value,
 
     const int size = static_cast<int>(value.size());
 
-    int status = BerUtil::putIdentifierOctets(d_streamBuf,
-                                              tagClass,
-                                              BerConstants::e_PRIMITIVE,
-                                              tagNumber);
+    int status = putIdentifierOctets(tagClass,
+                                     BerConstants::e_PRIMITIVE,
+                                     tagNumber);
     status |= BerUtil::putLength(d_streamBuf, size);
 
     // If 'size == 0', don't call 'sputn()'.  If 'size != 0', then set 'status'
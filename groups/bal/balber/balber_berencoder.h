@@ -31,6 +31,17 @@ BSLS_IDENT("$Id: $")
 // This component encodes objects based on the X.690 BER specification.  It can
 // only be used with types supported by the 'bdlat' framework.
 //
+///Encoding Into Contiguous Memory
+///-------------------------------
+// When the stream buffer supplied to 'encode' is a
+// 'balber::BerContiguousOutStreamBuf', i.e., the output is a pre-sized buffer,
+// the encoder writes identifier, length, and end-of-contents octets, and the
+// values of 'bool', integral, and 'bsl::string' elements directly into that
+// buffer (see 'balber_bercontiguousutil'), rather than with one virtual stream
+// buffer call per octet.  The encoding produced is the same in either case,
+// and encoding fails if the buffer is too small.  Note that a
+// 'bdlsb::FixedMemOutStreamBuf' is encoded into as any other stream buffer.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -169,6 +180,7 @@ BSLS_IDENT("$Id: $")
 #include <balscm_version.h>
 
 #include <balber_berconstants.h>
+#include <balber_bercontiguousutil.h>
 #include <balber_berencoderoptions.h>
 #include <balber_beruniversaltagnumber.h>
 #include <balber_berutil.h>
@@ -290,6 +302,11 @@ class BerEncoder {
     ErrorSeverity                     d_severity;       // error severity
 
     bsl::streambuf                   *d_streamBuf;      // held, not owned
+
+    BerContiguousOutStreamBuf        *d_contiguousBuf_p;
+        // 'd_streamBuf' if its buffer is contiguous, and 0 otherwise (held,
+        // not owned)
+
     int                               d_currentDepth;   // current depth
 
     // NOT IMPLEMENTED
@@ -315,6 +332,27 @@ class BerEncoder {
         // Return the stream for logging.  Note the if stream has not been
         // created yet, it will be created during this call.
 
+    int putIdentifierOctets(BerConstants::TagClass tagClass,
+                            BerConstants::TagType  tagType,
+                            int                    tagNumber);
+        // Encode the identifier octets for the specified 'tagClass', 'tagType'
+        // and 'tagNumber' to the stream buffer being encoded into.  Return 0
+        // on success, and a non-zero value otherwise.
+
+    int putIndefiniteLengthOctet();
+        // Encode the indefinite-length octet to the stream buffer being
+        // encoded into.  Return 0 on success, and a non-zero value otherwise.
+
+    int putEndOfContentOctets();
+        // Encode the end-of-contents octets to the stream buffer being encoded
+        // into.  Return 0 on success, and a non-zero value otherwise.
+
+    template <class TYPE>
+    int putValue(const TYPE& value);
+        // Encode the length and contents octets of the specified 'value' to
+        // the stream buffer being encoded into.  Return 0 on success, and a
+        // non-zero value otherwise.
+
     int encodeImpl(const bsl::vector<char>&  value,
                    BerConstants::TagClass    tagClass,
                    int                       tagNumber,
@@ -665,12 +703,66 @@ bsl::ostream& BerEncoder::logStream()
     return *d_logStream;
 }
 
+inline
+int BerEncoder::putIdentifierOctets(BerConstants::TagClass tagClass,
+                                    BerConstants::TagType  tagType,
+                                    int                    tagNumber)
+{
+    if (d_contiguousBuf_p
+     && 0 == BerContiguousUtil::putIdentifierOctets(d_contiguousBuf_p,
+                                                    tagClass,
+                                                    tagType,
+                                                    tagNumber)) {
+        return 0;                                                     // RETURN
+    }
+
+    return BerUtil::putIdentifierOctets(d_streamBuf,
+                                        tagClass,
+                                        tagType,
+                                        tagNumber);
+}
+
+inline
+int BerEncoder::putIndefiniteLengthOctet()
+{
+    if (d_contiguousBuf_p
+     && 0 == BerContiguousUtil::putIndefiniteLengthOctet(d_contiguousBuf_p)) {
+        return 0;                                                     // RETURN
+    }
+
+    return BerUtil::putIndefiniteLengthOctet(d_streamBuf);
+}
+
+inline
+int BerEncoder::putEndOfContentOctets()
+{
+    if (d_contiguousBuf_p
+     && 0 == BerContiguousUtil::putEndOfContentOctets(d_contiguousBuf_p)) {
+        return 0;                                                     // RETURN
+    }
+
+    return BerUtil::putEndOfContentOctets(d_streamBuf);
+}
+
+template <class TYPE>
+inline
+int BerEncoder::putValue(const TYPE& value)
+{
+    if (d_contiguousBuf_p
+     && 0 == BerContiguousUtil::putValue(d_contiguousBuf_p, value)) {
+        return 0;                                                     // RETURN
+    }
+
+    return BerUtil::putValue(d_streamBuf, value, d_options);
+}
+
 template <typename TYPE>
 int BerEncoder::encode(bsl::streambuf *streamBuf, const TYPE& value)
 {
     BSLS_ASSERT(!d_streamBuf);
 
-    d_streamBuf = streamBuf;
+    d_streamBuf       = streamBuf;
+    d_contiguousBuf_p = dynamic_cast<BerContiguousOutStreamBuf *>(streamBuf);
     d_severity  = e_BER_SUCCESS;
 
     if (d_logStream != 0) {
@@ -698,7 +790,8 @@ int BerEncoder::encode(bsl::streambuf *streamBuf, const TYPE& value)
         rc = visitor(value);
     }
 
-    d_streamBuf = 0;
+    d_streamBuf       = 0;
+    d_contiguousBuf_p = 0;
 
     streamBuf->pubsync();
 
@@ -731,11 +824,10 @@ int BerEncoder::encodeImpl(const TYPE&                value,
 
     const BerConstants::TagType tagType = BerConstants::e_CONSTRUCTED;
 
-    int rc = BerUtil::putIdentifierOctets(d_streamBuf,
-                                          tagClass,
-                                          tagType,
-                                          tagNumber);
-    if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+    int rc = putIdentifierOctets(tagClass,
+                                 tagType,
+                                 tagNumber);
+    if (rc | putIndefiniteLengthOctet()) {
         return k_FAILURE;                                             // RETURN
     }
 
@@ -746,11 +838,10 @@ int BerEncoder::encodeImpl(const TYPE&                value,
         // According to X.694 (clause 20.4), an XML choice (not anonymous)
         // element is encoded as a sequence with 1 element.
 
-        rc = BerUtil::putIdentifierOctets(d_streamBuf,
-                                          BerConstants::e_CONTEXT_SPECIFIC,
-                                          tagType,
-                                          0);
-        if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+        rc = putIdentifierOctets(BerConstants::e_CONTEXT_SPECIFIC,
+                                 tagType,
+                                 0);
+        if (rc | putIndefiniteLengthOctet()) {
             return k_FAILURE;
         }
     }
@@ -784,10 +875,10 @@ int BerEncoder::encodeImpl(const TYPE&                value,
         // Don't waste time checking the result of this call -- the only thing
         // that can go wrong is eof, which will happen again when we call it
         // again below.
-        BerUtil::putEndOfContentOctets(d_streamBuf);
+        putEndOfContentOctets();
     }
 
-    return BerUtil::putEndOfContentOctets(d_streamBuf);
+    return putEndOfContentOctets();
 }
 
 template <typename TYPE>
@@ -805,11 +896,10 @@ int BerEncoder::encodeImpl(const TYPE&                       value,
 
         // nillable is encoded in BER as a sequence with one optional element
 
-        int rc = BerUtil::putIdentifierOctets(d_streamBuf,
-                                              tagClass,
-                                              BerConstants::e_CONSTRUCTED,
-                                              tagNumber);
-        if (rc | BerUtil::putIndefiniteLengthOctet(d_streamBuf)) {
+        int rc = putIdentifierOctets(tagClass,
+                                     BerConstants::e_CONSTRUCTED,
+                                     tagNumber);
+        if (rc | putIndefiniteLengthOctet()) {
             return k_FAILURE;
         }
 
@@ -827,7 +917,7 @@ int BerEncoder::encodeImpl(const TYPE&                       value,
             }
         } // end of bdlat_NullableValueFunctions::isNull(...)
 
-        return BerUtil::putEndOfContentOctets(d_streamBuf);
+        return putEndOfContentOctets();
     } // end of isNillable
 
     if (!bdlat_NullableValueFunctions::isNull(value)) {
@@ -875,15 +965,14 @@ int BerEncoder::encodeImpl(const TYPE&                     value,
                            int                             ,
                            bdlat_TypeCategory::Enumeration )
 {
-    int rc = BerUtil::putIdentifierOctets(d_streamBuf,
-                                          tagClass,
-                                          BerConstants::e_PRIMITIVE,
-                                          tagNumber);
+    int rc = putIdentifierOctets(tagClass,
+                                 BerConstants::e_PRIMITIVE,
+                                 tagNumber);
 
     int intValue;
     bdlat_EnumFunctions::toInt(&intValue, value);
 
-    rc |= BerUtil::putValue(d_streamBuf, intValue);
+    rc |= putValue(intValue);
 
     return rc;
 }
@@ -897,17 +986,16 @@ int BerEncoder::encodeImpl(const TYPE&                  value,
 {
     BerEncoder_Visitor visitor(this);
 
-    int rc = BerUtil::putIdentifierOctets(d_streamBuf,
-                                          tagClass,
-                                          BerConstants::e_CONSTRUCTED,
-                                          tagNumber);
-    rc |= BerUtil::putIndefiniteLengthOctet(d_streamBuf);
+    int rc = putIdentifierOctets(tagClass,
+                                 BerConstants::e_CONSTRUCTED,
+                                 tagNumber);
+    rc |= putIndefiniteLengthOctet();
     if (rc) {
         return rc;
     }
 
     rc = bdlat_SequenceFunctions::accessAttributes(value, visitor);
-    rc |= BerUtil::putEndOfContentOctets(d_streamBuf);
+    rc |= putEndOfContentOctets();
 
     return rc;
 }
@@ -919,11 +1007,10 @@ int BerEncoder::encodeImpl(const TYPE&                     value,
                                 int                        ,
                                 bdlat_TypeCategory::Simple )
 {
-    int rc = BerUtil::putIdentifierOctets(d_streamBuf,
-                                          tagClass,
-                                          BerConstants::e_PRIMITIVE,
-                                          tagNumber);
-    rc |= BerUtil::putValue(d_streamBuf, value, d_options);
+    int rc = putIdentifierOctets(tagClass,
+                                 BerConstants::e_PRIMITIVE,
+                                 tagNumber);
+    rc |= putValue(value);
 
     return rc;
 }
@@ -965,11 +1052,10 @@ BerEncoder::encodeArrayImpl(const TYPE&             value,
 
     const BerConstants::TagType tagType = BerConstants::e_CONSTRUCTED;
 
-    int rc = BerUtil::putIdentifierOctets(d_streamBuf,
-                                          tagClass,
-                                          tagType,
-                                          tagNumber);
-    rc |= BerUtil::putIndefiniteLengthOctet(d_streamBuf);
+    int rc = putIdentifierOctets(tagClass,
+                                 tagType,
+                                 tagNumber);
+    rc |= putIndefiniteLengthOctet();
     if (rc) {
         return k_FAILURE;                                             // RETURN
     }
@@ -988,7 +1074,7 @@ BerEncoder::encodeArrayImpl(const TYPE&             value,
         }
     }
 
-    return BerUtil::putEndOfContentOctets(d_streamBuf);
+    return putEndOfContentOctets();
 }
 
 template <typename TYPE>
@@ -0,0 +1,55 @@
+// balbin_decoder.cpp                                                 -*-C++-*-
+#include <balbin_decoder.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balbin_decoder_cpp,"$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace balbin {
+
+                               // -------------
+                               // class Decoder
+                               // -------------
+
+// PRIVATE MANIPULATORS
+void Decoder::logFieldError(int fieldNumber)
+{
+    d_logStream << "Could not decode field " << fieldNumber << "\n";
+}
+
+// CREATORS
+Decoder::Decoder(bslma::Allocator *basicAllocator)
+: d_buffer(basicAllocator)
+, d_logStream(basicAllocator)
+, d_currentDepth(0)
+, d_maxDepth(k_DEFAULT_MAX_DEPTH)
+{
+}
+
+Decoder::Decoder(int maxDepth, bslma::Allocator *basicAllocator)
+: d_buffer(basicAllocator)
+, d_logStream(basicAllocator)
+, d_currentDepth(0)
+, d_maxDepth(maxDepth)
+{
+    BSLS_ASSERT(0 < maxDepth);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
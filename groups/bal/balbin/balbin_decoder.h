@@ -0,0 +1,826 @@
+// balbin_decoder.h                                                   -*-C++-*-
+#ifndef INCLUDED_BALBIN_DECODER
+#define INCLUDED_BALBIN_DECODER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a decoder of 'bdlat'-compatible types from compact binary.
+//
+//@CLASSES:
+//  balbin::Decoder: decoder of 'bdlat'-compatible types from 'balbin' format
+//
+//@SEE_ALSO: balbin_encoder, balbin_wireutil, balbin_primitiveutil
+//
+//@DESCRIPTION: This component provides a class, 'balbin::Decoder', that
+// decodes value-semantic objects of types supported by the 'bdlat' framework
+// (in particular, the types generated by 'bas_codegen.pl') from the 'balbin'
+// wire format produced by 'balbin::Encoder' (see 'balbin_encoder' for a
+// description of the format).  The input is either a contiguous buffer or a
+// 'bdlbb::Blob'.
+//
+// Fields are decoded into the attribute or selection whose 'bdlat' id is the
+// field number minus one.  Fields whose number corresponds to no attribute or
+// selection of the type being decoded are skipped, so that messages produced
+// using a newer version of a schema that adds attributes or selections can be
+// decoded using an older version.  Repeated fields of an array attribute each
+// append an element to the array, and a field that occurs more than once for
+// any other attribute is decoded again into the same object, so that the last
+// occurrence of a scalar value wins.  Note that, as for the other 'bdlat'
+// decoders, attributes that do not occur in the input are left unchanged:
+// the object being decoded is normally in its default state.
+//
+// Decoding fails, and the object being decoded is left in a valid but
+// unspecified state, if the input is truncated or malformed, if the wire type
+// of a field does not match the type of the attribute it is decoded into, if
+// a value is out of the range of its type (including enumerators that are
+// not defined), or if sequences, choices, and arrays are nested more deeply
+// than the maximum depth supplied at construction (32 by default).
+//
+// When decoding from a 'bdlbb::Blob' whose data spans more than one buffer,
+// the data is first copied into a buffer owned by the decoder, and reused by
+// subsequent calls.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding a Generated Sequence Type
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have received the 'balbin' encoding of a sequence type,
+// 'test::Employee', generated from a schema, having a 'name' (id 0), a
+// 'homeAddress' (id 1), itself a sequence having 'street', 'city', and
+// 'state' strings, and an 'age' (id 2):
+//..
+//  const char INPUT[] = "\x0a\x03" "Bob"
+//                       "\x12\x24"
+//                           "\x0a\x0b" "Some Street"
+//                           "\x12\x09" "Some City"
+//                           "\x1a\x0a" "Some State"
+//                       "\x18\x2a";
+//..
+// First, we create a decoder and an employee:
+//..
+//  balbin::Decoder decoder;
+//  test::Employee  bob;
+//..
+// Then, we decode the employee:
+//..
+//  int rc = decoder.decode(INPUT, sizeof INPUT - 1, &bob);
+//  assert(0 == rc);
+//..
+// Finally, we verify the result:
+//..
+//  assert("Bob"         == bob.name());
+//  assert("Some Street" == bob.homeAddress().street());
+//  assert("Some City"   == bob.homeAddress().city());
+//  assert("Some State"  == bob.homeAddress().state());
+//  assert(21            == bob.age());
+//..
+
+#include <balscm_version.h>
+
+#include <balbin_primitiveutil.h>
+#include <balbin_wireutil.h>
+
+#include <bdlat_arrayfunctions.h>
+#include <bdlat_choicefunctions.h>
+#include <bdlat_customizedtypefunctions.h>
+#include <bdlat_enumfunctions.h>
+#include <bdlat_nullablevaluefunctions.h>
+#include <bdlat_sequencefunctions.h>
+#include <bdlat_typecategory.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmf_nil.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_ostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balbin {
+
+struct Decoder_FieldProxy;
+struct Decoder_FieldManipulator;
+struct Decoder_MemberManipulator;
+
+                               // =============
+                               // class Decoder
+                               // =============
+
+class Decoder {
+    // This class provides a mechanism for decoding value-semantic objects of
+    // sequence and choice types supported by the 'bdlat' framework from the
+    // 'balbin' wire format.  The 'decode' methods are function templates that
+    // decode a value from a contiguous buffer or a 'bdlbb::Blob'.
+
+    // PRIVATE TYPES
+    enum Mode {
+        // This enumeration defines the contexts in which a value is decoded.
+
+        e_FIELD,    // value of an attribute or selection
+        e_ELEMENT   // element of an array
+    };
+
+    typedef WireUtil::WireType WireType;
+
+    // DATA
+    bsl::string         d_buffer;        // copy of fragmented blob input
+    bsl::ostringstream  d_logStream;     // stream to record errors
+    int                 d_currentDepth;  // current nesting depth
+    int                 d_maxDepth;      // maximum nesting depth
+
+    // FRIENDS
+    friend struct Decoder_FieldProxy;
+    friend struct Decoder_FieldManipulator;
+    friend struct Decoder_MemberManipulator;
+
+    // NOT IMPLEMENTED
+    Decoder(const Decoder&);
+    Decoder& operator=(const Decoder&);
+
+    // PRIVATE MANIPULATORS
+    template <class TYPE>
+    int decodeMessage(TYPE                         *value,
+                      const char                   *begin,
+                      const char                   *end,
+                      bdlat_TypeCategory::Sequence);
+    template <class TYPE>
+    int decodeMessage(TYPE                       *value,
+                      const char                 *begin,
+                      const char                 *end,
+                      bdlat_TypeCategory::Choice);
+        // Decode into the specified 'value' the fields in the specified range
+        // '[begin, end)'.  Return 0 on success, and a non-zero value
+        // otherwise.
+
+    template <class TYPE, class ANY_CATEGORY>
+    int decodeMessage(TYPE         *value,
+                      const char   *begin,
+                      const char   *end,
+                      ANY_CATEGORY  category);
+        // Log an error and return a non-zero value, as the specified 'value'
+        // of the 'bdlat' 'category' is neither a sequence nor a choice.  The
+        // specified 'begin' and 'end' are ignored.
+
+    template <class TYPE>
+    int decodeField(TYPE         *value,
+                    WireType      wireType,
+                    const char  **cursor,
+                    const char   *end,
+                    Mode          mode);
+        // Decode into the specified 'value', in the specified 'mode', the
+        // payload having the specified 'wireType' at the specified '*cursor',
+        // not reading at or beyond the specified 'end', and advance '*cursor'
+        // past it.  Return 0 on success, and a non-zero value otherwise.
+
+    template <class TYPE>
+    int decodeImp(TYPE                         *value,
+                  WireType                      wireType,
+                  const char                  **cursor,
+                  const char                   *end,
+                  Mode                          mode,
+                  bdlat_TypeCategory::Sequence);
+    template <class TYPE>
+    int decodeImp(TYPE                       *value,
+                  WireType                    wireType,
+                  const char                **cursor,
+                  const char                 *end,
+                  Mode                        mode,
+                  bdlat_TypeCategory::Choice);
+    template <class TYPE>
+    int decodeImp(TYPE                            *value,
+                  WireType                         wireType,
+                  const char                     **cursor,
+                  const char                      *end,
+                  Mode                             mode,
+                  bdlat_TypeCategory::Enumeration);
+    template <class TYPE>
+    int decodeImp(TYPE                               *value,
+                  WireType                            wireType,
+                  const char                        **cursor,
+                  const char                         *end,
+                  Mode                                mode,
+                  bdlat_TypeCategory::CustomizedType);
+    template <class TYPE>
+    int decodeImp(TYPE                       *value,
+                  WireType                    wireType,
+                  const char                **cursor,
+                  const char                 *end,
+                  Mode                        mode,
+                  bdlat_TypeCategory::Simple);
+    template <class TYPE>
+    int decodeImp(TYPE                      *value,
+                  WireType                   wireType,
+                  const char               **cursor,
+                  const char                *end,
+                  Mode                       mode,
+                  bdlat_TypeCategory::Array);
+    template <class TYPE>
+    int decodeImp(TYPE                              *value,
+                  WireType                           wireType,
+                  const char                       **cursor,
+                  const char                        *end,
+                  Mode                               mode,
+                  bdlat_TypeCategory::NullableValue);
+    int decodeImp(bsl::vector<char>          *value,
+                  WireType                    wireType,
+                  const char                **cursor,
+                  const char                 *end,
+                  Mode                        mode,
+                  bdlat_TypeCategory::Array);
+        // Decode into the specified 'value', of the 'bdlat' category
+        // indicated by the last argument, in the specified 'mode', the payload
+        // having the specified 'wireType' at the specified '*cursor', not
+        // reading at or beyond the specified 'end', and advance '*cursor' past
+        // it.  Return 0 on success, and a non-zero value otherwise.
+
+    template <class TYPE>
+    int decodeNested(TYPE         *value,
+                     WireType      wireType,
+                     const char  **cursor,
+                     const char   *end,
+                     Mode          mode);
+        // Decode into the specified 'value', a sequence or a choice if the
+        // specified 'mode' is 'e_FIELD', and an array or a nullable value
+        // otherwise, the length-delimited payload having the specified
+        // 'wireType' at the specified '*cursor', not reading at or beyond the
+        // specified 'end', and advance '*cursor' past it.  Return 0 on
+        // success, and a non-zero value otherwise.
+
+    template <class TYPE>
+    int decodeWrapped(TYPE *value, const char *begin, const char *end);
+        // Decode into the specified 'value' the occurrences of field number 1
+        // in the specified range '[begin, end)', skipping any other field.
+        // Return 0 on success, and a non-zero value otherwise.
+
+    void logFieldError(int fieldNumber);
+        // Log that the field having the specified 'fieldNumber' could not be
+        // decoded.
+
+  public:
+    // CONSTANTS
+    enum { k_DEFAULT_MAX_DEPTH = 32 };
+
+    // CREATORS
+    explicit Decoder(bslma::Allocator *basicAllocator = 0);
+    explicit Decoder(int maxDepth, bslma::Allocator *basicAllocator = 0);
+        // Create a decoder.  Optionally specify a 'maxDepth' limiting the
+        // nesting depth of the sequences, choices, and arrays being decoded;
+        // if 'maxDepth' is not specified, 'k_DEFAULT_MAX_DEPTH' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '0 < maxDepth'.
+
+    //! ~Decoder() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    template <class TYPE>
+    int decode(const char *data, bsl::size_t length, TYPE *value);
+        // Decode into the specified 'value' the 'balbin' encoding in the
+        // specified 'length' bytes at the specified 'data' address.  Return 0
+        // on success, and a non-zero value, with 'value' in a valid but
+        // unspecified state, otherwise.  The behavior is undefined unless
+        // 'TYPE' is a sequence or a choice type supported by the 'bdlat'
+        // framework.
+
+    template <class TYPE>
+    int decode(const bdlbb::Blob& blob, TYPE *value);
+        // Decode into the specified 'value' the 'balbin' encoding held by the
+        // specified 'blob'.  Return 0 on success, and a non-zero value, with
+        // 'value' in a valid but unspecified state, otherwise.  The behavior
+        // is undefined unless 'TYPE' is a sequence or a choice type supported
+        // by the 'bdlat' framework.
+
+    // ACCESSORS
+    bsl::string loggedMessages() const;
+        // Return a string containing any error messages that have been logged
+        // by the last call to 'decode'.
+
+    int maxDepth() const;
+        // Return the maximum nesting depth of this decoder.
+};
+
+                         // =========================
+                         // struct Decoder_FieldProxy
+                         // =========================
+
+struct Decoder_FieldProxy {
+    // [!PRIVATE!] This class provides a functor that dispatches the decoding
+    // of a field to the 'decodeImp' overload of a 'Decoder' matching the
+    // 'bdlat' category of its value.
+
+    // DATA
+    Decoder             *d_decoder_p;
+    WireUtil::WireType   d_wireType;
+    const char         **d_cursor_p;
+    const char          *d_end_p;
+    Decoder::Mode        d_mode;
+
+    // MANIPULATORS
+    template <class TYPE>
+    int operator()(TYPE *value, bslmf::Nil);
+    template <class TYPE, class ANY_CATEGORY>
+    int operator()(TYPE *value, ANY_CATEGORY category);
+        // Decode into the specified 'value', of the 'bdlat' category indicated
+        // by the last argument.  Return 0 on success, and a non-zero value
+        // otherwise.
+};
+
+                      // ===============================
+                      // struct Decoder_FieldManipulator
+                      // ===============================
+
+struct Decoder_FieldManipulator {
+    // [!PRIVATE!] This class provides a functor that decodes a field into an
+    // array element or the value of a nullable value.
+
+    // DATA
+    Decoder             *d_decoder_p;
+    WireUtil::WireType   d_wireType;
+    const char         **d_cursor_p;
+    const char          *d_end_p;
+    Decoder::Mode        d_mode;
+
+    // MANIPULATORS
+    template <class TYPE>
+    int operator()(TYPE *value);
+        // Decode into the specified 'value'.  Return 0 on success, and a
+        // non-zero value otherwise.
+};
+
+                      // ================================
+                      // struct Decoder_MemberManipulator
+                      // ================================
+
+struct Decoder_MemberManipulator {
+    // [!PRIVATE!] This class provides a functor that decodes a field into an
+    // attribute of a sequence, or the selection of a choice.
+
+    // DATA
+    Decoder             *d_decoder_p;
+    WireUtil::WireType   d_wireType;
+    const char         **d_cursor_p;
+    const char          *d_end_p;
+
+    // MANIPULATORS
+    template <class TYPE, class INFO>
+    int operator()(TYPE *value, const INFO& info);
+        // Decode into the specified 'value' of the attribute or selection
+        // described by the specified 'info'.  Return 0 on success, and a
+        // non-zero value otherwise.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                               // -------------
+                               // class Decoder
+                               // -------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+int Decoder::decodeMessage(TYPE                         *value,
+                           const char                   *begin,
+                           const char                   *end,
+                           bdlat_TypeCategory::Sequence)
+{
+    const char *cursor = begin;
+
+    while (cursor < end) {
+        int      fieldNumber;
+        WireType wireType;
+
+        if (0 != WireUtil::getKey(&fieldNumber, &wireType, &cursor, end)) {
+            d_logStream << "Malformed field key\n";
+            return -1;                                                // RETURN
+        }
+
+        if (!bdlat_SequenceFunctions::hasAttribute(*value, fieldNumber - 1)) {
+            if (0 != WireUtil::skipField(wireType, &cursor, end)) {
+                logFieldError(fieldNumber);
+                return -1;                                            // RETURN
+            }
+            continue;
+        }
+
+        Decoder_MemberManipulator manipulator = { this,
+                                                  wireType,
+                                                  &cursor,
+                                                  end };
+
+        if (0 != bdlat_SequenceFunctions::manipulateAttribute(
+                                                            value,
+                                                            manipulator,
+                                                            fieldNumber - 1)) {
+            logFieldError(fieldNumber);
+            return -1;                                                // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class TYPE>
+int Decoder::decodeMessage(TYPE                       *value,
+                           const char                 *begin,
+                           const char                 *end,
+                           bdlat_TypeCategory::Choice)
+{
+    const char *cursor = begin;
+
+    while (cursor < end) {
+        int      fieldNumber;
+        WireType wireType;
+
+        if (0 != WireUtil::getKey(&fieldNumber, &wireType, &cursor, end)) {
+            d_logStream << "Malformed field key\n";
+            return -1;                                                // RETURN
+        }
+
+        const int id = fieldNumber - 1;
+
+        if (!bdlat_ChoiceFunctions::hasSelection(*value, id)) {
+            if (0 != WireUtil::skipField(wireType, &cursor, end)) {
+                logFieldError(fieldNumber);
+                return -1;                                            // RETURN
+            }
+            continue;
+        }
+
+        if (id != bdlat_ChoiceFunctions::selectionId(*value)
+         && 0  != bdlat_ChoiceFunctions::makeSelection(value, id)) {
+            logFieldError(fieldNumber);
+            return -1;                                                // RETURN
+        }
+
+        Decoder_MemberManipulator manipulator = { this,
+                                                  wireType,
+                                                  &cursor,
+                                                  end };
+
+        if (0 != bdlat_ChoiceFunctions::manipulateSelection(value,
+                                                            manipulator)) {
+            logFieldError(fieldNumber);
+            return -1;                                                // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class TYPE, class ANY_CATEGORY>
+inline
+int Decoder::decodeMessage(TYPE *, const char *, const char *, ANY_CATEGORY)
+{
+    d_logStream << "Decoded object must be a sequence or choice type\n";
+    return -1;
+}
+
+template <class TYPE>
+inline
+int Decoder::decodeField(TYPE         *value,
+                         WireType      wireType,
+                         const char  **cursor,
+                         const char   *end,
+                         Mode          mode)
+{
+    Decoder_FieldProxy proxy = { this, wireType, cursor, end, mode };
+    return bdlat_TypeCategoryUtil::manipulateByCategory(value, proxy);
+}
+
+template <class TYPE>
+inline
+int Decoder::decodeImp(TYPE                         *value,
+                       WireType                      wireType,
+                       const char                  **cursor,
+                       const char                   *end,
+                       Mode                          ,
+                       bdlat_TypeCategory::Sequence)
+{
+    return decodeNested(value, wireType, cursor, end, e_FIELD);
+}
+
+template <class TYPE>
+inline
+int Decoder::decodeImp(TYPE                       *value,
+                       WireType                    wireType,
+                       const char                **cursor,
+                       const char                 *end,
+                       Mode                        ,
+                       bdlat_TypeCategory::Choice)
+{
+    return decodeNested(value, wireType, cursor, end, e_FIELD);
+}
+
+template <class TYPE>
+int Decoder::decodeImp(TYPE                            *value,
+                       WireType                         wireType,
+                       const char                     **cursor,
+                       const char                      *end,
+                       Mode                             ,
+                       bdlat_TypeCategory::Enumeration)
+{
+    int intValue;
+    if (0 != PrimitiveUtil::getValue(&intValue, wireType, cursor, end)) {
+        return -1;                                                    // RETURN
+    }
+    if (0 != bdlat_EnumFunctions::fromInt(value, intValue)) {
+        d_logStream << "Unknown enumerator " << intValue << "\n";
+        return -1;                                                    // RETURN
+    }
+    return 0;
+}
+
+template <class TYPE>
+int Decoder::decodeImp(TYPE                               *value,
+                       WireType                            wireType,
+                       const char                        **cursor,
+                       const char                         *end,
+                       Mode                                mode,
+                       bdlat_TypeCategory::CustomizedType)
+{
+    typedef typename bdlat_CustomizedTypeFunctions::BaseType<TYPE>::Type
+                                                                      BaseType;
+
+    BaseType base(bdlat_CustomizedTypeFunctions::convertToBaseType(*value));
+
+    if (0 != decodeField(&base, wireType, cursor, end, mode)) {
+        return -1;                                                    // RETURN
+    }
+    if (0 != bdlat_CustomizedTypeFunctions::convertFromBaseType(value, base)) {
+        d_logStream << "Value does not satisfy the restrictions of its "
+                    << "customized type\n";
+        return -1;                                                    // RETURN
+    }
+    return 0;
+}
+
+template <class TYPE>
+inline
+int Decoder::decodeImp(TYPE                       *value,
+                       WireType                    wireType,
+                       const char                **cursor,
+                       const char                 *end,
+                       Mode                        ,
+                       bdlat_TypeCategory::Simple)
+{
+    return PrimitiveUtil::getValue(value, wireType, cursor, end);
+}
+
+template <class TYPE>
+int Decoder::decodeImp(TYPE                      *value,
+                       WireType                   wireType,
+                       const char               **cursor,
+                       const char                *end,
+                       Mode                       mode,
+                       bdlat_TypeCategory::Array)
+{
+    if (e_ELEMENT == mode) {
+        return decodeNested(value, wireType, cursor, end, e_ELEMENT);
+                                                                      // RETURN
+    }
+
+    // Each occurrence of the field appends one element.
+
+    const int index = static_cast<int>(bdlat_ArrayFunctions::size(*value));
+    bdlat_ArrayFunctions::resize(value, index + 1);
+
+    Decoder_FieldManipulator manipulator = { this,
+                                             wireType,
+                                             cursor,
+                                             end,
+                                             e_ELEMENT };
+    return bdlat_ArrayFunctions::manipulateElement(value, manipulator, index);
+}
+
+template <class TYPE>
+int Decoder::decodeImp(TYPE                              *value,
+                       WireType                           wireType,
+                       const char                       **cursor,
+                       const char                        *end,
+                       Mode                               mode,
+                       bdlat_TypeCategory::NullableValue)
+{
+    if (e_ELEMENT == mode) {
+        return decodeNested(value, wireType, cursor, end, e_ELEMENT);
+                                                                      // RETURN
+    }
+
+    if (bdlat_NullableValueFunctions::isNull(*value)) {
+        bdlat_NullableValueFunctions::makeValue(value);
+    }
+
+    Decoder_FieldManipulator manipulator = { this,
+                                             wireType,
+                                             cursor,
+                                             end,
+                                             e_FIELD };
+    return bdlat_NullableValueFunctions::manipulateValue(value, manipulator);
+}
+
+inline
+int Decoder::decodeImp(bsl::vector<char>          *value,
+                       WireType                    wireType,
+                       const char                **cursor,
+                       const char                 *end,
+                       Mode                        ,
+                       bdlat_TypeCategory::Array)
+{
+    return PrimitiveUtil::getValue(value, wireType, cursor, end);
+}
+
+template <class TYPE>
+int Decoder::decodeNested(TYPE         *value,
+                          WireType      wireType,
+                          const char  **cursor,
+                          const char   *end,
+                          Mode          mode)
+{
+    typedef typename bdlat_TypeCategory::Select<TYPE>::Type Category;
+
+    const char  *data;
+    bsl::size_t  length;
+
+    if (WireUtil::e_LENGTH_DELIMITED != wireType
+     || 0 != WireUtil::getLengthDelimited(&data, &length, cursor, end)) {
+        return -1;                                                    // RETURN
+    }
+
+    if (++d_currentDepth > d_maxDepth) {
+        d_logStream << "Maximum allowed decoding depth reached: "
+                    << d_currentDepth << "\n";
+        return -1;                                                    // RETURN
+    }
+
+    // An array element that is itself an array or a nullable value is
+    // wrapped as field number 1 of the payload; a null element has no such
+    // field, and remains null as it was created.
+
+    const int rc = e_FIELD == mode
+                 ? decodeMessage(value, data, data + length, Category())
+                 : decodeWrapped(value, data, data + length);
+
+    --d_currentDepth;
+    return rc;
+}
+
+template <class TYPE>
+int Decoder::decodeWrapped(TYPE *value, const char *begin, const char *end)
+{
+    const char *cursor = begin;
+
+    while (cursor < end) {
+        int      fieldNumber;
+        WireType wireType;
+
+        if (0 != WireUtil::getKey(&fieldNumber, &wireType, &cursor, end)) {
+            d_logStream << "Malformed field key\n";
+            return -1;                                                // RETURN
+        }
+
+        const int rc = 1 == fieldNumber
+                     ? decodeField(value, wireType, &cursor, end, e_FIELD)
+                     : WireUtil::skipField(wireType, &cursor, end);
+        if (rc) {
+            logFieldError(fieldNumber);
+            return -1;                                                // RETURN
+        }
+    }
+    return 0;
+}
+
+// MANIPULATORS
+template <class TYPE>
+int Decoder::decode(const char *data, bsl::size_t length, TYPE *value)
+{
+    BSLS_ASSERT(data || 0 == length);
+    BSLS_ASSERT(value);
+
+    typedef typename bdlat_TypeCategory::Select<TYPE>::Type Category;
+
+    d_logStream.clear();
+    d_logStream.str("");
+    d_currentDepth = 0;
+
+    return decodeMessage(value, data, data + length, Category());
+}
+
+template <class TYPE>
+int Decoder::decode(const bdlbb::Blob& blob, TYPE *value)
+{
+    BSLS_ASSERT(value);
+
+    if (blob.numDataBuffers() <= 1) {
+        const char *data = 0 == blob.numDataBuffers()
+                         ? ""
+                         : blob.buffer(0).data();
+        return decode(data, blob.length(), value);                   // RETURN
+    }
+
+    d_buffer.resize(blob.length());
+    bdlbb::BlobUtil::copy(&d_buffer[0], blob, 0, blob.length());
+    return decode(d_buffer.data(), d_buffer.length(), value);
+}
+
+// ACCESSORS
+inline
+bsl::string Decoder::loggedMessages() const
+{
+    return d_logStream.str();
+}
+
+inline
+int Decoder::maxDepth() const
+{
+    return d_maxDepth;
+}
+
+                         // -------------------------
+                         // struct Decoder_FieldProxy
+                         // -------------------------
+
+// MANIPULATORS
+template <class TYPE>
+inline
+int Decoder_FieldProxy::operator()(TYPE *, bslmf::Nil)
+{
+    BSLS_ASSERT_OPT(!"Unreachable");
+
+    return -1;
+}
+
+template <class TYPE, class ANY_CATEGORY>
+inline
+int Decoder_FieldProxy::operator()(TYPE *value, ANY_CATEGORY category)
+{
+    return d_decoder_p->decodeImp(value,
+                                  d_wireType,
+                                  d_cursor_p,
+                                  d_end_p,
+                                  d_mode,
+                                  category);
+}
+
+                      // -------------------------------
+                      // struct Decoder_FieldManipulator
+                      // -------------------------------
+
+// MANIPULATORS
+template <class TYPE>
+inline
+int Decoder_FieldManipulator::operator()(TYPE *value)
+{
+    return d_decoder_p->decodeField(value,
+                                    d_wireType,
+                                    d_cursor_p,
+                                    d_end_p,
+                                    d_mode);
+}
+
+                      // --------------------------------
+                      // struct Decoder_MemberManipulator
+                      // --------------------------------
+
+// MANIPULATORS
+template <class TYPE, class INFO>
+inline
+int Decoder_MemberManipulator::operator()(TYPE *value, const INFO&)
+{
+    return d_decoder_p->decodeField(value,
+                                    d_wireType,
+                                    d_cursor_p,
+                                    d_end_p,
+                                    Decoder::e_FIELD);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
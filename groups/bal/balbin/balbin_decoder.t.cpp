@@ -0,0 +1,889 @@
+// balbin_decoder.t.cpp                                               -*-C++-*-
+#include <balbin_decoder.h>
+
+#include <balbin_encoder.h>
+#include <balbin_wireutil.h>
+
+#include <balber_berdecoder.h>
+#include <balber_berdecoderoptions.h>
+#include <balber_berencoder.h>
+#include <balber_berencoderoptions.h>
+
+#include <baljsn_decoder.h>
+#include <baljsn_decoderoptions.h>
+#include <baljsn_encoder.h>
+#include <baljsn_encoderoptions.h>
+
+#include <balxml_decoder.h>
+#include <balxml_decoderoptions.h>
+#include <balxml_errorinfo.h>
+#include <balxml_minireader.h>
+
+#include <s_baltst_employee.h>
+#include <s_baltst_enumerated.h>
+#include <s_baltst_featuretestmessage.h>
+#include <s_baltst_featuretestmessageutil.h>
+#include <s_baltst_mychoice.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a decoder of 'bdlat'-compatible types from the
+// 'balbin' wire format.  We verify that decoding inverts 'balbin::Encoder' for
+// a corpus of messages exercising every 'bdlat' type category, from
+// contiguous buffers and from blobs having one or many buffers; that unknown
+// fields are skipped; that truncated and malformed input is rejected; and
+// that the nesting depth is limited.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] explicit Decoder(bslma::Allocator *basicAllocator = 0);
+// [ 5] explicit Decoder(int maxDepth, bslma::Allocator *basicAllocator = 0);
+//
+// MANIPULATORS
+// [ 2] int decode(const char *data, bsl::size_t length, TYPE *value);
+// [ 2] int decode(const bdlbb::Blob& blob, TYPE *value);
+//
+// ACCESSORS
+// [ 4] bsl::string loggedMessages() const;
+// [ 5] int maxDepth() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] ROUND TRIP OF TEST MESSAGES
+// [ 3] SKIPPING UNKNOWN FIELDS
+// [ 4] MALFORMED INPUT
+// [ 5] MAXIMUM DEPTH
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balbin::Decoder  Obj;
+typedef balbin::WireUtil WireUtil;
+
+typedef s_baltst::FeatureTestMessage     FeatureTestMessage;
+typedef s_baltst::FeatureTestMessageUtil FeatureTestMessageUtil;
+
+// ============================================================================
+//                            TEST HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void constructFeatureTestMessages(bsl::vector<FeatureTestMessage> *objects)
+    // Decode the 's_baltst::FeatureTestMessage' objects defined by
+    // 's_baltst::FeatureTestMessageUtil::s_XML_MESSAGES' using
+    // 'balxml::Decoder', and append them to the specified 'objects'.
+{
+    for (int i = 0; i < FeatureTestMessageUtil::k_NUM_MESSAGES; ++i) {
+        FeatureTestMessage object;
+        bsl::istringstream ss(FeatureTestMessageUtil::s_XML_MESSAGES[i]);
+
+        balxml::MiniReader     reader;
+        balxml::DecoderOptions options;
+        balxml::ErrorInfo      e;
+        balxml::Decoder        decoder(&options, &reader, &e);
+
+        const int rc = decoder.decode(ss.rdbuf(), &object);
+        ASSERTV(i, decoder.loggedMessages(), 0 == rc);  // test invariant
+
+        objects->push_back(object);
+    }
+}
+
+template <class TYPE>
+bsl::string encodeToString(const TYPE& value)
+    // Return the encoding of the specified 'value', asserting that encoding
+    // succeeds.
+{
+    bsl::string     output;
+    balbin::Encoder encoder;
+
+    ASSERTV(encoder.loggedMessages(), 0 == encoder.encode(&output, value));
+    return output;
+}
+
+bsl::vector<bsl::size_t> fieldBoundaries(const bsl::string& input)
+    // Return the offsets in the specified 'input', a valid encoding, at which
+    // a top-level field begins, followed by the length of 'input'.
+{
+    bsl::vector<bsl::size_t> result;
+
+    const char *cursor = input.data();
+    const char *end    = input.data() + input.size();
+
+    while (cursor < end) {
+        result.push_back(cursor - input.data());
+
+        int                fieldNumber = 0;
+        WireUtil::WireType wireType    = WireUtil::e_VARINT;
+
+        ASSERT(0 == WireUtil::getKey(&fieldNumber, &wireType, &cursor, end));
+        ASSERT(0 == WireUtil::skipField(wireType, &cursor, end));
+    }
+    result.push_back(input.size());
+    return result;
+}
+
+// ============================================================================
+//                          PERFORMANCE TEST HELPERS
+// ----------------------------------------------------------------------------
+
+static bsl::size_t s_antiOptimization = 0;
+
+template <class FUNCTOR>
+double medianTime(FUNCTOR functor, int numIterations)
+    // Return the median elapsed time, in seconds, of several trials each
+    // invoking the specified 'functor' the specified 'numIterations' times.
+{
+    enum { k_NUM_TRIALS = 11 };
+
+    bsl::vector<double> times;
+    for (int trial = 0; trial < k_NUM_TRIALS; ++trial) {
+        bsls::Stopwatch timer;
+        timer.start();
+        for (int i = 0; i < numIterations; ++i) {
+            s_antiOptimization += functor();
+        }
+        timer.stop();
+        times.push_back(timer.accumulatedWallTime());
+    }
+    bsl::sort(times.begin(), times.end());
+    return times[k_NUM_TRIALS / 2];
+}
+
+struct BinaryDecoding {
+    // Decode a set of encoded messages using 'balbin::Decoder'.
+
+    const bsl::vector<bsl::string> *d_inputs_p;
+
+    bsl::size_t operator()() const
+    {
+        Obj         decoder;
+        bsl::size_t count = 0;
+        for (bsl::size_t i = 0; i < d_inputs_p->size(); ++i) {
+            const bsl::string& INPUT = (*d_inputs_p)[i];
+
+            FeatureTestMessage value;
+            count += 0 == decoder.decode(INPUT.data(), INPUT.size(), &value);
+        }
+        return count;
+    }
+};
+
+struct BerDecoding {
+    // Decode a set of encoded messages using 'balber::BerDecoder'.
+
+    const bsl::vector<bsl::string> *d_inputs_p;
+
+    bsl::size_t operator()() const
+    {
+        balber::BerDecoderOptions options;
+        balber::BerDecoder        decoder(&options);
+        bsl::size_t               count = 0;
+        for (bsl::size_t i = 0; i < d_inputs_p->size(); ++i) {
+            const bsl::string& INPUT = (*d_inputs_p)[i];
+
+            bdlsb::FixedMemInStreamBuf streamBuf(INPUT.data(), INPUT.size());
+            FeatureTestMessage         value;
+            count += 0 == decoder.decode(&streamBuf, &value);
+        }
+        return count;
+    }
+};
+
+struct JsonDecoding {
+    // Decode a set of encoded messages using 'baljsn::Decoder'.
+
+    const bsl::vector<bsl::string> *d_inputs_p;
+
+    bsl::size_t operator()() const
+    {
+        baljsn::DecoderOptions options;
+        baljsn::Decoder        decoder;
+        bsl::size_t            count = 0;
+        for (bsl::size_t i = 0; i < d_inputs_p->size(); ++i) {
+            const bsl::string& INPUT = (*d_inputs_p)[i];
+
+            bdlsb::FixedMemInStreamBuf streamBuf(INPUT.data(), INPUT.size());
+            FeatureTestMessage         value;
+            count += 0 == decoder.decode(&streamBuf, &value, options);
+        }
+        return count;
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+    bool veryVerbose         = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator globalAllocator("global", veryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        namespace test = s_baltst;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding a Generated Sequence Type
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have received the 'balbin' encoding of a sequence type,
+// 'test::Employee', generated from a schema, having a 'name' (id 0), a
+// 'homeAddress' (id 1), itself a sequence having 'street', 'city', and
+// 'state' strings, and an 'age' (id 2):
+//..
+    const char INPUT[] = "\x0a\x03" "Bob"
+                         "\x12\x24"
+                             "\x0a\x0b" "Some Street"
+                             "\x12\x09" "Some City"
+                             "\x1a\x0a" "Some State"
+                         "\x18\x2a";
+//..
+// First, we create a decoder and an employee:
+//..
+    balbin::Decoder decoder;
+    test::Employee  bob;
+//..
+// Then, we decode the employee:
+//..
+    int rc = decoder.decode(INPUT, sizeof INPUT - 1, &bob);
+    ASSERT(0 == rc);
+//..
+// Finally, we verify the result:
+//..
+    ASSERT("Bob"         == bob.name());
+    ASSERT("Some Street" == bob.homeAddress().street());
+    ASSERT("Some City"   == bob.homeAddress().city());
+    ASSERT("Some State"  == bob.homeAddress().state());
+    ASSERT(21            == bob.age());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // MAXIMUM DEPTH
+        //
+        // Concerns:
+        //: 1 The maximum depth is the one supplied at construction, or
+        //:   'k_DEFAULT_MAX_DEPTH' if none is supplied.
+        //:
+        //: 2 A message nested exactly as deeply as the maximum depth is
+        //:   decoded, and one nested more deeply is rejected.
+        //:
+        //: 3 A decoder that rejected a message can decode another one.
+        //
+        // Plan:
+        //: 1 Verify 'maxDepth' for decoders created with and without a depth.
+        //:   (C-1)
+        //:
+        //: 2 For each 's_baltst::FeatureTestMessage' test object, find the
+        //:   smallest depth with which it is decoded, and verify that it is
+        //:   rejected with the depth one less, and that the depths exercise
+        //:   several levels of nesting; then decode it with a decoder that
+        //:   has just rejected it.  (C-2..3)
+        //
+        // Testing:
+        //   explicit Decoder(int maxDepth, bslma::Allocator *basicAllocator);
+        //   int maxDepth() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MAXIMUM DEPTH" << endl
+                          << "=============" << endl;
+
+        ASSERT(Obj::k_DEFAULT_MAX_DEPTH == Obj().maxDepth());
+        ASSERT(1                        == Obj(1).maxDepth());
+        ASSERT(100                      == Obj(100).maxDepth());
+
+        bsl::vector<FeatureTestMessage> objects;
+        constructFeatureTestMessages(&objects);
+
+        int deepest = 0;
+
+        for (bsl::size_t i = 0; i < objects.size(); ++i) {
+            const bsl::string INPUT = encodeToString(objects[i]);
+
+            int depth = 1;
+            for (; depth <= Obj::k_DEFAULT_MAX_DEPTH; ++depth) {
+                Obj                mX(depth);
+                FeatureTestMessage value;
+                if (0 == mX.decode(INPUT.data(), INPUT.size(), &value)) {
+                    ASSERTV(i, depth, objects[i] == value);
+                    break;
+                }
+                ASSERTV(i, depth, !mX.loggedMessages().empty());
+
+                const bsl::string  EMPLOYEE = encodeToString(
+                                                        s_baltst::Employee());
+                s_baltst::Employee employee;
+                ASSERTV(i, depth, 0 == mX.decode(EMPLOYEE.data(),
+                                                 EMPLOYEE.size(),
+                                                 &employee));
+            }
+            ASSERTV(i, depth <= Obj::k_DEFAULT_MAX_DEPTH);
+
+            if (veryVerbose) { T_ P_(i) P(depth) }
+
+            deepest = bsl::max(deepest, depth);
+        }
+        ASSERTV(deepest, 3 <= deepest);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MALFORMED INPUT
+        //
+        // Concerns:
+        //: 1 Decoding any truncation of a valid encoding that ends within a
+        //:   field fails, and one that ends between fields succeeds.
+        //:
+        //: 2 Decoding fails, and logs a message, for a field whose wire type
+        //:   does not match the type of its attribute, for an integer out of
+        //:   the range of its attribute, and for an undefined enumerator.
+        //:
+        //: 3 Decoding fails for a malformed key.
+        //
+        // Plan:
+        //: 1 For each 's_baltst::FeatureTestMessage' test object, decode
+        //:   every prefix of its encoding, and check the result against the
+        //:   boundaries of its top-level fields.  (C-1)
+        //:
+        //: 2 Decode hand-made invalid encodings.  (C-2..3)
+        //
+        // Testing:
+        //   bsl::string loggedMessages() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MALFORMED INPUT" << endl
+                          << "===============" << endl;
+
+        if (verbose) cout << "\nTesting truncated input." << endl;
+        {
+            bsl::vector<FeatureTestMessage> objects;
+            constructFeatureTestMessages(&objects);
+
+            Obj mX;
+
+            for (bsl::size_t i = 0; i < objects.size(); ++i) {
+                const bsl::string              INPUT = encodeToString(
+                                                                  objects[i]);
+                const bsl::vector<bsl::size_t> BOUNDARIES =
+                                                       fieldBoundaries(INPUT);
+
+                for (bsl::size_t length = 0; length <= INPUT.size();
+                                                                  ++length) {
+                    const bool AT_BOUNDARY = bsl::binary_search(
+                                                            BOUNDARIES.begin(),
+                                                            BOUNDARIES.end(),
+                                                            length);
+
+                    FeatureTestMessage value;
+                    const int          rc = mX.decode(INPUT.data(),
+                                                      length,
+                                                      &value);
+                    ASSERTV(i, length, AT_BOUNDARY, AT_BOUNDARY == (0 == rc));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting invalid fields." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_input;
+                int         d_length;
+            } DATA[] = {
+                //LINE  INPUT                   LENGTH
+                //----  ----------------------  ------
+                { L_,   "\x08\x00",                  2 },  // 'name' varint
+                { L_,   "\x12\x01" "a",              3 },  // bad 'homeAddress'
+                { L_,   "\x1a\x01" "a",              3 },  // 'age' bytes
+                { L_,   "\x18\x80\x80\x80\x80\x10",  6 },  // 'age' too big
+                { L_,   "\x18",                      1 },  // no value
+                { L_,   "\x00\x00",                  2 },  // field 0
+                { L_,   "\x0b\x00",                  2 },  // wire type 3
+                { L_,   "\x80",                      1 },  // truncated key
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE = DATA[ti].d_line;
+
+                Obj                mX;
+                s_baltst::Employee value;
+
+                ASSERTV(LINE, 0 != mX.decode(DATA[ti].d_input,
+                                             DATA[ti].d_length,
+                                             &value));
+                ASSERTV(LINE, !mX.loggedMessages().empty());
+
+                if (veryVerbose) { T_ P_(LINE) P(mX.loggedMessages()) }
+            }
+        }
+
+        if (verbose) cout << "\nTesting undefined enumerators." << endl;
+        {
+            // 'selection7' of 'FeatureTestMessage' is an enumeration having
+            // the values 0, 1, and 2.
+
+            Obj                mX;
+            FeatureTestMessage value;
+
+            ASSERT(0 == mX.decode("\x38\x04", 2, &value));
+            ASSERT(value.isSelection7Value());
+            ASSERT(s_baltst::Enumerated::LONDON == value.selection7());
+
+            ASSERT(0 != mX.decode("\x38\x06", 2, &value));
+            ASSERT(!mX.loggedMessages().empty());
+
+            ASSERT(0 != mX.decode("\x38\x01", 2, &value));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SKIPPING UNKNOWN FIELDS
+        //
+        // Concerns:
+        //: 1 Fields of every wire type whose numbers correspond to no
+        //:   attribute are skipped, before, between, and after known fields,
+        //:   and within nested sequences.
+        //:
+        //: 2 A field whose number corresponds to no selection of a choice is
+        //:   skipped, and does not change the selection.
+        //:
+        //: 3 A field that occurs more than once for a scalar attribute is
+        //:   decoded again, so that the last occurrence wins.
+        //
+        // Plan:
+        //: 1 Insert unknown fields of each wire type into the encoding of an
+        //:   's_baltst::Employee', and verify that the result decodes to the
+        //:   original value.  (C-1)
+        //:
+        //: 2 Decode an 's_baltst::MyChoice' from input having unknown fields.
+        //:   (C-2)
+        //:
+        //: 3 Append a second 'age' field to an encoding, and decode it.  (C-3)
+        //
+        // Testing:
+        //   SKIPPING UNKNOWN FIELDS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SKIPPING UNKNOWN FIELDS" << endl
+                          << "=======================" << endl;
+
+        bsl::string unknown;
+        WireUtil::putKey(&unknown, 4, WireUtil::e_VARINT);
+        WireUtil::putVarint(&unknown, 1234567);
+        WireUtil::putKey(&unknown, 100, WireUtil::e_FIXED64);
+        WireUtil::putFixed64(&unknown, 5);
+        WireUtil::putKey(&unknown, 5, WireUtil::e_LENGTH_DELIMITED);
+        WireUtil::putLengthDelimited(&unknown, "\x08\x01", 2);
+        WireUtil::putKey(&unknown, WireUtil::k_MAX_FIELD_NUMBER,
+                         WireUtil::e_FIXED32);
+        WireUtil::putFixed32(&unknown, 7);
+
+        s_baltst::Employee employee;
+        employee.name()                 = "Alice";
+        employee.homeAddress().street() = "1 Main St";
+        employee.homeAddress().city()   = "Town";
+        employee.age()                  = 33;
+
+        if (verbose) cout << "\nTesting top-level unknown fields." << endl;
+        {
+            const bsl::string ENCODED = encodeToString(employee);
+            const bsl::vector<bsl::size_t> BOUNDARIES =
+                                                     fieldBoundaries(ENCODED);
+
+            for (bsl::size_t bi = 0; bi < BOUNDARIES.size(); ++bi) {
+                bsl::string input(ENCODED);
+                input.insert(BOUNDARIES[bi], unknown);
+
+                Obj                mX;
+                s_baltst::Employee value;
+                ASSERTV(bi, mX.loggedMessages(),
+                        0 == mX.decode(input.data(), input.size(), &value));
+                ASSERTV(bi, employee == value);
+            }
+        }
+
+        if (verbose) cout << "\nTesting nested unknown fields." << endl;
+        {
+            bsl::string address = encodeToString(employee.homeAddress());
+            address.insert(0, unknown);
+            address.append(unknown);
+
+            bsl::string input;
+            WireUtil::putKey(&input, 2, WireUtil::e_LENGTH_DELIMITED);
+            WireUtil::putLengthDelimited(&input,
+                                         address.data(),
+                                         address.size());
+
+            Obj                mX;
+            s_baltst::Employee value;
+            ASSERTV(mX.loggedMessages(),
+                    0 == mX.decode(input.data(), input.size(), &value));
+            ASSERT(employee.homeAddress() == value.homeAddress());
+        }
+
+        if (verbose) cout << "\nTesting unknown selections." << endl;
+        {
+            Obj                mX;
+            s_baltst::MyChoice value;
+
+            ASSERT(0 == mX.decode(unknown.data(), unknown.size(), &value));
+            ASSERT(s_baltst::MyChoice::SELECTION_ID_UNDEFINED ==
+                                                          value.selectionId());
+
+            const bsl::string INPUT = unknown + "\x12\x02" "hi" + unknown;
+            ASSERT(0 == mX.decode(INPUT.data(), INPUT.size(), &value));
+            ASSERT(value.isSelection2Value());
+            ASSERT("hi" == value.selection2());
+        }
+
+        if (verbose) cout << "\nTesting repeated fields." << endl;
+        {
+            const bsl::string INPUT = encodeToString(employee) + "\x18\x02";
+
+            Obj                mX;
+            s_baltst::Employee value;
+            ASSERT(0 == mX.decode(INPUT.data(), INPUT.size(), &value));
+            ASSERT(1 == value.age());
+            ASSERT(employee.name() == value.name());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // ROUND TRIP OF TEST MESSAGES
+        //
+        // Concerns:
+        //: 1 Decoding the encoding of a value yields that value, for values
+        //:   exercising every 'bdlat' type category, including arrays of
+        //:   arrays and arrays of nullable values.
+        //:
+        //: 2 Decoding from a blob yields the same value as decoding from a
+        //:   contiguous buffer, whether the blob has one or many buffers.
+        //:
+        //: 3 A decoder can be reused.
+        //:
+        //: 4 Decoding allocates no memory from the default allocator when
+        //:   the value and the decoder are supplied an allocator.
+        //
+        // Plan:
+        //: 1 For each 's_baltst::FeatureTestMessage' test object, encode it,
+        //:   then decode it using the same decoder from the encoding, from a
+        //:   blob holding the encoding in one buffer, and from a blob holding
+        //:   it in buffers of 7 bytes, and compare the results with the
+        //:   original.  (C-1..4)
+        //
+        // Testing:
+        //   int decode(const char *data, bsl::size_t length, TYPE *value);
+        //   int decode(const bdlbb::Blob& blob, TYPE *value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ROUND TRIP OF TEST MESSAGES" << endl
+                          << "===========================" << endl;
+
+        bsl::vector<FeatureTestMessage> objects;
+        constructFeatureTestMessages(&objects);
+
+        bslma::TestAllocator         da("default", veryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        Obj mX(&sa);
+
+        for (bsl::size_t i = 0; i < objects.size(); ++i) {
+            const FeatureTestMessage& OBJECT = objects[i];
+            const bsl::string         INPUT  = encodeToString(OBJECT);
+
+            bdlbb::PooledBlobBufferFactory smallFactory(7, &sa);
+            bdlbb::Blob                    fragmented(&smallFactory, &sa);
+            bdlbb::BlobUtil::append(&fragmented,
+                                    INPUT.data(),
+                                    static_cast<int>(INPUT.size()));
+
+            bdlbb::PooledBlobBufferFactory largeFactory(
+                            static_cast<int>(INPUT.size()) + 1, &sa);
+            bdlbb::Blob                    single(&largeFactory, &sa);
+            bdlbb::BlobUtil::append(&single,
+                                    INPUT.data(),
+                                    static_cast<int>(INPUT.size()));
+            ASSERTV(i, 1 >= single.numDataBuffers());
+
+            FeatureTestMessage fromBuffer(&sa);
+            FeatureTestMessage fromSingle(&sa);
+            FeatureTestMessage fromFragmented(&sa);
+
+            const bsls::Types::Int64 NUM_BLOCKS = da.numBlocksTotal();
+
+            ASSERTV(i, mX.loggedMessages(),
+                    0 == mX.decode(INPUT.data(), INPUT.size(), &fromBuffer));
+            ASSERTV(i, 0 == mX.decode(single, &fromSingle));
+            ASSERTV(i, 0 == mX.decode(fragmented, &fromFragmented));
+
+            ASSERTV(i, NUM_BLOCKS == da.numBlocksTotal());
+
+            ASSERTV(i, OBJECT == fromBuffer);
+            ASSERTV(i, OBJECT == fromSingle);
+            ASSERTV(i, OBJECT == fromFragmented);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Encode an employee, and decode it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   explicit Decoder(bslma::Allocator *basicAllocator = 0);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        s_baltst::Employee employee;
+        employee.name()                 = "Alice";
+        employee.homeAddress().street() = "1 Main St";
+        employee.homeAddress().city()   = "Town";
+        employee.homeAddress().state()  = "NY";
+        employee.age()                  = -7;
+
+        const bsl::string INPUT = encodeToString(employee);
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        Obj                mX(&sa);
+        s_baltst::Employee value;
+
+        ASSERT(0 == mX.decode(INPUT.data(), INPUT.size(), &value));
+        ASSERT(employee == value);
+        ASSERT(mX.loggedMessages().empty());
+        ASSERT(Obj::k_DEFAULT_MAX_DEPTH == mX.maxDepth());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Decoding the binary format is faster than decoding BER or JSON.
+        //
+        // Plan:
+        //: 1 Encode all of the 's_baltst::FeatureTestMessage' test objects
+        //:   with 'balbin::Encoder', 'balber::BerEncoder', and
+        //:   'baljsn::Encoder', then time decoding them with the matching
+        //:   decoders, the number of times given as the second command-line
+        //:   argument, and report the throughput of each.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int ARG        = argc > 2 ? atoi(argv[2]) : 0;
+        const int ITERATIONS = 0 < ARG ? ARG : 200;
+
+        bsl::vector<FeatureTestMessage> objects;
+        constructFeatureTestMessages(&objects);
+
+        bsl::vector<bsl::string> binaryInputs;
+        bsl::vector<bsl::string> berInputs;
+        bsl::vector<bsl::string> jsonInputs;
+
+        balber::BerEncoderOptions berOptions;
+        balber::BerEncoder        berEncoder(&berOptions);
+        baljsn::EncoderOptions    jsonOptions;
+        baljsn::Encoder           jsonEncoder;
+
+        for (bsl::size_t i = 0; i < objects.size(); ++i) {
+            binaryInputs.push_back(encodeToString(objects[i]));
+
+            bdlsb::MemOutStreamBuf berBuffer;
+            ASSERTV(i, 0 == berEncoder.encode(&berBuffer, objects[i]));
+            berInputs.push_back(bsl::string(berBuffer.data(),
+                                            berBuffer.length()));
+
+            bsl::string json;
+            ASSERTV(i, 0 == jsonEncoder.encode(&json,
+                                               objects[i],
+                                               jsonOptions));
+            jsonInputs.push_back(json);
+        }
+
+        BinaryDecoding binary = { &binaryInputs };
+        BerDecoding    ber    = { &berInputs };
+        JsonDecoding   json   = { &jsonInputs };
+
+        ASSERTV(binary(), objects.size() == binary());
+        ASSERTV(ber(),    objects.size() == ber());
+        ASSERTV(json(),   objects.size() == json());
+
+        const double binaryTime = medianTime(binary, ITERATIONS);
+        const double berTime    = medianTime(ber,    ITERATIONS);
+        const double jsonTime   = medianTime(json,   ITERATIONS);
+
+        const double MESSAGES = static_cast<double>(objects.size())
+                              * ITERATIONS / 1e6;
+
+        cout << "format  messages/us" << endl;
+        cout << "balbin  " << MESSAGES / binaryTime << endl;
+        cout << "balber  " << MESSAGES / berTime << endl;
+        cout << "baljsn  " << MESSAGES / jsonTime << endl;
+
+        if (veryVerbose) {
+            P(s_antiOptimization);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,39 @@
+// balbin_encoder.cpp                                                 -*-C++-*-
+#include <balbin_encoder.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balbin_encoder_cpp,"$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace balbin {
+
+                               // -------------
+                               // class Encoder
+                               // -------------
+
+// CREATORS
+Encoder::Encoder(bslma::Allocator *basicAllocator)
+: d_buffer(basicAllocator)
+, d_output_p(0)
+, d_logStream(basicAllocator)
+{
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
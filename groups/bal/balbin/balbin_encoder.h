@@ -0,0 +1,663 @@
+// balbin_encoder.h                                                   -*-C++-*-
+#ifndef INCLUDED_BALBIN_ENCODER
+#define INCLUDED_BALBIN_ENCODER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an encoder of 'bdlat'-compatible types to a compact format.
+//
+//@CLASSES:
+//  balbin::Encoder: encoder of 'bdlat'-compatible types to the 'balbin' format
+//
+//@SEE_ALSO: balbin_decoder, balbin_wireutil, balbin_primitiveutil
+//
+//@DESCRIPTION: This component provides a class, 'balbin::Encoder', that
+// encodes value-semantic objects of types supported by the 'bdlat' framework
+// (in particular, the types generated by 'bas_codegen.pl') in the 'balbin'
+// wire format, a compact binary format laid out like the Protocol Buffers
+// wire format: each attribute of a sequence, and the selection of a choice,
+// is written as a field numbered by its 'bdlat' id plus one, holding a varint,
+// zigzag varint, fixed-size, or length-prefixed payload (see
+// 'balbin_wireutil' and 'balbin_primitiveutil').  Field names never appear in
+// the encoding, which is typically several times smaller than the XML or
+// JSON encoding of the same value, and smaller than its BER encoding.
+//
+// The encoder appends the encoding of the value to a 'bsl::string', or to a
+// 'bdlbb::Blob'.  The value being encoded must be a sequence or a choice.
+//
+///Mapping of 'bdlat' Categories
+///-----------------------------
+// The value of each attribute or selection is encoded as follows, depending on
+// its 'bdlat' category:
+//
+//: o Sequence and choice: a length-delimited field whose payload is the
+//:   encoding of the attributes, or of the selection, of the value.  A choice
+//:   having no selection has an empty payload.
+//:
+//: o Simple types: a field as described in 'balbin_primitiveutil'.
+//:
+//: o Enumeration: a varint field holding the zigzag-encoded integer value.
+//:
+//: o Customized type: the encoding of the value converted to its base type.
+//:
+//: o Nullable value: nothing if the value is null, and the encoding of the
+//:   contained value otherwise.
+//:
+//: o Array: one field per element, all having the number of the attribute,
+//:   in order; an empty array therefore produces nothing.  An array of 'char'
+//:   ('bsl::vector<char>') is instead a single length-delimited field holding
+//:   the bytes.  An element that is itself an array or a nullable value
+//:   (whose encoding could be empty or span several fields) is written as a
+//:   length-delimited field whose payload holds the element as field number 1.
+//
+// Note that the 'bdlat' id of every attribute and selection must be in the
+// range '[0 .. WireUtil::k_MAX_FIELD_NUMBER - 1]', as is the case for
+// generated types, and that the types of 'bdlt' that may hold either a
+// date/time value or a time zone-aware one ('bdlb::Variant2' of both) are not
+// supported.
+//
+///Forward Compatibility
+///---------------------
+// Because fields are identified by number and every field encodes its own
+// length, a 'balbin::Decoder' skips fields whose number it does not recognize,
+// so that messages produced from a newer version of a schema that adds
+// attributes or selections can be decoded using the older version.
+// Attributes must therefore never be renumbered, and the id of a removed
+// attribute should not be reused.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding a Generated Sequence Type
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a sequence type, 'test::Employee', generated from a schema,
+// having a 'name' (id 0), a 'homeAddress' (id 1), itself a sequence having
+// 'street', 'city', and 'state' strings, and an 'age' (id 2).
+//
+// First, we create an employee:
+//..
+//  test::Employee bob;
+//  bob.name()                 = "Bob";
+//  bob.homeAddress().street() = "Some Street";
+//  bob.homeAddress().city()   = "Some City";
+//  bob.homeAddress().state()  = "Some State";
+//  bob.age()                  = 21;
+//..
+// Then, we encode the employee to a string:
+//..
+//  bsl::string     output;
+//  balbin::Encoder encoder;
+//
+//  int rc = encoder.encode(&output, bob);
+//  assert(0 == rc);
+//..
+// Finally, we verify the encoding, in which each field consists of a key
+// byte, holding the field number and the wire type, followed by the length
+// and the bytes of the strings and the nested sequence, or the zigzag-encoded
+// age:
+//..
+//  const char EXPECTED[] = "\x0a\x03" "Bob"
+//                          "\x12\x24"
+//                              "\x0a\x0b" "Some Street"
+//                              "\x12\x09" "Some City"
+//                              "\x1a\x0a" "Some State"
+//                          "\x18\x2a";
+//
+//  assert(bsl::string(EXPECTED, sizeof EXPECTED - 1) == output);
+//..
+
+#include <balscm_version.h>
+
+#include <balbin_primitiveutil.h>
+#include <balbin_wireutil.h>
+
+#include <bdlat_arrayfunctions.h>
+#include <bdlat_choicefunctions.h>
+#include <bdlat_customizedtypefunctions.h>
+#include <bdlat_enumfunctions.h>
+#include <bdlat_nullablevaluefunctions.h>
+#include <bdlat_sequencefunctions.h>
+#include <bdlat_typecategory.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmf_nil.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_ostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balbin {
+
+struct Encoder_FieldProxy;
+struct Encoder_FieldVisitor;
+struct Encoder_MemberVisitor;
+
+                               // =============
+                               // class Encoder
+                               // =============
+
+class Encoder {
+    // This class provides a mechanism for encoding value-semantic objects of
+    // sequence and choice types supported by the 'bdlat' framework in the
+    // 'balbin' wire format.  The 'encode' methods are function templates that
+    // append the encoding of a value to a 'bsl::string' or a 'bdlbb::Blob'.
+
+    // PRIVATE TYPES
+    enum Mode {
+        // This enumeration defines the contexts in which a value is encoded.
+
+        e_FIELD,    // value of an attribute or selection
+        e_ELEMENT   // element of an array
+    };
+
+    // DATA
+    bsl::string         d_buffer;     // reused output buffer for blobs
+    bsl::string        *d_output_p;   // output of the current 'encode' call
+    bsl::ostringstream  d_logStream;  // stream to record errors
+
+    // FRIENDS
+    friend struct Encoder_FieldProxy;
+    friend struct Encoder_FieldVisitor;
+    friend struct Encoder_MemberVisitor;
+
+    // NOT IMPLEMENTED
+    Encoder(const Encoder&);
+    Encoder& operator=(const Encoder&);
+
+    // PRIVATE MANIPULATORS
+    template <class TYPE>
+    int encodeMessage(const TYPE& value, bdlat_TypeCategory::Sequence);
+    template <class TYPE>
+    int encodeMessage(const TYPE& value, bdlat_TypeCategory::Choice);
+        // Append to the output the encoding of the attributes, or of the
+        // selection, of the specified 'value'.  Return 0 on success, and a
+        // non-zero value otherwise.
+
+    template <class TYPE, class ANY_CATEGORY>
+    int encodeMessage(const TYPE& value, ANY_CATEGORY category);
+        // Log an error and return a non-zero value, as the specified 'value'
+        // of the 'bdlat' 'category' is neither a sequence nor a choice.
+
+    template <class TYPE>
+    int encodeMember(const TYPE& value, int id);
+        // Append to the output the encoding of the specified 'value' of the
+        // attribute or selection having the specified 'id'.  Return 0 on
+        // success, and a non-zero value otherwise.
+
+    template <class TYPE>
+    int encodeField(const TYPE& value, int fieldNumber, Mode mode);
+        // Append to the output the encoding of the specified 'value' as the
+        // field having the specified 'fieldNumber' in the specified 'mode'.
+        // Return 0 on success, and a non-zero value otherwise.
+
+    template <class TYPE>
+    int encodeImp(const TYPE&                  value,
+                  int                          fieldNumber,
+                  Mode                         mode,
+                  bdlat_TypeCategory::Sequence);
+    template <class TYPE>
+    int encodeImp(const TYPE&                value,
+                  int                        fieldNumber,
+                  Mode                       mode,
+                  bdlat_TypeCategory::Choice);
+    template <class TYPE>
+    int encodeImp(const TYPE&                     value,
+                  int                             fieldNumber,
+                  Mode                            mode,
+                  bdlat_TypeCategory::Enumeration);
+    template <class TYPE>
+    int encodeImp(const TYPE&                        value,
+                  int                                fieldNumber,
+                  Mode                               mode,
+                  bdlat_TypeCategory::CustomizedType);
+    template <class TYPE>
+    int encodeImp(const TYPE&                value,
+                  int                        fieldNumber,
+                  Mode                       mode,
+                  bdlat_TypeCategory::Simple);
+    template <class TYPE>
+    int encodeImp(const TYPE&               value,
+                  int                       fieldNumber,
+                  Mode                      mode,
+                  bdlat_TypeCategory::Array);
+    template <class TYPE>
+    int encodeImp(const TYPE&                       value,
+                  int                               fieldNumber,
+                  Mode                              mode,
+                  bdlat_TypeCategory::NullableValue);
+    int encodeImp(const bsl::vector<char>&  value,
+                  int                       fieldNumber,
+                  Mode                      mode,
+                  bdlat_TypeCategory::Array);
+        // Append to the output the encoding of the specified 'value', of the
+        // 'bdlat' category indicated by the last argument, as the field
+        // having the specified 'fieldNumber' in the specified 'mode'.  Return
+        // 0 on success, and a non-zero value otherwise.
+
+    template <class TYPE>
+    int encodeWrapped(const TYPE& value, int fieldNumber);
+        // Append to the output a length-delimited field having the specified
+        // 'fieldNumber' whose payload is the encoding of the specified 'value'
+        // as field number 1.  Return 0 on success, and a non-zero value
+        // otherwise.
+
+    template <class TYPE>
+    int startEncoding(bsl::string *output, const TYPE& value);
+        // Prepare to append the encoding of the specified 'value' to the
+        // specified 'output', and encode it.  Return 0 on success, and a
+        // non-zero value, with 'output' in an unspecified state, otherwise.
+
+  public:
+    // CREATORS
+    explicit Encoder(bslma::Allocator *basicAllocator = 0);
+        // Create an encoder.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    //! ~Encoder() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    template <class TYPE>
+    int encode(bsl::string *output, const TYPE& value);
+        // Append to the specified 'output' the encoding of the specified
+        // 'value'.  Return 0 on success, and a non-zero value, with no effect
+        // on 'output', otherwise.  The behavior is undefined unless 'TYPE' is
+        // a sequence or a choice type supported by the 'bdlat' framework.
+
+    template <class TYPE>
+    int encode(bdlbb::Blob *output, const TYPE& value);
+        // Append to the specified 'output' the encoding of the specified
+        // 'value'.  Return 0 on success, and a non-zero value, with no effect
+        // on 'output', otherwise.  The behavior is undefined unless 'TYPE' is
+        // a sequence or a choice type supported by the 'bdlat' framework.
+        // Note that the encoding is produced in a buffer owned by this
+        // encoder, and reused by subsequent calls, before being appended to
+        // 'output'.
+
+    // ACCESSORS
+    bsl::string loggedMessages() const;
+        // Return a string containing any error messages that have been logged
+        // by the last call to 'encode'.
+};
+
+                         // =========================
+                         // struct Encoder_FieldProxy
+                         // =========================
+
+struct Encoder_FieldProxy {
+    // [!PRIVATE!] This class provides a functor that dispatches the encoding
+    // of a field to the 'encodeImp' overload of an 'Encoder' matching the
+    // 'bdlat' category of its value.
+
+    // DATA
+    Encoder       *d_encoder_p;
+    int            d_fieldNumber;
+    Encoder::Mode  d_mode;
+
+    // MANIPULATORS
+    template <class TYPE>
+    int operator()(const TYPE& value, bslmf::Nil);
+    template <class TYPE, class ANY_CATEGORY>
+    int operator()(const TYPE& value, ANY_CATEGORY category);
+        // Encode the specified 'value', of the 'bdlat' category indicated by
+        // the last argument.  Return 0 on success, and a non-zero value
+        // otherwise.
+};
+
+                        // ===========================
+                        // struct Encoder_FieldVisitor
+                        // ===========================
+
+struct Encoder_FieldVisitor {
+    // [!PRIVATE!] This class provides a functor that encodes an array element,
+    // or the value of a nullable value, as a field of a given number.
+
+    // DATA
+    Encoder       *d_encoder_p;
+    int            d_fieldNumber;
+    Encoder::Mode  d_mode;
+
+    // MANIPULATORS
+    template <class TYPE>
+    int operator()(const TYPE& value);
+        // Encode the specified 'value'.  Return 0 on success, and a non-zero
+        // value otherwise.
+};
+
+                        // ============================
+                        // struct Encoder_MemberVisitor
+                        // ============================
+
+struct Encoder_MemberVisitor {
+    // [!PRIVATE!] This class provides a functor that encodes an attribute of a
+    // sequence, or the selection of a choice.
+
+    // DATA
+    Encoder *d_encoder_p;
+
+    // MANIPULATORS
+    template <class TYPE, class INFO>
+    int operator()(const TYPE& value, const INFO& info);
+        // Encode the specified 'value' of the attribute or selection described
+        // by the specified 'info'.  Return 0 on success, and a non-zero value
+        // otherwise.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                               // -------------
+                               // class Encoder
+                               // -------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+inline
+int Encoder::encodeMessage(const TYPE& value, bdlat_TypeCategory::Sequence)
+{
+    Encoder_MemberVisitor visitor = { this };
+    return bdlat_SequenceFunctions::accessAttributes(value, visitor);
+}
+
+template <class TYPE>
+inline
+int Encoder::encodeMessage(const TYPE& value, bdlat_TypeCategory::Choice)
+{
+    if (bdlat_ChoiceFunctions::k_UNDEFINED_SELECTION_ID ==
+                                   bdlat_ChoiceFunctions::selectionId(value)) {
+        return 0;                                                     // RETURN
+    }
+
+    Encoder_MemberVisitor visitor = { this };
+    return bdlat_ChoiceFunctions::accessSelection(value, visitor);
+}
+
+template <class TYPE, class ANY_CATEGORY>
+inline
+int Encoder::encodeMessage(const TYPE&, ANY_CATEGORY)
+{
+    d_logStream << "Encoded object must be a sequence or choice type\n";
+    return -1;
+}
+
+template <class TYPE>
+inline
+int Encoder::encodeMember(const TYPE& value, int id)
+{
+    if (id < 0 || WireUtil::k_MAX_FIELD_NUMBER <= id) {
+        d_logStream << "Attribute or selection id " << id
+                    << " cannot be encoded as a field number\n";
+        return -1;                                                    // RETURN
+    }
+    return encodeField(value, id + 1, e_FIELD);
+}
+
+template <class TYPE>
+inline
+int Encoder::encodeField(const TYPE& value, int fieldNumber, Mode mode)
+{
+    Encoder_FieldProxy proxy = { this, fieldNumber, mode };
+    return bdlat_TypeCategoryUtil::accessByCategory(value, proxy);
+}
+
+template <class TYPE>
+int Encoder::encodeImp(const TYPE&                  value,
+                       int                          fieldNumber,
+                       Mode                         ,
+                       bdlat_TypeCategory::Sequence)
+{
+    WireUtil::putKey(d_output_p, fieldNumber, WireUtil::e_LENGTH_DELIMITED);
+    const bsl::size_t position = WireUtil::beginLengthDelimited(d_output_p);
+
+    const int rc = encodeMessage(value, bdlat_TypeCategory::Sequence());
+
+    WireUtil::endLengthDelimited(d_output_p, position);
+    return rc;
+}
+
+template <class TYPE>
+int Encoder::encodeImp(const TYPE&                value,
+                       int                        fieldNumber,
+                       Mode                       ,
+                       bdlat_TypeCategory::Choice)
+{
+    WireUtil::putKey(d_output_p, fieldNumber, WireUtil::e_LENGTH_DELIMITED);
+    const bsl::size_t position = WireUtil::beginLengthDelimited(d_output_p);
+
+    const int rc = encodeMessage(value, bdlat_TypeCategory::Choice());
+
+    WireUtil::endLengthDelimited(d_output_p, position);
+    return rc;
+}
+
+template <class TYPE>
+inline
+int Encoder::encodeImp(const TYPE&                     value,
+                       int                             fieldNumber,
+                       Mode                            ,
+                       bdlat_TypeCategory::Enumeration)
+{
+    int intValue;
+    bdlat_EnumFunctions::toInt(&intValue, value);
+
+    PrimitiveUtil::putField(d_output_p, fieldNumber, intValue);
+    return 0;
+}
+
+template <class TYPE>
+inline
+int Encoder::encodeImp(const TYPE&                        value,
+                       int                                fieldNumber,
+                       Mode                               mode,
+                       bdlat_TypeCategory::CustomizedType)
+{
+    return encodeField(bdlat_CustomizedTypeFunctions::convertToBaseType(value),
+                       fieldNumber,
+                       mode);
+}
+
+template <class TYPE>
+inline
+int Encoder::encodeImp(const TYPE&                value,
+                       int                        fieldNumber,
+                       Mode                       ,
+                       bdlat_TypeCategory::Simple)
+{
+    PrimitiveUtil::putField(d_output_p, fieldNumber, value);
+    return 0;
+}
+
+template <class TYPE>
+int Encoder::encodeImp(const TYPE&               value,
+                       int                       fieldNumber,
+                       Mode                      mode,
+                       bdlat_TypeCategory::Array)
+{
+    if (e_ELEMENT == mode) {
+        return encodeWrapped(value, fieldNumber);                     // RETURN
+    }
+
+    Encoder_FieldVisitor visitor = { this, fieldNumber, e_ELEMENT };
+
+    const int size = static_cast<int>(bdlat_ArrayFunctions::size(value));
+    for (int i = 0; i < size; ++i) {
+        const int rc = bdlat_ArrayFunctions::accessElement(value, visitor, i);
+        if (rc) {
+            d_logStream << "Error encoding element " << i
+                        << " of field " << fieldNumber << "\n";
+            return rc;                                                // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class TYPE>
+int Encoder::encodeImp(const TYPE&                       value,
+                       int                               fieldNumber,
+                       Mode                              mode,
+                       bdlat_TypeCategory::NullableValue)
+{
+    if (e_ELEMENT == mode) {
+        return encodeWrapped(value, fieldNumber);                     // RETURN
+    }
+
+    if (bdlat_NullableValueFunctions::isNull(value)) {
+        return 0;                                                     // RETURN
+    }
+
+    Encoder_FieldVisitor visitor = { this, fieldNumber, e_FIELD };
+    return bdlat_NullableValueFunctions::accessValue(value, visitor);
+}
+
+inline
+int Encoder::encodeImp(const bsl::vector<char>&  value,
+                       int                       fieldNumber,
+                       Mode                      ,
+                       bdlat_TypeCategory::Array)
+{
+    PrimitiveUtil::putField(d_output_p, fieldNumber, value);
+    return 0;
+}
+
+template <class TYPE>
+int Encoder::encodeWrapped(const TYPE& value, int fieldNumber)
+{
+    WireUtil::putKey(d_output_p, fieldNumber, WireUtil::e_LENGTH_DELIMITED);
+    const bsl::size_t position = WireUtil::beginLengthDelimited(d_output_p);
+
+    const int rc = encodeField(value, 1, e_FIELD);
+
+    WireUtil::endLengthDelimited(d_output_p, position);
+    return rc;
+}
+
+template <class TYPE>
+int Encoder::startEncoding(bsl::string *output, const TYPE& value)
+{
+    typedef typename bdlat_TypeCategory::Select<TYPE>::Type Category;
+
+    d_logStream.clear();
+    d_logStream.str("");
+
+    d_output_p = output;
+    const int rc = encodeMessage(value, Category());
+    d_output_p = 0;
+
+    return rc;
+}
+
+// MANIPULATORS
+template <class TYPE>
+int Encoder::encode(bsl::string *output, const TYPE& value)
+{
+    BSLS_ASSERT(output);
+
+    const bsl::size_t originalLength = output->length();
+
+    const int rc = startEncoding(output, value);
+    if (rc) {
+        output->resize(originalLength);
+    }
+    return rc;
+}
+
+template <class TYPE>
+int Encoder::encode(bdlbb::Blob *output, const TYPE& value)
+{
+    BSLS_ASSERT(output);
+
+    d_buffer.clear();
+
+    const int rc = startEncoding(&d_buffer, value);
+    if (0 == rc) {
+        bdlbb::BlobUtil::append(output,
+                                d_buffer.data(),
+                                static_cast<int>(d_buffer.length()));
+    }
+    return rc;
+}
+
+// ACCESSORS
+inline
+bsl::string Encoder::loggedMessages() const
+{
+    return d_logStream.str();
+}
+
+                         // -------------------------
+                         // struct Encoder_FieldProxy
+                         // -------------------------
+
+// MANIPULATORS
+template <class TYPE>
+inline
+int Encoder_FieldProxy::operator()(const TYPE&, bslmf::Nil)
+{
+    BSLS_ASSERT_OPT(!"Unreachable");
+
+    return -1;
+}
+
+template <class TYPE, class ANY_CATEGORY>
+inline
+int Encoder_FieldProxy::operator()(const TYPE& value, ANY_CATEGORY category)
+{
+    return d_encoder_p->encodeImp(value, d_fieldNumber, d_mode, category);
+}
+
+                        // ---------------------------
+                        // struct Encoder_FieldVisitor
+                        // ---------------------------
+
+// MANIPULATORS
+template <class TYPE>
+inline
+int Encoder_FieldVisitor::operator()(const TYPE& value)
+{
+    return d_encoder_p->encodeField(value, d_fieldNumber, d_mode);
+}
+
+                        // ----------------------------
+                        // struct Encoder_MemberVisitor
+                        // ----------------------------
+
+// MANIPULATORS
+template <class TYPE, class INFO>
+inline
+int Encoder_MemberVisitor::operator()(const TYPE& value, const INFO& info)
+{
+    return d_encoder_p->encodeMember(value, info.id());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,749 @@
+// balbin_encoder.t.cpp                                               -*-C++-*-
+#include <balbin_encoder.h>
+
+#include <balber_berencoder.h>
+#include <balber_berencoderoptions.h>
+
+#include <baljsn_encoder.h>
+#include <baljsn_encoderoptions.h>
+
+#include <balxml_decoder.h>
+#include <balxml_decoderoptions.h>
+#include <balxml_errorinfo.h>
+#include <balxml_minireader.h>
+
+#include <s_baltst_address.h>
+#include <s_baltst_employee.h>
+#include <s_baltst_enumerated.h>
+#include <s_baltst_featuretestmessage.h>
+#include <s_baltst_featuretestmessageutil.h>
+#include <s_baltst_mychoice.h>
+#include <s_baltst_myenumeration.h>
+#include <s_baltst_mysequencewitharray.h>
+#include <s_baltst_mysequencewithnullables.h>
+#include <s_baltst_ratsnest.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is an encoder of 'bdlat'-compatible types to the
+// 'balbin' wire format.  We verify the exact encoding of sequences and of
+// members of each 'bdlat' type category, that the string and blob outputs
+// produce the same bytes, and that a failed encoding has no effect on the
+// output.  Decoding is verified in 'balbin_decoder'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] explicit Encoder(bslma::Allocator *basicAllocator = 0);
+//
+// MANIPULATORS
+// [ 2] int encode(bsl::string *output, const TYPE& value);
+// [ 4] int encode(bdlbb::Blob *output, const TYPE& value);
+//
+// ACCESSORS
+// [ 4] bsl::string loggedMessages() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] ENCODING SEQUENCES
+// [ 3] ENCODING MEMBERS OF EACH CATEGORY
+// [ 4] OUTPUT TARGETS AND FAILURES
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balbin::Encoder Obj;
+
+typedef s_baltst::FeatureTestMessage     FeatureTestMessage;
+typedef s_baltst::FeatureTestMessageUtil FeatureTestMessageUtil;
+
+// ============================================================================
+//                            TEST HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void constructFeatureTestMessages(bsl::vector<FeatureTestMessage> *objects)
+    // Decode the 's_baltst::FeatureTestMessage' objects defined by
+    // 's_baltst::FeatureTestMessageUtil::s_XML_MESSAGES' using
+    // 'balxml::Decoder', and append them to the specified 'objects'.
+{
+    for (int i = 0; i < FeatureTestMessageUtil::k_NUM_MESSAGES; ++i) {
+        FeatureTestMessage object;
+        bsl::istringstream ss(FeatureTestMessageUtil::s_XML_MESSAGES[i]);
+
+        balxml::MiniReader     reader;
+        balxml::DecoderOptions options;
+        balxml::ErrorInfo      e;
+        balxml::Decoder        decoder(&options, &reader, &e);
+
+        const int rc = decoder.decode(ss.rdbuf(), &object);
+        ASSERTV(i, decoder.loggedMessages(), 0 == rc);  // test invariant
+
+        objects->push_back(object);
+    }
+}
+
+bsl::string blobToString(const bdlbb::Blob& blob)
+    // Return a string holding the data in the specified 'blob'.
+{
+    bsl::string result;
+    for (int i = 0; i < blob.numDataBuffers(); ++i) {
+        const int length = i == blob.numDataBuffers() - 1
+                         ? blob.lastDataBufferLength()
+                         : blob.buffer(i).size();
+        result.append(blob.buffer(i).data(), length);
+    }
+    return result;
+}
+
+template <class TYPE>
+bsl::string encodeToString(const TYPE& value)
+    // Return the encoding of the specified 'value', asserting that encoding
+    // succeeds.
+{
+    bsl::string output;
+    Obj         encoder;
+
+    ASSERTV(encoder.loggedMessages(), 0 == encoder.encode(&output, value));
+    return output;
+}
+
+// ============================================================================
+//                          PERFORMANCE TEST HELPERS
+// ----------------------------------------------------------------------------
+
+static bsl::size_t s_antiOptimization = 0;
+
+template <class FUNCTOR>
+double medianTime(FUNCTOR functor, int numIterations)
+    // Return the median elapsed time, in seconds, of several trials each
+    // invoking the specified 'functor' the specified 'numIterations' times.
+{
+    enum { k_NUM_TRIALS = 11 };
+
+    bsl::vector<double> times;
+    for (int trial = 0; trial < k_NUM_TRIALS; ++trial) {
+        bsls::Stopwatch timer;
+        timer.start();
+        for (int i = 0; i < numIterations; ++i) {
+            s_antiOptimization += functor();
+        }
+        timer.stop();
+        times.push_back(timer.accumulatedWallTime());
+    }
+    bsl::sort(times.begin(), times.end());
+    return times[k_NUM_TRIALS / 2];
+}
+
+struct BinaryEncoding {
+    // Encode a set of messages to a reused string using 'balbin::Encoder'.
+
+    const bsl::vector<FeatureTestMessage> *d_objects_p;
+    bsl::string                           *d_buffer_p;
+
+    bsl::size_t operator()() const
+    {
+        Obj         encoder;
+        bsl::size_t length = 0;
+        for (bsl::size_t i = 0; i < d_objects_p->size(); ++i) {
+            d_buffer_p->clear();
+            encoder.encode(d_buffer_p, (*d_objects_p)[i]);
+            length += d_buffer_p->length();
+        }
+        return length;
+    }
+};
+
+struct BerEncoding {
+    // Encode a set of messages to a reused stream buffer using
+    // 'balber::BerEncoder'.
+
+    const bsl::vector<FeatureTestMessage> *d_objects_p;
+    bdlsb::MemOutStreamBuf                *d_buffer_p;
+
+    bsl::size_t operator()() const
+    {
+        balber::BerEncoderOptions options;
+        balber::BerEncoder        encoder(&options);
+        bsl::size_t               length = 0;
+        for (bsl::size_t i = 0; i < d_objects_p->size(); ++i) {
+            d_buffer_p->reset();
+            encoder.encode(d_buffer_p, (*d_objects_p)[i]);
+            length += d_buffer_p->length();
+        }
+        return length;
+    }
+};
+
+struct JsonEncoding {
+    // Encode a set of messages to a reused string using 'baljsn::Encoder'.
+
+    const bsl::vector<FeatureTestMessage> *d_objects_p;
+    bsl::string                           *d_buffer_p;
+
+    bsl::size_t operator()() const
+    {
+        baljsn::EncoderOptions options;
+        baljsn::Encoder        encoder;
+        bsl::size_t            length = 0;
+        for (bsl::size_t i = 0; i < d_objects_p->size(); ++i) {
+            d_buffer_p->clear();
+            encoder.encode(d_buffer_p, (*d_objects_p)[i], options);
+            length += d_buffer_p->length();
+        }
+        return length;
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+    bool veryVerbose         = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator globalAllocator("global", veryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        namespace test = s_baltst;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding a Generated Sequence Type
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a sequence type, 'test::Employee', generated from a schema,
+// having a 'name' (id 0), a 'homeAddress' (id 1), itself a sequence having
+// 'street', 'city', and 'state' strings, and an 'age' (id 2).
+//
+// First, we create an employee:
+//..
+    test::Employee bob;
+    bob.name()                 = "Bob";
+    bob.homeAddress().street() = "Some Street";
+    bob.homeAddress().city()   = "Some City";
+    bob.homeAddress().state()  = "Some State";
+    bob.age()                  = 21;
+//..
+// Then, we encode the employee to a string:
+//..
+    bsl::string     output;
+    balbin::Encoder encoder;
+
+    int rc = encoder.encode(&output, bob);
+    ASSERT(0 == rc);
+//..
+// Finally, we verify the encoding, in which each field consists of a key
+// byte, holding the field number and the wire type, followed by the length
+// and the bytes of the strings and the nested sequence, or the zigzag-encoded
+// age:
+//..
+    const char EXPECTED[] = "\x0a\x03" "Bob"
+                            "\x12\x24"
+                                "\x0a\x0b" "Some Street"
+                                "\x12\x09" "Some City"
+                                "\x1a\x0a" "Some State"
+                            "\x18\x2a";
+
+    ASSERT(bsl::string(EXPECTED, sizeof EXPECTED - 1) == output);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // OUTPUT TARGETS AND FAILURES
+        //
+        // Concerns:
+        //: 1 Encoding to a string appends to its existing contents.
+        //:
+        //: 2 Encoding to a blob appends the same bytes as encoding to a
+        //:   string, including when the encoding spans several blob buffers.
+        //:
+        //: 3 Encoding a value that is neither a sequence nor a choice fails,
+        //:   logs a message, and leaves the string or the blob unchanged.
+        //:
+        //: 4 An encoder can be reused after a failure, and the log holds only
+        //:   messages of the last call.
+        //:
+        //: 5 Encoding allocates memory from the supplied allocator only.
+        //
+        // Plan:
+        //: 1 Encode each 's_baltst::FeatureTestMessage' test object to a
+        //:   non-empty string, and to a non-empty blob having small buffers,
+        //:   and compare the results.  (C-1..2, 5)
+        //:
+        //: 2 Encode an 'int' and an enumeration to the string and the blob,
+        //:   and verify the result and the log; then encode a sequence with
+        //:   the same encoder.  (C-3..4)
+        //
+        // Testing:
+        //   int encode(bdlbb::Blob *output, const TYPE& value);
+        //   bsl::string loggedMessages() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "OUTPUT TARGETS AND FAILURES" << endl
+                          << "===========================" << endl;
+
+        bsl::vector<FeatureTestMessage> objects;
+        constructFeatureTestMessages(&objects);
+
+        bslma::TestAllocator         da("default", veryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        if (verbose) cout << "\nComparing string and blob output." << endl;
+
+        for (bsl::size_t i = 0; i < objects.size(); ++i) {
+            const FeatureTestMessage& OBJECT = objects[i];
+
+            Obj mX(&sa);
+
+            bsl::string output("prefix", &sa);
+
+            bdlbb::PooledBlobBufferFactory factory(7, &sa);
+            bdlbb::Blob                    blob(&factory, &sa);
+            bdlbb::BlobUtil::append(&blob, "prefix", 6);
+
+            const bsls::Types::Int64 NUM_BLOCKS = da.numBlocksTotal();
+
+            ASSERTV(i, 0 == mX.encode(&output, OBJECT));
+            ASSERTV(i, 0 == mX.encode(&blob, OBJECT));
+
+            ASSERTV(i, NUM_BLOCKS == da.numBlocksTotal());
+
+            ASSERTV(i, 0 == output.compare(0, 6, "prefix"));
+            ASSERTV(i, output == blobToString(blob));
+            ASSERTV(i, mX.loggedMessages().empty());
+        }
+
+        if (verbose) cout << "\nTesting failures." << endl;
+        {
+            Obj mX(&sa);  const Obj& X = mX;
+
+            bsl::string output("prefix", &sa);
+            ASSERT(0 != mX.encode(&output, 5));
+            ASSERT("prefix" == output);
+            ASSERT(!X.loggedMessages().empty());
+
+            ASSERT(0 != mX.encode(&output, s_baltst::MyEnumeration::VALUE2));
+            ASSERT("prefix" == output);
+
+            bdlbb::PooledBlobBufferFactory factory(7, &sa);
+            bdlbb::Blob                    blob(&factory, &sa);
+            bdlbb::BlobUtil::append(&blob, "prefix", 6);
+
+            ASSERT(0 != mX.encode(&blob, 5));
+            ASSERT("prefix" == blobToString(blob));
+            ASSERT(!X.loggedMessages().empty());
+
+            s_baltst::MyChoice choice;
+            choice.makeSelection1(1);
+
+            ASSERT(0 == mX.encode(&output, choice));
+            ASSERT(bsl::string("prefix\x08\x02") == output);
+            ASSERT(X.loggedMessages().empty());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ENCODING MEMBERS OF EACH CATEGORY
+        //
+        // Concerns:
+        //: 1 Each element of an array is encoded as a separate field having
+        //:   the number of the array, and an empty array is omitted.
+        //:
+        //: 2 A null nullable value is omitted, and a non-null one is encoded
+        //:   as its value.
+        //:
+        //: 3 A choice is encoded as its selection only, and a choice having
+        //:   no selection is encoded as no fields.
+        //:
+        //: 4 An enumeration is encoded as its integer value.
+        //:
+        //: 5 Each element of an array of nullable values is wrapped in a
+        //:   length-delimited field, holding field 1 if the element is not
+        //:   null.
+        //
+        // Plan:
+        //: 1 Encode objects of a few generated types, and compare the results
+        //:   to hand-made encodings.  (C-1..5)
+        //
+        // Testing:
+        //   ENCODING MEMBERS OF EACH CATEGORY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ENCODING MEMBERS OF EACH CATEGORY" << endl
+                          << "=================================" << endl;
+
+        if (verbose) cout << "\nTesting arrays." << endl;
+        {
+            s_baltst::MySequenceWithArray value;
+            value.attribute1() = 5;
+
+            ASSERT(bsl::string("\x08\x0a") == encodeToString(value));
+
+            value.attribute2().push_back("a");
+            value.attribute2().push_back("");
+            value.attribute2().push_back("bc");
+
+            ASSERT(bsl::string("\x08\x0a" "\x12\x01" "a" "\x12\x00"
+                               "\x12\x02" "bc", 11) == encodeToString(value));
+        }
+
+        if (verbose) cout << "\nTesting nullable values." << endl;
+        {
+            s_baltst::MySequenceWithNullables value;
+
+            ASSERT(bsl::string() == encodeToString(value));
+
+            value.attribute1().makeValue(-1);
+            ASSERT(bsl::string("\x08\x01") == encodeToString(value));
+
+            value.attribute1().reset();
+            value.attribute2().makeValue("x");
+            ASSERT(bsl::string("\x12\x01" "x") == encodeToString(value));
+
+            value.attribute3().makeValue();
+            const bsl::string OUTPUT = encodeToString(value);
+            ASSERT(0 == OUTPUT.compare(0, 3, "\x12\x01" "x"));
+            ASSERT('\x1a' == OUTPUT[3]);
+        }
+
+        if (verbose) cout << "\nTesting choices." << endl;
+        {
+            s_baltst::MyChoice value;
+
+            ASSERT(bsl::string() == encodeToString(value));
+
+            value.makeSelection1(-2);
+            ASSERT(bsl::string("\x08\x03") == encodeToString(value));
+
+            value.makeSelection2("hi");
+            ASSERT(bsl::string("\x12\x02" "hi") == encodeToString(value));
+        }
+
+        if (verbose) cout << "\nTesting enumerations." << endl;
+        {
+            FeatureTestMessage value;
+            value.makeSelection7(s_baltst::Enumerated::LONDON);
+
+            ASSERT(bsl::string("\x38\x04") == encodeToString(value));
+        }
+
+        if (verbose) cout << "\nTesting arrays of nullable values." << endl;
+        {
+            s_baltst::Sequence3 value;
+            value.element1().push_back(s_baltst::Enumerated::LONDON);
+            value.element1().push_back(s_baltst::Enumerated::NEW_YORK);
+            value.element6().resize(2);
+            value.element6()[1].makeValue(s_baltst::Enumerated::NEW_JERSEY);
+
+            ASSERT(bsl::string("\x08\x04" "\x08\x00"
+                               "\x32\x00" "\x32\x02\x08\x02", 10) ==
+                                                       encodeToString(value));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // ENCODING SEQUENCES
+        //
+        // Concerns:
+        //: 1 Each attribute of a sequence is encoded as a field whose number
+        //:   is the attribute id plus one, in the order of the attributes.
+        //:
+        //: 2 A nested sequence is encoded as a length-delimited field, even
+        //:   when all of its attributes have default values.
+        //:
+        //: 3 Encoding is repeatable with the same encoder.
+        //
+        // Plan:
+        //: 1 Encode a table of 's_baltst::Employee' objects, twice each with
+        //:   the same encoder, and compare the results with hand-made
+        //:   encodings.  (C-1..3)
+        //
+        // Testing:
+        //   int encode(bsl::string *output, const TYPE& value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ENCODING SEQUENCES" << endl
+                          << "==================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_name;
+            const char *d_street;
+            int         d_age;
+            const char *d_expected;
+            int         d_length;
+        } DATA[] = {
+            { L_, "",    "",    0,
+              "\x0a\x00" "\x12\x06" "\x0a\x00\x12\x00\x1a\x00" "\x18\x00",
+              12 },
+            { L_, "A",   "",    -1,
+              "\x0a\x01" "A" "\x12\x06" "\x0a\x00\x12\x00\x1a\x00" "\x18\x01",
+              13 },
+            { L_, "",    "S",   64,
+              "\x0a\x00" "\x12\x07" "\x0a\x01" "S" "\x12\x00\x1a\x00"
+              "\x18\x80\x01",
+              14 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        Obj mX;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const bsl::string EXPECTED(DATA[ti].d_expected,
+                                       DATA[ti].d_length);
+
+            s_baltst::Employee value;
+            value.name()                 = DATA[ti].d_name;
+            value.homeAddress().street() = DATA[ti].d_street;
+            value.age()                  = DATA[ti].d_age;
+
+            for (int pass = 0; pass < 2; ++pass) {
+                bsl::string output;
+                ASSERTV(LINE, pass, 0 == mX.encode(&output, value));
+                ASSERTV(LINE, pass, EXPECTED == output);
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Encode an address, and verify the result.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   explicit Encoder(bslma::Allocator *basicAllocator = 0);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVerbose);
+
+        s_baltst::Address address;
+        address.street() = "1 Main St";
+        address.city()   = "Town";
+        address.state()  = "NY";
+
+        Obj         mX(&sa);
+        bsl::string output;
+
+        ASSERT(0 == mX.encode(&output, address));
+        ASSERT(bsl::string("\x0a\x09" "1 Main St" "\x12\x04" "Town"
+                           "\x1a\x02" "NY") == output);
+        ASSERT(mX.loggedMessages().empty());
+
+        if (veryVerbose) { P(output.size()) }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Encoding to the binary format is faster, and produces smaller
+        //:   output, than encoding to BER or JSON.
+        //
+        // Plan:
+        //: 1 Time encoding all of the 's_baltst::FeatureTestMessage' test
+        //:   objects with 'balbin::Encoder', 'balber::BerEncoder', and
+        //:   'baljsn::Encoder', the number of times given as the second
+        //:   command-line argument, and report the throughput and size of
+        //:   each.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int ARG        = argc > 2 ? atoi(argv[2]) : 0;
+        const int ITERATIONS = 0 < ARG ? ARG : 200;
+
+        bsl::vector<FeatureTestMessage> objects;
+        constructFeatureTestMessages(&objects);
+
+        bsl::string            binaryBuffer;
+        bdlsb::MemOutStreamBuf berBuffer;
+        bsl::string            jsonBuffer;
+
+        BinaryEncoding binary = { &objects, &binaryBuffer };
+        BerEncoding    ber    = { &objects, &berBuffer };
+        JsonEncoding   json   = { &objects, &jsonBuffer };
+
+        const bsl::size_t BINARY_LENGTH = binary();
+        const bsl::size_t BER_LENGTH    = ber();
+        const bsl::size_t JSON_LENGTH   = json();
+
+        const double binaryTime = medianTime(binary, ITERATIONS);
+        const double berTime    = medianTime(ber,    ITERATIONS);
+        const double jsonTime   = medianTime(json,   ITERATIONS);
+
+        const double MESSAGES = static_cast<double>(objects.size())
+                              * ITERATIONS / 1e6;
+
+        cout << "format  bytes  messages/us" << endl;
+        cout << "balbin  " << BINARY_LENGTH << "  "
+             << MESSAGES / binaryTime << endl;
+        cout << "balber  " << BER_LENGTH << "  "
+             << MESSAGES / berTime << endl;
+        cout << "baljsn  " << JSON_LENGTH << "  "
+             << MESSAGES / jsonTime << endl;
+
+        if (veryVerbose) {
+            P(s_antiOptimization);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,624 @@
+// balbin_primitiveutil.cpp                                           -*-C++-*-
+#include <balbin_primitiveutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balbin_primitiveutil_cpp,"$Id$ $CSID$")
+
+#include <bdldfp_decimalconvertutil.h>
+
+#include <bdlt_timeunitratio.h>
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace balbin {
+namespace {
+
+const bdlt::Date     k_EPOCH_DATE(1, 1, 1);
+const bdlt::Datetime k_EPOCH_DATETIME(1, 1, 1);
+const bdlt::Time     k_MIDNIGHT(0);
+
+const bsls::Types::Int64 k_MAX_DATE_SERIAL =
+                                      bdlt::Date(9999, 12, 31) - k_EPOCH_DATE;
+
+const bsls::Types::Int64 k_MAX_DATETIME_MICROSECONDS =
+                    (bdlt::Datetime(9999, 12, 31, 23, 59, 59, 999, 999)
+                                    - k_EPOCH_DATETIME).totalMicroseconds();
+
+template <class TYPE>
+struct TzTraits;
+    // This 'struct' template provides, for each time zone-aware 'TYPE', the
+    // type of its local value, and access to that value.
+
+template <>
+struct TzTraits<bdlt::DateTz> {
+    typedef bdlt::Date LocalType;
+
+    static bdlt::Date localValue(const bdlt::DateTz& value)
+    {
+        return value.localDate();
+    }
+};
+
+template <>
+struct TzTraits<bdlt::TimeTz> {
+    typedef bdlt::Time LocalType;
+
+    static bdlt::Time localValue(const bdlt::TimeTz& value)
+    {
+        return value.localTime();
+    }
+};
+
+template <>
+struct TzTraits<bdlt::DatetimeTz> {
+    typedef bdlt::Datetime LocalType;
+
+    static bdlt::Datetime localValue(const bdlt::DatetimeTz& value)
+    {
+        return value.localDatetime();
+    }
+};
+
+bsls::Types::Uint64 encodeLocalValue(const bdlt::Date& value)
+    // Return the varint payload encoding the specified 'value'.
+{
+    return static_cast<bsls::Types::Uint64>(value - k_EPOCH_DATE);
+}
+
+bsls::Types::Uint64 encodeLocalValue(const bdlt::Time& value)
+    // Return the varint payload encoding the specified 'value'.
+{
+    if (bdlt::Time() == value) {
+        return bdlt::TimeUnitRatio::k_US_PER_D;                       // RETURN
+    }
+    return (value - k_MIDNIGHT).totalMicroseconds();
+}
+
+bsls::Types::Uint64 encodeLocalValue(const bdlt::Datetime& value)
+    // Return the varint payload encoding the specified 'value'.
+{
+    if (24 == value.hour()) {
+        return WireUtil::zigzagEncode(-1);                            // RETURN
+    }
+    const bdlt::DatetimeInterval sinceEpoch = value - k_EPOCH_DATETIME;
+    return WireUtil::zigzagEncode(sinceEpoch.totalMicroseconds());
+}
+
+int decodeLocalValue(bdlt::Date *value, bsls::Types::Uint64 payload)
+    // Load into the specified 'value' the date encoded by the specified
+    // varint 'payload'.  Return 0 on success, and a non-zero value, with no
+    // effect, if 'payload' does not encode a valid date.
+{
+    if (static_cast<bsls::Types::Uint64>(k_MAX_DATE_SERIAL) < payload) {
+        return -1;                                                    // RETURN
+    }
+    *value = k_EPOCH_DATE + static_cast<int>(payload);
+    return 0;
+}
+
+int decodeLocalValue(bdlt::Time *value, bsls::Types::Uint64 payload)
+    // Load into the specified 'value' the time encoded by the specified
+    // varint 'payload'.  Return 0 on success, and a non-zero value, with no
+    // effect, if 'payload' does not encode a valid time.
+{
+    if (static_cast<bsls::Types::Uint64>(bdlt::TimeUnitRatio::k_US_PER_D)
+                                                                   < payload) {
+        return -1;                                                    // RETURN
+    }
+    if (static_cast<bsls::Types::Uint64>(bdlt::TimeUnitRatio::k_US_PER_D)
+                                                                  == payload) {
+        *value = bdlt::Time();
+        return 0;                                                     // RETURN
+    }
+
+    bdlt::Time result(k_MIDNIGHT);
+    result.addMicroseconds(static_cast<bsls::Types::Int64>(payload));
+    *value = result;
+    return 0;
+}
+
+int decodeLocalValue(bdlt::Datetime *value, bsls::Types::Uint64 payload)
+    // Load into the specified 'value' the datetime encoded by the specified
+    // varint 'payload'.  Return 0 on success, and a non-zero value, with no
+    // effect, if 'payload' does not encode a valid datetime.
+{
+    const bsls::Types::Int64 microseconds = WireUtil::zigzagDecode(payload);
+
+    if (-1 == microseconds) {
+        *value = bdlt::Datetime();
+        return 0;                                                     // RETURN
+    }
+    if (microseconds < 0 || k_MAX_DATETIME_MICROSECONDS < microseconds) {
+        return -1;                                                    // RETURN
+    }
+
+    bdlt::Datetime result(k_EPOCH_DATETIME);
+    result.addMicroseconds(microseconds);
+    *value = result;
+    return 0;
+}
+
+}  // close unnamed namespace
+
+                            // --------------------
+                            // struct PrimitiveUtil
+                            // --------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+int PrimitiveUtil::getTzValue(TYPE        *value,
+                              WireType     wireType,
+                              const char **cursor,
+                              const char  *end)
+{
+    const char  *iter = *cursor;
+    const char  *data;
+    bsl::size_t  length;
+
+    if (WireUtil::e_LENGTH_DELIMITED != wireType
+     || 0 != WireUtil::getLengthDelimited(&data, &length, &iter, end)) {
+        return -1;                                                    // RETURN
+    }
+
+    const char *payloadEnd = data + length;
+
+    typename TzTraits<TYPE>::LocalType local;
+    bsls::Types::Int64                 offset = 0;
+
+    while (data < payloadEnd) {
+        int                 fieldNumber;
+        WireType            fieldType;
+        bsls::Types::Uint64 encoded;
+
+        if (0 != WireUtil::getKey(&fieldNumber,
+                                  &fieldType,
+                                  &data,
+                                  payloadEnd)) {
+            return -1;                                                // RETURN
+        }
+
+        if (1 == fieldNumber || 2 == fieldNumber) {
+            if (WireUtil::e_VARINT != fieldType
+             || 0 != WireUtil::getVarint(&encoded, &data, payloadEnd)) {
+                return -1;                                            // RETURN
+            }
+            if (1 == fieldNumber) {
+                if (0 != decodeLocalValue(&local, encoded)) {
+                    return -1;                                        // RETURN
+                }
+            }
+            else {
+                offset = WireUtil::zigzagDecode(encoded);
+            }
+        }
+        else if (0 != WireUtil::skipField(fieldType, &data, payloadEnd)) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    if (offset < -1439 || 1439 < offset
+     || !TYPE::isValid(local, static_cast<int>(offset))) {
+        return -1;                                                    // RETURN
+    }
+
+    *value  = TYPE(local, static_cast<int>(offset));
+    *cursor = iter;
+    return 0;
+}
+
+template <class TYPE>
+void PrimitiveUtil::putTzField(bsl::string *buffer,
+                               int          fieldNumber,
+                               const TYPE&  value)
+{
+    WireUtil::putKey(buffer, fieldNumber, WireUtil::e_LENGTH_DELIMITED);
+    const bsl::size_t position = WireUtil::beginLengthDelimited(buffer);
+
+    WireUtil::putKey(buffer, 1, WireUtil::e_VARINT);
+    WireUtil::putVarint(buffer,
+                        encodeLocalValue(TzTraits<TYPE>::localValue(value)));
+
+    if (0 != value.offset()) {
+        WireUtil::putKey(buffer, 2, WireUtil::e_VARINT);
+        WireUtil::putVarint(buffer, WireUtil::zigzagEncode(value.offset()));
+    }
+
+    WireUtil::endLengthDelimited(buffer, position);
+}
+
+// CLASS METHODS
+
+                            // Encoding Functions
+
+void PrimitiveUtil::putField(bsl::string *buffer, int fieldNumber, float value)
+{
+    unsigned int bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+
+    WireUtil::putKey(buffer, fieldNumber, WireUtil::e_FIXED32);
+    WireUtil::putFixed32(buffer, bits);
+}
+
+void PrimitiveUtil::putField(bsl::string *buffer,
+                             int          fieldNumber,
+                             double       value)
+{
+    bsls::Types::Uint64 bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+
+    WireUtil::putKey(buffer, fieldNumber, WireUtil::e_FIXED64);
+    WireUtil::putFixed64(buffer, bits);
+}
+
+void PrimitiveUtil::putField(bsl::string       *buffer,
+                             int                fieldNumber,
+                             bdldfp::Decimal64  value)
+{
+    unsigned char bid[sizeof(bdldfp::Decimal64)];
+    bdldfp::DecimalConvertUtil::decimal64ToBID(bid, value);
+
+    bsls::Types::Uint64 bits;
+    bsl::memcpy(&bits, bid, sizeof bits);
+
+    WireUtil::putKey(buffer, fieldNumber, WireUtil::e_FIXED64);
+    WireUtil::putFixed64(buffer, bits);
+}
+
+void PrimitiveUtil::putField(bsl::string       *buffer,
+                             int                fieldNumber,
+                             const bdlt::Date&  value)
+{
+    WireUtil::putKey(buffer, fieldNumber, WireUtil::e_VARINT);
+    WireUtil::putVarint(buffer, encodeLocalValue(value));
+}
+
+void PrimitiveUtil::putField(bsl::string         *buffer,
+                             int                  fieldNumber,
+                             const bdlt::DateTz&  value)
+{
+    putTzField(buffer, fieldNumber, value);
+}
+
+void PrimitiveUtil::putField(bsl::string           *buffer,
+                             int                    fieldNumber,
+                             const bdlt::Datetime&  value)
+{
+    WireUtil::putKey(buffer, fieldNumber, WireUtil::e_VARINT);
+    WireUtil::putVarint(buffer, encodeLocalValue(value));
+}
+
+void PrimitiveUtil::putField(bsl::string             *buffer,
+                             int                      fieldNumber,
+                             const bdlt::DatetimeTz&  value)
+{
+    putTzField(buffer, fieldNumber, value);
+}
+
+void PrimitiveUtil::putField(bsl::string       *buffer,
+                             int                fieldNumber,
+                             const bdlt::Time&  value)
+{
+    WireUtil::putKey(buffer, fieldNumber, WireUtil::e_VARINT);
+    WireUtil::putVarint(buffer, encodeLocalValue(value));
+}
+
+void PrimitiveUtil::putField(bsl::string         *buffer,
+                             int                  fieldNumber,
+                             const bdlt::TimeTz&  value)
+{
+    putTzField(buffer, fieldNumber, value);
+}
+
+void PrimitiveUtil::putField(bsl::string                   *buffer,
+                             int                            fieldNumber,
+                             const bdlt::DatetimeInterval&  value)
+{
+    WireUtil::putKey(buffer, fieldNumber, WireUtil::e_LENGTH_DELIMITED);
+    const bsl::size_t position = WireUtil::beginLengthDelimited(buffer);
+
+    if (0 != value.days()) {
+        WireUtil::putKey(buffer, 1, WireUtil::e_VARINT);
+        WireUtil::putVarint(buffer, WireUtil::zigzagEncode(value.days()));
+    }
+    if (0 != value.fractionalDayInMicroseconds()) {
+        WireUtil::putKey(buffer, 2, WireUtil::e_VARINT);
+        WireUtil::putVarint(
+                 buffer,
+                 WireUtil::zigzagEncode(value.fractionalDayInMicroseconds()));
+    }
+
+    WireUtil::endLengthDelimited(buffer, position);
+}
+
+                            // Decoding Functions
+
+int PrimitiveUtil::getValue(bool         *value,
+                            WireType      wireType,
+                            const char  **cursor,
+                            const char   *end)
+{
+    const char          *iter = *cursor;
+    bsls::Types::Uint64  encoded;
+
+    if (WireUtil::e_VARINT != wireType
+     || 0 != WireUtil::getVarint(&encoded, &iter, end)
+     || 1 < encoded) {
+        return -1;                                                    // RETURN
+    }
+
+    *value  = 1 == encoded;
+    *cursor = iter;
+    return 0;
+}
+
+int PrimitiveUtil::getValue(char         *value,
+                            WireType      wireType,
+                            const char  **cursor,
+                            const char   *end)
+{
+    signed char result;
+    if (0 != getSigned(&result, wireType, cursor, end)) {
+        return -1;                                                    // RETURN
+    }
+    *value = static_cast<char>(result);
+    return 0;
+}
+
+int PrimitiveUtil::getValue(signed char  *value,
+                            WireType      wireType,
+                            const char  **cursor,
+                            const char   *end)
+{
+    return getSigned(value, wireType, cursor, end);
+}
+
+int PrimitiveUtil::getValue(unsigned char  *value,
+                            WireType        wireType,
+                            const char    **cursor,
+                            const char     *end)
+{
+    return getUnsigned(value, wireType, cursor, end);
+}
+
+int PrimitiveUtil::getValue(float        *value,
+                            WireType      wireType,
+                            const char  **cursor,
+                            const char   *end)
+{
+    unsigned int bits;
+
+    if (WireUtil::e_FIXED32 != wireType
+     || 0 != WireUtil::getFixed32(&bits, cursor, end)) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::memcpy(value, &bits, sizeof bits);
+    return 0;
+}
+
+int PrimitiveUtil::getValue(double       *value,
+                            WireType      wireType,
+                            const char  **cursor,
+                            const char   *end)
+{
+    bsls::Types::Uint64 bits;
+
+    if (WireUtil::e_FIXED64 != wireType
+     || 0 != WireUtil::getFixed64(&bits, cursor, end)) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::memcpy(value, &bits, sizeof bits);
+    return 0;
+}
+
+int PrimitiveUtil::getValue(bdldfp::Decimal64  *value,
+                            WireType            wireType,
+                            const char        **cursor,
+                            const char         *end)
+{
+    bsls::Types::Uint64 bits;
+
+    if (WireUtil::e_FIXED64 != wireType
+     || 0 != WireUtil::getFixed64(&bits, cursor, end)) {
+        return -1;                                                    // RETURN
+    }
+
+    unsigned char bid[sizeof(bdldfp::Decimal64)];
+    bsl::memcpy(bid, &bits, sizeof bid);
+    *value = bdldfp::DecimalConvertUtil::decimal64FromBID(bid);
+    return 0;
+}
+
+int PrimitiveUtil::getValue(bsl::string  *value,
+                            WireType      wireType,
+                            const char  **cursor,
+                            const char   *end)
+{
+    const char  *data;
+    bsl::size_t  length;
+
+    if (WireUtil::e_LENGTH_DELIMITED != wireType
+     || 0 != WireUtil::getLengthDelimited(&data, &length, cursor, end)) {
+        return -1;                                                    // RETURN
+    }
+
+    value->assign(data, length);
+    return 0;
+}
+
+int PrimitiveUtil::getValue(bsl::vector<char>  *value,
+                            WireType            wireType,
+                            const char        **cursor,
+                            const char         *end)
+{
+    const char  *data;
+    bsl::size_t  length;
+
+    if (WireUtil::e_LENGTH_DELIMITED != wireType
+     || 0 != WireUtil::getLengthDelimited(&data, &length, cursor, end)) {
+        return -1;                                                    // RETURN
+    }
+
+    value->assign(data, data + length);
+    return 0;
+}
+
+int PrimitiveUtil::getValue(bdlt::Date   *value,
+                            WireType      wireType,
+                            const char  **cursor,
+                            const char   *end)
+{
+    const char          *iter = *cursor;
+    bsls::Types::Uint64  encoded;
+
+    if (WireUtil::e_VARINT != wireType
+     || 0 != WireUtil::getVarint(&encoded, &iter, end)
+     || 0 != decodeLocalValue(value, encoded)) {
+        return -1;                                                    // RETURN
+    }
+
+    *cursor = iter;
+    return 0;
+}
+
+int PrimitiveUtil::getValue(bdlt::DateTz  *value,
+                            WireType       wireType,
+                            const char   **cursor,
+                            const char    *end)
+{
+    return getTzValue(value, wireType, cursor, end);
+}
+
+int PrimitiveUtil::getValue(bdlt::Datetime  *value,
+                            WireType         wireType,
+                            const char     **cursor,
+                            const char      *end)
+{
+    const char          *iter = *cursor;
+    bsls::Types::Uint64  encoded;
+
+    if (WireUtil::e_VARINT != wireType
+     || 0 != WireUtil::getVarint(&encoded, &iter, end)
+     || 0 != decodeLocalValue(value, encoded)) {
+        return -1;                                                    // RETURN
+    }
+
+    *cursor = iter;
+    return 0;
+}
+
+int PrimitiveUtil::getValue(bdlt::DatetimeTz  *value,
+                            WireType           wireType,
+                            const char       **cursor,
+                            const char        *end)
+{
+    return getTzValue(value, wireType, cursor, end);
+}
+
+int PrimitiveUtil::getValue(bdlt::Time   *value,
+                            WireType      wireType,
+                            const char  **cursor,
+                            const char   *end)
+{
+    const char          *iter = *cursor;
+    bsls::Types::Uint64  encoded;
+
+    if (WireUtil::e_VARINT != wireType
+     || 0 != WireUtil::getVarint(&encoded, &iter, end)
+     || 0 != decodeLocalValue(value, encoded)) {
+        return -1;                                                    // RETURN
+    }
+
+    *cursor = iter;
+    return 0;
+}
+
+int PrimitiveUtil::getValue(bdlt::TimeTz  *value,
+                            WireType       wireType,
+                            const char   **cursor,
+                            const char    *end)
+{
+    return getTzValue(value, wireType, cursor, end);
+}
+
+int PrimitiveUtil::getValue(bdlt::DatetimeInterval  *value,
+                            WireType                 wireType,
+                            const char             **cursor,
+                            const char              *end)
+{
+    const char  *iter = *cursor;
+    const char  *data;
+    bsl::size_t  length;
+
+    if (WireUtil::e_LENGTH_DELIMITED != wireType
+     || 0 != WireUtil::getLengthDelimited(&data, &length, &iter, end)) {
+        return -1;                                                    // RETURN
+    }
+
+    const char *payloadEnd = data + length;
+
+    bsls::Types::Int64 days         = 0;
+    bsls::Types::Int64 microseconds = 0;
+
+    while (data < payloadEnd) {
+        int                 fieldNumber;
+        WireType            fieldType;
+        bsls::Types::Uint64 encoded;
+
+        if (0 != WireUtil::getKey(&fieldNumber,
+                                  &fieldType,
+                                  &data,
+                                  payloadEnd)) {
+            return -1;                                                // RETURN
+        }
+
+        if (1 == fieldNumber || 2 == fieldNumber) {
+            if (WireUtil::e_VARINT != fieldType
+             || 0 != WireUtil::getVarint(&encoded, &data, payloadEnd)) {
+                return -1;                                            // RETURN
+            }
+            (1 == fieldNumber ? days : microseconds) =
+                                               WireUtil::zigzagDecode(encoded);
+        }
+        else if (0 != WireUtil::skipField(fieldType, &data, payloadEnd)) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    // The days must fit in an 'int', and the fractional day must be less than
+    // a day and have the same sign as the days, as produced by
+    // 'fractionalDayInMicroseconds'.
+
+    if (static_cast<int>(days) != days
+     || microseconds <= -bdlt::TimeUnitRatio::k_US_PER_D
+     || bdlt::TimeUnitRatio::k_US_PER_D <= microseconds
+     || (0 < days && microseconds < 0)
+     || (days < 0 && 0 < microseconds)) {
+        return -1;                                                    // RETURN
+    }
+
+    value->setInterval(static_cast<int>(days), 0, 0, 0, 0, microseconds);
+    *cursor = iter;
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
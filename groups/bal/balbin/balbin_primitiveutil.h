@@ -0,0 +1,558 @@
+// balbin_primitiveutil.h                                             -*-C++-*-
+#ifndef INCLUDED_BALBIN_PRIMITIVEUTIL
+#define INCLUDED_BALBIN_PRIMITIVEUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide wire-format encoding and decoding of 'bdlat' simple types.
+//
+//@CLASSES:
+//  balbin::PrimitiveUtil: namespace for encoding and decoding simple types
+//
+//@SEE_ALSO: balbin_wireutil, balbin_encoder, balbin_decoder
+//
+//@DESCRIPTION: This component provides a 'struct', 'balbin::PrimitiveUtil',
+// that serves as a namespace for functions that append a field holding a
+// value of one of the simple types supported by the 'bdlat' framework to a
+// 'bsl::string', and that decode the payload of such a field from a
+// contiguous range of memory, in the 'balbin' wire format described in
+// 'balbin_wireutil'.
+//
+///Encoding of Simple Types
+///------------------------
+// The following table shows the wire type and the payload of each supported
+// type:
+//..
+//  C++ type              Wire type           Payload
+//  --------------------  ------------------  -------------------------------
+//  bool                  e_VARINT            0 or 1
+//  char, signed char,    e_VARINT            zigzag-encoded value ('char' is
+//  short, int, Int64                         treated as 'signed char')
+//  unsigned char,        e_VARINT            value
+//  unsigned short,
+//  unsigned int, Uint64
+//  float                 e_FIXED32           IEEE 754 bits
+//  double                e_FIXED64           IEEE 754 bits
+//  bdldfp::Decimal64     e_FIXED64           IEEE 754 BID bits
+//  bsl::string,          e_LENGTH_DELIMITED  the bytes
+//  bsl::vector<char>
+//  bdlt::Date            e_VARINT            days since 0001/01/01
+//  bdlt::Time            e_VARINT            microseconds since midnight
+//                                            (24:00:00.000000 is one day)
+//  bdlt::Datetime        e_VARINT            zigzag-encoded microseconds
+//                                            since 0001/01/01_00:00:00, or
+//                                            -1 for the default value
+//  bdlt::DateTz,         e_LENGTH_DELIMITED  field 1: the local value, as
+//  bdlt::TimeTz,                             above;  field 2: the zigzag-
+//  bdlt::DatetimeTz                          encoded offset, if not 0
+//  bdlt::DatetimeInterval e_LENGTH_DELIMITED field 1: zigzag-encoded days, if
+//                                            not 0;  field 2: zigzag-encoded
+//                                            microseconds of the fractional
+//                                            day, if not 0
+//..
+// The 'getValue' functions fail, leaving the output unchanged, if the wire
+// type of the field does not match the type being decoded, if the payload is
+// truncated, or if it does not represent a valid value of that type (for
+// example, an integer out of range).  Fields in the payload of the
+// length-delimited time zone and interval types that have unknown numbers
+// are skipped.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding and Decoding a Date
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we want to encode a 'bdlt::Date' as field number 7 and decode it
+// back.
+//
+// First, we append the field to a buffer:
+//..
+//  const bdlt::Date date(2026, 10, 19);
+//
+//  bsl::string buffer;
+//  balbin::PrimitiveUtil::putField(&buffer, 7, date);
+//..
+// Then, we read the key of the field:
+//..
+//  const char *cursor = buffer.data();
+//  const char *end    = buffer.data() + buffer.length();
+//
+//  int                        fieldNumber;
+//  balbin::WireUtil::WireType wireType;
+//  int rc = balbin::WireUtil::getKey(&fieldNumber, &wireType, &cursor, end);
+//  assert(0 == rc);
+//  assert(7 == fieldNumber);
+//..
+// Finally, we decode the payload, and verify the result:
+//..
+//  bdlt::Date result;
+//  rc = balbin::PrimitiveUtil::getValue(&result, wireType, &cursor, end);
+//  assert(0    == rc);
+//  assert(date == result);
+//  assert(end  == cursor);
+//..
+
+#include <balscm_version.h>
+
+#include <balbin_wireutil.h>
+
+#include <bdldfp_decimal.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimeinterval.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_datetz.h>
+#include <bdlt_time.h>
+#include <bdlt_timetz.h>
+
+#include <bsls_types.h>
+
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balbin {
+
+                            // ====================
+                            // struct PrimitiveUtil
+                            // ====================
+
+struct PrimitiveUtil {
+    // This 'struct' provides a namespace for functions that encode and decode
+    // fields holding values of the simple types supported by the 'bdlat'
+    // framework.
+
+    // TYPES
+    typedef WireUtil::WireType WireType;
+
+  private:
+    // PRIVATE CLASS METHODS
+    template <class TYPE>
+    static int getSigned(TYPE        *value,
+                         WireType     wireType,
+                         const char **cursor,
+                         const char  *end);
+    template <class TYPE>
+    static int getUnsigned(TYPE        *value,
+                           WireType     wireType,
+                           const char **cursor,
+                           const char  *end);
+        // Load into the specified 'value' the integer read from the varint
+        // payload at the specified '*cursor', not reading at or beyond the
+        // specified 'end', and advance '*cursor' past it.  Return 0 on
+        // success, and a non-zero value, with no effect, if the specified
+        // 'wireType' is not 'e_VARINT', the input is truncated, or the integer
+        // is not representable by 'TYPE'.
+
+    template <class TYPE>
+    static int getTzValue(TYPE        *value,
+                          WireType     wireType,
+                          const char **cursor,
+                          const char  *end);
+        // Load into the specified 'value' the time zone-aware value read from
+        // the length-delimited payload at the specified '*cursor', not reading
+        // at or beyond the specified 'end', and advance '*cursor' past it.
+        // Return 0 on success, and a non-zero value, with no effect, if the
+        // specified 'wireType' is not 'e_LENGTH_DELIMITED', the input is
+        // truncated, or the payload does not hold a valid value of 'TYPE'.
+
+    template <class TYPE>
+    static void putTzField(bsl::string *buffer,
+                           int          fieldNumber,
+                           const TYPE&  value);
+        // Append to the specified 'buffer' a field having the specified
+        // 'fieldNumber' and holding the specified time zone-aware 'value'.
+
+  public:
+    // CLASS METHODS
+
+                            // Encoding Functions
+
+    static void putField(bsl::string *buffer, int fieldNumber, bool value);
+    static void putField(bsl::string *buffer, int fieldNumber, char value);
+    static void putField(bsl::string *buffer,
+                         int          fieldNumber,
+                         signed char  value);
+    static void putField(bsl::string   *buffer,
+                         int            fieldNumber,
+                         unsigned char  value);
+    static void putField(bsl::string *buffer, int fieldNumber, short value);
+    static void putField(bsl::string    *buffer,
+                         int             fieldNumber,
+                         unsigned short  value);
+    static void putField(bsl::string *buffer, int fieldNumber, int value);
+    static void putField(bsl::string  *buffer,
+                         int           fieldNumber,
+                         unsigned int  value);
+    static void putField(bsl::string        *buffer,
+                         int                 fieldNumber,
+                         bsls::Types::Int64  value);
+    static void putField(bsl::string         *buffer,
+                         int                  fieldNumber,
+                         bsls::Types::Uint64  value);
+    static void putField(bsl::string *buffer, int fieldNumber, float value);
+    static void putField(bsl::string *buffer, int fieldNumber, double value);
+    static void putField(bsl::string       *buffer,
+                         int                fieldNumber,
+                         bdldfp::Decimal64  value);
+    static void putField(bsl::string        *buffer,
+                         int                 fieldNumber,
+                         const bsl::string&  value);
+    static void putField(bsl::string              *buffer,
+                         int                       fieldNumber,
+                         const bsl::vector<char>&  value);
+    static void putField(bsl::string       *buffer,
+                         int                fieldNumber,
+                         const bdlt::Date&  value);
+    static void putField(bsl::string         *buffer,
+                         int                  fieldNumber,
+                         const bdlt::DateTz&  value);
+    static void putField(bsl::string           *buffer,
+                         int                    fieldNumber,
+                         const bdlt::Datetime&  value);
+    static void putField(bsl::string             *buffer,
+                         int                      fieldNumber,
+                         const bdlt::DatetimeTz&  value);
+    static void putField(bsl::string       *buffer,
+                         int                fieldNumber,
+                         const bdlt::Time&  value);
+    static void putField(bsl::string         *buffer,
+                         int                  fieldNumber,
+                         const bdlt::TimeTz&  value);
+    static void putField(bsl::string                   *buffer,
+                         int                            fieldNumber,
+                         const bdlt::DatetimeInterval&  value);
+        // Append to the specified 'buffer' a field having the specified
+        // 'fieldNumber' and holding the specified 'value'.  The behavior is
+        // undefined unless '1 <= fieldNumber <= WireUtil::k_MAX_FIELD_NUMBER'.
+
+                            // Decoding Functions
+
+    static int getValue(bool        *value,
+                        WireType     wireType,
+                        const char **cursor,
+                        const char  *end);
+    static int getValue(char        *value,
+                        WireType     wireType,
+                        const char **cursor,
+                        const char  *end);
+    static int getValue(signed char  *value,
+                        WireType      wireType,
+                        const char  **cursor,
+                        const char   *end);
+    static int getValue(unsigned char  *value,
+                        WireType        wireType,
+                        const char    **cursor,
+                        const char     *end);
+    static int getValue(short       *value,
+                        WireType     wireType,
+                        const char **cursor,
+                        const char  *end);
+    static int getValue(unsigned short  *value,
+                        WireType         wireType,
+                        const char     **cursor,
+                        const char      *end);
+    static int getValue(int         *value,
+                        WireType     wireType,
+                        const char **cursor,
+                        const char  *end);
+    static int getValue(unsigned int  *value,
+                        WireType       wireType,
+                        const char   **cursor,
+                        const char    *end);
+    static int getValue(bsls::Types::Int64  *value,
+                        WireType             wireType,
+                        const char         **cursor,
+                        const char          *end);
+    static int getValue(bsls::Types::Uint64  *value,
+                        WireType              wireType,
+                        const char          **cursor,
+                        const char           *end);
+    static int getValue(float       *value,
+                        WireType     wireType,
+                        const char **cursor,
+                        const char  *end);
+    static int getValue(double      *value,
+                        WireType     wireType,
+                        const char **cursor,
+                        const char  *end);
+    static int getValue(bdldfp::Decimal64  *value,
+                        WireType            wireType,
+                        const char        **cursor,
+                        const char         *end);
+    static int getValue(bsl::string  *value,
+                        WireType      wireType,
+                        const char  **cursor,
+                        const char   *end);
+    static int getValue(bsl::vector<char>  *value,
+                        WireType            wireType,
+                        const char        **cursor,
+                        const char         *end);
+    static int getValue(bdlt::Date  *value,
+                        WireType     wireType,
+                        const char **cursor,
+                        const char  *end);
+    static int getValue(bdlt::DateTz  *value,
+                        WireType       wireType,
+                        const char   **cursor,
+                        const char    *end);
+    static int getValue(bdlt::Datetime  *value,
+                        WireType         wireType,
+                        const char     **cursor,
+                        const char      *end);
+    static int getValue(bdlt::DatetimeTz  *value,
+                        WireType           wireType,
+                        const char       **cursor,
+                        const char        *end);
+    static int getValue(bdlt::Time  *value,
+                        WireType     wireType,
+                        const char **cursor,
+                        const char  *end);
+    static int getValue(bdlt::TimeTz  *value,
+                        WireType       wireType,
+                        const char   **cursor,
+                        const char    *end);
+    static int getValue(bdlt::DatetimeInterval  *value,
+                        WireType                 wireType,
+                        const char             **cursor,
+                        const char              *end);
+        // Load into the specified 'value' the value read from the payload,
+        // having the specified 'wireType', at the specified '*cursor', not
+        // reading at or beyond the specified 'end', and advance '*cursor' past
+        // the payload.  Return 0 on success, and a non-zero value, with no
+        // effect, if 'wireType' is not the wire type used to encode values of
+        // the type of 'value', the payload is truncated, or it does not
+        // represent a valid value of that type.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // --------------------
+                            // struct PrimitiveUtil
+                            // --------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+int PrimitiveUtil::getSigned(TYPE        *value,
+                             WireType     wireType,
+                             const char **cursor,
+                             const char  *end)
+{
+    const char          *iter = *cursor;
+    bsls::Types::Uint64  encoded;
+
+    if (WireUtil::e_VARINT != wireType
+     || 0 != WireUtil::getVarint(&encoded, &iter, end)) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsls::Types::Int64 result = WireUtil::zigzagDecode(encoded);
+    if (static_cast<TYPE>(result) != result) {
+        return -1;                                                    // RETURN
+    }
+
+    *value  = static_cast<TYPE>(result);
+    *cursor = iter;
+    return 0;
+}
+
+template <class TYPE>
+int PrimitiveUtil::getUnsigned(TYPE        *value,
+                               WireType     wireType,
+                               const char **cursor,
+                               const char  *end)
+{
+    const char          *iter = *cursor;
+    bsls::Types::Uint64  result;
+
+    if (WireUtil::e_VARINT != wireType
+     || 0 != WireUtil::getVarint(&result, &iter, end)
+     || static_cast<TYPE>(result) != result) {
+        return -1;                                                    // RETURN
+    }
+
+    *value  = static_cast<TYPE>(result);
+    *cursor = iter;
+    return 0;
+}
+
+// CLASS METHODS
+
+                            // Encoding Functions
+
+inline
+void PrimitiveUtil::putField(bsl::string *buffer, int fieldNumber, bool value)
+{
+    WireUtil::putKey(buffer, fieldNumber, WireUtil::e_VARINT);
+    buffer->push_back(value ? '\1' : '\0');
+}
+
+inline
+void PrimitiveUtil::putField(bsl::string *buffer, int fieldNumber, char value)
+{
+    putField(buffer, fieldNumber, static_cast<signed char>(value));
+}
+
+inline
+void PrimitiveUtil::putField(bsl::string *buffer,
+                             int          fieldNumber,
+                             signed char  value)
+{
+    putField(buffer, fieldNumber, static_cast<bsls::Types::Int64>(value));
+}
+
+inline
+void PrimitiveUtil::putField(bsl::string   *buffer,
+                             int            fieldNumber,
+                             unsigned char  value)
+{
+    putField(buffer, fieldNumber, static_cast<bsls::Types::Uint64>(value));
+}
+
+inline
+void PrimitiveUtil::putField(bsl::string *buffer, int fieldNumber, short value)
+{
+    putField(buffer, fieldNumber, static_cast<bsls::Types::Int64>(value));
+}
+
+inline
+void PrimitiveUtil::putField(bsl::string    *buffer,
+                             int             fieldNumber,
+                             unsigned short  value)
+{
+    putField(buffer, fieldNumber, static_cast<bsls::Types::Uint64>(value));
+}
+
+inline
+void PrimitiveUtil::putField(bsl::string *buffer, int fieldNumber, int value)
+{
+    putField(buffer, fieldNumber, static_cast<bsls::Types::Int64>(value));
+}
+
+inline
+void PrimitiveUtil::putField(bsl::string  *buffer,
+                             int           fieldNumber,
+                             unsigned int  value)
+{
+    putField(buffer, fieldNumber, static_cast<bsls::Types::Uint64>(value));
+}
+
+inline
+void PrimitiveUtil::putField(bsl::string        *buffer,
+                             int                 fieldNumber,
+                             bsls::Types::Int64  value)
+{
+    WireUtil::putKey(buffer, fieldNumber, WireUtil::e_VARINT);
+    WireUtil::putVarint(buffer, WireUtil::zigzagEncode(value));
+}
+
+inline
+void PrimitiveUtil::putField(bsl::string         *buffer,
+                             int                  fieldNumber,
+                             bsls::Types::Uint64  value)
+{
+    WireUtil::putKey(buffer, fieldNumber, WireUtil::e_VARINT);
+    WireUtil::putVarint(buffer, value);
+}
+
+inline
+void PrimitiveUtil::putField(bsl::string        *buffer,
+                             int                 fieldNumber,
+                             const bsl::string&  value)
+{
+    WireUtil::putKey(buffer, fieldNumber, WireUtil::e_LENGTH_DELIMITED);
+    WireUtil::putLengthDelimited(buffer, value.data(), value.length());
+}
+
+inline
+void PrimitiveUtil::putField(bsl::string              *buffer,
+                             int                       fieldNumber,
+                             const bsl::vector<char>&  value)
+{
+    WireUtil::putKey(buffer, fieldNumber, WireUtil::e_LENGTH_DELIMITED);
+    WireUtil::putLengthDelimited(buffer,
+                                 value.empty() ? 0 : &value[0],
+                                 value.size());
+}
+
+                            // Decoding Functions
+
+inline
+int PrimitiveUtil::getValue(short       *value,
+                            WireType     wireType,
+                            const char **cursor,
+                            const char  *end)
+{
+    return getSigned(value, wireType, cursor, end);
+}
+
+inline
+int PrimitiveUtil::getValue(unsigned short  *value,
+                            WireType         wireType,
+                            const char     **cursor,
+                            const char      *end)
+{
+    return getUnsigned(value, wireType, cursor, end);
+}
+
+inline
+int PrimitiveUtil::getValue(int         *value,
+                            WireType     wireType,
+                            const char **cursor,
+                            const char  *end)
+{
+    return getSigned(value, wireType, cursor, end);
+}
+
+inline
+int PrimitiveUtil::getValue(unsigned int  *value,
+                            WireType       wireType,
+                            const char   **cursor,
+                            const char    *end)
+{
+    return getUnsigned(value, wireType, cursor, end);
+}
+
+inline
+int PrimitiveUtil::getValue(bsls::Types::Int64  *value,
+                            WireType             wireType,
+                            const char         **cursor,
+                            const char          *end)
+{
+    return getSigned(value, wireType, cursor, end);
+}
+
+inline
+int PrimitiveUtil::getValue(bsls::Types::Uint64  *value,
+                            WireType              wireType,
+                            const char          **cursor,
+                            const char           *end)
+{
+    return getUnsigned(value, wireType, cursor, end);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,913 @@
+// balbin_primitiveutil.t.cpp                                         -*-C++-*-
+#include <balbin_primitiveutil.h>
+
+#include <balbin_wireutil.h>
+
+#include <bdldfp_decimal.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimeinterval.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_datetz.h>
+#include <bdlt_time.h>
+#include <bdlt_timetz.h>
+#include <bdlt_timeunitratio.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a utility that encodes each 'bdlat' simple type
+// as a field, and decodes it from the payload of a field.  We verify, for
+// each type, that decoding inverts encoding for representative and extreme
+// values, that decoding every truncation of the payload fails with no
+// effect, and that decoding fails with no effect for a mismatched wire type
+// and for payloads that are not valid values of the type.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] void putField(bsl::string *, int, INTEGRAL_TYPE);
+// [ 2] int getValue(INTEGRAL_TYPE *, WireType, const char **, end);
+// [ 3] void putField(bsl::string *, int, FLOATING_POINT_TYPE);
+// [ 3] int getValue(FLOATING_POINT_TYPE *, WireType, const char **, end);
+// [ 4] void putField(bsl::string *, int, const bsl::string&);
+// [ 4] void putField(bsl::string *, int, const bsl::vector<char>&);
+// [ 4] int getValue(bsl::string *, WireType, const char **, end);
+// [ 4] int getValue(bsl::vector<char> *, WireType, const char **, end);
+// [ 5] void putField(bsl::string *, int, const DATE_TIME_TYPE&);
+// [ 5] int getValue(DATE_TIME_TYPE *, WireType, const char **, end);
+// [ 6] void putField(bsl::string *, int, const bdlt::DatetimeInterval&);
+// [ 6] int getValue(DatetimeInterval *, WireType, const char **, end);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balbin::PrimitiveUtil Util;
+typedef balbin::WireUtil      WireUtil;
+typedef WireUtil::WireType    WireType;
+typedef bsls::Types::Int64    Int64;
+typedef bsls::Types::Uint64   Uint64;
+
+// ============================================================================
+//                            TEST HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+template <class TYPE>
+void testRoundTrip(int line, const TYPE& value, const TYPE& sentinel)
+    // Encode the specified 'value' as a field, and verify that decoding the
+    // field, using the specified 'line' to report errors, yields 'value', and
+    // that decoding each strict prefix of the payload fails, leaving an
+    // object having the specified 'sentinel' value unchanged.
+{
+    static const int k_FIELD_NUMBER = 1000;
+
+    bsl::string buffer;
+    Util::putField(&buffer, k_FIELD_NUMBER, value);
+
+    const char *cursor = buffer.data();
+    const char *end    = buffer.data() + buffer.size();
+
+    int      fieldNumber = 0;
+    WireType wireType    = WireUtil::e_VARINT;
+
+    ASSERTV(line,
+            0 == WireUtil::getKey(&fieldNumber, &wireType, &cursor, end));
+    ASSERTV(line, k_FIELD_NUMBER == fieldNumber);
+
+    const char *const payload = cursor;
+
+    TYPE result(sentinel);
+    ASSERTV(line, 0 == Util::getValue(&result, wireType, &cursor, end));
+    ASSERTV(line, value == result);
+    ASSERTV(line, end   == cursor);
+
+    for (const char *last = payload; last < end; ++last) {
+        cursor = payload;
+        result = sentinel;
+        ASSERTV(line, last - payload,
+                0 != Util::getValue(&result, wireType, &cursor, last));
+        ASSERTV(line, last - payload, sentinel == result);
+        ASSERTV(line, last - payload, payload  == cursor);
+    }
+}
+
+template <class TYPE>
+void testWrongWireTypes(int line, const TYPE& value, const TYPE& sentinel)
+    // Encode the specified 'value' as a field, and verify that decoding its
+    // payload with any other wire type, using the specified 'line' to report
+    // errors, fails, leaving an object having the specified 'sentinel' value
+    // unchanged.
+{
+    static const WireType TYPES[] = {
+        WireUtil::e_VARINT,
+        WireUtil::e_FIXED64,
+        WireUtil::e_LENGTH_DELIMITED,
+        WireUtil::e_FIXED32
+    };
+    const int NUM_TYPES = sizeof TYPES / sizeof *TYPES;
+
+    bsl::string buffer;
+    Util::putField(&buffer, 1, value);
+
+    const char *const payload = buffer.data() + 1;
+    const char *const end     = buffer.data() + buffer.size();
+
+    const WireType actual = static_cast<WireType>(buffer[0] & 7);
+
+    for (int ti = 0; ti < NUM_TYPES; ++ti) {
+        if (TYPES[ti] == actual) {
+            continue;                                               // CONTINUE
+        }
+
+        const char *cursor = payload;
+        TYPE        result(sentinel);
+
+        ASSERTV(line, ti, 0 != Util::getValue(&result,
+                                              TYPES[ti],
+                                              &cursor,
+                                              end));
+        ASSERTV(line, ti, sentinel == result);
+        ASSERTV(line, ti, payload  == cursor);
+    }
+}
+
+template <class TYPE>
+void testInvalidVarint(int line, Uint64 payload, const TYPE& sentinel)
+    // Verify, using the specified 'line' to report errors, that decoding the
+    // specified varint 'payload' as a 'TYPE' fails, leaving an object having
+    // the specified 'sentinel' value unchanged.
+{
+    bsl::string buffer;
+    WireUtil::putVarint(&buffer, payload);
+
+    const char *cursor = buffer.data();
+    TYPE        result(sentinel);
+
+    ASSERTV(line, 0 != Util::getValue(&result,
+                                      WireUtil::e_VARINT,
+                                      &cursor,
+                                      buffer.data() + buffer.size()));
+    ASSERTV(line, sentinel      == result);
+    ASSERTV(line, buffer.data() == cursor);
+}
+
+template <class TYPE>
+void testInvalidMessage(int                line,
+                        const bsl::string& body,
+                        const TYPE&        sentinel)
+    // Verify, using the specified 'line' to report errors, that decoding a
+    // length-delimited payload having the specified 'body' as a 'TYPE' fails,
+    // leaving an object having the specified 'sentinel' value unchanged.
+{
+    bsl::string buffer;
+    WireUtil::putLengthDelimited(&buffer, body.data(), body.size());
+
+    const char *cursor = buffer.data();
+    TYPE        result(sentinel);
+
+    ASSERTV(line, 0 != Util::getValue(&result,
+                                      WireUtil::e_LENGTH_DELIMITED,
+                                      &cursor,
+                                      buffer.data() + buffer.size()));
+    ASSERTV(line, sentinel      == result);
+    ASSERTV(line, buffer.data() == cursor);
+}
+
+template <class TYPE>
+void testIntegralType()
+    // Verify the round trip of the extremes of the integral 'TYPE' and of
+    // values around zero, and that values just outside of the range of 'TYPE'
+    // are rejected.
+{
+    typedef bsl::numeric_limits<TYPE> Limits;
+
+    const TYPE MIN = Limits::min();
+    const TYPE MAX = Limits::max();
+
+    testRoundTrip(L_, MIN, MAX);
+    testRoundTrip(L_, MAX, MIN);
+    testRoundTrip(L_, static_cast<TYPE>(0), MAX);
+    testRoundTrip(L_, static_cast<TYPE>(1), MAX);
+    testRoundTrip(L_, static_cast<TYPE>(MIN + 1), MAX);
+    testRoundTrip(L_, static_cast<TYPE>(MAX - 1), MIN);
+    testRoundTrip(L_, static_cast<TYPE>(100), MAX);
+
+    testWrongWireTypes(L_, MAX, MIN);
+
+    if (Limits::is_signed) {
+        testRoundTrip(L_, static_cast<TYPE>(-1), MAX);
+
+        if (sizeof(TYPE) < sizeof(Int64)) {
+            testInvalidVarint(
+                      L_,
+                      WireUtil::zigzagEncode(static_cast<Int64>(MAX) + 1),
+                      MIN);
+            testInvalidVarint(
+                      L_,
+                      WireUtil::zigzagEncode(static_cast<Int64>(MIN) - 1),
+                      MAX);
+        }
+    }
+    else if (sizeof(TYPE) < sizeof(Uint64)) {
+        testInvalidVarint(L_, static_cast<Uint64>(MAX) + 1, MIN);
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+    bool veryVerbose         = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding and Decoding a Date
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we want to encode a 'bdlt::Date' as field number 7 and decode it
+// back.
+//
+// First, we append the field to a buffer:
+//..
+    const bdlt::Date date(2026, 10, 19);
+
+    bsl::string buffer;
+    balbin::PrimitiveUtil::putField(&buffer, 7, date);
+//..
+// Then, we read the key of the field:
+//..
+    const char *cursor = buffer.data();
+    const char *end    = buffer.data() + buffer.length();
+
+    int                        fieldNumber;
+    balbin::WireUtil::WireType wireType;
+    int rc = balbin::WireUtil::getKey(&fieldNumber, &wireType, &cursor, end);
+    ASSERT(0 == rc);
+    ASSERT(7 == fieldNumber);
+//..
+// Finally, we decode the payload, and verify the result:
+//..
+    bdlt::Date result;
+    rc = balbin::PrimitiveUtil::getValue(&result, wireType, &cursor, end);
+    ASSERT(0    == rc);
+    ASSERT(date == result);
+    ASSERT(end  == cursor);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // DATETIME INTERVALS
+        //
+        // Concerns:
+        //: 1 Intervals round trip, including the zero, extreme, and mixed
+        //:   day and fractional values.
+        //:
+        //: 2 Zero components are omitted from the payload.
+        //:
+        //: 3 Decoding rejects a day count outside the range of 'int', a
+        //:   fractional part of a day or more, and components having
+        //:   different signs.
+        //:
+        //: 4 Unknown fields in the payload are skipped.
+        //
+        // Plan:
+        //: 1 Round trip a table of intervals.  (C-1)
+        //:
+        //: 2 Verify the encoding of the zero interval.  (C-2)
+        //:
+        //: 3 Decode hand-made invalid and extended payloads.  (C-3..4)
+        //
+        // Testing:
+        //   void putField(bsl::string *, int, const bdlt::DatetimeInterval&);
+        //   int getValue(DatetimeInterval *, WireType, const char **, end);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DATETIME INTERVALS" << endl
+                          << "==================" << endl;
+
+        typedef bdlt::DatetimeInterval Obj;
+
+        const Obj SENTINEL(1, 2, 3, 4, 5, 6);
+        const int IMAX = bsl::numeric_limits<int>::max();
+        const int IMIN = bsl::numeric_limits<int>::min();
+
+        static const struct {
+            int d_line;
+            int d_days;
+            int d_hours;
+            int d_microseconds;
+        } DATA[] = {
+            //LINE  DAYS  HOURS  MICROSECONDS
+            //----  ----  -----  ------------
+            { L_,      0,     0,            0 },
+            { L_,      0,     0,            1 },
+            { L_,      0,     0,           -1 },
+            { L_,      1,     0,            0 },
+            { L_,     -1,     0,            0 },
+            { L_,      3,    23,       999999 },
+            { L_,     -3,   -23,      -999999 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const Obj VALUE(DATA[ti].d_days,
+                            DATA[ti].d_hours,
+                            0,
+                            0,
+                            0,
+                            DATA[ti].d_microseconds);
+            testRoundTrip(DATA[ti].d_line, VALUE, SENTINEL);
+        }
+
+        testRoundTrip(L_, Obj(IMAX, 23, 59, 59, 999, 999), SENTINEL);
+        testRoundTrip(L_, Obj(IMIN, -23, -59, -59, -999, -999), SENTINEL);
+        testWrongWireTypes(L_, Obj(5), SENTINEL);
+
+        {
+            bsl::string buffer;
+            Util::putField(&buffer, 1, Obj());
+            ASSERT(bsl::string("\x0a\x00", 2) == buffer);
+        }
+
+        if (verbose) cout << "\nTesting invalid payloads." << endl;
+        {
+            bsl::string body;
+            WireUtil::putKey(&body, 1, WireUtil::e_VARINT);
+            WireUtil::putVarint(&body,
+                                WireUtil::zigzagEncode(Int64(IMAX) + 1));
+            testInvalidMessage(L_, body, SENTINEL);
+        }
+        {
+            bsl::string body;
+            WireUtil::putKey(&body, 2, WireUtil::e_VARINT);
+            WireUtil::putVarint(&body, WireUtil::zigzagEncode(
+                                        bdlt::TimeUnitRatio::k_US_PER_D));
+            testInvalidMessage(L_, body, SENTINEL);
+        }
+        {
+            bsl::string body;
+            WireUtil::putKey(&body, 1, WireUtil::e_VARINT);
+            WireUtil::putVarint(&body, WireUtil::zigzagEncode(1));
+            WireUtil::putKey(&body, 2, WireUtil::e_VARINT);
+            WireUtil::putVarint(&body, WireUtil::zigzagEncode(-1));
+            testInvalidMessage(L_, body, SENTINEL);
+        }
+        {
+            bsl::string body;
+            WireUtil::putKey(&body, 1, WireUtil::e_FIXED32);
+            WireUtil::putFixed32(&body, 1);
+            testInvalidMessage(L_, body, SENTINEL);
+        }
+
+        if (verbose) cout << "\nTesting unknown fields." << endl;
+        {
+            bsl::string body;
+            WireUtil::putKey(&body, 9, WireUtil::e_LENGTH_DELIMITED);
+            WireUtil::putLengthDelimited(&body, "abc", 3);
+            WireUtil::putKey(&body, 1, WireUtil::e_VARINT);
+            WireUtil::putVarint(&body, WireUtil::zigzagEncode(-2));
+
+            bsl::string buffer;
+            WireUtil::putLengthDelimited(&buffer, body.data(), body.size());
+
+            const char *cursor = buffer.data();
+            Obj         result(SENTINEL);
+
+            ASSERT(0 == Util::getValue(&result,
+                                       WireUtil::e_LENGTH_DELIMITED,
+                                       &cursor,
+                                       buffer.data() + buffer.size()));
+            ASSERT(Obj(-2) == result);
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // DATE AND TIME TYPES
+        //
+        // Concerns:
+        //: 1 Each date and time type round trips, including the minimum,
+        //:   maximum, and default values, and values with an offset.
+        //:
+        //: 2 Decoding rejects serial values beyond the maximum of each type,
+        //:   invalid offsets, and combinations of value and offset that are
+        //:   not valid.
+        //
+        // Plan:
+        //: 1 Round trip representative values of each type.  (C-1)
+        //:
+        //: 2 Decode hand-made invalid payloads.  (C-2)
+        //
+        // Testing:
+        //   void putField(bsl::string *, int, const DATE_TIME_TYPE&);
+        //   int getValue(DATE_TIME_TYPE *, WireType, const char **, end);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DATE AND TIME TYPES" << endl
+                          << "===================" << endl;
+
+        const bdlt::Date     MIN_DATE(1, 1, 1);
+        const bdlt::Date     MAX_DATE(9999, 12, 31);
+        const bdlt::Date     DATE(2026, 10, 19);
+        const bdlt::Time     MIN_TIME(0, 0);
+        const bdlt::Time     MAX_TIME(23, 59, 59, 999, 999);
+        const bdlt::Time     TIME(12, 34, 56, 789, 12);
+        const bdlt::Datetime MIN_DATETIME(MIN_DATE);
+        const bdlt::Datetime MAX_DATETIME(MAX_DATE, MAX_TIME);
+        const bdlt::Datetime DATETIME(DATE, TIME);
+
+        if (verbose) cout << "\nTesting round trips." << endl;
+
+        testRoundTrip(L_, MIN_DATE, DATE);
+        testRoundTrip(L_, MAX_DATE, DATE);
+        testRoundTrip(L_, DATE, MIN_DATE);
+
+        testRoundTrip(L_, bdlt::Time(), TIME);
+        testRoundTrip(L_, MIN_TIME, TIME);
+        testRoundTrip(L_, MAX_TIME, TIME);
+        testRoundTrip(L_, TIME, MIN_TIME);
+
+        testRoundTrip(L_, bdlt::Datetime(), DATETIME);
+        testRoundTrip(L_, MIN_DATETIME, DATETIME);
+        testRoundTrip(L_, MAX_DATETIME, DATETIME);
+        testRoundTrip(L_, DATETIME, MIN_DATETIME);
+
+        for (int offset = -1439; offset <= 1439; offset += 719) {
+            testRoundTrip(L_,
+                          bdlt::DateTz(DATE, offset),
+                          bdlt::DateTz(MIN_DATE, 0));
+            testRoundTrip(L_,
+                          bdlt::TimeTz(TIME, offset),
+                          bdlt::TimeTz(MIN_TIME, 0));
+            testRoundTrip(L_,
+                          bdlt::DatetimeTz(DATETIME, offset),
+                          bdlt::DatetimeTz(MIN_DATETIME, 0));
+            testRoundTrip(L_,
+                          bdlt::DatetimeTz(MAX_DATETIME, offset),
+                          bdlt::DatetimeTz(MIN_DATETIME, 0));
+        }
+        testRoundTrip(L_, bdlt::DateTz(), bdlt::DateTz(DATE, 5));
+        testRoundTrip(L_, bdlt::TimeTz(), bdlt::TimeTz(TIME, 5));
+        testRoundTrip(L_, bdlt::DatetimeTz(), bdlt::DatetimeTz(DATETIME, 5));
+
+        testWrongWireTypes(L_, DATE, MIN_DATE);
+        testWrongWireTypes(L_, TIME, MIN_TIME);
+        testWrongWireTypes(L_, DATETIME, MIN_DATETIME);
+        testWrongWireTypes(L_, bdlt::DateTz(DATE, 5), bdlt::DateTz());
+        testWrongWireTypes(L_, bdlt::TimeTz(TIME, 5), bdlt::TimeTz());
+        testWrongWireTypes(L_,
+                           bdlt::DatetimeTz(DATETIME, 5),
+                           bdlt::DatetimeTz());
+
+        if (verbose) cout << "\nTesting invalid payloads." << endl;
+
+        testInvalidVarint(L_, (MAX_DATE - MIN_DATE) + 1, DATE);
+        testInvalidVarint(L_, bdlt::TimeUnitRatio::k_US_PER_D + 1, TIME);
+        testInvalidVarint(
+                L_,
+                WireUtil::zigzagEncode(
+                      (MAX_DATETIME - MIN_DATETIME).totalMicroseconds() + 1),
+                DATETIME);
+        testInvalidVarint(L_, WireUtil::zigzagEncode(-2), DATETIME);
+
+        {
+            bsl::string body;
+            WireUtil::putKey(&body, 1, WireUtil::e_VARINT);
+            WireUtil::putVarint(&body, 0);
+            WireUtil::putKey(&body, 2, WireUtil::e_VARINT);
+            WireUtil::putVarint(&body, WireUtil::zigzagEncode(1440));
+            testInvalidMessage(L_, body, bdlt::DateTz(DATE, 5));
+        }
+        {
+            // The default time, 24:00, must have a zero offset.
+
+            bsl::string body;
+            WireUtil::putKey(&body, 1, WireUtil::e_VARINT);
+            WireUtil::putVarint(&body, bdlt::TimeUnitRatio::k_US_PER_D);
+            WireUtil::putKey(&body, 2, WireUtil::e_VARINT);
+            WireUtil::putVarint(&body, WireUtil::zigzagEncode(60));
+            testInvalidMessage(L_, body, bdlt::TimeTz(TIME, 5));
+        }
+        {
+            bsl::string body;
+            WireUtil::putKey(&body, 1, WireUtil::e_VARINT);
+            WireUtil::putVarint(&body, WireUtil::zigzagEncode(-1));
+            WireUtil::putKey(&body, 2, WireUtil::e_VARINT);
+            WireUtil::putVarint(&body, WireUtil::zigzagEncode(-60));
+            testInvalidMessage(L_, body, bdlt::DatetimeTz(DATETIME, 5));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // STRINGS AND BYTE ARRAYS
+        //
+        // Concerns:
+        //: 1 Strings and byte arrays round trip, including when empty, when
+        //:   holding null and non-ASCII bytes, and when long enough to need a
+        //:   multi-byte length.
+        //:
+        //: 2 A string and a byte array holding the same bytes have the same
+        //:   encoding.
+        //
+        // Plan:
+        //: 1 Round trip a set of strings and the equivalent byte arrays, and
+        //:   compare their encodings.  (C-1..2)
+        //
+        // Testing:
+        //   void putField(bsl::string *, int, const bsl::string&);
+        //   void putField(bsl::string *, int, const bsl::vector<char>&);
+        //   int getValue(bsl::string *, WireType, const char **, end);
+        //   int getValue(bsl::vector<char> *, WireType, const char **, end);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "STRINGS AND BYTE ARRAYS" << endl
+                          << "=======================" << endl;
+
+        bsl::string values[4];
+        values[1] = "Hello, world";
+        values[2].assign("\x00\xff\x80\x7f", 4);
+        values[3].assign(300, '#');
+
+        const bsl::string      STRING_SENTINEL("sentinel");
+        const bsl::vector<char> BYTES_SENTINEL(3, 'z');
+
+        for (int ti = 0; ti < 4; ++ti) {
+            const bsl::string&      STRING = values[ti];
+            const bsl::vector<char> BYTES(STRING.begin(), STRING.end());
+
+            testRoundTrip(L_, STRING, STRING_SENTINEL);
+            testRoundTrip(L_, BYTES, BYTES_SENTINEL);
+            testWrongWireTypes(L_, STRING, STRING_SENTINEL);
+            testWrongWireTypes(L_, BYTES, BYTES_SENTINEL);
+
+            bsl::string stringBuffer;
+            bsl::string bytesBuffer;
+            Util::putField(&stringBuffer, 5, STRING);
+            Util::putField(&bytesBuffer, 5, BYTES);
+            ASSERTV(ti, stringBuffer == bytesBuffer);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // FLOATING-POINT TYPES
+        //
+        // Concerns:
+        //: 1 'float', 'double', and 'bdldfp::Decimal64' values round trip
+        //:   exactly, including signed zeros, extremes, denormals, and
+        //:   infinities.
+        //:
+        //: 2 NaN values decode as NaN.
+        //:
+        //: 3 The payloads have fixed sizes of 4 and 8 bytes.
+        //
+        // Plan:
+        //: 1 Round trip a set of values of each type.  (C-1)
+        //:
+        //: 2 Round trip a NaN, and verify that the result is a NaN.  (C-2)
+        //:
+        //: 3 Verify the length of an encoded field of each type.  (C-3)
+        //
+        // Testing:
+        //   void putField(bsl::string *, int, FLOATING_POINT_TYPE);
+        //   int getValue(FLOATING_POINT_TYPE *, WireType, const char **, end);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FLOATING-POINT TYPES" << endl
+                          << "====================" << endl;
+
+        typedef bsl::numeric_limits<float>             FloatLimits;
+        typedef bsl::numeric_limits<double>            DoubleLimits;
+        typedef bsl::numeric_limits<bdldfp::Decimal64> DecimalLimits;
+
+        const float FLOATS[] = {
+            0.0f, -0.0f, 1.5f, -3.25e10f,
+            FloatLimits::min(), FloatLimits::max(),
+            FloatLimits::denorm_min(), FloatLimits::infinity(),
+            -FloatLimits::infinity()
+        };
+        const int NUM_FLOATS = sizeof FLOATS / sizeof *FLOATS;
+
+        for (int ti = 0; ti < NUM_FLOATS; ++ti) {
+            testRoundTrip(L_, FLOATS[ti], 42.0f);
+        }
+        testWrongWireTypes(L_, 1.5f, 42.0f);
+
+        const double DOUBLES[] = {
+            0.0, -0.0, 1.5, -3.25e100,
+            DoubleLimits::min(), DoubleLimits::max(),
+            DoubleLimits::denorm_min(), DoubleLimits::infinity(),
+            -DoubleLimits::infinity()
+        };
+        const int NUM_DOUBLES = sizeof DOUBLES / sizeof *DOUBLES;
+
+        for (int ti = 0; ti < NUM_DOUBLES; ++ti) {
+            testRoundTrip(L_, DOUBLES[ti], 42.0);
+        }
+        testWrongWireTypes(L_, 1.5, 42.0);
+
+        const bdldfp::Decimal64 DECIMALS[] = {
+            BDLDFP_DECIMAL_DD(0.0),
+            BDLDFP_DECIMAL_DD(-1.25),
+            BDLDFP_DECIMAL_DD(1234567890123456e-300),
+            DecimalLimits::min(),
+            DecimalLimits::max(),
+            DecimalLimits::infinity(),
+            -DecimalLimits::infinity()
+        };
+        const int NUM_DECIMALS = sizeof DECIMALS / sizeof *DECIMALS;
+
+        for (int ti = 0; ti < NUM_DECIMALS; ++ti) {
+            testRoundTrip(L_, DECIMALS[ti], BDLDFP_DECIMAL_DD(42.0));
+        }
+        testWrongWireTypes(L_,
+                           BDLDFP_DECIMAL_DD(1.5),
+                           BDLDFP_DECIMAL_DD(42.0));
+
+        if (verbose) cout << "\nTesting NaN." << endl;
+        {
+            bsl::string buffer;
+            Util::putField(&buffer, 1, DoubleLimits::quiet_NaN());
+            ASSERT(9 == buffer.size());
+
+            const char *cursor = buffer.data() + 1;
+            double      result = 0;
+            ASSERT(0 == Util::getValue(&result,
+                                       WireUtil::e_FIXED64,
+                                       &cursor,
+                                       buffer.data() + buffer.size()));
+            ASSERT(result != result);
+        }
+        {
+            bsl::string buffer;
+            Util::putField(&buffer, 1, FloatLimits::quiet_NaN());
+            ASSERT(5 == buffer.size());
+
+            const char *cursor = buffer.data() + 1;
+            float       result = 0;
+            ASSERT(0 == Util::getValue(&result,
+                                       WireUtil::e_FIXED32,
+                                       &cursor,
+                                       buffer.data() + buffer.size()));
+            ASSERT(result != result);
+        }
+        {
+            bsl::string buffer;
+            Util::putField(&buffer, 1, DecimalLimits::quiet_NaN());
+            ASSERT(9 == buffer.size());
+
+            const char        *cursor = buffer.data() + 1;
+            bdldfp::Decimal64  result(0);
+            ASSERT(0 == Util::getValue(&result,
+                                       WireUtil::e_FIXED64,
+                                       &cursor,
+                                       buffer.data() + buffer.size()));
+            ASSERT(result != result);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // INTEGRAL TYPES
+        //
+        // Concerns:
+        //: 1 Each integral type round trips, including its extremes.
+        //:
+        //: 2 Signed types use zigzag encoding, so that small negative values
+        //:   have short encodings.
+        //:
+        //: 3 Decoding rejects values outside of the range of the type, and
+        //:   'bool' values other than 0 and 1.
+        //:
+        //: 4 Decoding rejects mismatched wire types.
+        //
+        // Plan:
+        //: 1 For each integral type, round trip the extremes and a few values
+        //:   around zero, decode values just outside of its range, and decode
+        //:   with mismatched wire types.  (C-1, 3..4)
+        //:
+        //: 2 Verify the encoding of small values by hand.  (C-2)
+        //
+        // Testing:
+        //   void putField(bsl::string *, int, INTEGRAL_TYPE);
+        //   int getValue(INTEGRAL_TYPE *, WireType, const char **, end);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INTEGRAL TYPES" << endl
+                          << "==============" << endl;
+
+        testIntegralType<char>();
+        testIntegralType<signed char>();
+        testIntegralType<unsigned char>();
+        testIntegralType<short>();
+        testIntegralType<unsigned short>();
+        testIntegralType<int>();
+        testIntegralType<unsigned int>();
+        testIntegralType<Int64>();
+        testIntegralType<Uint64>();
+
+        testRoundTrip(L_, true, false);
+        testRoundTrip(L_, false, true);
+        testWrongWireTypes(L_, true, false);
+        testInvalidVarint(L_, 2, false);
+
+        {
+            bsl::string buffer;
+            Util::putField(&buffer, 1, -1);
+            Util::putField(&buffer, 2, 1);
+            Util::putField(&buffer, 3, 64u);
+            Util::putField(&buffer, 4, static_cast<char>(-64));
+            Util::putField(&buffer, 5, true);
+            ASSERT(bsl::string("\x08\x01\x10\x02\x18\x40\x20\x7f\x28\x01",
+                               10) == buffer);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Encode a few fields of different types and decode them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const bdlt::DatetimeTz DATETIMETZ(bdlt::Datetime(2026, 10, 19, 9, 30),
+                                          -240);
+
+        bsl::string buffer;
+        Util::putField(&buffer, 1, -12345);
+        Util::putField(&buffer, 2, bsl::string("breathing"));
+        Util::putField(&buffer, 3, 2.5);
+        Util::putField(&buffer, 4, DATETIMETZ);
+
+        if (veryVerbose) { P(buffer.size()) }
+
+        const char *cursor = buffer.data();
+        const char *end    = buffer.data() + buffer.size();
+
+        int      fieldNumber;
+        WireType wireType;
+
+        int i = 0;
+        ASSERT(0 == WireUtil::getKey(&fieldNumber, &wireType, &cursor, end));
+        ASSERT(1 == fieldNumber);
+        ASSERT(0 == Util::getValue(&i, wireType, &cursor, end));
+        ASSERT(-12345 == i);
+
+        bsl::string s;
+        ASSERT(0 == WireUtil::getKey(&fieldNumber, &wireType, &cursor, end));
+        ASSERT(2 == fieldNumber);
+        ASSERT(0 == Util::getValue(&s, wireType, &cursor, end));
+        ASSERT("breathing" == s);
+
+        double d = 0;
+        ASSERT(0 == WireUtil::getKey(&fieldNumber, &wireType, &cursor, end));
+        ASSERT(3 == fieldNumber);
+        ASSERT(0 == Util::getValue(&d, wireType, &cursor, end));
+        ASSERT(2.5 == d);
+
+        bdlt::DatetimeTz dtz;
+        ASSERT(0 == WireUtil::getKey(&fieldNumber, &wireType, &cursor, end));
+        ASSERT(4 == fieldNumber);
+        ASSERT(0 == Util::getValue(&dtz, wireType, &cursor, end));
+        ASSERT(DATETIMETZ == dtz);
+        ASSERT(end == cursor);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
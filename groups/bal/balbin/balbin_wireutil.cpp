@@ -0,0 +1,145 @@
+// balbin_wireutil.cpp                                                -*-C++-*-
+#include <balbin_wireutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balbin_wireutil_cpp,"$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace balbin {
+
+                              // ---------------
+                              // struct WireUtil
+                              // ---------------
+
+// CLASS METHODS
+int WireUtil::varintLength(bsls::Types::Uint64 value)
+{
+    int length = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        ++length;
+    }
+    return length;
+}
+
+                            // Encoding Functions
+
+void WireUtil::putFixed32(bsl::string *buffer, unsigned int value)
+{
+    BSLS_ASSERT(buffer);
+
+    const char bytes[] = { static_cast<char>(value),
+                           static_cast<char>(value >> 8),
+                           static_cast<char>(value >> 16),
+                           static_cast<char>(value >> 24) };
+    buffer->append(bytes, sizeof bytes);
+}
+
+void WireUtil::putFixed64(bsl::string *buffer, bsls::Types::Uint64 value)
+{
+    BSLS_ASSERT(buffer);
+
+    char bytes[8];
+    for (int i = 0; i < 8; ++i) {
+        bytes[i] = static_cast<char>(value >> (8 * i));
+    }
+    buffer->append(bytes, sizeof bytes);
+}
+
+                            // Decoding Functions
+
+int WireUtil::getFixed32(unsigned int  *value,
+                         const char   **cursor,
+                         const char    *end)
+{
+    BSLS_ASSERT(value);
+    BSLS_ASSERT(cursor);
+
+    const unsigned char *bytes =
+                              reinterpret_cast<const unsigned char *>(*cursor);
+    if (end - *cursor < 4) {
+        return -1;                                                    // RETURN
+    }
+
+    *value = static_cast<unsigned int>(bytes[0])
+           | static_cast<unsigned int>(bytes[1]) << 8
+           | static_cast<unsigned int>(bytes[2]) << 16
+           | static_cast<unsigned int>(bytes[3]) << 24;
+    *cursor += 4;
+    return 0;
+}
+
+int WireUtil::getFixed64(bsls::Types::Uint64  *value,
+                         const char          **cursor,
+                         const char           *end)
+{
+    BSLS_ASSERT(value);
+    BSLS_ASSERT(cursor);
+
+    const unsigned char *bytes =
+                              reinterpret_cast<const unsigned char *>(*cursor);
+    if (end - *cursor < 8) {
+        return -1;                                                    // RETURN
+    }
+
+    bsls::Types::Uint64 result = 0;
+    for (int i = 7; 0 <= i; --i) {
+        result = (result << 8) | bytes[i];
+    }
+    *value   = result;
+    *cursor += 8;
+    return 0;
+}
+
+int WireUtil::skipField(WireType      wireType,
+                        const char  **cursor,
+                        const char   *end)
+{
+    BSLS_ASSERT(cursor);
+
+    switch (wireType) {
+      case e_VARINT: {
+        bsls::Types::Uint64 value;
+        return getVarint(&value, cursor, end);                        // RETURN
+      }
+      case e_FIXED64: {
+        if (end - *cursor < 8) {
+            return -1;                                                // RETURN
+        }
+        *cursor += 8;
+        return 0;                                                     // RETURN
+      }
+      case e_LENGTH_DELIMITED: {
+        const char  *data;
+        bsl::size_t  length;
+        return getLengthDelimited(&data, &length, cursor, end);       // RETURN
+      }
+      case e_FIXED32: {
+        if (end - *cursor < 4) {
+            return -1;                                                // RETURN
+        }
+        *cursor += 4;
+        return 0;                                                     // RETURN
+      }
+    }
+    return -1;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,450 @@
+// balbin_wireutil.h                                                  -*-C++-*-
+#ifndef INCLUDED_BALBIN_WIREUTIL
+#define INCLUDED_BALBIN_WIREUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide primitives of a compact, tagged, varint-based wire format.
+//
+//@CLASSES:
+//  balbin::WireUtil: namespace for wire-format encoding and decoding functions
+//
+//@SEE_ALSO: balbin_encoder, balbin_decoder
+//
+//@DESCRIPTION: This component provides a 'struct', 'balbin::WireUtil', that
+// serves as a namespace for functions that append the primitives of the
+// 'balbin' wire format to a 'bsl::string', and that read those primitives
+// from a contiguous range of memory.  The wire format is a sequence of
+// *fields*, each consisting of a *key* followed by a *payload*, in the same
+// layout as the Protocol Buffers wire format:
+//..
+//  key     ::= varint((fieldNumber << 3) | wireType)
+//  payload ::= varint                                 (e_VARINT)
+//            | 8 bytes, little-endian                 (e_FIXED64)
+//            | varint(length) followed by 'length' bytes
+//                                                     (e_LENGTH_DELIMITED)
+//            | 4 bytes, little-endian                 (e_FIXED32)
+//..
+// A *varint* holds an unsigned 64-bit integer in groups of 7 bits, least
+// significant group first, with the high bit of each byte set on all but the
+// last byte, so that values less than 128 occupy a single byte.  Signed
+// integers are first mapped to unsigned ones using the *zigzag* encoding
+// ('0, -1, 1, -2, 2, ...' to '0, 1, 2, 3, 4, ...'), so that values of small
+// magnitude are short whatever their sign.
+//
+// Because the wire type of every field determines the length of its payload,
+// a decoder can skip a field it does not recognize without knowing its type,
+// which is what makes the format forward compatible: 'skipField' does exactly
+// that.
+//
+// The functions reading from memory take the address of a *cursor* into the
+// input and the end of the input, advance the cursor past the primitive read
+// on success, and return a non-zero value, leaving the cursor unchanged, if
+// the input is truncated or malformed.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing and Reading a Field
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose we want to write a field having number 3 and the signed value -300,
+// and read it back.
+//
+// First, we append the key and the zigzag-encoded value to a buffer:
+//..
+//  bsl::string buffer;
+//  balbin::WireUtil::putKey(&buffer, 3, balbin::WireUtil::e_VARINT);
+//  balbin::WireUtil::putVarint(&buffer,
+//                              balbin::WireUtil::zigzagEncode(-300));
+//  assert(3 == buffer.length());
+//..
+// Then, we read the key back:
+//..
+//  const char *cursor = buffer.data();
+//  const char *end    = buffer.data() + buffer.length();
+//
+//  int                        fieldNumber;
+//  balbin::WireUtil::WireType wireType;
+//  int rc = balbin::WireUtil::getKey(&fieldNumber, &wireType, &cursor, end);
+//  assert(0                             == rc);
+//  assert(3                             == fieldNumber);
+//  assert(balbin::WireUtil::e_VARINT    == wireType);
+//..
+// Finally, we read the value, and verify that all of the input was consumed:
+//..
+//  bsls::Types::Uint64 encoded;
+//  rc = balbin::WireUtil::getVarint(&encoded, &cursor, end);
+//  assert(0    == rc);
+//  assert(-300 == balbin::WireUtil::zigzagDecode(encoded));
+//  assert(end  == cursor);
+//..
+
+#include <balscm_version.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace balbin {
+
+                              // ===============
+                              // struct WireUtil
+                              // ===============
+
+struct WireUtil {
+    // This 'struct' provides a namespace for functions that encode and decode
+    // the primitives of the 'balbin' wire format.
+
+    // TYPES
+    enum WireType {
+        // This enumeration defines the types of field payloads.
+
+        e_VARINT           = 0,  // varint
+        e_FIXED64          = 1,  // 8 bytes, little-endian
+        e_LENGTH_DELIMITED = 2,  // varint length followed by the bytes
+        e_FIXED32          = 5   // 4 bytes, little-endian
+    };
+
+    enum {
+        k_MAX_VARINT_LENGTH = 10,            // bytes in the longest varint
+        k_MAX_FIELD_NUMBER  = (1 << 29) - 1  // largest valid field number
+    };
+
+    // CLASS METHODS
+    static bsls::Types::Uint64 zigzagEncode(bsls::Types::Int64 value);
+        // Return the zigzag encoding of the specified 'value'.
+
+    static bsls::Types::Int64 zigzagDecode(bsls::Types::Uint64 value);
+        // Return the signed integer whose zigzag encoding is the specified
+        // 'value'.
+
+    static int varintLength(bsls::Types::Uint64 value);
+        // Return the number of bytes in the varint encoding of the specified
+        // 'value'.
+
+    static int encodeVarint(char *buffer, bsls::Types::Uint64 value);
+        // Write the varint encoding of the specified 'value' to the specified
+        // 'buffer', and return the number of bytes written.  The behavior is
+        // undefined unless 'buffer' has room for at least
+        // 'k_MAX_VARINT_LENGTH' bytes.
+
+                            // Encoding Functions
+
+    static void putVarint(bsl::string *buffer, bsls::Types::Uint64 value);
+        // Append the varint encoding of the specified 'value' to the specified
+        // 'buffer'.
+
+    static void putFixed32(bsl::string *buffer, unsigned int value);
+        // Append the 4-byte little-endian encoding of the specified 'value' to
+        // the specified 'buffer'.
+
+    static void putFixed64(bsl::string *buffer, bsls::Types::Uint64 value);
+        // Append the 8-byte little-endian encoding of the specified 'value' to
+        // the specified 'buffer'.
+
+    static void putKey(bsl::string *buffer,
+                       int          fieldNumber,
+                       WireType     wireType);
+        // Append to the specified 'buffer' the key of a field having the
+        // specified 'fieldNumber' and 'wireType'.  The behavior is undefined
+        // unless '1 <= fieldNumber <= k_MAX_FIELD_NUMBER'.
+
+    static void putLengthDelimited(bsl::string *buffer,
+                                   const char  *data,
+                                   bsl::size_t  length);
+        // Append to the specified 'buffer' the specified 'length' followed by
+        // the specified 'length' bytes at the specified 'data' address.
+
+    static bsl::size_t beginLengthDelimited(bsl::string *buffer);
+        // Reserve space in the specified 'buffer' for the length of a
+        // length-delimited payload whose bytes will be appended next, and
+        // return a position to be passed to 'endLengthDelimited' once they
+        // have been.
+
+    static void endLengthDelimited(bsl::string *buffer, bsl::size_t position);
+        // Store, at the specified 'position' of the specified 'buffer', the
+        // length of the bytes appended since 'position' was returned by
+        // 'beginLengthDelimited', moving those bytes if the length needs more
+        // than the space reserved.
+
+                            // Decoding Functions
+
+    static int getVarint(bsls::Types::Uint64  *value,
+                         const char          **cursor,
+                         const char           *end);
+        // Read a varint from the specified '*cursor', not reading at or beyond
+        // the specified 'end', load its value into the specified 'value', and
+        // advance '*cursor' past it.  Return 0 on success, and a non-zero
+        // value, with no effect, if the input is truncated, or the varint is
+        // longer than 'k_MAX_VARINT_LENGTH' bytes or its value does not fit
+        // in 64 bits.
+
+    static int getFixed32(unsigned int  *value,
+                          const char   **cursor,
+                          const char    *end);
+        // Read a 4-byte little-endian integer from the specified '*cursor',
+        // not reading at or beyond the specified 'end', load it into the
+        // specified 'value', and advance '*cursor' past it.  Return 0 on
+        // success, and a non-zero value, with no effect, if the input is
+        // truncated.
+
+    static int getFixed64(bsls::Types::Uint64  *value,
+                          const char          **cursor,
+                          const char           *end);
+        // Read an 8-byte little-endian integer from the specified '*cursor',
+        // not reading at or beyond the specified 'end', load it into the
+        // specified 'value', and advance '*cursor' past it.  Return 0 on
+        // success, and a non-zero value, with no effect, if the input is
+        // truncated.
+
+    static int getKey(int          *fieldNumber,
+                      WireType     *wireType,
+                      const char  **cursor,
+                      const char   *end);
+        // Read a field key from the specified '*cursor', not reading at or
+        // beyond the specified 'end', load its field number and wire type
+        // into the specified 'fieldNumber' and 'wireType', and advance
+        // '*cursor' past it.  Return 0 on success, and a non-zero value, with
+        // no effect, if the input is truncated, or the key does not hold a
+        // field number in '[1 .. k_MAX_FIELD_NUMBER]' and one of the wire
+        // types enumerated by 'WireType'.
+
+    static int getLengthDelimited(const char  **data,
+                                  bsl::size_t  *length,
+                                  const char  **cursor,
+                                  const char   *end);
+        // Read a length-delimited payload from the specified '*cursor', not
+        // reading at or beyond the specified 'end', load the address and the
+        // length of its bytes into the specified 'data' and 'length', and
+        // advance '*cursor' past it.  Return 0 on success, and a non-zero
+        // value, with no effect, if the input is truncated.
+
+    static int skipField(WireType      wireType,
+                         const char  **cursor,
+                         const char   *end);
+        // Advance the specified '*cursor' past the payload of a field having
+        // the specified 'wireType', not reading at or beyond the specified
+        // 'end'.  Return 0 on success, and a non-zero value, with no effect,
+        // if the payload is truncated or malformed.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // ---------------
+                              // struct WireUtil
+                              // ---------------
+
+// CLASS METHODS
+inline
+bsls::Types::Uint64 WireUtil::zigzagEncode(bsls::Types::Int64 value)
+{
+    return (static_cast<bsls::Types::Uint64>(value) << 1)
+         ^ static_cast<bsls::Types::Uint64>(value >> 63);
+}
+
+inline
+bsls::Types::Int64 WireUtil::zigzagDecode(bsls::Types::Uint64 value)
+{
+    return static_cast<bsls::Types::Int64>(value >> 1)
+         ^ -static_cast<bsls::Types::Int64>(value & 1);
+}
+
+inline
+int WireUtil::encodeVarint(char *buffer, bsls::Types::Uint64 value)
+{
+    int length = 0;
+    while (value >= 0x80) {
+        buffer[length++] = static_cast<char>((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    buffer[length++] = static_cast<char>(value);
+    return length;
+}
+
+                            // Encoding Functions
+
+inline
+void WireUtil::putVarint(bsl::string *buffer, bsls::Types::Uint64 value)
+{
+    BSLS_ASSERT(buffer);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(value < 0x80)) {
+        buffer->push_back(static_cast<char>(value));
+        return;                                                       // RETURN
+    }
+
+    char bytes[k_MAX_VARINT_LENGTH];
+    buffer->append(bytes, encodeVarint(bytes, value));
+}
+
+inline
+void WireUtil::putKey(bsl::string *buffer, int fieldNumber, WireType wireType)
+{
+    BSLS_ASSERT(1 <= fieldNumber);
+    BSLS_ASSERT(fieldNumber <= k_MAX_FIELD_NUMBER);
+
+    putVarint(buffer,
+              (static_cast<bsls::Types::Uint64>(fieldNumber) << 3) | wireType);
+}
+
+inline
+void WireUtil::putLengthDelimited(bsl::string *buffer,
+                                  const char  *data,
+                                  bsl::size_t  length)
+{
+    putVarint(buffer, length);
+    buffer->append(data, length);
+}
+
+inline
+bsl::size_t WireUtil::beginLengthDelimited(bsl::string *buffer)
+{
+    BSLS_ASSERT(buffer);
+
+    // Reserve a single byte, which suffices for payloads of fewer than 128
+    // bytes; 'endLengthDelimited' makes room for longer lengths.
+
+    const bsl::size_t position = buffer->length();
+    buffer->push_back('\0');
+    return position;
+}
+
+inline
+void WireUtil::endLengthDelimited(bsl::string *buffer, bsl::size_t position)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(position < buffer->length());
+
+    const bsl::size_t length = buffer->length() - position - 1;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(length < 0x80)) {
+        (*buffer)[position] = static_cast<char>(length);
+        return;                                                       // RETURN
+    }
+
+    char bytes[k_MAX_VARINT_LENGTH];
+    buffer->replace(position, 1, bytes, encodeVarint(bytes, length));
+}
+
+                            // Decoding Functions
+
+inline
+int WireUtil::getVarint(bsls::Types::Uint64  *value,
+                        const char          **cursor,
+                        const char           *end)
+{
+    BSLS_ASSERT(value);
+    BSLS_ASSERT(cursor);
+    BSLS_ASSERT(*cursor);
+
+    const char *iter = *cursor;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(iter < end
+                                         && 0 == (*iter & 0x80))) {
+        *value  = static_cast<unsigned char>(*iter);
+        *cursor = iter + 1;
+        return 0;                                                     // RETURN
+    }
+
+    bsls::Types::Uint64 result = 0;
+    for (int shift = 0; iter < end && shift < 64; shift += 7) {
+        const bsls::Types::Uint64 byte = static_cast<unsigned char>(*iter++);
+
+        if (63 == shift && 1 < byte) {
+            return -1;                                                // RETURN
+        }
+        result |= (byte & 0x7F) << shift;
+
+        if (0 == (byte & 0x80)) {
+            *value  = result;
+            *cursor = iter;
+            return 0;                                                 // RETURN
+        }
+    }
+    return -1;
+}
+
+inline
+int WireUtil::getKey(int          *fieldNumber,
+                     WireType     *wireType,
+                     const char  **cursor,
+                     const char   *end)
+{
+    BSLS_ASSERT(fieldNumber);
+    BSLS_ASSERT(wireType);
+
+    const char          *iter = *cursor;
+    bsls::Types::Uint64  key;
+
+    if (0 != getVarint(&key, &iter, end)) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsls::Types::Uint64 number = key >> 3;
+    const int                 type   = static_cast<int>(key & 0x7);
+
+    if (0 == number || k_MAX_FIELD_NUMBER < number) {
+        return -1;                                                    // RETURN
+    }
+    if (e_VARINT           != type && e_FIXED64 != type &&
+        e_LENGTH_DELIMITED != type && e_FIXED32 != type) {
+        return -1;                                                    // RETURN
+    }
+
+    *fieldNumber = static_cast<int>(number);
+    *wireType    = static_cast<WireType>(type);
+    *cursor      = iter;
+    return 0;
+}
+
+inline
+int WireUtil::getLengthDelimited(const char  **data,
+                                 bsl::size_t  *length,
+                                 const char  **cursor,
+                                 const char   *end)
+{
+    BSLS_ASSERT(data);
+    BSLS_ASSERT(length);
+
+    const char          *iter = *cursor;
+    bsls::Types::Uint64  size;
+
+    if (0 != getVarint(&size, &iter, end)
+     || static_cast<bsls::Types::Uint64>(end - iter) < size) {
+        return -1;                                                    // RETURN
+    }
+
+    *data   = iter;
+    *length = static_cast<bsl::size_t>(size);
+    *cursor = iter + size;
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
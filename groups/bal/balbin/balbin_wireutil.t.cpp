@@ -0,0 +1,787 @@
+// balbin_wireutil.t.cpp                                              -*-C++-*-
+#include <balbin_wireutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_types.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a utility of stateless functions that encode
+// the primitives of a wire format to a string and decode them from memory.
+// For each primitive we verify the exact encoding of boundary values, that
+// decoding inverts encoding, and that decoding rejects every truncated or
+// malformed input without advancing the cursor.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] Uint64 zigzagEncode(Int64 value);
+// [ 2] Int64 zigzagDecode(Uint64 value);
+// [ 3] int varintLength(Uint64 value);
+// [ 3] int encodeVarint(char *buffer, Uint64 value);
+// [ 3] void putVarint(bsl::string *buffer, Uint64 value);
+// [ 3] int getVarint(Uint64 *value, const char **c, const char *e);
+// [ 4] void putFixed32(bsl::string *buffer, unsigned int value);
+// [ 4] void putFixed64(bsl::string *buffer, Uint64 value);
+// [ 4] int getFixed32(unsigned int *v, const char **c, const char *e);
+// [ 4] int getFixed64(Uint64 *value, const char **c, const char *e);
+// [ 5] void putKey(bsl::string *buffer, int fieldNumber, WireType type);
+// [ 5] int getKey(int *, WireType *, const char **cursor, const char *e);
+// [ 6] void putLengthDelimited(bsl::string *, const char *, size_t);
+// [ 6] size_t beginLengthDelimited(bsl::string *buffer);
+// [ 6] void endLengthDelimited(bsl::string *buffer, size_t position);
+// [ 6] int getLengthDelimited(const char **, size_t *, const char **, e);
+// [ 7] int skipField(WireType type, const char **cursor, const char *e);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balbin::WireUtil   Util;
+typedef bsls::Types::Int64  Int64;
+typedef bsls::Types::Uint64 Uint64;
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose             = argc > 2;
+    bool veryVerbose         = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing and Reading a Field
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose we want to write a field having number 3 and the signed value -300,
+// and read it back.
+//
+// First, we append the key and the zigzag-encoded value to a buffer:
+//..
+    bsl::string buffer;
+    balbin::WireUtil::putKey(&buffer, 3, balbin::WireUtil::e_VARINT);
+    balbin::WireUtil::putVarint(&buffer,
+                                balbin::WireUtil::zigzagEncode(-300));
+    ASSERT(3 == buffer.length());
+//..
+// Then, we read the key back:
+//..
+    const char *cursor = buffer.data();
+    const char *end    = buffer.data() + buffer.length();
+
+    int                        fieldNumber;
+    balbin::WireUtil::WireType wireType;
+    int rc = balbin::WireUtil::getKey(&fieldNumber, &wireType, &cursor, end);
+    ASSERT(0                             == rc);
+    ASSERT(3                             == fieldNumber);
+    ASSERT(balbin::WireUtil::e_VARINT    == wireType);
+//..
+// Finally, we read the value, and verify that all of the input was consumed:
+//..
+    bsls::Types::Uint64 encoded;
+    rc = balbin::WireUtil::getVarint(&encoded, &cursor, end);
+    ASSERT(0    == rc);
+    ASSERT(-300 == balbin::WireUtil::zigzagDecode(encoded));
+    ASSERT(end  == cursor);
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // 'skipField'
+        //
+        // Concerns:
+        //: 1 'skipField' advances the cursor past exactly the payload of a
+        //:   field of each wire type.
+        //:
+        //: 2 'skipField' fails, without advancing the cursor, if the payload
+        //:   is truncated.
+        //
+        // Plan:
+        //: 1 For each wire type, encode a payload followed by a marker byte,
+        //:   skip the payload, and verify that the cursor is at the marker.
+        //:   (C-1)
+        //:
+        //: 2 Repeat P-1 for every strict prefix of the payload, and verify
+        //:   that 'skipField' fails and leaves the cursor unchanged.  (C-2)
+        //
+        // Testing:
+        //   int skipField(WireType type, const char **cursor, const char *e);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'skipField'" << endl
+                          << "===========" << endl;
+
+        for (int ti = 0; ti < 4; ++ti) {
+            bsl::string    payload;
+            Util::WireType wireType = Util::e_VARINT;
+
+            switch (ti) {
+              case 0: {
+                wireType = Util::e_VARINT;
+                Util::putVarint(&payload, 1234567890123ULL);
+              } break;
+              case 1: {
+                wireType = Util::e_FIXED64;
+                Util::putFixed64(&payload, 42);
+              } break;
+              case 2: {
+                wireType = Util::e_LENGTH_DELIMITED;
+                const bsl::string data(200, 'x');
+                Util::putLengthDelimited(&payload, data.data(), data.size());
+              } break;
+              case 3: {
+                wireType = Util::e_FIXED32;
+                Util::putFixed32(&payload, 42);
+              } break;
+            }
+
+            const bsl::string INPUT = payload + '!';
+
+            const char *cursor = INPUT.data();
+            ASSERTV(ti, 0 == Util::skipField(wireType,
+                                             &cursor,
+                                             INPUT.data() + INPUT.size()));
+            ASSERTV(ti, '!' == *cursor);
+
+            for (bsl::size_t length = 0; length < payload.size(); ++length) {
+                cursor = payload.data();
+                ASSERTV(ti, length,
+                        0 != Util::skipField(wireType,
+                                             &cursor,
+                                             payload.data() + length));
+                ASSERTV(ti, length, payload.data() == cursor);
+            }
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // LENGTH-DELIMITED PAYLOADS
+        //
+        // Concerns:
+        //: 1 'putLengthDelimited' writes the varint length followed by the
+        //:   bytes.
+        //:
+        //: 2 'beginLengthDelimited' and 'endLengthDelimited' produce the same
+        //:   encoding as 'putLengthDelimited', including for lengths needing
+        //:   more than one byte, and after existing contents.
+        //:
+        //: 3 'getLengthDelimited' returns the address and length of the bytes,
+        //:   and fails, without advancing the cursor, if the input holds fewer
+        //:   bytes than the length.
+        //
+        // Plan:
+        //: 1 For lengths around the varint length boundaries, produce a
+        //:   payload with both methods after a prefix, and compare them; then
+        //:   decode the payload and verify the result.  (C-1..2)
+        //:
+        //: 2 Decode each payload with the last byte removed.  (C-3)
+        //
+        // Testing:
+        //   void putLengthDelimited(bsl::string *, const char *, size_t);
+        //   size_t beginLengthDelimited(bsl::string *buffer);
+        //   void endLengthDelimited(bsl::string *buffer, size_t position);
+        //   int getLengthDelimited(const char **, size_t *, const char **, e);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LENGTH-DELIMITED PAYLOADS" << endl
+                          << "=========================" << endl;
+
+        static const bsl::size_t LENGTHS[] = {
+            0, 1, 126, 127, 128, 129, 16383, 16384, 70000
+        };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int li = 0; li < NUM_LENGTHS; ++li) {
+            const bsl::size_t LENGTH = LENGTHS[li];
+
+            bsl::string data(LENGTH, 'a');
+            for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                data[i] = static_cast<char>('a' + i % 26);
+            }
+
+            const bsl::string PREFIX("pre");
+
+            bsl::string expected(PREFIX);
+            Util::putLengthDelimited(&expected, data.data(), data.size());
+
+            ASSERTV(LENGTH,
+                    PREFIX.size() + Util::varintLength(LENGTH) + LENGTH ==
+                                                              expected.size());
+
+            bsl::string       buffer(PREFIX);
+            const bsl::size_t position = Util::beginLengthDelimited(&buffer);
+            ASSERTV(LENGTH, PREFIX.size() == position);
+            buffer.append(data);
+            Util::endLengthDelimited(&buffer, position);
+
+            ASSERTV(LENGTH, expected == buffer);
+
+            const char  *cursor = buffer.data() + PREFIX.size();
+            const char  *end    = buffer.data() + buffer.size();
+            const char  *bytes  = 0;
+            bsl::size_t  length = 0;
+
+            ASSERTV(LENGTH,
+                    0 == Util::getLengthDelimited(&bytes,
+                                                  &length,
+                                                  &cursor,
+                                                  end));
+            ASSERTV(LENGTH, end == cursor);
+            ASSERTV(LENGTH, LENGTH == length);
+            ASSERTV(LENGTH, data == bsl::string(bytes, length));
+
+            cursor = buffer.data() + PREFIX.size();
+            ASSERTV(LENGTH,
+                    0 != Util::getLengthDelimited(&bytes,
+                                                  &length,
+                                                  &cursor,
+                                                  end - 1));
+            ASSERTV(LENGTH, buffer.data() + PREFIX.size() == cursor);
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // KEYS
+        //
+        // Concerns:
+        //: 1 A key holds the field number shifted left by three bits, ORed
+        //:   with the wire type, as a varint.
+        //:
+        //: 2 'getKey' inverts 'putKey' for every wire type and for the
+        //:   smallest and largest field numbers.
+        //:
+        //: 3 'getKey' rejects field number 0, field numbers greater than
+        //:   'k_MAX_FIELD_NUMBER', and undefined wire types, without
+        //:   advancing the cursor.
+        //
+        // Plan:
+        //: 1 Encode keys for a set of field numbers and all wire types, and
+        //:   verify the encoding and the decoded values.  (C-1..2)
+        //:
+        //: 2 Decode hand-made invalid keys.  (C-3)
+        //
+        // Testing:
+        //   void putKey(bsl::string *buffer, int fieldNumber, WireType type);
+        //   int getKey(int *, WireType *, const char **cursor, const char *e);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "KEYS" << endl
+                          << "====" << endl;
+
+        static const int NUMBERS[] = {
+            1, 2, 15, 16, 2047, 2048, Util::k_MAX_FIELD_NUMBER
+        };
+        const int NUM_NUMBERS = sizeof NUMBERS / sizeof *NUMBERS;
+
+        static const Util::WireType TYPES[] = {
+            Util::e_VARINT,
+            Util::e_FIXED64,
+            Util::e_LENGTH_DELIMITED,
+            Util::e_FIXED32
+        };
+        const int NUM_TYPES = sizeof TYPES / sizeof *TYPES;
+
+        for (int ni = 0; ni < NUM_NUMBERS; ++ni) {
+            for (int ti = 0; ti < NUM_TYPES; ++ti) {
+                const int            NUMBER = NUMBERS[ni];
+                const Util::WireType TYPE   = TYPES[ti];
+
+                bsl::string buffer;
+                Util::putKey(&buffer, NUMBER, TYPE);
+
+                bsl::string expected;
+                Util::putVarint(&expected,
+                                (static_cast<Uint64>(NUMBER) << 3) | TYPE);
+                ASSERTV(NUMBER, TYPE, expected == buffer);
+
+                const char     *cursor = buffer.data();
+                int             number = 0;
+                Util::WireType  type   = Util::e_VARINT;
+
+                ASSERTV(NUMBER, TYPE,
+                        0 == Util::getKey(&number,
+                                          &type,
+                                          &cursor,
+                                          buffer.data() + buffer.size()));
+                ASSERTV(NUMBER, TYPE, NUMBER == number);
+                ASSERTV(NUMBER, TYPE, TYPE   == type);
+                ASSERTV(NUMBER, TYPE, buffer.data() + buffer.size() == cursor);
+            }
+        }
+
+        static const Uint64 INVALID[] = {
+            0 << 3 | 0,                                           // number 0
+            0 << 3 | 2,                                           // number 0
+            1 << 3 | 3,                                           // group
+            1 << 3 | 4,                                           // end group
+            1 << 3 | 6,                                           // undefined
+            1 << 3 | 7,                                           // undefined
+            (static_cast<Uint64>(Util::k_MAX_FIELD_NUMBER) + 1) << 3,
+            ~static_cast<Uint64>(0)
+        };
+        const int NUM_INVALID = sizeof INVALID / sizeof *INVALID;
+
+        for (int i = 0; i < NUM_INVALID; ++i) {
+            bsl::string buffer;
+            Util::putVarint(&buffer, INVALID[i]);
+
+            const char     *cursor = buffer.data();
+            int             number = 0;
+            Util::WireType  type   = Util::e_VARINT;
+
+            ASSERTV(i, 0 != Util::getKey(&number,
+                                         &type,
+                                         &cursor,
+                                         buffer.data() + buffer.size()));
+            ASSERTV(i, buffer.data() == cursor);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // FIXED-SIZE INTEGERS
+        //
+        // Concerns:
+        //: 1 Fixed-size integers are written in little-endian byte order.
+        //:
+        //: 2 Decoding inverts encoding, and fails, without advancing the
+        //:   cursor, if the input is truncated.
+        //
+        // Plan:
+        //: 1 Encode values having distinct bytes, and verify the bytes, then
+        //:   decode them, and decode every strict prefix.  (C-1..2)
+        //
+        // Testing:
+        //   void putFixed32(bsl::string *buffer, unsigned int value);
+        //   void putFixed64(bsl::string *buffer, Uint64 value);
+        //   int getFixed32(unsigned int *v, const char **c, const char *e);
+        //   int getFixed64(Uint64 *value, const char **c, const char *e);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FIXED-SIZE INTEGERS" << endl
+                          << "===================" << endl;
+
+        {
+            bsl::string buffer;
+            Util::putFixed32(&buffer, 0xF1020304u);
+            ASSERT(bsl::string("\x04\x03\x02\xF1", 4) == buffer);
+
+            for (bsl::size_t length = 0; length <= 4; ++length) {
+                const char   *cursor = buffer.data();
+                unsigned int  value  = 0;
+                const int     rc     = Util::getFixed32(
+                                                      &value,
+                                                      &cursor,
+                                                      buffer.data() + length);
+                if (4 == length) {
+                    ASSERT(0           == rc);
+                    ASSERT(0xF1020304u == value);
+                    ASSERT(buffer.data() + 4 == cursor);
+                }
+                else {
+                    ASSERTV(length, 0             != rc);
+                    ASSERTV(length, buffer.data() == cursor);
+                }
+            }
+        }
+        {
+            const Uint64 VALUE = 0xF102030405060708ULL;
+
+            bsl::string buffer;
+            Util::putFixed64(&buffer, VALUE);
+            ASSERT(bsl::string("\x08\x07\x06\x05\x04\x03\x02\xF1", 8) ==
+                                                                      buffer);
+
+            for (bsl::size_t length = 0; length <= 8; ++length) {
+                const char *cursor = buffer.data();
+                Uint64      value  = 0;
+                const int   rc     = Util::getFixed64(&value,
+                                                      &cursor,
+                                                      buffer.data() + length);
+                if (8 == length) {
+                    ASSERT(0     == rc);
+                    ASSERT(VALUE == value);
+                    ASSERT(buffer.data() + 8 == cursor);
+                }
+                else {
+                    ASSERTV(length, 0             != rc);
+                    ASSERTV(length, buffer.data() == cursor);
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // VARINTS
+        //
+        // Concerns:
+        //: 1 A varint holds 7 bits per byte, least significant first, with the
+        //:   continuation bit set on all bytes but the last.
+        //:
+        //: 2 'varintLength' returns the number of bytes written by
+        //:   'encodeVarint' and 'putVarint', which append to the buffer.
+        //:
+        //: 3 'getVarint' inverts 'putVarint' for every length, and fails,
+        //:   without advancing the cursor, if the varint is truncated, longer
+        //:   than 10 bytes, or does not fit in 64 bits.
+        //:
+        //: 4 'getVarint' accepts redundant (non-minimal) encodings of up to 10
+        //:   bytes.
+        //
+        // Plan:
+        //: 1 Verify the encoding of a few values by hand.  (C-1)
+        //:
+        //: 2 For each power of two and its neighbors, encode and decode the
+        //:   value, and decode each strict prefix of its encoding.  (C-2..3)
+        //:
+        //: 3 Decode hand-made overlong, overflowing, and redundant varints.
+        //:   (C-3..4)
+        //
+        // Testing:
+        //   int varintLength(Uint64 value);
+        //   int encodeVarint(char *buffer, Uint64 value);
+        //   void putVarint(bsl::string *buffer, Uint64 value);
+        //   int getVarint(Uint64 *value, const char **c, const char *e);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VARINTS" << endl
+                          << "=======" << endl;
+
+        if (verbose) cout << "\nTesting known encodings." << endl;
+        {
+            static const struct {
+                int         d_line;
+                Uint64      d_value;
+                const char *d_expected;
+                int         d_length;
+            } DATA[] = {
+                //LINE  VALUE   EXPECTED                          LEN
+                //----  -----   --------------------------------  ---
+                { L_,   0,      "\x00",                             1 },
+                { L_,   1,      "\x01",                             1 },
+                { L_,   127,    "\x7f",                             1 },
+                { L_,   128,    "\x80\x01",                         2 },
+                { L_,   300,    "\xac\x02",                         2 },
+                { L_,   16383,  "\xff\x7f",                         2 },
+                { L_,   16384,  "\x80\x80\x01",                     3 },
+                { L_,   ~0ULL,  "\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01",
+                                                                    10 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE   = DATA[ti].d_line;
+                const Uint64      VALUE  = DATA[ti].d_value;
+                const bsl::string EXPECTED(DATA[ti].d_expected,
+                                           DATA[ti].d_length);
+
+                bsl::string buffer("x");
+                Util::putVarint(&buffer, VALUE);
+                ASSERTV(LINE, "x" + EXPECTED == buffer);
+
+                char      bytes[Util::k_MAX_VARINT_LENGTH];
+                const int length = Util::encodeVarint(bytes, VALUE);
+                ASSERTV(LINE, EXPECTED == bsl::string(bytes, length));
+                ASSERTV(LINE, length == Util::varintLength(VALUE));
+            }
+        }
+
+        if (verbose) cout << "\nTesting round trips." << endl;
+
+        for (int bit = 0; bit < 64; ++bit) {
+            const Uint64 POWER = static_cast<Uint64>(1) << bit;
+
+            for (int delta = -1; delta <= 1; ++delta) {
+                const Uint64 VALUE = POWER + delta;
+
+                bsl::string buffer;
+                Util::putVarint(&buffer, VALUE);
+                ASSERTV(VALUE,
+                        Util::varintLength(VALUE) ==
+                                            static_cast<int>(buffer.size()));
+
+                const char *cursor = buffer.data();
+                Uint64      value  = 0;
+                ASSERTV(VALUE,
+                        0 == Util::getVarint(&value,
+                                             &cursor,
+                                             buffer.data() + buffer.size()));
+                ASSERTV(VALUE, value == VALUE);
+                ASSERTV(VALUE, buffer.data() + buffer.size() == cursor);
+
+                for (bsl::size_t length = 0;
+                     length < buffer.size();
+                     ++length) {
+                    cursor = buffer.data();
+                    ASSERTV(VALUE, length,
+                            0 != Util::getVarint(&value,
+                                                 &cursor,
+                                                 buffer.data() + length));
+                    ASSERTV(VALUE, length, buffer.data() == cursor);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting malformed and redundant varints."
+                          << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_input;
+                int         d_length;
+                bool        d_valid;
+                Uint64      d_value;
+            } DATA[] = {
+                //LINE  INPUT                                      LEN  VALID
+                //----  -----------------------------------------  ---  -----
+                { L_,   "\x80\x00",                                  2, true,
+                                                                         0 },
+                { L_,   "\xff\x80\x80\x00",                          4, true,
+                                                                       127 },
+                { L_,   "\x80\x80\x80\x80\x80\x80\x80\x80\x80\x00", 10, true,
+                                                                         0 },
+                { L_,   "\xff\xff\xff\xff\xff\xff\xff\xff\xff\x02", 10, false,
+                                                                         0 },
+                { L_,   "\xff\xff\xff\xff\xff\xff\xff\xff\xff\x81", 10, false,
+                                                                         0 },
+                { L_,   "\x80\x80\x80\x80\x80\x80\x80\x80\x80\x80\x00",
+                                                                11, false, 0 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE   = DATA[ti].d_line;
+                const char *INPUT  = DATA[ti].d_input;
+                const int   LENGTH = DATA[ti].d_length;
+                const bool  VALID  = DATA[ti].d_valid;
+                const Uint64 VALUE = DATA[ti].d_value;
+
+                const char *cursor = INPUT;
+                Uint64      value  = 99;
+                const int   rc     = Util::getVarint(&value,
+                                                     &cursor,
+                                                     INPUT + LENGTH);
+                if (VALID) {
+                    ASSERTV(LINE, 0              == rc);
+                    ASSERTV(LINE, VALUE          == value);
+                    ASSERTV(LINE, INPUT + LENGTH == cursor);
+                }
+                else {
+                    ASSERTV(LINE, 0     != rc);
+                    ASSERTV(LINE, 99    == value);
+                    ASSERTV(LINE, INPUT == cursor);
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // ZIGZAG ENCODING
+        //
+        // Concerns:
+        //: 1 Zigzag encoding maps '0, -1, 1, -2, 2, ...' to '0, 1, 2, 3, 4,
+        //:   ...', including the extremes of 'Int64'.
+        //:
+        //: 2 'zigzagDecode' inverts 'zigzagEncode'.
+        //
+        // Plan:
+        //: 1 Verify the encoding of small values and the extremes, and the
+        //:   round trip of a range of values.  (C-1..2)
+        //
+        // Testing:
+        //   Uint64 zigzagEncode(Int64 value);
+        //   Int64 zigzagDecode(Uint64 value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ZIGZAG ENCODING" << endl
+                          << "===============" << endl;
+
+        const Int64 MIN = bsl::numeric_limits<Int64>::min();
+        const Int64 MAX = bsl::numeric_limits<Int64>::max();
+
+        ASSERT(0 == Util::zigzagEncode( 0));
+        ASSERT(1 == Util::zigzagEncode(-1));
+        ASSERT(2 == Util::zigzagEncode( 1));
+        ASSERT(3 == Util::zigzagEncode(-2));
+        ASSERT(4 == Util::zigzagEncode( 2));
+        ASSERT(~static_cast<Uint64>(0)     == Util::zigzagEncode(MIN));
+        ASSERT(~static_cast<Uint64>(0) - 1 == Util::zigzagEncode(MAX));
+
+        for (Int64 value = -1000; value <= 1000; ++value) {
+            ASSERTV(value, value == Util::zigzagDecode(
+                                                  Util::zigzagEncode(value)));
+        }
+        ASSERT(MIN == Util::zigzagDecode(Util::zigzagEncode(MIN)));
+        ASSERT(MAX == Util::zigzagDecode(Util::zigzagEncode(MAX)));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write a field of each wire type, and read them back.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bsl::string buffer;
+        Util::putKey(&buffer, 1, Util::e_VARINT);
+        Util::putVarint(&buffer, 150);
+        Util::putKey(&buffer, 2, Util::e_LENGTH_DELIMITED);
+        Util::putLengthDelimited(&buffer, "testing", 7);
+        Util::putKey(&buffer, 3, Util::e_FIXED32);
+        Util::putFixed32(&buffer, 7);
+        Util::putKey(&buffer, 4, Util::e_FIXED64);
+        Util::putFixed64(&buffer, 8);
+
+        ASSERT(bsl::string("\x08\x96\x01" "\x12\x07" "testing"
+                           "\x1d\x07\x00\x00\x00"
+                           "\x21\x08\x00\x00\x00\x00\x00\x00\x00", 26) ==
+                                                                      buffer);
+
+        const char *cursor = buffer.data();
+        const char *end    = buffer.data() + buffer.size();
+
+        for (int i = 1; i <= 4; ++i) {
+            int            number;
+            Util::WireType type;
+
+            ASSERTV(i, 0 == Util::getKey(&number, &type, &cursor, end));
+            ASSERTV(i, i == number);
+            ASSERTV(i, 0 == Util::skipField(type, &cursor, end));
+
+            if (veryVerbose) { T_ P_(number) P(type) }
+        }
+        ASSERT(end == cursor);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
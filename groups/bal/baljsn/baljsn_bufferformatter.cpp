@@ -0,0 +1,291 @@
+// baljsn_bufferformatter.cpp                                         -*-C++-*-
+#include <baljsn_bufferformatter.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(baljsn_bufferformatter_cpp,"$Id$ $CSID$")
+
+#include <bdlde_utf8util.h>
+
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
+namespace BloombergLP {
+namespace {
+
+const char s_escapeTable[256] = {
+    // For each byte value, the character following the backslash in its JSON
+    // escape sequence ('u' for the '\u00XX' form), or 0 if the character is
+    // written unescaped.  Note that bytes having the high bit set are written
+    // unescaped, as part of a (validated) UTF-8 sequence.
+
+    'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u',    // 00-07
+    'b', 't', 'n', 'u', 'f', 'r', 'u', 'u',    // 08-0F
+    'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u',    // 10-17
+    'u', 'u', 'u', 'u', 'u', 'u', 'u', 'u',    // 18-1F
+    0,   0,   '"', 0,   0,   0,   0,   0,      // 20-27
+    0,   0,   0,   0,   0,   0,   0,   '/',    // 28-2F
+    0,   0,   0,   0,   0,   0,   0,   0,      // 30-37
+    0,   0,   0,   0,   0,   0,   0,   0,      // 38-3F
+    0,   0,   0,   0,   0,   0,   0,   0,      // 40-47
+    0,   0,   0,   0,   0,   0,   0,   0,      // 48-4F
+    0,   0,   0,   0,   0,   0,   0,   0,      // 50-57
+    0,   0,   0,   0,   '\\', 0,  0,   0,      // 58-5F
+};
+
+inline
+bool isSpecial(unsigned char value, bool stopAtNonAscii)
+    // Return 'true' if the specified 'value' must be escaped in a JSON string,
+    // or if 'value' has its high bit set and the specified 'stopAtNonAscii' is
+    // 'true', and 'false' otherwise.
+{
+    return 0 != s_escapeTable[value] || (stopAtNonAscii && 0x80 <= value);
+}
+
+const char *findSpecial(const char *begin,
+                        const char *end,
+                        bool        stopAtNonAscii)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' that must be escaped in a JSON string, or that has its
+    // high bit set if the specified 'stopAtNonAscii' is 'true', and 'end' if
+    // there is no such character.
+{
+    const char *iter = begin;
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    const __m128i maxControl = _mm_set1_epi8(0x1F);
+    const __m128i quote      = _mm_set1_epi8('"');
+    const __m128i backslash  = _mm_set1_epi8('\\');
+    const __m128i slash      = _mm_set1_epi8('/');
+
+    while (end - iter >= 16) {
+        const __m128i chunk = _mm_loadu_si128(
+                                       reinterpret_cast<const __m128i *>(iter));
+
+        // A byte is a control character if its unsigned maximum with 0x1F is
+        // 0x1F.
+
+        __m128i special = _mm_cmpeq_epi8(_mm_max_epu8(chunk, maxControl),
+                                         maxControl);
+        special = _mm_or_si128(special, _mm_cmpeq_epi8(chunk, quote));
+        special = _mm_or_si128(special, _mm_cmpeq_epi8(chunk, backslash));
+        special = _mm_or_si128(special, _mm_cmpeq_epi8(chunk, slash));
+
+        int mask = _mm_movemask_epi8(special);
+        if (stopAtNonAscii) {
+            mask |= _mm_movemask_epi8(chunk);
+        }
+
+        if (0 != mask) {
+            int index = 0;
+            while (0 == (mask & (1 << index))) {
+                ++index;
+            }
+            return iter + index;                                      // RETURN
+        }
+        iter += 16;
+    }
+#endif
+
+    for (; iter < end; ++iter) {
+        if (isSpecial(static_cast<unsigned char>(*iter), stopAtNonAscii)) {
+            break;
+        }
+    }
+    return iter;
+}
+
+}  // close unnamed namespace
+
+namespace baljsn {
+
+                      // --------------------------------
+                      // struct BufferFormatter_PrintUtil
+                      // --------------------------------
+
+// CLASS METHODS
+int BufferFormatter_PrintUtil::printString(bsl::string             *buffer,
+                                           const bsl::string_view&  value)
+{
+    static const char k_HEX_DIGITS[] = "0123456789abcdef";
+
+    const bsl::size_t  originalLength = buffer->length();
+    const char        *current        = value.data();
+    const char        *iter           = value.data();
+    const char        *end            = value.data() + value.length();
+    bool               validated      = false;
+
+    buffer->push_back('"');
+
+    while (iter < end) {
+        iter = findSpecial(iter, end, !validated);
+        if (iter == end) {
+            break;
+        }
+
+        const unsigned char ch = static_cast<unsigned char>(*iter);
+
+        if (0x80 <= ch) {
+            // Everything before 'iter' is ASCII, so the whole string is valid
+            // UTF-8 if and only if the remainder is.
+
+            if (!bdlde::Utf8Util::isValid(iter,
+                                          static_cast<int>(end - iter))) {
+                buffer->resize(originalLength);
+                return -1;                                            // RETURN
+            }
+            validated = true;
+            ++iter;
+            continue;
+        }
+
+        buffer->append(current, iter - current);
+
+        const char escape = s_escapeTable[ch];
+        if ('u' == escape) {
+            const char sequence[] = { '\\', 'u', '0', '0',
+                                      k_HEX_DIGITS[(ch & 0xF0) >> 4],
+                                      k_HEX_DIGITS[ ch & 0x0F] };
+            buffer->append(sequence, sizeof sequence);
+        }
+        else {
+            const char sequence[] = { '\\', escape };
+            buffer->append(sequence, sizeof sequence);
+        }
+        current = ++iter;
+    }
+
+    buffer->append(current, end - current);
+    buffer->push_back('"');
+
+    return 0;
+}
+
+                          // ---------------------
+                          // class BufferFormatter
+                          // ---------------------
+
+// CREATORS
+BufferFormatter::BufferFormatter(bsl::string      *buffer,
+                                 bool              usePrettyStyle,
+                                 int               initialIndentLevel,
+                                 int               spacesPerLevel,
+                                 bslma::Allocator *basicAllocator)
+: d_buffer_p(buffer)
+, d_usePrettyStyle(usePrettyStyle)
+, d_indentLevel(initialIndentLevel)
+, d_spacesPerLevel(spacesPerLevel)
+, d_callSequence(basicAllocator)
+{
+    BSLS_ASSERT(buffer);
+
+    // Add a dummy value so we don't have to check whether 'd_callSequence' is
+    // empty in 'openObject' when we access its last element.
+
+    d_callSequence.push_back(false);
+}
+
+// MANIPULATORS
+void BufferFormatter::openObject()
+{
+    if (d_usePrettyStyle && isArrayElement()) {
+        indent();
+    }
+
+    d_buffer_p->push_back('{');
+
+    if (d_usePrettyStyle) {
+        d_buffer_p->push_back('\n');
+        ++d_indentLevel;
+        d_callSequence.push_back(false);
+    }
+}
+
+void BufferFormatter::closeObject()
+{
+    if (d_usePrettyStyle) {
+        --d_indentLevel;
+        d_buffer_p->push_back('\n');
+        indent();
+
+        BSLS_ASSERT(false == isArrayElement());
+        d_callSequence.pop_back();
+    }
+
+    d_buffer_p->push_back('}');
+}
+
+void BufferFormatter::openArray(bool formatAsEmptyArrayFlag)
+{
+    if (d_usePrettyStyle &&
+        (1 == d_callSequence.size() || isArrayElement())) {
+        indent();
+    }
+
+    d_buffer_p->push_back('[');
+
+    if (d_usePrettyStyle && !formatAsEmptyArrayFlag) {
+        d_buffer_p->push_back('\n');
+        ++d_indentLevel;
+        d_callSequence.push_back(true);
+    }
+}
+
+void BufferFormatter::closeArray(bool formatAsEmptyArrayFlag)
+{
+    if (d_usePrettyStyle && !formatAsEmptyArrayFlag) {
+        --d_indentLevel;
+        d_buffer_p->push_back('\n');
+        indent();
+
+        BSLS_ASSERT(true == isArrayElement());
+        d_callSequence.pop_back();
+    }
+
+    d_buffer_p->push_back(']');
+}
+
+int BufferFormatter::openMember(const bsl::string_view& name)
+{
+    const bsl::size_t originalLength = d_buffer_p->length();
+
+    if (d_usePrettyStyle) {
+        indent();
+    }
+
+    const int rc = BufferFormatter_PrintUtil::printString(d_buffer_p, name);
+    if (rc) {
+        d_buffer_p->resize(originalLength);
+        return rc;                                                    // RETURN
+    }
+
+    if (d_usePrettyStyle) {
+        d_buffer_p->append(" : ", 3);
+    }
+    else {
+        d_buffer_p->push_back(':');
+    }
+
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,831 @@
+// baljsn_bufferformatter.h                                           -*-C++-*-
+#ifndef INCLUDED_BALJSN_BUFFERFORMATTER
+#define INCLUDED_BALJSN_BUFFERFORMATTER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a JSON formatter that appends to a flat character buffer.
+//
+//@CLASSES:
+// baljsn::BufferFormatter: JSON formatter writing to a 'bsl::string'
+//
+//@SEE_ALSO: baljsn_formatter, baljsn_printutil, baljsn_encoder
+//
+//@DESCRIPTION: This component provides a class, 'baljsn::BufferFormatter',
+// for formatting JSON objects, arrays, and name-value pairs in the JSON
+// encoding format by appending them to a 'bsl::string' supplied at
+// construction.  'baljsn::BufferFormatter' has the same interface, and
+// produces exactly the same text for every sequence of operations and every
+// set of 'baljsn::EncoderOptions', as 'baljsn::Formatter', which writes to a
+// 'bsl::ostream'.  It is the formatter used by 'baljsn::Encoder' when encoding
+// to a 'bsl::string' or to a 'bdlbb::Blob'.
+//
+// Writing to a 'bsl::ostream' costs a sentry construction, and often a locale
+// lookup, for every token written; for the short tokens that make up most of a
+// JSON document that overhead dominates the cost of encoding.
+// 'baljsn::BufferFormatter' instead appends directly to the buffer:
+//
+//: o Integral and floating-point values are converted using
+//:   'bslalg::NumericFormatterUtil' into a local buffer.
+//:
+//: o Date and time values are generated using 'bdlt::Iso8601Util' and
+//:   appended without being re-scanned for characters that need escaping.
+//:
+//: o Strings, including member names, are scanned for the characters that
+//:   need escaping 16 bytes at a time using SSE2 instructions where they are
+//:   available; runs of characters that need no escaping are appended with a
+//:   single copy.  A string consisting entirely of ASCII characters is never
+//:   passed to the (comparatively slow) UTF-8 validation.
+//:
+//: o The stack of open objects and arrays is kept in a 'bdlc::SmallVector'
+//:   having enough inline capacity for typical documents, so that formatting
+//:   does not allocate memory other than to grow the output buffer.
+//
+// Values of type 'bdldfp::Decimal64' and 'bdlt::DatetimeInterval', which have
+// no buffer-based formatting facility, are formatted by
+// 'baljsn::PrintUtil' to a stream writing to a fixed-size local buffer.
+//
+// If an operation returning a status fails (e.g., due to a string that is not
+// valid UTF-8), nothing is appended to the buffer by that operation.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting a Small JSON Document to a String
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to produce a small JSON document describing a stock in
+// a 'bsl::string' without going through a stream.
+//
+// First, we create the buffer and a 'baljsn::BufferFormatter' writing to it
+// in the pretty style, with an initial indentation level of 0 and 2 spaces per
+// level:
+//..
+//  bsl::string             buffer;
+//  baljsn::BufferFormatter formatter(&buffer, true, 0, 2);
+//..
+// Then, we format the object exactly as we would with a 'baljsn::Formatter':
+//..
+//  formatter.openObject();
+//
+//  formatter.openMember("Name");
+//  formatter.putValue("Apple Inc");
+//  formatter.closeMember();
+//
+//  formatter.openMember("Last Price");
+//  formatter.putValue(205.8);
+//
+//  formatter.closeObject();
+//..
+// Finally, we verify the text that was appended to the buffer:
+//..
+//  const char *EXPECTED = "{\n"
+//                         "  \"Name\" : \"Apple Inc\",\n"
+//                         "  \"Last Price\" : 205.8\n"
+//                         "}";
+//
+//  assert(EXPECTED == buffer);
+//..
+
+#include <balscm_version.h>
+
+#include <baljsn_encoderoptions.h>
+#include <baljsn_printutil.h>
+
+#include <bdlb_float.h>
+
+#include <bdlc_smallvector.h>
+
+#include <bdldfp_decimal.h>
+
+#include <bdlsb_fixedmemoutstreambuf.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimeinterval.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_datetz.h>
+#include <bdlt_iso8601util.h>
+#include <bdlt_iso8601utilconfiguration.h>
+#include <bdlt_time.h>
+#include <bdlt_timetz.h>
+
+#include <bslalg_numericformatterutil.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmf_issame.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+
+namespace BloombergLP {
+namespace baljsn {
+
+                      // ================================
+                      // struct BufferFormatter_PrintUtil
+                      // ================================
+
+struct BufferFormatter_PrintUtil {
+    // This component-private 'struct' provides functions that append the JSON
+    // representation of values to a 'bsl::string'.  Each function produces
+    // exactly the text that the corresponding 'baljsn::PrintUtil' function
+    // writes to a stream, and appends nothing if it returns a non-zero value.
+
+  private:
+    // PRIVATE CLASS METHODS
+    template <class TYPE>
+    static int printDateAndTime(bsl::string          *buffer,
+                                const TYPE&           value,
+                                const EncoderOptions *options);
+        // Append the ISO 8601 representation of the specified 'value' in
+        // quotes to the specified 'buffer' using the specified 'options'.
+        // Return 0.
+
+    template <class TYPE>
+    static int printFloatingPoint(bsl::string          *buffer,
+                                  TYPE                  value,
+                                  const EncoderOptions *options);
+        // Append the JSON representation of the specified floating point
+        // 'value' to the specified 'buffer' using the specified 'options'.
+        // Return 0 on success, and a non-zero value if 'value' is not finite
+        // and 'options' does not allow encoding infinities and NaNs as
+        // strings.
+
+    template <class TYPE>
+    static int printInteger(bsl::string *buffer, TYPE value);
+        // Append the decimal representation of the specified integral 'value'
+        // to the specified 'buffer'.  Return 0.
+
+    template <class TYPE>
+    static int printUsingStream(bsl::string          *buffer,
+                                const TYPE&           value,
+                                const EncoderOptions *options);
+        // Append the text written by 'baljsn::PrintUtil::printValue' for the
+        // specified 'value' and 'options' to the specified 'buffer'.  Return
+        // 0 on success, and a non-zero value otherwise.
+
+  public:
+    // CLASS METHODS
+    static int printString(bsl::string             *buffer,
+                           const bsl::string_view&  value);
+        // Append the specified string 'value', quoted and escaped as JSON, to
+        // the specified 'buffer'.  Return 0 on success, and a non-zero value,
+        // with no effect on 'buffer', if 'value' is not valid UTF-8.
+
+    static int printValue(bsl::string          *buffer,
+                          bool                  value,
+                          const EncoderOptions *options = 0);
+    static int printValue(bsl::string          *buffer,
+                          char                  value,
+                          const EncoderOptions *options = 0);
+    static int printValue(bsl::string          *buffer,
+                          signed char           value,
+                          const EncoderOptions *options = 0);
+    static int printValue(bsl::string          *buffer,
+                          unsigned char         value,
+                          const EncoderOptions *options = 0);
+    static int printValue(bsl::string          *buffer,
+                          short                 value,
+                          const EncoderOptions *options = 0);
+    static int printValue(bsl::string          *buffer,
+                          unsigned short        value,
+                          const EncoderOptions *options = 0);
+    static int printValue(bsl::string          *buffer,
+                          int                   value,
+                          const EncoderOptions *options = 0);
+    static int printValue(bsl::string          *buffer,
+                          unsigned int          value,
+                          const EncoderOptions *options = 0);
+    static int printValue(bsl::string          *buffer,
+                          bsls::Types::Int64    value,
+                          const EncoderOptions *options = 0);
+    static int printValue(bsl::string          *buffer,
+                          bsls::Types::Uint64   value,
+                          const EncoderOptions *options = 0);
+    static int printValue(bsl::string          *buffer,
+                          float                 value,
+                          const EncoderOptions *options = 0);
+    static int printValue(bsl::string          *buffer,
+                          double                value,
+                          const EncoderOptions *options = 0);
+    static int printValue(bsl::string          *buffer,
+                          bdldfp::Decimal64     value,
+                          const EncoderOptions *options = 0);
+    static int printValue(bsl::string          *buffer,
+                          const char           *value,
+                          const EncoderOptions *options = 0);
+    static int printValue(bsl::string             *buffer,
+                          const bsl::string_view&  value,
+                          const EncoderOptions    *options = 0);
+    static int printValue(bsl::string          *buffer,
+                          const bdlt::Time&     value,
+                          const EncoderOptions *options = 0);
+    static int printValue(bsl::string          *buffer,
+                          const bdlt::Date&     value,
+                          const EncoderOptions *options = 0);
+    static int printValue(bsl::string           *buffer,
+                          const bdlt::Datetime&  value,
+                          const EncoderOptions  *options = 0);
+    static int printValue(bsl::string                   *buffer,
+                          const bdlt::DatetimeInterval&  value,
+                          const EncoderOptions          *options = 0);
+    static int printValue(bsl::string          *buffer,
+                          const bdlt::TimeTz&   value,
+                          const EncoderOptions *options = 0);
+    static int printValue(bsl::string          *buffer,
+                          const bdlt::DateTz&   value,
+                          const EncoderOptions *options = 0);
+    static int printValue(bsl::string             *buffer,
+                          const bdlt::DatetimeTz&  value,
+                          const EncoderOptions    *options = 0);
+        // Append the JSON representation of the specified 'value' to the
+        // specified 'buffer' using the optionally specified 'options'.  Return
+        // 0 on success and a non-zero value, with no effect on 'buffer',
+        // otherwise.
+};
+
+                          // =====================
+                          // class BufferFormatter
+                          // =====================
+
+class BufferFormatter {
+    // This class implements a formatter providing operations for rendering
+    // JSON text elements to a 'bsl::string' (supplied at construction)
+    // according to a set of formatting options (also supplied at
+    // construction).  The text produced is identical to that produced by
+    // 'baljsn::Formatter' for the same sequence of operations.
+
+    // PRIVATE TYPES
+    enum { k_INLINE_NESTING_DEPTH = 32 };  // nesting depth tracked without
+                                           // allocating memory
+
+    typedef bdlc::SmallVector<bool, k_INLINE_NESTING_DEPTH> CallSequence;
+
+    // DATA
+    bsl::string  *d_buffer_p;        // buffer for output (held, not owned)
+
+    bool          d_usePrettyStyle;  // encoding style
+
+    int           d_indentLevel;     // current indentation level
+
+    int           d_spacesPerLevel;  // spaces per indentation level
+
+    CallSequence  d_callSequence;    // sequence in which the 'openObject'
+                                     // and 'openArray' methods were called;
+                                     // an 'openObject' call is represented
+                                     // by 'false' and an 'openArray' call by
+                                     // 'true'
+
+  private:
+    // NOT IMPLEMENTED
+    BufferFormatter(const BufferFormatter&);
+    BufferFormatter& operator=(const BufferFormatter&);
+
+    // PRIVATE MANIPULATORS
+    void indent();
+        // Unconditionally append to the buffer supplied at construction the
+        // sequence of whitespace characters for the proper indentation of an
+        // element at the current indentation level.  Note that this method
+        // does not check that 'd_usePrettyStyle' is 'true' before indenting.
+
+    // PRIVATE ACCESSORS
+    bool isArrayElement() const;
+        // Return 'true' if the value being encoded is an element of an array,
+        // and 'false' otherwise.  A value is identified as an element of an
+        // array if 'openArray' was called on this object and was not
+        // subsequently followed by either an 'openObject' or 'closeArray'
+        // call.
+
+  public:
+    // CREATORS
+    explicit
+    BufferFormatter(bsl::string      *buffer,
+                    bool              usePrettyStyle     = false,
+                    int               initialIndentLevel = 0,
+                    int               spacesPerLevel     = 0,
+                    bslma::Allocator *basicAllocator     = 0);
+        // Create a 'BufferFormatter' object that appends to the specified
+        // 'buffer'.  Optionally specify 'usePrettyStyle' to inform the
+        // formatter whether the pretty encoding style should be used when
+        // writing data.  If 'usePrettyStyle' is not specified then the data is
+        // written in a compact style.  If 'usePrettyStyle' is specified,
+        // additionally specify 'initialIndentLevel' and 'spacesPerLevel' to
+        // provide the initial indentation level and spaces per level at which
+        // the data should be formatted.  If 'initialIndentLevel' or
+        // 'spacesPerLevel' is not specified then an initial value of '0' is
+        // used for both parameters.  If 'usePrettyStyle' is 'false' then
+        // 'initialIndentLevel' and 'spacesPerLevel' are both ignored.
+        // Optionally specify a 'basicAllocator' used to supply memory if the
+        // nesting depth exceeds 'k_INLINE_NESTING_DEPTH'.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'buffer' remains valid for
+        // the lifetime of this object.
+
+    //! ~BufferFormatter() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void openObject();
+        // Append to the buffer supplied at construction the sequence of
+        // characters designating the start of an object (referred to as an
+        // "object" in JSON).
+
+    void closeObject();
+        // Append to the buffer supplied at construction the sequence of
+        // characters designating the end of an object (referred to as an
+        // "object" in JSON).  The behavior is undefined unless this
+        // 'BufferFormatter' is currently formatting an object.
+
+    void openArray(bool formatAsEmptyArray = false);
+        // Append to the buffer supplied at construction the sequence of
+        // characters designating the start of an array (referred to as an
+        // "array" in JSON).  Optionally specify 'formatAsEmptyArray' denoting
+        // if the array being opened should be formatted as an empty array.  If
+        // 'formatAsEmptyArray' is not specified then the array being opened is
+        // formatted as an array having elements.  Note that the formatting
+        // (and as a consequence the 'formatAsEmptyArray') is relevant only if
+        // this formatter encodes in the pretty style and is ignored otherwise.
+
+    void closeArray(bool formatAsEmptyArray = false);
+        // Append to the buffer supplied at construction the sequence of
+        // characters designating the end of an array (referred to as an
+        // "array" in JSON).  Optionally specify 'formatAsEmptyArray' denoting
+        // if the array being closed should be formatted as an empty array.  If
+        // 'formatAsEmptyArray' is not specified then the array being closed is
+        // formatted as an array having elements.  The behavior is undefined
+        // unless this 'BufferFormatter' is currently formatting an array.
+        // Note that the formatting (and as a consequence the
+        // 'formatAsEmptyArray') is relevant only if this formatter encodes in
+        // the pretty style and is ignored otherwise.
+
+    int openMember(const bsl::string_view& name);
+        // Append to the buffer supplied at construction the sequence of
+        // characters designating the start of a member (referred to as a
+        // "name/value pair" in JSON) having the specified 'name'.  Return 0 on
+        // success and a non-zero value otherwise.
+
+    void putNullValue();
+        // Append to the buffer supplied at construction the value
+        // corresponding to a null element.
+
+    template <class TYPE>
+    int putValue(const TYPE& value, const EncoderOptions *options = 0);
+        // Append to the buffer supplied at construction the specified
+        // 'value'.  Optionally specify 'options' according which 'value'
+        // should be encoded.  Return 0 on success and a non-zero value
+        // otherwise.
+
+    void closeMember();
+        // Append to the buffer supplied at construction the sequence of
+        // characters designating the end of an member (referred to as a
+        // "name/value pair" in JSON).  The behavior is undefined unless this
+        // 'BufferFormatter' is currently formatting a member.
+
+    void addArrayElementSeparator();
+        // Append to the buffer supplied at construction the sequence of
+        // characters designating an array element separator (i.e., ',').  The
+        // behavior is undefined unless this 'BufferFormatter' is currently
+        // formatting a member.
+
+    // ACCESSORS
+    int nestingDepth() const;
+        // Return the number of currently open nested objects or arrays.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                      // --------------------------------
+                      // struct BufferFormatter_PrintUtil
+                      // --------------------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+inline
+int BufferFormatter_PrintUtil::printDateAndTime(
+                                          bsl::string          *buffer,
+                                          const TYPE&           value,
+                                          const EncoderOptions *options)
+{
+    char                           text[bdlt::Iso8601Util::k_MAX_STRLEN + 1];
+    bdlt::Iso8601UtilConfiguration config;
+
+    if (options) {
+        config.setFractionalSecondPrecision(
+                                 options->datetimeFractionalSecondPrecision());
+    }
+    else {
+        config.setFractionalSecondPrecision(3);
+    }
+
+    const int length = bdlt::Iso8601Util::generate(text,
+                                                   sizeof text,
+                                                   value,
+                                                   config);
+
+    // The ISO 8601 representation contains no characters that need escaping.
+
+    buffer->push_back('"');
+    buffer->append(text, length);
+    buffer->push_back('"');
+    return 0;
+}
+
+template <class TYPE>
+int BufferFormatter_PrintUtil::printFloatingPoint(
+                                          bsl::string          *buffer,
+                                          TYPE                  value,
+                                          const EncoderOptions *options)
+{
+    switch (bdlb::Float::classifyFine(value)) {
+      case bdlb::Float::k_POSITIVE_INFINITY: {
+        if (!options || !options->encodeInfAndNaNAsStrings()) {
+            return -1;                                                // RETURN
+        }
+        buffer->append("\"+inf\"", 6);
+      } break;
+      case bdlb::Float::k_NEGATIVE_INFINITY: {
+        if (!options || !options->encodeInfAndNaNAsStrings()) {
+            return -1;                                                // RETURN
+        }
+        buffer->append("\"-inf\"", 6);
+      } break;
+      case bdlb::Float::k_QNAN:                                 // FALL-THROUGH
+      case bdlb::Float::k_SNAN: {
+        if (!options || !options->encodeInfAndNaNAsStrings()) {
+            return -1;                                                // RETURN
+        }
+        buffer->append("\"nan\"", 5);
+      } break;
+      default: {
+        int precision = 0;
+        if (options) {
+            precision = bsl::is_same<TYPE, float>::value
+                      ? options->maxFloatPrecision()
+                      : options->maxDoublePrecision();
+        }
+
+        if (0 == precision) {
+            typedef bslalg::NumericFormatterUtil NumFmt;
+            char text[NumFmt::ToCharsMaxLength<TYPE>::k_VALUE];
+
+            const char * const endPtr = NumFmt::toChars(text,
+                                                        text + sizeof text,
+                                                        value);
+            BSLS_ASSERT(0 != endPtr);
+
+            buffer->append(text, endPtr - text);
+        }
+        else {
+            const int k_SIZE = 32;
+            char      text[k_SIZE];
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#define snprintf _snprintf
+#endif
+            const int length = snprintf(text,
+                                        k_SIZE,
+                                        "%-1.*g",
+                                        precision,
+                                        value);
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+#undef snprintf
+#endif
+            buffer->append(text, length);
+        }
+      }
+    }
+    return 0;
+}
+
+template <class TYPE>
+inline
+int BufferFormatter_PrintUtil::printInteger(bsl::string *buffer, TYPE value)
+{
+    typedef bslalg::NumericFormatterUtil NumFmt;
+    char text[NumFmt::ToCharsMaxLength<TYPE>::k_VALUE];
+
+    const char * const endPtr = NumFmt::toChars(text,
+                                                text + sizeof text,
+                                                value);
+    BSLS_ASSERT(0 != endPtr);
+
+    buffer->append(text, endPtr - text);
+    return 0;
+}
+
+template <class TYPE>
+int BufferFormatter_PrintUtil::printUsingStream(
+                                          bsl::string          *buffer,
+                                          const TYPE&           value,
+                                          const EncoderOptions *options)
+{
+    char                        text[64];
+    bdlsb::FixedMemOutStreamBuf streamBuf(text, sizeof text);
+    bsl::ostream                stream(&streamBuf);
+
+    const int rc = PrintUtil::printValue(stream, value, options);
+    if (0 != rc || !stream) {
+        return -1;                                                    // RETURN
+    }
+
+    buffer->append(text, static_cast<bsl::size_t>(streamBuf.length()));
+    return 0;
+}
+
+// CLASS METHODS
+inline
+int BufferFormatter_PrintUtil::printValue(bsl::string          *buffer,
+                                          bool                  value,
+                                          const EncoderOptions *)
+{
+    if (value) {
+        buffer->append("true", 4);
+    }
+    else {
+        buffer->append("false", 5);
+    }
+    return 0;
+}
+
+inline
+int BufferFormatter_PrintUtil::printValue(bsl::string          *buffer,
+                                          char                  value,
+                                          const EncoderOptions *)
+{
+    signed char tmp(value);  // Note that 'char' is unsigned on IBM.
+
+    return printInteger(buffer, static_cast<int>(tmp));
+}
+
+inline
+int BufferFormatter_PrintUtil::printValue(bsl::string          *buffer,
+                                          signed char           value,
+                                          const EncoderOptions *)
+{
+    return printInteger(buffer, static_cast<int>(value));
+}
+
+inline
+int BufferFormatter_PrintUtil::printValue(bsl::string          *buffer,
+                                          unsigned char         value,
+                                          const EncoderOptions *)
+{
+    return printInteger(buffer, static_cast<int>(value));
+}
+
+inline
+int BufferFormatter_PrintUtil::printValue(bsl::string          *buffer,
+                                          short                 value,
+                                          const EncoderOptions *)
+{
+    return printInteger(buffer, value);
+}
+
+inline
+int BufferFormatter_PrintUtil::printValue(bsl::string          *buffer,
+                                          unsigned short        value,
+                                          const EncoderOptions *)
+{
+    return printInteger(buffer, value);
+}
+
+inline
+int BufferFormatter_PrintUtil::printValue(bsl::string          *buffer,
+                                          int                   value,
+                                          const EncoderOptions *)
+{
+    return printInteger(buffer, value);
+}
+
+inline
+int BufferFormatter_PrintUtil::printValue(bsl::string          *buffer,
+                                          unsigned int          value,
+                                          const EncoderOptions *)
+{
+    return printInteger(buffer, value);
+}
+
+inline
+int BufferFormatter_PrintUtil::printValue(bsl::string          *buffer,
+                                          bsls::Types::Int64    value,
+                                          const EncoderOptions *)
+{
+    return printInteger(buffer, value);
+}
+
+inline
+int BufferFormatter_PrintUtil::printValue(bsl::string          *buffer,
+                                          bsls::Types::Uint64   value,
+                                          const EncoderOptions *)
+{
+    return printInteger(buffer, value);
+}
+
+inline
+int BufferFormatter_PrintUtil::printValue(bsl::string          *buffer,
+                                          float                 value,
+                                          const EncoderOptions *options)
+{
+    return printFloatingPoint(buffer, value, options);
+}
+
+inline
+int BufferFormatter_PrintUtil::printValue(bsl::string          *buffer,
+                                          double                value,
+                                          const EncoderOptions *options)
+{
+    return printFloatingPoint(buffer, value, options);
+}
+
+inline
+int BufferFormatter_PrintUtil::printValue(bsl::string          *buffer,
+                                          bdldfp::Decimal64     value,
+                                          const EncoderOptions *options)
+{
+    return printUsingStream(buffer, value, options);
+}
+
+inline
+int BufferFormatter_PrintUtil::printValue(bsl::string          *buffer,
+                                          const char           *value,
+                                          const EncoderOptions *)
+{
+    return printString(buffer, value);
+}
+
+inline
+int BufferFormatter_PrintUtil::printValue(bsl::string             *buffer,
+                                          const bsl::string_view&  value,
+                                          const EncoderOptions    *)
+{
+    return printString(buffer, value);
+}
+
+inline
+int BufferFormatter_PrintUtil::printValue(bsl::string          *buffer,
+                                          const bdlt::Time&     value,
+                                          const EncoderOptions *options)
+{
+    return printDateAndTime(buffer, value, options);
+}
+
+inline
+int BufferFormatter_PrintUtil::printValue(bsl::string          *buffer,
+                                          const bdlt::Date&     value,
+                                          const EncoderOptions *options)
+{
+    return printDateAndTime(buffer, value, options);
+}
+
+inline
+int BufferFormatter_PrintUtil::printValue(bsl::string           *buffer,
+                                          const bdlt::Datetime&  value,
+                                          const EncoderOptions  *options)
+{
+    return printDateAndTime(buffer, value, options);
+}
+
+inline
+int BufferFormatter_PrintUtil::printValue(
+                                        bsl::string                   *buffer,
+                                        const bdlt::DatetimeInterval&  value,
+                                        const EncoderOptions          *options)
+{
+    return printUsingStream(buffer, value, options);
+}
+
+inline
+int BufferFormatter_PrintUtil::printValue(bsl::string          *buffer,
+                                          const bdlt::TimeTz&   value,
+                                          const EncoderOptions *options)
+{
+    return printDateAndTime(buffer, value, options);
+}
+
+inline
+int BufferFormatter_PrintUtil::printValue(bsl::string          *buffer,
+                                          const bdlt::DateTz&   value,
+                                          const EncoderOptions *options)
+{
+    return printDateAndTime(buffer, value, options);
+}
+
+inline
+int BufferFormatter_PrintUtil::printValue(bsl::string             *buffer,
+                                          const bdlt::DatetimeTz&  value,
+                                          const EncoderOptions    *options)
+{
+    return printDateAndTime(buffer, value, options);
+}
+
+                          // ---------------------
+                          // class BufferFormatter
+                          // ---------------------
+
+// PRIVATE MANIPULATORS
+inline
+void BufferFormatter::indent()
+{
+    const int spacesPerLevel = d_spacesPerLevel < 0 ? -d_spacesPerLevel
+                                                    : d_spacesPerLevel;
+    const int numSpaces      = d_indentLevel * spacesPerLevel;
+
+    if (0 < numSpaces) {
+        d_buffer_p->append(static_cast<bsl::size_t>(numSpaces), ' ');
+    }
+}
+
+// PRIVATE ACCESSORS
+inline
+bool BufferFormatter::isArrayElement() const
+{
+    BSLS_ASSERT(d_callSequence.size() >= 1);
+
+    return d_callSequence.back();
+}
+
+// MANIPULATORS
+inline
+void BufferFormatter::closeMember()
+{
+    d_buffer_p->push_back(',');
+    if (d_usePrettyStyle) {
+        d_buffer_p->push_back('\n');
+    }
+}
+
+inline
+void BufferFormatter::addArrayElementSeparator()
+{
+    d_buffer_p->push_back(',');
+    if (d_usePrettyStyle) {
+        d_buffer_p->push_back('\n');
+    }
+}
+
+inline
+void BufferFormatter::putNullValue()
+{
+    if (d_usePrettyStyle && isArrayElement()) {
+        indent();
+    }
+    d_buffer_p->append("null", 4);
+}
+
+template <class TYPE>
+inline
+int BufferFormatter::putValue(const TYPE& value, const EncoderOptions *options)
+{
+    const bsl::size_t originalLength = d_buffer_p->length();
+
+    if (d_usePrettyStyle && isArrayElement()) {
+        indent();
+    }
+
+    const int rc = BufferFormatter_PrintUtil::printValue(d_buffer_p,
+                                                         value,
+                                                         options);
+    if (rc) {
+        d_buffer_p->resize(originalLength);
+    }
+    return rc;
+}
+
+// ACCESSORS
+inline
+int BufferFormatter::nestingDepth() const
+{
+    // The call sequence contains a "dummy" initial element, so subtract one
+    // from the length.
+    return static_cast<int>(d_callSequence.size()) - 1;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
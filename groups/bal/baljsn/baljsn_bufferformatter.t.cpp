@@ -0,0 +1,1016 @@
+// baljsn_bufferformatter.t.cpp                                       -*-C++-*-
+#include <baljsn_bufferformatter.h>
+
+#include <baljsn_encoderoptions.h>
+#include <baljsn_formatter.h>
+#include <baljsn_printutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bdldfp_decimal.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimeinterval.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_datetz.h>
+#include <bdlt_time.h>
+#include <bdlt_timetz.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a JSON formatter, 'baljsn::BufferFormatter',
+// that appends to a 'bsl::string', and must produce exactly the same text as
+// 'baljsn::Formatter' does on a stream.  Our testing strategy is therefore to
+// apply the same input to both formatters (and to both print utilities) and
+// compare the output, over inputs chosen to exercise every formatting rule,
+// every encoder option, and both the vectorized and the scalar paths of the
+// string escaping.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int BufferFormatter_PrintUtil::printString(bsl::string *, value);
+// [ 3] int BufferFormatter_PrintUtil::printValue(bsl::string *, value, opt);
+//
+// CREATORS
+// [ 4] BufferFormatter(bsl::string *, bool, int, int, bslma::Allocator *);
+// [ 4] ~BufferFormatter();
+//
+// MANIPULATORS
+// [ 4] void openObject();
+// [ 4] void closeObject();
+// [ 4] void openArray(bool formatAsEmptyArray);
+// [ 4] void closeArray(bool formatAsEmptyArray);
+// [ 4] int openMember(const bsl::string_view& name);
+// [ 4] void putNullValue();
+// [ 4] int putValue(const TYPE& value, const EncoderOptions *options);
+// [ 4] void closeMember();
+// [ 4] void addArrayElementSeparator();
+//
+// ACCESSORS
+// [ 4] int nestingDepth() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] FAILED OPERATIONS APPEND NOTHING
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef baljsn::BufferFormatter           Obj;
+typedef baljsn::BufferFormatter_PrintUtil Util;
+typedef baljsn::EncoderOptions            Options;
+typedef bsls::Types::Int64                Int64;
+typedef bsls::Types::Uint64               Uint64;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                          HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+template <class TYPE>
+void assertSameValue(int line, const TYPE& value, const Options *options)
+    // Assert that 'BufferFormatter_PrintUtil::printValue' returns the same
+    // status for the specified 'value' and 'options' as
+    // 'baljsn::PrintUtil::printValue', appends the same text on success, and
+    // appends nothing on failure.  Report the specified 'line' on failure.
+{
+    bsl::ostringstream stream;
+    const int          expRc = baljsn::PrintUtil::printValue(stream,
+                                                             value,
+                                                             options);
+
+    const bsl::string PREFIX("<>");
+    bsl::string       buffer(PREFIX);
+    const int         rc = Util::printValue(&buffer, value, options);
+
+    ASSERTV(line, expRc, rc, expRc == rc);
+    if (0 == expRc) {
+        ASSERTV(line, stream.str(), buffer, PREFIX + stream.str() == buffer);
+    }
+    else {
+        ASSERTV(line, buffer, PREFIX == buffer);
+    }
+}
+
+void assertSameString(int line, const bsl::string_view& value)
+    // Assert that 'BufferFormatter_PrintUtil::printString' returns the same
+    // status for the specified 'value' as 'baljsn::PrintUtil::printValue',
+    // appends the same text on success, and appends nothing on failure.
+    // Report the specified 'line' on failure.
+{
+    bsl::ostringstream stream;
+    const int          expRc = baljsn::PrintUtil::printValue(stream, value);
+
+    const bsl::string PREFIX("<>");
+    bsl::string       buffer(PREFIX);
+    const int         rc = Util::printString(&buffer, value);
+
+    ASSERTV(line, value, expRc, rc, expRc == rc);
+    if (0 == expRc) {
+        ASSERTV(line, stream.str(), buffer, PREFIX + stream.str() == buffer);
+    }
+    else {
+        ASSERTV(line, buffer, PREFIX == buffer);
+    }
+}
+
+template <class FORMATTER>
+int applyScript(FORMATTER          *formatter,
+                bsl::vector<int>   *depths,
+                const bsl::string&  script)
+    // Apply to the specified 'formatter' the sequence of operations encoded
+    // by the specified 'script', and append to the specified 'depths' the
+    // nesting depth of 'formatter' after each operation.  Return the sum of
+    // the status values returned by the operations.  Each character of
+    // 'script' designates one operation:
+    //..
+    //  '{'  openObject()          '}'  closeObject()
+    //  '['  openArray()           ']'  closeArray()
+    //  '('  openArray(true)       ')'  closeArray(true)
+    //  'm'  openMember("name")    'M'  openMember("a \"quoted\" /name")
+    //  ','  closeMember()         ';'  addArrayElementSeparator()
+    //  'n'  putNullValue()        'i'  putValue(-42)
+    //  's'  putValue("str\n")     'd'  putValue(0.1)
+    //  'b'  putValue(true)        't'  putValue(bdlt::Date(2026, 10, 19))
+    //..
+{
+    int sum = 0;
+    for (bsl::size_t i = 0; i < script.length(); ++i) {
+        switch (script[i]) {
+          case '{': formatter->openObject();                           break;
+          case '}': formatter->closeObject();                          break;
+          case '[': formatter->openArray();                            break;
+          case ']': formatter->closeArray();                           break;
+          case '(': formatter->openArray(true);                        break;
+          case ')': formatter->closeArray(true);                       break;
+          case 'm': sum += formatter->openMember("name");              break;
+          case 'M': sum += formatter->openMember("a \"quoted\" /name"); break;
+          case ',': formatter->closeMember();                          break;
+          case ';': formatter->addArrayElementSeparator();             break;
+          case 'n': formatter->putNullValue();                         break;
+          case 'i': sum += formatter->putValue(-42);                   break;
+          case 's': sum += formatter->putValue("str\n");               break;
+          case 'd': sum += formatter->putValue(0.1);                   break;
+          case 'b': sum += formatter->putValue(true);                  break;
+          case 't': {
+            sum += formatter->putValue(bdlt::Date(2026, 10, 19));
+          } break;
+          default: {
+            BSLS_ASSERT_INVOKE_NORETURN("unknown script character");
+          }
+        }
+        depths->push_back(formatter->nestingDepth());
+    }
+    return sum;
+}
+
+// ============================================================================
+//                          PERFORMANCE TEST HELPERS
+// ----------------------------------------------------------------------------
+
+static bsl::size_t s_antiOptimization = 0;
+
+template <class FUNCTOR>
+double medianTime(FUNCTOR functor, int numIterations)
+    // Return the median elapsed time, in seconds, of several trials each
+    // invoking the specified 'functor' the specified 'numIterations' times.
+{
+    enum { k_NUM_TRIALS = 11 };
+
+    bsl::vector<double> times;
+    for (int trial = 0; trial < k_NUM_TRIALS; ++trial) {
+        bsls::Stopwatch timer;
+        timer.start();
+        for (int i = 0; i < numIterations; ++i) {
+            s_antiOptimization += functor();
+        }
+        timer.stop();
+        times.push_back(timer.accumulatedWallTime());
+    }
+    bsl::sort(times.begin(), times.end());
+    return times[k_NUM_TRIALS / 2];
+}
+
+template <class FORMATTER>
+void formatRecords(FORMATTER *formatter, int numRecords)
+    // Format to the specified 'formatter' an array of the specified
+    // 'numRecords' objects, each having a mix of string and numeric members.
+{
+    formatter->openArray();
+    for (int i = 0; i < numRecords; ++i) {
+        if (i) {
+            formatter->addArrayElementSeparator();
+        }
+        formatter->openObject();
+        formatter->openMember("security");
+        formatter->putValue("IBM US Equity");
+        formatter->closeMember();
+        formatter->openMember("description");
+        formatter->putValue("International Business Machines Corp");
+        formatter->closeMember();
+        formatter->openMember("lastPrice");
+        formatter->putValue(149.3 + i);
+        formatter->closeMember();
+        formatter->openMember("volume");
+        formatter->putValue(1000000 + i);
+        formatter->closeMember();
+        formatter->openMember("active");
+        formatter->putValue(0 == i % 2);
+        formatter->closeObject();
+    }
+    formatter->closeArray();
+}
+
+struct StreamFormatting {
+    // This 'struct' provides a functor that formats a document using a
+    // 'baljsn::Formatter' writing to a reused stream buffer.
+
+    // DATA
+    int d_numRecords;
+
+    // ACCESSORS
+    bsl::size_t operator()() const
+        // Format the document, and return its length.
+    {
+        bsl::ostringstream stream;
+        baljsn::Formatter  formatter(stream, true, 0, 2);
+        formatRecords(&formatter, d_numRecords);
+        return stream.str().length();
+    }
+};
+
+struct BufferFormatting {
+    // This 'struct' provides a functor that formats a document using a
+    // 'baljsn::BufferFormatter' writing to a reused string.
+
+    // DATA
+    bsl::string *d_buffer_p;
+    int          d_numRecords;
+
+    // ACCESSORS
+    bsl::size_t operator()() const
+        // Format the document, and return its length.
+    {
+        d_buffer_p->clear();
+        Obj formatter(d_buffer_p, true, 0, 2);
+        formatRecords(&formatter, d_numRecords);
+        return d_buffer_p->length();
+    }
+};
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Formatting a Small JSON Document to a String
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to produce a small JSON document describing a stock in
+// a 'bsl::string' without going through a stream.
+//
+// First, we create the buffer and a 'baljsn::BufferFormatter' writing to it
+// in the pretty style, with an initial indentation level of 0 and 2 spaces per
+// level:
+//..
+    bsl::string             buffer;
+    baljsn::BufferFormatter formatter(&buffer, true, 0, 2);
+//..
+// Then, we format the object exactly as we would with a 'baljsn::Formatter':
+//..
+    formatter.openObject();
+
+    formatter.openMember("Name");
+    formatter.putValue("Apple Inc");
+    formatter.closeMember();
+
+    formatter.openMember("Last Price");
+    formatter.putValue(205.8);
+
+    formatter.closeObject();
+//..
+// Finally, we verify the text that was appended to the buffer:
+//..
+    const char *EXPECTED = "{\n"
+                           "  \"Name\" : \"Apple Inc\",\n"
+                           "  \"Last Price\" : 205.8\n"
+                           "}";
+
+    ASSERT(EXPECTED == buffer);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // FAILED OPERATIONS APPEND NOTHING
+        //
+        // Concerns:
+        //: 1 'openMember' with a name that is not valid UTF-8 fails, and
+        //:   appends nothing, not even indentation.
+        //:
+        //: 2 'putValue' with a value that cannot be encoded fails, and
+        //:   appends nothing, not even indentation.
+        //:
+        //: 3 After a failed operation, subsequent operations produce the same
+        //:   text as 'baljsn::Formatter' produces for the successful
+        //:   operations alone.
+        //
+        // Plan:
+        //: 1 In the pretty style, inside an array, call 'openMember' with an
+        //:   invalid name and 'putValue' with an invalid string, an infinite
+        //:   'double', and an infinite 'bdldfp::Decimal64', verify that each
+        //:   fails and that the buffer is unchanged.  (C-1..2)
+        //:
+        //: 2 Complete the document, and compare it to the one produced by a
+        //:   'baljsn::Formatter' omitting the failed operations.  (C-3)
+        //
+        // Testing:
+        //   FAILED OPERATIONS APPEND NOTHING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FAILED OPERATIONS APPEND NOTHING" << endl
+                          << "================================" << endl;
+
+        const char *BAD = "bad \xc3 UTF-8";
+
+        bsl::string buffer;
+        Obj         mX(&buffer, true, 1, 2);
+
+        mX.openObject();
+        const bsl::string AFTER_OPEN(buffer);
+
+        ASSERT(0 != mX.openMember(BAD));
+        ASSERTV(buffer, AFTER_OPEN == buffer);
+
+        ASSERT(0 == mX.openMember("values"));
+        mX.openArray();
+        const bsl::string AFTER_ARRAY(buffer);
+
+        Options options;
+        ASSERT(0 != mX.putValue(BAD));
+        ASSERT(0 != mX.putValue(bsl::numeric_limits<double>::infinity(),
+                                &options));
+        ASSERT(0 != mX.putValue(
+                          bsl::numeric_limits<bdldfp::Decimal64>::infinity(),
+                               &options));
+        ASSERTV(buffer, AFTER_ARRAY == buffer);
+
+        ASSERT(0 == mX.putValue(1));
+        mX.closeArray();
+        mX.closeObject();
+
+        bsl::ostringstream stream;
+        baljsn::Formatter  formatter(stream, true, 1, 2);
+        formatter.openObject();
+        formatter.openMember("values");
+        formatter.openArray();
+        formatter.putValue(1);
+        formatter.closeArray();
+        formatter.closeObject();
+
+        ASSERTV(stream.str(), buffer, stream.str() == buffer);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // FORMATTING OPERATIONS
+        //
+        // Concerns:
+        //: 1 For every sequence of operations, 'BufferFormatter' appends the
+        //:   same text as 'baljsn::Formatter' writes, in both the compact and
+        //:   the pretty style, for any indentation level and number of spaces
+        //:   per level, including negative ones.
+        //:
+        //: 2 'nestingDepth' returns the same value as for
+        //:   'baljsn::Formatter' after each operation.
+        //:
+        //: 3 Text is appended to the existing contents of the buffer.
+        //:
+        //: 4 No memory is allocated from the supplied allocator unless the
+        //:   nesting depth exceeds the inline capacity, and the formatter
+        //:   works correctly beyond it.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, specify a set of scripts of
+        //:   operations.  For each script and each of a set of formatting
+        //:   configurations, apply the script to a 'BufferFormatter' writing
+        //:   to a non-empty string, and to a 'baljsn::Formatter', and compare
+        //:   the text and the nesting depths.  (C-1..3)
+        //:
+        //: 2 Repeat P-1 for scripts nesting objects and arrays 8 and 40
+        //:   levels deep, using a test allocator, and verify the number of
+        //:   allocations.  (C-4)
+        //
+        // Testing:
+        //   BufferFormatter(bsl::string *, bool, int, int, Allocator *);
+        //   ~BufferFormatter();
+        //   void openObject();
+        //   void closeObject();
+        //   void openArray(bool formatAsEmptyArray);
+        //   void closeArray(bool formatAsEmptyArray);
+        //   int openMember(const bsl::string_view& name);
+        //   void putNullValue();
+        //   int putValue(const TYPE& value, const EncoderOptions *options);
+        //   void closeMember();
+        //   void addArrayElementSeparator();
+        //   int nestingDepth() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FORMATTING OPERATIONS" << endl
+                          << "=====================" << endl;
+
+        static const struct {
+            int  d_line;
+            bool d_pretty;
+            int  d_indent;
+            int  d_spaces;
+        } CONFIGS[] = {
+            //LINE  PRETTY  INDENT  SPACES
+            //----  ------  ------  ------
+            { L_,   false,       0,      0 },
+            { L_,   false,       2,      4 },
+            { L_,    true,       0,      0 },
+            { L_,    true,       0,      2 },
+            { L_,    true,       1,      4 },
+            { L_,    true,       3,     -2 },
+            { L_,    true,      -1,      3 },
+        };
+        const int NUM_CONFIGS = sizeof CONFIGS / sizeof *CONFIGS;
+
+        bsl::vector<bsl::string> scripts;
+        {
+            static const char *SCRIPTS[] = {
+                "",
+                "{}",
+                "[]",
+                "()",
+                "{mi}",
+                "{mi,Ms,mn,md,mb,mt}",
+                "[i;s;n;d;b;t]",
+                "[{mi};{Ms}]",
+                "{m[i;i],m(),m{mn}}",
+                "[[i;i];();[[n]];{}]",
+                "[()]",
+                "{m(),m[()]}",
+            };
+            const int NUM_SCRIPTS = sizeof SCRIPTS / sizeof *SCRIPTS;
+            scripts.assign(SCRIPTS, SCRIPTS + NUM_SCRIPTS);
+
+            for (int depth = 8; depth <= 40; depth += 32) {
+                scripts.push_back(bsl::string(depth, '[') +
+                                  "i" +
+                                  bsl::string(depth, ']'));
+
+                bsl::string objects;
+                for (int i = 0; i < depth; ++i) {
+                    objects += "{m";
+                }
+                objects += "s";
+                objects += bsl::string(depth, '}');
+                scripts.push_back(objects);
+            }
+        }
+
+        for (int ci = 0; ci < NUM_CONFIGS; ++ci) {
+            const int  LINE   = CONFIGS[ci].d_line;
+            const bool PRETTY = CONFIGS[ci].d_pretty;
+            const int  INDENT = CONFIGS[ci].d_indent;
+            const int  SPACES = CONFIGS[ci].d_spaces;
+
+            for (bsl::size_t si = 0; si < scripts.size(); ++si) {
+                const bsl::string& SCRIPT = scripts[si];
+
+                if (veryVerbose) { T_ P_(LINE) P(SCRIPT) }
+
+                bsl::ostringstream stream;
+                bsl::vector<int>   expDepths;
+                {
+                    baljsn::Formatter formatter(stream,
+                                                PRETTY,
+                                                INDENT,
+                                                SPACES);
+                    ASSERTV(LINE,
+                            0 == applyScript(&formatter, &expDepths, SCRIPT));
+                }
+
+                bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+                const bsl::string PREFIX("prefix:");
+                bsl::string       buffer(PREFIX);
+                bsl::vector<int>  depths;
+                {
+                    Obj mX(&buffer, PRETTY, INDENT, SPACES, &sa);
+                    ASSERTV(LINE, 0 == applyScript(&mX, &depths, SCRIPT));
+                }
+
+                ASSERTV(LINE, SCRIPT, stream.str(), buffer,
+                        PREFIX + stream.str() == buffer);
+                ASSERTV(LINE, SCRIPT, expDepths == depths);
+
+                const int maxDepth = depths.empty()
+                                   ? 0
+                                   : *bsl::max_element(depths.begin(),
+                                                       depths.end());
+                if (!PRETTY || maxDepth < 32) {
+                    ASSERTV(LINE, SCRIPT, sa.numAllocations(),
+                            0 == sa.numAllocations());
+                }
+                else {
+                    ASSERTV(LINE, SCRIPT, sa.numAllocations(),
+                            0 < sa.numAllocations());
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PRINTING VALUES
+        //
+        // Concerns:
+        //: 1 For each supported type, 'printValue' appends the same text as
+        //:   'baljsn::PrintUtil::printValue' writes, and returns the same
+        //:   status, with and without options.
+        //:
+        //: 2 Integral values of every width, including their extremes, are
+        //:   printed in decimal; 'char' values are printed as numbers.
+        //:
+        //: 3 Floating-point values are printed in the shortest round-trip
+        //:   form when no precision is specified, and using the specified
+        //:   precision otherwise; infinities and NaN are rejected unless the
+        //:   options allow encoding them as strings.
+        //:
+        //: 4 'bdldfp::Decimal64' values are quoted according to the options.
+        //:
+        //: 5 Date and time values use the fractional second precision of the
+        //:   options, or 3 if there are no options.
+        //
+        // Plan:
+        //: 1 For a set of values of each supported type, and for a set of
+        //:   options covering the relevant attributes (and no options),
+        //:   compare the output of 'printValue' with that of
+        //:   'baljsn::PrintUtil::printValue'.  (C-1..5)
+        //
+        // Testing:
+        //   int BufferFormatter_PrintUtil::printValue(bsl::string *, v, opt);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRINTING VALUES" << endl
+                          << "===============" << endl;
+
+        bsl::vector<Options> optionSets(1);
+        {
+            Options options;
+            options.setEncodeInfAndNaNAsStrings(true);
+            options.setEncodeQuotedDecimal64(false);
+            options.setDatetimeFractionalSecondPrecision(0);
+            optionSets.push_back(options);
+
+            options.setMaxFloatPrecision(3);
+            options.setMaxDoublePrecision(10);
+            options.setDatetimeFractionalSecondPrecision(6);
+            optionSets.push_back(options);
+
+            options.setEncodeInfAndNaNAsStrings(false);
+            options.setEncodeQuotedDecimal64(true);
+            options.setMaxFloatPrecision(9);
+            options.setMaxDoublePrecision(17);
+            options.setDatetimeFractionalSecondPrecision(1);
+            optionSets.push_back(options);
+        }
+
+        const double DINF = bsl::numeric_limits<double>::infinity();
+        const double DNAN = bsl::numeric_limits<double>::quiet_NaN();
+        const float  FINF = bsl::numeric_limits<float>::infinity();
+        const float  FNAN = bsl::numeric_limits<float>::quiet_NaN();
+
+        const double DOUBLES[] = {
+            0.0, -0.0, 1.0, -1.5, 0.1, 1.0 / 3.0, 1e21, 1e-7, 6.02214076e23,
+            bsl::numeric_limits<double>::min(),
+            bsl::numeric_limits<double>::max(),
+            bsl::numeric_limits<double>::denorm_min(),
+            DINF, -DINF, DNAN
+        };
+        const int NUM_DOUBLES = sizeof DOUBLES / sizeof *DOUBLES;
+
+        const float FLOATS[] = {
+            0.0f, -0.0f, 1.0f, -1.5f, 0.1f, 1.0f / 3.0f, 3.4e38f, 1e-7f,
+            bsl::numeric_limits<float>::min(),
+            bsl::numeric_limits<float>::denorm_min(),
+            FINF, -FINF, FNAN
+        };
+        const int NUM_FLOATS = sizeof FLOATS / sizeof *FLOATS;
+
+        typedef bdldfp::Decimal64 Dec;
+        const Dec DECIMALS[] = {
+            BDLDFP_DECIMAL_DD(0.0),
+            BDLDFP_DECIMAL_DD(-1.25),
+            BDLDFP_DECIMAL_DD(1234567890.123456),
+            BDLDFP_DECIMAL_DD(1e-300),
+            bsl::numeric_limits<Dec>::max(),
+            bsl::numeric_limits<Dec>::min(),
+            bsl::numeric_limits<Dec>::infinity(),
+            -bsl::numeric_limits<Dec>::infinity(),
+            bsl::numeric_limits<Dec>::quiet_NaN()
+        };
+        const int NUM_DECIMALS = sizeof DECIMALS / sizeof *DECIMALS;
+
+        const bdlt::Time     TIME(13, 14, 15, 167, 891);
+        const bdlt::Date     DATE(2026, 10, 19);
+        const bdlt::Datetime DATETIME(DATE, TIME);
+
+        for (bsl::size_t oi = 0; oi <= optionSets.size(); ++oi) {
+            const Options *OPT = oi < optionSets.size() ? &optionSets[oi] : 0;
+
+            if (veryVerbose) { T_ P(oi) }
+
+            assertSameValue(L_, true,  OPT);
+            assertSameValue(L_, false, OPT);
+
+            assertSameValue(L_, 'a',                        OPT);
+            assertSameValue(L_, static_cast<char>(-5),      OPT);
+            assertSameValue(L_, static_cast<signed char>(SCHAR_MIN), OPT);
+            assertSameValue(L_, static_cast<unsigned char>(UCHAR_MAX), OPT);
+            assertSameValue(L_, static_cast<short>(SHRT_MIN),          OPT);
+            assertSameValue(L_, static_cast<unsigned short>(USHRT_MAX), OPT);
+            assertSameValue(L_, 0,                          OPT);
+            assertSameValue(L_, INT_MIN,                    OPT);
+            assertSameValue(L_, INT_MAX,                    OPT);
+            assertSameValue(L_, UINT_MAX,                   OPT);
+            assertSameValue(L_, bsl::numeric_limits<Int64>::min(),  OPT);
+            assertSameValue(L_, bsl::numeric_limits<Int64>::max(),  OPT);
+            assertSameValue(L_, bsl::numeric_limits<Uint64>::max(), OPT);
+
+            for (int i = 0; i < NUM_DOUBLES; ++i) {
+                assertSameValue(L_, DOUBLES[i], OPT);
+            }
+            for (int i = 0; i < NUM_FLOATS; ++i) {
+                assertSameValue(L_, FLOATS[i], OPT);
+            }
+            for (int i = 0; i < NUM_DECIMALS; ++i) {
+                assertSameValue(L_, DECIMALS[i], OPT);
+            }
+
+            assertSameValue(L_, "a \"string\"", OPT);
+            assertSameValue(L_, bsl::string_view("view\t"), OPT);
+
+            assertSameValue(L_, TIME,     OPT);
+            assertSameValue(L_, DATE,     OPT);
+            assertSameValue(L_, DATETIME, OPT);
+            assertSameValue(L_, bdlt::TimeTz(TIME, -300),         OPT);
+            assertSameValue(L_, bdlt::DateTz(DATE, 60),           OPT);
+            assertSameValue(L_, bdlt::DatetimeTz(DATETIME, 330),  OPT);
+            assertSameValue(L_, bdlt::DatetimeInterval(-3, 4, 5, 6, 7, 8),
+                            OPT);
+            assertSameValue(L_,
+                            bdlt::DatetimeInterval(INT_MAX, 23, 59, 59),
+                            OPT);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRINTING STRINGS
+        //
+        // Concerns:
+        //: 1 Every byte value is escaped, or not, exactly as by
+        //:   'baljsn::PrintUtil', wherever it occurs relative to the 16-byte
+        //:   blocks scanned at once.
+        //:
+        //: 2 Strings containing valid multi-byte UTF-8 sequences are printed
+        //:   verbatim (apart from escapes).
+        //:
+        //: 3 Strings that are not valid UTF-8 are rejected wherever the
+        //:   invalid sequence occurs, and nothing is appended.
+        //
+        // Plan:
+        //: 1 For strings of lengths 0 to 40, insert each of a set of bytes
+        //:   (every byte value, for a few lengths) at every position of a
+        //:   string of plain characters, and compare the output with that of
+        //:   'baljsn::PrintUtil'.  (C-1)
+        //:
+        //: 2 Repeat P-1, inserting valid and invalid UTF-8 sequences, and
+        //:   both a valid sequence and an escaped character.  (C-2..3)
+        //
+        // Testing:
+        //   int BufferFormatter_PrintUtil::printString(bsl::string *, value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRINTING STRINGS" << endl
+                          << "================" << endl;
+
+        if (verbose) cout << "\nTesting every byte value." << endl;
+
+        for (int ch = 0; ch < 256; ++ch) {
+            static const int LENGTHS[] = { 1, 2, 16, 17, 33 };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            for (int li = 0; li < NUM_LENGTHS; ++li) {
+                const int LENGTH = LENGTHS[li];
+                for (int pos = 0; pos < LENGTH; ++pos) {
+                    bsl::string value(LENGTH, 'x');
+                    value[pos] = static_cast<char>(ch);
+                    assertSameString(L_, value);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting interesting bytes and sequences."
+                          << endl;
+
+        static const char *INSERTS[] = {
+            "\"", "\\", "/", "\b", "\f", "\n", "\r", "\t", "\x01", "\x1f",
+            " ", "\x7f",
+            "\xc3\xa9",                    // valid 2-byte sequence
+            "\xe2\x82\xac",                // valid 3-byte sequence
+            "\xf0\x9f\x98\x80",            // valid 4-byte sequence
+            "\xc3\xa9\"",                  // valid sequence then an escape
+            "\xc3",                        // truncated sequence
+            "\xe2\x82",                    // truncated sequence
+            "\x80",                        // unexpected continuation byte
+            "\xc0\xaf",                    // overlong encoding
+            "\xed\xa0\x80",                // surrogate
+            "\xff",                        // invalid byte
+        };
+        const int NUM_INSERTS = sizeof INSERTS / sizeof *INSERTS;
+
+        for (int ii = 0; ii < NUM_INSERTS; ++ii) {
+            for (int length = 0; length <= 40; ++length) {
+                for (int pos = 0; pos <= length; ++pos) {
+                    bsl::string value(length, 'y');
+                    value.insert(pos, INSERTS[ii]);
+                    assertSameString(L_, value);
+
+                    // Also place a valid multi-byte sequence earlier, so that
+                    // the string has been validated when the insert is seen.
+
+                    value.insert(0, "\xc3\xa9");
+                    assertSameString(L_, value);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting embedded null characters." << endl;
+        {
+            const bsl::string value("a\0b\0c", 5);
+            assertSameString(L_, value);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Format a small document in the compact and the pretty style and
+        //:   verify the text.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        {
+            bsl::string buffer;
+            Obj         mX(&buffer);
+
+            mX.openObject();
+            ASSERT(0 == mX.openMember("a"));
+            mX.openArray();
+            ASSERT(0 == mX.putValue(1));
+            mX.addArrayElementSeparator();
+            mX.putNullValue();
+            mX.closeArray();
+            mX.closeMember();
+            ASSERT(0 == mX.openMember("b"));
+            ASSERT(0 == mX.putValue("x/y"));
+            mX.closeObject();
+
+            ASSERTV(buffer, "{\"a\":[1,null],\"b\":\"x\\/y\"}" == buffer);
+            ASSERT(0 == mX.nestingDepth());
+        }
+        {
+            bsl::string buffer;
+            Obj         mX(&buffer, true, 0, 2);
+
+            mX.openObject();
+            ASSERT(1 == mX.nestingDepth());
+            ASSERT(0 == mX.openMember("a"));
+            mX.openArray();
+            ASSERT(2 == mX.nestingDepth());
+            ASSERT(0 == mX.putValue(1));
+            mX.closeArray();
+            mX.closeObject();
+            ASSERT(0 == mX.nestingDepth());
+
+            ASSERTV(buffer,
+                    "{\n  \"a\" : [\n    1\n  ]\n}" == buffer);
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Formatting to a flat buffer is faster than formatting to a
+        //:   stream.
+        //
+        // Plan:
+        //: 1 For documents of several sizes, or of the number of records
+        //:   given as the second command-line argument, time formatting the
+        //:   document with a 'baljsn::Formatter' and with a
+        //:   'BufferFormatter', and report the throughput of each.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int ARG     = argc > 2 ? atoi(argv[2]) : 0;
+        const int SIZES[] = { 1, 16, 256, 4096 };
+        const int NUM_SIZES = 0 < ARG
+                            ? 1
+                            : static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        cout << "records  stream(MB/s)  buffer(MB/s)" << endl;
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int NUM_RECORDS = 0 < ARG ? ARG : SIZES[si];
+            const int ITERATIONS  = bsl::max(1, 20000 / NUM_RECORDS);
+
+            bsl::string buffer;
+
+            StreamFormatting streamed  = { NUM_RECORDS };
+            BufferFormatting flattened = { &buffer, NUM_RECORDS };
+
+            const bsl::size_t LENGTH = flattened();
+
+            const double streamTime = medianTime(streamed,  ITERATIONS);
+            const double bufferTime = medianTime(flattened, ITERATIONS);
+
+            const double MEGABYTES = static_cast<double>(LENGTH)
+                                   * ITERATIONS / 1e6;
+
+            cout << NUM_RECORDS << "  " << MEGABYTES / streamTime
+                 << "  " << MEGABYTES / bufferTime << endl;
+        }
+
+        if (veryVerbose) {
+            P(s_antiOptimization);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -24,11 +24,15 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <bdlsb_memoutstreambuf.h>
 
 #include <bsls_alignedbuffer.h>
+#include <bsls_assert.h>
 
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
 #include <bsl_unordered_set.h>
+#include <bsl_vector.h>
 
 namespace {
 namespace u {
@@ -291,6 +295,408 @@ int decodeValue(bdld::ManagedDatum *result,
       } break;
     }
 
+    return 0;
+}
+
+                            // ==================
+                            // class ArenaDecoder
+                            // ==================
+
+class ArenaDecoder {
+    // This class implements a recursive-descent JSON parser over a contiguous
+    // input that builds the decoded 'bdld::Datum' directly in an arena.
+    // Strings and keys containing no escape sequences refer to the input in
+    // place; all other memory of the resulting datum comes from the arena.
+    // Elements of arrays and objects are accumulated on scratch stacks and
+    // copied into the arena exactly once, when the enclosing aggregate is
+    // complete, so that no partially grown aggregate is ever abandoned in the
+    // arena.
+
+    // PRIVATE TYPES
+    enum {
+        k_LINEAR_KEY_SEARCH_LIMIT = 16  // objects having no more than this
+                                        // many members are searched linearly
+                                        // for duplicate keys
+    };
+
+    // DATA
+    const char                       *d_begin_p;        // start of input
+    const char                       *d_cursor_p;       // parse position
+    const char                       *d_end_p;          // end of input
+    bslma::Allocator                 *d_arena_p;        // result memory
+    bsl::ostream                     *d_errorStream_p;  // diagnostics
+    bsl::vector<bdld::Datum>          d_elements;       // pending elements
+    bsl::vector<bdld::DatumMapEntry>  d_entries;        // pending members
+    bsl::string                       d_unescaped;      // escape scratch
+
+    // PRIVATE MANIPULATORS
+    int decodeArray(bdld::Datum *result, int maxNestedDepth);
+        // Decode into the specified 'result' the JSON array at the current
+        // position, failing if the specified 'maxNestedDepth' is negative.
+        // Return 0 on success, and a non-zero value otherwise.
+
+    int decodeObject(bdld::Datum *result, int maxNestedDepth);
+        // Decode into the specified 'result' the JSON object at the current
+        // position, failing if the specified 'maxNestedDepth' is negative.
+        // Keep the *first* of any members having the same key.  Return 0 on
+        // success, and a non-zero value otherwise.
+
+    int decodeScalar(bdld::Datum *result);
+        // Decode into the specified 'result' the unquoted JSON value (number,
+        // 'true', 'false' or 'null') at the current position.  Return 0 on
+        // success, and a non-zero value otherwise.
+
+    int decodeString(bsl::string_view *result);
+        // Load into the specified 'result' the unescaped contents of the
+        // quoted JSON string at the current position, referring to the input
+        // if the string has no escape sequences and to a copy in the arena
+        // otherwise.  Return 0 on success, and a non-zero value otherwise.
+
+    int fail(const char *message);
+        // Output the specified 'message' and the current offset to the error
+        // stream (if any), and return a non-zero value.
+
+    void skipWhitespace();
+        // Advance the current position past any JSON whitespace.
+
+  public:
+    // CREATORS
+    ArenaDecoder(const bsl::string_view&  json,
+                 bslma::Allocator        *arena,
+                 bsl::ostream            *errorStream,
+                 bslma::Allocator        *scratchAllocator);
+        // Create a decoder for the specified 'json' that supplies the memory
+        // of decoded values from the specified 'arena' and reports errors to
+        // the specified 'errorStream' (if not null), using the specified
+        // 'scratchAllocator' for temporary storage.
+
+    // MANIPULATORS
+    int decodeValue(bdld::Datum *result, int maxNestedDepth);
+        // Decode into the specified 'result' the JSON value at the current
+        // position, failing if arrays or objects nest more deeply than the
+        // specified 'maxNestedDepth'.  Return 0 on success, and a non-zero
+        // value otherwise.
+
+    int finish();
+        // Skip trailing whitespace and return 0 if the entire input has been
+        // consumed, and a non-zero value otherwise.
+};
+
+                            // ------------------
+                            // class ArenaDecoder
+                            // ------------------
+
+// PRIVATE MANIPULATORS
+int ArenaDecoder::decodeArray(bdld::Datum *result, int maxNestedDepth)
+{
+    if (maxNestedDepth < 0) {
+        return fail("Maximum nesting depth exceeded");                // RETURN
+    }
+
+    ++d_cursor_p;  // '['
+    skipWhitespace();
+
+    const bsl::size_t mark = d_elements.size();
+
+    if (d_cursor_p < d_end_p && ']' == *d_cursor_p) {
+        ++d_cursor_p;
+    }
+    else {
+        while (true) {
+            bdld::Datum element;
+            if (0 != decodeValue(&element, maxNestedDepth)) {
+                return -1;                                            // RETURN
+            }
+            d_elements.push_back(element);
+
+            skipWhitespace();
+            if (d_cursor_p == d_end_p) {
+                return fail("Unterminated array");                    // RETURN
+            }
+
+            const char separator = *d_cursor_p++;
+            if (']' == separator) {
+                break;
+            }
+            if (',' != separator) {
+                --d_cursor_p;
+                return fail("Expected ',' or ']'");                   // RETURN
+            }
+        }
+    }
+
+    const bsl::size_t length = d_elements.size() - mark;
+    if (0 == length) {
+        *result = bdld::Datum::adoptArray(bdld::DatumMutableArrayRef());
+        return 0;                                                     // RETURN
+    }
+
+    bdld::DatumMutableArrayRef array;
+    bdld::Datum::createUninitializedArray(&array, length, d_arena_p);
+    bsl::copy(d_elements.begin() + mark, d_elements.end(), array.data());
+    *array.length() = length;
+    d_elements.resize(mark);
+
+    *result = bdld::Datum::adoptArray(array);
+    return 0;
+}
+
+int ArenaDecoder::decodeObject(bdld::Datum *result, int maxNestedDepth)
+{
+    if (maxNestedDepth < 0) {
+        return fail("Maximum nesting depth exceeded");                // RETURN
+    }
+
+    ++d_cursor_p;  // '{'
+    skipWhitespace();
+
+    const bsl::size_t mark = d_entries.size();
+
+    // 'keys' is populated only once the object outgrows a linear search.
+
+    bsl::unordered_set<bsl::string_view> keys(
+                                   d_elements.get_allocator().mechanism());
+
+    if (d_cursor_p < d_end_p && '}' == *d_cursor_p) {
+        ++d_cursor_p;
+    }
+    else {
+        while (true) {
+            skipWhitespace();
+            if (d_cursor_p == d_end_p || '"' != *d_cursor_p) {
+                return fail("Expected member name");                  // RETURN
+            }
+
+            bsl::string_view key;
+            if (0 != decodeString(&key)) {
+                return -1;                                            // RETURN
+            }
+
+            skipWhitespace();
+            if (d_cursor_p == d_end_p || ':' != *d_cursor_p) {
+                return fail("Expected ':'");                          // RETURN
+            }
+            ++d_cursor_p;
+
+            bdld::Datum value;
+            if (0 != decodeValue(&value, maxNestedDepth)) {
+                return -1;                                            // RETURN
+            }
+
+            // Keep the FIRST instance of any duplicate keys.
+
+            const bsl::size_t numMembers = d_entries.size() - mark;
+            bool              isDuplicate;
+            if (numMembers < k_LINEAR_KEY_SEARCH_LIMIT) {
+                isDuplicate = false;
+                for (bsl::size_t i = mark; i < d_entries.size(); ++i) {
+                    if (d_entries[i].key() == key) {
+                        isDuplicate = true;
+                        break;
+                    }
+                }
+            }
+            else {
+                if (keys.empty()) {
+                    for (bsl::size_t i = mark; i < d_entries.size(); ++i) {
+                        keys.insert(d_entries[i].key());
+                    }
+                }
+                isDuplicate = !keys.insert(key).second;
+            }
+
+            if (!isDuplicate) {
+                d_entries.push_back(bdld::DatumMapEntry(key, value));
+            }
+
+            skipWhitespace();
+            if (d_cursor_p == d_end_p) {
+                return fail("Unterminated object");                   // RETURN
+            }
+
+            const char separator = *d_cursor_p++;
+            if ('}' == separator) {
+                break;
+            }
+            if (',' != separator) {
+                --d_cursor_p;
+                return fail("Expected ',' or '}'");                   // RETURN
+            }
+        }
+    }
+
+    const bsl::size_t size = d_entries.size() - mark;
+    if (0 == size) {
+        *result = bdld::Datum::adoptMap(bdld::DatumMutableMapRef());
+        return 0;                                                     // RETURN
+    }
+
+    bdld::DatumMutableMapRef map;
+    bdld::Datum::createUninitializedMap(&map, size, d_arena_p);
+    bsl::copy(d_entries.begin() + mark, d_entries.end(), map.data());
+    *map.size()   = size;
+    *map.sorted() = false;
+    d_entries.resize(mark);
+
+    *result = bdld::Datum::adoptMap(map);
+    return 0;
+}
+
+int ArenaDecoder::decodeScalar(bdld::Datum *result)
+{
+    // A scalar extends to the next whitespace or structural character, as
+    // for 'baljsn::Tokenizer'.
+
+    const char *begin = d_cursor_p;
+    while (d_cursor_p < d_end_p
+        && !bdlb::CharType::isSpace(*d_cursor_p)
+        && 0 == bsl::memchr("{}[]:,", *d_cursor_p, 6)) {
+        ++d_cursor_p;
+    }
+
+    const bsl::string_view value(begin, d_cursor_p - begin);
+
+    if (value.empty()) {
+        return fail("Expected value");                                // RETURN
+    }
+
+    if ("true" == value || "false" == value) {
+        *result = bdld::Datum::createBoolean("true" == value);
+        return 0;                                                     // RETURN
+    }
+
+    if ("null" == value) {
+        *result = bdld::Datum::createNull();
+        return 0;                                                     // RETURN
+    }
+
+    double            d;
+    bslstl::StringRef remainder;
+    if (0 == bdlb::NumericParseUtil::parseDouble(&d, &remainder, value) &&
+        0 == remainder.length()) {
+        *result = bdld::Datum::createDouble(d);
+        return 0;                                                     // RETURN
+    }
+
+    d_cursor_p = begin;
+    return fail("Invalid value");
+}
+
+int ArenaDecoder::decodeString(bsl::string_view *result)
+{
+    const char *begin = d_cursor_p + 1;  // skip '"'
+
+    const char *quote = static_cast<const char *>(
+                               bsl::memchr(begin, '"', d_end_p - begin));
+    if (!quote) {
+        return fail("Unterminated string");                           // RETURN
+    }
+
+    if (!bsl::memchr(begin, '\\', quote - begin)) {
+        // No escape sequences: refer to the input in place.
+
+        *result    = bsl::string_view(begin, quote - begin);
+        d_cursor_p = quote + 1;
+        return 0;                                                     // RETURN
+    }
+
+    // Find the closing quote, skipping escaped characters.
+
+    const char *end = begin;
+    while (end < d_end_p && '"' != *end) {
+        end += '\\' == *end ? 2 : 1;
+    }
+    if (end >= d_end_p) {
+        return fail("Unterminated string");                           // RETURN
+    }
+
+    if (0 != baljsn::ParserUtil::getUnquotedString(
+                                  &d_unescaped,
+                                  bsl::string_view(begin, end - begin))) {
+        return fail("Invalid escape sequence");                       // RETURN
+    }
+
+    const bsl::size_t length = d_unescaped.length();
+    char             *copy   = 0;
+    if (0 != length) {
+        copy = static_cast<char *>(d_arena_p->allocate(length));
+        bsl::memcpy(copy, d_unescaped.data(), length);
+    }
+
+    *result    = bsl::string_view(copy, length);
+    d_cursor_p = end + 1;
+    return 0;
+}
+
+int ArenaDecoder::fail(const char *message)
+{
+    if (d_errorStream_p) {
+        *d_errorStream_p << message << " at offset "
+                         << (d_cursor_p - d_begin_p) << '\n';
+    }
+    return -1;
+}
+
+void ArenaDecoder::skipWhitespace()
+{
+    while (d_cursor_p < d_end_p && bdlb::CharType::isSpace(*d_cursor_p)) {
+        ++d_cursor_p;
+    }
+}
+
+// CREATORS
+ArenaDecoder::ArenaDecoder(const bsl::string_view&  json,
+                           bslma::Allocator        *arena,
+                           bsl::ostream            *errorStream,
+                           bslma::Allocator        *scratchAllocator)
+: d_begin_p(json.data())
+, d_cursor_p(json.data())
+, d_end_p(json.data() + json.length())
+, d_arena_p(arena)
+, d_errorStream_p(errorStream)
+, d_elements(scratchAllocator)
+, d_entries(scratchAllocator)
+, d_unescaped(scratchAllocator)
+{
+}
+
+// MANIPULATORS
+int ArenaDecoder::decodeValue(bdld::Datum *result, int maxNestedDepth)
+{
+    skipWhitespace();
+    if (d_cursor_p == d_end_p) {
+        return fail("Unexpected end of input");                       // RETURN
+    }
+
+    switch (*d_cursor_p) {
+      case '{': {
+        return decodeObject(result, maxNestedDepth - 1);              // RETURN
+      }
+      case '[': {
+        return decodeArray(result, maxNestedDepth - 1);               // RETURN
+      }
+      case '"': {
+        bsl::string_view value;
+        if (0 != decodeString(&value)) {
+            return -1;                                                // RETURN
+        }
+        *result = bdld::Datum::createStringRef(value.data(),
+                                               value.length(),
+                                               d_arena_p);
+        return 0;                                                     // RETURN
+      }
+      default: {
+        return decodeScalar(result);                                  // RETURN
+      }
+    }
+}
+
+int ArenaDecoder::finish()
+{
+    skipWhitespace();
+    if (d_cursor_p != d_end_p) {
+        return fail("Extra token detected after value");              // RETURN
+    }
     return 0;
 }
 
@@ -519,6 +925,45 @@ int DatumUtil::decode(bdld::ManagedDatum         *result,
     return 0;
 }
 
+int DatumUtil::decodeInArena(bdld::Datum                *result,
+                             bdlma::ManagedAllocator    *arena,
+                             bsl::ostream               *errorStream,
+                             const bsl::string_view&     json,
+                             const DatumDecoderOptions&  options)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(arena);
+
+    if (!bdlde::Utf8Util::isValid(json.data(), json.length())) {
+        if (errorStream) {
+            *errorStream << "Invalid UTF-8 in input\n";
+        }
+        return -1;                                                    // RETURN
+    }
+
+    // Scratch stacks for pending elements usually fit in the local buffer;
+    // any overflow is taken from 'arena', never from the default allocator.
+
+    bsls::AlignedBuffer<8 * 1024>      buffer;
+    bdlma::BufferedSequentialAllocator scratch(buffer.buffer(),
+                                               sizeof(buffer),
+                                               arena);
+
+    u::ArenaDecoder decoder(json, arena, errorStream, &scratch);
+
+    bdld::Datum value;
+    if (0 != decoder.decodeValue(&value, options.maxNestedDepth())) {
+        return -2;                                                    // RETURN
+    }
+
+    if (0 != decoder.finish()) {
+        return -3;                                                    // RETURN
+    }
+
+    *result = value;
+    return 0;
+}
+
 int DatumUtil::encode(bsl::string                *result,
                       const bdld::Datum&          datum,
                       const DatumEncoderOptions&  options)
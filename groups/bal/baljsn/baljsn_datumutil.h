@@ -116,6 +116,36 @@ BSLS_IDENT("$Id$ $CSID$")
 //: o *strictTypes ok?* - 'encode' will return 0 on success even if
 //:   'options->strictTypes()' is 'true'.
 //
+///Arena Decoding
+///---------------
+// The 'decodeInArena' functions decode a JSON string held in contiguous
+// memory into a plain 'bdld::Datum' whose entire footprint is supplied by a
+// caller-provided 'bdlma::ManagedAllocator' (the "arena"), typically a
+// 'bdlma::SequentialAllocator' or a 'bdlma::BufferedSequentialAllocator'
+// reused from message to message.  String values and object keys containing
+// no escape sequences are not copied: the decoded 'Datum' refers to the
+// characters of the input directly, and only strings that must be unescaped
+// are copied into the arena.  Arrays and objects are sized exactly before
+// they are allocated, so the arena holds no abandoned intermediate buffers.
+// Consequently:
+//
+//: o The input characters must remain valid and unmodified for as long as the
+//:   decoded 'Datum' is in use.  Clients that do not retain the input can
+//:   first copy it into the arena, so that both share a lifetime.
+//:
+//: o The decoded 'Datum' must *not* be passed to 'bdld::Datum::destroy' (nor
+//:   adopted by a 'bdld::ManagedDatum'); all of its memory is reclaimed at
+//:   once by 'arena->release()'.
+//:
+//: o Memory allocated from the arena by a failed decode is likewise
+//:   reclaimed only by 'release'.
+//
+// The decoded value is equal to the one produced by 'decode' for the same
+// input and options, including the treatment of numbers and duplicate keys.
+// The grammar accepted by 'decodeInArena' is, however, slightly stricter than
+// that of 'decode': unbalanced brackets (e.g., '[1}') and trailing characters
+// after the top-level value are always rejected.
+
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -252,6 +282,48 @@ BSLS_IDENT("$Id$ $CSID$")
 // Notice that the 'type' of "age" is 'double', since "age" was encoded as a
 // number, and 'double' is the supported representation of a JSON number (see
 // {'Supported Types'}).
+//
+///Example 3: Decoding a Stream of Messages into an Arena
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we process a high volume of small JSON messages, each of which
+// is examined and then discarded.  Using 'decodeInArena' we can decode each
+// message without copying its strings and discard the decoded 'Datum' with a
+// single 'release' of the arena.
+//
+// First, we create an arena that is reused for every message:
+//..
+//  bsls::AlignedBuffer<4 * 1024>      arenaBuffer;
+//  bdlma::BufferedSequentialAllocator arena(arenaBuffer.buffer(),
+//                                           sizeof(arenaBuffer));
+//..
+// Then, we decode a message held in a buffer that we retain while the decoded
+// 'Datum' is in use:
+//..
+//  const bsl::string_view message =
+//                  "{\"symbol\":\"IBM\",\"side\":\"Buy\",\"quantity\":300}";
+//
+//  bdld::Datum order;
+//  rc = baljsn::DatumUtil::decodeInArena(&order, &arena, message);
+//  assert(0 == rc);
+//..
+// Next, we inspect the result, observing that the "symbol" string refers to
+// the characters of 'message' rather than to a copy:
+//..
+//  assert(order.isMap());
+//  assert(3   == order.theMap().size());
+//  assert(300 == order.theMap().find("quantity")->theDouble());
+//
+//  const bslstl::StringRef symbol =
+//                                 order.theMap().find("symbol")->theString();
+//  assert("IBM" == symbol);
+//  assert(message.data() < symbol.data());
+//  assert(symbol.data()  < message.data() + message.length());
+//..
+// Finally, once we are done with the message, we release all memory used by
+// the decoded 'Datum' at once, readying the arena for the next message:
+//..
+//  arena.release();
+//..
 
 #include <balscm_version.h>
 
@@ -260,6 +332,7 @@ BSLS_IDENT("$Id$ $CSID$")
 
 #include <bdld_datum.h>
 #include <bdld_manageddatum.h>
+#include <bdlma_managedallocator.h>
 #include <bdlsb_fixedmeminstreambuf.h>
 
 #include <bsls_libraryfeatures.h>
@@ -337,6 +410,38 @@ struct DatumUtil {
         // mapping of types in JSON to the types supported by 'Datum' is
         // described in {Supported Types}.
 
+    static int decodeInArena(bdld::Datum                *result,
+                             bdlma::ManagedAllocator    *arena,
+                             const bsl::string_view&     json);
+    static int decodeInArena(bdld::Datum                *result,
+                             bdlma::ManagedAllocator    *arena,
+                             const bsl::string_view&     json,
+                             const DatumDecoderOptions&  options);
+    static int decodeInArena(bdld::Datum                *result,
+                             bdlma::ManagedAllocator    *arena,
+                             bsl::ostream               *errorStream,
+                             const bsl::string_view&     json);
+    static int decodeInArena(bdld::Datum                *result,
+                             bdlma::ManagedAllocator    *arena,
+                             bsl::ostream               *errorStream,
+                             const bsl::string_view&     json,
+                             const DatumDecoderOptions&  options);
+        // Decode the specified 'json' into the specified 'result', using the
+        // specified 'arena' to supply all memory for the decoded value, and
+        // referring to the characters of 'json' for strings and keys having no
+        // escape sequences.  If the optionally specified 'errorStream' is
+        // non-null, a description of any errors that occur during parsing
+        // will be output to this stream.  If the optionally specified
+        // 'options' argument is not present, treat it as a
+        // default-constructed 'DatumDecoderOptions'.  Return 0 on success, and
+        // a negative value (with no effect on 'result') if 'json' could not be
+        // decoded.  No memory is allocated from the default allocator.  The
+        // behavior is undefined unless the characters of 'json' remain valid
+        // and unmodified while 'result' is in use, and 'result' is never
+        // passed to 'bdld::Datum::destroy'.  Note that all memory used by
+        // 'result' (including that used by a failed decode) is reclaimed by
+        // 'arena->release()'.  See {Arena Decoding}.
+
     static int encode(bsl::string         *result,
                       const bdld::Datum&   datum);
     static int encode(std::string         *result,
@@ -453,6 +558,36 @@ int DatumUtil::decode(bdld::ManagedDatum         *result,
     return decode(result, errorStream, jsonBuffer, DatumDecoderOptions());
 }
 
+inline
+int DatumUtil::decodeInArena(bdld::Datum                *result,
+                             bdlma::ManagedAllocator    *arena,
+                             const bsl::string_view&     json)
+{
+    return decodeInArena(result, arena, 0, json, DatumDecoderOptions());
+}
+
+inline
+int DatumUtil::decodeInArena(bdld::Datum                *result,
+                             bdlma::ManagedAllocator    *arena,
+                             const bsl::string_view&     json,
+                             const DatumDecoderOptions&  options)
+{
+    return decodeInArena(result, arena, 0, json, options);
+}
+
+inline
+int DatumUtil::decodeInArena(bdld::Datum                *result,
+                             bdlma::ManagedAllocator    *arena,
+                             bsl::ostream               *errorStream,
+                             const bsl::string_view&     json)
+{
+    return decodeInArena(result,
+                         arena,
+                         errorStream,
+                         json,
+                         DatumDecoderOptions());
+}
+
 inline
 int DatumUtil::encode(bsl::string *result, const bdld::Datum& datum)
 {
@@ -18,6 +18,7 @@
 
 #include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
 #include <bslma_testallocator.h>            // to verify that we do not
 #include <bslma_testallocatormonitor.h>     // allocate any memory
 
@@ -25,6 +26,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_compilerfeatures.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bdld_datum.h>
@@ -37,6 +39,7 @@
 #include <bdldfp_decimal.h>
 
 #include <bdlma_bufferedsequentialallocator.h>
+#include <bdlma_sequentialallocator.h>
 
 #include <bdlsb_fixedmeminstreambuf.h>  // for testing only
 #include <bdlsb_memoutstreambuf.h>      // for testing only
@@ -79,12 +82,17 @@ using namespace bsl;
 // [ 5] int decode(MgedDatum*, streamBuf*, const DDOptions&);
 // [ 5] int decode(MgedDatum*, ostream*, streamBuf*);
 // [ 5] int decode(MgedDatum*, ostream*, streamBuf*, const DDOptions&);
+// [ 9] int decodeInArena(Datum*, MgdAlloc*, const string_view&);
+// [ 9] int decodeInArena(Datum*, MgdAlloc*, sv, const DDOptions&);
+// [ 9] int decodeInArena(Datum*, MgdAlloc*, ostream*, sv);
+// [ 9] int decodeInArena(Datum*, MgdAlloc*, ostream*, sv, DDOptions);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] BREATHING DECODE TEST
 // [ 3] BREATHING ENCODE TEST
 // [ 4] BREATHING ROUND-TRIP TEST
-// [ 7] USAGE EXAMPLE
+// [10] USAGE EXAMPLE
+// [-1] PERFORMANCE: DECODE VS. DECODE IN ARENA
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -1157,7 +1165,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocatorMonitor gam(&ga);
 
     switch (test) { case 0:
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1355,6 +1363,339 @@ int main(int argc, char *argv[])
 // Notice that the 'type' of "age" is 'double', since "age" was encoded as a
 // number, and 'double' is the supported representation of a JSON number (see
 // {'Supported Types'}).
+//
+///Example 3: Decoding a Stream of Messages into an Arena
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we process a high volume of small JSON messages, each of which
+// is examined and then discarded.  Using 'decodeInArena' we can decode each
+// message without copying its strings and discard the decoded 'Datum' with a
+// single 'release' of the arena.
+//
+// First, we create an arena that is reused for every message:
+//..
+    bsls::AlignedBuffer<4 * 1024>      arenaBuffer;
+    bdlma::BufferedSequentialAllocator arena(arenaBuffer.buffer(),
+                                             sizeof(arenaBuffer));
+//..
+// Then, we decode a message held in a buffer that we retain while the decoded
+// 'Datum' is in use:
+//..
+    const bsl::string_view message =
+                    "{\"symbol\":\"IBM\",\"side\":\"Buy\",\"quantity\":300}";
+
+    bdld::Datum order;
+    rc = baljsn::DatumUtil::decodeInArena(&order, &arena, message);
+    ASSERT(0 == rc);
+//..
+// Next, we inspect the result, observing that the "symbol" string refers to
+// the characters of 'message' rather than to a copy:
+//..
+    ASSERT(order.isMap());
+    ASSERT(3   == order.theMap().size());
+    ASSERT(300 == order.theMap().find("quantity")->theDouble());
+
+    const bslstl::StringRef symbol =
+                                   order.theMap().find("symbol")->theString();
+    ASSERT("IBM" == symbol);
+    ASSERT(message.data() < symbol.data());
+    ASSERT(symbol.data()  < message.data() + message.length());
+//..
+// Finally, once we are done with the message, we release all memory used by
+// the decoded 'Datum' at once, readying the arena for the next message:
+//..
+    arena.release();
+//..
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // DECODE IN ARENA
+        //   This case tests the 'decodeInArena' methods.
+        //
+        // Concerns:
+        //: 1 'decodeInArena' succeeds on exactly the valid inputs on which
+        //:   'decode' succeeds, producing an equal 'Datum'.
+        //:
+        //: 2 'decodeInArena' fails on inputs that are not valid JSON, leaving
+        //:   'result' unchanged, and reports the error to a non-null error
+        //:   stream.
+        //:
+        //: 3 Strings and keys without escape sequences refer to the input;
+        //:   strings and keys with escape sequences are unescaped copies.
+        //:
+        //: 4 The first of any members having duplicate keys is kept, in
+        //:   small and in large objects.
+        //:
+        //: 5 The 'maxNestedDepth' option is honored as by 'decode'.
+        //:
+        //: 6 No memory comes from the default allocator, even when scratch
+        //:   space overflows its local buffer.
+        //
+        // Plan:
+        //: 1 For a table of valid and invalid inputs, decode with both
+        //:   'decode' and 'decodeInArena' and compare the status and result.
+        //:   Verify that a failed decode leaves 'result' unchanged.  (C-1..2)
+        //:
+        //: 2 Decode an object having escaped and unescaped strings and keys
+        //:   and check whether each string's address is within the input.
+        //:   (C-3)
+        //:
+        //: 3 Decode objects having 4 and 64 members with duplicate keys and
+        //:   compare with 'decode'.  (C-4)
+        //:
+        //: 4 Decode deeply nested inputs with 'maxNestedDepth' values around
+        //:   the nesting depth and compare the status with 'decode'.  (C-5)
+        //:
+        //: 5 Verify that the default allocator is unused while decoding,
+        //:   including for an array of 10000 elements.  (C-6)
+        //
+        // Testing:
+        //   int decodeInArena(Datum*, MgdAlloc*, const string_view&);
+        //   int decodeInArena(Datum*, MgdAlloc*, sv, const DDOptions&);
+        //   int decodeInArena(Datum*, MgdAlloc*, ostream*, sv);
+        //   int decodeInArena(Datum*, MgdAlloc*, ostream*, sv, DDOptions);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nDECODE IN ARENA"
+                          << "\n===============" << endl;
+
+        if (verbose) cout << "\nCompare with 'decode'." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_json;
+                bool        d_isValid;
+            } DATA[] = {
+                //LINE  JSON                                 VALID
+                //----  ----                                 -----
+                { L_,   "0",                                 true  },
+                { L_,   "-1.5e3",                            true  },
+                { L_,   "  42  ",                            true  },
+                { L_,   "true",                              true  },
+                { L_,   "false",                             true  },
+                { L_,   "null",                              true  },
+                { L_,   "\"\"",                              true  },
+                { L_,   "\"abc\"",                           true  },
+                { L_,   "\"a\\\"b\"",                        true  },
+                { L_,   "\"\\\\\"",                          true  },
+                { L_,   "\"\\u00e9\\n\\t\"",                 true  },
+                { L_,   "\"\xc3\xa9\"",                      true  },
+                { L_,   "[]",                                true  },
+                { L_,   "[ ]",                               true  },
+                { L_,   "{}",                                true  },
+                { L_,   "{ }",                               true  },
+                { L_,   "[1,\"a\",true,null,[],{}]",         true  },
+                { L_,   " [ 1 , 2 ] ",                       true  },
+                { L_,   "{\"a\":1,\"b\":[2,{\"c\":3}]}",     true  },
+                { L_,   "{\"a\" : 1 , \"b\" : 2}",           true  },
+                { L_,   "{\"\":\"\"}",                       true  },
+                { L_,   "{\"a\":1,\"a\":2}",                 true  },
+                { L_,   "[[[[]]]]",                          true  },
+                { L_,   "\r\n\t[\f1\v]",                     true  },
+
+                { L_,   "",                                  false },
+                { L_,   "   ",                               false },
+                { L_,   "[",                                 false },
+                { L_,   "]",                                 false },
+                { L_,   "{",                                 false },
+                { L_,   "[1",                                false },
+                { L_,   "[1,]",                              false },
+                { L_,   "[,1]",                              false },
+                { L_,   "[1 2]",                             false },
+                { L_,   "{\"a\"}",                           false },
+                { L_,   "{\"a\":}",                          false },
+                { L_,   "{\"a\":1,}",                        false },
+                { L_,   "{a:1}",                             false },
+                { L_,   "{1:1}",                             false },
+                { L_,   "\"abc",                             false },
+                { L_,   "\"a\\\"",                           false },
+                { L_,   "\"\\x\"",                           false },
+                { L_,   "\"\\u12\"",                         false },
+                { L_,   "tru",                               false },
+                { L_,   "nul",                               false },
+                { L_,   "1a",                                false },
+                { L_,   "1 2",                               false },
+                { L_,   "[1]]",                              false },
+                { L_,   "\"\xc3\"",                          false },
+                { L_,   "[\"\xff\"]",                        false },
+            };
+            enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int              LINE     = DATA[ti].d_line;
+                const bsl::string_view JSON     = DATA[ti].d_json;
+                const bool             IS_VALID = DATA[ti].d_isValid;
+
+                if (veryVerbose) { T_ P_(LINE) P(JSON) }
+
+                bdlma::SequentialAllocator arena(&ta);
+
+                MD  expected(&ta);
+                int expectedRc = Util::decode(&expected, JSON);
+
+                ASSERTV(LINE, expectedRc, !IS_VALID || 0 == expectedRc);
+
+                const D   SENTINEL = D::createInteger(ti);
+                D         result   = SENTINEL;
+                bsl::ostringstream errors(&ta);
+
+                bslma::TestAllocatorMonitor dam(&da);
+
+                int rc = Util::decodeInArena(&result, &arena, &errors, JSON);
+
+                ASSERTV(LINE, dam.isTotalSame());
+
+                ASSERTV(LINE, rc, IS_VALID == (0 == rc));
+                if (0 == rc) {
+                    ASSERTV(LINE, *expected, result, *expected == result);
+                    ASSERTV(LINE, errors.str(), errors.str().empty());
+                }
+                else {
+                    ASSERTV(LINE, result, SENTINEL == result);
+                    ASSERTV(LINE, !errors.str().empty());
+                }
+
+                arena.release();
+            }
+        }
+
+        if (verbose) cout << "\nStrings refer to the input." << endl;
+        {
+            bdlma::SequentialAllocator arena(&ta);
+
+            const bsl::string JSON(
+                      "{\"plain\":\"borrowed value\","
+                      "\"esc\\taped\":\"copied\\nvalue\","
+                      "\"list\":[\"x\",\"y\\u0041\"]}",
+                      &ta);
+
+            const char *BEGIN = JSON.data();
+            const char *END   = JSON.data() + JSON.length();
+
+            D   result;
+            int rc = Util::decodeInArena(&result, &arena, JSON);
+            ASSERTV(rc, 0 == rc);
+            ASSERT(result.isMap());
+
+            const DMR map = result.theMap();
+            ASSERTV(map.size(), 3 == map.size());
+
+            ASSERT("plain"          == map[0].key());
+            ASSERT("borrowed value" == map[0].value().theString());
+            ASSERT(BEGIN <= map[0].key().data() && map[0].key().data() < END);
+            ASSERT(BEGIN <= map[0].value().theString().data() &&
+                   map[0].value().theString().data() < END);
+
+            ASSERT("esc\taped"      == map[1].key());
+            ASSERT("copied\nvalue"  == map[1].value().theString());
+            ASSERT(!(BEGIN <= map[1].key().data() &&
+                     map[1].key().data() < END));
+            ASSERT(!(BEGIN <= map[1].value().theString().data() &&
+                     map[1].value().theString().data() < END));
+
+            const DAR list = map[2].value().theArray();
+            ASSERTV(list.length(), 2 == list.length());
+            ASSERT("x"  == list[0].theString());
+            ASSERT("yA" == list[1].theString());
+        }
+
+        if (verbose) cout << "\nDuplicate keys." << endl;
+        {
+            for (int numMembers = 4; numMembers <= 64; numMembers *= 4) {
+                bsl::string json("{", &ta);
+                for (int i = 0; i < numMembers; ++i) {
+                    // Keys repeat every 'numMembers / 2' members; the values
+                    // identify the occurrence.
+
+                    if (i) {
+                        json += ',';
+                    }
+                    json += "\"k";
+                    json += bsl::to_string(i % (numMembers / 2));
+                    json += "\":";
+                    json += bsl::to_string(i);
+                }
+                json += '}';
+
+                bdlma::SequentialAllocator arena(&ta);
+
+                MD  expected(&ta);
+                int expectedRc = Util::decode(&expected, json);
+                ASSERTV(numMembers, expectedRc, 0 == expectedRc);
+
+                D   result;
+                int rc = Util::decodeInArena(&result, &arena, json);
+                ASSERTV(numMembers, rc, 0 == rc);
+                ASSERTV(numMembers, *expected == result);
+                ASSERTV(numMembers,
+                        result.theMap().size(),
+                        static_cast<bsl::size_t>(numMembers / 2) ==
+                                                     result.theMap().size());
+            }
+        }
+
+        if (verbose) cout << "\nNesting depth." << endl;
+        {
+            const char *INPUTS[] = { DEEP_JSON_ARRAY,
+                                     DEEP_JSON_OBJECT,
+                                     DEEP_JSON_AOA };
+
+            for (int i = 0; i < 3; ++i) {
+                for (int depth = 90; depth <= 100; ++depth) {
+                    baljsn::DatumDecoderOptions options;
+                    options.setMaxNestedDepth(depth);
+
+                    bdlma::SequentialAllocator arena(&ta);
+
+                    MD  expected(&ta);
+                    int expectedRc = Util::decode(&expected,
+                                                  INPUTS[i],
+                                                  options);
+
+                    D   result;
+                    int rc = Util::decodeInArena(&result,
+                                                 &arena,
+                                                 INPUTS[i],
+                                                 options);
+
+                    ASSERTV(i, depth, rc, expectedRc,
+                            (0 == rc) == (0 == expectedRc));
+                    if (0 == rc && 0 == expectedRc) {
+                        ASSERTV(i, depth, *expected == result);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nLarge input uses only the arena." << endl;
+        {
+            bsl::string json("[", &ta);
+            for (int i = 0; i < 10000; ++i) {
+                json += i ? ",{\"n\":" : "{\"n\":";
+                json += bsl::to_string(i);
+                json += ",\"s\":\"value\"}";
+            }
+            json += ']';
+
+            bdlma::SequentialAllocator arena(&ta);
+
+            bslma::TestAllocatorMonitor dam(&da);
+
+            D   result;
+            int rc = Util::decodeInArena(&result, &arena, json);
+
+            ASSERT(dam.isTotalSame());
+            ASSERTV(rc, 0 == rc);
+            ASSERTV(result.theArray().length(),
+                    10000 == result.theArray().length());
+            ASSERT(9999 ==
+                result.theArray()[9999].theMap().find("n")->theDouble());
+
+            MD expected(&ta);
+            ASSERT(0 == Util::decode(&expected, json));
+            ASSERT(*expected == result);
+
+            arena.release();
+        }
       } break;
       case 8: {
         // --------------------------------------------------------------------
@@ -3995,6 +4336,65 @@ int main(int argc, char *argv[])
         testCase01<std::pmr::string>();
 #endif
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: DECODE VS. DECODE IN ARENA
+        //
+        // Concerns:
+        //: 1 'decodeInArena' is faster than 'decode' for typical messages.
+        //
+        // Plan:
+        //: 1 Repeatedly decode a representative message with 'decode' and
+        //:   with 'decodeInArena' (releasing the arena after each message),
+        //:   and report the throughput of each.
+        //
+        // Testing:
+        //   PERFORMANCE: DECODE VS. DECODE IN ARENA
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE: DECODE VS. DECODE IN ARENA"
+                          << "\n=======================================\n";
+
+        const char *JSON =
+            "{\"id\":\"ORD-000123456\",\"symbol\":\"IBM\",\"side\":\"Buy\","
+            "\"quantity\":300,\"price\":134.25,\"account\":\"ACCT-42\","
+            "\"tags\":[\"algo\",\"dma\",\"post-only\"],"
+            "\"fills\":[{\"qty\":100,\"px\":134.2,\"venue\":\"XNYS\"},"
+                      "{\"qty\":200,\"px\":134.25,\"venue\":\"ARCX\"}],"
+            "\"note\":\"line one\\nline two\",\"active\":true,"
+            "\"parent\":null}";
+
+        const int NUM_ITERATIONS = 100000;
+
+        bslma::Allocator *allocator = bslma::NewDeleteAllocator::allocator(0);
+
+        bsls::Stopwatch timer;
+
+        timer.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            MD result(allocator);
+            Util::decode(&result, JSON);
+        }
+        timer.stop();
+        const double DECODE = timer.accumulatedWallTime();
+
+        bdlma::SequentialAllocator arena(allocator);
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            D result;
+            Util::decodeInArena(&result, &arena, JSON);
+            arena.rewind();
+        }
+        timer.stop();
+        const double ARENA = timer.accumulatedWallTime();
+
+        cout << "decode:        " << NUM_ITERATIONS / DECODE / 1e6
+             << " messages/us\n"
+             << "decodeInArena: " << NUM_ITERATIONS / ARENA / 1e6
+             << " messages/us\n";
+      } break;
       default: {
         cerr << "WARNING: CASE '" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -151,6 +151,7 @@ BSLS_IDENT("$Id: $")
 #include <bdlat_customizedtypefunctions.h>
 #include <bdlat_enumfunctions.h>
 #include <bdlat_formattingmode.h>
+#include <bdlat_nameindex.h>
 #include <bdlat_selectioninfo.h>
 #include <bdlat_sequencefunctions.h>
 #include <bdlat_typecategory.h>
@@ -406,13 +407,13 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
         // This is an anonymous element.  Do not read anything and instead
         // decode into the corresponding sub-element.
 
-        if (bdlat_SequenceFunctions::hasAttribute(
+        if (bdlat::NameIndexUtil::hasAttribute(
                                    *value,
                                    d_elementName.data(),
                                    static_cast<int>(d_elementName.length()))) {
             Decoder_ElementVisitor visitor = { this, mode };
 
-            if (0 != bdlat_SequenceFunctions::manipulateAttribute(
+            if (0 != bdlat::NameIndexUtil::manipulateAttribute(
                                    value,
                                    visitor,
                                    d_elementName.data(),
@@ -466,7 +467,7 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
                 return -1;                                            // RETURN
             }
 
-            if (bdlat_SequenceFunctions::hasAttribute(
+            if (bdlat::NameIndexUtil::hasAttribute(
                                      *value,
                                      elementName.data(),
                                      static_cast<int>(elementName.length()))) {
@@ -481,7 +482,7 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
 
                 Decoder_ElementVisitor visitor = { this, mode };
 
-                if (0 != bdlat_SequenceFunctions::manipulateAttribute(
+                if (0 != bdlat::NameIndexUtil::manipulateAttribute(
                                    value,
                                    visitor,
                                    d_elementName.data(),
@@ -708,7 +709,8 @@ int Decoder::decodeImp(TYPE *value,
         return -1;                                                    // RETURN
     }
 
-    rc = bdlat_EnumFunctions::fromString(value,
+    rc = bdlat::NameIndexUtil::fromString(
+                                         value,
                                          tmpString.data(),
                                          static_cast<int>(tmpString.size()));
 
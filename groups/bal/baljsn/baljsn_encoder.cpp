@@ -14,23 +14,20 @@ namespace baljsn {
                         // -----------------------------
 
 // CLASS METHODS
-int Encoder_EncodeImplUtil::encodeCharArray(
-                                      Formatter                *formatter,
-                                      const bsl::vector<char>& value,
-                                      const EncoderOptions&    encoderOptions)
+int Encoder_EncodeImplUtil::encodeBase64(bsl::string              *base64String,
+                                         const bsl::vector<char>&  value)
 {
-    bsl::string base64String;
     bdlde::Base64Encoder encoder(0);
-    base64String.resize(
+    base64String->resize(
        bdlde::Base64Encoder::encodedLength(static_cast<int>(value.size()), 0));
 
     // Ensure length is a multiple of 4.
 
-    BSLS_ASSERT(0 == (base64String.length() & 0x03));
+    BSLS_ASSERT(0 == (base64String->length() & 0x03));
 
     int numOut;
     int numIn;
-    int rc = encoder.convert(base64String.begin(),
+    int rc = encoder.convert(base64String->begin(),
                              &numOut,
                              &numIn,
                              value.begin(),
@@ -40,44 +37,11 @@ int Encoder_EncodeImplUtil::encodeCharArray(
         return rc;                                                    // RETURN
     }
 
-    rc = encoder.endConvert(base64String.begin() + numOut);
+    rc = encoder.endConvert(base64String->begin() + numOut);
     if (rc < 0) {
         return rc;                                                    // RETURN
     }
 
-    return encodeSimpleValue(formatter,
-                  base64String,
-                  encoderOptions);
-}
-
-                               // Member Encoding
-
-int Encoder_EncodeImplUtil::encodeMember(
-                                     bool                      *memberIsEmpty,
-                                     Formatter                 *formatter,
-                                     bsl::ostream              *logStream,
-                                     const bsl::string_view&    memberName,
-                                     const bsl::vector<char>&   member,
-                                     FormattingMode             formattingMode,
-                                     const EncoderOptions&      options,
-                                     bool                       isFirstMember,
-                                     bdlat_TypeCategory::Array)
-{
-    int rc = ThisUtil::encodeMemberPrefix(
-        formatter, logStream, memberName, formattingMode, isFirstMember);
-    if (0 != rc) {
-        return rc;                                                    // RETURN
-    }
-
-    rc = ThisUtil::encodeCharArray(formatter, member, options);
-    if (0 != rc) {
-        (*logStream) << "Unable to encode value of element "
-                     << "named: '" << memberName << "'."
-                     << bsl::endl;
-        return rc;                                                    // RETURN
-    }
-
-    *memberIsEmpty = false;
     return 0;
 }
 
@@ -15,11 +15,21 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component provides a class, 'baljsn::Encoder', for
 // encoding value-semantic objects in the JSON format.  In particular, the
 // 'class' contains a parameterized 'encode' function that encodes an object
-// into a specified stream.  There are two overloaded versions of this
+// into a specified destination.  There are four overloaded versions of this
 // function:
 //
 //: o one that writes to a 'bsl::streambuf'
 //: o one that writes to an 'bsl::ostream'
+//: o one that appends to a 'bsl::string'
+//: o one that appends to a 'bdlbb::Blob'
+//
+// The versions writing to a 'bsl::string' or a 'bdlbb::Blob' format the
+// document with a 'baljsn::BufferFormatter', which appends directly to a flat
+// buffer instead of going through a stream for every token, and are
+// considerably faster.  They produce exactly the same text as the stream-based
+// versions for every setting of 'baljsn::EncoderOptions'.  The 'bdlbb::Blob'
+// version formats into a buffer owned by the encoder, which is reused by
+// subsequent calls, and then appends it to the blob.
 //
 // This component can be used with types that support the 'bdlat' framework
 // (see the 'bdlat' package for details), which is a compile-time interface for
@@ -132,6 +142,7 @@ BSLS_IDENT("$Id: $")
 
 #include <balscm_version.h>
 
+#include <baljsn_bufferformatter.h>
 #include <baljsn_encoderoptions.h>
 #include <baljsn_formatter.h>
 #include <baljsn_printutil.h>
@@ -147,6 +158,9 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlb_print.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+
 #include <bdlsb_memoutstreambuf.h>
 
 #include <bsls_assert.h>
@@ -180,6 +194,9 @@ class Encoder {
     // DATA
     bsl::ostringstream d_logStream;  // stream used for logging
 
+    bsl::string        d_buffer;     // buffer reused when encoding to a
+                                     // 'bdlbb::Blob'
+
     // NOT IMPLEMENTED
     Encoder(const Encoder&);
 
@@ -187,6 +204,13 @@ class Encoder {
     bsl::ostream& logStream();
         // Return the stream for logging.
 
+    template <class TYPE>
+    int startEncoding(const TYPE& value);
+        // Reset the log, and return 0 if the specified 'value' is of a
+        // sequence, choice, or array type (the types that may be encoded as a
+        // JSON document), and log an error and return a non-zero value
+        // otherwise.
+
   public:
     // CREATORS
     explicit Encoder(bslma::Allocator *basicAllocator = 0);
@@ -231,6 +255,41 @@ class Encoder {
         // type, or a 'bdlat'-compatible dynamic type referring to one of those
         // types.  Return 0 on success, and a non-zero value otherwise.
 
+    template <class TYPE>
+    int encode(bsl::string           *output,
+               const TYPE&            value,
+               const EncoderOptions&  options);
+    template <class TYPE>
+    int encode(bsl::string           *output,
+               const TYPE&            value,
+               const EncoderOptions  *options);
+        // Append the encoding of the specified 'value', of (template
+        // parameter) 'TYPE', in the JSON format using the specified 'options'
+        // to the specified 'output' string.  Specifying a nullptr 'options' is
+        // equivalent to passing a default-constructed EncoderOptions in
+        // 'options'.  'TYPE' shall be a 'bdlat'-compatible sequence, choice,
+        // or array type, or a 'bdlat'-compatible dynamic type referring to one
+        // of those types.  Return 0 on success, and a non-zero value
+        // otherwise.  If the encoding fails, 'output' is restored to its value
+        // before the call.
+
+    template <class TYPE>
+    int encode(bdlbb::Blob           *output,
+               const TYPE&            value,
+               const EncoderOptions&  options);
+    template <class TYPE>
+    int encode(bdlbb::Blob           *output,
+               const TYPE&            value,
+               const EncoderOptions  *options);
+        // Append the encoding of the specified 'value', of (template
+        // parameter) 'TYPE', in the JSON format using the specified 'options'
+        // to the specified 'output' blob.  Specifying a nullptr 'options' is
+        // equivalent to passing a default-constructed EncoderOptions in
+        // 'options'.  'TYPE' shall be a 'bdlat'-compatible sequence, choice,
+        // or array type, or a 'bdlat'-compatible dynamic type referring to one
+        // of those types.  Return 0 on success, and a non-zero value
+        // otherwise.  If the encoding fails, 'output' is not modified.
+
     template <class TYPE>
     int encode(bsl::streambuf *streamBuf, const TYPE& value);
         // Encode the specified 'value' of (template parameter) 'TYPE' into the
@@ -289,6 +348,12 @@ struct Encoder_EncodeImplUtil {
         // {'baljsn_encoderoptions'} for a description of the effects, if any,
         // of each option in the 'options' on the start of a JSON document.
 
+    static void openDocument(bsl::string           *outputBuffer,
+                             const EncoderOptions&  options);
+        // Append the sequence of characters that designate the start of a
+        // JSON document to the specified 'outputBuffer' according to the
+        // specified encoding 'options'.
+
     static void closeDocument(bsl::ostream          *outputStream,
                               const EncoderOptions&  options);
         // Print the sequence of characters that designate the end of a JSON
@@ -297,6 +362,12 @@ struct Encoder_EncodeImplUtil {
         // {'baljsn_encoderoptions'} for a description of the effects, if any,
         // of each option in the 'options' on the end of a JSON document.
 
+    static void closeDocument(bsl::string           *outputBuffer,
+                              const EncoderOptions&  options);
+        // Append the sequence of characters that designate the end of a JSON
+        // document to the specified 'outputBuffer' according to the specified
+        // encoding 'options'.
+
                                // Value Encoding
 
     template <class TYPE>
@@ -338,8 +409,26 @@ struct Encoder_EncodeImplUtil {
         // introduction to the requirements of 'bdlat' type-category concepts.
 
     template <class TYPE>
+    static int encode(
+                     bsl::ostream          *logStream,
+                     bsl::string           *jsonBuffer,
+                     const TYPE&            value,
+                     const EncoderOptions&  options = EncoderOptions());
+        // Append the JSON representation of the specified 'value' to the
+        // specified 'jsonBuffer', using a 'BufferFormatter'.  If this
+        // operation is not successful, load an unspecified, human-readable
+        // description of the error condition to the specified 'logStream'.
+        // Optionally specify 'options' to configure aspects of the JSON
+        // representation of the 'value'.  If 'options' is not specified, the
+        // default 'EncoderOptions' value is used.  Return 0 on success, and a
+        // non-zero value otherwise.  The text appended on success is identical
+        // to that written by the overload taking a 'jsonStream'.  The behavior
+        // is undefined unless the specified 'TYPE' satisfies both the static
+        // and dynamic requirements of one 'bdlat' type-category concept.
+
+    template <class FORMATTER, class TYPE>
     static int encode(bool                  *valueIsEmpty,
-                      Formatter             *formatter,
+                      FORMATTER             *formatter,
                       bsl::ostream          *logStream,
                       const TYPE&            value,
                       FormattingMode         formattingMode,
@@ -400,7 +489,14 @@ struct Encoder_EncodeImplUtil {
 
              // Encoding Values That Have Specific Type Categories
 
-    static int encodeCharArray(Formatter                *formatter,
+    static int encodeBase64(bsl::string              *base64String,
+                            const bsl::vector<char>&  value);
+        // Load into the specified 'base64String' the base64 encoding of the
+        // specified 'value'.  Return 0 on success, and a non-zero value
+        // otherwise.
+
+    template <class FORMATTER>
+    static int encodeCharArray(FORMATTER                *formatter,
                                const bsl::vector<char>&  value,
                                const EncoderOptions&     options);
         // Encode the JSON representation of the specified 'value' to the
@@ -408,8 +504,8 @@ struct Encoder_EncodeImplUtil {
         // configure aspects of the JSON representation of the 'value'.  Return
         // 0 on success, and a non-zero value otherwise.
 
-    template <class TYPE>
-    static int encodeSimpleValue(Formatter             *formatter,
+    template <class FORMATTER, class TYPE>
+    static int encodeSimpleValue(FORMATTER             *formatter,
                                  const TYPE&            value,
                                  const EncoderOptions&  options);
         // Encode the JSON representation of the specified 'value' to the
@@ -426,8 +522,9 @@ struct Encoder_EncodeImplUtil {
 
                        // Encoding Prefixes and Suffixes
 
+    template <class FORMATTER>
     static void encodeObjectPrefix(bool           *prefixIsEmpty,
-                                   Formatter      *formatter,
+                                   FORMATTER      *formatter,
                                    FormattingMode  formattingMode);
         // If the specified 'formattingMode' does not have the
         // 'bdlat_FormattingMode::e_UNTAGGED' bit set, encode a "left brace"
@@ -436,8 +533,9 @@ struct Encoder_EncodeImplUtil {
         // formatter, load the value 'false' to the specified 'prefixIsEmpty',
         // and the value 'true' otherwise.
 
+    template <class FORMATTER>
     static void encodeObjectSuffix(bool           *suffixIsEmpty,
-                                   Formatter      *formatter,
+                                   FORMATTER      *formatter,
                                    FormattingMode  formattingMode);
         // If the specified 'formattingMode' does not have the
         // 'bdlat_FormattingMode::e_UNTAGGED' bit set, encode a "right brace"
@@ -448,12 +546,13 @@ struct Encoder_EncodeImplUtil {
 
                   // Encoding Arrays That Have Specific Shapes
 
-    static void encodeEmptyArray(Formatter *formatter);
+    template <class FORMATTER>
+    static void encodeEmptyArray(FORMATTER *formatter);
         // Encode the representation of the empty-array JSON value to the
         // specified 'formatter'.
 
-    template <class TYPE>
-    static int encodeNonEmptyArray(Formatter             *formatter,
+    template <class FORMATTER, class TYPE>
+    static int encodeNonEmptyArray(FORMATTER             *formatter,
                                    bsl::ostream          *logStream,
                                    const TYPE&            value,
                                    const EncoderOptions&  options);
@@ -474,8 +573,9 @@ struct Encoder_EncodeImplUtil {
 
                         // Encoding Generalized Members
 
+    template <class FORMATTER>
     static int encodeMember(bool                      *memberIsEmpty,
-                            Formatter                 *formatter,
+                            FORMATTER                 *formatter,
                             bsl::ostream              *logStream,
                             const bsl::string_view&    memberName,
                             const bsl::vector<char>&   member,
@@ -483,9 +583,9 @@ struct Encoder_EncodeImplUtil {
                             const EncoderOptions&      options,
                             bool                       isFirstMember,
                             bdlat_TypeCategory::Array  category);
-    template <class TYPE>
+    template <class FORMATTER, class TYPE>
     static int encodeMember(bool                      *memberIsEmpty,
-                            Formatter                 *formatter,
+                            FORMATTER                 *formatter,
                             bsl::ostream              *logStream,
                             const bsl::string_view&    memberName,
                             const TYPE&                member,
@@ -493,9 +593,9 @@ struct Encoder_EncodeImplUtil {
                             const EncoderOptions&      options,
                             bool                       isFirstMember,
                             bdlat_TypeCategory::Array  category);
-    template <class TYPE, class OTHER_CATEGORY>
+    template <class FORMATTER, class TYPE, class OTHER_CATEGORY>
     static int encodeMember(bool                     *memberIsEmpty,
-                            Formatter                *formatter,
+                            FORMATTER                *formatter,
                             bsl::ostream             *logStream,
                             const bsl::string_view&   memberName,
                             const TYPE&               member,
@@ -524,17 +624,20 @@ struct Encoder_EncodeImplUtil {
         // an introduction to the requirements of 'bdlat' type-category
         // concepts.
 
-    static int encodeMemberPrefix(Formatter                *formatter,
+    template <class FORMATTER>
+    static int encodeMemberPrefix(FORMATTER                *formatter,
                                   bsl::ostream             *logStream,
                                   const bsl::string_view&   memberName,
                                   bool                      isFirstMember);
-    static int encodeMemberPrefix(Formatter                *formatter,
+    template <class FORMATTER>
+    static int encodeMemberPrefix(FORMATTER                *formatter,
                                   bsl::ostream             *logStream,
                                   const bsl::string_view&   memberName,
                                   FormattingMode            formattingMode,
                                   bool                      isFirstMember);
+    template <class FORMATTER>
     static int encodeMemberPrefix(bool                     *prefixIsEmpty,
-                                  Formatter                *formatter,
+                                  FORMATTER                *formatter,
                                   bsl::ostream             *logStream,
                                   const bsl::string_view&   memberName,
                                   FormattingMode            formattingMode,
@@ -557,6 +660,7 @@ struct Encoder_EncodeImplUtil {
                          // struct Encoder_ValueVisitor
                          // ===========================
 
+template <class FORMATTER>
 class Encoder_ValueVisitor {
     // this component-private class provides a function object used to encode
     // values that satisfy one of the 'bdlat' type-category concepts.
@@ -589,7 +693,7 @@ class Encoder_ValueVisitor {
         // 'true' after invocation if the empty string represents the encoded
         // value
 
-    Formatter            *d_formatter_p;
+    FORMATTER            *d_formatter_p;
         // wrapper around the output stream that determines the whitespace to
         // emit around each JSON token
 
@@ -611,7 +715,7 @@ class Encoder_ValueVisitor {
 
   public:
     // CREATORS
-    Encoder_ValueVisitor(Formatter             *formatter,
+    Encoder_ValueVisitor(FORMATTER             *formatter,
                          bsl::ostream          *logStream,
                          FormattingMode         formattingMode,
                          const EncoderOptions&  options,
@@ -655,6 +759,7 @@ class Encoder_ValueVisitor {
                        // struct Encoder_ValueDispatcher
                        // ==============================
 
+template <class FORMATTER>
 class Encoder_ValueDispatcher {
     // this component-private class provides a function object used to encode
     // values that satisfy one of the 'bdlat' type-category concepts.
@@ -687,7 +792,7 @@ class Encoder_ValueDispatcher {
         // 'true' after invocation if the empty string represents the encoded
         // value
 
-    Formatter            *d_formatter_p;
+    FORMATTER            *d_formatter_p;
         // wrapper around the output stream that determines the whitespace to
         // emit around each JSON token
 
@@ -709,7 +814,7 @@ class Encoder_ValueDispatcher {
 
   public:
     // CREATORS
-    Encoder_ValueDispatcher(Formatter             *formatter,
+    Encoder_ValueDispatcher(FORMATTER             *formatter,
                             bsl::ostream          *logStream,
                             FormattingMode         formattingMode,
                             const EncoderOptions&  options,
@@ -879,6 +984,7 @@ class Encoder_ValueDispatcher {
                        // class Encoder_SelectionVisitor
                        // ==============================
 
+template <class FORMATTER>
 class Encoder_SelectionVisitor {
     // This component-private class provides a function object used to encode
     // 'bdlat' choice selection values.
@@ -902,7 +1008,7 @@ class Encoder_SelectionVisitor {
         // 'true' after invocation if the empty string represents the encoded
         // value
 
-    Formatter            *d_formatter_p;
+    FORMATTER            *d_formatter_p;
         // wrapper around the output stream that determines the whitespace to
         // emit around each JSON token
 
@@ -919,7 +1025,7 @@ class Encoder_SelectionVisitor {
 
   public:
     // CREATORS
-    Encoder_SelectionVisitor(Formatter             *formatter,
+    Encoder_SelectionVisitor(FORMATTER             *formatter,
                              bsl::ostream          *logStream,
                              const EncoderOptions&  options,
                              bool                   isFirstMember);
@@ -961,6 +1067,7 @@ class Encoder_SelectionVisitor {
                       // class Encoder_SelectionDispatcher
                       // =================================
 
+template <class FORMATTER>
 class Encoder_SelectionDispatcher {
     // This component-private class provides a function object that closes over
     // the 'formatter', 'logStream', 'selectionName', 'formattingMode',
@@ -992,7 +1099,7 @@ class Encoder_SelectionDispatcher {
         // 'true' after invocation if the empty string represents the encoded
         // selection
 
-    Formatter            *d_formatter_p;
+    FORMATTER            *d_formatter_p;
         // wrapper around the output stream that determines the whitespace to
         // emit around each JSON token
 
@@ -1018,7 +1125,7 @@ class Encoder_SelectionDispatcher {
 
   public:
     // CREATORS
-    Encoder_SelectionDispatcher(Formatter                *formatter,
+    Encoder_SelectionDispatcher(FORMATTER                *formatter,
                                 bsl::ostream             *logStream,
                                 const bsl::string_view&   selectionName,
                                 FormattingMode            formattingMode,
@@ -1073,6 +1180,7 @@ class Encoder_SelectionDispatcher {
                        // class Encoder_AttributeVisitor
                        // ==============================
 
+template <class FORMATTER>
 class Encoder_AttributeVisitor {
     // This component-private class provides a function object used to encode
     // 'bdlat' sequence attribute values.
@@ -1092,7 +1200,7 @@ class Encoder_AttributeVisitor {
     // 'bdlat_SequenceFunctions::accessAttributes' function.
 
     // DATA
-    Formatter            *d_formatter_p;
+    FORMATTER            *d_formatter_p;
         // wrapper around the output stream that determines the whitespace to
         // emit around each JSON token
 
@@ -1109,7 +1217,7 @@ class Encoder_AttributeVisitor {
 
   public:
     // CREATORS
-    Encoder_AttributeVisitor(Formatter             *formatter,
+    Encoder_AttributeVisitor(FORMATTER             *formatter,
                              bsl::ostream          *logStream,
                              const EncoderOptions&  options,
                              bool                   isFirstMember);
@@ -1153,6 +1261,7 @@ class Encoder_AttributeVisitor {
                       // class Encoder_AttributeDispatcher
                       // =================================
 
+template <class FORMATTER>
 class Encoder_AttributeDispatcher {
     // This component-private class provides a function object that closes over
     // the 'formatter', 'logStream', 'attributeName', 'formattingMode',
@@ -1185,7 +1294,7 @@ class Encoder_AttributeDispatcher {
         // contains no tokens, and 'false' otherwise (if it does contain
         // tokens)
 
-    Formatter            *d_formatter_p;
+    FORMATTER            *d_formatter_p;
         // wrapper around the output stream that determines the whitespace to
         // emit around each JSON token
 
@@ -1211,7 +1320,7 @@ class Encoder_AttributeDispatcher {
 
   public:
     // CREATORS
-    Encoder_AttributeDispatcher(Formatter                *formatter,
+    Encoder_AttributeDispatcher(FORMATTER                *formatter,
                                 bsl::ostream             *logStream,
                                 const bsl::string_view&   attributeName,
                                 FormattingMode            formattingMode,
@@ -1285,10 +1394,31 @@ bsl::ostream& Encoder::logStream()
     return d_logStream;
 }
 
+template <class TYPE>
+int Encoder::startEncoding(const TYPE& value)
+{
+    d_logStream.clear();
+    d_logStream.str("");
+
+    bdlat_TypeCategory::Value category =
+                                    bdlat_TypeCategoryFunctions::select(value);
+    if (bdlat_TypeCategory::e_SEQUENCE_CATEGORY != category
+     && bdlat_TypeCategory::e_CHOICE_CATEGORY != category
+     && bdlat_TypeCategory::e_ARRAY_CATEGORY != category) {
+        logStream()
+            << "Encoded object must be a Sequence, Choice, or Array type."
+            << bsl::endl;
+        return -1;                                                    // RETURN
+    }
+
+    return 0;
+}
+
 // CREATORS
 inline
 Encoder::Encoder(bslma::Allocator *basicAllocator)
 : d_logStream(basicAllocator)
+, d_buffer(basicAllocator)
 {
 }
 
@@ -1316,17 +1446,7 @@ int Encoder::encode(bsl::streambuf        *streamBuf,
 {
     BSLS_ASSERT(streamBuf);
 
-    d_logStream.clear();
-    d_logStream.str("");
-
-    bdlat_TypeCategory::Value category =
-                                    bdlat_TypeCategoryFunctions::select(value);
-    if (bdlat_TypeCategory::e_SEQUENCE_CATEGORY != category
-     && bdlat_TypeCategory::e_CHOICE_CATEGORY != category
-     && bdlat_TypeCategory::e_ARRAY_CATEGORY != category) {
-        logStream()
-            << "Encoded object must be a Sequence, Choice, or Array type."
-            << bsl::endl;
+    if (0 != startEncoding(value)) {
         return -1;                                                    // RETURN
     }
 
@@ -1394,6 +1514,73 @@ int Encoder::encode(bsl::ostream&         stream,
     return encode(stream, value, options ? *options : localOpts);
 }
 
+template <class TYPE>
+int Encoder::encode(bsl::string           *output,
+                    const TYPE&            value,
+                    const EncoderOptions&  options)
+{
+    BSLS_ASSERT(output);
+
+    if (0 != startEncoding(value)) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::size_t originalLength = output->length();
+
+    Encoder_EncodeImplUtil::openDocument(output, options);
+
+    const int rc = Encoder_EncodeImplUtil::encode(
+        &d_logStream, output, value, options);
+    if (0 != rc) {
+        output->resize(originalLength);
+        return rc;                                                    // RETURN
+    }
+
+    Encoder_EncodeImplUtil::closeDocument(output, options);
+
+    return 0;
+}
+
+template <class TYPE>
+inline
+int Encoder::encode(bsl::string           *output,
+                    const TYPE&            value,
+                    const EncoderOptions  *options)
+{
+    EncoderOptions localOpts;
+    return encode(output, value, options ? *options : localOpts);
+}
+
+template <class TYPE>
+int Encoder::encode(bdlbb::Blob           *output,
+                    const TYPE&            value,
+                    const EncoderOptions&  options)
+{
+    BSLS_ASSERT(output);
+
+    d_buffer.clear();
+
+    const int rc = encode(&d_buffer, value, options);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    bdlbb::BlobUtil::append(output,
+                            d_buffer.data(),
+                            static_cast<int>(d_buffer.length()));
+    return 0;
+}
+
+template <class TYPE>
+inline
+int Encoder::encode(bdlbb::Blob           *output,
+                    const TYPE&            value,
+                    const EncoderOptions  *options)
+{
+    EncoderOptions localOpts;
+    return encode(output, value, options ? *options : localOpts);
+}
+
 // ACCESSORS
 inline
 bsl::string Encoder::loggedMessages() const
@@ -1431,6 +1618,31 @@ void Encoder_EncodeImplUtil::closeDocument(bsl::ostream *outputStream,
     }
 }
 
+inline
+void Encoder_EncodeImplUtil::openDocument(bsl::string           *outputBuffer,
+                                          const EncoderOptions&  options)
+{
+    if (baljsn::EncoderOptions::e_PRETTY == options.encodingStyle()) {
+        const int spacesPerLevel = options.spacesPerLevel() < 0
+                                 ? -options.spacesPerLevel()
+                                 : options.spacesPerLevel();
+        const int numSpaces      = options.initialIndentLevel()
+                                 * spacesPerLevel;
+        if (0 < numSpaces) {
+            outputBuffer->append(static_cast<bsl::size_t>(numSpaces), ' ');
+        }
+    }
+}
+
+inline
+void Encoder_EncodeImplUtil::closeDocument(bsl::string           *outputBuffer,
+                                           const EncoderOptions&  options)
+{
+    if (baljsn::EncoderOptions::e_PRETTY == options.encodingStyle()) {
+        outputBuffer->push_back('\n');
+    }
+}
+
                                // Value Encoding
 
 template <class TYPE>
@@ -1480,19 +1692,52 @@ int Encoder_EncodeImplUtil::encode(bsl::ostream          *logStream,
 }
 
 template <class TYPE>
+int Encoder_EncodeImplUtil::encode(bsl::ostream          *logStream,
+                                   bsl::string           *jsonBuffer,
+                                   const TYPE&            value,
+                                   const EncoderOptions&  options)
+{
+    static const FormattingMode s_MODE = bdlat_FormattingMode::e_DEFAULT;
+    static const bool           s_FIRST_MEMBER_FLAG = false;
+
+    baljsn::BufferFormatter formatter(jsonBuffer,
+                                      baljsn::EncoderOptions::e_PRETTY ==
+                                          options.encodingStyle(),
+                                      options.initialIndentLevel(),
+                                      options.spacesPerLevel());
+
+    bool valueIsEmpty = false;
+
+    int rc = encode(&valueIsEmpty,
+                    &formatter,
+                    logStream,
+                    value,
+                    s_MODE,
+                    options,
+                    s_FIRST_MEMBER_FLAG);
+
+    if (0 != formatter.nestingDepth()) {
+        *logStream << "Encoding failed leaving an unclosed element (rc = "
+                   << rc << ")\n";
+    }
+
+    return rc;
+}
+
+template <class FORMATTER, class TYPE>
 int Encoder_EncodeImplUtil::encode(bool                  *valueIsEmpty,
-                                   Formatter             *formatter,
+                                   FORMATTER             *formatter,
                                    bsl::ostream          *logStream,
                                    const TYPE&            value,
                                    FormattingMode         formattingMode,
                                    const EncoderOptions&  options,
                                    bool                   isFirstMember)
 {
-    Encoder_ValueDispatcher proxy(formatter,
-                                  logStream,
-                                  formattingMode,
-                                  options,
-                                  isFirstMember);
+    Encoder_ValueDispatcher<FORMATTER> proxy(formatter,
+                                             logStream,
+                                             formattingMode,
+                                             options,
+                                             isFirstMember);
 
     int rc = bdlat_TypeCategoryUtil::accessByCategory(value, proxy);
     if (0 != rc) {
@@ -1536,21 +1781,38 @@ int Encoder_EncodeImplUtil::validateChoice(bsl::ostream *logStream,
 
              // Encoding Values That Have Specific Type Categories
 
-template <class TYPE>
+template <class FORMATTER, class TYPE>
 inline
-int Encoder_EncodeImplUtil::encodeSimpleValue(Formatter             *formatter,
+int Encoder_EncodeImplUtil::encodeSimpleValue(FORMATTER             *formatter,
                                               const TYPE&            value,
                                               const EncoderOptions&  options)
 {
     return formatter->putValue(value, &options);
 }
 
+template <class FORMATTER>
+int Encoder_EncodeImplUtil::encodeCharArray(
+                                      FORMATTER                *formatter,
+                                      const bsl::vector<char>&  value,
+                                      const EncoderOptions&     encoderOptions)
+{
+    bsl::string base64String;
+
+    const int rc = encodeBase64(&base64String, value);
+    if (rc < 0) {
+        return rc;                                                    // RETURN
+    }
+
+    return encodeSimpleValue(formatter, base64String, encoderOptions);
+}
+
                     // Encoding Value Prefixes and Suffixes
 
+template <class FORMATTER>
 inline
 void Encoder_EncodeImplUtil::encodeObjectPrefix(
                                                bool           *prefixIsEmpty,
-                                               Formatter      *formatter,
+                                               FORMATTER      *formatter,
                                                FormattingMode  formattingMode)
 {
     if (bdlat_FormattingMode::e_UNTAGGED & formattingMode) {
@@ -1563,9 +1825,10 @@ void Encoder_EncodeImplUtil::encodeObjectPrefix(
     *prefixIsEmpty = false;
 }
 
+template <class FORMATTER>
 inline
 void Encoder_EncodeImplUtil::encodeObjectSuffix(bool           *suffixIsEmpty,
-                                                Formatter      *formatter,
+                                                FORMATTER      *formatter,
                                                 FormattingMode  formattingMode)
 {
     if (bdlat_FormattingMode::e_UNTAGGED & formattingMode) {
@@ -1580,16 +1843,17 @@ void Encoder_EncodeImplUtil::encodeObjectSuffix(bool           *suffixIsEmpty,
 
                   // Encoding Arrays That Have Specific Shapes
 
+template <class FORMATTER>
 inline
-void Encoder_EncodeImplUtil::encodeEmptyArray(Formatter *formatter)
+void Encoder_EncodeImplUtil::encodeEmptyArray(FORMATTER *formatter)
 {
     formatter->openArray(true);
     formatter->closeArray(true);
 }
 
-template <class TYPE>
+template <class FORMATTER, class TYPE>
 int Encoder_EncodeImplUtil::encodeNonEmptyArray(
-                                         Formatter             *formatter,
+                                         FORMATTER             *formatter,
                                          bsl::ostream          *logStream,
                                          const TYPE&            value,
                                          const EncoderOptions&  options)
@@ -1600,11 +1864,11 @@ int Encoder_EncodeImplUtil::encodeNonEmptyArray(
     formatter->openArray();
 
     static const bool s_FIRST_VALUE_IS_FIRST_ELEMENT = true;
-    Encoder_ValueVisitor visitor(formatter,
-                                 logStream,
-                                 bdlat_FormattingMode::e_DEFAULT,
-                                 options,
-                                 s_FIRST_VALUE_IS_FIRST_ELEMENT);
+    Encoder_ValueVisitor<FORMATTER> visitor(formatter,
+                                            logStream,
+                                            bdlat_FormattingMode::e_DEFAULT,
+                                            options,
+                                            s_FIRST_VALUE_IS_FIRST_ELEMENT);
 
     int rc = bdlat_ArrayFunctions::accessElement(value, visitor, 0);
     if (rc) {
@@ -1629,10 +1893,40 @@ int Encoder_EncodeImplUtil::encodeNonEmptyArray(
 
                         // Encoding Generalized Members
 
-template <class TYPE>
+template <class FORMATTER>
+int Encoder_EncodeImplUtil::encodeMember(
+                                     bool                      *memberIsEmpty,
+                                     FORMATTER                 *formatter,
+                                     bsl::ostream              *logStream,
+                                     const bsl::string_view&    memberName,
+                                     const bsl::vector<char>&   member,
+                                     FormattingMode             formattingMode,
+                                     const EncoderOptions&      options,
+                                     bool                       isFirstMember,
+                                     bdlat_TypeCategory::Array)
+{
+    int rc = ThisUtil::encodeMemberPrefix(
+        formatter, logStream, memberName, formattingMode, isFirstMember);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    rc = ThisUtil::encodeCharArray(formatter, member, options);
+    if (0 != rc) {
+        (*logStream) << "Unable to encode value of element "
+                     << "named: '" << memberName << "'."
+                     << bsl::endl;
+        return rc;                                                    // RETURN
+    }
+
+    *memberIsEmpty = false;
+    return 0;
+}
+
+template <class FORMATTER, class TYPE>
 int Encoder_EncodeImplUtil::encodeMember(
                                      bool                      *memberIsEmpty,
-                                     Formatter                 *formatter,
+                                     FORMATTER                 *formatter,
                                      bsl::ostream              *logStream,
                                      const bsl::string_view&    memberName,
                                      const TYPE&                member,
@@ -1679,10 +1973,10 @@ int Encoder_EncodeImplUtil::encodeMember(
     return 0;
 }
 
-template <class TYPE, class OTHER_CATEGORY>
+template <class FORMATTER, class TYPE, class OTHER_CATEGORY>
 int Encoder_EncodeImplUtil::encodeMember(
                                        bool                    *memberIsEmpty,
-                                       Formatter               *formatter,
+                                       FORMATTER               *formatter,
                                        bsl::ostream            *logStream,
                                        const bsl::string_view&  memberName,
                                        const TYPE&              member,
@@ -1731,9 +2025,10 @@ int Encoder_EncodeImplUtil::encodeMember(
     return 0;
 }
 
+template <class FORMATTER>
 inline
 int Encoder_EncodeImplUtil::encodeMemberPrefix(
-                                       Formatter                *formatter,
+                                       FORMATTER                *formatter,
                                        bsl::ostream             *logStream,
                                        const bsl::string_view&   memberName,
                                        bool                      isFirstMember)
@@ -1752,9 +2047,10 @@ int Encoder_EncodeImplUtil::encodeMemberPrefix(
     return 0;
 }
 
+template <class FORMATTER>
 inline
 int Encoder_EncodeImplUtil::encodeMemberPrefix(
-                                       Formatter                *formatter,
+                                       FORMATTER                *formatter,
                                        bsl::ostream             *logStream,
                                        const bsl::string_view&   memberName,
                                        FormattingMode            formattingMode,
@@ -1768,10 +2064,11 @@ int Encoder_EncodeImplUtil::encodeMemberPrefix(
         formatter, logStream, memberName, isFirstMember);
 }
 
+template <class FORMATTER>
 inline
 int Encoder_EncodeImplUtil::encodeMemberPrefix(
                                        bool                    *prefixIsEmpty,
-                                       Formatter               *formatter,
+                                       FORMATTER               *formatter,
                                        bsl::ostream            *logStream,
                                        const bsl::string_view&  memberName,
                                        FormattingMode           formattingMode,
@@ -1797,9 +2094,10 @@ int Encoder_EncodeImplUtil::encodeMemberPrefix(
                         // ---------------------------
 
 // CREATORS
+template <class FORMATTER>
 inline
-Encoder_ValueVisitor::Encoder_ValueVisitor(
-                                         Formatter             *formatter,
+Encoder_ValueVisitor<FORMATTER>::Encoder_ValueVisitor(
+                                         FORMATTER             *formatter,
                                          bsl::ostream          *logStream,
                                          FormattingMode         formattingMode,
                                          const EncoderOptions&  options,
@@ -1814,9 +2112,10 @@ Encoder_ValueVisitor::Encoder_ValueVisitor(
 }
 
 // MANIPULATORS
+template <class FORMATTER>
 template <class TYPE>
 inline
-int Encoder_ValueVisitor::operator()(const TYPE& value)
+int Encoder_ValueVisitor<FORMATTER>::operator()(const TYPE& value)
 {
     return Encoder_EncodeImplUtil::encode(&d_valueIsEmpty,
                                           d_formatter_p,
@@ -1828,8 +2127,9 @@ int Encoder_ValueVisitor::operator()(const TYPE& value)
 }
 
 // ACCESSORS
+template <class FORMATTER>
 inline
-bool Encoder_ValueVisitor::valueIsEmpty() const
+bool Encoder_ValueVisitor<FORMATTER>::valueIsEmpty() const
 {
     return d_valueIsEmpty;
 }
@@ -1839,9 +2139,10 @@ bool Encoder_ValueVisitor::valueIsEmpty() const
                        // ------------------------------
 
 // CREATORS
+template <class FORMATTER>
 inline
-Encoder_ValueDispatcher::Encoder_ValueDispatcher(
-                                         Formatter             *formatter,
+Encoder_ValueDispatcher<FORMATTER>::Encoder_ValueDispatcher(
+                                         FORMATTER             *formatter,
                                          bsl::ostream          *logStream,
                                          FormattingMode         formattingMode,
                                          const EncoderOptions&  options,
@@ -1856,19 +2157,23 @@ Encoder_ValueDispatcher::Encoder_ValueDispatcher(
 }
 
 // MANIPULATORS
+template <class FORMATTER>
 inline
-int Encoder_ValueDispatcher::operator()(const bsl::vector<char>&  value,
-                                        bdlat_TypeCategory::Array)
+int Encoder_ValueDispatcher<FORMATTER>::operator()(
+                                               const bsl::vector<char>&  value,
+                                               bdlat_TypeCategory::Array)
 {
     d_valueIsEmpty = false;
     return Encoder_EncodeImplUtil::encodeCharArray(
         d_formatter_p, value, *d_options_p);
 }
 
+template <class FORMATTER>
 template <class TYPE>
 inline
-int Encoder_ValueDispatcher::operator()(const TYPE&               value,
-                                        bdlat_TypeCategory::Array)
+int Encoder_ValueDispatcher<FORMATTER>::operator()(
+                                               const TYPE&               value,
+                                               bdlat_TypeCategory::Array)
 {
     const bool arrayIsEmpty = (0 == bdlat_ArrayFunctions::size(value));
 
@@ -1893,10 +2198,12 @@ int Encoder_ValueDispatcher::operator()(const TYPE&               value,
     return 0;
 }
 
+template <class FORMATTER>
 template <class TYPE>
 inline
-int Encoder_ValueDispatcher::operator()(const TYPE&                value,
-                                        bdlat_TypeCategory::Choice)
+int Encoder_ValueDispatcher<FORMATTER>::operator()(
+                                              const TYPE&                value,
+                                              bdlat_TypeCategory::Choice)
 {
     int rc = Encoder_EncodeImplUtil::validateChoice(d_logStream_p, value);
     if (0 != rc) {
@@ -1907,10 +2214,11 @@ int Encoder_ValueDispatcher::operator()(const TYPE&                value,
     Encoder_EncodeImplUtil::encodeObjectPrefix(
         &prefixIsEmpty, d_formatter_p, d_formattingMode);
 
-    Encoder_SelectionVisitor visitor(d_formatter_p,
-                                     d_logStream_p,
-                                     *d_options_p,
-                                     !prefixIsEmpty || d_isFirstMember);
+    Encoder_SelectionVisitor<FORMATTER> visitor(
+                                            d_formatter_p,
+                                            d_logStream_p,
+                                            *d_options_p,
+                                            !prefixIsEmpty || d_isFirstMember);
     rc = bdlat_ChoiceFunctions::accessSelection(value, visitor);
     if (0 != rc) {
         return rc;                                                    // RETURN
@@ -1925,9 +2233,10 @@ int Encoder_ValueDispatcher::operator()(const TYPE&                value,
     return 0;
 }
 
+template <class FORMATTER>
 template <class TYPE>
 inline
-int Encoder_ValueDispatcher::operator()(
+int Encoder_ValueDispatcher<FORMATTER>::operator()(
                                       const TYPE&                        value,
                                       bdlat_TypeCategory::CustomizedType)
 {
@@ -1941,10 +2250,12 @@ int Encoder_ValueDispatcher::operator()(
         d_isFirstMember);
 }
 
+template <class FORMATTER>
 template <class TYPE>
 inline
-int Encoder_ValueDispatcher::operator()(const TYPE&                     value,
-                                        bdlat_TypeCategory::Enumeration)
+int Encoder_ValueDispatcher<FORMATTER>::operator()(
+                                         const TYPE&                     value,
+                                         bdlat_TypeCategory::Enumeration)
 {
     bsl::string valueString;
     bdlat_EnumFunctions::toString(&valueString, value);
@@ -1954,9 +2265,10 @@ int Encoder_ValueDispatcher::operator()(const TYPE&                     value,
         d_formatter_p, valueString, *d_options_p);
 }
 
+template <class FORMATTER>
 template <class TYPE>
 inline
-int Encoder_ValueDispatcher::operator()(
+int Encoder_ValueDispatcher<FORMATTER>::operator()(
                                        const TYPE&                       value,
                                        bdlat_TypeCategory::NullableValue)
 {
@@ -1966,11 +2278,11 @@ int Encoder_ValueDispatcher::operator()(
         return 0;                                                     // RETURN
     }
 
-    Encoder_ValueVisitor visitor(d_formatter_p,
-                                 d_logStream_p,
-                                 d_formattingMode,
-                                 *d_options_p,
-                                 d_isFirstMember);
+    Encoder_ValueVisitor<FORMATTER> visitor(d_formatter_p,
+                                            d_logStream_p,
+                                            d_formattingMode,
+                                            *d_options_p,
+                                            d_isFirstMember);
     int rc = bdlat_NullableValueFunctions::accessValue(value, visitor);
     if (0 != rc) {
         return rc;                                                    // RETURN
@@ -1980,19 +2292,22 @@ int Encoder_ValueDispatcher::operator()(
     return 0;
 }
 
+template <class FORMATTER>
 template <class TYPE>
 inline
-int Encoder_ValueDispatcher::operator()(const TYPE&                  value,
-                                        bdlat_TypeCategory::Sequence)
+int Encoder_ValueDispatcher<FORMATTER>::operator()(
+                                            const TYPE&                  value,
+                                            bdlat_TypeCategory::Sequence)
 {
     bool prefixIsEmpty = false;
     Encoder_EncodeImplUtil::encodeObjectPrefix(
         &prefixIsEmpty, d_formatter_p, d_formattingMode);
 
-    Encoder_AttributeVisitor visitor(d_formatter_p,
-                                     d_logStream_p,
-                                     *d_options_p,
-                                     !prefixIsEmpty || d_isFirstMember);
+    Encoder_AttributeVisitor<FORMATTER> visitor(
+                                            d_formatter_p,
+                                            d_logStream_p,
+                                            *d_options_p,
+                                            !prefixIsEmpty || d_isFirstMember);
     int rc = bdlat_SequenceFunctions::accessAttributes(value, visitor);
     if (0 != rc) {
         return rc;                                                    // RETURN
@@ -2007,27 +2322,31 @@ int Encoder_ValueDispatcher::operator()(const TYPE&                  value,
     return 0;
 }
 
+template <class FORMATTER>
 template <class TYPE>
 inline
-int Encoder_ValueDispatcher::operator()(const TYPE&                value,
-                                        bdlat_TypeCategory::Simple)
+int Encoder_ValueDispatcher<FORMATTER>::operator()(
+                                              const TYPE&                value,
+                                              bdlat_TypeCategory::Simple)
 {
     d_valueIsEmpty = false;
     return Encoder_EncodeImplUtil::encodeSimpleValue(
         d_formatter_p, value, *d_options_p);
 }
 
+template <class FORMATTER>
 template <class TYPE>
 inline
-int Encoder_ValueDispatcher::operator()(const TYPE&, bslmf::Nil)
+int Encoder_ValueDispatcher<FORMATTER>::operator()(const TYPE&, bslmf::Nil)
 {
     BSLS_ASSERT_OPT(!"Unreachable");
     return -1;
 }
 
 // ACCESSORS
+template <class FORMATTER>
 inline
-bool Encoder_ValueDispatcher::valueIsEmpty() const
+bool Encoder_ValueDispatcher<FORMATTER>::valueIsEmpty() const
 {
     return d_valueIsEmpty;
 }
@@ -2037,9 +2356,10 @@ bool Encoder_ValueDispatcher::valueIsEmpty() const
                        // ------------------------------
 
 // CREATORS
+template <class FORMATTER>
 inline
-Encoder_SelectionVisitor::Encoder_SelectionVisitor(
-                                         Formatter             *formatter,
+Encoder_SelectionVisitor<FORMATTER>::Encoder_SelectionVisitor(
+                                         FORMATTER             *formatter,
                                          bsl::ostream          *logStream,
                                          const EncoderOptions&  options,
                                          bool                   isFirstMember)
@@ -2052,11 +2372,13 @@ Encoder_SelectionVisitor::Encoder_SelectionVisitor(
 }
 
 // MANIPULATORS
+template <class FORMATTER>
 template <class TYPE, class INFO>
-int Encoder_SelectionVisitor::operator()(const TYPE& selection,
-                                         const INFO& selectionInfo)
+int Encoder_SelectionVisitor<FORMATTER>::operator()(const TYPE& selection,
+                                                    const INFO& selectionInfo)
 {
-    Encoder_SelectionDispatcher dispatcher(d_formatter_p,
+    Encoder_SelectionDispatcher<FORMATTER> dispatcher(
+                                           d_formatter_p,
                                            d_logStream_p,
                                            bsl::string_view(
                                                    selectionInfo.name(),
@@ -2075,8 +2397,9 @@ int Encoder_SelectionVisitor::operator()(const TYPE& selection,
 }
 
 // ACCESSORS
+template <class FORMATTER>
 inline
-bool Encoder_SelectionVisitor::selectionIsEmpty() const
+bool Encoder_SelectionVisitor<FORMATTER>::selectionIsEmpty() const
 {
     return d_selectionIsEmpty;
 }
@@ -2086,9 +2409,10 @@ bool Encoder_SelectionVisitor::selectionIsEmpty() const
                       // ---------------------------------
 
 // CREATORS
+template <class FORMATTER>
 inline
-Encoder_SelectionDispatcher::Encoder_SelectionDispatcher(
-                                      Formatter                *formatter,
+Encoder_SelectionDispatcher<FORMATTER>::Encoder_SelectionDispatcher(
+                                      FORMATTER                *formatter,
                                       bsl::ostream             *logStream,
                                       const bsl::string_view&   selectionName,
                                       FormattingMode            formattingMode,
@@ -2105,16 +2429,18 @@ Encoder_SelectionDispatcher::Encoder_SelectionDispatcher(
 }
 
 // ACCESSORS
+template <class FORMATTER>
 template <class TYPE>
 inline
-int Encoder_SelectionDispatcher::operator()(const TYPE& selection)
+int Encoder_SelectionDispatcher<FORMATTER>::operator()(const TYPE& selection)
 {
     return bdlat_TypeCategoryUtil::accessByCategory(selection, *this);
 }
 
+template <class FORMATTER>
 template <class TYPE>
 inline
-int Encoder_SelectionDispatcher::operator()(
+int Encoder_SelectionDispatcher<FORMATTER>::operator()(
                                   const TYPE&                        selection,
                                   bdlat_TypeCategory::CustomizedType)
 {
@@ -2122,10 +2448,11 @@ int Encoder_SelectionDispatcher::operator()(
         bdlat_CustomizedTypeFunctions::convertToBaseType(selection), *this);
 }
 
+template <class FORMATTER>
 template <class TYPE, class CATEGORY>
 inline
-int Encoder_SelectionDispatcher::operator()(const TYPE& selection,
-                                            CATEGORY    category)
+int Encoder_SelectionDispatcher<FORMATTER>::operator()(const TYPE& selection,
+                                                       CATEGORY    category)
 {
     return Encoder_EncodeImplUtil::encodeMember(&d_selectionIsEmpty,
                                                 d_formatter_p,
@@ -2138,17 +2465,19 @@ int Encoder_SelectionDispatcher::operator()(const TYPE& selection,
                                                 category);
 }
 
+template <class FORMATTER>
 template <class TYPE>
 inline
-int Encoder_SelectionDispatcher::operator()(const TYPE&, bslmf::Nil)
+int Encoder_SelectionDispatcher<FORMATTER>::operator()(const TYPE&, bslmf::Nil)
 {
     BSLS_ASSERT_OPT(!"Reachable");
     return -1;
 }
 
 // ACCESSORS
+template <class FORMATTER>
 inline
-bool Encoder_SelectionDispatcher::selectionIsEmpty() const
+bool Encoder_SelectionDispatcher<FORMATTER>::selectionIsEmpty() const
 {
     return d_selectionIsEmpty;
 }
@@ -2158,9 +2487,10 @@ bool Encoder_SelectionDispatcher::selectionIsEmpty() const
                        // ------------------------------
 
 // CREATORS
+template <class FORMATTER>
 inline
-Encoder_AttributeVisitor::Encoder_AttributeVisitor(
-                                         Formatter             *formatter,
+Encoder_AttributeVisitor<FORMATTER>::Encoder_AttributeVisitor(
+                                         FORMATTER             *formatter,
                                          bsl::ostream          *logStream,
                                          const EncoderOptions&  options,
                                          bool                   isFirstMember)
@@ -2172,11 +2502,13 @@ Encoder_AttributeVisitor::Encoder_AttributeVisitor(
 }
 
 // MANIPULATORS
+template <class FORMATTER>
 template <class TYPE, class INFO>
-int Encoder_AttributeVisitor::operator()(const TYPE& attribute,
-                                         const INFO& attributeInfo)
+int Encoder_AttributeVisitor<FORMATTER>::operator()(const TYPE& attribute,
+                                                    const INFO& attributeInfo)
 {
-    Encoder_AttributeDispatcher dispatcher(d_formatter_p,
+    Encoder_AttributeDispatcher<FORMATTER> dispatcher(
+                                           d_formatter_p,
                                            d_logStream_p,
                                            bsl::string_view(
                                                    attributeInfo.name(),
@@ -2197,8 +2529,9 @@ int Encoder_AttributeVisitor::operator()(const TYPE& attribute,
 }
 
 // ACCESSORS
+template <class FORMATTER>
 inline
-bool Encoder_AttributeVisitor::attributesAreEmpty() const
+bool Encoder_AttributeVisitor<FORMATTER>::attributesAreEmpty() const
 {
     return d_isFirstMember;
 }
@@ -2208,9 +2541,10 @@ bool Encoder_AttributeVisitor::attributesAreEmpty() const
                       // ---------------------------------
 
 // CREATORS
+template <class FORMATTER>
 inline
-Encoder_AttributeDispatcher::Encoder_AttributeDispatcher(
-                                      Formatter                *formatter,
+Encoder_AttributeDispatcher<FORMATTER>::Encoder_AttributeDispatcher(
+                                      FORMATTER                *formatter,
                                       bsl::ostream             *logStream,
                                       const bsl::string_view&   attributeName,
                                       FormattingMode            formattingMode,
@@ -2227,15 +2561,17 @@ Encoder_AttributeDispatcher::Encoder_AttributeDispatcher(
 }
 
 // MANIPULATORS
+template <class FORMATTER>
 template <class TYPE>
 inline
-int Encoder_AttributeDispatcher::operator()(const TYPE& value)
+int Encoder_AttributeDispatcher<FORMATTER>::operator()(const TYPE& value)
 {
     return bdlat_TypeCategoryUtil::accessByCategory(value, *this);
 }
 
+template <class FORMATTER>
 inline
-int Encoder_AttributeDispatcher::operator()(
+int Encoder_AttributeDispatcher<FORMATTER>::operator()(
                                            const bsl::vector<char>&  attribute,
                                            bdlat_TypeCategory::Array category)
 {
@@ -2250,9 +2586,10 @@ int Encoder_AttributeDispatcher::operator()(
                                                 category);
 }
 
+template <class FORMATTER>
 template <class TYPE>
 inline
-int Encoder_AttributeDispatcher::operator()(
+int Encoder_AttributeDispatcher<FORMATTER>::operator()(
                                            const TYPE&               attribute,
                                            bdlat_TypeCategory::Array category)
 {
@@ -2286,9 +2623,10 @@ int Encoder_AttributeDispatcher::operator()(
     return 0;
 }
 
+template <class FORMATTER>
 template <class TYPE>
 inline
-int Encoder_AttributeDispatcher::operator()(
+int Encoder_AttributeDispatcher<FORMATTER>::operator()(
                                   const TYPE&                        attribute,
                                   bdlat_TypeCategory::CustomizedType)
 {
@@ -2296,9 +2634,10 @@ int Encoder_AttributeDispatcher::operator()(
         bdlat_CustomizedTypeFunctions::convertToBaseType(attribute), *this);
 }
 
+template <class FORMATTER>
 template <class TYPE>
 inline
-int Encoder_AttributeDispatcher::operator()(
+int Encoder_AttributeDispatcher<FORMATTER>::operator()(
                                    const TYPE&                       attribute,
                                    bdlat_TypeCategory::NullableValue category)
 {
@@ -2319,10 +2658,11 @@ int Encoder_AttributeDispatcher::operator()(
                                                 category);
 }
 
+template <class FORMATTER>
 template <class TYPE, class CATEGORY>
 inline
-int Encoder_AttributeDispatcher::operator()(const TYPE& attribute,
-                                            CATEGORY    category)
+int Encoder_AttributeDispatcher<FORMATTER>::operator()(const TYPE& attribute,
+                                                       CATEGORY    category)
 {
     return Encoder_EncodeImplUtil::encodeMember(&d_attributeIsEmpty,
                                                 d_formatter_p,
@@ -2335,17 +2675,19 @@ int Encoder_AttributeDispatcher::operator()(const TYPE& attribute,
                                                 category);
 }
 
+template <class FORMATTER>
 template <class TYPE>
 inline
-int Encoder_AttributeDispatcher::operator()(const TYPE&, bslmf::Nil)
+int Encoder_AttributeDispatcher<FORMATTER>::operator()(const TYPE&, bslmf::Nil)
 {
     BSLS_ASSERT_OPT(!"Unreachable");
     return -1;
 }
 
 // ACCESSORS
+template <class FORMATTER>
 inline
-bool Encoder_AttributeDispatcher::attributeIsEmpty() const
+bool Encoder_AttributeDispatcher<FORMATTER>::attributeIsEmpty() const
 {
     return d_attributeIsEmpty;
 }
@@ -17,8 +17,14 @@
 #include <bdlb_printmethods.h>  // for printing vector
 #include <bdlb_chartype.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+
 #include <bdlde_utf8util.h>
 
+#include <bdldfp_decimal.h>
+
 #include <bdlsb_fixedmeminstreambuf.h>
 #include <bdlsb_fixedmemoutstreambuf.h>
 #include <bdlsb_memoutstreambuf.h>
@@ -97,12 +103,16 @@ using bsl::endl;
 // [13] int encode(bsl::ostream& stream, const TYPE& v, options);
 // [13] int encode(bsl::streambuf *streamBuf, const TYPE& v, &options);
 // [13] int encode(bsl::ostream& stream, const TYPE& v, &options);
+// [21] int encode(bsl::string *, const TYPE& v, options);
+// [21] int encode(bsl::string *, const TYPE& v, &options);
+// [21] int encode(bdlbb::Blob *, const TYPE& v, options);
+// [21] int encode(bdlbb::Blob *, const TYPE& v, &options);
 //
 // ACCESSORS
 // [13] bsl::string loggedMessages() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [14] USAGE EXAMPLE
+// [22] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -201,6 +211,19 @@ void testNumber();
     // the specified integral 'TYPE' to a JSON number literal, and that the
     // encoding loses no precision of the original value.
 
+bsl::string blobToString(const bdlbb::Blob& blob);
+    // Return a string holding the data in the specified 'blob'.
+
+template <class TYPE>
+void assertFlatEncodingsAreSame(int                           line,
+                                const TYPE&                   value,
+                                const baljsn::EncoderOptions& options);
+    // Assert that encoding the specified 'value' with the specified 'options'
+    // to a 'bsl::string' and to a 'bdlbb::Blob' yields the same status as
+    // encoding it to a 'bsl::streambuf', and on success the same text, and
+    // that neither the string nor the blob is modified on failure.  Report
+    // the specified 'line' on failure.
+
                              // ==================
                              // struct TestMessage
                              // ==================
@@ -499,7 +522,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 21: {
+      case 22: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -611,6 +634,218 @@ int main(int argc, char *argv[])
     ASSERT(EXP_OUTPUT == os.str());
 //..
       } break;
+      case 21: {
+        // --------------------------------------------------------------------
+        // TESTING ENCODING TO A FLAT BUFFER
+        //   This case tests that the 'encode' overloads writing to a
+        //   'bsl::string' and to a 'bdlbb::Blob' produce exactly the same
+        //   text as the overload writing to a 'bsl::streambuf'.
+        //
+        // Concerns:
+        //: 1 For every setting of every encoder option, encoding to a
+        //:   'bsl::string' or a 'bdlbb::Blob' produces the same status and, on
+        //:   success, the same text as encoding to a 'bsl::streambuf'.
+        //:
+        //: 2 Encoding to a 'bsl::string' appends to its existing contents.
+        //:
+        //: 3 If encoding fails, the 'bsl::string' or 'bdlbb::Blob' supplied
+        //:   is left unchanged.
+        //:
+        //: 4 Strings that need escaping, and strings that are not valid
+        //:   UTF-8, are handled the same way as by the stream-based encoder.
+        //:
+        //: 5 Infinite and NaN floating-point values are handled the same way
+        //:   as by the stream-based encoder.
+        //:
+        //: 6 Encoding to a 'bdlbb::Blob' reuses the encoder's buffer.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, specify a set of encoder
+        //:   options covering every option.  For each row, encode every
+        //:   'FeatureTestMessage' test object to a stream buffer, to a
+        //:   non-empty 'bsl::string', and to a 'bdlbb::Blob', and verify that
+        //:   the results are the same.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 for arrays of strings containing every ASCII
+        //:   character, invalid UTF-8, and for arrays of 'double' and
+        //:   'bdldfp::Decimal64' values including infinities and NaN.  For
+        //:   failing encodings verify that the output string and blob are
+        //:   unchanged.  (C-3..5)
+        //:
+        //: 3 Encode to a 'bdlbb::Blob' twice using a test allocator supplied
+        //:   to the encoder, and verify that the second encoding of the same
+        //:   value allocates no memory from it.  (C-6)
+        //
+        // Testing:
+        //   int encode(bsl::string *, const TYPE& v, options);
+        //   int encode(bsl::string *, const TYPE& v, &options);
+        //   int encode(bdlbb::Blob *, const TYPE& v, options);
+        //   int encode(bdlbb::Blob *, const TYPE& v, &options);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING ENCODING TO A FLAT BUFFER"
+                          << "\n=================================" << endl;
+
+        const baljsn::EncoderOptions::EncodingStyle C =
+                                             baljsn::EncoderOptions::e_COMPACT;
+        const baljsn::EncoderOptions::EncodingStyle P =
+                                              baljsn::EncoderOptions::e_PRETTY;
+
+        static const struct {
+            int                                   d_line;
+            baljsn::EncoderOptions::EncodingStyle d_style;
+            int                                   d_indent;
+            int                                   d_spaces;
+            bool                                  d_emptyArrays;
+            bool                                  d_nullElements;
+            bool                                  d_infNaNAsStrings;
+            int                                   d_fracPrecision;
+            int                                   d_floatPrecision;
+            int                                   d_doublePrecision;
+            bool                                  d_quotedDecimal64;
+        } DATA[] = {
+            //LN STY IND SPC EMPTY  NULL   INFNAN FRAC FLT DBL QUOTED
+            //-- --- --- --- -----  -----  ------ ---- --- --- ------
+            { L_, C,  0,  0, false, false, false,  3,  0,  0, false },
+            { L_, C,  2,  4, true,  true,  true,   6,  0,  0, true  },
+            { L_, C,  0,  0, true,  false, true,   0,  3,  7, false },
+            { L_, P,  0,  0, false, false, false,  3,  0,  0, false },
+            { L_, P,  0,  2, false, true,  false,  3,  0,  0, false },
+            { L_, P,  1,  4, true,  false, true,   6,  0,  0, true  },
+            { L_, P,  3,  1, true,  true,  true,   0,  6, 15, false },
+            { L_, P,  0,  3, false, true,  false,  1,  9, 17, true  },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bsl::vector<s_baltst::FeatureTestMessage> testObjects;
+        u::constructFeatureTestMessage(&testObjects);
+
+        bsl::vector<bsl::string> strings;
+        {
+            bsl::string allAscii;
+            for (int ch = 1; ch < 128; ++ch) {
+                allAscii.push_back(static_cast<char>(ch));
+            }
+            strings.push_back(allAscii);
+            strings.push_back(bsl::string(1, '\0'));
+            strings.push_back("a \"quoted\" string with a / and a \\ in it");
+            strings.push_back("0123456789abcdef0123456789abcde\x7f");
+            strings.push_back("caf\xc3\xa9 \xe2\x82\xac \xf0\x9f\x98\x80 "
+                              "\"x\"");
+            strings.push_back("");
+        }
+        bsl::vector<bsl::string> badStrings(strings);
+        badStrings.push_back("valid prefix, then \xc3 truncated sequence");
+
+        const double INF = bsl::numeric_limits<double>::infinity();
+        const double QNAN = bsl::numeric_limits<double>::quiet_NaN();
+
+        bsl::vector<double> finiteDoubles;
+        finiteDoubles.push_back(0.0);
+        finiteDoubles.push_back(-1.5);
+        finiteDoubles.push_back(1.0 / 3.0);
+        finiteDoubles.push_back(6.02214076e23);
+        finiteDoubles.push_back(bsl::numeric_limits<double>::min());
+        finiteDoubles.push_back(bsl::numeric_limits<double>::max());
+
+        bsl::vector<double> allDoubles(finiteDoubles);
+        allDoubles.push_back(INF);
+        allDoubles.push_back(-INF);
+        allDoubles.push_back(QNAN);
+
+        typedef bdldfp::Decimal64 Dec;
+        bsl::vector<Dec> decimals;
+        decimals.push_back(BDLDFP_DECIMAL_DD(0.0));
+        decimals.push_back(BDLDFP_DECIMAL_DD(-1.25));
+        decimals.push_back(BDLDFP_DECIMAL_DD(1234567890.123456));
+        decimals.push_back(bsl::numeric_limits<Dec>::max());
+        decimals.push_back(bsl::numeric_limits<Dec>::infinity());
+        decimals.push_back(bsl::numeric_limits<Dec>::quiet_NaN());
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DATA[ti].d_line;
+
+            baljsn::EncoderOptions mX;  const baljsn::EncoderOptions& OPT = mX;
+            mX.setEncodingStyle(DATA[ti].d_style);
+            mX.setInitialIndentLevel(DATA[ti].d_indent);
+            mX.setSpacesPerLevel(DATA[ti].d_spaces);
+            mX.setEncodeEmptyArrays(DATA[ti].d_emptyArrays);
+            mX.setEncodeNullElements(DATA[ti].d_nullElements);
+            mX.setEncodeInfAndNaNAsStrings(DATA[ti].d_infNaNAsStrings);
+            mX.setDatetimeFractionalSecondPrecision(DATA[ti].d_fracPrecision);
+            mX.setMaxFloatPrecision(DATA[ti].d_floatPrecision);
+            mX.setMaxDoublePrecision(DATA[ti].d_doublePrecision);
+            mX.setEncodeQuotedDecimal64(DATA[ti].d_quotedDecimal64);
+
+            if (veryVerbose) { T_ P_(LINE) P(OPT) }
+
+            for (bsl::size_t i = 0; i < testObjects.size(); ++i) {
+                u::assertFlatEncodingsAreSame(LINE, testObjects[i], OPT);
+            }
+            u::assertFlatEncodingsAreSame(LINE, strings,       OPT);
+            u::assertFlatEncodingsAreSame(LINE, badStrings,    OPT);
+            u::assertFlatEncodingsAreSame(LINE, finiteDoubles, OPT);
+            u::assertFlatEncodingsAreSame(LINE, allDoubles,    OPT);
+            u::assertFlatEncodingsAreSame(LINE, decimals,      OPT);
+        }
+
+        if (verbose) cout << "\nTesting the 'EncoderOptions *' overloads."
+                          << endl;
+        {
+            const bsl::vector<bsl::string>& X = strings;
+
+            baljsn::Encoder encoder;
+            bsl::string     expected;
+            ASSERT(0 == encoder.encode(&expected,
+                                       X,
+                                       baljsn::EncoderOptions()));
+
+            bsl::string actual;
+            ASSERT(0 == encoder.encode(&actual,
+                                       X,
+                                       (const baljsn::EncoderOptions *)0));
+            ASSERTV(expected, actual, expected == actual);
+
+            bdlbb::PooledBlobBufferFactory factory(7);
+            bdlbb::Blob                    blob(&factory);
+            ASSERT(0 == encoder.encode(&blob,
+                                       X,
+                                       (const baljsn::EncoderOptions *)0));
+            ASSERTV(expected == u::blobToString(blob));
+        }
+
+        if (verbose) cout << "\nTesting rejection of non-aggregate types."
+                          << endl;
+        {
+            baljsn::Encoder encoder;
+            bsl::string     output("unchanged");
+            ASSERT(0 != encoder.encode(&output, 5, baljsn::EncoderOptions()));
+            ASSERTV(output, "unchanged" == output);
+            ASSERT(!encoder.loggedMessages().empty());
+        }
+
+        if (verbose) cout << "\nTesting reuse of the blob buffer." << endl;
+        {
+            bslma::TestAllocator ea("encoder", veryVeryVerbose);
+
+            baljsn::Encoder encoder(&ea);
+
+            bdlbb::PooledBlobBufferFactory factory(256);
+            bdlbb::Blob                    blob(&factory);
+
+            ASSERT(0 == encoder.encode(&blob,
+                                       testObjects[0],
+                                       baljsn::EncoderOptions()));
+
+            const bsls::Types::Int64 numAllocations = ea.numAllocations();
+
+            ASSERT(0 == encoder.encode(&blob,
+                                       testObjects[0],
+                                       baljsn::EncoderOptions()));
+            ASSERTV(numAllocations, ea.numAllocations(),
+                    numAllocations == ea.numAllocations());
+        }
+      } break;
       case 20: {
         // --------------------------------------------------------------------
         // TESTING ENCODING UNSET CHOICE
@@ -4037,6 +4272,61 @@ void testNumber()
     }
 }
 
+bsl::string blobToString(const bdlbb::Blob& blob)
+{
+    bsl::string result;
+    for (int i = 0; i < blob.numDataBuffers(); ++i) {
+        const int length = i == blob.numDataBuffers() - 1
+                         ? blob.lastDataBufferLength()
+                         : blob.buffer(i).size();
+        result.append(blob.buffer(i).data(), length);
+    }
+    return result;
+}
+
+template <class TYPE>
+void assertFlatEncodingsAreSame(int                           line,
+                                const TYPE&                   value,
+                                const baljsn::EncoderOptions& options)
+{
+    baljsn::Encoder encoder;
+
+    bdlsb::MemOutStreamBuf osb;
+    const int              streamRc = encoder.encode(&osb, value, options);
+    const bsl::string      expected(osb.data(), osb.length());
+
+    const bsl::string PREFIX = "prefix";
+
+    bsl::string output(PREFIX);
+    const int   stringRc = encoder.encode(&output, value, options);
+
+    ASSERTV(line, streamRc, stringRc, streamRc == stringRc);
+    if (0 == streamRc) {
+        ASSERTV(line, expected, output, PREFIX + expected == output);
+        if (PREFIX + expected != output) {
+            printStringDifferences(PREFIX + expected, output);
+        }
+    }
+    else {
+        ASSERTV(line, output, PREFIX == output);
+    }
+
+    bdlbb::PooledBlobBufferFactory factory(13);
+    bdlbb::Blob                    blob(&factory);
+    bdlbb::BlobUtil::append(&blob, PREFIX.data(), 6);
+
+    const int blobRc = encoder.encode(&blob, value, options);
+
+    ASSERTV(line, streamRc, blobRc, streamRc == blobRc);
+    const bsl::string blobText = blobToString(blob);
+    if (0 == streamRc) {
+        ASSERTV(line, expected, blobText, PREFIX + expected == blobText);
+    }
+    else {
+        ASSERTV(line, blobText, PREFIX == blobText);
+    }
+}
+
 
                                // ---------------
                                // struct TestUtil
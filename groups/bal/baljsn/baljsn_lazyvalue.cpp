@@ -0,0 +1,508 @@
+// baljsn_lazyvalue.cpp                                               -*-C++-*-
+#include <baljsn_lazyvalue.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(baljsn_lazyvalue_cpp,"$Id$ $CSID$")
+
+#include <bdlb_chartype.h>
+
+#include <bsl_cstring.h>
+#include <bsl_limits.h>
+
+namespace BloombergLP {
+namespace {
+namespace u {
+
+const char *skipWhitespace(const char *begin, const char *end)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' that is not JSON whitespace, or 'end' if there is none.
+{
+    while (begin < end && bdlb::CharType::isSpace(*begin)) {
+        ++begin;
+    }
+    return begin;
+}
+
+const char *skipString(const char *begin, const char *end)
+    // Return the address one past the closing quote of the JSON string whose
+    // opening quote is at the specified 'begin', or 0 if the string is not
+    // terminated before the specified 'end'.
+{
+    const char *cursor = begin + 1;
+    while (true) {
+        const char *quote = static_cast<const char *>(
+                                  bsl::memchr(cursor, '"', end - cursor));
+        if (!quote) {
+            return 0;                                                 // RETURN
+        }
+
+        // The quote is escaped if it is preceded by an odd number of
+        // backslashes.
+
+        const char *backslash = quote;
+        while (backslash > cursor && '\\' == backslash[-1]) {
+            --backslash;
+        }
+        if (0 == (quote - backslash) % 2) {
+            return quote + 1;                                         // RETURN
+        }
+        cursor = quote + 1;
+    }
+}
+
+const char *skipScalar(const char *begin, const char *end)
+    // Return the address one past the last character of the unquoted JSON
+    // value (e.g., a number or 'true') starting at the specified 'begin', that
+    // is, of the first whitespace or structural character, or the specified
+    // 'end'.  Note that the delimiting rules are those of 'baljsn::Tokenizer'.
+{
+    while (begin < end
+        && !bdlb::CharType::isSpace(*begin)
+        && 0 == bsl::memchr("{}[]:,", *begin, 6)) {
+        ++begin;
+    }
+    return begin;
+}
+
+const char *skipAggregate(const char *begin, const char *end)
+    // Return the address one past the bracket matching the opening bracket of
+    // the JSON array or object at the specified 'begin', or 0 if the brackets
+    // are unbalanced or a string is not terminated before the specified
+    // 'end'.  Note that only the nesting depth is tracked: the kinds of the
+    // matching brackets, and the contents of the aggregate, are not checked.
+{
+    bsl::size_t depth  = 1;
+    const char *cursor = begin + 1;
+
+    while (cursor < end) {
+        switch (*cursor) {
+          case '"': {
+            cursor = skipString(cursor, end);
+            if (!cursor) {
+                return 0;                                             // RETURN
+            }
+          } continue;
+          case '[':
+          case '{': {
+            ++depth;
+          } break;
+          case ']':
+          case '}': {
+            if (0 == --depth) {
+                return cursor + 1;                                    // RETURN
+            }
+          } break;
+        }
+        ++cursor;
+    }
+    return 0;
+}
+
+const char *skipValue(const char *begin, const char *end)
+    // Return the address one past the last character of the JSON value
+    // starting at the specified 'begin', or 0 if the value is empty or
+    // malformed (see 'skipAggregate') before the specified 'end'.
+{
+    if (begin >= end) {
+        return 0;                                                     // RETURN
+    }
+
+    switch (*begin) {
+      case '"': {
+        return skipString(begin, end);                                // RETURN
+      }
+      case '[':
+      case '{': {
+        return skipAggregate(begin, end);                             // RETURN
+      }
+    }
+
+    const char *next = skipScalar(begin, end);
+    return next == begin ? 0 : next;
+}
+
+const char *firstChild(const char *begin, const char *end, char open)
+    // Return the address of the first non-whitespace character following the
+    // specified 'open' bracket at the specified 'begin', or 0 if the character
+    // at 'begin' is not 'open' or there is no such character before the
+    // specified 'end'.
+{
+    if (begin >= end || open != *begin) {
+        return 0;                                                     // RETURN
+    }
+    const char *cursor = skipWhitespace(begin + 1, end);
+    return cursor < end ? cursor : 0;
+}
+
+const char *nextSibling(const char *cursor, const char *end, char close)
+    // Return the address of the first non-whitespace character following the
+    // ',' separating the array element or object member ending at the
+    // specified 'cursor' from the next one, 'end' if the specified 'close'
+    // bracket follows the element instead, or 0 if neither follows before the
+    // specified 'end'.
+{
+    cursor = skipWhitespace(cursor, end);
+    if (cursor >= end) {
+        return 0;                                                     // RETURN
+    }
+    if (close == *cursor) {
+        return end;                                                   // RETURN
+    }
+    if (',' != *cursor) {
+        return 0;                                                     // RETURN
+    }
+    cursor = skipWhitespace(cursor + 1, end);
+    return cursor < end ? cursor : 0;
+}
+
+int memberValue(const char       **value,
+                bool              *matches,
+                const char        *cursor,
+                const char        *end,
+                bsl::string_view   key)
+    // Load into the specified 'value' the address of the value of the object
+    // member whose name starts at the specified 'cursor', and load into the
+    // specified 'matches' whether the (unescaped) name equals the specified
+    // 'key'.  Return 0 on success, and a non-zero value if the member is
+    // malformed before the specified 'end'.
+{
+    if ('"' != *cursor) {
+        return -1;                                                    // RETURN
+    }
+
+    const char *nameEnd = skipString(cursor, end);
+    if (!nameEnd) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::string_view name(cursor + 1, nameEnd - cursor - 2);
+    if (!bsl::memchr(name.data(), '\\', name.length())) {
+        *matches = name == key;
+    }
+    else {
+        bdlma::LocalSequentialAllocator<128> bufferAllocator;
+        bsl::string                          unescaped(&bufferAllocator);
+        if (0 != baljsn::ParserUtil::getUnquotedString(&unescaped, name)) {
+            return -1;                                                // RETURN
+        }
+        *matches = unescaped == key;
+    }
+
+    cursor = skipWhitespace(nameEnd, end);
+    if (cursor >= end || ':' != *cursor) {
+        return -1;                                                    // RETURN
+    }
+    cursor = skipWhitespace(cursor + 1, end);
+    if (cursor >= end) {
+        return -1;                                                    // RETURN
+    }
+
+    *value = cursor;
+    return 0;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+namespace baljsn {
+
+                              // ---------------
+                              // class LazyValue
+                              // ---------------
+
+// PRIVATE CREATORS
+LazyValue::LazyValue(const char *begin, const char *end)
+: d_begin_p(u::skipWhitespace(begin, end))
+, d_end_p(end)
+{
+    if (d_begin_p == d_end_p) {
+        d_begin_p = 0;
+        d_end_p   = 0;
+    }
+}
+
+// CREATORS
+LazyValue::LazyValue(const bsl::string_view& json)
+: d_begin_p(0)
+, d_end_p(0)
+{
+    *this = LazyValue(json.data(), json.data() + json.length());
+}
+
+// ACCESSORS
+int LazyValue::findElement(LazyValue *result, bsl::size_t index) const
+{
+    BSLS_ASSERT(result);
+
+    const char *cursor = u::firstChild(d_begin_p, d_end_p, '[');
+    if (!cursor || ']' == *cursor) {
+        return -1;                                                    // RETURN
+    }
+
+    for (; 0 != index; --index) {
+        cursor = u::skipValue(cursor, d_end_p);
+        if (!cursor) {
+            return -1;                                                // RETURN
+        }
+        cursor = u::nextSibling(cursor, d_end_p, ']');
+        if (!cursor || d_end_p == cursor) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    *result = LazyValue(cursor, d_end_p);
+    return 0;
+}
+
+int LazyValue::findMember(LazyValue               *result,
+                          const bsl::string_view&  key) const
+{
+    BSLS_ASSERT(result);
+
+    const char *cursor = u::firstChild(d_begin_p, d_end_p, '{');
+    if (!cursor || '}' == *cursor) {
+        return -1;                                                    // RETURN
+    }
+
+    while (true) {
+        const char *value;
+        bool        matches;
+        if (0 != u::memberValue(&value, &matches, cursor, d_end_p, key)) {
+            return -1;                                                // RETURN
+        }
+
+        if (matches) {
+            *result = LazyValue(value, d_end_p);
+            return 0;                                                 // RETURN
+        }
+
+        cursor = u::skipValue(value, d_end_p);
+        if (!cursor) {
+            return -1;                                                // RETURN
+        }
+        cursor = u::nextSibling(cursor, d_end_p, '}');
+        if (!cursor || d_end_p == cursor) {
+            return -1;                                                // RETURN
+        }
+    }
+}
+
+int LazyValue::findPath(LazyValue               *result,
+                        const bsl::string_view&  pointer) const
+{
+    BSLS_ASSERT(result);
+
+    if (!d_begin_p) {
+        return -1;                                                    // RETURN
+    }
+
+    LazyValue   current(*this);
+    bsl::size_t position = 0;
+
+    bdlma::LocalSequentialAllocator<128> bufferAllocator;
+    bsl::string                          token(&bufferAllocator);
+
+    while (position < pointer.length()) {
+        if ('/' != pointer[position]) {
+            return -1;                                                // RETURN
+        }
+        ++position;
+
+        bsl::size_t tokenEnd = pointer.find('/', position);
+        if (bsl::string_view::npos == tokenEnd) {
+            tokenEnd = pointer.length();
+        }
+        bsl::string_view reference = pointer.substr(position,
+                                                    tokenEnd - position);
+        position = tokenEnd;
+
+        if (bsl::string_view::npos != reference.find('~')) {
+            token.clear();
+            for (bsl::size_t i = 0; i < reference.length(); ++i) {
+                if ('~' != reference[i]) {
+                    token += reference[i];
+                    continue;
+                }
+                if (++i == reference.length()
+                 || ('0' != reference[i] && '1' != reference[i])) {
+                    return -1;                                        // RETURN
+                }
+                token += '0' == reference[i] ? '~' : '/';
+            }
+            reference = token;
+        }
+
+        LazyValue next;
+        switch (current.type()) {
+          case e_OBJECT: {
+            if (0 != current.findMember(&next, reference)) {
+                return -1;                                            // RETURN
+            }
+          } break;
+          case e_ARRAY: {
+            // An index is a non-empty sequence of decimal digits having no
+            // leading zero, and is rejected if it is not representable as a
+            // 'bsl::size_t' (which no array could reach in any case).
+
+            if (reference.empty()
+             || (1 < reference.length() && '0' == reference[0])) {
+                return -1;                                            // RETURN
+            }
+            const bsl::size_t k_MAX_INDEX =
+                         (bsl::numeric_limits<bsl::size_t>::max() - 9) / 10;
+
+            bsl::size_t index = 0;
+            for (bsl::size_t i = 0; i < reference.length(); ++i) {
+                if (!bdlb::CharType::isDigit(reference[i])
+                 || k_MAX_INDEX < index) {
+                    return -1;                                        // RETURN
+                }
+                index = index * 10 + (reference[i] - '0');
+            }
+            if (0 != current.findElement(&next, index)) {
+                return -1;                                            // RETURN
+            }
+          } break;
+          default: {
+            return -1;                                                // RETURN
+          }
+        }
+        current = next;
+    }
+
+    *result = current;
+    return 0;
+}
+
+int LazyValue::getValue(bdld::ManagedDatum         *value,
+                        const DatumDecoderOptions&  options) const
+{
+    BSLS_ASSERT(value);
+
+    bsl::string_view data;
+    if (0 != text(&data)) {
+        return -1;                                                    // RETURN
+    }
+    return DatumUtil::decode(value, data, options);
+}
+
+int LazyValue::getValue(bdld::Datum             *value,
+                        bdlma::ManagedAllocator *arena) const
+{
+    BSLS_ASSERT(value);
+    BSLS_ASSERT(arena);
+
+    bsl::string_view data;
+    if (0 != text(&data)) {
+        return -1;                                                    // RETURN
+    }
+    return DatumUtil::decodeInArena(value, arena, data);
+}
+
+int LazyValue::size(bsl::size_t *result) const
+{
+    BSLS_ASSERT(result);
+
+    const Type kind = type();
+    if (e_ARRAY != kind && e_OBJECT != kind) {
+        return -1;                                                    // RETURN
+    }
+
+    const char  close  = e_ARRAY == kind ? ']' : '}';
+    const char *cursor = u::firstChild(d_begin_p, d_end_p, *d_begin_p);
+    if (!cursor) {
+        return -1;                                                    // RETURN
+    }
+    if (close == *cursor) {
+        *result = 0;
+        return 0;                                                     // RETURN
+    }
+
+    bsl::size_t count = 0;
+    while (true) {
+        if (e_OBJECT == kind) {
+            const char *value;
+            bool        matches;
+            if (0 != u::memberValue(&value, &matches, cursor, d_end_p, "")) {
+                return -1;                                            // RETURN
+            }
+            cursor = value;
+        }
+
+        cursor = u::skipValue(cursor, d_end_p);
+        if (!cursor) {
+            return -1;                                                // RETURN
+        }
+        ++count;
+
+        cursor = u::nextSibling(cursor, d_end_p, close);
+        if (!cursor) {
+            return -1;                                                // RETURN
+        }
+        if (d_end_p == cursor) {
+            break;
+        }
+    }
+
+    *result = count;
+    return 0;
+}
+
+int LazyValue::text(bsl::string_view *result) const
+{
+    BSLS_ASSERT(result);
+
+    const char *valueEnd = u::skipValue(d_begin_p, d_end_p);
+    if (!valueEnd) {
+        return -1;                                                    // RETURN
+    }
+
+    *result = bsl::string_view(d_begin_p, valueEnd - d_begin_p);
+    return 0;
+}
+
+LazyValue::Type LazyValue::type() const
+{
+    if (!d_begin_p) {
+        return e_INVALID;                                             // RETURN
+    }
+
+    switch (*d_begin_p) {
+      case '{': return e_OBJECT;                                      // RETURN
+      case '[': return e_ARRAY;                                       // RETURN
+      case '"': return e_STRING;                                      // RETURN
+      case 't':
+      case 'f': return e_BOOLEAN;                                     // RETURN
+      case 'n': {
+        if (4 <= d_end_p - d_begin_p && 0 == bsl::memcmp(d_begin_p, "null", 4))
+        {
+            return e_NULL;                                            // RETURN
+        }
+        return e_NUMBER;                                              // RETURN
+      }
+      case '}':
+      case ']':
+      case ',':
+      case ':': return e_INVALID;                                     // RETURN
+    }
+    return e_NUMBER;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,569 @@
+// baljsn_lazyvalue.h                                                 -*-C++-*-
+#ifndef INCLUDED_BALJSN_LAZYVALUE
+#define INCLUDED_BALJSN_LAZYVALUE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide on-demand navigation of a JSON document without decoding.
+//
+//@CLASSES:
+// baljsn::LazyValue: reference to a JSON value that is parsed only on demand
+//
+//@SEE_ALSO: baljsn_decoder, baljsn_datumutil, baljsn_parserutil
+//
+//@DESCRIPTION: This component provides a class, 'baljsn::LazyValue', that
+// refers to a value within a JSON document held in contiguous memory, and
+// that supports navigating from that value to a member of an object (by key),
+// to an element of an array (by index), or to a descendant identified by a
+// JSON Pointer (RFC 6901), without decoding the document.  Only once a value
+// of interest has been located is it parsed, on demand, into a 'bdlat'
+// compatible type or a 'bdld::Datum'.
+//
+// Navigation examines only the characters needed to reach the requested value:
+// members and elements that precede it are skipped by matching brackets and
+// string delimiters, without tokenizing or materializing their contents, and
+// nothing following it is examined at all.  Consequently, extracting a few
+// fields from a large message costs a small fraction of decoding the whole
+// message.  'baljsn::LazyValue' does not allocate memory during navigation,
+// and is a cheap, copyable handle (two pointers) into the document.
+//
+///Validation
+///----------
+// Because skipped values are not parsed, a 'baljsn::LazyValue' performs only
+// the validation needed to navigate: skipped arrays and objects are checked
+// for balanced brackets, and skipped strings for a closing quote.  A value is
+// fully validated only when it is parsed by one of the 'getValue' overloads.
+// Navigation functions return a non-zero status if the portion of the
+// document they examine is malformed.  A member of an object that appears
+// more than once is found at its *first* occurrence, as by
+// 'baljsn::DatumUtil::decode'.
+//
+// The characters of the document must remain valid and unmodified for as long
+// as any 'baljsn::LazyValue' referring to them is in use.
+//
+///Parsing Values
+///--------------
+// The 'getValue' member function template loads the referenced value into an
+// object of any type supported by 'baljsn::Decoder':
+//
+//: o Simple types (e.g., 'int', 'double', 'bsl::string', 'bdlt::Date'),
+//:   enumerations, and customized types are parsed directly by
+//:   'baljsn::ParserUtil', with the same rules as 'baljsn::Decoder'.
+//:
+//: o Nullable values are reset if the JSON value is 'null', and otherwise
+//:   parsed as the underlying type.
+//:
+//: o Sequences, choices, and arrays are decoded by a 'baljsn::Decoder'
+//:   reading only the text of the referenced value.
+//
+// Overloads of 'getValue' taking a 'bdld::ManagedDatum', or a 'bdld::Datum'
+// and an arena, decode the referenced value using 'baljsn::DatumUtil'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Extracting a Few Fields from a Large Message
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive JSON messages describing orders, each of which
+// carries a long audit trail that we are not interested in, and that we need
+// only the symbol, the quantity, and the venue of the first fill.
+//
+// First, we obtain the message text (here, a small literal):
+//..
+//  const bsl::string_view message =
+//      "{"
+//          "\"audit\":[{\"user\":\"a\",\"time\":1},"
+//                     "{\"user\":\"b\",\"time\":2}],"
+//          "\"order\":{"
+//              "\"symbol\":\"IBM\","
+//              "\"quantity\":300,"
+//              "\"fills\":[{\"venue\":\"XNYS\",\"qty\":100},"
+//                         "{\"venue\":\"ARCX\",\"qty\":200}]"
+//          "}"
+//      "}";
+//..
+// Then, we create a 'baljsn::LazyValue' referring to the whole document, and
+// navigate to the order, skipping the audit trail without parsing it:
+//..
+//  baljsn::LazyValue document(message);
+//  baljsn::LazyValue order;
+//
+//  int rc = document.findMember(&order, "order");
+//  assert(0 == rc);
+//  assert(baljsn::LazyValue::e_OBJECT == order.type());
+//..
+// Next, we parse the two scalar fields of the order that we need:
+//..
+//  baljsn::LazyValue field;
+//  bsl::string       symbol;
+//  int               quantity;
+//
+//  rc = order.findMember(&field, "symbol");
+//  assert(0 == rc);
+//  rc = field.getValue(&symbol);
+//  assert(0 == rc);
+//  assert("IBM" == symbol);
+//
+//  rc = order.findMember(&field, "quantity");
+//  assert(0 == rc);
+//  rc = field.getValue(&quantity);
+//  assert(0 == rc);
+//  assert(300 == quantity);
+//..
+// Finally, we use a JSON Pointer to reach the venue of the first fill directly
+// from the document:
+//..
+//  bsl::string venue;
+//
+//  rc = document.findPath(&field, "/order/fills/0/venue");
+//  assert(0 == rc);
+//  rc = field.getValue(&venue);
+//  assert(0 == rc);
+//  assert("XNYS" == venue);
+//..
+
+#include <balscm_version.h>
+
+#include <baljsn_datumdecoderoptions.h>
+#include <baljsn_datumutil.h>
+#include <baljsn_decoder.h>
+#include <baljsn_decoderoptions.h>
+#include <baljsn_parserutil.h>
+
+#include <bdlat_customizedtypefunctions.h>
+#include <bdlat_nameindex.h>
+#include <bdlat_nullablevaluefunctions.h>
+#include <bdlat_typecategory.h>
+#include <bdlat_valuetypefunctions.h>
+
+#include <bdld_datum.h>
+#include <bdld_manageddatum.h>
+
+#include <bdlma_localsequentialallocator.h>
+#include <bdlma_managedallocator.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace baljsn {
+
+struct LazyValue_Manipulator;
+
+                              // ===============
+                              // class LazyValue
+                              // ===============
+
+class LazyValue {
+    // This class provides a reference to a value within a JSON document held
+    // in contiguous memory.  The value is located, but not parsed, on
+    // construction or navigation, and is parsed only by 'getValue'.  See
+    // {Validation} for the checks performed on skipped portions of the
+    // document.
+
+  public:
+    // TYPES
+    enum Type {
+        // Enumeration of the kinds of JSON value, as determined by the first
+        // character of the value.
+
+        e_INVALID,  // no value (e.g., default-constructed or empty input)
+        e_OBJECT,
+        e_ARRAY,
+        e_STRING,
+        e_NUMBER,   // any other unquoted value (e.g., '1.5' or 'NaN')
+        e_BOOLEAN,
+        e_NULL
+    };
+
+  private:
+    // DATA
+    const char *d_begin_p;  // first character of the value, or 0
+    const char *d_end_p;    // end of the enclosing document
+
+    // FRIENDS
+    friend struct LazyValue_Manipulator;
+
+    // PRIVATE CREATORS
+    LazyValue(const char *begin, const char *end);
+        // Create a 'LazyValue' referring to the value starting at the first
+        // non-whitespace character in the range '[begin, end)', or to no
+        // value if there is none.
+
+    // PRIVATE ACCESSORS
+    template <class TYPE>
+    int getValueImp(TYPE *value, bdlat_TypeCategory::DynamicType) const;
+    template <class TYPE>
+    int getValueImp(TYPE *value, bdlat_TypeCategory::Sequence) const;
+    template <class TYPE>
+    int getValueImp(TYPE *value, bdlat_TypeCategory::Choice) const;
+    template <class TYPE>
+    int getValueImp(TYPE *value, bdlat_TypeCategory::Array) const;
+    int getValueImp(bsl::vector<char> *value, bdlat_TypeCategory::Array) const;
+    template <class TYPE>
+    int getValueImp(TYPE *value, bdlat_TypeCategory::Enumeration) const;
+    template <class TYPE>
+    int getValueImp(TYPE *value, bdlat_TypeCategory::CustomizedType) const;
+    template <class TYPE>
+    int getValueImp(TYPE *value, bdlat_TypeCategory::NullableValue) const;
+    template <class TYPE>
+    int getValueImp(TYPE *value, bdlat_TypeCategory::Simple) const;
+    template <class TYPE, class ANY_CATEGORY>
+    int getValueImp(TYPE *value, ANY_CATEGORY) const;
+        // Load into the specified 'value' the referenced JSON value, parsed
+        // according to the 'bdlat' category of 'value'.  Return 0 on success,
+        // and a non-zero value otherwise.
+
+    template <class TYPE>
+    int decodeAggregate(TYPE *value) const;
+        // Decode into the specified 'value' (of a sequence, choice, or array
+        // type) the referenced JSON value using a 'baljsn::Decoder' that
+        // skips unknown elements.  Return 0 on success, and a non-zero value
+        // otherwise.
+
+  public:
+    // CREATORS
+    LazyValue();
+        // Create a 'LazyValue' that refers to no value.  Note that 'type()'
+        // of such an object is 'e_INVALID', and all navigation and parsing
+        // functions fail.
+
+    explicit LazyValue(const bsl::string_view& json);
+        // Create a 'LazyValue' that refers to the top-level value of the
+        // specified 'json' document.  The behavior is undefined unless the
+        // characters of 'json' remain valid and unmodified while this object,
+        // or any 'LazyValue' obtained from it, is in use.  Note that 'json' is
+        // not examined beyond its leading whitespace.
+
+    //! LazyValue(const LazyValue& original) = default;
+        // Create a 'LazyValue' referring to the same value as the specified
+        // 'original'.
+
+    //! ~LazyValue() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! LazyValue& operator=(const LazyValue& rhs) = default;
+        // Make this object refer to the same value as the specified 'rhs', and
+        // return a reference providing modifiable access to this object.
+
+    // ACCESSORS
+    int findElement(LazyValue *result, bsl::size_t index) const;
+        // Load into the specified 'result' a reference to the element at the
+        // specified 'index' of the array referred to by this object, skipping
+        // the preceding elements without parsing them.  Return 0 on success,
+        // and a non-zero value (with no effect on 'result') if this object
+        // does not refer to an array, the array has no element at 'index', or
+        // the examined portion of the document is malformed.
+
+    int findMember(LazyValue *result, const bsl::string_view& key) const;
+        // Load into the specified 'result' a reference to the value of the
+        // first member having the specified 'key' of the object referred to by
+        // this object, skipping the values of the preceding members without
+        // parsing them.  Return 0 on success, and a non-zero value (with no
+        // effect on 'result') if this object does not refer to an object, the
+        // object has no member named 'key', or the examined portion of the
+        // document is malformed.  Note that 'key' is compared with the
+        // unescaped member names.
+
+    int findPath(LazyValue *result, const bsl::string_view& pointer) const;
+        // Load into the specified 'result' a reference to the value identified
+        // by the specified JSON 'pointer' (RFC 6901), relative to the value
+        // referred to by this object.  Each '/'-prefixed reference token of
+        // 'pointer' selects a member of an object by name (with "~1" and "~0"
+        // denoting '/' and '~') or an element of an array by its decimal
+        // index.  An empty 'pointer' refers to this value.  Return 0 on
+        // success, and a non-zero value (with no effect on 'result') if
+        // 'pointer' is not a valid JSON Pointer, no value is identified by it,
+        // or the examined portion of the document is malformed.
+
+    template <class TYPE>
+    int getValue(TYPE *value) const;
+        // Load into the specified 'value' the JSON value referred to by this
+        // object, parsed according to the 'bdlat' category of the (template
+        // parameter) 'TYPE' as described in {Parsing Values}.  Return 0 on
+        // success, and a non-zero value otherwise.  'TYPE' shall be a type
+        // supported by 'baljsn::Decoder'.  Note that aggregate types are
+        // decoded skipping unknown elements.
+
+    int getValue(bdld::ManagedDatum *value) const;
+    int getValue(bdld::ManagedDatum         *value,
+                 const DatumDecoderOptions&  options) const;
+        // Load into the specified 'value' the JSON value referred to by this
+        // object, decoded by 'baljsn::DatumUtil::decode' using the optionally
+        // specified 'options'.  Return 0 on success, and a non-zero value
+        // otherwise.
+
+    int getValue(bdld::Datum *value, bdlma::ManagedAllocator *arena) const;
+        // Load into the specified 'value' the JSON value referred to by this
+        // object, decoded by 'baljsn::DatumUtil::decodeInArena' using the
+        // specified 'arena'.  Return 0 on success, and a non-zero value
+        // otherwise.  The behavior is undefined unless the document outlives
+        // 'value'.  See {'baljsn_datumutil'|Arena Decoding}.
+
+    int size(bsl::size_t *result) const;
+        // Load into the specified 'result' the number of elements of the
+        // array, or the number of members of the object, referred to by this
+        // object.  Return 0 on success, and a non-zero value (with no effect
+        // on 'result') if this object does not refer to an array or an
+        // object, or the array or object is malformed.
+
+    int text(bsl::string_view *result) const;
+        // Load into the specified 'result' the text of the JSON value referred
+        // to by this object (e.g., including the quotes of a string).  Return
+        // 0 on success, and a non-zero value (with no effect on 'result') if
+        // this object refers to no value or the value is malformed.
+
+    Type type() const;
+        // Return the kind of JSON value referred to by this object, as
+        // determined by its first character.  Note that this value is not
+        // otherwise validated.
+};
+
+                        // ============================
+                        // struct LazyValue_Manipulator
+                        // ============================
+
+struct LazyValue_Manipulator {
+    // This component-private 'struct' provides a 'bdlat' manipulator that
+    // loads a value from the 'LazyValue' it holds.
+
+    // DATA
+    const LazyValue *d_value_p;
+
+    // MANIPULATORS
+    template <class TYPE>
+    int operator()(TYPE *value);
+        // Load into the specified 'value' the value referred to by
+        // 'd_value_p'.  Return 0 on success, and a non-zero value otherwise.
+
+    template <class TYPE, class CATEGORY>
+    int operator()(TYPE *value, CATEGORY category);
+        // Load into the specified 'value' the value referred to by
+        // 'd_value_p', parsed according to the specified 'category'.  Return
+        // 0 on success, and a non-zero value otherwise.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // ---------------
+                              // class LazyValue
+                              // ---------------
+
+// PRIVATE ACCESSORS
+template <class TYPE>
+int LazyValue::getValueImp(TYPE *value, bdlat_TypeCategory::DynamicType) const
+{
+    LazyValue_Manipulator manipulator = { this };
+    return bdlat_TypeCategoryUtil::manipulateByCategory(value, manipulator);
+}
+
+template <class TYPE>
+inline
+int LazyValue::getValueImp(TYPE *value, bdlat_TypeCategory::Sequence) const
+{
+    return decodeAggregate(value);
+}
+
+template <class TYPE>
+inline
+int LazyValue::getValueImp(TYPE *value, bdlat_TypeCategory::Choice) const
+{
+    return decodeAggregate(value);
+}
+
+template <class TYPE>
+inline
+int LazyValue::getValueImp(TYPE *value, bdlat_TypeCategory::Array) const
+{
+    return decodeAggregate(value);
+}
+
+inline
+int LazyValue::getValueImp(bsl::vector<char>         *value,
+                           bdlat_TypeCategory::Array  ) const
+{
+    bsl::string_view data;
+    if (0 != text(&data)) {
+        return -1;                                                    // RETURN
+    }
+    return ParserUtil::getValue(value, data);
+}
+
+template <class TYPE>
+int LazyValue::getValueImp(TYPE                            *value,
+                           bdlat_TypeCategory::Enumeration  ) const
+{
+    enum { k_MIN_ENUM_STRING_LENGTH = 2 };
+
+    bsl::string_view data;
+    if (0 != text(&data)
+     || data.length() <= k_MIN_ENUM_STRING_LENGTH
+     || '"'           != data[0]) {
+        return -1;                                                    // RETURN
+    }
+
+    const int                                     k_BUFFER_SIZE = 128;
+    bdlma::LocalSequentialAllocator<k_BUFFER_SIZE> bufferAllocator;
+    bsl::string                                   tmpString(&bufferAllocator);
+
+    if (0 != ParserUtil::getValue(&tmpString, data)) {
+        return -1;                                                    // RETURN
+    }
+
+    return bdlat::NameIndexUtil::fromString(
+                                         value,
+                                         tmpString.data(),
+                                         static_cast<int>(tmpString.size()));
+}
+
+template <class TYPE>
+int LazyValue::getValueImp(TYPE                               *value,
+                           bdlat_TypeCategory::CustomizedType  ) const
+{
+    bsl::string_view data;
+    if (0 != text(&data)) {
+        return -1;                                                    // RETURN
+    }
+
+    typename bdlat_CustomizedTypeFunctions::BaseType<TYPE>::Type valueBaseType;
+
+    if (0 != ParserUtil::getValue(&valueBaseType, data)) {
+        return -1;                                                    // RETURN
+    }
+
+    return bdlat_CustomizedTypeFunctions::convertFromBaseType(value,
+                                                              valueBaseType);
+}
+
+template <class TYPE>
+int LazyValue::getValueImp(TYPE                              *value,
+                           bdlat_TypeCategory::NullableValue  ) const
+{
+    if (e_NULL == type()) {
+        bsl::string_view data;
+        if (0 != text(&data) || "null" != data) {
+            return -1;                                                // RETURN
+        }
+        bdlat_ValueTypeFunctions::reset(value);
+        return 0;                                                     // RETURN
+    }
+
+    bdlat_NullableValueFunctions::makeValue(value);
+
+    LazyValue_Manipulator manipulator = { this };
+    return bdlat_NullableValueFunctions::manipulateValue(value, manipulator);
+}
+
+template <class TYPE>
+inline
+int LazyValue::getValueImp(TYPE *value, bdlat_TypeCategory::Simple) const
+{
+    bsl::string_view data;
+    if (0 != text(&data)) {
+        return -1;                                                    // RETURN
+    }
+    return ParserUtil::getValue(value, data);
+}
+
+template <class TYPE, class ANY_CATEGORY>
+inline
+int LazyValue::getValueImp(TYPE *, ANY_CATEGORY) const
+{
+    BSLS_ASSERT_OPT(!"Unreachable");
+
+    return -1;
+}
+
+template <class TYPE>
+int LazyValue::decodeAggregate(TYPE *value) const
+{
+    bsl::string_view data;
+    if (0 != text(&data)) {
+        return -1;                                                    // RETURN
+    }
+
+    bdlsb::FixedMemInStreamBuf streamBuf(data.data(), data.length());
+
+    DecoderOptions options;
+    options.setSkipUnknownElements(true);
+
+    Decoder decoder;
+    return decoder.decode(&streamBuf, value, options);
+}
+
+// CREATORS
+inline
+LazyValue::LazyValue()
+: d_begin_p(0)
+, d_end_p(0)
+{
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+int LazyValue::getValue(TYPE *value) const
+{
+    BSLS_ASSERT(value);
+
+    typedef typename bdlat_TypeCategory::Select<TYPE>::Type TypeCategory;
+
+    return getValueImp(value, TypeCategory());
+}
+
+inline
+int LazyValue::getValue(bdld::ManagedDatum *value) const
+{
+    return getValue(value, DatumDecoderOptions());
+}
+
+                        // ----------------------------
+                        // struct LazyValue_Manipulator
+                        // ----------------------------
+
+// MANIPULATORS
+template <class TYPE>
+inline
+int LazyValue_Manipulator::operator()(TYPE *value)
+{
+    return d_value_p->getValue(value);
+}
+
+template <class TYPE, class CATEGORY>
+inline
+int LazyValue_Manipulator::operator()(TYPE *value, CATEGORY category)
+{
+    return d_value_p->getValueImp(value, category);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1245 @@
+// baljsn_lazyvalue.t.cpp                                             -*-C++-*-
+#include <baljsn_lazyvalue.h>
+
+#include <baljsn_datumutil.h>
+
+#include <s_baltst_address.h>
+#include <s_baltst_customint.h>
+#include <s_baltst_employee.h>
+#include <s_baltst_enumerated.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlb_nullablevalue.h>
+
+#include <bdld_datum.h>
+#include <bdld_manageddatum.h>
+
+#include <bdlma_sequentialallocator.h>
+
+#include <bdlt_date.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a reference to a value within a JSON document
+// that supports navigation without parsing the values it skips, and parses the
+// referenced value on demand.  We first verify, using tables of documents,
+// that the extent ('text') and 'type' of values are found correctly for every
+// kind of value, including strings with escaped quotes and aggregates holding
+// brackets within strings.  We then verify each navigation function against
+// tables of documents and expected results, including malformed documents,
+// and that navigation does not allocate.  Finally, we verify that 'getValue'
+// parses each 'bdlat' category as 'baljsn::Decoder' does, and decodes
+// 'bdld::Datum' values as 'baljsn::DatumUtil' does.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] LazyValue();
+// [ 2] explicit LazyValue(const bsl::string_view& json);
+//
+// ACCESSORS
+// [ 4] int findElement(LazyValue *result, bsl::size_t index) const;
+// [ 3] int findMember(LazyValue *result, const bsl::string_view& key) const;
+// [ 5] int findPath(LazyValue *result, const bsl::string_view& ptr) const;
+// [ 6] int getValue(TYPE *value) const;
+// [ 7] int getValue(bdld::ManagedDatum *value) const;
+// [ 7] int getValue(bdld::ManagedDatum *value, const DDOptions&) const;
+// [ 7] int getValue(bdld::Datum *value, bdlma::ManagedAllocator *) const;
+// [ 4] int size(bsl::size_t *result) const;
+// [ 2] int text(bsl::string_view *result) const;
+// [ 2] Type type() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef baljsn::LazyValue Obj;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                          HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bsl::string textOf(const Obj& value)
+    // Return the text of the specified 'value', or "<error>" if 'value.text'
+    // fails.
+{
+    bsl::string_view text;
+    return 0 == value.text(&text) ? bsl::string(text) : "<error>";
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                          PERFORMANCE TEST HELPERS
+// ----------------------------------------------------------------------------
+
+static bsl::size_t s_antiOptimization = 0;
+
+template <class FUNCTOR>
+double medianTime(FUNCTOR functor, int numIterations)
+    // Return the median elapsed time, in seconds, of several trials each
+    // invoking the specified 'functor' the specified 'numIterations' times.
+{
+    enum { k_NUM_TRIALS = 11 };
+
+    bsl::vector<double> times;
+    for (int trial = 0; trial < k_NUM_TRIALS; ++trial) {
+        bsls::Stopwatch timer;
+        timer.start();
+        for (int i = 0; i < numIterations; ++i) {
+            s_antiOptimization += functor();
+        }
+        timer.stop();
+        times.push_back(timer.accumulatedWallTime());
+    }
+    bsl::sort(times.begin(), times.end());
+    return times[k_NUM_TRIALS / 2];
+}
+
+bsl::string makeMessage(int numRecords)
+    // Return a JSON document having an object member "records" holding the
+    // specified 'numRecords' objects of about 200 bytes each, followed by an
+    // object member "header" holding three scalar fields.
+{
+    bsl::string json("{\"records\":[");
+    for (int i = 0; i < numRecords; ++i) {
+        if (i) {
+            json += ',';
+        }
+        json += "{\"id\":";
+        json += bsl::to_string(i);
+        json += ",\"security\":\"IBM US Equity\","
+                "\"description\":\"International Business Machines Corp\","
+                "\"prices\":[149.25,149.5,149.75,150.0,150.25],"
+                "\"flags\":{\"active\":true,\"halted\":false,\"note\":null},"
+                "\"comment\":\"quoted \\\"text\\\" and [brackets]\"}";
+    }
+    json += "],\"header\":{\"source\":\"FEED-A\",\"sequence\":123456,"
+            "\"count\":";
+    json += bsl::to_string(numRecords);
+    json += "}}";
+    return json;
+}
+
+struct SparseLazy {
+    // Extract three fields from a message using 'baljsn::LazyValue'.
+
+    const bsl::string *d_json_p;
+
+    bsl::size_t operator()() const
+    {
+        Obj         document(*d_json_p);
+        Obj         field;
+        bsl::string source;
+        int         sequence = 0;
+        int         id       = 0;
+
+        document.findPath(&field, "/header/source");
+        field.getValue(&source);
+        document.findPath(&field, "/header/sequence");
+        field.getValue(&sequence);
+        document.findPath(&field, "/records/0/id");
+        field.getValue(&id);
+
+        return source.length() + sequence + id;
+    }
+};
+
+struct SparseDatum {
+    // Extract three fields from a message by decoding it into a
+    // 'bdld::ManagedDatum'.
+
+    const bsl::string *d_json_p;
+
+    bsl::size_t operator()() const
+    {
+        bdld::ManagedDatum datum;
+        baljsn::DatumUtil::decode(&datum, *d_json_p);
+
+        const bdld::DatumMapRef header =
+                                  datum->theMap().find("header")->theMap();
+        const bdld::DatumMapRef record =
+                    datum->theMap().find("records")->theArray()[0].theMap();
+
+        return header.find("source")->theString().length()
+             + static_cast<bsl::size_t>(
+                                     header.find("sequence")->theDouble())
+             + static_cast<bsl::size_t>(record.find("id")->theDouble());
+    }
+};
+
+struct SparseArena {
+    // Extract three fields from a message by decoding it into a 'bdld::Datum'
+    // in an arena.
+
+    const bsl::string          *d_json_p;
+    bdlma::SequentialAllocator *d_arena_p;
+
+    bsl::size_t operator()() const
+    {
+        bdld::Datum datum;
+        baljsn::DatumUtil::decodeInArena(&datum, d_arena_p, *d_json_p);
+
+        const bdld::DatumMapRef header =
+                                  datum.theMap().find("header")->theMap();
+        const bdld::DatumMapRef record =
+                     datum.theMap().find("records")->theArray()[0].theMap();
+
+        const bsl::size_t result =
+               header.find("source")->theString().length()
+             + static_cast<bsl::size_t>(
+                                     header.find("sequence")->theDouble())
+             + static_cast<bsl::size_t>(record.find("id")->theDouble());
+
+        d_arena_p->rewind();
+        return result;
+    }
+};
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Extracting a Few Fields from a Large Message
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive JSON messages describing orders, each of which
+// carries a long audit trail that we are not interested in, and that we need
+// only the symbol, the quantity, and the venue of the first fill.
+//
+// First, we obtain the message text (here, a small literal):
+//..
+    const bsl::string_view message =
+        "{"
+            "\"audit\":[{\"user\":\"a\",\"time\":1},"
+                       "{\"user\":\"b\",\"time\":2}],"
+            "\"order\":{"
+                "\"symbol\":\"IBM\","
+                "\"quantity\":300,"
+                "\"fills\":[{\"venue\":\"XNYS\",\"qty\":100},"
+                           "{\"venue\":\"ARCX\",\"qty\":200}]"
+            "}"
+        "}";
+//..
+// Then, we create a 'baljsn::LazyValue' referring to the whole document, and
+// navigate to the order, skipping the audit trail without parsing it:
+//..
+    baljsn::LazyValue document(message);
+    baljsn::LazyValue order;
+
+    int rc = document.findMember(&order, "order");
+    ASSERT(0 == rc);
+    ASSERT(baljsn::LazyValue::e_OBJECT == order.type());
+//..
+// Next, we parse the two scalar fields of the order that we need:
+//..
+    baljsn::LazyValue field;
+    bsl::string       symbol;
+    int               quantity;
+
+    rc = order.findMember(&field, "symbol");
+    ASSERT(0 == rc);
+    rc = field.getValue(&symbol);
+    ASSERT(0 == rc);
+    ASSERT("IBM" == symbol);
+
+    rc = order.findMember(&field, "quantity");
+    ASSERT(0 == rc);
+    rc = field.getValue(&quantity);
+    ASSERT(0 == rc);
+    ASSERT(300 == quantity);
+//..
+// Finally, we use a JSON Pointer to reach the venue of the first fill directly
+// from the document:
+//..
+    bsl::string venue;
+
+    rc = document.findPath(&field, "/order/fills/0/venue");
+    ASSERT(0 == rc);
+    rc = field.getValue(&venue);
+    ASSERT(0 == rc);
+    ASSERT("XNYS" == venue);
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // GETVALUE: AGGREGATES AND DATUMS
+        //
+        // Concerns:
+        //: 1 Sequences and arrays are decoded from the text of the referenced
+        //:   value only, skipping unknown elements.
+        //:
+        //: 2 A 'bdld::ManagedDatum' is decoded equal to the result of
+        //:   'baljsn::DatumUtil::decode' on the text of the value, honoring
+        //:   the decoder options.
+        //:
+        //: 3 A 'bdld::Datum' decoded in an arena refers to the document.
+        //:
+        //: 4 Malformed values are reported.
+        //
+        // Plan:
+        //: 1 Decode an 's_baltst::Employee' and a 'bsl::vector<int>' from
+        //:   members of a larger document having unknown members.  (C-1)
+        //:
+        //: 2 Decode a member of a document into a 'bdld::ManagedDatum' and
+        //:   compare with 'baljsn::DatumUtil::decode' of the member's text;
+        //:   verify that a small 'maxNestedDepth' causes failure.  (C-2)
+        //:
+        //: 3 Decode a member into a 'bdld::Datum' in an arena, and verify
+        //:   that its strings lie within the document.  (C-3)
+        //:
+        //: 4 Verify that decoding malformed values fails.  (C-4)
+        //
+        // Testing:
+        //   int getValue(TYPE *value) const;
+        //   int getValue(bdld::ManagedDatum *value) const;
+        //   int getValue(bdld::ManagedDatum *value, const DDOptions&) const;
+        //   int getValue(bdld::Datum *value, bdlma::ManagedAllocator *) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "GETVALUE: AGGREGATES AND DATUMS" << endl
+                          << "===============================" << endl;
+
+        const bsl::string JSON =
+            "{\"before\":[1,{\"x\":\"}\"}],"
+             "\"employee\":{\"name\":\"Bob\",\"unknown\":[1,2],"
+                           "\"homeAddress\":{\"street\":\"Lexington Ave\","
+                                            "\"city\":\"New York\","
+                                            "\"state\":\"NY\"},"
+                           "\"age\":21},"
+             "\"numbers\":[1, 2, 3],"
+             "\"nested\":{\"a\":[[[1]]],\"b\":\"text\"},"
+             "\"broken\":{\"a\":1,}}";
+
+        const Obj DOCUMENT(JSON);
+
+        if (verbose) cout << "\nSequences and arrays." << endl;
+        {
+            Obj field;
+            ASSERT(0 == DOCUMENT.findMember(&field, "employee"));
+
+            s_baltst::Employee employee;
+            int rc = field.getValue(&employee);
+            ASSERTV(rc, 0 == rc);
+            ASSERTV(employee.name(), "Bob" == employee.name());
+            ASSERTV(employee.age(), 21 == employee.age());
+            ASSERTV(employee.homeAddress().city(),
+                    "New York" == employee.homeAddress().city());
+
+            bsl::vector<int> numbers;
+            ASSERT(0 == DOCUMENT.findMember(&field, "numbers"));
+            rc = field.getValue(&numbers);
+            ASSERTV(rc, 0 == rc);
+            ASSERTV(numbers.size(), 3 == numbers.size());
+            ASSERT(3 == numbers.size() && 3 == numbers[2]);
+
+            ASSERT(0 == DOCUMENT.findMember(&field, "nested"));
+            ASSERT(0 != field.getValue(&numbers));
+        }
+
+        if (verbose) cout << "\nManaged datums." << endl;
+        {
+            bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+            Obj              field;
+            bsl::string_view text;
+            ASSERT(0 == DOCUMENT.findMember(&field, "nested"));
+            ASSERT(0 == field.text(&text));
+
+            bdld::ManagedDatum expected(&ta);
+            ASSERT(0 == baljsn::DatumUtil::decode(&expected, text));
+
+            bdld::ManagedDatum datum(&ta);
+            int                rc = field.getValue(&datum);
+            ASSERTV(rc, 0 == rc);
+            ASSERTV(*expected, *datum, *expected == *datum);
+
+            baljsn::DatumDecoderOptions options;
+            options.setMaxNestedDepth(2);
+            rc = field.getValue(&datum, options);
+            ASSERTV(rc, 0 != rc);
+
+            options.setMaxNestedDepth(4);
+            rc = field.getValue(&datum, options);
+            ASSERTV(rc, 0 == rc);
+
+            ASSERT(0 == DOCUMENT.findMember(&field, "broken"));
+            ASSERT(0 != field.getValue(&datum));
+        }
+
+        if (verbose) cout << "\nArena datums." << endl;
+        {
+            bdlma::SequentialAllocator arena;
+
+            Obj field;
+            ASSERT(0 == DOCUMENT.findMember(&field, "employee"));
+
+            bdld::Datum datum;
+            int         rc = field.getValue(&datum, &arena);
+            ASSERTV(rc, 0 == rc);
+            ASSERT(datum.isMap());
+
+            const bslstl::StringRef name =
+                                      datum.theMap().find("name")->theString();
+            ASSERT("Bob" == name);
+            ASSERT(JSON.data() <= name.data() &&
+                   name.data() < JSON.data() + JSON.length());
+
+            ASSERT(0 == DOCUMENT.findMember(&field, "broken"));
+            ASSERT(0 != field.getValue(&datum, &arena));
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // GETVALUE: SCALAR CATEGORIES
+        //
+        // Concerns:
+        //: 1 Simple types are parsed as by 'baljsn::ParserUtil', including
+        //:   strings with escape sequences and quoted dates.
+        //:
+        //: 2 Enumerations are parsed from their string names.
+        //:
+        //: 3 Customized types are parsed through their base type, and their
+        //:   restrictions are enforced.
+        //:
+        //: 4 Nullable values are reset for 'null', and otherwise hold the
+        //:   parsed underlying value.
+        //:
+        //: 5 'bsl::vector<char>' is parsed from base64 text.
+        //:
+        //: 6 Parsing a value of the wrong kind, or a value that does not
+        //:   exist, fails.
+        //
+        // Plan:
+        //: 1 Locate each member of a document holding a value of each kind,
+        //:   parse it into a value of the corresponding type, and verify the
+        //:   result.  Verify that parsing into a mismatched type fails.
+        //:   (C-1..6)
+        //
+        // Testing:
+        //   int getValue(TYPE *value) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "GETVALUE: SCALAR CATEGORIES" << endl
+                          << "===========================" << endl;
+
+        const char *JSON =
+            "{\"int\":-42,\"double\":1.5e3,\"bool\":true,"
+             "\"string\":\"a\\\"b\\u0041\",\"date\":\"2026-10-19\","
+             "\"enum\":\"LONDON\",\"badEnum\":\"PARIS\","
+             "\"custom\":999,\"badCustom\":1001,"
+             "\"null\":null,\"notNull\":7,"
+             "\"base64\":\"AQID\"}";
+
+        const Obj DOCUMENT(JSON);
+        Obj       field;
+
+        {
+            int value = 0;
+            ASSERT(0 == DOCUMENT.findMember(&field, "int"));
+            ASSERT(0 == field.getValue(&value));
+            ASSERTV(value, -42 == value);
+
+            bsls::Types::Int64 value64 = 0;
+            ASSERT(0 == field.getValue(&value64));
+            ASSERTV(value64, -42 == value64);
+
+            bsl::string string;
+            ASSERT(0 != field.getValue(&string));
+        }
+        {
+            double value = 0;
+            ASSERT(0 == DOCUMENT.findMember(&field, "double"));
+            ASSERT(0 == field.getValue(&value));
+            ASSERTV(value, 1500 == value);
+        }
+        {
+            bool value = false;
+            ASSERT(0 == DOCUMENT.findMember(&field, "bool"));
+            ASSERT(0 == field.getValue(&value));
+            ASSERT(value);
+
+            int number;
+            ASSERT(0 != field.getValue(&number));
+        }
+        {
+            bsl::string value;
+            ASSERT(0 == DOCUMENT.findMember(&field, "string"));
+            ASSERT(0 == field.getValue(&value));
+            ASSERTV(value, "a\"bA" == value);
+        }
+        {
+            bdlt::Date value;
+            ASSERT(0 == DOCUMENT.findMember(&field, "date"));
+            ASSERT(0 == field.getValue(&value));
+            ASSERTV(value, bdlt::Date(2026, 10, 19) == value);
+        }
+        {
+            s_baltst::Enumerated::Value value = s_baltst::Enumerated::NEW_YORK;
+            ASSERT(0 == DOCUMENT.findMember(&field, "enum"));
+            ASSERT(0 == field.getValue(&value));
+            ASSERTV(value, s_baltst::Enumerated::LONDON == value);
+
+            ASSERT(0 == DOCUMENT.findMember(&field, "badEnum"));
+            ASSERT(0 != field.getValue(&value));
+
+            ASSERT(0 == DOCUMENT.findMember(&field, "int"));
+            ASSERT(0 != field.getValue(&value));
+        }
+        {
+            s_baltst::CustomInt value;
+            ASSERT(0 == DOCUMENT.findMember(&field, "custom"));
+            ASSERT(0 == field.getValue(&value));
+            ASSERTV(value.toInt(), 999 == value.toInt());
+
+            ASSERT(0 == DOCUMENT.findMember(&field, "badCustom"));
+            ASSERT(0 != field.getValue(&value));
+        }
+        {
+            bdlb::NullableValue<int> value(5);
+            ASSERT(0 == DOCUMENT.findMember(&field, "null"));
+            ASSERT(0 == field.getValue(&value));
+            ASSERT(value.isNull());
+
+            ASSERT(0 == DOCUMENT.findMember(&field, "notNull"));
+            ASSERT(0 == field.getValue(&value));
+            ASSERT(!value.isNull() && 7 == value.value());
+        }
+        {
+            bsl::vector<char> value;
+            ASSERT(0 == DOCUMENT.findMember(&field, "base64"));
+            ASSERT(0 == field.getValue(&value));
+            ASSERTV(value.size(), 3 == value.size());
+            ASSERT(3 == value.size() && 1 == value[0] && 3 == value[2]);
+        }
+        {
+            int value;
+            ASSERT(0 != Obj().getValue(&value));
+            ASSERT(0 != Obj("[1").getValue(&value));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // FINDPATH
+        //
+        // Concerns:
+        //: 1 An empty pointer refers to the value itself.
+        //:
+        //: 2 Reference tokens select object members by name, and array
+        //:   elements by decimal index, at any depth.
+        //:
+        //: 3 "~1" and "~0" in a reference token denote '/' and '~'.
+        //:
+        //: 4 Malformed pointers, invalid indices (including indices too large
+        //:   to represent, which must not wrap around to a valid index),
+        //:   absent members and elements, and attempts to descend into
+        //:   scalars fail, leaving 'result' unchanged.
+        //:
+        //: 5 A decimal reference token names a member of an object.
+        //
+        // Plan:
+        //: 1 Using a table of pointers and the expected text of the values
+        //:   they identify in a fixed document, verify the status and result
+        //:   of 'findPath'.  (C-1..5)
+        //
+        // Testing:
+        //   int findPath(LazyValue *result, const string_view& ptr) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FINDPATH" << endl
+                          << "========" << endl;
+
+        const char *JSON =
+            "{\"a\":{\"b\":[10,{\"c\":\"deep\"},[20,21]]},"
+             "\"x/y\":1,\"m~n\":2,\"\":3,\"0\":4,"
+             "\"s\":\"str\"}";
+
+        static const struct {
+            int         d_line;
+            const char *d_pointer;
+            const char *d_text;  // 0 if 'findPath' fails
+        } DATA[] = {
+            //LINE  POINTER         TEXT
+            //----  -------         ----
+            { L_,   "",             0                                   },
+            { L_,   "/a/b/0",       "10"                                },
+            { L_,   "/a/b/1/c",     "\"deep\""                          },
+            { L_,   "/a/b/2/1",     "21"                                },
+            { L_,   "/a/b",         "[10,{\"c\":\"deep\"},[20,21]]"     },
+            { L_,   "/x~1y",        "1"                                 },
+            { L_,   "/m~0n",        "2"                                 },
+            { L_,   "/",            "3"                                 },
+            { L_,   "/0",           "4"                                 },
+            { L_,   "/s",           "\"str\""                           },
+
+            { L_,   "a",            0                                   },
+            { L_,   "/missing",     0                                   },
+            { L_,   "/a/b/3",       0                                   },
+            { L_,   "/a/b/01",      0                                   },
+            { L_,   "/a/b/-1",      0                                   },
+            { L_,   "/a/b/",        0                                   },
+            { L_,   "/a/b/x",       0                                   },
+            { L_,   "/s/0",         0                                   },
+            { L_,   "/a/b/0/0",     0                                   },
+            { L_,   "/m~2n",        0                                   },
+            { L_,   "/m~",          0                                   },
+            { L_,   "/a//b",        0                                   },
+        };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        const Obj DOCUMENT(JSON);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE    = DATA[ti].d_line;
+            const char *POINTER = DATA[ti].d_pointer;
+            const char *TEXT    = DATA[ti].d_text;
+
+            if (veryVerbose) { T_ P_(LINE) P(POINTER) }
+
+            Obj       result(bsl::string_view("\"sentinel\""));
+            const int rc = DOCUMENT.findPath(&result, POINTER);
+
+            if (0 == ti) {
+                ASSERTV(LINE, rc, 0 == rc);
+                ASSERTV(LINE, textOf(result), textOf(DOCUMENT) ==
+                                                              textOf(result));
+            }
+            else if (TEXT) {
+                ASSERTV(LINE, rc, 0 == rc);
+                ASSERTV(LINE, textOf(result), TEXT == textOf(result));
+            }
+            else {
+                ASSERTV(LINE, rc, 0 != rc);
+                ASSERTV(LINE, textOf(result), "\"sentinel\"" ==
+                                                              textOf(result));
+            }
+        }
+
+        if (verbose) cout << "\nTesting indices too large to represent."
+                          << endl;
+        {
+            // Each index is congruent to a valid index of "/a/b" modulo
+            // 2^32 or 2^64.
+
+            static const char *const POINTERS[] = {
+                "/a/b/4294967296",
+                "/a/b/4294967297",
+                "/a/b/18446744073709551616",
+                "/a/b/18446744073709551617",
+                "/a/b/36893488147419103232",
+                "/a/b/1000000000000000000000000000000000000000",
+            };
+            enum { NUM_POINTERS = sizeof POINTERS / sizeof *POINTERS };
+
+            for (int ti = 0; ti < NUM_POINTERS; ++ti) {
+                const char *POINTER = POINTERS[ti];
+
+                if (veryVerbose) { T_ P(POINTER) }
+
+                Obj       result(bsl::string_view("\"sentinel\""));
+                const int rc = DOCUMENT.findPath(&result, POINTER);
+
+                ASSERTV(POINTER, rc, 0 != rc);
+                ASSERTV(POINTER, textOf(result), "\"sentinel\"" ==
+                                                              textOf(result));
+            }
+        }
+
+        Obj result;
+        ASSERT(0 != Obj().findPath(&result, ""));
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // FINDELEMENT AND SIZE
+        //
+        // Concerns:
+        //: 1 'findElement' finds each element of an array, at any index, with
+        //:   arbitrary whitespace, skipping elements of every kind.
+        //:
+        //: 2 'findElement' fails for an index past the end, for non-arrays,
+        //:   and for arrays malformed before the element, leaving 'result'
+        //:   unchanged.  Text following the element is not examined.
+        //:
+        //: 3 'size' counts the elements of arrays and the members of objects,
+        //:   and fails for scalars and malformed aggregates.
+        //
+        // Plan:
+        //: 1 Using a table of documents with their expected elements (or
+        //:   members) and sizes, verify 'findElement' for every index and
+        //:   one past the end, and verify 'size'.  (C-1..3)
+        //
+        // Testing:
+        //   int findElement(LazyValue *result, bsl::size_t index) const;
+        //   int size(bsl::size_t *result) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FINDELEMENT AND SIZE" << endl
+                          << "====================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_json;
+            int         d_size;      // -1 if 'size' fails
+            const char *d_elements;  // '|'-separated, or 0 if not an array
+        } DATA[] = {
+            //LINE  JSON                        SIZE  ELEMENTS
+            //----  ----                        ----  --------
+            { L_,   "[]",                          0, ""                   },
+            { L_,   " [ ] ",                       0, ""                   },
+            { L_,   "[1]",                         1, "1"                  },
+            { L_,   "[1,2,3]",                     3, "1|2|3"              },
+            { L_,   "[ 1 , \"a\" ,\ttrue ]",       3, "1|\"a\"|true"       },
+            { L_,   "[[1,[2]],{\"]\":\"[\"},3]",   3,
+                                          "[1,[2]]|{\"]\":\"[\"}|3"       },
+            { L_,   "[\"\\\"\",\"\\\\\",null]",   3,
+                                               "\"\\\"\"|\"\\\\\"|null"   },
+            { L_,   "{}",                          0, 0                    },
+            { L_,   "{\"a\":1,\"b\":[1,2]}",       2, 0                    },
+            { L_,   "{\"a\" : {\"b\":1} }",        1, 0                    },
+
+            { L_,   "1",                          -1, 0                    },
+            { L_,   "\"[1]\"",                    -1, 0                    },
+            { L_,   "[1,",                        -1, "1"                  },
+            { L_,   "[1 2]",                      -1, "1"                  },
+            { L_,   "[\"abc]",                    -1, "<error>"            },
+            { L_,   "{\"a\"1}",                   -1, 0                    },
+            { L_,   "{1:2}",                      -1, 0                    },
+        };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const char *JSON     = DATA[ti].d_json;
+            const int   SIZE     = DATA[ti].d_size;
+            const char *ELEMENTS = DATA[ti].d_elements;
+
+            if (veryVerbose) { T_ P_(LINE) P(JSON) }
+
+            const Obj X(JSON);
+
+            bsl::size_t size = 99;
+            const int   rc   = X.size(&size);
+            if (0 <= SIZE) {
+                ASSERTV(LINE, rc, 0 == rc);
+                ASSERTV(LINE, size, static_cast<bsl::size_t>(SIZE) == size);
+            }
+            else {
+                ASSERTV(LINE, rc, 0 != rc);
+                ASSERTV(LINE, size, 99 == size);
+            }
+
+            if (!ELEMENTS) {
+                Obj result(bsl::string_view("0"));
+                ASSERTV(LINE, 0 != X.findElement(&result, 0));
+                ASSERTV(LINE, "0" == textOf(result));
+                continue;
+            }
+
+            bsl::vector<bsl::string> expected;
+            if (*ELEMENTS) {
+                const bsl::string all(ELEMENTS);
+                bsl::size_t       begin = 0;
+                while (true) {
+                    const bsl::size_t bar = all.find('|', begin);
+                    expected.push_back(all.substr(begin, bar - begin));
+                    if (bsl::string::npos == bar) {
+                        break;
+                    }
+                    begin = bar + 1;
+                }
+            }
+
+            for (bsl::size_t i = 0; i <= expected.size(); ++i) {
+                Obj       result(bsl::string_view("0"));
+                const int rc = X.findElement(&result, i);
+                if (i < expected.size()) {
+                    ASSERTV(LINE, i, rc, 0 == rc);
+                    ASSERTV(LINE, i, textOf(result), expected[i] ==
+                                                              textOf(result));
+                }
+                else {
+                    ASSERTV(LINE, i, rc, 0 != rc);
+                    ASSERTV(LINE, i, "0" == textOf(result));
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // FINDMEMBER
+        //
+        // Concerns:
+        //: 1 'findMember' finds the value of a member by name, with arbitrary
+        //:   whitespace, skipping the values of the preceding members of
+        //:   every kind without parsing them.
+        //:
+        //: 2 Names are compared after unescaping.
+        //:
+        //: 3 The first of several members having the same name is found.
+        //:
+        //: 4 'findMember' fails for absent members, non-objects, and
+        //:   malformed objects, leaving 'result' unchanged.
+        //:
+        //: 5 Members following the one found are not examined.
+        //:
+        //: 6 Navigation does not allocate memory unless a member name needing
+        //:   unescaping exceeds a local buffer.
+        //
+        // Plan:
+        //: 1 Using a table of documents, names, and the expected text of the
+        //:   values found, verify the status and result of 'findMember',
+        //:   with the default allocator guarded by a test allocator.
+        //:   (C-1..6)
+        //
+        // Testing:
+        //   int findMember(LazyValue *result, const string_view& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "FINDMEMBER" << endl
+                          << "==========" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_json;
+            const char *d_key;
+            const char *d_text;  // 0 if 'findMember' fails
+        } DATA[] = {
+            //LINE  JSON                                KEY    TEXT
+            //----  ----                                ---    ----
+            { L_,   "{\"a\":1}",                        "a",   "1"        },
+            { L_,   " { \"a\" : 1 } ",                  "a",   "1"        },
+            { L_,   "{\"a\":1,\"b\":2}",                "b",   "2"        },
+            { L_,   "{\"a\":[1,{\"b\":3}],\"b\":2}",    "b",   "2"        },
+            { L_,   "{\"a\":\"\\\"}\",\"b\":2}",        "b",   "2"        },
+            { L_,   "{\"a\":{\"}\":\"{\"},\"b\":[]}",   "b",   "[]"       },
+            { L_,   "{\"a\":true,\"b\":null}",          "b",   "null"     },
+            { L_,   "{\"a\\u0062\":1}",                 "ab",  "1"        },
+            { L_,   "{\"a\\\"\":1}",                    "a\"", "1"        },
+            { L_,   "{\"\":5}",                         "",    "5"        },
+            { L_,   "{\"a\":1,\"a\":2}",                "a",   "1"        },
+            { L_,   "{\"a\":1,\"b\":2,}",               "b",   "2"        },
+            { L_,   "{\"a\":1,\"b\":2 garbage",         "a",   "1"        },
+
+            { L_,   "{}",                               "a",   0          },
+            { L_,   "{\"a\":1}",                        "b",   0          },
+            { L_,   "{\"ab\":1}",                       "a",   0          },
+            { L_,   "[\"a\",1]",                        "a",   0          },
+            { L_,   "\"a\"",                            "a",   0          },
+            { L_,   "{\"a\" 1}",                        "a",   0          },
+            { L_,   "{\"a\":1 \"b\":2}",                "b",   0          },
+            { L_,   "{\"a\":[1,\"b\":2}",               "b",   0          },
+            { L_,   "{\"a\":\"1,\"b\":2}",              "b",   0          },
+            { L_,   "{\"a\\x\":1}",                     "a",   0          },
+            { L_,   "{a:1}",                            "a",   0          },
+            { L_,   "{\"a\":",                          "a",   0          },
+        };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE = DATA[ti].d_line;
+            const char *JSON = DATA[ti].d_json;
+            const char *KEY  = DATA[ti].d_key;
+            const char *TEXT = DATA[ti].d_text;
+
+            if (veryVerbose) { T_ P_(LINE) P_(JSON) P(KEY) }
+
+            const Obj X(JSON);
+
+            Obj       result(bsl::string_view("0"));
+            const int rc = X.findMember(&result, KEY);
+
+            if (TEXT) {
+                ASSERTV(LINE, rc, 0 == rc);
+                ASSERTV(LINE, textOf(result), TEXT == textOf(result));
+            }
+            else {
+                ASSERTV(LINE, rc, 0 != rc);
+                ASSERTV(LINE, "0" == textOf(result));
+            }
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        Obj result;
+        ASSERT(0 != Obj().findMember(&result, "a"));
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS, TYPE, AND TEXT
+        //
+        // Concerns:
+        //: 1 A default-constructed object, and an object constructed from an
+        //:   empty or all-whitespace document, refer to no value.
+        //:
+        //: 2 The type of a value is determined by its first character, after
+        //:   any leading whitespace.
+        //:
+        //: 3 The text of a value extends exactly to its end: the closing
+        //:   quote of a string (respecting escaped quotes and backslashes),
+        //:   the matching bracket of an aggregate (ignoring brackets within
+        //:   strings), or the first whitespace or structural character
+        //:   following a scalar.
+        //:
+        //: 4 'text' fails for unterminated strings and unbalanced aggregates.
+        //
+        // Plan:
+        //: 1 Using a table of documents with the expected type and text of
+        //:   their top-level values, verify 'type' and 'text'.  (C-1..4)
+        //
+        // Testing:
+        //   LazyValue();
+        //   explicit LazyValue(const bsl::string_view& json);
+        //   int text(bsl::string_view *result) const;
+        //   Type type() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTORS, TYPE, AND TEXT" << endl
+                          << "============================" << endl;
+
+        {
+            const Obj        X;
+            bsl::string_view text("unchanged");
+            ASSERT(Obj::e_INVALID == X.type());
+            ASSERT(0 != X.text(&text));
+            ASSERT("unchanged" == text);
+        }
+
+        static const struct {
+            int         d_line;
+            const char *d_json;
+            Obj::Type   d_type;
+            const char *d_text;  // 0 if 'text' fails
+        } DATA[] = {
+            //LINE  JSON                   TYPE             TEXT
+            //----  ----                   ----             ----
+            { L_,   "",                    Obj::e_INVALID,  0               },
+            { L_,   " \t\r\n",             Obj::e_INVALID,  0               },
+            { L_,   "0",                   Obj::e_NUMBER,   "0"             },
+            { L_,   " -1.5e3 ",            Obj::e_NUMBER,   "-1.5e3"        },
+            { L_,   "12,",                 Obj::e_NUMBER,   "12"            },
+            { L_,   "12]",                 Obj::e_NUMBER,   "12"            },
+            { L_,   "NaN",                 Obj::e_NUMBER,   "NaN"           },
+            { L_,   "nan",                 Obj::e_NUMBER,   "nan"           },
+            { L_,   "true",                Obj::e_BOOLEAN,  "true"          },
+            { L_,   "false}",              Obj::e_BOOLEAN,  "false"         },
+            { L_,   "null",                Obj::e_NULL,     "null"          },
+            { L_,   "\"\"",                Obj::e_STRING,   "\"\""          },
+            { L_,   "\"a b\" x",           Obj::e_STRING,   "\"a b\""       },
+            { L_,   "\"a\\\"b\"",          Obj::e_STRING,   "\"a\\\"b\""    },
+            { L_,   "\"a\\\\\"b\"",        Obj::e_STRING,   "\"a\\\\\""     },
+            { L_,   "\"\\\\\\\"\"",        Obj::e_STRING,   "\"\\\\\\\"\""  },
+            { L_,   "[]",                  Obj::e_ARRAY,    "[]"            },
+            { L_,   "[1,[2,[3]]],4",       Obj::e_ARRAY,    "[1,[2,[3]]]"   },
+            { L_,   "[\"]\"]]",            Obj::e_ARRAY,    "[\"]\"]"       },
+            { L_,   "{}",                  Obj::e_OBJECT,   "{}"            },
+            { L_,   "{\"}\":\"\\\"}\"}}",  Obj::e_OBJECT,
+                                                     "{\"}\":\"\\\"}\"}"   },
+
+            { L_,   "\"abc",               Obj::e_STRING,   0               },
+            { L_,   "\"abc\\\"",           Obj::e_STRING,   0               },
+            { L_,   "[1,[2]",              Obj::e_ARRAY,    0               },
+            { L_,   "{\"a\":\"}",          Obj::e_OBJECT,   0               },
+            { L_,   "}",                   Obj::e_INVALID,  0               },
+            { L_,   ",",                   Obj::e_INVALID,  0               },
+        };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int       LINE = DATA[ti].d_line;
+            const char     *JSON = DATA[ti].d_json;
+            const Obj::Type TYPE = DATA[ti].d_type;
+            const char     *TEXT = DATA[ti].d_text;
+
+            if (veryVerbose) { T_ P_(LINE) P(JSON) }
+
+            const Obj X(JSON);
+
+            ASSERTV(LINE, X.type(), TYPE == X.type());
+
+            bsl::string_view text("unchanged");
+            const int        rc = X.text(&text);
+            if (TEXT) {
+                ASSERTV(LINE, rc, 0 == rc);
+                ASSERTV(LINE, text, TEXT == text);
+            }
+            else {
+                ASSERTV(LINE, rc, 0 != rc);
+                ASSERTV(LINE, text, "unchanged" == text);
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Navigate a small document by member, element, and path, and
+        //:   parse the values found.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const Obj X("{\"a\": [1, 2, {\"b\": \"c\"}], \"d\": 4.5}");
+        ASSERT(Obj::e_OBJECT == X.type());
+
+        bsl::size_t size;
+        ASSERT(0 == X.size(&size));
+        ASSERT(2 == size);
+
+        Obj a;
+        ASSERT(0 == X.findMember(&a, "a"));
+        ASSERT(Obj::e_ARRAY == a.type());
+        ASSERT(0 == a.size(&size));
+        ASSERT(3 == size);
+
+        Obj element;
+        ASSERT(0 == a.findElement(&element, 1));
+        int i = 0;
+        ASSERT(0 == element.getValue(&i));
+        ASSERT(2 == i);
+
+        Obj b;
+        ASSERT(0 == X.findPath(&b, "/a/2/b"));
+        bsl::string s;
+        ASSERT(0 == b.getValue(&s));
+        ASSERT("c" == s);
+
+        Obj d;
+        ASSERT(0 == X.findMember(&d, "d"));
+        double value = 0;
+        ASSERT(0 == d.getValue(&value));
+        ASSERT(4.5 == value);
+
+        ASSERT(0 != X.findMember(&d, "e"));
+        ASSERT(0 != a.findElement(&d, 3));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Extracting a few fields from a large message using 'LazyValue'
+        //:   is much faster than decoding the whole message.
+        //
+        // Plan:
+        //: 1 For messages of several sizes (or of the number of records given
+        //:   as the second command-line argument), time extracting three
+        //:   fields (two near the end of the message, one near the start)
+        //:   using 'LazyValue', using 'baljsn::DatumUtil::decode', and using
+        //:   'baljsn::DatumUtil::decodeInArena', and report the throughput of
+        //:   each.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int ARG     = argc > 2 ? atoi(argv[2]) : 0;
+        const int SIZES[] = { 4, 32, 256 };
+        const int NUM_SIZES = 0 < ARG
+                            ? 1
+                            : static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        cout << "records  bytes  lazy(msg/ms)  datum(msg/ms)  arena(msg/ms)"
+             << endl;
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int         NUM_RECORDS = 0 < ARG ? ARG : SIZES[si];
+            const int         ITERATIONS  = bsl::max(1, 2000 / NUM_RECORDS);
+            const bsl::string JSON        = makeMessage(NUM_RECORDS);
+
+            bdlma::SequentialAllocator arena;
+
+            SparseLazy  lazy  = { &JSON };
+            SparseDatum datum = { &JSON };
+            SparseArena inArena = { &JSON, &arena };
+
+            ASSERT(lazy() == datum());
+            ASSERT(lazy() == inArena());
+
+            const double lazyTime  = medianTime(lazy,    ITERATIONS);
+            const double datumTime = medianTime(datum,   ITERATIONS);
+            const double arenaTime = medianTime(inArena, ITERATIONS);
+
+            const double MESSAGES = ITERATIONS / 1000.0;
+
+            cout << NUM_RECORDS << "  " << JSON.length()
+                 << "  " << MESSAGES / lazyTime
+                 << "  " << MESSAGES / datumTime
+                 << "  " << MESSAGES / arenaTime << endl;
+        }
+
+        if (veryVerbose) {
+            P(s_antiOptimization);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
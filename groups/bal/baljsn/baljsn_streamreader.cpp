@@ -0,0 +1,367 @@
+// baljsn_streamreader.cpp                                            -*-C++-*-
+#include <baljsn_streamreader.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(baljsn_streamreader_cpp,"$Id$ $CSID$")
+
+#include <bdlb_chartype.h>
+
+#include <bslma_default.h>
+
+#include <bsl_ios.h>
+
+namespace BloombergLP {
+namespace baljsn {
+
+namespace {
+namespace u {
+
+bool isDelimiter(char character)
+    // Return 'true' if the specified 'character' ends a JSON scalar value,
+    // and 'false' otherwise.
+{
+    return bdlb::CharType::isSpace(character)
+        || ',' == character
+        || ']' == character
+        || '}' == character;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                        // ---------------------------
+                        // struct StreamReader_ImpUtil
+                        // ---------------------------
+
+// CLASS METHODS
+bool StreamReader_ImpUtil::isBlank(const char *begin, const char *end)
+{
+    for (; begin < end; ++begin) {
+        if (!bdlb::CharType::isSpace(*begin)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+void StreamReader_ImpUtil::logLineError(bsl::string        *messages,
+                                        bsl::size_t         lineNumber,
+                                        const bsl::string&  decoderMessages)
+{
+    BSLS_ASSERT(messages);
+
+    bsl::ostringstream stream;
+    stream << "Unable to decode the value on line " << lineNumber << ": "
+           << decoderMessages;
+    *messages = stream.str();
+}
+
+                             // ------------------
+                             // class StreamReader
+                             // ------------------
+
+// PRIVATE MANIPULATORS
+int StreamReader::loadNextArrayElement()
+{
+    d_element.clear();
+
+    switch (d_state) {
+      case e_BEFORE_ARRAY: {
+        if ('[' != peekNonSpace()) {
+            d_logStream << "Expected '[' at the start of the input\n";
+            d_state = e_FAILED;
+            return -1;                                                // RETURN
+        }
+        ++d_position;
+        d_state = e_FIRST_ELEMENT;
+        return loadNextArrayElement();                                // RETURN
+      } break;
+      case e_FIRST_ELEMENT:
+      case e_NEXT_ELEMENT: {
+        int character = peekNonSpace();
+        if (']' == character) {
+            ++d_position;
+            if (0 <= peekNonSpace()) {
+                d_logStream << "Unexpected data following the array\n";
+                d_state = e_FAILED;
+                return -1;                                            // RETURN
+            }
+            d_state = e_END;
+            return 1;                                                 // RETURN
+        }
+
+        if (e_NEXT_ELEMENT == d_state) {
+            if (',' != character) {
+                d_logStream << "Expected ',' or ']' after element "
+                            << d_numElementsRead - 1 << '\n';
+                d_state = e_FAILED;
+                return -1;                                            // RETURN
+            }
+            ++d_position;
+            character = peekNonSpace();
+        }
+
+        if (character < 0 || ',' == character || ']' == character) {
+            d_logStream << "Expected a value for element "
+                        << d_numElementsRead << '\n';
+            d_state = e_FAILED;
+            return -1;                                                // RETURN
+        }
+
+        if (0 != loadValue()) {
+            d_logStream << "Input ended within element "
+                        << d_numElementsRead << '\n';
+            d_state = e_FAILED;
+            return -1;                                                // RETURN
+        }
+        d_state = e_NEXT_ELEMENT;
+        return 0;                                                     // RETURN
+      } break;
+      case e_END: {
+        return 1;                                                     // RETURN
+      } break;
+      case e_FAILED: {
+        d_logStream << "A previous error prevents further reading\n";
+        return -1;                                                    // RETURN
+      } break;
+    }
+
+    BSLS_ASSERT_OPT(!"Unreachable");
+    return -1;
+}
+
+int StreamReader::loadNextLine()
+{
+    if (e_END == d_state) {
+        return 1;                                                     // RETURN
+    }
+    if (e_FAILED == d_state) {
+        d_logStream << "A previous error prevents further reading\n";
+        return -1;                                                    // RETURN
+    }
+
+    while (true) {
+        d_element.clear();
+        if (0 == readLines(&d_element, 1)) {
+            d_state = e_END;
+            return 1;                                                 // RETURN
+        }
+        ++d_lineNumber;
+
+        if (!StreamReader_ImpUtil::isBlank(
+                                     d_element.data(),
+                                     d_element.data() + d_element.length())) {
+            return 0;                                                 // RETURN
+        }
+    }
+}
+
+int StreamReader::loadValue()
+{
+    BSLS_ASSERT(d_position < d_length);
+
+    const char first = d_buffer[d_position];
+
+    if ('{' != first && '[' != first && '"' != first) {
+        while (true) {
+            const char *begin  = d_buffer.data() + d_position;
+            const char *end    = d_buffer.data() + d_length;
+            const char *cursor = begin;
+            while (cursor < end && !u::isDelimiter(*cursor)) {
+                ++cursor;
+            }
+            d_element.append(begin, cursor);
+            d_position += cursor - begin;
+
+            if (cursor < end || !refill()) {
+                return 0;                                             // RETURN
+            }
+        }
+    }
+
+    int  depth    = 0;
+    bool inString = false;
+    bool escaped  = false;
+
+    while (true) {
+        const char *begin  = d_buffer.data() + d_position;
+        const char *end    = d_buffer.data() + d_length;
+        const char *cursor = begin;
+        bool        done   = false;
+
+        while (cursor < end && !done) {
+            const char character = *cursor++;
+            if (inString) {
+                if (escaped) {
+                    escaped = false;
+                }
+                else if ('\\' == character) {
+                    escaped = true;
+                }
+                else if ('"' == character) {
+                    inString = false;
+                    done     = 0 == depth;
+                }
+            }
+            else if ('"' == character) {
+                inString = true;
+            }
+            else if ('{' == character || '[' == character) {
+                ++depth;
+            }
+            else if ('}' == character || ']' == character) {
+                done = 0 == --depth;
+            }
+        }
+
+        d_element.append(begin, cursor);
+        d_position += cursor - begin;
+
+        if (done) {
+            return 0;                                                 // RETURN
+        }
+        if (!refill()) {
+            return -1;                                                // RETURN
+        }
+    }
+}
+
+void StreamReader::logDecodeError()
+{
+    if (e_NDJSON == d_format) {
+        d_logStream << "Unable to decode the value on line " << d_lineNumber
+                    << ": ";
+    }
+    else {
+        d_logStream << "Unable to decode element " << d_numElementsRead - 1
+                    << ": ";
+    }
+    d_logStream << d_decoder.loggedMessages();
+}
+
+int StreamReader::peekNonSpace()
+{
+    while (refill()) {
+        while (d_position < d_length) {
+            const char character = d_buffer[d_position];
+            if (!bdlb::CharType::isSpace(character)) {
+                return static_cast<unsigned char>(character);         // RETURN
+            }
+            ++d_position;
+        }
+    }
+    return -1;
+}
+
+bsl::size_t StreamReader::readLines(bsl::string *text, bsl::size_t maxLines)
+{
+    BSLS_ASSERT(text);
+
+    bsl::size_t numLines = 0;
+    bool        partial  = false;
+
+    while (numLines < maxLines) {
+        if (!refill()) {
+            if (partial) {
+                ++numLines;
+            }
+            break;
+        }
+
+        const char *begin   = d_buffer.data() + d_position;
+        const char *end     = d_buffer.data() + d_length;
+        const char *newline = static_cast<const char *>(
+                                       bsl::memchr(begin, '\n', end - begin));
+
+        if (!newline) {
+            text->append(begin, end);
+            d_position = d_length;
+            partial    = true;
+            continue;
+        }
+
+        text->append(begin, newline + 1);
+        d_position += newline + 1 - begin;
+        partial     = false;
+        ++numLines;
+    }
+
+    return numLines;
+}
+
+bool StreamReader::refill()
+{
+    if (d_position < d_length) {
+        return true;                                                  // RETURN
+    }
+
+    const bsl::streamsize numRead = d_streamBuf_p->sgetn(
+                                      d_buffer.data(),
+                                      static_cast<bsl::streamsize>(
+                                                             d_buffer.size()));
+
+    d_position = 0;
+    d_length   = 0 < numRead ? static_cast<bsl::size_t>(numRead) : 0;
+    return 0 < d_length;
+}
+
+// CREATORS
+StreamReader::StreamReader(bsl::streambuf   *streamBuf,
+                           Format            format,
+                           bslma::Allocator *basicAllocator)
+: d_streamBuf_p(streamBuf)
+, d_format(format)
+, d_state(e_BEFORE_ARRAY)
+, d_options()
+, d_decoder(basicAllocator)
+, d_buffer(k_BUFFER_SIZE, '\0', basicAllocator)
+, d_position(0)
+, d_length(0)
+, d_element(basicAllocator)
+, d_numElementsRead(0)
+, d_lineNumber(0)
+, d_logStream(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(streamBuf);
+}
+
+StreamReader::StreamReader(bsl::streambuf        *streamBuf,
+                           Format                 format,
+                           const DecoderOptions&  options,
+                           bslma::Allocator      *basicAllocator)
+: d_streamBuf_p(streamBuf)
+, d_format(format)
+, d_state(e_BEFORE_ARRAY)
+, d_options(options)
+, d_decoder(basicAllocator)
+, d_buffer(k_BUFFER_SIZE, '\0', basicAllocator)
+, d_position(0)
+, d_length(0)
+, d_element(basicAllocator)
+, d_numElementsRead(0)
+, d_lineNumber(0)
+, d_logStream(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(streamBuf);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,590 @@
+// baljsn_streamreader.h                                              -*-C++-*-
+#ifndef INCLUDED_BALJSN_STREAMREADER
+#define INCLUDED_BALJSN_STREAMREADER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a pull-style reader of JSON arrays and NDJSON streams.
+//
+//@CLASSES:
+//  baljsn::StreamReader: read elements of a JSON array or NDJSON one by one
+//
+//@SEE_ALSO: baljsn_decoder, baljsn_decoderoptions
+//
+//@DESCRIPTION: This component provides a class, 'baljsn::StreamReader', that
+// reads a sequence of JSON values from a 'bsl::streambuf' one at a time,
+// decoding each into a 'bdeat'-compatible object supplied by the caller.  Two
+// input formats are supported:
+//
+//: 'e_ARRAY':  a single top-level JSON array, whose elements are read in order
+//:
+//: 'e_NDJSON': newline-delimited JSON, in which each non-blank line holds one
+//:             value
+//
+// 'baljsn::Decoder::decode' requires the whole top-level value of its input to
+// be decoded into a single object; a file holding millions of records in one
+// array therefore needs an object holding millions of records.  A
+// 'StreamReader' instead extracts the text of one element at a time into an
+// internal buffer and decodes it with a 'baljsn::Decoder', so the memory it
+// uses is bounded by the size of the largest element, independent of the size
+// of the input.  The object passed to 'readNext' may be reused for every
+// element.
+//
+// As for 'baljsn::Decoder', each element must be decoded into a sequence,
+// choice, or array type (or a dynamic type referring to one).
+//
+///Error Handling
+///--------------
+// 'readNext' returns 0 when it has loaded an element, a positive value when
+// the input holds no further elements, and a negative value on error:
+//
+//: o A structural error (e.g., input that does not begin with '[' in
+//:   'e_ARRAY' format, or an unterminated element) is reported by -1, and
+//:   every subsequent call also fails.
+//:
+//: o A failure to decode an element whose extent was determined is reported
+//:   by -2; reading may continue with the next element.
+//
+// In either case 'loggedMessages' describes the error, including the index of
+// the failing element ('e_ARRAY') or its line number ('e_NDJSON').
+//
+///Parallel Decoding
+///-----------------
+// For 'e_NDJSON' input, 'readAllInParallel' splits the input at newlines into
+// chunks of a specified number of lines, decodes the chunks concurrently as
+// jobs on a 'bdlmt::FixedThreadPool', and passes the decoded elements to a
+// consumer on the calling thread in input order.  At most twice as many
+// chunks as the pool has threads are in memory at once, so memory use remains
+// bounded.  Decoding stops at the first element that fails to decode; all
+// elements preceding it are passed to the consumer.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading the Records of a Large Array
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a JSON file holding a large array of employee records,
+// which we want to process one at a time without holding all of them in
+// memory.
+//
+// First, we create a stream buffer over the input (here, a small literal):
+//..
+//  const char INPUT[] =
+//      "[\n"
+//      "  {\"name\":\"Bob\",\"age\":21},\n"
+//      "  {\"name\":\"Ann\",\"age\":42}\n"
+//      "]\n";
+//
+//  bdlsb::FixedMemInStreamBuf streamBuf(INPUT, sizeof INPUT - 1);
+//..
+// Then, we create a 'baljsn::StreamReader' reading the elements of an array
+// from the stream buffer:
+//..
+//  baljsn::StreamReader reader(&streamBuf, baljsn::StreamReader::e_ARRAY);
+//..
+// Next, we read the records into a single 'Employee' object in turn, until
+// 'readNext' indicates the end of the array:
+//..
+//  s_baltst::Employee employee;
+//  int                totalAge = 0;
+//  int                rc;
+//
+//  while (0 == (rc = reader.readNext(&employee))) {
+//      totalAge += employee.age();
+//  }
+//..
+// Finally, we verify that every record was read and that the input was
+// well-formed:
+//..
+//  assert(0  <  rc);
+//  assert(63 == totalAge);
+//  assert(2  == reader.numElementsRead());
+//..
+
+#include <balscm_version.h>
+
+#include <baljsn_decoder.h>
+#include <baljsn_decoderoptions.h>
+
+#include <bdlmt_fixedthreadpool.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_latch.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
+#include <bsl_sstream.h>
+#include <bsl_streambuf.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace baljsn {
+
+                         // =========================
+                         // struct StreamReader_Chunk
+                         // =========================
+
+template <class TYPE>
+struct StreamReader_Chunk {
+    // This component-private 'struct' holds a chunk of NDJSON lines and the
+    // elements decoded from them during a call to
+    // 'StreamReader::readAllInParallel'.  The decoded objects are retained
+    // between chunks so that they may be reused.
+
+    // DATA
+    bsl::string       d_text;         // complete lines of input
+    bsl::size_t       d_firstLine;    // line number of the first line
+    bsl::vector<TYPE> d_elements;     // decoded elements (reused)
+    bsl::size_t       d_numElements;  // number of elements decoded
+    int               d_status;       // 0, or status of the failing line
+    bsl::string       d_messages;     // description of the failure
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(StreamReader_Chunk,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit StreamReader_Chunk(bslma::Allocator *basicAllocator = 0);
+        // Create an empty chunk.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    StreamReader_Chunk(const StreamReader_Chunk&  original,
+                       bslma::Allocator          *basicAllocator = 0);
+        // Create a chunk having the value of the specified 'original' chunk.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+};
+
+                      // ===============================
+                      // struct StreamReader_DecodeChunk
+                      // ===============================
+
+template <class TYPE>
+struct StreamReader_DecodeChunk {
+    // This component-private 'struct' is a thread-pool job that decodes each
+    // non-blank line of a chunk of NDJSON input into the elements of the
+    // chunk, and then arrives at a latch.
+
+    // DATA
+    StreamReader_Chunk<TYPE> *d_chunk_p;    // chunk to decode
+    const DecoderOptions     *d_options_p;  // decoding options
+    bslmt::Latch             *d_latch_p;    // latch arrived at when done
+
+    // ACCESSORS
+    void operator()() const;
+        // Decode the lines of the chunk, recording the number of elements
+        // decoded and, on failure, the status and description of the first
+        // line that failed to decode; then arrive at the latch.
+};
+
+                        // ===========================
+                        // struct StreamReader_ImpUtil
+                        // ===========================
+
+struct StreamReader_ImpUtil {
+    // This component-private utility 'struct' provides functions used by the
+    // templates of this component.
+
+    // CLASS METHODS
+    static bool isBlank(const char *begin, const char *end);
+        // Return 'true' if the characters in the specified range
+        // '[ begin, end )' are all whitespace, and 'false' otherwise.
+
+    static void logLineError(bsl::string             *messages,
+                             bsl::size_t              lineNumber,
+                             const bsl::string&       decoderMessages);
+        // Load into the specified 'messages' a description of the failure to
+        // decode the line having the specified 'lineNumber', as described by
+        // the specified 'decoderMessages'.
+};
+
+                             // ==================
+                             // class StreamReader
+                             // ==================
+
+class StreamReader {
+    // This class provides a mechanism for reading the elements of a JSON
+    // array, or the values of an NDJSON stream, one at a time from a
+    // 'bsl::streambuf', decoding each into a 'bdeat'-compatible object.
+
+  public:
+    // TYPES
+    enum Format {
+        // Enumerate the supported input formats.
+
+        e_ARRAY,   // a single top-level JSON array
+        e_NDJSON   // newline-delimited JSON values
+    };
+
+  private:
+    // PRIVATE TYPES
+    enum State {
+        // Enumerate the states of an 'e_ARRAY' format reader.
+
+        e_BEFORE_ARRAY,    // '[' not yet read
+        e_FIRST_ELEMENT,   // '[' read; no element read
+        e_NEXT_ELEMENT,    // at least one element read
+        e_END,             // no further elements
+        e_FAILED           // a structural error occurred
+    };
+
+    enum {
+        k_BUFFER_SIZE = 8192  // size of each read from the stream buffer
+    };
+
+    // DATA
+    bsl::streambuf     *d_streamBuf_p;       // input (held, not owned)
+    Format              d_format;            // input format
+    State               d_state;             // current state
+    DecoderOptions      d_options;           // options for decoding elements
+    Decoder             d_decoder;           // decoder for each element
+    bsl::vector<char>   d_buffer;            // input read from 'd_streamBuf_p'
+    bsl::size_t         d_position;          // next unread position in buffer
+    bsl::size_t         d_length;            // number of valid buffer bytes
+    bsl::string         d_element;           // text of the current element
+    bsl::size_t         d_numElementsRead;   // elements read so far
+    bsl::size_t         d_lineNumber;        // lines read so far ('e_NDJSON')
+    bsl::ostringstream  d_logStream;         // messages for the last read
+    bslma::Allocator   *d_allocator_p;       // memory allocator (held)
+
+  private:
+    // NOT IMPLEMENTED
+    StreamReader(const StreamReader&);
+    StreamReader& operator=(const StreamReader&);
+
+    // PRIVATE MANIPULATORS
+    int loadNextArrayElement();
+        // Load into 'd_element' the text of the next element of the array.
+        // Return 0 on success, a positive value if the array has no further
+        // elements, and -1 (after logging a description) on a structural
+        // error.
+
+    int loadNextLine();
+        // Load into 'd_element' the next non-blank line of the input.  Return
+        // 0 on success, and a positive value if the input has no further
+        // non-blank lines.
+
+    int loadValue();
+        // Append to 'd_element' the text of the JSON value beginning at the
+        // next unread character of the input.  Return 0 on success, and a
+        // non-zero value if the input ends before the value does.
+
+    void logDecodeError();
+        // Log a description of the failure of 'd_decoder' to decode the
+        // current element.
+
+    int peekNonSpace();
+        // Skip whitespace in the input, and return the next unread character
+        // without consuming it, or a negative value if the input has ended.
+
+    bsl::size_t readLines(bsl::string *text, bsl::size_t maxLines);
+        // Append to the specified 'text' at most the specified 'maxLines'
+        // lines of input, including their terminating newlines, and return
+        // the number of lines appended.  A final line lacking a terminating
+        // newline is counted as a line.
+
+    bool refill();
+        // Read more input into the buffer if every byte in it has been
+        // consumed.  Return 'true' if the buffer holds an unread byte, and
+        // 'false' if the input has ended.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(StreamReader, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    StreamReader(bsl::streambuf   *streamBuf,
+                 Format            format,
+                 bslma::Allocator *basicAllocator = 0);
+    StreamReader(bsl::streambuf        *streamBuf,
+                 Format                 format,
+                 const DecoderOptions&  options,
+                 bslma::Allocator      *basicAllocator = 0);
+        // Create a reader of values in the specified 'format' from the
+        // specified 'streamBuf', decoding each using the optionally specified
+        // 'options'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless 'streamBuf'
+        // remains valid, and is not read by any other means, for the lifetime
+        // of this object.
+
+    // MANIPULATORS
+    template <class TYPE>
+    int readNext(TYPE *value);
+        // Read the next element from the input and decode it into the
+        // specified 'value', of (template parameter) 'TYPE'.  Return 0 on
+        // success, a positive value if the input holds no further elements,
+        // -1 on a structural error in the input (after which every call
+        // fails), and -2 if the element could not be decoded into 'value'
+        // (after which reading may continue with the next element).  'TYPE'
+        // shall be a 'bdeat'-compatible sequence, choice, or array type, or a
+        // 'bdeat'-compatible dynamic type referring to one of those types.
+        // Note that the value of '*value' is unspecified after a failure.
+
+    template <class TYPE, class CONSUMER>
+    int readAllInParallel(CONSUMER                 consumer,
+                          bdlmt::FixedThreadPool  *threadPool,
+                          bsl::size_t              linesPerChunk = 1024);
+        // Read the remaining lines of the NDJSON input in chunks of the
+        // optionally specified 'linesPerChunk' lines, decode the non-blank
+        // lines of each chunk into objects of (template parameter) 'TYPE' as
+        // a job on the specified 'threadPool', and invoke the specified
+        // 'consumer' as 'consumer(&element)' for each decoded 'element', on
+        // the calling thread and in input order.  Return 0 if every remaining
+        // line was decoded and consumed, and -2 if a line could not be
+        // decoded, in which case 'consumer' has been invoked for every element
+        // preceding it and no later element.  At most '2 *
+        // threadPool->numThreads()' chunks are held at once.  The consumer
+        // may modify (e.g., swap from) the element it is passed.  The
+        // behavior is undefined unless this reader has 'e_NDJSON' format,
+        // 'threadPool' has been started, and '0 < linesPerChunk'.  Note that
+        // a job that 'threadPool' does not accept is run on the calling
+        // thread.
+
+    // ACCESSORS
+    Format format() const;
+        // Return the format of the input read by this object.
+
+    bsl::string loggedMessages() const;
+        // Return a string describing any error that occurred during the last
+        // call to 'readNext' or 'readAllInParallel'.
+
+    bsl::size_t numElementsRead() const;
+        // Return the number of elements read so far, including any element
+        // that could not be decoded.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                         // -------------------------
+                         // struct StreamReader_Chunk
+                         // -------------------------
+
+// CREATORS
+template <class TYPE>
+StreamReader_Chunk<TYPE>::StreamReader_Chunk(bslma::Allocator *basicAllocator)
+: d_text(basicAllocator)
+, d_firstLine(0)
+, d_elements(basicAllocator)
+, d_numElements(0)
+, d_status(0)
+, d_messages(basicAllocator)
+{
+}
+
+template <class TYPE>
+StreamReader_Chunk<TYPE>::StreamReader_Chunk(
+                                  const StreamReader_Chunk&  original,
+                                  bslma::Allocator          *basicAllocator)
+: d_text(original.d_text, basicAllocator)
+, d_firstLine(original.d_firstLine)
+, d_elements(original.d_elements, basicAllocator)
+, d_numElements(original.d_numElements)
+, d_status(original.d_status)
+, d_messages(original.d_messages, basicAllocator)
+{
+}
+
+                      // -------------------------------
+                      // struct StreamReader_DecodeChunk
+                      // -------------------------------
+
+// ACCESSORS
+template <class TYPE>
+void StreamReader_DecodeChunk<TYPE>::operator()() const
+{
+    StreamReader_Chunk<TYPE>& chunk = *d_chunk_p;
+
+    chunk.d_numElements = 0;
+    chunk.d_status      = 0;
+    chunk.d_messages.clear();
+
+    Decoder     decoder(chunk.d_text.get_allocator().mechanism());
+    bsl::size_t lineNumber = chunk.d_firstLine;
+    const char *cursor     = chunk.d_text.data();
+    const char *end        = cursor + chunk.d_text.length();
+
+    while (cursor < end) {
+        const char *eol = static_cast<const char *>(
+                                     bsl::memchr(cursor, '\n', end - cursor));
+        if (!eol) {
+            eol = end;
+        }
+
+        if (!StreamReader_ImpUtil::isBlank(cursor, eol)) {
+            if (chunk.d_numElements == chunk.d_elements.size()) {
+                chunk.d_elements.resize(chunk.d_numElements + 1);
+            }
+
+            bdlsb::FixedMemInStreamBuf streamBuf(cursor, eol - cursor);
+            if (0 != decoder.decode(&streamBuf,
+                                    &chunk.d_elements[chunk.d_numElements],
+                                    *d_options_p)) {
+                chunk.d_status = -2;
+                StreamReader_ImpUtil::logLineError(&chunk.d_messages,
+                                                   lineNumber,
+                                                   decoder.loggedMessages());
+                break;
+            }
+            ++chunk.d_numElements;
+        }
+
+        cursor = eol + 1;
+        ++lineNumber;
+    }
+
+    d_latch_p->arrive();
+}
+
+                             // ------------------
+                             // class StreamReader
+                             // ------------------
+
+// MANIPULATORS
+template <class TYPE>
+int StreamReader::readNext(TYPE *value)
+{
+    BSLS_ASSERT(value);
+
+    d_logStream.clear();
+    d_logStream.str("");
+
+    const int rc = e_NDJSON == d_format ? loadNextLine()
+                                        : loadNextArrayElement();
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    ++d_numElementsRead;
+
+    bdlsb::FixedMemInStreamBuf streamBuf(d_element.data(),
+                                         d_element.length());
+    if (0 != d_decoder.decode(&streamBuf, value, d_options)) {
+        logDecodeError();
+        return -2;                                                    // RETURN
+    }
+    return 0;
+}
+
+template <class TYPE, class CONSUMER>
+int StreamReader::readAllInParallel(CONSUMER                 consumer,
+                                    bdlmt::FixedThreadPool  *threadPool,
+                                    bsl::size_t              linesPerChunk)
+{
+    BSLS_ASSERT(threadPool);
+    BSLS_ASSERT(e_NDJSON == d_format);
+    BSLS_ASSERT(0 < linesPerChunk);
+
+    typedef StreamReader_Chunk<TYPE> Chunk;
+
+    d_logStream.clear();
+    d_logStream.str("");
+
+    const bsl::size_t  maxChunks = 2 * threadPool->numThreads();
+    bsl::vector<Chunk> chunks(d_allocator_p);
+    chunks.resize(maxChunks);
+
+    while (true) {
+        bsl::size_t numChunks = 0;
+        while (numChunks < maxChunks) {
+            Chunk& chunk = chunks[numChunks];
+
+            chunk.d_text.clear();
+            chunk.d_firstLine = d_lineNumber + 1;
+
+            const bsl::size_t numLines = readLines(&chunk.d_text,
+                                                   linesPerChunk);
+            if (0 == numLines) {
+                break;
+            }
+            d_lineNumber += numLines;
+            ++numChunks;
+        }
+
+        if (0 == numChunks) {
+            d_state = e_END;
+            return 0;                                                 // RETURN
+        }
+
+        bslmt::Latch latch(static_cast<int>(numChunks));
+        for (bsl::size_t i = 0; i < numChunks; ++i) {
+            StreamReader_DecodeChunk<TYPE> job = { &chunks[i],
+                                                   &d_options,
+                                                   &latch };
+            if (0 != threadPool->enqueueJob(job)) {
+                job();
+            }
+        }
+        latch.wait();
+
+        for (bsl::size_t i = 0; i < numChunks; ++i) {
+            Chunk& chunk = chunks[i];
+            for (bsl::size_t j = 0; j < chunk.d_numElements; ++j) {
+                consumer(&chunk.d_elements[j]);
+            }
+            d_numElementsRead += chunk.d_numElements;
+
+            if (0 != chunk.d_status) {
+                ++d_numElementsRead;
+                d_logStream << chunk.d_messages;
+                d_state = e_FAILED;
+                return chunk.d_status;                                // RETURN
+            }
+        }
+    }
+}
+
+// ACCESSORS
+inline
+StreamReader::Format StreamReader::format() const
+{
+    return d_format;
+}
+
+inline
+bsl::string StreamReader::loggedMessages() const
+{
+    return d_logStream.str();
+}
+
+inline
+bsl::size_t StreamReader::numElementsRead() const
+{
+    return d_numElementsRead;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
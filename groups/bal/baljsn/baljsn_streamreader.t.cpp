@@ -0,0 +1,1070 @@
+// baljsn_streamreader.t.cpp                                          -*-C++-*-
+#include <baljsn_streamreader.h>
+
+#include <baljsn_decoder.h>
+#include <baljsn_decoderoptions.h>
+
+#include <s_baltst_address.h>
+#include <s_baltst_employee.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlmt_fixedthreadpool.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_sstream.h>
+#include <bsl_streambuf.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a mechanism that reads the elements of a JSON
+// array, or the values of an NDJSON stream, one at a time.  We verify, using
+// tables of inputs read both from a contiguous stream buffer and from one that
+// supplies a single character per read (so that every element straddles
+// buffer refills), that elements are extracted and decoded in order, and that
+// structural and decoding errors are reported as documented.  We then verify,
+// using a stream buffer that generates records on demand, that memory use is
+// independent of the number of elements, and that the parallel mode delivers
+// every element in input order and stops at the first decoding failure.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] StreamReader(streamBuf, format, basicAllocator);
+// [ 2] StreamReader(streamBuf, format, options, basicAllocator);
+//
+// MANIPULATORS
+// [ 2] int readNext(TYPE *value);
+// [ 5] int readAllInParallel(CONSUMER, FixedThreadPool *, size_t);
+//
+// ACCESSORS
+// [ 2] Format format() const;
+// [ 2] bsl::string loggedMessages() const;
+// [ 2] bsl::size_t numElementsRead() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] NDJSON FORMAT
+// [ 4] LARGE INPUT AND BOUNDED MEMORY
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef baljsn::StreamReader Obj;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                          HELPER CLASSES AND FUNCTIONS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+                           // ======================
+                           // class TrickleStreamBuf
+                           // ======================
+
+class TrickleStreamBuf : public bsl::streambuf {
+    // This class provides input from a string, supplying at most one
+    // character for each read.
+
+    // DATA
+    const char *d_current_p;  // next character to supply
+    const char *d_end_p;      // end of input
+
+  protected:
+    // PROTECTED MANIPULATORS
+    int_type underflow()
+        // Return the next character without consuming it, or 'eof()'.
+    {
+        return d_current_p < d_end_p ? traits_type::to_int_type(*d_current_p)
+                                     : traits_type::eof();
+    }
+
+    int_type uflow()
+        // Return and consume the next character, or return 'eof()'.
+    {
+        return d_current_p < d_end_p
+               ? traits_type::to_int_type(*d_current_p++)
+               : traits_type::eof();
+    }
+
+    bsl::streamsize xsgetn(char *buffer, bsl::streamsize length)
+        // Load into the specified 'buffer' at most one of the specified
+        // 'length' characters requested, and return the number loaded.
+    {
+        if (0 < length && d_current_p < d_end_p) {
+            *buffer = *d_current_p++;
+            return 1;                                                 // RETURN
+        }
+        return 0;
+    }
+
+  public:
+    // CREATORS
+    explicit TrickleStreamBuf(const bsl::string& input)
+        // Create a stream buffer supplying the specified 'input'.
+    : d_current_p(input.data())
+    , d_end_p(input.data() + input.length())
+    {
+    }
+};
+
+                           // =====================
+                           // class RecordStreamBuf
+                           // =====================
+
+class RecordStreamBuf : public bsl::streambuf {
+    // This class generates, on demand, a JSON array or NDJSON stream of a
+    // specified number of employee records, the age of each of which is its
+    // index, so that arbitrarily large inputs may be read without being held
+    // in memory.
+
+    // DATA
+    bsl::string d_chunk;       // text currently supplied
+    int         d_next;        // index of the next record to generate
+    int         d_numRecords;  // number of records to generate
+    bool        d_isArray;     // 'true' for 'e_ARRAY' format
+    bool        d_done;        // 'true' once the input is complete
+
+  protected:
+    // PROTECTED MANIPULATORS
+    int_type underflow()
+        // Generate the next record (or the array punctuation) and return its
+        // first character, or return 'eof()' if the input is complete.
+    {
+        if (gptr() < egptr()) {
+            return traits_type::to_int_type(*gptr());                 // RETURN
+        }
+        if (d_done) {
+            return traits_type::eof();                                // RETURN
+        }
+
+        d_chunk.clear();
+        if (d_next < d_numRecords) {
+            if (d_isArray) {
+                d_chunk += 0 == d_next ? "[" : ",";
+            }
+            bsl::ostringstream stream;
+            stream << "{\"name\":\"Employee " << d_next << "\","
+                   << "\"homeAddress\":{\"street\":\"Main St\","
+                   << "\"city\":\"Springfield\",\"state\":\"IL\"},"
+                   << "\"age\":" << d_next << "}\n";
+            d_chunk += stream.str();
+            ++d_next;
+        }
+        else {
+            d_chunk = !d_isArray ? "" : 0 == d_numRecords ? "[]" : "]";
+            d_done  = true;
+            if (d_chunk.empty()) {
+                return traits_type::eof();                            // RETURN
+            }
+        }
+
+        char *begin = &d_chunk[0];
+        setg(begin, begin, begin + d_chunk.length());
+        return traits_type::to_int_type(*begin);
+    }
+
+  public:
+    // CREATORS
+    RecordStreamBuf(int numRecords, bool isArray)
+        // Create a stream buffer generating the specified 'numRecords'
+        // records, as a JSON array if the specified 'isArray' is 'true', and
+        // as NDJSON otherwise.
+    : d_next(0)
+    , d_numRecords(numRecords)
+    , d_isArray(isArray)
+    , d_done(false)
+    {
+    }
+};
+
+bsl::string readAll(Obj *reader, bslma::Allocator *allocator)
+    // Read every element from the specified 'reader' into a
+    // 'bsl::vector<int>' and return a description of the results: "[...]"
+    // for each element decoded, "D" for each element that could not be
+    // decoded, and, finally, "E" for the end of input or "S" for a structural
+    // error.  Use the specified 'allocator' to supply memory.
+{
+    bsl::string      result(allocator);
+    bsl::vector<int> value(allocator);
+
+    while (true) {
+        const int rc = reader->readNext(&value);
+        if (0 < rc) {
+            return result + "E";                                      // RETURN
+        }
+        if (-1 == rc) {
+            return result + "S";                                      // RETURN
+        }
+        if (-2 == rc) {
+            result += "D";
+            continue;
+        }
+        ASSERTV(rc, 0 == rc);
+
+        result += '[';
+        for (bsl::size_t i = 0; i < value.size(); ++i) {
+            if (i) {
+                result += ',';
+            }
+            result += bsl::to_string(value[i]);
+        }
+        result += ']';
+    }
+}
+
+struct AgeCollector {
+    // This 'struct' provides a consumer for 'readAllInParallel' that appends
+    // the age of each employee to a vector.
+
+    bsl::vector<int> *d_ages_p;
+
+    void operator()(s_baltst::Employee *employee) const
+        // Append the age of the specified 'employee' to the vector.
+    {
+        d_ages_p->push_back(employee->age());
+    }
+};
+
+bool isSequence(const bsl::vector<int>& values, int length)
+    // Return 'true' if the specified 'values' are the integers from 0 to the
+    // specified 'length' (exclusive) in order, and 'false' otherwise.
+{
+    if (values.size() != static_cast<bsl::size_t>(length)) {
+        return false;                                                 // RETURN
+    }
+    for (int i = 0; i < length; ++i) {
+        if (values[i] != i) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading the Records of a Large Array
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a JSON file holding a large array of employee records,
+// which we want to process one at a time without holding all of them in
+// memory.
+//
+// First, we create a stream buffer over the input (here, a small literal):
+//..
+    const char INPUT[] =
+        "[\n"
+        "  {\"name\":\"Bob\",\"age\":21},\n"
+        "  {\"name\":\"Ann\",\"age\":42}\n"
+        "]\n";
+
+    bdlsb::FixedMemInStreamBuf streamBuf(INPUT, sizeof INPUT - 1);
+//..
+// Then, we create a 'baljsn::StreamReader' reading the elements of an array
+// from the stream buffer:
+//..
+    baljsn::StreamReader reader(&streamBuf, baljsn::StreamReader::e_ARRAY);
+//..
+// Next, we read the records into a single 'Employee' object in turn, until
+// 'readNext' indicates the end of the array:
+//..
+    s_baltst::Employee employee;
+    int                totalAge = 0;
+    int                rc;
+
+    while (0 == (rc = reader.readNext(&employee))) {
+        totalAge += employee.age();
+    }
+//..
+// Finally, we verify that every record was read and that the input was
+// well-formed:
+//..
+    ASSERT(0  <  rc);
+    ASSERT(63 == totalAge);
+    ASSERT(2  == reader.numElementsRead());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // PARALLEL DECODING
+        //
+        // Concerns:
+        //: 1 Every element is passed to the consumer, on the calling thread,
+        //:   in input order, for any number of lines per chunk.
+        //:
+        //: 2 Blank lines are skipped but counted in line numbers.
+        //:
+        //: 3 On a decoding failure, exactly the preceding elements are passed
+        //:   to the consumer, -2 is returned, the failing line is identified
+        //:   in 'loggedMessages', and later reads fail.
+        //
+        // Plan:
+        //: 1 Decode generated NDJSON input of several sizes on a thread pool
+        //:   with several chunk sizes, collecting the ages of the employees,
+        //:   and verify that they are in order.  (C-1)
+        //:
+        //: 2 Decode input having blank lines and an invalid line, with
+        //:   several chunk sizes, and verify the elements consumed, the
+        //:   status, and the message.  (C-2..3)
+        //
+        // Testing:
+        //   int readAllInParallel(CONSUMER, FixedThreadPool *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PARALLEL DECODING" << endl
+                          << "=================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        bdlmt::FixedThreadPool threadPool(4, 64, &ta);
+        ASSERT(0 == threadPool.start());
+
+        const int         NUM_RECORDS[] = { 0, 1, 9, 1000 };
+        const bsl::size_t CHUNK_SIZES[] = { 1, 7, 100, 100000 };
+
+        if (verbose) cout << "\nOrder of generated input." << endl;
+
+        for (int ri = 0; ri < 4; ++ri) {
+            for (int ci = 0; ci < 4; ++ci) {
+                const int         N     = NUM_RECORDS[ri];
+                const bsl::size_t CHUNK = CHUNK_SIZES[ci];
+
+                if (veryVerbose) { T_ P_(N) P(CHUNK) }
+
+                RecordStreamBuf  streamBuf(N, false);
+                Obj              reader(&streamBuf, Obj::e_NDJSON, &ta);
+                bsl::vector<int> ages;
+                AgeCollector     collector = { &ages };
+
+                const int rc = reader.readAllInParallel<s_baltst::Employee>(
+                                                                  collector,
+                                                                  &threadPool,
+                                                                  CHUNK);
+                ASSERTV(N, CHUNK, rc, 0 == rc);
+                ASSERTV(N, CHUNK, isSequence(ages, N));
+                ASSERTV(N, CHUNK, reader.numElementsRead(),
+                        static_cast<bsl::size_t>(N) ==
+                                                     reader.numElementsRead());
+
+                s_baltst::Employee employee;
+                ASSERTV(N, CHUNK, 0 < reader.readNext(&employee));
+            }
+        }
+
+        if (verbose) cout << "\nBlank lines and failure." << endl;
+
+        bsl::string input;
+        for (int i = 0; i < 50; ++i) {
+            if (0 == i % 10) {
+                input += "\n  \r\n";
+            }
+            input += "{\"name\":\"E\",\"age\":" + bsl::to_string(i) + "}\n";
+        }
+        const bsl::size_t BAD_LINE =
+                       bsl::count(input.begin(), input.end(), '\n') + 1;
+        input += "{\"name\":\"E\",\"age\":\"x\"}\n";
+        input += "{\"name\":\"E\",\"age\":51}\n";
+
+        for (int ci = 0; ci < 4; ++ci) {
+            const bsl::size_t CHUNK = CHUNK_SIZES[ci];
+
+            if (veryVerbose) { T_ P(CHUNK) }
+
+            bdlsb::FixedMemInStreamBuf streamBuf(input.data(),
+                                                 input.length());
+            Obj                        reader(&streamBuf, Obj::e_NDJSON, &ta);
+            bsl::vector<int>           ages;
+            AgeCollector               collector = { &ages };
+
+            const int rc = reader.readAllInParallel<s_baltst::Employee>(
+                                                                  collector,
+                                                                  &threadPool,
+                                                                  CHUNK);
+            ASSERTV(CHUNK, rc, -2 == rc);
+            ASSERTV(CHUNK, isSequence(ages, 50));
+            ASSERTV(CHUNK, reader.numElementsRead(),
+                    51 == reader.numElementsRead());
+
+            const bsl::string MESSAGE = "line " + bsl::to_string(BAD_LINE);
+            ASSERTV(CHUNK, reader.loggedMessages(),
+                    bsl::string::npos != reader.loggedMessages().find(
+                                                                   MESSAGE));
+
+            s_baltst::Employee employee;
+            ASSERTV(CHUNK, -1 == reader.readNext(&employee));
+        }
+
+        threadPool.stop();
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // LARGE INPUT AND BOUNDED MEMORY
+        //
+        // Concerns:
+        //: 1 Every element of large inputs is read, in order, into a single
+        //:   reused object.
+        //:
+        //: 2 The memory used by the reader does not depend on the number of
+        //:   elements.
+        //:
+        //: 3 An element larger than the internal buffer is read correctly.
+        //
+        // Plan:
+        //: 1 Read generated inputs of 100 and 10000 employee records, in each
+        //:   format, into one 'Employee', and verify each record.  Verify
+        //:   that the peak memory used by the reader is the same for both
+        //:   sizes.  (C-1..2)
+        //:
+        //: 2 Read an array holding an element having a 100000-character
+        //:   string.  (C-3)
+        //
+        // Testing:
+        //   LARGE INPUT AND BOUNDED MEMORY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LARGE INPUT AND BOUNDED MEMORY" << endl
+                          << "==============================" << endl;
+
+        for (int fi = 0; fi < 2; ++fi) {
+            const bool IS_ARRAY = 0 == fi;
+
+            bsls::Types::Int64 peakBytes[2];
+
+            for (int si = 0; si < 2; ++si) {
+                const int N = 0 == si ? 100 : 10000;
+
+                if (veryVerbose) { T_ P_(IS_ARRAY) P(N) }
+
+                bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+                RecordStreamBuf streamBuf(N, IS_ARRAY);
+                Obj             reader(&streamBuf,
+                                       IS_ARRAY ? Obj::e_ARRAY : Obj::e_NDJSON,
+                                       &ta);
+
+                s_baltst::Employee employee;
+                int                i = 0;
+                int                rc;
+                while (0 == (rc = reader.readNext(&employee))) {
+                    ASSERTV(i, employee.age(), i == employee.age());
+                    ASSERTV(i, employee.homeAddress().city(),
+                            "Springfield" == employee.homeAddress().city());
+                    ++i;
+                }
+                ASSERTV(IS_ARRAY, N, rc, reader.loggedMessages(), 0 < rc);
+                ASSERTV(IS_ARRAY, N, i, N == i);
+
+                peakBytes[si] = ta.numBytesMax();
+            }
+
+            ASSERTV(IS_ARRAY, peakBytes[0], peakBytes[1],
+                    peakBytes[0] == peakBytes[1]);
+        }
+
+        {
+            const bsl::string NAME(100000, 'x');
+            const bsl::string INPUT = "[{\"name\":\"" + NAME + "\"},"
+                                      "{\"name\":\"short\"}]";
+
+            bdlsb::FixedMemInStreamBuf streamBuf(INPUT.data(),
+                                                 INPUT.length());
+            Obj                        reader(&streamBuf, Obj::e_ARRAY);
+
+            s_baltst::Employee employee;
+            ASSERT(0 == reader.readNext(&employee));
+            ASSERT(NAME == employee.name());
+            ASSERT(0 == reader.readNext(&employee));
+            ASSERT("short" == employee.name());
+            ASSERT(0 < reader.readNext(&employee));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // NDJSON FORMAT
+        //
+        // Concerns:
+        //: 1 Each non-blank line is read as one element, whether terminated
+        //:   by "\n", by "\r\n", or by the end of input.
+        //:
+        //: 2 Blank lines, including lines of whitespace, are skipped.
+        //:
+        //: 3 A line that cannot be decoded is reported, identifying its line
+        //:   number, and reading continues with the next line.
+        //
+        // Plan:
+        //: 1 Using a table of inputs and the expected results of reading
+        //:   every element, read each input from both a contiguous and a
+        //:   trickling stream buffer and verify the results.  (C-1..3)
+        //:
+        //: 2 Verify the line number reported for an invalid line.  (C-3)
+        //
+        // Testing:
+        //   NDJSON FORMAT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "NDJSON FORMAT" << endl
+                          << "=============" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_input;
+            const char *d_expected;
+        } DATA[] = {
+            //LINE  INPUT                            EXPECTED
+            //----  -----                            --------
+            { L_,   "",                              "E"                 },
+            { L_,   "\n\n  \n",                      "E"                 },
+            { L_,   "[1]",                           "[1]E"              },
+            { L_,   "[1]\n",                         "[1]E"              },
+            { L_,   "[1]\r\n[2,3]\r\n",              "[1][2,3]E"         },
+            { L_,   "\n[1]\n\n \t\n[2]",             "[1][2]E"           },
+            { L_,   " [ 1 , 2 ] \n",                 "[1,2]E"            },
+            { L_,   "[1]\nx\n[2]\n",                 "[1]D[2]E"          },
+            { L_,   "[1]\n{\"a\":1}\n[2]\n",         "[1]D[2]E"          },
+            { L_,   "[1]\n[2\n[3]\n",                "[1]D[3]E"          },
+        };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const bsl::string INPUT    = DATA[ti].d_input;
+            const char *const EXPECTED = DATA[ti].d_expected;
+
+            if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+            bdlsb::FixedMemInStreamBuf memBuf(INPUT.data(), INPUT.length());
+            TrickleStreamBuf           trickleBuf(INPUT);
+
+            bsl::streambuf *const STREAM_BUFS[] = { &memBuf, &trickleBuf };
+
+            for (int bi = 0; bi < 2; ++bi) {
+                bslma::TestAllocator         da("default",
+                                                veryVeryVeryVerbose);
+                bslma::DefaultAllocatorGuard guard(&da);
+
+                bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+                Obj reader(STREAM_BUFS[bi], Obj::e_NDJSON, &ta);
+                ASSERTV(LINE, Obj::e_NDJSON == reader.format());
+
+                const bsl::string result = readAll(&reader, &ta);
+                ASSERTV(LINE, bi, result, EXPECTED == result);
+
+                bsl::vector<int> value(&ta);
+                ASSERTV(LINE, bi, 0 < reader.readNext(&value));
+            }
+        }
+
+        {
+            const bsl::string INPUT = "[1]\n\n[2]\n[x]\n[3]\n";
+
+            bdlsb::FixedMemInStreamBuf streamBuf(INPUT.data(),
+                                                 INPUT.length());
+            Obj                        reader(&streamBuf, Obj::e_NDJSON);
+
+            bsl::vector<int> value;
+            ASSERT(0  == reader.readNext(&value));
+            ASSERT(0  == reader.readNext(&value));
+            ASSERT(-2 == reader.readNext(&value));
+            ASSERTV(reader.loggedMessages(),
+                    bsl::string::npos != reader.loggedMessages().find(
+                                                                   "line 4"));
+            ASSERT(3  == reader.numElementsRead());
+            ASSERT(0  == reader.readNext(&value));
+            ASSERT(reader.loggedMessages().empty());
+            ASSERT(1  == value.size() && 3 == value[0]);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // ARRAY FORMAT
+        //
+        // Concerns:
+        //: 1 The elements of a top-level array are read in order, regardless
+        //:   of whitespace, of brackets and escaped quotes within strings, and
+        //:   of how the stream buffer supplies its input.
+        //:
+        //: 2 An element that cannot be decoded is reported by -2, and reading
+        //:   continues with the next element.
+        //:
+        //: 3 Structural errors (missing '[', missing or extra separators, an
+        //:   unterminated element, and data following the array) are reported
+        //:   by -1, and every subsequent read also fails.
+        //:
+        //: 4 No memory is allocated from the default allocator, except to
+        //:   retrieve the decoder's description of a decoding failure.
+        //:
+        //: 5 The decoder options are used to decode each element.
+        //
+        // Plan:
+        //: 1 Using a table of inputs and the expected results of reading
+        //:   every element, read each input from both a contiguous and a
+        //:   trickling stream buffer, and verify the results and that no
+        //:   memory is allocated from the default allocator.  (C-1..4)
+        //:
+        //: 2 Verify the element index reported for an invalid element.  (C-2)
+        //:
+        //: 3 Read an element having an unknown member with and without the
+        //:   'skipUnknownElements' option.  (C-5)
+        //
+        // Testing:
+        //   StreamReader(streamBuf, format, basicAllocator);
+        //   StreamReader(streamBuf, format, options, basicAllocator);
+        //   int readNext(TYPE *value);
+        //   Format format() const;
+        //   bsl::string loggedMessages() const;
+        //   bsl::size_t numElementsRead() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ARRAY FORMAT" << endl
+                          << "============" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_input;
+            const char *d_expected;
+        } DATA[] = {
+            //LINE  INPUT                            EXPECTED
+            //----  -----                            --------
+            { L_,   "[]",                            "E"                 },
+            { L_,   " \n[ \t] \n",                   "E"                 },
+            { L_,   "[[1]]",                         "[1]E"              },
+            { L_,   "[[1,2],[],[3]]",                "[1,2][][3]E"       },
+            { L_,   " [ [1] ,\n [2] ] ",             "[1][2]E"           },
+            { L_,   "[[1],\"x\",[2]]",               "[1]D[2]E"          },
+            { L_,   "[[1],7,[2]]",                   "[1]D[2]E"          },
+            { L_,   "[[1],{\"a\":\"]\"},[2]]",       "[1]D[2]E"          },
+            { L_,   "[[1],[\"a\\\"]\"],[2]]",        "[1]D[2]E"          },
+            { L_,   "[[1],\"\\\\\",[2]]",            "[1]D[2]E"          },
+            { L_,   "[[1],[[2]],[3]]",               "[1]D[3]E"          },
+
+            { L_,   "",                              "S"                 },
+            { L_,   "   ",                           "S"                 },
+            { L_,   "x",                             "S"                 },
+            { L_,   "{\"a\":[1]}",                   "S"                 },
+            { L_,   "[",                             "S"                 },
+            { L_,   "[,[1]]",                        "S"                 },
+            { L_,   "[[1],]",                        "[1]S"              },
+            { L_,   "[[1] [2]]",                     "[1]S"              },
+            { L_,   "[[1]",                          "[1]S"              },
+            { L_,   "[[1],",                         "[1]S"              },
+            { L_,   "[[1],[2",                       "[1]S"              },
+            { L_,   "[[1],\"abc",                    "[1]S"              },
+            { L_,   "[[1],7",                        "[1]DS"             },
+            { L_,   "[[1],[2]] x",                   "[1][2]S"           },
+            { L_,   "[[1]][[2]]",                    "[1]S"              },
+        };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const bsl::string INPUT    = DATA[ti].d_input;
+            const char *const EXPECTED = DATA[ti].d_expected;
+
+            if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+            bdlsb::FixedMemInStreamBuf memBuf(INPUT.data(), INPUT.length());
+            TrickleStreamBuf           trickleBuf(INPUT);
+
+            bsl::streambuf *const STREAM_BUFS[] = { &memBuf, &trickleBuf };
+
+            for (int bi = 0; bi < 2; ++bi) {
+                bslma::TestAllocator         da("default",
+                                                veryVeryVeryVerbose);
+                bslma::DefaultAllocatorGuard guard(&da);
+
+                bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+                Obj reader(STREAM_BUFS[bi], Obj::e_ARRAY, &ta);
+                ASSERTV(LINE, Obj::e_ARRAY == reader.format());
+                ASSERTV(LINE, 0 == reader.numElementsRead());
+
+                const bsl::string result = readAll(&reader, &ta);
+                ASSERTV(LINE, bi, result, EXPECTED == result);
+                if (bsl::string::npos == result.find('D')) {
+                    ASSERTV(LINE, bi, da.numBlocksTotal(),
+                            0 == da.numBlocksTotal());
+                }
+                ASSERTV(LINE, bi, reader.loggedMessages(),
+                        ('S' == *result.rbegin()) ==
+                                            !reader.loggedMessages().empty());
+
+                const bsl::size_t numElements =
+                                 bsl::count(result.begin(), result.end(), '[')
+                               + bsl::count(result.begin(), result.end(), 'D');
+                ASSERTV(LINE, bi, reader.numElementsRead(),
+                        numElements == reader.numElementsRead());
+
+                bsl::vector<int> value(&ta);
+                const int        rc = reader.readNext(&value);
+                ASSERTV(LINE, bi, rc, 'S' == *result.rbegin() ? -1 == rc
+                                                              : 0 < rc);
+            }
+        }
+
+        if (verbose) cout << "\nElement index in messages." << endl;
+        {
+            const bsl::string INPUT = "[[0],[1],[\"x\"],[3]]";
+
+            bdlsb::FixedMemInStreamBuf streamBuf(INPUT.data(),
+                                                 INPUT.length());
+            Obj                        reader(&streamBuf, Obj::e_ARRAY);
+
+            bsl::vector<int> value;
+            ASSERT(0  == reader.readNext(&value));
+            ASSERT(0  == reader.readNext(&value));
+            ASSERT(-2 == reader.readNext(&value));
+            ASSERTV(reader.loggedMessages(),
+                    bsl::string::npos != reader.loggedMessages().find(
+                                                                "element 2"));
+            ASSERT(0  == reader.readNext(&value));
+            ASSERT(1  == value.size() && 3 == value[0]);
+        }
+
+        if (verbose) cout << "\nDecoder options." << endl;
+        {
+            const bsl::string INPUT = "[{\"name\":\"A\",\"unknown\":1}]";
+
+            for (int si = 0; si < 2; ++si) {
+                const bool SKIP = 0 == si;
+
+                baljsn::DecoderOptions options;
+                options.setSkipUnknownElements(SKIP);
+
+                bdlsb::FixedMemInStreamBuf streamBuf(INPUT.data(),
+                                                     INPUT.length());
+                Obj reader(&streamBuf, Obj::e_ARRAY, options);
+
+                s_baltst::Employee employee;
+                const int          rc = reader.readNext(&employee);
+                ASSERTV(SKIP, rc, SKIP ? 0 == rc : -2 == rc);
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Read the elements of a small array and of a small NDJSON input.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        {
+            const bsl::string INPUT = "[{\"name\":\"A\",\"age\":1},"
+                                      " {\"name\":\"B\",\"age\":2}]";
+
+            bdlsb::FixedMemInStreamBuf streamBuf(INPUT.data(),
+                                                 INPUT.length());
+            Obj                        reader(&streamBuf, Obj::e_ARRAY);
+
+            s_baltst::Employee employee;
+            ASSERT(0 == reader.readNext(&employee));
+            ASSERT("A" == employee.name() && 1 == employee.age());
+            ASSERT(0 == reader.readNext(&employee));
+            ASSERT("B" == employee.name() && 2 == employee.age());
+            ASSERT(0 <  reader.readNext(&employee));
+            ASSERT(2 == reader.numElementsRead());
+        }
+        {
+            const bsl::string INPUT = "{\"name\":\"A\",\"age\":1}\n"
+                                      "{\"name\":\"B\",\"age\":2}\n";
+
+            bdlsb::FixedMemInStreamBuf streamBuf(INPUT.data(),
+                                                 INPUT.length());
+            Obj                        reader(&streamBuf, Obj::e_NDJSON);
+
+            s_baltst::Employee employee;
+            ASSERT(0 == reader.readNext(&employee));
+            ASSERT("A" == employee.name());
+            ASSERT(0 == reader.readNext(&employee));
+            ASSERT("B" == employee.name());
+            ASSERT(0 <  reader.readNext(&employee));
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Reading elements one at a time is about as fast as decoding the
+        //:   whole array at once, while using bounded memory.
+        //:
+        //: 2 Parallel decoding of NDJSON scales with the number of threads.
+        //
+        // Plan:
+        //: 1 Generate an input of 'N' records ('N' given by the second
+        //:   command-line argument, or 100000), and report the throughput of
+        //:   decoding it as a whole with 'baljsn::Decoder', of reading it
+        //:   element by element in each format, and of reading NDJSON in
+        //:   parallel with 1, 2, and 4 threads, with the peak memory used.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int N = argc > 2 && 0 < atoi(argv[2]) ? atoi(argv[2]) : 100000;
+
+        bsl::string array;
+        bsl::string ndjson;
+        {
+            RecordStreamBuf arrayBuf(N, true);
+            RecordStreamBuf ndjsonBuf(N, false);
+            array.assign(bsl::istreambuf_iterator<char>(&arrayBuf),
+                         bsl::istreambuf_iterator<char>());
+            ndjson.assign(bsl::istreambuf_iterator<char>(&ndjsonBuf),
+                          bsl::istreambuf_iterator<char>());
+        }
+
+        cout << "records: " << N << ", bytes: " << ndjson.length() << endl;
+
+        const double RECORDS = N / 1000.0;
+
+        {
+            bslma::TestAllocator       ta("test", veryVeryVeryVerbose);
+            bdlsb::FixedMemInStreamBuf streamBuf(array.data(),
+                                                 array.length());
+
+            bsl::vector<s_baltst::Employee> employees(&ta);
+            baljsn::Decoder                 decoder(&ta);
+            baljsn::DecoderOptions          options;
+
+            bsls::Stopwatch timer;
+            timer.start();
+            const int rc = decoder.decode(&streamBuf, &employees, options);
+            timer.stop();
+            ASSERT(0 == rc);
+            ASSERT(static_cast<bsl::size_t>(N) == employees.size());
+
+            cout << "Decoder (whole array):  "
+                 << RECORDS / timer.accumulatedWallTime() << " records/ms, "
+                 << ta.numBytesMax() << " bytes peak" << endl;
+        }
+
+        for (int fi = 0; fi < 2; ++fi) {
+            const bool         IS_ARRAY = 0 == fi;
+            const bsl::string& INPUT    = IS_ARRAY ? array : ndjson;
+
+            bslma::TestAllocator       ta("test", veryVeryVeryVerbose);
+            bdlsb::FixedMemInStreamBuf streamBuf(INPUT.data(),
+                                                 INPUT.length());
+            Obj                        reader(&streamBuf,
+                                              IS_ARRAY ? Obj::e_ARRAY
+                                                       : Obj::e_NDJSON,
+                                              &ta);
+
+            s_baltst::Employee employee(&ta);
+            bsl::size_t        total = 0;
+
+            bsls::Stopwatch timer;
+            timer.start();
+            while (0 == reader.readNext(&employee)) {
+                total += employee.age();
+            }
+            timer.stop();
+            ASSERT(static_cast<bsl::size_t>(N) == reader.numElementsRead());
+
+            cout << (IS_ARRAY ? "readNext (array):       "
+                              : "readNext (NDJSON):      ")
+                 << RECORDS / timer.accumulatedWallTime() << " records/ms, "
+                 << ta.numBytesMax() << " bytes peak" << endl;
+        }
+
+        const int NUM_THREADS[] = { 1, 2, 4 };
+        for (int ti = 0; ti < 3; ++ti) {
+            bslma::TestAllocator   ta("test", veryVeryVeryVerbose);
+            bdlmt::FixedThreadPool threadPool(NUM_THREADS[ti], 64, &ta);
+            ASSERT(0 == threadPool.start());
+
+            bdlsb::FixedMemInStreamBuf streamBuf(ndjson.data(),
+                                                 ndjson.length());
+            Obj reader(&streamBuf, Obj::e_NDJSON, &ta);
+
+            bsl::vector<int> ages(&ta);
+            ages.reserve(N);
+            AgeCollector collector = { &ages };
+
+            bsls::Stopwatch timer;
+            timer.start();
+            const int rc = reader.readAllInParallel<s_baltst::Employee>(
+                                                                  collector,
+                                                                  &threadPool);
+            timer.stop();
+            ASSERT(0 == rc);
+            ASSERT(isSequence(ages, N));
+
+            threadPool.stop();
+
+            cout << "readAllInParallel (" << NUM_THREADS[ti] << "):  "
+                 << RECORDS / timer.accumulatedWallTime() << " records/ms"
+                 << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
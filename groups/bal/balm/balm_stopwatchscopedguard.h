@@ -45,6 +45,15 @@ BSLS_IDENT("$Id: $")
 // than an object instance).  In most instances, however, choosing between the
 // two is a matter of taste.
 //
+///Measuring Elapsed Time with the Time-Stamp Counter
+///--------------------------------------------------
+// A 'balm::StopwatchScopedGuard' measures the elapsed time using a
+// 'bsls::Stopwatch'.  Where guards are created at a high rate, the cost of
+// reading the system clock can be reduced by calling
+// 'bsls::Stopwatch::setUseTscClock(true)' at startup, after which the
+// stopwatches of guards subsequently created read the CPU time-stamp counter
+// instead (see 'bsls_tscclock').
+//
 ///Thread Safety
 ///-------------
 // 'balm::StopwatchScopedGuard' is *const* *thread-safe*, meaning that
@@ -0,0 +1,521 @@
+// balst_samplingallocator.cpp                                        -*-C++-*-
+#include <balst_samplingallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balst_samplingallocator_cpp,"$Id$ $CSID$")
+
+#include <balst_stacktrace.h>
+#include <balst_stacktraceframe.h>
+#include <balst_stacktraceutil.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bslma_deallocatorproctor.h>
+#include <bslma_mallocfreeallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+#include <bsls_stackaddressutil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_fstream.h>
+#include <bsl_ios.h>
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace {
+
+typedef bsls::StackAddressUtil AddressUtil;
+
+enum {
+    k_IGNORE_FRAMES = AddressUtil::k_IGNORE_FRAMES + 1
+        // Number of frames at the top of a captured stack that are not
+        // recorded: the frame of 'SamplingAllocator::allocate' itself, and, on
+        // some platforms, that of 'AddressUtil::getStackAddresses' (reflected
+        // in whether 'AddressUtil::k_IGNORE_FRAMES' is 0 or 1).
+};
+
+bsl::ostream& printAddress(bsl::ostream& stream, const void *address)
+    // Write the specified 'address' to the specified 'stream' as '0x'
+    // followed by hexadecimal digits, and return 'stream'.
+{
+    const bsl::ios_base::fmtflags flags = stream.flags();
+    stream << "0x" << bsl::hex
+           << reinterpret_cast<bsls::Types::UintPtr>(address);
+    stream.flags(flags);
+    return stream;
+}
+
+bsls::Types::Int64 roundToInt64(double value)
+    // Return the specified non-negative 'value' rounded to the nearest
+    // integer.
+{
+    return static_cast<bsls::Types::Int64>(value + 0.5);
+}
+
+}  // close unnamed namespace
+
+namespace balst {
+
+                     // ================================
+                     // struct SamplingAllocator::Sample
+                     // ================================
+
+struct SamplingAllocator::Sample {
+    // A record of this type describes one sampled block that has not been
+    // deallocated.  The address of the record is stored in the header of the
+    // block.
+
+    Site      *d_site_p;  // site from which the block was allocated
+    size_type  d_size;    // size of the block, as requested
+    double     d_weight;  // inverse of the probability of the sample
+};
+
+                          // -----------------------
+                          // class SamplingAllocator
+                          // -----------------------
+
+// PRIVATE MANIPULATORS
+bsls::Types::Int64 SamplingAllocator::nextInterval()
+{
+    if (1 == d_sampleInterval) {
+        return 1;                                                     // RETURN
+    }
+
+    // Advance an 'xorshift64*' generator, and use the top 53 bits of its
+    // output to form a uniform variate in the open interval '(0, 1)'.
+
+    d_randomState ^= d_randomState >> 12;
+    d_randomState ^= d_randomState << 25;
+    d_randomState ^= d_randomState >> 27;
+
+    const bsls::Types::Uint64 bits =
+                           (d_randomState * 2685821657736338717ULL) >> 11;
+    const double uniform = (static_cast<double>(bits) + 0.5)
+                                               / 9007199254740992.0;  // 2^53
+
+    const double interval = -bsl::log(uniform)
+                                       * static_cast<double>(d_sampleInterval);
+
+    return static_cast<bsls::Types::Int64>(interval) + 1;
+}
+
+SamplingAllocator::Sample *SamplingAllocator::recordSample(
+                                                        Stack     *stack,
+                                                        int        numFrames,
+                                                        size_type  size)
+{
+    BSLS_ASSERT(stack);
+
+    if (numFrames < k_IGNORE_FRAMES) {
+        numFrames = k_IGNORE_FRAMES;
+    }
+    stack->resize(numFrames);
+    stack->erase(stack->begin(), stack->begin() + k_IGNORE_FRAMES);
+
+    Sample *sample = static_cast<Sample *>(
+                                     d_allocator_p->allocate(sizeof(Sample)));
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(sample,
+                                                        d_allocator_p);
+
+    const double weight = 1 == d_sampleInterval
+                        ? 1.0
+                        : 1.0 / (1.0 - bsl::exp(
+                                   -static_cast<double>(size)
+                                   / static_cast<double>(d_sampleInterval)));
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    // Restart the countdown.  Other threads may have allocated while the
+    // countdown was expired; their allocations were sampled as well.
+
+    while (0 >= d_bytesUntilSample.loadRelaxed()) {
+        d_bytesUntilSample.addRelaxed(nextInterval());
+    }
+
+    // We avoid 'd_sites[stack]', because 'operator[]' creates its temporary
+    // key with the default allocator, which may be this very object.
+
+    SiteMap::iterator it = d_sites.find(*stack);
+    if (d_sites.end() == it) {
+        const Site site = { 0, 0, 0, 0, 0.0, 0.0 };
+        it = d_sites.insert(SiteMap::value_type(*stack,
+                                                site,
+                                                d_allocator_p)).first;
+    }
+
+    const bsls::Types::Int64 numBytes = static_cast<bsls::Types::Int64>(size);
+
+    Site& site = it->second;
+    ++site.d_numLiveSamples;
+    ++site.d_numSamples;
+    site.d_numLiveBytes       += numBytes;
+    site.d_numBytes           += numBytes;
+    site.d_estimatedLiveBytes += weight * static_cast<double>(size);
+    site.d_estimatedBytes     += weight * static_cast<double>(size);
+
+    ++d_numSamples;
+    ++d_numLiveSamples;
+
+    sample->d_site_p = &site;
+    sample->d_size   = size;
+    sample->d_weight = weight;
+
+    proctor.release();
+    return sample;
+}
+
+void SamplingAllocator::releaseSample(Sample *sample)
+{
+    BSLS_ASSERT(sample);
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        Site& site = *sample->d_site_p;
+
+        BSLS_ASSERT(0 < site.d_numLiveSamples);
+
+        --site.d_numLiveSamples;
+        site.d_numLiveBytes -=
+                              static_cast<bsls::Types::Int64>(sample->d_size);
+        site.d_estimatedLiveBytes -=
+                        sample->d_weight * static_cast<double>(sample->d_size);
+        if (0 == site.d_numLiveSamples) {
+            site.d_estimatedLiveBytes = 0.0;  // discard rounding errors
+        }
+
+        --d_numLiveSamples;
+    }
+
+    d_allocator_p->deallocate(sample);
+}
+
+// PRIVATE ACCESSORS
+void SamplingAllocator::copyProfile(
+                          bsl::vector<bsl::pair<Stack, Site> > *result) const
+{
+    BSLS_ASSERT(result);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    result->clear();
+    result->reserve(d_sites.size());
+    for (SiteMap::const_iterator it = d_sites.begin(); d_sites.end() != it;
+                                                                        ++it) {
+        result->push_back(bsl::pair<Stack, Site>(it->first, it->second));
+    }
+}
+
+// CREATORS
+SamplingAllocator::SamplingAllocator(bslma::Allocator *basicAllocator)
+: d_bytesUntilSample(0)
+, d_sampleInterval(k_DEFAULT_SAMPLE_INTERVAL)
+, d_maxRecordedFrames(k_DEFAULT_NUM_RECORDED_FRAMES + k_IGNORE_FRAMES)
+, d_randomState(0x9E3779B97F4A7C15ULL)
+, d_sites(basicAllocator
+          ? basicAllocator
+          : &bslma::MallocFreeAllocator::singleton())
+, d_numSamples(0)
+, d_numLiveSamples(0)
+, d_allocator_p(basicAllocator
+                ? basicAllocator
+                : &bslma::MallocFreeAllocator::singleton())
+{
+    d_bytesUntilSample = nextInterval();
+}
+
+SamplingAllocator::SamplingAllocator(bsls::Types::Int64  sampleInterval,
+                                     bslma::Allocator   *basicAllocator)
+: d_bytesUntilSample(0)
+, d_sampleInterval(sampleInterval)
+, d_maxRecordedFrames(k_DEFAULT_NUM_RECORDED_FRAMES + k_IGNORE_FRAMES)
+, d_randomState(0x9E3779B97F4A7C15ULL)
+, d_sites(basicAllocator
+          ? basicAllocator
+          : &bslma::MallocFreeAllocator::singleton())
+, d_numSamples(0)
+, d_numLiveSamples(0)
+, d_allocator_p(basicAllocator
+                ? basicAllocator
+                : &bslma::MallocFreeAllocator::singleton())
+{
+    BSLS_ASSERT(0 < sampleInterval);
+
+    d_bytesUntilSample = nextInterval();
+}
+
+SamplingAllocator::SamplingAllocator(bsls::Types::Int64  sampleInterval,
+                                     int                 numRecordedFrames,
+                                     bslma::Allocator   *basicAllocator)
+: d_bytesUntilSample(0)
+, d_sampleInterval(sampleInterval)
+, d_maxRecordedFrames(numRecordedFrames + k_IGNORE_FRAMES)
+, d_randomState(0x9E3779B97F4A7C15ULL)
+, d_sites(basicAllocator
+          ? basicAllocator
+          : &bslma::MallocFreeAllocator::singleton())
+, d_numSamples(0)
+, d_numLiveSamples(0)
+, d_allocator_p(basicAllocator
+                ? basicAllocator
+                : &bslma::MallocFreeAllocator::singleton())
+{
+    BSLS_ASSERT(0 < sampleInterval);
+    BSLS_ASSERT(0 < numRecordedFrames);
+
+    d_bytesUntilSample = nextInterval();
+}
+
+SamplingAllocator::~SamplingAllocator()
+{
+    BSLS_ASSERT(0 == d_numLiveSamples);
+}
+
+// MANIPULATORS
+void *SamplingAllocator::allocate(size_type size)
+{
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    char *block = static_cast<char *>(d_allocator_p->allocate(k_HEADER_SIZE
+                                                              + size));
+
+    Sample *sample = 0;
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                   0 >= d_bytesUntilSample.addRelaxed(
+                               -static_cast<bsls::Types::Int64>(size)))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(block,
+                                                            d_allocator_p);
+
+        // The stack is gathered here, rather than in 'recordSample', so that
+        // the number of frames belonging to this object is known.
+
+        Stack     stack(d_maxRecordedFrames,
+                        static_cast<void *>(0),
+                        d_allocator_p);
+        const int numFrames = AddressUtil::getStackAddresses(
+                                                         stack.data(),
+                                                         d_maxRecordedFrames);
+
+        sample = recordSample(&stack, numFrames, size);
+        proctor.release();
+    }
+
+    *reinterpret_cast<Sample **>(block) = sample;
+
+    return block + k_HEADER_SIZE;
+}
+
+void SamplingAllocator::deallocate(void *address)
+{
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+    char   *block  = static_cast<char *>(address) - k_HEADER_SIZE;
+    Sample *sample = *reinterpret_cast<Sample **>(block);
+
+    if (sample) {
+        releaseSample(sample);
+    }
+
+    d_allocator_p->deallocate(block);
+}
+
+void SamplingAllocator::resetCumulativeProfile()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    SiteMap::iterator it = d_sites.begin();
+    while (d_sites.end() != it) {
+        Site& site = it->second;
+        if (0 == site.d_numLiveSamples) {
+            it = d_sites.erase(it);
+        }
+        else {
+            site.d_numSamples     = site.d_numLiveSamples;
+            site.d_numBytes       = site.d_numLiveBytes;
+            site.d_estimatedBytes = site.d_estimatedLiveBytes;
+            ++it;
+        }
+    }
+}
+
+// ACCESSORS
+bsls::Types::Int64 SamplingAllocator::numLiveSamples() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numLiveSamples;
+}
+
+bsls::Types::Int64 SamplingAllocator::numSamples() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numSamples;
+}
+
+int SamplingAllocator::numSites() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return static_cast<int>(d_sites.size());
+}
+
+bsl::ostream& SamplingAllocator::printCollapsedStacks(
+                                                 bsl::ostream& stream,
+                                                 ProfileType   profile) const
+{
+    typedef bsl::vector<bsl::pair<Stack, Site> > Profile;
+
+    Profile sites(d_allocator_p);
+    copyProfile(&sites);
+
+    // Resolve every distinct address with a single call, since the resolver
+    // reads the symbol tables of the process each time it is invoked.
+
+    Stack addresses(d_allocator_p);
+    for (Profile::const_iterator it = sites.begin(); sites.end() != it; ++it) {
+        addresses.insert(addresses.end(),
+                         it->first.begin(),
+                         it->first.end());
+    }
+    bsl::sort(addresses.begin(), addresses.end());
+    addresses.erase(bsl::unique(addresses.begin(), addresses.end()),
+                    addresses.end());
+
+    StackTrace trace(d_allocator_p);
+    if (!addresses.empty()) {
+        const int rc = StackTraceUtil::loadStackTraceFromAddressArray(
+                                          &trace,
+                                          addresses.data(),
+                                          static_cast<int>(addresses.size()));
+        if (0 != rc
+         || static_cast<bsl::size_t>(trace.length()) != addresses.size()) {
+            trace.removeAll();
+        }
+    }
+
+    for (Profile::const_iterator it = sites.begin(); sites.end() != it; ++it) {
+        const Site&              site  = it->second;
+        const bsls::Types::Int64 bytes = roundToInt64(
+                                                e_LIVE == profile
+                                                ? site.d_estimatedLiveBytes
+                                                : site.d_estimatedBytes);
+        if (0 >= bytes) {
+            continue;                                               // CONTINUE
+        }
+
+        const Stack& stack = it->first;
+        for (Stack::const_reverse_iterator frameIt  = stack.rbegin();
+                                           frameIt != stack.rend();
+                                           ++frameIt) {
+            if (stack.rbegin() != frameIt) {
+                stream << ';';
+            }
+
+            if (0 == trace.length()) {
+                printAddress(stream, *frameIt);
+                continue;                                           // CONTINUE
+            }
+
+            const int index = static_cast<int>(
+                              bsl::lower_bound(addresses.begin(),
+                                               addresses.end(),
+                                               *frameIt) - addresses.begin());
+            const StackTraceFrame& frame = trace[index];
+            if (frame.isSymbolNameKnown() && !frame.symbolName().empty()) {
+                stream << frame.symbolName();
+            }
+            else if (frame.isMangledSymbolNameKnown()
+                  && !frame.mangledSymbolName().empty()) {
+                stream << frame.mangledSymbolName();
+            }
+            else {
+                printAddress(stream, *frameIt);
+            }
+        }
+        stream << ' ' << bytes << '\n';
+    }
+
+    return stream;
+}
+
+bsl::ostream& SamplingAllocator::printPprof(bsl::ostream& stream) const
+{
+    typedef bsl::vector<bsl::pair<Stack, Site> > Profile;
+
+    Profile sites(d_allocator_p);
+    copyProfile(&sites);
+
+    bsls::Types::Int64 numLiveSamples = 0;
+    bsls::Types::Int64 numLiveBytes   = 0;
+    bsls::Types::Int64 numSamples     = 0;
+    bsls::Types::Int64 numBytes       = 0;
+    for (Profile::const_iterator it = sites.begin(); sites.end() != it; ++it) {
+        numLiveSamples += it->second.d_numLiveSamples;
+        numLiveBytes   += it->second.d_numLiveBytes;
+        numSamples     += it->second.d_numSamples;
+        numBytes       += it->second.d_numBytes;
+    }
+
+    stream << "heap profile: " << numLiveSamples << ": " << numLiveBytes
+           << " [" << numSamples << ": " << numBytes << "] @ heap_v2/"
+           << d_sampleInterval << '\n';
+
+    for (Profile::const_iterator it = sites.begin(); sites.end() != it; ++it) {
+        const Site& site = it->second;
+
+        stream << site.d_numLiveSamples << ": " << site.d_numLiveBytes
+               << " [" << site.d_numSamples << ": " << site.d_numBytes
+               << "] @";
+
+        const Stack& stack = it->first;
+        for (Stack::const_iterator frameIt = stack.begin();
+                                   stack.end() != frameIt;
+                                   ++frameIt) {
+            stream << ' ';
+            printAddress(stream, *frameIt);
+        }
+        stream << '\n';
+    }
+
+    stream << "\nMAPPED_LIBRARIES:\n";
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    bsl::ifstream maps("/proc/self/maps");
+    bsl::string   line(d_allocator_p);
+    while (bsl::getline(maps, line)) {
+        stream << line << '\n';
+    }
+#endif
+
+    return stream;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
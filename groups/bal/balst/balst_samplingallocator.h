@@ -0,0 +1,410 @@
+// balst_samplingallocator.h                                          -*-C++-*-
+#ifndef INCLUDED_BALST_SAMPLINGALLOCATOR
+#define INCLUDED_BALST_SAMPLINGALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator that profiles a sample of its allocations.
+//
+//@CLASSES:
+//  balst::SamplingAllocator: heap-profiling allocator sampling 1 in N bytes
+//
+//@SEE_ALSO: balst_stacktracetestallocator, bdlma_countingallocator
+//
+//@DESCRIPTION: This component provides an allocator,
+// 'balst::SamplingAllocator', that implements the 'bslma::Allocator' protocol
+// by forwarding every request to an underlying allocator, and that records the
+// call stack of a random *sample* of the allocations it performs.  The
+// recorded stacks are aggregated per allocation site (i.e., per distinct call
+// stack) into two profiles:
+//
+//: o The *live* profile describes sampled blocks that have not yet been
+//:   deallocated.
+//:
+//: o The *cumulative* profile describes every sampled block allocated since
+//:   construction (or since the last call to 'resetCumulativeProfile').
+//
+// Either profile can be written on demand in the "collapsed stack" format
+// understood by flame-graph tools, and both are written by 'printPprof' in the
+// legacy text heap-profile format read by 'pprof'.
+//
+///Sampling
+///--------
+// A 'balst::SamplingAllocator' is configured with a 'sampleInterval', N.
+// Every allocated byte is sampled with probability 1/N, which is implemented
+// by counting down a random number of bytes -- drawn from an exponential
+// distribution having mean N -- between consecutive samples.  An allocation
+// is sampled if it causes the countdown to expire; a block of 'size' bytes is
+// therefore sampled with probability '1 - exp(-size / N)', so that large
+// blocks are (almost) always sampled and tiny blocks rarely are.  Each sample
+// is weighted by the inverse of that probability, yielding unbiased estimates
+// of the number of blocks and bytes allocated at each site; these estimates
+// are what 'printCollapsedStacks' reports.  'printPprof' writes the raw
+// sampled counts together with N, and 'pprof' performs the same scaling
+// itself.  A 'sampleInterval' of 1 samples every allocation, with a weight
+// of 1.
+//
+///Overhead
+///--------
+// An allocation that is not sampled costs one atomic subtraction more than a
+// direct call to the underlying allocator, plus 'k_HEADER_SIZE' bytes that are
+// prepended to every block so that 'deallocate' can recognize sampled blocks
+// without a lookup.  A sampled allocation additionally gathers the return
+// addresses on the stack -- omitting the frame of 'allocate' itself, so that
+// each stack begins at the caller of the allocator -- and updates the profile
+// under a mutex.  Note that the return addresses are stored as raw pointers:
+// resolving them to symbol names is expensive and is deferred until a profile
+// is printed, and is not done at all by 'printPprof', which leaves
+// symbolization to 'pprof'.
+//
+// The default 'sampleInterval' is 512 KiB, which keeps the sampling cost
+// negligible for typical services while still reliably identifying sites
+// responsible for a significant share of allocated memory.
+//
+///Underlying Allocator
+///--------------------
+// Like 'balst::StackTraceTestAllocator', and unlike most BDE allocators, this
+// allocator does *not* rely on the currently installed default allocator:
+// unless another allocator is supplied at construction, blocks (and the
+// allocator's own bookkeeping) are obtained from the
+// 'bslma::MallocFreeAllocator' singleton.  This permits a
+// 'balst::SamplingAllocator' to be installed as the default allocator of a
+// process.
+//
+///Thread Safety
+///-------------
+// 'balst::SamplingAllocator' is fully thread-safe, provided that the
+// underlying allocator is thread-safe.  The printing methods copy the
+// profile while holding the mutex, and then resolve and write it without
+// holding the mutex, so that allocations performed during symbol resolution
+// (possibly through this very allocator) do not deadlock.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding Allocation Hot Spots
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we have a service made of several subsystems sharing an allocator,
+// and we want to know which of them is responsible for most of its memory
+// use.
+//
+// First, we define two functions that allocate memory from a supplied
+// allocator, one making a few large allocations and the other many small
+// ones:
+//..
+//  void makeBigBuffers(bsl::vector<void *> *blocks,
+//                      bslma::Allocator    *allocator)
+//      // Allocate 10 blocks of 64 KiB from the specified 'allocator' and
+//      // append them to the specified 'blocks'.
+//  {
+//      for (int i = 0; i < 10; ++i) {
+//          blocks->push_back(allocator->allocate(64 * 1024));
+//      }
+//  }
+//
+//  void makeSmallNodes(bsl::vector<void *> *blocks,
+//                      bslma::Allocator    *allocator)
+//      // Allocate 1000 blocks of 16 bytes from the specified 'allocator' and
+//      // append them to the specified 'blocks'.
+//  {
+//      for (int i = 0; i < 1000; ++i) {
+//          blocks->push_back(allocator->allocate(16));
+//      }
+//  }
+//..
+// Then, we create a sampling allocator that samples, on average, one in every
+// 4096 allocated bytes:
+//..
+//  balst::SamplingAllocator profiler(4096);
+//..
+// Next, we run our workload, supplying the profiler as the allocator:
+//..
+//  bsl::vector<void *> blocks;
+//  makeBigBuffers(&blocks, &profiler);
+//  makeSmallNodes(&blocks, &profiler);
+//..
+// Now, we observe that every one of the large blocks was sampled (each is
+// 16 times larger than the sample interval), while most of the small ones
+// were not:
+//..
+//  assert(10   <= profiler.numLiveSamples());
+//  assert(1010 >  profiler.numLiveSamples());
+//..
+// Then, we write the live profile in collapsed-stack format.  Each line lists
+// the frames of one allocation site, outermost first and separated by ';',
+// followed by the estimated number of bytes in use that were allocated from
+// that site.  The output can be fed directly to a flame-graph generator:
+//..
+//  bsl::ostringstream collapsed;
+//  profiler.printCollapsedStacks(collapsed);
+//..
+// The output will look like the following (outermost frames elided; the
+// estimate for the small blocks varies from run to run):
+//..
+//  ...;main;makeBigBuffers(bsl::vector<void*>*, BloombergLP::bslma::Alloc...
+//  ...;main;makeSmallNodes(bsl::vector<void*>*, BloombergLP::bslma::Alloc...
+//..
+// where the first line ends with ' 655360' (all of the large blocks were
+// sampled, each with a weight very close to 1), and the second with an
+// estimate of the 16000 bytes allocated by 'makeSmallNodes'.
+// Next, we write both profiles in the text heap-profile format, which can be
+// saved to a file and analyzed with 'pprof --text <binary> <file>':
+//..
+//  bsl::ostringstream heapProfile;
+//  profiler.printPprof(heapProfile);
+//  assert(0 == heapProfile.str().find("heap profile:"));
+//..
+// Finally, we return the blocks to the allocator, after which the live
+// profile is empty, while the cumulative profile still describes every sample
+// taken:
+//..
+//  for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+//      profiler.deallocate(blocks[i]);
+//  }
+//  assert(0  == profiler.numLiveSamples());
+//  assert(10 <= profiler.numSamples());
+//..
+
+#include <balscm_version.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_iosfwd.h>
+#include <bsl_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balst {
+
+                          // =======================
+                          // class SamplingAllocator
+                          // =======================
+
+class SamplingAllocator : public bslma::Allocator {
+    // This class provides a concrete allocator that forwards allocation
+    // requests to an underlying allocator and records, for a random sample of
+    // those requests, the call stack of the request.  Samples are aggregated
+    // into live and cumulative profiles keyed by call stack, which can be
+    // printed on demand.  This class is fully thread-safe (see
+    // {Thread Safety}).
+
+  public:
+    // PUBLIC TYPES
+    enum ProfileType {
+        // Enumerate the profiles maintained by a 'SamplingAllocator'.
+
+        e_LIVE,        // sampled blocks not yet deallocated
+        e_CUMULATIVE   // all sampled blocks
+    };
+
+    enum {
+        k_DEFAULT_SAMPLE_INTERVAL     = 512 * 1024,
+            // mean number of bytes allocated between samples if none is
+            // specified at construction
+
+        k_DEFAULT_NUM_RECORDED_FRAMES = 32,
+            // maximum stack depth recorded if none is specified at
+            // construction
+
+        k_HEADER_SIZE = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT
+            // number of bytes prepended to every block
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct Site {
+        // Statistics gathered for one allocation site.  The 'd_num*' members
+        // hold raw sample counts; the 'd_estimated*' members hold the sums of
+        // the weights of the samples.
+
+        bsls::Types::Int64 d_numLiveSamples;     // sampled blocks in use
+        bsls::Types::Int64 d_numLiveBytes;       // sampled bytes in use
+        bsls::Types::Int64 d_numSamples;         // sampled blocks
+        bsls::Types::Int64 d_numBytes;           // sampled bytes
+        double             d_estimatedLiveBytes; // estimated bytes in use
+        double             d_estimatedBytes;     // estimated bytes
+    };
+
+    typedef bsl::vector<void *>      Stack;
+    typedef bsl::map<Stack, Site>    SiteMap;
+
+    struct Sample;                 // record of one live sampled block
+                                   // (defined in the '.cpp')
+
+    // DATA
+    bsls::AtomicInt64     d_bytesUntilSample;  // countdown to the next sample
+
+    const bsls::Types::Int64
+                          d_sampleInterval;    // mean bytes between samples
+
+    const int             d_maxRecordedFrames; // frames gathered per sample,
+                                               // including ignored frames
+
+    bsls::Types::Uint64   d_randomState;       // state of the generator
+                                               // drawing sample intervals
+
+    SiteMap               d_sites;             // profile, keyed by call stack
+
+    bsls::Types::Int64    d_numSamples;        // samples since construction
+
+    bsls::Types::Int64    d_numLiveSamples;    // sampled blocks in use
+
+    mutable bslmt::Mutex  d_mutex;             // guards all the data above
+                                               // except 'd_bytesUntilSample'
+
+    bslma::Allocator     *d_allocator_p;       // underlying allocator (held,
+                                               // not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    SamplingAllocator(const SamplingAllocator&);
+    SamplingAllocator& operator=(const SamplingAllocator&);
+
+    // PRIVATE MANIPULATORS
+    bsls::Types::Int64 nextInterval();
+        // Return the number of bytes to allocate before the next sample is
+        // taken, drawn from an exponential distribution with mean
+        // 'd_sampleInterval'.  The behavior is undefined unless 'd_mutex' is
+        // locked.
+
+    Sample *recordSample(Stack *stack, int numFrames, size_type size);
+        // Record a sample of an allocation of the specified 'size' bytes made
+        // from the call stack described by the first 'numFrames' addresses of
+        // the specified 'stack', as gathered by 'allocate', and return the
+        // address of the record of the sample.  The frames of this object at
+        // the top of 'stack' are removed before it is recorded.  Note that
+        // 'numFrames' may be negative if the stack could not be gathered.
+
+    void releaseSample(Sample *sample);
+        // Remove the block described by the specified 'sample' from the live
+        // profile, and free 'sample'.
+
+    // PRIVATE ACCESSORS
+    void copyProfile(bsl::vector<bsl::pair<Stack, Site> > *result) const;
+        // Load into the specified 'result' a copy of every allocation site
+        // and its statistics.
+
+  public:
+    // CREATORS
+    explicit
+    SamplingAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit
+    SamplingAllocator(bsls::Types::Int64  sampleInterval,
+                      bslma::Allocator   *basicAllocator = 0);
+    SamplingAllocator(bsls::Types::Int64  sampleInterval,
+                      int                 numRecordedFrames,
+                      bslma::Allocator   *basicAllocator = 0);
+        // Create a sampling allocator.  Optionally specify 'sampleInterval',
+        // the mean number of bytes allocated between consecutive samples; if
+        // 'sampleInterval' is not specified, 'k_DEFAULT_SAMPLE_INTERVAL' is
+        // used.  Optionally specify 'numRecordedFrames', the maximum number of
+        // stack frames, starting from the caller of 'allocate', recorded for
+        // each sample; if 'numRecordedFrames' is not specified,
+        // 'k_DEFAULT_NUM_RECORDED_FRAMES' is used.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the 'bslma::MallocFreeAllocator' singleton is
+        // used.  The behavior is undefined unless '0 < sampleInterval' and
+        // '0 < numRecordedFrames'.
+
+    virtual ~SamplingAllocator();
+        // Destroy this allocator.  The behavior is undefined unless all
+        // memory allocated from this object has been deallocated.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return a newly-allocated block of memory of (at least) the specified
+        // positive 'size' (in bytes), supplied by the underlying allocator,
+        // and, if the allocation is sampled, record the current call stack.
+        // If 'size' is 0, a null pointer is returned with no other effect.
+        // The returned block is maximally aligned.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' to the underlying
+        // allocator, and remove it from the live profile if it was sampled.
+        // If 'address' is 0, this function has no effect.  The behavior is
+        // undefined unless 'address' was allocated using this allocator
+        // object and has not already been deallocated.
+
+    void resetCumulativeProfile();
+        // Discard the cumulative profile, so that it subsequently describes
+        // only the sampled blocks that are in use, and the samples taken after
+        // this call.  The live profile is unaffected.
+
+    // ACCESSORS
+    bsls::Types::Int64 numLiveSamples() const;
+        // Return the number of sampled blocks that have not been deallocated.
+
+    bsls::Types::Int64 numSamples() const;
+        // Return the number of allocations that have been sampled since this
+        // object was constructed.  Note that 'resetCumulativeProfile' does not
+        // affect this value.
+
+    int numSites() const;
+        // Return the number of distinct allocation sites in the cumulative
+        // profile.
+
+    bsl::ostream& printCollapsedStacks(bsl::ostream& stream,
+                                       ProfileType   profile = e_LIVE) const;
+        // Write the specified 'profile' (the live profile by default) to the
+        // specified 'stream' in the "collapsed stack" format, and return
+        // 'stream'.  One line is written for each allocation site having a
+        // non-zero estimated byte count in 'profile', listing the resolved
+        // names of the frames of its call stack, outermost first, separated by
+        // ';', then a space and the estimated number of bytes.  A frame whose
+        // name cannot be resolved is written as its address, in hex.
+
+    bsl::ostream& printPprof(bsl::ostream& stream) const;
+        // Write both profiles to the specified 'stream' in the legacy text
+        // heap-profile format ("heap_v2") understood by 'pprof', and return
+        // 'stream'.  The call stacks are written as unresolved addresses and,
+        // on Linux, the memory map of the process is appended so that 'pprof'
+        // can symbolize them.
+
+    bsls::Types::Int64 sampleInterval() const;
+        // Return the mean number of bytes allocated between samples.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class SamplingAllocator
+                          // -----------------------
+
+// ACCESSORS
+inline
+bsls::Types::Int64 SamplingAllocator::sampleInterval() const
+{
+    return d_sampleInterval;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1298 @@
+// balst_samplingallocator.t.cpp                                      -*-C++-*-
+#include <balst_samplingallocator.h>
+
+#include <balst_stacktracetestallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_mallocfreeallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+// 'getStackAddresses' will not be able to trace through our stack frames if
+// we're optimized on Windows
+
+# pragma optimize("", off)
+
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'balst::SamplingAllocator' is a thread-safe mechanism that forwards every
+// request to an underlying allocator and records the call stacks of a random
+// sample of its allocations.  The primary concerns are that the blocks it
+// returns are usable, maximally aligned, and returned to the underlying
+// allocator; that with a sample interval of 1 every allocation is recorded,
+// so that the profiles can be verified exactly; that with larger intervals
+// the number of samples, and the byte counts estimated from them, agree with
+// the documented sampling scheme; and that both output formats faithfully
+// describe the profiles.  Note that the names of the frames written by
+// 'printCollapsedStacks' depend on the ability of the platform to resolve
+// symbols, so the tests check only the structure of that output, and the
+// presence of the names of test functions where resolution is known to work.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit SamplingAllocator(bslma::Allocator *basicAllocator = 0);
+// [ 2] explicit SamplingAllocator(Int64 interval, Allocator *ba = 0);
+// [ 2] SamplingAllocator(Int64 interval, int frames, Allocator *ba = 0);
+// [ 2] ~SamplingAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+// [ 5] void resetCumulativeProfile();
+//
+// ACCESSORS
+// [ 3] Int64 numLiveSamples() const;
+// [ 3] Int64 numSamples() const;
+// [ 3] int numSites() const;
+// [ 5] ostream& printCollapsedStacks(ostream& s, ProfileType p) const;
+// [ 6] ostream& printPprof(ostream& stream) const;
+// [ 2] Int64 sampleInterval() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+// [ 4] CONCERN: Sampling rate and estimates match the sample interval.
+// [ 7] CONCERN: The allocator is thread-safe.
+// [ *] CONCERN: In no case does memory come from the global allocator.
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balst::SamplingAllocator Obj;
+typedef bsls::Types::Int64       Int64;
+typedef bsls::Types::size_type   size_type;
+typedef bsls::Types::UintPtr     UintPtr;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+const int k_MAX_ALIGNMENT = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef void *(*AllocateFunction)(bslma::Allocator *, size_type);
+
+static void *volatile s_lastBlock = 0;
+
+void *allocateFromSiteA(bslma::Allocator *allocator, size_type size)
+    // Return a block of the specified 'size' allocated from the specified
+    // 'allocator'.  This function is called through a pointer so that it is
+    // not inlined, and stores the block in 's_lastBlock' so that the call is
+    // not a tail call; thus it appears on the call stack.
+{
+    void *block = allocator->allocate(size);
+    s_lastBlock = block;
+    return block;
+}
+
+void *allocateFromSiteB(bslma::Allocator *allocator, size_type size)
+    // Return a block of the specified 'size' allocated from the specified
+    // 'allocator'.  This function is called through a pointer so that it is
+    // not inlined, and stores the block in 's_lastBlock' so that the call is
+    // not a tail call; thus it appears on the call stack.
+{
+    void *block = allocator->allocate(size);
+    s_lastBlock = block;
+    return block;
+}
+
+AllocateFunction volatile siteA = &allocateFromSiteA;
+AllocateFunction volatile siteB = &allocateFromSiteB;
+
+bsl::vector<bsl::string> splitLines(const bsl::string& text)
+    // Return the non-empty lines of the specified 'text'.
+{
+    bsl::vector<bsl::string> result;
+    bsl::istringstream       in(text);
+    bsl::string              line;
+    while (bsl::getline(in, line)) {
+        if (!line.empty()) {
+            result.push_back(line);
+        }
+    }
+    return result;
+}
+
+Int64 collapsedValue(const bsl::string& line)
+    // Return the value at the end of the specified collapsed-stack 'line', or
+    // -1 if 'line' is malformed.
+{
+    const bsl::string::size_type pos = line.rfind(' ');
+    if (bsl::string::npos == pos || pos + 1 == line.size()) {
+        return -1;                                                    // RETURN
+    }
+    Int64 value = 0;
+    for (bsl::string::size_type i = pos + 1; i < line.size(); ++i) {
+        if (line[i] < '0' || '9' < line[i]) {
+            return -1;                                                // RETURN
+        }
+        value = value * 10 + (line[i] - '0');
+    }
+    return value;
+}
+
+bool canResolveSymbols()
+    // Return 'true' if the names of the functions in this test driver are
+    // expected to be resolved from their addresses on this platform, and
+    // 'false' otherwise.
+{
+#if defined(BSLS_PLATFORM_OS_LINUX) || defined(BSLS_PLATFORM_OS_DARWIN)
+    return true;
+#else
+    return false;
+#endif
+}
+
+struct ConcurrencyTestArg {
+    // This 'struct' holds the arguments of a thread of the concurrency test.
+
+    bslma::Allocator *d_allocator_p;    // allocator under test
+    bslmt::Barrier   *d_barrier_p;      // barrier synchronizing the threads
+    int               d_numIterations;  // number of batches to allocate
+};
+
+extern "C"
+void *concurrencyTestThread(void *arg)
+    // Wait on the barrier described by the specified 'arg', which must address
+    // a 'ConcurrencyTestArg', then repeatedly allocate a batch of blocks from
+    // two sites, write over them, and free them.  Return 0.
+{
+    const ConcurrencyTestArg& args = *static_cast<ConcurrencyTestArg *>(arg);
+
+    args.d_barrier_p->wait();
+
+    void *blocks[8];
+    for (int i = 0; i < args.d_numIterations; ++i) {
+        for (int j = 0; j < 8; ++j) {
+            blocks[j] = (j % 2 ? siteA : siteB)(args.d_allocator_p, 8 + j);
+            bsl::memset(blocks[j], j, 8 + j);
+        }
+        for (int j = 0; j < 8; ++j) {
+            args.d_allocator_p->deallocate(blocks[j]);
+        }
+    }
+    return 0;
+}
+
+// ============================================================================
+//                          PERFORMANCE TEST HELPERS
+// ----------------------------------------------------------------------------
+
+static UintPtr s_antiOptimization = 0;
+
+double toDouble(const bsls::TimeInterval& duration)
+    // Return the specified 'duration' in nanoseconds.
+{
+    return static_cast<double>(duration.totalNanoseconds());
+}
+
+bsls::TimeInterval churn(bslma::Allocator *allocator, int numOperations)
+    // Perform the specified 'numOperations' allocations of varying sizes from
+    // the specified 'allocator', keeping a window of recent blocks alive, and
+    // return the elapsed time of the median of several trials.
+{
+    enum { k_WINDOW = 256, k_NUM_TRIALS = 11 };
+
+    bsl::vector<bsls::TimeInterval> times;
+    for (int trial = 0; trial < k_NUM_TRIALS; ++trial) {
+        void *window[k_WINDOW] = { 0 };
+
+        const bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+        for (int i = 0; i < numOperations; ++i) {
+            const int slot = i % k_WINDOW;
+            allocator->deallocate(window[slot]);
+            window[slot] = allocator->allocate(16 + (i * 37) % 240);
+            s_antiOptimization += reinterpret_cast<UintPtr>(window[slot]);
+        }
+        times.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+
+        for (int i = 0; i < k_WINDOW; ++i) {
+            allocator->deallocate(window[i]);
+        }
+    }
+    bsl::sort(times.begin(), times.end());
+    return times[k_NUM_TRIALS / 2];
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding Allocation Hot Spots
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we have a service made of several subsystems sharing an allocator,
+// and we want to know which of them is responsible for most of its memory
+// use.
+//
+// First, we define two functions that allocate memory from a supplied
+// allocator, one making a few large allocations and the other many small
+// ones:
+//..
+    void makeBigBuffers(bsl::vector<void *> *blocks,
+                        bslma::Allocator    *allocator)
+        // Allocate 10 blocks of 64 KiB from the specified 'allocator' and
+        // append them to the specified 'blocks'.
+    {
+        for (int i = 0; i < 10; ++i) {
+            blocks->push_back(allocator->allocate(64 * 1024));
+        }
+    }
+
+    void makeSmallNodes(bsl::vector<void *> *blocks,
+                        bslma::Allocator    *allocator)
+        // Allocate 1000 blocks of 16 bytes from the specified 'allocator' and
+        // append them to the specified 'blocks'.
+    {
+        for (int i = 0; i < 1000; ++i) {
+            blocks->push_back(allocator->allocate(16));
+        }
+    }
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator(veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create a sampling allocator that samples, on average, one in every
+// 4096 allocated bytes:
+//..
+    balst::SamplingAllocator profiler(4096);
+//..
+// Next, we run our workload, supplying the profiler as the allocator:
+//..
+    bsl::vector<void *> blocks;
+    makeBigBuffers(&blocks, &profiler);
+    makeSmallNodes(&blocks, &profiler);
+//..
+// Now, we observe that every one of the large blocks was sampled (each is
+// 16 times larger than the sample interval), while most of the small ones
+// were not:
+//..
+    ASSERT(10   <= profiler.numLiveSamples());
+    ASSERT(1010 >  profiler.numLiveSamples());
+//..
+// Then, we write the live profile in collapsed-stack format.  Each line lists
+// the frames of one allocation site, outermost first and separated by ';',
+// followed by the estimated number of bytes in use that were allocated from
+// that site.  The output can be fed directly to a flame-graph generator:
+//..
+    bsl::ostringstream collapsed;
+    profiler.printCollapsedStacks(collapsed);
+//..
+// The output will look like the following (outermost frames elided; the
+// estimate for the small blocks varies from run to run):
+//..
+//  ...;main;makeBigBuffers(bsl::vector<void*>*, BloombergLP::bslma::Alloc...
+//  ...;main;makeSmallNodes(bsl::vector<void*>*, BloombergLP::bslma::Alloc...
+//..
+// where the first line ends with ' 655360' (all of the large blocks were
+// sampled, each with a weight very close to 1), and the second with an
+// estimate of the 16000 bytes allocated by 'makeSmallNodes'.
+// Next, we write both profiles in the text heap-profile format, which can be
+// saved to a file and analyzed with 'pprof --text <binary> <file>':
+//..
+    bsl::ostringstream heapProfile;
+    profiler.printPprof(heapProfile);
+    ASSERT(0 == heapProfile.str().find("heap profile:"));
+//..
+// Finally, we return the blocks to the allocator, after which the live
+// profile is empty, while the cumulative profile still describes every sample
+// taken:
+//..
+    for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+        profiler.deallocate(blocks[i]);
+    }
+    ASSERT(0  == profiler.numLiveSamples());
+    ASSERT(10 <= profiler.numSamples());
+//..
+
+        if (veryVerbose) {
+            cout << collapsed.str();
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 Allocations and deallocations may be performed concurrently from
+        //:   several threads without corrupting the profile.
+        //:
+        //: 2 Every allocation is sampled when the sample interval is 1, even
+        //:   under contention.
+        //
+        // Plan:
+        //: 1 Start several threads that, after waiting on a common barrier,
+        //:   allocate and free many blocks from two call sites.  Join them,
+        //:   and verify that the number of samples equals the number of
+        //:   allocations, that no sample is live, and that the underlying
+        //:   test allocator has no blocks in use.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: The allocator is thread-safe.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        enum { k_NUM_THREADS = 4, k_NUM_ITERATIONS = 2000 };
+
+        bslma::TestAllocator ta("underlying", veryVeryVeryVerbose);
+        {
+            Obj mX(1, &ta);  const Obj& X = mX;
+
+            bslmt::Barrier barrier(k_NUM_THREADS);
+
+            ConcurrencyTestArg args = { &mX, &barrier, k_NUM_ITERATIONS };
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                const int rc = bslmt::ThreadUtil::create(&handles[i],
+                                                         concurrencyTestThread,
+                                                         &args);
+                LOOP_ASSERT(i, 0 == rc);
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            ASSERTV(X.numSamples(),
+                    k_NUM_THREADS * k_NUM_ITERATIONS * 8 == X.numSamples());
+            ASSERTV(X.numLiveSamples(), 0 == X.numLiveSamples());
+            ASSERTV(X.numSites(), 2 <= X.numSites());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'printPprof'
+        //
+        // Concerns:
+        //: 1 The output begins with a header line giving the totals of the
+        //:   live and cumulative profiles and the sample interval, in the
+        //:   "heap_v2" format.
+        //:
+        //: 2 One line is written per site, giving the raw live and cumulative
+        //:   sample counts and byte counts, followed by the unresolved
+        //:   addresses of the frames of the site in hex.
+        //:
+        //: 3 The site lines are followed by a 'MAPPED_LIBRARIES:' section,
+        //:   which on Linux lists the memory map of the process.
+        //:
+        //: 4 The method returns the supplied stream.
+        //
+        // Plan:
+        //: 1 Using a sample interval of 1, allocate blocks from two sites,
+        //:   free some of them, print the profile, and parse the output,
+        //:   verifying the totals and the per-site values.  (C-1..4)
+        //
+        // Testing:
+        //   ostream& printPprof(ostream& stream) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'printPprof'" << endl
+                          << "============" << endl;
+
+        bslma::TestAllocator ta("underlying", veryVeryVeryVerbose);
+        {
+            Obj mX(1, &ta);  const Obj& X = mX;
+
+            bsl::vector<void *> a, b;
+            for (int i = 0; i < 3; ++i) {
+                a.push_back(siteA(&mX, 100));
+            }
+            for (int i = 0; i < 5; ++i) {
+                b.push_back(siteB(&mX, 10));
+            }
+            mX.deallocate(a.back());  a.pop_back();
+
+            bsl::ostringstream out;
+            ASSERT(&out == &X.printPprof(out));
+
+            if (veryVerbose) {
+                cout << out.str().substr(0, out.str().find("MAPPED"));
+            }
+
+            const bsl::vector<bsl::string> lines = splitLines(out.str());
+            ASSERT(3 <= lines.size());
+
+            ASSERTV(lines[0],
+                    "heap profile: 7: 250 [8: 350] @ heap_v2/1" == lines[0]);
+
+            // Note that a loop calling a site may have been unrolled by the
+            // compiler, in which case the allocations of one site function
+            // are made from several call stacks, so the site lines are checked
+            // only to add up to the totals.
+
+            Int64       sums[4] = { 0, 0, 0, 0 };
+            bsl::size_t i       = 1;
+            for (; i < lines.size() && "MAPPED_LIBRARIES:" != lines[i]; ++i) {
+                const bsl::string& line = lines[i];
+                const bsl::string::size_type at = line.find(" @ 0x");
+                ASSERTV(line, bsl::string::npos != at);
+
+                long long values[4];
+                const int rc = bsl::sscanf(line.c_str(),
+                                           "%lld: %lld [%lld: %lld]",
+                                           &values[0],
+                                           &values[1],
+                                           &values[2],
+                                           &values[3]);
+                ASSERTV(line, 4 == rc);
+                for (int j = 0; j < 4; ++j) {
+                    sums[j] += values[j];
+                }
+            }
+            ASSERTV(i, X.numSites() + 1 == static_cast<int>(i));
+
+            ASSERTV(sums[0], 7   == sums[0]);
+            ASSERTV(sums[1], 250 == sums[1]);
+            ASSERTV(sums[2], 8   == sums[2]);
+            ASSERTV(sums[3], 350 == sums[3]);
+
+            ASSERT(i < lines.size() && "MAPPED_LIBRARIES:" == lines[i]);
+#if defined(BSLS_PLATFORM_OS_LINUX)
+            ASSERT(i + 1 < lines.size());
+#endif
+
+            for (bsl::size_t i = 0; i < a.size(); ++i) {
+                mX.deallocate(a[i]);
+            }
+            for (bsl::size_t i = 0; i < b.size(); ++i) {
+                mX.deallocate(b[i]);
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'printCollapsedStacks' AND 'resetCumulativeProfile'
+        //
+        // Concerns:
+        //: 1 One line is written for each site having a non-zero byte count
+        //:   in the requested profile, ending with a space and that count.
+        //:
+        //: 2 The live profile is written by default, and the cumulative
+        //:   profile on request.
+        //:
+        //: 3 Frames are written outermost first, separated by ';', and are
+        //:   resolved to function names where the platform supports it.
+        //:
+        //: 4 'resetCumulativeProfile' discards the history of freed blocks
+        //:   from the cumulative profile, but leaves the live profile, and
+        //:   'numSamples', unchanged.
+        //:
+        //: 5 The method returns the supplied stream.
+        //
+        // Plan:
+        //: 1 Using a sample interval of 1, allocate blocks from two sites
+        //:   (functions called through pointers, so that they are not
+        //:   inlined), and free some of them.  Print both profiles and verify
+        //:   the number of lines, the values, and, where symbols can be
+        //:   resolved, that the site functions and 'main' appear in the
+        //:   expected order and account for the expected values.  (C-1..3,
+        //:   5)
+        //:
+        //: 2 Free all blocks of one site, call 'resetCumulativeProfile', and
+        //:   verify the profiles and accessors.  (C-4)
+        //
+        // Testing:
+        //   ostream& printCollapsedStacks(ostream& s, ProfileType p) const;
+        //   void resetCumulativeProfile();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'printCollapsedStacks' AND "
+                             "'resetCumulativeProfile'" << endl
+                          << "==========================="
+                             "========================" << endl;
+
+        bslma::TestAllocator ta("underlying", veryVeryVeryVerbose);
+        {
+            Obj mX(1, &ta);  const Obj& X = mX;
+
+            {
+                bsl::ostringstream out;
+                ASSERT(&out == &X.printCollapsedStacks(out));
+                ASSERT(out.str().empty());
+            }
+
+            bsl::vector<void *> a, b;
+            for (int i = 0; i < 4; ++i) {
+                a.push_back(siteA(&mX, 100));
+            }
+            for (int i = 0; i < 2; ++i) {
+                b.push_back(siteB(&mX, 30));
+            }
+            mX.deallocate(a.back());  a.pop_back();
+
+            // Note that a loop calling a site may have been unrolled by the
+            // compiler, in which case the allocations of one site function
+            // are made from several call stacks, and so are written on several
+            // lines.
+
+            const int NUM_SITES = X.numSites();
+            ASSERTV(NUM_SITES, 2 <= NUM_SITES);
+
+            const struct {
+                int         d_line;
+                Obj::ProfileType
+                            d_profile;
+                Int64       d_valueA;
+                Int64       d_valueB;
+            } DATA[] = {
+                { L_, Obj::e_LIVE,       300, 60 },
+                { L_, Obj::e_CUMULATIVE, 400, 60 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE = DATA[ti].d_line;
+
+                bsl::ostringstream out;
+                ASSERT(&out == &X.printCollapsedStacks(out,
+                                                       DATA[ti].d_profile));
+
+                if (veryVerbose) {
+                    cout << out.str();
+                }
+
+                const bsl::vector<bsl::string> lines = splitLines(out.str());
+                ASSERTV(LINE, lines.size(),
+                        NUM_SITES == static_cast<int>(lines.size()));
+
+                Int64 sum = 0, sumA = 0, sumB = 0;
+                for (bsl::size_t i = 0; i < lines.size(); ++i) {
+                    const Int64 value = collapsedValue(lines[i]);
+                    ASSERTV(LINE, lines[i], 0 < value);
+                    sum += value;
+
+                    if (!canResolveSymbols()) {
+                        continue;
+                    }
+
+                    const bsl::string::size_type mainPos =
+                                                        lines[i].find("main");
+                    const bsl::string::size_type sitePos =
+                                                lines[i].find("allocateFrom");
+                    ASSERTV(LINE, lines[i], bsl::string::npos != mainPos);
+                    ASSERTV(LINE, lines[i], bsl::string::npos != sitePos);
+                    ASSERTV(LINE, lines[i], mainPos < sitePos);
+
+                    if (bsl::string::npos !=
+                                         lines[i].find("allocateFromSiteA")) {
+                        sumA += value;
+                    }
+                    else {
+                        ASSERTV(LINE, lines[i], bsl::string::npos !=
+                                         lines[i].find("allocateFromSiteB"));
+                        sumB += value;
+                    }
+                }
+                ASSERTV(LINE, sum, DATA[ti].d_valueA + DATA[ti].d_valueB
+                                                                      == sum);
+                if (canResolveSymbols()) {
+                    ASSERTV(LINE, sumA, DATA[ti].d_valueA == sumA);
+                    ASSERTV(LINE, sumB, DATA[ti].d_valueB == sumB);
+                }
+            }
+
+            // Free all of site B, and reset the cumulative profile.
+
+            for (bsl::size_t i = 0; i < b.size(); ++i) {
+                mX.deallocate(b[i]);
+            }
+            b.clear();
+
+            {
+                bsl::ostringstream out;
+                X.printCollapsedStacks(out);
+                const bsl::vector<bsl::string> lines = splitLines(out.str());
+
+                Int64 sum = 0;
+                for (bsl::size_t i = 0; i < lines.size(); ++i) {
+                    sum += collapsedValue(lines[i]);
+                }
+                ASSERTV(sum, 300 == sum);
+            }
+
+            ASSERT(NUM_SITES == X.numSites());
+            ASSERT(6         == X.numSamples());
+            ASSERT(3         == X.numLiveSamples());
+
+            mX.resetCumulativeProfile();
+
+            const int NUM_LIVE_SITES = X.numSites();
+            ASSERTV(NUM_LIVE_SITES, 1 <= NUM_LIVE_SITES);
+            ASSERTV(NUM_LIVE_SITES, NUM_LIVE_SITES < NUM_SITES);
+            ASSERT(6 == X.numSamples());
+            ASSERT(3 == X.numLiveSamples());
+
+            for (int ti = 0; ti < 2; ++ti) {
+                bsl::ostringstream out;
+                X.printCollapsedStacks(out, ti ? Obj::e_CUMULATIVE
+                                               : Obj::e_LIVE);
+                const bsl::vector<bsl::string> lines = splitLines(out.str());
+                ASSERTV(ti, lines.size(),
+                        NUM_LIVE_SITES == static_cast<int>(lines.size()));
+
+                Int64 sum = 0;
+                for (bsl::size_t i = 0; i < lines.size(); ++i) {
+                    sum += collapsedValue(lines[i]);
+                    ASSERTV(ti, lines[i], !canResolveSymbols()
+                           || bsl::string::npos !=
+                                         lines[i].find("allocateFromSiteA"));
+                }
+                ASSERTV(ti, sum, 300 == sum);
+            }
+
+            // Freeing the remaining blocks empties the live profile only.
+
+            for (bsl::size_t i = 0; i < a.size(); ++i) {
+                mX.deallocate(a[i]);
+            }
+            {
+                bsl::ostringstream out;
+                X.printCollapsedStacks(out);
+                ASSERT(out.str().empty());
+            }
+            {
+                bsl::ostringstream out;
+                X.printCollapsedStacks(out, Obj::e_CUMULATIVE);
+                const bsl::vector<bsl::string> lines = splitLines(out.str());
+                ASSERTV(lines.size(),
+                        NUM_LIVE_SITES == static_cast<int>(lines.size()));
+            }
+
+            mX.resetCumulativeProfile();
+            ASSERT(0 == X.numSites());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SAMPLING RATE
+        //
+        // Concerns:
+        //: 1 On average, one sample is taken per 'sampleInterval' bytes
+        //:   allocated.
+        //:
+        //: 2 The byte counts estimated from the samples are close to the
+        //:   number of bytes actually allocated, both for blocks much smaller
+        //:   and for blocks much larger than the sample interval.
+        //:
+        //: 3 Blocks much larger than the sample interval are always sampled.
+        //
+        // Plan:
+        //: 1 For a table of sample intervals and block sizes, allocate
+        //:   enough blocks to expect many samples, and verify that the number
+        //:   of samples, and the estimated byte count reported by
+        //:   'printCollapsedStacks', are within a tolerance of their expected
+        //:   values.  The tolerance is several standard deviations wide, and
+        //:   the random sequence is deterministic, so the test is
+        //:   reproducible.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: Sampling rate and estimates match the sample interval.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SAMPLING RATE" << endl
+                          << "=============" << endl;
+
+        const struct {
+            int       d_line;
+            Int64     d_interval;
+            size_type d_size;
+            int       d_numBlocks;
+        } DATA[] = {
+            //LINE  INTERVAL   SIZE  BLOCKS
+            //----  --------  -----  ------
+            { L_,       1024,    16, 100000 },
+            { L_,       4096,    64,  50000 },
+            { L_,       4096,  1000,  10000 },
+            { L_,      65536,  4096,  10000 },
+            { L_,       1000, 64000,    500 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int       LINE     = DATA[ti].d_line;
+            const Int64     INTERVAL = DATA[ti].d_interval;
+            const size_type SIZE     = DATA[ti].d_size;
+            const int       N        = DATA[ti].d_numBlocks;
+
+            Obj mX(INTERVAL);  const Obj& X = mX;
+
+            bsl::vector<void *> blocks;
+            blocks.reserve(N);
+            for (int i = 0; i < N; ++i) {
+                blocks.push_back(mX.allocate(SIZE));
+            }
+
+            const double p = 1.0 - bsl::exp(-static_cast<double>(SIZE)
+                                            / static_cast<double>(INTERVAL));
+            const double expected = N * p;
+            const double sigma    = bsl::sqrt(N * p * (1.0 - p));
+            const double samples  = static_cast<double>(X.numSamples());
+
+            if (veryVerbose) {
+                T_ P_(LINE) P_(expected) P_(sigma) P(samples);
+            }
+
+            ASSERTV(LINE, expected, samples,
+                    bsl::fabs(samples - expected) <= 5 * sigma + 1);
+            ASSERTV(LINE, X.numLiveSamples() == X.numSamples());
+
+            bsl::ostringstream out;
+            X.printCollapsedStacks(out);
+            const bsl::vector<bsl::string> lines = splitLines(out.str());
+            ASSERTV(LINE, lines.size(), 1 <= lines.size());
+
+            double estimated = 0;
+            for (bsl::size_t i = 0; i < lines.size(); ++i) {
+                estimated += static_cast<double>(collapsedValue(lines[i]));
+            }
+            const double actual = static_cast<double>(N) * SIZE;
+
+            if (veryVerbose) {
+                T_ P_(actual) P(estimated);
+            }
+
+            ASSERTV(LINE, actual, estimated,
+                    bsl::fabs(estimated - actual)
+                                  <= 5 * sigma / p * SIZE + SIZE / p + 1);
+
+            for (int i = 0; i < N; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            ASSERTV(LINE, 0 == X.numLiveSamples());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate' returns a maximally-aligned block of at least the
+        //:   requested size, obtained from the underlying allocator.
+        //:
+        //: 2 'allocate(0)' returns 0, and 'deallocate(0)' has no effect.
+        //:
+        //: 3 'deallocate' returns the block to the underlying allocator.
+        //:
+        //: 4 With a sample interval of 1, every allocation is sampled, and
+        //:   'numSamples', 'numLiveSamples', and 'numSites' reflect the
+        //:   allocations and deallocations performed.
+        //:
+        //: 5 'allocate' is exception-neutral: if the underlying allocator
+        //:   throws, no memory is leaked and the profile is unchanged.
+        //
+        // Plan:
+        //: 1 Using a 'bslma::TestAllocator' as the underlying allocator,
+        //:   allocate blocks of a range of sizes, check their alignment,
+        //:   write over them, and verify the counts of the test allocator and
+        //:   of the object under test as blocks are allocated and freed.
+        //:   (C-1..4)
+        //:
+        //: 2 Allocate within the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST'
+        //:   macros, and verify that no memory is leaked and that the number
+        //:   of live samples equals the number of blocks held.  (C-5)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   Int64 numLiveSamples() const;
+        //   Int64 numSamples() const;
+        //   int numSites() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'allocate' AND 'deallocate'" << endl
+                          << "===========================" << endl;
+
+        if (verbose) cout << "\nAlignment, size, and counts." << endl;
+        {
+            bslma::TestAllocator ta("underlying", veryVeryVeryVerbose);
+            {
+                Obj mX(1, 1, &ta);  const Obj& X = mX;
+
+                ASSERT(0 == mX.allocate(0));
+                mX.deallocate(0);
+                ASSERT(0 == ta.numBlocksTotal());
+                ASSERT(0 == X.numSamples());
+
+                // The underlying allocator also supplies the bookkeeping of
+                // 'mX': a site, once created, persists, and each sampled
+                // block in use is accompanied by one record.  Recording a
+                // single frame, and allocating through a site function, lets
+                // all the allocations share one site.
+
+                mX.deallocate(siteA(&mX, 1));
+                ASSERT(1 == X.numSites());
+
+                const Int64 BASE = ta.numBlocksInUse();
+
+                bsl::vector<void *> blocks;
+                for (size_type size = 1; size <= 300; ++size) {
+                    void *p = siteA(&mX, size);
+                    ASSERTV(size, 0 == reinterpret_cast<UintPtr>(p)
+                                                      % k_MAX_ALIGNMENT);
+                    bsl::memset(p, 0xa5, size);
+                    blocks.push_back(p);
+
+                    ASSERTV(size, BASE + 2 * static_cast<Int64>(size) ==
+                                                         ta.numBlocksInUse());
+                    ASSERTV(size, static_cast<Int64>(size) + 1 ==
+                                                           X.numSamples());
+                    ASSERTV(size, static_cast<Int64>(size) ==
+                                                       X.numLiveSamples());
+                }
+                ASSERTV(X.numSites(), 1 == X.numSites());
+
+                for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                    mX.deallocate(blocks[i]);
+                    ASSERTV(i, BASE + 2 * static_cast<Int64>(
+                                                       blocks.size() - i - 1)
+                                                      == ta.numBlocksInUse());
+                    ASSERTV(i, static_cast<Int64>(blocks.size() - i - 1) ==
+                                                       X.numLiveSamples());
+                }
+                ASSERT(BASE == ta.numBlocksInUse());
+                ASSERT(301  == X.numSamples());
+                ASSERT(1    == X.numSites());
+            }
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nUnsampled blocks." << endl;
+        {
+            bslma::TestAllocator ta("underlying", veryVeryVeryVerbose);
+            {
+                Obj mX(Obj::k_DEFAULT_SAMPLE_INTERVAL, &ta);
+                const Obj& X = mX;
+
+                void *p = mX.allocate(8);
+                ASSERT(0 == reinterpret_cast<UintPtr>(p) % k_MAX_ALIGNMENT);
+                ASSERT(1 == ta.numBlocksInUse());
+                ASSERT(8 + Obj::k_HEADER_SIZE == ta.numBytesInUse());
+                ASSERT(0 == X.numSamples());
+                ASSERT(0 == X.numSites());
+
+                mX.deallocate(p);
+                ASSERT(0 == ta.numBlocksInUse());
+            }
+        }
+
+        if (verbose) cout << "\nException neutrality." << endl;
+        {
+            bslma::TestAllocator ta("underlying", veryVeryVeryVerbose);
+            {
+                Obj mX(1, &ta);  const Obj& X = mX;
+
+                bsl::vector<void *> blocks;
+                blocks.reserve(100);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                    for (int i = 0; i < 10; ++i) {
+                        blocks.push_back(siteA(&mX, 24));
+                    }
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(X.numLiveSamples(), blocks.size(),
+                        static_cast<Int64>(blocks.size()) ==
+                                                         X.numLiveSamples());
+
+                for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                    mX.deallocate(blocks[i]);
+                }
+            }
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS
+        //
+        // Concerns:
+        //: 1 The default sample interval is 'k_DEFAULT_SAMPLE_INTERVAL'.
+        //:
+        //: 2 A supplied sample interval is reported by 'sampleInterval'.
+        //:
+        //: 3 A newly-created object has no samples and no sites.
+        //:
+        //: 4 If no allocator is supplied, memory is obtained from the
+        //:   'bslma::MallocFreeAllocator' singleton, and not from the default
+        //:   allocator.
+        //:
+        //: 5 At most 'numRecordedFrames' frames are recorded per sample.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create objects with each constructor and verify the accessors.
+        //:   Allocate from objects created without an allocator while a test
+        //:   allocator is installed as the default, and verify that the
+        //:   default allocator is not used.  (C-1..4)
+        //:
+        //: 2 Create an object recording a single frame, allocate twice through
+        //:   a site function called from two places, and verify that both
+        //:   allocations share one site, whereas they do not if the default
+        //:   number of frames is recorded.  (C-5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   explicit SamplingAllocator(bslma::Allocator *basicAllocator = 0);
+        //   explicit SamplingAllocator(Int64 interval, Allocator *ba = 0);
+        //   SamplingAllocator(Int64 interval, int frames, Allocator *ba = 0);
+        //   ~SamplingAllocator();
+        //   Int64 sampleInterval() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS" << endl
+                          << "========" << endl;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::Default::setDefaultAllocatorRaw(&da);
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(Obj::k_DEFAULT_SAMPLE_INTERVAL == X.sampleInterval());
+            ASSERT(0 == X.numSamples());
+            ASSERT(0 == X.numLiveSamples());
+            ASSERT(0 == X.numSites());
+
+            mX.deallocate(mX.allocate(16 * Obj::k_DEFAULT_SAMPLE_INTERVAL));
+            ASSERT(1 == X.numSamples());
+        }
+        {
+            Obj mX(1);  const Obj& X = mX;
+            ASSERT(1 == X.sampleInterval());
+
+            mX.deallocate(mX.allocate(1));
+            ASSERT(1 == X.numSamples());
+            ASSERT(1 == X.numSites());
+        }
+        {
+            Obj mX(100, 4);  const Obj& X = mX;
+            ASSERT(100 == X.sampleInterval());
+            ASSERT(0   == X.numSites());
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        bslma::TestAllocator ta("underlying", veryVeryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            ASSERT(Obj::k_DEFAULT_SAMPLE_INTERVAL == X.sampleInterval());
+
+            mX.deallocate(mX.allocate(8));
+            ASSERT(1 == ta.numBlocksTotal());
+        }
+        {
+            Obj mX(7, &ta);  const Obj& X = mX;
+            ASSERT(7 == X.sampleInterval());
+        }
+        {
+            Obj mX(1, 1, &ta);  const Obj& X = mX;
+            ASSERT(1 == X.sampleInterval());
+
+            mX.deallocate(siteA(&mX, 8));
+            mX.deallocate(siteA(&mX, 8));
+            ASSERT(2 == X.numSamples());
+            ASSERTV(X.numSites(), 1 == X.numSites());
+        }
+        {
+            Obj mX(1, &ta);  const Obj& X = mX;
+
+            mX.deallocate(siteA(&mX, 8));
+            mX.deallocate(siteA(&mX, 8));
+            ASSERT(2 == X.numSamples());
+            ASSERTV(X.numSites(), 2 == X.numSites());
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Obj(Int64(0)));
+            ASSERT_FAIL(Obj(-1, &ta));
+            ASSERT_PASS(Obj(1, &ta));
+
+            ASSERT_FAIL(Obj(1, 0, &ta));
+            ASSERT_FAIL(Obj(0, 1, &ta));
+            ASSERT_PASS(Obj(1, 1, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and free a few blocks, with and without sampling, and
+        //:   print the profiles.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("underlying", veryVeryVeryVerbose);
+        {
+            Obj mX(1, &ta);  const Obj& X = mX;
+
+            void *p = siteA(&mX, 10);
+            void *q = siteB(&mX, 20);
+            ASSERT(p);
+            ASSERT(q);
+            ASSERT(2 == X.numSamples());
+            ASSERT(2 == X.numLiveSamples());
+            ASSERT(2 == X.numSites());
+
+            bsl::ostringstream collapsed;
+            X.printCollapsedStacks(collapsed);
+            ASSERT(2 == splitLines(collapsed.str()).size());
+
+            bsl::ostringstream pprof;
+            X.printPprof(pprof);
+            ASSERT(0 == pprof.str().find("heap profile: 2: 30 [2: 30]"));
+
+            if (veryVerbose) {
+                cout << collapsed.str();
+            }
+
+            mX.deallocate(p);
+            mX.deallocate(q);
+            ASSERT(0 == X.numLiveSamples());
+            ASSERT(2 == X.numSamples());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 With the default sample interval, the overhead of the sampling
+        //:   allocator over its underlying allocator is small.
+        //:
+        //: 2 Sampling is much cheaper than tracking every allocation, as
+        //:   'balst::StackTraceTestAllocator' does.
+        //
+        // Plan:
+        //: 1 Time a churn of allocations and deallocations of varying sizes
+        //:   through the 'bslma::MallocFreeAllocator' directly, through a
+        //:   'balst::SamplingAllocator' with the default interval, and through
+        //:   a 'balst::StackTraceTestAllocator', and report the cost per
+        //:   operation of each.  The number of operations may be given as the
+        //:   second command-line argument.  (C-1..2)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int ARG            = argc > 2 ? atoi(argv[2]) : 0;
+        const int NUM_OPERATIONS = 0 < ARG ? ARG : 1000000;
+
+        bslma::MallocFreeAllocator& mfa =
+                                       bslma::MallocFreeAllocator::singleton();
+
+        Obj                            sampling;
+        balst::StackTraceTestAllocator tracing;
+
+        const double baseTime     = toDouble(churn(&mfa, NUM_OPERATIONS));
+        const double samplingTime = toDouble(churn(&sampling,
+                                                   NUM_OPERATIONS));
+        const double tracingTime  = toDouble(churn(&tracing, NUM_OPERATIONS));
+
+        cout << "operations: " << NUM_OPERATIONS << endl
+             << "bslma::MallocFreeAllocator    : "
+             << baseTime / NUM_OPERATIONS << " ns per op" << endl
+             << "balst::SamplingAllocator      : "
+             << samplingTime / NUM_OPERATIONS << " ns per op, "
+             << 100.0 * (samplingTime - baseTime) / baseTime
+             << "% overhead (" << sampling.numSamples() << " samples)" << endl
+             << "balst::StackTraceTestAllocator: "
+             << tracingTime / NUM_OPERATIONS << " ns per op, "
+             << 100.0 * (tracingTime - baseTime) / baseTime
+             << "% overhead" << endl;
+
+        if (veryVerbose) {
+            P(s_antiOptimization);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
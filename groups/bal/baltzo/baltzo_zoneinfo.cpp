@@ -13,10 +13,30 @@ BSLS_IDENT_RCSID(baltzo_zoneinfo_cpp,"$Id$ $CSID$")
 
 #include <bsls_assert.h>
 #include <bsls_review.h>
+#include <bsls_types.h>
 
 #include <bsl_ostream.h>
 
 namespace BloombergLP {
+namespace {
+namespace u {
+
+const bdlt::EpochUtil::TimeT64 k_INDEX_BEGIN = 0;
+    // UTC time (1970/01/01_00:00:00) at which the transition index begins
+
+enum {
+    k_INDEX_INTERVAL_SHIFT = 22,  // log2 of the length, in seconds, of each
+                                  // interval of the transition index (about
+                                  // 48.5 days, so that an interval rarely
+                                  // holds more than one transition)
+
+    k_INDEX_NUM_INTERVALS  = 1024 // number of intervals in the transition
+                                  // index (so that it ends at
+                                  // 2106/02/07_06:28:16)
+};
+
+}  // close namespace u
+}  // close unnamed namespace
 
 // STATIC HELPER FUNCTIONS
 static
@@ -149,6 +169,7 @@ Zoneinfo::Zoneinfo(const Zoneinfo& original, const allocator_type &allocator)
 , d_transitions(allocator)
 , d_posixExtendedRangeDescription(original.d_posixExtendedRangeDescription,
                                   allocator)
+, d_transitionIndex(allocator)
 {
     d_transitions.reserve(original.d_transitions.size());
 
@@ -157,6 +178,8 @@ Zoneinfo::Zoneinfo(const Zoneinfo& original, const allocator_type &allocator)
     for (; it != end; ++it) {
         addTransition(it->utcTime(), it->descriptor());
     }
+
+    d_transitionIndex = original.d_transitionIndex;
 }
 
 Zoneinfo::Zoneinfo(bslmf::MovableRef<Zoneinfo> original) BSLS_KEYWORD_NOEXCEPT
@@ -168,6 +191,8 @@ Zoneinfo::Zoneinfo(bslmf::MovableRef<Zoneinfo> original) BSLS_KEYWORD_NOEXCEPT
       bslmf::MovableRefUtil::access(original).d_transitions))
 , d_posixExtendedRangeDescription(bslmf::MovableRefUtil::move(
       bslmf::MovableRefUtil::access(original).d_posixExtendedRangeDescription))
+, d_transitionIndex(bslmf::MovableRefUtil::move(
+      bslmf::MovableRefUtil::access(original).d_transitionIndex))
 {
 }
 
@@ -182,6 +207,7 @@ Zoneinfo::Zoneinfo(bslmf::MovableRef<Zoneinfo> original,
       bslmf::MovableRefUtil::move(bslmf::MovableRefUtil::access(original)
                                       .d_posixExtendedRangeDescription),
       allocator)
+, d_transitionIndex(allocator)
 {
     const Zoneinfo& origRef = bslmf::MovableRefUtil::access(original);
 
@@ -192,6 +218,8 @@ Zoneinfo::Zoneinfo(bslmf::MovableRef<Zoneinfo> original,
     for (; it != end; ++it) {
         addTransition(it->utcTime(), it->descriptor());
     }
+
+    d_transitionIndex = origRef.d_transitionIndex;
 }
 
 // MANIPULATORS
@@ -213,6 +241,7 @@ Zoneinfo& Zoneinfo::operator=(bslmf::MovableRef<Zoneinfo> rhs)
 
     d_posixExtendedRangeDescription =
            bslmf::MovableRefUtil::move(rhsRef.d_posixExtendedRangeDescription);
+    d_transitionIndex = bslmf::MovableRefUtil::move(rhsRef.d_transitionIndex);
 
     return *this;
 }
@@ -222,6 +251,8 @@ void Zoneinfo::addTransition(bdlt::EpochUtil::TimeT64   utcTime,
 {
     typedef bsl::vector<ZoneinfoTransition>::iterator TransitionIterator;
 
+    d_transitionIndex.clear();
+
     // Insert the description in the set and get back an iterator pointing to
     // the inserted item.
 
@@ -261,18 +292,69 @@ void Zoneinfo::addTransition(bdlt::EpochUtil::TimeT64   utcTime,
     return;
 }
 
+void Zoneinfo::buildTransitionIndex()
+{
+    if (d_transitions.empty()) {
+        return;                                                       // RETURN
+    }
+
+    bsl::vector<int> index(u::k_INDEX_NUM_INTERVALS, 0, get_allocator());
+
+    const bsl::size_t lastPosition = d_transitions.size() - 1;
+    bsl::size_t       position     = 0;
+
+    for (int i = 0; i < u::k_INDEX_NUM_INTERVALS; ++i) {
+        const bdlt::EpochUtil::TimeT64 intervalBegin =
+               u::k_INDEX_BEGIN
+             + (static_cast<bdlt::EpochUtil::TimeT64>(i)
+                                                << u::k_INDEX_INTERVAL_SHIFT);
+
+        while (position < lastPosition
+            && d_transitions[position + 1].utcTime() <= intervalBegin) {
+            ++position;
+        }
+        index[i] = static_cast<int>(position);
+    }
+
+    d_transitionIndex.swap(index);
+}
+
 // ACCESSORS
 Zoneinfo::TransitionConstIterator
 Zoneinfo::findTransitionForUtcTime(const bdlt::Datetime& utcTime) const
 {
     BSLS_ASSERT(numTransitions() > 0);
-    BSLS_ASSERT(d_transitions.front().utcTime() <=
-                                   bdlt::EpochUtil::convertToTimeT64(utcTime));
-
-    LocalTimeDescriptor dummyDescriptor;
 
     const bdlt::EpochUtil::TimeT64 utcTimeT64 =
                                     bdlt::EpochUtil::convertToTimeT64(utcTime);
+
+    BSLS_ASSERT(d_transitions.front().utcTime() <= utcTimeT64);
+
+    if (!d_transitionIndex.empty()) {
+        // Converting to an unsigned offset maps times before the start of the
+        // index to values beyond its end.
+
+        const bsls::Types::Uint64 interval =
+                   static_cast<bsls::Types::Uint64>(utcTimeT64
+                                                    - u::k_INDEX_BEGIN)
+                                                >> u::k_INDEX_INTERVAL_SHIFT;
+
+        if (interval < static_cast<bsls::Types::Uint64>(
+                                                 u::k_INDEX_NUM_INTERVALS)) {
+            const bsl::size_t lastPosition = d_transitions.size() - 1;
+            bsl::size_t       position     =
+                       d_transitionIndex[static_cast<bsl::size_t>(interval)];
+
+            while (position < lastPosition
+                && d_transitions[position + 1].utcTime() <= utcTimeT64) {
+                ++position;
+            }
+            return d_transitions.begin() + position;                  // RETURN
+        }
+    }
+
+    LocalTimeDescriptor dummyDescriptor;
+
     TransitionConstIterator it = bsl::upper_bound(
                                      d_transitions.begin(),
                                      d_transitions.end(),
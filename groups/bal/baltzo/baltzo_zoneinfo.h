@@ -64,6 +64,21 @@ BSLS_IDENT("$Id: $")
 // typically populated by the client through the 'baltzo::Loader' protocol, and
 // not directly.
 //
+///Transition Index
+///- - - - - - - -
+// By default, 'findTransitionForUtcTime' performs a binary search of the
+// sequence of transitions.  Once a 'baltzo::Zoneinfo' object is fully
+// populated, a client may call 'buildTransitionIndex' to precompute, for each
+// of a series of fixed-length (roughly seven week) intervals of UTC time
+// spanning January 1, 1970 through February 7, 2106, the transition in effect
+// at the start of that interval.  While the index is present,
+// 'findTransitionForUtcTime' locates the transition for a UTC time in that
+// range in constant time (for any realistic time zone, an interval contains
+// at most a couple of transitions), and falls back to the binary search for
+// times outside it.  The index occupies about 4K bytes, is not a salient
+// attribute, and is discarded by 'addTransition'.  Note that
+// 'baltzo::ZoneinfoCache' builds the index for every time zone it caches.
+//
 ///Zoneinfo Database
 ///-----------------
 // This database, also referred to as either the TZ database or the Olson
@@ -418,6 +433,13 @@ class Zoneinfo {
                           // optional POSIX-like TZ environment string
                           // representing far-reaching times
 
+    bsl::vector<int>    d_transitionIndex;
+                          // for each interval of UTC time covered by the
+                          // transition index, the position in 'd_transitions'
+                          // of the transition in effect at the start of the
+                          // interval; empty unless 'buildTransitionIndex' has
+                          // been called since the last 'addTransition'
+
     // FRIENDS
     friend bool operator==(const Zoneinfo&, const Zoneinfo&);
 
@@ -487,7 +509,16 @@ class Zoneinfo {
         // when the local time in the described time-zone adopts the
         // characteristics of the specified 'descriptor'.  If a transition at
         // 'utcTime' is already present, replace it's local-time descriptor
-        // with 'descriptor'.
+        // with 'descriptor'.  Note that this operation discards the
+        // transition index, if any (see 'buildTransitionIndex').
+
+    void buildTransitionIndex();
+        // Build an index of the transitions of this object with which
+        // 'findTransitionForUtcTime' finds the transition for a UTC time from
+        // January 1, 1970 up to February 7, 2106 in constant time.  The index
+        // is retained until the next call to 'addTransition'.  Note that the
+        // index is not a salient attribute of this object, and that calling
+        // this method when this object has no transitions has no effect.
 
     void setIdentifier(const bsl::string_view&  value);
     void setIdentifier(const char              *value);
@@ -514,13 +545,19 @@ class Zoneinfo {
         // that if no allocator was supplied at construction the currently
         // installed default allocator is used.
 
+    bool hasTransitionIndex() const;
+        // Return 'true' if this object holds a transition index (see
+        // 'buildTransitionIndex'), and 'false' otherwise.
+
     TransitionConstIterator findTransitionForUtcTime(
                                           const bdlt::Datetime& utcTime) const;
         // Return an iterator providing non-modifiable access to the transition
         // that holds the local-time descriptor associated with the specified
         // 'utcTime'.  The behavior is undefined unless 'numTransitions() > 0'
         // and 'utcTime' is at or after the transition returned by
-        // 'firstTransition'.
+        // 'firstTransition'.  Note that this operation takes constant time if
+        // 'hasTransitionIndex()' is 'true' and 'utcTime' is in the range of
+        // the index, and logarithmic time otherwise.
 
     const ZoneinfoTransition& firstTransition() const;
         // Return a reference providing non-modifiable access to the first
@@ -682,6 +719,7 @@ Zoneinfo::Zoneinfo()
 , d_descriptors()
 , d_transitions()
 , d_posixExtendedRangeDescription()
+, d_transitionIndex()
 {
 }
 
@@ -691,6 +729,7 @@ Zoneinfo::Zoneinfo(const allocator_type& allocator)
 , d_descriptors(allocator)
 , d_transitions(allocator)
 , d_posixExtendedRangeDescription(allocator)
+, d_transitionIndex(allocator)
 {
 }
 
@@ -744,6 +783,7 @@ void Zoneinfo::swap(Zoneinfo& other)
     bslalg::SwapUtil::swap(&d_transitions, &other.d_transitions);
     bslalg::SwapUtil::swap(&d_posixExtendedRangeDescription,
                            &other.d_posixExtendedRangeDescription);
+    bslalg::SwapUtil::swap(&d_transitionIndex, &other.d_transitionIndex);
 }
 
 // ACCESSORS
@@ -753,6 +793,12 @@ bslma::Allocator *Zoneinfo::allocator() const
     return get_allocator().mechanism();
 }
 
+inline
+bool Zoneinfo::hasTransitionIndex() const
+{
+    return !d_transitionIndex.empty();
+}
+
 inline
 const ZoneinfoTransition& Zoneinfo::firstTransition() const
 {
@@ -23,6 +23,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_platform.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
@@ -30,6 +31,7 @@
 #include <bsl_map.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #undef DS
 
@@ -110,10 +112,12 @@ using bsl::flush;
 // [ 2] void setPosixExtendedRangeDescription(const char *value);
 // [ 9] void setIdentifier(const bsl::string_view& identifier);
 // [13] void swap(baltzo::Zoneinfo& other);
+// [17] void buildTransitionIndex();
 
 // ACCESSORS
 // [ 4] bslma::Allocator *allocator() const;
 // [16] TransitionConstIterator findTransitionForUtcTime(utcTime) const;
+// [17] bool hasTransitionIndex() const;
 // [ 4] const Transition& firstTransition() const;
 // [ 4] allocator_type get_allocator() const;
 // [ 9] const bsl::string& identifier() const;
@@ -132,7 +136,8 @@ using bsl::flush;
 // [13] void swap(baltzo::Zoneinfo& first, baltzo::Zoneinfo& second);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST: 'baltzo::Zoneinfo', 'baltzo::ZoneinfoTransition'
-// [17] USAGE EXAMPLE
+// [18] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'findTransitionForUtcTime'
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -405,6 +410,65 @@ Obj g(const char *spec)
     return gg(&object, spec);
 }
 
+unsigned int nextRandom(unsigned int *seed)
+    // Advance the specified '*seed' and return a pseudo-random value in the
+    // range '[0 .. 2^24 - 1]'.
+{
+    *seed = *seed * 1103515245 + 12345;
+    return *seed >> 8;
+}
+
+void addYearlyTransitions(Obj *object, int beginYear, int endYear)
+    // Add to the specified 'object' a transition at 0001/01/01 to a standard
+    // time descriptor, followed by a transition to daylight-saving time on
+    // March 14 and back to standard time on November 7 of each year in the
+    // range '[beginYear .. endYear)'.
+{
+    const Descriptor EST(-5 * 60 * 60, false, "EST");
+    const Descriptor EDT(-4 * 60 * 60, true,  "EDT");
+
+    object->addTransition(
+              bdlt::EpochUtil::convertToTimeT64(bdlt::Datetime(1, 1, 1)), EST);
+
+    for (int year = beginYear; year < endYear; ++year) {
+        object->addTransition(bdlt::EpochUtil::convertToTimeT64(
+                                         bdlt::Datetime(year, 3, 14, 7, 0)),
+                              EDT);
+        object->addTransition(bdlt::EpochUtil::convertToTimeT64(
+                                         bdlt::Datetime(year, 11, 7, 6, 0)),
+                              EST);
+    }
+}
+
+void addRandomTransitions(Obj          *object,
+                          unsigned int *seed,
+                          int           numTransitions,
+                          TimeT64       begin,
+                          TimeT64       end)
+    // Add to the specified 'object' a transition at 0001/01/01, followed by
+    // the specified 'numTransitions' transitions at pseudo-random times,
+    // generated from the specified '*seed', in the range '[begin .. end)'.
+    // The behavior is undefined unless 'begin < end'.
+{
+    const Descriptor DESCRIPTORS[] = {
+        Descriptor(-5 * 60 * 60, false, "EST"),
+        Descriptor(-4 * 60 * 60, true,  "EDT"),
+        Descriptor(           0, false, "GMT"),
+    };
+
+    object->addTransition(
+                    bdlt::EpochUtil::convertToTimeT64(bdlt::Datetime(1, 1, 1)),
+                    DESCRIPTORS[0]);
+
+    for (int i = 0; i < numTransitions; ++i) {
+        const TimeT64 offset = ((static_cast<TimeT64>(nextRandom(seed)) << 24)
+                                                            | nextRandom(seed))
+                             % (end - begin);
+
+        object->addTransition(begin + offset, DESCRIPTORS[i % 3]);
+    }
+}
+
 //=============================================================================
 //                                USAGE
 //-----------------------------------------------------------------------------
@@ -469,6 +533,268 @@ int main(int argc, char *argv[])
 
     switch (test) { case 0:
       case 17: {
+        // --------------------------------------------------------------------
+        // 'baltzo::Zoneinfo' TRANSITION INDEX
+        //   Ensure that the transition index finds the same transitions as
+        //   the binary search, and that it is discarded and retained as
+        //   documented.
+        //
+        // Concerns:
+        //: 1 A default-constructed object has no transition index, and
+        //:   'buildTransitionIndex' has no effect on an object having no
+        //:   transitions.
+        //:
+        //: 2 Once 'buildTransitionIndex' is called, 'findTransitionForUtcTime'
+        //:   returns the same transition as it would without the index, for
+        //:   times before, within, and after the range of the index, at and
+        //:   adjacent to transitions and the boundaries of the index
+        //:   intervals, and when many transitions share an interval.
+        //:
+        //: 3 'addTransition' discards the index.
+        //:
+        //: 4 Copy construction, move construction, copy assignment, move
+        //:   assignment, and 'swap' carry the index with the transitions, and
+        //:   the index does not affect equality.
+        //:
+        //: 5 The index is allocated from the object allocator, and
+        //:   'findTransitionForUtcTime' does not allocate.
+        //
+        // Plan:
+        //: 1 Verify 'hasTransitionIndex' for a default-constructed object,
+        //:   before and after calling 'buildTransitionIndex'.  (C-1)
+        //:
+        //: 2 Create objects having yearly daylight-saving time transitions
+        //:   spanning the range of the index, pseudo-random transitions, and
+        //:   a cluster of transitions one second apart.  For each, create an
+        //:   indexed copy, and compare the transitions found by both for a
+        //:   set of times covering the cases of C-2.  (C-2, 5)
+        //:
+        //: 3 Add a transition to an indexed object and verify that the index
+        //:   is discarded.  (C-3)
+        //:
+        //: 4 Copy, move, assign, and swap indexed objects, and verify the
+        //:   index and the value of the results.  (C-4)
+        //:
+        //: 5 Use a test allocator monitor to verify that building the index
+        //:   allocates from the object allocator only.  (C-5)
+        //
+        // Testing:
+        //   void buildTransitionIndex();
+        //   bool hasTransitionIndex() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'baltzo::Zoneinfo' TRANSITION INDEX" << endl
+                          << "===================================" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const TimeT64 INTERVAL = TimeT64(1) << 22;
+        const TimeT64 END      = 1024 * INTERVAL;
+
+        if (verbose) cout << "\nTesting an object without transitions."
+                          << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(false == X.hasTransitionIndex());
+
+            mX.buildTransitionIndex();
+
+            ASSERT(false == X.hasTransitionIndex());
+            ASSERT(0     == oa.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nComparing against the binary search." << endl;
+
+        for (int ti = 0; ti < 3; ++ti) {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            switch (ti) {
+              case 0: {
+                addYearlyTransitions(&mX, 1900, 2200);
+              } break;
+              case 1: {
+                unsigned int seed = 1;
+                addRandomTransitions(&mX, &seed, 2000, -END, 2 * END);
+              } break;
+              default: {
+                addYearlyTransitions(&mX, 2000, 2010);
+                for (TimeT64 t = 3 * INTERVAL - 50;
+                             t < 3 * INTERVAL + 50;
+                             ++t) {
+                    mX.addTransition(t, Descriptor((t % 7) * 60,
+                                                   0 == t % 2,
+                                                   "X",
+                                                   &oa));
+                }
+              } break;
+            }
+
+            Obj mY(X, &oa);  const Obj& Y = mY;
+
+            bslma::TestAllocatorMonitor oam(&oa), dam(&da);
+
+            mY.buildTransitionIndex();
+
+            ASSERTV(ti, Y.hasTransitionIndex());
+            ASSERTV(ti, false == X.hasTransitionIndex());
+            ASSERTV(ti, oam.isTotalUp());
+            ASSERTV(ti, dam.isTotalSame());
+            ASSERTV(ti, X == Y);
+
+            bsl::vector<TimeT64> times;
+
+            for (TransitionConstIter it = X.beginTransitions();
+                                     it != X.endTransitions();
+                                     ++it) {
+                for (TimeT64 d = -1; d <= 1; ++d) {
+                    times.push_back(it->utcTime() + d);
+                }
+            }
+            for (TimeT64 t = -2 * INTERVAL; t <= END + 2 * INTERVAL;
+                                                             t += INTERVAL) {
+                for (TimeT64 d = -1; d <= 1; ++d) {
+                    times.push_back(t + d);
+                }
+            }
+            unsigned int seed = 2;
+            for (int i = 0; i < 10000; ++i) {
+                times.push_back(-END
+                              + (static_cast<TimeT64>(nextRandom(&seed)) << 3)
+                                                        % (4 * END));
+            }
+
+            const TimeT64 FIRST = X.firstTransition().utcTime();
+
+            bslma::TestAllocatorMonitor oam2(&oa);
+
+            for (bsl::size_t i = 0; i < times.size(); ++i) {
+                const TimeT64 T = times[i];
+
+                if (T < FIRST) {
+                    continue;
+                }
+
+                const bdlt::Datetime DT =
+                                        bdlt::EpochUtil::convertFromTimeT64(T);
+
+                const bsls::Types::Int64 EXP = X.findTransitionForUtcTime(DT)
+                                                       - X.beginTransitions();
+                const bsls::Types::Int64 POS = Y.findTransitionForUtcTime(DT)
+                                                       - Y.beginTransitions();
+
+                ASSERTV(ti, T, EXP, POS, EXP == POS);
+            }
+
+            ASSERTV(ti, oam2.isTotalSame());
+        }
+
+        if (verbose) cout << "\nTesting 'addTransition'." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            addYearlyTransitions(&mX, 2000, 2010);
+            mX.buildTransitionIndex();
+            ASSERT(true  == X.hasTransitionIndex());
+
+            mX.addTransition(X.firstTransition().utcTime(),
+                             X.firstTransition().descriptor());
+            ASSERT(false == X.hasTransitionIndex());
+
+            mX.buildTransitionIndex();
+            ASSERT(true  == X.hasTransitionIndex());
+        }
+
+        if (verbose) cout << "\nTesting copy, move, assignment, and 'swap'."
+                          << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+            Obj mW(&oa);  const Obj& W = mW;  // indexed
+            Obj mV(&oa);  const Obj& V = mV;  // not indexed
+
+            addYearlyTransitions(&mW, 1990, 2020);
+            addYearlyTransitions(&mV, 1960, 1990);
+            mW.buildTransitionIndex();
+
+            const Obj EXP_W(W, &oa);
+            const Obj EXP_V(V, &oa);
+
+            {
+                const Obj X(W, &oa);
+                const Obj Y(W, &za);
+                const Obj Z(V, &oa);
+
+                ASSERT(true  == X.hasTransitionIndex());  ASSERT(W == X);
+                ASSERT(true  == Y.hasTransitionIndex());  ASSERT(W == Y);
+                ASSERT(false == Z.hasTransitionIndex());  ASSERT(V == Z);
+            }
+            {
+                Obj mS(W, &oa);
+                Obj mT(W, &oa);
+
+                const Obj X(bslmf::MovableRefUtil::move(mS));
+                const Obj Y(bslmf::MovableRefUtil::move(mT), &za);
+
+                ASSERT(true  == X.hasTransitionIndex());  ASSERT(W == X);
+                ASSERT(true  == Y.hasTransitionIndex());  ASSERT(W == Y);
+            }
+            {
+                Obj mX(V, &oa);  const Obj& X = mX;
+                Obj mY(V, &za);  const Obj& Y = mY;
+
+                mX = W;
+                mY = W;
+
+                ASSERT(true  == X.hasTransitionIndex());  ASSERT(W == X);
+                ASSERT(true  == Y.hasTransitionIndex());  ASSERT(W == Y);
+
+                mX = V;
+
+                ASSERT(false == X.hasTransitionIndex());  ASSERT(V == X);
+            }
+            {
+                Obj mS(W, &oa);
+                Obj mT(W, &za);
+
+                Obj mX(V, &oa);  const Obj& X = mX;
+                Obj mY(V, &oa);  const Obj& Y = mY;
+
+                mX = bslmf::MovableRefUtil::move(mS);
+                mY = bslmf::MovableRefUtil::move(mT);
+
+                ASSERT(true  == X.hasTransitionIndex());  ASSERT(W == X);
+                ASSERT(true  == Y.hasTransitionIndex());  ASSERT(W == Y);
+            }
+            {
+                Obj mX(W, &oa);  const Obj& X = mX;
+                Obj mY(V, &oa);  const Obj& Y = mY;
+
+                mX.swap(mY);
+
+                ASSERT(false == X.hasTransitionIndex());  ASSERT(V == X);
+                ASSERT(true  == Y.hasTransitionIndex());  ASSERT(W == Y);
+
+                swap(mX, mY);
+
+                ASSERT(true  == X.hasTransitionIndex());  ASSERT(W == X);
+                ASSERT(false == Y.hasTransitionIndex());  ASSERT(V == Y);
+            }
+
+            ASSERT(EXP_W == W);
+            ASSERT(EXP_V == V);
+        }
+      } break;
+      case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -5242,6 +5568,69 @@ int main(int argc, char *argv[])
         ASSERT(0 == (X1 == X4));        ASSERT(1 == (X1 != X4));
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'findTransitionForUtcTime'
+        //   Compare the cost of finding the transition for a UTC time with
+        //   and without the transition index.
+        //
+        // Concerns:
+        //: 1 The transition index makes 'findTransitionForUtcTime' faster for
+        //:   a time zone having many transitions.
+        //
+        // Plan:
+        //: 1 Create a time zone having yearly daylight-saving time
+        //:   transitions from 1900 through 2037, time repeated lookups of
+        //:   pseudo-random times from 1970 through 2037 with and without the
+        //:   index, and report the average cost per lookup.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: 'findTransitionForUtcTime'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: 'findTransitionForUtcTime'" << endl
+             << "=======================================" << endl;
+
+        const int NUM_TIMES      = 100000;
+        const int NUM_ITERATIONS = 20;
+
+        Obj mX;  const Obj& X = mX;
+        addYearlyTransitions(&mX, 1900, 2038);
+
+        Obj mY(X);  const Obj& Y = mY;
+        mY.buildTransitionIndex();
+
+        const TimeT64 END = bdlt::EpochUtil::convertToTimeT64(
+                                                  bdlt::Datetime(2038, 1, 1));
+
+        bsl::vector<bdlt::Datetime> times;
+        unsigned int                seed = 3;
+        for (int i = 0; i < NUM_TIMES; ++i) {
+            times.push_back(bdlt::EpochUtil::convertFromTimeT64(
+                                                   nextRandom(&seed) % END));
+        }
+
+        for (int indexed = 0; indexed < 2; ++indexed) {
+            const Obj&         Z        = indexed ? Y : X;
+            bsls::Types::Int64 checksum = 0;
+            bsls::Stopwatch    timer;
+
+            timer.start();
+            for (int j = 0; j < NUM_ITERATIONS; ++j) {
+                for (int i = 0; i < NUM_TIMES; ++i) {
+                    checksum += Z.findTransitionForUtcTime(times[i])
+                                                       - Z.beginTransitions();
+                }
+            }
+            timer.stop();
+
+            cout << (indexed ? "with index    " : "without index ")
+                 << "(ns/lookup): "
+                 << timer.elapsedTime() * 1.0e9 / NUM_ITERATIONS / NUM_TIMES
+                 << "  (checksum " << checksum << ")" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -7,8 +7,7 @@ BSLS_IDENT_RCSID(baltzo_zoneinfocache_cpp, "$Id$ $CSID$")
 #include <baltzo_errorcode.h>         // for testing only
 #include <baltzo_zoneinfoutil.h>
 
-#include <bslmt_readlockguard.h>
-#include <bslmt_writelockguard.h>
+#include <bslmt_lockguard.h>
 
 #include <bslma_allocator.h>
 #include <bslma_rawdeleterproctor.h>
@@ -17,12 +16,70 @@ BSLS_IDENT_RCSID(baltzo_zoneinfocache_cpp, "$Id$ $CSID$")
 
 #include <bsls_log.h>
 
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
 #include <bsl_set.h>
 #include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace baltzo {
 
+                       // ------------------------------
+                       // struct ZoneinfoCache::Snapshot
+                       // ------------------------------
+
+struct ZoneinfoCache::Snapshot {
+    // This 'struct' holds an immutable sequence of the time zones cached at
+    // the time it was published, sorted by identifier.
+
+    // TYPES
+    typedef bsl::pair<const char *, const Zoneinfo *> Entry;
+        // Time-zone identifier and the cached information for that time
+        // zone.
+
+    struct EntryLess {
+        // This 'struct' orders an 'Entry' against a time-zone identifier.
+
+        bool operator()(const Entry& entry, const char *timeZoneId) const
+            // Return 'true' if the identifier of the specified 'entry' is
+            // ordered before the specified 'timeZoneId', and 'false'
+            // otherwise.
+        {
+            return bsl::strcmp(entry.first, timeZoneId) < 0;
+        }
+    };
+
+    // DATA
+    bsl::vector<Entry> d_entries;  // cached time zones, sorted by id
+
+    // CREATORS
+    explicit Snapshot(const allocator_type& allocator)
+        // Create an empty snapshot that uses the specified 'allocator' to
+        // supply memory.
+    : d_entries(allocator)
+    {
+    }
+
+    // ACCESSORS
+    const Zoneinfo *find(const char *timeZoneId) const
+        // Return the address of the time-zone information in this snapshot
+        // having the specified 'timeZoneId', or 0 if there is none.
+    {
+        bsl::vector<Entry>::const_iterator it =
+                                  bsl::lower_bound(d_entries.begin(),
+                                                   d_entries.end(),
+                                                   timeZoneId,
+                                                   EntryLess());
+
+        if (d_entries.end() != it && 0 == bsl::strcmp(it->first, timeZoneId)) {
+            return it->second;                                        // RETURN
+        }
+        return 0;
+    }
+};
+
                             // -------------------
                             // class ZoneinfoCache
                             // -------------------
@@ -30,6 +87,8 @@ namespace baltzo {
 // CREATORS
 ZoneinfoCache::~ZoneinfoCache()
 {
+    d_allocator.mechanism()->deleteObject(d_snapshot_p.loadRelaxed());
+
     for (ZoneinfoMap::iterator it  = d_cache.begin();
                                it != d_cache.end();
                                ++it) {
@@ -59,7 +118,7 @@ const Zoneinfo *ZoneinfoCache::getZoneinfo(int *rc, const char *timeZoneId)
         return result;                                                // RETURN
     }
 
-    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_lock);
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
 
     // We use 'lower_bound' to return the position where the 'timeZoneId'
     // should be (even if it is not in the map), so that it can be used as an
@@ -69,7 +128,7 @@ const Zoneinfo *ZoneinfoCache::getZoneinfo(int *rc, const char *timeZoneId)
 
     if (d_cache.end() != it && !(d_cache.key_comp()(timeZoneId, it->first))) {
         // 'timeZoneId' must have been added to the map between the call to
-        // 'lookupTimeZone', and the acquisition of the write-lock on 'd_lock'.
+        // 'lookupZoneinfo', and the acquisition of the lock on 'd_lock'.
 
         BSLS_ASSERT(0 != it->second);
         *rc    = 0;
@@ -109,15 +168,50 @@ const Zoneinfo *ZoneinfoCache::getZoneinfo(int *rc, const char *timeZoneId)
             return 0;                                                 // RETURN
         }
 
-        d_cache.insert(
-                  it,
-                  ZoneinfoMap::value_type(newTimeZonePtr->identifier().c_str(),
-                                          newTimeZonePtr));
+        newTimeZonePtr->buildTransitionIndex();
+
+        // Build the snapshot to publish, which holds the entries of 'd_cache'
+        // with the new time zone inserted before 'it', before modifying
+        // 'd_cache', so that a failure leaves the cache unchanged.
+
+        const char *newTimeZoneId = newTimeZonePtr->identifier().c_str();
+
+        Snapshot *snapshot = new (*d_allocator.mechanism())
+                                                        Snapshot(d_allocator);
+
+        bslma::RawDeleterProctor<Snapshot, bslma::Allocator> snapshotProctor(
+                                                      snapshot,
+                                                      d_allocator.mechanism());
+
+        snapshot->d_entries.reserve(d_cache.size() + 1);
+        snapshot->d_entries.insert(snapshot->d_entries.end(),
+                                   d_cache.begin(),
+                                   it);
+        snapshot->d_entries.push_back(Snapshot::Entry(newTimeZoneId,
+                                                      newTimeZonePtr));
+        snapshot->d_entries.insert(snapshot->d_entries.end(),
+                                   it,
+                                   d_cache.end());
+
+        d_cache.insert(it,
+                       ZoneinfoMap::value_type(newTimeZoneId, newTimeZonePtr));
         result = newTimeZonePtr;
 
-        // The pointer has been copied, so the proctor must release ownership.
+        // The pointers have been copied, so the proctors must release
+        // ownership.
 
         proctor.release();
+        snapshotProctor.release();
+
+        // Publish the new snapshot.  Every lookup that starts from now on
+        // observes it, so the replaced snapshot is no longer in use once the
+        // lookups now in progress have completed.
+
+        const Snapshot *previous = d_snapshot_p.swap(snapshot);
+
+        d_gracePeriod.synchronize();
+
+        d_allocator.mechanism()->deleteObject(previous);
     }
 
     return result;
@@ -128,13 +222,16 @@ const Zoneinfo *ZoneinfoCache::lookupZoneinfo(const char *timeZoneId) const
 {
     BSLS_ASSERT(0 != timeZoneId);
 
-    bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_lock);
+    // The snapshot is loaded after entering the grace period, so that a load
+    // that replaces it, and then synchronizes with the grace period, can
+    // safely destroy it.  The returned 'Zoneinfo' is owned by 'd_cache', and
+    // so outlives the snapshot.
 
-    ZoneinfoMap::const_iterator it = d_cache.find(timeZoneId);
-    if (d_cache.end() != it) {
-        return it->second;                                            // RETURN
-    }
-    return 0;
+    bslmt::GracePeriodReadGuard guard(&d_gracePeriod);
+
+    const Snapshot *snapshot = d_snapshot_p.load();
+
+    return snapshot ? snapshot->find(timeZoneId) : 0;
 }
 
 }  // close package namespace
@@ -20,7 +20,10 @@ BSLS_IDENT("$Id: $")
 // previously cached data, or if that data is not cache-resident, a new loaded
 // 'baltzo::Zoneinfo' object, which is cached for use in subsequent calls to
 // 'getZoneinfo' and 'lookupZoneinfo'.  Addresses returned by either of these
-// methods are valid for the lifetime of the cache.
+// methods are valid for the lifetime of the cache.  Before a newly loaded
+// 'baltzo::Zoneinfo' object is cached, its transition index is built (see
+// 'baltzo::Zoneinfo::buildTransitionIndex'), so that converting a UTC time to
+// local time using a cached time zone takes constant time.
 //
 ///Thread Safety
 ///-------------
@@ -28,6 +31,18 @@ BSLS_IDENT("$Id: $")
 // operations on an object can be safely invoked simultaneously from multiple
 // threads.
 //
+// Looking up a time zone that is already cached (with either 'lookupZoneinfo'
+// or 'getZoneinfo') does not acquire a lock.  The cache publishes an
+// immutable, sorted snapshot of its contents through an atomic pointer, and
+// readers search the most recently published snapshot.  Loading a time zone
+// is serialized by a mutex, and publishes a new snapshot that replaces the
+// previous one.  Because a reader may still be searching a replaced snapshot,
+// the loading thread waits, using a 'bslmt::GracePeriod', for the lookups in
+// progress to complete, and then destroys the replaced snapshot; at most one
+// replaced snapshot therefore exists at any time.  Loading a time zone may
+// consequently block (briefly) until concurrent lookups complete, but lookups
+// never block.
+//
 ///Usage
 ///-----
 // In this section, we demonstrate creating a 'baltzo::ZoneinfoCache' object
@@ -156,7 +171,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
-#include <bslmt_rwmutex.h>
+#include <bslmt_graceperiod.h>
+#include <bslmt_mutex.h>
 
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
@@ -193,16 +209,33 @@ class ZoneinfoCache {
     // PRIVATE TYPES
     typedef bsl::map<const char *, Zoneinfo *, bdlb::CStringLess> ZoneinfoMap;
 
+    struct Snapshot;
+        // Immutable sorted sequence of the cached time zones, searched by
+        // readers without locking (defined in the implementation).
+
     // DATA
-    ZoneinfoMap             d_cache;      // cached time-zone info, indexed by
-                                          // time-zone id
+    ZoneinfoMap                          d_cache;       // cached time-zone
+                                                        // info, indexed by
+                                                        // time-zone id
+
+    bsls::AtomicPointer<const Snapshot>  d_snapshot_p;  // most recently
+                                                        // published snapshot
+                                                        // of 'd_cache' (owned)
+
+    Loader                              *d_loader_p;    // loader used to
+                                                        // obtain time-zone
+                                                        // information (held,
+                                                        // not owned)
 
-    Loader                 *d_loader_p;   // loader used to obtain time-zone
-                                          // information (held, not owned)
+    bslmt::Mutex                         d_lock;        // serializes loading
+                                                        // of time zones
 
-    mutable bslmt::RWMutex  d_lock;       // cache access synchronization
+    mutable bslmt::GracePeriod           d_gracePeriod; // lookups of
+                                                        // 'd_snapshot_p' in
+                                                        // progress
 
-    allocator_type          d_allocator;  // allocator used to supply memory
+    allocator_type                       d_allocator;   // allocator used to
+                                                        // supply memory
 
     // NOT IMPLEMENTED
     ZoneinfoCache(const ZoneinfoCache&);
@@ -277,7 +310,10 @@ class ZoneinfoCache {
 inline
 ZoneinfoCache::ZoneinfoCache(Loader *loader, const allocator_type&  allocator)
 : d_cache(allocator)
+, d_snapshot_p(0)
 , d_loader_p(loader)
+, d_lock()
+, d_gracePeriod()
 , d_allocator(allocator)
 {
     BSLS_ASSERT(0 != loader);
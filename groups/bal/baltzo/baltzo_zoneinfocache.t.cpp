@@ -5,6 +5,8 @@
 #include <baltzo_localtimedescriptor.h>
 #include <baltzo_zoneinfo.h>
 
+#include <bdlb_cstringless.h>
+
 #include <bdlt_datetime.h>
 #include <bdlt_epochutil.h>
 
@@ -32,6 +34,8 @@
 #include <bsl_map.h>
 #include <bsl_memory.h>
 #include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace std;
@@ -81,7 +85,9 @@ using namespace std;
 // [ 4] allocator_type get_allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 9] USAGE EXAMPLE
+// [10] USAGE EXAMPLE
+// [ 9] CONCERN: Lookups see each published snapshot of the cache
+// [ 9] CONCERN: Cached time zones have a transition index
 // [ 8] CONCERN: All methods are thread-safe
 // [ 7] CONCERN: ACCESSOR methods are declared 'const'.
 // [ 6] CONCERN: CREATOR & MANIPULATOR parameters are declared 'const'.
@@ -513,6 +519,65 @@ extern "C" void *workerThread(void *arg)
 
 }  // close namespace BALTZO_ZONEINFOCACHE_CONCURRENCY
 
+// ============================================================================
+//                       SNAPSHOT CONCERNS RELATED ENTRIES
+// ----------------------------------------------------------------------------
+
+namespace BALTZO_ZONEINFOCACHE_SNAPSHOT {
+
+struct ReaderData {
+    const Obj                      *d_cache_p;       // cache under test
+    const bsl::vector<bsl::string> *d_ids_p;         // time-zone ids
+    bsls::AtomicBool               *d_done_p;        // set once all ids are
+                                                     // loaded
+    bsls::AtomicInt                *d_numObserved_p; // number of lookups that
+                                                     // found a time zone
+};
+
+extern "C" void *readerThread(void *arg)
+    // Repeatedly look up each time-zone id in the 'ReaderData' addressed by
+    // the specified 'arg' until all are loaded, verifying that each time zone
+    // found has the requested id and a transition index, and that once found,
+    // a time zone remains found at the same address.
+{
+    const ReaderData&               data = *static_cast<ReaderData *>(arg);
+    const Obj&                      X    = *data.d_cache_p;
+    const bsl::vector<bsl::string>& IDS  = *data.d_ids_p;
+
+    bsl::vector<const Zone *> observed(IDS.size(), 0);
+    int                       numObserved = 0;
+
+    bool done = false;
+    while (!done) {
+        // Read 'd_done_p' before the final pass, so that the final pass sees
+        // every time zone.
+
+        done = data.d_done_p->load();
+
+        for (bsl::size_t i = 0; i < IDS.size(); ++i) {
+            const Zone *result = X.lookupZoneinfo(IDS[i].c_str());
+
+            if (0 == result) {
+                ASSERTV(i, 0 == observed[i]);
+                ASSERTV(i, !done);
+                continue;
+            }
+
+            ASSERTV(i, IDS[i] == result->identifier());
+            ASSERTV(i, result->hasTransitionIndex());
+            ASSERTV(i, 0 == observed[i] || result == observed[i]);
+
+            observed[i] = result;
+            ++numObserved;
+        }
+    }
+
+    data.d_numObserved_p->add(numObserved);
+    return 0;
+}
+
+}  // close namespace BALTZO_ZONEINFOCACHE_SNAPSHOT
+
 // ============================================================================
 //                               USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -648,7 +713,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocatorMonitor gam(&globalAllocator);
 
     switch (test) { case 0:
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -782,6 +847,176 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING SNAPSHOT PUBLICATION
+        //
+        // Concerns:
+        //: 1 A time zone loaded by 'getZoneinfo' has a transition index.
+        //:
+        //: 2 After each time zone is loaded, 'lookupZoneinfo' finds every
+        //:   loaded time zone, at the address returned by 'getZoneinfo', and
+        //:   no other, whatever the order in which the time zones are loaded.
+        //:
+        //: 3 A reader calling 'lookupZoneinfo' concurrently with the loading
+        //:   of time zones finds either nothing or the loaded time zone, and
+        //:   once it finds a time zone, finds it on every later call.
+        //:
+        //: 4 A replaced snapshot is released by the load that replaces it, so
+        //:   that the memory in use is that of the cached time zones and a
+        //:   single snapshot.
+        //:
+        //: 5 All memory is released when the cache is destroyed.
+        //
+        // Plan:
+        //: 1 Create a loader supplying a number of time zones, and load them,
+        //:   in a pseudo-random order, into a cache.  After each load, verify
+        //:   'hasTransitionIndex' and look up every time zone.  (C-1..2)
+        //:
+        //: 2 After each load, verify that the number of blocks in use is that
+        //:   used by the loaded time zones (each measured by loading it
+        //:   outside the cache) and by a map of the same identifiers, plus
+        //:   the two blocks of a single snapshot.  (C-4)
+        //:
+        //: 3 Load the time zones into a new cache while several threads
+        //:   repeatedly look up every time zone, verifying the results.  (C-3)
+        //:
+        //: 4 Verify that the test allocator supplying each cache has no
+        //:   memory in use after the cache is destroyed.  (C-5)
+        //
+        // Testing:
+        //   CONCERN: Lookups see each published snapshot of the cache
+        //   CONCERN: Cached time zones have a transition index
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING SNAPSHOT PUBLICATION" << endl
+                                  << "============================" << endl;
+
+        using namespace BALTZO_ZONEINFOCACHE_SNAPSHOT;
+
+        enum { NUM_IDS = 100 };
+
+        bslma::TestAllocator testAllocator;
+
+        bsl::vector<bsl::string> ids(&testAllocator);
+        bsl::vector<int>         order(&testAllocator);
+
+        TestDriverTestLoader testLoader(&testAllocator);
+        for (int i = 0; i < NUM_IDS; ++i) {
+            const char ID[] = { 'Z', 'O', 'N', 'E', '_',
+                                static_cast<char>('0' + i / 10),
+                                static_cast<char>('0' + i % 10),
+                                '\0' };
+
+            ids.push_back(bsl::string(ID, &testAllocator));
+            order.push_back(i);
+            testLoader.addTimeZone(ID, 60 * i, 0 == i % 2, "X");
+        }
+
+        unsigned int seed = 9;
+        for (int i = NUM_IDS - 1; 0 < i; --i) {
+            seed = seed * 1103515245 + 12345;
+            bsl::swap(order[i], order[(seed >> 8) % (i + 1)]);
+        }
+
+        if (verbose) cout << "\tLoading sequentially." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            {
+                Obj mX(&testLoader, &oa);  const Obj& X = mX;
+
+                bsl::vector<const Zone *> loaded(NUM_IDS, 0, &testAllocator);
+
+                // The map indexing the cached time zones allocates its nodes
+                // in chunks, so its memory use is measured by a map of the
+                // same identifiers.
+
+                typedef bsl::map<const char *,
+                                 const Zone *,
+                                 bdlb::CStringLess> ZoneMap;
+
+                bslma::TestAllocator ma("map", veryVeryVeryVerbose);
+                ZoneMap              map(&ma);
+
+                // The time zones, their map nodes, and the snapshot and its
+                // sequence of entries.
+
+                bsls::Types::Int64 zoneNumBlocks = 0;
+
+                for (int i = 0; i < NUM_IDS; ++i) {
+                    const int   INDEX = order[i];
+                    const Zone *ZONE  = mX.getZoneinfo(ids[INDEX].c_str());
+
+                    ASSERTV(i, INDEX, 0 != ZONE);
+                    ASSERTV(i, INDEX, ZONE->hasTransitionIndex());
+
+                    loaded[INDEX] = ZONE;
+
+                    {
+                        bslma::TestAllocator za("zone", veryVeryVeryVerbose);
+
+                        Zone zone(&za);
+                        ASSERTV(i, 0 == testLoader.loadTimeZone(
+                                                        &zone,
+                                                        ids[INDEX].c_str()));
+                        zone.buildTransitionIndex();
+
+                        zoneNumBlocks += za.numBlocksInUse() + 1;
+                    }
+
+                    map[ZONE->identifier().c_str()] = ZONE;
+
+                    const bsls::Types::Int64 expectedNumBlocks =
+                                    zoneNumBlocks + ma.numBlocksInUse() + 2;
+
+                    ASSERTV(i, expectedNumBlocks, oa.numBlocksInUse(),
+                            expectedNumBlocks == oa.numBlocksInUse());
+
+                    for (int j = 0; j < NUM_IDS; ++j) {
+                        ASSERTV(i, j, loaded[j] ==
+                                             X.lookupZoneinfo(ids[j].c_str()));
+                    }
+                }
+            }
+            ASSERTV(oa.numBytesInUse(), 0 == oa.numBytesInUse());
+        }
+
+        if (verbose) cout << "\tLoading with concurrent readers." << endl;
+        {
+            enum { NUM_READERS = 4 };
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            {
+                Obj mX(&testLoader, &oa);
+
+                bsls::AtomicBool done(false);
+                bsls::AtomicInt  numObserved(0);
+                ReaderData       data = { &mX, &ids, &done, &numObserved };
+
+                bslmt::ThreadUtil::Handle readers[NUM_READERS];
+                for (int i = 0; i < NUM_READERS; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::create(&readers[i],
+                                                          readerThread,
+                                                          &data));
+                }
+
+                for (int i = 0; i < NUM_IDS; ++i) {
+                    ASSERTV(i, 0 != mX.getZoneinfo(ids[order[i]].c_str()));
+                    bslmt::ThreadUtil::yield();
+                }
+                done = true;
+
+                for (int i = 0; i < NUM_READERS; ++i) {
+                    bslmt::ThreadUtil::join(readers[i]);
+                }
+
+                ASSERTV(numObserved, NUM_READERS * NUM_IDS <= numObserved);
+            }
+            ASSERTV(oa.numBytesInUse(), 0 == oa.numBytesInUse());
+        }
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // TESTING CONCURRENT ACCESS
@@ -269,6 +269,7 @@ BSLS_IDENT("$Id: $")
 #include <bdlat_choicefunctions.h>
 #include <bdlat_customizedtypefunctions.h>
 #include <bdlat_formattingmode.h>
+#include <bdlat_nameindex.h>
 #include <bdlat_nullablevaluefunctions.h>
 #include <bdlat_sequencefunctions.h>
 #include <bdlat_typecategory.h>
@@ -2430,10 +2431,10 @@ int Decoder_SequenceContext<TYPE>::parseAttribute(const char  *name,
 
     Decoder_ParseAttribute visitor(decoder, name, value, lenValue);
 
-    if (0 != bdlat_SequenceFunctions::manipulateAttribute(d_object_p,
-                                                          visitor,
-                                                          name,
-                                                          lenName)) {
+    if (0 != bdlat::NameIndexUtil::manipulateAttribute(d_object_p,
+                                                       visitor,
+                                                       name,
+                                                       lenName)) {
         if (visitor.failed()) {
             return k_FAILURE;                                         // RETURN
         }
@@ -2452,9 +2453,9 @@ int Decoder_SequenceContext<TYPE>::parseSubElement(const char *elementName,
     const int lenName = static_cast<int>(bsl::strlen(elementName));
 
     if (decoder->options()->skipUnknownElements()
-     && false == bdlat_SequenceFunctions::hasAttribute(*d_object_p,
-                                                       elementName,
-                                                       lenName)) {
+     && false == bdlat::NameIndexUtil::hasAttribute(*d_object_p,
+                                                    elementName,
+                                                    lenName)) {
         decoder->setNumUnknownElementsSkipped(
                                      decoder->numUnknownElementsSkipped() + 1);
         Decoder_UnknownElementContext unknownElement;
@@ -2463,10 +2464,10 @@ int Decoder_SequenceContext<TYPE>::parseSubElement(const char *elementName,
 
     Decoder_ParseSequenceSubElement visitor(decoder, elementName, lenName);
 
-    return bdlat_SequenceFunctions::manipulateAttribute(d_object_p,
-                                                        visitor,
-                                                        elementName,
-                                                        lenName);
+    return bdlat::NameIndexUtil::manipulateAttribute(d_object_p,
+                                                     visitor,
+                                                     elementName,
+                                                     lenName);
 }
 
                      // ---------------------------------
@@ -2985,7 +2986,7 @@ int Decoder_ParseObject::executeImp(
 
     if (formattingMode & bdlat_FormattingMode::e_UNTAGGED) {
         if (d_decoder->options()->skipUnknownElements()
-         && false == bdlat_SequenceFunctions::hasAttribute(
+         && false == bdlat::NameIndexUtil::hasAttribute(
                                                 *object,
                                                 d_elementName_p,
                                                 static_cast<int>(d_lenName))) {
@@ -2995,7 +2996,7 @@ int Decoder_ParseObject::executeImp(
             return unknownElement.beginParse(d_decoder);              // RETURN
         }
 
-        return bdlat_SequenceFunctions::manipulateAttribute(
+        return bdlat::NameIndexUtil::manipulateAttribute(
                                                   object,
                                                   *this,
                                                   d_elementName_p,
@@ -14,13 +14,21 @@ BSLS_IDENT_RCSID(balxml_minireader_cpp,"$Id$ $CSID$")
 
 #include <balxml_errorinfo.h>
 
+#include <bdlb_bitutil.h>
+
 #include <bsls_assert.h>
+#include <bsls_platform.h>
 
 #include <bsl_algorithm.h>  // for 'swap'
 #include <bsl_cctype.h>
 #include <bsl_climits.h>
+#include <bsl_cstdint.h>
 #include <bsl_cstring.h>    // for 'strlen', 'strcspn', 'memcmp'
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
 // IMPLEMENTATION NOTES
 // --------------------
 
@@ -282,6 +290,199 @@ void replaceCharReferences(char *text)
     *output = '\0';
 }
 
+// The following functions locate delimiters in the parse buffer, which
+// 'MiniReader' always terminates with a null character at 'd_endPtr'.  Where
+// SSE2 is available they examine 16 characters at a time while at least that
+// many remain before the specified 'end', and finish the scan one character
+// at a time, stopping at the terminating null character at the latest.  NL
+// characters are tallied in bulk rather than one at a time, so that text
+// spanning many lines does not interrupt the scan.
+
+typedef BloombergLP::bdlb::BitUtil BitUtil;
+
+inline
+void tallyNewLines(int            *numNewLines,
+                   const char    **lastNewLine,
+                   const char     *block,
+                   bsl::uint32_t   mask)
+    // Add to the specified 'numNewLines' the number of bits set in the
+    // specified 'mask', each of which marks an NL character in the 16
+    // characters starting at the specified 'block', and, if 'mask' is not 0,
+    // load into the specified 'lastNewLine' the address of the last NL
+    // character marked.
+{
+    if (mask) {
+        *numNewLines += BitUtil::numBitsSet(mask);
+        *lastNewLine  = block + 31 - BitUtil::numLeadingUnsetBits(mask);
+    }
+}
+
+const char *findSymbol(const char  *cursor,
+                       const char  *end,
+                       char         symbol,
+                       int         *numNewLines,
+                       const char **lastNewLine)
+    // Return the address of the first character at or after the specified
+    // 'cursor' that is either the specified 'symbol' or the null character.
+    // Load into the specified 'numNewLines' the number of NL characters
+    // preceding the returned address and, if there are any, load into the
+    // specified 'lastNewLine' the address of the last of them.  The behavior
+    // is undefined unless '*end' is the null character, 'cursor <= end', and
+    // 'symbol' is not NL.
+{
+    BSLS_ASSERT(cursor <= end);
+    BSLS_ASSERT('\n' != symbol);
+
+    *numNewLines = 0;
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    const __m128i symbolBlock  = _mm_set1_epi8(symbol);
+    const __m128i newLineBlock = _mm_set1_epi8('\n');
+    const __m128i nullBlock    = _mm_setzero_si128();
+
+    while (end - cursor >= 16) {
+        const __m128i block =
+                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(cursor));
+        const bsl::uint32_t stopMask = _mm_movemask_epi8(
+                               _mm_or_si128(_mm_cmpeq_epi8(block, symbolBlock),
+                                            _mm_cmpeq_epi8(block, nullBlock)));
+        bsl::uint32_t newLineMask = _mm_movemask_epi8(
+                                          _mm_cmpeq_epi8(block, newLineBlock));
+
+        if (stopMask) {
+            const int index = BitUtil::numTrailingUnsetBits(stopMask);
+            newLineMask &= (1u << index) - 1;
+            tallyNewLines(numNewLines, lastNewLine, cursor, newLineMask);
+            return cursor + index;                                    // RETURN
+        }
+        tallyNewLines(numNewLines, lastNewLine, cursor, newLineMask);
+        cursor += 16;
+    }
+#else
+    (void)end;
+#endif
+
+    for (; symbol != *cursor && '\0' != *cursor; ++cursor) {
+        if ('\n' == *cursor) {
+            ++*numNewLines;
+            *lastNewLine = cursor;
+        }
+    }
+    return cursor;
+}
+
+const char *findSymbolOrSpace(const char *cursor,
+                              const char *end,
+                              char        symbol1,
+                              char        symbol2)
+    // Return the address of the first character at or after the specified
+    // 'cursor' that is the specified 'symbol1', the specified 'symbol2', a
+    // space, TAB, CR or NL character, or the null character.  The behavior is
+    // undefined unless '*end' is the null character and 'cursor <= end'.
+{
+    BSLS_ASSERT(cursor <= end);
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    const __m128i symbol1Block = _mm_set1_epi8(symbol1);
+    const __m128i symbol2Block = _mm_set1_epi8(symbol2);
+    const __m128i spaceBlock   = _mm_set1_epi8(' ');
+    const __m128i tabBlock     = _mm_set1_epi8('\t');
+    const __m128i crBlock      = _mm_set1_epi8('\r');
+    const __m128i newLineBlock = _mm_set1_epi8('\n');
+    const __m128i nullBlock    = _mm_setzero_si128();
+
+    while (end - cursor >= 16) {
+        const __m128i block =
+                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(cursor));
+        const __m128i symbols = _mm_or_si128(
+                                       _mm_cmpeq_epi8(block, symbol1Block),
+                                       _mm_cmpeq_epi8(block, symbol2Block));
+        const __m128i spaces = _mm_or_si128(
+                            _mm_or_si128(_mm_cmpeq_epi8(block, spaceBlock),
+                                         _mm_cmpeq_epi8(block, tabBlock)),
+                            _mm_or_si128(_mm_cmpeq_epi8(block, crBlock),
+                                         _mm_cmpeq_epi8(block, newLineBlock)));
+        const bsl::uint32_t stopMask = _mm_movemask_epi8(
+                          _mm_or_si128(_mm_or_si128(symbols, spaces),
+                                       _mm_cmpeq_epi8(block, nullBlock)));
+
+        if (stopMask) {
+            return cursor + BitUtil::numTrailingUnsetBits(stopMask);
+                                                                      // RETURN
+        }
+        cursor += 16;
+    }
+#else
+    (void)end;
+#endif
+
+    for (;; ++cursor) {
+        const char ch = *cursor;
+        if (symbol1 == ch || symbol2 == ch || ' ' == ch || '\t' == ch
+         || '\r' == ch || '\n' == ch || '\0' == ch) {
+            return cursor;                                            // RETURN
+        }
+    }
+}
+
+const char *skipWhitespace(const char  *cursor,
+                           const char  *end,
+                           int         *numNewLines,
+                           const char **lastNewLine)
+    // Return the address of the first character at or after the specified
+    // 'cursor' that is not a space, TAB, CR or NL character.  Load into the
+    // specified 'numNewLines' the number of NL characters preceding the
+    // returned address and, if there are any, load into the specified
+    // 'lastNewLine' the address of the last of them.  The behavior is
+    // undefined unless '*end' is the null character and 'cursor <= end'.
+{
+    BSLS_ASSERT(cursor <= end);
+
+    *numNewLines = 0;
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    const __m128i spaceBlock   = _mm_set1_epi8(' ');
+    const __m128i tabBlock     = _mm_set1_epi8('\t');
+    const __m128i crBlock      = _mm_set1_epi8('\r');
+    const __m128i newLineBlock = _mm_set1_epi8('\n');
+
+    while (end - cursor >= 16) {
+        const __m128i block =
+                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(cursor));
+        const __m128i newLines = _mm_cmpeq_epi8(block, newLineBlock);
+        const __m128i spaces   = _mm_or_si128(
+                            _mm_or_si128(_mm_cmpeq_epi8(block, spaceBlock),
+                                         _mm_cmpeq_epi8(block, tabBlock)),
+                            _mm_or_si128(_mm_cmpeq_epi8(block, crBlock),
+                                         newLines));
+        const bsl::uint32_t stopMask = ~_mm_movemask_epi8(spaces) & 0xFFFFu;
+        bsl::uint32_t newLineMask = _mm_movemask_epi8(newLines);
+
+        if (stopMask) {
+            const int index = BitUtil::numTrailingUnsetBits(stopMask);
+            newLineMask &= (1u << index) - 1;
+            tallyNewLines(numNewLines, lastNewLine, cursor, newLineMask);
+            return cursor + index;                                    // RETURN
+        }
+        tallyNewLines(numNewLines, lastNewLine, cursor, newLineMask);
+        cursor += 16;
+    }
+#else
+    (void)end;
+#endif
+
+    for (;; ++cursor) {
+        const char ch = *cursor;
+        if ('\n' == ch) {
+            ++*numNewLines;
+            *lastNewLine = cursor;
+        }
+        else if (' ' != ch && '\t' != ch && '\r' != ch) {
+            return cursor;                                            // RETURN
+        }
+    }
+}
+
 }  // close unnamed namespace
 
 namespace BloombergLP  {
@@ -1232,14 +1433,15 @@ MiniReader::skipSpaces()
 {
     while (1) {
 
-        // skip SPACE, TAB, CR chars
-        size_t len = bsl::strspn(d_scanPtr, "\r\t ");
-        d_scanPtr +=len;
+        // skip SPACE, TAB, CR, NL chars
+        int         numNewLines = 0;
+        const char *lastNewLine = 0;
 
-        if (checkForNewLine()) {
-            ++d_scanPtr;          //skip NL
-            continue;
-        }
+        d_scanPtr = const_cast<char *>(skipWhitespace(d_scanPtr,
+                                                      d_endPtr,
+                                                      &numNewLines,
+                                                      &lastNewLine));
+        countNewLines(numNewLines, lastNewLine);
 
         if (d_scanPtr < d_endPtr) {
             break;
@@ -1255,22 +1457,22 @@ MiniReader::skipSpaces()
 int
 MiniReader::scanForSymbol(char symbol)
 {
-    char strSet [] = { symbol, '\n', '\0' };
-
     while (1) {
-        // find 'symbol' or NL
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        // find 'symbol', counting NL chars on the way
+        int         numNewLines = 0;
+        const char *lastNewLine = 0;
+
+        d_scanPtr = const_cast<char *>(findSymbol(d_scanPtr,
+                                                  d_endPtr,
+                                                  symbol,
+                                                  &numNewLines,
+                                                  &lastNewLine));
+        countNewLines(numNewLines, lastNewLine);
 
         if (symbol == *d_scanPtr) {
             return symbol;                                            // RETURN
         }
 
-        if (checkForNewLine()) {
-            ++d_scanPtr;        //skip NL
-            continue;
-        }
-
         if (d_scanPtr < d_endPtr) {
             break;
         }
@@ -1286,35 +1488,18 @@ MiniReader::scanForSymbol(char symbol)
 int
 MiniReader::scanForSymbolOrSpace(char symbol)
 {
-    char strSet[] = { symbol, '\n', '\r', '\t', ' ', '\0' };
-
-    while (1) {
-        // find 'symbol' or space
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
-
-        if (d_scanPtr < d_endPtr) {
-            break;
-        }
-
-        if (readInput() == 0) {
-            return 0;                                                 // RETURN
-        }
-    }
-    return *d_scanPtr;
+    return scanForSymbolOrSpace(symbol, symbol);
 }
 
 int
 MiniReader::scanForSymbolOrSpace(char symbol1, char symbol2)
 {
-    char strSet [] = {
-        symbol1, symbol2,  '\n', '\r', '\t', ' ', '\0'
-    };
-
     while (1) {
         // find 'symbol1' or 'symbol2' or space
-        size_t len = bsl::strcspn(d_scanPtr, strSet);
-        d_scanPtr +=len;
+        d_scanPtr = const_cast<char *>(findSymbolOrSpace(d_scanPtr,
+                                                         d_endPtr,
+                                                         symbol1,
+                                                         symbol2));
 
         if (d_scanPtr < d_endPtr) {
             break;
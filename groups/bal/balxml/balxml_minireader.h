@@ -511,6 +511,12 @@ class MiniReader :  public Reader {
         // Check if the current symbol is NL and adjust line number
         // information.  Return 'true' if it was NL, otherwise 'false'
 
+    void  countNewLines(int numNewLines, const char *lastNewLine);
+        // Adjust line number information for the specified 'numNewLines' NL
+        // characters skipped in the buffer, the last of which is at the
+        // specified 'lastNewLine' address.  This method has no effect if
+        // 'numNewLines' is 0.
+
     int   skipSpaces();
         // Skip spaces and set the current position to first non space
         // character or to end if there is no non space found symbol.  Return
@@ -945,6 +951,16 @@ bool MiniReader::checkForNewLine()
     return false;
 }
 
+inline
+void MiniReader::countNewLines(int numNewLines, const char *lastNewLine)
+{
+    if (numNewLines) {
+        d_lineNum    += numNewLines;
+        d_lineOffset  = static_cast<int>(d_streamOffset
+                                         + (lastNewLine - d_startPtr) + 1);
+    }
+}
+
 inline
 int MiniReader::getCharAndSet(char ch)
 {
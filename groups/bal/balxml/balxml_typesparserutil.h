@@ -130,6 +130,7 @@ BSLS_IDENT("$Id: $")
 #include <bdlat_customizedtypefunctions.h>
 #include <bdlat_enumfunctions.h>
 #include <bdlat_formattingmode.h>
+#include <bdlat_nameindex.h>
 #include <bdlat_typecategory.h>
 
 #include <bdlt_date.h>
@@ -1005,7 +1006,7 @@ int TypesParserUtil_Imp::parseDefault(
                                   int                              inputLength,
                                   bdlat_TypeCategory::Enumeration)
 {
-    return bdlat_EnumFunctions::fromString(result, input, inputLength);
+    return bdlat::NameIndexUtil::fromString(result, input, inputLength);
 }
 
 template <class TYPE>
@@ -1318,7 +1319,7 @@ int TypesParserUtil_Imp::parseText(
                                   int                              inputLength,
                                   bdlat_TypeCategory::Enumeration)
 {
-    return bdlat_EnumFunctions::fromString(result, input, inputLength);
+    return bdlat::NameIndexUtil::fromString(result, input, inputLength);
 }
 
 template <class TYPE>
@@ -0,0 +1,279 @@
+// bblb_schedulecache.cpp                                             -*-C++-*-
+#include <bblb_schedulecache.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bblb_schedulecache_cpp,"$Id$ $CSID$")
+
+#include <bblb_schedulegenerationutil.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace bblb {
+namespace {
+
+template <class GENERATOR>
+bsl::shared_ptr<const ScheduleCache::Schedule> generate(
+                                            const GENERATOR&  generator,
+                                            bslma::Allocator *allocator)
+    // Return a shared pointer to a newly created schedule holding the dates
+    // of the specified 'generator', using the specified 'allocator' to supply
+    // memory.
+{
+    bsl::shared_ptr<ScheduleCache::Schedule> schedule =
+                      bsl::allocate_shared<ScheduleCache::Schedule>(allocator);
+
+    const int numDates = generator.numDates();
+
+    schedule->reserve(numDates);
+
+    for (int i = 0; i < numDates; ++i) {
+        schedule->push_back(generator.date(i));
+    }
+    return schedule;
+}
+
+ScheduleCache_Key makeKey(ScheduleCache::Method method,
+                          int                   numDates,
+                          const bdlt::Date&     firstDate,
+                          int                   interval,
+                          int                   targetDayOfMonth,
+                          int                   targetDayOfFeb)
+    // Return the key of the schedule generated by the specified 'method'
+    // having the specified 'numDates' dates, the first of which is the
+    // specified 'firstDate', followed by the others according to the
+    // specified 'interval', 'targetDayOfMonth', and 'targetDayOfFeb'.  All of
+    // the parameters other than 'method' are ignored if 'numDates' is 0.
+{
+    ScheduleCache_Key key = { method, 0, 0, 0, 0, 0 };
+
+    if (numDates) {
+        key.d_firstDate        = firstDate - bdlt::Date();
+        key.d_numDates         = numDates;
+        key.d_interval         = interval;
+        key.d_targetDayOfMonth = targetDayOfMonth;
+        key.d_targetDayOfFeb   = targetDayOfFeb;
+    }
+    return key;
+}
+
+}  // close unnamed namespace
+
+                         // ------------------------
+                         // struct ScheduleCache_Key
+                         // ------------------------
+
+// FREE OPERATORS
+bool operator<(const ScheduleCache_Key& lhs, const ScheduleCache_Key& rhs)
+{
+    if (lhs.d_method != rhs.d_method) {
+        return lhs.d_method < rhs.d_method;                           // RETURN
+    }
+    if (lhs.d_firstDate != rhs.d_firstDate) {
+        return lhs.d_firstDate < rhs.d_firstDate;                     // RETURN
+    }
+    if (lhs.d_numDates != rhs.d_numDates) {
+        return lhs.d_numDates < rhs.d_numDates;                       // RETURN
+    }
+    if (lhs.d_interval != rhs.d_interval) {
+        return lhs.d_interval < rhs.d_interval;                       // RETURN
+    }
+    if (lhs.d_targetDayOfMonth != rhs.d_targetDayOfMonth) {
+        return lhs.d_targetDayOfMonth < rhs.d_targetDayOfMonth;       // RETURN
+    }
+    return lhs.d_targetDayOfFeb < rhs.d_targetDayOfFeb;
+}
+
+                            // -------------------
+                            // class ScheduleCache
+                            // -------------------
+
+// PRIVATE MANIPULATORS
+bsl::shared_ptr<const ScheduleCache::Schedule> ScheduleCache::insert(
+                            const ScheduleCache_Key&               key,
+                            const bsl::shared_ptr<const Schedule>& schedule)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+    EntryMap::iterator it = d_entries.find(key);
+
+    if (d_entries.end() != it) {
+        // Another thread inserted the schedule after it was looked up.
+
+        d_useOrder.splice(d_useOrder.begin(),
+                          d_useOrder,
+                          it->second.d_usePosition);
+        return it->second.d_schedule;                                 // RETURN
+    }
+
+    // The node recording the use of 'key' is allocated in a separate list,
+    // and spliced into 'd_useOrder' (which does not throw) only once the
+    // entry has been inserted, so that an exception leaves the cache
+    // unchanged.
+
+    KeyList node(1, key, d_useOrder.get_allocator());
+
+    ScheduleCache_Entry entry;
+    entry.d_schedule    = schedule;
+    entry.d_usePosition = node.begin();
+
+    d_entries.insert(EntryMap::value_type(key, entry));
+
+    d_useOrder.splice(d_useOrder.begin(), node);
+
+    if (d_entries.size() > d_capacity) {
+        d_entries.erase(d_useOrder.back());
+        d_useOrder.pop_back();
+    }
+
+    return schedule;
+}
+
+bsl::shared_ptr<const ScheduleCache::Schedule> ScheduleCache::lookup(
+                                                 const ScheduleCache_Key& key)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+    EntryMap::iterator it = d_entries.find(key);
+
+    if (d_entries.end() == it) {
+        return bsl::shared_ptr<const Schedule>();                     // RETURN
+    }
+
+    d_useOrder.splice(d_useOrder.begin(),
+                      d_useOrder,
+                      it->second.d_usePosition);
+    return it->second.d_schedule;
+}
+
+// CREATORS
+ScheduleCache::ScheduleCache(bsl::size_t       capacity,
+                             bslma::Allocator *basicAllocator)
+: d_entries(basicAllocator)
+, d_useOrder(basicAllocator)
+, d_capacity(capacity)
+, d_lock()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= capacity);
+}
+
+ScheduleCache::~ScheduleCache()
+{
+}
+
+// MANIPULATORS
+bsl::shared_ptr<const ScheduleCache::Schedule>
+ScheduleCache::getDayIntervalSchedule(const bdlt::Date& earliest,
+                                      const bdlt::Date& latest,
+                                      const bdlt::Date& example,
+                                      int               intervalInDays)
+{
+    BSLS_ASSERT(earliest <= latest);
+    BSLS_ASSERT(1 <= intervalInDays);
+
+    const DayIntervalScheduleGenerator generator(earliest,
+                                                 latest,
+                                                 example,
+                                                 intervalInDays);
+
+    const ScheduleCache_Key key = makeKey(
+                                   e_DAY_INTERVAL,
+                                   generator.numDates(),
+                                   generator.numDates() ? generator.date(0)
+                                                        : bdlt::Date(),
+                                   intervalInDays,
+                                   0,
+                                   0);
+
+    bsl::shared_ptr<const Schedule> schedule = lookup(key);
+
+    if (!schedule) {
+        schedule = insert(key, generate(generator, d_allocator_p));
+    }
+    return schedule;
+}
+
+bsl::shared_ptr<const ScheduleCache::Schedule>
+ScheduleCache::getDayOfMonthSchedule(const bdlt::Date& earliest,
+                                     const bdlt::Date& latest,
+                                     int               exampleYear,
+                                     int               exampleMonth,
+                                     int               intervalInMonths,
+                                     int               targetDayOfMonth,
+                                     int               targetDayOfFeb)
+{
+    BSLS_ASSERT(earliest <= latest);
+    BSLS_ASSERT(1 <= intervalInMonths);
+    BSLS_ASSERT(1 <= exampleYear      && 9999 >= exampleYear);
+    BSLS_ASSERT(1 <= exampleMonth     &&   12 >= exampleMonth);
+    BSLS_ASSERT(1 <= targetDayOfMonth &&   31 >= targetDayOfMonth);
+    BSLS_ASSERT(0 <= targetDayOfFeb   &&   29 >= targetDayOfFeb);
+
+    const DayOfMonthScheduleGenerator generator(earliest,
+                                                latest,
+                                                exampleYear,
+                                                exampleMonth,
+                                                intervalInMonths,
+                                                targetDayOfMonth,
+                                                targetDayOfFeb);
+
+    const ScheduleCache_Key key = makeKey(
+                                   e_DAY_OF_MONTH,
+                                   generator.numDates(),
+                                   generator.numDates() ? generator.date(0)
+                                                        : bdlt::Date(),
+                                   intervalInMonths,
+                                   targetDayOfMonth,
+                                   targetDayOfFeb);
+
+    bsl::shared_ptr<const Schedule> schedule = lookup(key);
+
+    if (!schedule) {
+        schedule = insert(key, generate(generator, d_allocator_p));
+    }
+    return schedule;
+}
+
+int ScheduleCache::invalidateAll()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+    const int numInvalidated = static_cast<int>(d_entries.size());
+
+    d_entries.clear();
+    d_useOrder.clear();
+
+    return numInvalidated;
+}
+
+// ACCESSORS
+bsl::size_t ScheduleCache::numSchedules() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
+
+    return d_entries.size();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
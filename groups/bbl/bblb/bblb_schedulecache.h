@@ -0,0 +1,349 @@
+// bblb_schedulecache.h                                               -*-C++-*-
+#ifndef INCLUDED_BBLB_SCHEDULECACHE
+#define INCLUDED_BBLB_SCHEDULECACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a bounded, thread-safe cache of generated schedules.
+//
+//@CLASSES:
+//  bblb::ScheduleCache: bounded cache of read-only schedules of dates
+//
+//@SEE_ALSO: bblb_schedulegenerationutil
+//
+//@DESCRIPTION: This component defines a class, 'bblb::ScheduleCache', that
+// holds read-only schedules of dates, as generated by
+// 'bblb::ScheduleGenerationUtil', so that requests for the same schedule
+// (e.g., from the many instruments of a portfolio that share the same terms)
+// are satisfied without generating and allocating the schedule again.  The
+// 'getDayIntervalSchedule' and 'getDayOfMonthSchedule' methods take the same
+// arguments as 'generateFromDayInterval' and 'generateFromDayOfMonth',
+// respectively, and return a 'bsl::shared_ptr<const bsl::vector<bdlt::Date> >'
+// referring to the schedule.
+//
+// Schedules are identified by the dates that they contain, rather than by the
+// arguments from which they were generated: the arguments are first reduced
+// (in constant time, and without allocating memory) to the first date, the
+// number of dates, and the rule by which the subsequent dates follow the
+// first (see 'bblb::DayIntervalScheduleGenerator' and
+// 'bblb::DayOfMonthScheduleGenerator').  Thus, for example, requests having
+// different 'example' dates that lie on the same grid of dates share one
+// cached schedule.
+//
+// A cache holds at most the number of schedules specified at construction.
+// When a schedule that is not in a full cache is requested, the schedule
+// that was least recently requested is removed from the cache.  A schedule
+// that has been removed from the cache (whether for this reason, or by
+// 'invalidateAll') remains valid to all outstanding references to it until
+// those references have been destroyed.
+//
+///Thread Safety
+///-------------
+// The 'bblb::ScheduleCache' class is fully thread-safe (see
+// 'bsldoc_glossary') provided that the allocator supplied at construction is
+// fully thread-safe.  Schedules are generated without holding the lock that
+// guards the cache, so that a thread generating a schedule does not block
+// threads requesting other schedules.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing the Coupon Schedules of a Portfolio
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a risk system values a portfolio of bonds, many of which pay
+// semi-annual coupons on the 15th day of the month, and that the coupon
+// schedule of each bond over the next five years is needed.
+//
+// First, we create a cache that holds at most 1000 schedules:
+//..
+//  bblb::ScheduleCache cache(1000);
+//..
+// Then, we obtain the schedule of a bond whose first coupon was paid in
+// March 2011:
+//..
+//  const bdlt::Date earliest(2024, 1,  1);
+//  const bdlt::Date latest  (2028, 12, 31);
+//
+//  bsl::shared_ptr<const bsl::vector<bdlt::Date> > scheduleA =
+//                      cache.getDayOfMonthSchedule(earliest,
+//                                                  latest,
+//                                                  2011,
+//                                                  3,
+//                                                  6,    // 'intervalInMonths'
+//                                                  15);  // 'targetDayOfMonth'
+//
+//  assert(10                      == scheduleA->size());
+//  assert(bdlt::Date(2024, 3, 15) == scheduleA->front());
+//  assert(bdlt::Date(2028, 9, 15) == scheduleA->back());
+//..
+// Next, we obtain the schedule of a bond whose first coupon was paid in
+// September 2019, which, having the same terms, shares the cached schedule:
+//..
+//  bsl::shared_ptr<const bsl::vector<bdlt::Date> > scheduleB =
+//                      cache.getDayOfMonthSchedule(earliest,
+//                                                  latest,
+//                                                  2019,
+//                                                  9,
+//                                                  6,
+//                                                  15);
+//
+//  assert(scheduleA == scheduleB);
+//  assert(1         == cache.numSchedules());
+//..
+// Finally, we invalidate the cache, and observe that the schedule obtained
+// earlier remains valid:
+//..
+//  assert(1  == cache.invalidateAll());
+//  assert(0  == cache.numSchedules());
+//  assert(10 == scheduleA->size());
+//..
+
+#include <bblscm_version.h>
+
+#include <bdlt_date.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_integralconstant.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_list.h>
+#include <bsl_map.h>
+#include <bsl_memory.h>  // 'bsl::shared_ptr'
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bblb {
+
+                         // ========================
+                         // struct ScheduleCache_Key
+                         // ========================
+
+struct ScheduleCache_Key {
+    // This component-private 'struct' identifies a schedule in the cache by
+    // the method used to generate it, its first date, its number of dates,
+    // and the parameters that determine the subsequent dates.  All of the
+    // members other than 'd_method' of the key of an empty schedule are 0.
+
+    // PUBLIC DATA
+    int d_method;            // generation method ('ScheduleCache::Method')
+    int d_firstDate;         // first date, as the number of days since
+                             // 'bdlt::Date()'
+    int d_numDates;          // number of dates in the schedule
+    int d_interval;          // number of days or months between dates
+    int d_targetDayOfMonth;  // target day of the month, or 0
+    int d_targetDayOfFeb;    // target day of February, or 0
+};
+
+// FREE OPERATORS
+bool operator<(const ScheduleCache_Key& lhs, const ScheduleCache_Key& rhs);
+    // Return 'true' if the specified 'lhs' is ordered before the specified
+    // 'rhs' by the lexicographic comparison of their members, and 'false'
+    // otherwise.
+
+                        // ==========================
+                        // struct ScheduleCache_Entry
+                        // ==========================
+
+// IMPLEMENTATION NOTE: As for 'bdlt::CalendarCache_Entry', this type must be
+// complete before it is used as the 'mapped_type' of a data member of
+// 'ScheduleCache'.
+
+struct ScheduleCache_Entry {
+    // This component-private 'struct' defines the type of the objects that
+    // are held in the schedule cache.
+
+    // PUBLIC DATA
+    bsl::shared_ptr<const bsl::vector<bdlt::Date> > d_schedule;
+                                          // cached schedule
+
+    bsl::list<ScheduleCache_Key>::iterator d_usePosition;
+                                          // position of the key of this entry
+                                          // in the list of keys ordered by
+                                          // most recent use
+};
+
+                            // ===================
+                            // class ScheduleCache
+                            // ===================
+
+class ScheduleCache {
+    // This class implements a bounded, thread-safe cache of read-only
+    // schedules of dates, generated on demand and evicted in least recently
+    // used order.
+    //
+    // This container is *exception* *neutral* with no guarantee of rollback:
+    // if an exception is thrown during the invocation of a method on a
+    // pre-existing instance, the container is left in a valid state, but its
+    // value is undefined.  In no event is memory leaked.
+    //
+    // This class is fully thread-safe (see 'bsldoc_glossary').
+
+  public:
+    // TYPES
+    typedef bsl::vector<bdlt::Date> Schedule;
+        // 'Schedule' is an alias for the type of the cached schedules.
+
+    enum Method {
+        // This enumeration defines the generation methods whose schedules may
+        // be cached.
+
+        e_DAY_INTERVAL = 1,  // 'generateFromDayInterval'
+        e_DAY_OF_MONTH = 2   // 'generateFromDayOfMonth'
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::list<ScheduleCache_Key>                      KeyList;
+    typedef bsl::map<ScheduleCache_Key, ScheduleCache_Entry>  EntryMap;
+
+    // DATA
+    EntryMap              d_entries;      // cached schedules, by key
+
+    KeyList               d_useOrder;     // keys of the cached schedules, most
+                                          // recently used first
+
+    bsl::size_t           d_capacity;     // maximum number of schedules
+
+    mutable bslmt::Mutex  d_lock;         // guard access to the cache
+
+    bslma::Allocator     *d_allocator_p;  // memory allocator (held, not
+                                          // owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ScheduleCache(const ScheduleCache&);
+    ScheduleCache& operator=(const ScheduleCache&);
+
+    // PRIVATE MANIPULATORS
+    bsl::shared_ptr<const Schedule> insert(
+                           const ScheduleCache_Key&               key,
+                           const bsl::shared_ptr<const Schedule>& schedule);
+        // Insert the specified 'schedule' into this cache under the specified
+        // 'key', evicting the least recently used schedule if this cache is
+        // full, and return 'schedule'.  If a schedule having 'key' is already
+        // in this cache (i.e., having been inserted by another thread), mark
+        // it as the most recently used and return it instead.
+
+    bsl::shared_ptr<const Schedule> lookup(const ScheduleCache_Key& key);
+        // Return the schedule in this cache having the specified 'key',
+        // marking it as the most recently used, or an empty shared pointer if
+        // there is no such schedule.
+
+  public:
+    // CREATORS
+    explicit
+    ScheduleCache(bsl::size_t capacity, bslma::Allocator *basicAllocator = 0);
+        // Create an empty schedule cache that holds at most the specified
+        // 'capacity' schedules.  Optionally specify a 'basicAllocator' used to
+        // supply memory, including the memory of the cached schedules.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '1 <= capacity'.
+
+    ~ScheduleCache();
+        // Destroy this object.
+
+    // MANIPULATORS
+    bsl::shared_ptr<const Schedule> getDayIntervalSchedule(
+                                             const bdlt::Date& earliest,
+                                             const bdlt::Date& latest,
+                                             const bdlt::Date& example,
+                                             int               intervalInDays);
+        // Return a shared pointer providing non-modifiable access to the
+        // schedule that 'ScheduleGenerationUtil::generateFromDayInterval'
+        // loads for the specified 'earliest', 'latest', 'example', and
+        // 'intervalInDays', generating the schedule and inserting it into this
+        // cache if it is not already present.  The behavior is undefined
+        // unless 'earliest <= latest' and '1 <= intervalInDays'.
+
+    bsl::shared_ptr<const Schedule> getDayOfMonthSchedule(
+                                       const bdlt::Date& earliest,
+                                       const bdlt::Date& latest,
+                                       int               exampleYear,
+                                       int               exampleMonth,
+                                       int               intervalInMonths,
+                                       int               targetDayOfMonth,
+                                       int               targetDayOfFeb = 0);
+        // Return a shared pointer providing non-modifiable access to the
+        // schedule that 'ScheduleGenerationUtil::generateFromDayOfMonth'
+        // loads for the specified 'earliest', 'latest', 'exampleYear',
+        // 'exampleMonth', 'intervalInMonths', and 'targetDayOfMonth', and the
+        // optionally specified 'targetDayOfFeb', generating the schedule and
+        // inserting it into this cache if it is not already present.  The
+        // behavior is undefined unless 'earliest <= latest',
+        // '1 <= exampleYear <= 9999', '1 <= exampleMonth <= 12',
+        // '1 <= intervalInMonths', '1 <= targetDayOfMonth <= 31', and
+        // '0 <= targetDayOfFeb <= 29'.
+
+    int invalidateAll();
+        // Remove all schedules from this cache, and return the number of
+        // schedules that were removed.  Note that a schedule that has been
+        // removed from the cache remains valid to all outstanding references
+        // to it until those references have been destroyed.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this cache to supply memory.
+
+    bsl::size_t capacity() const;
+        // Return the maximum number of schedules held by this cache.
+
+    bsl::size_t numSchedules() const;
+        // Return the number of schedules currently held by this cache.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class ScheduleCache
+                            // -------------------
+
+// ACCESSORS
+inline
+bslma::Allocator *ScheduleCache::allocator() const
+{
+    return d_allocator_p;
+}
+
+inline
+bsl::size_t ScheduleCache::capacity() const
+{
+    return d_capacity;
+}
+
+}  // close package namespace
+
+// TRAITS
+
+namespace bslma {
+
+template <>
+struct UsesBslmaAllocator<bblb::ScheduleCache> : bsl::true_type {};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
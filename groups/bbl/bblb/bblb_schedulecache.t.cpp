@@ -0,0 +1,1018 @@
+// bblb_schedulecache.t.cpp                                           -*-C++-*-
+#include <bblb_schedulecache.h>
+
+#include <bblb_schedulegenerationutil.h>
+
+#include <bdlt_date.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a thread-safe cache of schedules.  The
+// schedules returned by the cache are compared with those generated by
+// 'bblb::ScheduleGenerationUtil', the sharing of schedules between requests
+// having the same dates and the least-recently-used eviction order are
+// verified by comparing the addresses of the returned schedules, and the
+// thread safety of the cache is exercised by concurrent requests.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit ScheduleCache(size_t capacity, Allocator *ba = 0);
+// [ 2] ~ScheduleCache();
+//
+// MANIPULATORS
+// [ 3] shared_ptr<const Schedule> getDayIntervalSchedule(e, l, ex, i);
+// [ 3] shared_ptr<const Schedule> getDayOfMonthSchedule(e, l, y, m, ...);
+// [ 5] int invalidateAll();
+//
+// ACCESSORS
+// [ 2] bslma::Allocator *allocator() const;
+// [ 2] size_t capacity() const;
+// [ 4] size_t numSchedules() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] LEAST-RECENTLY-USED EVICTION
+// [ 6] CONCURRENCY
+// [ 7] EXCEPTION NEUTRALITY
+// [ 8] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bblb::ScheduleCache             Obj;
+typedef Obj::Schedule                   Schedule;
+typedef bsl::shared_ptr<const Schedule> ScheduleSp;
+typedef bblb::ScheduleGenerationUtil    Util;
+
+// ============================================================================
+//                            TEST CLASSES
+// ----------------------------------------------------------------------------
+
+class ConcurrentRequester {
+    // This class defines a functor that repeatedly requests schedules from a
+    // cache, and verifies each of them.
+
+    // DATA
+    Obj                *d_cache_p;       // cache under test (held, not owned)
+    int                 d_seed;          // seed selecting the requests
+    bsls::AtomicInt    *d_numErrors_p;   // number of incorrect schedules
+
+  public:
+    // CREATORS
+    ConcurrentRequester(Obj *cache, int seed, bsls::AtomicInt *numErrors)
+        // Create a functor that requests schedules from the specified 'cache'
+        // in an order determined by the specified 'seed', and increments the
+        // specified 'numErrors' for each incorrect schedule.
+    : d_cache_p(cache)
+    , d_seed(seed)
+    , d_numErrors_p(numErrors)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Request schedules from the cache, and verify them.
+    {
+        bslma::TestAllocator ta("requester");
+
+        unsigned int state = d_seed;
+
+        for (int i = 0; i < 2000; ++i) {
+            state = state * 1103515245 + 12345;
+
+            const int        selector = (state >> 16) % 40;
+            const bdlt::Date earliest(2020, 1, 1 + selector % 20);
+            const bdlt::Date latest(2030, 12, 31);
+
+            Schedule   expected(&ta);
+            ScheduleSp schedule;
+
+            if (selector < 20) {
+                schedule = d_cache_p->getDayIntervalSchedule(
+                                                     earliest,
+                                                     latest,
+                                                     bdlt::Date(2019, 1, 1),
+                                                     7);
+                Util::generateFromDayInterval(&expected,
+                                              earliest,
+                                              latest,
+                                              bdlt::Date(2019, 1, 1),
+                                              7);
+            }
+            else {
+                schedule = d_cache_p->getDayOfMonthSchedule(earliest,
+                                                            latest,
+                                                            2019,
+                                                            1,
+                                                            3,
+                                                            selector - 10);
+                Util::generateFromDayOfMonth(&expected,
+                                             earliest,
+                                             latest,
+                                             2019,
+                                             1,
+                                             3,
+                                             selector - 10);
+            }
+
+            if (!schedule || *schedule != expected) {
+                ++*d_numErrors_p;
+            }
+        }
+    }
+};
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file must
+        //:   compile, link, and run as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing the Coupon Schedules of a Portfolio
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a risk system values a portfolio of bonds, many of which pay
+// semi-annual coupons on the 15th day of the month, and that the coupon
+// schedule of each bond over the next five years is needed.
+//
+// First, we create a cache that holds at most 1000 schedules:
+//..
+    bblb::ScheduleCache cache(1000);
+//..
+// Then, we obtain the schedule of a bond whose first coupon was paid in
+// March 2011:
+//..
+    const bdlt::Date earliest(2024, 1,  1);
+    const bdlt::Date latest  (2028, 12, 31);
+
+    bsl::shared_ptr<const bsl::vector<bdlt::Date> > scheduleA =
+                        cache.getDayOfMonthSchedule(earliest,
+                                                    latest,
+                                                    2011,
+                                                    3,
+                                                    6,    // 'intervalInMonths'
+                                                    15);  // 'targetDayOfMonth'
+
+    ASSERT(10                      == scheduleA->size());
+    ASSERT(bdlt::Date(2024, 3, 15) == scheduleA->front());
+    ASSERT(bdlt::Date(2028, 9, 15) == scheduleA->back());
+//..
+// Next, we obtain the schedule of a bond whose first coupon was paid in
+// September 2019, which, having the same terms, shares the cached schedule:
+//..
+    bsl::shared_ptr<const bsl::vector<bdlt::Date> > scheduleB =
+                        cache.getDayOfMonthSchedule(earliest,
+                                                    latest,
+                                                    2019,
+                                                    9,
+                                                    6,
+                                                    15);
+
+    ASSERT(scheduleA == scheduleB);
+    ASSERT(1         == cache.numSchedules());
+//..
+// Finally, we invalidate the cache, and observe that the schedule obtained
+// earlier remains valid:
+//..
+    ASSERT(1  == cache.invalidateAll());
+    ASSERT(0  == cache.numSchedules());
+    ASSERT(10 == scheduleA->size());
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // EXCEPTION NEUTRALITY
+        //
+        // Concerns:
+        //: 1 If an allocation fails while a schedule is being added to the
+        //:   cache, the cache is left unchanged, and in particular no
+        //:   schedule is evicted.
+        //:
+        //: 2 Subsequent requests, including those that evict schedules,
+        //:   behave as though the failed request had not been made.
+        //
+        // Plan:
+        //: 1 Fill a cache of capacity 2, and then request a third schedule in
+        //:   the presence of injected allocation failures, verifying after
+        //:   each failure that both cached schedules are still returned by
+        //:   the cache without allocating.  (C-1)
+        //:
+        //: 2 Request the schedules repeatedly, in an order that causes
+        //:   evictions, and verify 'numSchedules' and the returned schedules.
+        //:   (C-2)
+        //
+        // Testing:
+        //   EXCEPTION NEUTRALITY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "EXCEPTION NEUTRALITY" << endl
+                                  << "====================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        const bdlt::Date EARLIEST(2015, 1, 1);
+        const bdlt::Date LATEST(2015, 12, 31);
+
+        Obj mX(2, &ta);  const Obj& X = mX;
+
+        const ScheduleSp S1 = mX.getDayIntervalSchedule(EARLIEST,
+                                                        LATEST,
+                                                        EARLIEST,
+                                                        1);
+        const ScheduleSp S2 = mX.getDayIntervalSchedule(EARLIEST,
+                                                        LATEST,
+                                                        EARLIEST,
+                                                        2);
+
+        ScheduleSp s3;
+
+        BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+            if (veryVerbose) { T_ P(ta.numBlocksInUse()) }
+
+            // Verify that the cache is unchanged by any previous failure.
+            // Requesting 'S1' and 'S2' in the order in which they were added
+            // leaves that order unchanged.
+
+            const bsls::Types::Int64 numBlocksTotal = ta.numBlocksTotal();
+
+            ASSERT(2  == X.numSchedules());
+            ASSERT(S1 == mX.getDayIntervalSchedule(EARLIEST,
+                                                   LATEST,
+                                                   EARLIEST,
+                                                   1));
+            ASSERT(S2 == mX.getDayIntervalSchedule(EARLIEST,
+                                                   LATEST,
+                                                   EARLIEST,
+                                                   2));
+            ASSERTV(numBlocksTotal, ta.numBlocksTotal(),
+                    numBlocksTotal == ta.numBlocksTotal());
+
+            s3 = mX.getDayIntervalSchedule(EARLIEST, LATEST, EARLIEST, 3);
+        } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+        ASSERT(s3);
+        ASSERT(2 == X.numSchedules());
+
+        // 'S1' was the least recently used, and so was evicted.
+
+        ASSERT(S2 == mX.getDayIntervalSchedule(EARLIEST,
+                                               LATEST,
+                                               EARLIEST,
+                                               2));
+        ASSERT(s3 == mX.getDayIntervalSchedule(EARLIEST,
+                                               LATEST,
+                                               EARLIEST,
+                                               3));
+
+        for (int i = 0; i < 6; ++i) {
+            const int interval = i % 3 + 1;
+
+            const ScheduleSp s = mX.getDayIntervalSchedule(EARLIEST,
+                                                           LATEST,
+                                                           EARLIEST,
+                                                           interval);
+
+            Schedule expected(&ta);
+            Util::generateFromDayInterval(&expected,
+                                          EARLIEST,
+                                          LATEST,
+                                          EARLIEST,
+                                          interval);
+
+            ASSERTV(i, s && expected == *s);
+            ASSERTV(i, X.numSchedules(), 2 == X.numSchedules());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 Concurrent requests, including requests for schedules that are
+        //:   being evicted, return correct schedules.
+        //:
+        //: 2 The number of schedules never exceeds the capacity.
+        //
+        // Plan:
+        //: 1 Create a cache having a capacity smaller than the number of
+        //:   distinct schedules requested, and have several threads request
+        //:   schedules in different orders, verifying each schedule against
+        //:   that generated by 'bblb::ScheduleGenerationUtil'.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCURRENCY" << endl
+                                  << "===========" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        enum { k_NUM_THREADS = 8 };
+
+        Obj             mX(16, &ta);
+        bsls::AtomicInt numErrors(0);
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERTV(i, 0 == bslmt::ThreadUtil::create(
+                               &handles[i],
+                               ConcurrentRequester(&mX, i + 1, &numErrors)));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERTV(i, 0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        ASSERTV(numErrors, 0 == numErrors);
+        ASSERTV(mX.numSchedules(), 16 >= mX.numSchedules());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'invalidateAll'
+        //
+        // Concerns:
+        //: 1 'invalidateAll' removes all schedules, and returns their number.
+        //:
+        //: 2 Outstanding references to removed schedules remain valid.
+        //:
+        //: 3 A schedule requested after invalidation is generated again.
+        //:
+        //: 4 All memory is released when the schedules are removed and the
+        //:   outstanding references are destroyed.
+        //
+        // Plan:
+        //: 1 Populate a cache, invalidate it, and verify the return value,
+        //:   'numSchedules', the outstanding references, and the memory in
+        //:   use.  (C-1..4)
+        //
+        // Testing:
+        //   int invalidateAll();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'invalidateAll'" << endl
+                                  << "=======================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        const bdlt::Date EARLIEST(2015, 1, 1);
+        const bdlt::Date LATEST(2016, 12, 31);
+
+        {
+            Obj mX(10, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.invalidateAll());
+
+            ScheduleSp a = mX.getDayIntervalSchedule(EARLIEST,
+                                                     LATEST,
+                                                     EARLIEST,
+                                                     7);
+            ScheduleSp b = mX.getDayOfMonthSchedule(EARLIEST,
+                                                    LATEST,
+                                                    2015,
+                                                    1,
+                                                    1,
+                                                    31);
+            ASSERT(2 == X.numSchedules());
+
+            const bsls::Types::Int64 numBlocks = ta.numBlocksInUse();
+
+            ASSERT(2 == mX.invalidateAll());
+            ASSERT(0 == X.numSchedules());
+            ASSERT(numBlocks > ta.numBlocksInUse());
+
+            ASSERT(105             == a->size());
+            ASSERT(EARLIEST        == a->front());
+            ASSERT(24              == b->size());
+            ASSERT(LATEST          == b->back());
+
+            ScheduleSp c = mX.getDayIntervalSchedule(EARLIEST,
+                                                     LATEST,
+                                                     EARLIEST,
+                                                     7);
+            ASSERT(c != a);
+            ASSERT(*c == *a);
+            ASSERT(1 == X.numSchedules());
+
+            a.reset();
+            b.reset();
+            c.reset();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // LEAST-RECENTLY-USED EVICTION
+        //
+        // Concerns:
+        //: 1 A cache holds at most 'capacity()' schedules.
+        //:
+        //: 2 When a schedule that is not in a full cache is requested, the
+        //:   least recently requested schedule is removed, where a request
+        //:   satisfied by the cache counts as a use.
+        //:
+        //: 3 Outstanding references to evicted schedules remain valid.
+        //
+        // Plan:
+        //: 1 Using a cache of capacity 3, request schedules in a chosen order,
+        //:   and verify 'numSchedules' and which of the subsequent requests
+        //:   return the previously returned schedules.  (C-1..3)
+        //
+        // Testing:
+        //   LEAST-RECENTLY-USED EVICTION
+        //   size_t numSchedules() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "LEAST-RECENTLY-USED EVICTION" << endl
+                                  << "============================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        const bdlt::Date EARLIEST(2015, 1, 1);
+        const bdlt::Date LATEST(2015, 12, 31);
+
+        Obj mX(3, &ta);  const Obj& X = mX;
+
+        ScheduleSp s[5];
+        for (int i = 0; i < 3; ++i) {
+            s[i] = mX.getDayIntervalSchedule(EARLIEST,
+                                             LATEST,
+                                             EARLIEST,
+                                             i + 1);
+            ASSERTV(i, i + 1 == static_cast<int>(X.numSchedules()));
+        }
+
+        // Use schedule 0, so that schedule 1 is the least recently used.
+
+        ASSERT(s[0] == mX.getDayIntervalSchedule(EARLIEST,
+                                                 LATEST,
+                                                 EARLIEST,
+                                                 1));
+
+        s[3] = mX.getDayIntervalSchedule(EARLIEST, LATEST, EARLIEST, 4);
+        ASSERT(3 == X.numSchedules());
+
+        ASSERT(s[0] == mX.getDayIntervalSchedule(EARLIEST,
+                                                 LATEST,
+                                                 EARLIEST,
+                                                 1));
+        ASSERT(s[2] == mX.getDayIntervalSchedule(EARLIEST,
+                                                 LATEST,
+                                                 EARLIEST,
+                                                 3));
+        ASSERT(s[3] == mX.getDayIntervalSchedule(EARLIEST,
+                                                 LATEST,
+                                                 EARLIEST,
+                                                 4));
+        ASSERT(3 == X.numSchedules());
+
+        // Schedule 1 was evicted, but remains valid.
+
+        ASSERT(183 == s[1]->size());
+
+        s[4] = mX.getDayIntervalSchedule(EARLIEST, LATEST, EARLIEST, 2);
+        ASSERT(s[4]  != s[1]);
+        ASSERT(*s[4] == *s[1]);
+        ASSERT(3 == X.numSchedules());
+
+        // Schedule 0 was the least recently used, and was evicted.
+
+        ASSERT(s[0] != mX.getDayIntervalSchedule(EARLIEST,
+                                                 LATEST,
+                                                 EARLIEST,
+                                                 1));
+        ASSERT(3 == X.numSchedules());
+
+        if (verbose) cout << "\tCapacity of 1." << endl;
+        {
+            Obj mY(1, &ta);  const Obj& Y = mY;
+
+            ScheduleSp a = mY.getDayIntervalSchedule(EARLIEST,
+                                                     LATEST,
+                                                     EARLIEST,
+                                                     1);
+            ASSERT(a == mY.getDayIntervalSchedule(EARLIEST,
+                                                  LATEST,
+                                                  EARLIEST,
+                                                  1));
+            ScheduleSp b = mY.getDayOfMonthSchedule(EARLIEST,
+                                                    LATEST,
+                                                    2015,
+                                                    1,
+                                                    1,
+                                                    1);
+            ASSERT(1 == Y.numSchedules());
+            ASSERT(a != mY.getDayIntervalSchedule(EARLIEST,
+                                                  LATEST,
+                                                  EARLIEST,
+                                                  1));
+            ASSERT(1 == Y.numSchedules());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'getDayIntervalSchedule' AND 'getDayOfMonthSchedule'
+        //
+        // Concerns:
+        //: 1 The schedules returned are those generated by the corresponding
+        //:   'bblb::ScheduleGenerationUtil' functions.
+        //:
+        //: 2 A repeated request returns the cached schedule.
+        //:
+        //: 3 Requests having different arguments that generate the same
+        //:   dates by the same method share a schedule, and requests that
+        //:   generate different dates do not.
+        //:
+        //: 4 Memory is supplied by the allocator supplied at construction.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a table of arguments, verify the schedules returned against
+        //:   those generated by 'bblb::ScheduleGenerationUtil', and verify
+        //:   that a repeated request returns the same schedule.  (C-1..2)
+        //:
+        //: 2 For chosen pairs of requests, verify whether the returned
+        //:   schedules are shared.  (C-3)
+        //:
+        //: 3 Verify that the default allocator is not used.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for argument values.  (C-5)
+        //
+        // Testing:
+        //   shared_ptr<const Schedule> getDayIntervalSchedule(e, l, ex, i);
+        //   shared_ptr<const Schedule> getDayOfMonthSchedule(e, l, y, m, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "TESTING 'getDayIntervalSchedule' AND "
+                 << "'getDayOfMonthSchedule'" << endl
+                 << "====================================="
+                 << "=======================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        Obj mX(100, &ta);
+
+        static const struct {
+            int d_lineNum;
+            int d_earliestYear;
+            int d_latestYear;
+            int d_exampleYear;
+            int d_exampleMonth;
+            int d_interval;
+            int d_targetDayOfMonth;
+            int d_targetDayOfFeb;
+        } DATA[] = {
+            //LN  EY    LY    XY    XM  I   DOM DOF
+            //--  ----  ----  ----  --  --  --- ---
+            { L_, 2014, 2014, 2001,  2,  1,  1,  0 },
+            { L_, 2014, 2016, 2019,  5,  7, 31,  0 },
+            { L_, 2014, 2016, 1968,  6, 14, 30, 28 },
+            { L_, 2014, 2024, 2020,  1, 25, 29,  0 },
+            { L_, 2014, 2014, 2013, 12, 30, 15, 14 },
+            { L_, 9998, 9999, 9999, 12,  6, 31,  0 },
+            { L_,    1,    2,    1,  1,  3, 31, 29 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int        LINE = DATA[ti].d_lineNum;
+            const bdlt::Date EARLIEST(DATA[ti].d_earliestYear, 1, 1);
+            const bdlt::Date LATEST(DATA[ti].d_latestYear, 12, 31);
+            const int        XY   = DATA[ti].d_exampleYear;
+            const int        XM   = DATA[ti].d_exampleMonth;
+            const int        I    = DATA[ti].d_interval;
+            const int        DOM  = DATA[ti].d_targetDayOfMonth;
+            const int        DOF  = DATA[ti].d_targetDayOfFeb;
+            const bdlt::Date EXAMPLE(XY, XM, 1);
+
+            Schedule expected(&ta);
+
+            Util::generateFromDayInterval(&expected,
+                                          EARLIEST,
+                                          LATEST,
+                                          EXAMPLE,
+                                          I);
+
+            ScheduleSp a = mX.getDayIntervalSchedule(EARLIEST,
+                                                     LATEST,
+                                                     EXAMPLE,
+                                                     I);
+            ASSERTV(LINE, expected == *a);
+            ASSERTV(LINE, a == mX.getDayIntervalSchedule(EARLIEST,
+                                                         LATEST,
+                                                         EXAMPLE,
+                                                         I));
+
+            Util::generateFromDayOfMonth(&expected,
+                                         EARLIEST,
+                                         LATEST,
+                                         XY,
+                                         XM,
+                                         I,
+                                         DOM,
+                                         DOF);
+
+            ScheduleSp b = mX.getDayOfMonthSchedule(EARLIEST,
+                                                    LATEST,
+                                                    XY,
+                                                    XM,
+                                                    I,
+                                                    DOM,
+                                                    DOF);
+            ASSERTV(LINE, expected == *b);
+            ASSERTV(LINE, b == mX.getDayOfMonthSchedule(EARLIEST,
+                                                        LATEST,
+                                                        XY,
+                                                        XM,
+                                                        I,
+                                                        DOM,
+                                                        DOF));
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (verbose) cout << "\tSharing." << endl;
+        {
+            const bdlt::Date EARLIEST(2015, 1, 1);
+            const bdlt::Date LATEST(2015, 12, 31);
+
+            // Examples on the same grid share a schedule.
+
+            ASSERT(mX.getDayIntervalSchedule(EARLIEST,
+                                             LATEST,
+                                             bdlt::Date(2001, 1, 1),
+                                             7)
+                == mX.getDayIntervalSchedule(EARLIEST,
+                                             LATEST,
+                                             bdlt::Date(2001, 1, 1) + 700,
+                                             7));
+            ASSERT(mX.getDayIntervalSchedule(EARLIEST,
+                                             LATEST,
+                                             bdlt::Date(2001, 1, 1),
+                                             7)
+                != mX.getDayIntervalSchedule(EARLIEST,
+                                             LATEST,
+                                             bdlt::Date(2001, 1, 2),
+                                             7));
+
+            // Ranges selecting the same dates share a schedule.
+
+            ASSERT(mX.getDayOfMonthSchedule(EARLIEST, LATEST, 2001, 3, 3, 10)
+                == mX.getDayOfMonthSchedule(bdlt::Date(2015, 1, 9),
+                                            bdlt::Date(2015, 12, 11),
+                                            1999,
+                                            12,
+                                            3,
+                                            10));
+
+            // Different target days do not, even where the dates coincide
+            // at first.
+
+            ScheduleSp a = mX.getDayOfMonthSchedule(EARLIEST,
+                                                    LATEST,
+                                                    2015,
+                                                    4,
+                                                    1,
+                                                    30);
+            ScheduleSp b = mX.getDayOfMonthSchedule(EARLIEST,
+                                                    LATEST,
+                                                    2015,
+                                                    4,
+                                                    1,
+                                                    31);
+            ASSERT(a != b);
+            ASSERT(bdlt::Date(2015, 1, 30) == a->front());
+            ASSERT(bdlt::Date(2015, 1, 31) == b->front());
+
+            // Empty schedules are shared within a method, but the same dates
+            // generated by different methods are not.
+
+            ASSERT(mX.getDayIntervalSchedule(EARLIEST,
+                                             EARLIEST,
+                                             EARLIEST + 1,
+                                             2)
+                == mX.getDayIntervalSchedule(LATEST,
+                                             LATEST,
+                                             LATEST + 1,
+                                             30));
+            ASSERT(mX.getDayIntervalSchedule(EARLIEST,
+                                             EARLIEST,
+                                             EARLIEST + 1,
+                                             2)
+                != mX.getDayOfMonthSchedule(EARLIEST,
+                                            EARLIEST,
+                                            2015,
+                                            1,
+                                            1,
+                                            2));
+            ASSERT(mX.getDayIntervalSchedule(EARLIEST,
+                                             EARLIEST,
+                                             EARLIEST,
+                                             1)
+                != mX.getDayOfMonthSchedule(EARLIEST,
+                                            EARLIEST,
+                                            2015,
+                                            1,
+                                            1,
+                                            1));
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bdlt::Date EARLIEST(2015, 1, 1);
+            const bdlt::Date LATEST(2015, 12, 31);
+
+            ASSERT_PASS(mX.getDayIntervalSchedule(EARLIEST,
+                                                  LATEST,
+                                                  EARLIEST,
+                                                  1));
+            ASSERT_FAIL(mX.getDayIntervalSchedule(LATEST,
+                                                  EARLIEST,
+                                                  EARLIEST,
+                                                  1));
+            ASSERT_FAIL(mX.getDayIntervalSchedule(EARLIEST,
+                                                  LATEST,
+                                                  EARLIEST,
+                                                  0));
+
+            ASSERT_PASS(mX.getDayOfMonthSchedule(EARLIEST, LATEST,
+                                                 2000,  1, 1,  1,  0));
+            ASSERT_FAIL(mX.getDayOfMonthSchedule(LATEST, EARLIEST,
+                                                 2000,  1, 1,  1,  0));
+            ASSERT_FAIL(mX.getDayOfMonthSchedule(EARLIEST, LATEST,
+                                                    0,  1, 1,  1,  0));
+            ASSERT_FAIL(mX.getDayOfMonthSchedule(EARLIEST, LATEST,
+                                                 2000, 13, 1,  1,  0));
+            ASSERT_FAIL(mX.getDayOfMonthSchedule(EARLIEST, LATEST,
+                                                 2000,  1, 0,  1,  0));
+            ASSERT_FAIL(mX.getDayOfMonthSchedule(EARLIEST, LATEST,
+                                                 2000,  1, 1, 32,  0));
+            ASSERT_FAIL(mX.getDayOfMonthSchedule(EARLIEST, LATEST,
+                                                 2000,  1, 1,  1, 30));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A cache is created empty, having the specified capacity.
+        //:
+        //: 2 The allocator supplied at construction, or the default allocator
+        //:   if none is supplied, is used.
+        //:
+        //: 3 All memory is released on destruction.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create caches with and without an allocator, and verify the
+        //:   accessors and the use of memory.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for argument values.  (C-4)
+        //
+        // Testing:
+        //   explicit ScheduleCache(size_t capacity, Allocator *ba = 0);
+        //   ~ScheduleCache();
+        //   bslma::Allocator *allocator() const;
+        //   size_t capacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CREATORS AND BASIC ACCESSORS" << endl
+                                  << "============================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        {
+            const Obj X(5, &ta);
+
+            ASSERT(5   == X.capacity());
+            ASSERT(0   == X.numSchedules());
+            ASSERT(&ta == X.allocator());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        {
+            Obj mX(1);  const Obj& X = mX;
+
+            ASSERT(1                 == X.capacity());
+            ASSERT(&defaultAllocator == X.allocator());
+
+            mX.getDayIntervalSchedule(bdlt::Date(2015, 1, 1),
+                                      bdlt::Date(2015, 2, 1),
+                                      bdlt::Date(2015, 1, 1),
+                                      1);
+            ASSERT(0 <  defaultAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(1, &ta));
+            ASSERT_FAIL(Obj(0, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Request a few schedules, and verify them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST" << endl
+                                  << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        Obj mX(2, &ta);  const Obj& X = mX;
+
+        ScheduleSp a = mX.getDayIntervalSchedule(bdlt::Date(2015, 1, 1),
+                                                 bdlt::Date(2015, 1, 31),
+                                                 bdlt::Date(2015, 1, 2),
+                                                 7);
+        ASSERT(5                      == a->size());
+        ASSERT(bdlt::Date(2015, 1, 2) == (*a)[0]);
+        ASSERT(1                      == X.numSchedules());
+
+        ScheduleSp b = mX.getDayOfMonthSchedule(bdlt::Date(2015, 1, 1),
+                                                bdlt::Date(2015, 12, 31),
+                                                2015,
+                                                1,
+                                                1,
+                                                31);
+        ASSERT(12                      == b->size());
+        ASSERT(bdlt::Date(2015, 2, 28) == (*b)[1]);
+        ASSERT(2                       == X.numSchedules());
+
+        ASSERT(a == mX.getDayIntervalSchedule(bdlt::Date(2015, 1, 1),
+                                              bdlt::Date(2015, 1, 31),
+                                              bdlt::Date(2015, 1, 2),
+                                              7));
+
+        ASSERT(2 == mX.invalidateAll());
+        ASSERT(0 == X.numSchedules());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
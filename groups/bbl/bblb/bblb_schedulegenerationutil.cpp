@@ -16,7 +16,6 @@ BSLS_IDENT_RCSID(bblb_schedulegenerationutil_cpp,"$Id$ $CSID$")
 #include <bsls_assert.h>
 
 #include <bsl_algorithm.h>
-#include <bsl_cstdlib.h>
 
 namespace {
 namespace u {
@@ -266,13 +265,17 @@ void generateFromDayIntervalImp(VECTOR            *schedule,
 
     schedule->clear();
 
-    int startCount = u::rationalCeiling(earliest - example, intervalInDays);
-    int endCount   = u::rationalFloor(latest - example, intervalInDays);
+    const DayIntervalScheduleGenerator generator(earliest,
+                                                 latest,
+                                                 example,
+                                                 intervalInDays);
 
-    schedule->reserve(bsl::abs(endCount - startCount) + 1);
+    const int numDates = generator.numDates();
 
-    for (int count = startCount; count <= endCount; count++) {
-        schedule->push_back(example + intervalInDays * count);
+    schedule->reserve(numDates);
+
+    for (int i = 0; i < numDates; ++i) {
+        schedule->push_back(generator.date(i));
     }
 }
 
@@ -311,62 +314,20 @@ void generateFromDayOfMonthImp(VECTOR            *schedule,
 
     schedule->clear();
 
-    int earliestSerialMonth;
-    int earliestDay;
-    u::computeSerialMonthAndDay(&earliestSerialMonth, &earliestDay, earliest);
-
-    int latestSerialMonth;
-    int latestDay;
-    u::computeSerialMonthAndDay(&latestSerialMonth, &latestDay, latest);
-
-    int startSerialMonth;
-    int endSerialMonth;
-
-    if (u::computeMonthRange(&startSerialMonth,
-                             &endSerialMonth,
-                             earliestSerialMonth,
-                             latestSerialMonth,
-                             U_YM2SERIAL(exampleYear, exampleMonth),
-                             intervalInMonths)) {
-        // empty schedule
-
-        return;                                                       // RETURN
-    }
-
-    int startDay = u::getDayOfMonth(U_SERIAL2Y(startSerialMonth),
-                                    U_SERIAL2M(startSerialMonth),
-                                    targetDayOfMonth,
-                                    targetDayOfFeb).day();
-
-    int endDay   = u::getDayOfMonth(U_SERIAL2Y(endSerialMonth),
-                                    U_SERIAL2M(endSerialMonth),
-                                    targetDayOfMonth,
-                                    targetDayOfFeb).day();
-
-    if (u::adjustMonthRange(&startSerialMonth,
-                            &endSerialMonth,
-                            startDay,
-                            endDay,
-                            earliestDay,
-                            latestDay,
-                            earliestSerialMonth,
-                            latestSerialMonth,
-                            intervalInMonths)) {
-        // empty schedule
+    const DayOfMonthScheduleGenerator generator(earliest,
+                                                latest,
+                                                exampleYear,
+                                                exampleMonth,
+                                                intervalInMonths,
+                                                targetDayOfMonth,
+                                                targetDayOfFeb);
 
-        return;                                                       // RETURN
-    }
+    const int numDates = generator.numDates();
 
-    schedule->reserve((endSerialMonth - startSerialMonth)
-                                                       / intervalInMonths + 1);
+    schedule->reserve(numDates);
 
-    for (int sm = startSerialMonth;
-         sm <= endSerialMonth;
-         sm += intervalInMonths) {
-        schedule->push_back(u::getDayOfMonth(U_SERIAL2Y(sm),
-                                             U_SERIAL2M(sm),
-                                             targetDayOfMonth,
-                                             targetDayOfFeb));
+    for (int i = 0; i < numDates; ++i) {
+        schedule->push_back(generator.date(i));
     }
 }
 
@@ -727,6 +688,125 @@ void generateFromDayOfWeekInMonthImp(VECTOR                *schedule,
 namespace BloombergLP {
 namespace bblb {
 
+                    // ----------------------------------
+                    // class DayIntervalScheduleGenerator
+                    // ----------------------------------
+
+// CREATORS
+DayIntervalScheduleGenerator::DayIntervalScheduleGenerator(
+                                             const bdlt::Date& earliest,
+                                             const bdlt::Date& latest,
+                                             const bdlt::Date& example,
+                                             int               intervalInDays)
+: d_firstDate()
+, d_intervalInDays(intervalInDays)
+, d_numDates(0)
+{
+    BSLS_ASSERT(earliest <= latest);
+    BSLS_ASSERT(1 <= intervalInDays);
+
+    const int startCount = u::rationalCeiling(earliest - example,
+                                              intervalInDays);
+    const int endCount   = u::rationalFloor(latest - example, intervalInDays);
+
+    if (startCount <= endCount) {
+        d_firstDate = example + intervalInDays * startCount;
+        d_numDates  = endCount - startCount + 1;
+    }
+}
+
+                     // ---------------------------------
+                     // class DayOfMonthScheduleGenerator
+                     // ---------------------------------
+
+// CREATORS
+DayOfMonthScheduleGenerator::DayOfMonthScheduleGenerator(
+                                           const bdlt::Date& earliest,
+                                           const bdlt::Date& latest,
+                                           int               exampleYear,
+                                           int               exampleMonth,
+                                           int               intervalInMonths,
+                                           int               targetDayOfMonth,
+                                           int               targetDayOfFeb)
+: d_firstSerialMonth(0)
+, d_intervalInMonths(intervalInMonths)
+, d_numDates(0)
+, d_targetDayOfMonth(targetDayOfMonth)
+, d_targetDayOfFeb(targetDayOfFeb)
+{
+    BSLS_ASSERT(earliest <= latest);
+    BSLS_ASSERT(1 <= intervalInMonths);
+    BSLS_ASSERT(1 <= exampleYear      && 9999 >= exampleYear);
+    BSLS_ASSERT(1 <= exampleMonth     &&   12 >= exampleMonth);
+    BSLS_ASSERT(1 <= targetDayOfMonth &&   31 >= targetDayOfMonth);
+    BSLS_ASSERT(0 <= targetDayOfFeb   &&   29 >= targetDayOfFeb);
+
+    int earliestSerialMonth;
+    int earliestDay;
+    u::computeSerialMonthAndDay(&earliestSerialMonth, &earliestDay, earliest);
+
+    int latestSerialMonth;
+    int latestDay;
+    u::computeSerialMonthAndDay(&latestSerialMonth, &latestDay, latest);
+
+    int startSerialMonth;
+    int endSerialMonth;
+
+    if (u::computeMonthRange(&startSerialMonth,
+                             &endSerialMonth,
+                             earliestSerialMonth,
+                             latestSerialMonth,
+                             U_YM2SERIAL(exampleYear, exampleMonth),
+                             intervalInMonths)) {
+        // empty schedule
+
+        return;                                                       // RETURN
+    }
+
+    int startDay = u::getDayOfMonth(U_SERIAL2Y(startSerialMonth),
+                                    U_SERIAL2M(startSerialMonth),
+                                    targetDayOfMonth,
+                                    targetDayOfFeb).day();
+
+    int endDay   = u::getDayOfMonth(U_SERIAL2Y(endSerialMonth),
+                                    U_SERIAL2M(endSerialMonth),
+                                    targetDayOfMonth,
+                                    targetDayOfFeb).day();
+
+    if (u::adjustMonthRange(&startSerialMonth,
+                            &endSerialMonth,
+                            startDay,
+                            endDay,
+                            earliestDay,
+                            latestDay,
+                            earliestSerialMonth,
+                            latestSerialMonth,
+                            intervalInMonths)) {
+        // empty schedule
+
+        return;                                                       // RETURN
+    }
+
+    if (startSerialMonth <= endSerialMonth) {
+        d_firstSerialMonth = startSerialMonth;
+        d_numDates         = (endSerialMonth - startSerialMonth)
+                                                       / intervalInMonths + 1;
+    }
+}
+
+// ACCESSORS
+bdlt::Date DayOfMonthScheduleGenerator::date(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index && index < d_numDates);
+
+    const int serialMonth = d_firstSerialMonth + index * d_intervalInMonths;
+
+    return u::getDayOfMonth(U_SERIAL2Y(serialMonth),
+                            U_SERIAL2M(serialMonth),
+                            d_targetDayOfMonth,
+                            d_targetDayOfFeb);
+}
+
                       // -----------------------------
                       // struct ScheduleGenerationUtil
                       // -----------------------------
@@ -9,8 +9,10 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bblb::ScheduleGenerationUtil: namespace for schedule generation functions
+//  bblb::DayIntervalScheduleGenerator: lazy day-interval schedule
+//  bblb::DayOfMonthScheduleGenerator: lazy day-of-month schedule
 //
-//@SEE_ALSO:
+//@SEE_ALSO: bblb_schedulecache
 //
 //@DESCRIPTION: This component provides a 'struct',
 // 'bblb::ScheduleGenerationUtil', that serves as a namespace for functions
@@ -73,6 +75,27 @@ BSLS_IDENT("$Id: $")
 //                                          the month.
 //..
 //
+///Lazy Schedule Generation
+///------------------------
+// The 'generate*' functions load a complete schedule into a vector.  Where
+// the dates of a schedule are only to be visited once (e.g., to accumulate
+// the accrual of a coupon stream), the allocation of that vector can be
+// avoided by using the corresponding generator class instead:
+//..
+//  'DayIntervalScheduleGenerator'          The dates that would be loaded by
+//                                          'generateFromDayInterval'.
+//
+//  'DayOfMonthScheduleGenerator'           The dates that would be loaded by
+//                                          'generateFromDayOfMonth'.
+//..
+// A generator is constructed from the same arguments as the corresponding
+// function, in constant time and without allocating memory.  It provides the
+// number of dates in the schedule, the date at any position in the schedule
+// (also in constant time), and a 'begin'/'end' pair of iterators over the
+// dates, which are computed as the iterators are dereferenced.  A generator
+// is a small value that does not refer to its arguments, and may be freely
+// copied.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -112,6 +135,41 @@ BSLS_IDENT("$Id: $")
 //  assert(bdlt::Date(2014,  4, 23) == schedule[2]);
 //  assert(bdlt::Date(2015,  1, 23) == schedule[3]);
 //..
+//
+///Example 2: Visiting a Schedule Without Allocating
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to count the number of dates in the schedule of
+// Example 1 that fall in the second half of a year, without materializing
+// the schedule.
+//
+// First, we create a generator for the schedule:
+//..
+//  const bblb::DayOfMonthScheduleGenerator generator(earliest,
+//                                                    latest,
+//                                                    example.year(),
+//                                                    example.month(),
+//                                                    9,
+//                                                    23);
+//  assert(4 == generator.numDates());
+//..
+// Then, we visit the dates of the schedule in chronological order:
+//..
+//  int count = 0;
+//  for (bblb::DayOfMonthScheduleGenerator::const_iterator it =
+//                                                           generator.begin();
+//       it != generator.end();
+//       ++it) {
+//      if (7 <= (*it).month()) {
+//          ++count;
+//      }
+//  }
+//..
+// Finally, we verify the count, and that the generator can also be indexed
+// directly:
+//..
+//  assert(2                        == count);
+//  assert(bdlt::Date(2014,  4, 23) == generator.date(2));
+//..
 
 #include <bblscm_version.h>
 
@@ -119,6 +177,10 @@ BSLS_IDENT("$Id: $")
 #include <bdlt_date.h>
 #include <bdlt_dayofweek.h>
 
+#include <bsls_assert.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_iterator.h>
 #include <bsl_vector.h>
 
 #ifdef BSLS_LIBRARYFEATURES_HAS_CPP17_PMR
@@ -334,6 +396,382 @@ struct ScheduleGenerationUtil {
         // '1 <= occurrenceWeek <= 4'.
 };
 
+               // ==========================================
+               // class ScheduleGenerationUtil_ConstIterator
+               // ==========================================
+
+template <class GENERATOR>
+class ScheduleGenerationUtil_ConstIterator {
+    // This class provides an input iterator over the dates of the schedule of
+    // an object of the (template parameter) 'GENERATOR' type, each date being
+    // computed as the iterator is dereferenced.  The behavior is undefined if
+    // an iterator is used after the generator from which it was obtained has
+    // been destroyed.
+
+    // DATA
+    const GENERATOR *d_generator_p;  // generator of the schedule (held, not
+                                     // owned)
+
+    int              d_index;        // index of the referenced date in the
+                                     // schedule
+
+  public:
+    // TYPES
+    typedef bsl::input_iterator_tag iterator_category;
+    typedef bdlt::Date              value_type;
+    typedef int                     difference_type;
+    typedef const bdlt::Date       *pointer;
+    typedef bdlt::Date              reference;
+        // Note that dates are returned by value.
+
+    // CREATORS
+    ScheduleGenerationUtil_ConstIterator(const GENERATOR *generator,
+                                         int              index);
+        // Create an iterator referring to the date at the specified 'index'
+        // in the schedule of the specified 'generator', or to the
+        // past-the-end position if 'index' is 'generator->numDates()'.  The
+        // behavior is undefined unless
+        // '0 <= index <= generator->numDates()'.
+
+    // MANIPULATORS
+    ScheduleGenerationUtil_ConstIterator& operator++();
+        // Advance this iterator to the next date in the schedule, and return
+        // a reference providing modifiable access to this iterator.  The
+        // behavior is undefined unless this iterator refers to a date.
+
+    ScheduleGenerationUtil_ConstIterator operator++(int);
+        // Advance this iterator to the next date in the schedule, and return
+        // an iterator having the value of this iterator before the call.  The
+        // behavior is undefined unless this iterator refers to a date.
+
+    // ACCESSORS
+    bdlt::Date operator*() const;
+        // Return the date referred to by this iterator.  The behavior is
+        // undefined unless this iterator refers to a date.
+
+    const GENERATOR *generator() const;
+        // Return the address of the generator over whose schedule this
+        // iterator iterates.
+
+    int index() const;
+        // Return the index of the date referred to by this iterator.
+};
+
+// FREE OPERATORS
+template <class GENERATOR>
+bool operator==(const ScheduleGenerationUtil_ConstIterator<GENERATOR>& lhs,
+                const ScheduleGenerationUtil_ConstIterator<GENERATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators refer to the
+    // same position in the schedule of the same generator, and 'false'
+    // otherwise.
+
+template <class GENERATOR>
+bool operator!=(const ScheduleGenerationUtil_ConstIterator<GENERATOR>& lhs,
+                const ScheduleGenerationUtil_ConstIterator<GENERATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators do not refer to
+    // the same position in the schedule of the same generator, and 'false'
+    // otherwise.
+
+                    // ==================================
+                    // class DayIntervalScheduleGenerator
+                    // ==================================
+
+class DayIntervalScheduleGenerator {
+    // This class provides, without allocating memory, the schedule of dates
+    // that 'ScheduleGenerationUtil::generateFromDayInterval' loads for the
+    // arguments supplied at construction.  See {Lazy Schedule Generation}.
+
+    // DATA
+    bdlt::Date d_firstDate;       // first date of the schedule, or
+                                  // 'bdlt::Date()' if the schedule is empty
+
+    int        d_intervalInDays;  // number of days between successive dates
+
+    int        d_numDates;        // number of dates in the schedule
+
+  public:
+    // TYPES
+    typedef ScheduleGenerationUtil_ConstIterator<DayIntervalScheduleGenerator>
+                                                                const_iterator;
+
+    // CREATORS
+    DayIntervalScheduleGenerator(const bdlt::Date& earliest,
+                                 const bdlt::Date& latest,
+                                 const bdlt::Date& example,
+                                 int               intervalInDays);
+        // Create a generator of the chronologically increasing sequence of
+        // unique dates that are integral multiples of the specified
+        // 'intervalInDays' away from the specified 'example' date, and within
+        // the specified closed-interval '[earliest, latest]'.  The behavior is
+        // undefined unless 'earliest <= latest' and '1 <= intervalInDays'.
+
+    // ACCESSORS
+    const_iterator begin() const;
+        // Return an iterator referring to the first date in the schedule of
+        // this generator, or 'end()' if the schedule is empty.
+
+    bdlt::Date date(int index) const;
+        // Return the date at the specified 'index' in the schedule of this
+        // generator.  The behavior is undefined unless
+        // '0 <= index < numDates()'.
+
+    const_iterator end() const;
+        // Return an iterator referring to the past-the-end position in the
+        // schedule of this generator.
+
+    int intervalInDays() const;
+        // Return the number of days between successive dates in the schedule
+        // of this generator.
+
+    int numDates() const;
+        // Return the number of dates in the schedule of this generator.
+};
+
+                     // =================================
+                     // class DayOfMonthScheduleGenerator
+                     // =================================
+
+class DayOfMonthScheduleGenerator {
+    // This class provides, without allocating memory, the schedule of dates
+    // that 'ScheduleGenerationUtil::generateFromDayOfMonth' loads for the
+    // arguments supplied at construction.  See {Lazy Schedule Generation}.
+
+    // DATA
+    int d_firstSerialMonth;  // '12 * year + month - 1' of the first date of
+                             // the schedule, or 0 if the schedule is empty
+
+    int d_intervalInMonths;  // number of months between successive dates
+
+    int d_numDates;          // number of dates in the schedule
+
+    int d_targetDayOfMonth;  // day of the month of each date (or the last
+                             // day of a shorter month)
+
+    int d_targetDayOfFeb;    // if non-zero, replaces 'd_targetDayOfMonth'
+                             // in February
+
+  public:
+    // TYPES
+    typedef ScheduleGenerationUtil_ConstIterator<DayOfMonthScheduleGenerator>
+                                                                const_iterator;
+
+    // CREATORS
+    DayOfMonthScheduleGenerator(const bdlt::Date& earliest,
+                                const bdlt::Date& latest,
+                                int               exampleYear,
+                                int               exampleMonth,
+                                int               intervalInMonths,
+                                int               targetDayOfMonth,
+                                int               targetDayOfFeb = 0);
+        // Create a generator of the chronologically increasing sequence of
+        // unique dates that are on the specified 'targetDayOfMonth' (or the
+        // last day of the month if 'targetDayOfMonth' would be past the end
+        // of the month), integral multiples of the specified
+        // 'intervalInMonths' away from the specified 'exampleYear' and
+        // 'exampleMonth', and within the specified closed-interval
+        // '[earliest, latest]'.  Optionally specify 'targetDayOfFeb' to
+        // replace 'targetDayOfMonth' whenever the month of a date is
+        // February.  The behavior is undefined unless 'earliest <= latest',
+        // '1 <= exampleYear <= 9999', '1 <= exampleMonth <= 12',
+        // '1 <= intervalInMonths', '1 <= targetDayOfMonth <= 31', and
+        // '0 <= targetDayOfFeb <= 29'.
+
+    // ACCESSORS
+    const_iterator begin() const;
+        // Return an iterator referring to the first date in the schedule of
+        // this generator, or 'end()' if the schedule is empty.
+
+    bdlt::Date date(int index) const;
+        // Return the date at the specified 'index' in the schedule of this
+        // generator.  The behavior is undefined unless
+        // '0 <= index < numDates()'.
+
+    const_iterator end() const;
+        // Return an iterator referring to the past-the-end position in the
+        // schedule of this generator.
+
+    int intervalInMonths() const;
+        // Return the number of months between successive dates in the
+        // schedule of this generator.
+
+    int numDates() const;
+        // Return the number of dates in the schedule of this generator.
+
+    int targetDayOfFeb() const;
+        // Return the day of the month of the dates in February in the
+        // schedule of this generator, or 0 if those dates are on the target
+        // day of the month.
+
+    int targetDayOfMonth() const;
+        // Return the day of the month of the dates in the schedule of this
+        // generator (or, in shorter months, the last day of the month).
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+               // ------------------------------------------
+               // class ScheduleGenerationUtil_ConstIterator
+               // ------------------------------------------
+
+// CREATORS
+template <class GENERATOR>
+inline
+ScheduleGenerationUtil_ConstIterator<GENERATOR>::
+               ScheduleGenerationUtil_ConstIterator(const GENERATOR *generator,
+                                                    int              index)
+: d_generator_p(generator)
+, d_index(index)
+{
+    BSLS_ASSERT_SAFE(generator);
+    BSLS_ASSERT_SAFE(0 <= index && index <= generator->numDates());
+}
+
+// MANIPULATORS
+template <class GENERATOR>
+inline
+ScheduleGenerationUtil_ConstIterator<GENERATOR>&
+ScheduleGenerationUtil_ConstIterator<GENERATOR>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_index < d_generator_p->numDates());
+
+    ++d_index;
+    return *this;
+}
+
+template <class GENERATOR>
+inline
+ScheduleGenerationUtil_ConstIterator<GENERATOR>
+ScheduleGenerationUtil_ConstIterator<GENERATOR>::operator++(int)
+{
+    ScheduleGenerationUtil_ConstIterator tmp(*this);
+    ++*this;
+    return tmp;
+}
+
+// ACCESSORS
+template <class GENERATOR>
+inline
+bdlt::Date ScheduleGenerationUtil_ConstIterator<GENERATOR>::operator*() const
+{
+    return d_generator_p->date(d_index);
+}
+
+template <class GENERATOR>
+inline
+const GENERATOR *
+ScheduleGenerationUtil_ConstIterator<GENERATOR>::generator() const
+{
+    return d_generator_p;
+}
+
+template <class GENERATOR>
+inline
+int ScheduleGenerationUtil_ConstIterator<GENERATOR>::index() const
+{
+    return d_index;
+}
+
+// FREE OPERATORS
+template <class GENERATOR>
+inline
+bool operator==(const ScheduleGenerationUtil_ConstIterator<GENERATOR>& lhs,
+                const ScheduleGenerationUtil_ConstIterator<GENERATOR>& rhs)
+{
+    return lhs.generator() == rhs.generator() && lhs.index() == rhs.index();
+}
+
+template <class GENERATOR>
+inline
+bool operator!=(const ScheduleGenerationUtil_ConstIterator<GENERATOR>& lhs,
+                const ScheduleGenerationUtil_ConstIterator<GENERATOR>& rhs)
+{
+    return lhs.generator() != rhs.generator() || lhs.index() != rhs.index();
+}
+
+                    // ----------------------------------
+                    // class DayIntervalScheduleGenerator
+                    // ----------------------------------
+
+// ACCESSORS
+inline
+DayIntervalScheduleGenerator::const_iterator
+DayIntervalScheduleGenerator::begin() const
+{
+    return const_iterator(this, 0);
+}
+
+inline
+bdlt::Date DayIntervalScheduleGenerator::date(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index && index < d_numDates);
+
+    return d_firstDate + index * d_intervalInDays;
+}
+
+inline
+DayIntervalScheduleGenerator::const_iterator
+DayIntervalScheduleGenerator::end() const
+{
+    return const_iterator(this, d_numDates);
+}
+
+inline
+int DayIntervalScheduleGenerator::intervalInDays() const
+{
+    return d_intervalInDays;
+}
+
+inline
+int DayIntervalScheduleGenerator::numDates() const
+{
+    return d_numDates;
+}
+
+                     // ---------------------------------
+                     // class DayOfMonthScheduleGenerator
+                     // ---------------------------------
+
+// ACCESSORS
+inline
+DayOfMonthScheduleGenerator::const_iterator
+DayOfMonthScheduleGenerator::begin() const
+{
+    return const_iterator(this, 0);
+}
+
+inline
+DayOfMonthScheduleGenerator::const_iterator
+DayOfMonthScheduleGenerator::end() const
+{
+    return const_iterator(this, d_numDates);
+}
+
+inline
+int DayOfMonthScheduleGenerator::intervalInMonths() const
+{
+    return d_intervalInMonths;
+}
+
+inline
+int DayOfMonthScheduleGenerator::numDates() const
+{
+    return d_numDates;
+}
+
+inline
+int DayOfMonthScheduleGenerator::targetDayOfFeb() const
+{
+    return d_targetDayOfFeb;
+}
+
+inline
+int DayOfMonthScheduleGenerator::targetDayOfMonth() const
+{
+    return d_targetDayOfMonth;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
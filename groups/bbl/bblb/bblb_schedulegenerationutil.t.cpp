@@ -21,6 +21,7 @@
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_vector.h>
@@ -49,8 +50,26 @@ using namespace bsl;
 // [ 4] generateFromBusinessDayOfMonth(s, e, l, c, eY, eM, i, tBDOM);
 // [ 5] generateFromDayOfWeekAfterDayOfMonth(s, e, l, d, eY, eM, i, DOM);
 // [ 6] generateFromDayOfWeekInMonth(s, e, l, d, eY, eM, i, oW);
+//
+// CLASS 'DayIntervalScheduleGenerator'
+// [ 7] DayIntervalScheduleGenerator(e, l, example, interval);
+// [ 7] const_iterator begin() const;
+// [ 7] bdlt::Date date(int index) const;
+// [ 7] const_iterator end() const;
+// [ 7] int intervalInDays() const;
+// [ 7] int numDates() const;
+//
+// CLASS 'DayOfMonthScheduleGenerator'
+// [ 7] DayOfMonthScheduleGenerator(e, l, eY, eM, i, tDOM, tDOF);
+// [ 7] const_iterator begin() const;
+// [ 7] bdlt::Date date(int index) const;
+// [ 7] const_iterator end() const;
+// [ 7] int intervalInMonths() const;
+// [ 7] int numDates() const;
+// [ 7] int targetDayOfFeb() const;
+// [ 7] int targetDayOfMonth() const;
 // ----------------------------------------------------------------------------
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 // [ 1] toString(output, date)
 // ----------------------------------------------------------------------------
 
@@ -170,6 +189,107 @@ void toString(bsl::ostringstream *output,
     output->flush();
 }
 
+static
+void referenceDayInterval(bsl::vector<bdlt::Date> *schedule,
+                          const bdlt::Date&        earliest,
+                          const bdlt::Date&        latest,
+                          const bdlt::Date&        example,
+                          int                      intervalInDays)
+    // Load, into the specified 'schedule', the dates in the closed-interval
+    // specified by 'earliest' and 'latest' that are integral multiples of the
+    // specified 'intervalInDays' away from the specified 'example', computed
+    // by testing each date in the interval.
+{
+    schedule->clear();
+
+    for (bdlt::Date date = earliest; ; ++date) {
+        if (0 == (date - example) % intervalInDays) {
+            schedule->push_back(date);
+        }
+        if (date == latest) {
+            break;
+        }
+    }
+}
+
+static
+void referenceDayOfMonth(bsl::vector<bdlt::Date> *schedule,
+                         const bdlt::Date&        earliest,
+                         const bdlt::Date&        latest,
+                         int                      exampleYear,
+                         int                      exampleMonth,
+                         int                      intervalInMonths,
+                         int                      targetDayOfMonth,
+                         int                      targetDayOfFeb)
+    // Load, into the specified 'schedule', the dates in the closed-interval
+    // specified by 'earliest' and 'latest' that are on the specified
+    // 'targetDayOfMonth' (or 'targetDayOfFeb', if non-zero, in February), or
+    // the last day of a shorter month, of the months that are integral
+    // multiples of the specified 'intervalInMonths' away from the specified
+    // 'exampleYear' and 'exampleMonth', computed by testing each month in the
+    // interval.
+{
+    schedule->clear();
+
+    const int exampleSerialMonth = exampleYear * 12 + exampleMonth - 1;
+
+    for (int sm = earliest.year() * 12 + earliest.month() - 1;
+         sm <= latest.year() * 12 + latest.month() - 1;
+         ++sm) {
+        if (0 != (sm - exampleSerialMonth) % intervalInMonths) {
+            continue;                                               // CONTINUE
+        }
+
+        const int year  = sm / 12;
+        const int month = sm % 12 + 1;
+        const int day   = bsl::min(bdlt::DateUtil::lastDayInMonth(year,
+                                                                  month).day(),
+                                   2 == month && targetDayOfFeb
+                                   ? targetDayOfFeb
+                                   : targetDayOfMonth);
+
+        const bdlt::Date date(year, month, day);
+        if (earliest <= date && date <= latest) {
+            schedule->push_back(date);
+        }
+    }
+}
+
+template <class GENERATOR>
+static
+void verifyGenerator(int                            line,
+                     const GENERATOR&               generator,
+                     const bsl::vector<bdlt::Date>& expected)
+    // Verify that the specified 'generator' produces the specified 'expected'
+    // schedule through each of its accessors, reporting failures using the
+    // specified 'line'.
+{
+    const int NUM_DATES = static_cast<int>(expected.size());
+
+    ASSERTV(line, NUM_DATES, generator.numDates(),
+            NUM_DATES == generator.numDates());
+
+    if (NUM_DATES != generator.numDates()) {
+        return;                                                       // RETURN
+    }
+
+    for (int i = 0; i < NUM_DATES; ++i) {
+        ASSERTV(line, i, expected[i], generator.date(i),
+                expected[i] == generator.date(i));
+    }
+
+    typename GENERATOR::const_iterator it = generator.begin();
+    for (int i = 0; i < NUM_DATES; ++i) {
+        ASSERTV(line, i, it != generator.end());
+        ASSERTV(line, i, i == it.index());
+        ASSERTV(line, i, expected[i] == *it);
+
+        typename GENERATOR::const_iterator previous = it++;
+        ASSERTV(line, i, i == previous.index());
+    }
+    ASSERTV(line, it == generator.end());
+}
+
 // ============================================================================
 //                            TEST CLASSES
 // ----------------------------------------------------------------------------
@@ -244,14 +364,15 @@ class TestCalendarLoader : public bdlt::CalendarLoader
 
 int main(int argc, char *argv[])
 {
-    int         test = argc > 1 ? atoi(argv[1]) : 0;
-    bool     verbose = argc > 2;
-    bool veryVerbose = argc > 3;
+    int             test = argc > 1 ? atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
 
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -311,6 +432,268 @@ int main(int argc, char *argv[])
     ASSERT(bdlt::Date(2014,  4, 23) == schedule[2]);
     ASSERT(bdlt::Date(2015,  1, 23) == schedule[3]);
 //..
+//
+///Example 2: Visiting a Schedule Without Allocating
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we want to count the number of dates in the schedule of
+// Example 1 that fall in the second half of a year, without materializing
+// the schedule.
+//
+// First, we create a generator for the schedule:
+//..
+    const bblb::DayOfMonthScheduleGenerator generator(earliest,
+                                                      latest,
+                                                      example.year(),
+                                                      example.month(),
+                                                      9,
+                                                      23);
+    ASSERT(4 == generator.numDates());
+//..
+// Then, we visit the dates of the schedule in chronological order:
+//..
+    int count = 0;
+    for (bblb::DayOfMonthScheduleGenerator::const_iterator it =
+                                                             generator.begin();
+         it != generator.end();
+         ++it) {
+        if (7 <= (*it).month()) {
+            ++count;
+        }
+    }
+//..
+// Finally, we verify the count, and that the generator can also be indexed
+// directly:
+//..
+    ASSERT(2                        == count);
+    ASSERT(bdlt::Date(2014,  4, 23) == generator.date(2));
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING SCHEDULE GENERATORS
+        //
+        // Concerns:
+        //: 1 A generator produces the schedule that the corresponding
+        //:   'generate*' function loads, through 'numDates', 'date', and the
+        //:   iterators.
+        //:
+        //: 2 Empty schedules, schedules at the limits of the valid range of
+        //:   dates, and target days past the end of the month are handled.
+        //:
+        //: 3 The accessors return the interval and target days supplied at
+        //:   construction.
+        //:
+        //: 4 No memory is allocated.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a grid of arguments, compare the schedule of each generator
+        //:   with one computed by brute force, and with that loaded by the
+        //:   corresponding 'generate*' function.  (C-1..3)
+        //:
+        //: 2 Install a test allocator as the default allocator, and verify
+        //:   that it is not used by the generators.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for argument values.  (C-5)
+        //
+        // Testing:
+        //   DayIntervalScheduleGenerator(e, l, example, interval);
+        //   DayOfMonthScheduleGenerator(e, l, eY, eM, i, tDOM, tDOF);
+        //   const_iterator begin() const;
+        //   bdlt::Date date(int index) const;
+        //   const_iterator end() const;
+        //   int intervalInDays() const;
+        //   int intervalInMonths() const;
+        //   int numDates() const;
+        //   int targetDayOfFeb() const;
+        //   int targetDayOfMonth() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING SCHEDULE GENERATORS" << endl
+                          << "===========================" << endl;
+
+        static const struct {
+            int d_lineNum;
+            int d_earliestYYYYMMDD;
+            int d_latestYYYYMMDD;
+        } RANGES[] = {
+            //LN  earliest   latest
+            //--  --------  --------
+            { L_, 20140505, 20140505 },
+            { L_, 20140505, 20140512 },
+            { L_, 20150123, 20150304 },
+            { L_, 20150131, 20160229 },
+            { L_, 20111130, 20150301 },
+            { L_, 20240229, 20240229 },
+            { L_,    10101,    10301 },
+            { L_,    10101,    20101 },
+            { L_, 99981215, 99991231 },
+            { L_, 99991231, 99991231 },
+        };
+        const int NUM_RANGES = static_cast<int>(sizeof RANGES
+                                              / sizeof *RANGES);
+
+        static const int EXAMPLES[] = {
+               10101, 19680607, 20140507, 20150131, 20160229, 99991231
+        };
+        const int NUM_EXAMPLES = static_cast<int>(sizeof EXAMPLES
+                                                / sizeof *EXAMPLES);
+
+        static const int DAY_INTERVALS[] = { 1, 2, 7, 14, 30, 365, 100000 };
+        const int NUM_DAY_INTERVALS = static_cast<int>(sizeof DAY_INTERVALS
+                                                     / sizeof *DAY_INTERVALS);
+
+        static const int MONTH_INTERVALS[] = { 1, 3, 6, 12, 25, 200000 };
+        const int NUM_MONTH_INTERVALS = static_cast<int>(
+                                                   sizeof MONTH_INTERVALS
+                                                 / sizeof *MONTH_INTERVALS);
+
+        static const int TARGET_DAYS[][2] = {
+            //DOM  DOF
+            //---  ---
+            {   1,   0 },
+            {  15,   0 },
+            {  29,   0 },
+            {  30,  28 },
+            {  31,   0 },
+            {  31,  29 },
+        };
+        const int NUM_TARGET_DAYS = static_cast<int>(sizeof TARGET_DAYS
+                                                   / sizeof *TARGET_DAYS);
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator         ta("test", veryVeryVerbose);
+
+        for (int ri = 0; ri < NUM_RANGES; ++ri) {
+            const int        LINE     = RANGES[ri].d_lineNum;
+            const bdlt::Date EARLIEST = bdlt::DateUtil::convertFromYYYYMMDDRaw(
+                                                RANGES[ri].d_earliestYYYYMMDD);
+            const bdlt::Date LATEST   = bdlt::DateUtil::convertFromYYYYMMDDRaw(
+                                                  RANGES[ri].d_latestYYYYMMDD);
+
+            for (int ei = 0; ei < NUM_EXAMPLES; ++ei) {
+                const bdlt::Date EXAMPLE =
+                         bdlt::DateUtil::convertFromYYYYMMDDRaw(EXAMPLES[ei]);
+
+                if (veryVerbose) { T_ P_(LINE) P(EXAMPLE) }
+
+                for (int ii = 0; ii < NUM_DAY_INTERVALS; ++ii) {
+                    const int INTERVAL = DAY_INTERVALS[ii];
+
+                    const bblb::DayIntervalScheduleGenerator X(EARLIEST,
+                                                               LATEST,
+                                                               EXAMPLE,
+                                                               INTERVAL);
+
+                    ASSERTV(LINE, INTERVAL == X.intervalInDays());
+
+                    bsl::vector<bdlt::Date> expected(&ta);
+                    referenceDayInterval(&expected,
+                                         EARLIEST,
+                                         LATEST,
+                                         EXAMPLE,
+                                         INTERVAL);
+                    verifyGenerator(LINE, X, expected);
+
+                    bsl::vector<bdlt::Date> schedule(&ta);
+                    Obj::generateFromDayInterval(&schedule,
+                                                 EARLIEST,
+                                                 LATEST,
+                                                 EXAMPLE,
+                                                 INTERVAL);
+                    ASSERTV(LINE, INTERVAL, expected == schedule);
+                }
+
+                for (int ii = 0; ii < NUM_MONTH_INTERVALS; ++ii) {
+                    const int INTERVAL = MONTH_INTERVALS[ii];
+
+                    for (int ti = 0; ti < NUM_TARGET_DAYS; ++ti) {
+                        const int DOM = TARGET_DAYS[ti][0];
+                        const int DOF = TARGET_DAYS[ti][1];
+
+                        const bblb::DayOfMonthScheduleGenerator X(
+                                                             EARLIEST,
+                                                             LATEST,
+                                                             EXAMPLE.year(),
+                                                             EXAMPLE.month(),
+                                                             INTERVAL,
+                                                             DOM,
+                                                             DOF);
+
+                        ASSERTV(LINE, INTERVAL == X.intervalInMonths());
+                        ASSERTV(LINE, DOM      == X.targetDayOfMonth());
+                        ASSERTV(LINE, DOF      == X.targetDayOfFeb());
+
+                        bsl::vector<bdlt::Date> expected(&ta);
+                        referenceDayOfMonth(&expected,
+                                            EARLIEST,
+                                            LATEST,
+                                            EXAMPLE.year(),
+                                            EXAMPLE.month(),
+                                            INTERVAL,
+                                            DOM,
+                                            DOF);
+                        verifyGenerator(LINE, X, expected);
+
+                        bsl::vector<bdlt::Date> schedule(&ta);
+                        Obj::generateFromDayOfMonth(&schedule,
+                                                    EARLIEST,
+                                                    LATEST,
+                                                    EXAMPLE.year(),
+                                                    EXAMPLE.month(),
+                                                    INTERVAL,
+                                                    DOM,
+                                                    DOF);
+                        ASSERTV(LINE, INTERVAL, DOM, DOF,
+                                expected == schedule);
+                    }
+                }
+            }
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bdlt::Date EARLIEST(2015, 1, 1);
+            const bdlt::Date LATEST(2015, 12, 31);
+
+            typedef bblb::DayIntervalScheduleGenerator DIG;
+            typedef bblb::DayOfMonthScheduleGenerator  DMG;
+
+            ASSERT_PASS(DIG(EARLIEST, EARLIEST, EARLIEST, 1));
+            ASSERT_FAIL(DIG(LATEST,   EARLIEST, EARLIEST, 1));
+            ASSERT_FAIL(DIG(EARLIEST, LATEST,   EARLIEST, 0));
+
+            ASSERT_PASS(DMG(EARLIEST, LATEST, 2000,  1, 1,  1,  0));
+            ASSERT_FAIL(DMG(LATEST, EARLIEST, 2000,  1, 1,  1,  0));
+            ASSERT_FAIL(DMG(EARLIEST, LATEST,    0,  1, 1,  1,  0));
+            ASSERT_FAIL(DMG(EARLIEST, LATEST, 2000, 13, 1,  1,  0));
+            ASSERT_FAIL(DMG(EARLIEST, LATEST, 2000,  1, 0,  1,  0));
+            ASSERT_FAIL(DMG(EARLIEST, LATEST, 2000,  1, 1, 32,  0));
+            ASSERT_FAIL(DMG(EARLIEST, LATEST, 2000,  1, 1,  1, 30));
+
+            const DIG X(EARLIEST, LATEST, EARLIEST, 7);
+            const DMG Y(EARLIEST, LATEST, 2000, 1, 1, 1);
+
+            ASSERT_SAFE_PASS(X.date(X.numDates() - 1));
+            ASSERT_SAFE_FAIL(X.date(X.numDates()));
+            ASSERT_SAFE_FAIL(X.date(-1));
+            ASSERT_SAFE_PASS(Y.date(Y.numDates() - 1));
+            ASSERT_SAFE_FAIL(Y.date(Y.numDates()));
+            ASSERT_SAFE_FAIL(Y.date(-1));
+
+            DIG::const_iterator it = X.end();
+            ASSERT_SAFE_FAIL(++it);
+            ASSERT_SAFE_FAIL(DIG::const_iterator(&X, X.numDates() + 1));
+        }
       } break;
       case 6: {
         // --------------------------------------------------------------------
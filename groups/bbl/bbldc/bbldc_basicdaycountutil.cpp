@@ -21,6 +21,57 @@ BSLS_IDENT_RCSID(bbldc_basicdaycountutil_cpp,"$Id$ $CSID$")
 namespace BloombergLP {
 namespace bbldc {
 
+// STATIC HELPER FUNCTIONS
+
+template <class CONVENTION>
+static void loadDaysDiff(int              *result,
+                         const bdlt::Date *beginDates,
+                         const bdlt::Date *endDates,
+                         int               numPairs)
+    // Load, into each of the specified 'numPairs' elements of the specified
+    // 'result' array, the day count computed by 'CONVENTION::daysDiff' for the
+    // corresponding elements of the specified 'beginDates' and 'endDates'
+    // arrays.
+{
+    for (int i = 0; i < numPairs; ++i) {
+        result[i] = CONVENTION::daysDiff(beginDates[i], endDates[i]);
+    }
+}
+
+template <class CONVENTION>
+static void loadYearsDiff(double           *result,
+                          const bdlt::Date *beginDates,
+                          const bdlt::Date *endDates,
+                          int               numPairs)
+    // Load, into each of the specified 'numPairs' elements of the specified
+    // 'result' array, the year fraction computed by 'CONVENTION::yearsDiff'
+    // for the corresponding elements of the specified 'beginDates' and
+    // 'endDates' arrays.
+{
+    for (int i = 0; i < numPairs; ++i) {
+        result[i] = CONVENTION::yearsDiff(beginDates[i], endDates[i]);
+    }
+}
+
+static void loadActualYearsDiff(double           *result,
+                                const bdlt::Date *beginDates,
+                                const bdlt::Date *endDates,
+                                int               numPairs,
+                                double            daysInYear)
+    // Load, into each of the specified 'numPairs' elements of the specified
+    // 'result' array, the actual number of days between the corresponding
+    // elements of the specified 'beginDates' and 'endDates' arrays divided by
+    // the specified 'daysInYear'.  Note that this is the year fraction of the
+    // Actual/360 and Actual/365 (Fixed) conventions, computed here without the
+    // per-call overhead of those conventions' out-of-line 'yearsDiff', and
+    // that storing each result into 'result' discards any extra precision
+    // just as the 'volatile' temporary in those functions does.
+{
+    for (int i = 0; i < numPairs; ++i) {
+        result[i] = (endDates[i] - beginDates[i]) / daysInYear;
+    }
+}
+
                          // ------------------------
                          // struct BasicDayCountUtil
                          // ------------------------
@@ -69,6 +120,69 @@ int BasicDayCountUtil::daysDiff(const bdlt::Date&        beginDate,
     return numDays;
 }
 
+void BasicDayCountUtil::daysDiff(int                      *result,
+                                 const bdlt::Date         *beginDates,
+                                 const bdlt::Date         *endDates,
+                                 int                       numPairs,
+                                 DayCountConvention::Enum  convention)
+{
+    BSLS_ASSERT(0 <= numPairs);
+    BSLS_ASSERT(result     || 0 == numPairs);
+    BSLS_ASSERT(beginDates || 0 == numPairs);
+    BSLS_ASSERT(endDates   || 0 == numPairs);
+
+    switch (convention) {
+      case DayCountConvention::e_ACTUAL_360: {
+        loadDaysDiff<BasicActual360>(result, beginDates, endDates, numPairs);
+      } break;
+      case DayCountConvention::e_ACTUAL_365_FIXED: {
+        loadDaysDiff<BasicActual365Fixed>(result,
+                                          beginDates,
+                                          endDates,
+                                          numPairs);
+      } break;
+      case DayCountConvention::e_ISDA_30_360_EOM: {
+        loadDaysDiff<TerminatedIsda30360Eom>(result,
+                                             beginDates,
+                                             endDates,
+                                             numPairs);
+      } break;
+      case DayCountConvention::e_ISDA_ACTUAL_ACTUAL: {
+        loadDaysDiff<BasicIsdaActualActual>(result,
+                                            beginDates,
+                                            endDates,
+                                            numPairs);
+      } break;
+      case DayCountConvention::e_ISMA_30_360: {
+        loadDaysDiff<BasicIsma30360>(result, beginDates, endDates, numPairs);
+      } break;
+      case DayCountConvention::e_NL_365: {
+        loadDaysDiff<BasicNl365>(result, beginDates, endDates, numPairs);
+      } break;
+      case DayCountConvention::e_PSA_30_360_EOM: {
+        loadDaysDiff<BasicPsa30360Eom>(result,
+                                       beginDates,
+                                       endDates,
+                                       numPairs);
+      } break;
+      case DayCountConvention::e_SIA_30_360_EOM: {
+        loadDaysDiff<BasicSia30360Eom>(result,
+                                       beginDates,
+                                       endDates,
+                                       numPairs);
+      } break;
+      case DayCountConvention::e_SIA_30_360_NEOM: {
+        loadDaysDiff<BasicSia30360Neom>(result,
+                                        beginDates,
+                                        endDates,
+                                        numPairs);
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+      } break;
+    }
+}
+
 bool BasicDayCountUtil::isSupported(DayCountConvention::Enum convention)
 {
     bool rv = true;
@@ -136,6 +250,66 @@ double BasicDayCountUtil::yearsDiff(const bdlt::Date&        beginDate,
     return numYears;
 }
 
+void BasicDayCountUtil::yearsDiff(double                   *result,
+                                  const bdlt::Date         *beginDates,
+                                  const bdlt::Date         *endDates,
+                                  int                       numPairs,
+                                  DayCountConvention::Enum  convention)
+{
+    BSLS_ASSERT(0 <= numPairs);
+    BSLS_ASSERT(result     || 0 == numPairs);
+    BSLS_ASSERT(beginDates || 0 == numPairs);
+    BSLS_ASSERT(endDates   || 0 == numPairs);
+
+    switch (convention) {
+      case DayCountConvention::e_ACTUAL_360: {
+        loadActualYearsDiff(result, beginDates, endDates, numPairs, 360.0);
+      } break;
+      case DayCountConvention::e_ACTUAL_365_FIXED: {
+        loadActualYearsDiff(result, beginDates, endDates, numPairs, 365.0);
+      } break;
+      case DayCountConvention::e_ISDA_30_360_EOM: {
+        loadYearsDiff<TerminatedIsda30360Eom>(result,
+                                              beginDates,
+                                              endDates,
+                                              numPairs);
+      } break;
+      case DayCountConvention::e_ISDA_ACTUAL_ACTUAL: {
+        loadYearsDiff<BasicIsdaActualActual>(result,
+                                             beginDates,
+                                             endDates,
+                                             numPairs);
+      } break;
+      case DayCountConvention::e_ISMA_30_360: {
+        loadYearsDiff<BasicIsma30360>(result, beginDates, endDates, numPairs);
+      } break;
+      case DayCountConvention::e_NL_365: {
+        loadYearsDiff<BasicNl365>(result, beginDates, endDates, numPairs);
+      } break;
+      case DayCountConvention::e_PSA_30_360_EOM: {
+        loadYearsDiff<BasicPsa30360Eom>(result,
+                                        beginDates,
+                                        endDates,
+                                        numPairs);
+      } break;
+      case DayCountConvention::e_SIA_30_360_EOM: {
+        loadYearsDiff<BasicSia30360Eom>(result,
+                                        beginDates,
+                                        endDates,
+                                        numPairs);
+      } break;
+      case DayCountConvention::e_SIA_30_360_NEOM: {
+        loadYearsDiff<BasicSia30360Neom>(result,
+                                         beginDates,
+                                         endDates,
+                                         numPairs);
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+      } break;
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -20,6 +20,16 @@ BSLS_IDENT("$Id: $")
 // 'DayCountConvention::Enum' argument indicating which particular day-count
 // convention to apply.
 //
+///Batch Computation
+///-----------------
+// Overloads of 'daysDiff' and 'yearsDiff' taking arrays of begin and end dates
+// compute the day counts or year fractions of many date pairs in one call.
+// These overloads select the implementation for the convention once, and then
+// evaluate every pair in a tight loop; for the actual-day conventions (e.g.,
+// Actual/360), the loop reduces to serial-date subtraction (and a division),
+// which the compiler can vectorize.  The results are identical to those
+// obtained by calling the single-pair overloads for each pair.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -80,6 +90,21 @@ struct BasicDayCountUtil {
         // 'beginDate <= endDate' then the result is non-negative.  Note that
         // reversing the order of 'beginDate' and 'endDate' negates the result.
 
+    static void daysDiff(int                      *result,
+                         const bdlt::Date         *beginDates,
+                         const bdlt::Date         *endDates,
+                         int                       numPairs,
+                         DayCountConvention::Enum  convention);
+        // Load, into each of the specified 'numPairs' elements of the
+        // specified 'result' array, the (signed) number of days between the
+        // corresponding elements of the specified 'beginDates' and 'endDates'
+        // arrays according to the specified day-count 'convention'; i.e.,
+        // 'result[i] = daysDiff(beginDates[i], endDates[i], convention)' for
+        // each 'i' in '[0 .. numPairs - 1]'.  The behavior is undefined unless
+        // 'isSupported(convention)', '0 <= numPairs', and each of 'result',
+        // 'beginDates', and 'endDates' refers to an array of at least
+        // 'numPairs' elements.
+
     static bool isSupported(DayCountConvention::Enum convention);
         // Return 'true' if the specified 'convention' is valid for use in
         // 'daysDiff' and 'yearsDiff', and 'false' otherwise.
@@ -95,6 +120,22 @@ struct BasicDayCountUtil {
         // 'beginDate' and 'endDate' negates the result; specifically,
         // '|yearsDiff(b, e, c) + yearsDiff(e, b, c)| <= 1.0e-15' for all dates
         // 'b' and 'e', and day-count conventions 'c'.
+
+    static void yearsDiff(double                   *result,
+                          const bdlt::Date         *beginDates,
+                          const bdlt::Date         *endDates,
+                          int                       numPairs,
+                          DayCountConvention::Enum  convention);
+        // Load, into each of the specified 'numPairs' elements of the
+        // specified 'result' array, the (signed fractional) number of years
+        // between the corresponding elements of the specified 'beginDates'
+        // and 'endDates' arrays according to the specified day-count
+        // 'convention'; i.e.,
+        // 'result[i] = yearsDiff(beginDates[i], endDates[i], convention)' for
+        // each 'i' in '[0 .. numPairs - 1]'.  The behavior is undefined unless
+        // 'isSupported(convention)', '0 <= numPairs', and each of 'result',
+        // 'beginDates', and 'endDates' refers to an array of at least
+        // 'numPairs' elements.
 };
 
 }  // close package namespace
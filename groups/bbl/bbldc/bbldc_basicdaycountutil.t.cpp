@@ -8,9 +8,11 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_cstdlib.h>     // 'atoi'
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -26,10 +28,13 @@ using namespace bsl;
 // functionality of these methods.
 // ----------------------------------------------------------------------------
 // [ 2] int daysDiff(beginDate, endDate, convention);
+// [ 4] void daysDiff(result, beginDates, endDates, numPairs, convention);
 // [ 1] bool isSupported(convention);
 // [ 3] double yearsDiff(beginDate, endDate, convention);
+// [ 4] void yearsDiff(result, beginDates, endDates, numPairs, convention);
 // ----------------------------------------------------------------------------
-// [ 4] USAGE EXAMPLE
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: BATCH DAY COUNTS
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -106,6 +111,58 @@ const Enum PSA_30_360_EOM     = bbldc::DayCountConvention::e_PSA_30_360_EOM;
 const Enum SIA_30_360_EOM     = bbldc::DayCountConvention::e_SIA_30_360_EOM;
 const Enum SIA_30_360_NEOM    = bbldc::DayCountConvention::e_SIA_30_360_NEOM;
 
+const Enum CONVENTIONS[] = { ACTUAL_360,
+                             ACTUAL_365_FIXED,
+                             ISDA_30_360_EOM,
+                             ISDA_ACTUAL_ACTUAL,
+                             ISMA_30_360,
+                             NL_365,
+                             PSA_30_360_EOM,
+                             SIA_30_360_EOM,
+                             SIA_30_360_NEOM };
+const int  NUM_CONVENTIONS = static_cast<int>(sizeof CONVENTIONS
+                                              / sizeof *CONVENTIONS);
+
+// ============================================================================
+//                          TEST UTILITY FUNCTIONS
+// ----------------------------------------------------------------------------
+
+void loadDatePairs(bsl::vector<bdlt::Date> *beginDates,
+                   bsl::vector<bdlt::Date> *endDates,
+                   int                      numPairs)
+    // Load, into the specified 'beginDates' and 'endDates', the specified
+    // 'numPairs' pseudo-random dates between 1990 and 2060, with the end date
+    // both before and after the begin date, and emphasizing month ends.
+{
+    beginDates->clear();
+    endDates->clear();
+
+    const bdlt::Date origin(1990, 1, 1);
+
+    unsigned int seed = 20260101;
+    for (int i = 0; i < numPairs; ++i) {
+        seed = seed * 1103515245 + 12345;
+        const int begin = static_cast<int>((seed >> 4) % 25000);
+        seed = seed * 1103515245 + 12345;
+        const int span  = static_cast<int>((seed >> 4) % 4000) - 500;
+
+        bdlt::Date beginDate = origin + begin;
+        bdlt::Date endDate   = beginDate + span;
+        if (0 == i % 3) {
+            // Move the end date to the end of its month.
+
+            endDate.setYearMonthDay(endDate.year(),
+                                    endDate.month(),
+                                    1);
+            endDate += 31;
+            endDate.setYearMonthDay(endDate.year(), endDate.month(), 1);
+            endDate -= 1;
+        }
+        beginDates->push_back(beginDate);
+        endDates->push_back(endDate);
+    }
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -119,7 +176,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 4: {
+      case 5: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -174,6 +231,121 @@ int main(int argc, char *argv[])
     ASSERT(0.1999 < yearsDiff && 0.2001 > yearsDiff);
 //..
       } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH 'daysDiff' AND 'yearsDiff'
+        //   Verify the array overloads compute, for every supported
+        //   convention, the same results as the single-pair overloads.
+        //
+        // Concerns:
+        //: 1 For every supported convention, each element loaded by the
+        //:   batch 'daysDiff' equals the result of the single-pair 'daysDiff'
+        //:   for the corresponding dates.
+        //:
+        //: 2 For every supported convention, each element loaded by the
+        //:   batch 'yearsDiff' is bitwise equal to the result of the
+        //:   single-pair 'yearsDiff' for the corresponding dates.
+        //:
+        //: 3 No element of 'result' beyond 'numPairs' is modified, and
+        //:   'numPairs == 0' is supported.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each supported convention, and for a series of array lengths
+        //:   (including 0 and lengths that are not multiples of typical vector
+        //:   widths), compute the batch results over pseudo-random date pairs
+        //:   into an array with a sentinel element past the end, and compare
+        //:   each result with the single-pair result.  (C-1..3)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-4)
+        //
+        // Testing:
+        //   void daysDiff(result, beginDates, endDates, numPairs, conv);
+        //   void yearsDiff(result, beginDates, endDates, numPairs, conv);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                         << endl
+                         << "TESTING BATCH 'daysDiff' AND 'yearsDiff'" << endl
+                         << "========================================" << endl;
+
+        static const int LENGTHS[] = { 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17,
+                                       1000 };
+        const int NUM_LENGTHS = static_cast<int>(sizeof LENGTHS
+                                                 / sizeof *LENGTHS);
+
+        bsl::vector<bdlt::Date> beginDates;
+        bsl::vector<bdlt::Date> endDates;
+        loadDatePairs(&beginDates, &endDates, 1000);
+
+        for (int ci = 0; ci < NUM_CONVENTIONS; ++ci) {
+            const Enum CONV = CONVENTIONS[ci];
+
+            if (veryVerbose) { T_ P(CONV) }
+
+            for (int li = 0; li < NUM_LENGTHS; ++li) {
+                const int NUM_PAIRS = LENGTHS[li];
+
+                bsl::vector<int>    days(NUM_PAIRS + 1, -7);
+                bsl::vector<double> years(NUM_PAIRS + 1, -7.0);
+
+                Util::daysDiff(days.data(),
+                               beginDates.data(),
+                               endDates.data(),
+                               NUM_PAIRS,
+                               CONV);
+                Util::yearsDiff(years.data(),
+                                beginDates.data(),
+                                endDates.data(),
+                                NUM_PAIRS,
+                                CONV);
+
+                for (int i = 0; i < NUM_PAIRS; ++i) {
+                    const bdlt::Date& X = beginDates[i];
+                    const bdlt::Date& Y = endDates[i];
+
+                    const int    EXP_DAYS  = Util::daysDiff(X, Y, CONV);
+                    const double EXP_YEARS = Util::yearsDiff(X, Y, CONV);
+
+                    ASSERTV(CONV, i, X, Y, EXP_DAYS, days[i],
+                            EXP_DAYS == days[i]);
+                    ASSERTV(CONV, i, X, Y, EXP_YEARS, years[i],
+                            EXP_YEARS == years[i]);
+                }
+                ASSERTV(CONV, NUM_PAIRS, -7   == days[NUM_PAIRS]);
+                ASSERTV(CONV, NUM_PAIRS, -7.0 == years[NUM_PAIRS]);
+            }
+        }
+
+        { // negative testing
+            bsls::AssertTestHandlerGuard hG;
+
+            int              days[1];
+            double           years[1];
+            const bdlt::Date DATE(2012, 1, 1);
+
+            ASSERT_PASS(Util::daysDiff(days, &DATE, &DATE, 1, ACTUAL_360));
+            ASSERT_PASS(Util::daysDiff(0, 0, 0, 0, ACTUAL_360));
+            ASSERT_FAIL(Util::daysDiff(days, &DATE, &DATE, -1, ACTUAL_360));
+            ASSERT_FAIL(Util::daysDiff(0, &DATE, &DATE, 1, ACTUAL_360));
+            ASSERT_OPT_FAIL(Util::daysDiff(days,
+                                           &DATE,
+                                           &DATE,
+                                           1,
+                                           INVALID_CONVENTION));
+
+            ASSERT_PASS(Util::yearsDiff(years, &DATE, &DATE, 1, ACTUAL_360));
+            ASSERT_PASS(Util::yearsDiff(0, 0, 0, 0, ACTUAL_360));
+            ASSERT_FAIL(Util::yearsDiff(years, &DATE, &DATE, -1, ACTUAL_360));
+            ASSERT_FAIL(Util::yearsDiff(years, 0, &DATE, 1, ACTUAL_360));
+            ASSERT_OPT_FAIL(Util::yearsDiff(years,
+                                            &DATE,
+                                            &DATE,
+                                            1,
+                                            INVALID_CONVENTION));
+        }
+      } break;
       case 3: {
         // --------------------------------------------------------------------
         // TESTING 'yearsDiff'
@@ -542,6 +714,100 @@ int main(int argc, char *argv[])
                    == Util::isSupported(convention));
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: BATCH DAY COUNTS
+        //   Compare, for each supported convention, the cost of computing day
+        //   counts and year fractions one pair at a time with that of the
+        //   batch overloads.
+        //
+        // Concerns:
+        //: 1 The batch overloads are no slower than repeated single-pair
+        //:   calls, and are substantially faster for the actual-day
+        //:   conventions.
+        //
+        // Plan:
+        //: 1 For each convention, time both forms over the same array of date
+        //:   pairs and report the average cost per pair.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: BATCH DAY COUNTS
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: BATCH DAY COUNTS" << endl
+             << "=============================" << endl;
+
+        const int NUM_PAIRS      = 100000;
+        const int NUM_ITERATIONS = 20;
+
+        bsl::vector<bdlt::Date> beginDates;
+        bsl::vector<bdlt::Date> endDates;
+        loadDatePairs(&beginDates, &endDates, NUM_PAIRS);
+
+        bsl::vector<int>    days(NUM_PAIRS);
+        bsl::vector<double> years(NUM_PAIRS);
+
+        for (int ci = 0; ci < NUM_CONVENTIONS; ++ci) {
+            const Enum CONV = CONVENTIONS[ci];
+
+            double          elapsed[4];
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (int j = 0; j < NUM_ITERATIONS; ++j) {
+                for (int i = 0; i < NUM_PAIRS; ++i) {
+                    days[i] = Util::daysDiff(beginDates[i], endDates[i], CONV);
+                }
+            }
+            timer.stop();
+            elapsed[0] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int j = 0; j < NUM_ITERATIONS; ++j) {
+                Util::daysDiff(days.data(),
+                               beginDates.data(),
+                               endDates.data(),
+                               NUM_PAIRS,
+                               CONV);
+            }
+            timer.stop();
+            elapsed[1] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int j = 0; j < NUM_ITERATIONS; ++j) {
+                for (int i = 0; i < NUM_PAIRS; ++i) {
+                    years[i] = Util::yearsDiff(beginDates[i],
+                                               endDates[i],
+                                               CONV);
+                }
+            }
+            timer.stop();
+            elapsed[2] = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int j = 0; j < NUM_ITERATIONS; ++j) {
+                Util::yearsDiff(years.data(),
+                                beginDates.data(),
+                                endDates.data(),
+                                NUM_PAIRS,
+                                CONV);
+            }
+            timer.stop();
+            elapsed[3] = timer.elapsedTime();
+
+            const double SCALE = 1.0e9 / NUM_ITERATIONS / NUM_PAIRS;
+
+            cout << CONV << ":" << endl
+                 << "\tdaysDiff  (ns/pair): single " << elapsed[0] * SCALE
+                 << ", batch " << elapsed[1] * SCALE << endl
+                 << "\tyearsDiff (ns/pair): single " << elapsed[2] * SCALE
+                 << ", batch " << elapsed[3] * SCALE << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT == FOUND." << endl;
         testStatus = -1;
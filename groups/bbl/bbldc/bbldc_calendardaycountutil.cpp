@@ -44,6 +44,35 @@ int CalendarDayCountUtil::daysDiff(const bdlt::Date&        beginDate,
     return numDays;
 }
 
+void CalendarDayCountUtil::daysDiff(int                      *result,
+                                    const bdlt::Date         *beginDates,
+                                    const bdlt::Date         *endDates,
+                                    int                       numPairs,
+                                    const bdlt::Calendar&     calendar,
+                                    DayCountConvention::Enum  convention)
+{
+    BSLS_ASSERT(0 <= numPairs);
+    BSLS_ASSERT(result     || 0 == numPairs);
+    BSLS_ASSERT(beginDates || 0 == numPairs);
+    BSLS_ASSERT(endDates   || 0 == numPairs);
+
+    switch (convention) {
+      case DayCountConvention::e_CALENDAR_BUS_252: {
+        for (int i = 0; i < numPairs; ++i) {
+            BSLS_ASSERT(calendar.isInRange(beginDates[i]));
+            BSLS_ASSERT(calendar.isInRange(endDates[i]));
+
+            result[i] = bbldc::CalendarBus252::daysDiff(beginDates[i],
+                                                        endDates[i],
+                                                        calendar);
+        }
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+      } break;
+    }
+}
+
 bool CalendarDayCountUtil::isSupported(DayCountConvention::Enum convention)
 {
     bool rv = true;
@@ -84,6 +113,35 @@ double CalendarDayCountUtil::yearsDiff(const bdlt::Date&        beginDate,
     return numYears;
 }
 
+void CalendarDayCountUtil::yearsDiff(double                   *result,
+                                     const bdlt::Date         *beginDates,
+                                     const bdlt::Date         *endDates,
+                                     int                       numPairs,
+                                     const bdlt::Calendar&     calendar,
+                                     DayCountConvention::Enum  convention)
+{
+    BSLS_ASSERT(0 <= numPairs);
+    BSLS_ASSERT(result     || 0 == numPairs);
+    BSLS_ASSERT(beginDates || 0 == numPairs);
+    BSLS_ASSERT(endDates   || 0 == numPairs);
+
+    switch (convention) {
+      case DayCountConvention::e_CALENDAR_BUS_252: {
+        for (int i = 0; i < numPairs; ++i) {
+            BSLS_ASSERT(calendar.isInRange(beginDates[i]));
+            BSLS_ASSERT(calendar.isInRange(endDates[i]));
+
+            result[i] = bbldc::CalendarBus252::yearsDiff(beginDates[i],
+                                                         endDates[i],
+                                                         calendar);
+        }
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+      } break;
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
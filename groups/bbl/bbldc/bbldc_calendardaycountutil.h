@@ -20,6 +20,15 @@ BSLS_IDENT("$Id: $")
 // 'bbldc::CalendarDayCountUtil' take a trailing 'DayCountConvention::Enum'
 // argument indicating which particular day-count convention to apply.
 //
+///Batch Computation
+///-----------------
+// Overloads of 'daysDiff' and 'yearsDiff' taking arrays of begin and end dates
+// compute the day counts or year fractions of many date pairs, all measured
+// against the same calendar, in one call.  These overloads select the
+// implementation for the convention once, and then evaluate every pair in a
+// single loop.  The results are identical to those obtained by calling the
+// single-pair overloads for each pair.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -95,6 +104,24 @@ struct CalendarDayCountUtil {
         // Note that reversing the order of 'beginDate' and 'endDate' negates
         // the result and that the result is 0 when 'beginDate == endDate'.
 
+    static void daysDiff(int                      *result,
+                         const bdlt::Date         *beginDates,
+                         const bdlt::Date         *endDates,
+                         int                       numPairs,
+                         const bdlt::Calendar&     calendar,
+                         DayCountConvention::Enum  convention);
+        // Load, into each of the specified 'numPairs' elements of the
+        // specified 'result' array, the (signed) number of days between the
+        // corresponding elements of the specified 'beginDates' and 'endDates'
+        // arrays according to the specified day-count 'convention' with the
+        // specified 'calendar' providing the definition of business days;
+        // i.e., 'result[i] = daysDiff(beginDates[i], endDates[i], calendar,
+        // convention)' for each 'i' in '[0 .. numPairs - 1]'.  The behavior is
+        // undefined unless 'isSupported(convention)', '0 <= numPairs', each of
+        // 'result', 'beginDates', and 'endDates' refers to an array of at
+        // least 'numPairs' elements, and every date in those elements of
+        // 'beginDates' and 'endDates' is in the range of 'calendar'.
+
     static bool isSupported(DayCountConvention::Enum convention);
         // Return 'true' if the specified 'convention' is valid for use in
         // 'daysDiff' and 'yearsDiff', and 'false' otherwise.
@@ -114,6 +141,25 @@ struct CalendarDayCountUtil {
         // '|yearsDiff(b, e, cal, c) + yearsDiff(e, b, cal, c)| <= 1.0e-15' for
         // all calendars 'cal', valid dates 'b' and 'e', and day-count
         // conventions 'c'.
+
+    static void yearsDiff(double                   *result,
+                          const bdlt::Date         *beginDates,
+                          const bdlt::Date         *endDates,
+                          int                       numPairs,
+                          const bdlt::Calendar&     calendar,
+                          DayCountConvention::Enum  convention);
+        // Load, into each of the specified 'numPairs' elements of the
+        // specified 'result' array, the (signed fractional) number of years
+        // between the corresponding elements of the specified 'beginDates'
+        // and 'endDates' arrays according to the specified day-count
+        // 'convention' with the specified 'calendar' providing the definition
+        // of business days; i.e., 'result[i] = yearsDiff(beginDates[i],
+        // endDates[i], calendar, convention)' for each 'i' in
+        // '[0 .. numPairs - 1]'.  The behavior is undefined unless
+        // 'isSupported(convention)', '0 <= numPairs', each of 'result',
+        // 'beginDates', and 'endDates' refers to an array of at least
+        // 'numPairs' elements, and every date in those elements of
+        // 'beginDates' and 'endDates' is in the range of 'calendar'.
 };
 
 }  // close package namespace
@@ -9,9 +9,11 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_cstdlib.h>     // 'atoi'
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -27,10 +29,13 @@ using namespace bsl;
 // functionality of these methods.
 // ----------------------------------------------------------------------------
 // [ 2] int daysDiff(beginDate, endDate, calendar, convention);
+// [ 4] void daysDiff(result, begins, ends, numPairs, calendar, convention);
 // [ 1] bool isSupported(convention);
 // [ 3] double yearsDiff(beginDate, endDate, calendar, convention);
+// [ 4] void yearsDiff(result, begins, ends, numPairs, calendar, convention);
 // ----------------------------------------------------------------------------
-// [ 4] USAGE EXAMPLE
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: BATCH DAY COUNTS
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -97,6 +102,50 @@ typedef bbldc::DayCountConvention::Enum Enum;
 
 const Enum CALENDAR_BUS_252 = bbldc::DayCountConvention::e_CALENDAR_BUS_252;
 
+// ============================================================================
+//                       GLOBAL FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+void loadCalendar(bdlt::Calendar *calendar, int firstYear, int lastYear)
+    // Load, into the specified 'calendar', a valid range from the start of
+    // the specified 'firstYear' to the end of the specified 'lastYear', with
+    // Saturday and Sunday as weekend days and a few holidays in each year.
+{
+    calendar->removeAll();
+    calendar->setValidRange(bdlt::Date(firstYear,  1,  1),
+                            bdlt::Date(lastYear,  12, 31));
+    calendar->addWeekendDay(bdlt::DayOfWeek::e_SAT);
+    calendar->addWeekendDay(bdlt::DayOfWeek::e_SUN);
+    for (int year = firstYear; year <= lastYear; ++year) {
+        calendar->addHoliday(bdlt::Date(year,  1,  1));
+        calendar->addHoliday(bdlt::Date(year,  7,  4));
+        calendar->addHoliday(bdlt::Date(year, 12, 25));
+    }
+}
+
+void loadDatePairs(bsl::vector<bdlt::Date> *beginDates,
+                   bsl::vector<bdlt::Date> *endDates,
+                   int                      numPairs,
+                   const bdlt::Date&        firstDate,
+                   int                      numDays)
+    // Load, into the specified 'beginDates' and 'endDates', the specified
+    // 'numPairs' pseudo-random dates in the range starting at the specified
+    // 'firstDate' and having the specified 'numDays' days.
+{
+    beginDates->clear();
+    endDates->clear();
+
+    unsigned int seed = 20260101;
+    for (int i = 0; i < numPairs; ++i) {
+        seed = seed * 1103515245 + 12345;
+        beginDates->push_back(firstDate + static_cast<int>((seed >> 4)
+                                                           % numDays));
+        seed = seed * 1103515245 + 12345;
+        endDates->push_back(firstDate + static_cast<int>((seed >> 4)
+                                                         % numDays));
+    }
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -124,7 +173,7 @@ int main(int argc, char *argv[])
     }
 
     switch (test) { case 0:
-      case 4: {
+      case 5: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -189,6 +238,173 @@ int main(int argc, char *argv[])
     ASSERT(0.2063 < yearsDiff && 0.2064 > yearsDiff);
 //..
       } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH 'daysDiff' AND 'yearsDiff'
+        //   Verify the array overloads compute the same results as the
+        //   single-pair overloads.
+        //
+        // Concerns:
+        //: 1 Each element loaded by the batch 'daysDiff' equals the result of
+        //:   the single-pair 'daysDiff' for the corresponding dates.
+        //:
+        //: 2 Each element loaded by the batch 'yearsDiff' is bitwise equal to
+        //:   the result of the single-pair 'yearsDiff' for the corresponding
+        //:   dates.
+        //:
+        //: 3 No element of 'result' beyond 'numPairs' is modified, and
+        //:   'numPairs == 0' is supported.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a series of array lengths (including 0), compute the batch
+        //:   results over pseudo-random date pairs within the range of a
+        //:   calendar into an array with a sentinel element past the end, and
+        //:   compare each result with the single-pair result.  (C-1..3)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-4)
+        //
+        // Testing:
+        //   void daysDiff(result, begins, ends, numPairs, calendar, conv);
+        //   void yearsDiff(result, begins, ends, numPairs, calendar, conv);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                         << endl
+                         << "TESTING BATCH 'daysDiff' AND 'yearsDiff'" << endl
+                         << "========================================" << endl;
+
+        bdlt::Calendar mX;  const bdlt::Calendar& X = mX;
+        loadCalendar(&mX, 2000, 2030);
+
+        bsl::vector<bdlt::Date> beginDates;
+        bsl::vector<bdlt::Date> endDates;
+        loadDatePairs(&beginDates,
+                      &endDates,
+                      500,
+                      X.firstDate(),
+                      X.length());
+
+        static const int LENGTHS[] = { 0, 1, 2, 3, 4, 5, 7, 8, 9, 500 };
+        const int NUM_LENGTHS = static_cast<int>(sizeof LENGTHS
+                                                 / sizeof *LENGTHS);
+
+        for (int li = 0; li < NUM_LENGTHS; ++li) {
+            const int NUM_PAIRS = LENGTHS[li];
+
+            if (veryVerbose) { T_ P(NUM_PAIRS) }
+
+            bsl::vector<int>    days(NUM_PAIRS + 1, -7);
+            bsl::vector<double> years(NUM_PAIRS + 1, -7.0);
+
+            Util::daysDiff(days.data(),
+                           beginDates.data(),
+                           endDates.data(),
+                           NUM_PAIRS,
+                           X,
+                           CALENDAR_BUS_252);
+            Util::yearsDiff(years.data(),
+                            beginDates.data(),
+                            endDates.data(),
+                            NUM_PAIRS,
+                            X,
+                            CALENDAR_BUS_252);
+
+            for (int i = 0; i < NUM_PAIRS; ++i) {
+                const int    EXP_DAYS  = Util::daysDiff(beginDates[i],
+                                                        endDates[i],
+                                                        X,
+                                                        CALENDAR_BUS_252);
+                const double EXP_YEARS = Util::yearsDiff(beginDates[i],
+                                                         endDates[i],
+                                                         X,
+                                                         CALENDAR_BUS_252);
+
+                ASSERTV(NUM_PAIRS, i, EXP_DAYS, days[i],
+                        EXP_DAYS == days[i]);
+                ASSERTV(NUM_PAIRS, i, EXP_YEARS, years[i],
+                        EXP_YEARS == years[i]);
+            }
+            ASSERTV(NUM_PAIRS, -7   == days[NUM_PAIRS]);
+            ASSERTV(NUM_PAIRS, -7.0 == years[NUM_PAIRS]);
+        }
+
+        { // negative testing
+            bsls::AssertTestHandlerGuard hG;
+
+            int              days[1];
+            double           years[1];
+            const bdlt::Date DATE(2012, 1, 1);
+            const bdlt::Date EARLY(1999, 1, 1);
+
+            const Enum INVALID = static_cast<Enum>(-1);
+
+            ASSERT_PASS(Util::daysDiff(days,
+                                       &DATE,
+                                       &DATE,
+                                       1,
+                                       X,
+                                       CALENDAR_BUS_252));
+            ASSERT_PASS(Util::daysDiff(0, 0, 0, 0, X, CALENDAR_BUS_252));
+            ASSERT_FAIL(Util::daysDiff(days,
+                                       &DATE,
+                                       &DATE,
+                                       -1,
+                                       X,
+                                       CALENDAR_BUS_252));
+            ASSERT_FAIL(Util::daysDiff(days,
+                                       &EARLY,
+                                       &DATE,
+                                       1,
+                                       X,
+                                       CALENDAR_BUS_252));
+            ASSERT_FAIL(Util::daysDiff(days,
+                                       &DATE,
+                                       &EARLY,
+                                       1,
+                                       X,
+                                       CALENDAR_BUS_252));
+            ASSERT_OPT_FAIL(Util::daysDiff(days,
+                                           &DATE,
+                                           &DATE,
+                                           1,
+                                           X,
+                                           INVALID));
+
+            ASSERT_PASS(Util::yearsDiff(years,
+                                        &DATE,
+                                        &DATE,
+                                        1,
+                                        X,
+                                        CALENDAR_BUS_252));
+            ASSERT_PASS(Util::yearsDiff(0, 0, 0, 0, X, CALENDAR_BUS_252));
+            ASSERT_FAIL(Util::yearsDiff(years,
+                                        &DATE,
+                                        &DATE,
+                                        -1,
+                                        X,
+                                        CALENDAR_BUS_252));
+            ASSERT_FAIL(Util::yearsDiff(years,
+                                        &EARLY,
+                                        &DATE,
+                                        1,
+                                        X,
+                                        CALENDAR_BUS_252));
+            ASSERT_FAIL(Util::yearsDiff(0,
+                                        &DATE,
+                                        &DATE,
+                                        1,
+                                        X,
+                                        CALENDAR_BUS_252));
+            ASSERT_OPT_FAIL(Util::yearsDiff(years,
+                                            &DATE,
+                                            &DATE,
+                                            1,
+                                            X,
+                                            INVALID));
+        }
+      } break;
       case 3: {
         // --------------------------------------------------------------------
         // TESTING 'yearsDiff'
@@ -523,6 +739,110 @@ int main(int argc, char *argv[])
                 == Util::isSupported(convention));
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: BATCH DAY COUNTS
+        //   Compare, for each supported convention, the cost of computing day
+        //   counts and year fractions one pair at a time with that of the
+        //   batch overloads.
+        //
+        // Concerns:
+        //: 1 The batch overloads are no slower than repeated single-pair
+        //:   calls.
+        //
+        // Plan:
+        //: 1 Time both forms over the same array of date pairs and report the
+        //:   average cost per pair.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: BATCH DAY COUNTS
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: BATCH DAY COUNTS" << endl
+             << "=============================" << endl;
+
+        const int NUM_PAIRS      = 100000;
+        const int NUM_ITERATIONS = 20;
+
+        bdlt::Calendar calendar;
+        loadCalendar(&calendar, 2000, 2030);
+
+        bsl::vector<bdlt::Date> beginDates;
+        bsl::vector<bdlt::Date> endDates;
+        loadDatePairs(&beginDates,
+                      &endDates,
+                      NUM_PAIRS,
+                      calendar.firstDate(),
+                      calendar.length());
+
+        bsl::vector<int>    days(NUM_PAIRS);
+        bsl::vector<double> years(NUM_PAIRS);
+
+        const Enum CONV = CALENDAR_BUS_252;
+
+        double          elapsed[4];
+        bsls::Stopwatch timer;
+
+        timer.start();
+        for (int j = 0; j < NUM_ITERATIONS; ++j) {
+            for (int i = 0; i < NUM_PAIRS; ++i) {
+                days[i] = Util::daysDiff(beginDates[i],
+                                         endDates[i],
+                                         calendar,
+                                         CONV);
+            }
+        }
+        timer.stop();
+        elapsed[0] = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int j = 0; j < NUM_ITERATIONS; ++j) {
+            Util::daysDiff(days.data(),
+                           beginDates.data(),
+                           endDates.data(),
+                           NUM_PAIRS,
+                           calendar,
+                           CONV);
+        }
+        timer.stop();
+        elapsed[1] = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int j = 0; j < NUM_ITERATIONS; ++j) {
+            for (int i = 0; i < NUM_PAIRS; ++i) {
+                years[i] = Util::yearsDiff(beginDates[i],
+                                           endDates[i],
+                                           calendar,
+                                           CONV);
+            }
+        }
+        timer.stop();
+        elapsed[2] = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int j = 0; j < NUM_ITERATIONS; ++j) {
+            Util::yearsDiff(years.data(),
+                            beginDates.data(),
+                            endDates.data(),
+                            NUM_PAIRS,
+                            calendar,
+                            CONV);
+        }
+        timer.stop();
+        elapsed[3] = timer.elapsedTime();
+
+        const double SCALE = 1.0e9 / NUM_ITERATIONS / NUM_PAIRS;
+
+        cout << CONV << ":" << endl
+             << "\tdaysDiff  (ns/pair): single " << elapsed[0] * SCALE
+             << ", batch " << elapsed[1] * SCALE << endl
+             << "\tyearsDiff (ns/pair): single " << elapsed[2] * SCALE
+             << ", batch " << elapsed[3] * SCALE << endl;
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT == FOUND." << endl;
         testStatus = -1;
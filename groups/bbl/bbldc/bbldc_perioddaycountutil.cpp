@@ -76,6 +76,51 @@ double PeriodDayCountUtil::yearsDiffImp(
     return numYears;
 }
 
+void PeriodDayCountUtil::yearsDiffImp(
+                                     double                   *result,
+                                     const bdlt::Date         *beginDates,
+                                     const bdlt::Date         *endDates,
+                                     int                       numPairs,
+                                     const bdlt::Date         *periodDateBegin,
+                                     const bdlt::Date         *periodDateEnd,
+                                     double                    periodYearDiff,
+                                     DayCountConvention::Enum  convention)
+{
+    BSLS_ASSERT(0 <= numPairs);
+    BSLS_ASSERT(result     || 0 == numPairs);
+    BSLS_ASSERT(beginDates || 0 == numPairs);
+    BSLS_ASSERT(endDates   || 0 == numPairs);
+    BSLS_ASSERT(2 <= periodDateEnd - periodDateBegin);
+
+    BSLS_ASSERT_SAFE(isSortedAndUnique(periodDateBegin, periodDateEnd));
+
+    switch (convention) {
+      case DayCountConvention::e_PERIOD_ICMA_ACTUAL_ACTUAL: {
+        for (int i = 0; i < numPairs; ++i) {
+            BSLS_ASSERT(*periodDateBegin <= beginDates[i]);
+            BSLS_ASSERT(                    beginDates[i] <=
+                                                       *(periodDateEnd - 1));
+            BSLS_ASSERT(*periodDateBegin <= endDates[i]);
+            BSLS_ASSERT(                    endDates[i]   <=
+                                                       *(periodDateEnd - 1));
+
+            // The period dates were verified to be sorted and unique above,
+            // so skip repeating that (linear) check for every pair.
+
+            result[i] = bbldc::PeriodIcmaActualActual_ImpUtil::yearsDiff(
+                                                              beginDates[i],
+                                                              endDates[i],
+                                                              periodDateBegin,
+                                                              periodDateEnd,
+                                                              periodYearDiff);
+        }
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+      } break;
+    }
+}
+
 // CLASS METHODS
 int PeriodDayCountUtil::daysDiff(const bdlt::Date&        beginDate,
                                  const bdlt::Date&        endDate,
@@ -96,6 +141,30 @@ int PeriodDayCountUtil::daysDiff(const bdlt::Date&        beginDate,
     return numDays;
 }
 
+void PeriodDayCountUtil::daysDiff(int                      *result,
+                                  const bdlt::Date         *beginDates,
+                                  const bdlt::Date         *endDates,
+                                  int                       numPairs,
+                                  DayCountConvention::Enum  convention)
+{
+    BSLS_ASSERT(0 <= numPairs);
+    BSLS_ASSERT(result     || 0 == numPairs);
+    BSLS_ASSERT(beginDates || 0 == numPairs);
+    BSLS_ASSERT(endDates   || 0 == numPairs);
+
+    switch (convention) {
+      case DayCountConvention::e_PERIOD_ICMA_ACTUAL_ACTUAL: {
+        for (int i = 0; i < numPairs; ++i) {
+            result[i] = bbldc::PeriodIcmaActualActual::daysDiff(beginDates[i],
+                                                                endDates[i]);
+        }
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+      } break;
+    }
+}
+
 bool PeriodDayCountUtil::isSupported(DayCountConvention::Enum convention)
 {
     bool rv = true;
@@ -20,6 +20,15 @@ BSLS_IDENT("$Id: $")
 // take a trailing 'DayCountConvention::Enum' argument indicating which
 // particular period-based day-count convention to apply.
 //
+///Batch Computation
+///-----------------
+// Overloads of 'daysDiff' and 'yearsDiff' taking arrays of begin and end dates
+// compute the day counts or year fractions of many date pairs, all measured
+// against the same period dates, in one call.  These overloads select the
+// implementation for the convention, and validate the period dates, once, and
+// then evaluate every pair in a single loop.  The results are identical to
+// those obtained by calling the single-pair overloads for each pair.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -113,6 +122,26 @@ struct PeriodDayCountUtil {
         // all dates 'b' and 'e', periods 'pd', and year fraction per period
         // 'pyd'.
 
+    static void yearsDiffImp(double                   *result,
+                             const bdlt::Date         *beginDates,
+                             const bdlt::Date         *endDates,
+                             int                       numPairs,
+                             const bdlt::Date         *periodDateBegin,
+                             const bdlt::Date         *periodDateEnd,
+                             double                    periodYearDiff,
+                             DayCountConvention::Enum  convention);
+        // Load, into each of the specified 'numPairs' elements of the
+        // specified 'result' array, the (signed fractional) number of years
+        // between the corresponding elements of the specified 'beginDates'
+        // and 'endDates' arrays according to the specified day-count
+        // 'convention' with periods starting on the specified range
+        // '[ periodDateBegin, periodDateEnd )' values and each period having a
+        // duration of the specified 'periodYearDiff' years.  The behavior is
+        // undefined unless '0 <= numPairs', each of 'result', 'beginDates',
+        // and 'endDates' refers to an array of at least 'numPairs' elements,
+        // and, for each pair of dates, the preconditions of the single-pair
+        // 'yearsDiffImp' are satisfied.
+
   public:
     // CLASS METHODS
     static int daysDiff(const bdlt::Date&        beginDate,
@@ -124,6 +153,21 @@ struct PeriodDayCountUtil {
         // behavior is undefined unless 'isSupported(convention)'.  Note that
         // reversing the order of 'beginDate' and 'endDate' negates the result.
 
+    static void daysDiff(int                      *result,
+                         const bdlt::Date         *beginDates,
+                         const bdlt::Date         *endDates,
+                         int                       numPairs,
+                         DayCountConvention::Enum  convention);
+        // Load, into each of the specified 'numPairs' elements of the
+        // specified 'result' array, the (signed) number of days between the
+        // corresponding elements of the specified 'beginDates' and 'endDates'
+        // arrays according to the specified day-count 'convention'; i.e.,
+        // 'result[i] = daysDiff(beginDates[i], endDates[i], convention)' for
+        // each 'i' in '[0 .. numPairs - 1]'.  The behavior is undefined unless
+        // 'isSupported(convention)', '0 <= numPairs', and each of 'result',
+        // 'beginDates', and 'endDates' refers to an array of at least
+        // 'numPairs' elements.
+
     static bool isSupported(DayCountConvention::Enum convention);
         // Return 'true' if the specified 'convention' is valid for use in
         // 'daysDiff' and 'yearsDiff', and 'false' otherwise.
@@ -160,6 +204,46 @@ struct PeriodDayCountUtil {
         // '|yearsDiff(b,e,pd,pyd,c) + yearsDiff(e,b,pd,pyd,c)| <= 1.0e-15' for
         // all dates 'b' and 'e', periods 'pd', and year fraction per period
         // 'pyd'.
+
+    static void yearsDiff(double                              *result,
+                          const bdlt::Date                    *beginDates,
+                          const bdlt::Date                    *endDates,
+                          int                                  numPairs,
+                          const bsl::vector<bdlt::Date>&       periodDate,
+                          double                               periodYearDiff,
+                          DayCountConvention::Enum             convention);
+    static void yearsDiff(double                              *result,
+                          const bdlt::Date                    *beginDates,
+                          const bdlt::Date                    *endDates,
+                          int                                  numPairs,
+                          const std::vector<bdlt::Date>&       periodDate,
+                          double                               periodYearDiff,
+                          DayCountConvention::Enum             convention);
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP17_PMR
+    static void yearsDiff(double                              *result,
+                          const bdlt::Date                    *beginDates,
+                          const bdlt::Date                    *endDates,
+                          int                                  numPairs,
+                          const std::pmr::vector<bdlt::Date>&  periodDate,
+                          double                               periodYearDiff,
+                          DayCountConvention::Enum             convention);
+#endif
+        // Load, into each of the specified 'numPairs' elements of the
+        // specified 'result' array, the (signed fractional) number of years
+        // between the corresponding elements of the specified 'beginDates'
+        // and 'endDates' arrays according to the specified day-count
+        // 'convention' with periods starting on the specified 'periodDate'
+        // values and each period having a duration of the specified
+        // 'periodYearDiff' years; i.e., 'result[i] = yearsDiff(beginDates[i],
+        // endDates[i], periodDate, periodYearDiff, convention)' for each 'i'
+        // in '[0 .. numPairs - 1]'.  The behavior is undefined unless
+        // '0 <= numPairs', each of 'result', 'beginDates', and 'endDates'
+        // refers to an array of at least 'numPairs' elements,
+        // 'periodDate.size() >= 2', the values contained in 'periodDate' are
+        // unique and sorted from minimum to maximum, every date in those
+        // elements of 'beginDates' and 'endDates' is in the range
+        // '[ periodDate.front(), periodDate.back() ]', and
+        // 'isSupported(convention)'.
 };
 
 // ============================================================================
@@ -230,6 +314,74 @@ double PeriodDayCountUtil::yearsDiff(
 }
 #endif
 
+inline
+void PeriodDayCountUtil::yearsDiff(
+                                 double                        *result,
+                                 const bdlt::Date              *beginDates,
+                                 const bdlt::Date              *endDates,
+                                 int                            numPairs,
+                                 const bsl::vector<bdlt::Date>& periodDate,
+                                 double                         periodYearDiff,
+                                 DayCountConvention::Enum       convention)
+{
+    yearsDiffImp(result,
+                 beginDates,
+                 endDates,
+                 numPairs,
+                 periodDate.data(),
+                 periodDate.data() + periodDate.size(),
+                 periodYearDiff,
+                 convention);
+}
+
+inline
+void PeriodDayCountUtil::yearsDiff(
+                                 double                        *result,
+                                 const bdlt::Date              *beginDates,
+                                 const bdlt::Date              *endDates,
+                                 int                            numPairs,
+                                 const std::vector<bdlt::Date>& periodDate,
+                                 double                         periodYearDiff,
+                                 DayCountConvention::Enum       convention)
+{
+    // Some implmentations of 'std::vector', notably Aix and Solaris, do not
+    // provide the 'data' accessor.
+
+    const bdlt::Date *begin = periodDate.empty() ? 0 : &*periodDate.begin();
+    const bdlt::Date *end   = begin + periodDate.size();
+
+    yearsDiffImp(result,
+                 beginDates,
+                 endDates,
+                 numPairs,
+                 begin,
+                 end,
+                 periodYearDiff,
+                 convention);
+}
+
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP17_PMR
+inline
+void PeriodDayCountUtil::yearsDiff(
+                            double                             *result,
+                            const bdlt::Date                   *beginDates,
+                            const bdlt::Date                   *endDates,
+                            int                                 numPairs,
+                            const std::pmr::vector<bdlt::Date>& periodDate,
+                            double                              periodYearDiff,
+                            DayCountConvention::Enum            convention)
+{
+    yearsDiffImp(result,
+                 beginDates,
+                 endDates,
+                 numPairs,
+                 periodDate.data(),
+                 periodDate.data() + periodDate.size(),
+                 periodYearDiff,
+                 convention);
+}
+#endif
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -8,6 +8,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_cstdlib.h>     // 'atoi'
 #include <bsl_iostream.h>
@@ -26,10 +27,13 @@ using namespace bsl;
 // functionality of these methods.
 // ----------------------------------------------------------------------------
 // [ 2] int daysDiff(beginDate, endDate, convention);
+// [ 4] void daysDiff(result, begins, ends, numPairs, convention);
 // [ 1] bool isSupported(convention);
 // [ 3] double yearsDiff(begin, end, periodDate, periodYearDiff, conv);
+// [ 4] void yearsDiff(result, begins, ends, n, pd, periodYearDiff, conv);
 // ----------------------------------------------------------------------------
-// [ 4] USAGE EXAMPLE
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: BATCH DAY COUNTS
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -134,6 +138,44 @@ bsl::ostream& operator<<(bsl::ostream& stream, VecType vecType)
     return stream;
 }
 
+void loadQuarterlyPeriods(bsl::vector<bdlt::Date> *periodDate,
+                          int                      firstYear,
+                          int                      lastYear)
+    // Load, into the specified 'periodDate', the quarterly period dates
+    // falling on the 15th of January, April, July, and October from the
+    // specified 'firstYear' through the specified 'lastYear'.
+{
+    periodDate->clear();
+    for (int year = firstYear; year <= lastYear; ++year) {
+        for (int month = 1; month <= 12; month += 3) {
+            periodDate->push_back(bdlt::Date(year, month, 15));
+        }
+    }
+}
+
+void loadDatePairs(bsl::vector<bdlt::Date> *beginDates,
+                   bsl::vector<bdlt::Date> *endDates,
+                   int                      numPairs,
+                   const bdlt::Date&        firstDate,
+                   int                      numDays)
+    // Load, into the specified 'beginDates' and 'endDates', the specified
+    // 'numPairs' pseudo-random dates in the range starting at the specified
+    // 'firstDate' and having the specified 'numDays' days.
+{
+    beginDates->clear();
+    endDates->clear();
+
+    unsigned int seed = 20260101;
+    for (int i = 0; i < numPairs; ++i) {
+        seed = seed * 1103515245 + 12345;
+        beginDates->push_back(firstDate + static_cast<int>((seed >> 4)
+                                                           % numDays));
+        seed = seed * 1103515245 + 12345;
+        endDates->push_back(firstDate + static_cast<int>((seed >> 4)
+                                                         % numDays));
+    }
+}
+
 double doubleAbort()
     // Call when a function returning a double is required, but you really
     // want undefined behavior
@@ -156,7 +198,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 4: {
+      case 5: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -220,6 +262,228 @@ int main(int argc, char *argv[])
     ASSERT(yearsDiff > 0.1983 && yearsDiff < 0.1985);
 //..
       } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH 'daysDiff' AND 'yearsDiff'
+        //   Verify the array overloads compute the same results as the
+        //   single-pair overloads.
+        //
+        // Concerns:
+        //: 1 Each element loaded by the batch 'daysDiff' equals the result of
+        //:   the single-pair 'daysDiff' for the corresponding dates.
+        //:
+        //: 2 Each element loaded by the batch 'yearsDiff' is bitwise equal to
+        //:   the result of the single-pair 'yearsDiff' for the corresponding
+        //:   dates, for each supported vector type of period dates.
+        //:
+        //: 3 No element of 'result' beyond 'numPairs' is modified, and
+        //:   'numPairs == 0' is supported.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a series of array lengths (including 0), compute the batch
+        //:   results over pseudo-random date pairs within a quarterly
+        //:   schedule into an array with a sentinel element past the end, and
+        //:   compare each result with the single-pair result.  (C-1..3)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-4)
+        //
+        // Testing:
+        //   void daysDiff(result, begins, ends, numPairs, convention);
+        //   void yearsDiff(result, begins, ends, n, pd, periodYearDiff, conv);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                         << endl
+                         << "TESTING BATCH 'daysDiff' AND 'yearsDiff'" << endl
+                         << "========================================" << endl;
+
+        BslVector mBslPeriods;  const BslVector& BSL_PERIODS = mBslPeriods;
+        loadQuarterlyPeriods(&mBslPeriods, 2000, 2030);
+
+        const StdVector STD_PERIODS(BSL_PERIODS.begin(), BSL_PERIODS.end());
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP17_PMR
+        const PmrVector PMR_PERIODS(BSL_PERIODS.begin(), BSL_PERIODS.end());
+#endif
+
+        bsl::vector<bdlt::Date> beginDates;
+        bsl::vector<bdlt::Date> endDates;
+        loadDatePairs(&beginDates,
+                      &endDates,
+                      500,
+                      BSL_PERIODS.front(),
+                      BSL_PERIODS.back() - BSL_PERIODS.front() + 1);
+
+        static const int LENGTHS[] = { 0, 1, 2, 3, 4, 5, 7, 8, 9, 500 };
+        const int NUM_LENGTHS = static_cast<int>(sizeof LENGTHS
+                                                 / sizeof *LENGTHS);
+
+        for (int li = 0; li < NUM_LENGTHS; ++li) {
+            const int NUM_PAIRS = LENGTHS[li];
+
+            if (veryVerbose) { T_ P(NUM_PAIRS) }
+
+            bsl::vector<int> days(NUM_PAIRS + 1, -7);
+
+            Util::daysDiff(days.data(),
+                           beginDates.data(),
+                           endDates.data(),
+                           NUM_PAIRS,
+                           PERIOD_ICMA_ACTUAL_ACTUAL);
+
+            for (int i = 0; i < NUM_PAIRS; ++i) {
+                const int EXP = Util::daysDiff(beginDates[i],
+                                               endDates[i],
+                                               PERIOD_ICMA_ACTUAL_ACTUAL);
+                ASSERTV(NUM_PAIRS, i, EXP, days[i], EXP == days[i]);
+            }
+            ASSERTV(NUM_PAIRS, -7 == days[NUM_PAIRS]);
+
+            for (int vt = e_BEGIN; vt < e_END; ++vt) {
+                const VecType VEC_TYPE = static_cast<VecType>(vt);
+
+                bsl::vector<double> years(NUM_PAIRS + 1, -7.0);
+
+                switch (VEC_TYPE) {
+                  case e_BSL: {
+                    Util::yearsDiff(years.data(),
+                                    beginDates.data(),
+                                    endDates.data(),
+                                    NUM_PAIRS,
+                                    BSL_PERIODS,
+                                    0.25,
+                                    PERIOD_ICMA_ACTUAL_ACTUAL);
+                  } break;
+                  case e_STD: {
+                    Util::yearsDiff(years.data(),
+                                    beginDates.data(),
+                                    endDates.data(),
+                                    NUM_PAIRS,
+                                    STD_PERIODS,
+                                    0.25,
+                                    PERIOD_ICMA_ACTUAL_ACTUAL);
+                  } break;
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP17_PMR
+                  case e_PMR: {
+                    Util::yearsDiff(years.data(),
+                                    beginDates.data(),
+                                    endDates.data(),
+                                    NUM_PAIRS,
+                                    PMR_PERIODS,
+                                    0.25,
+                                    PERIOD_ICMA_ACTUAL_ACTUAL);
+                  } break;
+#endif
+                  default: {
+                    ASSERTV(VEC_TYPE, 0);
+                  } break;
+                }
+
+                for (int i = 0; i < NUM_PAIRS; ++i) {
+                    const double EXP = Util::yearsDiff(
+                                                    beginDates[i],
+                                                    endDates[i],
+                                                    BSL_PERIODS,
+                                                    0.25,
+                                                    PERIOD_ICMA_ACTUAL_ACTUAL);
+                    ASSERTV(VEC_TYPE, NUM_PAIRS, i, EXP, years[i],
+                            EXP == years[i]);
+                }
+                ASSERTV(VEC_TYPE, NUM_PAIRS, -7.0 == years[NUM_PAIRS]);
+            }
+        }
+
+        { // negative testing
+            bsls::AssertTestHandlerGuard hG;
+
+            int              days[1];
+            double           years[1];
+            const bdlt::Date DATE(2012, 1, 1);
+            const bdlt::Date EARLY(1999, 1, 1);
+
+            const Enum INVALID = static_cast<Enum>(-1);
+
+            ASSERT_PASS(Util::daysDiff(days,
+                                       &DATE,
+                                       &DATE,
+                                       1,
+                                       PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_PASS(Util::daysDiff(0, 0, 0, 0, PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_FAIL(Util::daysDiff(days,
+                                       &DATE,
+                                       &DATE,
+                                       -1,
+                                       PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_FAIL(Util::daysDiff(0,
+                                       &DATE,
+                                       &DATE,
+                                       1,
+                                       PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_OPT_FAIL(Util::daysDiff(days, &DATE, &DATE, 1, INVALID));
+
+            ASSERT_PASS(Util::yearsDiff(years,
+                                        &DATE,
+                                        &DATE,
+                                        1,
+                                        BSL_PERIODS,
+                                        0.25,
+                                        PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_PASS(Util::yearsDiff(0,
+                                        0,
+                                        0,
+                                        0,
+                                        BSL_PERIODS,
+                                        0.25,
+                                        PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_FAIL(Util::yearsDiff(years,
+                                        &DATE,
+                                        &DATE,
+                                        -1,
+                                        BSL_PERIODS,
+                                        0.25,
+                                        PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_FAIL(Util::yearsDiff(years,
+                                        &EARLY,
+                                        &DATE,
+                                        1,
+                                        BSL_PERIODS,
+                                        0.25,
+                                        PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_FAIL(Util::yearsDiff(years,
+                                        &DATE,
+                                        &EARLY,
+                                        1,
+                                        BSL_PERIODS,
+                                        0.25,
+                                        PERIOD_ICMA_ACTUAL_ACTUAL));
+            ASSERT_FAIL(Util::yearsDiff(years,
+                                        &DATE,
+                                        &DATE,
+                                        1,
+                                        BslVector(1, DATE),
+                                        0.25,
+                                        PERIOD_ICMA_ACTUAL_ACTUAL));
+
+            BslVector unsorted(BSL_PERIODS);
+            bsl::swap(unsorted[1], unsorted[2]);
+            ASSERT_SAFE_FAIL(Util::yearsDiff(years,
+                                             &DATE,
+                                             &DATE,
+                                             1,
+                                             unsorted,
+                                             0.25,
+                                             PERIOD_ICMA_ACTUAL_ACTUAL));
+
+            ASSERT_OPT_FAIL(Util::yearsDiff(years,
+                                            &DATE,
+                                            &DATE,
+                                            1,
+                                            BSL_PERIODS,
+                                            0.25,
+                                            INVALID));
+        }
+      } break;
       case 3: {
         // --------------------------------------------------------------------
         // TESTING 'yearsDiff'
@@ -797,6 +1061,108 @@ int main(int argc, char *argv[])
                    == Util::isSupported(convention));
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: BATCH DAY COUNTS
+        //   Compare, for each supported convention, the cost of computing day
+        //   counts and year fractions one pair at a time with that of the
+        //   batch overloads.
+        //
+        // Concerns:
+        //: 1 The batch overloads are no slower than repeated single-pair
+        //:   calls.
+        //
+        // Plan:
+        //: 1 Time both forms over the same array of date pairs and report the
+        //:   average cost per pair.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: BATCH DAY COUNTS
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: BATCH DAY COUNTS" << endl
+             << "=============================" << endl;
+
+        const int NUM_PAIRS      = 100000;
+        const int NUM_ITERATIONS = 20;
+
+        BslVector periods;
+        loadQuarterlyPeriods(&periods, 2000, 2030);
+
+        bsl::vector<bdlt::Date> beginDates;
+        bsl::vector<bdlt::Date> endDates;
+        loadDatePairs(&beginDates,
+                      &endDates,
+                      NUM_PAIRS,
+                      periods.front(),
+                      periods.back() - periods.front() + 1);
+
+        bsl::vector<int>    days(NUM_PAIRS);
+        bsl::vector<double> years(NUM_PAIRS);
+
+        const Enum CONV = PERIOD_ICMA_ACTUAL_ACTUAL;
+
+        double          elapsed[4];
+        bsls::Stopwatch timer;
+
+        timer.start();
+        for (int j = 0; j < NUM_ITERATIONS; ++j) {
+            for (int i = 0; i < NUM_PAIRS; ++i) {
+                days[i] = Util::daysDiff(beginDates[i], endDates[i], CONV);
+            }
+        }
+        timer.stop();
+        elapsed[0] = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int j = 0; j < NUM_ITERATIONS; ++j) {
+            Util::daysDiff(days.data(),
+                           beginDates.data(),
+                           endDates.data(),
+                           NUM_PAIRS,
+                           CONV);
+        }
+        timer.stop();
+        elapsed[1] = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int j = 0; j < NUM_ITERATIONS; ++j) {
+            for (int i = 0; i < NUM_PAIRS; ++i) {
+                years[i] = Util::yearsDiff(beginDates[i],
+                                           endDates[i],
+                                           periods,
+                                           0.25,
+                                           CONV);
+            }
+        }
+        timer.stop();
+        elapsed[2] = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int j = 0; j < NUM_ITERATIONS; ++j) {
+            Util::yearsDiff(years.data(),
+                            beginDates.data(),
+                            endDates.data(),
+                            NUM_PAIRS,
+                            periods,
+                            0.25,
+                            CONV);
+        }
+        timer.stop();
+        elapsed[3] = timer.elapsedTime();
+
+        const double SCALE = 1.0e9 / NUM_ITERATIONS / NUM_PAIRS;
+
+        cout << CONV << ":" << endl
+             << "\tdaysDiff  (ns/pair): single " << elapsed[0] * SCALE
+             << ", batch " << elapsed[1] * SCALE << endl
+             << "\tyearsDiff (ns/pair): single " << elapsed[2] * SCALE
+             << ", batch " << elapsed[3] * SCALE << endl;
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT == FOUND." << endl;
         testStatus = -1;
@@ -62,6 +62,31 @@ double PeriodIcmaActualActual::yearsDiff(const bdlt::Date&  beginDate,
 
     BSLS_ASSERT_SAFE(u::isSortedAndUnique(periodDateBegin, periodDateEnd));
 
+    return PeriodIcmaActualActual_ImpUtil::yearsDiff(beginDate,
+                                                     endDate,
+                                                     periodDateBegin,
+                                                     periodDateEnd,
+                                                     periodYearDiff);
+}
+
+                  // -------------------------------------
+                  // struct PeriodIcmaActualActual_ImpUtil
+                  // -------------------------------------
+
+// CLASS METHODS
+double PeriodIcmaActualActual_ImpUtil::yearsDiff(
+                                     const bdlt::Date&  beginDate,
+                                     const bdlt::Date&  endDate,
+                                     const bdlt::Date  *periodDateBegin,
+                                     const bdlt::Date  *periodDateEnd,
+                                     double             periodYearDiff)
+{
+    BSLS_ASSERT_SAFE(2 <= periodDateEnd - periodDateBegin);
+    BSLS_ASSERT_SAFE(*periodDateBegin <= beginDate);
+    BSLS_ASSERT_SAFE(                    beginDate <= *(periodDateEnd - 1));
+    BSLS_ASSERT_SAFE(*periodDateBegin <= endDate);
+    BSLS_ASSERT_SAFE(                    endDate   <= *(periodDateEnd - 1));
+
     if (beginDate == endDate) {
         return 0.0;                                                   // RETURN
     }
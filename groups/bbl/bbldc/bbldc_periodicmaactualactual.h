@@ -146,6 +146,35 @@ struct PeriodIcmaActualActual {
         // period 'pyd'.
 };
 
+                  // =====================================
+                  // struct PeriodIcmaActualActual_ImpUtil
+                  // =====================================
+
+struct PeriodIcmaActualActual_ImpUtil {
+    // [!PRIVATE!] This 'struct' provides a namespace for the implementation of
+    // 'PeriodIcmaActualActual::yearsDiff', which does not verify that the
+    // period dates are sorted and unique, so that callers evaluating many
+    // date pairs against the same period dates (e.g.,
+    // 'bbldc::PeriodDayCountUtil') need perform that linear check only once.
+    // This 'struct' must not be used outside of the 'bbldc' package.
+
+    // CLASS METHODS
+    static double yearsDiff(const bdlt::Date&  beginDate,
+                            const bdlt::Date&  endDate,
+                            const bdlt::Date  *periodDateBegin,
+                            const bdlt::Date  *periodDateEnd,
+                            double             periodYearDiff);
+        // Return the (signed fractional) number of years between the specified
+        // 'beginDate' and 'endDate' according to the ICMA Actual/Actual
+        // day-count convention with periods starting on the specified range
+        // '[ periodDateBegin, periodDateEnd )' values and each period having a
+        // duration of the specified 'periodYearDiff' years.  The behavior is
+        // undefined unless the preconditions of
+        // 'PeriodIcmaActualActual::yearsDiff' are satisfied.  Note that this
+        // method does not check (in any build mode) that the period dates are
+        // sorted and unique.
+};
+
 // ============================================================================
 //                             INLINE DEFINITIONS
 // ============================================================================
@@ -0,0 +1,86 @@
+// bdlat_nameindex.cpp                                                -*-C++-*-
+#include <bdlat_nameindex.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlat_nameindex_cpp, "$Id$ $CSID$")
+
+#include <bdlb_hashutil.h>
+
+namespace BloombergLP {
+namespace bdlat {
+
+                              // ---------------
+                              // class NameIndex
+                              // ---------------
+
+// PRIVATE CLASS METHODS
+unsigned int NameIndex::hash(const char *name, int nameLength)
+{
+    return bdlb::HashUtil::hash2(name, nameLength);
+}
+
+// PRIVATE MANIPULATORS
+void NameIndex::insert(const char *name, int nameLength, int position)
+{
+    BSLS_ASSERT(name || 0 == nameLength);
+    BSLS_ASSERT(0 <= nameLength);
+    BSLS_ASSERT(0 <= position);
+    BSLS_ASSERT(static_cast<bsl::size_t>(d_numNames) * 2 < d_slots.size());
+
+    const unsigned int hashValue = hash(name, nameLength);
+
+    unsigned int i = hashValue & d_mask;
+    for (; 0 <= d_slots[i].d_position; i = (i + 1) & d_mask) {
+        const Slot& slot = d_slots[i];
+
+        if (slot.d_hash == hashValue
+         && slot.d_nameLength == nameLength
+         && 0 == bsl::memcmp(slot.d_name_p, name, nameLength)) {
+            return;                                                   // RETURN
+        }
+    }
+
+    Slot& slot = d_slots[i];
+    slot.d_name_p     = name;
+    slot.d_nameLength = nameLength;
+    slot.d_hash       = hashValue;
+    slot.d_position   = position;
+    ++d_numNames;
+}
+
+void NameIndex::reserveSlots(int numNames)
+{
+    BSLS_ASSERT(0 <= numNames);
+    BSLS_ASSERT(d_slots.empty());
+
+    // Keep the table at most half full, so that probe sequences are short and
+    // always end at an empty slot.
+
+    bsl::size_t numSlots = 2;
+    while (numSlots < static_cast<bsl::size_t>(numNames) * 2 + 1) {
+        numSlots *= 2;
+    }
+
+    const Slot emptySlot = { 0, 0, 0, -1 };
+    d_slots.assign(numSlots, emptySlot);
+    d_mask = static_cast<unsigned int>(numSlots - 1);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
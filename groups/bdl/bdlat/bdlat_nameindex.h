@@ -0,0 +1,726 @@
+// bdlat_nameindex.h                                                  -*-C++-*-
+#ifndef INCLUDED_BDLAT_NAMEINDEX
+#define INCLUDED_BDLAT_NAMEINDEX
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a hash index for attribute and enumerator name lookup.
+//
+//@CLASSES:
+//  bdlat::NameIndex: immutable hash index from names to table positions
+//  bdlat::NameIndexUtil: name lookup through per-type cached indexes
+//
+//@SEE_ALSO: bdlat_sequencefunctions, bdlat_enumfunctions
+//
+//@DESCRIPTION: This component provides a class, 'bdlat::NameIndex', that
+// indexes the names held by an array of 'bdlat' information 'struct's (such as
+// 'bdlat_AttributeInfo' or 'bdlat_EnumeratorInfo'), and a utility 'struct',
+// 'bdlat::NameIndexUtil', that resolves the names of the attributes of
+// "sequence" types, and of the enumerators of "enumeration" types, through an
+// index built on first use and cached for each type.
+//
+// Types generated by 'bas_codegen.pl' resolve attribute and enumerator names
+// with a linear scan over their information arrays, comparing each name in
+// turn.  Decoders resolve one name for every element they read, so for types
+// having many attributes name lookup can dominate decoding time.
+// 'bdlat::NameIndexUtil' replaces that scan with a single hash probe.
+//
+///Hash Index
+///----------
+// A 'bdlat::NameIndex' is an open-addressed hash table, holding at most half
+// as many names as it has slots, in which each slot records the address,
+// length, and full hash value of a name, and the position of that name in the
+// array from which the index was built.  A lookup hashes the name once and
+// compares it, in the common case, against the single name occupying the
+// slot that it hashes to, so its cost is independent of the number of names.
+// Where the array holds several elements having the same name, the index
+// resolves that name to the first of them, as a linear scan would.
+//
+// The index refers to the names of the array from which it was built, which
+// therefore must outlive it.  This is always the case for the static
+// information arrays of generated types.
+//
+///Cached Per-Type Indexes
+///-----------------------
+// 'bdlat::NameIndexUtil' applies to "sequence" types that provide, as do types
+// generated by 'bas_codegen.pl', a public static 'ATTRIBUTE_INFO_ARRAY' of
+// 'bdlat_AttributeInfo' objects and a public 'NUM_ATTRIBUTES' constant, and to
+// "basic enumeration" types (see 'bdlat_IsBasicEnumeration') whose wrapper
+// 'struct' (see 'bdlat_BasicEnumerationWrapper') provides a public static
+// 'ENUMERATOR_INFO_ARRAY' of 'bdlat_EnumeratorInfo' objects and a public
+// 'NUM_ENUMERATORS' constant.  The presence of these members is detected at
+// compile time.  For each such type, the index of its array is built the
+// first time it is needed, in a thread-safe manner, using memory from
+// 'bslma::NewDeleteAllocator' (so that it is not attributed to the default or
+// global allocators), and is never destroyed.
+//
+// A name found in the index is then resolved through the identifier of the
+// attribute, or the value of the enumerator, having that name, using the
+// 'bdlat_SequenceFunctions' and 'bdlat_EnumFunctions' overloads taking an
+// identifier or integral value, which generated types implement with a
+// 'switch'.  A name not found in the index, and any name for a type lacking
+// the required members, is resolved by the name-based
+// 'bdlat_SequenceFunctions' and 'bdlat_EnumFunctions' functions, exactly as
+// if this component were not used.  This preserves the behavior of types that
+// also resolve names not listed in their arrays (such as the selection names
+// of an anonymous choice attribute of a generated "sequence"), at the cost of
+// a second, linear, lookup for names that are not found at all.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Indexing an Array of Enumerator Information
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have an array of enumerator information describing the colors
+// of a palette, and we want to find enumerators by name.
+//
+// First, we define the array:
+//..
+//  const bdlat_EnumeratorInfo COLORS[] = {
+//      { 0, "RED",   3, "" },
+//      { 1, "GREEN", 5, "" },
+//      { 2, "BLUE",  4, "" },
+//  };
+//..
+// Then, we build an index of the names in the array:
+//..
+//  bdlat::NameIndex index(COLORS, 3);
+//  assert(3 == index.numNames());
+//..
+// Finally, we look up names, obtaining their positions in 'COLORS', or -1 for
+// names that are not in the array:
+//..
+//  assert( 1 == index.find("GREEN", 5));
+//  assert( 2 == index.find("BLUE",  4));
+//  assert(-1 == index.find("BLUEISH", 7));
+//  assert(-1 == index.find("GREEN", 4));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlat_attributeinfo.h>
+#include <bdlat_enumeratorinfo.h>
+#include <bdlat_enumfunctions.h>
+#include <bdlat_sequencefunctions.h>
+#include <bdlat_typetraits.h>
+
+#include <bslma_allocator.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_once.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_cstring.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlat {
+
+                              // ===============
+                              // class NameIndex
+                              // ===============
+
+class NameIndex {
+    // This class provides an immutable, open-addressed hash index from the
+    // names held by an array of 'bdlat' information 'struct's to the positions
+    // of those names in the array.  See {Hash Index}.
+
+    // PRIVATE TYPES
+    struct Slot {
+        // This 'struct' describes one slot of the hash table.  A slot is empty
+        // if its position is negative.
+
+        const char   *d_name_p;      // name (not null-terminated)
+        int           d_nameLength;  // length of 'd_name_p'
+        unsigned int  d_hash;        // hash value of the name
+        int           d_position;    // position in the array, or -1
+    };
+
+    // DATA
+    bsl::vector<Slot> d_slots;     // hash table (size is a power of 2)
+    unsigned int      d_mask;      // 'd_slots.size() - 1'
+    int               d_numNames;  // number of distinct names indexed
+
+  private:
+    // NOT IMPLEMENTED
+    NameIndex(const NameIndex&);
+    NameIndex& operator=(const NameIndex&);
+
+    // PRIVATE CLASS METHODS
+    static unsigned int hash(const char *name, int nameLength);
+        // Return the hash value of the specified 'name' having the specified
+        // 'nameLength'.
+
+    // PRIVATE MANIPULATORS
+    void insert(const char *name, int nameLength, int position);
+        // Add to this index the specified 'name' having the specified
+        // 'nameLength' at the specified 'position', unless 'name' is already
+        // indexed.  The behavior is undefined unless this index has fewer
+        // than half as many names as slots.
+
+    void reserveSlots(int numNames);
+        // Size the table of this index to hold the specified 'numNames'
+        // names.  The behavior is undefined unless this index is empty.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(NameIndex, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    template <class INFO>
+    NameIndex(const INFO       *infos,
+              int               numInfos,
+              bslma::Allocator *basicAllocator = 0);
+        // Create an index of the names held by the specified 'numInfos'
+        // elements of the specified 'infos' array.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  'INFO' must
+        // have 'd_name_p' and 'd_nameLength' data members, as do
+        // 'bdlat_AttributeInfo', 'bdlat_EnumeratorInfo', and
+        // 'bdlat_SelectionInfo'.  The behavior is undefined unless
+        // '0 <= numInfos', 'infos' refers to at least 'numInfos' elements,
+        // and the names of those elements outlive this index.
+
+    //! ~NameIndex() = default;
+        // Destroy this object.
+
+    // ACCESSORS
+    int find(const char *name, int nameLength) const;
+        // Return the position, in the array from which this index was built,
+        // of the first element having the specified 'name' of the specified
+        // 'nameLength', or -1 if there is no such element.  The behavior is
+        // undefined unless '0 <= nameLength' and 'name' refers to at least
+        // 'nameLength' characters.
+
+    int numNames() const;
+        // Return the number of distinct names in this index.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+                    // ==================================
+                    // struct NameIndex_HasAttributeTable
+                    // ==================================
+
+template <class TYPE>
+struct NameIndex_HasAttributeTable {
+    // This component-private metafunction has a 'value' of 'true' if 'TYPE'
+    // provides a public static 'ATTRIBUTE_INFO_ARRAY' of 'bdlat_AttributeInfo'
+    // objects and a public 'NUM_ATTRIBUTES' constant, and 'false' otherwise.
+
+  private:
+    // PRIVATE TYPES
+    typedef char YesType;
+    struct NoType {
+        char d_dummy[2];
+    };
+
+    // PRIVATE CLASS METHODS
+    static YesType isInfo(const bdlat_AttributeInfo *);
+
+    template <class OTHER_TYPE>
+    static YesType test(
+                      char (*)[sizeof(isInfo(OTHER_TYPE::ATTRIBUTE_INFO_ARRAY))
+                               + sizeof(OTHER_TYPE::NUM_ATTRIBUTES)]);
+    template <class OTHER_TYPE>
+    static NoType test(...);
+
+  public:
+    // CONSTANTS
+    enum { value = sizeof(test<TYPE>(0)) == sizeof(YesType) };
+};
+
+                    // ===================================
+                    // struct NameIndex_HasEnumeratorTable
+                    // ===================================
+
+template <class TYPE>
+struct NameIndex_HasEnumeratorTable {
+    // This component-private metafunction has a 'value' of 'true' if 'TYPE'
+    // provides a public static 'ENUMERATOR_INFO_ARRAY' of
+    // 'bdlat_EnumeratorInfo' objects and a public 'NUM_ENUMERATORS' constant,
+    // and 'false' otherwise.
+
+  private:
+    // PRIVATE TYPES
+    typedef char YesType;
+    struct NoType {
+        char d_dummy[2];
+    };
+
+    // PRIVATE CLASS METHODS
+    static YesType isInfo(const bdlat_EnumeratorInfo *);
+
+    template <class OTHER_TYPE>
+    static YesType test(
+                     char (*)[sizeof(isInfo(OTHER_TYPE::ENUMERATOR_INFO_ARRAY))
+                              + sizeof(OTHER_TYPE::NUM_ENUMERATORS)]);
+    template <class OTHER_TYPE>
+    static NoType test(...);
+
+  public:
+    // CONSTANTS
+    enum { value = sizeof(test<TYPE>(0)) == sizeof(YesType) };
+};
+
+                  // =====================================
+                  // struct NameIndex_HasEnumerationWrapper
+                  // =====================================
+
+template <class TYPE>
+struct NameIndex_HasEnumerationWrapper {
+    // This component-private metafunction has a 'value' of 'true' if
+    // 'bdlat_BasicEnumerationWrapper' is specialized for 'TYPE' (as it is by
+    // 'BDLAT_DECL_ENUMERATION_TRAITS'), and 'false' otherwise.  Note that a
+    // basic enumeration may instead provide its 'bdlat' enumeration functions
+    // directly, without a wrapper.
+
+  private:
+    // PRIVATE TYPES
+    typedef char YesType;
+    struct NoType {
+        char d_dummy[2];
+    };
+
+    // PRIVATE CLASS METHODS
+    template <class OTHER_TYPE>
+    static YesType test(
+               typename bdlat_BasicEnumerationWrapper<OTHER_TYPE>::Wrapper *);
+    template <class OTHER_TYPE>
+    static NoType test(...);
+
+  public:
+    // CONSTANTS
+    enum { value = sizeof(test<TYPE>(0)) == sizeof(YesType) };
+};
+
+                          // =======================
+                          // struct NameIndex_Cache
+                          // =======================
+
+template <class TABLE_TYPE, class INFO>
+struct NameIndex_Cache {
+    // This component-private 'struct' provides the index of the 'INFO' array
+    // of 'TABLE_TYPE', built on first use.
+
+    // CLASS METHODS
+    static const NameIndex& index(const INFO *infos, int numInfos);
+        // Return a reference providing non-modifiable access to the index of
+        // the specified 'numInfos' elements of the specified 'infos' array,
+        // building it if this is the first call for 'TABLE_TYPE' and 'INFO'.
+        // The behavior is undefined unless every call for 'TABLE_TYPE' and
+        // 'INFO' supplies the same 'infos' and 'numInfos'.
+};
+
+                       // ===============================
+                       // struct NameIndex_AttributeTable
+                       // ===============================
+
+template <class TYPE,
+          bool HAS_TABLE = NameIndex_HasAttributeTable<TYPE>::value>
+struct NameIndex_AttributeTable {
+    // This component-private 'struct' looks up attribute names of 'TYPE',
+    // which does not provide an attribute information array.
+
+    // CLASS METHODS
+    static const bdlat_AttributeInfo *lookup(const char *, int);
+        // Return 0.
+};
+
+template <class TYPE>
+struct NameIndex_AttributeTable<TYPE, true> {
+    // This component-private 'struct' looks up attribute names of 'TYPE'
+    // through the cached index of its attribute information array.
+
+    // CLASS METHODS
+    static const bdlat_AttributeInfo *lookup(const char *name,
+                                             int         nameLength);
+        // Return the address of the element of 'TYPE::ATTRIBUTE_INFO_ARRAY'
+        // having the specified 'name' of the specified 'nameLength', or 0 if
+        // there is no such element.
+};
+
+                      // ================================
+                      // struct NameIndex_EnumeratorTable
+                      // ================================
+
+template <class TYPE,
+          bool HAS_WRAPPER = bdlat_IsBasicEnumeration<TYPE>::value
+                          && NameIndex_HasEnumerationWrapper<TYPE>::value>
+struct NameIndex_EnumeratorTable {
+    // This component-private 'struct' looks up enumerator names of 'TYPE',
+    // which is not a basic enumeration having a wrapper.
+
+    // CLASS METHODS
+    static const bdlat_EnumeratorInfo *lookup(const char *, int);
+        // Return 0.
+};
+
+template <class WRAPPER,
+          bool HAS_TABLE = NameIndex_HasEnumeratorTable<WRAPPER>::value>
+struct NameIndex_EnumeratorWrapperTable {
+    // This component-private 'struct' looks up enumerator names of the
+    // enumeration wrapped by 'WRAPPER', which does not provide an enumerator
+    // information array.
+
+    // CLASS METHODS
+    static const bdlat_EnumeratorInfo *lookup(const char *, int);
+        // Return 0.
+};
+
+template <class WRAPPER>
+struct NameIndex_EnumeratorWrapperTable<WRAPPER, true> {
+    // This component-private 'struct' looks up enumerator names of the
+    // enumeration wrapped by 'WRAPPER' through the cached index of its
+    // enumerator information array.
+
+    // CLASS METHODS
+    static const bdlat_EnumeratorInfo *lookup(const char *name,
+                                              int         nameLength);
+        // Return the address of the element of
+        // 'WRAPPER::ENUMERATOR_INFO_ARRAY' having the specified 'name' of the
+        // specified 'nameLength', or 0 if there is no such element.
+};
+
+template <class TYPE>
+struct NameIndex_EnumeratorTable<TYPE, true>
+: NameIndex_EnumeratorWrapperTable<
+                     typename bdlat_BasicEnumerationWrapper<TYPE>::Wrapper> {
+    // This component-private 'struct' looks up enumerator names of the basic
+    // enumeration 'TYPE' through its wrapper.
+};
+
+                            // ====================
+                            // struct NameIndexUtil
+                            // ====================
+
+struct NameIndexUtil {
+    // This 'struct' provides a namespace for a suite of function templates
+    // resolving the names of attributes of "sequence" types, and of
+    // enumerators of "enumeration" types, through per-type cached indexes.
+    // See {Cached Per-Type Indexes}.
+
+    // CLASS METHODS
+    template <class TYPE>
+    static const bdlat_AttributeInfo *lookupAttributeInfo(
+                                                       const char *name,
+                                                       int         nameLength);
+        // Return the address of the element of the attribute information
+        // array of the "sequence" 'TYPE' having the specified 'name' of the
+        // specified 'nameLength', or 0 if there is no such element or 'TYPE'
+        // does not provide such an array.  The behavior is undefined unless
+        // '0 <= nameLength'.
+
+    template <class TYPE>
+    static const bdlat_EnumeratorInfo *lookupEnumeratorInfo(
+                                                       const char *name,
+                                                       int         nameLength);
+        // Return the address of the element of the enumerator information
+        // array of the "enumeration" 'TYPE' having the specified 'name' of the
+        // specified 'nameLength', or 0 if there is no such element or 'TYPE'
+        // does not provide such an array.  The behavior is undefined unless
+        // '0 <= nameLength'.
+
+    template <class TYPE, class MANIPULATOR>
+    static int manipulateAttribute(TYPE         *object,
+                                   MANIPULATOR&  manipulator,
+                                   const char   *attributeName,
+                                   int           attributeNameLength);
+        // Invoke the specified 'manipulator' on the address of the
+        // (modifiable) attribute indicated by the specified 'attributeName'
+        // and 'attributeNameLength' of the specified "sequence" 'object', as
+        // if by 'bdlat_SequenceFunctions::manipulateAttribute'.  Return a
+        // non-zero value if the attribute is not found, and the value returned
+        // from the invocation of 'manipulator' otherwise.
+
+    template <class TYPE>
+    static bool hasAttribute(const TYPE&  object,
+                             const char  *attributeName,
+                             int          attributeNameLength);
+        // Return 'true' if the specified "sequence" 'object' has an attribute
+        // with the specified 'attributeName' of the specified
+        // 'attributeNameLength', and 'false' otherwise.
+
+    template <class TYPE>
+    static int fromString(TYPE *result, const char *string, int stringLength);
+        // Load into the specified 'result' the enumerator of the
+        // "enumeration" 'TYPE' matching the specified 'string' of the
+        // specified 'stringLength', as if by
+        // 'bdlat_EnumFunctions::fromString'.  Return 0 on success, and a
+        // non-zero value with no effect on 'result' if 'string' and
+        // 'stringLength' do not match any enumerator.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // ---------------
+                              // class NameIndex
+                              // ---------------
+
+// CREATORS
+template <class INFO>
+NameIndex::NameIndex(const INFO       *infos,
+                     int               numInfos,
+                     bslma::Allocator *basicAllocator)
+: d_slots(basicAllocator)
+, d_mask(0)
+, d_numNames(0)
+{
+    BSLS_ASSERT(infos || 0 == numInfos);
+    BSLS_ASSERT(0 <= numInfos);
+
+    reserveSlots(numInfos);
+    for (int i = 0; i < numInfos; ++i) {
+        insert(infos[i].d_name_p, infos[i].d_nameLength, i);
+    }
+}
+
+// ACCESSORS
+inline
+int NameIndex::find(const char *name, int nameLength) const
+{
+    BSLS_ASSERT_SAFE(0 <= nameLength);
+
+    const unsigned int hashValue = hash(name, nameLength);
+
+    // The table is never more than half full, so the probe sequence ends at an
+    // empty slot.
+
+    for (unsigned int i = hashValue & d_mask;; i = (i + 1) & d_mask) {
+        const Slot& slot = d_slots[i];
+
+        if (slot.d_position < 0) {
+            return -1;                                                // RETURN
+        }
+        if (slot.d_hash == hashValue
+         && slot.d_nameLength == nameLength
+         && 0 == bsl::memcmp(slot.d_name_p, name, nameLength)) {
+            return slot.d_position;                                   // RETURN
+        }
+    }
+}
+
+inline
+int NameIndex::numNames() const
+{
+    return d_numNames;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *NameIndex::allocator() const
+{
+    return d_slots.get_allocator().mechanism();
+}
+
+                          // -----------------------
+                          // struct NameIndex_Cache
+                          // -----------------------
+
+// CLASS METHODS
+template <class TABLE_TYPE, class INFO>
+const NameIndex& NameIndex_Cache<TABLE_TYPE, INFO>::index(const INFO *infos,
+                                                          int numInfos)
+{
+    static bsls::AtomicOperations::AtomicTypes::Pointer s_index_p;
+        // zero-initialized, so safe to use before dynamic initialization
+
+    static bslmt::Once s_once = BSLMT_ONCE_INITIALIZER;
+
+    const void *index = bsls::AtomicOperations::getPtrAcquire(&s_index_p);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == index)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        bslmt::OnceGuard onceGuard(&s_once);
+        if (onceGuard.enter()) {
+            bslma::Allocator *allocator =
+                                      &bslma::NewDeleteAllocator::singleton();
+
+            bsls::AtomicOperations::setPtrRelease(
+                              &s_index_p,
+                              new (*allocator) NameIndex(infos,
+                                                         numInfos,
+                                                         allocator));
+        }
+        index = bsls::AtomicOperations::getPtrAcquire(&s_index_p);
+    }
+
+    return *static_cast<const NameIndex *>(index);
+}
+
+                       // -------------------------------
+                       // struct NameIndex_AttributeTable
+                       // -------------------------------
+
+// CLASS METHODS
+template <class TYPE, bool HAS_TABLE>
+inline
+const bdlat_AttributeInfo *
+NameIndex_AttributeTable<TYPE, HAS_TABLE>::lookup(const char *, int)
+{
+    return 0;
+}
+
+template <class TYPE>
+inline
+const bdlat_AttributeInfo *
+NameIndex_AttributeTable<TYPE, true>::lookup(const char *name, int nameLength)
+{
+    const int position = NameIndex_Cache<TYPE, bdlat_AttributeInfo>::index(
+                                                   TYPE::ATTRIBUTE_INFO_ARRAY,
+                                                   TYPE::NUM_ATTRIBUTES)
+                                                       .find(name, nameLength);
+
+    return 0 <= position ? TYPE::ATTRIBUTE_INFO_ARRAY + position : 0;
+}
+
+                      // --------------------------------
+                      // struct NameIndex_EnumeratorTable
+                      // --------------------------------
+
+// CLASS METHODS
+template <class TYPE, bool HAS_WRAPPER>
+inline
+const bdlat_EnumeratorInfo *
+NameIndex_EnumeratorTable<TYPE, HAS_WRAPPER>::lookup(const char *, int)
+{
+    return 0;
+}
+
+                  // ---------------------------------------
+                  // struct NameIndex_EnumeratorWrapperTable
+                  // ---------------------------------------
+
+// CLASS METHODS
+template <class WRAPPER, bool HAS_TABLE>
+inline
+const bdlat_EnumeratorInfo *
+NameIndex_EnumeratorWrapperTable<WRAPPER, HAS_TABLE>::lookup(const char *,
+                                                              int)
+{
+    return 0;
+}
+
+template <class WRAPPER>
+inline
+const bdlat_EnumeratorInfo *
+NameIndex_EnumeratorWrapperTable<WRAPPER, true>::lookup(const char *name,
+                                                        int         nameLength)
+{
+    const int position = NameIndex_Cache<WRAPPER, bdlat_EnumeratorInfo>::index(
+                                                WRAPPER::ENUMERATOR_INFO_ARRAY,
+                                                WRAPPER::NUM_ENUMERATORS)
+                                                       .find(name, nameLength);
+
+    return 0 <= position ? WRAPPER::ENUMERATOR_INFO_ARRAY + position : 0;
+}
+
+                            // --------------------
+                            // struct NameIndexUtil
+                            // --------------------
+
+// CLASS METHODS
+template <class TYPE>
+inline
+const bdlat_AttributeInfo *NameIndexUtil::lookupAttributeInfo(
+                                                        const char *name,
+                                                        int         nameLength)
+{
+    return NameIndex_AttributeTable<TYPE>::lookup(name, nameLength);
+}
+
+template <class TYPE>
+inline
+const bdlat_EnumeratorInfo *NameIndexUtil::lookupEnumeratorInfo(
+                                                        const char *name,
+                                                        int         nameLength)
+{
+    return NameIndex_EnumeratorTable<TYPE>::lookup(name, nameLength);
+}
+
+template <class TYPE, class MANIPULATOR>
+inline
+int NameIndexUtil::manipulateAttribute(TYPE         *object,
+                                       MANIPULATOR&  manipulator,
+                                       const char   *attributeName,
+                                       int           attributeNameLength)
+{
+    const bdlat_AttributeInfo *info = lookupAttributeInfo<TYPE>(
+                                                          attributeName,
+                                                          attributeNameLength);
+    if (info) {
+        return bdlat_SequenceFunctions::manipulateAttribute(object,
+                                                            manipulator,
+                                                            info->d_id);
+                                                                      // RETURN
+    }
+
+    return bdlat_SequenceFunctions::manipulateAttribute(object,
+                                                        manipulator,
+                                                        attributeName,
+                                                        attributeNameLength);
+}
+
+template <class TYPE>
+inline
+bool NameIndexUtil::hasAttribute(const TYPE&  object,
+                                 const char  *attributeName,
+                                 int          attributeNameLength)
+{
+    return 0 != lookupAttributeInfo<TYPE>(attributeName, attributeNameLength)
+        || bdlat_SequenceFunctions::hasAttribute(object,
+                                                 attributeName,
+                                                 attributeNameLength);
+}
+
+template <class TYPE>
+inline
+int NameIndexUtil::fromString(TYPE       *result,
+                              const char *string,
+                              int         stringLength)
+{
+    const bdlat_EnumeratorInfo *info = lookupEnumeratorInfo<TYPE>(
+                                                                 string,
+                                                                 stringLength);
+    if (info) {
+        return bdlat_EnumFunctions::fromInt(result, info->d_value);   // RETURN
+    }
+
+    return bdlat_EnumFunctions::fromString(result, string, stringLength);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // INCLUDED_BDLAT_NAMEINDEX
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1398 @@
+// bdlat_nameindex.t.cpp                                              -*-C++-*-
+#include <bdlat_nameindex.h>
+
+#include <bdlat_attributeinfo.h>
+#include <bdlat_enumeratorinfo.h>
+#include <bdlat_enumfunctions.h>
+#include <bdlat_selectioninfo.h>
+#include <bdlat_sequencefunctions.h>
+#include <bdlat_typetraits.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// This component provides a hash index over the names of an array of 'bdlat'
+// information 'struct's, and a utility resolving attribute and enumerator
+// names of generated types through indexes cached per type.  The index is
+// tested against a linear scan over tables of names chosen to exercise
+// collisions, duplicates, empty names, and names that are prefixes of one
+// another.  The utility is tested with test types modeled on the output of
+// 'bas_codegen.pl' that count the name-based lookups they perform, so that
+// the tests can verify both that the result of each call is as if the
+// name-based 'bdlat' functions were called, and that those functions are
+// called only for names missing from the cached index.
+// ----------------------------------------------------------------------------
+// NameIndex
+// [ 2] NameIndex(const INFO *infos, int numInfos, Allocator *bA = 0);
+// [ 2] ~NameIndex();
+// [ 2] int find(const char *name, int nameLength) const;
+// [ 2] int numNames() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// NameIndexUtil
+// [ 4] const bdlat_AttributeInfo *lookupAttributeInfo<TYPE>(name, len);
+// [ 4] const bdlat_EnumeratorInfo *lookupEnumeratorInfo<TYPE>(name, len);
+// [ 5] int manipulateAttribute(TYPE *, MANIPULATOR&, const char *, int);
+// [ 5] bool hasAttribute(const TYPE&, const char *, int);
+// [ 5] int fromString(TYPE *result, const char *string, int length);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] TESTING TABLE DETECTION
+// [ 6] CONCURRENT FIRST USE
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlat::NameIndex     Obj;
+typedef bdlat::NameIndexUtil Util;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                            CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace test {
+
+                               // ============
+                               // class Record
+                               // ============
+
+class Record {
+    // This class models a "sequence" type generated by 'bas_codegen.pl',
+    // having four 'int' attributes.  In addition to the names in its
+    // attribute information array, its name-based lookup resolves the name
+    // "alias" to the first attribute, as a generated type resolves the
+    // selection names of an anonymous choice.  The name-based lookups are
+    // counted.
+
+  public:
+    // TYPES
+    enum {
+        ATTRIBUTE_ID_ALPHA = 10,
+        ATTRIBUTE_ID_BETA  = 20,
+        ATTRIBUTE_ID_GAMMA = 30,
+        ATTRIBUTE_ID_DELTA = 40
+    };
+
+    enum {
+        NUM_ATTRIBUTES = 4
+    };
+
+    // CONSTANTS
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+
+    static int s_numNameLookups;
+        // number of calls to the name-based 'lookupAttributeInfo'
+
+  private:
+    // DATA
+    int d_values[NUM_ATTRIBUTES];
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Record, bdlat_IsBasicSequence);
+
+    // CLASS METHODS
+    static const bdlat_AttributeInfo *lookupAttributeInfo(int id)
+        // Return the information for the attribute having the specified 'id',
+        // or 0 if there is none.
+    {
+        for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+            if (id == ATTRIBUTE_INFO_ARRAY[i].d_id) {
+                return ATTRIBUTE_INFO_ARRAY + i;                      // RETURN
+            }
+        }
+        return 0;
+    }
+
+    static const bdlat_AttributeInfo *lookupAttributeInfo(
+                                                        const char *name,
+                                                        int         nameLength)
+        // Return the information for the attribute having the specified
+        // 'name' of the specified 'nameLength', or 0 if there is none.
+    {
+        ++s_numNameLookups;
+
+        if (5 == nameLength && 0 == bsl::memcmp("alias", name, 5)) {
+            return ATTRIBUTE_INFO_ARRAY;                              // RETURN
+        }
+        for (int i = 0; i < NUM_ATTRIBUTES; ++i) {
+            const bdlat_AttributeInfo& info = ATTRIBUTE_INFO_ARRAY[i];
+            if (nameLength == info.d_nameLength
+             && 0 == bsl::memcmp(info.d_name_p, name, nameLength)) {
+                return &info;                                         // RETURN
+            }
+        }
+        return 0;
+    }
+
+    // CREATORS
+    Record()
+        // Create a 'Record' having all attributes 0.
+    {
+        bsl::fill(d_values, d_values + NUM_ATTRIBUTES, 0);
+    }
+
+    // MANIPULATORS
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR& manipulator, int id)
+        // Invoke the specified 'manipulator' on the attribute having the
+        // specified 'id'.  Return the result of the invocation, or -1 if
+        // there is no such attribute.
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(id);
+        if (0 == info) {
+            return -1;                                                // RETURN
+        }
+        return manipulator(&d_values[info - ATTRIBUTE_INFO_ARRAY], *info);
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR&  manipulator,
+                            const char   *name,
+                            int           nameLength)
+        // Invoke the specified 'manipulator' on the attribute having the
+        // specified 'name' of the specified 'nameLength'.  Return the result
+        // of the invocation, or -1 if there is no such attribute.
+    {
+        const bdlat_AttributeInfo *info = lookupAttributeInfo(name,
+                                                              nameLength);
+        if (0 == info) {
+            return -1;                                                // RETURN
+        }
+        return manipulateAttribute(manipulator, info->d_id);
+    }
+
+    // ACCESSORS
+    int value(int index) const
+        // Return the value of the attribute at the specified 'index'.
+    {
+        return d_values[index];
+    }
+};
+
+int Record::s_numNameLookups = 0;
+
+const bdlat_AttributeInfo Record::ATTRIBUTE_INFO_ARRAY[] = {
+    { ATTRIBUTE_ID_ALPHA, "alpha", 5, "", 0 },
+    { ATTRIBUTE_ID_BETA,  "beta",  4, "", 0 },
+    { ATTRIBUTE_ID_GAMMA, "gamma", 5, "", 0 },
+    { ATTRIBUTE_ID_DELTA, "delta", 5, "", 0 },
+};
+
+                               // ===========
+                               // class Point
+                               // ===========
+
+class Point {
+    // This class models a hand-written "sequence" type, having the single
+    // 'int' attribute "x" and no attribute information array.
+
+  public:
+    // CONSTANTS
+    static const bdlat_AttributeInfo X_INFO;
+
+    static int s_numNameLookups;
+        // number of calls to the name-based 'lookupAttributeInfo'
+
+  private:
+    // DATA
+    int d_x;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Point, bdlat_IsBasicSequence);
+
+    // CLASS METHODS
+    static const bdlat_AttributeInfo *lookupAttributeInfo(int id)
+        // Return the information for the attribute having the specified 'id',
+        // or 0 if there is none.
+    {
+        return 1 == id ? &X_INFO : 0;
+    }
+
+    static const bdlat_AttributeInfo *lookupAttributeInfo(
+                                                        const char *name,
+                                                        int         nameLength)
+        // Return the information for the attribute having the specified
+        // 'name' of the specified 'nameLength', or 0 if there is none.
+    {
+        ++s_numNameLookups;
+        return 1 == nameLength && 'x' == *name ? &X_INFO : 0;
+    }
+
+    // CREATORS
+    Point()
+    : d_x(0)
+        // Create a 'Point' having "x" 0.
+    {
+    }
+
+    // MANIPULATORS
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR& manipulator, int id)
+        // Invoke the specified 'manipulator' on the attribute having the
+        // specified 'id'.  Return the result of the invocation, or -1 if
+        // there is no such attribute.
+    {
+        return 1 == id ? manipulator(&d_x, X_INFO) : -1;
+    }
+
+    template <class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR&  manipulator,
+                            const char   *name,
+                            int           nameLength)
+        // Invoke the specified 'manipulator' on the attribute having the
+        // specified 'name' of the specified 'nameLength'.  Return the result
+        // of the invocation, or -1 if there is no such attribute.
+    {
+        return lookupAttributeInfo(name, nameLength)
+               ? manipulator(&d_x, X_INFO)
+               : -1;
+    }
+
+    // ACCESSORS
+    int x() const
+        // Return the value of "x".
+    {
+        return d_x;
+    }
+};
+
+int Point::s_numNameLookups = 0;
+
+const bdlat_AttributeInfo Point::X_INFO = { 1, "x", 1, "", 0 };
+
+                               // ============
+                               // struct Color
+                               // ============
+
+struct Color {
+    // This 'struct' models an "enumeration" type generated by
+    // 'bas_codegen.pl'.  The calls to its 'fromString' are counted.
+
+    // TYPES
+    enum Value {
+        e_RED   = 1,
+        e_GREEN = 2,
+        e_BLUE  = 4
+    };
+
+    enum {
+        NUM_ENUMERATORS = 3
+    };
+
+    // CONSTANTS
+    static const bdlat_EnumeratorInfo ENUMERATOR_INFO_ARRAY[];
+
+    static int s_numFromString;
+        // number of calls to 'fromString'
+
+    // CLASS METHODS
+    static int fromInt(Value *result, int number)
+        // Load into the specified 'result' the enumerator having the
+        // specified 'number'.  Return 0 on success, and a non-zero value
+        // otherwise.
+    {
+        for (int i = 0; i < NUM_ENUMERATORS; ++i) {
+            if (number == ENUMERATOR_INFO_ARRAY[i].d_value) {
+                *result = static_cast<Value>(number);
+                return 0;                                             // RETURN
+            }
+        }
+        return -1;
+    }
+
+    static int fromString(Value *result, const char *string, int length)
+        // Load into the specified 'result' the enumerator having the
+        // specified 'string' of the specified 'length'.  Return 0 on success,
+        // and a non-zero value otherwise.
+    {
+        ++s_numFromString;
+
+        for (int i = 0; i < NUM_ENUMERATORS; ++i) {
+            const bdlat_EnumeratorInfo& info = ENUMERATOR_INFO_ARRAY[i];
+            if (length == info.d_nameLength
+             && 0 == bsl::memcmp(info.d_name_p, string, length)) {
+                *result = static_cast<Value>(info.d_value);
+                return 0;                                             // RETURN
+            }
+        }
+        return -1;
+    }
+
+    static const char *toString(Value value)
+        // Return the name of the specified 'value'.
+    {
+        for (int i = 0; i < NUM_ENUMERATORS; ++i) {
+            if (value == ENUMERATOR_INFO_ARRAY[i].d_value) {
+                return ENUMERATOR_INFO_ARRAY[i].d_name_p;             // RETURN
+            }
+        }
+        return 0;
+    }
+};
+
+int Color::s_numFromString = 0;
+
+const bdlat_EnumeratorInfo Color::ENUMERATOR_INFO_ARRAY[] = {
+    { e_RED,   "RED",   3, "" },
+    { e_GREEN, "GREEN", 5, "" },
+    { e_BLUE,  "BLUE",  4, "" },
+};
+
+                               // ============
+                               // struct Shade
+                               // ============
+
+struct Shade {
+    // This 'struct' models a hand-written basic "enumeration" type having no
+    // enumerator information array.  The calls to its 'fromString' are
+    // counted.
+
+    // TYPES
+    enum Value {
+        e_LIGHT,
+        e_DARK
+    };
+
+    static int s_numFromString;
+        // number of calls to 'fromString'
+
+    // CLASS METHODS
+    static int fromInt(Value *result, int number)
+        // Load into the specified 'result' the enumerator having the
+        // specified 'number'.  Return 0 on success, and a non-zero value
+        // otherwise.
+    {
+        if (e_LIGHT != number && e_DARK != number) {
+            return -1;                                                // RETURN
+        }
+        *result = static_cast<Value>(number);
+        return 0;
+    }
+
+    static int fromString(Value *result, const char *string, int length)
+        // Load into the specified 'result' the enumerator having the
+        // specified 'string' of the specified 'length'.  Return 0 on success,
+        // and a non-zero value otherwise.
+    {
+        ++s_numFromString;
+
+        if (4 == length && 0 == bsl::memcmp("DARK", string, 4)) {
+            *result = e_DARK;
+            return 0;                                                 // RETURN
+        }
+        if (5 == length && 0 == bsl::memcmp("LIGHT", string, 5)) {
+            *result = e_LIGHT;
+            return 0;                                                 // RETURN
+        }
+        return -1;
+    }
+
+    static const char *toString(Value value)
+        // Return the name of the specified 'value'.
+    {
+        return e_DARK == value ? "DARK" : "LIGHT";
+    }
+};
+
+int Shade::s_numFromString = 0;
+
+                           // ====================
+                           // struct SetManipulator
+                           // ====================
+
+struct SetManipulator {
+    // This 'struct' provides a manipulator that sets an 'int' attribute to a
+    // value and records the identifier of the attribute.
+
+    // DATA
+    int d_value;   // value to set
+    int d_lastId;  // identifier of the last attribute manipulated
+
+    // MANIPULATORS
+    int operator()(int *attribute, const bdlat_AttributeInfo& info)
+        // Set the specified 'attribute' to 'd_value', record the identifier
+        // in the specified 'info', and return 0.
+    {
+        *attribute = d_value;
+        d_lastId   = info.d_id;
+        return 0;
+    }
+
+    template <class TYPE>
+    int operator()(TYPE *, const bdlat_AttributeInfo&)
+        // Return -1.
+    {
+        return -1;
+    }
+};
+
+enum Mood {
+    // This enumeration models a basic "enumeration" type providing its
+    // 'bdlat' enumeration functions directly, without a wrapper 'struct'.
+
+    e_CALM,
+    e_BUSY
+};
+
+struct ConcurrencyTag {
+    // This 'struct' identifies the cached index used only by the concurrency
+    // test.
+};
+
+}  // close namespace test
+
+namespace BloombergLP {
+
+template <>
+struct bdlat_IsBasicEnumeration<test::Color::Value> : bsl::true_type {
+};
+
+template <>
+struct bdlat_BasicEnumerationWrapper<test::Color::Value> : test::Color {
+    typedef test::Color Wrapper;
+};
+
+template <>
+struct bdlat_IsBasicEnumeration<test::Shade::Value> : bsl::true_type {
+};
+
+template <>
+struct bdlat_IsBasicEnumeration<test::Mood> : bsl::true_type {
+};
+
+template <>
+struct bdlat_BasicEnumerationWrapper<test::Shade::Value> : test::Shade {
+    typedef test::Shade Wrapper;
+};
+
+}  // close enterprise namespace
+
+// ============================================================================
+//                          HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+int linearFind(const bsl::vector<bdlat_EnumeratorInfo>&  infos,
+               const char                               *name,
+               int                                       nameLength)
+    // Return the position of the first element of the specified 'infos'
+    // having the specified 'name' of the specified 'nameLength', or -1 if
+    // there is none.
+{
+    for (bsl::size_t i = 0; i < infos.size(); ++i) {
+        if (nameLength == infos[i].d_nameLength
+         && 0 == bsl::memcmp(infos[i].d_name_p, name, nameLength)) {
+            return static_cast<int>(i);                               // RETURN
+        }
+    }
+    return -1;
+}
+
+void makeInfos(bsl::vector<bdlat_EnumeratorInfo> *infos,
+               const bsl::vector<bsl::string>&    names)
+    // Load into the specified 'infos' one element for each of the specified
+    // 'names', referring to the characters of 'names'.
+{
+    infos->clear();
+    for (bsl::size_t i = 0; i < names.size(); ++i) {
+        bdlat_EnumeratorInfo info = { static_cast<int>(i),
+                                      names[i].data(),
+                                      static_cast<int>(names[i].length()),
+                                      "" };
+        infos->push_back(info);
+    }
+}
+
+extern "C" void *concurrentLookup(void *arg)
+    // Wait on the 'bslmt::Barrier' at the specified 'arg', then look up every
+    // name of 'test::Record' through the index cached for
+    // 'test::ConcurrencyTag', and return 0 if every lookup succeeds, and a
+    // non-zero value otherwise.
+{
+    static_cast<bslmt::Barrier *>(arg)->wait();
+
+    const Obj& index = bdlat::NameIndex_Cache<test::ConcurrencyTag,
+                                              bdlat_AttributeInfo>::index(
+                                           test::Record::ATTRIBUTE_INFO_ARRAY,
+                                           test::Record::NUM_ATTRIBUTES);
+
+    bsl::size_t numFailures = 0;
+    for (int i = 0; i < test::Record::NUM_ATTRIBUTES; ++i) {
+        const bdlat_AttributeInfo& info =
+                                         test::Record::ATTRIBUTE_INFO_ARRAY[i];
+        numFailures += i != index.find(info.d_name_p, info.d_nameLength);
+    }
+    return reinterpret_cast<void *>(numFailures);
+}
+
+// ============================================================================
+//                          PERFORMANCE TEST HELPERS
+// ----------------------------------------------------------------------------
+
+static unsigned s_antiOptimization = 0;
+
+template <class FUNCTOR>
+double medianTime(FUNCTOR functor, int numIterations)
+    // Return the median elapsed time, in seconds, of several trials each
+    // invoking the specified 'functor' the specified 'numIterations' times.
+{
+    enum { k_NUM_TRIALS = 11 };
+
+    bsl::vector<double> times;
+    for (int trial = 0; trial < k_NUM_TRIALS; ++trial) {
+        bsls::Stopwatch timer;
+        timer.start();
+        for (int i = 0; i < numIterations; ++i) {
+            s_antiOptimization += functor();
+        }
+        timer.stop();
+        times.push_back(timer.accumulatedWallTime());
+    }
+    bsl::sort(times.begin(), times.end());
+    return times[k_NUM_TRIALS / 2];
+}
+
+struct LinearLookups {
+    // This 'struct' provides a functor that looks up every name in a table
+    // by linear scan.
+
+    // DATA
+    const bsl::vector<bdlat_EnumeratorInfo> *d_infos_p;
+
+    // ACCESSORS
+    unsigned operator()() const
+        // Look up every name, and return the sum of the positions found.
+    {
+        unsigned sum = 0;
+        for (bsl::size_t i = 0; i < d_infos_p->size(); ++i) {
+            const bdlat_EnumeratorInfo& info = (*d_infos_p)[i];
+            sum += linearFind(*d_infos_p, info.d_name_p, info.d_nameLength);
+        }
+        return sum;
+    }
+};
+
+struct IndexLookups {
+    // This 'struct' provides a functor that looks up every name in a table
+    // through a 'bdlat::NameIndex'.
+
+    // DATA
+    const bsl::vector<bdlat_EnumeratorInfo> *d_infos_p;
+    const Obj                               *d_index_p;
+
+    // ACCESSORS
+    unsigned operator()() const
+        // Look up every name, and return the sum of the positions found.
+    {
+        unsigned sum = 0;
+        for (bsl::size_t i = 0; i < d_infos_p->size(); ++i) {
+            const bdlat_EnumeratorInfo& info = (*d_infos_p)[i];
+            sum += d_index_p->find(info.d_name_p, info.d_nameLength);
+        }
+        return sum;
+    }
+};
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Indexing an Array of Enumerator Information
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have an array of enumerator information describing the colors
+// of a palette, and we want to find enumerators by name.
+//
+// First, we define the array:
+//..
+    const bdlat_EnumeratorInfo COLORS[] = {
+        { 0, "RED",   3, "" },
+        { 1, "GREEN", 5, "" },
+        { 2, "BLUE",  4, "" },
+    };
+//..
+// Then, we build an index of the names in the array:
+//..
+    bdlat::NameIndex index(COLORS, 3);
+    ASSERT(3 == index.numNames());
+//..
+// Finally, we look up names, obtaining their positions in 'COLORS', or -1 for
+// names that are not in the array:
+//..
+    ASSERT( 1 == index.find("GREEN", 5));
+    ASSERT( 2 == index.find("BLUE",  4));
+    ASSERT(-1 == index.find("BLUEISH", 7));
+    ASSERT(-1 == index.find("GREEN", 4));
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENT FIRST USE
+        //
+        // Concerns:
+        //: 1 When several threads use a cached index for the first time
+        //:   concurrently, exactly one index is built, and every thread
+        //:   observes it fully built.
+        //
+        // Plan:
+        //: 1 Release several threads from a barrier to look up every name
+        //:   through a cached index that has not been used before, and verify
+        //:   that every lookup succeeds and that every thread obtains the same
+        //:   index.  (C-1)
+        //
+        // Testing:
+        //   CONCURRENT FIRST USE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT FIRST USE" << endl
+                          << "====================" << endl;
+
+        enum { k_NUM_THREADS = 8 };
+
+        bslmt::Barrier                 barrier(k_NUM_THREADS);
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERTV(i, 0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      concurrentLookup,
+                                                      &barrier));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            void *result = 0;
+            ASSERTV(i, 0 == bslmt::ThreadUtil::join(handles[i], &result));
+            ASSERTV(i, 0 == result);
+        }
+
+        const Obj& index = bdlat::NameIndex_Cache<test::ConcurrencyTag,
+                                                  bdlat_AttributeInfo>::index(
+                                           test::Record::ATTRIBUTE_INFO_ARRAY,
+                                           test::Record::NUM_ATTRIBUTES);
+        const Obj& again = bdlat::NameIndex_Cache<test::ConcurrencyTag,
+                                                  bdlat_AttributeInfo>::index(
+                                           test::Record::ATTRIBUTE_INFO_ARRAY,
+                                           test::Record::NUM_ATTRIBUTES);
+        ASSERT(&index == &again);
+        ASSERT(test::Record::NUM_ATTRIBUTES == index.numNames());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'manipulateAttribute', 'hasAttribute', AND 'fromString'
+        //
+        // Concerns:
+        //: 1 For a name in the information array of a type, each function has
+        //:   the same result as the corresponding name-based 'bdlat' function,
+        //:   without calling that function.
+        //:
+        //: 2 For a name not in the array, and for any name of a type without
+        //:   an array, each function defers to the corresponding name-based
+        //:   'bdlat' function, so that names that only it resolves are still
+        //:   resolved.
+        //:
+        //: 3 Unknown names are reported as such, and 'fromString' leaves its
+        //:   'result' unchanged for them.
+        //
+        // Plan:
+        //: 1 Using 'test::Record', 'test::Point', 'test::Color', and
+        //:   'test::Shade', call each function for known, alias, and unknown
+        //:   names, verifying the effect and the number of name-based lookups
+        //:   performed by the type.  (C-1..3)
+        //
+        // Testing:
+        //   int manipulateAttribute(TYPE *, MANIPULATOR&, const char *, int);
+        //   bool hasAttribute(const TYPE&, const char *, int);
+        //   int fromString(TYPE *result, const char *string, int length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'manipulateAttribute', 'hasAttribute', AND "
+                          << "'fromString'" << endl
+                          << "==========================================="
+                          << "============" << endl;
+
+        if (verbose) cout << "\nSequence with an attribute table." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_name;
+                int         d_index;    // index of attribute set, or -1
+                int         d_lookups;  // expected name-based lookups
+            } DATA[] = {
+                //LINE  NAME       INDEX  LOOKUPS
+                //----  ----       -----  -------
+                { L_,   "alpha",       0,       0 },
+                { L_,   "beta",        1,       0 },
+                { L_,   "gamma",       2,       0 },
+                { L_,   "delta",       3,       0 },
+                { L_,   "alias",       0,       1 },
+                { L_,   "Alpha",      -1,       1 },
+                { L_,   "alph",       -1,       1 },
+                { L_,   "",           -1,       1 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE    = DATA[ti].d_line;
+                const char *NAME    = DATA[ti].d_name;
+                const int   LENGTH  = static_cast<int>(bsl::strlen(NAME));
+                const int   INDEX   = DATA[ti].d_index;
+                const int   LOOKUPS = DATA[ti].d_lookups;
+
+                if (veryVerbose) { T_ P_(LINE) P(NAME) }
+
+                test::Record         mX;
+                const test::Record&  X = mX;
+                test::SetManipulator manipulator = { 100 + ti, 0 };
+
+                test::Record::s_numNameLookups = 0;
+
+                const int rc = Util::manipulateAttribute(&mX,
+                                                         manipulator,
+                                                         NAME,
+                                                         LENGTH);
+
+                ASSERTV(LINE, rc, (0 <= INDEX) == (0 == rc));
+                ASSERTV(LINE, LOOKUPS == test::Record::s_numNameLookups);
+                for (int i = 0; i < test::Record::NUM_ATTRIBUTES; ++i) {
+                    ASSERTV(LINE, i, (i == INDEX ? 100 + ti : 0)
+                                                              == X.value(i));
+                }
+                if (0 <= INDEX) {
+                    ASSERTV(LINE,
+                            test::Record::ATTRIBUTE_INFO_ARRAY[INDEX].d_id
+                                                     == manipulator.d_lastId);
+                }
+
+                test::Record::s_numNameLookups = 0;
+
+                ASSERTV(LINE, (0 <= INDEX) == Util::hasAttribute(X,
+                                                                 NAME,
+                                                                 LENGTH));
+                ASSERTV(LINE, LOOKUPS == test::Record::s_numNameLookups);
+                ASSERTV(LINE, bdlat_SequenceFunctions::hasAttribute(X,
+                                                                    NAME,
+                                                                    LENGTH)
+                              == Util::hasAttribute(X, NAME, LENGTH));
+            }
+        }
+
+        if (verbose) cout << "\nSequence without an attribute table." << endl;
+        {
+            test::Point          mX;
+            const test::Point&   X = mX;
+            test::SetManipulator manipulator = { 7, 0 };
+
+            test::Point::s_numNameLookups = 0;
+
+            ASSERT(0 == Util::manipulateAttribute(&mX, manipulator, "x", 1));
+            ASSERT(7 == X.x());
+            ASSERT(1 == test::Point::s_numNameLookups);
+
+            ASSERT(0 != Util::manipulateAttribute(&mX, manipulator, "y", 1));
+            ASSERT(2 == test::Point::s_numNameLookups);
+
+            ASSERT( Util::hasAttribute(X, "x", 1));
+            ASSERT(!Util::hasAttribute(X, "y", 1));
+            ASSERT(4 == test::Point::s_numNameLookups);
+        }
+
+        if (verbose) cout << "\nEnumerations." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_name;
+                int         d_value;    // enumerator value, or -1
+            } DATA[] = {
+                //LINE  NAME       VALUE
+                //----  ----       -----
+                { L_,   "RED",         1 },
+                { L_,   "GREEN",       2 },
+                { L_,   "BLUE",        4 },
+                { L_,   "BLU",        -1 },
+                { L_,   "red",        -1 },
+                { L_,   "",           -1 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE   = DATA[ti].d_line;
+                const char *NAME   = DATA[ti].d_name;
+                const int   LENGTH = static_cast<int>(bsl::strlen(NAME));
+                const int   VALUE  = DATA[ti].d_value;
+
+                if (veryVerbose) { T_ P_(LINE) P(NAME) }
+
+                test::Color::Value value = test::Color::e_GREEN;
+                test::Color::s_numFromString = 0;
+
+                const int rc = Util::fromString(&value, NAME, LENGTH);
+
+                ASSERTV(LINE, (0 <= VALUE) == (0 == rc));
+                ASSERTV(LINE, (0 <= VALUE ? VALUE : test::Color::e_GREEN)
+                                                                     == value);
+                ASSERTV(LINE, (0 <= VALUE ? 0 : 1)
+                                              == test::Color::s_numFromString);
+            }
+
+            test::Shade::Value value = test::Shade::e_LIGHT;
+            test::Shade::s_numFromString = 0;
+
+            ASSERT(0 == Util::fromString(&value, "DARK", 4));
+            ASSERT(test::Shade::e_DARK == value);
+            ASSERT(0 != Util::fromString(&value, "DIM", 3));
+            ASSERT(test::Shade::e_DARK == value);
+            ASSERT(2 == test::Shade::s_numFromString);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'lookupAttributeInfo' AND 'lookupEnumeratorInfo'
+        //
+        // Concerns:
+        //: 1 For a type having an information array, the functions return the
+        //:   address of the element of that array having the given name, or 0
+        //:   if there is none.
+        //:
+        //: 2 For a type without an information array, including a basic
+        //:   enumeration without a wrapper, the functions return 0.
+        //:
+        //: 3 The index is built once, and memory is not obtained from the
+        //:   default or global allocators.
+        //
+        // Plan:
+        //: 1 Look up every name of 'test::Record' and 'test::Color', and
+        //:   several other names, verifying the addresses returned.  (C-1)
+        //:
+        //: 2 Look up names of 'test::Point', 'test::Shade', and 'test::Mood'.
+        //:   (C-2)
+        //:
+        //: 3 Verify that the default and global allocators are unused.  (C-3)
+        //
+        // Testing:
+        //   const bdlat_AttributeInfo *lookupAttributeInfo<TYPE>(name, len);
+        //   const bdlat_EnumeratorInfo *lookupEnumeratorInfo<TYPE>(name, len);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'lookupAttributeInfo' AND "
+                          << "'lookupEnumeratorInfo'" << endl
+                          << "==========================="
+                          << "======================" << endl;
+
+        for (int round = 0; round < 2; ++round) {
+            for (int i = 0; i < test::Record::NUM_ATTRIBUTES; ++i) {
+                const bdlat_AttributeInfo& INFO =
+                                         test::Record::ATTRIBUTE_INFO_ARRAY[i];
+
+                ASSERTV(round, i, &INFO ==
+                              Util::lookupAttributeInfo<test::Record>(
+                                                           INFO.d_name_p,
+                                                           INFO.d_nameLength));
+            }
+            ASSERT(0 == Util::lookupAttributeInfo<test::Record>("alias", 5));
+            ASSERT(0 == Util::lookupAttributeInfo<test::Record>("alph",  4));
+            ASSERT(0 == Util::lookupAttributeInfo<test::Record>("",      0));
+
+            for (int i = 0; i < test::Color::NUM_ENUMERATORS; ++i) {
+                const bdlat_EnumeratorInfo& INFO =
+                                         test::Color::ENUMERATOR_INFO_ARRAY[i];
+
+                ASSERTV(round, i, &INFO ==
+                         Util::lookupEnumeratorInfo<test::Color::Value>(
+                                                           INFO.d_name_p,
+                                                           INFO.d_nameLength));
+            }
+            ASSERT(0 == Util::lookupEnumeratorInfo<test::Color::Value>("RE",
+                                                                       2));
+
+            ASSERT(0 == Util::lookupAttributeInfo<test::Point>("x", 1));
+            ASSERT(0 == Util::lookupEnumeratorInfo<test::Shade::Value>("DARK",
+                                                                       4));
+            ASSERT(0 == Util::lookupEnumeratorInfo<test::Mood>("e_CALM", 6));
+            ASSERT(0 == Util::lookupAttributeInfo<int>("x", 1));
+            ASSERT(0 == Util::lookupEnumeratorInfo<int>("x", 1));
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+        ASSERT(0 == globalAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING TABLE DETECTION
+        //
+        // Concerns:
+        //: 1 'NameIndex_HasAttributeTable' and 'NameIndex_HasEnumeratorTable'
+        //:   are 'true' exactly for types having a public static information
+        //:   array of the corresponding type and a count constant.
+        //:
+        //: 2 'NameIndex_HasEnumerationWrapper' is 'true' exactly for types for
+        //:   which 'bdlat_BasicEnumerationWrapper' is specialized.
+        //:
+        //: 3 The detection compiles for fundamental and enumerated types.
+        //
+        // Plan:
+        //: 1 Verify the value of each metafunction for the test types, for
+        //:   'int', and for an 'enum'.  (C-1..3)
+        //
+        // Testing:
+        //   TESTING TABLE DETECTION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING TABLE DETECTION" << endl
+                          << "=======================" << endl;
+
+        ASSERT( bdlat::NameIndex_HasAttributeTable<test::Record>::value);
+        ASSERT(!bdlat::NameIndex_HasAttributeTable<test::Point>::value);
+        ASSERT(!bdlat::NameIndex_HasAttributeTable<test::Color>::value);
+        ASSERT(!bdlat::NameIndex_HasAttributeTable<int>::value);
+        ASSERT(!bdlat::NameIndex_HasAttributeTable<
+                                               test::Color::Value>::value);
+
+        ASSERT( bdlat::NameIndex_HasEnumeratorTable<test::Color>::value);
+        ASSERT(!bdlat::NameIndex_HasEnumeratorTable<test::Shade>::value);
+        ASSERT(!bdlat::NameIndex_HasEnumeratorTable<test::Record>::value);
+        ASSERT(!bdlat::NameIndex_HasEnumeratorTable<int>::value);
+        ASSERT(!bdlat::NameIndex_HasEnumeratorTable<
+                                               test::Color::Value>::value);
+
+        ASSERT( bdlat::NameIndex_HasEnumerationWrapper<
+                                               test::Color::Value>::value);
+        ASSERT( bdlat::NameIndex_HasEnumerationWrapper<
+                                               test::Shade::Value>::value);
+        ASSERT(!bdlat::NameIndex_HasEnumerationWrapper<test::Mood>::value);
+        ASSERT(!bdlat::NameIndex_HasEnumerationWrapper<test::Color>::value);
+        ASSERT(!bdlat::NameIndex_HasEnumerationWrapper<int>::value);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'NameIndex'
+        //
+        // Concerns:
+        //: 1 'find' returns, for every name, the position of the first element
+        //:   of the array having that name, and -1 for names not in the
+        //:   array, including prefixes and extensions of names in the array,
+        //:   and the empty name unless it is in the array.
+        //:
+        //: 2 'numNames' returns the number of distinct names.
+        //:
+        //: 3 The index works for arrays of every size, including 0, and for
+        //:   each of the 'bdlat' information types.
+        //:
+        //: 4 Memory is obtained from the supplied allocator, or the default
+        //:   allocator if none is supplied, and is released on destruction.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each prefix of a table of names with duplicates, build an
+        //:   index and compare 'find' with a linear scan for every name, and
+        //:   every name with a character removed or appended.  (C-1..3)
+        //:
+        //: 2 For arrays of up to 300 generated names, compare 'find' with a
+        //:   linear scan.  (C-1..3)
+        //:
+        //: 3 Build indexes of 'bdlat_AttributeInfo' and 'bdlat_SelectionInfo'
+        //:   arrays.  (C-3)
+        //:
+        //: 4 Monitor the supplied and default test allocators.  (C-4)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   NameIndex(const INFO *infos, int numInfos, Allocator *bA = 0);
+        //   ~NameIndex();
+        //   int find(const char *name, int nameLength) const;
+        //   int numNames() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'NameIndex'" << endl
+                          << "===========" << endl;
+
+        if (verbose) cout << "\nTable of names." << endl;
+        {
+            static const char *const NAMES[] = {
+                "a", "b", "ab", "ba", "abc", "", "a", "name", "names",
+                "Name", "ab", "x_y", "x-y", "\xff\x01", "long_attribute_name",
+                "long_attribute_nam", "long_attribute_name_"
+            };
+            const int NUM_NAMES = static_cast<int>(sizeof NAMES
+                                                   / sizeof *NAMES);
+
+            for (int n = 0; n <= NUM_NAMES; ++n) {
+                bsl::vector<bsl::string> names(NAMES, NAMES + n);
+
+                bsl::vector<bdlat_EnumeratorInfo> infos;
+                makeInfos(&infos, names);
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+                {
+                    const Obj X(infos.data(), n, &oa);
+
+                    ASSERTV(n, &oa == X.allocator());
+
+                    bsl::vector<bsl::string> distinct(names);
+                    bsl::sort(distinct.begin(), distinct.end());
+                    distinct.erase(bsl::unique(distinct.begin(),
+                                               distinct.end()),
+                                   distinct.end());
+                    ASSERTV(n, static_cast<int>(distinct.size())
+                                                           == X.numNames());
+
+                    for (int i = 0; i < NUM_NAMES; ++i) {
+                        const bsl::string NAME(NAMES[i]);
+                        const int         LENGTH =
+                                            static_cast<int>(NAME.length());
+
+                        ASSERTV(n, i, linearFind(infos, NAME.data(), LENGTH)
+                                      == X.find(NAME.data(), LENGTH));
+
+                        const bsl::string LONGER = NAME + "z";
+                        ASSERTV(n, i, linearFind(infos,
+                                                 LONGER.data(),
+                                                 LENGTH + 1)
+                                      == X.find(LONGER.data(), LENGTH + 1));
+
+                        if (0 < LENGTH) {
+                            ASSERTV(n, i, linearFind(infos,
+                                                     NAME.data(),
+                                                     LENGTH - 1)
+                                          == X.find(NAME.data(), LENGTH - 1));
+                        }
+                    }
+                }
+                ASSERTV(n, 0 == oa.numBlocksInUse());
+                ASSERTV(n, 0 < oa.numBlocksTotal());
+            }
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nGenerated names." << endl;
+        {
+            bsl::vector<bsl::string> names;
+            for (int i = 0; i < 300; ++i) {
+                bsl::string name("attribute");
+                name += static_cast<char>('a' + i % 26);
+                name += static_cast<char>('a' + i / 26);
+                names.push_back(name);
+            }
+
+            for (int n = 0; n <= 300; n += 1 + n / 4) {
+                bsl::vector<bsl::string> prefix(names.begin(),
+                                                names.begin() + n);
+
+                bsl::vector<bdlat_EnumeratorInfo> infos;
+                makeInfos(&infos, prefix);
+
+                const Obj X(infos.data(), n);
+
+                ASSERTV(n, n == X.numNames());
+                ASSERTV(n, &defaultAllocator == X.allocator());
+
+                for (int i = 0; i < 300; ++i) {
+                    ASSERTV(n, i, (i < n ? i : -1) == X.find(
+                                    names[i].data(),
+                                    static_cast<int>(names[i].length())));
+                }
+            }
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nOther information types." << endl;
+        {
+            const bdlat_AttributeInfo ATTRIBUTES[] = {
+                { 5, "first",  5, "", 0 },
+                { 9, "second", 6, "", 0 },
+            };
+            const bdlat_SelectionInfo SELECTIONS[] = {
+                { 3, "one", 3, "", 0 },
+                { 4, "two", 3, "", 0 },
+            };
+
+            const Obj A(ATTRIBUTES, 2);
+            ASSERT( 1 == A.find("second", 6));
+            ASSERT(-1 == A.find("third",  5));
+
+            const Obj S(SELECTIONS, 2);
+            ASSERT( 0 == S.find("one", 3));
+            ASSERT(-1 == S.find("six", 3));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bdlat_EnumeratorInfo *NULL_INFOS = 0;
+
+            ASSERT_PASS(Obj(NULL_INFOS, 0));
+            ASSERT_FAIL(Obj(NULL_INFOS, 1));
+            ASSERT_FAIL(Obj(test::Color::ENUMERATOR_INFO_ARRAY, -1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Build an index of the enumerators of 'test::Color' and find
+        //:   names in it, then resolve attribute and enumerator names through
+        //:   'NameIndexUtil'.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const Obj X(test::Color::ENUMERATOR_INFO_ARRAY,
+                    test::Color::NUM_ENUMERATORS);
+
+        ASSERT( 3 == X.numNames());
+        ASSERT( 0 == X.find("RED",   3));
+        ASSERT( 1 == X.find("GREEN", 5));
+        ASSERT( 2 == X.find("BLUE",  4));
+        ASSERT(-1 == X.find("PINK",  4));
+
+        test::Record         record;
+        test::SetManipulator manipulator = { 42, 0 };
+
+        ASSERT(0  == Util::manipulateAttribute(&record,
+                                               manipulator,
+                                               "gamma",
+                                               5));
+        ASSERT(42 == record.value(2));
+        ASSERT(Util::hasAttribute(record, "delta", 5));
+
+        test::Color::Value color = test::Color::e_RED;
+        ASSERT(0 == Util::fromString(&color, "BLUE", 4));
+        ASSERT(test::Color::e_BLUE == color);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Looking up names through an index is faster than a linear scan,
+        //:   increasingly so as the number of names grows.
+        //
+        // Plan:
+        //: 1 For tables of several sizes, or of the size given as the second
+        //:   command-line argument, time looking up every name by linear scan
+        //:   and through an index, and report the rate of each.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int ARG     = argc > 2 ? atoi(argv[2]) : 0;
+        const int SIZES[] = { 4, 16, 64, 256 };
+        const int NUM_SIZES = 0 < ARG
+                            ? 1
+                            : static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        cout << "names  linear(M/s)  index(M/s)" << endl;
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int NUM_NAMES = 0 < ARG ? ARG : SIZES[si];
+
+            bsl::vector<bsl::string> names;
+            for (int i = 0; i < NUM_NAMES; ++i) {
+                bsl::string name("fieldName");
+                for (int n = i; 0 < n; n /= 26) {
+                    name += static_cast<char>('a' + n % 26);
+                }
+                names.push_back(name);
+            }
+
+            bsl::vector<bdlat_EnumeratorInfo> infos;
+            makeInfos(&infos, names);
+
+            const Obj index(infos.data(), NUM_NAMES);
+
+            const int ITERATIONS = bsl::max(1, 200000 / NUM_NAMES);
+
+            LinearLookups linear  = { &infos };
+            IndexLookups  indexed = { &infos, &index };
+
+            const double linearTime  = medianTime(linear,  ITERATIONS);
+            const double indexedTime = medianTime(indexed, ITERATIONS);
+
+            const double MILLIONS = static_cast<double>(NUM_NAMES)
+                                  * ITERATIONS / 1e6;
+
+            cout << NUM_NAMES << "  " << MILLIONS / linearTime
+                 << "  " << MILLIONS / indexedTime << endl;
+        }
+
+        if (veryVerbose) {
+            P(s_antiOptimization);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,336 @@
+// bdlbb_blobioutil.cpp                                               -*-C++-*-
+#include <bdlbb_blobioutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlbb_blobioutil_cpp, "$Id$ $CSID$")
+
+#include <bdlbb_blobutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+#include <errno.h>
+#include <limits.h>
+#include <sys/uio.h>
+#endif
+
+///Implementation Notes
+///--------------------
+// A transfer is described by a 'Cursor', identifying the buffer of the blob
+// and the offset within it at which the transfer starts.  Each system call is
+// given the (at most 'k_MAX_IOVECS') non-empty buffer segments following the
+// cursor, and the cursor is then advanced by the number of bytes actually
+// transferred.  The complete 'read' and 'write' operations therefore walk the
+// buffers of the blob exactly once, irrespective of the number of partial
+// transfers.
+//
+// 'read' grows the blob to its final length before the first system call, so
+// that all the buffers needed are obtained from the factory at once, and
+// trims it back to the number of bytes actually read at the end.  Shrinking a
+// blob retains its buffers, so no buffer is obtained twice.
+
+namespace BloombergLP {
+namespace {
+
+typedef bdlbb::BlobIoUtil::FileDescriptor FileDescriptor;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+struct IoVec {
+    // This 'struct' describes one contiguous segment of a transfer, with the
+    // same members as the POSIX 'iovec'.
+
+    void        *iov_base;
+    bsl::size_t  iov_len;
+};
+
+enum { k_MAX_IOVECS = 1 };  // each system call transfers a single segment
+#else
+typedef ::iovec IoVec;
+
+#if defined(IOV_MAX) && IOV_MAX < 64
+enum { k_MAX_IOVECS = IOV_MAX };
+#else
+enum { k_MAX_IOVECS = bdlbb::BlobIoUtil::k_MAX_BUFFERS_PER_CALL };
+#endif
+#endif
+
+struct Cursor {
+    // This 'struct' identifies a byte position in a blob by the index of the
+    // buffer holding it and its offset within that buffer.
+
+    int d_index;   // buffer index
+    int d_offset;  // offset within the buffer
+};
+
+// HELPER FUNCTIONS
+bool isInterrupted()
+    // Return 'true' if the last failed system call was interrupted by a
+    // signal before transferring any data, and 'false' otherwise.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return false;
+#else
+    return EINTR == errno;
+#endif
+}
+
+Cursor cursorAt(const bdlbb::Blob& blob, int position)
+    // Return the cursor of the specified 'position' in the specified 'blob'.
+    // The behavior is undefined unless '0 <= position < blob.totalSize()'.
+{
+    bsl::pair<int, int> place =
+                  bdlbb::BlobUtil::findBufferIndexAndOffset(blob, position);
+    Cursor cursor = { place.first, place.second };
+    return cursor;
+}
+
+Cursor endCursor(const bdlbb::Blob& blob)
+    // Return the cursor of the first byte following the data of the specified
+    // 'blob', which is the byte at which appended data starts.  Note that the
+    // returned cursor may address the end of a buffer, or a buffer index equal
+    // to 'blob.numBuffers()', if 'blob' has no capacity beyond its length.
+{
+    Cursor cursor = { 0, 0 };
+    if (0 < blob.numDataBuffers()) {
+        cursor.d_index  = blob.numDataBuffers() - 1;
+        cursor.d_offset = blob.lastDataBufferLength();
+    }
+    return cursor;
+}
+
+int loadIoVecs(IoVec              *iovecs,
+               const bdlbb::Blob&  blob,
+               Cursor              cursor,
+               int                 numBytes)
+    // Load into the specified 'iovecs' the non-empty segments of the
+    // specified 'blob' holding the specified 'numBytes' bytes starting at the
+    // specified 'cursor', stopping after 'k_MAX_IOVECS' segments.  Return the
+    // number of segments loaded.  The behavior is undefined unless
+    // '0 < numBytes', 'iovecs' has room for 'k_MAX_IOVECS' elements, and the
+    // buffers of 'blob' hold at least 'numBytes' bytes following 'cursor'.
+{
+    int numIoVecs = 0;
+    while (0 < numBytes && numIoVecs < k_MAX_IOVECS) {
+        BSLS_ASSERT(cursor.d_index < blob.numBuffers());
+
+        const bdlbb::BlobBuffer& buffer = blob.buffer(cursor.d_index);
+        const int length = bsl::min(buffer.size() - cursor.d_offset,
+                                    numBytes);
+        if (0 < length) {
+            iovecs[numIoVecs].iov_base = buffer.data() + cursor.d_offset;
+            iovecs[numIoVecs].iov_len  = length;
+            ++numIoVecs;
+            numBytes -= length;
+        }
+        ++cursor.d_index;
+        cursor.d_offset = 0;
+    }
+    return numIoVecs;
+}
+
+void advance(Cursor *cursor, const bdlbb::Blob& blob, int numBytes)
+    // Advance the specified 'cursor' over the specified 'numBytes' bytes of
+    // the specified 'blob'.  The behavior is undefined unless the buffers of
+    // 'blob' hold at least 'numBytes' bytes following 'cursor'.
+{
+    while (0 < numBytes) {
+        const int remaining = blob.buffer(cursor->d_index).size()
+                                                           - cursor->d_offset;
+        if (numBytes < remaining) {
+            cursor->d_offset += numBytes;
+            return;                                                   // RETURN
+        }
+        numBytes -= remaining;
+        ++cursor->d_index;
+        cursor->d_offset = 0;
+    }
+}
+
+int readSegments(FileDescriptor  descriptor,
+                 const IoVec    *iovecs,
+                 int             numIoVecs)
+    // Read from the specified 'descriptor' into the specified 'numIoVecs'
+    // segments described by the specified 'iovecs' with a single system call.
+    // Return the number of bytes read, 0 at end-of-file, and a negative value
+    // on error.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    (void)numIoVecs;
+    return bdls::FilesystemUtil::read(descriptor,
+                                      iovecs[0].iov_base,
+                                      static_cast<int>(iovecs[0].iov_len));
+#else
+    return static_cast<int>(::readv(descriptor, iovecs, numIoVecs));
+#endif
+}
+
+int writeSegments(FileDescriptor  descriptor,
+                  const IoVec    *iovecs,
+                  int             numIoVecs)
+    // Write to the specified 'descriptor' the specified 'numIoVecs' segments
+    // described by the specified 'iovecs' with a single system call.  Return
+    // the number of bytes written, and a negative value on error.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    (void)numIoVecs;
+    return bdls::FilesystemUtil::write(descriptor,
+                                       iovecs[0].iov_base,
+                                       static_cast<int>(iovecs[0].iov_len));
+#else
+    return static_cast<int>(::writev(descriptor, iovecs, numIoVecs));
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bdlbb {
+
+                              // -----------------
+                              // struct BlobIoUtil
+                              // -----------------
+
+// CLASS METHODS
+int BlobIoUtil::read(Blob *blob, FileDescriptor descriptor, int numBytes)
+{
+    BSLS_ASSERT(blob);
+    BSLS_ASSERT(0 <= numBytes);
+
+    if (0 == numBytes) {
+        return 0;                                                     // RETURN
+    }
+
+    const int oldLength = blob->length();
+    Cursor    cursor    = endCursor(*blob);
+
+    blob->setLength(oldLength + numBytes);
+
+    IoVec iovecs[k_MAX_IOVECS];
+    int   numRead = 0;
+    int   rc      = 0;
+    while (numRead < numBytes) {
+        const int numIoVecs = loadIoVecs(iovecs,
+                                         *blob,
+                                         cursor,
+                                         numBytes - numRead);
+
+        rc = readSegments(descriptor, iovecs, numIoVecs);
+        if (0 < rc) {
+            numRead += rc;
+            advance(&cursor, *blob, rc);
+        }
+        else if (0 == rc || !isInterrupted()) {
+            break;
+        }
+    }
+
+    blob->setLength(oldLength + numRead);
+
+    return 0 <= rc ? numRead : rc;
+}
+
+int BlobIoUtil::readSome(Blob           *blob,
+                         FileDescriptor  descriptor,
+                         int             maxNumBytes)
+{
+    BSLS_ASSERT(blob);
+    BSLS_ASSERT(0 < maxNumBytes);
+
+    const int    oldLength = blob->length();
+    const Cursor cursor    = endCursor(*blob);
+
+    blob->setLength(oldLength + maxNumBytes);
+
+    IoVec     iovecs[k_MAX_IOVECS];
+    const int numIoVecs = loadIoVecs(iovecs, *blob, cursor, maxNumBytes);
+    const int rc        = readSegments(descriptor, iovecs, numIoVecs);
+
+    blob->setLength(oldLength + bsl::max(rc, 0));
+
+    return rc;
+}
+
+int BlobIoUtil::write(FileDescriptor  descriptor,
+                      const Blob&     blob,
+                      int             position,
+                      int             numBytes)
+{
+    BSLS_ASSERT(0 <= position);
+    BSLS_ASSERT(0 <= numBytes);
+    BSLS_ASSERT(position <= blob.length() - numBytes);
+
+    if (0 == numBytes) {
+        return 0;                                                     // RETURN
+    }
+
+    Cursor cursor     = cursorAt(blob, position);
+    int    numWritten = 0;
+
+    IoVec iovecs[k_MAX_IOVECS];
+    while (numWritten < numBytes) {
+        const int numIoVecs = loadIoVecs(iovecs,
+                                         blob,
+                                         cursor,
+                                         numBytes - numWritten);
+
+        const int rc = writeSegments(descriptor, iovecs, numIoVecs);
+        if (0 < rc) {
+            numWritten += rc;
+            advance(&cursor, blob, rc);
+        }
+        else if (0 == rc) {
+            // No progress, and no error reported: give up rather than spin.
+
+            return -1;                                                // RETURN
+        }
+        else if (!isInterrupted()) {
+            return rc;                                                // RETURN
+        }
+    }
+
+    return numWritten;
+}
+
+int BlobIoUtil::writeSome(FileDescriptor  descriptor,
+                          const Blob&     blob,
+                          int             position,
+                          int             numBytes)
+{
+    BSLS_ASSERT(0 <= position);
+    BSLS_ASSERT(0 <= numBytes);
+    BSLS_ASSERT(position <= blob.length() - numBytes);
+
+    if (0 == numBytes) {
+        return 0;                                                     // RETURN
+    }
+
+    IoVec     iovecs[k_MAX_IOVECS];
+    const int numIoVecs = loadIoVecs(iovecs,
+                                     blob,
+                                     cursorAt(blob, position),
+                                     numBytes);
+
+    return writeSegments(descriptor, iovecs, numIoVecs);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,266 @@
+// bdlbb_blobioutil.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLBB_BLOBIOUTIL
+#define INCLUDED_BDLBB_BLOBIOUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide scatter/gather I/O between blobs and file descriptors.
+//
+//@CLASSES:
+//  bdlbb::BlobIoUtil: utilities for reading and writing blobs without copying
+//
+//@SEE_ALSO: bdlbb_blob, bdlbb_blobutil, bdls_filesystemutil
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlbb::BlobIoUtil', that
+// is a namespace for functions transferring data directly between the buffers
+// of a 'bdlbb::Blob' and a file descriptor, as used by
+// 'bdls::FilesystemUtil', without copying the data through an intermediate
+// contiguous buffer.  The descriptor may refer to a regular file, a pipe, a
+// socket, or any other object supporting 'read' and 'write'.
+//
+// The 'write' functions gather the data buffers of a blob, starting at a given
+// position, into a single 'writev' system call, and the 'read' functions grow
+// a blob -- obtaining new buffers from its 'bdlbb::BlobBufferFactory' as
+// needed -- and scatter the incoming data directly into those buffers with a
+// single 'readv' system call.  A system call is limited to
+// 'k_MAX_BUFFERS_PER_CALL' buffers; larger transfers take several calls.
+//
+///'Some' vs. Complete Transfers
+///-----------------------------
+// The functions come in two flavors, mirroring the underlying system calls:
+//
+//: o 'readSome' and 'writeSome' make a single system call, and return the
+//:   number of bytes transferred, which may be fewer than requested (e.g.,
+//:   when a pipe is full or holds little data, or when the transfer spans more
+//:   than 'k_MAX_BUFFERS_PER_CALL' buffers).  They are suited to non-blocking
+//:   descriptors driven by an event loop, which track their progress through
+//:   the blob themselves.
+//:
+//: o 'read' and 'write' repeat the system call, advancing through the blob,
+//:   until the requested number of bytes has been transferred, end-of-file is
+//:   reached (for 'read'), or an error occurs.  Calls interrupted by a signal
+//:   before transferring any data are retried.
+//
+// All functions return a negative value on error, in which case the platform
+// error code ('errno' on POSIX) describes the error.
+//
+///Platform Notes
+///--------------
+// On Windows there is no scatter/gather I/O for arbitrary handles, and each
+// system call transfers the data of a single blob buffer.  The data is still
+// not copied.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Saving and Restoring a Blob
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose we accumulate messages in a blob, and want to save them to a file,
+// and later load them into another blob.
+//
+// First, we create a blob whose buffers are supplied by a factory, and
+// append some data to it:
+//..
+//  bdlbb::SimpleBlobBufferFactory factory(16);
+//  bdlbb::Blob                    blob(&factory);
+//
+//  const char MESSAGE[] = "The quick brown fox jumps over the lazy dog.";
+//  const int  LENGTH    = sizeof MESSAGE - 1;
+//
+//  for (int i = 0; i < 10; ++i) {
+//      bdlbb::BlobUtil::append(&blob, MESSAGE, LENGTH);
+//  }
+//  assert(10 * LENGTH == blob.length());
+//  assert(28          == blob.numDataBuffers());
+//..
+// Then, we create a temporary file, and write the whole blob to it.  'write'
+// hands all 28 buffers to the operating system in a single system call, and
+// would, if the operating system accepted only part of the data, write the
+// rest with further calls:
+//..
+//  bsl::string                          path;
+//  bdls::FilesystemUtil::FileDescriptor fd =
+//                    bdls::FilesystemUtil::createTemporaryFile(&path, "bbio");
+//  assert(bdls::FilesystemUtil::k_INVALID_FD != fd);
+//
+//  int rc = bdlbb::BlobIoUtil::write(fd, blob);
+//  assert(blob.length() == rc);
+//..
+// Next, we rewind the file, and read it into a new, empty blob.  'read'
+// extends the blob with buffers from its factory, and reads the data directly
+// into them:
+//..
+//  bdls::FilesystemUtil::seek(fd,
+//                             0,
+//                             bdls::FilesystemUtil::e_SEEK_FROM_BEGINNING);
+//
+//  bdlbb::Blob copy(&factory);
+//  rc = bdlbb::BlobIoUtil::read(&copy, fd, blob.length());
+//  assert(blob.length() == rc);
+//  assert(0 == bdlbb::BlobUtil::compare(blob, copy));
+//..
+// Now, we observe that asking for more data returns 0, which indicates that
+// end-of-file has been reached, and leaves the blob unchanged:
+//..
+//  rc = bdlbb::BlobIoUtil::readSome(&copy, fd, 100);
+//  assert(0             == rc);
+//  assert(blob.length() == copy.length());
+//..
+// Finally, we close and remove the file:
+//..
+//  bdls::FilesystemUtil::close(fd);
+//  bdls::FilesystemUtil::remove(path);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlbb_blob.h>
+
+#include <bdls_filesystemutil.h>
+
+namespace BloombergLP {
+namespace bdlbb {
+
+                              // =================
+                              // struct BlobIoUtil
+                              // =================
+
+struct BlobIoUtil {
+    // This 'struct' provides a namespace for functions transferring data
+    // between 'Blob' objects and file descriptors using scatter/gather I/O.
+
+    // TYPES
+    typedef bdls::FilesystemUtil::FileDescriptor FileDescriptor;
+        // Type of the descriptors on which I/O is performed.
+
+    enum {
+        k_MAX_BUFFERS_PER_CALL = 64
+            // maximum number of blob buffers transferred by one system call
+    };
+
+    // CLASS METHODS
+    static int read(Blob           *blob,
+                    FileDescriptor  descriptor,
+                    int             numBytes);
+        // Append to the specified 'blob' the specified 'numBytes' read from
+        // the specified 'descriptor', repeating the read as necessary, and
+        // stopping early if end-of-file is reached.  Return the number of
+        // bytes read on success (fewer than 'numBytes' only at end-of-file),
+        // and a negative value if an error occurs, in which case the data
+        // read before the error remains appended to 'blob'.  'blob' is grown
+        // with buffers obtained from its factory, and the data is read
+        // directly into those buffers.  The behavior is undefined unless
+        // '0 <= numBytes', and 'blob' was created with a blob buffer factory
+        // or has at least 'numBytes' of capacity beyond its length.
+
+    static int readSome(Blob           *blob,
+                        FileDescriptor  descriptor,
+                        int             maxNumBytes);
+        // Append to the specified 'blob' at most the specified 'maxNumBytes'
+        // read from the specified 'descriptor' by a single system call.
+        // Return the number of bytes read, 0 at end-of-file, and a negative
+        // value if an error occurs, in which case the length of 'blob' is
+        // unchanged.  'blob' is grown with buffers obtained from its factory,
+        // and the data is read directly into those buffers; buffers obtained
+        // but not filled remain in 'blob' as capacity.  The behavior is
+        // undefined unless '0 < maxNumBytes', and 'blob' was created with a
+        // blob buffer factory or has at least 'maxNumBytes' of capacity beyond
+        // its length.
+
+    static int write(FileDescriptor descriptor, const Blob& blob);
+    static int write(FileDescriptor  descriptor,
+                     const Blob&     blob,
+                     int             position);
+    static int write(FileDescriptor  descriptor,
+                     const Blob&     blob,
+                     int             position,
+                     int             numBytes);
+        // Write to the specified 'descriptor' the data of the specified 'blob'
+        // starting at the optionally specified 'position' (0 by default), and
+        // continuing for the optionally specified 'numBytes' (to the end of
+        // 'blob' by default), repeating the write as necessary.  Return the
+        // number of bytes written on success (always the number of bytes
+        // requested), and a negative value if an error occurs.  The data is
+        // written directly from the buffers of 'blob'.  The behavior is
+        // undefined unless '0 <= position', '0 <= numBytes', and
+        // 'position + numBytes <= blob.length()'.
+
+    static int writeSome(FileDescriptor descriptor, const Blob& blob);
+    static int writeSome(FileDescriptor  descriptor,
+                         const Blob&     blob,
+                         int             position);
+    static int writeSome(FileDescriptor  descriptor,
+                         const Blob&     blob,
+                         int             position,
+                         int             numBytes);
+        // Write to the specified 'descriptor', by a single system call, at
+        // most the data of the specified 'blob' starting at the optionally
+        // specified 'position' (0 by default), and continuing for the
+        // optionally specified 'numBytes' (to the end of 'blob' by default).
+        // Return the number of bytes written, which may be fewer than
+        // requested, and a negative value if an error occurs.  The data is
+        // written directly from the buffers of 'blob'.  The behavior is
+        // undefined unless '0 <= position', '0 <= numBytes', and
+        // 'position + numBytes <= blob.length()'.  Note that a call
+        // requesting 0 bytes returns 0 without making a system call.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // -----------------
+                              // struct BlobIoUtil
+                              // -----------------
+
+// CLASS METHODS
+inline
+int BlobIoUtil::write(FileDescriptor descriptor, const Blob& blob)
+{
+    return write(descriptor, blob, 0, blob.length());
+}
+
+inline
+int BlobIoUtil::write(FileDescriptor  descriptor,
+                      const Blob&     blob,
+                      int             position)
+{
+    return write(descriptor, blob, position, blob.length() - position);
+}
+
+inline
+int BlobIoUtil::writeSome(FileDescriptor descriptor, const Blob& blob)
+{
+    return writeSome(descriptor, blob, 0, blob.length());
+}
+
+inline
+int BlobIoUtil::writeSome(FileDescriptor  descriptor,
+                          const Blob&     blob,
+                          int             position)
+{
+    return writeSome(descriptor, blob, position, blob.length() - position);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1361 @@
+// bdlbb_blobioutil.t.cpp                                             -*-C++-*-
+#include <bdlbb_blobioutil.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlbb::BlobIoUtil' provides functions transferring data between the
+// buffers of a blob and a file descriptor.  The primary concerns are that the
+// bytes transferred are exactly those of the requested range of the blob,
+// whatever the sizes of its buffers and the position of the range within
+// them; that the complete 'read' and 'write' operations resume correctly
+// after partial transfers, which are provoked here by pipes whose capacity is
+// smaller than the transfer, and by blobs having more buffers than can be
+// transferred by one system call; that 'read' grows the blob using its
+// factory, appending after existing data; and that errors and end-of-file
+// are reported as documented.  Files are created with
+// 'bdls::FilesystemUtil::createTemporaryFile' and removed after each test.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 4] int read(Blob *blob, FileDescriptor descriptor, int numBytes);
+// [ 4] int readSome(Blob *blob, FileDescriptor descriptor, int maxNumBytes);
+// [ 2] int write(FileDescriptor descriptor, const Blob& blob);
+// [ 2] int write(FileDescriptor d, const Blob& b, int position);
+// [ 2] int write(FileDescriptor d, const Blob& b, int position, int n);
+// [ 2] int writeSome(FileDescriptor descriptor, const Blob& blob);
+// [ 2] int writeSome(FileDescriptor d, const Blob& b, int position);
+// [ 2] int writeSome(FileDescriptor d, const Blob& b, int position, int n);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+// [ 3] CONCERN: 'write' and 'read' resume after partial transfers.
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlbb::BlobIoUtil    Util;
+typedef bdls::FilesystemUtil FileUtil;
+typedef FileUtil::FileDescriptor FileDescriptor;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                          HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+char patternByte(int index)
+    // Return the byte at the specified 'index' of the test pattern.
+{
+    return static_cast<char>('a' + (index * 7 + index / 251) % 26);
+}
+
+void loadPattern(bdlbb::Blob *blob, int length)
+    // Append to the specified 'blob' the first specified 'length' bytes of
+    // the test pattern.
+{
+    for (int i = 0; i < length; ++i) {
+        const char c = patternByte(i);
+        bdlbb::BlobUtil::append(blob, &c, 1);
+    }
+}
+
+bool matchesPattern(const char *data, int offset, int length)
+    // Return 'true' if the specified 'length' bytes at the specified 'data'
+    // are the bytes of the test pattern starting at the specified 'offset',
+    // and 'false' otherwise.
+{
+    for (int i = 0; i < length; ++i) {
+        if (patternByte(offset + i) != data[i]) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+bool matchesPattern(const bdlbb::Blob& blob,
+                    int                position,
+                    int                offset,
+                    int                length)
+    // Return 'true' if the specified 'length' bytes at the specified
+    // 'position' in the specified 'blob' are the bytes of the test pattern
+    // starting at the specified 'offset', and 'false' otherwise.
+{
+    if (0 == length) {
+        return true;                                                  // RETURN
+    }
+    bsl::vector<char> data(length);
+    bdlbb::BlobUtil::copy(data.data(), blob, position, length);
+    return matchesPattern(data.data(), offset, length);
+}
+
+class TempFile {
+    // This class creates a temporary file, and removes it on destruction.
+
+    // DATA
+    bsl::string    d_path;
+    FileDescriptor d_descriptor;
+
+  private:
+    // NOT IMPLEMENTED
+    TempFile(const TempFile&);
+    TempFile& operator=(const TempFile&);
+
+  public:
+    // CREATORS
+    TempFile()
+    : d_descriptor(FileUtil::createTemporaryFile(&d_path,
+                                                 "bdlbb_blobioutil"))
+        // Create a new, empty temporary file, and open it for reading and
+        // writing.
+    {
+        ASSERT(FileUtil::k_INVALID_FD != d_descriptor);
+    }
+
+    ~TempFile()
+        // Close and remove the temporary file.
+    {
+        FileUtil::close(d_descriptor);
+        FileUtil::remove(d_path);
+    }
+
+    // MANIPULATORS
+    void rewind()
+        // Position the file at its beginning.
+    {
+        FileUtil::seek(d_descriptor, 0, FileUtil::e_SEEK_FROM_BEGINNING);
+    }
+
+    void truncate()
+        // Remove the contents of the file, and position it at its beginning.
+    {
+        FileUtil::truncateFileSize(d_descriptor, 0);
+        rewind();
+    }
+
+    // ACCESSORS
+    FileDescriptor descriptor() const
+        // Return the descriptor of the file.
+    {
+        return d_descriptor;
+    }
+
+    bsl::vector<char> contents() const
+        // Return the contents of the file, and leave the file positioned at
+        // its end.
+    {
+        bsl::vector<char> result;
+        FileUtil::seek(d_descriptor, 0, FileUtil::e_SEEK_FROM_BEGINNING);
+
+        char buffer[4096];
+        int  rc;
+        while (0 < (rc = FileUtil::read(d_descriptor,
+                                        buffer,
+                                        sizeof buffer))) {
+            result.insert(result.end(), buffer, buffer + rc);
+        }
+        return result;
+    }
+};
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+struct PipeTransfer {
+    // This 'struct' describes the transfer performed by a thread at the other
+    // end of a pipe from the thread under test.
+
+    int               d_descriptor;  // end of the pipe used by the thread
+    int               d_numBytes;    // number of bytes to transfer
+    int               d_chunkSize;   // maximum bytes per system call
+    bsl::vector<char> d_data;        // data read by a draining thread
+};
+
+extern "C" void *drainPipe(void *arg)
+    // Read from the pipe described by the specified 'arg', in chunks of at
+    // most 'd_chunkSize' bytes, until end-of-file, appending the data read to
+    // 'd_data'.  Pause briefly between chunks so that the writer fills the
+    // pipe.
+{
+    PipeTransfer *transfer = static_cast<PipeTransfer *>(arg);
+
+    bsl::vector<char> buffer(transfer->d_chunkSize);
+    while (true) {
+        const ssize_t rc = ::read(transfer->d_descriptor,
+                                  buffer.data(),
+                                  buffer.size());
+        if (0 < rc) {
+            transfer->d_data.insert(transfer->d_data.end(),
+                                    buffer.data(),
+                                    buffer.data() + rc);
+            bslmt::ThreadUtil::microSleep(100);
+        }
+        else if (0 == rc || EINTR != errno) {
+            break;
+        }
+    }
+    return 0;
+}
+
+extern "C" void *fillPipe(void *arg)
+    // Write 'd_numBytes' bytes of the test pattern to the pipe described by
+    // the specified 'arg', in chunks of at most 'd_chunkSize' bytes, pausing
+    // briefly between chunks, and then close the pipe.
+{
+    PipeTransfer *transfer = static_cast<PipeTransfer *>(arg);
+
+    bsl::vector<char> buffer(transfer->d_numBytes);
+    for (int i = 0; i < transfer->d_numBytes; ++i) {
+        buffer[i] = patternByte(i);
+    }
+
+    int written = 0;
+    while (written < transfer->d_numBytes) {
+        const int length = bsl::min(transfer->d_chunkSize,
+                                    transfer->d_numBytes - written);
+        const ssize_t rc = ::write(transfer->d_descriptor,
+                                   buffer.data() + written,
+                                   length);
+        if (rc < 0) {
+            break;
+        }
+        written += static_cast<int>(rc);
+        bslmt::ThreadUtil::microSleep(100);
+    }
+    ::close(transfer->d_descriptor);
+    return 0;
+}
+#endif
+
+// ============================================================================
+//                          PERFORMANCE TEST HELPERS
+// ----------------------------------------------------------------------------
+
+static unsigned s_antiOptimization = 0;
+
+double toDouble(const bsls::TimeInterval& duration)
+    // Return the specified 'duration' in seconds.
+{
+    return duration.totalSecondsAsDouble();
+}
+
+bsls::TimeInterval timeWriteCopy(FileDescriptor      descriptor,
+                                 const bdlbb::Blob&  blob,
+                                 int                 numIterations)
+    // Write the specified 'blob' to the specified 'descriptor' the specified
+    // 'numIterations' times by copying it into a contiguous buffer and
+    // writing the buffer, and return the elapsed time of the median of
+    // several trials.
+{
+    enum { k_NUM_TRIALS = 11 };
+
+    bsl::vector<bsls::TimeInterval> times;
+    for (int trial = 0; trial < k_NUM_TRIALS; ++trial) {
+        FileUtil::seek(descriptor, 0, FileUtil::e_SEEK_FROM_BEGINNING);
+
+        const bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+        for (int i = 0; i < numIterations; ++i) {
+            bsl::vector<char> buffer(blob.length());
+            bdlbb::BlobUtil::copy(buffer.data(), blob, 0, blob.length());
+
+            int written = 0;
+            while (written < blob.length()) {
+                const int rc = FileUtil::write(descriptor,
+                                               buffer.data() + written,
+                                               blob.length() - written);
+                if (rc <= 0) {
+                    break;
+                }
+                written += rc;
+            }
+            s_antiOptimization += written;
+        }
+        times.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+    }
+    bsl::sort(times.begin(), times.end());
+    return times[k_NUM_TRIALS / 2];
+}
+
+bsls::TimeInterval timeWriteGather(FileDescriptor      descriptor,
+                                   const bdlbb::Blob&  blob,
+                                   int                 numIterations)
+    // Write the specified 'blob' to the specified 'descriptor' the specified
+    // 'numIterations' times using 'bdlbb::BlobIoUtil::write', and return the
+    // elapsed time of the median of several trials.
+{
+    enum { k_NUM_TRIALS = 11 };
+
+    bsl::vector<bsls::TimeInterval> times;
+    for (int trial = 0; trial < k_NUM_TRIALS; ++trial) {
+        FileUtil::seek(descriptor, 0, FileUtil::e_SEEK_FROM_BEGINNING);
+
+        const bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+        for (int i = 0; i < numIterations; ++i) {
+            s_antiOptimization += Util::write(descriptor, blob);
+        }
+        times.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+    }
+    bsl::sort(times.begin(), times.end());
+    return times[k_NUM_TRIALS / 2];
+}
+
+bsls::TimeInterval timeReadCopy(FileDescriptor             descriptor,
+                                bdlbb::BlobBufferFactory  *factory,
+                                int                        length,
+                                int                        numIterations)
+    // Read the specified 'length' bytes from the start of the specified
+    // 'descriptor' into a new blob using the specified 'factory' the
+    // specified 'numIterations' times by reading into a contiguous buffer and
+    // appending the buffer to the blob, and return the elapsed time of the
+    // median of several trials.
+{
+    enum { k_NUM_TRIALS = 11 };
+
+    bsl::vector<bsls::TimeInterval> times;
+    for (int trial = 0; trial < k_NUM_TRIALS; ++trial) {
+        const bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+        for (int i = 0; i < numIterations; ++i) {
+            FileUtil::seek(descriptor, 0, FileUtil::e_SEEK_FROM_BEGINNING);
+
+            bdlbb::Blob       blob(factory);
+            bsl::vector<char> buffer(length);
+
+            int numRead = 0;
+            while (numRead < length) {
+                const int rc = FileUtil::read(descriptor,
+                                              buffer.data() + numRead,
+                                              length - numRead);
+                if (rc <= 0) {
+                    break;
+                }
+                numRead += rc;
+            }
+            bdlbb::BlobUtil::append(&blob, buffer.data(), numRead);
+            s_antiOptimization += blob.length();
+        }
+        times.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+    }
+    bsl::sort(times.begin(), times.end());
+    return times[k_NUM_TRIALS / 2];
+}
+
+bsls::TimeInterval timeReadScatter(FileDescriptor             descriptor,
+                                   bdlbb::BlobBufferFactory  *factory,
+                                   int                        length,
+                                   int                        numIterations)
+    // Read the specified 'length' bytes from the start of the specified
+    // 'descriptor' into a new blob using the specified 'factory' the
+    // specified 'numIterations' times using 'bdlbb::BlobIoUtil::read', and
+    // return the elapsed time of the median of several trials.
+{
+    enum { k_NUM_TRIALS = 11 };
+
+    bsl::vector<bsls::TimeInterval> times;
+    for (int trial = 0; trial < k_NUM_TRIALS; ++trial) {
+        const bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+        for (int i = 0; i < numIterations; ++i) {
+            FileUtil::seek(descriptor, 0, FileUtil::e_SEEK_FROM_BEGINNING);
+
+            bdlbb::Blob blob(factory);
+            s_antiOptimization += Util::read(&blob, descriptor, length);
+        }
+        times.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+    }
+    bsl::sort(times.begin(), times.end());
+    return times[k_NUM_TRIALS / 2];
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+    // A reader closing its end of a pipe early must not kill the test.
+
+    ::signal(SIGPIPE, SIG_IGN);
+#endif
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Saving and Restoring a Blob
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose we accumulate messages in a blob, and want to save them to a file,
+// and later load them into another blob.
+//
+// First, we create a blob whose buffers are supplied by a factory, and
+// append some data to it:
+//..
+    bdlbb::SimpleBlobBufferFactory factory(16);
+    bdlbb::Blob                    blob(&factory);
+
+    const char MESSAGE[] = "The quick brown fox jumps over the lazy dog.";
+    const int  LENGTH    = sizeof MESSAGE - 1;
+
+    for (int i = 0; i < 10; ++i) {
+        bdlbb::BlobUtil::append(&blob, MESSAGE, LENGTH);
+    }
+    ASSERT(10 * LENGTH == blob.length());
+    ASSERT(28          == blob.numDataBuffers());
+//..
+// Then, we create a temporary file, and write the whole blob to it.  'write'
+// hands all 28 buffers to the operating system in a single system call, and
+// would, if the operating system accepted only part of the data, write the
+// rest with further calls:
+//..
+    bsl::string                          path;
+    bdls::FilesystemUtil::FileDescriptor fd =
+                   bdls::FilesystemUtil::createTemporaryFile(&path, "bbio");
+    ASSERT(bdls::FilesystemUtil::k_INVALID_FD != fd);
+
+    int rc = bdlbb::BlobIoUtil::write(fd, blob);
+    ASSERT(blob.length() == rc);
+//..
+// Next, we rewind the file, and read it into a new, empty blob.  'read'
+// extends the blob with buffers from its factory, and reads the data directly
+// into them:
+//..
+    bdls::FilesystemUtil::seek(fd,
+                               0,
+                               bdls::FilesystemUtil::e_SEEK_FROM_BEGINNING);
+
+    bdlbb::Blob copy(&factory);
+    rc = bdlbb::BlobIoUtil::read(&copy, fd, blob.length());
+    ASSERT(blob.length() == rc);
+    ASSERT(0 == bdlbb::BlobUtil::compare(blob, copy));
+//..
+// Now, we observe that asking for more data returns 0, which indicates that
+// end-of-file has been reached, and leaves the blob unchanged:
+//..
+    rc = bdlbb::BlobIoUtil::readSome(&copy, fd, 100);
+    ASSERT(0             == rc);
+    ASSERT(blob.length() == copy.length());
+//..
+// Finally, we close and remove the file:
+//..
+    bdls::FilesystemUtil::close(fd);
+    bdls::FilesystemUtil::remove(path);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'read' AND 'readSome'
+        //
+        // Concerns:
+        //: 1 'readSome' appends the bytes read after the existing data of the
+        //:   blob, whether the last data buffer is full, partially filled, or
+        //:   the blob is empty, and obtains the buffers needed from the
+        //:   factory of the blob.
+        //:
+        //: 2 'readSome' returns the number of bytes read, which is at most
+        //:   'maxNumBytes', and is limited to 'k_MAX_BUFFERS_PER_CALL'
+        //:   buffers.
+        //:
+        //: 3 At end-of-file 'readSome' and 'read' return 0 and leave the
+        //:   length of the blob unchanged.
+        //:
+        //: 4 On error both return a negative value and leave the length of
+        //:   the blob unchanged.
+        //:
+        //: 5 'read' reads exactly 'numBytes' when that many are available,
+        //:   whatever the number of buffers needed, and all the bytes to the
+        //:   end of the file otherwise.
+        //:
+        //: 6 Memory comes from the factory only; the default allocator is
+        //:   not used.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Write a file holding the test pattern.  For a table of buffer
+        //:   sizes, initial blob lengths, and read lengths, read the file into
+        //:   a blob holding a prefix of the pattern, using both 'readSome'
+        //:   and 'read', and verify the return value, the length of the blob,
+        //:   and its contents.  (C-1..2, 5..6)
+        //:
+        //: 2 Read past the end of the file, and from an invalid descriptor.
+        //:   (C-3..4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   int read(Blob *blob, FileDescriptor descriptor, int numBytes);
+        //   int readSome(Blob *blob, FileDescriptor descriptor, int max);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'read' AND 'readSome'" << endl
+                          << "=====================" << endl;
+
+        enum { k_FILE_LENGTH = 20000 };
+
+        bslma::TestAllocator ta("factory", veryVeryVeryVerbose);
+
+        TempFile file;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(1000, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+            loadPattern(&blob, k_FILE_LENGTH);
+            ASSERT(k_FILE_LENGTH == Util::write(file.descriptor(), blob));
+        }
+
+        static const struct {
+            int d_line;
+            int d_bufferSize;   // size of the buffers from the factory
+            int d_initial;      // length of the blob before reading
+            int d_numBytes;     // number of bytes to read
+        } DATA[] = {
+            //LINE  BUFFER  INITIAL  NUM
+            //----  ------  -------  -----
+            { L_,        1,       0,     1 },
+            { L_,        1,       0,    10 },
+            { L_,        1,       3,   200 },
+            { L_,        7,       0,     5 },
+            { L_,        7,       7,    14 },
+            { L_,        7,      10,   100 },
+            { L_,       16,       0,  1024 },
+            { L_,       16,      15,  1024 },
+            { L_,       64,       1,  4096 },
+            { L_,      100,      50,   450 },
+            { L_,      100,     100, 10000 },
+            { L_,     4096,       0, 20000 },
+            { L_,     4096,    4095,  4097 },
+            { L_,    32768,       0, 20000 },
+            { L_,    32768,    1000,  5000 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE    = DATA[ti].d_line;
+            const int BUFFER  = DATA[ti].d_bufferSize;
+            const int INITIAL = DATA[ti].d_initial;
+            const int NUM     = DATA[ti].d_numBytes;
+
+            if (veryVerbose) { T_ P_(LINE) P_(BUFFER) P_(INITIAL) P(NUM) }
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER, &ta);
+
+            // 'read'
+
+            {
+                bdlbb::Blob blob(&factory, &ta);
+                loadPattern(&blob, INITIAL);
+
+                FileUtil::seek(file.descriptor(),
+                               INITIAL,
+                               FileUtil::e_SEEK_FROM_BEGINNING);
+
+                const bsls::Types::Int64 NUM_DEFAULT =
+                                             defaultAllocator.numBlocksTotal();
+
+                const int rc = Util::read(&blob, file.descriptor(), NUM);
+                ASSERTV(LINE, rc, NUM == rc);
+                ASSERTV(LINE,
+                        NUM_DEFAULT == defaultAllocator.numBlocksTotal());
+                ASSERTV(LINE, blob.length(), INITIAL + NUM == blob.length());
+                ASSERTV(LINE, matchesPattern(blob, 0, 0, INITIAL + NUM));
+                ASSERTV(LINE, blob.totalSize(),
+                        blob.totalSize() < INITIAL + NUM + 2 * BUFFER);
+            }
+
+            // 'readSome'
+
+            {
+                bdlbb::Blob blob(&factory, &ta);
+                loadPattern(&blob, INITIAL);
+
+                FileUtil::seek(file.descriptor(),
+                               INITIAL,
+                               FileUtil::e_SEEK_FROM_BEGINNING);
+
+                const int rc = Util::readSome(&blob, file.descriptor(), NUM);
+
+                // A regular file supplies all the bytes requested, up to the
+                // limit on the number of buffers per system call.
+
+                const int startOffset = INITIAL % BUFFER;
+                const int MAX_BYTES   = Util::k_MAX_BUFFERS_PER_CALL * BUFFER
+                                                                - startOffset;
+                const int EXP = bsl::min(NUM, MAX_BYTES);
+
+                ASSERTV(LINE, rc, EXP, EXP == rc);
+                ASSERTV(LINE, blob.length(), INITIAL + EXP == blob.length());
+                ASSERTV(LINE, matchesPattern(blob, 0, 0, INITIAL + EXP));
+            }
+        }
+
+        if (verbose) cout << "\nEnd-of-file and errors." << endl;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(64, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+            loadPattern(&blob, 10);
+
+            // Reading past the end returns what remains, then 0.
+
+            FileUtil::seek(file.descriptor(),
+                           k_FILE_LENGTH - 100,
+                           FileUtil::e_SEEK_FROM_BEGINNING);
+            ASSERT(100 == Util::read(&blob, file.descriptor(), 1000));
+            ASSERT(110 == blob.length());
+            ASSERT(matchesPattern(blob, 10, k_FILE_LENGTH - 100, 100));
+
+            ASSERT(0   == Util::read(&blob, file.descriptor(), 1000));
+            ASSERT(110 == blob.length());
+            ASSERT(0   == Util::readSome(&blob, file.descriptor(), 1000));
+            ASSERT(110 == blob.length());
+
+            // Reading 0 bytes is a no-op.
+
+            ASSERT(0   == Util::read(&blob, file.descriptor(), 0));
+            ASSERT(110 == blob.length());
+
+            // Errors leave the length unchanged.
+
+            ASSERT(0   >  Util::read(&blob, FileUtil::k_INVALID_FD, 100));
+            ASSERT(110 == blob.length());
+            ASSERT(0   >  Util::readSome(&blob, FileUtil::k_INVALID_FD, 100));
+            ASSERT(110 == blob.length());
+            ASSERT(matchesPattern(blob, 0, 0, 10));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(64, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            ASSERT_FAIL(Util::read(0, file.descriptor(), 1));
+            ASSERT_FAIL(Util::read(&blob, file.descriptor(), -1));
+            ASSERT_FAIL(Util::readSome(0, file.descriptor(), 1));
+            ASSERT_FAIL(Util::readSome(&blob, file.descriptor(), 0));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCERN: 'write' AND 'read' RESUME AFTER PARTIAL TRANSFERS
+        //
+        // Concerns:
+        //: 1 When the descriptor accepts only part of the data, 'write'
+        //:   continues from exactly the first byte not yet written, including
+        //:   when that byte is in the middle of a buffer.
+        //:
+        //: 2 'writeSome' on a non-blocking descriptor returns the number of
+        //:   bytes accepted, which is fewer than requested when the
+        //:   descriptor is full.
+        //:
+        //: 3 When the descriptor supplies the data in small pieces, 'read'
+        //:   continues until the requested number of bytes is read, and
+        //:   'readSome' returns the data available.
+        //
+        // Plan:
+        //: 1 Write blobs much larger than the capacity of a pipe to a pipe
+        //:   drained slowly, in odd-sized chunks, by another thread, and
+        //:   verify the data received.  (C-1)
+        //:
+        //: 2 Write a large blob to a non-blocking pipe that is not read, and
+        //:   verify that 'writeSome' returns a positive count smaller than
+        //:   the blob, that those bytes are the start of the blob, and that
+        //:   writing to the full pipe fails.  (C-2)
+        //:
+        //: 3 Read from a pipe written slowly, in odd-sized chunks, by another
+        //:   thread, and verify the data read.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: 'write' and 'read' resume after partial transfers.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                        << "CONCERN: 'write' AND 'read' RESUME AFTER PARTIAL"
+                        << " TRANSFERS" << endl
+                        << "================================================="
+                        << "=========" << endl;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        if (verbose) cout << "Skipped: pipes are not tested on Windows.\n";
+#else
+        bslma::TestAllocator ta("factory", veryVeryVeryVerbose);
+
+        static const struct {
+            int d_line;
+            int d_bufferSize;   // size of the buffers of the blob
+            int d_length;       // length of the blob
+            int d_position;     // position from which to transfer
+            int d_chunkSize;    // bytes per system call of the other thread
+        } DATA[] = {
+            //LINE  BUFFER  LENGTH   POSITION  CHUNK
+            //----  ------  -------  --------  -----
+            { L_,        1,   50000,        0,  4093 },
+            { L_,       13,  300000,        5,  1021 },
+            { L_,     1000,  500000,     1234, 65521 },
+            { L_,    65536, 1000000,    65535, 32749 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE     = DATA[ti].d_line;
+            const int BUFFER   = DATA[ti].d_bufferSize;
+            const int LENGTH   = DATA[ti].d_length;
+            const int POSITION = DATA[ti].d_position;
+            const int CHUNK    = DATA[ti].d_chunkSize;
+            const int NUM      = LENGTH - POSITION;
+
+            if (veryVerbose) {
+                T_ P_(LINE) P_(BUFFER) P_(LENGTH) P_(POSITION) P(CHUNK)
+            }
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER, &ta);
+
+            // 'write' to a slowly drained pipe.
+
+            {
+                bdlbb::Blob blob(&factory, &ta);
+                loadPattern(&blob, LENGTH);
+
+                int fds[2];
+                ASSERTV(LINE, 0 == ::pipe(fds));
+
+                PipeTransfer transfer;
+                transfer.d_descriptor = fds[0];
+                transfer.d_numBytes   = NUM;
+                transfer.d_chunkSize  = CHUNK;
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERTV(LINE, 0 == bslmt::ThreadUtil::create(&handle,
+                                                             &drainPipe,
+                                                             &transfer));
+
+                const int rc = Util::write(fds[1], blob, POSITION);
+                ASSERTV(LINE, rc, NUM == rc);
+
+                ::close(fds[1]);
+                bslmt::ThreadUtil::join(handle);
+                ::close(fds[0]);
+
+                ASSERTV(LINE, transfer.d_data.size(),
+                        NUM == static_cast<int>(transfer.d_data.size()));
+                ASSERTV(LINE, matchesPattern(transfer.d_data.data(),
+                                             POSITION,
+                                             NUM));
+            }
+
+            // 'read' from a slowly filled pipe.
+
+            {
+                bdlbb::Blob blob(&factory, &ta);
+                loadPattern(&blob, POSITION % 97);
+                const int INITIAL = blob.length();
+
+                int fds[2];
+                ASSERTV(LINE, 0 == ::pipe(fds));
+
+                PipeTransfer transfer;
+                transfer.d_descriptor = fds[1];
+                transfer.d_numBytes   = LENGTH;
+                transfer.d_chunkSize  = CHUNK;
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERTV(LINE, 0 == bslmt::ThreadUtil::create(&handle,
+                                                             &fillPipe,
+                                                             &transfer));
+
+                // 'readSome' returns whatever the pipe holds, which is
+                // usually a single chunk.
+
+                int rc = Util::readSome(&blob, fds[0], LENGTH);
+                ASSERTV(LINE, rc, 0 < rc && rc <= LENGTH);
+                int numRead = rc;
+
+                rc = Util::read(&blob, fds[0], LENGTH - numRead);
+                ASSERTV(LINE, rc, LENGTH - numRead == rc);
+
+                // The pipe is now at end-of-file.
+
+                bslmt::ThreadUtil::join(handle);
+                ASSERTV(LINE, 0 == Util::read(&blob, fds[0], 10));
+                ::close(fds[0]);
+
+                ASSERTV(LINE, blob.length(),
+                        INITIAL + LENGTH == blob.length());
+                ASSERTV(LINE, matchesPattern(blob, 0, 0, INITIAL));
+                ASSERTV(LINE, matchesPattern(blob, INITIAL, 0, LENGTH));
+            }
+        }
+
+        if (verbose) cout << "\n'writeSome' to a full pipe." << endl;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(1000, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            // With at most 'k_MAX_BUFFERS_PER_CALL' buffers of 1000 bytes per
+            // call, several calls are needed to fill any plausible pipe.
+
+            loadPattern(&blob, 4 * 1024 * 1024);
+
+            int fds[2];
+            ASSERT(0 == ::pipe(fds));
+            ASSERT(0 == ::fcntl(fds[1], F_SETFL, O_NONBLOCK));
+
+            int written = 0;
+            int rc;
+            while (0 < (rc = Util::writeSome(fds[1], blob, written))) {
+                ASSERTV(rc, rc <= Util::k_MAX_BUFFERS_PER_CALL * 1000);
+                written += rc;
+            }
+            ASSERTV(written, 0 < written && written < blob.length());
+            ASSERTV(rc, errno, rc < 0 && EAGAIN == errno);
+            rc = Util::write(fds[1], blob, written);
+            ASSERTV(rc, rc < 0);
+
+            ::close(fds[1]);
+
+            bsl::vector<char> data(written);
+            int               numRead = 0;
+            while (numRead < written) {
+                const ssize_t n = ::read(fds[0],
+                                         data.data() + numRead,
+                                         written - numRead);
+                ASSERT(0 < n);
+                if (n <= 0) {
+                    break;
+                }
+                numRead += static_cast<int>(n);
+            }
+            ::close(fds[0]);
+
+            ASSERT(matchesPattern(data.data(), 0, written));
+        }
+#endif
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'write' AND 'writeSome'
+        //
+        // Concerns:
+        //: 1 The bytes written are exactly those of the requested range of
+        //:   the blob, whatever the buffer sizes and the position of the
+        //:   range relative to buffer boundaries.
+        //:
+        //: 2 The defaults for 'position' and 'numBytes' select the whole blob
+        //:   and the rest of the blob, respectively.
+        //:
+        //: 3 Zero-size buffers, and capacity beyond the length of the blob,
+        //:   are ignored.
+        //:
+        //: 4 'writeSome' writes at most 'k_MAX_BUFFERS_PER_CALL' buffers.
+        //:
+        //: 5 Requesting 0 bytes returns 0; errors return a negative value.
+        //:
+        //: 6 No memory is allocated.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a table of buffer sizes, blob lengths, positions, and
+        //:   lengths, write the range of a blob holding the test pattern to a
+        //:   temporary file using each overload, and verify the return value
+        //:   and the file contents.  (C-1..2, 4, 6)
+        //:
+        //: 2 Write a blob built from buffers of varying sizes, including
+        //:   zero-size buffers, having unused capacity.  (C-3)
+        //:
+        //: 3 Write 0 bytes, and write to an invalid descriptor.  (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   int write(FileDescriptor descriptor, const Blob& blob);
+        //   int write(FileDescriptor d, const Blob& b, int position);
+        //   int write(FileDescriptor d, const Blob& b, int position, int n);
+        //   int writeSome(FileDescriptor descriptor, const Blob& blob);
+        //   int writeSome(FileDescriptor d, const Blob& b, int position);
+        //   int writeSome(FileDescriptor d, const Blob& b, int pos, int n);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'write' AND 'writeSome'" << endl
+                          << "=======================" << endl;
+
+        bslma::TestAllocator ta("factory", veryVeryVeryVerbose);
+
+        static const struct {
+            int d_line;
+            int d_bufferSize;   // size of the buffers of the blob
+            int d_length;       // length of the blob
+            int d_position;     // position of the range to write
+            int d_numBytes;     // length of the range to write
+        } DATA[] = {
+            //LINE  BUFFER  LENGTH  POSITION   NUM
+            //----  ------  ------  --------  -----
+            { L_,        1,      1,        0,     1 },
+            { L_,        1,     10,        3,     5 },
+            { L_,        1,    200,        0,   200 },
+            { L_,        7,     20,        6,     2 },
+            { L_,        7,     20,        7,     7 },
+            { L_,        7,     20,        8,    12 },
+            { L_,        7,    500,        1,   498 },
+            { L_,       16,     16,        0,    16 },
+            { L_,       16,     17,       16,     1 },
+            { L_,       16,   5000,       15,  4970 },
+            { L_,      100,  10000,      100,  9900 },
+            { L_,      100,  10000,     4321,  1234 },
+            { L_,     4096,  50000,        0, 50000 },
+            { L_,     4096,  50000,     4095,     2 },
+            { L_,    65536, 100000,    65535, 34465 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        TempFile file;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE     = DATA[ti].d_line;
+            const int BUFFER   = DATA[ti].d_bufferSize;
+            const int LENGTH   = DATA[ti].d_length;
+            const int POSITION = DATA[ti].d_position;
+            const int NUM      = DATA[ti].d_numBytes;
+
+            if (veryVerbose) {
+                T_ P_(LINE) P_(BUFFER) P_(LENGTH) P_(POSITION) P(NUM)
+            }
+
+            bdlbb::SimpleBlobBufferFactory factory(BUFFER, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+            loadPattern(&blob, LENGTH);
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+
+            // Each buffer touched by a 'writeSome' call counts against the
+            // limit.
+
+            const int FIRST_OFFSET = POSITION % BUFFER;
+            const int MAX_BYTES    = Util::k_MAX_BUFFERS_PER_CALL * BUFFER
+                                                               - FIRST_OFFSET;
+
+            for (int overload = 0; overload < 3; ++overload) {
+                const int START = 0 == overload ? 0 : POSITION;
+                const int COUNT = 0 == overload ? LENGTH
+                                : 1 == overload ? LENGTH - POSITION
+                                :                 NUM;
+                const int SOME  = bsl::min(COUNT,
+                                           0 == overload
+                                           ? Util::k_MAX_BUFFERS_PER_CALL
+                                                                      * BUFFER
+                                           : MAX_BYTES);
+
+                if (veryVeryVerbose) { T_ T_ P_(overload) P_(START) P(COUNT) }
+
+                file.truncate();
+                int rc = 0 == overload
+                         ? Util::write(file.descriptor(), blob)
+                         : 1 == overload
+                         ? Util::write(file.descriptor(), blob, POSITION)
+                         : Util::write(file.descriptor(), blob, POSITION, NUM);
+
+                ASSERTV(LINE, overload, rc, COUNT == rc);
+                bsl::vector<char> contents = file.contents();
+                ASSERTV(LINE, overload, contents.size(),
+                        COUNT == static_cast<int>(contents.size()));
+                ASSERTV(LINE, overload,
+                        matchesPattern(contents.data(), START, COUNT));
+
+                file.truncate();
+                rc = 0 == overload
+                     ? Util::writeSome(file.descriptor(), blob)
+                     : 1 == overload
+                     ? Util::writeSome(file.descriptor(), blob, POSITION)
+                     : Util::writeSome(file.descriptor(), blob, POSITION, NUM);
+
+                ASSERTV(LINE, overload, rc, SOME, SOME == rc);
+                contents = file.contents();
+                ASSERTV(LINE, overload, contents.size(),
+                        SOME == static_cast<int>(contents.size()));
+                ASSERTV(LINE, overload,
+                        matchesPattern(contents.data(), START, SOME));
+            }
+
+            ASSERTV(LINE, NUM_ALLOCATIONS == ta.numAllocations());
+        }
+
+        if (verbose) cout << "\nIrregular buffers." << endl;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(100, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            // Build a blob from buffers of sizes 0, 1, 2, ..., 49, holding
+            // 1225 bytes, then add capacity that must not be written.
+
+            int length = 0;
+            for (int size = 0; size < 50; ++size) {
+                bsl::shared_ptr<char> data(
+                                  static_cast<char *>(ta.allocate(size + 1)),
+                                  &ta);
+                for (int i = 0; i < size; ++i) {
+                    data.get()[i] = patternByte(length + i);
+                }
+                blob.appendDataBuffer(bdlbb::BlobBuffer(data, size));
+                length += size;
+            }
+            ASSERT(1225 == blob.length());
+
+            bdlbb::BlobBuffer extra;
+            factory.allocate(&extra);
+            blob.appendBuffer(extra);
+            ASSERT(1225 == blob.length());
+            ASSERT(1325 == blob.totalSize());
+
+            for (int position = 0; position < length; position += 17) {
+                file.truncate();
+                const int rc = Util::write(file.descriptor(), blob, position);
+                ASSERTV(position, rc, length - position == rc);
+
+                const bsl::vector<char> contents = file.contents();
+                ASSERTV(position, contents.size(),
+                        rc == static_cast<int>(contents.size()));
+                ASSERTV(position,
+                        matchesPattern(contents.data(), position, rc));
+            }
+        }
+
+        if (verbose) cout << "\nEmpty writes and errors." << endl;
+        {
+            bdlbb::SimpleBlobBufferFactory factory(10, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+
+            file.truncate();
+            ASSERT(0 == Util::write(file.descriptor(), blob));
+            ASSERT(0 == Util::writeSome(file.descriptor(), blob));
+
+            loadPattern(&blob, 100);
+            ASSERT(0 == Util::write(file.descriptor(), blob, 100));
+            ASSERT(0 == Util::write(file.descriptor(), blob, 50, 0));
+            ASSERT(0 == Util::writeSome(file.descriptor(), blob, 100));
+            ASSERT(0 == Util::writeSome(file.descriptor(), blob, 50, 0));
+            ASSERT(file.contents().empty());
+
+            ASSERT(0 > Util::write(FileUtil::k_INVALID_FD, blob));
+            ASSERT(0 > Util::writeSome(FileUtil::k_INVALID_FD, blob));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlbb::SimpleBlobBufferFactory factory(10, &ta);
+            bdlbb::Blob                    blob(&factory, &ta);
+            loadPattern(&blob, 100);
+
+            const FileDescriptor FD = file.descriptor();
+
+            file.truncate();
+            ASSERT_PASS(Util::write(FD, blob, 100));
+            ASSERT_FAIL(Util::write(FD, blob, 101));
+            ASSERT_FAIL(Util::write(FD, blob, -1));
+            ASSERT_PASS(Util::write(FD, blob, 0, 100));
+            ASSERT_FAIL(Util::write(FD, blob, 0, 101));
+            ASSERT_FAIL(Util::write(FD, blob, 1, 100));
+            ASSERT_FAIL(Util::write(FD, blob, 0, -1));
+
+            ASSERT_PASS(Util::writeSome(FD, blob, 100));
+            ASSERT_FAIL(Util::writeSome(FD, blob, 101));
+            ASSERT_FAIL(Util::writeSome(FD, blob, -1));
+            ASSERT_PASS(Util::writeSome(FD, blob, 0, 100));
+            ASSERT_FAIL(Util::writeSome(FD, blob, 0, 101));
+            ASSERT_FAIL(Util::writeSome(FD, blob, 1, 100));
+            ASSERT_FAIL(Util::writeSome(FD, blob, 0, -1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write a blob to a temporary file, read it back into another
+        //:   blob, and compare the blobs.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("factory", veryVeryVeryVerbose);
+
+        bdlbb::PooledBlobBufferFactory factory(128, &ta);
+        bdlbb::Blob                    blob(&factory, &ta);
+        loadPattern(&blob, 1000);
+
+        TempFile file;
+        ASSERT(1000 == Util::write(file.descriptor(), blob));
+        ASSERT(100  == Util::write(file.descriptor(), blob, 900));
+        ASSERT(50   == Util::writeSome(file.descriptor(), blob, 0, 50));
+
+        file.rewind();
+
+        bdlbb::Blob copy(&factory, &ta);
+        ASSERT(1000 == Util::read(&copy, file.descriptor(), 1000));
+        ASSERT(0    == bdlbb::BlobUtil::compare(blob, copy));
+
+        ASSERT(100  == Util::readSome(&copy, file.descriptor(), 100));
+        ASSERT(1100 == copy.length());
+        ASSERT(matchesPattern(copy, 1000, 900, 100));
+
+        ASSERT(50   == Util::read(&copy, file.descriptor(), 1000));
+        ASSERT(1150 == copy.length());
+        ASSERT(matchesPattern(copy, 1100, 0, 50));
+
+        ASSERT(0    == Util::readSome(&copy, file.descriptor(), 1000));
+        ASSERT(1150 == copy.length());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Writing a blob with 'write' is faster than copying it into a
+        //:   contiguous buffer and writing that buffer.
+        //:
+        //: 2 Reading into a blob with 'read' is faster than reading into a
+        //:   contiguous buffer and appending that buffer to the blob.
+        //
+        // Plan:
+        //: 1 For several blob sizes, time writing a blob with 4K buffers to a
+        //:   temporary file, and reading it back into a new blob, both ways,
+        //:   and report the throughput of each.  The total number of bytes
+        //:   transferred per measurement may be given, in megabytes, as the
+        //:   second command-line argument.  (C-1..2)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int ARG      = argc > 2 ? atoi(argv[2]) : 0;
+        const int TOTAL_MB = 0 < ARG ? ARG : 256;
+
+        bdlbb::PooledBlobBufferFactory factory(4096);
+
+        TempFile file;
+
+        static const int SIZES[] = { 16 * 1024, 256 * 1024, 4 * 1024 * 1024 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        cout << "size(bytes)  operation  copy(MB/s)  scatter/gather(MB/s)"
+             << endl;
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int SIZE       = SIZES[si];
+            const int ITERATIONS = bsl::max(1,
+                                            static_cast<int>(
+                               static_cast<double>(TOTAL_MB) * 1024 * 1024
+                                                                     / SIZE));
+            const double MB = static_cast<double>(SIZE) * ITERATIONS
+                                                               / 1024 / 1024;
+
+            bdlbb::Blob blob(&factory);
+            loadPattern(&blob, SIZE);
+
+            file.truncate();
+            ASSERT(SIZE == Util::write(file.descriptor(), blob));
+
+            const double writeCopy   = toDouble(timeWriteCopy(
+                                                             file.descriptor(),
+                                                             blob,
+                                                             ITERATIONS));
+            const double writeGather = toDouble(timeWriteGather(
+                                                             file.descriptor(),
+                                                             blob,
+                                                             ITERATIONS));
+            const double readCopy    = toDouble(timeReadCopy(
+                                                             file.descriptor(),
+                                                             &factory,
+                                                             SIZE,
+                                                             ITERATIONS));
+            const double readScatter = toDouble(timeReadScatter(
+                                                             file.descriptor(),
+                                                             &factory,
+                                                             SIZE,
+                                                             ITERATIONS));
+
+            cout << SIZE << "  write  " << MB / writeCopy
+                 << "  " << MB / writeGather << endl
+                 << SIZE << "  read   " << MB / readCopy
+                 << "  " << MB / readScatter << endl;
+        }
+
+        if (veryVerbose) {
+            P(s_antiOptimization);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,2319 @@
+// bdlc_btree.h                                                       -*-C++-*-
+#ifndef INCLUDED_BDLC_BTREE
+#define INCLUDED_BDLC_BTREE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a cache-friendly B-tree for ordered containers.
+//
+//@CLASSES:
+//  bdlc::BTree: B-tree implementation of an ordered sequence of entries
+//  bdlc::BTree_IteratorImp: bidirectional iterator implementation
+//
+//@SEE_ALSO: bdlc_btreemap, bdlc_btreeset, bdlc_btreemultimap,
+//           bdlc_btreemultiset
+//
+//@DESCRIPTION: This component provides a class template, 'bdlc::BTree', that
+// implements an in-memory B-tree maintaining an ordered sequence of entries of
+// (template parameter) type 'ENTRY', each having a key of (template parameter)
+// type 'KEY' obtained through the (template parameter) 'ENTRY_UTIL' and
+// ordered by the (template parameter) 'COMPARATOR'.  'bdlc::BTree' is the
+// implementation underlying 'bdlc::BTreeMap', 'bdlc::BTreeSet',
+// 'bdlc::BTreeMultiMap', and 'bdlc::BTreeMultiSet'.
+//
+// Unlike the red-black tree used by 'bsl::map' (see 'bslalg_rbtreeutil'),
+// which allocates one node per element, a B-tree node stores many entries in a
+// contiguous array.  The number of entries per node is chosen so that a node
+// occupies roughly 256 bytes (and never fewer than 3 entries), which is the
+// size of a handful of cache lines.  Searching a node therefore touches few
+// cache lines, the height of the tree is much smaller than that of a binary
+// tree, and in-order iteration walks mostly contiguous memory.  The per
+// element memory overhead is also substantially lower than one node (three
+// pointers and a color) per element.
+//
+// The price paid for this locality is that entries are *moved* within and
+// between nodes as the tree is modified.  Any insertion or erasure invalidates
+// all iterators, pointers, and references into the tree.
+//
+///Requirements on 'ENTRY_UTIL'
+///----------------------------
+// The (template parameter) type 'ENTRY_UTIL' must provide the following static
+// member functions:
+//..
+//  static const KEY& key(const ENTRY& entry);
+//      // Return the key of the specified 'entry'.
+//
+//  template <class KEY_TYPE>
+//  static void construct(ENTRY                                       *entry,
+//                        bslma::Allocator                            *alloc,
+//                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key);
+//      // Load into the specified 'entry' the 'ENTRY' value comprised of the
+//      // specified 'key' (and a default value, if applicable), using the
+//      // specified 'alloc' to supply memory.
+//..
+//
+///Requirements on 'COMPARATOR'
+///----------------------------
+// 'COMPARATOR' must be a copy-constructible functor defining a strict weak
+// ordering on 'KEY' values.  The lookup methods of 'bdlc::BTree' are templates
+// on the type of the key being looked up; for a type 'LOOKUP_KEY' other than
+// 'KEY' to be used, 'COMPARATOR' must be callable with a 'KEY' and a
+// 'LOOKUP_KEY' in either order (i.e., it must be a "transparent" comparator).
+//
+///Exception Safety
+///----------------
+// Insertion provides the basic exception-safety guarantee: if an exception is
+// thrown, the tree is left in a valid state and the entry being inserted is
+// not present.  Erasure does not throw provided that the move constructor and
+// move-assignment operator of 'ENTRY' do not throw.
+//
+///Usage
+///-----
+// This component is an implementation detail of the 'bdlc' B-tree containers
+// and is *not* intended for direct client use.  Please see the usage examples
+// in 'bdlc_btreemap' and 'bdlc_btreeset'.
+
+#include <bdlscm_version.h>
+
+#include <bslalg_arraydestructionprimitives.h>
+#include <bslalg_arrayprimitives.h>
+#include <bslalg_swaputil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_destructorguard.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_util.h>    // 'forward(V)'
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentfromtype.h>
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_util.h>     // 'forward<T>(V)'
+
+#include <bslstl_bidirectionaliterator.h>
+#include <bslstl_iterator.h>
+#include <bslstl_pair.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+// FORWARD DECLARATIONS
+template <class ENTRY>
+class BTree_IteratorImp;
+
+template <class ENTRY>
+bool operator==(const BTree_IteratorImp<ENTRY>&,
+                const BTree_IteratorImp<ENTRY>&);
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+class BTree;
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void swap(BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& a,
+          BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& b);
+
+                              // =================
+                              // struct BTree_Node
+                              // =================
+
+template <class ENTRY>
+struct BTree_Node {
+    // This component-private 'struct' describes a leaf node of a B-tree
+    // holding up to 'k_CAPACITY' entries of the (template parameter) type
+    // 'ENTRY'.  An internal node is a 'BTree_InternalNode', which extends this
+    // type with an array of child pointers.  Entries occupy the first
+    // 'd_count' positions of 'd_entries'; the remaining positions are
+    // uninitialized.
+
+    // PUBLIC TYPES
+    enum {
+        k_TARGET_NODE_SIZE = 256,    // target size (in bytes) of the entries
+                                     // and header of a leaf node
+
+        k_HEADER_SIZE      = 2 * sizeof(void *),
+
+        k_NATURAL_CAPACITY = (k_TARGET_NODE_SIZE - k_HEADER_SIZE)
+                                                             / sizeof(ENTRY),
+
+        k_CAPACITY         = k_NATURAL_CAPACITY < 3 ? 3 : k_NATURAL_CAPACITY,
+                                     // maximum number of entries in a node
+
+        k_MIN_COUNT        = (k_CAPACITY - 1) / 2
+                                     // minimum number of entries in a
+                                     // non-root node
+    };
+
+    // PUBLIC DATA
+    BTree_Node                  *d_parent_p;  // parent node (0 for the root)
+
+    unsigned short               d_position;  // index of this node within the
+                                              // children of 'd_parent_p'
+
+    unsigned short               d_count;     // number of entries
+
+    bool                         d_isLeaf;    // 'true' if this node has no
+                                              // children
+
+    bsls::AlignedBuffer<k_CAPACITY * sizeof(ENTRY),
+                        bsls::AlignmentFromType<ENTRY>::VALUE>
+                                 d_entries;   // footprint of the entries
+
+    // MANIPULATORS
+    ENTRY *entries();
+        // Return the address of the first entry of this node.
+
+    // ACCESSORS
+    const ENTRY *entries() const;
+        // Return the address of the first entry of this node.
+};
+
+                          // =========================
+                          // struct BTree_InternalNode
+                          // =========================
+
+template <class ENTRY>
+struct BTree_InternalNode : BTree_Node<ENTRY> {
+    // This component-private 'struct' describes an internal node of a B-tree.
+    // An internal node having 'd_count' entries has exactly 'd_count + 1'
+    // children, and every key in the subtree rooted at 'd_children[i]' is
+    // ordered between the keys of entries 'i - 1' and 'i' of the node.
+
+    // PUBLIC DATA
+    BTree_Node<ENTRY> *d_children[BTree_Node<ENTRY>::k_CAPACITY + 1];
+                                                    // children of this node
+};
+
+                          // =======================
+                          // class BTree_IteratorImp
+                          // =======================
+
+template <class ENTRY>
+class BTree_IteratorImp {
+    // This class implements the methods required by
+    // 'bslstl::BidirectionalIterator' to provide bidirectional iterators over
+    // the entries of a 'BTree'.  An iterator is a (node, position) pair; the
+    // past-the-end iterator of a non-empty tree refers to the position one
+    // past the last entry of the right-most leaf, and the past-the-end
+    // iterator of an empty tree has a null node.
+
+    // PRIVATE TYPES
+    typedef BTree_Node<ENTRY>         Node;
+    typedef BTree_InternalNode<ENTRY> InternalNode;
+
+    // DATA
+    Node *d_node_p;      // node holding the referenced entry
+    int   d_position;    // index of the referenced entry within 'd_node_p'
+
+    // FRIENDS
+    friend bool operator==<>(const BTree_IteratorImp&,
+                             const BTree_IteratorImp&);
+
+  public:
+    // CREATORS
+    BTree_IteratorImp();
+        // Create a 'BTree_IteratorImp' having the default, non-dereferenceable
+        // value.
+
+    BTree_IteratorImp(Node *node, int position);
+        // Create a 'BTree_IteratorImp' referring to the entry at the specified
+        // 'position' within the specified 'node'.
+
+    //! BTree_IteratorImp(const BTree_IteratorImp& original) = default;
+    //! ~BTree_IteratorImp() = default;
+    //! BTree_IteratorImp& operator=(const BTree_IteratorImp& rhs) = default;
+
+    // MANIPULATORS
+    void operator++();
+        // Advance this iterator to the next entry in the ordered sequence of
+        // entries of the underlying tree, or to the past-the-end position if
+        // there is no such entry.  The behavior is undefined unless this
+        // iterator refers to a valid entry of the underlying tree.
+
+    void operator--();
+        // Move this iterator to the previous entry in the ordered sequence of
+        // entries of the underlying tree.  The behavior is undefined unless
+        // this iterator refers to a valid entry, or to the past-the-end
+        // position, of a non-empty tree and is not the first position.
+
+    // ACCESSORS
+    ENTRY& operator*() const;
+        // Return a reference to the entry referred to by this iterator.  The
+        // behavior is undefined unless this iterator refers to a valid entry.
+
+    Node *node() const;
+        // Return the node referred to by this iterator.
+
+    int position() const;
+        // Return the position, within 'node()', referred to by this iterator.
+};
+
+// FREE OPERATORS
+template <class ENTRY>
+bool operator==(const BTree_IteratorImp<ENTRY>& a,
+                const BTree_IteratorImp<ENTRY>& b);
+    // Return 'true' if the specified 'a' and 'b' refer to the same position
+    // of the same tree, and 'false' otherwise.
+
+                                 // ===========
+                                 // class BTree
+                                 // ===========
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+class BTree {
+    // This class template provides an in-memory B-tree holding an ordered
+    // sequence of 'ENTRY' objects, ordered by their 'KEY' (as determined by
+    // 'ENTRY_UTIL::key') using 'COMPARATOR'.  Entries having equivalent keys
+    // may be present if inserted with 'insertMulti' or 'emplaceMulti'; the
+    // relative order of such entries is the order of their insertion.
+
+    // PRIVATE TYPES
+    typedef BTree_Node<ENTRY>          Node;
+    typedef BTree_InternalNode<ENTRY>  InternalNode;
+    typedef BTree_IteratorImp<ENTRY>   IteratorImp;
+    typedef bslmf::MovableRefUtil      MoveUtil;
+
+    class TreeProctor;
+        // This private class provides a proctor that, unless released,
+        // destroys (and deallocates) a sub-tree on destruction.
+
+    class InsertGuard;
+        // This private class provides a guard that, unless released, restores
+        // the invariants of a tree after a failed insertion.
+
+  public:
+    // TYPES
+    typedef KEY        key_type;
+    typedef ENTRY      entry_type;
+    typedef ENTRY_UTIL entry_util_type;
+    typedef COMPARATOR key_compare;
+
+    typedef bslstl::BidirectionalIterator<ENTRY, IteratorImp> iterator;
+    typedef bslstl::BidirectionalIterator<const ENTRY, IteratorImp>
+                                                              const_iterator;
+
+    // PUBLIC CLASS DATA
+    static const int k_NODE_CAPACITY = Node::k_CAPACITY;
+                                             // maximum number of entries held
+                                             // in a single node
+
+  private:
+    // DATA
+    Node             *d_root_p;       // root node, or 0 if empty
+    Node             *d_leftmost_p;   // left-most leaf, or 0 if empty
+    Node             *d_rightmost_p;  // right-most leaf, or 0 if empty
+    bsl::size_t       d_size;         // number of entries
+    COMPARATOR        d_comparator;   // key ordering functor
+    bslma::Allocator *d_allocator_p;  // allocator (held, not owned)
+
+    // PRIVATE CLASS METHODS
+    static Node *child(const Node *node, int index);
+        // Return the child at the specified 'index' of the specified internal
+        // 'node'.
+
+    static Node **children(Node *node);
+        // Return the address of the array of children of the specified
+        // internal 'node'.
+
+    static void constructEntries(ENTRY            *toBegin,
+                                 ENTRY            *fromBegin,
+                                 ENTRY            *fromEnd,
+                                 bslma::Allocator *allocator,
+                                 bsl::true_type);
+    static void constructEntries(ENTRY            *toBegin,
+                                 ENTRY            *fromBegin,
+                                 ENTRY            *fromEnd,
+                                 bslma::Allocator *allocator,
+                                 bsl::false_type);
+        // Construct, at the uninitialized array beginning at the specified
+        // 'toBegin', the entries in the range '[fromBegin .. fromEnd)' using
+        // the specified 'allocator' to supply memory; the entries are moved
+        // if the last argument is 'bsl::true_type', and copied otherwise.
+
+    static void setChild(Node *parent, int index, Node *node);
+        // Make the specified 'node' the child at the specified 'index' of the
+        // specified internal 'parent'.
+
+    // PRIVATE MANIPULATORS
+    Node *allocateNode(bool isLeaf);
+        // Allocate and return an empty leaf node if the specified 'isLeaf' is
+        // 'true', and an empty internal node having null children otherwise.
+
+    template <class MOVE_TAG>
+    void cloneNode(Node *destination, Node *source, MOVE_TAG tag);
+        // Load into the specified empty 'destination' node copies (or moved
+        // values, if the specified 'tag' is 'bsl::true_type') of the entries
+        // of the specified 'source' node, and, recursively, clones of the
+        // children of 'source'.  'destination' must be a leaf if and only if
+        // 'source' is.  If an exception is thrown, the partially constructed
+        // sub-tree rooted at 'destination' remains valid for 'destroyTree'.
+
+    template <class MOVE_TAG>
+    void cloneTree(BTree *original, MOVE_TAG tag);
+        // Load into this empty tree a copy of the specified 'original' tree,
+        // moving the entries of 'original' if the specified 'tag' is
+        // 'bsl::true_type'.
+
+    void deallocateNode(Node *node);
+        // Return the memory of the specified 'node', whose entries must have
+        // already been destroyed or moved, to the allocator.
+
+    void destroyTree(Node *node);
+        // Destroy the entries of, and deallocate, the sub-tree rooted at the
+        // specified 'node'.  Null children are permitted and ignored.
+
+    IteratorImp endImp() const;
+        // Return the past-the-end iterator of this tree.
+
+    IteratorImp insertAtLeaf(Node *leaf, int position, ENTRY *entry);
+        // Move the specified 'entry' to the specified 'position' within the
+        // specified 'leaf', splitting nodes as required, and return an
+        // iterator referring to the inserted entry.  On return, '*entry' is
+        // left in a valid but unspecified state.
+
+    template <class ENTRY_TYPE>
+    IteratorImp insertMultiImp(
+                        const KEY&                                    key,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(ENTRY_TYPE) entry);
+        // Insert the specified 'entry', having the specified 'key', into this
+        // tree after any entries having an equivalent key, and return an
+        // iterator referring to the newly inserted entry.  'key' must remain
+        // valid until 'entry' has been inserted.
+
+    template <class ENTRY_TYPE>
+    bsl::pair<IteratorImp, bool> insertUniqueImp(
+                        const KEY&                                    key,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(ENTRY_TYPE) entry);
+        // Insert the specified 'entry', having the specified 'key', into this
+        // tree if no entry having an equivalent key is present.  Return a
+        // 'pair' whose 'first' member refers to the (possibly newly inserted)
+        // entry having a key equivalent to 'key', and whose 'second' member is
+        // 'true' if 'entry' was inserted.  'key' must remain valid until
+        // 'entry' has been inserted.
+
+    void mergeChildren(Node *parent, int index);
+        // Merge the child of the specified 'parent' at 'index + 1' into the
+        // child at the specified 'index', together with the separating entry
+        // 'index' of 'parent', and deallocate the emptied node.
+
+    void prepareForInsert(Node **leaf, int *position);
+        // Ensure the specified '*leaf' has room for one more entry, splitting
+        // it (and, as required, its ancestors) otherwise, and adjust '*leaf'
+        // and '*position' to refer to the location at which the new entry is
+        // to be placed.  If the tree is empty, create its root.
+
+    void rebalance(Node *node, Node **trackedNode, int *trackedPosition);
+        // Restore the occupancy invariant of the specified 'node', which may
+        // have one entry fewer than the required minimum, and recursively of
+        // its ancestors, by borrowing entries from siblings or merging nodes.
+        // Adjust the specified 'trackedNode' and 'trackedPosition' so that
+        // they continue to identify the same location in the ordered sequence
+        // of entries; '*trackedNode' is set to 0 if the tree becomes empty.
+
+    void rotateLeft(Node *parent, int index);
+        // Move the separating entry 'index' of the specified 'parent' to the
+        // end of the child at the specified 'index', and replace it with the
+        // first entry (and child) of the child at 'index + 1'.
+
+    void rotateRight(Node *parent, int index);
+        // Move the separating entry 'index' of the specified 'parent' to the
+        // front of the child at 'index + 1', and replace it with the last
+        // entry (and child) of the child at the specified 'index'.
+
+    void restoreRightSpine();
+        // Restore the occupancy invariant of the nodes on the right-most path
+        // of this tree, which may have been left under-full by 'insertSorted',
+        // by borrowing entries from their left siblings.
+
+    void splitNode(Node *node, int median);
+        // Split the specified full 'node' into two nodes, moving the entry at
+        // the specified 'median' position into its parent (which is itself
+        // split first if required, or created if 'node' is the root).  The
+        // entries (and children) following 'median' are moved to the new
+        // right sibling of 'node'.
+
+    // PRIVATE ACCESSORS
+    template <class LOOKUP_KEY>
+    int lowerBoundInNode(const Node *node, const LOOKUP_KEY& key) const;
+        // Return the index of the first entry in the specified 'node' whose
+        // key is not ordered before the specified 'key'.
+
+    template <class LOOKUP_KEY>
+    int upperBoundInNode(const Node *node, const LOOKUP_KEY& key) const;
+        // Return the index of the first entry in the specified 'node' whose
+        // key is ordered after the specified 'key'.
+
+    template <class LOOKUP_KEY>
+    IteratorImp lowerBoundImp(const LOOKUP_KEY& key) const;
+        // Return an iterator to the first entry whose key is not ordered
+        // before the specified 'key', or the past-the-end iterator.
+
+    template <class LOOKUP_KEY>
+    IteratorImp upperBoundImp(const LOOKUP_KEY& key) const;
+        // Return an iterator to the first entry whose key is ordered after the
+        // specified 'key', or the past-the-end iterator.
+
+    template <class LOOKUP_KEY>
+    IteratorImp findImp(const LOOKUP_KEY& key) const;
+        // Return an iterator to the first entry whose key is equivalent to the
+        // specified 'key', or the past-the-end iterator.
+
+  public:
+    // CREATORS
+    explicit BTree(const COMPARATOR&  comparator,
+                   bslma::Allocator  *basicAllocator = 0);
+        // Create an empty tree that orders its entries using the specified
+        // 'comparator'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  No memory is allocated.
+
+    BTree(const BTree& original, bslma::Allocator *basicAllocator = 0);
+        // Create a tree having the same value and comparator as the specified
+        // 'original'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The node structure of 'original' is replicated,
+        // so this operation takes linear time.
+
+    explicit BTree(bslmf::MovableRef<BTree> original);
+        // Create a tree having the same value, comparator, and allocator as
+        // the specified 'original' by moving (in constant time) the contents
+        // of 'original' to the new tree.  'original' is left empty.
+
+    BTree(bslmf::MovableRef<BTree>  original,
+          bslma::Allocator         *basicAllocator);
+        // Create a tree having the same value and comparator as the specified
+        // 'original', using the specified 'basicAllocator' to supply memory.
+        // If 'basicAllocator' is 0, the currently installed default allocator
+        // is used.  If 'original' uses the same allocator, its contents are
+        // moved in constant time and 'original' is left empty; otherwise, the
+        // entries of 'original' are moved into new nodes, and 'original' is
+        // left in a valid but unspecified state.
+
+    ~BTree();
+        // Destroy this object and each of its entries.
+
+    // MANIPULATORS
+    BTree& operator=(const BTree& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.
+
+    BTree& operator=(bslmf::MovableRef<BTree> rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  The contents of 'rhs' are moved (in constant time) to
+        // this object if the two have the same allocator, otherwise the
+        // entries of 'rhs' are moved into new nodes.  In either case, 'rhs' is
+        // left in a valid but unspecified state.
+
+    template <class KEY_TYPE>
+    bsl::pair<iterator, bool> findOrInsertKey(
+                             BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key);
+        // Return a 'pair' whose 'first' member refers to the entry in this
+        // tree having a key equivalent to the specified 'key', inserting an
+        // entry obtained from 'ENTRY_UTIL::construct' (with 'key') if no such
+        // entry exists, and whose 'second' member is 'true' if the entry was
+        // inserted and 'false' otherwise.
+
+    bsl::pair<iterator, bool> insertUnique(const ENTRY& entry);
+    bsl::pair<iterator, bool> insertUnique(bslmf::MovableRef<ENTRY> entry);
+        // Insert the specified 'entry' into this tree if no entry having an
+        // equivalent key is present; otherwise, this method has no effect.
+        // Return a 'pair' whose 'first' member refers to the (possibly newly
+        // inserted) entry having a key equivalent to that of 'entry', and
+        // whose 'second' member is 'true' if 'entry' was inserted.
+
+    template <class ENTRY_TYPE>
+    bsl::pair<iterator, bool> insertUnique(
+                         BSLS_COMPILERFEATURES_FORWARD_REF(ENTRY_TYPE) entry);
+        // Insert into this tree an 'ENTRY' constructed from the specified
+        // 'entry' if no entry having an equivalent key is present; otherwise,
+        // this method has no effect (other than constructing and destroying a
+        // temporary 'ENTRY').  Return a 'pair' whose 'first' member refers to
+        // the (possibly newly inserted) entry having a key equivalent to that
+        // of the constructed entry, and whose 'second' member is 'true' if an
+        // entry was inserted.
+
+    iterator insertMulti(const ENTRY& entry);
+    iterator insertMulti(bslmf::MovableRef<ENTRY> entry);
+        // Insert the specified 'entry' into this tree after any entries having
+        // an equivalent key, and return an iterator referring to the newly
+        // inserted entry.
+
+    template <class ENTRY_TYPE>
+    iterator insertMulti(BSLS_COMPILERFEATURES_FORWARD_REF(ENTRY_TYPE) entry);
+        // Insert into this tree, after any entries having an equivalent key,
+        // an 'ENTRY' constructed from the specified 'entry', and return an
+        // iterator referring to the newly inserted entry.
+
+    template <class INPUT_ITERATOR>
+    void insertSorted(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert the entries in the range '[first .. last)', which must be
+        // sorted by key according to the comparator of this tree, into this
+        // empty tree, filling each leaf before starting the next.  The
+        // behavior is undefined unless this tree is empty and the range is
+        // sorted.  Note that the resulting tree is as compact as possible and
+        // is built in linear time, without key comparisons; if this tree is
+        // used for a unique-key container, the keys in the range must also be
+        // unique.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... ARGS>
+    bsl::pair<iterator, bool> emplaceUnique(ARGS&&... arguments);
+        // Insert into this tree an entry constructed by forwarding this tree's
+        // allocator and the specified 'arguments' to the constructor of
+        // 'ENTRY', if no entry having an equivalent key is present; otherwise,
+        // this method has no effect (other than constructing and destroying a
+        // temporary entry).  Return a 'pair' whose 'first' member refers to
+        // the (possibly newly inserted) entry and whose 'second' member is
+        // 'true' if an entry was inserted.
+
+    template <class... ARGS>
+    iterator emplaceMulti(ARGS&&... arguments);
+        // Insert into this tree, after any entries having an equivalent key,
+        // an entry constructed by forwarding this tree's allocator and the
+        // specified 'arguments' to the constructor of 'ENTRY', and return an
+        // iterator referring to the inserted entry.
+#endif
+
+    void clear();
+        // Remove all entries from this tree and release all of its nodes.
+
+    iterator erase(const_iterator position);
+        // Remove from this tree the entry at the specified 'position', and
+        // return an iterator referring to the entry that followed it (or the
+        // past-the-end iterator).  All iterators, pointers, and references
+        // into this tree are invalidated.  The behavior is undefined unless
+        // 'position' refers to an entry of this tree.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this tree the entries in the range '[first .. last)',
+        // and return an iterator referring to the entry formerly referred to
+        // by 'last'.  All iterators, pointers, and references into this tree
+        // are invalidated.  The behavior is undefined unless '[first .. last)'
+        // is a valid range of this tree.
+
+    bsl::size_t eraseKey(const KEY& key);
+        // Remove from this tree all entries having a key equivalent to the
+        // specified 'key', and return the number of entries removed.
+
+    template <class LOOKUP_KEY>
+    iterator find(const LOOKUP_KEY& key);
+        // Return an iterator to the first entry having a key equivalent to the
+        // specified 'key', or 'end()' if there is no such entry.
+
+    template <class LOOKUP_KEY>
+    iterator lower_bound(const LOOKUP_KEY& key);
+        // Return an iterator to the first entry whose key is not ordered
+        // before the specified 'key', or 'end()' if there is no such entry.
+
+    template <class LOOKUP_KEY>
+    iterator upper_bound(const LOOKUP_KEY& key);
+        // Return an iterator to the first entry whose key is ordered after the
+        // specified 'key', or 'end()' if there is no such entry.
+
+    template <class LOOKUP_KEY>
+    bsl::pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+        // Return the pair 'lower_bound(key), upper_bound(key)' for the
+        // specified 'key'.
+
+                          // Iterators
+
+    iterator begin();
+        // Return an iterator to the first entry of this tree, or 'end()' if
+        // this tree is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this tree.
+
+                             // Aspects
+
+    void swap(BTree& other);
+        // Efficiently exchange the value and comparator of this tree with
+        // those of the specified 'other' tree.  This method provides the
+        // no-throw exception-safety guarantee.  The behavior is undefined
+        // unless this tree was created with the same allocator as 'other'.
+
+    // ACCESSORS
+    template <class LOOKUP_KEY>
+    bool contains(const LOOKUP_KEY& key) const;
+        // Return 'true' if this tree contains an entry having a key equivalent
+        // to the specified 'key', and 'false' otherwise.
+
+    template <class LOOKUP_KEY>
+    bsl::size_t count(const LOOKUP_KEY& key) const;
+        // Return the number of entries having a key equivalent to the
+        // specified 'key'.
+
+    bool empty() const;
+        // Return 'true' if this tree has no entries, and 'false' otherwise.
+
+    template <class LOOKUP_KEY>
+    const_iterator find(const LOOKUP_KEY& key) const;
+        // Return an iterator to the first entry having a key equivalent to the
+        // specified 'key', or 'end()' if there is no such entry.
+
+    template <class LOOKUP_KEY>
+    const_iterator lower_bound(const LOOKUP_KEY& key) const;
+        // Return an iterator to the first entry whose key is not ordered
+        // before the specified 'key', or 'end()' if there is no such entry.
+
+    template <class LOOKUP_KEY>
+    const_iterator upper_bound(const LOOKUP_KEY& key) const;
+        // Return an iterator to the first entry whose key is ordered after the
+        // specified 'key', or 'end()' if there is no such entry.
+
+    template <class LOOKUP_KEY>
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                  const LOOKUP_KEY& key) const;
+        // Return the pair 'lower_bound(key), upper_bound(key)' for the
+        // specified 'key'.
+
+    int height() const;
+        // Return the number of levels of this tree, or 0 if it is empty.
+
+    bsl::size_t size() const;
+        // Return the number of entries in this tree.
+
+                          // Iterators
+
+    const_iterator begin() const;
+        // Return an iterator to the first entry of this tree, or 'end()' if
+        // this tree is empty.
+
+    const_iterator end() const;
+        // Return the past-the-end iterator of this tree.
+
+                             // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this tree to supply memory.
+
+    const COMPARATOR& comparator() const;
+        // Return a reference providing non-modifiable access to the key
+        // ordering functor of this tree.
+};
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+bool operator==(const BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& lhs,
+                const BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'BTree' objects have the same value
+    // if they have the same number of entries and corresponding entries in
+    // their ordered sequences compare equal using 'operator=='.
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+bool operator!=(const BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& lhs,
+                const BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void swap(BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& a,
+          BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& b);
+    // Exchange the value and comparator of the specified 'a' and 'b' objects.
+    // This function provides the no-throw exception-safety guarantee if the
+    // two objects were created with the same allocator and the basic
+    // guarantee otherwise.
+
+                     // ================================
+                     // class BTree<...>::TreeProctor
+                     // ================================
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+class BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::TreeProctor {
+    // This private class provides a proctor that destroys the sub-tree rooted
+    // at a managed node on destruction unless 'release' has been called.
+
+    // DATA
+    BTree *d_tree_p;  // tree providing 'destroyTree'
+    Node  *d_node_p;  // managed sub-tree, or 0 if released
+
+  private:
+    // NOT IMPLEMENTED
+    TreeProctor(const TreeProctor&);
+    TreeProctor& operator=(const TreeProctor&);
+
+  public:
+    // CREATORS
+    TreeProctor(BTree *tree, Node *node)
+        // Create a proctor managing the sub-tree rooted at the specified
+        // 'node' of the specified 'tree'.
+    : d_tree_p(tree)
+    , d_node_p(node)
+    {
+    }
+
+    ~TreeProctor()
+        // Destroy the managed sub-tree, if any.
+    {
+        if (d_node_p) {
+            d_tree_p->destroyTree(d_node_p);
+        }
+    }
+
+    // MANIPULATORS
+    void release()
+        // Release the managed sub-tree from management by this proctor.
+    {
+        d_node_p = 0;
+    }
+};
+
+                     // ================================
+                     // class BTree<...>::InsertGuard
+                     // ================================
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+class BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::InsertGuard {
+    // This private class provides a guard that, on destruction unless
+    // 'release' has been called, restores the invariants of a tree into which
+    // the construction of an entry has failed: the nodes on the right-most
+    // path of the tree are topped up (see 'insertSorted') and a root node left
+    // without entries is deallocated.
+
+    // DATA
+    BTree *d_tree_p;  // guarded tree, or 0 if released
+
+  private:
+    // NOT IMPLEMENTED
+    InsertGuard(const InsertGuard&);
+    InsertGuard& operator=(const InsertGuard&);
+
+  public:
+    // CREATORS
+    explicit InsertGuard(BTree *tree)
+        // Create a guard for the specified 'tree'.
+    : d_tree_p(tree)
+    {
+    }
+
+    ~InsertGuard()
+        // Restore the invariants of the guarded tree, if any.
+    {
+        if (d_tree_p) {
+            d_tree_p->restoreRightSpine();
+            if (0 == d_tree_p->d_size) {
+                d_tree_p->clear();
+            }
+        }
+    }
+
+    // MANIPULATORS
+    void release()
+        // Release the tree from management by this guard.
+    {
+        d_tree_p = 0;
+    }
+};
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                              // -----------------
+                              // struct BTree_Node
+                              // -----------------
+
+// MANIPULATORS
+template <class ENTRY>
+inline
+ENTRY *BTree_Node<ENTRY>::entries()
+{
+    return reinterpret_cast<ENTRY *>(d_entries.buffer());
+}
+
+// ACCESSORS
+template <class ENTRY>
+inline
+const ENTRY *BTree_Node<ENTRY>::entries() const
+{
+    return reinterpret_cast<const ENTRY *>(d_entries.buffer());
+}
+
+                          // -----------------------
+                          // class BTree_IteratorImp
+                          // -----------------------
+
+// CREATORS
+template <class ENTRY>
+inline
+BTree_IteratorImp<ENTRY>::BTree_IteratorImp()
+: d_node_p(0)
+, d_position(0)
+{
+}
+
+template <class ENTRY>
+inline
+BTree_IteratorImp<ENTRY>::BTree_IteratorImp(Node *node, int position)
+: d_node_p(node)
+, d_position(position)
+{
+}
+
+// MANIPULATORS
+template <class ENTRY>
+void BTree_IteratorImp<ENTRY>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+    BSLS_ASSERT_SAFE(d_position < d_node_p->d_count);
+
+    if (d_node_p->d_isLeaf) {
+        ++d_position;
+        if (d_position < d_node_p->d_count) {
+            return;                                                   // RETURN
+        }
+
+        // Climb until an ancestor has an entry following the sub-tree just
+        // exhausted.  If there is none, leave this iterator at the
+        // past-the-end position of the right-most leaf.
+
+        Node *node     = d_node_p;
+        int   position = d_position;
+        while (position == node->d_count && node->d_parent_p) {
+            position = node->d_position;
+            node     = node->d_parent_p;
+        }
+        if (position < node->d_count) {
+            d_node_p   = node;
+            d_position = position;
+        }
+    }
+    else {
+        Node *node = static_cast<InternalNode *>(d_node_p)->
+                                                   d_children[d_position + 1];
+        while (!node->d_isLeaf) {
+            node = static_cast<InternalNode *>(node)->d_children[0];
+        }
+        d_node_p   = node;
+        d_position = 0;
+    }
+}
+
+template <class ENTRY>
+void BTree_IteratorImp<ENTRY>::operator--()
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    if (d_node_p->d_isLeaf) {
+        if (0 < d_position) {
+            --d_position;
+            return;                                                   // RETURN
+        }
+
+        Node *node     = d_node_p;
+        int   position = 0;
+        while (0 == position && node->d_parent_p) {
+            position = node->d_position;
+            node     = node->d_parent_p;
+        }
+
+        BSLS_ASSERT_SAFE(0 < position);
+
+        d_node_p   = node;
+        d_position = position - 1;
+    }
+    else {
+        Node *node = static_cast<InternalNode *>(d_node_p)->
+                                                       d_children[d_position];
+        while (!node->d_isLeaf) {
+            node = static_cast<InternalNode *>(node)->
+                                                   d_children[node->d_count];
+        }
+        d_node_p   = node;
+        d_position = node->d_count - 1;
+    }
+}
+
+// ACCESSORS
+template <class ENTRY>
+inline
+ENTRY& BTree_IteratorImp<ENTRY>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+    BSLS_ASSERT_SAFE(d_position < d_node_p->d_count);
+
+    return d_node_p->entries()[d_position];
+}
+
+template <class ENTRY>
+inline
+typename BTree_IteratorImp<ENTRY>::Node *
+BTree_IteratorImp<ENTRY>::node() const
+{
+    return d_node_p;
+}
+
+template <class ENTRY>
+inline
+int BTree_IteratorImp<ENTRY>::position() const
+{
+    return d_position;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class ENTRY>
+inline
+bool bdlc::operator==(const BTree_IteratorImp<ENTRY>& a,
+                      const BTree_IteratorImp<ENTRY>& b)
+{
+    return a.d_node_p == b.d_node_p && a.d_position == b.d_position;
+}
+
+namespace bdlc {
+
+                                 // -----------
+                                 // class BTree
+                                 // -----------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::Node *
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::child(const Node *node, int index)
+{
+    BSLS_ASSERT_SAFE(!node->d_isLeaf);
+
+    return static_cast<const InternalNode *>(node)->d_children[index];
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::Node **
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::children(Node *node)
+{
+    BSLS_ASSERT_SAFE(!node->d_isLeaf);
+
+    return static_cast<InternalNode *>(node)->d_children;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::constructEntries(
+                                                 ENTRY            *toBegin,
+                                                 ENTRY            *fromBegin,
+                                                 ENTRY            *fromEnd,
+                                                 bslma::Allocator *allocator,
+                                                 bsl::true_type)
+{
+    bslalg::ArrayPrimitives::moveConstruct(toBegin,
+                                           fromBegin,
+                                           fromEnd,
+                                           allocator);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::constructEntries(
+                                                 ENTRY            *toBegin,
+                                                 ENTRY            *fromBegin,
+                                                 ENTRY            *fromEnd,
+                                                 bslma::Allocator *allocator,
+                                                 bsl::false_type)
+{
+    bslalg::ArrayPrimitives::copyConstruct(
+                                         toBegin,
+                                         static_cast<const ENTRY *>(fromBegin),
+                                         static_cast<const ENTRY *>(fromEnd),
+                                         allocator);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::setChild(Node *parent,
+                                                         int   index,
+                                                         Node *node)
+{
+    children(parent)[index] = node;
+    node->d_parent_p        = parent;
+    node->d_position        = static_cast<unsigned short>(index);
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::Node *
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::allocateNode(bool isLeaf)
+{
+    Node *node;
+    if (isLeaf) {
+        node = static_cast<Node *>(d_allocator_p->allocate(sizeof(Node)));
+    }
+    else {
+        InternalNode *internal = static_cast<InternalNode *>(
+                                d_allocator_p->allocate(sizeof(InternalNode)));
+        bsl::memset(internal->d_children, 0, sizeof internal->d_children);
+        node = internal;
+    }
+
+    node->d_parent_p = 0;
+    node->d_position = 0;
+    node->d_count    = 0;
+    node->d_isLeaf   = isLeaf;
+
+    return node;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class MOVE_TAG>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::cloneNode(
+                                                        Node     *destination,
+                                                        Node     *source,
+                                                        MOVE_TAG  tag)
+{
+    BSLS_ASSERT_SAFE(destination);
+    BSLS_ASSERT_SAFE(source);
+    BSLS_ASSERT_SAFE(0 == destination->d_count);
+    BSLS_ASSERT_SAFE(destination->d_isLeaf == source->d_isLeaf);
+
+    constructEntries(destination->entries(),
+                     source->entries(),
+                     source->entries() + source->d_count,
+                     d_allocator_p,
+                     tag);
+    destination->d_count = source->d_count;
+
+    if (!source->d_isLeaf) {
+        for (int i = 0; i <= source->d_count; ++i) {
+            Node *sourceChild = child(source, i);
+            Node *node        = allocateNode(sourceChild->d_isLeaf);
+
+            setChild(destination, i, node);
+            cloneNode(node, sourceChild, tag);
+        }
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class MOVE_TAG>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::cloneTree(BTree    *original,
+                                                          MOVE_TAG  tag)
+{
+    BSLS_ASSERT_SAFE(0 == d_root_p);
+
+    if (0 == original->d_root_p) {
+        return;                                                       // RETURN
+    }
+
+    Node *root = allocateNode(original->d_root_p->d_isLeaf);
+
+    TreeProctor proctor(this, root);
+
+    cloneNode(root, original->d_root_p, tag);
+
+    proctor.release();
+
+    d_root_p = root;
+    d_size   = original->d_size;
+
+    d_leftmost_p = root;
+    while (!d_leftmost_p->d_isLeaf) {
+        d_leftmost_p = child(d_leftmost_p, 0);
+    }
+    d_rightmost_p = root;
+    while (!d_rightmost_p->d_isLeaf) {
+        d_rightmost_p = child(d_rightmost_p, d_rightmost_p->d_count);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::deallocateNode(Node *node)
+{
+    d_allocator_p->deallocate(node);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::destroyTree(Node *node)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    bslalg::ArrayDestructionPrimitives::destroy(node->entries(),
+                                                node->entries() +
+                                                               node->d_count);
+
+    if (!node->d_isLeaf) {
+        Node **nodes = children(node);
+        for (int i = 0; i <= Node::k_CAPACITY && nodes[i]; ++i) {
+            destroyTree(nodes[i]);
+        }
+    }
+
+    deallocateNode(node);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::IteratorImp
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::endImp() const
+{
+    return d_rightmost_p ? IteratorImp(d_rightmost_p, d_rightmost_p->d_count)
+                         : IteratorImp();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::IteratorImp
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insertAtLeaf(Node  *leaf,
+                                                        int    position,
+                                                        ENTRY *entry)
+{
+    prepareForInsert(&leaf, &position);
+
+    ENTRY *entries = leaf->entries();
+    bslalg::ArrayPrimitives::emplace(entries + position,
+                                     entries + leaf->d_count,
+                                     d_allocator_p,
+                                     MoveUtil::move(*entry));
+    ++leaf->d_count;
+    ++d_size;
+
+    return IteratorImp(leaf, position);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class ENTRY_TYPE>
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::IteratorImp
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insertMultiImp(
+                        const KEY&                                    key,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(ENTRY_TYPE) entry)
+{
+    Node *node     = d_root_p;
+    Node *leaf     = 0;
+    int   position = 0;
+    while (node) {
+        position = upperBoundInNode(node, key);
+        leaf     = node;
+        node     = node->d_isLeaf ? 0 : child(node, position);
+    }
+
+    prepareForInsert(&leaf, &position);
+
+    InsertGuard guard(this);
+
+    ENTRY *entries = leaf->entries();
+    bslalg::ArrayPrimitives::emplace(
+                             entries + position,
+                             entries + leaf->d_count,
+                             d_allocator_p,
+                             BSLS_COMPILERFEATURES_FORWARD(ENTRY_TYPE, entry));
+    ++leaf->d_count;
+    ++d_size;
+
+    guard.release();
+
+    return IteratorImp(leaf, position);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class ENTRY_TYPE>
+bsl::pair<typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::IteratorImp,
+          bool>
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insertUniqueImp(
+                        const KEY&                                    key,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(ENTRY_TYPE) entry)
+{
+    Node *node     = d_root_p;
+    Node *leaf     = 0;
+    int   position = 0;
+    while (node) {
+        position = lowerBoundInNode(node, key);
+        if (position < node->d_count
+         && !d_comparator(key, ENTRY_UTIL::key(node->entries()[position]))) {
+            return bsl::pair<IteratorImp, bool>(IteratorImp(node, position),
+                                                false);               // RETURN
+        }
+        leaf = node;
+        node = node->d_isLeaf ? 0 : child(node, position);
+    }
+
+    prepareForInsert(&leaf, &position);
+
+    InsertGuard guard(this);
+
+    ENTRY *entries = leaf->entries();
+    bslalg::ArrayPrimitives::emplace(
+                             entries + position,
+                             entries + leaf->d_count,
+                             d_allocator_p,
+                             BSLS_COMPILERFEATURES_FORWARD(ENTRY_TYPE, entry));
+    ++leaf->d_count;
+    ++d_size;
+
+    guard.release();
+
+    return bsl::pair<IteratorImp, bool>(IteratorImp(leaf, position), true);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::mergeChildren(Node *parent,
+                                                              int   index)
+{
+    Node *left  = child(parent, index);
+    Node *right = child(parent, index + 1);
+
+    BSLS_ASSERT_SAFE(left->d_count + right->d_count + 1 <= Node::k_CAPACITY);
+
+    ENTRY *parentEntries = parent->entries();
+    ENTRY *leftEntries   = left->entries();
+
+    // Bring down the separator, then append the entries of 'right'.
+
+    bslma::ConstructionUtil::construct(
+                                  leftEntries + left->d_count,
+                                  d_allocator_p,
+                                  MoveUtil::move(parentEntries[index]));
+    bslalg::ArrayPrimitives::destructiveMove(leftEntries + left->d_count + 1,
+                                             right->entries(),
+                                             right->entries() + right->d_count,
+                                             d_allocator_p);
+
+    if (!left->d_isLeaf) {
+        for (int i = 0; i <= right->d_count; ++i) {
+            setChild(left, left->d_count + 1 + i, child(right, i));
+        }
+    }
+
+    left->d_count = static_cast<unsigned short>(
+                                        left->d_count + 1 + right->d_count);
+    right->d_count = 0;
+
+    // Remove the separator and the pointer to 'right' from 'parent'.
+
+    bslalg::ArrayPrimitives::erase(parentEntries + index,
+                                   parentEntries + index + 1,
+                                   parentEntries + parent->d_count,
+                                   d_allocator_p);
+    for (int i = index + 2; i <= parent->d_count; ++i) {
+        setChild(parent, i - 1, child(parent, i));
+    }
+    children(parent)[parent->d_count] = 0;
+    --parent->d_count;
+
+    if (right == d_rightmost_p) {
+        d_rightmost_p = left;
+    }
+    deallocateNode(right);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::prepareForInsert(
+                                                              Node **leaf,
+                                                              int   *position)
+{
+    if (0 == *leaf) {
+        BSLS_ASSERT_SAFE(0 == d_root_p);
+
+        d_root_p      = allocateNode(true);
+        d_leftmost_p  = d_root_p;
+        d_rightmost_p = d_root_p;
+        *leaf         = d_root_p;
+        *position     = 0;
+        return;                                                       // RETURN
+    }
+
+    if (Node::k_CAPACITY == (*leaf)->d_count) {
+        const int mid = Node::k_CAPACITY / 2;
+
+        splitNode(*leaf, mid);
+
+        if (*position > mid) {
+            *position -= mid + 1;
+            *leaf      = child((*leaf)->d_parent_p, (*leaf)->d_position + 1);
+        }
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::rebalance(
+                                                   Node  *node,
+                                                   Node **trackedNode,
+                                                   int   *trackedPosition)
+{
+    while (node != d_root_p && node->d_count < Node::k_MIN_COUNT) {
+        Node *parent = node->d_parent_p;
+        int   index  = node->d_position;
+
+        if (0 < index && child(parent, index - 1)->d_count >
+                                                         Node::k_MIN_COUNT) {
+            rotateRight(parent, index - 1);
+            if (*trackedNode == node) {
+                ++*trackedPosition;
+            }
+            return;                                                   // RETURN
+        }
+        if (index < parent->d_count && child(parent, index + 1)->d_count >
+                                                         Node::k_MIN_COUNT) {
+            rotateLeft(parent, index);
+            return;                                                   // RETURN
+        }
+
+        if (index < parent->d_count) {
+            mergeChildren(parent, index);
+        }
+        else {
+            Node *left = child(parent, index - 1);
+            if (*trackedNode == node) {
+                *trackedNode      = left;
+                *trackedPosition += left->d_count + 1;
+            }
+            mergeChildren(parent, index - 1);
+        }
+        node = parent;
+    }
+
+    if (node == d_root_p && 0 == node->d_count) {
+        if (node->d_isLeaf) {
+            d_root_p      = 0;
+            d_leftmost_p  = 0;
+            d_rightmost_p = 0;
+            *trackedNode  = 0;
+        }
+        else {
+            d_root_p              = child(node, 0);
+            d_root_p->d_parent_p  = 0;
+            d_root_p->d_position  = 0;
+        }
+        deallocateNode(node);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::restoreRightSpine()
+{
+    for (Node *node = d_rightmost_p; node && node != d_root_p;
+                                                   node = node->d_parent_p) {
+        while (node->d_count < Node::k_MIN_COUNT) {
+            rotateRight(node->d_parent_p, node->d_position - 1);
+        }
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::rotateLeft(Node *parent,
+                                                           int   index)
+{
+    Node *left  = child(parent, index);
+    Node *right = child(parent, index + 1);
+
+    ENTRY *parentEntries = parent->entries();
+    ENTRY *rightEntries  = right->entries();
+
+    bslma::ConstructionUtil::construct(
+                                  left->entries() + left->d_count,
+                                  d_allocator_p,
+                                  MoveUtil::move(parentEntries[index]));
+    ++left->d_count;
+
+    parentEntries[index] = MoveUtil::move(rightEntries[0]);
+    bslalg::ArrayPrimitives::erase(rightEntries,
+                                   rightEntries + 1,
+                                   rightEntries + right->d_count,
+                                   d_allocator_p);
+
+    if (!left->d_isLeaf) {
+        setChild(left, left->d_count, child(right, 0));
+        for (int i = 1; i <= right->d_count; ++i) {
+            setChild(right, i - 1, child(right, i));
+        }
+        children(right)[right->d_count] = 0;
+    }
+    --right->d_count;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::rotateRight(Node *parent,
+                                                            int   index)
+{
+    Node *left  = child(parent, index);
+    Node *right = child(parent, index + 1);
+
+    ENTRY *parentEntries = parent->entries();
+    ENTRY *leftEntries   = left->entries();
+    ENTRY *rightEntries  = right->entries();
+
+    bslalg::ArrayPrimitives::emplace(rightEntries,
+                                     rightEntries + right->d_count,
+                                     d_allocator_p,
+                                     MoveUtil::move(parentEntries[index]));
+    ++right->d_count;
+
+    parentEntries[index] = MoveUtil::move(leftEntries[left->d_count - 1]);
+    bslma::DestructionUtil::destroy(leftEntries + left->d_count - 1);
+
+    if (!right->d_isLeaf) {
+        for (int i = right->d_count - 1; i >= 0; --i) {
+            setChild(right, i + 1, child(right, i));
+        }
+        setChild(right, 0, child(left, left->d_count));
+        children(left)[left->d_count] = 0;
+    }
+    --left->d_count;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::splitNode(Node *node,
+                                                          int   median)
+{
+    BSLS_ASSERT_SAFE(Node::k_CAPACITY == node->d_count);
+    BSLS_ASSERT_SAFE(0 <= median && median < Node::k_CAPACITY);
+
+    // Allocate all required nodes before modifying the tree, so that the tree
+    // is left unchanged if an allocation fails.
+
+    Node        *sibling = allocateNode(node->d_isLeaf);
+    TreeProctor  proctor(this, sibling);
+
+    Node *parent = node->d_parent_p;
+    if (0 == parent) {
+        parent = allocateNode(false);
+        setChild(parent, 0, node);
+        d_root_p = parent;
+    }
+    else if (Node::k_CAPACITY == parent->d_count) {
+        splitNode(parent, median);
+        parent = node->d_parent_p;
+    }
+
+    proctor.release();
+
+    const int index = node->d_position;
+
+    ENTRY *entries       = node->entries();
+    ENTRY *parentEntries = parent->entries();
+
+    // Move the entries (and children) following 'median' to 'sibling'.
+
+    bslalg::ArrayPrimitives::destructiveMove(sibling->entries(),
+                                             entries + median + 1,
+                                             entries + Node::k_CAPACITY,
+                                             d_allocator_p);
+    sibling->d_count = static_cast<unsigned short>(
+                                             Node::k_CAPACITY - median - 1);
+    node->d_count    = static_cast<unsigned short>(median + 1);
+
+    if (!node->d_isLeaf) {
+        for (int i = median + 1; i <= Node::k_CAPACITY; ++i) {
+            setChild(sibling, i - median - 1, child(node, i));
+            children(node)[i] = 0;
+        }
+    }
+
+    // Move the median entry into 'parent', followed by 'sibling'.
+
+    bslalg::ArrayPrimitives::emplace(parentEntries + index,
+                                     parentEntries + parent->d_count,
+                                     d_allocator_p,
+                                     MoveUtil::move(entries[median]));
+    bslma::DestructionUtil::destroy(entries + median);
+    node->d_count = static_cast<unsigned short>(median);
+
+    for (int i = parent->d_count; i > index; --i) {
+        setChild(parent, i + 1, child(parent, i));
+    }
+    setChild(parent, index + 1, sibling);
+    ++parent->d_count;
+
+    if (node == d_rightmost_p) {
+        d_rightmost_p = sibling;
+    }
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+int BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::lowerBoundInNode(
+                                             const Node        *node,
+                                             const LOOKUP_KEY&  key) const
+{
+    const ENTRY *entries = node->entries();
+
+    int first = 0;
+    int count = node->d_count;
+    while (0 < count) {
+        const int half = count / 2;
+        if (d_comparator(ENTRY_UTIL::key(entries[first + half]), key)) {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else {
+            count = half;
+        }
+    }
+    return first;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+int BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::upperBoundInNode(
+                                             const Node        *node,
+                                             const LOOKUP_KEY&  key) const
+{
+    const ENTRY *entries = node->entries();
+
+    int first = 0;
+    int count = node->d_count;
+    while (0 < count) {
+        const int half = count / 2;
+        if (!d_comparator(key, ENTRY_UTIL::key(entries[first + half]))) {
+            first += half + 1;
+            count -= half + 1;
+        }
+        else {
+            count = half;
+        }
+    }
+    return first;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class LOOKUP_KEY>
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::IteratorImp
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::lowerBoundImp(
+                                                  const LOOKUP_KEY& key) const
+{
+    IteratorImp result = endImp();
+
+    Node *node = d_root_p;
+    while (node) {
+        const int index = lowerBoundInNode(node, key);
+        if (index < node->d_count) {
+            result = IteratorImp(node, index);
+        }
+        node = node->d_isLeaf ? 0 : child(node, index);
+    }
+    return result;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class LOOKUP_KEY>
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::IteratorImp
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::upperBoundImp(
+                                                  const LOOKUP_KEY& key) const
+{
+    IteratorImp result = endImp();
+
+    Node *node = d_root_p;
+    while (node) {
+        const int index = upperBoundInNode(node, key);
+        if (index < node->d_count) {
+            result = IteratorImp(node, index);
+        }
+        node = node->d_isLeaf ? 0 : child(node, index);
+    }
+    return result;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class LOOKUP_KEY>
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::IteratorImp
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::findImp(
+                                                  const LOOKUP_KEY& key) const
+{
+    IteratorImp result = lowerBoundImp(key);
+    if (result.node() && result.position() < result.node()->d_count
+     && !d_comparator(key, ENTRY_UTIL::key(*result))) {
+        return result;                                                // RETURN
+    }
+    return endImp();
+}
+
+// CREATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::BTree(
+                                          const COMPARATOR&  comparator,
+                                          bslma::Allocator  *basicAllocator)
+: d_root_p(0)
+, d_leftmost_p(0)
+, d_rightmost_p(0)
+, d_size(0)
+, d_comparator(comparator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::BTree(
+                                             const BTree&      original,
+                                             bslma::Allocator *basicAllocator)
+: d_root_p(0)
+, d_leftmost_p(0)
+, d_rightmost_p(0)
+, d_size(0)
+, d_comparator(original.d_comparator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    cloneTree(const_cast<BTree *>(&original), bsl::false_type());
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::BTree(
+                                            bslmf::MovableRef<BTree> original)
+: d_root_p(MoveUtil::access(original).d_root_p)
+, d_leftmost_p(MoveUtil::access(original).d_leftmost_p)
+, d_rightmost_p(MoveUtil::access(original).d_rightmost_p)
+, d_size(MoveUtil::access(original).d_size)
+, d_comparator(MoveUtil::access(original).d_comparator)
+, d_allocator_p(MoveUtil::access(original).d_allocator_p)
+{
+    BTree& lvalue = original;
+
+    lvalue.d_root_p      = 0;
+    lvalue.d_leftmost_p  = 0;
+    lvalue.d_rightmost_p = 0;
+    lvalue.d_size        = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::BTree(
+                                    bslmf::MovableRef<BTree>  original,
+                                    bslma::Allocator         *basicAllocator)
+: d_root_p(0)
+, d_leftmost_p(0)
+, d_rightmost_p(0)
+, d_size(0)
+, d_comparator(MoveUtil::access(original).d_comparator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BTree& lvalue = original;
+
+    if (d_allocator_p == lvalue.d_allocator_p) {
+        d_root_p      = lvalue.d_root_p;
+        d_leftmost_p  = lvalue.d_leftmost_p;
+        d_rightmost_p = lvalue.d_rightmost_p;
+        d_size        = lvalue.d_size;
+
+        lvalue.d_root_p      = 0;
+        lvalue.d_leftmost_p  = 0;
+        lvalue.d_rightmost_p = 0;
+        lvalue.d_size        = 0;
+    }
+    else {
+        cloneTree(&lvalue, bsl::true_type());
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::~BTree()
+{
+    clear();
+}
+
+// MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>&
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::operator=(const BTree& rhs)
+{
+    if (this != &rhs) {
+        BTree(rhs, d_allocator_p).swap(*this);
+    }
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>&
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::operator=(
+                                                 bslmf::MovableRef<BTree> rhs)
+{
+    BTree& lvalue = rhs;
+
+    if (this != &lvalue) {
+        BTree(MoveUtil::move(lvalue), d_allocator_p).swap(*this);
+    }
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class KEY_TYPE>
+bsl::pair<typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator, bool>
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::findOrInsertKey(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key)
+{
+    Node *node     = d_root_p;
+    Node *leaf     = 0;
+    int   position = 0;
+    while (node) {
+        position = lowerBoundInNode(node, key);
+        if (position < node->d_count
+         && !d_comparator(key, ENTRY_UTIL::key(node->entries()[position]))) {
+            return bsl::pair<iterator, bool>(IteratorImp(node, position),
+                                             false);                  // RETURN
+        }
+        leaf = node;
+        node = node->d_isLeaf ? 0 : child(node, position);
+    }
+
+    bsls::ObjectBuffer<ENTRY> entry;
+    ENTRY_UTIL::construct(entry.address(),
+                          d_allocator_p,
+                          BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key));
+    bslma::DestructorGuard<ENTRY> guard(entry.address());
+
+    return bsl::pair<iterator, bool>(insertAtLeaf(leaf,
+                                                  position,
+                                                  entry.address()),
+                                     true);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::pair<typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator, bool>
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insertUnique(const ENTRY& entry)
+{
+    bsl::pair<IteratorImp, bool> result = insertUniqueImp(
+                                                      ENTRY_UTIL::key(entry),
+                                                      entry);
+    return bsl::pair<iterator, bool>(result.first, result.second);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::pair<typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator, bool>
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insertUnique(
+                                               bslmf::MovableRef<ENTRY> entry)
+{
+    ENTRY&                       lvalue = entry;
+    bsl::pair<IteratorImp, bool> result = insertUniqueImp(
+                                                     ENTRY_UTIL::key(lvalue),
+                                                     MoveUtil::move(lvalue));
+    return bsl::pair<iterator, bool>(result.first, result.second);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class ENTRY_TYPE>
+bsl::pair<typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator, bool>
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insertUnique(
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ENTRY_TYPE) entry)
+{
+    // Construct the entry first so that its key is available without the
+    // creation of a temporary (e.g., when 'entry' is merely convertible to
+    // 'ENTRY').
+
+    bsls::ObjectBuffer<ENTRY> buffer;
+    bslma::ConstructionUtil::construct(
+                             buffer.address(),
+                             d_allocator_p,
+                             BSLS_COMPILERFEATURES_FORWARD(ENTRY_TYPE, entry));
+    bslma::DestructorGuard<ENTRY> guard(buffer.address());
+
+    bsl::pair<IteratorImp, bool> result = insertUniqueImp(
+                                            ENTRY_UTIL::key(buffer.object()),
+                                            MoveUtil::move(buffer.object()));
+    return bsl::pair<iterator, bool>(result.first, result.second);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insertMulti(const ENTRY& entry)
+{
+    return iterator(insertMultiImp(ENTRY_UTIL::key(entry), entry));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insertMulti(
+                                               bslmf::MovableRef<ENTRY> entry)
+{
+    ENTRY& lvalue = entry;
+    return iterator(insertMultiImp(ENTRY_UTIL::key(lvalue),
+                                   MoveUtil::move(lvalue)));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class ENTRY_TYPE>
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insertMulti(
+                          BSLS_COMPILERFEATURES_FORWARD_REF(ENTRY_TYPE) entry)
+{
+    bsls::ObjectBuffer<ENTRY> buffer;
+    bslma::ConstructionUtil::construct(
+                             buffer.address(),
+                             d_allocator_p,
+                             BSLS_COMPILERFEATURES_FORWARD(ENTRY_TYPE, entry));
+    bslma::DestructorGuard<ENTRY> guard(buffer.address());
+
+    return iterator(insertMultiImp(ENTRY_UTIL::key(buffer.object()),
+                                   MoveUtil::move(buffer.object())));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class INPUT_ITERATOR>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insertSorted(
+                                                         INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    BSLS_ASSERT(0 == d_size);
+
+    // Appending to the right-most leaf by the usual median split would leave
+    // every leaf half-full.  Instead, a full right-most node is split just
+    // before its last entry, so that all but the nodes on the right-most path
+    // are left full; those are then topped up from their left siblings.
+
+    InsertGuard guard(this);
+
+    for (; first != last; ++first) {
+        Node *leaf = d_rightmost_p;
+        if (0 == leaf) {
+            leaf          = allocateNode(true);
+            d_root_p      = leaf;
+            d_leftmost_p  = leaf;
+            d_rightmost_p = leaf;
+        }
+        else if (Node::k_CAPACITY == leaf->d_count) {
+            splitNode(leaf, Node::k_CAPACITY - 1);
+            leaf = d_rightmost_p;
+        }
+
+        bslma::ConstructionUtil::construct(leaf->entries() + leaf->d_count,
+                                           d_allocator_p,
+                                           *first);
+        ++leaf->d_count;
+        ++d_size;
+    }
+
+    guard.release();
+
+    restoreRightSpine();
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class... ARGS>
+bsl::pair<typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator, bool>
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::emplaceUnique(ARGS&&... arguments)
+{
+    bsls::ObjectBuffer<ENTRY> buffer;
+    bslma::ConstructionUtil::construct(
+                                    buffer.address(),
+                                    d_allocator_p,
+                                    bslmf::Util::forward<ARGS>(arguments)...);
+    bslma::DestructorGuard<ENTRY> guard(buffer.address());
+
+    bsl::pair<IteratorImp, bool> result = insertUniqueImp(
+                                            ENTRY_UTIL::key(buffer.object()),
+                                            MoveUtil::move(buffer.object()));
+    return bsl::pair<iterator, bool>(result.first, result.second);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class... ARGS>
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::emplaceMulti(ARGS&&... arguments)
+{
+    bsls::ObjectBuffer<ENTRY> buffer;
+    bslma::ConstructionUtil::construct(
+                                    buffer.address(),
+                                    d_allocator_p,
+                                    bslmf::Util::forward<ARGS>(arguments)...);
+    bslma::DestructorGuard<ENTRY> guard(buffer.address());
+
+    return iterator(insertMultiImp(ENTRY_UTIL::key(buffer.object()),
+                                   MoveUtil::move(buffer.object())));
+}
+#endif
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::clear()
+{
+    if (d_root_p) {
+        destroyTree(d_root_p);
+
+        d_root_p      = 0;
+        d_leftmost_p  = 0;
+        d_rightmost_p = 0;
+        d_size        = 0;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT(position != end());
+
+    Node *node  = position.imp().node();
+    int   index = position.imp().position();
+
+    // Erasure always removes an entry from a leaf.  An entry of an internal
+    // node is replaced by its in-order predecessor, which is the last entry
+    // of a leaf.  In both cases, track the location following the removed
+    // leaf entry, from which the returned iterator is computed once the tree
+    // has been rebalanced.
+
+    Node *leaf;
+    int   trackedPosition;
+    bool  isInternal = !node->d_isLeaf;
+
+    if (isInternal) {
+        leaf = child(node, index);
+        while (!leaf->d_isLeaf) {
+            leaf = child(leaf, leaf->d_count);
+        }
+
+        ENTRY *last = leaf->entries() + leaf->d_count - 1;
+
+        node->entries()[index] = MoveUtil::move(*last);
+        bslma::DestructionUtil::destroy(last);
+        --leaf->d_count;
+
+        trackedPosition = leaf->d_count;
+    }
+    else {
+        ENTRY *entries = node->entries();
+        bslalg::ArrayPrimitives::erase(entries + index,
+                                       entries + index + 1,
+                                       entries + node->d_count,
+                                       d_allocator_p);
+        --node->d_count;
+
+        leaf            = node;
+        trackedPosition = index;
+    }
+    --d_size;
+
+    Node *trackedNode = leaf;
+    rebalance(leaf, &trackedNode, &trackedPosition);
+
+    if (0 == trackedNode) {
+        return end();                                                 // RETURN
+    }
+
+    IteratorImp result(trackedNode, trackedPosition);
+    if (trackedPosition == trackedNode->d_count) {
+        // Normalize a position past the end of a leaf to the next entry (or
+        // the past-the-end position).
+
+        Node *n = trackedNode;
+        int   p = trackedPosition;
+        while (p == n->d_count && n->d_parent_p) {
+            p = n->d_position;
+            n = n->d_parent_p;
+        }
+        if (p < n->d_count) {
+            result = IteratorImp(n, p);
+        }
+    }
+
+    if (isInternal) {
+        // 'result' refers to the predecessor that replaced the erased entry.
+
+        ++result;
+    }
+    return iterator(result);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::erase(const_iterator first,
+                                                 const_iterator last)
+{
+    bsl::size_t n = bsl::distance(first, last);
+
+    iterator result(first.imp());
+    for (; n; --n) {
+        result = erase(result);
+    }
+    return result;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+bsl::size_t BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::eraseKey(const KEY& key)
+{
+    bsl::pair<iterator, iterator> range = equal_range(key);
+    bsl::size_t                   n     = bsl::distance(range.first,
+                                                        range.second);
+    erase(range.first, range.second);
+    return n;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::find(const LOOKUP_KEY& key)
+{
+    return iterator(findImp(key));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::lower_bound(const LOOKUP_KEY& key)
+{
+    return iterator(lowerBoundImp(key));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::upper_bound(const LOOKUP_KEY& key)
+{
+    return iterator(upperBoundImp(key));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+bsl::pair<typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator,
+          typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator>
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::equal_range(const LOOKUP_KEY& key)
+{
+    return bsl::pair<iterator, iterator>(iterator(lowerBoundImp(key)),
+                                         iterator(upperBoundImp(key)));
+}
+
+                          // Iterators
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::begin()
+{
+    return d_leftmost_p ? iterator(IteratorImp(d_leftmost_p, 0)) : end();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::end()
+{
+    return iterator(endImp());
+}
+
+                             // Aspects
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::swap(BTree& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    bslalg::SwapUtil::swap(&d_root_p,      &other.d_root_p);
+    bslalg::SwapUtil::swap(&d_leftmost_p,  &other.d_leftmost_p);
+    bslalg::SwapUtil::swap(&d_rightmost_p, &other.d_rightmost_p);
+    bslalg::SwapUtil::swap(&d_size,        &other.d_size);
+    bslalg::SwapUtil::swap(&d_comparator,  &other.d_comparator);
+}
+
+// ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+bool BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::contains(
+                                                  const LOOKUP_KEY& key) const
+{
+    return !(findImp(key) == endImp());
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+bsl::size_t BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::count(
+                                                  const LOOKUP_KEY& key) const
+{
+    return bsl::distance(const_iterator(lowerBoundImp(key)),
+                         const_iterator(upperBoundImp(key)));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bool BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::empty() const
+{
+    return 0 == d_size;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::find(const LOOKUP_KEY& key) const
+{
+    return const_iterator(findImp(key));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::lower_bound(
+                                                  const LOOKUP_KEY& key) const
+{
+    return const_iterator(lowerBoundImp(key));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::upper_bound(
+                                                  const LOOKUP_KEY& key) const
+{
+    return const_iterator(upperBoundImp(key));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+bsl::pair<typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator,
+          typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator>
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::equal_range(
+                                                  const LOOKUP_KEY& key) const
+{
+    return bsl::pair<const_iterator, const_iterator>(
+                                         const_iterator(lowerBoundImp(key)),
+                                         const_iterator(upperBoundImp(key)));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+int BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::height() const
+{
+    int result = 0;
+    for (const Node *node = d_root_p; node;
+                            node = node->d_isLeaf ? 0 : child(node, 0)) {
+        ++result;
+    }
+    return result;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::size_t BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::size() const
+{
+    return d_size;
+}
+
+                          // Iterators
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::begin() const
+{
+    return d_leftmost_p ? const_iterator(IteratorImp(d_leftmost_p, 0))
+                        : end();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::end() const
+{
+    return const_iterator(endImp());
+}
+
+                             // Aspects
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bslma::Allocator *BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::allocator() const
+{
+    return d_allocator_p;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+const COMPARATOR&
+BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::comparator() const
+{
+    return d_comparator;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+bool bdlc::operator==(const BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& lhs,
+                      const BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& rhs)
+{
+    typedef typename BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+                                                                ConstIterator;
+
+    if (lhs.size() != rhs.size()) {
+        return false;                                                 // RETURN
+    }
+
+    ConstIterator lhsEnd = lhs.end();
+    for (ConstIterator i = lhs.begin(), j = rhs.begin(); i != lhsEnd;
+                                                                 ++i, ++j) {
+        if (!(*i == *j)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bool bdlc::operator!=(const BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& lhs,
+                      const BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void bdlc::swap(BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& a,
+                BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    typedef BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR> Tree;
+
+    Tree futureA(b, a.allocator());
+    Tree futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+// TRAITS
+namespace bslma {
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+struct UsesBslmaAllocator<bdlc::BTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR> >
+: bsl::true_type {
+};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
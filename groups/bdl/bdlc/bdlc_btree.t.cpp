@@ -0,0 +1,1235 @@
+// bdlc_btree.t.cpp                                                   -*-C++-*-
+
+#include <bdlc_btree.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_util.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a B-tree used as the implementation of the
+// 'bdlc' B-tree containers.  The primary concern is that every manipulator
+// preserves the structural invariants of the tree (node occupancy, uniform
+// leaf depth, parent links, and ordering) and the in-order sequence of
+// entries.  We verify the invariants directly by walking the nodes (reachable
+// through the public 'BTree_IteratorImp::node' accessor) and compare the
+// sequence of entries against 'bsl::multiset' over large randomized sequences
+// of operations.  Small entries yield wide nodes and deep trees are
+// exercised with a large entry type, for which the node capacity is the
+// minimum of 3.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] BTree(const COMPARATOR&, bslma::Allocator *);
+// [ 7] BTree(const BTree&, bslma::Allocator *);
+// [ 7] BTree(MovableRef<BTree>);
+// [ 7] BTree(MovableRef<BTree>, bslma::Allocator *);
+// [ 2] ~BTree();
+//
+// MANIPULATORS
+// [ 7] BTree& operator=(const BTree&);
+// [ 7] BTree& operator=(MovableRef<BTree>);
+// [ 3] pair<iterator, bool> findOrInsertKey(FORWARD_REF(KEY_TYPE));
+// [ 3] pair<iterator, bool> insertUnique(const ENTRY&);
+// [ 3] pair<iterator, bool> insertUnique(MovableRef<ENTRY>);
+// [ 3] pair<iterator, bool> insertUnique(FORWARD_REF(ENTRY_TYPE));
+// [ 4] iterator insertMulti(const ENTRY&);
+// [ 4] iterator insertMulti(MovableRef<ENTRY>);
+// [ 4] iterator insertMulti(FORWARD_REF(ENTRY_TYPE));
+// [ 6] void insertSorted(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 3] pair<iterator, bool> emplaceUnique(ARGS&&...);
+// [ 4] iterator emplaceMulti(ARGS&&...);
+// [ 2] void clear();
+// [ 5] iterator erase(const_iterator);
+// [ 5] iterator erase(const_iterator, const_iterator);
+// [ 5] size_t eraseKey(const KEY&);
+// [ 3] iterator find(const LOOKUP_KEY&);
+// [ 4] iterator lower_bound(const LOOKUP_KEY&);
+// [ 4] iterator upper_bound(const LOOKUP_KEY&);
+// [ 4] pair<iterator, iterator> equal_range(const LOOKUP_KEY&);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 7] void swap(BTree&);
+//
+// ACCESSORS
+// [ 3] bool contains(const LOOKUP_KEY&) const;
+// [ 4] size_t count(const LOOKUP_KEY&) const;
+// [ 2] bool empty() const;
+// [ 3] const_iterator find(const LOOKUP_KEY&) const;
+// [ 4] const_iterator lower_bound(const LOOKUP_KEY&) const;
+// [ 4] const_iterator upper_bound(const LOOKUP_KEY&) const;
+// [ 4] pair<c_iter, c_iter> equal_range(const LOOKUP_KEY&) const;
+// [ 2] int height() const;
+// [ 2] size_t size() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 2] bslma::Allocator *allocator() const;
+// [ 2] const COMPARATOR& comparator() const;
+//
+// FREE FUNCTIONS
+// [ 7] void swap(BTree&, BTree&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] CONCERN: exception safety of insertion
+// [ 9] CONCERN: iterators traverse the tree in both directions
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT  BSLIM_TESTUTIL_ASSERT
+#define ASSERTV BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q  BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P  BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_ BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_ BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_ BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool verbose;
+bool veryVerbose;
+bool veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                  GLOBAL CLASSES/STRUCTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+                              // ===============
+                              // struct IntUtil
+                              // ===============
+
+struct IntUtil {
+    // This 'struct' provides the 'ENTRY_UTIL' operations for an 'int' entry
+    // that is its own key.
+
+    // CLASS METHODS
+    template <class KEY_TYPE>
+    static void construct(int                                         *entry,
+                          bslma::Allocator                            *,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key)
+        // Load into the specified 'entry' the specified 'key'.
+    {
+        *entry = BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key);
+    }
+
+    static const int& key(const int& entry)
+        // Return the specified 'entry'.
+    {
+        return entry;
+    }
+};
+
+                              // ==============
+                              // class BigEntry
+                              // ==============
+
+class BigEntry {
+    // This class provides an entry type, keyed by an 'int', that is large
+    // enough that a B-tree node holds the minimum number of entries.  Each
+    // entry also records a sequence number so that the relative order of
+    // equivalent entries can be verified.
+
+    // DATA
+    int  d_key;        // key
+    int  d_sequence;   // insertion sequence number
+    char d_pad[120];   // padding
+
+  public:
+    // CREATORS
+    BigEntry(int key = 0, int sequence = 0)                         // IMPLICIT
+        // Create a 'BigEntry' having the specified 'key' and 'sequence'.
+    : d_key(key)
+    , d_sequence(sequence)
+    {
+        d_pad[0] = static_cast<char>(key);
+    }
+
+    // ACCESSORS
+    const int& key() const
+        // Return a reference providing non-modifiable access to the key of
+        // this entry.
+    {
+        return d_key;
+    }
+
+    int sequence() const
+        // Return the sequence number of this entry.
+    {
+        return d_sequence;
+    }
+};
+
+bool operator==(const BigEntry& lhs, const BigEntry& rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same key and
+    // sequence number, and 'false' otherwise.
+{
+    return lhs.key() == rhs.key() && lhs.sequence() == rhs.sequence();
+}
+
+bool operator<(const BigEntry& lhs, const BigEntry& rhs)
+    // Return 'true' if the key of the specified 'lhs' is less than that of the
+    // specified 'rhs', and 'false' otherwise.
+{
+    return lhs.key() < rhs.key();
+}
+
+                             // ===============
+                             // struct BigUtil
+                             // ===============
+
+struct BigUtil {
+    // This 'struct' provides the 'ENTRY_UTIL' operations for 'BigEntry'.
+
+    // CLASS METHODS
+    template <class KEY_TYPE>
+    static void construct(BigEntry                                    *entry,
+                          bslma::Allocator                            *,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key)
+        // Load into the specified 'entry' a 'BigEntry' having the specified
+        // 'key' and a sequence number of 0.
+    {
+        new (entry) BigEntry(BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key));
+    }
+
+    static const int& key(const BigEntry& entry)
+        // Return the key of the specified 'entry'.
+    {
+        return entry.key();
+    }
+};
+
+                             // ==================
+                             // struct StringUtil
+                             // ==================
+
+struct StringUtil {
+    // This 'struct' provides the 'ENTRY_UTIL' operations for a 'bsl::string'
+    // entry that is its own key.
+
+    // CLASS METHODS
+    template <class KEY_TYPE>
+    static void construct(bsl::string                                 *entry,
+                          bslma::Allocator                            *alloc,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key)
+        // Load into the specified 'entry' the specified 'key', using the
+        // specified 'alloc' to supply memory.
+    {
+        bslma::ConstructionUtil::construct(
+                                 entry,
+                                 alloc,
+                                 BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key));
+    }
+
+    static const bsl::string& key(const bsl::string& entry)
+        // Return the specified 'entry'.
+    {
+        return entry;
+    }
+};
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::BTree<int, int, IntUtil, bsl::less<int> >           IntObj;
+typedef bdlc::BTree<int, BigEntry, BigUtil, bsl::less<int> >      BigObj;
+typedef bdlc::BTree<bsl::string,
+                    bsl::string,
+                    StringUtil,
+                    bsl::less<bsl::string> >                      StringObj;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+template <class NODE, class ENTRY_UTIL, class COMPARATOR>
+int verifyNode(const NODE        *node,
+               const NODE        *parent,
+               int                position,
+               int                depth,
+               const COMPARATOR&  comparator,
+               int               *leafDepth,
+               bsl::size_t       *numEntries)
+    // Verify the structural invariants of the subtree rooted at the specified
+    // 'node' having the specified 'parent', 'position' within 'parent', and
+    // 'depth', using the specified 'comparator' to verify the order of
+    // entries, loading into the specified 'leafDepth' the depth of the leaves
+    // (if not already set) and adding the number of entries in the subtree to
+    // the specified 'numEntries'.  Return the number of violations found.
+{
+    typedef bdlc::BTree_InternalNode<typename ENTRY_UTIL::EntryType>
+                                                                  InternalNode;
+
+    int errors = 0;
+
+    if (node->d_parent_p != parent) {
+        ++errors;
+    }
+    if (parent && node->d_position != position) {
+        ++errors;
+    }
+    if (node->d_count > NODE::k_CAPACITY) {
+        ++errors;
+    }
+    if (parent && node->d_count < NODE::k_MIN_COUNT) {
+        ++errors;
+    }
+    if (!parent && 0 == node->d_count) {
+        ++errors;
+    }
+
+    *numEntries += node->d_count;
+
+    for (int i = 1; i < node->d_count; ++i) {
+        if (comparator(ENTRY_UTIL::key(node->entries()[i]),
+                       ENTRY_UTIL::key(node->entries()[i - 1]))) {
+            ++errors;
+        }
+    }
+
+    if (node->d_isLeaf) {
+        if (-1 == *leafDepth) {
+            *leafDepth = depth;
+        }
+        else if (*leafDepth != depth) {
+            ++errors;
+        }
+        return errors;                                                // RETURN
+    }
+
+    const InternalNode *internal = static_cast<const InternalNode *>(node);
+    for (int i = 0; i <= node->d_count; ++i) {
+        errors += verifyNode<NODE, ENTRY_UTIL>(internal->d_children[i],
+                                               node,
+                                               i,
+                                               depth + 1,
+                                               comparator,
+                                               leafDepth,
+                                               numEntries);
+    }
+    return errors;
+}
+
+template <class KEY, class ENTRY, class UTIL>
+struct VerifyUtil : UTIL {
+    // This 'struct' extends the (template parameter) 'UTIL' with the type of
+    // its entries.
+
+    typedef ENTRY EntryType;
+};
+
+template <class KEY, class ENTRY, class UTIL, class COMPARATOR>
+int verify(const bdlc::BTree<KEY, ENTRY, UTIL, COMPARATOR>& tree)
+    // Verify the structural invariants of the specified 'tree', and return the
+    // number of violations found.
+{
+    typedef bdlc::BTree_Node<ENTRY> Node;
+
+    if (tree.begin() == tree.end()) {
+        return 0 == tree.size() && 0 == tree.height() ? 0 : 1;        // RETURN
+    }
+
+    const Node *root = tree.begin().imp().node();
+    while (root->d_parent_p) {
+        root = root->d_parent_p;
+    }
+
+    const COMPARATOR& comparator = tree.comparator();
+
+    int         leafDepth  = -1;
+    bsl::size_t numEntries = 0;
+    int         errors     = verifyNode<Node, VerifyUtil<KEY, ENTRY, UTIL> >(
+                                                                  root,
+                                                                  0,
+                                                                  0,
+                                                                  1,
+                                                                  comparator,
+                                                                  &leafDepth,
+                                                                  &numEntries);
+
+    if (numEntries != tree.size()) {
+        ++errors;
+    }
+    if (leafDepth != tree.height()) {
+        ++errors;
+    }
+    if (static_cast<bsl::size_t>(bsl::distance(tree.begin(), tree.end())) !=
+                                                                 tree.size()) {
+        ++errors;
+    }
+    return errors;
+}
+
+template <class TREE, class CONTAINER>
+bool sameSequence(const TREE& tree, const CONTAINER& container)
+    // Return 'true' if the specified 'tree' holds the same sequence of entries
+    // as the specified 'container', and 'false' otherwise.
+{
+    return tree.size() == container.size()
+        && bsl::equal(tree.begin(), tree.end(), container.begin());
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 9: {
+        // --------------------------------------------------------------------
+        // CONCERN: ITERATION
+        //
+        // Concerns:
+        //: 1 Incrementing an iterator from 'begin()' visits every entry in
+        //:   order and reaches 'end()'.
+        //:
+        //: 2 Decrementing an iterator from 'end()' visits every entry in
+        //:   reverse order and reaches 'begin()'.
+        //
+        // Plan:
+        //: 1 For trees of various sizes and heights, traverse the tree in both
+        //:   directions and compare with the expected sequence.  (C-1,2)
+        //
+        // Testing:
+        //   CONCERN: iterators traverse the tree in both directions
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: ITERATION" << endl
+                          << "==================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int n = 0; n < 300; n += 1 + n / 8) {
+            BigObj mX(bsl::less<int>(), &oa);  const BigObj& X = mX;
+
+            for (int i = 0; i < n; ++i) {
+                mX.insertUnique(BigEntry((i * 37) % n));
+            }
+            ASSERTV(n, 0 == verify(X));
+
+            int expected = 0;
+            for (BigObj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(n, expected, expected == it->key());
+                ++expected;
+            }
+            ASSERTV(n, expected, n == expected);
+
+            BigObj::const_iterator it = X.end();
+            while (it != X.begin()) {
+                --it;
+                --expected;
+                ASSERTV(n, expected, expected == it->key());
+            }
+            ASSERTV(n, expected, 0 == expected);
+        }
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCERN: EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 If an allocation fails during insertion, no memory is leaked, the
+        //:   tree remains valid, and the tree holds either its original
+        //:   sequence of entries or that sequence plus the new entry.
+        //:
+        //: 2 If an allocation fails during 'insertSorted', no memory is leaked
+        //:   and the tree remains valid.
+        //
+        // Plan:
+        //: 1 Using the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST' macros, insert
+        //:   strings that allocate into trees of various sizes, and verify
+        //:   the tree after each injected exception.  (C-1)
+        //:
+        //: 2 Using the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST' macros, invoke
+        //:   'insertSorted' with sequences of strings of various lengths, and
+        //:   verify the tree after each injected exception.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: exception safety of insertion
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: EXCEPTION SAFETY" << endl
+                          << "=========================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const char *PREFIX = "a string long enough to require allocation ";
+
+        for (int n = 0; n < 200; n += 7) {
+            StringObj mX(bsl::less<bsl::string>(), &oa);
+            const StringObj& X = mX;
+
+            for (int i = 0; i < n; ++i) {
+                bsl::string value(PREFIX, &oa);
+                value += static_cast<char>(i % 64);
+                value += static_cast<char>(i / 64);
+
+                mX.insertUnique(value);
+            }
+
+            const bsl::size_t SIZE = X.size();
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                bsl::string value(PREFIX, &oa);
+                value += '~';
+
+                ASSERTV(n, 0 == verify(X));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+                mX.emplaceUnique(value);
+#else
+                mX.insertUnique(value);
+#endif
+
+                ASSERTV(n, SIZE + 1 == X.size());
+                ASSERTV(n, 0 == verify(X));
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERTV(n, SIZE + 1 == X.size());
+        }
+
+        for (int n = 0; n < 100; n += 9) {
+            bsl::vector<bsl::string> input(&oa);
+            for (int i = 0; i < n; ++i) {
+                bsl::string value(PREFIX, &oa);
+                value += static_cast<char>(i % 64);
+
+                input.push_back(value);
+            }
+            bsl::sort(input.begin(), input.end());
+
+            StringObj mX(bsl::less<bsl::string>(), &oa);
+            const StringObj& X = mX;
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                ASSERTV(n, 0 == verify(X));
+
+                mX.clear();
+                mX.insertSorted(input.begin(), input.end());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERTV(n, sameSequence(X, input));
+            ASSERTV(n, 0 == verify(X));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, AND SWAP
+        //
+        // Concerns:
+        //: 1 A copy has the same sequence of entries and structure, and uses
+        //:   the supplied allocator.
+        //:
+        //: 2 A move with the same allocator steals the nodes and allocates no
+        //:   memory; a move with a different allocator copies the entries.
+        //:
+        //: 3 Copy and move assignment yield the value of the source.
+        //:
+        //: 4 'swap' exchanges the contents of two trees.
+        //
+        // Plan:
+        //: 1 Create trees of various sizes and copy, move, assign, and swap
+        //:   them, verifying the resulting values, invariants, and allocator
+        //:   usage.  (C-1..4)
+        //
+        // Testing:
+        //   BTree(const BTree&, bslma::Allocator *);
+        //   BTree(MovableRef<BTree>);
+        //   BTree(MovableRef<BTree>, bslma::Allocator *);
+        //   BTree& operator=(const BTree&);
+        //   BTree& operator=(MovableRef<BTree>);
+        //   void swap(BTree&);
+        //   void swap(BTree&, BTree&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, MOVE, AND SWAP" << endl
+                          << "====================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        for (int n = 0; n < 500; n += 1 + n / 4) {
+            bsl::vector<int> expected;
+
+            IntObj mX(bsl::less<int>(), &oa);  const IntObj& X = mX;
+            for (int i = 0; i < n; ++i) {
+                mX.insertMulti(i / 2);
+                expected.push_back(i / 2);
+            }
+
+            IntObj mY(X, &za);  const IntObj& Y = mY;
+            ASSERTV(n, &za == Y.allocator());
+            ASSERTV(n, sameSequence(Y, expected));
+            ASSERTV(n, X.height() == Y.height());
+            ASSERTV(n, 0 == verify(Y));
+
+            {
+                const bsls::Types::Int64 numAllocations = oa.numAllocations();
+
+                IntObj mZ(bslmf::MovableRefUtil::move(mX));
+                const IntObj& Z = mZ;
+                ASSERTV(n, numAllocations == oa.numAllocations());
+                ASSERTV(n, &oa == Z.allocator());
+                ASSERTV(n, sameSequence(Z, expected));
+                ASSERTV(n, 0 == verify(Z));
+                ASSERTV(n, 0 == verify(X));
+
+                mX = bslmf::MovableRefUtil::move(mZ);
+                ASSERTV(n, numAllocations == oa.numAllocations());
+                ASSERTV(n, sameSequence(X, expected));
+                ASSERTV(n, 0 == verify(X));
+            }
+
+            {
+                IntObj mZ(bslmf::MovableRefUtil::move(mY), &oa);
+                const IntObj& Z = mZ;
+                ASSERTV(n, &oa == Z.allocator());
+                ASSERTV(n, sameSequence(Z, expected));
+                ASSERTV(n, 0 == verify(Z));
+
+                mZ.clear();
+                mZ = X;
+                ASSERTV(n, sameSequence(Z, expected));
+                ASSERTV(n, 0 == verify(Z));
+
+                IntObj mW(bsl::less<int>(), &oa);  const IntObj& W = mW;
+                mW.insertUnique(-1);
+
+                mW.swap(mZ);
+                ASSERTV(n, 1 == Z.size());
+                ASSERTV(n, sameSequence(W, expected));
+
+                swap(mW, mZ);
+                ASSERTV(n, 1 == W.size());
+                ASSERTV(n, sameSequence(Z, expected));
+
+                mY = bslmf::MovableRefUtil::move(mZ);
+                ASSERTV(n, &za == Y.allocator());
+                ASSERTV(n, sameSequence(Y, expected));
+                ASSERTV(n, 0 == verify(Y));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'insertSorted'
+        //
+        // Concerns:
+        //: 1 'insertSorted' builds a valid tree holding the supplied sequence.
+        //:
+        //: 2 The resulting tree supports subsequent insertion and erasure.
+        //:
+        //: 3 The nodes built by 'insertSorted' are densely filled.
+        //
+        // Plan:
+        //: 1 For sequences of various lengths (including duplicate entries),
+        //:   invoke 'insertSorted' on an empty tree and verify the sequence,
+        //:   the invariants, and the height.  Then perform random insertions
+        //:   and erasures and verify again.  (C-1..3)
+        //
+        // Testing:
+        //   void insertSorted(INPUT_ITERATOR, INPUT_ITERATOR);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'insertSorted'" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int n = 0; n < 2000; n += 1 + n / 3) {
+            bsl::vector<BigEntry> input;
+            for (int i = 0; i < n; ++i) {
+                input.push_back(BigEntry(i / 3, i));
+            }
+
+            BigObj mX(bsl::less<int>(), &oa);  const BigObj& X = mX;
+            mX.insertSorted(input.begin(), input.end());
+
+            ASSERTV(n, sameSequence(X, input));
+            ASSERTV(n, 0 == verify(X));
+
+            // A tree of minimum-capacity nodes filled by 'insertSorted' holds
+            // at least 'k_NODE_CAPACITY - 1' entries in each node.
+
+            int minHeight = 0;
+            for (long long capacity = 0; capacity < n;
+                           capacity = capacity * (BigObj::k_NODE_CAPACITY + 1)
+                                                + BigObj::k_NODE_CAPACITY) {
+                ++minHeight;
+            }
+            ASSERTV(n, X.height(), minHeight, X.height() <= minHeight + 1);
+
+            bsl::multiset<BigEntry> expected(input.begin(), input.end());
+            for (int i = 0; i < n; ++i) {
+                const int key = (i * 7919) % (n / 3 + 2);
+                if (i % 2) {
+                    mX.insertMulti(BigEntry(key, n + i));
+                    expected.insert(BigEntry(key, n + i));
+                }
+                else {
+                    ASSERTV(n, i, expected.erase(key) == mX.eraseKey(key));
+                }
+            }
+            ASSERTV(n, sameSequence(X, expected));
+            ASSERTV(n, 0 == verify(X));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ERASE
+        //
+        // Concerns:
+        //: 1 Erasing at a position removes exactly that entry and returns an
+        //:   iterator to the next entry.
+        //:
+        //: 2 Erasing a range removes exactly the entries in the range and
+        //:   returns an iterator to the entry at 'last'.
+        //:
+        //: 3 'eraseKey' removes all entries with the key and returns the
+        //:   number removed.
+        //:
+        //: 4 The tree remains valid after each erasure, and all memory is
+        //:   returned when the tree is empty.
+        //
+        // Plan:
+        //: 1 Perform a large random sequence of insertions and erasures (of
+        //:   each kind) and compare against 'bsl::multiset' after each
+        //:   operation.  (C-1..4)
+        //
+        // Testing:
+        //   iterator erase(const_iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        //   size_t eraseKey(const KEY&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ERASE" << endl
+                          << "=====" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            BigObj mX(bsl::less<int>(), &oa);  const BigObj& X = mX;
+
+            bsl::multiset<BigEntry> expected;
+
+            bsl::srand(11);
+            for (int i = 0; i < 20000; ++i) {
+                const int key = bsl::rand() % 1000;
+                const int op  = bsl::rand() % 8;
+
+                if (op < 4) {
+                    mX.insertMulti(BigEntry(key, i));
+                    expected.insert(BigEntry(key, i));
+                }
+                else if (op < 6 && !expected.empty()) {
+                    BigObj::const_iterator it = X.lower_bound(key);
+                    if (it == X.end()) {
+                        continue;
+                    }
+                    const int                  k  = it->key();
+                    const int                  s  = it->sequence();
+                    bsl::multiset<BigEntry>::iterator ei =
+                                                       expected.lower_bound(k);
+                    while (ei->sequence() != s) {
+                        ++ei;
+                    }
+                    ei = expected.erase(ei);
+
+                    BigObj::iterator next = mX.erase(it);
+                    if (ei == expected.end()) {
+                        ASSERTV(i, next == X.end());
+                    }
+                    else {
+                        ASSERTV(i, next != X.end() && *next == *ei);
+                    }
+                }
+                else if (op < 7) {
+                    ASSERTV(i, expected.erase(key) == mX.eraseKey(key));
+                }
+                else {
+                    BigObj::const_iterator first = X.lower_bound(key);
+                    BigObj::const_iterator last  = X.upper_bound(key + 5);
+
+                    const bsl::size_t num =
+                                          bsl::distance(first, last);
+                    bsl::size_t removed = 0;
+                    for (int k = key; k <= key + 5; ++k) {
+                        removed += expected.erase(k);
+                    }
+                    ASSERTV(i, num == removed);
+
+                    BigObj::iterator next = mX.erase(first, last);
+                    ASSERTV(i, next == X.upper_bound(key + 5));
+                }
+
+                if (0 == i % 97) {
+                    ASSERTV(i, 0 == verify(X));
+                    ASSERTV(i, sameSequence(X, expected));
+                }
+            }
+            ASSERT(0 == verify(X));
+            ASSERT(sameSequence(X, expected));
+
+            while (!X.empty()) {
+                mX.erase(X.begin());
+            }
+            ASSERT(0 == verify(X));
+            ASSERT(0 == X.height());
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MULTI-INSERTION AND BOUNDS
+        //
+        // Concerns:
+        //: 1 'insertMulti' and 'emplaceMulti' insert equivalent entries after
+        //:   any existing equivalent entries.
+        //:
+        //: 2 'lower_bound', 'upper_bound', 'equal_range', and 'count' are
+        //:   consistent with 'bsl::multiset'.
+        //
+        // Plan:
+        //: 1 Insert random keys into a tree, recording insertion sequence
+        //:   numbers, and compare with 'bsl::multiset', which also preserves
+        //:   insertion order of equivalent keys.  (C-1)
+        //:
+        //: 2 For every key in the range of inserted keys (and beyond), compare
+        //:   the results of the bound methods.  (C-2)
+        //
+        // Testing:
+        //   iterator insertMulti(const ENTRY&);
+        //   iterator insertMulti(MovableRef<ENTRY>);
+        //   iterator insertMulti(FORWARD_REF(ENTRY_TYPE));
+        //   iterator emplaceMulti(ARGS&&...);
+        //   iterator lower_bound(const LOOKUP_KEY&);
+        //   iterator upper_bound(const LOOKUP_KEY&);
+        //   pair<iterator, iterator> equal_range(const LOOKUP_KEY&);
+        //   const_iterator lower_bound(const LOOKUP_KEY&) const;
+        //   const_iterator upper_bound(const LOOKUP_KEY&) const;
+        //   pair<c_iter, c_iter> equal_range(const LOOKUP_KEY&) const;
+        //   size_t count(const LOOKUP_KEY&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MULTI-INSERTION AND BOUNDS" << endl
+                          << "==========================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            BigObj mX(bsl::less<int>(), &oa);  const BigObj& X = mX;
+
+            bsl::multiset<BigEntry> expected;
+
+            bsl::srand(7);
+            for (int i = 0; i < 5000; ++i) {
+                const int      key = bsl::rand() % 300;
+                const BigEntry ENTRY(key, i);
+
+                BigObj::iterator it;
+                switch (i % 4) {
+                  case 0: {
+                    it = mX.insertMulti(ENTRY);
+                  } break;
+                  case 1: {
+                    BigEntry entry(ENTRY);
+                    it = mX.insertMulti(bslmf::MovableRefUtil::move(entry));
+                  } break;
+                  case 2: {
+                    it = mX.insertMulti(key);
+                    *it = ENTRY;
+                  } break;
+                  default: {
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+                    it = mX.emplaceMulti(key, i);
+#else
+                    it = mX.insertMulti(ENTRY);
+#endif
+                  }
+                }
+                ASSERTV(i, ENTRY == *it);
+                expected.insert(ENTRY);
+            }
+            ASSERT(0 == verify(X));
+            ASSERT(sameSequence(X, expected));
+
+            for (int key = -1; key <= 301; ++key) {
+                ASSERTV(key, expected.count(key) == X.count(key));
+
+                bsl::size_t lb = bsl::distance(expected.begin(),
+                                               expected.lower_bound(key));
+                bsl::size_t ub = bsl::distance(expected.begin(),
+                                               expected.upper_bound(key));
+
+                ASSERTV(key, lb == static_cast<bsl::size_t>(
+                                bsl::distance(X.begin(), X.lower_bound(key))));
+                ASSERTV(key, ub == static_cast<bsl::size_t>(
+                                bsl::distance(X.begin(), X.upper_bound(key))));
+                ASSERTV(key, mX.lower_bound(key) == X.lower_bound(key));
+                ASSERTV(key, mX.upper_bound(key) == X.upper_bound(key));
+
+                bsl::pair<BigObj::iterator, BigObj::iterator> range =
+                                                         mX.equal_range(key);
+                ASSERTV(key, range.first  == X.lower_bound(key));
+                ASSERTV(key, range.second == X.upper_bound(key));
+                ASSERTV(key, X.equal_range(key).first  == X.lower_bound(key));
+                ASSERTV(key, X.equal_range(key).second == X.upper_bound(key));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // UNIQUE INSERTION AND LOOKUP
+        //
+        // Concerns:
+        //: 1 'insertUnique', 'emplaceUnique', and 'findOrInsertKey' insert an
+        //:   entry only if no equivalent entry is present, and return an
+        //:   iterator to the equivalent entry and whether insertion occurred.
+        //:
+        //: 2 'find' and 'contains' locate exactly the entries present.
+        //:
+        //: 3 Entries convertible to 'ENTRY' can be inserted.
+        //
+        // Plan:
+        //: 1 Insert random keys using each method and compare with
+        //:   'bsl::set'.  (C-1,3)
+        //:
+        //: 2 Look up every key in the range of inserted keys.  (C-2)
+        //
+        // Testing:
+        //   pair<iterator, bool> findOrInsertKey(FORWARD_REF(KEY_TYPE));
+        //   pair<iterator, bool> insertUnique(const ENTRY&);
+        //   pair<iterator, bool> insertUnique(MovableRef<ENTRY>);
+        //   pair<iterator, bool> insertUnique(FORWARD_REF(ENTRY_TYPE));
+        //   pair<iterator, bool> emplaceUnique(ARGS&&...);
+        //   iterator find(const LOOKUP_KEY&);
+        //   const_iterator find(const LOOKUP_KEY&) const;
+        //   bool contains(const LOOKUP_KEY&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "UNIQUE INSERTION AND LOOKUP" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < 2; ++ti) {
+            IntObj mX(bsl::less<int>(), &oa);  const IntObj& X = mX;
+
+            bsl::set<int> expected;
+
+            bsl::srand(ti + 1);
+            for (int i = 0; i < 20000; ++i) {
+                const int key = bsl::rand() % 10000;
+
+                bsl::pair<IntObj::iterator, bool> rv;
+                switch (i % 5) {
+                  case 0: {
+                    rv = mX.insertUnique(key);
+                  } break;
+                  case 1: {
+                    int entry = key;
+                    rv = mX.insertUnique(bslmf::MovableRefUtil::move(entry));
+                  } break;
+                  case 2: {
+                    rv = mX.insertUnique(static_cast<short>(key));
+                  } break;
+                  case 3: {
+                    rv = mX.findOrInsertKey(key);
+                  } break;
+                  default: {
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+                    rv = mX.emplaceUnique(key);
+#else
+                    rv = mX.insertUnique(key);
+#endif
+                  }
+                }
+
+                const bool inserted = expected.insert(key).second;
+                ASSERTV(i, inserted == rv.second);
+                ASSERTV(i, key == *rv.first);
+            }
+            ASSERT(0 == verify(X));
+            ASSERT(sameSequence(X, expected));
+
+            for (int key = -1; key <= 10000; ++key) {
+                const bool present = expected.count(key) > 0;
+
+                ASSERTV(key, present == X.contains(key));
+                ASSERTV(key, present == (X.end() != X.find(key)));
+                ASSERTV(key, mX.find(key) == X.find(key));
+                if (present) {
+                    ASSERTV(key, key == *X.find(key));
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed tree is empty and allocates no memory.
+        //:
+        //: 2 The comparator and allocator supplied at construction are
+        //:   retained.
+        //:
+        //: 3 The height grows logarithmically with the number of entries.
+        //:
+        //: 4 'clear' releases all memory.
+        //
+        // Plan:
+        //: 1 Create a tree, insert an increasing number of entries, and check
+        //:   the accessors, invariants, and allocator usage.  (C-1..4)
+        //
+        // Testing:
+        //   BTree(const COMPARATOR&, bslma::Allocator *);
+        //   ~BTree();
+        //   void clear();
+        //   iterator begin();
+        //   iterator end();
+        //   bool empty() const;
+        //   int height() const;
+        //   size_t size() const;
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   bslma::Allocator *allocator() const;
+        //   const COMPARATOR& comparator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            typedef bdlc::BTree<int, int, IntUtil, bsl::greater<int> > Obj;
+
+            Obj mX(bsl::greater<int>(), &oa);  const Obj& X = mX;
+
+            ASSERT(0    == oa.numBlocksTotal());
+            ASSERT(true == X.empty());
+            ASSERT(0    == X.size());
+            ASSERT(0    == X.height());
+            ASSERT(&oa  == X.allocator());
+            ASSERT(X.begin() == X.end());
+            ASSERT(mX.begin() == mX.end());
+            ASSERT(true == X.comparator()(2, 1));
+
+            const int N = Obj::k_NODE_CAPACITY;
+            for (int i = 0; i < N * N * N; ++i) {
+                mX.insertUnique(i);
+
+                ASSERTV(i, false == X.empty());
+                ASSERTV(i, i + 1 == static_cast<int>(X.size()));
+                ASSERTV(i, i     == *X.begin());
+                ASSERTV(i, 0     == *(--mX.end()));
+
+                if (0 == i % (N * N) || i < N * 2) {
+                    ASSERTV(i, 0 == verify(X));
+                }
+            }
+            ASSERT(0 == verify(X));
+            ASSERTV(X.height(), 3 <= X.height() && X.height() <= 4);
+
+            mX.clear();
+            ASSERT(0 == oa.numBlocksInUse());
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.height());
+            ASSERT(0 == verify(X));
+
+            mX.insertUnique(5);
+            ASSERT(1 == X.size());
+            ASSERT(1 == X.height());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Instantiate an object and verify basic functionality.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        IntObj mX(bsl::less<int>(), &oa);  const IntObj& X = mX;
+
+        ASSERT(0 == X.size());
+        ASSERT(X.end() == X.find(0));
+
+        for (int i = 0; i < 1000; ++i) {
+            ASSERTV(i, true == mX.insertUnique(i).second);
+        }
+        ASSERT(1000 == X.size());
+        ASSERT(false == mX.insertUnique(500).second);
+        ASSERT(500 == *X.find(500));
+        ASSERT(X.end() == X.find(1000));
+        ASSERT(0 == verify(X));
+
+        ASSERT(1 == mX.eraseKey(500));
+        ASSERT(0 == mX.eraseKey(500));
+        ASSERT(999 == X.size());
+        ASSERT(501 == *X.lower_bound(500));
+        ASSERT(0 == verify(X));
+
+        IntObj mY(X, &oa);  const IntObj& Y = mY;
+        ASSERT(sameSequence(Y, bsl::vector<int>(X.begin(), X.end())));
+
+        mX.clear();
+        ASSERT(0 == X.size());
+        ASSERT(999 == Y.size());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1314 @@
+// bdlc_btreemap.h                                                    -*-C++-*-
+#ifndef INCLUDED_BDLC_BTREEMAP
+#define INCLUDED_BDLC_BTREEMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered map container implemented as a B-tree.
+//
+//@CLASSES:
+//   bdlc::BTreeMap: B-tree based ordered map container
+//
+//@SEE_ALSO: bdlc_btree, bdlc_btreemultimap, bdlc_btreeset, bsl_map
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::BTreeMap', that implements an ordered map of items with unique keys,
+// stored in a B-tree (see 'bdlc_btree').
+//
+// An instantiation of 'bdlc::BTreeMap' is an allocator-aware, value-semantic
+// type whose salient attributes are its size (number of keys) and the ordered
+// sequence of 'KEY-VALUE' pairs the map contains.  An instantiation may be
+// provided with a custom key-comparison functor, but that functor is not a
+// salient attribute.  In particular, when comparing element values for
+// equality between two different 'bdlc::BTreeMap' objects, the elements are
+// compared using 'operator=='.
+//
+// 'bdlc::BTreeMap' offers the same ordered-map operations as 'bsl::map', with
+// the same logarithmic complexity, but stores many elements in each node of
+// its tree rather than one.  Lookups therefore touch far fewer cache lines,
+// in-order iteration walks mostly contiguous memory, and the per-element
+// memory overhead is a small fraction of that of 'bsl::map' (which allocates a
+// node holding three pointers and a color for every element).  For small
+// elements, 'bdlc::BTreeMap' is typically significantly faster than
+// 'bsl::map' for lookup, insertion, and iteration once the container no
+// longer fits in the first-level cache, while using roughly half the memory.
+//
+///Interface Differences with 'bsl::map'
+///-------------------------------------
+// A 'bdlc::BTreeMap' meets most of the requirements of an ordered associative
+// container with bidirectional iterators in the C++11 Standard [23.2.4].
+// However, elements are *moved* within and between the nodes of the tree as
+// the container is modified, so:
+//
+//: o Every insertion or erasure invalidates all iterators, pointers, and
+//:   references to the elements of the map (unlike 'bsl::map', where only
+//:   references to an erased element are invalidated).
+//:
+//: o The (template parameter) types 'KEY' and 'VALUE' must be move-assignable
+//:   as well as move-constructible.
+//
+// As with 'bdlc::FlatHashMap', the iterators of a 'bdlc::BTreeMap' refer to
+// objects of type 'bsl::pair<KEY, VALUE>' (rather than 'value_type'); the key
+// of an element must not be modified through an iterator.  Allocator use
+// follows BDE style, and the various allocator propagation attributes are not
+// present.
+//
+///Requirements on 'KEY', 'VALUE', and 'COMPARATOR'
+///------------------------------------------------
+// The (template parameter) types 'KEY' and 'VALUE' must be move-constructible
+// and move-assignable, and 'VALUE' must be default-constructible if
+// 'operator[]' is used.  The (template parameter) type 'COMPARATOR' must be a
+// copy-constructible functor defining a strict weak ordering on 'KEY' values;
+// 'COMPARATOR' must also be default-constructible if a constructor not taking
+// a comparator is used.
+//
+///Exception Safety
+///----------------
+// A 'bdlc::BTreeMap' is exception neutral, and all of the methods of
+// 'bdlc::BTreeMap' provide the basic exception safety guarantee (see
+// {'bsldoc_glossary'|Basic Guarantee}).
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Maintaining an Order Book
+/// - - - - - - - - - - - - - - - - - -
+// Suppose we are maintaining one side of an order book for a security, in
+// which the total quantity bid at each price level must be tracked, and from
+// which the best (highest) price levels are frequently read in order.  An
+// order book may hold many thousands of levels and is both updated and
+// scanned very frequently, which makes it a good candidate for a B-tree.
+//
+// First, we define an alias for a map from price (in ticks) to quantity,
+// ordered from the highest price to the lowest:
+//..
+//  typedef bdlc::BTreeMap<int, int, bsl::greater<int> > PriceLevels;
+//..
+// Next, we create an (empty) map and record a sequence of orders:
+//..
+//  PriceLevels bids;
+//
+//  const struct {
+//      int d_price;
+//      int d_quantity;
+//  } ORDERS[] = {
+//      { 1001, 100 }, { 1003, 200 }, { 1002, 300 }, { 1001,  50 },
+//      { 1004, 100 }, { 1003, 100 }, {  999, 500 }, { 1000,  75 },
+//  };
+//  const int NUM_ORDERS = sizeof ORDERS / sizeof *ORDERS;
+//
+//  for (int i = 0; i < NUM_ORDERS; ++i) {
+//      bids[ORDERS[i].d_price] += ORDERS[i].d_quantity;
+//  }
+//  assert(6 == bids.size());
+//..
+// Then, we remove the price level at which all orders have been filled:
+//..
+//  assert(1 == bids.erase(1004));
+//..
+// Now, we compute the total quantity available at the three best prices,
+// traversing the map in order:
+//..
+//  int                   total = 0;
+//  int                   count = 0;
+//  PriceLevels::iterator it    = bids.begin();
+//  for (; it != bids.end() && count < 3; ++it, ++count) {
+//      total += it->second;
+//  }
+//  assert(750 == total);
+//..
+// Finally, we find the levels priced at 1000 or better (i.e., up to and
+// including 1000 in the order of the map):
+//..
+//  assert(1003 == bids.begin()->first);
+//  assert(4    == bsl::distance(bids.begin(), bids.upper_bound(1000)));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_btree.h>
+
+#include <bslalg_hasstliterators.h>
+#include <bslalg_swaputil.h>
+
+#include <bslim_printer.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_destructorguard.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_addconst.h>
+#include <bslmf_enableif.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_movableref.h>
+#include <bslmf_util.h>    // 'forward(V)'
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_util.h>     // 'forward<T>(V)'
+
+#include <bslstl_iterator.h>
+#include <bslstl_stdexceptutil.h>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <bsl_initializer_list.h>
+#endif
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_ostream.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+// FORWARD DECLARATIONS
+template <class KEY, class VALUE, class COMPARATOR = bsl::less<KEY> >
+class BTreeMap;
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator==(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+                const BTreeMap<KEY, VALUE, COMPARATOR>& rhs);
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator!=(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+                const BTreeMap<KEY, VALUE, COMPARATOR>& rhs);
+
+template <class KEY, class VALUE, class COMPARATOR>
+void swap(BTreeMap<KEY, VALUE, COMPARATOR>& a,
+          BTreeMap<KEY, VALUE, COMPARATOR>& b);
+
+                         // =========================
+                         // struct BTreeMap_EntryUtil
+                         // =========================
+
+template <class KEY, class VALUE, class ENTRY>
+struct BTreeMap_EntryUtil
+    // This templated utility provides methods to construct an 'ENTRY' and a
+    // method to extract the key from an 'ENTRY'.
+{
+    // CLASS METHODS
+    template <class KEY_TYPE>
+    static void construct(
+                        ENTRY                                       *entry,
+                        bslma::Allocator                            *allocator,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key);
+        // Load into the specified 'entry' the 'ENTRY' value comprised of the
+        // specified 'key' and a default constructed 'VALUE', using the
+        // specified 'allocator' to supply memory.  'allocator' is ignored if
+        // the (template parameter) type 'ENTRY' is not allocator aware.
+
+    static const KEY& key(const ENTRY& entry);
+        // Return the key of the specified 'entry'.
+};
+
+                              // ==============
+                              // class BTreeMap
+                              // ==============
+
+template <class KEY, class VALUE, class COMPARATOR>
+class BTreeMap {
+    // This class template implements a value-semantic container type holding
+    // an ordered map of 'KEY-VALUE' pairs having unique keys that provides a
+    // mapping from keys of (template parameter) type 'KEY' to their associated
+    // mapped values of (template parameter) type 'VALUE'.  The (template
+    // parameter) type 'COMPARATOR' is a functor defining the order of 'KEY'
+    // values.  See {Requirements on 'KEY', 'VALUE', and 'COMPARATOR'} for more
+    // information.
+
+  private:
+    // PRIVATE TYPES
+    typedef BTree<KEY,
+                  bsl::pair<KEY, VALUE>,
+                  BTreeMap_EntryUtil<KEY, VALUE, bsl::pair<KEY, VALUE> >,
+                  COMPARATOR> ImplType;
+        // This is the underlying implementation class.
+
+    // FRIENDS
+    friend bool operator==<>(const BTreeMap&, const BTreeMap&);
+    friend bool operator!=<>(const BTreeMap&, const BTreeMap&);
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::pair<typename bsl::add_const<KEY>::type, VALUE> value_type;
+
+    typedef KEY                                    key_type;
+    typedef VALUE                                  mapped_type;
+    typedef bsl::size_t                            size_type;
+    typedef bsl::ptrdiff_t                         difference_type;
+    typedef COMPARATOR                             key_compare;
+    typedef value_type&                            reference;
+    typedef const value_type&                      const_reference;
+    typedef typename ImplType::iterator            iterator;
+    typedef typename ImplType::const_iterator      const_iterator;
+    typedef bsl::reverse_iterator<iterator>        reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>  const_reverse_iterator;
+
+  private:
+    // DATA
+    ImplType d_impl;  // underlying B-tree used by this map
+
+  public:
+    // CREATORS
+    BTreeMap();
+    explicit BTreeMap(bslma::Allocator *basicAllocator);
+    explicit BTreeMap(const COMPARATOR&  comparator,
+                      bslma::Allocator  *basicAllocator = 0);
+        // Create an empty 'BTreeMap' object.  Optionally specify a
+        // 'comparator' used to order the keys of elements in this container.
+        // If 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied or is 0, the currently installed default allocator is
+        // used.  No memory is allocated.
+
+    template <class INPUT_ITERATOR>
+    BTreeMap(INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    BTreeMap(INPUT_ITERATOR     first,
+             INPUT_ITERATOR     last,
+             const COMPARATOR&  comparator,
+             bslma::Allocator  *basicAllocator = 0);
+        // Create a 'BTreeMap' object initialized by insertion of the values
+        // from the input iterator range specified by 'first' through 'last'
+        // (including 'first', excluding 'last').  Optionally specify a
+        // 'comparator' used to order the keys of elements in this container.
+        // If 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied or is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'first' and 'last' refer to
+        // a sequence of valid values where 'first' is at a position at or
+        // before 'last'.  Note that if a member of the input sequence has an
+        // equivalent key to an earlier member, the later member will not be
+        // inserted.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    BTreeMap(bsl::initializer_list<value_type>  values,
+             bslma::Allocator                  *basicAllocator = 0);
+    BTreeMap(bsl::initializer_list<value_type>  values,
+             const COMPARATOR&                  comparator,
+             bslma::Allocator                  *basicAllocator = 0);
+        // Create a 'BTreeMap' object initialized by insertion of the specified
+        // 'values'.  Optionally specify a 'comparator' used to order the keys
+        // of elements in this container.  If 'comparator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'COMPARATOR' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not supplied or is 0, the
+        // currently installed default allocator is used.  Note that if a
+        // member of 'values' has an equivalent key to an earlier member, the
+        // later member will not be inserted.
+#endif
+
+    BTreeMap(const BTreeMap& original, bslma::Allocator *basicAllocator = 0);
+        // Create a 'BTreeMap' object having the same value and comparator as
+        // the specified 'original' object.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // specified or is 0, the currently installed default allocator is
+        // used.
+
+    BTreeMap(bslmf::MovableRef<BTreeMap> original);
+        // Create a 'BTreeMap' object having the same value, comparator, and
+        // allocator as the specified 'original' object.  The contents of
+        // 'original' are moved (in constant time) to this object, 'original'
+        // is left in a (valid) unspecified state, and no exceptions will be
+        // thrown.
+
+    BTreeMap(bslmf::MovableRef<BTreeMap>  original,
+             bslma::Allocator            *basicAllocator);
+        // Create a 'BTreeMap' object having the same value and comparator as
+        // the specified 'original' object, using the specified
+        // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  The allocator of
+        // 'original' remains unchanged.  If 'original' and the newly created
+        // object have the same allocator then the contents of 'original' are
+        // moved (in constant time) to this object, 'original' is left in a
+        // (valid) unspecified state, and no exceptions will be thrown;
+        // otherwise, the elements of 'original' are moved, 'original' is left
+        // in a (valid) unspecified state, and an exception may be thrown.
+
+    ~BTreeMap();
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    BTreeMap& operator=(const BTreeMap& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.
+
+    BTreeMap& operator=(bslmf::MovableRef<BTreeMap> rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  If this object and 'rhs' use the same allocator the
+        // contents of 'rhs' are moved (in constant time) to this object.
+        // 'rhs' is left in a (valid) unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    BTreeMap& operator=(bsl::initializer_list<value_type> values);
+        // Assign to this object the value resulting from first clearing this
+        // map and then inserting each object in the specified 'values'
+        // initializer list, ignoring those objects having a value whose key is
+        // equivalent to that which appears earlier in the list; return a
+        // reference providing modifiable access to this object.
+#endif
+
+    template <class KEY_TYPE>
+    VALUE& operator[](BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key);
+        // Return a reference providing modifiable access to the mapped value
+        // associated with the specified 'key' in this map.  If this map does
+        // not already contain an element having 'key', insert an element with
+        // the 'key' and a default-constructed 'VALUE', and return a reference
+        // to the newly mapped value.  If 'key' is movable, 'key' is left in a
+        // (valid) unspecified state.
+
+    VALUE& at(const KEY& key);
+        // Return a reference providing modifiable access to the mapped value
+        // associated with the specified 'key' in this map, if such an entry
+        // exists; otherwise throw a 'std::out_of_range' exception.  Note that
+        // this method is not exception-neutral.
+
+    void clear();
+        // Remove all elements from this map and release all memory from this
+        // map.
+
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        // Return a pair of iterators defining the sequence of modifiable
+        // elements in this map having the specified 'key', where the first
+        // iterator is positioned at the start of the sequence and the second
+        // iterator is positioned one past the end of the sequence.  If this
+        // map contains no elements having a key equivalent to 'key', then the
+        // two returned iterators will have the same value.  Note that since a
+        // map maintains unique keys, the range will contain at most one
+        // element.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove from this map the element whose key is equivalent to the
+        // specified 'key', if it exists, and return 1; otherwise (there is no
+        // element having 'key' in this map), return 0 with no other effect.
+        // This method invalidates all iterators and references to the
+        // elements of this map.
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove from this map the element at the specified 'position', and
+        // return an iterator referring to the modifiable element immediately
+        // following the removed element, or to the past-the-end position if
+        // the removed element was the last element in the sequence of elements
+        // maintained by this map.  This method invalidates all iterators and
+        // references to the elements of this map.  The behavior is undefined
+        // unless 'position' refers to an element in this map.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this map the elements starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and return an iterator referencing the same element as 'last'.  This
+        // method invalidates all iterators and references to the elements of
+        // this map.  The behavior is undefined unless 'first' and 'last' are
+        // valid iterators on this map, and the 'first' position is at or
+        // before the 'last' position in the ordered sequence of elements of
+        // this container.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the modifiable element in this map
+        // having the specified 'key', or 'end()' if no such entry exists in
+        // this map.
+
+    template <class VALUE_TYPE>
+    typename bsl::enable_if<bsl::is_convertible<VALUE_TYPE, value_type>::value,
+                            bsl::pair<iterator, bool> >::type
+                    insert(BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value)
+        // Insert the specified 'value' into this map if the key of 'value'
+        // does not already exist in this map; otherwise, this method has no
+        // effect.  Return a 'pair' whose 'first' member is an iterator
+        // referring to the (possibly newly inserted) modifiable element in
+        // this map whose key is equivalent to that of the element to be
+        // inserted, and whose 'second' member is 'true' if a new element was
+        // inserted, and 'false' if an element with an equivalent key was
+        // already present.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        return d_impl.insertUnique(
+                             BSLS_COMPILERFEATURES_FORWARD(VALUE_TYPE, value));
+    }
+
+    template <class VALUE_TYPE>
+    typename bsl::enable_if<bsl::is_convertible<VALUE_TYPE, value_type>::value,
+                            iterator>::type
+                    insert(const_iterator                                ,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value)
+        // Insert the specified 'value' into this map if the key of 'value'
+        // does not already exist in this map; otherwise, this method has no
+        // effect.  Return an iterator referring to the (possibly newly
+        // inserted) modifiable element in this map whose key is equivalent to
+        // that of the element to be inserted.  The supplied 'const_iterator'
+        // is ignored.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        return d_impl.insertUnique(
+                       BSLS_COMPILERFEATURES_FORWARD(VALUE_TYPE, value)).first;
+    }
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map the value of each element in the input iterator
+        // range specified by 'first' through 'last' (including 'first',
+        // excluding 'last').  The behavior is undefined unless 'first' and
+        // 'last' refer to a sequence of valid values where 'first' is at a
+        // position at or before 'last'.  Note that if the key of a member of
+        // the input sequence is equivalent to the key of an earlier member,
+        // the later member will not be inserted.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(bsl::initializer_list<value_type> values);
+        // Insert into this map an element having the value of each object in
+        // the specified 'values' initializer list if a value with an
+        // equivalent key is not already contained in this map.
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... ARGS>
+    bsl::pair<iterator, bool> emplace(ARGS&&... args);
+        // Insert into this map a newly-created element constructed by
+        // forwarding this map's allocator and the specified 'args' to the
+        // constructor of 'bsl::pair<KEY, VALUE>', if no element having an
+        // equivalent key is already present.  Return a 'pair' whose 'first'
+        // member is an iterator referring to the (possibly newly inserted)
+        // element having an equivalent key, and whose 'second' member is
+        // 'true' if a new element was inserted.
+#endif
+
+    iterator lower_bound(const KEY& key);
+        // Return an iterator referring to the first modifiable element in this
+        // map whose key is not ordered before the specified 'key', or 'end()'
+        // if no such element exists.
+
+    iterator upper_bound(const KEY& key);
+        // Return an iterator referring to the first modifiable element in this
+        // map whose key is ordered after the specified 'key', or 'end()' if no
+        // such element exists.
+
+                          // Iterators
+
+    iterator begin();
+        // Return an iterator to the first element in the ordered sequence of
+        // modifiable elements maintained by this map, or the 'end' iterator if
+        // this map is empty.
+
+    iterator end();
+        // Return an iterator to the past-the-end element in the ordered
+        // sequence of modifiable elements maintained by this map.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator to the last element in the ordered
+        // sequence of modifiable elements maintained by this map, or 'rend()'
+        // if this map is empty.
+
+    reverse_iterator rend();
+        // Return a reverse iterator to the prior-to-the-beginning element in
+        // the ordered sequence of modifiable elements maintained by this map.
+
+                             // Aspects
+
+    void swap(BTreeMap& other);
+        // Exchange the value of this object as well as its comparator with
+        // those of the specified 'other' object.  The behavior is undefined
+        // unless this object was created with the same allocator as 'other'.
+
+    // ACCESSORS
+    const VALUE& at(const KEY& key) const;
+        // Return a reference providing non-modifiable access to the mapped
+        // value associated with the specified 'key' in this map, if such an
+        // entry exists; otherwise throw a 'std::out_of_range' exception.  Note
+        // that this method is not exception-neutral.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this map contains an element having the specified
+        // 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements in this map having the specified
+        // 'key'.  Note that since a map maintains unique keys, the returned
+        // value will be either 0 or 1.
+
+    bool empty() const;
+        // Return 'true' if this map contains no elements, and 'false'
+        // otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                         const KEY& key) const;
+        // Return a pair of 'const_iterator's defining the sequence of elements
+        // in this map having the specified 'key', where the first iterator is
+        // positioned at the start of the sequence and the second iterator is
+        // positioned one past the end of the sequence.  If this map contains
+        // no elements having a key equivalent to 'key', then the two returned
+        // iterators will have the same value.  Note that since a map maintains
+        // unique keys, the range will contain at most one element.
+
+    const_iterator find(const KEY& key) const;
+        // Return a 'const_iterator' referring to the element in this map
+        // having the specified 'key', or 'end()' if no such entry exists in
+        // this map.
+
+    COMPARATOR key_comp() const;
+        // Return (a copy of) the key-comparison functor used by this map to
+        // order its elements.
+
+    const_iterator lower_bound(const KEY& key) const;
+        // Return a 'const_iterator' referring to the first element in this map
+        // whose key is not ordered before the specified 'key', or 'end()' if
+        // no such element exists.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this map.
+
+    const_iterator upper_bound(const KEY& key) const;
+        // Return a 'const_iterator' referring to the first element in this map
+        // whose key is ordered after the specified 'key', or 'end()' if no
+        // such element exists.
+
+                          // Iterators
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return a 'const_iterator' to the first element in the ordered
+        // sequence of elements maintained by this map, or the 'end' iterator
+        // if this map is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return a 'const_iterator' to the past-the-end element in the ordered
+        // sequence of elements maintained by this map.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse 'const_iterator' to the last element in the ordered
+        // sequence of elements maintained by this map, or 'rend()' if this map
+        // is empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return a reverse 'const_iterator' to the prior-to-the-beginning
+        // element in the ordered sequence of elements maintained by this map.
+
+                           // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this map to supply memory.
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level = 0,
+                        int           spacesPerLevel = 4) const;
+        // Format this object to the specified output 'stream' at the (absolute
+        // value of) the optionally specified indentation 'level', and return a
+        // reference to the modifiable 'stream'.  If 'level' is specified,
+        // optionally specify 'spacesPerLevel', the number of spaces per
+        // indentation level for this and all of its nested objects.  If
+        // 'level' is negative, suppress indentation of the first line.  If
+        // 'spacesPerLevel' is negative, format the entire output on one line,
+        // suppressing all but the initial indentation (as governed by
+        // 'level').  If 'stream' is not valid on entry, this operation has no
+        // effect.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator==(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+                const BTreeMap<KEY, VALUE, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'BTreeMap' objects have the same
+    // value if they have the same number of elements, and each element in the
+    // ordered sequence of elements of 'lhs' is equal to the element at the
+    // corresponding position in 'rhs'.  The comparators are not involved in
+    // the comparison.
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator!=(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+                const BTreeMap<KEY, VALUE, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'BTreeMap' objects do not have
+    // the same value if they do not have the same number of elements, or some
+    // element in the ordered sequence of elements of 'lhs' is not equal to the
+    // element at the corresponding position in 'rhs'.
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator<(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+               const BTreeMap<KEY, VALUE, COMPARATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically less than that of the specified 'rhs' map, and 'false'
+    // otherwise.  Elements are compared using 'operator<'.
+
+template <class KEY, class VALUE, class COMPARATOR>
+bsl::ostream& operator<<(bsl::ostream&                           stream,
+                         const BTreeMap<KEY, VALUE, COMPARATOR>& map);
+    // Write the value of the specified 'map' to the specified output 'stream'
+    // in a single-line format, and return a reference providing modifiable
+    // access to 'stream'.  If 'stream' is not valid on entry, this operation
+    // has no effect.  Note that this human-readable format is not fully
+    // specified and can change without notice.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR>
+void swap(BTreeMap<KEY, VALUE, COMPARATOR>& a,
+          BTreeMap<KEY, VALUE, COMPARATOR>& b);
+    // Exchange the value and the comparator of the specified 'a' and 'b'
+    // objects.  This function provides the no-throw exception-safety
+    // guarantee if the two objects were created with the same allocator and
+    // the basic guarantee otherwise.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                         // -------------------------
+                         // struct BTreeMap_EntryUtil
+                         // -------------------------
+
+// CLASS METHODS
+template <class KEY, class VALUE, class ENTRY>
+template <class KEY_TYPE>
+inline
+void BTreeMap_EntryUtil<KEY, VALUE, ENTRY>::construct(
+                        ENTRY                                       *entry,
+                        bslma::Allocator                            *allocator,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    bsls::ObjectBuffer<VALUE> value;
+
+    bslma::ConstructionUtil::construct(value.address(), allocator);
+    bslma::DestructorGuard<VALUE> guard(value.address());
+
+    bslma::ConstructionUtil::construct(
+                                  entry,
+                                  allocator,
+                                  BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key),
+                                  bslmf::MovableRefUtil::move(value.object()));
+}
+
+template <class KEY, class VALUE, class ENTRY>
+inline
+const KEY& BTreeMap_EntryUtil<KEY, VALUE, ENTRY>::key(const ENTRY& entry)
+{
+    return entry.first;
+}
+
+                              // --------------
+                              // class BTreeMap
+                              // --------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::BTreeMap()
+: d_impl(COMPARATOR())
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::BTreeMap(bslma::Allocator *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::BTreeMap(
+                                            const COMPARATOR&  comparator,
+                                            bslma::Allocator  *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::BTreeMap(INPUT_ITERATOR    first,
+                                           INPUT_ITERATOR    last,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::BTreeMap(INPUT_ITERATOR     first,
+                                           INPUT_ITERATOR     last,
+                                           const COMPARATOR&  comparator,
+                                           bslma::Allocator  *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+    insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::BTreeMap(
+                             bsl::initializer_list<value_type>  values,
+                             bslma::Allocator                  *basicAllocator)
+: BTreeMap(values.begin(), values.end(), COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::BTreeMap(
+                             bsl::initializer_list<value_type>  values,
+                             const COMPARATOR&                  comparator,
+                             bslma::Allocator                  *basicAllocator)
+: BTreeMap(values.begin(), values.end(), comparator, basicAllocator)
+{
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::BTreeMap(const BTreeMap&   original,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::BTreeMap(
+                                          bslmf::MovableRef<BTreeMap> original)
+: d_impl(bslmf::MovableRefUtil::move(
+                               bslmf::MovableRefUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::BTreeMap(
+                                   bslmf::MovableRef<BTreeMap>  original,
+                                   bslma::Allocator            *basicAllocator)
+: d_impl(bslmf::MovableRefUtil::move(
+                               bslmf::MovableRefUtil::access(original).d_impl),
+         basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>::~BTreeMap()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>&
+BTreeMap<KEY, VALUE, COMPARATOR>::operator=(const BTreeMap& rhs)
+{
+    d_impl = rhs.d_impl;
+
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>&
+BTreeMap<KEY, VALUE, COMPARATOR>::operator=(bslmf::MovableRef<BTreeMap> rhs)
+{
+    BTreeMap& lvalue = rhs;
+
+    d_impl = bslmf::MovableRefUtil::move(lvalue.d_impl);
+
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+BTreeMap<KEY, VALUE, COMPARATOR>&
+BTreeMap<KEY, VALUE, COMPARATOR>::operator=(
+                                      bsl::initializer_list<value_type> values)
+{
+    BTreeMap tmp(values.begin(),
+                 values.end(),
+                 d_impl.comparator(),
+                 d_impl.allocator());
+
+    this->swap(tmp);
+
+    return *this;
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class KEY_TYPE>
+inline
+VALUE& BTreeMap<KEY, VALUE, COMPARATOR>::operator[](
+                               BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key)
+{
+    iterator it = d_impl.findOrInsertKey(
+                           BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key)).first;
+    return it->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+VALUE& BTreeMap<KEY, VALUE, COMPARATOR>::at(const KEY& key)
+{
+    iterator node = d_impl.find(key);
+
+    if (node == d_impl.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                             "BTreeMap<...>::at(key_type): invalid key value");
+    }
+
+    return node->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void BTreeMap<KEY, VALUE, COMPARATOR>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::pair<typename BTreeMap<KEY, VALUE, COMPARATOR>::iterator,
+          typename BTreeMap<KEY, VALUE, COMPARATOR>::iterator>
+BTreeMap<KEY, VALUE, COMPARATOR>::equal_range(const KEY& key)
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t BTreeMap<KEY, VALUE, COMPARATOR>::erase(const KEY& key)
+{
+    return d_impl.eraseKey(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::erase(iterator position)
+{
+    // Note that this overload is required to avoid ambiguity when the key is
+    // an iterator.
+
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::erase(const_iterator first,
+                                        const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::find(const KEY& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+void BTreeMap<KEY, VALUE, COMPARATOR>::insert(INPUT_ITERATOR first,
+                                              INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        d_impl.insertUnique(*first);
+    }
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void BTreeMap<KEY, VALUE, COMPARATOR>::insert(
+                                      bsl::initializer_list<value_type> values)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class KEY, class VALUE, class COMPARATOR>
+template <class... ARGS>
+inline
+bsl::pair<typename BTreeMap<KEY, VALUE, COMPARATOR>::iterator, bool>
+BTreeMap<KEY, VALUE, COMPARATOR>::emplace(ARGS&&... args)
+{
+    return d_impl.emplaceUnique(BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::lower_bound(const KEY& key)
+{
+    return d_impl.lower_bound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::upper_bound(const KEY& key)
+{
+    return d_impl.upper_bound(key);
+}
+
+                          // Iterators
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::end()
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::reverse_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::rbegin()
+{
+    return reverse_iterator(d_impl.end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::reverse_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::rend()
+{
+    return reverse_iterator(d_impl.begin());
+}
+
+                             // Aspects
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void BTreeMap<KEY, VALUE, COMPARATOR>::swap(BTreeMap& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+const VALUE& BTreeMap<KEY, VALUE, COMPARATOR>::at(const KEY& key) const
+{
+    const_iterator node = d_impl.find(key);
+
+    if (node == d_impl.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                       "BTreeMap<...>::at(key_type) const: invalid key value");
+    }
+
+    return node->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool BTreeMap<KEY, VALUE, COMPARATOR>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t BTreeMap<KEY, VALUE, COMPARATOR>::count(const KEY& key) const
+{
+    return d_impl.contains(key) ? 1 : 0;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool BTreeMap<KEY, VALUE, COMPARATOR>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::pair<typename BTreeMap<KEY, VALUE, COMPARATOR>::const_iterator,
+          typename BTreeMap<KEY, VALUE, COMPARATOR>::const_iterator>
+BTreeMap<KEY, VALUE, COMPARATOR>::equal_range(const KEY& key) const
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+COMPARATOR BTreeMap<KEY, VALUE, COMPARATOR>::key_comp() const
+{
+    return d_impl.comparator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::lower_bound(const KEY& key) const
+{
+    return d_impl.lower_bound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t BTreeMap<KEY, VALUE, COMPARATOR>::size() const
+{
+    return d_impl.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::upper_bound(const KEY& key) const
+{
+    return d_impl.upper_bound(key);
+}
+
+                          // Iterators
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::cend() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_reverse_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::rbegin() const
+{
+    return const_reverse_iterator(d_impl.end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_reverse_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::crbegin() const
+{
+    return const_reverse_iterator(d_impl.end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_reverse_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::rend() const
+{
+    return const_reverse_iterator(d_impl.begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename BTreeMap<KEY, VALUE, COMPARATOR>::const_reverse_iterator
+BTreeMap<KEY, VALUE, COMPARATOR>::crend() const
+{
+    return const_reverse_iterator(d_impl.begin());
+}
+
+                           // Aspects
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bslma::Allocator *BTreeMap<KEY, VALUE, COMPARATOR>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+bsl::ostream& BTreeMap<KEY, VALUE, COMPARATOR>::print(
+                                            bsl::ostream& stream,
+                                            int           level,
+                                            int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;                                                // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+
+    printer.start();
+
+    const_iterator iter = begin();
+    while (iter != end()) {
+        printer.printValue(*iter);
+        ++iter;
+    }
+
+    printer.end();
+
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool bdlc::operator==(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+                      const BTreeMap<KEY, VALUE, COMPARATOR>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool bdlc::operator!=(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+                      const BTreeMap<KEY, VALUE, COMPARATOR>& rhs)
+{
+    return lhs.d_impl != rhs.d_impl;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool bdlc::operator<(const BTreeMap<KEY, VALUE, COMPARATOR>& lhs,
+                     const BTreeMap<KEY, VALUE, COMPARATOR>& rhs)
+{
+    return bsl::lexicographical_compare(lhs.begin(),
+                                        lhs.end(),
+                                        rhs.begin(),
+                                        rhs.end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::ostream& bdlc::operator<<(bsl::ostream&                           stream,
+                               const BTreeMap<KEY, VALUE, COMPARATOR>& map)
+{
+    return map.print(stream, 0, -1);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void bdlc::swap(BTreeMap<KEY, VALUE, COMPARATOR>& a,
+                BTreeMap<KEY, VALUE, COMPARATOR>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    typedef BTreeMap<KEY, VALUE, COMPARATOR> Map;
+
+    Map futureA(b, a.allocator());
+    Map futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslalg {
+
+template <class KEY, class VALUE, class COMPARATOR>
+struct HasStlIterators<bdlc::BTreeMap<KEY, VALUE, COMPARATOR> >
+: bsl::true_type {
+};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class VALUE, class COMPARATOR>
+struct UsesBslmaAllocator<bdlc::BTreeMap<KEY, VALUE, COMPARATOR> >
+: bsl::true_type {
+};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
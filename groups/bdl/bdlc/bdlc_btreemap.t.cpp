@@ -0,0 +1,1230 @@
+// bdlc_btreemap.t.cpp                                                -*-C++-*-
+
+#include <bdlc_btreemap.h>
+
+#include <bslalg_hasstliterators.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <bsl_initializer_list.h>
+#endif
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_map.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+#if defined(BDE_BUILD_TARGET_EXC)
+#include <stdexcept>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines an ordered map implemented with a B-tree.
+// For all of the object's functionality except 'print' and 'operator<<', the
+// concern is the correct forwarding to the implementation object
+// 'bdlc::BTree' (which is thoroughly tested in 'bdlc_btree.t.cpp'), so most
+// test cases compare the behavior of 'bdlc::BTreeMap' against that of
+// 'bsl::map' over randomized sequences of operations.
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//: o Any allocated memory is always from the object allocator.
+//: o Injected exceptions are safely propagated during memory allocation.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] BTreeMap();
+// [ 2] BTreeMap(bslma::Allocator *basicAllocator);
+// [ 2] BTreeMap(const COMPARATOR&, bslma::Allocator * = 0);
+// [ 5] BTreeMap(INPUT_ITERATOR, INPUT_ITERATOR, bslma::Allocator * = 0);
+// [ 5] BTreeMap(II, II, const COMPARATOR&, bslma::Allocator * = 0);
+// #if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+// [ 5] BTreeMap(bsl::initializer_list<v_t>, bslma::Allocator * = 0);
+// [ 5] BTreeMap(init_list<v_t>, const COMPARATOR&, bslma::Allocator * = 0);
+// #endif
+// [ 4] BTreeMap(const BTreeMap&, bslma::Allocator *bA = 0);
+// [ 4] BTreeMap(MovableRef<BTreeMap>);
+// [ 4] BTreeMap(MovableRef<BTreeMap>, bslma::Allocator *basicAllocator);
+// [ 2] ~BTreeMap();
+//
+// MANIPULATORS
+// [ 4] BTreeMap& operator=(const BTreeMap&);
+// [ 4] BTreeMap& operator=(MovableRef<BTreeMap>);
+// #if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+// [ 5] BTreeMap& operator=(bsl::initializer_list<v_t> values);
+// #endif
+// [ 3] VALUE& operator[](FORWARD_REF(KEY_TYPE) key);
+// [ 3] VALUE& at(const KEY& key);
+// [ 2] void clear();
+// [ 6] pair<iterator, iterator> equal_range(const KEY& key);
+// [ 2] size_t erase(const KEY& key);
+// [ 2] iterator erase(const_iterator position);
+// [ 2] iterator erase(iterator position);
+// [ 2] iterator erase(const_iterator first, const_iterator last);
+// [ 2] iterator find(const KEY& key);
+// [ 2] pair<iterator, bool> insert(FORWARD_REF(VALUE_TYPE) value);
+// [ 5] iterator insert(const_iterator, FORWARD_REF(VALUE_TYPE) value);
+// [ 5] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// #if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+// [ 5] void insert(bsl::initializer_list<value_type> values);
+// #endif
+// [ 3] pair<iterator, bool> emplace(ARGS&&... args);
+// [ 6] iterator lower_bound(const KEY& key);
+// [ 6] iterator upper_bound(const KEY& key);
+// [ 6] iterator begin();
+// [ 6] iterator end();
+// [ 6] reverse_iterator rbegin();
+// [ 6] reverse_iterator rend();
+// [ 4] void swap(BTreeMap& other);
+//
+// ACCESSORS
+// [ 3] const VALUE& at(const KEY& key) const;
+// [ 2] bool contains(const KEY& key) const;
+// [ 2] size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 6] pair<c_iter, c_iter> equal_range(const KEY& key) const;
+// [ 2] const_iterator find(const KEY& key) const;
+// [ 2] COMPARATOR key_comp() const;
+// [ 6] const_iterator lower_bound(const KEY& key) const;
+// [ 2] size_t size() const;
+// [ 6] const_iterator upper_bound(const KEY& key) const;
+// [ 6] const_iterator begin() const;
+// [ 6] const_iterator cbegin() const;
+// [ 6] const_iterator end() const;
+// [ 6] const_iterator cend() const;
+// [ 6] const_reverse_iterator rbegin() const;
+// [ 6] const_reverse_iterator crbegin() const;
+// [ 6] const_reverse_iterator rend() const;
+// [ 6] const_reverse_iterator crend() const;
+// [ 2] bslma::Allocator *allocator() const;
+// [ 7] ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const BTreeMap&, const BTreeMap&);
+// [ 4] bool operator!=(const BTreeMap&, const BTreeMap&);
+// [ 4] bool operator<(const BTreeMap&, const BTreeMap&);
+// [ 7] ostream& operator<<(ostream& stream, const BTreeMap& map);
+//
+// FREE FUNCTIONS
+// [ 4] void swap(BTreeMap&, BTreeMap&);
+// ----------------------------------------------------------------------------
+// [ 9] USAGE EXAMPLE
+// [ 8] CONCERN: 'BTreeMap' has the necessary type traits
+// [ 1] BREATHING TEST
+// [-1] PERFORMANCE TEST
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT  BSLIM_TESTUTIL_ASSERT
+#define ASSERTV BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q  BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P  BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_ BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_ BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_ BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool verbose;
+bool veryVerbose;
+bool veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::BTreeMap<int, bsl::string> Obj;
+typedef bsl::map<int, bsl::string>       Model;
+
+const char *const LONG = "a string long enough to require allocation ";
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+template <class MAP, class MODEL>
+bool sameValue(const MAP& map, const MODEL& model)
+    // Return 'true' if the specified 'map' holds the same sequence of
+    // key-value pairs as the specified 'model', and 'false' otherwise.
+{
+    if (map.size() != model.size()) {
+        return false;                                                 // RETURN
+    }
+
+    typename MODEL::const_iterator jt = model.begin();
+    for (typename MAP::const_iterator it = map.begin();
+                                                 it != map.end(); ++it, ++jt) {
+        if (it->first != jt->first || it->second != jt->second) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+bsl::string makeValue(int i, bslma::Allocator *basicAllocator)
+    // Return a string, that requires allocation, uniquely determined by the
+    // specified 'i', using the specified 'basicAllocator' to supply memory.
+{
+    bsl::ostringstream oss(basicAllocator);
+    oss << LONG << i;
+    return bsl::string(oss.str(), basicAllocator);
+}
+
+static unsigned int s_antiOptimization = 0;
+
+double toDouble(const bsls::TimeInterval& duration)
+    // Return the specified 'duration' in nanoseconds.
+{
+    return static_cast<double>(duration.totalNanoseconds());
+}
+
+template <class MAP>
+bsls::TimeInterval performanceInsert(MAP *map, const bsl::vector<int>& keys)
+    // Insert into the specified 'map' an entry for each of the specified
+    // 'keys', and return the duration of the insertions.
+{
+    bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+    for (bsl::size_t i = 0; i < keys.size(); ++i) {
+        map->insert(bsl::make_pair(keys[i], keys[i]));
+    }
+
+    return bsls::SystemTime::nowMonotonicClock() - start;
+}
+
+template <class MAP>
+bsls::TimeInterval performanceFind(const MAP&              map,
+                                   const bsl::vector<int>& keys)
+    // Invoke 'find' on the specified 'map' for each of the specified 'keys'
+    // several times, and return the median duration of a pass over 'keys'.
+{
+    const int NUM_TRIAL = 11;
+
+    bsl::vector<bsls::TimeInterval> results;
+    for (int trial = 0; trial < NUM_TRIAL; ++trial) {
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+        for (bsl::size_t i = 0; i < keys.size(); ++i) {
+            typename MAP::const_iterator it = map.find(keys[i]);
+            if (it != map.end()) {
+                s_antiOptimization += it->second;
+            }
+        }
+
+        results.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+    }
+
+    bsl::sort(results.begin(), results.end());
+
+    return results[NUM_TRIAL / 2];
+}
+
+template <class MAP>
+bsls::TimeInterval performanceIterate(const MAP& map)
+    // Iterate over the specified 'map' several times, and return the median
+    // duration of a complete iteration.
+{
+    const int NUM_TRIAL = 11;
+
+    bsl::vector<bsls::TimeInterval> results;
+    for (int trial = 0; trial < NUM_TRIAL; ++trial) {
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+        for (typename MAP::const_iterator it = map.begin();
+                                                      it != map.end(); ++it) {
+            s_antiOptimization += it->second;
+        }
+
+        results.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+    }
+
+    bsl::sort(results.begin(), results.end());
+
+    return results[NUM_TRIAL / 2];
+}
+
+template <class MAP>
+bsls::TimeInterval performanceErase(MAP *map, const bsl::vector<int>& keys)
+    // Erase from the specified 'map' each of the specified 'keys', and return
+    // the duration of the erasures.
+{
+    bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+    for (bsl::size_t i = 0; i < keys.size(); ++i) {
+        s_antiOptimization += static_cast<unsigned int>(map->erase(keys[i]));
+    }
+
+    return bsls::SystemTime::nowMonotonicClock() - start;
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator         oa("object", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&oa);
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Maintaining an Order Book
+/// - - - - - - - - - - - - - - - - - -
+// Suppose we are maintaining one side of an order book for a security, in
+// which the total quantity bid at each price level must be tracked, and from
+// which the best (highest) price levels are frequently read in order.  An
+// order book may hold many thousands of levels and is both updated and
+// scanned very frequently, which makes it a good candidate for a B-tree.
+//
+// First, we define an alias for a map from price (in ticks) to quantity,
+// ordered from the highest price to the lowest:
+//..
+    typedef bdlc::BTreeMap<int, int, bsl::greater<int> > PriceLevels;
+//..
+// Next, we create an (empty) map and record a sequence of orders:
+//..
+    PriceLevels bids;
+
+    const struct {
+        int d_price;
+        int d_quantity;
+    } ORDERS[] = {
+        { 1001, 100 }, { 1003, 200 }, { 1002, 300 }, { 1001,  50 },
+        { 1004, 100 }, { 1003, 100 }, {  999, 500 }, { 1000,  75 },
+    };
+    const int NUM_ORDERS = sizeof ORDERS / sizeof *ORDERS;
+
+    for (int i = 0; i < NUM_ORDERS; ++i) {
+        bids[ORDERS[i].d_price] += ORDERS[i].d_quantity;
+    }
+    ASSERT(6 == bids.size());
+//..
+// Then, we remove the price level at which all orders have been filled:
+//..
+    ASSERT(1 == bids.erase(1004));
+//..
+// Now, we compute the total quantity available at the three best prices,
+// traversing the map in order:
+//..
+    int                   total = 0;
+    int                   count = 0;
+    PriceLevels::iterator it    = bids.begin();
+    for (; it != bids.end() && count < 3; ++it, ++count) {
+        total += it->second;
+    }
+    ASSERT(750 == total);
+//..
+// Finally, we find the levels priced at 1000 or better (i.e., up to and
+// including 1000 in the order of the map):
+//..
+    ASSERT(1003 == bids.begin()->first);
+    ASSERT(4    == bsl::distance(bids.begin(), bids.upper_bound(1000)));
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TYPE TRAITS
+        //
+        // Concerns:
+        //: 1 'BTreeMap' has the expected type traits.
+        //
+        // Plan:
+        //: 1 Use 'BSLMF_ASSERT' to verify the traits.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: 'BTreeMap' has the necessary type traits
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TYPE TRAITS" << endl
+                          << "===========" << endl;
+
+        BSLMF_ASSERT(bslalg::HasStlIterators<Obj>::value);
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // PRINT AND OUTPUT OPERATOR
+        //
+        // Concerns:
+        //: 1 'print' and 'operator<<' write each element, in order, in the
+        //:   standard BDE format.
+        //
+        // Plan:
+        //: 1 Print maps having zero, one, and two elements on one line, and
+        //:   compare with the expected output.  (C-1)
+        //
+        // Testing:
+        //   ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+        //   ostream& operator<<(ostream& stream, const BTreeMap& map);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRINT AND OUTPUT OPERATOR" << endl
+                          << "=========================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        typedef bdlc::BTreeMap<int, int> IntObj;
+
+        IntObj mX(&oa);  const IntObj& X = mX;
+
+        {
+            bsl::ostringstream oss(&oa);
+            oss << X;
+            ASSERTV(oss.str(), "[ ]" == oss.str());
+        }
+
+        mX[2] = 20;
+        mX[1] = 10;
+
+        {
+            bsl::ostringstream oss(&oa);
+            oss << X;
+            ASSERTV(oss.str(), "[ [ 1 10 ] [ 2 20 ] ]" == oss.str());
+        }
+        {
+            bsl::ostringstream oss(&oa);
+            X.print(oss, 0, -1);
+            ASSERTV(oss.str(), "[ [ 1 10 ] [ 2 20 ] ]" == oss.str());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // ITERATORS AND BOUNDS
+        //
+        // Concerns:
+        //: 1 The iterators (including the reverse iterators) traverse the
+        //:   elements in the order of the comparator.
+        //:
+        //: 2 'lower_bound', 'upper_bound', and 'equal_range' agree with
+        //:   'bsl::map'.
+        //:
+        //: 3 A mapped value can be modified through an 'iterator'.
+        //
+        // Plan:
+        //: 1 Populate a map and a 'bsl::map' with the same random elements,
+        //:   and compare the iteration sequences and bounds.  (C-1..3)
+        //
+        // Testing:
+        //   pair<iterator, iterator> equal_range(const KEY& key);
+        //   iterator lower_bound(const KEY& key);
+        //   iterator upper_bound(const KEY& key);
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   pair<c_iter, c_iter> equal_range(const KEY& key) const;
+        //   const_iterator lower_bound(const KEY& key) const;
+        //   const_iterator upper_bound(const KEY& key) const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_reverse_iterator crend() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ITERATORS AND BOUNDS" << endl
+                          << "====================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        typedef bdlc::BTreeMap<int, int> IntObj;
+        typedef bsl::map<int, int>       IntModel;
+
+        IntObj   mX(&oa);  const IntObj& X = mX;
+        IntModel mY(&oa);  const IntModel& Y = mY;
+
+        bsl::srand(5);
+        for (int i = 0; i < 3000; ++i) {
+            const int key = bsl::rand() % 5000 * 2;
+            mX.insert(bsl::make_pair(key, i));
+            mY.insert(bsl::make_pair(key, i));
+        }
+
+        for (IntObj::iterator it = mX.begin(); it != mX.end(); ++it) {
+            it->second *= 3;
+        }
+        for (IntModel::iterator it = mY.begin(); it != mY.end(); ++it) {
+            it->second *= 3;
+        }
+        ASSERT(sameValue(X, Y));
+
+        ASSERT(X.cbegin() == X.begin());
+        ASSERT(X.cend()   == X.end());
+        ASSERT(static_cast<bsl::size_t>(bsl::distance(X.begin(), X.end()))
+                                                                == X.size());
+
+        {
+            IntModel::const_reverse_iterator jt = Y.rbegin();
+            for (IntObj::const_reverse_iterator it = X.crbegin();
+                                                 it != X.crend(); ++it, ++jt) {
+                ASSERTV(it->first, it->first  == jt->first);
+                ASSERTV(it->first, it->second == jt->second);
+            }
+            ASSERT(jt == Y.rend());
+            ASSERT(X.rbegin() == X.crbegin());
+            ASSERT(X.rend()   == X.crend());
+            ASSERT(bsl::distance(mX.rbegin(), mX.rend()) ==
+                                            bsl::distance(X.begin(), X.end()));
+        }
+
+        for (int key = -1; key <= 10001; ++key) {
+            ASSERTV(key, bsl::distance(Y.begin(), Y.lower_bound(key)) ==
+                                 bsl::distance(X.begin(), X.lower_bound(key)));
+            ASSERTV(key, bsl::distance(Y.begin(), Y.upper_bound(key)) ==
+                                 bsl::distance(X.begin(), X.upper_bound(key)));
+            ASSERTV(key, mX.lower_bound(key) == X.lower_bound(key));
+            ASSERTV(key, mX.upper_bound(key) == X.upper_bound(key));
+
+            bsl::pair<IntObj::iterator, IntObj::iterator> range =
+                                                          mX.equal_range(key);
+            ASSERTV(key, range.first  == X.lower_bound(key));
+            ASSERTV(key, range.second == X.upper_bound(key));
+            ASSERTV(key, X.equal_range(key).first  == X.lower_bound(key));
+            ASSERTV(key, X.equal_range(key).second == X.upper_bound(key));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // RANGE AND INITIALIZER-LIST CREATORS AND INSERTION
+        //
+        // Concerns:
+        //: 1 The range and initializer-list constructors and 'insert' methods
+        //:   insert each element whose key is not already present, and ignore
+        //:   the others.
+        //:
+        //: 2 The comparator and allocator supplied at construction are used.
+        //:
+        //: 3 Insertion with a hint inserts the value, and returns an iterator
+        //:   to the element having the key of the value.
+        //
+        // Plan:
+        //: 1 Construct maps from ranges and initializer lists containing
+        //:   duplicate keys, and compare with 'bsl::map'.  (C-1,2)
+        //:
+        //: 2 Insert values with hints, and verify the results.  (C-3)
+        //
+        // Testing:
+        //   BTreeMap(INPUT_ITERATOR, INPUT_ITERATOR, bslma::Allocator * = 0);
+        //   BTreeMap(II, II, const COMPARATOR&, bslma::Allocator * = 0);
+        //   BTreeMap(bsl::initializer_list<v_t>, bslma::Allocator * = 0);
+        //   BTreeMap(init_list<v_t>, const COMPARATOR&, bslma::Allocator *);
+        //   BTreeMap& operator=(bsl::initializer_list<v_t> values);
+        //   iterator insert(const_iterator, FORWARD_REF(VALUE_TYPE) value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void insert(bsl::initializer_list<value_type> values);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                << "RANGE AND INITIALIZER-LIST CREATORS AND INSERTION" << endl
+                << "=================================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            bsl::vector<bsl::pair<int, int> > values(&oa);
+            for (int i = 0; i < 1000; ++i) {
+                values.push_back(bsl::make_pair((i * 7) % 400, i));
+            }
+            bsl::map<int, int> model(values.begin(), values.end(), &oa);
+
+            typedef bdlc::BTreeMap<int, int> IntObj;
+
+            IntObj mX(values.begin(), values.end(), &oa);
+            const IntObj& X = mX;
+            ASSERT(&oa == X.allocator());
+            ASSERT(sameValue(X, model));
+
+            typedef bdlc::BTreeMap<int, int, bsl::greater<int> > RevObj;
+
+            RevObj mY(values.begin(), values.end(), bsl::greater<int>(), &oa);
+            const RevObj& Y = mY;
+            ASSERT(&oa == Y.allocator());
+            ASSERT(model.size() == Y.size());
+            ASSERT(model.rbegin()->first == Y.begin()->first);
+
+            IntObj mZ(&oa);  const IntObj& Z = mZ;
+            mZ.insert(values.begin(), values.end());
+            ASSERT(sameValue(Z, model));
+
+            IntObj::iterator it = mZ.insert(Z.begin(), bsl::make_pair(7, -1));
+            ASSERT(7 == it->first);
+            ASSERT(model[7] == it->second);
+
+            it = mZ.insert(Z.end(), bsl::make_pair(-7, -1));
+            ASSERT(-7 == it->first);
+            ASSERT(-1 == it->second);
+            ASSERT(model.size() + 1 == Z.size());
+        }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            typedef bdlc::BTreeMap<int, int> IntObj;
+
+            IntObj mX({ {3, 30}, {1, 10}, {2, 20}, {1, 11} }, &oa);
+            const IntObj& X = mX;
+            ASSERT(3  == X.size());
+            ASSERT(10 == X.at(1));
+            ASSERT(&oa == X.allocator());
+
+            IntObj mY({ {3, 30}, {1, 10} }, bsl::less<int>(), &oa);
+            const IntObj& Y = mY;
+            ASSERT(2 == Y.size());
+
+            mY.insert({ {4, 40}, {3, 31} });
+            ASSERT(3  == Y.size());
+            ASSERT(30 == Y.at(3));
+
+            mY = { {5, 50} };
+            ASSERT(1  == Y.size());
+            ASSERT(50 == Y.at(5));
+        }
+#endif
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 Copies and moves have the value of the source, and use the
+        //:   expected allocator.
+        //:
+        //: 2 A move using the same allocator does not allocate.
+        //:
+        //: 3 'swap' exchanges the values of two maps.
+        //:
+        //: 4 The equality and less-than operators compare the sequences of
+        //:   elements.
+        //
+        // Plan:
+        //: 1 Create maps of various sizes and copy, move, swap, and compare
+        //:   them.  (C-1..4)
+        //
+        // Testing:
+        //   BTreeMap(const BTreeMap&, bslma::Allocator *bA = 0);
+        //   BTreeMap(MovableRef<BTreeMap>);
+        //   BTreeMap(MovableRef<BTreeMap>, bslma::Allocator *basicAllocator);
+        //   BTreeMap& operator=(const BTreeMap&);
+        //   BTreeMap& operator=(MovableRef<BTreeMap>);
+        //   void swap(BTreeMap& other);
+        //   bool operator==(const BTreeMap&, const BTreeMap&);
+        //   bool operator!=(const BTreeMap&, const BTreeMap&);
+        //   bool operator<(const BTreeMap&, const BTreeMap&);
+        //   void swap(BTreeMap&, BTreeMap&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, MOVE, SWAP, AND COMPARISON" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        for (int n = 0; n < 300; n += 1 + n / 2) {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < n; ++i) {
+                mX[i] = makeValue(i, &oa);
+            }
+
+            Obj mY(X, &za);  const Obj& Y = mY;
+            ASSERTV(n, &za == Y.allocator());
+            ASSERTV(n, X == Y);
+            ASSERTV(n, !(X != Y));
+            ASSERTV(n, !(X < Y) && !(Y < X));
+
+            {
+                const bsls::Types::Int64 numAllocations = oa.numAllocations();
+
+                Obj mZ(bslmf::MovableRefUtil::move(mX));  const Obj& Z = mZ;
+                ASSERTV(n, numAllocations == oa.numAllocations());
+                ASSERTV(n, &oa == Z.allocator());
+                ASSERTV(n, Y == Z);
+
+                mX = bslmf::MovableRefUtil::move(mZ);
+                ASSERTV(n, numAllocations == oa.numAllocations());
+                ASSERTV(n, Y == X);
+            }
+            {
+                Obj mZ(bslmf::MovableRefUtil::move(mY), &oa);
+                const Obj& Z = mZ;
+                ASSERTV(n, &oa == Z.allocator());
+                ASSERTV(n, X == Z);
+
+                mY = Z;
+                ASSERTV(n, X == Y);
+                ASSERTV(n, &za == Y.allocator());
+            }
+
+            if (0 < n) {
+                Obj mZ(X, &oa);  const Obj& Z = mZ;
+                mZ[n - 1] = "x";
+                ASSERTV(n, X != Z);
+                ASSERTV(n, X < Z);
+
+                mZ.swap(mX);
+                ASSERTV(n, Y == Z);
+                ASSERTV(n, Y != X);
+
+                swap(mX, mZ);
+                ASSERTV(n, Y == X);
+
+                mZ[n] = "y";
+                ASSERTV(n, X < Z);
+                ASSERTV(n, !(Z < X));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'operator[]', 'at', AND 'emplace'
+        //
+        // Concerns:
+        //: 1 'operator[]' returns a reference to the mapped value of the
+        //:   element having the key, inserting a default-constructed mapped
+        //:   value if no such element exists.
+        //:
+        //: 2 'at' returns a reference to the mapped value of the element
+        //:   having the key, and throws 'bsl::out_of_range' if there is none.
+        //:
+        //: 3 'emplace' inserts an element only if no element having an
+        //:   equivalent key exists.
+        //:
+        //: 4 All of the above are exception neutral.
+        //
+        // Plan:
+        //: 1 Exercise the methods on a map of strings, and verify the results.
+        //:   (C-1..3)
+        //:
+        //: 2 Use the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST' macros to verify
+        //:   exception neutrality.  (C-4)
+        //
+        // Testing:
+        //   VALUE& operator[](FORWARD_REF(KEY_TYPE) key);
+        //   VALUE& at(const KEY& key);
+        //   const VALUE& at(const KEY& key) const;
+        //   pair<iterator, bool> emplace(ARGS&&... args);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'operator[]', 'at', AND 'emplace'" << endl
+                          << "=================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 500; ++i) {
+                const int         key   = (i * 31) % 250;
+                const bsl::string VALUE = makeValue(key, &oa);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    mX[key] = VALUE;
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(i, VALUE == X.at(key));
+                ASSERTV(i, VALUE == mX.at(key));
+            }
+            ASSERT(250 == X.size());
+
+#if defined(BDE_BUILD_TARGET_EXC)
+            {
+                bool caught = false;
+                try {
+                    X.at(250);
+                }
+                catch (const std::out_of_range&) {
+                    caught = true;
+                }
+                ASSERT(caught);
+            }
+            {
+                bool caught = false;
+                try {
+                    mX.at(-1);
+                }
+                catch (const std::out_of_range&) {
+                    caught = true;
+                }
+                ASSERT(caught);
+            }
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+            {
+                bsl::pair<Obj::iterator, bool> rv = mX.emplace(250, LONG);
+                ASSERT(true  == rv.second);
+                ASSERT(250   == rv.first->first);
+                ASSERT(LONG  == rv.first->second);
+                ASSERT(&oa   == rv.first->second.allocator().mechanism());
+
+                rv = mX.emplace(250, "other");
+                ASSERT(false == rv.second);
+                ASSERT(LONG  == rv.first->second);
+            }
+#endif
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed map is empty and allocates no memory.
+        //:
+        //: 2 'insert', 'erase', and 'clear' yield the same value as the
+        //:   corresponding operations on 'bsl::map'.
+        //:
+        //: 3 The basic accessors report the value of the map.
+        //:
+        //: 4 The elements of the map use the allocator of the map.
+        //
+        // Plan:
+        //: 1 Perform a random sequence of insertions and erasures on a map
+        //:   and on a 'bsl::map', and compare the results and values.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   BTreeMap();
+        //   BTreeMap(bslma::Allocator *basicAllocator);
+        //   BTreeMap(const COMPARATOR&, bslma::Allocator * = 0);
+        //   ~BTreeMap();
+        //   void clear();
+        //   size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   iterator find(const KEY& key);
+        //   pair<iterator, bool> insert(FORWARD_REF(VALUE_TYPE) value);
+        //   bool contains(const KEY& key) const;
+        //   size_t count(const KEY& key) const;
+        //   bool empty() const;
+        //   const_iterator find(const KEY& key) const;
+        //   COMPARATOR key_comp() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+        {
+            const bsl::greater<int> comparator;
+
+            bdlc::BTreeMap<int, int, bsl::greater<int> > mX(comparator);
+            ASSERT(true == mX.key_comp()(2, 1));
+            ASSERT(&defaultAllocator == mX.allocator());
+        }
+
+        {
+            Obj   mX(&oa);  const Obj&   X = mX;
+            Model mY(&oa);  const Model& Y = mY;
+
+            ASSERT(0    == oa.numBlocksTotal());
+            ASSERT(true == X.empty());
+            ASSERT(0    == X.size());
+            ASSERT(&oa  == X.allocator());
+
+            bsl::srand(3);
+            for (int i = 0; i < 10000; ++i) {
+                const int key = bsl::rand() % 2000;
+                const int op  = bsl::rand() % 10;
+
+                if (op < 5) {
+                    const bsl::string value = makeValue(i, &oa);
+
+                    bsl::pair<Obj::iterator, bool> rv =
+                                         mX.insert(bsl::make_pair(key, value));
+                    bsl::pair<Model::iterator, bool> exp =
+                                         mY.insert(bsl::make_pair(key, value));
+
+                    ASSERTV(i, exp.second == rv.second);
+                    ASSERTV(i, key == rv.first->first);
+                    ASSERTV(i, exp.first->second == rv.first->second);
+                    ASSERTV(i,
+                            &oa == rv.first->second.allocator().mechanism());
+                }
+                else if (op < 7) {
+                    ASSERTV(i, mY.erase(key) == mX.erase(key));
+                }
+                else if (op < 8) {
+                    Obj::iterator   it  = mX.find(key);
+                    Model::iterator exp = mY.find(key);
+
+                    ASSERTV(i, (Y.end() == exp) == (X.end() == it));
+                    if (X.end() != it) {
+                        Model::iterator expNext = mY.erase(exp);
+                        Obj::iterator   next    = 0 == i % 2
+                                                ? mX.erase(it)
+                                                : mX.erase(Obj::const_iterator(
+                                                                          it));
+                        ASSERTV(i, (Y.end() == expNext) == (X.end() == next));
+                        if (X.end() != next) {
+                            ASSERTV(i, expNext->first == next->first);
+                        }
+                    }
+                }
+                else if (op < 9) {
+                    Obj::iterator next = mX.erase(X.lower_bound(key),
+                                                  X.lower_bound(key + 20));
+                    mY.erase(Y.lower_bound(key), Y.lower_bound(key + 20));
+                    ASSERTV(i, next == X.lower_bound(key + 20));
+                }
+                else {
+                    ASSERTV(i, Y.count(key)      == X.count(key));
+                    ASSERTV(i, (0 < Y.count(key)) == X.contains(key));
+                    ASSERTV(i, (Y.end() == Y.find(key)) ==
+                                                     (X.end() == X.find(key)));
+                }
+
+                ASSERTV(i, Y.size()  == X.size());
+                ASSERTV(i, Y.empty() == X.empty());
+            }
+            ASSERT(sameValue(X, Y));
+
+            mX.clear();
+            ASSERT(0    == X.size());
+            ASSERT(true == X.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Instantiate an object and verify basic functionality.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        typedef bdlc::BTreeMap<int, int> IntObj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        IntObj mX(&oa);  const IntObj& X = mX;
+
+        ASSERT(       0 == X.size());
+        ASSERT( X.end() == X.find(0));
+
+        {
+            bsl::pair<IntObj::iterator, bool> rv =
+                                               mX.insert(bsl::make_pair(0, 7));
+
+            ASSERT(       1 == X.size());
+            ASSERT(    true == rv.second);
+            ASSERT( X.end() != rv.first);
+            ASSERT(       0 == rv.first->first);
+            ASSERT(       7 == rv.first->second);
+            ASSERT(rv.first == X.find(0));
+            ASSERT( X.end() == X.find(1));
+        }
+
+        IntObj mY(X, &oa);  const IntObj& Y = mY;
+
+        ASSERT(      1 == Y.size());
+        ASSERT(      0 == Y.find(0)->first);
+        ASSERT(      7 == Y.find(0)->second);
+        ASSERT(Y.end() == Y.find(1));
+        ASSERT(      X == Y);
+        ASSERT(      Y == X);
+
+        {
+            bsl::size_t rv = mY.erase(0);
+
+            ASSERT(      1 == rv);
+            ASSERT(      0 == Y.size());
+            ASSERT(Y.end() == Y.find(0));
+            ASSERT(      X != Y);
+        }
+
+        for (int i = 0; i < 1000; ++i) {
+            mY[999 - i] = i;
+        }
+        ASSERT(1000 == Y.size());
+        ASSERT(   0 == Y.begin()->first);
+        ASSERT( 999 == Y.begin()->second);
+        ASSERT( 500 == Y.at(499));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Compare the performance and memory use of 'bdlc::BTreeMap' with
+        //   that of 'bsl::map'.
+        //
+        // Concerns:
+        //: 1 'bdlc::BTreeMap' uses substantially less memory than 'bsl::map'
+        //:   for small elements.
+        //:
+        //: 2 'bdlc::BTreeMap' can outperform 'bsl::map' for 'find' and for
+        //:   iteration.
+        //
+        // Plan:
+        //: 1 Insert the same random keys into both containers, using test
+        //:   allocators, and compare the memory in use.  (C-1)
+        //:
+        //: 2 Time the insertion of random keys, 'find' with keys both present
+        //:   and absent, complete iteration, and erasure, and report the
+        //:   results.  (C-2)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_KEYS = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        bslma::NewDeleteAllocator    na;
+        bslma::DefaultAllocatorGuard dag(&na);
+
+        bsl::vector<int> keys;
+        bsl::vector<int> absent;
+        bsl::srand(1);
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            const int key = ((bsl::rand() << 15) ^ bsl::rand()) & 0x3fffffff;
+            keys.push_back(key * 2);
+            absent.push_back(key * 2 + 1);
+        }
+
+        {
+            bslma::TestAllocator ba("btree", veryVeryVeryVerbose);
+            bslma::TestAllocator ma("map",   veryVeryVeryVerbose);
+
+            bdlc::BTreeMap<int, int> mX(&ba);
+            bsl::map<int, int>       mY(&ma);
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                mX.insert(bsl::make_pair(keys[i], i));
+                mY.insert(bsl::make_pair(keys[i], i));
+            }
+
+            const double x = static_cast<double>(ba.numBytesInUse());
+            const double y = static_cast<double>(ma.numBytesInUse());
+
+            ASSERT(x < y);
+
+            cout << "memory: btree " << x / mX.size()
+                 << " bytes/element, map " << y / mY.size()
+                 << " bytes/element" << endl;
+        }
+
+        bdlc::BTreeMap<int, int> mX;
+        bsl::map<int, int>       mY;
+
+        const char *NAMES[] = {
+            "insert",
+            "find (present)",
+            "find (absent)",
+            "iterate",
+            "erase"
+        };
+        double x[5];
+        double y[5];
+
+        x[0] = toDouble(performanceInsert(&mX, keys));
+        y[0] = toDouble(performanceInsert(&mY, keys));
+        x[1] = toDouble(performanceFind(mX, keys));
+        y[1] = toDouble(performanceFind(mY, keys));
+        x[2] = toDouble(performanceFind(mX, absent));
+        y[2] = toDouble(performanceFind(mY, absent));
+        x[3] = toDouble(performanceIterate(mX));
+        y[3] = toDouble(performanceIterate(mY));
+        x[4] = toDouble(performanceErase(&mX, keys));
+        y[4] = toDouble(performanceErase(&mY, keys));
+
+        ASSERT(x[1] < y[1]);
+        ASSERT(x[3] < y[3]);
+
+        for (int i = 0; i < 5; ++i) {
+            cout << NAMES[i] << ": btree " << x[i] / NUM_KEYS
+                 << " ns/op, map " << y[i] / NUM_KEYS
+                 << " ns/op (btree is " << 100.0 * (y[i] - x[i]) / x[i]
+                 << "% faster)" << endl;
+        }
+
+        if (veryVeryVeryVerbose) {
+            cout << "anti-optimization: " << s_antiOptimization << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1178 @@
+// bdlc_btreemultiset.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLC_BTREEMULTISET
+#define INCLUDED_BDLC_BTREEMULTISET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered multiset container implemented as a B-tree.
+//
+//@CLASSES:
+//   bdlc::BTreeMultiSet: B-tree based ordered multiset container
+//
+//@SEE_ALSO: bdlc_btree, bdlc_btreeset, bdlc_btreemultimap, bsl_multiset
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::BTreeMultiSet', that implements an ordered collection of keys that
+// need not be unique, stored in a B-tree (see 'bdlc_btree').  Equivalent keys
+// are maintained in the order of their insertion.
+//
+// An instantiation of 'bdlc::BTreeMultiSet' is an allocator-aware,
+// value-semantic type whose salient attributes are its size (number of keys)
+// and the ordered sequence of keys the multiset contains.  An instantiation
+// may be provided with a custom key-comparison functor, but that functor is
+// not a salient attribute.  In particular, when comparing element values for
+// equality between two different 'bdlc::BTreeMultiSet' objects, the elements
+// are compared using 'operator=='.
+//
+// 'bdlc::BTreeMultiSet' offers the same operations as 'bsl::multiset', with
+// the same logarithmic complexity, but stores many keys in each node of its
+// tree rather than one.  See 'bdlc_btreemap' for a discussion of the
+// performance characteristics.
+//
+///Interface Differences with 'bsl::multiset'
+///------------------------------------------
+// A 'bdlc::BTreeMultiSet' meets most of the requirements of an ordered
+// associative container with bidirectional iterators in the C++11 Standard
+// [23.2.4].  However, elements are *moved* within and between the nodes of
+// the tree as the container is modified, so:
+//
+//: o Every insertion or erasure invalidates all iterators, pointers, and
+//:   references to the elements of the multiset (unlike 'bsl::multiset',
+//:   where only references to an erased element are invalidated).
+//:
+//: o The (template parameter) type 'KEY' must be move-assignable as well as
+//:   move-constructible.
+//
+// Allocator use follows BDE style, and the various allocator propagation
+// attributes are not present.
+//
+///Requirements on 'KEY' and 'COMPARATOR'
+///--------------------------------------
+// The (template parameter) type 'KEY' must be move-constructible and
+// move-assignable.  The (template parameter) type 'COMPARATOR' must be a
+// copy-constructible functor defining a strict weak ordering on 'KEY' values;
+// 'COMPARATOR' must also be default-constructible if a constructor not taking
+// a comparator is used.
+//
+///Exception Safety
+///----------------
+// A 'bdlc::BTreeMultiSet' is exception neutral, and all of the methods of
+// 'bdlc::BTreeMultiSet' provide the basic exception safety guarantee (see
+// {'bsldoc_glossary'|Basic Guarantee}).
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Computing a Running Median
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we must report the median of a sliding window of latency samples,
+// some of which may be identical.
+//
+// First, we create a multiset holding the samples in the current window:
+//..
+//  bdlc::BTreeMultiSet<int> window;
+//
+//  const int SAMPLES[]   = { 12, 7, 12, 30, 7, 12, 9 };
+//  const int NUM_SAMPLES = sizeof SAMPLES / sizeof *SAMPLES;
+//
+//  for (int i = 0; i < NUM_SAMPLES; ++i) {
+//      window.insert(SAMPLES[i]);
+//  }
+//  assert(3 == window.count(12));
+//..
+// Then, the oldest sample leaves the window; note that only one of the
+// samples having the value 12 must be removed:
+//..
+//  window.erase(window.find(12));
+//  assert(2 == window.count(12));
+//..
+// Finally, we find the median of the six remaining samples:
+//..
+//  bdlc::BTreeMultiSet<int>::const_iterator it = window.begin();
+//  bsl::advance(it, window.size() / 2);
+//  assert(12 == *it);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_btree.h>
+
+#include <bslalg_hasstliterators.h>
+#include <bslalg_swaputil.h>
+
+#include <bslim_printer.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_destructorguard.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_movableref.h>
+#include <bslmf_util.h>    // 'forward(V)'
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_util.h>     // 'forward<T>(V)'
+
+#include <bslstl_iterator.h>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <bsl_initializer_list.h>
+#endif
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_ostream.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+// FORWARD DECLARATIONS
+template <class KEY, class COMPARATOR = bsl::less<KEY> >
+class BTreeMultiSet;
+
+template <class KEY, class COMPARATOR>
+bool operator==(const BTreeMultiSet<KEY, COMPARATOR>& lhs,
+                const BTreeMultiSet<KEY, COMPARATOR>& rhs);
+
+template <class KEY, class COMPARATOR>
+bool operator!=(const BTreeMultiSet<KEY, COMPARATOR>& lhs,
+                const BTreeMultiSet<KEY, COMPARATOR>& rhs);
+
+template <class KEY, class COMPARATOR>
+void swap(BTreeMultiSet<KEY, COMPARATOR>& a,
+          BTreeMultiSet<KEY, COMPARATOR>& b);
+
+                         // =========================
+                         // struct BTreeMultiSet_EntryUtil
+                         // =========================
+
+template <class ENTRY>
+struct BTreeMultiSet_EntryUtil
+    // This templated utility provides methods to construct an 'ENTRY' and a
+    // method to extract the key from an 'ENTRY' (which is, identically, the
+    // 'ENTRY').
+{
+    // CLASS METHODS
+    template <class KEY_TYPE>
+    static void construct(
+                        ENTRY                                       *entry,
+                        bslma::Allocator                            *allocator,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key);
+        // Load into the specified 'entry' the 'ENTRY' value constructed from
+        // the specified 'key', using the specified 'allocator' to supply
+        // memory.  'allocator' is ignored if the (template parameter) type
+        // 'ENTRY' is not allocator aware.
+
+    static const ENTRY& key(const ENTRY& entry);
+        // Return the specified 'entry'.
+};
+
+                              // ==============
+                              // class BTreeMultiSet
+                              // ==============
+
+template <class KEY, class COMPARATOR>
+class BTreeMultiSet {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of keys of (template parameter) type 'KEY', which
+    // need not be unique.  The (template parameter) type 'COMPARATOR' is a
+    // functor defining the order of 'KEY' values.  See {Requirements on 'KEY'
+    // and 'COMPARATOR'} for more information.
+
+  private:
+    // PRIVATE TYPES
+    typedef BTree<KEY, KEY, BTreeMultiSet_EntryUtil<KEY>, COMPARATOR> ImplType;
+        // This is the underlying implementation class.
+
+    // FRIENDS
+    friend bool operator==<>(const BTreeMultiSet&, const BTreeMultiSet&);
+    friend bool operator!=<>(const BTreeMultiSet&, const BTreeMultiSet&);
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                    key_type;
+    typedef KEY                                    value_type;
+    typedef bsl::size_t                            size_type;
+    typedef bsl::ptrdiff_t                         difference_type;
+    typedef COMPARATOR                             key_compare;
+    typedef COMPARATOR                             value_compare;
+    typedef value_type&                            reference;
+    typedef const value_type&                      const_reference;
+    typedef typename ImplType::const_iterator      iterator;
+    typedef typename ImplType::const_iterator      const_iterator;
+    typedef bsl::reverse_iterator<iterator>        reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>  const_reverse_iterator;
+
+  private:
+    // DATA
+    ImplType d_impl;  // underlying B-tree used by this set
+
+  public:
+    // CREATORS
+    BTreeMultiSet();
+    explicit BTreeMultiSet(bslma::Allocator *basicAllocator);
+    explicit BTreeMultiSet(const COMPARATOR&  comparator,
+                           bslma::Allocator  *basicAllocator = 0);
+        // Create an empty 'BTreeMultiSet' object.  Optionally specify a
+        // 'comparator' used to order the keys of elements in this container.
+        // If 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied or is 0, the currently installed default allocator is
+        // used.  No memory is allocated.
+
+    template <class INPUT_ITERATOR>
+    BTreeMultiSet(INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    BTreeMultiSet(INPUT_ITERATOR     first,
+                  INPUT_ITERATOR     last,
+                  const COMPARATOR&  comparator,
+                  bslma::Allocator  *basicAllocator = 0);
+        // Create a 'BTreeMultiSet' object initialized by insertion of the
+        // values from the input iterator range specified by 'first' through
+        // 'last' (including 'first', excluding 'last').  Optionally specify a
+        // 'comparator' used to order the keys of elements in this container.
+        // If 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied or is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'first' and 'last' refer to
+        // a sequence of valid values where 'first' is at a position at or
+        // before 'last'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    BTreeMultiSet(bsl::initializer_list<value_type>  values,
+                  bslma::Allocator                  *basicAllocator = 0);
+    BTreeMultiSet(bsl::initializer_list<value_type>  values,
+                  const COMPARATOR&                  comparator,
+                  bslma::Allocator                  *basicAllocator = 0);
+        // Create a 'BTreeMultiSet' object initialized by insertion of the
+        // specified 'values'.  Optionally specify a 'comparator' used to order
+        // the keys of elements in this container.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied or is 0,
+        // the currently installed default allocator is used.
+#endif
+
+    BTreeMultiSet(const BTreeMultiSet&  original,
+                  bslma::Allocator     *basicAllocator = 0);
+        // Create a 'BTreeMultiSet' object having the same value and comparator
+        // as the specified 'original' object.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // specified or is 0, the currently installed default allocator is
+        // used.
+
+    BTreeMultiSet(bslmf::MovableRef<BTreeMultiSet> original);
+        // Create a 'BTreeMultiSet' object having the same value, comparator,
+        // and allocator as the specified 'original' object.  The contents of
+        // 'original' are moved (in constant time) to this object, 'original'
+        // is left in a (valid) unspecified state, and no exceptions will be
+        // thrown.
+
+    BTreeMultiSet(bslmf::MovableRef<BTreeMultiSet>  original,
+                  bslma::Allocator                 *basicAllocator);
+        // Create a 'BTreeMultiSet' object having the same value and comparator
+        // as the specified 'original' object, using the specified
+        // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  The allocator of
+        // 'original' remains unchanged.  If 'original' and the newly created
+        // object have the same allocator then the contents of 'original' are
+        // moved (in constant time) to this object, 'original' is left in a
+        // (valid) unspecified state, and no exceptions will be thrown;
+        // otherwise, the elements of 'original' are moved, 'original' is left
+        // in a (valid) unspecified state, and an exception may be thrown.
+
+    ~BTreeMultiSet();
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    BTreeMultiSet& operator=(const BTreeMultiSet& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.
+
+    BTreeMultiSet& operator=(bslmf::MovableRef<BTreeMultiSet> rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  If this object and 'rhs' use the same allocator the
+        // contents of 'rhs' are moved (in constant time) to this object.
+        // 'rhs' is left in a (valid) unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    BTreeMultiSet& operator=(bsl::initializer_list<value_type> values);
+        // Assign to this object the value resulting from first clearing this
+        // set and then inserting each object in the specified 'values'
+        // initializer list; return a reference providing modifiable access to
+        // this object.
+#endif
+
+    void clear();
+        // Remove all elements from this set and release all memory from this
+        // set.
+
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        // Return a pair of iterators defining the sequence of modifiable
+        // elements in this set having the specified 'key', where the first
+        // iterator is positioned at the start of the sequence and the second
+        // iterator is positioned one past the end of the sequence.  If this
+        // set contains no elements having a key equivalent to 'key', then the
+        // two returned iterators will have the same value.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove from this set all elements whose key is equivalent to the
+        // specified 'key', and return the number of elements removed.  This
+        // method invalidates all iterators and references to the elements of
+        // this set.
+
+    iterator erase(const_iterator position);
+        // Remove from this set the element at the specified 'position', and
+        // return an iterator referring to the element immediately following
+        // the removed element, or to the past-the-end position if the removed
+        // element was the last element in the sequence of elements maintained
+        // by this set.  This method invalidates all iterators and references
+        // to the elements of this set.  The behavior is undefined unless
+        // 'position' refers to an element in this set.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this set the elements starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and return an iterator referencing the same element as 'last'.  This
+        // method invalidates all iterators and references to the elements of
+        // this set.  The behavior is undefined unless 'first' and 'last' are
+        // valid iterators on this set, and the 'first' position is at or
+        // before the 'last' position in the ordered sequence of elements of
+        // this container.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the first element in this set having
+        // the specified 'key', or 'end()' if no such entry exists in this set.
+
+    template <class VALUE_TYPE>
+    typename bsl::enable_if<bsl::is_convertible<VALUE_TYPE, value_type>::value,
+                            iterator>::type
+                    insert(BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value)
+        // Insert the specified 'value' into this set after any elements having
+        // an equivalent key, and return an iterator referring to the newly
+        // inserted element.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        return d_impl.insertMulti(
+                             BSLS_COMPILERFEATURES_FORWARD(VALUE_TYPE, value));
+    }
+
+    template <class VALUE_TYPE>
+    typename bsl::enable_if<bsl::is_convertible<VALUE_TYPE, value_type>::value,
+                            iterator>::type
+                    insert(const_iterator                                ,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value)
+        // Insert the specified 'value' into this set after any elements having
+        // an equivalent key, and return an iterator referring to the newly
+        // inserted element.  The supplied 'const_iterator' is ignored.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        return d_impl.insertMulti(
+                             BSLS_COMPILERFEATURES_FORWARD(VALUE_TYPE, value));
+    }
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set the value of each element in the input iterator
+        // range specified by 'first' through 'last' (including 'first',
+        // excluding 'last').  The behavior is undefined unless 'first' and
+        // 'last' refer to a sequence of valid values where 'first' is at a
+        // position at or before 'last'.  Note that the relative order of
+        // elements having equivalent keys is the order of their insertion.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(bsl::initializer_list<value_type> values);
+        // Insert into this set an element having the value of each object in
+        // the specified 'values' initializer list.
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... ARGS>
+    iterator emplace(ARGS&&... args);
+        // Insert into this set, after any elements having an equivalent key, a
+        // newly-created element constructed by forwarding this set's allocator
+        // and the specified 'args' to the constructor of 'KEY', and return an
+        // iterator referring to the newly inserted element.
+#endif
+
+    iterator lower_bound(const KEY& key);
+        // Return an iterator referring to the first element in this set whose
+        // key is not ordered before the specified 'key', or 'end()' if no such
+        // element exists.
+
+    iterator upper_bound(const KEY& key);
+        // Return an iterator referring to the first element in this set whose
+        // key is ordered after the specified 'key', or 'end()' if no such
+        // element exists.
+
+                          // Iterators
+
+    iterator begin();
+        // Return an iterator to the first element in the ordered sequence of
+        // elements maintained by this set, or the 'end' iterator if this set
+        // is empty.
+
+    iterator end();
+        // Return an iterator to the past-the-end element in the ordered
+        // sequence of elements maintained by this set.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator to the last element in the ordered
+        // sequence of elements maintained by this set, or 'rend()' if this set
+        // is empty.
+
+    reverse_iterator rend();
+        // Return a reverse iterator to the prior-to-the-beginning element in
+        // the ordered sequence of elements maintained by this set.
+
+                             // Aspects
+
+    void swap(BTreeMultiSet& other);
+        // Exchange the value of this object as well as its comparator with
+        // those of the specified 'other' object.  The behavior is undefined
+        // unless this object was created with the same allocator as 'other'.
+
+    // ACCESSORS
+    bool contains(const KEY& key) const;
+        // Return 'true' if this set contains an element having the specified
+        // 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements in this set having the specified
+        // 'key'.
+
+    bool empty() const;
+        // Return 'true' if this set contains no elements, and 'false'
+        // otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                         const KEY& key) const;
+        // Return a pair of 'const_iterator's defining the sequence of elements
+        // in this set having the specified 'key', where the first iterator is
+        // positioned at the start of the sequence and the second iterator is
+        // positioned one past the end of the sequence.  If this set contains
+        // no elements having a key equivalent to 'key', then the two returned
+        // iterators will have the same value.
+
+    const_iterator find(const KEY& key) const;
+        // Return a 'const_iterator' referring to the first element in this set
+        // having the specified 'key', or 'end()' if no such entry exists in
+        // this set.
+
+    COMPARATOR key_comp() const;
+        // Return (a copy of) the key-comparison functor used by this set to
+        // order its elements.
+
+    const_iterator lower_bound(const KEY& key) const;
+        // Return a 'const_iterator' referring to the first element in this set
+        // whose key is not ordered before the specified 'key', or 'end()' if
+        // no such element exists.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this set.
+
+    const_iterator upper_bound(const KEY& key) const;
+        // Return a 'const_iterator' referring to the first element in this set
+        // whose key is ordered after the specified 'key', or 'end()' if no
+        // such element exists.
+
+                          // Iterators
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return a 'const_iterator' to the first element in the ordered
+        // sequence of elements maintained by this set, or the 'end' iterator
+        // if this set is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return a 'const_iterator' to the past-the-end element in the ordered
+        // sequence of elements maintained by this set.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse 'const_iterator' to the last element in the ordered
+        // sequence of elements maintained by this set, or 'rend()' if this set
+        // is empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return a reverse 'const_iterator' to the prior-to-the-beginning
+        // element in the ordered sequence of elements maintained by this set.
+
+                           // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this set to supply memory.
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level = 0,
+                        int           spacesPerLevel = 4) const;
+        // Format this object to the specified output 'stream' at the (absolute
+        // value of) the optionally specified indentation 'level', and return a
+        // reference to the modifiable 'stream'.  If 'level' is specified,
+        // optionally specify 'spacesPerLevel', the number of spaces per
+        // indentation level for this and all of its nested objects.  If
+        // 'level' is negative, suppress indentation of the first line.  If
+        // 'spacesPerLevel' is negative, format the entire output on one line,
+        // suppressing all but the initial indentation (as governed by
+        // 'level').  If 'stream' is not valid on entry, this operation has no
+        // effect.
+};
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR>
+bool operator==(const BTreeMultiSet<KEY, COMPARATOR>& lhs,
+                const BTreeMultiSet<KEY, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'BTreeMultiSet' objects have the same
+    // value if they have the same number of elements, and each element in the
+    // ordered sequence of elements of 'lhs' is equal to the element at the
+    // corresponding position in 'rhs'.  The comparators are not involved in
+    // the comparison.
+
+template <class KEY, class COMPARATOR>
+bool operator!=(const BTreeMultiSet<KEY, COMPARATOR>& lhs,
+                const BTreeMultiSet<KEY, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'BTreeMultiSet' objects do not
+    // have the same value if they do not have the same number of elements, or
+    // some element in the ordered sequence of elements of 'lhs' is not equal
+    // to the element at the corresponding position in 'rhs'.
+
+template <class KEY, class COMPARATOR>
+bool operator<(const BTreeMultiSet<KEY, COMPARATOR>& lhs,
+               const BTreeMultiSet<KEY, COMPARATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically less than that of the specified 'rhs' set, and 'false'
+    // otherwise.  Elements are compared using 'operator<'.
+
+template <class KEY, class COMPARATOR>
+bsl::ostream& operator<<(bsl::ostream&                           stream,
+                         const BTreeMultiSet<KEY, COMPARATOR>& set);
+    // Write the value of the specified 'set' to the specified output 'stream'
+    // in a single-line format, and return a reference providing modifiable
+    // access to 'stream'.  If 'stream' is not valid on entry, this operation
+    // has no effect.  Note that this human-readable format is not fully
+    // specified and can change without notice.
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR>
+void swap(BTreeMultiSet<KEY, COMPARATOR>& a,
+          BTreeMultiSet<KEY, COMPARATOR>& b);
+    // Exchange the value and the comparator of the specified 'a' and 'b'
+    // objects.  This function provides the no-throw exception-safety guarantee
+    // if the two objects were created with the same allocator and the basic
+    // guarantee otherwise.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                         // -------------------------
+                         // struct BTreeMultiSet_EntryUtil
+                         // -------------------------
+
+// CLASS METHODS
+template <class ENTRY>
+template <class KEY_TYPE>
+inline
+void BTreeMultiSet_EntryUtil<ENTRY>::construct(
+                        ENTRY                                       *entry,
+                        bslma::Allocator                            *allocator,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    bslma::ConstructionUtil::construct(
+                                 entry,
+                                 allocator,
+                                 BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key));
+}
+
+template <class ENTRY>
+inline
+const ENTRY& BTreeMultiSet_EntryUtil<ENTRY>::key(const ENTRY& entry)
+{
+    return entry;
+}
+
+                              // --------------
+                              // class BTreeMultiSet
+                              // --------------
+
+// CREATORS
+template <class KEY, class COMPARATOR>
+inline
+BTreeMultiSet<KEY, COMPARATOR>::BTreeMultiSet()
+: d_impl(COMPARATOR())
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeMultiSet<KEY, COMPARATOR>::BTreeMultiSet(
+                                              bslma::Allocator *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeMultiSet<KEY, COMPARATOR>::BTreeMultiSet(
+                                            const COMPARATOR&  comparator,
+                                            bslma::Allocator  *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+BTreeMultiSet<KEY, COMPARATOR>::BTreeMultiSet(
+                                          INPUT_ITERATOR    first,
+                                          INPUT_ITERATOR    last,
+                                          bslma::Allocator *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+BTreeMultiSet<KEY, COMPARATOR>::BTreeMultiSet(
+                                         INPUT_ITERATOR     first,
+                                         INPUT_ITERATOR     last,
+                                         const COMPARATOR&  comparator,
+                                         bslma::Allocator  *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+    insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR>
+inline
+BTreeMultiSet<KEY, COMPARATOR>::BTreeMultiSet(
+                             bsl::initializer_list<value_type>  values,
+                             bslma::Allocator                  *basicAllocator)
+: BTreeMultiSet(values.begin(), values.end(), COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeMultiSet<KEY, COMPARATOR>::BTreeMultiSet(
+                             bsl::initializer_list<value_type>  values,
+                             const COMPARATOR&                  comparator,
+                             bslma::Allocator                  *basicAllocator)
+: BTreeMultiSet(values.begin(), values.end(), comparator, basicAllocator)
+{
+}
+#endif
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeMultiSet<KEY, COMPARATOR>::BTreeMultiSet(
+                                      const BTreeMultiSet&  original,
+                                      bslma::Allocator     *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeMultiSet<KEY, COMPARATOR>::BTreeMultiSet(
+                                     bslmf::MovableRef<BTreeMultiSet> original)
+: d_impl(bslmf::MovableRefUtil::move(
+                               bslmf::MovableRefUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeMultiSet<KEY, COMPARATOR>::BTreeMultiSet(
+                            bslmf::MovableRef<BTreeMultiSet>  original,
+                            bslma::Allocator                 *basicAllocator)
+: d_impl(bslmf::MovableRefUtil::move(
+                               bslmf::MovableRefUtil::access(original).d_impl),
+         basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeMultiSet<KEY, COMPARATOR>::~BTreeMultiSet()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR>
+inline
+BTreeMultiSet<KEY, COMPARATOR>&
+BTreeMultiSet<KEY, COMPARATOR>::operator=(const BTreeMultiSet& rhs)
+{
+    d_impl = rhs.d_impl;
+
+    return *this;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeMultiSet<KEY, COMPARATOR>&
+BTreeMultiSet<KEY, COMPARATOR>::operator=(
+                                          bslmf::MovableRef<BTreeMultiSet> rhs)
+{
+    BTreeMultiSet& lvalue = rhs;
+
+    d_impl = bslmf::MovableRefUtil::move(lvalue.d_impl);
+
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR>
+inline
+BTreeMultiSet<KEY, COMPARATOR>&
+BTreeMultiSet<KEY, COMPARATOR>::operator=(
+                                      bsl::initializer_list<value_type> values)
+{
+    BTreeMultiSet tmp(values.begin(),
+                      values.end(),
+                      d_impl.comparator(),
+                      d_impl.allocator());
+
+    this->swap(tmp);
+
+    return *this;
+}
+#endif
+
+template <class KEY, class COMPARATOR>
+inline
+void BTreeMultiSet<KEY, COMPARATOR>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::pair<typename BTreeMultiSet<KEY, COMPARATOR>::iterator,
+          typename BTreeMultiSet<KEY, COMPARATOR>::iterator>
+BTreeMultiSet<KEY, COMPARATOR>::equal_range(const KEY& key)
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t BTreeMultiSet<KEY, COMPARATOR>::erase(const KEY& key)
+{
+    return d_impl.eraseKey(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeMultiSet<KEY, COMPARATOR>::iterator
+BTreeMultiSet<KEY, COMPARATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeMultiSet<KEY, COMPARATOR>::iterator
+BTreeMultiSet<KEY, COMPARATOR>::erase(const_iterator first,
+                                        const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeMultiSet<KEY, COMPARATOR>::iterator
+BTreeMultiSet<KEY, COMPARATOR>::find(const KEY& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+void BTreeMultiSet<KEY, COMPARATOR>::insert(INPUT_ITERATOR first,
+                                              INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        d_impl.insertMulti(*first);
+    }
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR>
+inline
+void BTreeMultiSet<KEY, COMPARATOR>::insert(
+                                      bsl::initializer_list<value_type> values)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class KEY, class COMPARATOR>
+template <class... ARGS>
+inline
+typename BTreeMultiSet<KEY, COMPARATOR>::iterator
+BTreeMultiSet<KEY, COMPARATOR>::emplace(ARGS&&... args)
+{
+    return d_impl.emplaceMulti(BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+}
+#endif
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeMultiSet<KEY, COMPARATOR>::iterator
+BTreeMultiSet<KEY, COMPARATOR>::lower_bound(const KEY& key)
+{
+    return d_impl.lower_bound(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeMultiSet<KEY, COMPARATOR>::iterator
+BTreeMultiSet<KEY, COMPARATOR>::upper_bound(const KEY& key)
+{
+    return d_impl.upper_bound(key);
+}
+
+                          // Iterators
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeMultiSet<KEY, COMPARATOR>::iterator
+BTreeMultiSet<KEY, COMPARATOR>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeMultiSet<KEY, COMPARATOR>::iterator
+BTreeMultiSet<KEY, COMPARATOR>::end()
+{
+    return d_impl.end();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeMultiSet<KEY, COMPARATOR>::reverse_iterator
+BTreeMultiSet<KEY, COMPARATOR>::rbegin()
+{
+    return reverse_iterator(d_impl.end());
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeMultiSet<KEY, COMPARATOR>::reverse_iterator
+BTreeMultiSet<KEY, COMPARATOR>::rend()
+{
+    return reverse_iterator(d_impl.begin());
+}
+
+                             // Aspects
+
+template <class KEY, class COMPARATOR>
+inline
+void BTreeMultiSet<KEY, COMPARATOR>::swap(BTreeMultiSet& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR>
+inline
+bool BTreeMultiSet<KEY, COMPARATOR>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t BTreeMultiSet<KEY, COMPARATOR>::count(const KEY& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool BTreeMultiSet<KEY, COMPARATOR>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::pair<typename BTreeMultiSet<KEY, COMPARATOR>::const_iterator,
+          typename BTreeMultiSet<KEY, COMPARATOR>::const_iterator>
+BTreeMultiSet<KEY, COMPARATOR>::equal_range(const KEY& key) const
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeMultiSet<KEY, COMPARATOR>::const_iterator
+BTreeMultiSet<KEY, COMPARATOR>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+COMPARATOR BTreeMultiSet<KEY, COMPARATOR>::key_comp() const
+{
+    return d_impl.comparator();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeMultiSet<KEY, COMPARATOR>::const_iterator
+BTreeMultiSet<KEY, COMPARATOR>::lower_bound(const KEY& key) const
+{
+    return d_impl.lower_bound(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t BTreeMultiSet<KEY, COMPARATOR>::size() const
+{
+    return d_impl.size();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeMultiSet<KEY, COMPARATOR>::const_iterator
+BTreeMultiSet<KEY, COMPARATOR>::upper_bound(const KEY& key) const
+{
+    return d_impl.upper_bound(key);
+}
+
+                          // Iterators
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeMultiSet<KEY, COMPARATOR>::const_iterator
+BTreeMultiSet<KEY, COMPARATOR>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeMultiSet<KEY, COMPARATOR>::const_iterator
+BTreeMultiSet<KEY, COMPARATOR>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeMultiSet<KEY, COMPARATOR>::const_iterator
+BTreeMultiSet<KEY, COMPARATOR>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeMultiSet<KEY, COMPARATOR>::const_iterator
+BTreeMultiSet<KEY, COMPARATOR>::cend() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeMultiSet<KEY, COMPARATOR>::const_reverse_iterator
+BTreeMultiSet<KEY, COMPARATOR>::rbegin() const
+{
+    return const_reverse_iterator(d_impl.end());
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeMultiSet<KEY, COMPARATOR>::const_reverse_iterator
+BTreeMultiSet<KEY, COMPARATOR>::crbegin() const
+{
+    return const_reverse_iterator(d_impl.end());
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeMultiSet<KEY, COMPARATOR>::const_reverse_iterator
+BTreeMultiSet<KEY, COMPARATOR>::rend() const
+{
+    return const_reverse_iterator(d_impl.begin());
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeMultiSet<KEY, COMPARATOR>::const_reverse_iterator
+BTreeMultiSet<KEY, COMPARATOR>::crend() const
+{
+    return const_reverse_iterator(d_impl.begin());
+}
+
+                           // Aspects
+
+template <class KEY, class COMPARATOR>
+inline
+bslma::Allocator *BTreeMultiSet<KEY, COMPARATOR>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+template <class KEY, class COMPARATOR>
+bsl::ostream& BTreeMultiSet<KEY, COMPARATOR>::print(
+                                            bsl::ostream& stream,
+                                            int           level,
+                                            int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;                                                // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+
+    printer.start();
+
+    const_iterator iter = begin();
+    while (iter != end()) {
+        printer.printValue(*iter);
+        ++iter;
+    }
+
+    printer.end();
+
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR>
+inline
+bool bdlc::operator==(const BTreeMultiSet<KEY, COMPARATOR>& lhs,
+                      const BTreeMultiSet<KEY, COMPARATOR>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool bdlc::operator!=(const BTreeMultiSet<KEY, COMPARATOR>& lhs,
+                      const BTreeMultiSet<KEY, COMPARATOR>& rhs)
+{
+    return lhs.d_impl != rhs.d_impl;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool bdlc::operator<(const BTreeMultiSet<KEY, COMPARATOR>& lhs,
+                     const BTreeMultiSet<KEY, COMPARATOR>& rhs)
+{
+    return bsl::lexicographical_compare(lhs.begin(),
+                                        lhs.end(),
+                                        rhs.begin(),
+                                        rhs.end());
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::ostream& bdlc::operator<<(bsl::ostream&                           stream,
+                               const BTreeMultiSet<KEY, COMPARATOR>& set)
+{
+    return set.print(stream, 0, -1);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR>
+inline
+void bdlc::swap(BTreeMultiSet<KEY, COMPARATOR>& a,
+                BTreeMultiSet<KEY, COMPARATOR>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    typedef BTreeMultiSet<KEY, COMPARATOR> Map;
+
+    Map futureA(b, a.allocator());
+    Map futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslalg {
+
+template <class KEY, class COMPARATOR>
+struct HasStlIterators<bdlc::BTreeMultiSet<KEY, COMPARATOR> >
+: bsl::true_type {
+};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class COMPARATOR>
+struct UsesBslmaAllocator<bdlc::BTreeMultiSet<KEY, COMPARATOR> >
+: bsl::true_type {
+};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
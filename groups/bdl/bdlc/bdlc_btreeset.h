@@ -0,0 +1,1196 @@
+// bdlc_btreeset.h                                                    -*-C++-*-
+#ifndef INCLUDED_BDLC_BTREESET
+#define INCLUDED_BDLC_BTREESET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered set container implemented as a B-tree.
+//
+//@CLASSES:
+//   bdlc::BTreeSet: B-tree based ordered set container
+//
+//@SEE_ALSO: bdlc_btree, bdlc_btreemultiset, bdlc_btreemap, bsl_set
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::BTreeSet', that implements an ordered set of unique keys, stored in a
+// B-tree (see 'bdlc_btree').
+//
+// An instantiation of 'bdlc::BTreeSet' is an allocator-aware, value-semantic
+// type whose salient attributes are its size (number of keys) and the ordered
+// sequence of keys the set contains.  An instantiation may be provided with a
+// custom key-comparison functor, but that functor is not a salient attribute.
+// In particular, when comparing element values for equality between two
+// different 'bdlc::BTreeSet' objects, the elements are compared using
+// 'operator=='.
+//
+// 'bdlc::BTreeSet' offers the same ordered-set operations as 'bsl::set', with
+// the same logarithmic complexity, but stores many keys in each node of its
+// tree rather than one.  Lookups therefore touch far fewer cache lines,
+// in-order iteration walks mostly contiguous memory, and the per-element
+// memory overhead is a small fraction of that of 'bsl::set'.  See
+// 'bdlc_btreemap' for a discussion of the performance characteristics.
+//
+///Interface Differences with 'bsl::set'
+///-------------------------------------
+// A 'bdlc::BTreeSet' meets most of the requirements of an ordered associative
+// container with bidirectional iterators in the C++11 Standard [23.2.4].
+// However, elements are *moved* within and between the nodes of the tree as
+// the container is modified, so:
+//
+//: o Every insertion or erasure invalidates all iterators, pointers, and
+//:   references to the elements of the set (unlike 'bsl::set', where only
+//:   references to an erased element are invalidated).
+//:
+//: o The (template parameter) type 'KEY' must be move-assignable as well as
+//:   move-constructible.
+//
+// Allocator use follows BDE style, and the various allocator propagation
+// attributes are not present.
+//
+///Requirements on 'KEY' and 'COMPARATOR'
+///--------------------------------------
+// The (template parameter) type 'KEY' must be move-constructible and
+// move-assignable.  The (template parameter) type 'COMPARATOR' must be a
+// copy-constructible functor defining a strict weak ordering on 'KEY' values;
+// 'COMPARATOR' must also be default-constructible if a constructor not taking
+// a comparator is used.
+//
+///Exception Safety
+///----------------
+// A 'bdlc::BTreeSet' is exception neutral, and all of the methods of
+// 'bdlc::BTreeSet' provide the basic exception safety guarantee (see
+// {'bsldoc_glossary'|Basic Guarantee}).
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Finding Free Identifiers
+///- - - - - - - - - - - - - - - - - -
+// Suppose we hand out integer identifiers that are returned to a pool when
+// released, and we must always reuse the smallest available identifier.
+//
+// First, we create an (empty) set of available identifiers and populate it:
+//..
+//  bdlc::BTreeSet<int> available;
+//
+//  for (int id = 0; id < 1000; ++id) {
+//      available.insert(id);
+//  }
+//  assert(1000 == available.size());
+//..
+// Then, we hand out the three smallest identifiers:
+//..
+//  for (int i = 0; i < 3; ++i) {
+//      available.erase(available.begin());
+//  }
+//  assert(3 == *available.begin());
+//..
+// Next, identifier 1 is released, and becomes the smallest available:
+//..
+//  assert(true == available.insert(1).second);
+//  assert(1    == *available.begin());
+//..
+// Finally, we count the available identifiers in the range '[100 .. 200)':
+//..
+//  assert(100 == bsl::distance(available.lower_bound(100),
+//                              available.lower_bound(200)));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_btree.h>
+
+#include <bslalg_hasstliterators.h>
+#include <bslalg_swaputil.h>
+
+#include <bslim_printer.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_destructorguard.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_movableref.h>
+#include <bslmf_util.h>    // 'forward(V)'
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_util.h>     // 'forward<T>(V)'
+
+#include <bslstl_iterator.h>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <bsl_initializer_list.h>
+#endif
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_ostream.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+// FORWARD DECLARATIONS
+template <class KEY, class COMPARATOR = bsl::less<KEY> >
+class BTreeSet;
+
+template <class KEY, class COMPARATOR>
+bool operator==(const BTreeSet<KEY, COMPARATOR>& lhs,
+                const BTreeSet<KEY, COMPARATOR>& rhs);
+
+template <class KEY, class COMPARATOR>
+bool operator!=(const BTreeSet<KEY, COMPARATOR>& lhs,
+                const BTreeSet<KEY, COMPARATOR>& rhs);
+
+template <class KEY, class COMPARATOR>
+void swap(BTreeSet<KEY, COMPARATOR>& a,
+          BTreeSet<KEY, COMPARATOR>& b);
+
+                         // =========================
+                         // struct BTreeSet_EntryUtil
+                         // =========================
+
+template <class ENTRY>
+struct BTreeSet_EntryUtil
+    // This templated utility provides methods to construct an 'ENTRY' and a
+    // method to extract the key from an 'ENTRY' (which is, identically, the
+    // 'ENTRY').
+{
+    // CLASS METHODS
+    template <class KEY_TYPE>
+    static void construct(
+                        ENTRY                                       *entry,
+                        bslma::Allocator                            *allocator,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key);
+        // Load into the specified 'entry' the 'ENTRY' value constructed from
+        // the specified 'key', using the specified 'allocator' to supply
+        // memory.  'allocator' is ignored if the (template parameter) type
+        // 'ENTRY' is not allocator aware.
+
+    static const ENTRY& key(const ENTRY& entry);
+        // Return the specified 'entry'.
+};
+
+                              // ==============
+                              // class BTreeSet
+                              // ==============
+
+template <class KEY, class COMPARATOR>
+class BTreeSet {
+    // This class template implements a value-semantic container type holding
+    // an ordered set of unique keys of (template parameter) type 'KEY'.  The
+    // (template parameter) type 'COMPARATOR' is a functor defining the order
+    // of 'KEY' values.  See {Requirements on 'KEY' and 'COMPARATOR'} for more
+    // information.
+
+  private:
+    // PRIVATE TYPES
+    typedef BTree<KEY, KEY, BTreeSet_EntryUtil<KEY>, COMPARATOR> ImplType;
+        // This is the underlying implementation class.
+
+    // FRIENDS
+    friend bool operator==<>(const BTreeSet&, const BTreeSet&);
+    friend bool operator!=<>(const BTreeSet&, const BTreeSet&);
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                    key_type;
+    typedef KEY                                    value_type;
+    typedef bsl::size_t                            size_type;
+    typedef bsl::ptrdiff_t                         difference_type;
+    typedef COMPARATOR                             key_compare;
+    typedef COMPARATOR                             value_compare;
+    typedef value_type&                            reference;
+    typedef const value_type&                      const_reference;
+    typedef typename ImplType::const_iterator      iterator;
+    typedef typename ImplType::const_iterator      const_iterator;
+    typedef bsl::reverse_iterator<iterator>        reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>  const_reverse_iterator;
+
+  private:
+    // DATA
+    ImplType d_impl;  // underlying B-tree used by this set
+
+  public:
+    // CREATORS
+    BTreeSet();
+    explicit BTreeSet(bslma::Allocator *basicAllocator);
+    explicit BTreeSet(const COMPARATOR&  comparator,
+                      bslma::Allocator  *basicAllocator = 0);
+        // Create an empty 'BTreeSet' object.  Optionally specify a
+        // 'comparator' used to order the keys of elements in this container.
+        // If 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied or is 0, the currently installed default allocator is
+        // used.  No memory is allocated.
+
+    template <class INPUT_ITERATOR>
+    BTreeSet(INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    BTreeSet(INPUT_ITERATOR     first,
+             INPUT_ITERATOR     last,
+             const COMPARATOR&  comparator,
+             bslma::Allocator  *basicAllocator = 0);
+        // Create a 'BTreeSet' object initialized by insertion of the values
+        // from the input iterator range specified by 'first' through 'last'
+        // (including 'first', excluding 'last').  Optionally specify a
+        // 'comparator' used to order the keys of elements in this container.
+        // If 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied or is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'first' and 'last' refer to
+        // a sequence of valid values where 'first' is at a position at or
+        // before 'last'.  Note that if a member of the input sequence has an
+        // equivalent key to an earlier member, the later member will not be
+        // inserted.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    BTreeSet(bsl::initializer_list<value_type>  values,
+             bslma::Allocator                  *basicAllocator = 0);
+    BTreeSet(bsl::initializer_list<value_type>  values,
+             const COMPARATOR&                  comparator,
+             bslma::Allocator                  *basicAllocator = 0);
+        // Create a 'BTreeSet' object initialized by insertion of the specified
+        // 'values'.  Optionally specify a 'comparator' used to order the keys
+        // of elements in this container.  If 'comparator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'COMPARATOR' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not supplied or is 0, the
+        // currently installed default allocator is used.  Note that if a
+        // member of 'values' has an equivalent key to an earlier member, the
+        // later member will not be inserted.
+#endif
+
+    BTreeSet(const BTreeSet& original, bslma::Allocator *basicAllocator = 0);
+        // Create a 'BTreeSet' object having the same value and comparator as
+        // the specified 'original' object.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // specified or is 0, the currently installed default allocator is
+        // used.
+
+    BTreeSet(bslmf::MovableRef<BTreeSet> original);
+        // Create a 'BTreeSet' object having the same value, comparator, and
+        // allocator as the specified 'original' object.  The contents of
+        // 'original' are moved (in constant time) to this object, 'original'
+        // is left in a (valid) unspecified state, and no exceptions will be
+        // thrown.
+
+    BTreeSet(bslmf::MovableRef<BTreeSet>  original,
+             bslma::Allocator            *basicAllocator);
+        // Create a 'BTreeSet' object having the same value and comparator as
+        // the specified 'original' object, using the specified
+        // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  The allocator of
+        // 'original' remains unchanged.  If 'original' and the newly created
+        // object have the same allocator then the contents of 'original' are
+        // moved (in constant time) to this object, 'original' is left in a
+        // (valid) unspecified state, and no exceptions will be thrown;
+        // otherwise, the elements of 'original' are moved, 'original' is left
+        // in a (valid) unspecified state, and an exception may be thrown.
+
+    ~BTreeSet();
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    BTreeSet& operator=(const BTreeSet& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.
+
+    BTreeSet& operator=(bslmf::MovableRef<BTreeSet> rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  If this object and 'rhs' use the same allocator the
+        // contents of 'rhs' are moved (in constant time) to this object.
+        // 'rhs' is left in a (valid) unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    BTreeSet& operator=(bsl::initializer_list<value_type> values);
+        // Assign to this object the value resulting from first clearing this
+        // set and then inserting each object in the specified 'values'
+        // initializer list, ignoring those objects having a value whose key is
+        // equivalent to that which appears earlier in the list; return a
+        // reference providing modifiable access to this object.
+#endif
+
+    void clear();
+        // Remove all elements from this set and release all memory from this
+        // set.
+
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        // Return a pair of iterators defining the sequence of modifiable
+        // elements in this set having the specified 'key', where the first
+        // iterator is positioned at the start of the sequence and the second
+        // iterator is positioned one past the end of the sequence.  If this
+        // set contains no elements having a key equivalent to 'key', then the
+        // two returned iterators will have the same value.  Note that since a
+        // set maintains unique keys, the range will contain at most one
+        // element.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove from this set the element whose key is equivalent to the
+        // specified 'key', if it exists, and return 1; otherwise (there is no
+        // element having 'key' in this set), return 0 with no other effect.
+        // This method invalidates all iterators and references to the elements
+        // of this set.
+
+    iterator erase(const_iterator position);
+        // Remove from this set the element at the specified 'position', and
+        // return an iterator referring to the element immediately following
+        // the removed element, or to the past-the-end position if the removed
+        // element was the last element in the sequence of elements maintained
+        // by this set.  This method invalidates all iterators and references
+        // to the elements of this set.  The behavior is undefined unless
+        // 'position' refers to an element in this set.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this set the elements starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and return an iterator referencing the same element as 'last'.  This
+        // method invalidates all iterators and references to the elements of
+        // this set.  The behavior is undefined unless 'first' and 'last' are
+        // valid iterators on this set, and the 'first' position is at or
+        // before the 'last' position in the ordered sequence of elements of
+        // this container.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the element in this set having the
+        // specified 'key', or 'end()' if no such entry exists in this set.
+
+    template <class VALUE_TYPE>
+    typename bsl::enable_if<bsl::is_convertible<VALUE_TYPE, value_type>::value,
+                            bsl::pair<iterator, bool> >::type
+                    insert(BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value)
+        // Insert the specified 'value' into this set if 'value' does not
+        // already exist in this set; otherwise, this method has no effect.
+        // Return a 'pair' whose 'first' member is an iterator referring to the
+        // (possibly newly inserted) element in this set whose key is
+        // equivalent to that of the element to be inserted, and whose 'second'
+        // member is 'true' if a new element was inserted, and 'false' if an
+        // element with an equivalent key was already present.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        return d_impl.insertUnique(
+                             BSLS_COMPILERFEATURES_FORWARD(VALUE_TYPE, value));
+    }
+
+    template <class VALUE_TYPE>
+    typename bsl::enable_if<bsl::is_convertible<VALUE_TYPE, value_type>::value,
+                            iterator>::type
+                    insert(const_iterator                                ,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value)
+        // Insert the specified 'value' into this set if 'value' does not
+        // already exist in this set; otherwise, this method has no effect.
+        // Return an iterator referring to the (possibly newly inserted)
+        // element in this set whose key is equivalent to that of the element
+        // to be inserted.  The supplied 'const_iterator' is ignored.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        return d_impl.insertUnique(
+                       BSLS_COMPILERFEATURES_FORWARD(VALUE_TYPE, value)).first;
+    }
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set the value of each element in the input iterator
+        // range specified by 'first' through 'last' (including 'first',
+        // excluding 'last').  The behavior is undefined unless 'first' and
+        // 'last' refer to a sequence of valid values where 'first' is at a
+        // position at or before 'last'.  Note that if the key of a member of
+        // the input sequence is equivalent to the key of an earlier member,
+        // the later member will not be inserted.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(bsl::initializer_list<value_type> values);
+        // Insert into this set an element having the value of each object in
+        // the specified 'values' initializer list if a value with an
+        // equivalent key is not already contained in this set.
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... ARGS>
+    bsl::pair<iterator, bool> emplace(ARGS&&... args);
+        // Insert into this set a newly-created element constructed by
+        // forwarding this set's allocator and the specified 'args' to the
+        // constructor of 'KEY', if no element having an equivalent key is
+        // already present.  Return a 'pair' whose 'first' member is an
+        // iterator referring to the (possibly newly inserted) element having
+        // an equivalent key, and whose 'second' member is 'true' if a new
+        // element was inserted.
+#endif
+
+    iterator lower_bound(const KEY& key);
+        // Return an iterator referring to the first element in this set whose
+        // key is not ordered before the specified 'key', or 'end()' if no such
+        // element exists.
+
+    iterator upper_bound(const KEY& key);
+        // Return an iterator referring to the first element in this set whose
+        // key is ordered after the specified 'key', or 'end()' if no such
+        // element exists.
+
+                          // Iterators
+
+    iterator begin();
+        // Return an iterator to the first element in the ordered sequence of
+        // elements maintained by this set, or the 'end' iterator if this set
+        // is empty.
+
+    iterator end();
+        // Return an iterator to the past-the-end element in the ordered
+        // sequence of elements maintained by this set.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator to the last element in the ordered
+        // sequence of elements maintained by this set, or 'rend()' if this set
+        // is empty.
+
+    reverse_iterator rend();
+        // Return a reverse iterator to the prior-to-the-beginning element in
+        // the ordered sequence of elements maintained by this set.
+
+                             // Aspects
+
+    void swap(BTreeSet& other);
+        // Exchange the value of this object as well as its comparator with
+        // those of the specified 'other' object.  The behavior is undefined
+        // unless this object was created with the same allocator as 'other'.
+
+    // ACCESSORS
+    bool contains(const KEY& key) const;
+        // Return 'true' if this set contains an element having the specified
+        // 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements in this set having the specified
+        // 'key'.  Note that since a set maintains unique keys, the returned
+        // value will be either 0 or 1.
+
+    bool empty() const;
+        // Return 'true' if this set contains no elements, and 'false'
+        // otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                         const KEY& key) const;
+        // Return a pair of 'const_iterator's defining the sequence of elements
+        // in this set having the specified 'key', where the first iterator is
+        // positioned at the start of the sequence and the second iterator is
+        // positioned one past the end of the sequence.  If this set contains
+        // no elements having a key equivalent to 'key', then the two returned
+        // iterators will have the same value.  Note that since a set maintains
+        // unique keys, the range will contain at most one element.
+
+    const_iterator find(const KEY& key) const;
+        // Return a 'const_iterator' referring to the element in this set
+        // having the specified 'key', or 'end()' if no such entry exists in
+        // this set.
+
+    COMPARATOR key_comp() const;
+        // Return (a copy of) the key-comparison functor used by this set to
+        // order its elements.
+
+    const_iterator lower_bound(const KEY& key) const;
+        // Return a 'const_iterator' referring to the first element in this set
+        // whose key is not ordered before the specified 'key', or 'end()' if
+        // no such element exists.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this set.
+
+    const_iterator upper_bound(const KEY& key) const;
+        // Return a 'const_iterator' referring to the first element in this set
+        // whose key is ordered after the specified 'key', or 'end()' if no
+        // such element exists.
+
+                          // Iterators
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return a 'const_iterator' to the first element in the ordered
+        // sequence of elements maintained by this set, or the 'end' iterator
+        // if this set is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return a 'const_iterator' to the past-the-end element in the ordered
+        // sequence of elements maintained by this set.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse 'const_iterator' to the last element in the ordered
+        // sequence of elements maintained by this set, or 'rend()' if this set
+        // is empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return a reverse 'const_iterator' to the prior-to-the-beginning
+        // element in the ordered sequence of elements maintained by this set.
+
+                           // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this set to supply memory.
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level = 0,
+                        int           spacesPerLevel = 4) const;
+        // Format this object to the specified output 'stream' at the (absolute
+        // value of) the optionally specified indentation 'level', and return a
+        // reference to the modifiable 'stream'.  If 'level' is specified,
+        // optionally specify 'spacesPerLevel', the number of spaces per
+        // indentation level for this and all of its nested objects.  If
+        // 'level' is negative, suppress indentation of the first line.  If
+        // 'spacesPerLevel' is negative, format the entire output on one line,
+        // suppressing all but the initial indentation (as governed by
+        // 'level').  If 'stream' is not valid on entry, this operation has no
+        // effect.
+};
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR>
+bool operator==(const BTreeSet<KEY, COMPARATOR>& lhs,
+                const BTreeSet<KEY, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'BTreeSet' objects have the same
+    // value if they have the same number of elements, and each element in the
+    // ordered sequence of elements of 'lhs' is equal to the element at the
+    // corresponding position in 'rhs'.  The comparators are not involved in
+    // the comparison.
+
+template <class KEY, class COMPARATOR>
+bool operator!=(const BTreeSet<KEY, COMPARATOR>& lhs,
+                const BTreeSet<KEY, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'BTreeSet' objects do not have
+    // the same value if they do not have the same number of elements, or some
+    // element in the ordered sequence of elements of 'lhs' is not equal to the
+    // element at the corresponding position in 'rhs'.
+
+template <class KEY, class COMPARATOR>
+bool operator<(const BTreeSet<KEY, COMPARATOR>& lhs,
+               const BTreeSet<KEY, COMPARATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically less than that of the specified 'rhs' set, and 'false'
+    // otherwise.  Elements are compared using 'operator<'.
+
+template <class KEY, class COMPARATOR>
+bsl::ostream& operator<<(bsl::ostream&                           stream,
+                         const BTreeSet<KEY, COMPARATOR>& set);
+    // Write the value of the specified 'set' to the specified output 'stream'
+    // in a single-line format, and return a reference providing modifiable
+    // access to 'stream'.  If 'stream' is not valid on entry, this operation
+    // has no effect.  Note that this human-readable format is not fully
+    // specified and can change without notice.
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR>
+void swap(BTreeSet<KEY, COMPARATOR>& a,
+          BTreeSet<KEY, COMPARATOR>& b);
+    // Exchange the value and the comparator of the specified 'a' and 'b'
+    // objects.  This function provides the no-throw exception-safety guarantee
+    // if the two objects were created with the same allocator and the basic
+    // guarantee otherwise.
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                         // -------------------------
+                         // struct BTreeSet_EntryUtil
+                         // -------------------------
+
+// CLASS METHODS
+template <class ENTRY>
+template <class KEY_TYPE>
+inline
+void BTreeSet_EntryUtil<ENTRY>::construct(
+                        ENTRY                                       *entry,
+                        bslma::Allocator                            *allocator,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    bslma::ConstructionUtil::construct(
+                                 entry,
+                                 allocator,
+                                 BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key));
+}
+
+template <class ENTRY>
+inline
+const ENTRY& BTreeSet_EntryUtil<ENTRY>::key(const ENTRY& entry)
+{
+    return entry;
+}
+
+                              // --------------
+                              // class BTreeSet
+                              // --------------
+
+// CREATORS
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::BTreeSet()
+: d_impl(COMPARATOR())
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::BTreeSet(bslma::Allocator *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::BTreeSet(
+                                            const COMPARATOR&  comparator,
+                                            bslma::Allocator  *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::BTreeSet(INPUT_ITERATOR    first,
+                                           INPUT_ITERATOR    last,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::BTreeSet(INPUT_ITERATOR     first,
+                                           INPUT_ITERATOR     last,
+                                           const COMPARATOR&  comparator,
+                                           bslma::Allocator  *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+    insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::BTreeSet(
+                             bsl::initializer_list<value_type>  values,
+                             bslma::Allocator                  *basicAllocator)
+: BTreeSet(values.begin(), values.end(), COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::BTreeSet(
+                             bsl::initializer_list<value_type>  values,
+                             const COMPARATOR&                  comparator,
+                             bslma::Allocator                  *basicAllocator)
+: BTreeSet(values.begin(), values.end(), comparator, basicAllocator)
+{
+}
+#endif
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::BTreeSet(const BTreeSet&   original,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::BTreeSet(
+                                          bslmf::MovableRef<BTreeSet> original)
+: d_impl(bslmf::MovableRefUtil::move(
+                               bslmf::MovableRefUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::BTreeSet(
+                                   bslmf::MovableRef<BTreeSet>  original,
+                                   bslma::Allocator            *basicAllocator)
+: d_impl(bslmf::MovableRefUtil::move(
+                               bslmf::MovableRefUtil::access(original).d_impl),
+         basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>::~BTreeSet()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>&
+BTreeSet<KEY, COMPARATOR>::operator=(const BTreeSet& rhs)
+{
+    d_impl = rhs.d_impl;
+
+    return *this;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>&
+BTreeSet<KEY, COMPARATOR>::operator=(bslmf::MovableRef<BTreeSet> rhs)
+{
+    BTreeSet& lvalue = rhs;
+
+    d_impl = bslmf::MovableRefUtil::move(lvalue.d_impl);
+
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR>
+inline
+BTreeSet<KEY, COMPARATOR>&
+BTreeSet<KEY, COMPARATOR>::operator=(
+                                      bsl::initializer_list<value_type> values)
+{
+    BTreeSet tmp(values.begin(),
+                 values.end(),
+                 d_impl.comparator(),
+                 d_impl.allocator());
+
+    this->swap(tmp);
+
+    return *this;
+}
+#endif
+
+template <class KEY, class COMPARATOR>
+inline
+void BTreeSet<KEY, COMPARATOR>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::pair<typename BTreeSet<KEY, COMPARATOR>::iterator,
+          typename BTreeSet<KEY, COMPARATOR>::iterator>
+BTreeSet<KEY, COMPARATOR>::equal_range(const KEY& key)
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t BTreeSet<KEY, COMPARATOR>::erase(const KEY& key)
+{
+    return d_impl.eraseKey(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::iterator
+BTreeSet<KEY, COMPARATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::iterator
+BTreeSet<KEY, COMPARATOR>::erase(const_iterator first,
+                                        const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::iterator
+BTreeSet<KEY, COMPARATOR>::find(const KEY& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+void BTreeSet<KEY, COMPARATOR>::insert(INPUT_ITERATOR first,
+                                              INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        d_impl.insertUnique(*first);
+    }
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR>
+inline
+void BTreeSet<KEY, COMPARATOR>::insert(
+                                      bsl::initializer_list<value_type> values)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class KEY, class COMPARATOR>
+template <class... ARGS>
+inline
+bsl::pair<typename BTreeSet<KEY, COMPARATOR>::iterator, bool>
+BTreeSet<KEY, COMPARATOR>::emplace(ARGS&&... args)
+{
+    return d_impl.emplaceUnique(BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+}
+#endif
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::iterator
+BTreeSet<KEY, COMPARATOR>::lower_bound(const KEY& key)
+{
+    return d_impl.lower_bound(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::iterator
+BTreeSet<KEY, COMPARATOR>::upper_bound(const KEY& key)
+{
+    return d_impl.upper_bound(key);
+}
+
+                          // Iterators
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::iterator
+BTreeSet<KEY, COMPARATOR>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::iterator
+BTreeSet<KEY, COMPARATOR>::end()
+{
+    return d_impl.end();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::reverse_iterator
+BTreeSet<KEY, COMPARATOR>::rbegin()
+{
+    return reverse_iterator(d_impl.end());
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::reverse_iterator
+BTreeSet<KEY, COMPARATOR>::rend()
+{
+    return reverse_iterator(d_impl.begin());
+}
+
+                             // Aspects
+
+template <class KEY, class COMPARATOR>
+inline
+void BTreeSet<KEY, COMPARATOR>::swap(BTreeSet& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR>
+inline
+bool BTreeSet<KEY, COMPARATOR>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t BTreeSet<KEY, COMPARATOR>::count(const KEY& key) const
+{
+    return d_impl.contains(key) ? 1 : 0;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool BTreeSet<KEY, COMPARATOR>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::pair<typename BTreeSet<KEY, COMPARATOR>::const_iterator,
+          typename BTreeSet<KEY, COMPARATOR>::const_iterator>
+BTreeSet<KEY, COMPARATOR>::equal_range(const KEY& key) const
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_iterator
+BTreeSet<KEY, COMPARATOR>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+COMPARATOR BTreeSet<KEY, COMPARATOR>::key_comp() const
+{
+    return d_impl.comparator();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_iterator
+BTreeSet<KEY, COMPARATOR>::lower_bound(const KEY& key) const
+{
+    return d_impl.lower_bound(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t BTreeSet<KEY, COMPARATOR>::size() const
+{
+    return d_impl.size();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_iterator
+BTreeSet<KEY, COMPARATOR>::upper_bound(const KEY& key) const
+{
+    return d_impl.upper_bound(key);
+}
+
+                          // Iterators
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_iterator
+BTreeSet<KEY, COMPARATOR>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_iterator
+BTreeSet<KEY, COMPARATOR>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_iterator
+BTreeSet<KEY, COMPARATOR>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_iterator
+BTreeSet<KEY, COMPARATOR>::cend() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_reverse_iterator
+BTreeSet<KEY, COMPARATOR>::rbegin() const
+{
+    return const_reverse_iterator(d_impl.end());
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_reverse_iterator
+BTreeSet<KEY, COMPARATOR>::crbegin() const
+{
+    return const_reverse_iterator(d_impl.end());
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_reverse_iterator
+BTreeSet<KEY, COMPARATOR>::rend() const
+{
+    return const_reverse_iterator(d_impl.begin());
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename BTreeSet<KEY, COMPARATOR>::const_reverse_iterator
+BTreeSet<KEY, COMPARATOR>::crend() const
+{
+    return const_reverse_iterator(d_impl.begin());
+}
+
+                           // Aspects
+
+template <class KEY, class COMPARATOR>
+inline
+bslma::Allocator *BTreeSet<KEY, COMPARATOR>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+template <class KEY, class COMPARATOR>
+bsl::ostream& BTreeSet<KEY, COMPARATOR>::print(
+                                            bsl::ostream& stream,
+                                            int           level,
+                                            int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;                                                // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+
+    printer.start();
+
+    const_iterator iter = begin();
+    while (iter != end()) {
+        printer.printValue(*iter);
+        ++iter;
+    }
+
+    printer.end();
+
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR>
+inline
+bool bdlc::operator==(const BTreeSet<KEY, COMPARATOR>& lhs,
+                      const BTreeSet<KEY, COMPARATOR>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool bdlc::operator!=(const BTreeSet<KEY, COMPARATOR>& lhs,
+                      const BTreeSet<KEY, COMPARATOR>& rhs)
+{
+    return lhs.d_impl != rhs.d_impl;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool bdlc::operator<(const BTreeSet<KEY, COMPARATOR>& lhs,
+                     const BTreeSet<KEY, COMPARATOR>& rhs)
+{
+    return bsl::lexicographical_compare(lhs.begin(),
+                                        lhs.end(),
+                                        rhs.begin(),
+                                        rhs.end());
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::ostream& bdlc::operator<<(bsl::ostream&                           stream,
+                               const BTreeSet<KEY, COMPARATOR>& set)
+{
+    return set.print(stream, 0, -1);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR>
+inline
+void bdlc::swap(BTreeSet<KEY, COMPARATOR>& a,
+                BTreeSet<KEY, COMPARATOR>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    typedef BTreeSet<KEY, COMPARATOR> Map;
+
+    Map futureA(b, a.allocator());
+    Map futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslalg {
+
+template <class KEY, class COMPARATOR>
+struct HasStlIterators<bdlc::BTreeSet<KEY, COMPARATOR> >
+: bsl::true_type {
+};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class COMPARATOR>
+struct UsesBslmaAllocator<bdlc::BTreeSet<KEY, COMPARATOR> >
+: bsl::true_type {
+};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
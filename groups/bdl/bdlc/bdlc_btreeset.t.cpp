@@ -0,0 +1,599 @@
+// bdlc_btreeset.t.cpp                                                -*-C++-*-
+
+#include <bdlc_btreeset.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_set.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines an ordered set implemented with a
+// B-tree.  The implementation object, 'bdlc::BTree', is thoroughly tested in
+// 'bdlc_btree.t.cpp', and the interface of this component closely follows
+// that of 'bdlc::BTreeMap' (see 'bdlc_btreemap.t.cpp'), so this test driver
+// concentrates on the correct forwarding to the implementation object by
+// comparing the behavior of 'bdlc::BTreeSet' against that of
+// 'bsl::set' over randomized sequences of operations.
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//: o Any allocated memory is always from the object allocator.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] BTreeSet(bslma::Allocator *basicAllocator);
+// [ 3] BTreeSet(II, II, bslma::Allocator * = 0);
+// [ 3] BTreeSet(const BTreeSet&, bslma::Allocator *bA = 0);
+// [ 3] BTreeSet(MovableRef<BTreeSet>);
+// [ 3] BTreeSet(MovableRef<BTreeSet>, bslma::Allocator *);
+// [ 2] ~BTreeSet();
+//
+// MANIPULATORS
+// [ 3] BTreeSet& operator=(const BTreeSet&);
+// [ 3] BTreeSet& operator=(MovableRef<BTreeSet>);
+// [ 2] void clear();
+// [ 2] pair<iterator, iterator> equal_range(const KEY& key);
+// [ 2] size_t erase(const KEY& key);
+// [ 2] iterator erase(const_iterator position);
+// [ 2] iterator erase(const_iterator first, const_iterator last);
+// [ 2] iterator find(const KEY& key);
+// [ 2] pair<iterator, bool> insert(FORWARD_REF(VALUE_TYPE) value);
+// [ 2] iterator lower_bound(const KEY& key);
+// [ 2] iterator upper_bound(const KEY& key);
+// [ 3] void swap(BTreeSet& other);
+//
+// ACCESSORS
+// [ 2] bool contains(const KEY& key) const;
+// [ 2] size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 2] size_t size() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_reverse_iterator rbegin() const;
+// [ 2] const_reverse_iterator rend() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const BTreeSet&, const BTreeSet&);
+// [ 3] bool operator!=(const BTreeSet&, const BTreeSet&);
+// [ 3] bool operator<(const BTreeSet&, const BTreeSet&);
+// [ 3] ostream& operator<<(ostream& stream, const BTreeSet& set);
+// ----------------------------------------------------------------------------
+// [ 4] USAGE EXAMPLE
+// [ 1] BREATHING TEST
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT  BSLIM_TESTUTIL_ASSERT
+#define ASSERTV BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q  BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P  BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_ BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_ BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_ BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool verbose;
+bool veryVerbose;
+bool veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::BTreeSet<bsl::string> Obj;
+typedef bsl::set<bsl::string>        Model;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool sameElement(const bsl::string& lhs, const bsl::string& rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same value, and
+    // 'false' otherwise.
+{
+    return lhs == rhs;
+}
+
+template <class CONTAINER, class MODEL>
+bool sameValue(const CONTAINER& container, const MODEL& model)
+    // Return 'true' if the specified 'container' holds the same sequence of
+    // elements as the specified 'model', and 'false' otherwise.
+{
+    if (container.size() != model.size()) {
+        return false;                                                 // RETURN
+    }
+
+    typename MODEL::const_iterator jt = model.begin();
+    for (typename CONTAINER::const_iterator it = container.begin();
+                                           it != container.end(); ++it, ++jt) {
+        if (!sameElement(*it, *jt)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+bsl::string makeString(int i, bslma::Allocator *basicAllocator)
+    // Return a string, that requires allocation, uniquely determined by the
+    // specified 'i', using the specified 'basicAllocator' to supply memory.
+    // Note that the strings for values of 'i' in '[0 .. 9999]' have the same
+    // relative order as the values.
+{
+    bsl::ostringstream oss(basicAllocator);
+    oss << "a string long enough to require allocation " << 10000 + i;
+    return bsl::string(oss.str(), basicAllocator);
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Finding Free Identifiers
+///- - - - - - - - - - - - - - - - - -
+// Suppose we hand out integer identifiers that are returned to a pool when
+// released, and we must always reuse the smallest available identifier.
+//
+// First, we create an (empty) set of available identifiers and populate it:
+//..
+    bdlc::BTreeSet<int> available;
+
+    for (int id = 0; id < 1000; ++id) {
+        available.insert(id);
+    }
+    ASSERT(1000 == available.size());
+//..
+// Then, we hand out the three smallest identifiers:
+//..
+    for (int i = 0; i < 3; ++i) {
+        available.erase(available.begin());
+    }
+    ASSERT(3 == *available.begin());
+//..
+// Next, identifier 1 is released, and becomes the smallest available:
+//..
+    ASSERT(true == available.insert(1).second);
+    ASSERT(1    == *available.begin());
+//..
+// Finally, we count the available identifiers in the range '[100 .. 200)':
+//..
+    ASSERT(100 == bsl::distance(available.lower_bound(100),
+                                available.lower_bound(200)));
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 Copies and moves have the value of the source, and use the
+        //:   expected allocator.
+        //:
+        //: 2 A move using the same allocator does not allocate.
+        //:
+        //: 3 'swap' exchanges the values of two objects.
+        //:
+        //: 4 The comparison operators compare the sequences of elements.
+        //:
+        //: 5 'operator<<' prints the elements in order.
+        //
+        // Plan:
+        //: 1 Create objects of various sizes from ranges of elements having
+        //:   duplicate keys, and copy, move, swap, compare, and print them.
+        //:   (C-1..5)
+        //
+        // Testing:
+        //   BTreeSet(II, II, bslma::Allocator * = 0);
+        //   BTreeSet(const BTreeSet&, bslma::Allocator *bA = 0);
+        //   BTreeSet(MovableRef<BTreeSet>);
+        //   BTreeSet(MovableRef<BTreeSet>, bslma::Allocator *);
+        //   BTreeSet& operator=(const BTreeSet&);
+        //   BTreeSet& operator=(MovableRef<BTreeSet>);
+        //   void swap(BTreeSet& other);
+        //   bool operator==(const BTreeSet&, const BTreeSet&);
+        //   bool operator!=(const BTreeSet&, const BTreeSet&);
+        //   bool operator<(const BTreeSet&, const BTreeSet&);
+        //   ostream& operator<<(ostream& stream, const BTreeSet& set);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, MOVE, SWAP, AND COMPARISON" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        for (int n = 0; n < 300; n += 1 + n / 2) {
+            Model values(&oa);
+            for (int i = 0; i < n; ++i) {
+                values.insert(makeString(i % 50, &oa));
+            }
+
+            Obj mX(values.begin(), values.end(), &oa);  const Obj& X = mX;
+            ASSERTV(n, &oa == X.allocator());
+            ASSERTV(n, sameValue(X, values));
+
+            Obj mY(X, &za);  const Obj& Y = mY;
+            ASSERTV(n, &za == Y.allocator());
+            ASSERTV(n, X == Y);
+            ASSERTV(n, !(X != Y));
+            ASSERTV(n, !(X < Y) && !(Y < X));
+
+            {
+                const bsls::Types::Int64 numAllocations = oa.numAllocations();
+
+                Obj mZ(bslmf::MovableRefUtil::move(mX));  const Obj& Z = mZ;
+                ASSERTV(n, numAllocations == oa.numAllocations());
+                ASSERTV(n, &oa == Z.allocator());
+                ASSERTV(n, Y == Z);
+
+                mX = bslmf::MovableRefUtil::move(mZ);
+                ASSERTV(n, numAllocations == oa.numAllocations());
+                ASSERTV(n, Y == X);
+            }
+            {
+                Obj mZ(bslmf::MovableRefUtil::move(mY), &oa);
+                const Obj& Z = mZ;
+                ASSERTV(n, &oa == Z.allocator());
+                ASSERTV(n, X == Z);
+
+                mY = Z;
+                ASSERTV(n, X == Y);
+                ASSERTV(n, &za == Y.allocator());
+            }
+
+            Obj mZ(&oa);  const Obj& Z = mZ;
+            mZ.insert(makeString(9999, &oa));
+            ASSERTV(n, X != Z);
+            ASSERTV(n, X < Z);
+            ASSERTV(n, !(Z < X));
+
+            mZ.swap(mX);
+            ASSERTV(n, Y == Z);
+            ASSERTV(n, 1 == X.size());
+
+            swap(mX, mZ);
+            ASSERTV(n, Y == X);
+            ASSERTV(n, 1 == Z.size());
+
+            bsl::ostringstream expected(&oa);
+            bsl::ostringstream actual(&oa);
+            expected << "[";
+            for (Obj::const_iterator it = Z.begin(); it != Z.end(); ++it) {
+                expected << ' ' << '"' << *it << '"';
+            }
+            expected << " ]";
+            actual << Z;
+            ASSERTV(n, actual.str(), expected.str() == actual.str());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed object is empty and allocates no memory.
+        //:
+        //: 2 'insert', 'erase', and 'clear' yield the same value as the
+        //:   corresponding operations on 'bsl::set'.
+        //:
+        //: 3 The accessors and the lookup methods agree with 'bsl::set'.
+        //:
+        //: 4 The elements use the allocator of the object.
+        //
+        // Plan:
+        //: 1 Perform a random sequence of operations on an object and on a
+        //:   'bsl::set', and compare the results and values.  (C-1..4)
+        //
+        // Testing:
+        //   BTreeSet(bslma::Allocator *basicAllocator);
+        //   ~BTreeSet();
+        //   void clear();
+        //   pair<iterator, iterator> equal_range(const KEY& key);
+        //   size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   iterator find(const KEY& key);
+        //   pair<iterator, bool> insert(FORWARD_REF(VALUE_TYPE) value);
+        //   iterator lower_bound(const KEY& key);
+        //   iterator upper_bound(const KEY& key);
+        //   bool contains(const KEY& key) const;
+        //   size_t count(const KEY& key) const;
+        //   bool empty() const;
+        //   size_t size() const;
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj   mX(&oa);  const Obj&   X = mX;
+            Model mY(&oa);  const Model& Y = mY;
+
+            ASSERT(0    == oa.numBlocksTotal());
+            ASSERT(true == X.empty());
+            ASSERT(0    == X.size());
+            ASSERT(&oa  == X.allocator());
+
+            bsl::srand(3);
+            for (int i = 0; i < 10000; ++i) {
+                const int   k   = bsl::rand() % 2000;
+                const int   op  = bsl::rand() % 10;
+
+                const bsl::string KEY = makeString(k, &oa);
+
+                if (op < 5) {
+                    bsl::pair<Obj::iterator, bool>   rv  = mX.insert(KEY);
+                    bsl::pair<Model::iterator, bool> exp = mY.insert(KEY);
+
+                    ASSERTV(i, exp.second == rv.second);
+                    ASSERTV(i, KEY == *rv.first);
+                    ASSERTV(i, &oa == rv.first->allocator().mechanism());
+                }
+                else if (op < 6) {
+                    ASSERTV(i, mY.erase(KEY) == mX.erase(KEY));
+                }
+                else if (op < 7) {
+                    Obj::iterator   it  = mX.find(KEY);
+                    Model::iterator exp = mY.find(KEY);
+
+                    ASSERTV(i, (Y.end() == exp) == (X.end() == it));
+                    if (X.end() != it) {
+                        ASSERTV(i, sameElement(*exp, *it));
+
+                        Model::iterator expNext = mY.erase(exp);
+                        Obj::iterator   next    = mX.erase(it);
+                        ASSERTV(i, (Y.end() == expNext) == (X.end() == next));
+                        if (X.end() != next) {
+                            ASSERTV(i, sameElement(*expNext, *next));
+                        }
+                    }
+                }
+                else if (op < 8) {
+                    const bsl::string LAST = makeString(k + 20, &oa);
+
+                    Obj::iterator next = mX.erase(X.lower_bound(KEY),
+                                                  X.lower_bound(LAST));
+                    mY.erase(Y.lower_bound(KEY), Y.lower_bound(LAST));
+                    ASSERTV(i, next == X.lower_bound(LAST));
+                }
+                else {
+                    ASSERTV(i, Y.count(KEY) == X.count(KEY));
+                    ASSERTV(i, (0 < Y.count(KEY)) == X.contains(KEY));
+
+                    bsl::pair<Obj::iterator, Obj::iterator> range =
+                                                           mX.equal_range(KEY);
+                    ASSERTV(i, range.first  == mX.lower_bound(KEY));
+                    ASSERTV(i, range.second == mX.upper_bound(KEY));
+                    ASSERTV(i, Y.count(KEY) == static_cast<bsl::size_t>(
+                                  bsl::distance(range.first, range.second)));
+                    ASSERTV(i, bsl::distance(Y.begin(), Y.lower_bound(KEY)) ==
+                                bsl::distance(X.begin(), X.lower_bound(KEY)));
+                }
+
+                ASSERTV(i, Y.size()  == X.size());
+                ASSERTV(i, Y.empty() == X.empty());
+            }
+            ASSERT(sameValue(X, Y));
+
+            Model::const_reverse_iterator jt = Y.rbegin();
+            for (Obj::const_reverse_iterator it = X.rbegin();
+                                                  it != X.rend(); ++it, ++jt) {
+                ASSERT(sameElement(*jt, *it));
+            }
+
+            mX.clear();
+            ASSERT(0    == X.size());
+            ASSERT(true == X.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Instantiate an object and verify basic functionality.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        typedef bdlc::BTreeSet<int> IntObj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        IntObj mX(&oa);  const IntObj& X = mX;
+
+        ASSERT(      0 == X.size());
+        ASSERT(X.end() == X.find(0));
+
+        ASSERT(true  == mX.insert(0).second);
+        ASSERT(false == mX.insert(0).second);
+        ASSERT(      1 == X.size());
+        ASSERT(      1 == X.count(0));
+
+        for (int i = 999; i >= 0; --i) {
+            mX.insert(i);
+        }
+        ASSERT(   1000 == X.size());
+        ASSERT(      1 == mX.erase(0));
+        ASSERT(      0 == mX.erase(0));
+        ASSERT(    999 == X.size());
+        ASSERT(      1 == *X.begin());
+        ASSERT(    999 == *X.rbegin());
+        ASSERT(true  == mX.insert(0).second);
+
+        IntObj mY(X, &oa);  const IntObj& Y = mY;
+        ASSERT(      X == Y);
+
+        mY.erase(Y.begin());
+        ASSERT(      X != Y);
+        ASSERT(      1 == *Y.begin());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
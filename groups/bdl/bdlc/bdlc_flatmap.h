@@ -0,0 +1,1872 @@
+// bdlc_flatmap.h                                                     -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATMAP
+#define INCLUDED_BDLC_FLATMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered map container stored in sorted vectors.
+//
+//@CLASSES:
+//   bdlc::FlatMap: sorted-vector based ordered map container
+//
+//@SEE_ALSO: bdlc_flatmultimap, bdlc_flatset, bdlc_flatsortedutil, bsl_map
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatMap', that implements an ordered map of items with unique keys,
+// in which the keys and the mapped values are stored, in key order, in two
+// separate contiguous arrays ('bsl::vector' objects).
+//
+// An instantiation of 'bdlc::FlatMap' is an allocator-aware, value-semantic
+// type whose salient attributes are its size (number of keys) and the ordered
+// sequence of 'KEY-VALUE' pairs the map contains.  An instantiation may be
+// provided with a custom key-comparison functor, but that functor is not a
+// salient attribute.  In particular, when comparing element values for
+// equality between two different 'bdlc::FlatMap' objects, the elements are
+// compared using 'operator=='.
+//
+// 'bdlc::FlatMap' is intended for ordered lookup tables that are built once
+// (or updated in large batches) and then queried very many times.  Compared
+// with the node-based 'bsl::map', a 'bdlc::FlatMap':
+//
+//: o uses no memory beyond the two arrays (for small elements, typically a
+//:   fraction of the memory of 'bsl::map', which allocates a node holding
+//:   three pointers and a color for every element),
+//:
+//: o performs lookups with a branchless binary search (see
+//:   'bdlc_flatsortedutil') over the contiguous array of keys only, so that
+//:   the mapped values do not dilute the cache lines touched by a search, and
+//:
+//: o iterates over contiguous memory.
+//
+// In exchange, inserting or erasing a single element has complexity linear in
+// the size of the map, since the elements following the insertion point must
+// be moved.  Insertion of a *range* of elements is therefore provided as a
+// bulk operation: the range is appended, sorted (if necessary), and merged
+// with the existing elements in a single pass (see {Bulk Insertion}).
+//
+///Interface Differences with 'bsl::map'
+///-------------------------------------
+// A 'bdlc::FlatMap' provides most of the interface of 'bsl::map', with the
+// following differences:
+//
+//: o The iterators of a 'bdlc::FlatMap' are random-access iterators whose
+//:   'reference' type is a proxy, 'bsl::pair<const KEY&, VALUE&>', returned
+//:   by value (see 'bdlc_flatmap_iterator').  'it->first' and 'it->second'
+//:   may be used as with 'bsl::map', but the address of an element cannot be
+//:   obtained from an iterator.
+//:
+//: o Every insertion or erasure invalidates all iterators, pointers, and
+//:   references to the elements of the map.
+//:
+//: o 'value_type' is 'bsl::pair<KEY, VALUE>' (rather than
+//:   'bsl::pair<const KEY, VALUE>').
+//:
+//: o The arrays of keys and of mapped values are available through the 'keys'
+//:   and 'values' accessors, and capacity may be managed using 'reserve'.
+//
+// Allocator use follows BDE style, and the various allocator propagation
+// attributes are not present.
+//
+///Bulk Insertion
+///--------------
+// The range-insertion methods (and the range constructors) insert all of the
+// elements of a range at once.  If the range is known to be sorted with
+// respect to the comparator of the map, and to contain no two elements having
+// equivalent keys, the client may pass a 'bdlc::SortedUniqueTag' object as the
+// first argument, in which case the elements of the range are merged with the
+// existing elements in linear time.  Otherwise, the range is first sorted
+// (stably, and without moving the elements), and then merged, for a total
+// complexity of 'O(N + M * log(M))', where 'N' is the size of the map and 'M'
+// is the length of the range.  In either case, an element of the range having
+// a key equivalent to that of an element of the map, or of an earlier element
+// of the range, is not inserted.
+//
+///Requirements on 'KEY', 'VALUE', and 'COMPARATOR'
+///------------------------------------------------
+// The (template parameter) types 'KEY' and 'VALUE' must be copy-constructible,
+// move-constructible, and move-assignable, and 'VALUE' must be
+// default-constructible if 'operator[]' is used.  The (template parameter)
+// type 'COMPARATOR' must be a copy-constructible functor defining a strict
+// weak ordering on 'KEY' values; 'COMPARATOR' must also be
+// default-constructible if a constructor not taking a comparator is used.
+//
+///Exception Safety
+///----------------
+// A 'bdlc::FlatMap' is exception neutral, and all of the methods of
+// 'bdlc::FlatMap' provide the basic exception safety guarantee (see
+// {'bsldoc_glossary'|Basic Guarantee}).  Should the move constructor of 'KEY'
+// or 'VALUE' throw during a bulk insertion, the map is left empty.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Building a Read-Mostly Lookup Table
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a table of reference prices, keyed by an integral
+// security identifier, that is loaded in large batches from a source that
+// delivers the securities in identifier order, and is queried very frequently.
+//
+// First, we define an alias for the table, and create an (empty) table:
+//..
+//  typedef bdlc::FlatMap<int, double> PriceTable;
+//
+//  PriceTable prices;
+//..
+// Then, we load the first batch of prices.  Since the batch is sorted by
+// identifier and contains no duplicate identifiers, we supply a
+// 'bdlc::SortedUniqueTag' to the insertion, which merges the batch with the
+// contents of the table in linear time:
+//..
+//  const bsl::pair<int, double> BATCH1[] = {
+//      bsl::make_pair(1001, 10.25),
+//      bsl::make_pair(1007, 99.50),
+//      bsl::make_pair(1013, 47.00),
+//      bsl::make_pair(1021,  3.75),
+//  };
+//  const int NUM_BATCH1 = sizeof BATCH1 / sizeof *BATCH1;
+//
+//  prices.insert(bdlc::SortedUniqueTag(), BATCH1, BATCH1 + NUM_BATCH1);
+//  assert(4 == prices.size());
+//..
+// Next, we load a second batch, in which the price for security 1007 is
+// repeated.  As with 'insert' of a single value, the element already in the
+// table is retained:
+//..
+//  const bsl::pair<int, double> BATCH2[] = {
+//      bsl::make_pair(1003, 12.00),
+//      bsl::make_pair(1007, 98.00),
+//      bsl::make_pair(1030, 61.25),
+//  };
+//  const int NUM_BATCH2 = sizeof BATCH2 / sizeof *BATCH2;
+//
+//  prices.insert(bdlc::SortedUniqueTag(), BATCH2, BATCH2 + NUM_BATCH2);
+//  assert(6     == prices.size());
+//  assert(99.50 == prices.at(1007));
+//..
+// Now, we look up prices, and update one of them in place:
+//..
+//  PriceTable::const_iterator it = prices.find(1013);
+//  assert(prices.end() != it);
+//  assert(47.00 == it->second);
+//
+//  assert(prices.end() == prices.find(1014));
+//
+//  prices[1021] = 4.00;
+//  assert(4.00 == prices.at(1021));
+//..
+// Finally, we observe that the identifiers are stored contiguously, in order:
+//..
+//  const bsl::vector<int>& ids = prices.keys();
+//  assert(1001 == ids.front());
+//  assert(1030 == ids.back());
+//  assert(1003 == ids[1]);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flatmap_iterator.h>
+#include <bdlc_flatsortedutil.h>
+
+#include <bslalg_hasstliterators.h>
+#include <bslalg_swaputil.h>
+
+#include <bslim_printer.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_destructorguard.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_movableref.h>
+#include <bslmf_util.h>    // 'forward(V)'
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_util.h>     // 'forward<T>(V)'
+
+#include <bslstl_stdexceptutil.h>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <bsl_initializer_list.h>
+#endif
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_iterator.h>
+#include <bsl_ostream.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+// FORWARD DECLARATIONS
+template <class KEY, class VALUE, class COMPARATOR = bsl::less<KEY> >
+class FlatMap;
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator==(const FlatMap<KEY, VALUE, COMPARATOR>& lhs,
+                const FlatMap<KEY, VALUE, COMPARATOR>& rhs);
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator!=(const FlatMap<KEY, VALUE, COMPARATOR>& lhs,
+                const FlatMap<KEY, VALUE, COMPARATOR>& rhs);
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator<(const FlatMap<KEY, VALUE, COMPARATOR>& lhs,
+               const FlatMap<KEY, VALUE, COMPARATOR>& rhs);
+
+template <class KEY, class VALUE, class COMPARATOR>
+void swap(FlatMap<KEY, VALUE, COMPARATOR>& a,
+          FlatMap<KEY, VALUE, COMPARATOR>& b);
+
+                               // =============
+                               // class FlatMap
+                               // =============
+
+template <class KEY, class VALUE, class COMPARATOR>
+class FlatMap {
+    // This class template implements a value-semantic container type holding
+    // an ordered map of 'KEY-VALUE' pairs having unique keys that provides a
+    // mapping from keys of (template parameter) type 'KEY' to their associated
+    // mapped values of (template parameter) type 'VALUE'.  The keys and the
+    // mapped values are held, in key order, in two parallel arrays.  The
+    // (template parameter) type 'COMPARATOR' is a functor defining the order
+    // of 'KEY' values.  See {Requirements on 'KEY', 'VALUE', and
+    // 'COMPARATOR'} for more information.
+
+    // PRIVATE TYPES
+    typedef bslmf::MovableRefUtil MoveUtil;
+    typedef bsl::vector<KEY>      KeyContainer;
+    typedef bsl::vector<VALUE>    ValueContainer;
+
+    class Proctor;
+        // restores the invariants of a map after a failed modification
+
+    // DATA
+    KeyContainer   d_keys;        // keys, in order
+    ValueContainer d_values;      // mapped values, parallel to 'd_keys'
+    COMPARATOR     d_comparator;  // defines the order of the keys
+
+    // FRIENDS
+    friend bool operator==<>(const FlatMap&, const FlatMap&);
+    friend bool operator!=<>(const FlatMap&, const FlatMap&);
+    friend bool operator< <>(const FlatMap&, const FlatMap&);
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::pair<KEY, VALUE>                  value_type;
+    typedef KEY                                    key_type;
+    typedef VALUE                                  mapped_type;
+    typedef bsl::size_t                            size_type;
+    typedef bsl::ptrdiff_t                         difference_type;
+    typedef COMPARATOR                             key_compare;
+    typedef FlatMap_Iterator<KEY, VALUE>           iterator;
+    typedef FlatMap_Iterator<KEY, const VALUE>     const_iterator;
+    typedef typename iterator::reference           reference;
+    typedef typename const_iterator::reference     const_reference;
+    typedef bsl::reverse_iterator<iterator>        reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>  const_reverse_iterator;
+
+  private:
+    // PRIVATE MANIPULATORS
+    template <class KEY_TYPE>
+    iterator emplaceDefaultAt(
+                        bsl::size_t                                  index,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key);
+        // Insert, at the specified 'index', an element having the specified
+        // 'key' and a default-constructed mapped value, and return an iterator
+        // referring to the newly inserted element.  The behavior is undefined
+        // unless the keys of the map remain in order after the insertion.
+
+    template <class KEY_TYPE, class VALUE_TYPE>
+    iterator emplaceAt(bsl::size_t                                   index,
+                       BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)   key,
+                       BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value);
+        // Insert, at the specified 'index', an element having the specified
+        // 'key' and 'value', and return an iterator referring to the newly
+        // inserted element.  The behavior is undefined unless the keys of the
+        // map remain in order after the insertion.
+
+    template <class INPUT_ITERATOR>
+    void insertRange(INPUT_ITERATOR first, INPUT_ITERATOR last, bool sorted);
+        // Insert into this map the value of each element in the input iterator
+        // range specified by 'first' through 'last' (including 'first',
+        // excluding 'last') whose key is not equivalent to that of an element
+        // of this map or of an earlier element of the range.  If the specified
+        // 'sorted' is 'true', the behavior is undefined unless the range is
+        // sorted with respect to the comparator of this map and contains no
+        // two elements having equivalent keys.
+
+    void merge(KeyContainer      *keys,
+               ValueContainer    *values,
+               const bsl::size_t *order);
+        // Merge into this map the elements having the keys in the specified
+        // 'keys' and the mapped values at the corresponding positions in the
+        // specified 'values', taken in the order of the indices in the array
+        // at the specified 'order', or in the order of 'keys' if 'order' is
+        // 0, ignoring each element whose key is equivalent to that of an
+        // element of this map or of an earlier element in that order.  The
+        // elements of 'keys' and 'values' are left in a valid but unspecified
+        // state.  The behavior is undefined unless 'keys' and 'values' use the
+        // allocator of this map and have the same length, 'order' is 0 or
+        // refers to a permutation of the indices of 'keys', and the elements
+        // are sorted in the resulting order.
+
+    iterator makeIterator(bsl::size_t index);
+        // Return an iterator referring to the element at the specified
+        // 'index' in this map.  The behavior is undefined unless
+        // 'index <= size()'.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t lowerBoundIndex(const KEY& key) const;
+        // Return the index of the first element in this map whose key is not
+        // ordered before the specified 'key', or 'size()' if no such element
+        // exists.
+
+    bsl::size_t upperBoundIndex(const KEY& key) const;
+        // Return the index of the first element in this map whose key is
+        // ordered after the specified 'key', or 'size()' if no such element
+        // exists.
+
+    const_iterator makeIterator(bsl::size_t index) const;
+        // Return an iterator referring to the element at the specified
+        // 'index' in this map.  The behavior is undefined unless
+        // 'index <= size()'.
+
+  public:
+    // CREATORS
+    FlatMap();
+    explicit FlatMap(bslma::Allocator *basicAllocator);
+    explicit FlatMap(const COMPARATOR&  comparator,
+                     bslma::Allocator  *basicAllocator = 0);
+        // Create an empty 'FlatMap' object.  Optionally specify a
+        // 'comparator' used to order the keys of elements in this container.
+        // If 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied or is 0, the currently installed default allocator is
+        // used.  No memory is allocated.
+
+    template <class INPUT_ITERATOR>
+    FlatMap(INPUT_ITERATOR    first,
+            INPUT_ITERATOR    last,
+            bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatMap(INPUT_ITERATOR     first,
+            INPUT_ITERATOR     last,
+            const COMPARATOR&  comparator,
+            bslma::Allocator  *basicAllocator = 0);
+        // Create a 'FlatMap' object initialized by insertion of the values
+        // from the input iterator range specified by 'first' through 'last'
+        // (including 'first', excluding 'last').  Optionally specify a
+        // 'comparator' used to order the keys of elements in this container.
+        // If 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied or is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'first' and 'last' refer to
+        // a sequence of valid values where 'first' is at a position at or
+        // before 'last'.  Note that if a member of the input sequence has an
+        // equivalent key to an earlier member, the later member will not be
+        // inserted.
+
+    template <class INPUT_ITERATOR>
+    FlatMap(SortedUniqueTag   ,
+            INPUT_ITERATOR    first,
+            INPUT_ITERATOR    last,
+            bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatMap(SortedUniqueTag    ,
+            INPUT_ITERATOR     first,
+            INPUT_ITERATOR     last,
+            const COMPARATOR&  comparator,
+            bslma::Allocator  *basicAllocator = 0);
+        // Create a 'FlatMap' object holding the values from the input
+        // iterator range specified by 'first' through 'last' (including
+        // 'first', excluding 'last'), in time linear in the length of the
+        // range.  Optionally specify a 'comparator' used to order the keys of
+        // elements in this container.  If 'comparator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'COMPARATOR' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not supplied or is 0, the
+        // currently installed default allocator is used.  The behavior is
+        // undefined unless 'first' and 'last' refer to a sequence of valid
+        // values where 'first' is at a position at or before 'last', and the
+        // sequence is sorted with respect to the comparator and contains no
+        // two values having equivalent keys.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    FlatMap(bsl::initializer_list<value_type>  values,
+            bslma::Allocator                  *basicAllocator = 0);
+    FlatMap(bsl::initializer_list<value_type>  values,
+            const COMPARATOR&                  comparator,
+            bslma::Allocator                  *basicAllocator = 0);
+        // Create a 'FlatMap' object initialized by insertion of the specified
+        // 'values'.  Optionally specify a 'comparator' used to order the keys
+        // of elements in this container.  If 'comparator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'COMPARATOR' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not supplied or is 0, the
+        // currently installed default allocator is used.  Note that if a
+        // member of 'values' has an equivalent key to an earlier member, the
+        // later member will not be inserted.
+#endif
+
+    FlatMap(const FlatMap& original, bslma::Allocator *basicAllocator = 0);
+        // Create a 'FlatMap' object having the same value and comparator as
+        // the specified 'original' object.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // specified or is 0, the currently installed default allocator is
+        // used.
+
+    FlatMap(bslmf::MovableRef<FlatMap> original);
+        // Create a 'FlatMap' object having the same value, comparator, and
+        // allocator as the specified 'original' object.  The contents of
+        // 'original' are moved (in constant time) to this object, 'original'
+        // is left in a (valid) unspecified state, and no exceptions will be
+        // thrown.
+
+    FlatMap(bslmf::MovableRef<FlatMap>  original,
+            bslma::Allocator           *basicAllocator);
+        // Create a 'FlatMap' object having the same value and comparator as
+        // the specified 'original' object, using the specified
+        // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  The allocator of
+        // 'original' remains unchanged.  If 'original' and the newly created
+        // object have the same allocator then the contents of 'original' are
+        // moved (in constant time) to this object, 'original' is left in a
+        // (valid) unspecified state, and no exceptions will be thrown;
+        // otherwise, the elements of 'original' are moved, 'original' is left
+        // in a (valid) unspecified state, and an exception may be thrown.
+
+    //! ~FlatMap() = default;
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    FlatMap& operator=(const FlatMap& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.
+
+    FlatMap& operator=(bslmf::MovableRef<FlatMap> rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  If this object and 'rhs' use the same allocator the
+        // contents of 'rhs' are moved (in constant time) to this object.
+        // 'rhs' is left in a (valid) unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    FlatMap& operator=(bsl::initializer_list<value_type> values);
+        // Assign to this object the value resulting from first clearing this
+        // map and then inserting each object in the specified 'values'
+        // initializer list, ignoring those objects having a value whose key is
+        // equivalent to that which appears earlier in the list; return a
+        // reference providing modifiable access to this object.
+#endif
+
+    template <class KEY_TYPE>
+    VALUE& operator[](BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key);
+        // Return a reference providing modifiable access to the mapped value
+        // associated with the specified 'key' in this map.  If this map does
+        // not already contain an element having 'key', insert an element
+        // having 'key' and a default-constructed 'VALUE', and return a
+        // reference to the newly mapped value.  If 'key' is movable, 'key' is
+        // left in a (valid) unspecified state.
+
+    VALUE& at(const KEY& key);
+        // Return a reference providing modifiable access to the mapped value
+        // associated with the specified 'key' in this map, if such an entry
+        // exists; otherwise, throw a 'std::out_of_range' exception.  Note that
+        // this method may also throw a different kind of exception if the
+        // (template parameter) type 'COMPARATOR' throws.
+
+    void clear();
+        // Remove all entries from this map.  Note that the map is empty after
+        // this call, but allocated memory may be retained for future use.
+
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        // Return a pair of iterators defining the sequence of modifiable
+        // elements in this map having the specified 'key', where the first
+        // iterator is positioned at the start of the sequence and the second
+        // iterator is positioned one past the end of the sequence.  If this
+        // map contains no elements having a key equivalent to 'key', then the
+        // two returned iterators will have the same value.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove from this map the element whose key is equivalent to the
+        // specified 'key', if it exists, and return 1; otherwise (there is no
+        // element having 'key' in this map), return 0 with no other effect.
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove from this map the element at the specified 'position', and
+        // return an iterator referring to the element immediately following
+        // the removed element, or to the past-the-end position if the removed
+        // element was the last element in the sequence of elements maintained
+        // by this map.  The behavior is undefined unless 'position' refers to
+        // an element in this map.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this map the elements starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and return an iterator referring to the element at 'last' prior to
+        // the erasure.  The behavior is undefined unless 'first' and 'last'
+        // either refer to elements in this map or are the 'end' iterator, and
+        // the 'first' position is at or before the 'last' position in the
+        // sequence provided by this container.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the modifiable element in this map
+        // having the specified 'key', or 'end()' if no such entry exists in
+        // this map.
+
+    template <class VALUE_TYPE>
+    typename bsl::enable_if<bsl::is_convertible<VALUE_TYPE, value_type>::value,
+                            bsl::pair<iterator, bool> >::type
+                    insert(BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value)
+        // Insert the specified 'value' into this map if the key (the 'first'
+        // element) of 'value' does not already exist in this map; otherwise,
+        // this method has no effect.  Return a 'pair' whose 'first' member is
+        // an iterator referring to the (possibly newly inserted) element in
+        // this map whose key is equivalent to that of the element to be
+        // inserted, and whose 'second' member is 'true' if a new element was
+        // inserted, and 'false' if an element with an equivalent key was
+        // already present.  The behavior is undefined unless 'VALUE_TYPE' is
+        // a specialization of 'bsl::pair'.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        const bsl::size_t index = lowerBoundIndex(value.first);
+
+        if (index < d_keys.size() && !d_comparator(value.first,
+                                                   d_keys[index])) {
+            return bsl::pair<iterator, bool>(makeIterator(index),
+                                             false);                  // RETURN
+        }
+
+        return bsl::pair<iterator, bool>(
+                emplaceAt(index,
+                          BSLS_COMPILERFEATURES_FORWARD(VALUE_TYPE,
+                                                        value).first,
+                          BSLS_COMPILERFEATURES_FORWARD(VALUE_TYPE,
+                                                        value).second),
+                true);
+    }
+
+    template <class VALUE_TYPE>
+    typename bsl::enable_if<bsl::is_convertible<VALUE_TYPE, value_type>::value,
+                            iterator>::type
+                    insert(const_iterator                                ,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value)
+        // Insert the specified 'value' into this map if the key (the 'first'
+        // element) of 'value' does not already exist in this map; otherwise,
+        // this method has no effect.  Return an iterator referring to the
+        // (possibly newly inserted) element in this map whose key is
+        // equivalent to that of the element to be inserted.  The supplied
+        // 'const_iterator' is ignored.  The behavior is undefined unless
+        // 'VALUE_TYPE' is a specialization of 'bsl::pair'.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        return insert(BSLS_COMPILERFEATURES_FORWARD(VALUE_TYPE, value)).first;
+    }
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map the value of each element in the input iterator
+        // range specified by 'first' through 'last' (including 'first',
+        // excluding 'last') whose key is not equivalent to that of an element
+        // of this map or of an earlier element of the range, in
+        // 'O(size() + M * log(M))' time, where 'M' is the length of the range.
+        // The behavior is undefined unless 'first' and 'last' refer to a
+        // sequence of valid values where 'first' is at a position at or
+        // before 'last'.
+
+    template <class INPUT_ITERATOR>
+    void insert(SortedUniqueTag, INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map the value of each element in the input iterator
+        // range specified by 'first' through 'last' (including 'first',
+        // excluding 'last') whose key is not equivalent to that of an element
+        // of this map, in time linear in 'size()' and the length of the range.
+        // The behavior is undefined unless 'first' and 'last' refer to a
+        // sequence of valid values where 'first' is at a position at or
+        // before 'last', and the sequence is sorted with respect to the
+        // comparator of this map and contains no two values having equivalent
+        // keys.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(bsl::initializer_list<value_type> values);
+        // Insert into this map the value of each element in the specified
+        // 'values' initializer list whose key is not equivalent to that of an
+        // element of this map or of an earlier element of 'values'.
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... ARGS>
+    bsl::pair<iterator, bool> emplace(ARGS&&... args);
+        // Insert into this map a newly-created element constructed by
+        // forwarding this map's allocator and the specified 'args' to the
+        // constructor of 'bsl::pair<KEY, VALUE>', if no element having an
+        // equivalent key is already present.  Return a 'pair' whose 'first'
+        // member is an iterator referring to the (possibly newly inserted)
+        // element having an equivalent key, and whose 'second' member is
+        // 'true' if a new element was inserted.
+#endif
+
+    iterator lower_bound(const KEY& key);
+        // Return an iterator referring to the first modifiable element in this
+        // map whose key is not ordered before the specified 'key', or 'end()'
+        // if no such element exists.
+
+    void reserve(bsl::size_t numElements);
+        // Change the capacity of this map to at least the specified
+        // 'numElements'.  Note that this method has no effect unless
+        // 'numElements > capacity()'.
+
+    iterator upper_bound(const KEY& key);
+        // Return an iterator referring to the first modifiable element in this
+        // map whose key is ordered after the specified 'key', or 'end()' if no
+        // such element exists.
+
+                          // Iterators
+
+    iterator begin();
+        // Return an iterator referring to the first modifiable element in the
+        // sequence of elements maintained by this map, or the 'end' iterator
+        // if this map is empty.
+
+    iterator end();
+        // Return an iterator referring to the past-the-end position in the
+        // sequence of elements maintained by this map.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator referring to the last modifiable element
+        // in the sequence of elements maintained by this map, or 'rend' if
+        // this map is empty.
+
+    reverse_iterator rend();
+        // Return a reverse iterator referring to the past-the-end position in
+        // the reverse sequence of elements maintained by this map.
+
+                             // Aspects
+
+    void swap(FlatMap& other);
+        // Exchange the value of this object as well as its comparator with
+        // those of the specified 'other' object.  This method provides the
+        // no-throw exception-safety guarantee if 'COMPARATOR' provides a
+        // no-throw swap.  The behavior is undefined unless this object was
+        // created with the same allocator as 'other'.
+
+    // ACCESSORS
+    const VALUE& at(const KEY& key) const;
+        // Return a reference providing non-modifiable access to the mapped
+        // value associated with the specified 'key' in this map, if such an
+        // entry exists; otherwise, throw a 'std::out_of_range' exception.
+        // Note that this method may also throw a different kind of exception
+        // if the (template parameter) type 'COMPARATOR' throws.
+
+    bsl::size_t capacity() const;
+        // Return the number of elements this map can hold without
+        // reallocation.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this map contains an element having the specified
+        // 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements in this map having the specified
+        // 'key'.  Note that since a map maintains unique keys, the returned
+        // value will be either 0 or 1.
+
+    bool empty() const;
+        // Return 'true' if this map contains no elements, and 'false'
+        // otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                         const KEY& key) const;
+        // Return a pair of iterators defining the sequence of non-modifiable
+        // elements in this map having the specified 'key', where the first
+        // iterator is positioned at the start of the sequence and the second
+        // iterator is positioned one past the end of the sequence.  If this
+        // map contains no elements having a key equivalent to 'key', then the
+        // two returned iterators will have the same value.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the non-modifiable element in this
+        // map having the specified 'key', or 'end()' if no such entry exists
+        // in this map.
+
+    COMPARATOR key_comp() const;
+        // Return (a copy of) the key-comparison functor used by this map.
+
+    const bsl::vector<KEY>& keys() const;
+        // Return a reference providing non-modifiable access to the array of
+        // the keys of this map, in order.
+
+    const_iterator lower_bound(const KEY& key) const;
+        // Return an iterator referring to the first non-modifiable element in
+        // this map whose key is not ordered before the specified 'key', or
+        // 'end()' if no such element exists.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this map.
+
+    const_iterator upper_bound(const KEY& key) const;
+        // Return an iterator referring to the first non-modifiable element in
+        // this map whose key is ordered after the specified 'key', or 'end()'
+        // if no such element exists.
+
+    const bsl::vector<VALUE>& values() const;
+        // Return a reference providing non-modifiable access to the array of
+        // the mapped values of this map, in the order of their keys.
+
+                          // Iterators
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator referring to the first non-modifiable element in
+        // the sequence of elements maintained by this map, or the 'end'
+        // iterator if this map is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return an iterator referring to the past-the-end position in the
+        // sequence of elements maintained by this map.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator referring to the last non-modifiable
+        // element in the sequence of elements maintained by this map, or
+        // 'rend' if this map is empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator referring to the past-the-end position in
+        // the reverse sequence of elements maintained by this map.
+
+                             // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this map to supply memory.
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level          = 0,
+                        int           spacesPerLevel = 4) const;
+        // Format this object to the specified output 'stream' at the (absolute
+        // value of) the optionally specified indentation 'level' and return a
+        // reference to 'stream'.  If 'level' is specified, optionally specify
+        // 'spacesPerLevel', the number of spaces per indentation level for
+        // this and all of its nested objects.  If 'level' is negative,
+        // suppress indentation of the first line.  If 'spacesPerLevel' is
+        // negative format the entire output on one line, suppressing all but
+        // the initial indentation (as governed by 'level').  If 'stream' is
+        // not valid on entry, this operation has no effect.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator==(const FlatMap<KEY, VALUE, COMPARATOR>& lhs,
+                const FlatMap<KEY, VALUE, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'FlatMap' objects have the same
+    // value if their sizes are the same and each element contained in one is
+    // equal to the element at the same position in the other.  This method
+    // requires that the (template parameter) types 'KEY' and 'VALUE' both be
+    // equality-comparable.
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator!=(const FlatMap<KEY, VALUE, COMPARATOR>& lhs,
+                const FlatMap<KEY, VALUE, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'FlatMap' objects do not have
+    // the same value if they do not have the same size, or some element
+    // contained in one is not equal to the element at the same position in
+    // the other.  This method requires that the (template parameter) types
+    // 'KEY' and 'VALUE' both be equality-comparable.
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator<(const FlatMap<KEY, VALUE, COMPARATOR>& lhs,
+               const FlatMap<KEY, VALUE, COMPARATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' map is
+    // lexicographically less than that of the specified 'rhs' map, and
+    // 'false' otherwise.  Elements are compared as 'bsl::pair<KEY, VALUE>'
+    // objects (i.e., by key and then by mapped value) using 'operator<'.
+
+template <class KEY, class VALUE, class COMPARATOR>
+bsl::ostream& operator<<(bsl::ostream&                          stream,
+                         const FlatMap<KEY, VALUE, COMPARATOR>& map);
+    // Write the value of the specified 'map' to the specified output 'stream'
+    // in a single-line format, and return a reference providing modifiable
+    // access to 'stream'.  If 'stream' is not valid on entry, this operation
+    // has no effect.  Note that this human-readable format is not fully
+    // specified and can change without notice.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR>
+void swap(FlatMap<KEY, VALUE, COMPARATOR>& a,
+          FlatMap<KEY, VALUE, COMPARATOR>& b);
+    // Exchange the values of the specified 'a' and 'b' objects.  This method
+    // provides the no-throw exception-safety guarantee if the two objects
+    // were created with the same allocator and the basic guarantee otherwise.
+
+                          // ======================
+                          // class FlatMap::Proctor
+                          // ======================
+
+template <class KEY, class VALUE, class COMPARATOR>
+class FlatMap<KEY, VALUE, COMPARATOR>::Proctor {
+    // This class implements a proctor that, unless its 'release' method has
+    // been invoked, restores, on destruction, the invariants of a map whose
+    // arrays of keys and mapped values may have become inconsistent, either
+    // by erasing a specified key or, if no key is specified, by clearing the
+    // map.
+
+    // DATA
+    FlatMap     *d_map_p;  // managed map, or 0 if released
+    bsl::size_t  d_index;  // index of the key to erase, or 'size_t(-1)'
+
+  private:
+    // NOT IMPLEMENTED
+    Proctor(const Proctor&);
+    Proctor& operator=(const Proctor&);
+
+  public:
+    // CREATORS
+    explicit Proctor(FlatMap *map);
+        // Create a proctor that clears the specified 'map' on destruction
+        // unless released.
+
+    Proctor(FlatMap *map, bsl::size_t index);
+        // Create a proctor that erases the key at the specified 'index' of the
+        // specified 'map' on destruction unless released.
+
+    ~Proctor();
+        // Restore the invariants of the managed map, unless this proctor has
+        // been released.
+
+    // MANIPULATORS
+    void release();
+        // Release the managed map from management by this proctor.
+};
+
+// ============================================================================
+//                TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                          // ----------------------
+                          // class FlatMap::Proctor
+                          // ----------------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::Proctor::Proctor(FlatMap *map)
+: d_map_p(map)
+, d_index(static_cast<bsl::size_t>(-1))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::Proctor::Proctor(FlatMap     *map,
+                                                  bsl::size_t  index)
+: d_map_p(map)
+, d_index(index)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::Proctor::~Proctor()
+{
+    if (d_map_p) {
+        if (static_cast<bsl::size_t>(-1) == d_index) {
+            d_map_p->d_keys.clear();
+            d_map_p->d_values.clear();
+        }
+        else {
+            d_map_p->d_keys.erase(d_map_p->d_keys.begin() + d_index);
+        }
+    }
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMap<KEY, VALUE, COMPARATOR>::Proctor::release()
+{
+    d_map_p = 0;
+}
+
+                               // -------------
+                               // class FlatMap
+                               // -------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR>
+template <class KEY_TYPE>
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::emplaceDefaultAt(
+                          bsl::size_t                                 index,
+                          BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key)
+{
+    d_keys.emplace(d_keys.begin() + index,
+                   BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key));
+
+    Proctor proctor(this, index);
+
+    d_values.emplace(d_values.begin() + index);
+
+    proctor.release();
+
+    return makeIterator(index);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class KEY_TYPE, class VALUE_TYPE>
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::emplaceAt(
+                         bsl::size_t                                   index,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)   key,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value)
+{
+    d_keys.emplace(d_keys.begin() + index,
+                   BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key));
+
+    Proctor proctor(this, index);
+
+    d_values.emplace(d_values.begin() + index,
+                     BSLS_COMPILERFEATURES_FORWARD(VALUE_TYPE, value));
+
+    proctor.release();
+
+    return makeIterator(index);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+void FlatMap<KEY, VALUE, COMPARATOR>::insertRange(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last,
+                                                  bool           sorted)
+{
+    KeyContainer   keys(allocator());
+    ValueContainer values(allocator());
+
+    for (; first != last; ++first) {
+        keys.push_back((*first).first);
+        values.push_back((*first).second);
+    }
+
+    if (sorted) {
+        BSLS_ASSERT_SAFE(FlatSortedUtil::isSortedUnique(keys.begin(),
+                                                        keys.end(),
+                                                        d_comparator));
+
+        merge(&keys, &values, 0);
+    }
+    else if (FlatSortedUtil::isSortedUnique(keys.begin(),
+                                            keys.end(),
+                                            d_comparator)) {
+        merge(&keys, &values, 0);
+    }
+    else {
+        bsl::vector<bsl::size_t> order(keys.size(), 0, allocator());
+
+        FlatSortedUtil::sortPermutation(order.data(),
+                                        keys.data(),
+                                        keys.size(),
+                                        d_comparator);
+
+        merge(&keys, &values, order.data());
+    }
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+void FlatMap<KEY, VALUE, COMPARATOR>::merge(KeyContainer      *keys,
+                                            ValueContainer    *values,
+                                            const bsl::size_t *order)
+{
+    BSLS_ASSERT(keys);
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(keys->size() == values->size());
+
+    const bsl::size_t numOld = d_keys.size();
+    const bsl::size_t numNew = keys->size();
+
+    if (0 == numNew) {
+        return;                                                       // RETURN
+    }
+
+    if (0 == numOld && 0 == order) {
+        // The new elements are sorted and unique, and form the entire result.
+
+        d_keys.swap(*keys);
+        d_values.swap(*values);
+        return;                                                       // RETURN
+    }
+
+    KeyContainer   mergedKeys(allocator());
+    ValueContainer mergedValues(allocator());
+
+    mergedKeys.reserve(numOld + numNew);
+    mergedValues.reserve(numOld + numNew);
+
+    Proctor proctor(this);
+
+    bsl::size_t i = 0;  // index of the next element of this map
+    bsl::size_t j = 0;  // position in 'order' of the next new element
+
+    while (i < numOld || j < numNew) {
+        const bsl::size_t n = j < numNew ? (order ? order[j] : j) : 0;
+
+        if (j == numNew
+         || (i < numOld && !d_comparator((*keys)[n], d_keys[i]))) {
+            mergedKeys.push_back(MoveUtil::move(d_keys[i]));
+            mergedValues.push_back(MoveUtil::move(d_values[i]));
+            ++i;
+        }
+        else {
+            ++j;
+
+            // A new element having a key equivalent to that of the previous
+            // element (an existing element, or an earlier new element) is not
+            // inserted.
+
+            if (mergedKeys.empty()
+             || d_comparator(mergedKeys.back(), (*keys)[n])) {
+                mergedKeys.push_back(MoveUtil::move((*keys)[n]));
+                mergedValues.push_back(MoveUtil::move((*values)[n]));
+            }
+        }
+    }
+
+    d_keys.swap(mergedKeys);
+    d_values.swap(mergedValues);
+
+    proctor.release();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::makeIterator(bsl::size_t index)
+{
+    BSLS_ASSERT_SAFE(index <= d_keys.size());
+
+    return iterator(d_keys.data() + index, d_values.data() + index);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t
+FlatMap<KEY, VALUE, COMPARATOR>::lowerBoundIndex(const KEY& key) const
+{
+    const KEY *begin = d_keys.data();
+
+    return FlatSortedUtil::lowerBound(begin,
+                                      begin + d_keys.size(),
+                                      key,
+                                      d_comparator) - begin;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t
+FlatMap<KEY, VALUE, COMPARATOR>::upperBoundIndex(const KEY& key) const
+{
+    const KEY *begin = d_keys.data();
+
+    return FlatSortedUtil::upperBound(begin,
+                                      begin + d_keys.size(),
+                                      key,
+                                      d_comparator) - begin;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::makeIterator(bsl::size_t index) const
+{
+    BSLS_ASSERT_SAFE(index <= d_keys.size());
+
+    return const_iterator(d_keys.data() + index, d_values.data() + index);
+}
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap()
+: d_keys()
+, d_values()
+, d_comparator()
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(bslma::Allocator *basicAllocator)
+: d_keys(basicAllocator)
+, d_values(basicAllocator)
+, d_comparator()
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(const COMPARATOR&  comparator,
+                                         bslma::Allocator  *basicAllocator)
+: d_keys(basicAllocator)
+, d_values(basicAllocator)
+, d_comparator(comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(INPUT_ITERATOR    first,
+                                         INPUT_ITERATOR    last,
+                                         bslma::Allocator *basicAllocator)
+: d_keys(basicAllocator)
+, d_values(basicAllocator)
+, d_comparator()
+{
+    insertRange(first, last, false);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(INPUT_ITERATOR     first,
+                                         INPUT_ITERATOR     last,
+                                         const COMPARATOR&  comparator,
+                                         bslma::Allocator  *basicAllocator)
+: d_keys(basicAllocator)
+, d_values(basicAllocator)
+, d_comparator(comparator)
+{
+    insertRange(first, last, false);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(SortedUniqueTag   ,
+                                         INPUT_ITERATOR    first,
+                                         INPUT_ITERATOR    last,
+                                         bslma::Allocator *basicAllocator)
+: d_keys(basicAllocator)
+, d_values(basicAllocator)
+, d_comparator()
+{
+    insertRange(first, last, true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(SortedUniqueTag    ,
+                                         INPUT_ITERATOR     first,
+                                         INPUT_ITERATOR     last,
+                                         const COMPARATOR&  comparator,
+                                         bslma::Allocator  *basicAllocator)
+: d_keys(basicAllocator)
+, d_values(basicAllocator)
+, d_comparator(comparator)
+{
+    insertRange(first, last, true);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(
+                            bsl::initializer_list<value_type>  values,
+                            bslma::Allocator                  *basicAllocator)
+: d_keys(basicAllocator)
+, d_values(basicAllocator)
+, d_comparator()
+{
+    insertRange(values.begin(), values.end(), false);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(
+                            bsl::initializer_list<value_type>  values,
+                            const COMPARATOR&                  comparator,
+                            bslma::Allocator                  *basicAllocator)
+: d_keys(basicAllocator)
+, d_values(basicAllocator)
+, d_comparator(comparator)
+{
+    insertRange(values.begin(), values.end(), false);
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(const FlatMap&    original,
+                                         bslma::Allocator *basicAllocator)
+: d_keys(original.d_keys, basicAllocator)
+, d_values(original.d_values, basicAllocator)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(bslmf::MovableRef<FlatMap> original)
+: d_keys(MoveUtil::move(MoveUtil::access(original).d_keys))
+, d_values(MoveUtil::move(MoveUtil::access(original).d_values))
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(
+                                  bslmf::MovableRef<FlatMap>  original,
+                                  bslma::Allocator           *basicAllocator)
+: d_keys(MoveUtil::move(MoveUtil::access(original).d_keys), basicAllocator)
+, d_values(MoveUtil::move(MoveUtil::access(original).d_values),
+           basicAllocator)
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>&
+FlatMap<KEY, VALUE, COMPARATOR>::operator=(const FlatMap& rhs)
+{
+    if (this != &rhs) {
+        FlatMap tmp(rhs, allocator());
+
+        this->swap(tmp);
+    }
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>&
+FlatMap<KEY, VALUE, COMPARATOR>::operator=(bslmf::MovableRef<FlatMap> rhs)
+{
+    FlatMap& lvalue = rhs;
+
+    if (this != &lvalue) {
+        FlatMap tmp(MoveUtil::move(lvalue), allocator());
+
+        this->swap(tmp);
+    }
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>&
+FlatMap<KEY, VALUE, COMPARATOR>::operator=(
+                                     bsl::initializer_list<value_type> values)
+{
+    FlatMap tmp(values.begin(), values.end(), d_comparator, allocator());
+
+    this->swap(tmp);
+
+    return *this;
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class KEY_TYPE>
+inline
+VALUE& FlatMap<KEY, VALUE, COMPARATOR>::operator[](
+                               BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key)
+{
+    const KEY&        lvalue = key;
+    const bsl::size_t index  = lowerBoundIndex(lvalue);
+
+    if (index < d_keys.size() && !d_comparator(lvalue, d_keys[index])) {
+        return d_values[index];                                       // RETURN
+    }
+
+    emplaceDefaultAt(index, BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key));
+
+    return d_values[index];
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+VALUE& FlatMap<KEY, VALUE, COMPARATOR>::at(const KEY& key)
+{
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    if (index == d_keys.size() || d_comparator(key, d_keys[index])) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                              "FlatMap<...>::at(key_type): invalid key value");
+    }
+
+    return d_values[index];
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMap<KEY, VALUE, COMPARATOR>::clear()
+{
+    d_keys.clear();
+    d_values.clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::pair<typename FlatMap<KEY, VALUE, COMPARATOR>::iterator,
+          typename FlatMap<KEY, VALUE, COMPARATOR>::iterator>
+FlatMap<KEY, VALUE, COMPARATOR>::equal_range(const KEY& key)
+{
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    if (index < d_keys.size() && !d_comparator(key, d_keys[index])) {
+        return bsl::pair<iterator, iterator>(makeIterator(index),
+                                             makeIterator(index + 1));
+                                                                      // RETURN
+    }
+
+    return bsl::pair<iterator, iterator>(makeIterator(index),
+                                         makeIterator(index));
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t FlatMap<KEY, VALUE, COMPARATOR>::erase(const KEY& key)
+{
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    if (index < d_keys.size() && !d_comparator(key, d_keys[index])) {
+        d_keys.erase(d_keys.begin() + index);
+        d_values.erase(d_values.begin() + index);
+        return 1;                                                     // RETURN
+    }
+    return 0;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    const bsl::size_t index = position.keyAddress() - d_keys.data();
+
+    d_keys.erase(d_keys.begin() + index);
+    d_values.erase(d_values.begin() + index);
+
+    return makeIterator(index);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::erase(iterator position)
+{
+    // Note that this overload is required to avoid ambiguity when the key is
+    // an iterator.
+
+    return erase(const_iterator(position));
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::erase(const_iterator first,
+                                       const_iterator last)
+{
+    BSLS_ASSERT_SAFE(first <= last);
+
+    const bsl::size_t index  = first.keyAddress() - d_keys.data();
+    const bsl::size_t length = last - first;
+
+    d_keys.erase(d_keys.begin() + index, d_keys.begin() + index + length);
+    d_values.erase(d_values.begin() + index,
+                   d_values.begin() + index + length);
+
+    return makeIterator(index);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::find(const KEY& key)
+{
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    if (index < d_keys.size() && !d_comparator(key, d_keys[index])) {
+        return makeIterator(index);                                   // RETURN
+    }
+    return end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+void FlatMap<KEY, VALUE, COMPARATOR>::insert(INPUT_ITERATOR first,
+                                             INPUT_ITERATOR last)
+{
+    insertRange(first, last, false);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+void FlatMap<KEY, VALUE, COMPARATOR>::insert(SortedUniqueTag ,
+                                             INPUT_ITERATOR  first,
+                                             INPUT_ITERATOR  last)
+{
+    insertRange(first, last, true);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMap<KEY, VALUE, COMPARATOR>::insert(
+                                     bsl::initializer_list<value_type> values)
+{
+    insertRange(values.begin(), values.end(), false);
+}
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class KEY, class VALUE, class COMPARATOR>
+template <class... ARGS>
+inline
+bsl::pair<typename FlatMap<KEY, VALUE, COMPARATOR>::iterator, bool>
+FlatMap<KEY, VALUE, COMPARATOR>::emplace(ARGS&&... args)
+{
+    bsls::ObjectBuffer<value_type> buffer;
+
+    bslma::ConstructionUtil::construct(
+                                    buffer.address(),
+                                    allocator(),
+                                    BSLS_COMPILERFEATURES_FORWARD(ARGS,
+                                                                  args)...);
+
+    bslma::DestructorGuard<value_type> guard(buffer.address());
+
+    return insert(MoveUtil::move(buffer.object()));
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::lower_bound(const KEY& key)
+{
+    return makeIterator(lowerBoundIndex(key));
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMap<KEY, VALUE, COMPARATOR>::reserve(bsl::size_t numElements)
+{
+    d_keys.reserve(numElements);
+    d_values.reserve(numElements);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::upper_bound(const KEY& key)
+{
+    return makeIterator(upperBoundIndex(key));
+}
+
+                          // Iterators
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::begin()
+{
+    return makeIterator(0);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::end()
+{
+    return makeIterator(d_keys.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::reverse_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::reverse_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+                             // Aspects
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMap<KEY, VALUE, COMPARATOR>::swap(FlatMap& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    d_keys.swap(other.d_keys);
+    d_values.swap(other.d_values);
+    bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+const VALUE& FlatMap<KEY, VALUE, COMPARATOR>::at(const KEY& key) const
+{
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    if (index == d_keys.size() || d_comparator(key, d_keys[index])) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                        "FlatMap<...>::at(key_type) const: invalid key value");
+    }
+
+    return d_values[index];
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t FlatMap<KEY, VALUE, COMPARATOR>::capacity() const
+{
+    return d_keys.capacity() < d_values.capacity() ? d_keys.capacity()
+                                                   : d_values.capacity();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool FlatMap<KEY, VALUE, COMPARATOR>::contains(const KEY& key) const
+{
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    return index < d_keys.size() && !d_comparator(key, d_keys[index]);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t FlatMap<KEY, VALUE, COMPARATOR>::count(const KEY& key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool FlatMap<KEY, VALUE, COMPARATOR>::empty() const
+{
+    return d_keys.empty();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::pair<typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator,
+          typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator>
+FlatMap<KEY, VALUE, COMPARATOR>::equal_range(const KEY& key) const
+{
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    if (index < d_keys.size() && !d_comparator(key, d_keys[index])) {
+        return bsl::pair<const_iterator, const_iterator>(
+                                                      makeIterator(index),
+                                                      makeIterator(index + 1));
+                                                                      // RETURN
+    }
+
+    return bsl::pair<const_iterator, const_iterator>(makeIterator(index),
+                                                     makeIterator(index));
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::find(const KEY& key) const
+{
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    if (index < d_keys.size() && !d_comparator(key, d_keys[index])) {
+        return makeIterator(index);                                   // RETURN
+    }
+    return end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+COMPARATOR FlatMap<KEY, VALUE, COMPARATOR>::key_comp() const
+{
+    return d_comparator;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+const bsl::vector<KEY>& FlatMap<KEY, VALUE, COMPARATOR>::keys() const
+{
+    return d_keys;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::lower_bound(const KEY& key) const
+{
+    return makeIterator(lowerBoundIndex(key));
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t FlatMap<KEY, VALUE, COMPARATOR>::size() const
+{
+    return d_keys.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::upper_bound(const KEY& key) const
+{
+    return makeIterator(upperBoundIndex(key));
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+const bsl::vector<VALUE>& FlatMap<KEY, VALUE, COMPARATOR>::values() const
+{
+    return d_values;
+}
+
+                          // Iterators
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::begin() const
+{
+    return makeIterator(0);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::cbegin() const
+{
+    return makeIterator(0);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::end() const
+{
+    return makeIterator(d_keys.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::cend() const
+{
+    return makeIterator(d_keys.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_reverse_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_reverse_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::crbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_reverse_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_reverse_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::crend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+                             // Aspects
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bslma::Allocator *FlatMap<KEY, VALUE, COMPARATOR>::allocator() const
+{
+    return d_keys.get_allocator().mechanism();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+bsl::ostream& FlatMap<KEY, VALUE, COMPARATOR>::print(
+                                            bsl::ostream& stream,
+                                            int           level,
+                                            int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;                                                // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+
+    printer.start();
+
+    for (bsl::size_t i = 0; i < d_keys.size(); ++i) {
+        printer.printValue(bsl::pair<const KEY&, const VALUE&>(d_keys[i],
+                                                               d_values[i]));
+    }
+
+    printer.end();
+
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool bdlc::operator==(const FlatMap<KEY, VALUE, COMPARATOR>& lhs,
+                      const FlatMap<KEY, VALUE, COMPARATOR>& rhs)
+{
+    return lhs.d_keys == rhs.d_keys && lhs.d_values == rhs.d_values;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool bdlc::operator!=(const FlatMap<KEY, VALUE, COMPARATOR>& lhs,
+                      const FlatMap<KEY, VALUE, COMPARATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool bdlc::operator<(const FlatMap<KEY, VALUE, COMPARATOR>& lhs,
+                     const FlatMap<KEY, VALUE, COMPARATOR>& rhs)
+{
+    const bsl::size_t length = lhs.size() < rhs.size() ? lhs.size()
+                                                       : rhs.size();
+
+    for (bsl::size_t i = 0; i < length; ++i) {
+        if (lhs.d_keys[i] < rhs.d_keys[i]) {
+            return true;                                              // RETURN
+        }
+        if (rhs.d_keys[i] < lhs.d_keys[i]) {
+            return false;                                             // RETURN
+        }
+        if (lhs.d_values[i] < rhs.d_values[i]) {
+            return true;                                              // RETURN
+        }
+        if (rhs.d_values[i] < lhs.d_values[i]) {
+            return false;                                             // RETURN
+        }
+    }
+    return lhs.size() < rhs.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::ostream& bdlc::operator<<(bsl::ostream&                          stream,
+                               const FlatMap<KEY, VALUE, COMPARATOR>& map)
+{
+    return map.print(stream, 0, -1);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void bdlc::swap(FlatMap<KEY, VALUE, COMPARATOR>& a,
+                FlatMap<KEY, VALUE, COMPARATOR>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    typedef FlatMap<KEY, VALUE, COMPARATOR> Map;
+
+    Map futureA(b, a.allocator());
+    Map futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslalg {
+
+template <class KEY, class VALUE, class COMPARATOR>
+struct HasStlIterators<bdlc::FlatMap<KEY, VALUE, COMPARATOR> >
+: bsl::true_type {
+};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class VALUE, class COMPARATOR>
+struct UsesBslmaAllocator<bdlc::FlatMap<KEY, VALUE, COMPARATOR> >
+: bsl::true_type {
+};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1455 @@
+// bdlc_flatmap.t.cpp                                                 -*-C++-*-
+
+#include <bdlc_flatmap.h>
+
+#include <bslalg_hasstliterators.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <bsl_initializer_list.h>
+#endif
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_map.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+#if defined(BDE_BUILD_TARGET_EXC)
+#include <stdexcept>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines an ordered map stored in two parallel
+// sorted arrays.  The lookup algorithms are provided by 'bdlc::FlatSortedUtil'
+// and the iterators by 'bdlc::FlatMap_Iterator' (both tested in their own
+// components), so the primary concern is that the arrays remain sorted and
+// parallel through every manipulation, including the bulk insertion that
+// merges a range with the existing elements.  Most test cases therefore
+// compare the behavior of 'bdlc::FlatMap' against that of 'bsl::map' over
+// randomized sequences of operations.
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//: o Any allocated memory is always from the object allocator.
+//: o Injected exceptions are safely propagated during memory allocation.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatMap();
+// [ 2] FlatMap(bslma::Allocator *basicAllocator);
+// [ 2] FlatMap(const COMPARATOR&, bslma::Allocator * = 0);
+// [ 5] FlatMap(INPUT_ITERATOR, INPUT_ITERATOR, bslma::Allocator * = 0);
+// [ 5] FlatMap(II, II, const COMPARATOR&, bslma::Allocator * = 0);
+// [ 9] FlatMap(SortedUniqueTag, II, II, bslma::Allocator * = 0);
+// [ 9] FlatMap(SortedUniqueTag, II, II, const COMPARATOR&, Allocator *);
+// #if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+// [ 5] FlatMap(bsl::initializer_list<v_t>, bslma::Allocator * = 0);
+// [ 5] FlatMap(init_list<v_t>, const COMPARATOR&, bslma::Allocator * = 0);
+// #endif
+// [ 4] FlatMap(const FlatMap&, bslma::Allocator *bA = 0);
+// [ 4] FlatMap(MovableRef<FlatMap>);
+// [ 4] FlatMap(MovableRef<FlatMap>, bslma::Allocator *basicAllocator);
+// [ 2] ~FlatMap();
+//
+// MANIPULATORS
+// [ 4] FlatMap& operator=(const FlatMap&);
+// [ 4] FlatMap& operator=(MovableRef<FlatMap>);
+// #if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+// [ 5] FlatMap& operator=(bsl::initializer_list<v_t> values);
+// #endif
+// [ 3] VALUE& operator[](FORWARD_REF(KEY_TYPE) key);
+// [ 3] VALUE& at(const KEY& key);
+// [ 2] void clear();
+// [ 6] pair<iterator, iterator> equal_range(const KEY& key);
+// [ 2] size_t erase(const KEY& key);
+// [ 2] iterator erase(const_iterator position);
+// [ 2] iterator erase(iterator position);
+// [ 2] iterator erase(const_iterator first, const_iterator last);
+// [ 2] iterator find(const KEY& key);
+// [ 2] pair<iterator, bool> insert(FORWARD_REF(VALUE_TYPE) value);
+// [ 5] iterator insert(const_iterator, FORWARD_REF(VALUE_TYPE) value);
+// [ 5] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 9] void insert(SortedUniqueTag, INPUT_ITERATOR, INPUT_ITERATOR);
+// #if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+// [ 5] void insert(bsl::initializer_list<value_type> values);
+// #endif
+// [ 3] pair<iterator, bool> emplace(ARGS&&... args);
+// [ 6] iterator lower_bound(const KEY& key);
+// [ 9] void reserve(size_t numElements);
+// [ 6] iterator upper_bound(const KEY& key);
+// [ 6] iterator begin();
+// [ 6] iterator end();
+// [ 6] reverse_iterator rbegin();
+// [ 6] reverse_iterator rend();
+// [ 4] void swap(FlatMap& other);
+//
+// ACCESSORS
+// [ 3] const VALUE& at(const KEY& key) const;
+// [ 9] size_t capacity() const;
+// [ 2] bool contains(const KEY& key) const;
+// [ 2] size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 6] pair<c_iter, c_iter> equal_range(const KEY& key) const;
+// [ 2] const_iterator find(const KEY& key) const;
+// [ 2] COMPARATOR key_comp() const;
+// [ 9] const bsl::vector<KEY>& keys() const;
+// [ 6] const_iterator lower_bound(const KEY& key) const;
+// [ 2] size_t size() const;
+// [ 6] const_iterator upper_bound(const KEY& key) const;
+// [ 9] const bsl::vector<VALUE>& values() const;
+// [ 6] const_iterator begin() const;
+// [ 6] const_iterator cbegin() const;
+// [ 6] const_iterator end() const;
+// [ 6] const_iterator cend() const;
+// [ 6] const_reverse_iterator rbegin() const;
+// [ 6] const_reverse_iterator crbegin() const;
+// [ 6] const_reverse_iterator rend() const;
+// [ 6] const_reverse_iterator crend() const;
+// [ 2] bslma::Allocator *allocator() const;
+// [ 7] ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const FlatMap&, const FlatMap&);
+// [ 4] bool operator!=(const FlatMap&, const FlatMap&);
+// [ 4] bool operator<(const FlatMap&, const FlatMap&);
+// [ 7] ostream& operator<<(ostream& stream, const FlatMap& map);
+//
+// FREE FUNCTIONS
+// [ 4] void swap(FlatMap&, FlatMap&);
+// ----------------------------------------------------------------------------
+// [10] USAGE EXAMPLE
+// [ 8] CONCERN: 'FlatMap' has the necessary type traits
+// [ 1] BREATHING TEST
+// [ 9] CONCERN: bulk insertion is exception neutral
+// [-1] PERFORMANCE TEST
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT  BSLIM_TESTUTIL_ASSERT
+#define ASSERTV BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q  BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P  BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_ BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_ BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_ BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool verbose;
+bool veryVerbose;
+bool veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatMap<int, bsl::string> Obj;
+typedef bsl::map<int, bsl::string>       Model;
+
+const char *const LONG = "a string long enough to require allocation ";
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+template <class MAP, class MODEL>
+bool sameValue(const MAP& map, const MODEL& model)
+    // Return 'true' if the specified 'map' holds the same sequence of
+    // key-value pairs as the specified 'model', and 'false' otherwise.
+{
+    if (map.size() != model.size()) {
+        return false;                                                 // RETURN
+    }
+
+    typename MODEL::const_iterator jt = model.begin();
+    for (typename MAP::const_iterator it = map.begin();
+                                                 it != map.end(); ++it, ++jt) {
+        if (it->first != jt->first || it->second != jt->second) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+bsl::string makeValue(int i, bslma::Allocator *basicAllocator)
+    // Return a string, that requires allocation, uniquely determined by the
+    // specified 'i', using the specified 'basicAllocator' to supply memory.
+{
+    bsl::ostringstream oss(basicAllocator);
+    oss << LONG << i;
+    return bsl::string(oss.str(), basicAllocator);
+}
+
+static unsigned int s_antiOptimization = 0;
+
+double toDouble(const bsls::TimeInterval& duration)
+    // Return the specified 'duration' in nanoseconds.
+{
+    return static_cast<double>(duration.totalNanoseconds());
+}
+
+template <class MAP>
+bsls::TimeInterval performanceBuild(
+                            MAP                                       *map,
+                            const bsl::vector<bsl::pair<int, int> >&  values)
+    // Insert into the specified 'map' each of the specified 'values' using
+    // range insertion, and return the duration of the insertion.
+{
+    bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+    map->insert(values.begin(), values.end());
+
+    return bsls::SystemTime::nowMonotonicClock() - start;
+}
+
+template <class MAP>
+bsls::TimeInterval performanceFind(const MAP&              map,
+                                   const bsl::vector<int>& keys)
+    // Invoke 'find' on the specified 'map' for each of the specified 'keys'
+    // several times, and return the median duration of a pass over 'keys'.
+{
+    const int NUM_TRIAL = 11;
+
+    bsl::vector<bsls::TimeInterval> results;
+    for (int trial = 0; trial < NUM_TRIAL; ++trial) {
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+        for (bsl::size_t i = 0; i < keys.size(); ++i) {
+            typename MAP::const_iterator it = map.find(keys[i]);
+            if (it != map.end()) {
+                s_antiOptimization += it->second;
+            }
+        }
+
+        results.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+    }
+
+    bsl::sort(results.begin(), results.end());
+
+    return results[NUM_TRIAL / 2];
+}
+
+template <class MAP>
+bsls::TimeInterval performanceIterate(const MAP& map)
+    // Iterate over the specified 'map' several times, and return the median
+    // duration of a complete iteration.
+{
+    const int NUM_TRIAL = 11;
+
+    bsl::vector<bsls::TimeInterval> results;
+    for (int trial = 0; trial < NUM_TRIAL; ++trial) {
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+        for (typename MAP::const_iterator it = map.begin();
+                                                      it != map.end(); ++it) {
+            s_antiOptimization += it->second;
+        }
+
+        results.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+    }
+
+    bsl::sort(results.begin(), results.end());
+
+    return results[NUM_TRIAL / 2];
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 10: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator         oa("object", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&oa);
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Building a Read-Mostly Lookup Table
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a table of reference prices, keyed by an integral
+// security identifier, that is loaded in large batches from a source that
+// delivers the securities in identifier order, and is queried very frequently.
+//
+// First, we define an alias for the table, and create an (empty) table:
+//..
+    typedef bdlc::FlatMap<int, double> PriceTable;
+
+    PriceTable prices;
+//..
+// Then, we load the first batch of prices.  Since the batch is sorted by
+// identifier and contains no duplicate identifiers, we supply a
+// 'bdlc::SortedUniqueTag' to the insertion, which merges the batch with the
+// contents of the table in linear time:
+//..
+    const bsl::pair<int, double> BATCH1[] = {
+        bsl::make_pair(1001, 10.25),
+        bsl::make_pair(1007, 99.50),
+        bsl::make_pair(1013, 47.00),
+        bsl::make_pair(1021,  3.75),
+    };
+    const int NUM_BATCH1 = sizeof BATCH1 / sizeof *BATCH1;
+
+    prices.insert(bdlc::SortedUniqueTag(), BATCH1, BATCH1 + NUM_BATCH1);
+    ASSERT(4 == prices.size());
+//..
+// Next, we load a second batch, in which the price for security 1007 is
+// repeated.  As with 'insert' of a single value, the element already in the
+// table is retained:
+//..
+    const bsl::pair<int, double> BATCH2[] = {
+        bsl::make_pair(1003, 12.00),
+        bsl::make_pair(1007, 98.00),
+        bsl::make_pair(1030, 61.25),
+    };
+    const int NUM_BATCH2 = sizeof BATCH2 / sizeof *BATCH2;
+
+    prices.insert(bdlc::SortedUniqueTag(), BATCH2, BATCH2 + NUM_BATCH2);
+    ASSERT(6     == prices.size());
+    ASSERT(99.50 == prices.at(1007));
+//..
+// Now, we look up prices, and update one of them in place:
+//..
+    PriceTable::const_iterator it = prices.find(1013);
+    ASSERT(prices.end() != it);
+    ASSERT(47.00 == it->second);
+
+    ASSERT(prices.end() == prices.find(1014));
+
+    prices[1021] = 4.00;
+    ASSERT(4.00 == prices.at(1021));
+//..
+// Finally, we observe that the identifiers are stored contiguously, in order:
+//..
+    const bsl::vector<int>& ids = prices.keys();
+    ASSERT(1001 == ids.front());
+    ASSERT(1030 == ids.back());
+    ASSERT(1003 == ids[1]);
+//..
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // BULK INSERTION
+        //
+        // Concerns:
+        //: 1 Range insertion, with or without 'SortedUniqueTag', yields the
+        //:   same value as inserting each element of the range in turn.
+        //:
+        //: 2 An element of the range whose key is equivalent to that of an
+        //:   element of the map, or of an earlier element of the range, is not
+        //:   inserted.
+        //:
+        //: 3 The keys and mapped values remain parallel, and are available
+        //:   through 'keys' and 'values'.
+        //:
+        //: 4 'reserve' increases the capacity, and does not change the value.
+        //:
+        //: 5 Bulk insertion is exception neutral and, should an exception be
+        //:   thrown, leaves the map in a valid state.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a variety of sizes of map and of range, insert random sorted
+        //:   and unsorted ranges, and compare with 'bsl::map'.  (C-1..3)
+        //:
+        //: 2 Reserve capacity, and verify the capacity and value.  (C-4)
+        //:
+        //: 3 Use the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST' macros, verifying
+        //:   after each exception that the map is sorted and that its arrays
+        //:   are parallel.  (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a 'SortedUniqueTag' range that is not sorted.
+        //:   (C-6)
+        //
+        // Testing:
+        //   FlatMap(SortedUniqueTag, II, II, bslma::Allocator * = 0);
+        //   FlatMap(SortedUniqueTag, II, II, const COMPARATOR&, Allocator *);
+        //   void insert(SortedUniqueTag, INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void reserve(size_t numElements);
+        //   size_t capacity() const;
+        //   const bsl::vector<KEY>& keys() const;
+        //   const bsl::vector<VALUE>& values() const;
+        //   CONCERN: bulk insertion is exception neutral
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BULK INSERTION" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        typedef bsl::pair<int, bsl::string> Value;
+
+        bsl::srand(9);
+        for (int n = 0; n < 200; n += 1 + n / 2) {
+            for (int m = 0; m < 200; m += 1 + m / 2) {
+                Obj   mX(&oa);  const Obj&   X = mX;
+                Model mY(&oa);  const Model& Y = mY;
+
+                for (int i = 0; i < n; ++i) {
+                    const int key = bsl::rand() % 400;
+                    mX.insert(bsl::make_pair(key, makeValue(i, &oa)));
+                    mY.insert(bsl::make_pair(key, makeValue(i, &oa)));
+                }
+
+                bsl::vector<Value> range(&oa);
+                for (int i = 0; i < m; ++i) {
+                    range.push_back(Value(bsl::rand() % 400,
+                                          makeValue(1000 + i, &oa)));
+                }
+
+                Obj mZ(X, &oa);  const Obj& Z = mZ;
+
+                mX.insert(range.begin(), range.end());
+                for (bsl::size_t i = 0; i < range.size(); ++i) {
+                    mY.insert(range[i]);
+                }
+                ASSERTV(n, m, sameValue(X, Y));
+                ASSERTV(n, m, X.keys().size() == X.values().size());
+
+                // Remove the duplicate keys from the range, and sort it.
+
+                Model unique(range.begin(), range.end(), &oa);
+
+                range.assign(unique.begin(), unique.end());
+
+                mZ.insert(bdlc::SortedUniqueTag(), range.begin(), range.end());
+                ASSERTV(n, m, X == Z);
+
+                Obj mW(bdlc::SortedUniqueTag(),
+                       range.begin(),
+                       range.end(),
+                       &oa);
+                const Obj& W = mW;
+                ASSERTV(n, m, sameValue(W, unique));
+                ASSERTV(n, m, &oa == W.allocator());
+
+                for (bsl::size_t i = 0; i < W.size(); ++i) {
+                    ASSERTV(n, m, i, range[i].first  == W.keys()[i]);
+                    ASSERTV(n, m, i, range[i].second == W.values()[i]);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTesting with a comparator." << endl;
+        {
+            typedef bdlc::FlatMap<int, int, bsl::greater<int> > RevObj;
+
+            const bsl::pair<int, int> DATA[] = {
+                bsl::make_pair(9, 90),
+                bsl::make_pair(5, 50),
+                bsl::make_pair(2, 20),
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            RevObj mX(bdlc::SortedUniqueTag(),
+                      DATA,
+                      DATA + NUM_DATA,
+                      bsl::greater<int>(),
+                      &oa);
+            const RevObj& X = mX;
+            ASSERT(3  == X.size());
+            ASSERT(9  == X.begin()->first);
+            ASSERT(20 == X.at(2));
+
+            const bsl::pair<int, int> MORE[] = {
+                bsl::make_pair(7, 70),
+                bsl::make_pair(5, 51),
+                bsl::make_pair(1, 10),
+            };
+            const int NUM_MORE = sizeof MORE / sizeof *MORE;
+
+            mX.insert(bdlc::SortedUniqueTag(), MORE, MORE + NUM_MORE);
+            ASSERT(5  == X.size());
+            ASSERT(50 == X.at(5));
+            ASSERT(7  == X.keys()[1]);
+            ASSERT(1  == X.keys()[4]);
+        }
+
+        if (verbose) cout << "\tTesting 'reserve'." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            mX[1] = LONG;
+
+            mX.reserve(100);
+            ASSERT(100  <= X.capacity());
+            ASSERT(1    == X.size());
+            ASSERT(LONG == X.at(1));
+
+            const bsls::Types::Int64 numAllocations = oa.numAllocations();
+            for (int i = 2; i <= 100; ++i) {
+                mX[i];
+            }
+            ASSERT(numAllocations == oa.numAllocations());
+
+            mX.reserve(10);
+            ASSERT(100 <= X.capacity());
+        }
+
+        if (verbose) cout << "\tTesting exception neutrality." << endl;
+        {
+            bsl::vector<Value> range(&oa);
+            for (int i = 0; i < 40; ++i) {
+                range.push_back(Value((i * 13) % 50, makeValue(i, &oa)));
+            }
+
+            Model expected(&oa);
+            for (int i = 0; i < 50; i += 3) {
+                expected[i] = LONG;
+            }
+            expected.insert(range.begin(), range.end());
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                Obj mX(&oa);  const Obj& X = mX;
+                for (int i = 0; i < 50; i += 3) {
+                    mX[i] = LONG;
+                }
+
+                try {
+                    mX.insert(range.begin(), range.end());
+                }
+                catch (...) {
+                    ASSERT(X.keys().size() == X.values().size());
+                    ASSERT(bdlc::FlatSortedUtil::isSortedUnique(
+                                                           X.keys().begin(),
+                                                           X.keys().end(),
+                                                           X.key_comp()));
+                    throw;
+                }
+                ASSERT(sameValue(X, expected));
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bsl::pair<int, int> DATA[] = {
+                bsl::make_pair(1, 10),
+                bsl::make_pair(3, 30),
+                bsl::make_pair(3, 31),
+                bsl::make_pair(2, 20),
+            };
+
+            typedef bdlc::FlatMap<int, int> IntObj;
+
+            IntObj mX(&oa);
+
+            ASSERT_SAFE_PASS(mX.insert(bdlc::SortedUniqueTag(),
+                                       DATA,
+                                       DATA + 2));
+            ASSERT_SAFE_FAIL(mX.insert(bdlc::SortedUniqueTag(),
+                                       DATA + 1,
+                                       DATA + 3));
+            ASSERT_SAFE_FAIL(mX.insert(bdlc::SortedUniqueTag(),
+                                       DATA + 2,
+                                       DATA + 4));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TYPE TRAITS
+        //
+        // Concerns:
+        //: 1 'FlatMap' has the expected type traits.
+        //
+        // Plan:
+        //: 1 Use 'BSLMF_ASSERT' to verify the traits.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: 'FlatMap' has the necessary type traits
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TYPE TRAITS" << endl
+                          << "===========" << endl;
+
+        BSLMF_ASSERT(bslalg::HasStlIterators<Obj>::value);
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // PRINT AND OUTPUT OPERATOR
+        //
+        // Concerns:
+        //: 1 'print' and 'operator<<' write each element, in order, in the
+        //:   standard BDE format.
+        //
+        // Plan:
+        //: 1 Print maps having zero, one, and two elements on one line, and
+        //:   compare with the expected output.  (C-1)
+        //
+        // Testing:
+        //   ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+        //   ostream& operator<<(ostream& stream, const FlatMap& map);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRINT AND OUTPUT OPERATOR" << endl
+                          << "=========================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        typedef bdlc::FlatMap<int, int> IntObj;
+
+        IntObj mX(&oa);  const IntObj& X = mX;
+
+        {
+            bsl::ostringstream oss(&oa);
+            oss << X;
+            ASSERTV(oss.str(), "[ ]" == oss.str());
+        }
+
+        mX[2] = 20;
+        mX[1] = 10;
+
+        {
+            bsl::ostringstream oss(&oa);
+            oss << X;
+            ASSERTV(oss.str(), "[ [ 1 10 ] [ 2 20 ] ]" == oss.str());
+        }
+        {
+            bsl::ostringstream oss(&oa);
+            X.print(oss, 0, -1);
+            ASSERTV(oss.str(), "[ [ 1 10 ] [ 2 20 ] ]" == oss.str());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // ITERATORS AND BOUNDS
+        //
+        // Concerns:
+        //: 1 The iterators (including the reverse iterators) traverse the
+        //:   elements in the order of the comparator.
+        //:
+        //: 2 'lower_bound', 'upper_bound', and 'equal_range' agree with
+        //:   'bsl::map'.
+        //:
+        //: 3 A mapped value can be modified through an 'iterator'.
+        //
+        // Plan:
+        //: 1 Populate a map and a 'bsl::map' with the same random elements,
+        //:   and compare the iteration sequences and bounds.  (C-1..3)
+        //
+        // Testing:
+        //   pair<iterator, iterator> equal_range(const KEY& key);
+        //   iterator lower_bound(const KEY& key);
+        //   iterator upper_bound(const KEY& key);
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   pair<c_iter, c_iter> equal_range(const KEY& key) const;
+        //   const_iterator lower_bound(const KEY& key) const;
+        //   const_iterator upper_bound(const KEY& key) const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   const_reverse_iterator crend() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ITERATORS AND BOUNDS" << endl
+                          << "====================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        typedef bdlc::FlatMap<int, int> IntObj;
+        typedef bsl::map<int, int>       IntModel;
+
+        IntObj   mX(&oa);  const IntObj& X = mX;
+        IntModel mY(&oa);  const IntModel& Y = mY;
+
+        bsl::srand(5);
+        for (int i = 0; i < 3000; ++i) {
+            const int key = bsl::rand() % 5000 * 2;
+            mX.insert(bsl::make_pair(key, i));
+            mY.insert(bsl::make_pair(key, i));
+        }
+
+        for (IntObj::iterator it = mX.begin(); it != mX.end(); ++it) {
+            it->second *= 3;
+        }
+        for (IntModel::iterator it = mY.begin(); it != mY.end(); ++it) {
+            it->second *= 3;
+        }
+        ASSERT(sameValue(X, Y));
+
+        ASSERT(X.cbegin() == X.begin());
+        ASSERT(X.cend()   == X.end());
+        ASSERT(static_cast<bsl::size_t>(bsl::distance(X.begin(), X.end()))
+                                                                == X.size());
+
+        {
+            IntModel::const_reverse_iterator jt = Y.rbegin();
+            for (IntObj::const_reverse_iterator it = X.crbegin();
+                                                 it != X.crend(); ++it, ++jt) {
+                ASSERTV(it->first, it->first  == jt->first);
+                ASSERTV(it->first, it->second == jt->second);
+            }
+            ASSERT(jt == Y.rend());
+            ASSERT(X.rbegin() == X.crbegin());
+            ASSERT(X.rend()   == X.crend());
+            ASSERT(bsl::distance(mX.rbegin(), mX.rend()) ==
+                                            bsl::distance(X.begin(), X.end()));
+        }
+
+        for (int key = -1; key <= 10001; ++key) {
+            ASSERTV(key, bsl::distance(Y.begin(), Y.lower_bound(key)) ==
+                                 bsl::distance(X.begin(), X.lower_bound(key)));
+            ASSERTV(key, bsl::distance(Y.begin(), Y.upper_bound(key)) ==
+                                 bsl::distance(X.begin(), X.upper_bound(key)));
+            ASSERTV(key, mX.lower_bound(key) == X.lower_bound(key));
+            ASSERTV(key, mX.upper_bound(key) == X.upper_bound(key));
+
+            bsl::pair<IntObj::iterator, IntObj::iterator> range =
+                                                          mX.equal_range(key);
+            ASSERTV(key, range.first  == X.lower_bound(key));
+            ASSERTV(key, range.second == X.upper_bound(key));
+            ASSERTV(key, X.equal_range(key).first  == X.lower_bound(key));
+            ASSERTV(key, X.equal_range(key).second == X.upper_bound(key));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // RANGE AND INITIALIZER-LIST CREATORS AND INSERTION
+        //
+        // Concerns:
+        //: 1 The range and initializer-list constructors and 'insert' methods
+        //:   insert each element whose key is not already present, and ignore
+        //:   the others.
+        //:
+        //: 2 The comparator and allocator supplied at construction are used.
+        //:
+        //: 3 Insertion with a hint inserts the value, and returns an iterator
+        //:   to the element having the key of the value.
+        //
+        // Plan:
+        //: 1 Construct maps from ranges and initializer lists containing
+        //:   duplicate keys, and compare with 'bsl::map'.  (C-1,2)
+        //:
+        //: 2 Insert values with hints, and verify the results.  (C-3)
+        //
+        // Testing:
+        //   FlatMap(INPUT_ITERATOR, INPUT_ITERATOR, bslma::Allocator * = 0);
+        //   FlatMap(II, II, const COMPARATOR&, bslma::Allocator * = 0);
+        //   FlatMap(bsl::initializer_list<v_t>, bslma::Allocator * = 0);
+        //   FlatMap(init_list<v_t>, const COMPARATOR&, bslma::Allocator *);
+        //   FlatMap& operator=(bsl::initializer_list<v_t> values);
+        //   iterator insert(const_iterator, FORWARD_REF(VALUE_TYPE) value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void insert(bsl::initializer_list<value_type> values);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                << "RANGE AND INITIALIZER-LIST CREATORS AND INSERTION" << endl
+                << "=================================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            bsl::vector<bsl::pair<int, int> > values(&oa);
+            for (int i = 0; i < 1000; ++i) {
+                values.push_back(bsl::make_pair((i * 7) % 400, i));
+            }
+            bsl::map<int, int> model(values.begin(), values.end(), &oa);
+
+            typedef bdlc::FlatMap<int, int> IntObj;
+
+            IntObj mX(values.begin(), values.end(), &oa);
+            const IntObj& X = mX;
+            ASSERT(&oa == X.allocator());
+            ASSERT(sameValue(X, model));
+
+            typedef bdlc::FlatMap<int, int, bsl::greater<int> > RevObj;
+
+            RevObj mY(values.begin(), values.end(), bsl::greater<int>(), &oa);
+            const RevObj& Y = mY;
+            ASSERT(&oa == Y.allocator());
+            ASSERT(model.size() == Y.size());
+            ASSERT(model.rbegin()->first == Y.begin()->first);
+
+            IntObj mZ(&oa);  const IntObj& Z = mZ;
+            mZ.insert(values.begin(), values.end());
+            ASSERT(sameValue(Z, model));
+
+            IntObj::iterator it = mZ.insert(Z.begin(), bsl::make_pair(7, -1));
+            ASSERT(7 == it->first);
+            ASSERT(model[7] == it->second);
+
+            it = mZ.insert(Z.end(), bsl::make_pair(-7, -1));
+            ASSERT(-7 == it->first);
+            ASSERT(-1 == it->second);
+            ASSERT(model.size() + 1 == Z.size());
+        }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            typedef bdlc::FlatMap<int, int> IntObj;
+
+            IntObj mX({ {3, 30}, {1, 10}, {2, 20}, {1, 11} }, &oa);
+            const IntObj& X = mX;
+            ASSERT(3  == X.size());
+            ASSERT(10 == X.at(1));
+            ASSERT(&oa == X.allocator());
+
+            IntObj mY({ {3, 30}, {1, 10} }, bsl::less<int>(), &oa);
+            const IntObj& Y = mY;
+            ASSERT(2 == Y.size());
+
+            mY.insert({ {4, 40}, {3, 31} });
+            ASSERT(3  == Y.size());
+            ASSERT(30 == Y.at(3));
+
+            mY = { {5, 50} };
+            ASSERT(1  == Y.size());
+            ASSERT(50 == Y.at(5));
+        }
+#endif
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 Copies and moves have the value of the source, and use the
+        //:   expected allocator.
+        //:
+        //: 2 A move using the same allocator does not allocate.
+        //:
+        //: 3 'swap' exchanges the values of two maps.
+        //:
+        //: 4 The equality and less-than operators compare the sequences of
+        //:   elements.
+        //
+        // Plan:
+        //: 1 Create maps of various sizes and copy, move, swap, and compare
+        //:   them.  (C-1..4)
+        //
+        // Testing:
+        //   FlatMap(const FlatMap&, bslma::Allocator *bA = 0);
+        //   FlatMap(MovableRef<FlatMap>);
+        //   FlatMap(MovableRef<FlatMap>, bslma::Allocator *basicAllocator);
+        //   FlatMap& operator=(const FlatMap&);
+        //   FlatMap& operator=(MovableRef<FlatMap>);
+        //   void swap(FlatMap& other);
+        //   bool operator==(const FlatMap&, const FlatMap&);
+        //   bool operator!=(const FlatMap&, const FlatMap&);
+        //   bool operator<(const FlatMap&, const FlatMap&);
+        //   void swap(FlatMap&, FlatMap&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, MOVE, SWAP, AND COMPARISON" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        for (int n = 0; n < 300; n += 1 + n / 2) {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < n; ++i) {
+                mX[i] = makeValue(i, &oa);
+            }
+
+            Obj mY(X, &za);  const Obj& Y = mY;
+            ASSERTV(n, &za == Y.allocator());
+            ASSERTV(n, X == Y);
+            ASSERTV(n, !(X != Y));
+            ASSERTV(n, !(X < Y) && !(Y < X));
+
+            {
+                const bsls::Types::Int64 numAllocations = oa.numAllocations();
+
+                Obj mZ(bslmf::MovableRefUtil::move(mX));  const Obj& Z = mZ;
+                ASSERTV(n, numAllocations == oa.numAllocations());
+                ASSERTV(n, &oa == Z.allocator());
+                ASSERTV(n, Y == Z);
+
+                mX = bslmf::MovableRefUtil::move(mZ);
+                ASSERTV(n, numAllocations == oa.numAllocations());
+                ASSERTV(n, Y == X);
+            }
+            {
+                Obj mZ(bslmf::MovableRefUtil::move(mY), &oa);
+                const Obj& Z = mZ;
+                ASSERTV(n, &oa == Z.allocator());
+                ASSERTV(n, X == Z);
+
+                mY = Z;
+                ASSERTV(n, X == Y);
+                ASSERTV(n, &za == Y.allocator());
+            }
+
+            if (0 < n) {
+                Obj mZ(X, &oa);  const Obj& Z = mZ;
+                mZ[n - 1] = "x";
+                ASSERTV(n, X != Z);
+                ASSERTV(n, X < Z);
+
+                mZ.swap(mX);
+                ASSERTV(n, Y == Z);
+                ASSERTV(n, Y != X);
+
+                swap(mX, mZ);
+                ASSERTV(n, Y == X);
+
+                mZ[n] = "y";
+                ASSERTV(n, X < Z);
+                ASSERTV(n, !(Z < X));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'operator[]', 'at', AND 'emplace'
+        //
+        // Concerns:
+        //: 1 'operator[]' returns a reference to the mapped value of the
+        //:   element having the key, inserting a default-constructed mapped
+        //:   value if no such element exists.
+        //:
+        //: 2 'at' returns a reference to the mapped value of the element
+        //:   having the key, and throws 'bsl::out_of_range' if there is none.
+        //:
+        //: 3 'emplace' inserts an element only if no element having an
+        //:   equivalent key exists.
+        //:
+        //: 4 All of the above are exception neutral.
+        //
+        // Plan:
+        //: 1 Exercise the methods on a map of strings, and verify the results.
+        //:   (C-1..3)
+        //:
+        //: 2 Use the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST' macros to verify
+        //:   exception neutrality.  (C-4)
+        //
+        // Testing:
+        //   VALUE& operator[](FORWARD_REF(KEY_TYPE) key);
+        //   VALUE& at(const KEY& key);
+        //   const VALUE& at(const KEY& key) const;
+        //   pair<iterator, bool> emplace(ARGS&&... args);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'operator[]', 'at', AND 'emplace'" << endl
+                          << "=================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 500; ++i) {
+                const int         key   = (i * 31) % 250;
+                const bsl::string VALUE = makeValue(key, &oa);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    mX[key] = VALUE;
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(i, VALUE == X.at(key));
+                ASSERTV(i, VALUE == mX.at(key));
+            }
+            ASSERT(250 == X.size());
+
+#if defined(BDE_BUILD_TARGET_EXC)
+            {
+                bool caught = false;
+                try {
+                    X.at(250);
+                }
+                catch (const std::out_of_range&) {
+                    caught = true;
+                }
+                ASSERT(caught);
+            }
+            {
+                bool caught = false;
+                try {
+                    mX.at(-1);
+                }
+                catch (const std::out_of_range&) {
+                    caught = true;
+                }
+                ASSERT(caught);
+            }
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+            {
+                bsl::pair<Obj::iterator, bool> rv = mX.emplace(250, LONG);
+                ASSERT(true  == rv.second);
+                ASSERT(250   == rv.first->first);
+                ASSERT(LONG  == rv.first->second);
+                ASSERT(&oa   == rv.first->second.allocator().mechanism());
+
+                rv = mX.emplace(250, "other");
+                ASSERT(false == rv.second);
+                ASSERT(LONG  == rv.first->second);
+            }
+#endif
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed map is empty and allocates no memory.
+        //:
+        //: 2 'insert', 'erase', and 'clear' yield the same value as the
+        //:   corresponding operations on 'bsl::map'.
+        //:
+        //: 3 The basic accessors report the value of the map.
+        //:
+        //: 4 The elements of the map use the allocator of the map.
+        //
+        // Plan:
+        //: 1 Perform a random sequence of insertions and erasures on a map
+        //:   and on a 'bsl::map', and compare the results and values.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   FlatMap();
+        //   FlatMap(bslma::Allocator *basicAllocator);
+        //   FlatMap(const COMPARATOR&, bslma::Allocator * = 0);
+        //   ~FlatMap();
+        //   void clear();
+        //   size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   iterator find(const KEY& key);
+        //   pair<iterator, bool> insert(FORWARD_REF(VALUE_TYPE) value);
+        //   bool contains(const KEY& key) const;
+        //   size_t count(const KEY& key) const;
+        //   bool empty() const;
+        //   const_iterator find(const KEY& key) const;
+        //   COMPARATOR key_comp() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+        {
+            const bsl::greater<int> comparator;
+
+            bdlc::FlatMap<int, int, bsl::greater<int> > mX(comparator);
+            ASSERT(true == mX.key_comp()(2, 1));
+            ASSERT(&defaultAllocator == mX.allocator());
+        }
+
+        {
+            Obj   mX(&oa);  const Obj&   X = mX;
+            Model mY(&oa);  const Model& Y = mY;
+
+            ASSERT(0    == oa.numBlocksTotal());
+            ASSERT(true == X.empty());
+            ASSERT(0    == X.size());
+            ASSERT(&oa  == X.allocator());
+
+            bsl::srand(3);
+            for (int i = 0; i < 10000; ++i) {
+                const int key = bsl::rand() % 2000;
+                const int op  = bsl::rand() % 10;
+
+                if (op < 5) {
+                    const bsl::string value = makeValue(i, &oa);
+
+                    bsl::pair<Obj::iterator, bool> rv =
+                                         mX.insert(bsl::make_pair(key, value));
+                    bsl::pair<Model::iterator, bool> exp =
+                                         mY.insert(bsl::make_pair(key, value));
+
+                    ASSERTV(i, exp.second == rv.second);
+                    ASSERTV(i, key == rv.first->first);
+                    ASSERTV(i, exp.first->second == rv.first->second);
+                    ASSERTV(i,
+                            &oa == rv.first->second.allocator().mechanism());
+                }
+                else if (op < 7) {
+                    ASSERTV(i, mY.erase(key) == mX.erase(key));
+                }
+                else if (op < 8) {
+                    Obj::iterator   it  = mX.find(key);
+                    Model::iterator exp = mY.find(key);
+
+                    ASSERTV(i, (Y.end() == exp) == (X.end() == it));
+                    if (X.end() != it) {
+                        Model::iterator expNext = mY.erase(exp);
+                        Obj::iterator   next    = 0 == i % 2
+                                                ? mX.erase(it)
+                                                : mX.erase(Obj::const_iterator(
+                                                                          it));
+                        ASSERTV(i, (Y.end() == expNext) == (X.end() == next));
+                        if (X.end() != next) {
+                            ASSERTV(i, expNext->first == next->first);
+                        }
+                    }
+                }
+                else if (op < 9) {
+                    Obj::iterator next = mX.erase(X.lower_bound(key),
+                                                  X.lower_bound(key + 20));
+                    mY.erase(Y.lower_bound(key), Y.lower_bound(key + 20));
+                    ASSERTV(i, next == X.lower_bound(key + 20));
+                }
+                else {
+                    ASSERTV(i, Y.count(key)      == X.count(key));
+                    ASSERTV(i, (0 < Y.count(key)) == X.contains(key));
+                    ASSERTV(i, (Y.end() == Y.find(key)) ==
+                                                     (X.end() == X.find(key)));
+                }
+
+                ASSERTV(i, Y.size()  == X.size());
+                ASSERTV(i, Y.empty() == X.empty());
+            }
+            ASSERT(sameValue(X, Y));
+
+            mX.clear();
+            ASSERT(0    == X.size());
+            ASSERT(true == X.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Instantiate an object and verify basic functionality.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        typedef bdlc::FlatMap<int, int> IntObj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        IntObj mX(&oa);  const IntObj& X = mX;
+
+        ASSERT(       0 == X.size());
+        ASSERT( X.end() == X.find(0));
+
+        {
+            bsl::pair<IntObj::iterator, bool> rv =
+                                               mX.insert(bsl::make_pair(0, 7));
+
+            ASSERT(       1 == X.size());
+            ASSERT(    true == rv.second);
+            ASSERT( X.end() != rv.first);
+            ASSERT(       0 == rv.first->first);
+            ASSERT(       7 == rv.first->second);
+            ASSERT(rv.first == X.find(0));
+            ASSERT( X.end() == X.find(1));
+        }
+
+        IntObj mY(X, &oa);  const IntObj& Y = mY;
+
+        ASSERT(      1 == Y.size());
+        ASSERT(      0 == Y.find(0)->first);
+        ASSERT(      7 == Y.find(0)->second);
+        ASSERT(Y.end() == Y.find(1));
+        ASSERT(      X == Y);
+        ASSERT(      Y == X);
+
+        {
+            bsl::size_t rv = mY.erase(0);
+
+            ASSERT(      1 == rv);
+            ASSERT(      0 == Y.size());
+            ASSERT(Y.end() == Y.find(0));
+            ASSERT(      X != Y);
+        }
+
+        for (int i = 0; i < 1000; ++i) {
+            mY[999 - i] = i;
+        }
+        ASSERT(1000 == Y.size());
+        ASSERT(   0 == Y.begin()->first);
+        ASSERT( 999 == Y.begin()->second);
+        ASSERT( 500 == Y.at(499));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Compare the performance and memory use of 'bdlc::FlatMap' with
+        //   that of 'bsl::map'.
+        //
+        // Concerns:
+        //: 1 'bdlc::FlatMap' uses substantially less memory than 'bsl::map'
+        //:   for small elements.
+        //:
+        //: 2 'bdlc::FlatMap' outperforms 'bsl::map' for 'find' and for
+        //:   iteration.
+        //
+        // Plan:
+        //: 1 Insert the same random keys into both containers, using test
+        //:   allocators, and compare the memory in use.  (C-1)
+        //:
+        //: 2 Time the range insertion of random keys, 'find' with keys both
+        //:   present and absent, and complete iteration, and report the
+        //:   results.  (C-2)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_KEYS = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        bslma::NewDeleteAllocator    na;
+        bslma::DefaultAllocatorGuard dag(&na);
+
+        bsl::vector<bsl::pair<int, int> > values;
+        bsl::vector<int>                  keys;
+        bsl::vector<int>                  absent;
+        bsl::srand(1);
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            const int key = static_cast<int>(
+                               ((static_cast<unsigned int>(bsl::rand()) << 15)
+                                ^ bsl::rand()) & 0x3fffffff);
+            values.push_back(bsl::make_pair(key * 2, i));
+            keys.push_back(key * 2);
+            absent.push_back(key * 2 + 1);
+        }
+
+        {
+            bslma::TestAllocator fa("flat", veryVeryVeryVerbose);
+            bslma::TestAllocator ma("map",  veryVeryVeryVerbose);
+
+            bdlc::FlatMap<int, int> mX(values.begin(), values.end(), &fa);
+            bsl::map<int, int>      mY(values.begin(), values.end(), &ma);
+
+            const double x = static_cast<double>(fa.numBytesInUse());
+            const double y = static_cast<double>(ma.numBytesInUse());
+
+            ASSERT(x < y);
+
+            cout << "memory: flat " << x / mX.size()
+                 << " bytes/element, map " << y / mY.size()
+                 << " bytes/element" << endl;
+        }
+
+        bdlc::FlatMap<int, int> mX;
+        bsl::map<int, int>      mY;
+
+        const char *NAMES[] = {
+            "insert (range)",
+            "find (present)",
+            "find (absent)",
+            "iterate"
+        };
+        const int NUM_NAMES = sizeof NAMES / sizeof *NAMES;
+
+        double x[NUM_NAMES];
+        double y[NUM_NAMES];
+
+        x[0] = toDouble(performanceBuild(&mX, values));
+        y[0] = toDouble(performanceBuild(&mY, values));
+        x[1] = toDouble(performanceFind(mX, keys));
+        y[1] = toDouble(performanceFind(mY, keys));
+        x[2] = toDouble(performanceFind(mX, absent));
+        y[2] = toDouble(performanceFind(mY, absent));
+        x[3] = toDouble(performanceIterate(mX));
+        y[3] = toDouble(performanceIterate(mY));
+
+        ASSERT(x[1] < y[1]);
+        ASSERT(x[3] < y[3]);
+
+        for (int i = 0; i < NUM_NAMES; ++i) {
+            cout << NAMES[i] << ": flat " << x[i] / NUM_KEYS
+                 << " ns/op, map " << y[i] / NUM_KEYS
+                 << " ns/op (flat is " << 100.0 * (y[i] - x[i]) / x[i]
+                 << "% faster)" << endl;
+        }
+
+        if (veryVeryVeryVerbose) {
+            cout << "anti-optimization: " << s_antiOptimization << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,514 @@
+// bdlc_flatmap_iterator.h                                            -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATMAP_ITERATOR
+#define INCLUDED_BDLC_FLATMAP_ITERATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a random-access iterator over parallel key/value arrays.
+//
+//@CLASSES:
+//   bdlc::FlatMap_Iterator: iterator over parallel arrays of keys and values
+//   bdlc::FlatMap_ArrowProxy: result of 'bdlc::FlatMap_Iterator::operator->'
+//
+//@SEE_ALSO: bdlc_flatmap, bdlc_flatmultimap
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bdlc::FlatMap_Iterator', implementing a random-access iterator over a pair
+// of parallel arrays, one of keys and one of mapped values, and a class
+// template, 'bdlc::FlatMap_ArrowProxy', returned by the arrow operator of the
+// iterator.  This component is an implementation detail of 'bdlc_flatmap'
+// and 'bdlc_flatmultimap', which store their keys and mapped values in
+// separate contiguous arrays, and is *not* intended for direct client use.
+//
+// Since a key and its mapped value are not stored in a single object, the
+// 'reference' type of the iterator is a *proxy*, 'bsl::pair<const KEY&,
+// VALUE&>', returned by value, that refers to the key and the mapped value of
+// an element.  The iterator therefore satisfies all of the requirements of a
+// random-access iterator except that 'reference' is not a true reference
+// type; in particular, 'it->second' and '(*it).second' are modifiable lvalues
+// (unless 'VALUE' is 'const'), but '&*it' is not the address of an element.
+//
+// A 'bdlc::FlatMap_Iterator<KEY, VALUE>' is implicitly convertible to a
+// 'bdlc::FlatMap_Iterator<KEY, const VALUE>', which is the type of the
+// 'const_iterator' of the flat map containers.
+//
+///Usage
+///-----
+// This component is an implementation detail of 'bdlc_flatmap' and
+// 'bdlc_flatmultimap' and is *not* intended for direct client use.  It is
+// subject to change without notice.  As such, a usage example is not
+// provided.
+
+#include <bdlscm_version.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_issame.h>
+#include <bslmf_removecv.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_iterator.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                         // ========================
+                         // class FlatMap_ArrowProxy
+                         // ========================
+
+template <class KEY, class VALUE>
+class FlatMap_ArrowProxy {
+    // This class holds the proxy returned by dereferencing a
+    // 'FlatMap_Iterator', and provides an arrow operator returning the
+    // address of that proxy, so that the members of the proxy can be accessed
+    // through the arrow operator of the iterator.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::pair<const KEY&, VALUE&> Proxy;
+
+  private:
+    // DATA
+    Proxy d_proxy;  // proxy for the element
+
+  public:
+    // CREATORS
+    explicit FlatMap_ArrowProxy(const Proxy& proxy);
+        // Create an arrow proxy holding the specified 'proxy'.
+
+    // ACCESSORS
+    const Proxy *operator->() const;
+        // Return the address of the proxy held by this object.
+};
+
+                          // ======================
+                          // class FlatMap_Iterator
+                          // ======================
+
+template <class KEY, class VALUE>
+class FlatMap_Iterator {
+    // This class implements a random-access iterator over a pair of parallel
+    // arrays of keys of the (template parameter) type 'KEY' and of mapped
+    // values of the (template parameter) type 'VALUE'.  'VALUE' may be
+    // 'const'-qualified, in which case the iterator does not provide
+    // modifiable access to the mapped values.
+
+    // PRIVATE TYPES
+    typedef typename bsl::remove_cv<VALUE>::type NonConstValue;
+
+    // DATA
+    const KEY *d_key_p;    // address of the key of the current element
+    VALUE     *d_value_p;  // address of the mapped value of the current
+                           // element
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::random_access_iterator_tag   iterator_category;
+    typedef bsl::pair<KEY, NonConstValue>     value_type;
+    typedef bsl::ptrdiff_t                    difference_type;
+    typedef bsl::pair<const KEY&, VALUE&>     reference;
+    typedef FlatMap_ArrowProxy<KEY, VALUE>    pointer;
+
+    // CREATORS
+    FlatMap_Iterator();
+        // Create a default-constructed iterator that does not refer to any
+        // element.
+
+    FlatMap_Iterator(const KEY *key, VALUE *value);
+        // Create an iterator referring to the element whose key is at the
+        // specified 'key' address and whose mapped value is at the specified
+        // 'value' address.
+
+    //! FlatMap_Iterator(const FlatMap_Iterator& original) = default;
+        // Create an iterator referring to the same element as the specified
+        // 'original' iterator.
+
+    template <class OTHER_VALUE>
+    FlatMap_Iterator(
+        const FlatMap_Iterator<KEY, OTHER_VALUE>& original,
+        typename bsl::enable_if<bsl::is_same<OTHER_VALUE, NonConstValue>::value
+                             && !bsl::is_same<OTHER_VALUE, VALUE>::value,
+                                int>::type = 0)
+        // Create an iterator referring to the same element as the specified
+        // 'original' iterator, which provides modifiable access to the mapped
+        // values.  This constructor provides the conversion from 'iterator'
+        // to 'const_iterator', and does not participate in overload
+        // resolution unless 'VALUE' is 'const'-qualified (so that it is never
+        // a copy constructor).
+    : d_key_p(original.keyAddress())
+    , d_value_p(original.valueAddress())
+    {
+        // Note that some compilers require functions declared with
+        // 'enable_if' to be defined inline.
+    }
+
+    //! ~FlatMap_Iterator() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! FlatMap_Iterator& operator=(const FlatMap_Iterator& rhs) = default;
+        // Assign to this object the value of the specified 'rhs', and return
+        // a reference providing modifiable access to this object.
+
+    FlatMap_Iterator& operator++();
+        // Advance this iterator to the next element, and return a reference
+        // providing modifiable access to this iterator.
+
+    FlatMap_Iterator& operator--();
+        // Move this iterator to the previous element, and return a reference
+        // providing modifiable access to this iterator.
+
+    FlatMap_Iterator operator++(int);
+        // Advance this iterator to the next element, and return the previous
+        // value of this iterator.
+
+    FlatMap_Iterator operator--(int);
+        // Move this iterator to the previous element, and return the previous
+        // value of this iterator.
+
+    FlatMap_Iterator& operator+=(difference_type offset);
+        // Advance this iterator by the specified 'offset' elements, and
+        // return a reference providing modifiable access to this iterator.
+
+    FlatMap_Iterator& operator-=(difference_type offset);
+        // Move this iterator back by the specified 'offset' elements, and
+        // return a reference providing modifiable access to this iterator.
+
+    // ACCESSORS
+    reference operator*() const;
+        // Return a proxy referring to the key and the mapped value of the
+        // element referred to by this iterator.
+
+    pointer operator->() const;
+        // Return an object whose arrow operator provides access to the proxy
+        // referring to the key and the mapped value of the element referred to
+        // by this iterator.
+
+    reference operator[](difference_type offset) const;
+        // Return a proxy referring to the key and the mapped value of the
+        // element at the specified 'offset' from the element referred to by
+        // this iterator.
+
+    const KEY *keyAddress() const;
+        // Return the address of the key of the element referred to by this
+        // iterator.
+
+    VALUE *valueAddress() const;
+        // Return the address of the mapped value of the element referred to
+        // by this iterator.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE>
+FlatMap_Iterator<KEY, VALUE> operator+(
+               const FlatMap_Iterator<KEY, VALUE>&                    iterator,
+               typename FlatMap_Iterator<KEY, VALUE>::difference_type offset);
+template <class KEY, class VALUE>
+FlatMap_Iterator<KEY, VALUE> operator+(
+              typename FlatMap_Iterator<KEY, VALUE>::difference_type offset,
+              const FlatMap_Iterator<KEY, VALUE>&                    iterator);
+    // Return an iterator referring to the element at the specified 'offset'
+    // from the element referred to by the specified 'iterator'.
+
+template <class KEY, class VALUE>
+FlatMap_Iterator<KEY, VALUE> operator-(
+               const FlatMap_Iterator<KEY, VALUE>&                    iterator,
+               typename FlatMap_Iterator<KEY, VALUE>::difference_type offset);
+    // Return an iterator referring to the element at the specified 'offset'
+    // before the element referred to by the specified 'iterator'.
+
+template <class KEY, class VALUE1, class VALUE2>
+bsl::ptrdiff_t operator-(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                         const FlatMap_Iterator<KEY, VALUE2>& rhs);
+    // Return the number of elements from the specified 'rhs' to the specified
+    // 'lhs'.  The behavior is undefined unless 'lhs' and 'rhs' refer to
+    // elements of the same container.
+
+template <class KEY, class VALUE1, class VALUE2>
+bool operator==(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                const FlatMap_Iterator<KEY, VALUE2>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators refer to the
+    // same element, and 'false' otherwise.
+
+template <class KEY, class VALUE1, class VALUE2>
+bool operator!=(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                const FlatMap_Iterator<KEY, VALUE2>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators do not refer
+    // to the same element, and 'false' otherwise.
+
+template <class KEY, class VALUE1, class VALUE2>
+bool operator<(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+               const FlatMap_Iterator<KEY, VALUE2>& rhs);
+template <class KEY, class VALUE1, class VALUE2>
+bool operator>(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+               const FlatMap_Iterator<KEY, VALUE2>& rhs);
+template <class KEY, class VALUE1, class VALUE2>
+bool operator<=(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                const FlatMap_Iterator<KEY, VALUE2>& rhs);
+template <class KEY, class VALUE1, class VALUE2>
+bool operator>=(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                const FlatMap_Iterator<KEY, VALUE2>& rhs);
+    // Return the result of comparing the positions of the elements referred
+    // to by the specified 'lhs' and 'rhs' iterators.  The behavior is
+    // undefined unless 'lhs' and 'rhs' refer to elements of the same
+    // container.
+
+// ============================================================================
+//                TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                         // ------------------------
+                         // class FlatMap_ArrowProxy
+                         // ------------------------
+
+// CREATORS
+template <class KEY, class VALUE>
+inline
+FlatMap_ArrowProxy<KEY, VALUE>::FlatMap_ArrowProxy(const Proxy& proxy)
+: d_proxy(proxy)
+{
+}
+
+// ACCESSORS
+template <class KEY, class VALUE>
+inline
+const typename FlatMap_ArrowProxy<KEY, VALUE>::Proxy *
+FlatMap_ArrowProxy<KEY, VALUE>::operator->() const
+{
+    return &d_proxy;
+}
+
+                          // ----------------------
+                          // class FlatMap_Iterator
+                          // ----------------------
+
+// CREATORS
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE>::FlatMap_Iterator()
+: d_key_p(0)
+, d_value_p(0)
+{
+}
+
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE>::FlatMap_Iterator(const KEY *key, VALUE *value)
+: d_key_p(key)
+, d_value_p(value)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE>& FlatMap_Iterator<KEY, VALUE>::operator++()
+{
+    ++d_key_p;
+    ++d_value_p;
+    return *this;
+}
+
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE>& FlatMap_Iterator<KEY, VALUE>::operator--()
+{
+    --d_key_p;
+    --d_value_p;
+    return *this;
+}
+
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE> FlatMap_Iterator<KEY, VALUE>::operator++(int)
+{
+    FlatMap_Iterator tmp(*this);
+    ++*this;
+    return tmp;
+}
+
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE> FlatMap_Iterator<KEY, VALUE>::operator--(int)
+{
+    FlatMap_Iterator tmp(*this);
+    --*this;
+    return tmp;
+}
+
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE>&
+FlatMap_Iterator<KEY, VALUE>::operator+=(difference_type offset)
+{
+    d_key_p   += offset;
+    d_value_p += offset;
+    return *this;
+}
+
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE>&
+FlatMap_Iterator<KEY, VALUE>::operator-=(difference_type offset)
+{
+    d_key_p   -= offset;
+    d_value_p -= offset;
+    return *this;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE>
+inline
+typename FlatMap_Iterator<KEY, VALUE>::reference
+FlatMap_Iterator<KEY, VALUE>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_key_p);
+
+    return reference(*d_key_p, *d_value_p);
+}
+
+template <class KEY, class VALUE>
+inline
+typename FlatMap_Iterator<KEY, VALUE>::pointer
+FlatMap_Iterator<KEY, VALUE>::operator->() const
+{
+    BSLS_ASSERT_SAFE(d_key_p);
+
+    return pointer(reference(*d_key_p, *d_value_p));
+}
+
+template <class KEY, class VALUE>
+inline
+typename FlatMap_Iterator<KEY, VALUE>::reference
+FlatMap_Iterator<KEY, VALUE>::operator[](difference_type offset) const
+{
+    BSLS_ASSERT_SAFE(d_key_p);
+
+    return reference(d_key_p[offset], d_value_p[offset]);
+}
+
+template <class KEY, class VALUE>
+inline
+const KEY *FlatMap_Iterator<KEY, VALUE>::keyAddress() const
+{
+    return d_key_p;
+}
+
+template <class KEY, class VALUE>
+inline
+VALUE *FlatMap_Iterator<KEY, VALUE>::valueAddress() const
+{
+    return d_value_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE>
+inline
+bdlc::FlatMap_Iterator<KEY, VALUE> bdlc::operator+(
+               const FlatMap_Iterator<KEY, VALUE>&                    iterator,
+               typename FlatMap_Iterator<KEY, VALUE>::difference_type offset)
+{
+    FlatMap_Iterator<KEY, VALUE> result(iterator);
+    return result += offset;
+}
+
+template <class KEY, class VALUE>
+inline
+bdlc::FlatMap_Iterator<KEY, VALUE> bdlc::operator+(
+              typename FlatMap_Iterator<KEY, VALUE>::difference_type offset,
+              const FlatMap_Iterator<KEY, VALUE>&                    iterator)
+{
+    FlatMap_Iterator<KEY, VALUE> result(iterator);
+    return result += offset;
+}
+
+template <class KEY, class VALUE>
+inline
+bdlc::FlatMap_Iterator<KEY, VALUE> bdlc::operator-(
+               const FlatMap_Iterator<KEY, VALUE>&                    iterator,
+               typename FlatMap_Iterator<KEY, VALUE>::difference_type offset)
+{
+    FlatMap_Iterator<KEY, VALUE> result(iterator);
+    return result -= offset;
+}
+
+template <class KEY, class VALUE1, class VALUE2>
+inline
+bsl::ptrdiff_t bdlc::operator-(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                               const FlatMap_Iterator<KEY, VALUE2>& rhs)
+{
+    return lhs.keyAddress() - rhs.keyAddress();
+}
+
+template <class KEY, class VALUE1, class VALUE2>
+inline
+bool bdlc::operator==(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                      const FlatMap_Iterator<KEY, VALUE2>& rhs)
+{
+    return lhs.keyAddress() == rhs.keyAddress();
+}
+
+template <class KEY, class VALUE1, class VALUE2>
+inline
+bool bdlc::operator!=(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                      const FlatMap_Iterator<KEY, VALUE2>& rhs)
+{
+    return lhs.keyAddress() != rhs.keyAddress();
+}
+
+template <class KEY, class VALUE1, class VALUE2>
+inline
+bool bdlc::operator<(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                     const FlatMap_Iterator<KEY, VALUE2>& rhs)
+{
+    return lhs.keyAddress() < rhs.keyAddress();
+}
+
+template <class KEY, class VALUE1, class VALUE2>
+inline
+bool bdlc::operator>(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                     const FlatMap_Iterator<KEY, VALUE2>& rhs)
+{
+    return lhs.keyAddress() > rhs.keyAddress();
+}
+
+template <class KEY, class VALUE1, class VALUE2>
+inline
+bool bdlc::operator<=(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                      const FlatMap_Iterator<KEY, VALUE2>& rhs)
+{
+    return lhs.keyAddress() <= rhs.keyAddress();
+}
+
+template <class KEY, class VALUE1, class VALUE2>
+inline
+bool bdlc::operator>=(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                      const FlatMap_Iterator<KEY, VALUE2>& rhs)
+{
+    return lhs.keyAddress() >= rhs.keyAddress();
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
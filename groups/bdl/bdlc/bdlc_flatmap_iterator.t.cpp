@@ -0,0 +1,485 @@
+// bdlc_flatmap_iterator.t.cpp                                        -*-C++-*-
+
+#include <bdlc_flatmap_iterator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_issame.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a random-access iterator over a pair of
+// parallel arrays, and a proxy returned by its 'operator->'.  The iterator
+// holds only two pointers, so the tests create iterators over small arrays of
+// keys and values and verify that each operation moves both pointers, and
+// that the references obtained from an iterator refer to the elements of the
+// arrays.
+// ----------------------------------------------------------------------------
+// FlatMap_ArrowProxy
+// [ 2] explicit FlatMap_ArrowProxy(const Proxy& proxy);
+// [ 2] const Proxy *operator->() const;
+//
+// FlatMap_Iterator
+// [ 1] FlatMap_Iterator();
+// [ 1] FlatMap_Iterator(const KEY *key, VALUE *value);
+// [ 1] FlatMap_Iterator(const FlatMap_Iterator& original);
+// [ 1] FlatMap_Iterator(const FlatMap_Iterator<KEY, OTHER_VALUE>&);
+// [ 1] FlatMap_Iterator& operator=(const FlatMap_Iterator& rhs);
+// [ 3] FlatMap_Iterator& operator++();
+// [ 3] FlatMap_Iterator& operator--();
+// [ 3] FlatMap_Iterator operator++(int);
+// [ 3] FlatMap_Iterator operator--(int);
+// [ 3] FlatMap_Iterator& operator+=(difference_type offset);
+// [ 3] FlatMap_Iterator& operator-=(difference_type offset);
+// [ 2] reference operator*() const;
+// [ 2] pointer operator->() const;
+// [ 2] reference operator[](difference_type offset) const;
+// [ 1] const KEY *keyAddress() const;
+// [ 1] VALUE *valueAddress() const;
+//
+// FREE OPERATORS
+// [ 3] FlatMap_Iterator operator+(FlatMap_Iterator, difference_type);
+// [ 3] FlatMap_Iterator operator+(difference_type, FlatMap_Iterator);
+// [ 3] FlatMap_Iterator operator-(FlatMap_Iterator, difference_type);
+// [ 3] difference_type operator-(FlatMap_Iterator, FlatMap_Iterator);
+// [ 4] bool operator==(const FlatMap_Iterator&, const FlatMap_Iterator&);
+// [ 4] bool operator!=(const FlatMap_Iterator&, const FlatMap_Iterator&);
+// [ 4] bool operator<(const FlatMap_Iterator&, const FlatMap_Iterator&);
+// [ 4] bool operator>(const FlatMap_Iterator&, const FlatMap_Iterator&);
+// [ 4] bool operator<=(const FlatMap_Iterator&, const FlatMap_Iterator&);
+// [ 4] bool operator>=(const FlatMap_Iterator&, const FlatMap_Iterator&);
+// ----------------------------------------------------------------------------
+// [ 5] CONCERN: the iterator has the expected iterator traits
+// [ 1] BREATHING TEST
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT  BSLIM_TESTUTIL_ASSERT
+#define ASSERTV BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q  BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P  BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_ BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_ BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_ BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool verbose;
+bool veryVerbose;
+bool veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatMap_Iterator<int, bsl::string>       Obj;
+typedef bdlc::FlatMap_Iterator<int, const bsl::string> ConstObj;
+
+const int KEYS[]   = { 1, 2, 3, 5, 8 };
+const int NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bsl::string values[NUM_KEYS] = { "one", "two", "three", "five", "eight" };
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // ITERATOR TRAITS
+        //
+        // Concerns:
+        //: 1 The iterator is a random-access iterator whose 'value_type' is
+        //:   the pair of the key and the (non-'const') mapped value, and whose
+        //:   'reference' is a pair of references.
+        //
+        // Plan:
+        //: 1 Use 'BSLMF_ASSERT' to verify the nested types, and the types
+        //:   reported by 'bsl::iterator_traits'.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: the iterator has the expected iterator traits
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ITERATOR TRAITS" << endl
+                          << "===============" << endl;
+
+        typedef bsl::iterator_traits<Obj>      Traits;
+        typedef bsl::iterator_traits<ConstObj> ConstTraits;
+
+        BSLMF_ASSERT((bsl::is_same<bsl::random_access_iterator_tag,
+                                   Traits::iterator_category>::value));
+        BSLMF_ASSERT((bsl::is_same<bsl::pair<int, bsl::string>,
+                                   Traits::value_type>::value));
+        BSLMF_ASSERT((bsl::is_same<bsl::pair<const int&, bsl::string&>,
+                                   Traits::reference>::value));
+        BSLMF_ASSERT((bsl::is_same<bsl::pair<int, bsl::string>,
+                                   ConstTraits::value_type>::value));
+        BSLMF_ASSERT((bsl::is_same<bsl::pair<const int&, const bsl::string&>,
+                                   ConstTraits::reference>::value));
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // RELATIONAL OPERATORS
+        //
+        // Concerns:
+        //: 1 The relational operators compare the positions of the iterators.
+        //:
+        //: 2 Modifiable and non-modifiable iterators can be compared.
+        //
+        // Plan:
+        //: 1 For each pair of positions in an array, compare iterators of both
+        //:   kinds, and verify the results.  (C-1,2)
+        //
+        // Testing:
+        //   bool operator==(const FlatMap_Iterator&, const FlatMap_Iterator&);
+        //   bool operator!=(const FlatMap_Iterator&, const FlatMap_Iterator&);
+        //   bool operator<(const FlatMap_Iterator&, const FlatMap_Iterator&);
+        //   bool operator>(const FlatMap_Iterator&, const FlatMap_Iterator&);
+        //   bool operator<=(const FlatMap_Iterator&, const FlatMap_Iterator&);
+        //   bool operator>=(const FlatMap_Iterator&, const FlatMap_Iterator&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RELATIONAL OPERATORS" << endl
+                          << "====================" << endl;
+
+        for (int i = 0; i <= NUM_KEYS; ++i) {
+            for (int j = 0; j <= NUM_KEYS; ++j) {
+                const Obj      X(KEYS + i, values + i);
+                const ConstObj Y(KEYS + j, values + j);
+
+                ASSERTV(i, j, (i == j) == (X == Y));
+                ASSERTV(i, j, (i != j) == (X != Y));
+                ASSERTV(i, j, (i <  j) == (X <  Y));
+                ASSERTV(i, j, (i >  j) == (X >  Y));
+                ASSERTV(i, j, (i <= j) == (X <= Y));
+                ASSERTV(i, j, (i >= j) == (X >= Y));
+                ASSERTV(i, j, (i == j) == (Y == X));
+                ASSERTV(i, j, (i <  j) == (Y >  X));
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ITERATOR ARITHMETIC
+        //
+        // Concerns:
+        //: 1 The increment, decrement, and compound-assignment operators move
+        //:   the iterator by the expected number of positions, and return the
+        //:   expected values.
+        //:
+        //: 2 The free arithmetic operators return iterators at the expected
+        //:   positions, and the difference of two iterators is the distance
+        //:   between their positions.
+        //
+        // Plan:
+        //: 1 For each position in an array, apply each operator and verify the
+        //:   addresses of the resulting iterator.  (C-1,2)
+        //
+        // Testing:
+        //   FlatMap_Iterator& operator++();
+        //   FlatMap_Iterator& operator--();
+        //   FlatMap_Iterator operator++(int);
+        //   FlatMap_Iterator operator--(int);
+        //   FlatMap_Iterator& operator+=(difference_type offset);
+        //   FlatMap_Iterator& operator-=(difference_type offset);
+        //   FlatMap_Iterator operator+(FlatMap_Iterator, difference_type);
+        //   FlatMap_Iterator operator+(difference_type, FlatMap_Iterator);
+        //   FlatMap_Iterator operator-(FlatMap_Iterator, difference_type);
+        //   difference_type operator-(FlatMap_Iterator, FlatMap_Iterator);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ITERATOR ARITHMETIC" << endl
+                          << "===================" << endl;
+
+        const Obj BEGIN(KEYS, values);
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            Obj mX(KEYS + i, values + i);  const Obj& X = mX;
+
+            ASSERTV(i, KEYS + i + 1 == (++mX).keyAddress());
+            ASSERTV(i, values + i + 1 == X.valueAddress());
+            ASSERTV(i, KEYS + i     == (--mX).keyAddress());
+            ASSERTV(i, values + i   == X.valueAddress());
+
+            ASSERTV(i, KEYS + i     == (mX++).keyAddress());
+            ASSERTV(i, KEYS + i + 1 == X.keyAddress());
+            ASSERTV(i, KEYS + i + 1 == (mX--).keyAddress());
+            ASSERTV(i, KEYS + i     == X.keyAddress());
+
+            for (int j = -i; j <= NUM_KEYS - i; ++j) {
+                Obj mY(X);  const Obj& Y = mY;
+
+                ASSERTV(i, j, KEYS + i + j == (mY += j).keyAddress());
+                ASSERTV(i, j, values + i + j == Y.valueAddress());
+                ASSERTV(i, j, KEYS + i == (mY -= j).keyAddress());
+                ASSERTV(i, j, values + i == Y.valueAddress());
+
+                ASSERTV(i, j, KEYS + i + j == (X + j).keyAddress());
+                ASSERTV(i, j, KEYS + i + j == (j + X).keyAddress());
+                ASSERTV(i, j, KEYS + i + j == (X - (-j)).keyAddress());
+                ASSERTV(i, j, values + i + j == (X + j).valueAddress());
+
+                ASSERTV(i, j,  j == (X + j) - X);
+                ASSERTV(i, j, -j == X - (X + j));
+            }
+
+            ASSERTV(i, i == X - BEGIN);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // DEREFERENCE AND ARROW PROXY
+        //
+        // Concerns:
+        //: 1 'operator*' and 'operator[]' return a pair of references to the
+        //:   key and the value at the (offset) position.
+        //:
+        //: 2 The mapped value can be modified through a modifiable iterator.
+        //:
+        //: 3 'operator->' provides access to the members of the pair of
+        //:   references.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Dereference iterators at each position of an array, verify the
+        //:   addresses of the referenced objects, and modify the values.
+        //:   (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered when a default-constructed iterator is dereferenced.
+        //:   (C-4)
+        //
+        // Testing:
+        //   explicit FlatMap_ArrowProxy(const Proxy& proxy);
+        //   const Proxy *operator->() const;
+        //   reference operator*() const;
+        //   pointer operator->() const;
+        //   reference operator[](difference_type offset) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DEREFERENCE AND ARROW PROXY" << endl
+                          << "===========================" << endl;
+
+        const Obj      BEGIN(KEYS, values);
+        const ConstObj CBEGIN(BEGIN);
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            const Obj X(KEYS + i, values + i);
+
+            ASSERTV(i, &KEYS[i]   == &(*X).first);
+            ASSERTV(i, &values[i] == &(*X).second);
+            ASSERTV(i, &KEYS[i]   == &X->first);
+            ASSERTV(i, &values[i] == &X->second);
+            ASSERTV(i, &KEYS[i]   == &BEGIN[i].first);
+            ASSERTV(i, &values[i] == &BEGIN[i].second);
+            ASSERTV(i, &values[i] == &CBEGIN[i].second);
+
+            X->second += '!';
+            (*X).second += '?';
+            BEGIN[i].second += '.';
+
+            ASSERTV(i, values[i], '.' == values[i][values[i].size() - 1]);
+            ASSERTV(i, values[i], values[i] == CBEGIN[i].second);
+        }
+        ASSERT("one!?." == values[0]);
+
+        {
+            const bdlc::FlatMap_ArrowProxy<int, bsl::string> PROXY(*BEGIN);
+
+            ASSERT(&KEYS[0]   == &PROXY->first);
+            ASSERT(&values[0] == &PROXY->second);
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const Obj X;
+
+            ASSERT_SAFE_FAIL(*X);
+            ASSERT_SAFE_FAIL(X->first);
+            ASSERT_SAFE_FAIL(X[0]);
+            ASSERT_SAFE_PASS(*BEGIN);
+            ASSERT_SAFE_PASS(BEGIN->first);
+            ASSERT_SAFE_PASS(BEGIN[0]);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create iterators using each constructor, and verify their
+        //:   addresses.  (C-1)
+        //
+        // Testing:
+        //   FlatMap_Iterator();
+        //   FlatMap_Iterator(const KEY *key, VALUE *value);
+        //   FlatMap_Iterator(const FlatMap_Iterator& original);
+        //   FlatMap_Iterator(const FlatMap_Iterator<KEY, OTHER_VALUE>&);
+        //   FlatMap_Iterator& operator=(const FlatMap_Iterator& rhs);
+        //   const KEY *keyAddress() const;
+        //   VALUE *valueAddress() const;
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const Obj D;
+        ASSERT(0 == D.keyAddress());
+        ASSERT(0 == D.valueAddress());
+
+        const Obj X(KEYS + 1, values + 1);
+        ASSERT(KEYS + 1   == X.keyAddress());
+        ASSERT(values + 1 == X.valueAddress());
+        ASSERT(2          == X->first);
+        ASSERT("two"      == X->second);
+
+        const Obj Y(X);
+        ASSERT(X == Y);
+
+        const ConstObj Z(X);
+        ASSERT(KEYS + 1   == Z.keyAddress());
+        ASSERT(values + 1 == Z.valueAddress());
+        ASSERT(X == Z);
+
+        const ConstObj W(Z);
+        ASSERT(Z == W);
+
+        Obj mU;  const Obj& U = mU;
+        mU = X;
+        ASSERT(X == U);
+
+        ConstObj mV;  const ConstObj& V = mV;
+        mV = Z;
+        ASSERT(Z == V);
+        mV = X;
+        ASSERT(X == V);
+
+        ASSERT(( bsl::is_convertible<Obj,      ConstObj>::value));
+        ASSERT((!bsl::is_convertible<ConstObj, Obj>::value));
+
+        int count = 0;
+        for (Obj it(KEYS, values); it != Obj(KEYS + NUM_KEYS,
+                                             values + NUM_KEYS); ++it) {
+            ASSERTV(count, KEYS[count] == it->first);
+            ++count;
+        }
+        ASSERT(NUM_KEYS == count);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
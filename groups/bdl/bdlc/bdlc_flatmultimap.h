@@ -0,0 +1,1694 @@
+// bdlc_flatmultimap.h                                                -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATMULTIMAP
+#define INCLUDED_BDLC_FLATMULTIMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered multimap container stored in sorted vectors.
+//
+//@CLASSES:
+//   bdlc::FlatMultiMap: sorted-vector based ordered multimap container
+//
+//@SEE_ALSO: bdlc_flatmap, bdlc_flatset, bdlc_flatsortedutil, bsl_multimap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatMultiMap', that implements an ordered map of items with possibly
+// non-unique keys, in which the keys and the mapped values are stored, in key
+// order, in two separate contiguous arrays ('bsl::vector' objects).  Elements
+// having equivalent keys are stored in the order in which they were inserted.
+//
+// An instantiation of 'bdlc::FlatMultiMap' is an allocator-aware,
+// value-semantic type whose salient attributes are its size (number of
+// elements) and the ordered sequence of 'KEY-VALUE' pairs the multimap
+// contains.  An instantiation may be provided with a custom key-comparison
+// functor, but that functor is not a salient attribute.  In particular, when
+// comparing element values for equality between two different
+// 'bdlc::FlatMultiMap' objects, the elements are compared using 'operator=='.
+//
+// 'bdlc::FlatMultiMap' is the multimap counterpart of 'bdlc::FlatMap' (see
+// 'bdlc_flatmap'), and has the same performance characteristics: compact
+// storage, branchless binary search over the contiguous array of keys, and
+// fast iteration, in exchange for insertion and erasure of a single element
+// in time linear in the size of the multimap.
+//
+///Interface Differences with 'bsl::multimap'
+///------------------------------------------
+// A 'bdlc::FlatMultiMap' provides most of the interface of 'bsl::multimap',
+// with the differences described for 'bdlc::FlatMap' in 'bdlc_flatmap': its
+// iterators are random-access iterators whose 'reference' type is the proxy
+// 'bsl::pair<const KEY&, VALUE&>', every insertion or erasure invalidates all
+// iterators, pointers, and references to its elements, and its 'value_type'
+// is 'bsl::pair<KEY, VALUE>'.
+//
+///Bulk Insertion
+///--------------
+// The range-insertion methods (and the range constructors) insert all of the
+// elements of a range at once.  If the range is known to be sorted with
+// respect to the comparator of the multimap, the client may pass a
+// 'bdlc::SortedEquivalentTag' object as the first argument, in which case the
+// elements of the range are merged with the existing elements in linear time.
+// Otherwise, the range is first sorted (stably, and without moving the
+// elements), and then merged, for a total complexity of 'O(N + M * log(M))',
+// where 'N' is the size of the multimap and 'M' is the length of the range.
+// In either case, the inserted elements follow the existing elements having
+// equivalent keys, and retain their relative order.
+//
+///Requirements on 'KEY', 'VALUE', and 'COMPARATOR'
+///------------------------------------------------
+// The (template parameter) types 'KEY' and 'VALUE' must be copy-constructible,
+// move-constructible, and move-assignable.  The (template parameter) type
+// 'COMPARATOR' must be a copy-constructible functor defining a strict weak
+// ordering on 'KEY' values; 'COMPARATOR' must also be default-constructible
+// if a constructor not taking a comparator is used.
+//
+///Exception Safety
+///----------------
+// A 'bdlc::FlatMultiMap' is exception neutral, and all of the methods of
+// 'bdlc::FlatMultiMap' provide the basic exception safety guarantee (see
+// {'bsldoc_glossary'|Basic Guarantee}).  Should the move constructor of 'KEY'
+// or 'VALUE' throw during a bulk insertion, the multimap is left empty.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Indexing Trades by Settlement Date
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we must report the trades settling on each date of a period, where
+// the trades are recorded throughout the day, and reported at its end.
+//
+// First, we define an alias for an index from a settlement date (expressed
+// as a serial day number) to a trade identifier, and create an empty index:
+//..
+//  typedef bdlc::FlatMultiMap<int, int> TradesByDate;
+//
+//  TradesByDate index;
+//..
+// Then, we record the trades of the day in a single batch.  The batch is not
+// sorted, so the index sorts it before merging it with its existing contents:
+//..
+//  const bsl::pair<int, int> TRADES[] = {
+//      bsl::make_pair(7002, 11),
+//      bsl::make_pair(7001, 12),
+//      bsl::make_pair(7002, 13),
+//      bsl::make_pair(7005, 14),
+//      bsl::make_pair(7001, 15),
+//  };
+//  const int NUM_TRADES = sizeof TRADES / sizeof *TRADES;
+//
+//  index.insert(TRADES, TRADES + NUM_TRADES);
+//  assert(5 == index.size());
+//..
+// Next, we record a late trade individually; it follows the trades already
+// recorded for the same date:
+//..
+//  index.insert(bsl::make_pair(7002, 16));
+//  assert(3 == index.count(7002));
+//..
+// Finally, we report the trades settling on date 7002, which are listed in
+// the order in which they were recorded:
+//..
+//  bsl::pair<TradesByDate::const_iterator, TradesByDate::const_iterator>
+//                                             range = index.equal_range(7002);
+//
+//  const int EXPECTED[] = { 11, 13, 16 };
+//  int       count      = 0;
+//
+//  for (; range.first != range.second; ++range.first, ++count) {
+//      assert(EXPECTED[count] == range.first->second);
+//  }
+//  assert(3 == count);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flatmap_iterator.h>
+#include <bdlc_flatsortedutil.h>
+
+#include <bslalg_hasstliterators.h>
+#include <bslalg_swaputil.h>
+
+#include <bslim_printer.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_destructorguard.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_movableref.h>
+#include <bslmf_util.h>    // 'forward(V)'
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_util.h>     // 'forward<T>(V)'
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <bsl_initializer_list.h>
+#endif
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_iterator.h>
+#include <bsl_ostream.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+// FORWARD DECLARATIONS
+template <class KEY, class VALUE, class COMPARATOR = bsl::less<KEY> >
+class FlatMultiMap;
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator==(const FlatMultiMap<KEY, VALUE, COMPARATOR>& lhs,
+                const FlatMultiMap<KEY, VALUE, COMPARATOR>& rhs);
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator!=(const FlatMultiMap<KEY, VALUE, COMPARATOR>& lhs,
+                const FlatMultiMap<KEY, VALUE, COMPARATOR>& rhs);
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator<(const FlatMultiMap<KEY, VALUE, COMPARATOR>& lhs,
+               const FlatMultiMap<KEY, VALUE, COMPARATOR>& rhs);
+
+template <class KEY, class VALUE, class COMPARATOR>
+void swap(FlatMultiMap<KEY, VALUE, COMPARATOR>& a,
+          FlatMultiMap<KEY, VALUE, COMPARATOR>& b);
+
+                            // ==================
+                            // class FlatMultiMap
+                            // ==================
+
+template <class KEY, class VALUE, class COMPARATOR>
+class FlatMultiMap {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of 'KEY-VALUE' pairs having possibly non-unique keys
+    // that provides a mapping from keys of (template parameter) type 'KEY' to
+    // their associated mapped values of (template parameter) type 'VALUE'.
+    // The keys and the mapped values are held, in key order, in two parallel
+    // arrays.  The (template parameter) type 'COMPARATOR' is a functor
+    // defining the order of 'KEY' values.  See {Requirements on 'KEY',
+    // 'VALUE', and 'COMPARATOR'} for more information.
+
+    // PRIVATE TYPES
+    typedef bslmf::MovableRefUtil MoveUtil;
+    typedef bsl::vector<KEY>      KeyContainer;
+    typedef bsl::vector<VALUE>    ValueContainer;
+
+    class Proctor;
+        // restores the invariants of a multimap after a failed modification
+
+    // DATA
+    KeyContainer   d_keys;        // keys, in order
+    ValueContainer d_values;      // mapped values, parallel to 'd_keys'
+    COMPARATOR     d_comparator;  // defines the order of the keys
+
+    // FRIENDS
+    friend bool operator==<>(const FlatMultiMap&, const FlatMultiMap&);
+    friend bool operator!=<>(const FlatMultiMap&, const FlatMultiMap&);
+    friend bool operator< <>(const FlatMultiMap&, const FlatMultiMap&);
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::pair<KEY, VALUE>                  value_type;
+    typedef KEY                                    key_type;
+    typedef VALUE                                  mapped_type;
+    typedef bsl::size_t                            size_type;
+    typedef bsl::ptrdiff_t                         difference_type;
+    typedef COMPARATOR                             key_compare;
+    typedef FlatMap_Iterator<KEY, VALUE>           iterator;
+    typedef FlatMap_Iterator<KEY, const VALUE>     const_iterator;
+    typedef typename iterator::reference           reference;
+    typedef typename const_iterator::reference     const_reference;
+    typedef bsl::reverse_iterator<iterator>        reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>  const_reverse_iterator;
+
+  private:
+    // PRIVATE MANIPULATORS
+    template <class KEY_TYPE, class VALUE_TYPE>
+    iterator emplaceAt(bsl::size_t                                   index,
+                       BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)   key,
+                       BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value);
+        // Insert, at the specified 'index', an element having the specified
+        // 'key' and 'value', and return an iterator referring to the newly
+        // inserted element.  The behavior is undefined unless the keys of the
+        // multimap remain in order after the insertion.
+
+    template <class INPUT_ITERATOR>
+    void insertRange(INPUT_ITERATOR first, INPUT_ITERATOR last, bool sorted);
+        // Insert into this multimap the value of each element in the input
+        // iterator range specified by 'first' through 'last' (including
+        // 'first', excluding 'last'), after the existing elements having
+        // equivalent keys.  If the specified 'sorted' is 'true', the behavior
+        // is undefined unless the range is sorted with respect to the
+        // comparator of this multimap.
+
+    void merge(KeyContainer      *keys,
+               ValueContainer    *values,
+               const bsl::size_t *order);
+        // Merge into this multimap the elements having the keys in the
+        // specified 'keys' and the mapped values at the corresponding
+        // positions in the specified 'values', taken in the order of the
+        // indices in the array at the specified 'order', or in the order of
+        // 'keys' if 'order' is 0, after the existing elements having
+        // equivalent keys.  The elements of 'keys' and 'values' are left in a
+        // valid but unspecified state.  The behavior is undefined unless
+        // 'keys' and 'values' use the allocator of this multimap and have the
+        // same length, 'order' is 0 or refers to a permutation of the indices
+        // of 'keys', and the elements are sorted in the resulting order.
+
+    iterator makeIterator(bsl::size_t index);
+        // Return an iterator referring to the element at the specified
+        // 'index' in this multimap.  The behavior is undefined unless
+        // 'index <= size()'.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t lowerBoundIndex(const KEY& key) const;
+        // Return the index of the first element in this multimap whose key is
+        // not ordered before the specified 'key', or 'size()' if no such
+        // element exists.
+
+    bsl::size_t upperBoundIndex(const KEY& key) const;
+        // Return the index of the first element in this multimap whose key is
+        // ordered after the specified 'key', or 'size()' if no such element
+        // exists.
+
+    const_iterator makeIterator(bsl::size_t index) const;
+        // Return an iterator referring to the element at the specified
+        // 'index' in this multimap.  The behavior is undefined unless
+        // 'index <= size()'.
+
+  public:
+    // CREATORS
+    FlatMultiMap();
+    explicit FlatMultiMap(bslma::Allocator *basicAllocator);
+    explicit FlatMultiMap(const COMPARATOR&  comparator,
+                          bslma::Allocator  *basicAllocator = 0);
+        // Create an empty 'FlatMultiMap' object.  Optionally specify a
+        // 'comparator' used to order the keys of elements in this container.
+        // If 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied or is 0, the currently installed default allocator is
+        // used.  No memory is allocated.
+
+    template <class INPUT_ITERATOR>
+    FlatMultiMap(INPUT_ITERATOR    first,
+                 INPUT_ITERATOR    last,
+                 bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatMultiMap(INPUT_ITERATOR     first,
+                 INPUT_ITERATOR     last,
+                 const COMPARATOR&  comparator,
+                 bslma::Allocator  *basicAllocator = 0);
+        // Create a 'FlatMultiMap' object initialized by insertion of the
+        // values from the input iterator range specified by 'first' through
+        // 'last' (including 'first', excluding 'last').  Optionally specify a
+        // 'comparator' used to order the keys of elements in this container.
+        // If 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied or is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'first' and 'last' refer to
+        // a sequence of valid values where 'first' is at a position at or
+        // before 'last'.
+
+    template <class INPUT_ITERATOR>
+    FlatMultiMap(SortedEquivalentTag  ,
+                 INPUT_ITERATOR       first,
+                 INPUT_ITERATOR       last,
+                 bslma::Allocator    *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatMultiMap(SortedEquivalentTag  ,
+                 INPUT_ITERATOR       first,
+                 INPUT_ITERATOR       last,
+                 const COMPARATOR&    comparator,
+                 bslma::Allocator    *basicAllocator = 0);
+        // Create a 'FlatMultiMap' object holding the values from the input
+        // iterator range specified by 'first' through 'last' (including
+        // 'first', excluding 'last'), in time linear in the length of the
+        // range.  Optionally specify a 'comparator' used to order the keys of
+        // elements in this container.  If 'comparator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'COMPARATOR' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not supplied or is 0, the
+        // currently installed default allocator is used.  The behavior is
+        // undefined unless 'first' and 'last' refer to a sequence of valid
+        // values where 'first' is at a position at or before 'last', and the
+        // sequence is sorted with respect to the comparator.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    FlatMultiMap(bsl::initializer_list<value_type>  values,
+                 bslma::Allocator                  *basicAllocator = 0);
+    FlatMultiMap(bsl::initializer_list<value_type>  values,
+                 const COMPARATOR&                  comparator,
+                 bslma::Allocator                  *basicAllocator = 0);
+        // Create a 'FlatMultiMap' object initialized by insertion of the
+        // specified 'values'.  Optionally specify a 'comparator' used to order
+        // the keys of elements in this container.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied or is 0,
+        // the currently installed default allocator is used.
+#endif
+
+    FlatMultiMap(const FlatMultiMap&  original,
+                 bslma::Allocator    *basicAllocator = 0);
+        // Create a 'FlatMultiMap' object having the same value and comparator
+        // as the specified 'original' object.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // specified or is 0, the currently installed default allocator is
+        // used.
+
+    FlatMultiMap(bslmf::MovableRef<FlatMultiMap> original);
+        // Create a 'FlatMultiMap' object having the same value, comparator,
+        // and allocator as the specified 'original' object.  The contents of
+        // 'original' are moved (in constant time) to this object, 'original'
+        // is left in a (valid) unspecified state, and no exceptions will be
+        // thrown.
+
+    FlatMultiMap(bslmf::MovableRef<FlatMultiMap>  original,
+                 bslma::Allocator                *basicAllocator);
+        // Create a 'FlatMultiMap' object having the same value and comparator
+        // as the specified 'original' object, using the specified
+        // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  The allocator of
+        // 'original' remains unchanged.  If 'original' and the newly created
+        // object have the same allocator then the contents of 'original' are
+        // moved (in constant time) to this object, 'original' is left in a
+        // (valid) unspecified state, and no exceptions will be thrown;
+        // otherwise, the elements of 'original' are moved, 'original' is left
+        // in a (valid) unspecified state, and an exception may be thrown.
+
+    //! ~FlatMultiMap() = default;
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    FlatMultiMap& operator=(const FlatMultiMap& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.
+
+    FlatMultiMap& operator=(bslmf::MovableRef<FlatMultiMap> rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  If this object and 'rhs' use the same allocator the
+        // contents of 'rhs' are moved (in constant time) to this object.
+        // 'rhs' is left in a (valid) unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    FlatMultiMap& operator=(bsl::initializer_list<value_type> values);
+        // Assign to this object the value resulting from first clearing this
+        // multimap and then inserting each object in the specified 'values'
+        // initializer list; return a reference providing modifiable access to
+        // this object.
+#endif
+
+    void clear();
+        // Remove all entries from this multimap.  Note that the multimap is
+        // empty after this call, but allocated memory may be retained for
+        // future use.
+
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        // Return a pair of iterators defining the sequence of modifiable
+        // elements in this multimap having the specified 'key', where the
+        // first iterator is positioned at the start of the sequence and the
+        // second iterator is positioned one past the end of the sequence.  If
+        // this multimap contains no elements having a key equivalent to 'key',
+        // then the two returned iterators will have the same value.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove from this multimap all the elements whose keys are equivalent
+        // to the specified 'key', and return the number of elements removed.
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove from this multimap the element at the specified 'position',
+        // and return an iterator referring to the element immediately
+        // following the removed element, or to the past-the-end position if
+        // the removed element was the last element in the sequence of elements
+        // maintained by this multimap.  The behavior is undefined unless
+        // 'position' refers to an element in this multimap.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this multimap the elements starting at the specified
+        // 'first' position up to, but not including, the specified 'last'
+        // position, and return an iterator referring to the element at 'last'
+        // prior to the erasure.  The behavior is undefined unless 'first' and
+        // 'last' either refer to elements in this multimap or are the 'end'
+        // iterator, and the 'first' position is at or before the 'last'
+        // position in the sequence provided by this container.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the first modifiable element in this
+        // multimap having the specified 'key', or 'end()' if no such entry
+        // exists in this multimap.
+
+    template <class VALUE_TYPE>
+    typename bsl::enable_if<bsl::is_convertible<VALUE_TYPE, value_type>::value,
+                            iterator>::type
+                    insert(BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value)
+        // Insert the specified 'value' into this multimap after the existing
+        // elements having a key equivalent to that of 'value', and return an
+        // iterator referring to the newly inserted element.  The behavior is
+        // undefined unless 'VALUE_TYPE' is a specialization of 'bsl::pair'.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        const bsl::size_t index = upperBoundIndex(value.first);
+
+        return emplaceAt(index,
+                         BSLS_COMPILERFEATURES_FORWARD(VALUE_TYPE,
+                                                       value).first,
+                         BSLS_COMPILERFEATURES_FORWARD(VALUE_TYPE,
+                                                       value).second);
+    }
+
+    template <class VALUE_TYPE>
+    typename bsl::enable_if<bsl::is_convertible<VALUE_TYPE, value_type>::value,
+                            iterator>::type
+                    insert(const_iterator                                ,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value)
+        // Insert the specified 'value' into this multimap after the existing
+        // elements having a key equivalent to that of 'value', and return an
+        // iterator referring to the newly inserted element.  The supplied
+        // 'const_iterator' is ignored.  The behavior is undefined unless
+        // 'VALUE_TYPE' is a specialization of 'bsl::pair'.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        return insert(BSLS_COMPILERFEATURES_FORWARD(VALUE_TYPE, value));
+    }
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this multimap the value of each element in the input
+        // iterator range specified by 'first' through 'last' (including
+        // 'first', excluding 'last'), after the existing elements having
+        // equivalent keys, in 'O(size() + M * log(M))' time, where 'M' is the
+        // length of the range.  The behavior is undefined unless 'first' and
+        // 'last' refer to a sequence of valid values where 'first' is at a
+        // position at or before 'last'.
+
+    template <class INPUT_ITERATOR>
+    void insert(SortedEquivalentTag  ,
+                INPUT_ITERATOR       first,
+                INPUT_ITERATOR       last);
+        // Insert into this multimap the value of each element in the input
+        // iterator range specified by 'first' through 'last' (including
+        // 'first', excluding 'last'), after the existing elements having
+        // equivalent keys, in time linear in 'size()' and the length of the
+        // range.  The behavior is undefined unless 'first' and 'last' refer to
+        // a sequence of valid values where 'first' is at a position at or
+        // before 'last', and the sequence is sorted with respect to the
+        // comparator of this multimap.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(bsl::initializer_list<value_type> values);
+        // Insert into this multimap the value of each element in the specified
+        // 'values' initializer list, after the existing elements having
+        // equivalent keys.
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... ARGS>
+    iterator emplace(ARGS&&... args);
+        // Insert into this multimap a newly-created element constructed by
+        // forwarding this multimap's allocator and the specified 'args' to the
+        // constructor of 'bsl::pair<KEY, VALUE>', after the existing elements
+        // having an equivalent key, and return an iterator referring to the
+        // newly inserted element.
+#endif
+
+    iterator lower_bound(const KEY& key);
+        // Return an iterator referring to the first modifiable element in this
+        // multimap whose key is not ordered before the specified 'key', or
+        // 'end()' if no such element exists.
+
+    void reserve(bsl::size_t numElements);
+        // Change the capacity of this multimap to at least the specified
+        // 'numElements'.  Note that this method has no effect unless
+        // 'numElements > capacity()'.
+
+    iterator upper_bound(const KEY& key);
+        // Return an iterator referring to the first modifiable element in this
+        // multimap whose key is ordered after the specified 'key', or 'end()'
+        // if no such element exists.
+
+                          // Iterators
+
+    iterator begin();
+        // Return an iterator referring to the first modifiable element in the
+        // sequence of elements maintained by this multimap, or the 'end'
+        // iterator if this multimap is empty.
+
+    iterator end();
+        // Return an iterator referring to the past-the-end position in the
+        // sequence of elements maintained by this multimap.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator referring to the last modifiable element
+        // in the sequence of elements maintained by this multimap, or 'rend'
+        // if this multimap is empty.
+
+    reverse_iterator rend();
+        // Return a reverse iterator referring to the past-the-end position in
+        // the reverse sequence of elements maintained by this multimap.
+
+                             // Aspects
+
+    void swap(FlatMultiMap& other);
+        // Exchange the value of this object as well as its comparator with
+        // those of the specified 'other' object.  This method provides the
+        // no-throw exception-safety guarantee if 'COMPARATOR' provides a
+        // no-throw swap.  The behavior is undefined unless this object was
+        // created with the same allocator as 'other'.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the number of elements this multimap can hold without
+        // reallocation.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this multimap contains an element having the
+        // specified 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements in this multimap having the specified
+        // 'key'.
+
+    bool empty() const;
+        // Return 'true' if this multimap contains no elements, and 'false'
+        // otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                         const KEY& key) const;
+        // Return a pair of iterators defining the sequence of non-modifiable
+        // elements in this multimap having the specified 'key', where the
+        // first iterator is positioned at the start of the sequence and the
+        // second iterator is positioned one past the end of the sequence.  If
+        // this multimap contains no elements having a key equivalent to 'key',
+        // then the two returned iterators will have the same value.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the first non-modifiable element in
+        // this multimap having the specified 'key', or 'end()' if no such
+        // entry exists in this multimap.
+
+    COMPARATOR key_comp() const;
+        // Return (a copy of) the key-comparison functor used by this multimap.
+
+    const bsl::vector<KEY>& keys() const;
+        // Return a reference providing non-modifiable access to the array of
+        // the keys of this multimap, in order.
+
+    const_iterator lower_bound(const KEY& key) const;
+        // Return an iterator referring to the first non-modifiable element in
+        // this multimap whose key is not ordered before the specified 'key',
+        // or 'end()' if no such element exists.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this multimap.
+
+    const_iterator upper_bound(const KEY& key) const;
+        // Return an iterator referring to the first non-modifiable element in
+        // this multimap whose key is ordered after the specified 'key', or
+        // 'end()' if no such element exists.
+
+    const bsl::vector<VALUE>& values() const;
+        // Return a reference providing non-modifiable access to the array of
+        // the mapped values of this multimap, in the order of their keys.
+
+                          // Iterators
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator referring to the first non-modifiable element in
+        // the sequence of elements maintained by this multimap, or the 'end'
+        // iterator if this multimap is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return an iterator referring to the past-the-end position in the
+        // sequence of elements maintained by this multimap.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator referring to the last non-modifiable
+        // element in the sequence of elements maintained by this multimap, or
+        // 'rend' if this multimap is empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator referring to the past-the-end position in
+        // the reverse sequence of elements maintained by this multimap.
+
+                             // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this multimap to supply memory.
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level          = 0,
+                        int           spacesPerLevel = 4) const;
+        // Format this object to the specified output 'stream' at the (absolute
+        // value of) the optionally specified indentation 'level' and return a
+        // reference to 'stream'.  If 'level' is specified, optionally specify
+        // 'spacesPerLevel', the number of spaces per indentation level for
+        // this and all of its nested objects.  If 'level' is negative,
+        // suppress indentation of the first line.  If 'spacesPerLevel' is
+        // negative format the entire output on one line, suppressing all but
+        // the initial indentation (as governed by 'level').  If 'stream' is
+        // not valid on entry, this operation has no effect.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator==(const FlatMultiMap<KEY, VALUE, COMPARATOR>& lhs,
+                const FlatMultiMap<KEY, VALUE, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'FlatMultiMap' objects have the same
+    // value if their sizes are the same and each element contained in one is
+    // equal to the element at the same position in the other.  This method
+    // requires that the (template parameter) types 'KEY' and 'VALUE' both be
+    // equality-comparable.
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator!=(const FlatMultiMap<KEY, VALUE, COMPARATOR>& lhs,
+                const FlatMultiMap<KEY, VALUE, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'FlatMultiMap' objects do not
+    // have the same value if they do not have the same size, or some element
+    // contained in one is not equal to the element at the same position in
+    // the other.  This method requires that the (template parameter) types
+    // 'KEY' and 'VALUE' both be equality-comparable.
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator<(const FlatMultiMap<KEY, VALUE, COMPARATOR>& lhs,
+               const FlatMultiMap<KEY, VALUE, COMPARATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' multimap is
+    // lexicographically less than that of the specified 'rhs' multimap, and
+    // 'false' otherwise.  Elements are compared as 'bsl::pair<KEY, VALUE>'
+    // objects (i.e., by key and then by mapped value) using 'operator<'.
+
+template <class KEY, class VALUE, class COMPARATOR>
+bsl::ostream& operator<<(bsl::ostream&                               stream,
+                         const FlatMultiMap<KEY, VALUE, COMPARATOR>& map);
+    // Write the value of the specified 'map' to the specified output 'stream'
+    // in a single-line format, and return a reference providing modifiable
+    // access to 'stream'.  If 'stream' is not valid on entry, this operation
+    // has no effect.  Note that this human-readable format is not fully
+    // specified and can change without notice.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR>
+void swap(FlatMultiMap<KEY, VALUE, COMPARATOR>& a,
+          FlatMultiMap<KEY, VALUE, COMPARATOR>& b);
+    // Exchange the values of the specified 'a' and 'b' objects.  This method
+    // provides the no-throw exception-safety guarantee if the two objects
+    // were created with the same allocator and the basic guarantee otherwise.
+
+                        // ===========================
+                        // class FlatMultiMap::Proctor
+                        // ===========================
+
+template <class KEY, class VALUE, class COMPARATOR>
+class FlatMultiMap<KEY, VALUE, COMPARATOR>::Proctor {
+    // This class implements a proctor that, unless its 'release' method has
+    // been invoked, restores, on destruction, the invariants of a multimap
+    // whose arrays of keys and mapped values may have become inconsistent,
+    // either by erasing a specified key or, if no key is specified, by
+    // clearing the multimap.
+
+    // DATA
+    FlatMultiMap *d_map_p;  // managed multimap, or 0 if released
+    bsl::size_t   d_index;  // index of the key to erase, or 'size_t(-1)'
+
+  private:
+    // NOT IMPLEMENTED
+    Proctor(const Proctor&);
+    Proctor& operator=(const Proctor&);
+
+  public:
+    // CREATORS
+    explicit Proctor(FlatMultiMap *map);
+        // Create a proctor that clears the specified 'map' on destruction
+        // unless released.
+
+    Proctor(FlatMultiMap *map, bsl::size_t index);
+        // Create a proctor that erases the key at the specified 'index' of the
+        // specified 'map' on destruction unless released.
+
+    ~Proctor();
+        // Restore the invariants of the managed multimap, unless this proctor
+        // has been released.
+
+    // MANIPULATORS
+    void release();
+        // Release the managed multimap from management by this proctor.
+};
+
+// ============================================================================
+//                TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // ---------------------------
+                        // class FlatMultiMap::Proctor
+                        // ---------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultiMap<KEY, VALUE, COMPARATOR>::Proctor::Proctor(FlatMultiMap *map)
+: d_map_p(map)
+, d_index(static_cast<bsl::size_t>(-1))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultiMap<KEY, VALUE, COMPARATOR>::Proctor::Proctor(FlatMultiMap *map,
+                                                       bsl::size_t   index)
+: d_map_p(map)
+, d_index(index)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultiMap<KEY, VALUE, COMPARATOR>::Proctor::~Proctor()
+{
+    if (d_map_p) {
+        if (static_cast<bsl::size_t>(-1) == d_index) {
+            d_map_p->d_keys.clear();
+            d_map_p->d_values.clear();
+        }
+        else {
+            d_map_p->d_keys.erase(d_map_p->d_keys.begin() + d_index);
+        }
+    }
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMultiMap<KEY, VALUE, COMPARATOR>::Proctor::release()
+{
+    d_map_p = 0;
+}
+
+                            // ------------------
+                            // class FlatMultiMap
+                            // ------------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR>
+template <class KEY_TYPE, class VALUE_TYPE>
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::emplaceAt(
+                         bsl::size_t                                   index,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)   key,
+                         BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value)
+{
+    d_keys.emplace(d_keys.begin() + index,
+                   BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key));
+
+    Proctor proctor(this, index);
+
+    d_values.emplace(d_values.begin() + index,
+                     BSLS_COMPILERFEATURES_FORWARD(VALUE_TYPE, value));
+
+    proctor.release();
+
+    return makeIterator(index);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+void FlatMultiMap<KEY, VALUE, COMPARATOR>::insertRange(INPUT_ITERATOR first,
+                                                       INPUT_ITERATOR last,
+                                                       bool           sorted)
+{
+    KeyContainer   keys(allocator());
+    ValueContainer values(allocator());
+
+    for (; first != last; ++first) {
+        keys.push_back((*first).first);
+        values.push_back((*first).second);
+    }
+
+    if (sorted) {
+        BSLS_ASSERT_SAFE(FlatSortedUtil::isSorted(keys.begin(),
+                                                  keys.end(),
+                                                  d_comparator));
+
+        merge(&keys, &values, 0);
+    }
+    else if (FlatSortedUtil::isSorted(keys.begin(),
+                                      keys.end(),
+                                      d_comparator)) {
+        merge(&keys, &values, 0);
+    }
+    else {
+        bsl::vector<bsl::size_t> order(keys.size(), 0, allocator());
+
+        FlatSortedUtil::sortPermutation(order.data(),
+                                        keys.data(),
+                                        keys.size(),
+                                        d_comparator);
+
+        merge(&keys, &values, order.data());
+    }
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+void FlatMultiMap<KEY, VALUE, COMPARATOR>::merge(KeyContainer      *keys,
+                                                 ValueContainer    *values,
+                                                 const bsl::size_t *order)
+{
+    BSLS_ASSERT(keys);
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(keys->size() == values->size());
+
+    const bsl::size_t numOld = d_keys.size();
+    const bsl::size_t numNew = keys->size();
+
+    if (0 == numNew) {
+        return;                                                       // RETURN
+    }
+
+    if (0 == numOld && 0 == order) {
+        // The new elements are sorted, and form the entire result.
+
+        d_keys.swap(*keys);
+        d_values.swap(*values);
+        return;                                                       // RETURN
+    }
+
+    KeyContainer   mergedKeys(allocator());
+    ValueContainer mergedValues(allocator());
+
+    mergedKeys.reserve(numOld + numNew);
+    mergedValues.reserve(numOld + numNew);
+
+    Proctor proctor(this);
+
+    bsl::size_t i = 0;  // index of the next element of this multimap
+    bsl::size_t j = 0;  // position in 'order' of the next new element
+
+    while (i < numOld || j < numNew) {
+        const bsl::size_t n = j < numNew ? (order ? order[j] : j) : 0;
+
+        // An existing element precedes the new elements having equivalent
+        // keys.
+
+        if (j == numNew
+         || (i < numOld && !d_comparator((*keys)[n], d_keys[i]))) {
+            mergedKeys.push_back(MoveUtil::move(d_keys[i]));
+            mergedValues.push_back(MoveUtil::move(d_values[i]));
+            ++i;
+        }
+        else {
+            mergedKeys.push_back(MoveUtil::move((*keys)[n]));
+            mergedValues.push_back(MoveUtil::move((*values)[n]));
+            ++j;
+        }
+    }
+
+    d_keys.swap(mergedKeys);
+    d_values.swap(mergedValues);
+
+    proctor.release();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::makeIterator(bsl::size_t index)
+{
+    BSLS_ASSERT_SAFE(index <= d_keys.size());
+
+    return iterator(d_keys.data() + index, d_values.data() + index);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t
+FlatMultiMap<KEY, VALUE, COMPARATOR>::lowerBoundIndex(const KEY& key) const
+{
+    const KEY *begin = d_keys.data();
+
+    return FlatSortedUtil::lowerBound(begin,
+                                      begin + d_keys.size(),
+                                      key,
+                                      d_comparator) - begin;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t
+FlatMultiMap<KEY, VALUE, COMPARATOR>::upperBoundIndex(const KEY& key) const
+{
+    const KEY *begin = d_keys.data();
+
+    return FlatSortedUtil::upperBound(begin,
+                                      begin + d_keys.size(),
+                                      key,
+                                      d_comparator) - begin;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::makeIterator(bsl::size_t index) const
+{
+    BSLS_ASSERT_SAFE(index <= d_keys.size());
+
+    return const_iterator(d_keys.data() + index, d_values.data() + index);
+}
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultiMap<KEY, VALUE, COMPARATOR>::FlatMultiMap()
+: d_keys()
+, d_values()
+, d_comparator()
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultiMap<KEY, VALUE, COMPARATOR>::FlatMultiMap(
+                                              bslma::Allocator *basicAllocator)
+: d_keys(basicAllocator)
+, d_values(basicAllocator)
+, d_comparator()
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultiMap<KEY, VALUE, COMPARATOR>::FlatMultiMap(
+                                            const COMPARATOR&  comparator,
+                                            bslma::Allocator  *basicAllocator)
+: d_keys(basicAllocator)
+, d_values(basicAllocator)
+, d_comparator(comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatMultiMap<KEY, VALUE, COMPARATOR>::FlatMultiMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bslma::Allocator *basicAllocator)
+: d_keys(basicAllocator)
+, d_values(basicAllocator)
+, d_comparator()
+{
+    insertRange(first, last, false);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatMultiMap<KEY, VALUE, COMPARATOR>::FlatMultiMap(
+                                            INPUT_ITERATOR     first,
+                                            INPUT_ITERATOR     last,
+                                            const COMPARATOR&  comparator,
+                                            bslma::Allocator  *basicAllocator)
+: d_keys(basicAllocator)
+, d_values(basicAllocator)
+, d_comparator(comparator)
+{
+    insertRange(first, last, false);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatMultiMap<KEY, VALUE, COMPARATOR>::FlatMultiMap(
+                                           SortedEquivalentTag  ,
+                                           INPUT_ITERATOR       first,
+                                           INPUT_ITERATOR       last,
+                                           bslma::Allocator    *basicAllocator)
+: d_keys(basicAllocator)
+, d_values(basicAllocator)
+, d_comparator()
+{
+    insertRange(first, last, true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatMultiMap<KEY, VALUE, COMPARATOR>::FlatMultiMap(
+                                           SortedEquivalentTag  ,
+                                           INPUT_ITERATOR       first,
+                                           INPUT_ITERATOR       last,
+                                           const COMPARATOR&    comparator,
+                                           bslma::Allocator    *basicAllocator)
+: d_keys(basicAllocator)
+, d_values(basicAllocator)
+, d_comparator(comparator)
+{
+    insertRange(first, last, true);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultiMap<KEY, VALUE, COMPARATOR>::FlatMultiMap(
+                            bsl::initializer_list<value_type>  values,
+                            bslma::Allocator                  *basicAllocator)
+: d_keys(basicAllocator)
+, d_values(basicAllocator)
+, d_comparator()
+{
+    insertRange(values.begin(), values.end(), false);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultiMap<KEY, VALUE, COMPARATOR>::FlatMultiMap(
+                            bsl::initializer_list<value_type>  values,
+                            const COMPARATOR&                  comparator,
+                            bslma::Allocator                  *basicAllocator)
+: d_keys(basicAllocator)
+, d_values(basicAllocator)
+, d_comparator(comparator)
+{
+    insertRange(values.begin(), values.end(), false);
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultiMap<KEY, VALUE, COMPARATOR>::FlatMultiMap(
+                                          const FlatMultiMap&  original,
+                                          bslma::Allocator    *basicAllocator)
+: d_keys(original.d_keys, basicAllocator)
+, d_values(original.d_values, basicAllocator)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultiMap<KEY, VALUE, COMPARATOR>::FlatMultiMap(
+                                      bslmf::MovableRef<FlatMultiMap> original)
+: d_keys(MoveUtil::move(MoveUtil::access(original).d_keys))
+, d_values(MoveUtil::move(MoveUtil::access(original).d_values))
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultiMap<KEY, VALUE, COMPARATOR>::FlatMultiMap(
+                             bslmf::MovableRef<FlatMultiMap>  original,
+                             bslma::Allocator                *basicAllocator)
+: d_keys(MoveUtil::move(MoveUtil::access(original).d_keys), basicAllocator)
+, d_values(MoveUtil::move(MoveUtil::access(original).d_values),
+           basicAllocator)
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultiMap<KEY, VALUE, COMPARATOR>&
+FlatMultiMap<KEY, VALUE, COMPARATOR>::operator=(const FlatMultiMap& rhs)
+{
+    if (this != &rhs) {
+        FlatMultiMap tmp(rhs, allocator());
+
+        this->swap(tmp);
+    }
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultiMap<KEY, VALUE, COMPARATOR>&
+FlatMultiMap<KEY, VALUE, COMPARATOR>::operator=(
+                                           bslmf::MovableRef<FlatMultiMap> rhs)
+{
+    FlatMultiMap& lvalue = rhs;
+
+    if (this != &lvalue) {
+        FlatMultiMap tmp(MoveUtil::move(lvalue), allocator());
+
+        this->swap(tmp);
+    }
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultiMap<KEY, VALUE, COMPARATOR>&
+FlatMultiMap<KEY, VALUE, COMPARATOR>::operator=(
+                                     bsl::initializer_list<value_type> values)
+{
+    FlatMultiMap tmp(values.begin(), values.end(), d_comparator, allocator());
+
+    this->swap(tmp);
+
+    return *this;
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMultiMap<KEY, VALUE, COMPARATOR>::clear()
+{
+    d_keys.clear();
+    d_values.clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::pair<typename FlatMultiMap<KEY, VALUE, COMPARATOR>::iterator,
+          typename FlatMultiMap<KEY, VALUE, COMPARATOR>::iterator>
+FlatMultiMap<KEY, VALUE, COMPARATOR>::equal_range(const KEY& key)
+{
+    return bsl::pair<iterator, iterator>(makeIterator(lowerBoundIndex(key)),
+                                         makeIterator(upperBoundIndex(key)));
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t FlatMultiMap<KEY, VALUE, COMPARATOR>::erase(const KEY& key)
+{
+    const bsl::size_t first = lowerBoundIndex(key);
+    const bsl::size_t last  = upperBoundIndex(key);
+
+    d_keys.erase(d_keys.begin() + first, d_keys.begin() + last);
+    d_values.erase(d_values.begin() + first, d_values.begin() + last);
+
+    return last - first;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    const bsl::size_t index = position.keyAddress() - d_keys.data();
+
+    d_keys.erase(d_keys.begin() + index);
+    d_values.erase(d_values.begin() + index);
+
+    return makeIterator(index);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::erase(iterator position)
+{
+    // Note that this overload is required to avoid ambiguity when the key is
+    // an iterator.
+
+    return erase(const_iterator(position));
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    BSLS_ASSERT_SAFE(first <= last);
+
+    const bsl::size_t index  = first.keyAddress() - d_keys.data();
+    const bsl::size_t length = last - first;
+
+    d_keys.erase(d_keys.begin() + index, d_keys.begin() + index + length);
+    d_values.erase(d_values.begin() + index,
+                   d_values.begin() + index + length);
+
+    return makeIterator(index);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::find(const KEY& key)
+{
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    if (index < d_keys.size() && !d_comparator(key, d_keys[index])) {
+        return makeIterator(index);                                   // RETURN
+    }
+    return end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+void FlatMultiMap<KEY, VALUE, COMPARATOR>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    insertRange(first, last, false);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+void FlatMultiMap<KEY, VALUE, COMPARATOR>::insert(SortedEquivalentTag  ,
+                                                  INPUT_ITERATOR       first,
+                                                  INPUT_ITERATOR       last)
+{
+    insertRange(first, last, true);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMultiMap<KEY, VALUE, COMPARATOR>::insert(
+                                     bsl::initializer_list<value_type> values)
+{
+    insertRange(values.begin(), values.end(), false);
+}
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class KEY, class VALUE, class COMPARATOR>
+template <class... ARGS>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::emplace(ARGS&&... args)
+{
+    bsls::ObjectBuffer<value_type> buffer;
+
+    bslma::ConstructionUtil::construct(
+                                    buffer.address(),
+                                    allocator(),
+                                    BSLS_COMPILERFEATURES_FORWARD(ARGS,
+                                                                  args)...);
+
+    bslma::DestructorGuard<value_type> guard(buffer.address());
+
+    return insert(MoveUtil::move(buffer.object()));
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::lower_bound(const KEY& key)
+{
+    return makeIterator(lowerBoundIndex(key));
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMultiMap<KEY, VALUE, COMPARATOR>::reserve(bsl::size_t numElements)
+{
+    d_keys.reserve(numElements);
+    d_values.reserve(numElements);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::upper_bound(const KEY& key)
+{
+    return makeIterator(upperBoundIndex(key));
+}
+
+                          // Iterators
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::begin()
+{
+    return makeIterator(0);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::end()
+{
+    return makeIterator(d_keys.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::reverse_iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::reverse_iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+                             // Aspects
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMultiMap<KEY, VALUE, COMPARATOR>::swap(FlatMultiMap& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    d_keys.swap(other.d_keys);
+    d_values.swap(other.d_values);
+    bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t FlatMultiMap<KEY, VALUE, COMPARATOR>::capacity() const
+{
+    return d_keys.capacity() < d_values.capacity() ? d_keys.capacity()
+                                                   : d_values.capacity();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool FlatMultiMap<KEY, VALUE, COMPARATOR>::contains(const KEY& key) const
+{
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    return index < d_keys.size() && !d_comparator(key, d_keys[index]);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t FlatMultiMap<KEY, VALUE, COMPARATOR>::count(const KEY& key) const
+{
+    return upperBoundIndex(key) - lowerBoundIndex(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool FlatMultiMap<KEY, VALUE, COMPARATOR>::empty() const
+{
+    return d_keys.empty();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::pair<typename FlatMultiMap<KEY, VALUE, COMPARATOR>::const_iterator,
+          typename FlatMultiMap<KEY, VALUE, COMPARATOR>::const_iterator>
+FlatMultiMap<KEY, VALUE, COMPARATOR>::equal_range(const KEY& key) const
+{
+    return bsl::pair<const_iterator, const_iterator>(
+                                          makeIterator(lowerBoundIndex(key)),
+                                          makeIterator(upperBoundIndex(key)));
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::find(const KEY& key) const
+{
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    if (index < d_keys.size() && !d_comparator(key, d_keys[index])) {
+        return makeIterator(index);                                   // RETURN
+    }
+    return end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+COMPARATOR FlatMultiMap<KEY, VALUE, COMPARATOR>::key_comp() const
+{
+    return d_comparator;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+const bsl::vector<KEY>& FlatMultiMap<KEY, VALUE, COMPARATOR>::keys() const
+{
+    return d_keys;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::lower_bound(const KEY& key) const
+{
+    return makeIterator(lowerBoundIndex(key));
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t FlatMultiMap<KEY, VALUE, COMPARATOR>::size() const
+{
+    return d_keys.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::upper_bound(const KEY& key) const
+{
+    return makeIterator(upperBoundIndex(key));
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+const bsl::vector<VALUE>&
+FlatMultiMap<KEY, VALUE, COMPARATOR>::values() const
+{
+    return d_values;
+}
+
+                          // Iterators
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::begin() const
+{
+    return makeIterator(0);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::cbegin() const
+{
+    return makeIterator(0);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::end() const
+{
+    return makeIterator(d_keys.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::cend() const
+{
+    return makeIterator(d_keys.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::const_reverse_iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::const_reverse_iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::crbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::const_reverse_iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultiMap<KEY, VALUE, COMPARATOR>::const_reverse_iterator
+FlatMultiMap<KEY, VALUE, COMPARATOR>::crend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+                             // Aspects
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bslma::Allocator *FlatMultiMap<KEY, VALUE, COMPARATOR>::allocator() const
+{
+    return d_keys.get_allocator().mechanism();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+bsl::ostream& FlatMultiMap<KEY, VALUE, COMPARATOR>::print(
+                                            bsl::ostream& stream,
+                                            int           level,
+                                            int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;                                                // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+
+    printer.start();
+
+    for (bsl::size_t i = 0; i < d_keys.size(); ++i) {
+        printer.printValue(bsl::pair<const KEY&, const VALUE&>(d_keys[i],
+                                                               d_values[i]));
+    }
+
+    printer.end();
+
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool bdlc::operator==(const FlatMultiMap<KEY, VALUE, COMPARATOR>& lhs,
+                      const FlatMultiMap<KEY, VALUE, COMPARATOR>& rhs)
+{
+    return lhs.d_keys == rhs.d_keys && lhs.d_values == rhs.d_values;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool bdlc::operator!=(const FlatMultiMap<KEY, VALUE, COMPARATOR>& lhs,
+                      const FlatMultiMap<KEY, VALUE, COMPARATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool bdlc::operator<(const FlatMultiMap<KEY, VALUE, COMPARATOR>& lhs,
+                     const FlatMultiMap<KEY, VALUE, COMPARATOR>& rhs)
+{
+    const bsl::size_t length = lhs.size() < rhs.size() ? lhs.size()
+                                                       : rhs.size();
+
+    for (bsl::size_t i = 0; i < length; ++i) {
+        if (lhs.d_keys[i] < rhs.d_keys[i]) {
+            return true;                                              // RETURN
+        }
+        if (rhs.d_keys[i] < lhs.d_keys[i]) {
+            return false;                                             // RETURN
+        }
+        if (lhs.d_values[i] < rhs.d_values[i]) {
+            return true;                                              // RETURN
+        }
+        if (rhs.d_values[i] < lhs.d_values[i]) {
+            return false;                                             // RETURN
+        }
+    }
+    return lhs.size() < rhs.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::ostream& bdlc::operator<<(
+                           bsl::ostream&                               stream,
+                           const FlatMultiMap<KEY, VALUE, COMPARATOR>& map)
+{
+    return map.print(stream, 0, -1);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void bdlc::swap(FlatMultiMap<KEY, VALUE, COMPARATOR>& a,
+                FlatMultiMap<KEY, VALUE, COMPARATOR>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    typedef FlatMultiMap<KEY, VALUE, COMPARATOR> MultiMap;
+
+    MultiMap futureA(b, a.allocator());
+    MultiMap futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslalg {
+
+template <class KEY, class VALUE, class COMPARATOR>
+struct HasStlIterators<bdlc::FlatMultiMap<KEY, VALUE, COMPARATOR> >
+: bsl::true_type {
+};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class VALUE, class COMPARATOR>
+struct UsesBslmaAllocator<bdlc::FlatMultiMap<KEY, VALUE, COMPARATOR> >
+: bsl::true_type {
+};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1482 @@
+// bdlc_flatset.h                                                     -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATSET
+#define INCLUDED_BDLC_FLATSET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered set container stored in a sorted vector.
+//
+//@CLASSES:
+//   bdlc::FlatSet: sorted-vector based ordered set container
+//
+//@SEE_ALSO: bdlc_flatmap, bdlc_flatmultimap, bdlc_flatsortedutil, bsl_set
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatSet', that implements an ordered set of unique keys stored, in
+// order, in a contiguous array (a 'bsl::vector').
+//
+// An instantiation of 'bdlc::FlatSet' is an allocator-aware, value-semantic
+// type whose salient attributes are its size (number of keys) and the ordered
+// sequence of keys the set contains.  An instantiation may be provided with a
+// custom key-comparison functor, but that functor is not a salient attribute.
+// In particular, when comparing element values for equality between two
+// different 'bdlc::FlatSet' objects, the elements are compared using
+// 'operator=='.
+//
+// 'bdlc::FlatSet' is the set counterpart of 'bdlc::FlatMap' (see
+// 'bdlc_flatmap'), and has the same performance characteristics: compact
+// storage, branchless binary search (see 'bdlc_flatsortedutil'), and fast
+// iteration, in exchange for insertion and erasure of a single element in
+// time linear in the size of the set.  The iterators of a 'bdlc::FlatSet'
+// are the (random-access) 'const_iterator' of 'bsl::vector', and every
+// insertion or erasure invalidates all iterators, pointers, and references to
+// the elements of the set.
+//
+///Bulk Insertion
+///--------------
+// The range-insertion methods (and the range constructors) insert all of the
+// elements of a range at once.  If the range is known to be sorted with
+// respect to the comparator of the set, and to contain no two equivalent
+// elements, the client may pass a 'bdlc::SortedUniqueTag' object as the first
+// argument, in which case the elements of the range are merged with the
+// existing elements in linear time.  Otherwise, the range is first sorted,
+// and then merged, for a total complexity of 'O(N + M * log(M))', where 'N'
+// is the size of the set and 'M' is the length of the range.  In either case,
+// an element of the range that is equivalent to an element of the set, or to
+// an earlier element of the range, is not inserted.
+//
+///Requirements on 'KEY' and 'COMPARATOR'
+///--------------------------------------
+// The (template parameter) type 'KEY' must be copy-constructible,
+// move-constructible, and move-assignable.  The (template parameter) type
+// 'COMPARATOR' must be a copy-constructible functor defining a strict weak
+// ordering on 'KEY' values; 'COMPARATOR' must also be default-constructible
+// if a constructor not taking a comparator is used.
+//
+///Exception Safety
+///----------------
+// A 'bdlc::FlatSet' is exception neutral, and all of the methods of
+// 'bdlc::FlatSet' provide the basic exception safety guarantee (see
+// {'bsldoc_glossary'|Basic Guarantee}).  Should the move constructor of 'KEY'
+// throw during a bulk insertion, the set is left empty.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Screening Against a Restricted List
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose every order must be screened against a list of restricted
+// securities that is published once a day, and is consulted for every order.
+//
+// First, we load the day's list, which arrives unsorted and may contain
+// duplicates:
+//..
+//  const char *const PUBLISHED[] = { "IBM", "AAPL", "MSFT", "AAPL", "BA" };
+//  const int         NUM_PUBLISHED = sizeof PUBLISHED / sizeof *PUBLISHED;
+//
+//  bdlc::FlatSet<bsl::string> restricted(PUBLISHED,
+//                                        PUBLISHED + NUM_PUBLISHED);
+//  assert(4 == restricted.size());
+//..
+// Then, we screen orders for a few securities:
+//..
+//  assert(true  == restricted.contains("MSFT"));
+//  assert(false == restricted.contains("GOOG"));
+//..
+// Finally, we observe that the securities are held, in order, in a contiguous
+// array:
+//..
+//  assert("AAPL" == restricted.keys().front());
+//  assert("MSFT" == restricted.keys().back());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flatsortedutil.h>
+
+#include <bslalg_hasstliterators.h>
+#include <bslalg_swaputil.h>
+
+#include <bslim_printer.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_destructorguard.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_movableref.h>
+#include <bslmf_util.h>    // 'forward(V)'
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_util.h>     // 'forward<T>(V)'
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <bsl_initializer_list.h>
+#endif
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_iterator.h>
+#include <bsl_ostream.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+// FORWARD DECLARATIONS
+template <class KEY, class COMPARATOR = bsl::less<KEY> >
+class FlatSet;
+
+template <class KEY, class COMPARATOR>
+bool operator==(const FlatSet<KEY, COMPARATOR>& lhs,
+                const FlatSet<KEY, COMPARATOR>& rhs);
+
+template <class KEY, class COMPARATOR>
+bool operator!=(const FlatSet<KEY, COMPARATOR>& lhs,
+                const FlatSet<KEY, COMPARATOR>& rhs);
+
+template <class KEY, class COMPARATOR>
+bool operator<(const FlatSet<KEY, COMPARATOR>& lhs,
+               const FlatSet<KEY, COMPARATOR>& rhs);
+
+template <class KEY, class COMPARATOR>
+void swap(FlatSet<KEY, COMPARATOR>& a, FlatSet<KEY, COMPARATOR>& b);
+
+                               // =============
+                               // class FlatSet
+                               // =============
+
+template <class KEY, class COMPARATOR>
+class FlatSet {
+    // This class template implements a value-semantic container type holding
+    // an ordered set of unique keys of (template parameter) type 'KEY', held
+    // in order in a contiguous array.  The (template parameter) type
+    // 'COMPARATOR' is a functor defining the order of 'KEY' values.  See
+    // {Requirements on 'KEY' and 'COMPARATOR'} for more information.
+
+    // PRIVATE TYPES
+    typedef bslmf::MovableRefUtil MoveUtil;
+    typedef bsl::vector<KEY>      KeyContainer;
+
+    class Proctor;
+        // clears a set on destruction unless released
+
+    // DATA
+    KeyContainer d_keys;        // keys, in order
+    COMPARATOR   d_comparator;  // defines the order of the keys
+
+    // FRIENDS
+    friend bool operator==<>(const FlatSet&, const FlatSet&);
+    friend bool operator!=<>(const FlatSet&, const FlatSet&);
+    friend bool operator< <>(const FlatSet&, const FlatSet&);
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                      key_type;
+    typedef KEY                                      value_type;
+    typedef bsl::size_t                              size_type;
+    typedef bsl::ptrdiff_t                           difference_type;
+    typedef COMPARATOR                               key_compare;
+    typedef COMPARATOR                               value_compare;
+    typedef value_type&                              reference;
+    typedef const value_type&                        const_reference;
+    typedef typename KeyContainer::const_iterator    iterator;
+    typedef typename KeyContainer::const_iterator    const_iterator;
+    typedef bsl::reverse_iterator<iterator>          reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>    const_reverse_iterator;
+
+  private:
+    // PRIVATE MANIPULATORS
+    template <class INPUT_ITERATOR>
+    void insertRange(INPUT_ITERATOR first, INPUT_ITERATOR last, bool sorted);
+        // Insert into this set the value of each element in the input iterator
+        // range specified by 'first' through 'last' (including 'first',
+        // excluding 'last') that is not equivalent to an element of this set
+        // or to an earlier element of the range.  If the specified 'sorted' is
+        // 'true', the behavior is undefined unless the range is sorted with
+        // respect to the comparator of this set and contains no two
+        // equivalent elements.
+
+    void merge(KeyContainer *keys);
+        // Merge into this set the elements of the specified 'keys', ignoring
+        // each element that is equivalent to an element of this set or to an
+        // earlier element of 'keys'.  The elements of 'keys' are left in a
+        // valid but unspecified state.  The behavior is undefined unless
+        // 'keys' uses the allocator of this set and is sorted.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t lowerBoundIndex(const KEY& key) const;
+        // Return the index of the first element in this set that is not
+        // ordered before the specified 'key', or 'size()' if no such element
+        // exists.
+
+    bsl::size_t upperBoundIndex(const KEY& key) const;
+        // Return the index of the first element in this set that is ordered
+        // after the specified 'key', or 'size()' if no such element exists.
+
+  public:
+    // CREATORS
+    FlatSet();
+    explicit FlatSet(bslma::Allocator *basicAllocator);
+    explicit FlatSet(const COMPARATOR&  comparator,
+                     bslma::Allocator  *basicAllocator = 0);
+        // Create an empty 'FlatSet' object.  Optionally specify a
+        // 'comparator' used to order the keys in this container.  If
+        // 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied or is 0, the currently installed default allocator is
+        // used.  No memory is allocated.
+
+    template <class INPUT_ITERATOR>
+    FlatSet(INPUT_ITERATOR    first,
+            INPUT_ITERATOR    last,
+            bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatSet(INPUT_ITERATOR     first,
+            INPUT_ITERATOR     last,
+            const COMPARATOR&  comparator,
+            bslma::Allocator  *basicAllocator = 0);
+        // Create a 'FlatSet' object initialized by insertion of the values
+        // from the input iterator range specified by 'first' through 'last'
+        // (including 'first', excluding 'last').  Optionally specify a
+        // 'comparator' used to order the keys in this container.  If
+        // 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied or is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'first' and 'last' refer to
+        // a sequence of valid values where 'first' is at a position at or
+        // before 'last'.  Note that if a member of the input sequence is
+        // equivalent to an earlier member, the later member will not be
+        // inserted.
+
+    template <class INPUT_ITERATOR>
+    FlatSet(SortedUniqueTag   ,
+            INPUT_ITERATOR    first,
+            INPUT_ITERATOR    last,
+            bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatSet(SortedUniqueTag    ,
+            INPUT_ITERATOR     first,
+            INPUT_ITERATOR     last,
+            const COMPARATOR&  comparator,
+            bslma::Allocator  *basicAllocator = 0);
+        // Create a 'FlatSet' object holding the values from the input iterator
+        // range specified by 'first' through 'last' (including 'first',
+        // excluding 'last'), in time linear in the length of the range.
+        // Optionally specify a 'comparator' used to order the keys in this
+        // container.  If 'comparator' is not supplied, a default-constructed
+        // object of the (template parameter) type 'COMPARATOR' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied or is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless 'first'
+        // and 'last' refer to a sequence of valid values where 'first' is at a
+        // position at or before 'last', and the sequence is sorted with
+        // respect to the comparator and contains no two equivalent values.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    FlatSet(bsl::initializer_list<value_type>  values,
+            bslma::Allocator                  *basicAllocator = 0);
+    FlatSet(bsl::initializer_list<value_type>  values,
+            const COMPARATOR&                  comparator,
+            bslma::Allocator                  *basicAllocator = 0);
+        // Create a 'FlatSet' object initialized by insertion of the specified
+        // 'values'.  Optionally specify a 'comparator' used to order the keys
+        // in this container.  If 'comparator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'COMPARATOR' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not supplied or is 0, the
+        // currently installed default allocator is used.  Note that if a
+        // member of 'values' is equivalent to an earlier member, the later
+        // member will not be inserted.
+#endif
+
+    FlatSet(const FlatSet& original, bslma::Allocator *basicAllocator = 0);
+        // Create a 'FlatSet' object having the same value and comparator as
+        // the specified 'original' object.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // specified or is 0, the currently installed default allocator is
+        // used.
+
+    FlatSet(bslmf::MovableRef<FlatSet> original);
+        // Create a 'FlatSet' object having the same value, comparator, and
+        // allocator as the specified 'original' object.  The contents of
+        // 'original' are moved (in constant time) to this object, 'original'
+        // is left in a (valid) unspecified state, and no exceptions will be
+        // thrown.
+
+    FlatSet(bslmf::MovableRef<FlatSet>  original,
+            bslma::Allocator           *basicAllocator);
+        // Create a 'FlatSet' object having the same value and comparator as
+        // the specified 'original' object, using the specified
+        // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  The allocator of
+        // 'original' remains unchanged.  If 'original' and the newly created
+        // object have the same allocator then the contents of 'original' are
+        // moved (in constant time) to this object, 'original' is left in a
+        // (valid) unspecified state, and no exceptions will be thrown;
+        // otherwise, the elements of 'original' are moved, 'original' is left
+        // in a (valid) unspecified state, and an exception may be thrown.
+
+    //! ~FlatSet() = default;
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    FlatSet& operator=(const FlatSet& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.
+
+    FlatSet& operator=(bslmf::MovableRef<FlatSet> rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  If this object and 'rhs' use the same allocator the
+        // contents of 'rhs' are moved (in constant time) to this object.
+        // 'rhs' is left in a (valid) unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    FlatSet& operator=(bsl::initializer_list<value_type> values);
+        // Assign to this object the value resulting from first clearing this
+        // set and then inserting each object in the specified 'values'
+        // initializer list, ignoring those objects that are equivalent to an
+        // object appearing earlier in the list; return a reference providing
+        // modifiable access to this object.
+#endif
+
+    void clear();
+        // Remove all entries from this set.  Note that the set is empty after
+        // this call, but allocated memory may be retained for future use.
+
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        // Return a pair of iterators defining the sequence of elements in this
+        // set equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence and the second iterator is
+        // positioned one past the end of the sequence.  If this set contains
+        // no element equivalent to 'key', then the two returned iterators will
+        // have the same value.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove from this set the element equivalent to the specified 'key',
+        // if it exists, and return 1; otherwise (there is no such element in
+        // this set), return 0 with no other effect.
+
+    iterator erase(const_iterator position);
+        // Remove from this set the element at the specified 'position', and
+        // return an iterator referring to the element immediately following
+        // the removed element, or to the past-the-end position if the removed
+        // element was the last element in the sequence of elements maintained
+        // by this set.  The behavior is undefined unless 'position' refers to
+        // an element in this set.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this set the elements starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and return an iterator referring to the element at 'last' prior to
+        // the erasure.  The behavior is undefined unless 'first' and 'last'
+        // either refer to elements in this set or are the 'end' iterator, and
+        // the 'first' position is at or before the 'last' position in the
+        // sequence provided by this container.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the element in this set equivalent
+        // to the specified 'key', or 'end()' if no such element exists in this
+        // set.
+
+    template <class VALUE_TYPE>
+    typename bsl::enable_if<bsl::is_convertible<VALUE_TYPE, value_type>::value,
+                            bsl::pair<iterator, bool> >::type
+                    insert(BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value)
+        // Insert the specified 'value' into this set if no element equivalent
+        // to 'value' already exists in this set; otherwise, this method has no
+        // effect.  Return a 'pair' whose 'first' member is an iterator
+        // referring to the (possibly newly inserted) element in this set
+        // equivalent to 'value', and whose 'second' member is 'true' if a new
+        // element was inserted, and 'false' if an equivalent element was
+        // already present.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        const KEY&        key   = value;
+        const bsl::size_t index = lowerBoundIndex(key);
+
+        if (index < d_keys.size() && !d_comparator(key, d_keys[index])) {
+            return bsl::pair<iterator, bool>(d_keys.cbegin() + index,
+                                             false);                  // RETURN
+        }
+
+        d_keys.emplace(d_keys.cbegin() + index,
+                       BSLS_COMPILERFEATURES_FORWARD(VALUE_TYPE, value));
+
+        return bsl::pair<iterator, bool>(d_keys.cbegin() + index, true);
+    }
+
+    template <class VALUE_TYPE>
+    typename bsl::enable_if<bsl::is_convertible<VALUE_TYPE, value_type>::value,
+                            iterator>::type
+                    insert(const_iterator                                ,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(VALUE_TYPE) value)
+        // Insert the specified 'value' into this set if no element equivalent
+        // to 'value' already exists in this set; otherwise, this method has no
+        // effect.  Return an iterator referring to the (possibly newly
+        // inserted) element in this set equivalent to 'value'.  The supplied
+        // 'const_iterator' is ignored.
+    {
+        // Note that some compilers require functions declared with 'enable_if'
+        // to be defined inline.
+
+        return insert(BSLS_COMPILERFEATURES_FORWARD(VALUE_TYPE, value)).first;
+    }
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set the value of each element in the input iterator
+        // range specified by 'first' through 'last' (including 'first',
+        // excluding 'last') that is not equivalent to an element of this set
+        // or to an earlier element of the range, in 'O(size() + M * log(M))'
+        // time, where 'M' is the length of the range.  The behavior is
+        // undefined unless 'first' and 'last' refer to a sequence of valid
+        // values where 'first' is at a position at or before 'last'.
+
+    template <class INPUT_ITERATOR>
+    void insert(SortedUniqueTag, INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set the value of each element in the input iterator
+        // range specified by 'first' through 'last' (including 'first',
+        // excluding 'last') that is not equivalent to an element of this set,
+        // in time linear in 'size()' and the length of the range.  The
+        // behavior is undefined unless 'first' and 'last' refer to a sequence
+        // of valid values where 'first' is at a position at or before 'last',
+        // and the sequence is sorted with respect to the comparator of this
+        // set and contains no two equivalent values.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void insert(bsl::initializer_list<value_type> values);
+        // Insert into this set the value of each element in the specified
+        // 'values' initializer list that is not equivalent to an element of
+        // this set or to an earlier element of 'values'.
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... ARGS>
+    bsl::pair<iterator, bool> emplace(ARGS&&... args);
+        // Insert into this set a newly-created element constructed by
+        // forwarding this set's allocator and the specified 'args' to the
+        // constructor of 'KEY', if no equivalent element is already present.
+        // Return a 'pair' whose 'first' member is an iterator referring to the
+        // (possibly newly inserted) equivalent element, and whose 'second'
+        // member is 'true' if a new element was inserted.
+#endif
+
+    iterator lower_bound(const KEY& key);
+        // Return an iterator referring to the first element in this set that
+        // is not ordered before the specified 'key', or 'end()' if no such
+        // element exists.
+
+    void reserve(bsl::size_t numElements);
+        // Change the capacity of this set to at least the specified
+        // 'numElements'.  Note that this method has no effect unless
+        // 'numElements > capacity()'.
+
+    iterator upper_bound(const KEY& key);
+        // Return an iterator referring to the first element in this set that
+        // is ordered after the specified 'key', or 'end()' if no such element
+        // exists.
+
+                          // Iterators
+
+    iterator begin();
+        // Return an iterator referring to the first element in the sequence of
+        // elements maintained by this set, or the 'end' iterator if this set
+        // is empty.
+
+    iterator end();
+        // Return an iterator referring to the past-the-end position in the
+        // sequence of elements maintained by this set.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator referring to the last element in the
+        // sequence of elements maintained by this set, or 'rend' if this set
+        // is empty.
+
+    reverse_iterator rend();
+        // Return a reverse iterator referring to the past-the-end position in
+        // the reverse sequence of elements maintained by this set.
+
+                             // Aspects
+
+    void swap(FlatSet& other);
+        // Exchange the value of this object as well as its comparator with
+        // those of the specified 'other' object.  This method provides the
+        // no-throw exception-safety guarantee if 'COMPARATOR' provides a
+        // no-throw swap.  The behavior is undefined unless this object was
+        // created with the same allocator as 'other'.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the number of elements this set can hold without
+        // reallocation.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this set contains an element equivalent to the
+        // specified 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements in this set equivalent to the
+        // specified 'key'.  Note that since a set maintains unique keys, the
+        // returned value will be either 0 or 1.
+
+    bool empty() const;
+        // Return 'true' if this set contains no elements, and 'false'
+        // otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                         const KEY& key) const;
+        // Return a pair of iterators defining the sequence of elements in this
+        // set equivalent to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence and the second iterator is
+        // positioned one past the end of the sequence.  If this set contains
+        // no element equivalent to 'key', then the two returned iterators will
+        // have the same value.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the element in this set equivalent
+        // to the specified 'key', or 'end()' if no such element exists in this
+        // set.
+
+    COMPARATOR key_comp() const;
+        // Return (a copy of) the key-comparison functor used by this set.
+
+    const bsl::vector<KEY>& keys() const;
+        // Return a reference providing non-modifiable access to the array of
+        // the keys of this set, in order.
+
+    const_iterator lower_bound(const KEY& key) const;
+        // Return an iterator referring to the first element in this set that
+        // is not ordered before the specified 'key', or 'end()' if no such
+        // element exists.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this set.
+
+    const_iterator upper_bound(const KEY& key) const;
+        // Return an iterator referring to the first element in this set that
+        // is ordered after the specified 'key', or 'end()' if no such element
+        // exists.
+
+    COMPARATOR value_comp() const;
+        // Return (a copy of) the value-comparison functor used by this set.
+
+                          // Iterators
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator referring to the first element in the sequence of
+        // elements maintained by this set, or the 'end' iterator if this set
+        // is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return an iterator referring to the past-the-end position in the
+        // sequence of elements maintained by this set.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator referring to the last element in the
+        // sequence of elements maintained by this set, or 'rend' if this set
+        // is empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator referring to the past-the-end position in
+        // the reverse sequence of elements maintained by this set.
+
+                             // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this set to supply memory.
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level          = 0,
+                        int           spacesPerLevel = 4) const;
+        // Format this object to the specified output 'stream' at the (absolute
+        // value of) the optionally specified indentation 'level' and return a
+        // reference to 'stream'.  If 'level' is specified, optionally specify
+        // 'spacesPerLevel', the number of spaces per indentation level for
+        // this and all of its nested objects.  If 'level' is negative,
+        // suppress indentation of the first line.  If 'spacesPerLevel' is
+        // negative format the entire output on one line, suppressing all but
+        // the initial indentation (as governed by 'level').  If 'stream' is
+        // not valid on entry, this operation has no effect.
+};
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR>
+bool operator==(const FlatSet<KEY, COMPARATOR>& lhs,
+                const FlatSet<KEY, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'FlatSet' objects have the same
+    // value if their sizes are the same and each element contained in one is
+    // equal to the element at the same position in the other.  This method
+    // requires that the (template parameter) type 'KEY' be
+    // equality-comparable.
+
+template <class KEY, class COMPARATOR>
+bool operator!=(const FlatSet<KEY, COMPARATOR>& lhs,
+                const FlatSet<KEY, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'FlatSet' objects do not have
+    // the same value if they do not have the same size, or some element
+    // contained in one is not equal to the element at the same position in
+    // the other.  This method requires that the (template parameter) type
+    // 'KEY' be equality-comparable.
+
+template <class KEY, class COMPARATOR>
+bool operator<(const FlatSet<KEY, COMPARATOR>& lhs,
+               const FlatSet<KEY, COMPARATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' set is
+    // lexicographically less than that of the specified 'rhs' set, and
+    // 'false' otherwise.  Elements are compared using 'operator<'.
+
+template <class KEY, class COMPARATOR>
+bsl::ostream& operator<<(bsl::ostream&                   stream,
+                         const FlatSet<KEY, COMPARATOR>& set);
+    // Write the value of the specified 'set' to the specified output 'stream'
+    // in a single-line format, and return a reference providing modifiable
+    // access to 'stream'.  If 'stream' is not valid on entry, this operation
+    // has no effect.  Note that this human-readable format is not fully
+    // specified and can change without notice.
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR>
+void swap(FlatSet<KEY, COMPARATOR>& a, FlatSet<KEY, COMPARATOR>& b);
+    // Exchange the values of the specified 'a' and 'b' objects.  This method
+    // provides the no-throw exception-safety guarantee if the two objects
+    // were created with the same allocator and the basic guarantee otherwise.
+
+                          // ======================
+                          // class FlatSet::Proctor
+                          // ======================
+
+template <class KEY, class COMPARATOR>
+class FlatSet<KEY, COMPARATOR>::Proctor {
+    // This class implements a proctor that, unless its 'release' method has
+    // been invoked, clears, on destruction, a set whose array of keys may be
+    // in an inconsistent state.
+
+    // DATA
+    FlatSet *d_set_p;  // managed set, or 0 if released
+
+  private:
+    // NOT IMPLEMENTED
+    Proctor(const Proctor&);
+    Proctor& operator=(const Proctor&);
+
+  public:
+    // CREATORS
+    explicit Proctor(FlatSet *set);
+        // Create a proctor that clears the specified 'set' on destruction
+        // unless released.
+
+    ~Proctor();
+        // Clear the managed set, unless this proctor has been released.
+
+    // MANIPULATORS
+    void release();
+        // Release the managed set from management by this proctor.
+};
+
+// ============================================================================
+//                TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                          // ----------------------
+                          // class FlatSet::Proctor
+                          // ----------------------
+
+// CREATORS
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::Proctor::Proctor(FlatSet *set)
+: d_set_p(set)
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::Proctor::~Proctor()
+{
+    if (d_set_p) {
+        d_set_p->d_keys.clear();
+    }
+}
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR>
+inline
+void FlatSet<KEY, COMPARATOR>::Proctor::release()
+{
+    d_set_p = 0;
+}
+
+                               // -------------
+                               // class FlatSet
+                               // -------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+void FlatSet<KEY, COMPARATOR>::insertRange(INPUT_ITERATOR first,
+                                           INPUT_ITERATOR last,
+                                           bool           sorted)
+{
+    KeyContainer keys(first, last, allocator());
+
+    if (sorted) {
+        BSLS_ASSERT_SAFE(FlatSortedUtil::isSortedUnique(keys.begin(),
+                                                        keys.end(),
+                                                        d_comparator));
+    }
+    else if (!FlatSortedUtil::isSorted(keys.begin(),
+                                       keys.end(),
+                                       d_comparator)) {
+        // A stable sort retains the first of several equivalent elements in
+        // front, so that it is the one inserted.
+
+        bsl::stable_sort(keys.begin(), keys.end(), d_comparator);
+    }
+
+    merge(&keys);
+}
+
+template <class KEY, class COMPARATOR>
+void FlatSet<KEY, COMPARATOR>::merge(KeyContainer *keys)
+{
+    BSLS_ASSERT(keys);
+
+    const bsl::size_t numOld = d_keys.size();
+    const bsl::size_t numNew = keys->size();
+
+    if (0 == numNew) {
+        return;                                                       // RETURN
+    }
+
+    if (0 == numOld
+     && FlatSortedUtil::isSortedUnique(keys->begin(),
+                                       keys->end(),
+                                       d_comparator)) {
+        // The new elements are unique, and form the entire result.
+
+        d_keys.swap(*keys);
+        return;                                                       // RETURN
+    }
+
+    KeyContainer merged(allocator());
+    merged.reserve(numOld + numNew);
+
+    Proctor proctor(this);
+
+    bsl::size_t i = 0;  // index of the next element of this set
+    bsl::size_t j = 0;  // index of the next new element
+
+    while (i < numOld || j < numNew) {
+        if (j == numNew
+         || (i < numOld && !d_comparator((*keys)[j], d_keys[i]))) {
+            merged.push_back(MoveUtil::move(d_keys[i]));
+            ++i;
+        }
+        else {
+            // A new element equivalent to the previous element (an existing
+            // element, or an earlier new element) is not inserted.
+
+            if (merged.empty() || d_comparator(merged.back(), (*keys)[j])) {
+                merged.push_back(MoveUtil::move((*keys)[j]));
+            }
+            ++j;
+        }
+    }
+
+    d_keys.swap(merged);
+
+    proctor.release();
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t FlatSet<KEY, COMPARATOR>::lowerBoundIndex(const KEY& key) const
+{
+    const KEY *begin = d_keys.data();
+
+    return FlatSortedUtil::lowerBound(begin,
+                                      begin + d_keys.size(),
+                                      key,
+                                      d_comparator) - begin;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t FlatSet<KEY, COMPARATOR>::upperBoundIndex(const KEY& key) const
+{
+    const KEY *begin = d_keys.data();
+
+    return FlatSortedUtil::upperBound(begin,
+                                      begin + d_keys.size(),
+                                      key,
+                                      d_comparator) - begin;
+}
+
+// CREATORS
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet()
+: d_keys()
+, d_comparator()
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(bslma::Allocator *basicAllocator)
+: d_keys(basicAllocator)
+, d_comparator()
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(const COMPARATOR&  comparator,
+                                  bslma::Allocator  *basicAllocator)
+: d_keys(basicAllocator)
+, d_comparator(comparator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(INPUT_ITERATOR    first,
+                                  INPUT_ITERATOR    last,
+                                  bslma::Allocator *basicAllocator)
+: d_keys(basicAllocator)
+, d_comparator()
+{
+    insertRange(first, last, false);
+}
+
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(INPUT_ITERATOR     first,
+                                  INPUT_ITERATOR     last,
+                                  const COMPARATOR&  comparator,
+                                  bslma::Allocator  *basicAllocator)
+: d_keys(basicAllocator)
+, d_comparator(comparator)
+{
+    insertRange(first, last, false);
+}
+
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(SortedUniqueTag   ,
+                                  INPUT_ITERATOR    first,
+                                  INPUT_ITERATOR    last,
+                                  bslma::Allocator *basicAllocator)
+: d_keys(basicAllocator)
+, d_comparator()
+{
+    insertRange(first, last, true);
+}
+
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(SortedUniqueTag    ,
+                                  INPUT_ITERATOR     first,
+                                  INPUT_ITERATOR     last,
+                                  const COMPARATOR&  comparator,
+                                  bslma::Allocator  *basicAllocator)
+: d_keys(basicAllocator)
+, d_comparator(comparator)
+{
+    insertRange(first, last, true);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(
+                            bsl::initializer_list<value_type>  values,
+                            bslma::Allocator                  *basicAllocator)
+: d_keys(basicAllocator)
+, d_comparator()
+{
+    insertRange(values.begin(), values.end(), false);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(
+                            bsl::initializer_list<value_type>  values,
+                            const COMPARATOR&                  comparator,
+                            bslma::Allocator                  *basicAllocator)
+: d_keys(basicAllocator)
+, d_comparator(comparator)
+{
+    insertRange(values.begin(), values.end(), false);
+}
+#endif
+
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(const FlatSet&    original,
+                                  bslma::Allocator *basicAllocator)
+: d_keys(original.d_keys, basicAllocator)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(bslmf::MovableRef<FlatSet> original)
+: d_keys(MoveUtil::move(MoveUtil::access(original).d_keys))
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(bslmf::MovableRef<FlatSet>  original,
+                                  bslma::Allocator           *basicAllocator)
+: d_keys(MoveUtil::move(MoveUtil::access(original).d_keys), basicAllocator)
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>&
+FlatSet<KEY, COMPARATOR>::operator=(const FlatSet& rhs)
+{
+    if (this != &rhs) {
+        FlatSet tmp(rhs, allocator());
+
+        this->swap(tmp);
+    }
+    return *this;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>&
+FlatSet<KEY, COMPARATOR>::operator=(bslmf::MovableRef<FlatSet> rhs)
+{
+    FlatSet& lvalue = rhs;
+
+    if (this != &lvalue) {
+        FlatSet tmp(MoveUtil::move(lvalue), allocator());
+
+        this->swap(tmp);
+    }
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>&
+FlatSet<KEY, COMPARATOR>::operator=(bsl::initializer_list<value_type> values)
+{
+    FlatSet tmp(values.begin(), values.end(), d_comparator, allocator());
+
+    this->swap(tmp);
+
+    return *this;
+}
+#endif
+
+template <class KEY, class COMPARATOR>
+inline
+void FlatSet<KEY, COMPARATOR>::clear()
+{
+    d_keys.clear();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::pair<typename FlatSet<KEY, COMPARATOR>::iterator,
+          typename FlatSet<KEY, COMPARATOR>::iterator>
+FlatSet<KEY, COMPARATOR>::equal_range(const KEY& key)
+{
+    const FlatSet& constThis = *this;
+
+    return constThis.equal_range(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t FlatSet<KEY, COMPARATOR>::erase(const KEY& key)
+{
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    if (index < d_keys.size() && !d_comparator(key, d_keys[index])) {
+        d_keys.erase(d_keys.begin() + index);
+        return 1;                                                     // RETURN
+    }
+    return 0;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::iterator
+FlatSet<KEY, COMPARATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_keys.erase(position);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::iterator
+FlatSet<KEY, COMPARATOR>::erase(const_iterator first, const_iterator last)
+{
+    BSLS_ASSERT_SAFE(first <= last);
+
+    return d_keys.erase(first, last);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::iterator
+FlatSet<KEY, COMPARATOR>::find(const KEY& key)
+{
+    const FlatSet& constThis = *this;
+
+    return constThis.find(key);
+}
+
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+void FlatSet<KEY, COMPARATOR>::insert(INPUT_ITERATOR first,
+                                      INPUT_ITERATOR last)
+{
+    insertRange(first, last, false);
+}
+
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+void FlatSet<KEY, COMPARATOR>::insert(SortedUniqueTag ,
+                                      INPUT_ITERATOR  first,
+                                      INPUT_ITERATOR  last)
+{
+    insertRange(first, last, true);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR>
+inline
+void FlatSet<KEY, COMPARATOR>::insert(
+                                     bsl::initializer_list<value_type> values)
+{
+    insertRange(values.begin(), values.end(), false);
+}
+#endif
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class KEY, class COMPARATOR>
+template <class... ARGS>
+inline
+bsl::pair<typename FlatSet<KEY, COMPARATOR>::iterator, bool>
+FlatSet<KEY, COMPARATOR>::emplace(ARGS&&... args)
+{
+    bsls::ObjectBuffer<KEY> buffer;
+
+    bslma::ConstructionUtil::construct(
+                                    buffer.address(),
+                                    allocator(),
+                                    BSLS_COMPILERFEATURES_FORWARD(ARGS,
+                                                                  args)...);
+
+    bslma::DestructorGuard<KEY> guard(buffer.address());
+
+    return insert(MoveUtil::move(buffer.object()));
+}
+#endif
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::iterator
+FlatSet<KEY, COMPARATOR>::lower_bound(const KEY& key)
+{
+    return d_keys.cbegin() + lowerBoundIndex(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+void FlatSet<KEY, COMPARATOR>::reserve(bsl::size_t numElements)
+{
+    d_keys.reserve(numElements);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::iterator
+FlatSet<KEY, COMPARATOR>::upper_bound(const KEY& key)
+{
+    return d_keys.cbegin() + upperBoundIndex(key);
+}
+
+                          // Iterators
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::iterator FlatSet<KEY, COMPARATOR>::begin()
+{
+    return d_keys.cbegin();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::iterator FlatSet<KEY, COMPARATOR>::end()
+{
+    return d_keys.cend();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::reverse_iterator
+FlatSet<KEY, COMPARATOR>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::reverse_iterator
+FlatSet<KEY, COMPARATOR>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+                             // Aspects
+
+template <class KEY, class COMPARATOR>
+inline
+void FlatSet<KEY, COMPARATOR>::swap(FlatSet& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    d_keys.swap(other.d_keys);
+    bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t FlatSet<KEY, COMPARATOR>::capacity() const
+{
+    return d_keys.capacity();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool FlatSet<KEY, COMPARATOR>::contains(const KEY& key) const
+{
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    return index < d_keys.size() && !d_comparator(key, d_keys[index]);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t FlatSet<KEY, COMPARATOR>::count(const KEY& key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool FlatSet<KEY, COMPARATOR>::empty() const
+{
+    return d_keys.empty();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::pair<typename FlatSet<KEY, COMPARATOR>::const_iterator,
+          typename FlatSet<KEY, COMPARATOR>::const_iterator>
+FlatSet<KEY, COMPARATOR>::equal_range(const KEY& key) const
+{
+    const bsl::size_t index = lowerBoundIndex(key);
+    const_iterator    first = d_keys.cbegin() + index;
+
+    if (index < d_keys.size() && !d_comparator(key, d_keys[index])) {
+        return bsl::pair<const_iterator, const_iterator>(first,
+                                                         first + 1);
+                                                                      // RETURN
+    }
+
+    return bsl::pair<const_iterator, const_iterator>(first, first);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::find(const KEY& key) const
+{
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    if (index < d_keys.size() && !d_comparator(key, d_keys[index])) {
+        return d_keys.cbegin() + index;                               // RETURN
+    }
+    return d_keys.cend();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+COMPARATOR FlatSet<KEY, COMPARATOR>::key_comp() const
+{
+    return d_comparator;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+const bsl::vector<KEY>& FlatSet<KEY, COMPARATOR>::keys() const
+{
+    return d_keys;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::lower_bound(const KEY& key) const
+{
+    return d_keys.cbegin() + lowerBoundIndex(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t FlatSet<KEY, COMPARATOR>::size() const
+{
+    return d_keys.size();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::upper_bound(const KEY& key) const
+{
+    return d_keys.cbegin() + upperBoundIndex(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+COMPARATOR FlatSet<KEY, COMPARATOR>::value_comp() const
+{
+    return d_comparator;
+}
+
+                          // Iterators
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::begin() const
+{
+    return d_keys.cbegin();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::cbegin() const
+{
+    return d_keys.cbegin();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::end() const
+{
+    return d_keys.cend();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::cend() const
+{
+    return d_keys.cend();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_reverse_iterator
+FlatSet<KEY, COMPARATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_reverse_iterator
+FlatSet<KEY, COMPARATOR>::crbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_reverse_iterator
+FlatSet<KEY, COMPARATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_reverse_iterator
+FlatSet<KEY, COMPARATOR>::crend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+                             // Aspects
+
+template <class KEY, class COMPARATOR>
+inline
+bslma::Allocator *FlatSet<KEY, COMPARATOR>::allocator() const
+{
+    return d_keys.get_allocator().mechanism();
+}
+
+template <class KEY, class COMPARATOR>
+bsl::ostream& FlatSet<KEY, COMPARATOR>::print(
+                                            bsl::ostream& stream,
+                                            int           level,
+                                            int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;                                                // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+
+    printer.start();
+
+    for (bsl::size_t i = 0; i < d_keys.size(); ++i) {
+        printer.printValue(d_keys[i]);
+    }
+
+    printer.end();
+
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR>
+inline
+bool bdlc::operator==(const FlatSet<KEY, COMPARATOR>& lhs,
+                      const FlatSet<KEY, COMPARATOR>& rhs)
+{
+    return lhs.d_keys == rhs.d_keys;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool bdlc::operator!=(const FlatSet<KEY, COMPARATOR>& lhs,
+                      const FlatSet<KEY, COMPARATOR>& rhs)
+{
+    return lhs.d_keys != rhs.d_keys;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool bdlc::operator<(const FlatSet<KEY, COMPARATOR>& lhs,
+                     const FlatSet<KEY, COMPARATOR>& rhs)
+{
+    return lhs.d_keys < rhs.d_keys;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::ostream& bdlc::operator<<(bsl::ostream&                   stream,
+                               const FlatSet<KEY, COMPARATOR>& set)
+{
+    return set.print(stream, 0, -1);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR>
+inline
+void bdlc::swap(FlatSet<KEY, COMPARATOR>& a, FlatSet<KEY, COMPARATOR>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    typedef FlatSet<KEY, COMPARATOR> Set;
+
+    Set futureA(b, a.allocator());
+    Set futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslalg {
+
+template <class KEY, class COMPARATOR>
+struct HasStlIterators<bdlc::FlatSet<KEY, COMPARATOR> > : bsl::true_type {
+};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class COMPARATOR>
+struct UsesBslmaAllocator<bdlc::FlatSet<KEY, COMPARATOR> > : bsl::true_type {
+};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
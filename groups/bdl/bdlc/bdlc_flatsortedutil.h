@@ -0,0 +1,367 @@
+// bdlc_flatsortedutil.h                                              -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATSORTEDUTIL
+#define INCLUDED_BDLC_FLATSORTEDUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide binary search of sorted sequences for flat containers.
+//
+//@CLASSES:
+//   bdlc::FlatSortedUtil: branchless binary search over contiguous sequences
+//   bdlc::SortedUniqueTag: tag for a sorted input range having unique keys
+//   bdlc::SortedEquivalentTag: tag for a sorted input range
+//
+//@SEE_ALSO: bdlc_flatmap, bdlc_flatmultimap, bdlc_flatset
+//
+//@DESCRIPTION: This component provides a utility 'struct',
+// 'bdlc::FlatSortedUtil', containing the binary search functions used by the
+// sorted-vector ("flat") containers of this package, and two empty tag types,
+// 'bdlc::SortedUniqueTag' and 'bdlc::SortedEquivalentTag', with which a client
+// of those containers asserts that a range of input values is already sorted.
+//
+// The search functions operate on contiguous sequences (i.e., pointer ranges)
+// and are written so that the loop body contains no data-dependent branch:
+// each iteration halves the length of the range under consideration and
+// selects the lower or upper half with a conditional move.  For a sequence of
+// 'N' elements the search therefore always executes 'floor(log2(N)) + 1'
+// comparisons, but avoids the branch mispredictions that dominate the cost of
+// a conventional binary search (such as 'bsl::lower_bound') on a randomly
+// distributed set of keys.  The cost of the search is further reduced by the
+// elements being contiguous, which allows the hardware to prefetch
+// effectively.
+//
+// The functions take a 'COMPARATOR' functor that must define a strict weak
+// ordering, and may be heterogeneous: 'lowerBound' invokes
+// 'comparator(element, key)' and 'upperBound' invokes
+// 'comparator(key, element)'.
+//
+// In addition, 'sortPermutation' computes the order of a stable sort of an
+// array without moving its elements, which allows the flat map containers to
+// merge an unsorted range of keys and mapped values held in parallel arrays.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Searching a Sorted Array
+/// - - - - - - - - - - - - - - - - -
+// Suppose we have a sorted array of holidays, expressed as serial day
+// numbers, and must determine whether a day is a holiday, and how many
+// holidays precede it.
+//
+// First, we define the array:
+//..
+//  const int HOLIDAYS[]   = { 3, 17, 45, 46, 100, 151, 185, 250, 329, 359 };
+//  const int NUM_HOLIDAYS = sizeof HOLIDAYS / sizeof *HOLIDAYS;
+//
+//  const int *begin = HOLIDAYS;
+//  const int *end   = HOLIDAYS + NUM_HOLIDAYS;
+//..
+// Then, we search for the first holiday that is not before day 100:
+//..
+//  const int *it = bdlc::FlatSortedUtil::lowerBound(begin,
+//                                                   end,
+//                                                   100,
+//                                                   bsl::less<int>());
+//  assert(it != end && 100 == *it);
+//  assert(4 == it - begin);
+//..
+// Next, we search for the first holiday after day 300:
+//..
+//  it = bdlc::FlatSortedUtil::upperBound(begin, end, 300, bsl::less<int>());
+//  assert(329 == *it);
+//..
+// Finally, we verify that the array satisfies the precondition of the
+// 'SortedUniqueTag' insertion methods of the flat containers:
+//..
+//  assert(true == bdlc::FlatSortedUtil::isSortedUnique(begin,
+//                                                      end,
+//                                                      bsl::less<int>()));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                          // ======================
+                          // struct SortedUniqueTag
+                          // ======================
+
+struct SortedUniqueTag {
+    // This empty 'struct' is used to select the overloads of the methods of
+    // the flat containers that take a range of values that is sorted with
+    // respect to the comparator of the container and contains no two values
+    // having equivalent keys.
+};
+
+                        // ==========================
+                        // struct SortedEquivalentTag
+                        // ==========================
+
+struct SortedEquivalentTag {
+    // This empty 'struct' is used to select the overloads of the methods of
+    // the flat containers that take a range of values that is sorted with
+    // respect to the comparator of the container, but that may contain values
+    // having equivalent keys.
+};
+
+                           // =====================
+                           // struct FlatSortedUtil
+                           // =====================
+
+struct FlatSortedUtil {
+    // This 'struct' provides a namespace for utility functions that search
+    // and inspect sorted contiguous sequences.
+
+    // CLASS METHODS
+    template <class FORWARD_ITERATOR, class COMPARATOR>
+    static bool isSorted(FORWARD_ITERATOR  first,
+                         FORWARD_ITERATOR  last,
+                         const COMPARATOR& comparator);
+        // Return 'true' if the range specified by 'first' and 'last' is sorted
+        // with respect to the specified 'comparator', and 'false' otherwise.
+
+    template <class FORWARD_ITERATOR, class COMPARATOR>
+    static bool isSortedUnique(FORWARD_ITERATOR  first,
+                               FORWARD_ITERATOR  last,
+                               const COMPARATOR& comparator);
+        // Return 'true' if each element in the range specified by 'first' and
+        // 'last' is ordered before its successor by the specified
+        // 'comparator', and 'false' otherwise.
+
+    template <class TYPE, class KEY, class COMPARATOR>
+    static const TYPE *lowerBound(const TYPE        *first,
+                                  const TYPE        *last,
+                                  const KEY&         key,
+                                  const COMPARATOR&  comparator);
+        // Return the address of the first element in the contiguous range
+        // specified by 'first' and 'last' for which
+        // 'comparator(element, key)' is 'false', or 'last' if there is no
+        // such element.  The behavior is undefined unless the range is
+        // partitioned with respect to 'comparator(element, key)'.
+
+    template <class TYPE, class COMPARATOR>
+    static void sortPermutation(bsl::size_t       *permutation,
+                                const TYPE        *elements,
+                                bsl::size_t        numElements,
+                                const COMPARATOR&  comparator);
+        // Load into the array at the specified 'permutation' the indices
+        // '[0 .. numElements - 1]' of the elements of the array at the
+        // specified 'elements' having the specified 'numElements' length, in
+        // the order of a stable sort of those elements with respect to the
+        // specified 'comparator'.  The behavior is undefined unless
+        // 'permutation' refers to an array of at least 'numElements' indices.
+        // Note that this function allows parallel arrays (such as the keys
+        // and the mapped values of a flat map) to be merged in sorted order
+        // without moving either array.
+
+    template <class TYPE, class KEY, class COMPARATOR>
+    static const TYPE *upperBound(const TYPE        *first,
+                                  const TYPE        *last,
+                                  const KEY&         key,
+                                  const COMPARATOR&  comparator);
+        // Return the address of the first element in the contiguous range
+        // specified by 'first' and 'last' for which
+        // 'comparator(key, element)' is 'true', or 'last' if there is no such
+        // element.  The behavior is undefined unless the range is partitioned
+        // with respect to 'comparator(key, element)'.
+};
+
+                   // ====================================
+                   // class FlatSortedUtil_IndexComparator
+                   // ====================================
+
+template <class TYPE, class COMPARATOR>
+class FlatSortedUtil_IndexComparator {
+    // This component-private class implements a functor that orders indices
+    // into an array by the order of the elements of the array.
+
+    // DATA
+    const TYPE        *d_elements_p;    // indexed array (held, not owned)
+    const COMPARATOR  *d_comparator_p;  // element order (held, not owned)
+
+  public:
+    // CREATORS
+    FlatSortedUtil_IndexComparator(const TYPE        *elements,
+                                   const COMPARATOR&  comparator);
+        // Create a functor ordering indices into the array at the specified
+        // 'elements' by the order of the indexed elements with respect to the
+        // specified 'comparator'.
+
+    // ACCESSORS
+    bool operator()(bsl::size_t lhs, bsl::size_t rhs) const;
+        // Return 'true' if the element at the specified 'lhs' index is
+        // ordered before the element at the specified 'rhs' index, and
+        // 'false' otherwise.
+};
+
+// ============================================================================
+//                TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // struct FlatSortedUtil
+                           // ---------------------
+
+// CLASS METHODS
+template <class FORWARD_ITERATOR, class COMPARATOR>
+bool FlatSortedUtil::isSorted(FORWARD_ITERATOR  first,
+                              FORWARD_ITERATOR  last,
+                              const COMPARATOR& comparator)
+{
+    if (first == last) {
+        return true;                                                  // RETURN
+    }
+
+    FORWARD_ITERATOR next = first;
+    for (++next; next != last; ++first, ++next) {
+        if (comparator(*next, *first)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class FORWARD_ITERATOR, class COMPARATOR>
+bool FlatSortedUtil::isSortedUnique(FORWARD_ITERATOR  first,
+                                    FORWARD_ITERATOR  last,
+                                    const COMPARATOR& comparator)
+{
+    if (first == last) {
+        return true;                                                  // RETURN
+    }
+
+    FORWARD_ITERATOR next = first;
+    for (++next; next != last; ++first, ++next) {
+        if (!comparator(*first, *next)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class TYPE, class KEY, class COMPARATOR>
+inline
+const TYPE *FlatSortedUtil::lowerBound(const TYPE        *first,
+                                       const TYPE        *last,
+                                       const KEY&         key,
+                                       const COMPARATOR&  comparator)
+{
+    BSLS_ASSERT_SAFE(first <= last);
+
+    bsl::size_t length = last - first;
+
+    if (0 == length) {
+        return first;                                                 // RETURN
+    }
+
+    // Invariant: the result is in '[first, first + length]'.
+
+    while (1 < length) {
+        const bsl::size_t half = length / 2;
+
+        first   = comparator(first[half], key) ? first + half : first;
+        length -= half;
+    }
+
+    return first + (comparator(*first, key) ? 1 : 0);
+}
+
+template <class TYPE, class COMPARATOR>
+void FlatSortedUtil::sortPermutation(bsl::size_t       *permutation,
+                                     const TYPE        *elements,
+                                     bsl::size_t        numElements,
+                                     const COMPARATOR&  comparator)
+{
+    BSLS_ASSERT(permutation || 0 == numElements);
+
+    for (bsl::size_t i = 0; i < numElements; ++i) {
+        permutation[i] = i;
+    }
+
+    bsl::stable_sort(permutation,
+                     permutation + numElements,
+                     FlatSortedUtil_IndexComparator<TYPE, COMPARATOR>(
+                                                                 elements,
+                                                                 comparator));
+}
+
+template <class TYPE, class KEY, class COMPARATOR>
+inline
+const TYPE *FlatSortedUtil::upperBound(const TYPE        *first,
+                                       const TYPE        *last,
+                                       const KEY&         key,
+                                       const COMPARATOR&  comparator)
+{
+    BSLS_ASSERT_SAFE(first <= last);
+
+    bsl::size_t length = last - first;
+
+    if (0 == length) {
+        return first;                                                 // RETURN
+    }
+
+    // Invariant: the result is in '[first, first + length]'.
+
+    while (1 < length) {
+        const bsl::size_t half = length / 2;
+
+        first   = comparator(key, first[half]) ? first : first + half;
+        length -= half;
+    }
+
+    return first + (comparator(key, *first) ? 0 : 1);
+}
+
+                   // ------------------------------------
+                   // class FlatSortedUtil_IndexComparator
+                   // ------------------------------------
+
+// CREATORS
+template <class TYPE, class COMPARATOR>
+inline
+FlatSortedUtil_IndexComparator<TYPE, COMPARATOR>::
+                  FlatSortedUtil_IndexComparator(const TYPE        *elements,
+                                                 const COMPARATOR&  comparator)
+: d_elements_p(elements)
+, d_comparator_p(&comparator)
+{
+}
+
+// ACCESSORS
+template <class TYPE, class COMPARATOR>
+inline
+bool FlatSortedUtil_IndexComparator<TYPE, COMPARATOR>::operator()(
+                                                        bsl::size_t lhs,
+                                                        bsl::size_t rhs) const
+{
+    return (*d_comparator_p)(d_elements_p[lhs], d_elements_p[rhs]);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
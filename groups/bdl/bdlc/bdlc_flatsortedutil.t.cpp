@@ -0,0 +1,609 @@
+// bdlc_flatsortedutil.t.cpp                                          -*-C++-*-
+
+#include <bdlc_flatsortedutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a utility 'struct' of pure functions, and
+// two empty tag types.  The search functions are tested against the standard
+// algorithms 'bsl::lower_bound' and 'bsl::upper_bound' for every position in
+// every sequence (with and without equivalent elements) up to a moderate
+// length, and 'sortPermutation' is tested against 'bsl::stable_sort'.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] bool isSorted(FWD_ITER, FWD_ITER, const COMP&);
+// [ 2] bool isSortedUnique(FWD_ITER, FWD_ITER, const COMP&);
+// [ 3] const T *lowerBound(const T *, const T *, const KEY&, const C&);
+// [ 4] void sortPermutation(size_t *, const T *, size_t, const C&);
+// [ 3] const T *upperBound(const T *, const T *, const KEY&, const C&);
+// ----------------------------------------------------------------------------
+// [ 5] USAGE EXAMPLE
+// [ 1] BREATHING TEST
+// [-1] PERFORMANCE TEST
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT  BSLIM_TESTUTIL_ASSERT
+#define ASSERTV BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q  BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P  BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_ BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_ BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_ BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool verbose;
+bool veryVerbose;
+bool veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static unsigned int s_antiOptimization = 0;
+
+struct ByFirst {
+    // This 'struct' provides a comparator that orders pairs of 'int' by their
+    // 'first' member only, so that pairs having equal 'first' members are
+    // equivalent.
+
+    bool operator()(const bsl::pair<int, int>& lhs,
+                    const bsl::pair<int, int>& rhs) const
+        // Return 'true' if the 'first' member of the specified 'lhs' is less
+        // than that of the specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.first < rhs.first;
+    }
+};
+
+struct StringLess {
+    // This 'struct' provides a comparator that orders a 'bsl::string' and a
+    // null-terminated string, in either order, without creating a temporary.
+
+    bool operator()(const bsl::string& lhs, const char *rhs) const
+        // Return 'true' if the specified 'lhs' is ordered before the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs.compare(rhs) < 0;
+    }
+
+    bool operator()(const char *lhs, const bsl::string& rhs) const
+        // Return 'true' if the specified 'lhs' is ordered before the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return rhs.compare(lhs) > 0;
+    }
+};
+
+template <class SEARCH>
+bsls::TimeInterval performanceSearch(const bsl::vector<int>& array,
+                                     const bsl::vector<int>& keys,
+                                     SEARCH                  search)
+    // Search the specified sorted 'array' for each of the specified 'keys'
+    // using the specified 'search' function several times, and return the
+    // median duration of a pass over 'keys'.
+{
+    const int NUM_TRIAL = 11;
+
+    const int *begin = array.data();
+    const int *end   = begin + array.size();
+
+    bsl::vector<bsls::TimeInterval> results;
+    for (int trial = 0; trial < NUM_TRIAL; ++trial) {
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+        for (bsl::size_t i = 0; i < keys.size(); ++i) {
+            s_antiOptimization += static_cast<unsigned int>(
+                                               search(begin, end, keys[i]) -
+                                               begin);
+        }
+
+        results.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+    }
+
+    bsl::sort(results.begin(), results.end());
+
+    return results[NUM_TRIAL / 2];
+}
+
+const int *branchlessLowerBound(const int *first, const int *last, int key)
+    // Return 'bdlc::FlatSortedUtil::lowerBound(first, last, key, less)'.
+{
+    return bdlc::FlatSortedUtil::lowerBound(first,
+                                            last,
+                                            key,
+                                            bsl::less<int>());
+}
+
+const int *standardLowerBound(const int *first, const int *last, int key)
+    // Return 'bsl::lower_bound(first, last, key)'.
+{
+    return bsl::lower_bound(first, last, key);
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Searching a Sorted Array
+/// - - - - - - - - - - - - - - - - -
+// Suppose we have a sorted array of holidays, expressed as serial day
+// numbers, and must determine whether a day is a holiday, and how many
+// holidays precede it.
+//
+// First, we define the array:
+//..
+    const int HOLIDAYS[]   = { 3, 17, 45, 46, 100, 151, 185, 250, 329, 359 };
+    const int NUM_HOLIDAYS = sizeof HOLIDAYS / sizeof *HOLIDAYS;
+
+    const int *begin = HOLIDAYS;
+    const int *end   = HOLIDAYS + NUM_HOLIDAYS;
+//..
+// Then, we search for the first holiday that is not before day 100:
+//..
+    const int *it = bdlc::FlatSortedUtil::lowerBound(begin,
+                                                     end,
+                                                     100,
+                                                     bsl::less<int>());
+    ASSERT(it != end && 100 == *it);
+    ASSERT(4 == it - begin);
+//..
+// Next, we search for the first holiday after day 300:
+//..
+    it = bdlc::FlatSortedUtil::upperBound(begin, end, 300, bsl::less<int>());
+    ASSERT(329 == *it);
+//..
+// Finally, we verify that the array satisfies the precondition of the
+// 'SortedUniqueTag' insertion methods of the flat containers:
+//..
+    ASSERT(true == bdlc::FlatSortedUtil::isSortedUnique(begin,
+                                                        end,
+                                                        bsl::less<int>()));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'sortPermutation'
+        //
+        // Concerns:
+        //: 1 The permutation orders the elements as would 'bsl::stable_sort',
+        //:   including the relative order of equivalent elements.
+        //:
+        //: 2 The elements are not modified.
+        //:
+        //: 3 An empty array is supported.
+        //
+        // Plan:
+        //: 1 For arrays of random pairs, compared by their 'first' members
+        //:   only, compare the elements in the order of the permutation with
+        //:   the result of 'bsl::stable_sort'.  (C-1..3)
+        //
+        // Testing:
+        //   void sortPermutation(size_t *, const T *, size_t, const C&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'sortPermutation'" << endl
+                          << "=================" << endl;
+
+        typedef bsl::pair<int, int> Element;
+
+        bsl::srand(4);
+        for (int length = 0; length < 300; length += 1 + length / 4) {
+            bsl::vector<Element> elements;
+            for (int i = 0; i < length; ++i) {
+                elements.push_back(Element(bsl::rand() % (length / 2 + 1),
+                                           i));
+            }
+
+            const bsl::vector<Element> ORIGINAL(elements);
+
+            bsl::vector<bsl::size_t> permutation(length + 1, 99999);
+
+            bdlc::FlatSortedUtil::sortPermutation(permutation.data(),
+                                                  elements.data(),
+                                                  elements.size(),
+                                                  ByFirst());
+            ASSERTV(length, ORIGINAL == elements);
+            ASSERTV(length, 99999 == permutation[length]);
+
+            bsl::vector<Element> expected(ORIGINAL);
+            bsl::stable_sort(expected.begin(), expected.end(), ByFirst());
+
+            for (int i = 0; i < length; ++i) {
+                ASSERTV(length, i, expected[i] == elements[permutation[i]]);
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'lowerBound' AND 'upperBound'
+        //
+        // Concerns:
+        //: 1 'lowerBound' and 'upperBound' return the same positions as
+        //:   'bsl::lower_bound' and 'bsl::upper_bound', for keys before,
+        //:   within, between, and after the elements of the range.
+        //:
+        //: 2 Runs of equivalent elements are handled correctly.
+        //:
+        //: 3 Empty ranges and ranges of one element are handled correctly.
+        //:
+        //: 4 The comparator is used, and may compare a key of a different type
+        //:   than the elements.
+        //
+        // Plan:
+        //: 1 For each length up to 70, create sorted arrays having distinct
+        //:   and repeated elements, search for every key in a range spanning
+        //:   the elements, and compare with the standard algorithms.  (C-1..3)
+        //:
+        //: 2 Repeat P-1 on reverse-sorted arrays using 'bsl::greater'.  (C-4)
+        //:
+        //: 3 Search an array of strings with a 'const char *' key.  (C-4)
+        //
+        // Testing:
+        //   const T *lowerBound(const T *, const T *, const KEY&, const C&);
+        //   const T *upperBound(const T *, const T *, const KEY&, const C&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'lowerBound' AND 'upperBound'" << endl
+                          << "=============================" << endl;
+
+        for (int length = 0; length < 70; ++length) {
+            for (int repeat = 1; repeat <= 3; ++repeat) {
+                bsl::vector<int> array;
+                for (int i = 0; i < length; ++i) {
+                    array.push_back(2 * (i / repeat));
+                }
+                const int *begin = array.data();
+                const int *end   = begin + array.size();
+
+                for (int key = -2; key <= 2 * length + 1; ++key) {
+                    ASSERTV(length, repeat, key,
+                            bsl::lower_bound(begin, end, key) ==
+                            bdlc::FlatSortedUtil::lowerBound(
+                                                           begin,
+                                                           end,
+                                                           key,
+                                                           bsl::less<int>()));
+                    ASSERTV(length, repeat, key,
+                            bsl::upper_bound(begin, end, key) ==
+                            bdlc::FlatSortedUtil::upperBound(
+                                                           begin,
+                                                           end,
+                                                           key,
+                                                           bsl::less<int>()));
+                }
+
+                bsl::reverse(array.begin(), array.end());
+
+                const bsl::greater<int> greater;
+
+                for (int key = -2; key <= 2 * length + 1; ++key) {
+                    ASSERTV(length, repeat, key,
+                            bsl::lower_bound(begin, end, key, greater) ==
+                            bdlc::FlatSortedUtil::lowerBound(begin,
+                                                             end,
+                                                             key,
+                                                             greater));
+                    ASSERTV(length, repeat, key,
+                            bsl::upper_bound(begin, end, key, greater) ==
+                            bdlc::FlatSortedUtil::upperBound(begin,
+                                                             end,
+                                                             key,
+                                                             greater));
+                }
+            }
+        }
+
+        {
+            const bsl::string NAMES[] = { "ant", "bee", "cat", "dog" };
+            const int         NUM_NAMES = sizeof NAMES / sizeof *NAMES;
+
+            const StringLess comparator = StringLess();
+
+            ASSERT(NAMES + 2 == bdlc::FlatSortedUtil::lowerBound(
+                                                            NAMES,
+                                                            NAMES + NUM_NAMES,
+                                                            "cat",
+                                                            comparator));
+            ASSERT(NAMES + 3 == bdlc::FlatSortedUtil::upperBound(
+                                                            NAMES,
+                                                            NAMES + NUM_NAMES,
+                                                            "cat",
+                                                            comparator));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'isSorted' AND 'isSortedUnique'
+        //
+        // Concerns:
+        //: 1 'isSorted' returns 'true' if and only if no element is ordered
+        //:   before its predecessor.
+        //:
+        //: 2 'isSortedUnique' returns 'true' if and only if every element is
+        //:   ordered before its successor.
+        //:
+        //: 3 Empty ranges and ranges of one element are sorted and unique.
+        //
+        // Plan:
+        //: 1 Using a table of sequences, verify the results of both functions.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   bool isSorted(FWD_ITER, FWD_ITER, const COMP&);
+        //   bool isSortedUnique(FWD_ITER, FWD_ITER, const COMP&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'isSorted' AND 'isSortedUnique'" << endl
+                          << "===============================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_spec;
+            bool        d_sorted;
+            bool        d_unique;
+        } DATA[] = {
+            //LINE  SPEC      SORTED  UNIQUE
+            //----  --------  ------  ------
+            { L_,   "",       true,   true   },
+            { L_,   "a",      true,   true   },
+            { L_,   "ab",     true,   true   },
+            { L_,   "aa",     true,   false  },
+            { L_,   "ba",     false,  false  },
+            { L_,   "abc",    true,   true   },
+            { L_,   "abb",    true,   false  },
+            { L_,   "aab",    true,   false  },
+            { L_,   "acb",    false,  false  },
+            { L_,   "bac",    false,  false  },
+            { L_,   "abcdef", true,   true   },
+            { L_,   "abcdee", true,   false  },
+            { L_,   "abcdfe", false,  false  },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE   = DATA[ti].d_line;
+            const bsl::string SPEC   = DATA[ti].d_spec;
+            const bool        SORTED = DATA[ti].d_sorted;
+            const bool        UNIQUE = DATA[ti].d_unique;
+
+            ASSERTV(LINE, SORTED == bdlc::FlatSortedUtil::isSorted(
+                                                          SPEC.begin(),
+                                                          SPEC.end(),
+                                                          bsl::less<char>()));
+            ASSERTV(LINE, UNIQUE == bdlc::FlatSortedUtil::isSortedUnique(
+                                                          SPEC.begin(),
+                                                          SPEC.end(),
+                                                          bsl::less<char>()));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Search a small array, and verify the results.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        typedef bdlc::FlatSortedUtil Util;
+
+        const int A[] = { 1, 3, 3, 5 };
+        const int N   = sizeof A / sizeof *A;
+
+        const bsl::less<int> comparator;
+
+        ASSERT(A     == Util::lowerBound(A, A + N, 0, comparator));
+        ASSERT(A + 1 == Util::lowerBound(A, A + N, 3, comparator));
+        ASSERT(A + 3 == Util::upperBound(A, A + N, 3, comparator));
+        ASSERT(A + N == Util::upperBound(A, A + N, 5, comparator));
+
+        ASSERT(true  == Util::isSorted(A, A + N, comparator));
+        ASSERT(false == Util::isSortedUnique(A, A + N, comparator));
+
+        bdlc::SortedUniqueTag     unique;
+        bdlc::SortedEquivalentTag equivalent;
+        (void)unique;
+        (void)equivalent;
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Compare the performance of 'lowerBound' with that of
+        //   'bsl::lower_bound'.
+        //
+        // Concerns:
+        //: 1 'lowerBound' is faster than 'bsl::lower_bound' for random keys.
+        //
+        // Plan:
+        //: 1 For arrays of several sizes, time the search for random keys
+        //:   using each function, and report the results.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_KEYS = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        bsl::srand(1);
+        bsl::vector<int> keys;
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            keys.push_back(bsl::rand());
+        }
+
+        for (int length = 16; length <= (1 << 24); length *= 16) {
+            bsl::vector<int> array;
+            for (int i = 0; i < length; ++i) {
+                array.push_back(bsl::rand());
+            }
+            bsl::sort(array.begin(), array.end());
+
+            const double x = static_cast<double>(
+                 performanceSearch(array, keys, &branchlessLowerBound)
+                                                          .totalNanoseconds());
+            const double y = static_cast<double>(
+                 performanceSearch(array, keys, &standardLowerBound)
+                                                          .totalNanoseconds());
+
+            cout << "length " << length << ": lowerBound "
+                 << x / NUM_KEYS << " ns/op, bsl::lower_bound "
+                 << y / NUM_KEYS << " ns/op (lowerBound is "
+                 << 100.0 * (y - x) / x << "% faster)" << endl;
+        }
+
+        if (veryVeryVeryVerbose) {
+            cout << "anti-optimization: " << s_antiOptimization << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
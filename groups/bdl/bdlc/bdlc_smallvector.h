@@ -0,0 +1,2009 @@
+// bdlc_smallvector.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_SMALLVECTOR
+#define INCLUDED_BDLC_SMALLVECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a vector holding a few elements without allocating.
+//
+//@CLASSES:
+//   bdlc::SmallVector: vector with inline storage for a few elements
+//
+//@SEE_ALSO: bsl_vector, bslalg_arrayprimitives
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::SmallVector', that implements a dynamic array of elements of the
+// (template parameter) type 'TYPE' having storage for up to (the template
+// parameter) 'INLINE_CAPACITY' elements within the object itself.  A
+// 'bdlc::SmallVector' holding no more than 'INLINE_CAPACITY' elements
+// allocates no memory; when it outgrows its inline storage, its elements are
+// moved to a block obtained from the allocator supplied at construction,
+// after which it behaves, and grows, like a 'bsl::vector'.
+//
+// An instantiation of 'bdlc::SmallVector' is an allocator-aware,
+// value-semantic type whose salient attributes are its size (number of
+// elements) and the sequence of its elements.  The interface follows that of
+// 'bsl::vector', except that 'bdlc::SmallVector' reports its allocator as a
+// 'bslma::Allocator *' through the 'allocator' method, and has the additional
+// accessor 'isInline'.  The allocator supplied at construction is passed to
+// each element of a type that uses a 'bslma' allocator, regardless of
+// whether the element is held inline.
+//
+// The elements are created, moved, and destroyed using the functions of
+// 'bslalg::ArrayPrimitives', so that elements of a bitwise-movable type are
+// relocated (when the vector grows, or shifts elements to insert or erase)
+// by copying their bytes, and elements of a trivially-copyable type are
+// copied in bulk.
+//
+///Choosing 'INLINE_CAPACITY'
+///--------------------------
+// The footprint of a 'bdlc::SmallVector' is 'INLINE_CAPACITY * sizeof(TYPE)'
+// plus four words, whether or not the inline storage is used.  The
+// (template parameter) 'INLINE_CAPACITY' should be chosen to hold the
+// typical number of elements, and is best kept small: an element beyond
+// 'INLINE_CAPACITY' costs an allocation much as it would in a 'bsl::vector',
+// and moving (or swapping) a 'bdlc::SmallVector' whose elements are held
+// inline moves each element, rather than transferring a pointer.
+//
+///Iterator Invalidation
+///---------------------
+// Iterators, pointers, and references to the elements of a
+// 'bdlc::SmallVector' are invalidated by the same operations that invalidate
+// those of a 'bsl::vector'.  In addition, since the inline storage is part of
+// the object, a move of a 'bdlc::SmallVector' whose elements are held inline
+// (and a 'swap' involving such an object) invalidates all of its iterators,
+// pointers, and references.
+//
+///Exception Safety
+///----------------
+// A 'bdlc::SmallVector' is exception neutral, and provides the same
+// exception-safety guarantees as 'bsl::vector', except that 'swap' provides
+// the no-throw guarantee only if neither object holds its elements inline, or
+// if the move constructor of 'TYPE' does not throw.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Collecting the Fills of an Order
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose an order-matching engine records the quantities with which each
+// incoming order is filled.  Almost every order is filled in at most a few
+// executions, so we hold the fills in a 'bdlc::SmallVector' having inline
+// storage for four of them.
+//
+// First, we define a function that matches an order for the specified
+// 'quantity' against resting orders of the specified 'restingQuantities',
+// recording each fill in the specified 'fills':
+//..
+//  void matchOrder(bdlc::SmallVector<int, 4> *fills,
+//                  int                        quantity,
+//                  const int                 *restingQuantities,
+//                  int                        numResting)
+//      // Fill the specified 'quantity' against the specified 'numResting'
+//      // resting orders of the specified 'restingQuantities', in order, and
+//      // append the quantity of each fill to the specified 'fills'.
+//  {
+//      for (int i = 0; 0 < quantity && i < numResting; ++i) {
+//          const int fill = bsl::min(quantity, restingQuantities[i]);
+//
+//          fills->push_back(fill);
+//          quantity -= fill;
+//      }
+//  }
+//..
+// Then, we match an order that is filled in three executions, and observe
+// that no memory is allocated:
+//..
+//  bslma::TestAllocator      ta;
+//  bdlc::SmallVector<int, 4> fills(&ta);
+//
+//  const int RESTING[] = { 100, 200, 300, 400, 500, 600 };
+//
+//  matchOrder(&fills, 500, RESTING, 6);
+//
+//  assert(3    == fills.size());
+//  assert(200  == fills[1]);
+//  assert(true == fills.isInline());
+//  assert(0    == ta.numAllocations());
+//..
+// Finally, we match a large order that sweeps the book, and observe that the
+// fills have moved to memory supplied by the allocator:
+//..
+//  fills.clear();
+//  matchOrder(&fills, 2000, RESTING, 6);
+//
+//  assert(6     == fills.size());
+//  assert(false == fills.isInline());
+//  assert(1     == ta.numBlocksInUse());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslalg_arraydestructionprimitives.h>
+#include <bslalg_arrayprimitives.h>
+#include <bslalg_hasstliterators.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_stdallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_integralconstant.h>
+#include <bslmf_isintegral.h>
+#include <bslmf_movableref.h>
+#include <bslmf_util.h>    // 'forward(V)'
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentfromtype.h>
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_performancehint.h>
+#include <bsls_util.h>     // 'forward<T>(V)'
+
+#include <bslstl_stdexceptutil.h>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <bsl_initializer_list.h>
+#endif
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_iterator.h>
+#include <bsl_limits.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+// FORWARD DECLARATIONS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+class SmallVector;
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void swap(SmallVector<TYPE, INLINE_CAPACITY>& a,
+          SmallVector<TYPE, INLINE_CAPACITY>& b);
+
+                             // =================
+                             // class SmallVector
+                             // =================
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+class SmallVector {
+    // This class template implements a value-semantic dynamic array of
+    // elements of (template parameter) type 'TYPE', holding up to (template
+    // parameter) 'INLINE_CAPACITY' elements without allocating memory.  See
+    // {Choosing 'INLINE_CAPACITY'} for more information.
+
+    BSLMF_ASSERT(0 < INLINE_CAPACITY);
+
+    // PRIVATE TYPES
+    typedef bslalg::ArrayPrimitives            ArrayPrimitives;
+    typedef bslalg::ArrayDestructionPrimitives ArrayDestructionPrimitives;
+    typedef bslmf::MovableRefUtil              MoveUtil;
+    typedef bsl::allocator<TYPE>               StdAllocator;
+
+    typedef bsls::AlignedBuffer<
+                            static_cast<int>(INLINE_CAPACITY * sizeof(TYPE)),
+                            bsls::AlignmentFromType<TYPE>::VALUE> InlineBuffer;
+
+    class Proctor;
+        // releases the elements and storage of a vector under construction
+        // on destruction unless released
+
+    // DATA
+    InlineBuffer      d_inline;       // storage for 'INLINE_CAPACITY'
+                                      // elements
+
+    TYPE             *d_begin_p;      // first element, either in 'd_inline'
+                                      // or in allocated memory
+
+    TYPE             *d_end_p;        // one past the last element
+
+    bsl::size_t       d_capacity;     // number of elements the storage at
+                                      // 'd_begin_p' can hold
+
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+  public:
+    // PUBLIC TYPES
+    typedef TYPE                                  value_type;
+    typedef TYPE&                                 reference;
+    typedef const TYPE&                           const_reference;
+    typedef TYPE                                 *pointer;
+    typedef const TYPE                           *const_pointer;
+    typedef TYPE                                 *iterator;
+    typedef const TYPE                           *const_iterator;
+    typedef bsl::reverse_iterator<iterator>       reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef bsl::size_t                           size_type;
+    typedef bsl::ptrdiff_t                        difference_type;
+
+  private:
+    // PRIVATE CLASS METHODS
+    static bsl::size_t computeNewCapacity(bsl::size_t newSize,
+                                          bsl::size_t capacity);
+        // Return the capacity to allocate for a vector of the specified
+        // 'capacity' that must grow to hold the specified 'newSize' elements.
+        // Throw 'bsl::length_error' if 'newSize > max_size()'.  The behavior
+        // is undefined unless 'capacity < newSize'.
+
+    // PRIVATE MANIPULATORS
+    TYPE *allocateBuffer(bsl::size_t capacity);
+        // Return the address of uninitialized storage, obtained from the
+        // allocator of this vector, sufficient to hold the specified
+        // 'capacity' elements.
+
+    void adoptBuffer(TYPE *buffer, bsl::size_t capacity, bsl::size_t size);
+        // Release the storage of this vector, and make the specified 'buffer',
+        // having the specified 'capacity' and holding the specified 'size'
+        // elements, the storage of this vector.  The behavior is undefined
+        // unless this vector holds no (valid) elements, and 'buffer' is
+        // either the inline storage of this vector or was obtained from
+        // 'allocateBuffer'.
+
+    TYPE *inlineBuffer();
+        // Return the address of the inline storage of this vector.
+
+    template <class INTEGRAL_TYPE>
+    void assignDispatch(INTEGRAL_TYPE   numElements,
+                        INTEGRAL_TYPE   value,
+                        bsl::true_type);
+    template <class INPUT_ITERATOR>
+    void assignDispatch(INPUT_ITERATOR  first,
+                        INPUT_ITERATOR  last,
+                        bsl::false_type);
+        // Assign to this vector either the specified 'numElements' copies of
+        // the specified 'value', or the elements of the range specified by
+        // 'first' and 'last', according to whether the template parameter of
+        // 'assign' is an integral type.
+
+    template <class INPUT_ITERATOR>
+    void assignRange(INPUT_ITERATOR first,
+                     INPUT_ITERATOR last,
+                     bsl::input_iterator_tag);
+    template <class FORWARD_ITERATOR>
+    void assignRange(FORWARD_ITERATOR first,
+                     FORWARD_ITERATOR last,
+                     bsl::forward_iterator_tag);
+        // Assign to this vector the elements of the range specified by 'first'
+        // and 'last'.
+
+    template <class INTEGRAL_TYPE>
+    iterator insertDispatch(const_iterator  position,
+                            INTEGRAL_TYPE   numElements,
+                            INTEGRAL_TYPE   value,
+                            bsl::true_type);
+    template <class INPUT_ITERATOR>
+    iterator insertDispatch(const_iterator  position,
+                            INPUT_ITERATOR  first,
+                            INPUT_ITERATOR  last,
+                            bsl::false_type);
+        // Insert at the specified 'position' either the specified
+        // 'numElements' copies of the specified 'value', or the elements of
+        // the range specified by 'first' and 'last', according to whether the
+        // template parameter of 'insert' is an integral type, and return an
+        // iterator referring to the first inserted element.
+
+    template <class INPUT_ITERATOR>
+    iterator insertRange(const_iterator          position,
+                         INPUT_ITERATOR          first,
+                         INPUT_ITERATOR          last,
+                         bsl::input_iterator_tag);
+    template <class FORWARD_ITERATOR>
+    iterator insertRange(const_iterator            position,
+                         FORWARD_ITERATOR          first,
+                         FORWARD_ITERATOR          last,
+                         bsl::forward_iterator_tag);
+        // Insert at the specified 'position' the elements of the range
+        // specified by 'first' and 'last', and return an iterator referring to
+        // the first inserted element.
+
+    // PRIVATE ACCESSORS
+    const TYPE *inlineBuffer() const;
+        // Return the address of the inline storage of this vector.
+
+  public:
+    // CREATORS
+    SmallVector();
+    explicit SmallVector(bslma::Allocator *basicAllocator);
+        // Create an empty 'SmallVector' object.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  No memory is
+        // allocated.
+
+    explicit SmallVector(bsl::size_t       numElements,
+                         bslma::Allocator *basicAllocator = 0);
+        // Create a 'SmallVector' object holding the specified 'numElements'
+        // default-constructed elements.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  Throw 'bsl::length_error' if
+        // 'numElements > max_size()'.
+
+    SmallVector(bsl::size_t       numElements,
+                const TYPE&       value,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a 'SmallVector' object holding the specified 'numElements'
+        // copies of the specified 'value'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  Throw
+        // 'bsl::length_error' if 'numElements > max_size()'.
+
+    template <class INPUT_ITERATOR>
+    SmallVector(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a 'SmallVector' object holding, in order, the elements of the
+        // input iterator range specified by 'first' through 'last' (including
+        // 'first', excluding 'last').  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values where
+        // 'first' is at a position at or before 'last'.  Note that if
+        // 'INPUT_ITERATOR' is an integral type, this constructor behaves as
+        // the constructor taking a number of elements and a value.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    SmallVector(bsl::initializer_list<TYPE>  values,
+                bslma::Allocator            *basicAllocator = 0);
+        // Create a 'SmallVector' object holding, in order, the specified
+        // 'values'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+#endif
+
+    SmallVector(const SmallVector&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a 'SmallVector' object having the same value as the specified
+        // 'original' object.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    SmallVector(bslmf::MovableRef<SmallVector> original);
+        // Create a 'SmallVector' object having the same value and allocator as
+        // the specified 'original' object.  If 'original' holds its elements
+        // in allocated memory, that memory is transferred (in constant time)
+        // to this object; otherwise, the elements of 'original' are moved to
+        // the inline storage of this object.  'original' is left empty.  No
+        // exception is thrown unless the move constructor of 'TYPE' throws.
+
+    SmallVector(bslmf::MovableRef<SmallVector>  original,
+                bslma::Allocator               *basicAllocator);
+        // Create a 'SmallVector' object having the same value as the specified
+        // 'original' object, using the specified 'basicAllocator' to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  If 'original' and the newly created object have
+        // the same allocator, this constructor behaves as the move
+        // constructor taking no allocator; otherwise, the elements of
+        // 'original' are moved, and 'original' is left in a valid but
+        // unspecified state.
+
+    ~SmallVector();
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    SmallVector& operator=(const SmallVector& rhs);
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+
+    SmallVector& operator=(bslmf::MovableRef<SmallVector> rhs);
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.  If
+        // this object and 'rhs' use the same allocator, the allocated memory
+        // (if any) of 'rhs' is transferred to this object, or else the
+        // elements of 'rhs' are moved, and 'rhs' is left empty; otherwise, the
+        // elements of 'rhs' are moved, and 'rhs' is left in a valid but
+        // unspecified state.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    SmallVector& operator=(bsl::initializer_list<TYPE> values);
+        // Assign to this object the specified 'values', in order, and return a
+        // reference providing modifiable access to this object.
+#endif
+
+    void assign(bsl::size_t numElements, const TYPE& value);
+        // Assign to this object the specified 'numElements' copies of the
+        // specified 'value'.  Throw 'bsl::length_error' if
+        // 'numElements > max_size()'.  The behavior is undefined unless
+        // 'value' is not an element of this vector.
+
+    template <class INPUT_ITERATOR>
+    void assign(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Assign to this object, in order, the elements of the input iterator
+        // range specified by 'first' through 'last' (including 'first',
+        // excluding 'last').  The behavior is undefined unless 'first' and
+        // 'last' refer to a sequence of valid values, not elements of this
+        // vector, where 'first' is at a position at or before 'last'.  Note
+        // that if 'INPUT_ITERATOR' is an integral type, this method behaves as
+        // the 'assign' overload taking a number of elements and a value.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    void assign(bsl::initializer_list<TYPE> values);
+        // Assign to this object the specified 'values', in order.
+#endif
+
+    reference operator[](bsl::size_t position);
+        // Return a reference providing modifiable access to the element at the
+        // specified 'position' in this vector.  The behavior is undefined
+        // unless 'position < size()'.
+
+    reference at(bsl::size_t position);
+        // Return a reference providing modifiable access to the element at the
+        // specified 'position' in this vector.  Throw 'bsl::out_of_range' if
+        // 'position >= size()'.
+
+    reference back();
+        // Return a reference providing modifiable access to the last element
+        // of this vector.  The behavior is undefined unless this vector is not
+        // empty.
+
+    void clear();
+        // Remove all elements from this vector.  Note that the capacity of
+        // this vector is not changed.
+
+    TYPE *data();
+        // Return the address of the first element of this vector, or of its
+        // (unused) storage if this vector is empty.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+    template <class... ARGS>
+    iterator emplace(const_iterator position, ARGS&&... args);
+        // Insert at the specified 'position' in this vector a newly created
+        // element, constructed by forwarding the allocator of this vector (if
+        // required) and the specified 'args' to the constructor of 'TYPE', and
+        // return an iterator referring to the new element.  Throw
+        // 'bsl::length_error' if 'size() == max_size()'.  The behavior is
+        // undefined unless 'position' is in the range '[ begin(), end() ]'.
+
+    template <class... ARGS>
+    reference emplace_back(ARGS&&... args);
+        // Append to this vector a newly created element, constructed by
+        // forwarding the allocator of this vector (if required) and the
+        // specified 'args' to the constructor of 'TYPE', and return a
+        // reference providing modifiable access to the new element.  Throw
+        // 'bsl::length_error' if 'size() == max_size()'.
+#endif
+
+    iterator erase(const_iterator position);
+        // Remove from this vector the element at the specified 'position', and
+        // return an iterator referring to the element following the removed
+        // element, or 'end()' if the removed element was the last.  The
+        // behavior is undefined unless 'position' is in the range
+        // '[ begin(), end() )'.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this vector the elements starting at the specified
+        // 'first' position up to, but not including, the specified 'last'
+        // position, and return an iterator referring to the element at 'last'
+        // prior to the erasure.  The behavior is undefined unless
+        // 'begin() <= first <= last <= end()'.
+
+    reference front();
+        // Return a reference providing modifiable access to the first element
+        // of this vector.  The behavior is undefined unless this vector is not
+        // empty.
+
+    iterator insert(const_iterator position, const TYPE& value);
+        // Insert at the specified 'position' in this vector a copy of the
+        // specified 'value', and return an iterator referring to the new
+        // element.  Throw 'bsl::length_error' if 'size() == max_size()'.  The
+        // behavior is undefined unless 'position' is in the range
+        // '[ begin(), end() ]'.
+
+    iterator insert(const_iterator position, bslmf::MovableRef<TYPE> value);
+        // Insert at the specified 'position' in this vector the specified
+        // 'value', and return an iterator referring to the new element.
+        // 'value' is left in a valid but unspecified state.  Throw
+        // 'bsl::length_error' if 'size() == max_size()'.  The behavior is
+        // undefined unless 'position' is in the range '[ begin(), end() ]'.
+
+    iterator insert(const_iterator position,
+                    bsl::size_t    numElements,
+                    const TYPE&    value);
+        // Insert at the specified 'position' in this vector the specified
+        // 'numElements' copies of the specified 'value', and return an
+        // iterator referring to the first inserted element, or 'position' if
+        // 'numElements' is 0.  Throw 'bsl::length_error' if
+        // 'size() + numElements > max_size()'.  The behavior is undefined
+        // unless 'position' is in the range '[ begin(), end() ]'.
+
+    template <class INPUT_ITERATOR>
+    iterator insert(const_iterator position,
+                    INPUT_ITERATOR first,
+                    INPUT_ITERATOR last);
+        // Insert at the specified 'position' in this vector, in order, the
+        // elements of the input iterator range specified by 'first' through
+        // 'last' (including 'first', excluding 'last'), and return an iterator
+        // referring to the first inserted element, or 'position' if the range
+        // is empty.  Throw 'bsl::length_error' if the resulting size would
+        // exceed 'max_size()'.  The behavior is undefined unless 'position' is
+        // in the range '[ begin(), end() ]', and 'first' and 'last' refer to a
+        // sequence of valid values, not elements of this vector, where 'first'
+        // is at a position at or before 'last'.  Note that if
+        // 'INPUT_ITERATOR' is an integral type, this method behaves as the
+        // 'insert' overload taking a number of elements and a value.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    iterator insert(const_iterator              position,
+                    bsl::initializer_list<TYPE> values);
+        // Insert at the specified 'position' in this vector, in order, the
+        // specified 'values', and return an iterator referring to the first
+        // inserted element, or 'position' if 'values' is empty.  The behavior
+        // is undefined unless 'position' is in the range
+        // '[ begin(), end() ]'.
+#endif
+
+    void pop_back();
+        // Remove the last element of this vector.  The behavior is undefined
+        // unless this vector is not empty.
+
+    void push_back(const TYPE& value);
+        // Append to this vector a copy of the specified 'value'.  Throw
+        // 'bsl::length_error' if 'size() == max_size()'.
+
+    void push_back(bslmf::MovableRef<TYPE> value);
+        // Append to this vector the specified 'value'.  'value' is left in a
+        // valid but unspecified state.  Throw 'bsl::length_error' if
+        // 'size() == max_size()'.
+
+    void reserve(bsl::size_t numElements);
+        // Change the capacity of this vector to at least the specified
+        // 'numElements'.  Throw 'bsl::length_error' if
+        // 'numElements > max_size()'.  Note that this method has no effect
+        // unless 'numElements > capacity()'.
+
+    void resize(bsl::size_t numElements);
+        // Change the size of this vector to the specified 'numElements',
+        // removing elements from, or appending default-constructed elements
+        // to, the end of this vector.  Throw 'bsl::length_error' if
+        // 'numElements > max_size()'.
+
+    void resize(bsl::size_t numElements, const TYPE& value);
+        // Change the size of this vector to the specified 'numElements',
+        // removing elements from, or appending copies of the specified 'value'
+        // to, the end of this vector.  Throw 'bsl::length_error' if
+        // 'numElements > max_size()'.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this vector to its size, or to
+        // 'INLINE_CAPACITY' if its size is not greater, moving its elements
+        // back to its inline storage in the latter case.
+
+                          // Iterators
+
+    iterator begin();
+        // Return an iterator referring to the first element of this vector, or
+        // 'end()' if this vector is empty.
+
+    iterator end();
+        // Return an iterator referring to the past-the-end position of this
+        // vector.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator referring to the last element of this
+        // vector, or 'rend()' if this vector is empty.
+
+    reverse_iterator rend();
+        // Return a reverse iterator referring to the past-the-end position in
+        // the reverse sequence of the elements of this vector.
+
+                             // Aspects
+
+    void swap(SmallVector& other);
+        // Exchange the value of this object with that of the specified 'other'
+        // object.  This method provides the no-throw exception-safety
+        // guarantee if neither object holds its elements inline, or if the
+        // move constructor of 'TYPE' does not throw.  The behavior is
+        // undefined unless this object was created with the same allocator as
+        // 'other'.
+
+    // ACCESSORS
+    const_reference operator[](bsl::size_t position) const;
+        // Return a reference providing non-modifiable access to the element at
+        // the specified 'position' in this vector.  The behavior is undefined
+        // unless 'position < size()'.
+
+    const_reference at(bsl::size_t position) const;
+        // Return a reference providing non-modifiable access to the element at
+        // the specified 'position' in this vector.  Throw 'bsl::out_of_range'
+        // if 'position >= size()'.
+
+    const_reference back() const;
+        // Return a reference providing non-modifiable access to the last
+        // element of this vector.  The behavior is undefined unless this
+        // vector is not empty.
+
+    bsl::size_t capacity() const;
+        // Return the number of elements this vector can hold without
+        // allocating memory.  Note that the capacity of a vector holding its
+        // elements inline is 'INLINE_CAPACITY'.
+
+    const TYPE *data() const;
+        // Return the address of the first element of this vector, or of its
+        // (unused) storage if this vector is empty.
+
+    bool empty() const;
+        // Return 'true' if this vector has no elements, and 'false' otherwise.
+
+    const_reference front() const;
+        // Return a reference providing non-modifiable access to the first
+        // element of this vector.  The behavior is undefined unless this
+        // vector is not empty.
+
+    bool isInline() const;
+        // Return 'true' if the elements of this vector are held in its inline
+        // storage, and 'false' if they are held in memory obtained from its
+        // allocator.
+
+    bsl::size_t max_size() const;
+        // Return the maximum possible size of this vector.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this vector.
+
+                          // Iterators
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator referring to the first element of this vector, or
+        // 'end()' if this vector is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return an iterator referring to the past-the-end position of this
+        // vector.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator referring to the last element of this
+        // vector, or 'rend()' if this vector is empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator referring to the past-the-end position in
+        // the reverse sequence of the elements of this vector.
+
+                             // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this vector to supply memory.
+};
+
+// FREE OPERATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator==(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                const SmallVector<TYPE, INLINE_CAPACITY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'SmallVector' objects have the same
+    // value if they have the same size, and each element of one is equal to
+    // the element at the same position in the other.  This method requires
+    // that the (template parameter) type 'TYPE' be equality-comparable.
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator!=(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                const SmallVector<TYPE, INLINE_CAPACITY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'SmallVector' objects do not
+    // have the same value if they do not have the same size, or some element
+    // of one is not equal to the element at the same position in the other.
+    // This method requires that the (template parameter) type 'TYPE' be
+    // equality-comparable.
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+bool operator<(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+               const SmallVector<TYPE, INLINE_CAPACITY>& rhs);
+    // Return 'true' if the value of the specified 'lhs' vector is
+    // lexicographically less than that of the specified 'rhs' vector, and
+    // 'false' otherwise.  Elements are compared using 'operator<'.
+
+// FREE FUNCTIONS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void swap(SmallVector<TYPE, INLINE_CAPACITY>& a,
+          SmallVector<TYPE, INLINE_CAPACITY>& b);
+    // Exchange the values of the specified 'a' and 'b' objects.  This method
+    // provides the guarantees of the 'swap' method if the two objects were
+    // created with the same allocator, and the basic guarantee otherwise.
+
+                        // ==========================
+                        // class SmallVector::Proctor
+                        // ==========================
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+class SmallVector<TYPE, INLINE_CAPACITY>::Proctor {
+    // This class implements a proctor that, unless its 'release' method has
+    // been invoked, destroys, on destruction, the elements of a vector whose
+    // constructor has not completed, and deallocates its storage.
+
+    // DATA
+    SmallVector *d_vector_p;  // managed vector, or 0 if released
+
+  private:
+    // NOT IMPLEMENTED
+    Proctor(const Proctor&);
+    Proctor& operator=(const Proctor&);
+
+  public:
+    // CREATORS
+    explicit Proctor(SmallVector *vector);
+        // Create a proctor that releases the elements and storage of the
+        // specified 'vector' on destruction unless released.
+
+    ~Proctor();
+        // Destroy the elements of the managed vector and deallocate its
+        // storage, unless this proctor has been released.
+
+    // MANIPULATORS
+    void release();
+        // Release the managed vector from management by this proctor.
+};
+
+// ============================================================================
+//                TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                        // --------------------------
+                        // class SmallVector::Proctor
+                        // --------------------------
+
+// CREATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<TYPE, INLINE_CAPACITY>::Proctor::Proctor(SmallVector *vector)
+: d_vector_p(vector)
+{
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<TYPE, INLINE_CAPACITY>::Proctor::~Proctor()
+{
+    if (d_vector_p) {
+        d_vector_p->clear();
+
+        if (!d_vector_p->isInline()) {
+            d_vector_p->d_allocator_p->deallocate(d_vector_p->d_begin_p);
+        }
+    }
+}
+
+// MANIPULATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::Proctor::release()
+{
+    d_vector_p = 0;
+}
+
+                             // -----------------
+                             // class SmallVector
+                             // -----------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+bsl::size_t SmallVector<TYPE, INLINE_CAPACITY>::computeNewCapacity(
+                                                         bsl::size_t newSize,
+                                                         bsl::size_t capacity)
+{
+    BSLS_ASSERT_SAFE(capacity < newSize);
+
+    const bsl::size_t maxSize = bsl::numeric_limits<bsl::size_t>::max() /
+                                                                  sizeof(TYPE);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(newSize > maxSize)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                                       "SmallVector<...>: vector too long");
+    }
+
+    return capacity < maxSize / 2 ? bsl::max(newSize, 2 * capacity)
+                                  : maxSize;
+}
+
+// PRIVATE MANIPULATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+TYPE *SmallVector<TYPE, INLINE_CAPACITY>::allocateBuffer(bsl::size_t capacity)
+{
+    return static_cast<TYPE *>(d_allocator_p->allocate(capacity *
+                                                       sizeof(TYPE)));
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::adoptBuffer(TYPE        *buffer,
+                                                     bsl::size_t  capacity,
+                                                     bsl::size_t  size)
+{
+    if (d_begin_p != inlineBuffer()) {
+        d_allocator_p->deallocate(d_begin_p);
+    }
+    d_begin_p  = buffer;
+    d_end_p    = buffer + size;
+    d_capacity = capacity;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+TYPE *SmallVector<TYPE, INLINE_CAPACITY>::inlineBuffer()
+{
+    return reinterpret_cast<TYPE *>(d_inline.buffer());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INTEGRAL_TYPE>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::assignDispatch(
+                                                   INTEGRAL_TYPE  numElements,
+                                                   INTEGRAL_TYPE  value,
+                                                   bsl::true_type)
+{
+    assign(static_cast<bsl::size_t>(numElements),
+           static_cast<TYPE>(value));
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::assignDispatch(
+                                                      INPUT_ITERATOR  first,
+                                                      INPUT_ITERATOR  last,
+                                                      bsl::false_type)
+{
+    assignRange(first,
+                last,
+                typename bsl::iterator_traits<
+                                      INPUT_ITERATOR>::iterator_category());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+void SmallVector<TYPE, INLINE_CAPACITY>::assignRange(INPUT_ITERATOR first,
+                                                     INPUT_ITERATOR last,
+                                                     bsl::input_iterator_tag)
+{
+    clear();
+    for (; first != last; ++first) {
+        push_back(*first);
+    }
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class FORWARD_ITERATOR>
+void SmallVector<TYPE, INLINE_CAPACITY>::assignRange(
+                                            FORWARD_ITERATOR          first,
+                                            FORWARD_ITERATOR          last,
+                                            bsl::forward_iterator_tag)
+{
+    const bsl::size_t numElements = bsl::distance(first, last);
+
+    clear();
+    reserve(numElements);
+
+    ArrayPrimitives::copyConstruct(d_begin_p, first, last, d_allocator_p);
+    d_end_p = d_begin_p + numElements;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INTEGRAL_TYPE>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insertDispatch(
+                                                  const_iterator position,
+                                                  INTEGRAL_TYPE  numElements,
+                                                  INTEGRAL_TYPE  value,
+                                                  bsl::true_type)
+{
+    return insert(position,
+                  static_cast<bsl::size_t>(numElements),
+                  static_cast<TYPE>(value));
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insertDispatch(
+                                                  const_iterator  position,
+                                                  INPUT_ITERATOR  first,
+                                                  INPUT_ITERATOR  last,
+                                                  bsl::false_type)
+{
+    return insertRange(position,
+                       first,
+                       last,
+                       typename bsl::iterator_traits<
+                                      INPUT_ITERATOR>::iterator_category());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insertRange(
+                                              const_iterator          position,
+                                              INPUT_ITERATOR          first,
+                                              INPUT_ITERATOR          last,
+                                              bsl::input_iterator_tag)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position <= end());
+
+    // The length of the range is not known in advance, so the elements are
+    // appended, and then rotated into position.
+
+    const bsl::size_t index   = position - d_begin_p;
+    const bsl::size_t oldSize = size();
+
+    for (; first != last; ++first) {
+        push_back(*first);
+    }
+
+    ArrayPrimitives::rotate(d_begin_p + index,
+                            d_begin_p + oldSize,
+                            d_end_p);
+
+    return d_begin_p + index;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class FORWARD_ITERATOR>
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insertRange(
+                                            const_iterator            position,
+                                            FORWARD_ITERATOR          first,
+                                            FORWARD_ITERATOR          last,
+                                            bsl::forward_iterator_tag)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position <= end());
+
+    const bsl::size_t index       = position - d_begin_p;
+    const bsl::size_t numElements = bsl::distance(first, last);
+    const bsl::size_t newSize     = size() + numElements;
+    TYPE             *pos         = d_begin_p + index;
+
+    if (newSize > d_capacity) {
+        const bsl::size_t newCapacity = computeNewCapacity(newSize,
+                                                           d_capacity);
+
+        TYPE *buffer = allocateBuffer(newCapacity);
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(buffer,
+                                                            d_allocator_p);
+
+        ArrayPrimitives::destructiveMoveAndInsert(buffer,
+                                                  &d_end_p,
+                                                  d_begin_p,
+                                                  pos,
+                                                  d_end_p,
+                                                  first,
+                                                  last,
+                                                  numElements,
+                                                  d_allocator_p);
+        proctor.release();
+
+        adoptBuffer(buffer, newCapacity, newSize);
+    }
+    else {
+        ArrayPrimitives::insert(pos,
+                                d_end_p,
+                                first,
+                                last,
+                                numElements,
+                                d_allocator_p);
+        d_end_p += numElements;
+    }
+
+    return d_begin_p + index;
+}
+
+// PRIVATE ACCESSORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+const TYPE *SmallVector<TYPE, INLINE_CAPACITY>::inlineBuffer() const
+{
+    return reinterpret_cast<const TYPE *>(d_inline.buffer());
+}
+
+// CREATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector()
+: d_begin_p(inlineBuffer())
+, d_end_p(d_begin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator())
+{
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                              bslma::Allocator *basicAllocator)
+: d_begin_p(inlineBuffer())
+, d_end_p(d_begin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                              bsl::size_t       numElements,
+                                              bslma::Allocator *basicAllocator)
+: d_begin_p(inlineBuffer())
+, d_end_p(d_begin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    Proctor proctor(this);
+
+    resize(numElements);
+
+    proctor.release();
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                              bsl::size_t       numElements,
+                                              const TYPE&       value,
+                                              bslma::Allocator *basicAllocator)
+: d_begin_p(inlineBuffer())
+, d_end_p(d_begin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    Proctor proctor(this);
+
+    assign(numElements, value);
+
+    proctor.release();
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bslma::Allocator *basicAllocator)
+: d_begin_p(inlineBuffer())
+, d_end_p(d_begin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    Proctor proctor(this);
+
+    assign(first, last);
+
+    proctor.release();
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                   bsl::initializer_list<TYPE>  values,
+                                   bslma::Allocator            *basicAllocator)
+: d_begin_p(inlineBuffer())
+, d_end_p(d_begin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    Proctor proctor(this);
+
+    assign(values.begin(), values.end());
+
+    proctor.release();
+}
+#endif
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                            const SmallVector&  original,
+                                            bslma::Allocator   *basicAllocator)
+: d_begin_p(inlineBuffer())
+, d_end_p(d_begin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    Proctor proctor(this);
+
+    assign(original.d_begin_p, original.d_end_p);
+
+    proctor.release();
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                       bslmf::MovableRef<SmallVector> original)
+: d_begin_p(inlineBuffer())
+, d_end_p(d_begin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(MoveUtil::access(original).d_allocator_p)
+{
+    SmallVector& lvalue = original;
+
+    if (lvalue.isInline()) {
+        ArrayPrimitives::destructiveMove(d_begin_p,
+                                         lvalue.d_begin_p,
+                                         lvalue.d_end_p,
+                                         d_allocator_p);
+        d_end_p        = d_begin_p + lvalue.size();
+        lvalue.d_end_p = lvalue.d_begin_p;
+    }
+    else {
+        d_begin_p  = lvalue.d_begin_p;
+        d_end_p    = lvalue.d_end_p;
+        d_capacity = lvalue.d_capacity;
+
+        lvalue.d_begin_p  = lvalue.inlineBuffer();
+        lvalue.d_end_p    = lvalue.d_begin_p;
+        lvalue.d_capacity = INLINE_CAPACITY;
+    }
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                               bslmf::MovableRef<SmallVector>  original,
+                               bslma::Allocator               *basicAllocator)
+: d_begin_p(inlineBuffer())
+, d_end_p(d_begin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    Proctor proctor(this);
+
+    *this = MoveUtil::move(MoveUtil::access(original));
+
+    proctor.release();
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<TYPE, INLINE_CAPACITY>::~SmallVector()
+{
+    ArrayDestructionPrimitives::destroy(d_begin_p, d_end_p);
+
+    if (d_begin_p != inlineBuffer()) {
+        d_allocator_p->deallocate(d_begin_p);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<TYPE, INLINE_CAPACITY>&
+SmallVector<TYPE, INLINE_CAPACITY>::operator=(const SmallVector& rhs)
+{
+    if (this != &rhs) {
+        assign(rhs.d_begin_p, rhs.d_end_p);
+    }
+    return *this;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>&
+SmallVector<TYPE, INLINE_CAPACITY>::operator=(
+                                            bslmf::MovableRef<SmallVector> rhs)
+{
+    SmallVector& lvalue = rhs;
+
+    if (this == &lvalue) {
+        return *this;                                                 // RETURN
+    }
+
+    clear();
+
+    if (d_allocator_p != lvalue.d_allocator_p) {
+        reserve(lvalue.size());
+
+        ArrayPrimitives::moveConstruct(d_begin_p,
+                                       lvalue.d_begin_p,
+                                       lvalue.d_end_p,
+                                       d_allocator_p);
+        d_end_p = d_begin_p + lvalue.size();
+    }
+    else if (lvalue.isInline()) {
+        // The storage of this vector, inline or not, is large enough.
+
+        ArrayPrimitives::destructiveMove(d_begin_p,
+                                         lvalue.d_begin_p,
+                                         lvalue.d_end_p,
+                                         d_allocator_p);
+        d_end_p        = d_begin_p + lvalue.size();
+        lvalue.d_end_p = lvalue.d_begin_p;
+    }
+    else {
+        adoptBuffer(lvalue.d_begin_p, lvalue.d_capacity, lvalue.size());
+
+        lvalue.d_begin_p  = lvalue.inlineBuffer();
+        lvalue.d_end_p    = lvalue.d_begin_p;
+        lvalue.d_capacity = INLINE_CAPACITY;
+    }
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<TYPE, INLINE_CAPACITY>&
+SmallVector<TYPE, INLINE_CAPACITY>::operator=(
+                                            bsl::initializer_list<TYPE> values)
+{
+    assign(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::assign(bsl::size_t numElements,
+                                                const TYPE& value)
+{
+    BSLS_ASSERT_SAFE(&value <  d_begin_p || d_end_p <= &value);
+
+    clear();
+    reserve(numElements);
+
+    ArrayPrimitives::uninitializedFillN(d_begin_p,
+                                        numElements,
+                                        value,
+                                        d_allocator_p);
+    d_end_p = d_begin_p + numElements;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::assign(INPUT_ITERATOR first,
+                                                INPUT_ITERATOR last)
+{
+    assignDispatch(first,
+                   last,
+                   typename bsl::is_integral<INPUT_ITERATOR>::type());
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::assign(
+                                            bsl::initializer_list<TYPE> values)
+{
+    assign(values.begin(), values.end());
+}
+#endif
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reference
+SmallVector<TYPE, INLINE_CAPACITY>::operator[](bsl::size_t position)
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_begin_p[position];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reference
+SmallVector<TYPE, INLINE_CAPACITY>::at(bsl::size_t position)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                  "SmallVector<...>::at(position): invalid "
+                                  "position");
+    }
+    return d_begin_p[position];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reference
+SmallVector<TYPE, INLINE_CAPACITY>::back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_end_p - 1);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::clear()
+{
+    ArrayDestructionPrimitives::destroy(d_begin_p, d_end_p);
+    d_end_p = d_begin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+TYPE *SmallVector<TYPE, INLINE_CAPACITY>::data()
+{
+    return d_begin_p;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class... ARGS>
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::emplace(const_iterator position,
+                                            ARGS&&...      args)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position <= end());
+
+    const bsl::size_t index = position - d_begin_p;
+    TYPE             *pos   = d_begin_p + index;
+
+    if (d_end_p == d_begin_p + d_capacity) {
+        const bsl::size_t newSize     = size() + 1;
+        const bsl::size_t newCapacity = computeNewCapacity(newSize,
+                                                           d_capacity);
+
+        TYPE *buffer = allocateBuffer(newCapacity);
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(buffer,
+                                                            d_allocator_p);
+
+        ArrayPrimitives::destructiveMoveAndEmplace(
+                                 buffer,
+                                 &d_end_p,
+                                 d_begin_p,
+                                 pos,
+                                 d_end_p,
+                                 StdAllocator(d_allocator_p),
+                                 BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+        proctor.release();
+
+        adoptBuffer(buffer, newCapacity, newSize);
+    }
+    else {
+        ArrayPrimitives::emplace(pos,
+                                 d_end_p,
+                                 d_allocator_p,
+                                 BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+        ++d_end_p;
+    }
+
+    return d_begin_p + index;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class... ARGS>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reference
+SmallVector<TYPE, INLINE_CAPACITY>::emplace_back(ARGS&&... args)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p !=
+                                                    d_begin_p + d_capacity)) {
+        bslma::ConstructionUtil::construct(
+                                 d_end_p,
+                                 d_allocator_p,
+                                 BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+        return *d_end_p++;                                            // RETURN
+    }
+
+    return *emplace(d_end_p, BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+}
+#endif
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position < end());
+
+    return erase(position, position + 1);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::erase(const_iterator first,
+                                          const_iterator last)
+{
+    BSLS_ASSERT_SAFE(begin() <= first);
+    BSLS_ASSERT_SAFE(first <= last);
+    BSLS_ASSERT_SAFE(last <= end());
+
+    TYPE *from = d_begin_p + (first - d_begin_p);
+    TYPE *to   = d_begin_p + (last  - d_begin_p);
+
+    ArrayPrimitives::erase(from, to, d_end_p, d_allocator_p);
+    d_end_p -= to - from;
+
+    return from;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reference
+SmallVector<TYPE, INLINE_CAPACITY>::front()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_begin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insert(const_iterator position,
+                                           const TYPE&    value)
+{
+    return insert(position, 1, value);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insert(
+                                       const_iterator          position,
+                                       bslmf::MovableRef<TYPE> value)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position <= end());
+
+    TYPE& lvalue = value;
+
+    const bsl::size_t index = position - d_begin_p;
+    TYPE             *pos   = d_begin_p + index;
+
+    if (d_end_p == d_begin_p + d_capacity) {
+        const bsl::size_t newSize     = size() + 1;
+        const bsl::size_t newCapacity = computeNewCapacity(newSize,
+                                                           d_capacity);
+
+        TYPE *buffer = allocateBuffer(newCapacity);
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(buffer,
+                                                            d_allocator_p);
+
+        ArrayPrimitives::destructiveMoveAndEmplace(buffer,
+                                                   &d_end_p,
+                                                   d_begin_p,
+                                                   pos,
+                                                   d_end_p,
+                                                   StdAllocator(d_allocator_p),
+                                                   MoveUtil::move(lvalue));
+        proctor.release();
+
+        adoptBuffer(buffer, newCapacity, newSize);
+    }
+    else {
+        ArrayPrimitives::insert(pos,
+                                d_end_p,
+                                MoveUtil::move(lvalue),
+                                d_allocator_p);
+        ++d_end_p;
+    }
+
+    return d_begin_p + index;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insert(const_iterator position,
+                                           bsl::size_t    numElements,
+                                           const TYPE&    value)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position <= end());
+
+    const bsl::size_t index = position - d_begin_p;
+    TYPE             *pos   = d_begin_p + index;
+
+    if (numElements > d_capacity - size()) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numElements >
+                                                     max_size() - size())) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                         "SmallVector<...>::insert(pos,n,v): vector too long");
+        }
+
+        const bsl::size_t newSize     = size() + numElements;
+        const bsl::size_t newCapacity = computeNewCapacity(newSize,
+                                                           d_capacity);
+
+        TYPE *buffer = allocateBuffer(newCapacity);
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(buffer,
+                                                            d_allocator_p);
+
+        ArrayPrimitives::destructiveMoveAndInsert(buffer,
+                                                  &d_end_p,
+                                                  d_begin_p,
+                                                  pos,
+                                                  d_end_p,
+                                                  value,
+                                                  numElements,
+                                                  d_allocator_p);
+        proctor.release();
+
+        adoptBuffer(buffer, newCapacity, newSize);
+    }
+    else {
+        ArrayPrimitives::insert(pos,
+                                d_end_p,
+                                value,
+                                numElements,
+                                d_allocator_p);
+        d_end_p += numElements;
+    }
+
+    return d_begin_p + index;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITERATOR>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insert(const_iterator position,
+                                           INPUT_ITERATOR first,
+                                           INPUT_ITERATOR last)
+{
+    return insertDispatch(position,
+                          first,
+                          last,
+                          typename bsl::is_integral<INPUT_ITERATOR>::type());
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insert(
+                                      const_iterator              position,
+                                      bsl::initializer_list<TYPE> values)
+{
+    return insert(position, values.begin(), values.end());
+}
+#endif
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::pop_back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    --d_end_p;
+    bslma::DestructionUtil::destroy(d_end_p);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::push_back(const TYPE& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p !=
+                                                    d_begin_p + d_capacity)) {
+        bslma::ConstructionUtil::construct(d_end_p, d_allocator_p, value);
+        ++d_end_p;
+        return;                                                       // RETURN
+    }
+
+    insert(d_end_p, 1, value);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::push_back(
+                                                 bslmf::MovableRef<TYPE> value)
+{
+    TYPE& lvalue = value;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_end_p !=
+                                                    d_begin_p + d_capacity)) {
+        bslma::ConstructionUtil::construct(d_end_p,
+                                           d_allocator_p,
+                                           MoveUtil::move(lvalue));
+        ++d_end_p;
+        return;                                                       // RETURN
+    }
+
+    insert(d_end_p, MoveUtil::move(lvalue));
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::reserve(bsl::size_t numElements)
+{
+    if (numElements <= d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numElements > max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                                "SmallVector<...>::reserve(n): n too large");
+    }
+
+    TYPE *buffer = allocateBuffer(numElements);
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(buffer,
+                                                        d_allocator_p);
+
+    ArrayPrimitives::destructiveMove(buffer,
+                                     d_begin_p,
+                                     d_end_p,
+                                     d_allocator_p);
+    proctor.release();
+
+    adoptBuffer(buffer, numElements, size());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::resize(bsl::size_t numElements)
+{
+    if (numElements <= size()) {
+        TYPE *newEnd = d_begin_p + numElements;
+
+        ArrayDestructionPrimitives::destroy(newEnd, d_end_p);
+        d_end_p = newEnd;
+        return;                                                       // RETURN
+    }
+
+    if (numElements > d_capacity) {
+        reserve(computeNewCapacity(numElements, d_capacity));
+    }
+
+    ArrayPrimitives::defaultConstruct(d_end_p,
+                                      numElements - size(),
+                                      d_allocator_p);
+    d_end_p = d_begin_p + numElements;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::resize(bsl::size_t numElements,
+                                                const TYPE& value)
+{
+    if (numElements <= size()) {
+        TYPE *newEnd = d_begin_p + numElements;
+
+        ArrayDestructionPrimitives::destroy(newEnd, d_end_p);
+        d_end_p = newEnd;
+        return;                                                       // RETURN
+    }
+
+    insert(d_end_p, numElements - size(), value);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::shrink_to_fit()
+{
+    if (isInline() || size() == d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    const bsl::size_t numElements = size();
+
+    if (numElements <= INLINE_CAPACITY) {
+        ArrayPrimitives::destructiveMove(inlineBuffer(),
+                                         d_begin_p,
+                                         d_end_p,
+                                         d_allocator_p);
+
+        adoptBuffer(inlineBuffer(), INLINE_CAPACITY, numElements);
+        return;                                                       // RETURN
+    }
+
+    TYPE *buffer = allocateBuffer(numElements);
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(buffer,
+                                                        d_allocator_p);
+
+    ArrayPrimitives::destructiveMove(buffer,
+                                     d_begin_p,
+                                     d_end_p,
+                                     d_allocator_p);
+    proctor.release();
+
+    adoptBuffer(buffer, numElements, numElements);
+}
+
+                          // Iterators
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::begin()
+{
+    return d_begin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::end()
+{
+    return d_end_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::rbegin()
+{
+    return reverse_iterator(d_end_p);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::rend()
+{
+    return reverse_iterator(d_begin_p);
+}
+
+                             // Aspects
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::swap(SmallVector& other)
+{
+    BSLS_ASSERT_SAFE(d_allocator_p == other.d_allocator_p);
+
+    if (!isInline() && !other.isInline()) {
+        bsl::swap(d_begin_p,  other.d_begin_p);
+        bsl::swap(d_end_p,    other.d_end_p);
+        bsl::swap(d_capacity, other.d_capacity);
+        return;                                                       // RETURN
+    }
+
+    SmallVector tmp(MoveUtil::move(*this));
+
+    *this = MoveUtil::move(other);
+    other = MoveUtil::move(tmp);
+}
+
+// ACCESSORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reference
+SmallVector<TYPE, INLINE_CAPACITY>::operator[](bsl::size_t position) const
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_begin_p[position];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reference
+SmallVector<TYPE, INLINE_CAPACITY>::at(bsl::size_t position) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                  "SmallVector<...>::at(position): invalid "
+                                  "position");
+    }
+    return d_begin_p[position];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reference
+SmallVector<TYPE, INLINE_CAPACITY>::back() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_end_p - 1);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bsl::size_t SmallVector<TYPE, INLINE_CAPACITY>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+const TYPE *SmallVector<TYPE, INLINE_CAPACITY>::data() const
+{
+    return d_begin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool SmallVector<TYPE, INLINE_CAPACITY>::empty() const
+{
+    return d_begin_p == d_end_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reference
+SmallVector<TYPE, INLINE_CAPACITY>::front() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_begin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool SmallVector<TYPE, INLINE_CAPACITY>::isInline() const
+{
+    return d_begin_p == inlineBuffer();
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bsl::size_t SmallVector<TYPE, INLINE_CAPACITY>::max_size() const
+{
+    return bsl::numeric_limits<bsl::size_t>::max() / sizeof(TYPE);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bsl::size_t SmallVector<TYPE, INLINE_CAPACITY>::size() const
+{
+    return d_end_p - d_begin_p;
+}
+
+                          // Iterators
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::begin() const
+{
+    return d_begin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::cbegin() const
+{
+    return d_begin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::end() const
+{
+    return d_end_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::cend() const
+{
+    return d_end_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::crbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::crend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+                             // Aspects
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bslma::Allocator *SmallVector<TYPE, INLINE_CAPACITY>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlc::operator==(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                      const SmallVector<TYPE, INLINE_CAPACITY>& rhs)
+{
+    return lhs.size() == rhs.size()
+        && bsl::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlc::operator!=(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                      const SmallVector<TYPE, INLINE_CAPACITY>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool bdlc::operator<(const SmallVector<TYPE, INLINE_CAPACITY>& lhs,
+                     const SmallVector<TYPE, INLINE_CAPACITY>& rhs)
+{
+    return bsl::lexicographical_compare(lhs.begin(),
+                                        lhs.end(),
+                                        rhs.begin(),
+                                        rhs.end());
+}
+
+// FREE FUNCTIONS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void bdlc::swap(SmallVector<TYPE, INLINE_CAPACITY>& a,
+                SmallVector<TYPE, INLINE_CAPACITY>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    typedef SmallVector<TYPE, INLINE_CAPACITY> Vector;
+
+    Vector futureA(b, a.allocator());
+    Vector futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslalg {
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+struct HasStlIterators<bdlc::SmallVector<TYPE, INLINE_CAPACITY> >
+: bsl::true_type {
+};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+struct UsesBslmaAllocator<bdlc::SmallVector<TYPE, INLINE_CAPACITY> >
+: bsl::true_type {
+};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
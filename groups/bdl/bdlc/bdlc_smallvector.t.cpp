@@ -0,0 +1,1868 @@
+// bdlc_smallvector.t.cpp                                             -*-C++-*-
+
+#include <bdlc_smallvector.h>
+
+#include <bslalg_hasstliterators.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <bsl_initializer_list.h>
+#endif
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_list.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#if defined(BDE_BUILD_TARGET_EXC)
+#include <stdexcept>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a dynamic array that holds a few elements
+// in storage inside the object, and moves them to allocated memory when it
+// outgrows that storage.  The element manipulations are delegated to
+// 'bslalg::ArrayPrimitives', so the primary concerns are the transitions
+// between inline and allocated storage, the correct bookkeeping of the size
+// and capacity through every manipulation, and the choice of allocator.
+// Most test cases compare the behavior of 'bdlc::SmallVector' against that of
+// 'bsl::vector', for an allocator-aware, bitwise-movable element type
+// ('bsl::string') and for a type that is neither bitwise-movable nor
+// bitwise-copyable ('SelfRef', which holds its own address).
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//: o Any allocated memory is always from the object allocator.
+//: o No memory is allocated while the elements fit in the inline storage.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] SmallVector(bslma::Allocator *basicAllocator);
+// [ 6] SmallVector(size_t numElements, bslma::Allocator * = 0);
+// [ 6] SmallVector(size_t n, const TYPE& value, bslma::Allocator * = 0);
+// [ 4] SmallVector(II first, II last, bslma::Allocator * = 0);
+// [ 4] SmallVector(initializer_list<TYPE>, bslma::Allocator * = 0);
+// [ 5] SmallVector(const SmallVector&, bslma::Allocator * = 0);
+// [ 5] SmallVector(MovableRef<SmallVector>);
+// [ 5] SmallVector(MovableRef<SmallVector>, bslma::Allocator *);
+// [ 2] ~SmallVector();
+//
+// MANIPULATORS
+// [ 5] SmallVector& operator=(const SmallVector& rhs);
+// [ 5] SmallVector& operator=(MovableRef<SmallVector> rhs);
+// [ 4] SmallVector& operator=(initializer_list<TYPE> values);
+// [ 6] void assign(size_t numElements, const TYPE& value);
+// [ 4] void assign(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 4] void assign(initializer_list<TYPE> values);
+// [ 2] reference operator[](size_t position);
+// [ 6] reference at(size_t position);
+// [ 2] reference back();
+// [ 2] void clear();
+// [ 2] TYPE *data();
+// [ 3] iterator emplace(const_iterator position, ARGS&&... args);
+// [ 2] reference emplace_back(ARGS&&... args);
+// [ 3] iterator erase(const_iterator position);
+// [ 3] iterator erase(const_iterator first, const_iterator last);
+// [ 2] reference front();
+// [ 3] iterator insert(const_iterator position, const TYPE& value);
+// [ 3] iterator insert(const_iterator position, MovableRef<TYPE> value);
+// [ 3] iterator insert(const_iterator pos, size_t n, const TYPE& value);
+// [ 4] iterator insert(const_iterator pos, II first, II last);
+// [ 4] iterator insert(const_iterator, initializer_list<TYPE>);
+// [ 2] void pop_back();
+// [ 2] void push_back(const TYPE& value);
+// [ 2] void push_back(MovableRef<TYPE> value);
+// [ 6] void reserve(size_t numElements);
+// [ 6] void resize(size_t numElements);
+// [ 6] void resize(size_t numElements, const TYPE& value);
+// [ 6] void shrink_to_fit();
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 2] reverse_iterator rbegin();
+// [ 2] reverse_iterator rend();
+// [ 5] void swap(SmallVector& other);
+//
+// ACCESSORS
+// [ 2] const_reference operator[](size_t position) const;
+// [ 6] const_reference at(size_t position) const;
+// [ 2] const_reference back() const;
+// [ 2] size_t capacity() const;
+// [ 2] const TYPE *data() const;
+// [ 2] bool empty() const;
+// [ 2] const_reference front() const;
+// [ 2] bool isInline() const;
+// [ 6] size_t max_size() const;
+// [ 2] size_t size() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_reverse_iterator rbegin() const;
+// [ 2] const_reverse_iterator rend() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const SmallVector&, const SmallVector&);
+// [ 5] bool operator!=(const SmallVector&, const SmallVector&);
+// [ 5] bool operator<(const SmallVector&, const SmallVector&);
+//
+// FREE FUNCTIONS
+// [ 5] void swap(SmallVector& a, SmallVector& b);
+// ----------------------------------------------------------------------------
+// [ 7] USAGE EXAMPLE
+// [ 1] BREATHING TEST
+// [-1] PERFORMANCE TEST
+// [ 5] CONCERN: The type traits are set correctly.
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT  BSLIM_TESTUTIL_ASSERT
+#define ASSERTV BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q  BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P  BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_ BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_ BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_ BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool verbose;
+bool veryVerbose;
+bool veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::SmallVector<bsl::string, 4> Obj;
+typedef bsl::vector<bsl::string>          Model;
+
+// ============================================================================
+//                     GLOBAL HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+class SelfRef {
+    // This class holds an 'int' value and its own address, and so is neither
+    // bitwise-movable nor bitwise-copyable: an object relocated other than by
+    // its copy constructor is detected by 'isValid'.  The number of objects
+    // of this class in existence is tracked, so that leaks are detected.
+
+    // DATA
+    SelfRef    *d_self_p;  // address of this object
+    int         d_value;   // value
+
+    // CLASS DATA
+    static int  s_count;   // number of objects in existence
+
+  public:
+    // CLASS METHODS
+    static int count();
+        // Return the number of objects of this class in existence.
+
+    // CREATORS
+    SelfRef();
+    SelfRef(int value);                                             // IMPLICIT
+    SelfRef(const SelfRef& original);
+        // Create an object having the optionally specified 'value', or having
+        // the value of the specified 'original' object.  If 'value' is not
+        // specified, the value is 0.
+
+    ~SelfRef();
+        // Destroy this object.
+
+    // MANIPULATORS
+    SelfRef& operator=(const SelfRef& rhs);
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+
+    // ACCESSORS
+    bool isValid() const;
+        // Return 'true' if this object has not been relocated, and 'false'
+        // otherwise.
+
+    int value() const;
+        // Return the value of this object.
+};
+
+int SelfRef::s_count = 0;
+
+int SelfRef::count()
+{
+    return s_count;
+}
+
+SelfRef::SelfRef()
+: d_self_p(this)
+, d_value(0)
+{
+    ++s_count;
+}
+
+SelfRef::SelfRef(int value)
+: d_self_p(this)
+, d_value(value)
+{
+    ++s_count;
+}
+
+SelfRef::SelfRef(const SelfRef& original)
+: d_self_p(this)
+, d_value(original.d_value)
+{
+    ASSERT(original.isValid());
+    ++s_count;
+}
+
+SelfRef::~SelfRef()
+{
+    ASSERT(isValid());
+    d_self_p = 0;
+    --s_count;
+}
+
+SelfRef& SelfRef::operator=(const SelfRef& rhs)
+{
+    ASSERT(isValid());
+    ASSERT(rhs.isValid());
+    d_value = rhs.d_value;
+    return *this;
+}
+
+bool SelfRef::isValid() const
+{
+    return this == d_self_p;
+}
+
+int SelfRef::value() const
+{
+    return d_value;
+}
+
+bool operator==(const SelfRef& lhs, const SelfRef& rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same value, and
+    // 'false' otherwise.
+{
+    return lhs.value() == rhs.value();
+}
+
+bool operator<(const SelfRef& lhs, const SelfRef& rhs)
+    // Return 'true' if the specified 'lhs' has a lesser value than the
+    // specified 'rhs', and 'false' otherwise.
+{
+    return lhs.value() < rhs.value();
+}
+
+template <class VALUE_TYPE>
+class ExceptionGuard {
+    // This scoped guard verifies, on destruction, that an object has the
+    // value it had on construction (or on the last call to 'resetValue'),
+    // unless 'release' has been called.
+
+    // DATA
+    int               d_line;      // line number of the guarded operation
+    VALUE_TYPE        d_value;     // expected value
+    const VALUE_TYPE *d_object_p;  // guarded object, or 0 if released
+
+  public:
+    // CREATORS
+    ExceptionGuard(const VALUE_TYPE *object, int line)
+        // Create a guard for the specified 'object', recording its value, and
+        // the specified 'line' to report on failure.
+    : d_line(line)
+    , d_value(*object)
+    , d_object_p(object)
+    {
+    }
+
+    ~ExceptionGuard()
+        // Verify that the guarded object, unless released, has the recorded
+        // value, and destroy this guard.
+    {
+        if (d_object_p) {
+            ASSERTV(d_line, d_value == *d_object_p);
+        }
+    }
+
+    // MANIPULATORS
+    void release()
+        // Release the guarded object from verification.
+    {
+        d_object_p = 0;
+    }
+
+    void resetValue(const VALUE_TYPE *object, int line)
+        // Record the value of the specified 'object' as that expected, and
+        // the specified 'line' to report on failure.
+    {
+        d_line     = line;
+        d_value    = *object;
+        d_object_p = object;
+    }
+};
+
+template <class ITERATOR>
+class InputIterator {
+    // This class template adapts an iterator of (template parameter) type
+    // 'ITERATOR' to provide only the interface of an input iterator.
+
+    // DATA
+    ITERATOR d_iterator;  // adapted iterator
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::input_iterator_tag                          iterator_category;
+    typedef typename bsl::iterator_traits<ITERATOR>::value_type value_type;
+    typedef bsl::ptrdiff_t                                   difference_type;
+    typedef const value_type                                *pointer;
+    typedef const value_type&                                reference;
+
+    // CREATORS
+    explicit InputIterator(ITERATOR iterator)
+        // Create an input iterator referring to the same position as the
+        // specified 'iterator'.
+    : d_iterator(iterator)
+    {
+    }
+
+    // MANIPULATORS
+    InputIterator& operator++()
+        // Advance this iterator, and return a reference providing modifiable
+        // access to it.
+    {
+        ++d_iterator;
+        return *this;
+    }
+
+    // ACCESSORS
+    reference operator*() const
+        // Return a reference to the element this iterator refers to.
+    {
+        return *d_iterator;
+    }
+
+    bool operator==(const InputIterator& rhs) const
+        // Return 'true' if this iterator and the specified 'rhs' refer to the
+        // same position, and 'false' otherwise.
+    {
+        return d_iterator == rhs.d_iterator;
+    }
+
+    bool operator!=(const InputIterator& rhs) const
+        // Return 'true' if this iterator and the specified 'rhs' do not refer
+        // to the same position, and 'false' otherwise.
+    {
+        return d_iterator != rhs.d_iterator;
+    }
+};
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+template <class TYPE>
+TYPE makeValue(int i);
+    // Return an object of the (template parameter) type 'TYPE' uniquely
+    // determined by the specified 'i'.  An object of an allocator-aware type
+    // uses the default allocator, and requires allocation.
+
+template <>
+int makeValue<int>(int i)
+{
+    return i;
+}
+
+template <>
+SelfRef makeValue<SelfRef>(int i)
+{
+    return SelfRef(i);
+}
+
+template <>
+bsl::string makeValue<bsl::string>(int i)
+{
+    bsl::ostringstream oss;
+    oss << "a string long enough to require allocation " << i;
+    return oss.str();
+}
+
+int blocksPerElement(const int *)
+    // Return the number of blocks of memory allocated by an 'int'.
+{
+    return 0;
+}
+
+int blocksPerElement(const SelfRef *)
+    // Return the number of blocks of memory allocated by a 'SelfRef'.
+{
+    return 0;
+}
+
+int blocksPerElement(const bsl::string *)
+    // Return the number of blocks of memory allocated by a string created by
+    // 'makeValue'.
+{
+    return 1;
+}
+
+bool usesAllocator(const int&, bslma::Allocator *)
+    // Return 'true'.
+{
+    return true;
+}
+
+bool usesAllocator(const SelfRef& object, bslma::Allocator *)
+    // Return 'true' if the specified 'object' is valid, and 'false'
+    // otherwise.
+{
+    return object.isValid();
+}
+
+bool usesAllocator(const bsl::string& object, bslma::Allocator *allocator)
+    // Return 'true' if the specified 'object' uses the specified 'allocator',
+    // and 'false' otherwise.
+{
+    return allocator == object.get_allocator().mechanism();
+}
+
+template <class VECTOR, class MODEL>
+bool sameValue(const VECTOR& vector, const MODEL& model)
+    // Return 'true' if the specified 'vector' holds the same sequence of
+    // elements as the specified 'model', and every element of 'vector' uses
+    // the allocator of 'vector', and 'false' otherwise.
+{
+    if (vector.size() != model.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (bsl::size_t i = 0; i < model.size(); ++i) {
+        if (!(vector[i] == model[i])
+         || !usesAllocator(vector[i], vector.allocator())) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class VECTOR>
+bool validStorage(const VECTOR&               vector,
+                  const bslma::TestAllocator& allocator)
+    // Return 'true' if the specified 'vector' holds its elements inline
+    // exactly when its capacity is its inline capacity, and the specified
+    // 'allocator', used only by 'vector', has outstanding exactly the blocks
+    // allocated by the elements of 'vector' and, unless 'vector' holds its
+    // elements inline, its storage; and 'false' otherwise.
+{
+    typedef typename VECTOR::value_type TYPE;
+
+    const bsl::size_t inlineCapacity = VECTOR().capacity();
+
+    if (vector.isInline() != (inlineCapacity == vector.capacity())) {
+        return false;                                                 // RETURN
+    }
+
+    const bsls::Types::Int64 numElements =
+                              static_cast<bsls::Types::Int64>(vector.size());
+    const bsls::Types::Int64 expected    =
+                      numElements * blocksPerElement(static_cast<TYPE *>(0))
+                    + (vector.isInline() ? 0 : 1);
+
+    return expected == allocator.numBlocksInUse();
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void testPrimaryManipulators()
+    // Test the primary manipulators and basic accessors of
+    // 'bdlc::SmallVector<TYPE, INLINE_CAPACITY>'.
+{
+    typedef bdlc::SmallVector<TYPE, INLINE_CAPACITY> Vector;
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    {
+        Vector          mX(&oa);  const Vector& X = mX;
+        bsl::vector<TYPE> mY;
+
+        ASSERT(0               == oa.numBlocksTotal());
+        ASSERT(true            == X.empty());
+        ASSERT(0               == X.size());
+        ASSERT(INLINE_CAPACITY == X.capacity());
+        ASSERT(true            == X.isInline());
+        ASSERT(&oa             == X.allocator());
+        ASSERT(X.begin()       == X.end());
+        ASSERT(X.rbegin()      == X.rend());
+
+        for (int round = 0; round < 3; ++round) {
+            const int NUM_ELEMENTS = static_cast<int>(3 * INLINE_CAPACITY + 2);
+
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                const TYPE VALUE = makeValue<TYPE>(i);
+
+                if (i % 2) {
+                    mX.push_back(VALUE);
+                }
+                else {
+                    TYPE value(VALUE);
+                    mX.push_back(bslmf::MovableRefUtil::move(value));
+                }
+                mY.push_back(VALUE);
+
+                ASSERTV(INLINE_CAPACITY, round, i, sameValue(X, mY));
+                ASSERTV(INLINE_CAPACITY, round, i, validStorage(X, oa));
+                ASSERTV(INLINE_CAPACITY, round, i,
+                        (0 == round && X.size() <= INLINE_CAPACITY) ==
+                                                               X.isInline());
+                ASSERTV(INLINE_CAPACITY, round, i, VALUE == X.back());
+                ASSERTV(INLINE_CAPACITY, round, i, VALUE == mX.back());
+                ASSERTV(INLINE_CAPACITY, round, i,
+                        makeValue<TYPE>(0) == X.front());
+                ASSERTV(INLINE_CAPACITY, round, i,
+                        makeValue<TYPE>(0) == mX.front());
+                ASSERTV(INLINE_CAPACITY, round, i, X.data() == &X[0]);
+                ASSERTV(INLINE_CAPACITY, round, i, mX.data() == &mX[0]);
+                ASSERTV(INLINE_CAPACITY, round, i, X.size() <= X.capacity());
+                ASSERTV(INLINE_CAPACITY, round, i,
+                        X.end() == X.begin() + X.size());
+                ASSERTV(INLINE_CAPACITY, round, i,
+                        mX.end() == mX.begin() + X.size());
+                ASSERTV(INLINE_CAPACITY, round, i, false == X.empty());
+            }
+
+            typename bsl::vector<TYPE>::const_reverse_iterator jt =
+                                                                  mY.rbegin();
+            for (typename Vector::reverse_iterator it = mX.rbegin();
+                                                   it != mX.rend();
+                                                   ++it, ++jt) {
+                ASSERTV(INLINE_CAPACITY, round, *jt == *it);
+            }
+            ASSERTV(INLINE_CAPACITY, round,
+                    X.size() == static_cast<bsl::size_t>(
+                                               bsl::distance(X.rbegin(),
+                                                             X.rend())));
+
+            for (int i = 0; i < NUM_ELEMENTS / 2; ++i) {
+                mX.pop_back();
+                mY.pop_back();
+
+                ASSERTV(INLINE_CAPACITY, round, i, sameValue(X, mY));
+                ASSERTV(INLINE_CAPACITY, round, i, validStorage(X, oa));
+            }
+
+            mX.clear();
+            mY.clear();
+            ASSERTV(INLINE_CAPACITY, round, true == X.empty());
+            ASSERTV(INLINE_CAPACITY, round, validStorage(X, oa));
+        }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+        {
+            Vector mZ(&oa);  const Vector& Z = mZ;
+
+            for (int i = 0; i < static_cast<int>(2 * INLINE_CAPACITY); ++i) {
+                TYPE& element = mZ.emplace_back(makeValue<TYPE>(i));
+
+                ASSERTV(INLINE_CAPACITY, i, &element == &Z.back());
+                ASSERTV(INLINE_CAPACITY, i, makeValue<TYPE>(i) == element);
+            }
+        }
+#endif
+    }
+    ASSERTV(INLINE_CAPACITY, 0 == oa.numBlocksInUse());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void testRandomOperations()
+    // Test the insertion and erasure methods of
+    // 'bdlc::SmallVector<TYPE, INLINE_CAPACITY>' by applying a random
+    // sequence of operations to an object and to a 'bsl::vector', and
+    // comparing the results.
+{
+    typedef bdlc::SmallVector<TYPE, INLINE_CAPACITY> Vector;
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    {
+        Vector            mX(&oa);  const Vector& X = mX;
+        bsl::vector<TYPE> mY;
+
+        bsl::srand(static_cast<unsigned int>(INLINE_CAPACITY));
+        for (int i = 0; i < 4000; ++i) {
+            const int         size = static_cast<int>(mY.size());
+            const int         k    = bsl::rand() % 1000;
+            const int         pos  = bsl::rand() % (size + 1);
+            const int         op   = size > 40 ? 5 : bsl::rand() % 10;
+            const TYPE        VALUE = makeValue<TYPE>(k);
+
+            if (0 == op) {
+                typename Vector::iterator it = mX.insert(X.begin() + pos,
+                                                         VALUE);
+                mY.insert(mY.begin() + pos, VALUE);
+                ASSERTV(INLINE_CAPACITY, i, X.begin() + pos == it);
+            }
+            else if (1 == op) {
+                TYPE value(VALUE);
+
+                typename Vector::iterator it = mX.insert(
+                                           X.begin() + pos,
+                                           bslmf::MovableRefUtil::move(value));
+                mY.insert(mY.begin() + pos, VALUE);
+                ASSERTV(INLINE_CAPACITY, i, X.begin() + pos == it);
+            }
+            else if (2 == op) {
+                const bsl::size_t n = bsl::rand() % 6;
+
+                typename Vector::iterator it = mX.insert(X.begin() + pos,
+                                                         n,
+                                                         VALUE);
+                mY.insert(mY.begin() + pos, n, VALUE);
+                ASSERTV(INLINE_CAPACITY, i, X.begin() + pos == it);
+            }
+            else if (3 == op) {
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)
+                typename Vector::iterator it = mX.emplace(X.begin() + pos,
+                                                          VALUE);
+#else
+                typename Vector::iterator it = mX.insert(X.begin() + pos,
+                                                         VALUE);
+#endif
+                mY.insert(mY.begin() + pos, VALUE);
+                ASSERTV(INLINE_CAPACITY, i, X.begin() + pos == it);
+            }
+            else if (4 == op && 0 < size) {
+                // Insert a copy of an element of the object itself.
+
+                const int  j    = bsl::rand() % size;
+                const TYPE COPY = mY[j];
+
+                if (bsl::rand() % 2) {
+                    mX.insert(X.begin() + pos, X[j]);
+                    mY.insert(mY.begin() + pos, COPY);
+                }
+                else {
+                    mX.insert(X.begin() + pos, 2, X[j]);
+                    mY.insert(mY.begin() + pos, 2, COPY);
+                }
+            }
+            else if (5 == op && 0 < size) {
+                const int first = bsl::rand() % size;
+                const int last  = first + bsl::rand() % (size - first + 1);
+
+                typename Vector::iterator it = mX.erase(X.begin() + first,
+                                                        X.begin() + last);
+                mY.erase(mY.begin() + first, mY.begin() + last);
+                ASSERTV(INLINE_CAPACITY, i, X.begin() + first == it);
+            }
+            else if (6 == op && pos < size) {
+                typename Vector::iterator it = mX.erase(X.begin() + pos);
+                mY.erase(mY.begin() + pos);
+                ASSERTV(INLINE_CAPACITY, i, X.begin() + pos == it);
+            }
+            else if (7 == op && 0 < size) {
+                // Append a copy of an element of the object itself.
+
+                const int  j    = bsl::rand() % size;
+                const TYPE COPY = mY[j];
+
+                mX.push_back(X[j]);
+                mY.push_back(COPY);
+            }
+            else if (8 == op && 0 < size) {
+                mX.pop_back();
+                mY.pop_back();
+            }
+            else if (9 == op && 0 == k % 8) {
+                mX.clear();
+                mX.shrink_to_fit();
+                mY.clear();
+                ASSERTV(INLINE_CAPACITY, i, X.isInline());
+            }
+
+            ASSERTV(INLINE_CAPACITY, i, sameValue(X, mY));
+            ASSERTV(INLINE_CAPACITY, i, validStorage(X, oa));
+        }
+    }
+    ASSERTV(INLINE_CAPACITY, 0 == oa.numBlocksInUse());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void testCopyMoveSwap()
+    // Test the copy and move constructors and assignment operators, 'swap',
+    // and the comparison operators of
+    // 'bdlc::SmallVector<TYPE, INLINE_CAPACITY>', for objects of various
+    // sizes.
+{
+    typedef bdlc::SmallVector<TYPE, INLINE_CAPACITY> Vector;
+    typedef bslmf::MovableRefUtil                    MoveUtil;
+
+    const int MAX_SIZE = static_cast<int>(2 * INLINE_CAPACITY + 2);
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+    bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+    for (int n = 0; n <= MAX_SIZE; ++n) {
+        bsl::vector<TYPE> values;
+        for (int i = 0; i < n; ++i) {
+            values.push_back(makeValue<TYPE>(i));
+        }
+
+        Vector mX(values.begin(), values.end(), &oa);  const Vector& X = mX;
+        ASSERTV(INLINE_CAPACITY, n, sameValue(X, values));
+
+        // Copy construction.
+
+        Vector mY(X, &za);  const Vector& Y = mY;
+        ASSERTV(INLINE_CAPACITY, n, &za == Y.allocator());
+        ASSERTV(INLINE_CAPACITY, n, sameValue(Y, values));
+        ASSERTV(INLINE_CAPACITY, n, X == Y);
+        ASSERTV(INLINE_CAPACITY, n, !(X != Y));
+        ASSERTV(INLINE_CAPACITY, n, !(X < Y) && !(Y < X));
+
+        // Move construction, and move assignment, using the same allocator.
+
+        {
+            const bsls::Types::Int64 numAllocations = oa.numAllocations();
+            const TYPE              *data           = X.data();
+            const bool               isInline       = X.isInline();
+
+            Vector mZ(MoveUtil::move(mX));  const Vector& Z = mZ;
+            ASSERTV(INLINE_CAPACITY, n, numAllocations == oa.numAllocations());
+            ASSERTV(INLINE_CAPACITY, n, &oa == Z.allocator());
+            ASSERTV(INLINE_CAPACITY, n, sameValue(Z, values));
+            ASSERTV(INLINE_CAPACITY, n, isInline == (data != Z.data()));
+            ASSERTV(INLINE_CAPACITY, n, true == X.empty());
+            ASSERTV(INLINE_CAPACITY, n, true == X.isInline());
+
+            for (int m = 0; m <= MAX_SIZE; m += 3) {
+                Vector mW(&oa);  const Vector& W = mW;
+                for (int i = 0; i < m; ++i) {
+                    mW.push_back(makeValue<TYPE>(100 + i));
+                }
+
+                mW = MoveUtil::move(mZ);
+                ASSERTV(INLINE_CAPACITY, n, m, sameValue(W, values));
+                ASSERTV(INLINE_CAPACITY, n, m, true == Z.empty());
+
+                mZ = MoveUtil::move(mW);
+                ASSERTV(INLINE_CAPACITY, n, m, sameValue(Z, values));
+            }
+
+            mX = MoveUtil::move(mZ);
+            ASSERTV(INLINE_CAPACITY, n, sameValue(X, values));
+        }
+
+        // Move construction, and move assignment, using another allocator.
+
+        {
+            Vector mZ(MoveUtil::move(mY), &oa);  const Vector& Z = mZ;
+            ASSERTV(INLINE_CAPACITY, n, &oa == Z.allocator());
+            ASSERTV(INLINE_CAPACITY, n, sameValue(Z, values));
+
+            mY = MoveUtil::move(mZ);
+            ASSERTV(INLINE_CAPACITY, n, &za == Y.allocator());
+            ASSERTV(INLINE_CAPACITY, n, sameValue(Y, values));
+        }
+
+        // Copy assignment to objects of every size.
+
+        for (int m = 0; m <= MAX_SIZE; ++m) {
+            Vector mW(&oa);  const Vector& W = mW;
+            for (int i = 0; i < m; ++i) {
+                mW.push_back(makeValue<TYPE>(100 + i));
+            }
+            ASSERTV(INLINE_CAPACITY, n, m, (W == X) == (0 == n && 0 == m));
+            ASSERTV(INLINE_CAPACITY, n, m, (W < X) == (0 == m && 0 < n));
+
+            mW = X;
+            ASSERTV(INLINE_CAPACITY, n, m, sameValue(W, values));
+
+            mW = W;
+            ASSERTV(INLINE_CAPACITY, n, m, sameValue(W, values));
+
+            mW = Y;
+            ASSERTV(INLINE_CAPACITY, n, m, &oa == W.allocator());
+            ASSERTV(INLINE_CAPACITY, n, m, sameValue(W, values));
+        }
+
+        // Swap with objects of every size.
+
+        for (int m = 0; m <= MAX_SIZE; ++m) {
+            bsl::vector<TYPE> otherValues;
+            for (int i = 0; i < m; ++i) {
+                otherValues.push_back(makeValue<TYPE>(100 + i));
+            }
+
+            Vector mW(otherValues.begin(), otherValues.end(), &oa);
+            const Vector& W = mW;
+
+            mW.swap(mX);
+            ASSERTV(INLINE_CAPACITY, n, m, sameValue(W, values));
+            ASSERTV(INLINE_CAPACITY, n, m, sameValue(X, otherValues));
+
+            swap(mX, mW);
+            ASSERTV(INLINE_CAPACITY, n, m, sameValue(X, values));
+            ASSERTV(INLINE_CAPACITY, n, m, sameValue(W, otherValues));
+
+            swap(mY, mW);
+            ASSERTV(INLINE_CAPACITY, n, m, &za == Y.allocator());
+            ASSERTV(INLINE_CAPACITY, n, m, &oa == W.allocator());
+            ASSERTV(INLINE_CAPACITY, n, m, sameValue(Y, otherValues));
+            ASSERTV(INLINE_CAPACITY, n, m, sameValue(W, values));
+
+            swap(mY, mW);
+            ASSERTV(INLINE_CAPACITY, n, m, sameValue(Y, values));
+        }
+    }
+    ASSERTV(INLINE_CAPACITY, 0 == oa.numBlocksInUse());
+    ASSERTV(INLINE_CAPACITY, 0 == za.numBlocksInUse());
+}
+
+static unsigned int s_antiOptimization = 0;
+
+double toDouble(const bsls::TimeInterval& duration)
+    // Return the specified 'duration' in nanoseconds.
+{
+    return static_cast<double>(duration.totalNanoseconds());
+}
+
+template <class VECTOR>
+bsls::TimeInterval performanceBuild(const bsl::vector<int>& sizes)
+    // For each of the specified 'sizes', build an object of the (template
+    // parameter) type 'VECTOR' having that many elements, and consume its
+    // elements; repeat several times, and return the median duration of a
+    // pass over 'sizes'.
+{
+    const int NUM_TRIAL = 11;
+
+    bsl::vector<bsls::TimeInterval> results;
+    for (int trial = 0; trial < NUM_TRIAL; ++trial) {
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+        for (bsl::size_t i = 0; i < sizes.size(); ++i) {
+            VECTOR vector;
+
+            for (int j = 0; j < sizes[i]; ++j) {
+                vector.push_back(j);
+            }
+            for (typename VECTOR::const_iterator it = vector.begin();
+                                                   it != vector.end(); ++it) {
+                s_antiOptimization += *it;
+            }
+        }
+
+        results.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+    }
+
+    bsl::sort(results.begin(), results.end());
+
+    return results[NUM_TRIAL / 2];
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Collecting the Fills of an Order
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose an order-matching engine records the quantities with which each
+// incoming order is filled.  Almost every order is filled in at most a few
+// executions, so we hold the fills in a 'bdlc::SmallVector' having inline
+// storage for four of them.
+//
+// First, we define a function that matches an order for the specified
+// 'quantity' against resting orders of the specified 'restingQuantities',
+// recording each fill in the specified 'fills':
+//..
+    void matchOrder(bdlc::SmallVector<int, 4> *fills,
+                    int                        quantity,
+                    const int                 *restingQuantities,
+                    int                        numResting)
+        // Fill the specified 'quantity' against the specified 'numResting'
+        // resting orders of the specified 'restingQuantities', in order, and
+        // append the quantity of each fill to the specified 'fills'.
+    {
+        for (int i = 0; 0 < quantity && i < numResting; ++i) {
+            const int fill = bsl::min(quantity, restingQuantities[i]);
+
+            fills->push_back(fill);
+            quantity -= fill;
+        }
+    }
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we match an order that is filled in three executions, and observe
+// that no memory is allocated:
+//..
+    bslma::TestAllocator      ta;
+    bdlc::SmallVector<int, 4> fills(&ta);
+
+    const int RESTING[] = { 100, 200, 300, 400, 500, 600 };
+
+    matchOrder(&fills, 500, RESTING, 6);
+
+    ASSERT(3    == fills.size());
+    ASSERT(200  == fills[1]);
+    ASSERT(true == fills.isInline());
+    ASSERT(0    == ta.numAllocations());
+//..
+// Finally, we match a large order that sweeps the book, and observe that the
+// fills have moved to memory supplied by the allocator:
+//..
+    fills.clear();
+    matchOrder(&fills, 2000, RESTING, 6);
+
+    ASSERT(6     == fills.size());
+    ASSERT(false == fills.isInline());
+    ASSERT(1     == ta.numBlocksInUse());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CAPACITY MANIPULATORS, 'assign', 'at', AND SIZED CONSTRUCTORS
+        //
+        // Concerns:
+        //: 1 The sized constructors create an object holding the specified
+        //:   number of default-constructed or copied elements, allocating
+        //:   exactly when that number exceeds the inline capacity.
+        //:
+        //: 2 'resize' grows or shrinks the object as 'bsl::vector' would.
+        //:
+        //: 3 'reserve' allocates only to grow the capacity, and
+        //:   'shrink_to_fit' releases unneeded capacity, returning the
+        //:   elements to the inline storage when they fit there.
+        //:
+        //: 4 'assign' replaces the elements of the object, reusing its
+        //:   storage.
+        //:
+        //: 5 'at' returns the element at a valid position, and throws
+        //:   'std::out_of_range' otherwise.
+        //:
+        //: 6 'max_size' bounds the size of the object, and a request to grow
+        //:   beyond it throws 'std::length_error'.
+        //:
+        //: 7 The growing manipulators are exception-neutral, and leave the
+        //:   object unchanged if an exception is thrown while appending.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create objects using the sized constructors for a range of
+        //:   sizes, and verify their values and memory use.  (C-1)
+        //:
+        //: 2 For a range of initial and final sizes, 'resize' an object and a
+        //:   'bsl::vector', with and without a value, and compare them.  (C-2)
+        //:
+        //: 3 'reserve' and 'shrink_to_fit' objects of a range of sizes, and
+        //:   verify their capacity, 'isInline', and memory use.  (C-3)
+        //:
+        //: 4 'assign' values of a range of sizes to objects of a range of
+        //:   sizes, and compare them against 'bsl::vector'.  (C-4)
+        //:
+        //: 5 Call 'at' at every position of an object and one past its end.
+        //:   (C-5)
+        //:
+        //: 6 Verify 'max_size', and that 'reserve' beyond it throws.  (C-6)
+        //:
+        //: 7 Use 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' to inject allocation
+        //:   failures into 'push_back', 'insert' at the end, 'reserve', and
+        //:   'resize' as the object moves to allocated storage, and verify
+        //:   that the object is unchanged by a failed operation.  (C-7)
+        //:
+        //: 8 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-8)
+        //
+        // Testing:
+        //   SmallVector(size_t numElements, bslma::Allocator * = 0);
+        //   SmallVector(size_t n, const TYPE& value, bslma::Allocator * = 0);
+        //   void assign(size_t numElements, const TYPE& value);
+        //   reference at(size_t position);
+        //   void reserve(size_t numElements);
+        //   void resize(size_t numElements);
+        //   void resize(size_t numElements, const TYPE& value);
+        //   void shrink_to_fit();
+        //   const_reference at(size_t position) const;
+        //   size_t max_size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "CAPACITY MANIPULATORS, 'assign', 'at', AND SIZED CTORS"
+                 << endl
+                 << "======================================================"
+                 << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const bsl::string VALUE = makeValue<bsl::string>(7);
+
+        if (verbose) cout << "\nTesting sized constructors." << endl;
+        {
+            for (int n = 0; n < 12; ++n) {
+                const bsl::size_t N = n;
+                {
+                    Obj mX(N, &oa);  const Obj& X = mX;
+
+                    ASSERTV(n, sameValue(X, Model(N)));
+                    ASSERTV(n, (N <= 4) == X.isInline());
+                    ASSERTV(n, (N <= 4 ? 0 : 1) == oa.numBlocksInUse());
+                }
+                {
+                    Obj mX(N, VALUE, &oa);  const Obj& X = mX;
+
+                    ASSERTV(n, sameValue(X, Model(N, VALUE)));
+                    ASSERTV(n, validStorage(X, oa));
+                }
+                ASSERTV(n, 0 == oa.numBlocksInUse());
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'resize'." << endl;
+        {
+            for (int n = 0; n < 12; ++n) {
+                for (int m = 0; m < 12; ++m) {
+                    {
+                        Obj   mX(n, VALUE, &oa);  const Obj& X = mX;
+                        Model mY(n, VALUE);
+
+                        mX.resize(m);
+                        mY.resize(m);
+                        ASSERTV(n, m, sameValue(X, mY));
+                        ASSERTV(n, m, (bsl::max(n, m) <= 4) == X.isInline());
+                    }
+                    {
+                        Obj   mX(n, VALUE, &oa);  const Obj& X = mX;
+                        Model mY(n, VALUE);
+
+                        const bsl::string OTHER = makeValue<bsl::string>(9);
+
+                        mX.resize(m, OTHER);
+                        mY.resize(m, OTHER);
+                        ASSERTV(n, m, sameValue(X, mY));
+                        ASSERTV(n, m, validStorage(X, oa));
+                    }
+                }
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting 'reserve' and 'shrink_to_fit'."
+                          << endl;
+        {
+            for (int n = 0; n < 12; ++n) {
+                for (int m = 0; m < 12; ++m) {
+                    Obj mX(n, VALUE, &oa);  const Obj& X = mX;
+
+                    const bsl::size_t capacity = X.capacity();
+                    const Model       EXP(n, VALUE);
+
+                    mX.reserve(m);
+                    ASSERTV(n, m, sameValue(X, EXP));
+                    ASSERTV(n, m, validStorage(X, oa));
+                    ASSERTV(n, m, bsl::max<bsl::size_t>(capacity, m) ==
+                                                                X.capacity());
+
+                    mX.shrink_to_fit();
+                    ASSERTV(n, m, sameValue(X, EXP));
+                    ASSERTV(n, m, validStorage(X, oa));
+                    ASSERTV(n, m, (n <= 4) == X.isInline());
+                    ASSERTV(n, m, bsl::max<bsl::size_t>(4, n) ==
+                                                                X.capacity());
+                }
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting 'assign'." << endl;
+        {
+            for (int n = 0; n < 12; ++n) {
+                for (int m = 0; m < 12; ++m) {
+                    Obj mX(n, VALUE, &oa);  const Obj& X = mX;
+
+                    const bsl::string OTHER = makeValue<bsl::string>(9);
+
+                    mX.assign(m, OTHER);
+                    ASSERTV(n, m, sameValue(X, Model(m, OTHER)));
+                    ASSERTV(n, m, validStorage(X, oa));
+                    ASSERTV(n, m, bsl::max(n, m) <= 4 || !X.isInline());
+                }
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting 'at' and 'max_size'." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 6; ++i) {
+                mX.push_back(makeValue<bsl::string>(i));
+            }
+            for (bsl::size_t i = 0; i < X.size(); ++i) {
+                ASSERTV(i, &X[i] == &X.at(i));
+                ASSERTV(i, &mX[i] == &mX.at(i));
+            }
+
+            ASSERT(0 < X.max_size());
+            ASSERT(X.max_size() <=
+                          bsl::numeric_limits<bsl::size_t>::max() /
+                                                        sizeof(bsl::string));
+
+#if defined(BDE_BUILD_TARGET_EXC)
+            bool caught = false;
+            try {
+                X.at(X.size());
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                mX.at(X.size());
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                mX.reserve(X.max_size() + 1);
+            }
+            catch (const std::length_error&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(6 == X.size());
+#endif
+        }
+
+        if (verbose) cout << "\nTesting exception neutrality." << endl;
+        {
+            for (int n = 0; n < 7; ++n) {
+                Model source;
+                for (int i = 0; i < n; ++i) {
+                    source.push_back(makeValue<bsl::string>(i));
+                }
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    Obj   mX(source.begin(), source.end(), &oa);
+                    const Obj& X = mX;
+                    Model mY(source);
+
+                    ExceptionGuard<Obj> guard(&X, L_);
+
+                    mX.push_back(VALUE);
+                    mY.push_back(VALUE);
+                    ASSERTV(n, sameValue(X, mY));
+
+                    guard.resetValue(&X, L_);
+
+                    mX.insert(X.end(), 3, VALUE);
+                    mY.insert(mY.end(), 3, VALUE);
+                    ASSERTV(n, sameValue(X, mY));
+
+                    guard.resetValue(&X, L_);
+
+                    mX.reserve(X.size() + 5);
+                    ASSERTV(n, X.size() + 5 <= X.capacity());
+
+                    guard.resetValue(&X, L_);
+
+                    const bsl::size_t newSize = X.capacity() + 2;
+
+                    mX.resize(newSize, VALUE);
+                    mY.resize(newSize, VALUE);
+                    ASSERTV(n, sameValue(X, mY));
+
+                    guard.release();
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT_SAFE_FAIL(X.front());
+            ASSERT_SAFE_FAIL(mX.front());
+            ASSERT_SAFE_FAIL(X.back());
+            ASSERT_SAFE_FAIL(mX.back());
+            ASSERT_SAFE_FAIL(mX.pop_back());
+            ASSERT_SAFE_FAIL(X[0]);
+            ASSERT_SAFE_FAIL(mX[0]);
+
+            mX.push_back(VALUE);
+
+            ASSERT_SAFE_PASS(X.front());
+            ASSERT_SAFE_PASS(X.back());
+            ASSERT_SAFE_PASS(X[0]);
+            ASSERT_SAFE_FAIL(X[1]);
+            ASSERT_SAFE_FAIL(mX.erase(X.end()));
+            ASSERT_SAFE_FAIL(mX.erase(X.end(), X.begin()));
+            ASSERT_SAFE_PASS(mX.erase(X.begin(), X.end()));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, COMPARISON, AND TRAITS
+        //
+        // Concerns:
+        //: 1 The copy constructor creates an object having the value of the
+        //:   original, using the specified or default allocator.
+        //:
+        //: 2 The move constructor without an allocator takes the allocated
+        //:   storage of the original without allocating, moves inline
+        //:   elements, and leaves the original empty and inline.
+        //:
+        //: 3 The move constructor with a different allocator copies the
+        //:   elements into storage from that allocator.
+        //:
+        //: 4 The copy and move assignment operators give the object the value
+        //:   of the source, keep the allocator of the object, and handle
+        //:   self-assignment and every combination of inline and allocated
+        //:   storage.
+        //:
+        //: 5 'swap' exchanges the values of two objects in every combination
+        //:   of inline and allocated storage, and the free 'swap' also
+        //:   handles objects using different allocators.
+        //:
+        //: 6 'operator==', 'operator!=', and 'operator<' compare the
+        //:   sequences of elements lexicographically.
+        //:
+        //: 7 The class declares the 'bslma::UsesBslmaAllocator' and
+        //:   'bslalg::HasStlIterators' traits.
+        //
+        // Plan:
+        //: 1 For objects of every size up to twice the inline capacity, and
+        //:   for 'bsl::string', 'SelfRef', and 'int' elements, exercise every
+        //:   copy, move, and swap operation against objects of every size,
+        //:   and verify the values and allocators of the results.  (C-1..6)
+        //:
+        //: 2 Use 'BSLMF_ASSERT' to verify the traits.  (C-7)
+        //
+        // Testing:
+        //   SmallVector(const SmallVector&, bslma::Allocator * = 0);
+        //   SmallVector(MovableRef<SmallVector>);
+        //   SmallVector(MovableRef<SmallVector>, bslma::Allocator *);
+        //   SmallVector& operator=(const SmallVector& rhs);
+        //   SmallVector& operator=(MovableRef<SmallVector> rhs);
+        //   void swap(SmallVector& other);
+        //   bool operator==(const SmallVector&, const SmallVector&);
+        //   bool operator!=(const SmallVector&, const SmallVector&);
+        //   bool operator<(const SmallVector&, const SmallVector&);
+        //   void swap(SmallVector& a, SmallVector& b);
+        //   CONCERN: The type traits are set correctly.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, MOVE, SWAP, COMPARISON, AND TRAITS"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        BSLMF_ASSERT(bslalg::HasStlIterators<Obj>::value);
+
+        testCopyMoveSwap<bsl::string, 1>();
+        testCopyMoveSwap<bsl::string, 4>();
+        testCopyMoveSwap<SelfRef,     3>();
+        testCopyMoveSwap<int,         8>();
+
+        ASSERT(0 == SelfRef::count());
+
+        if (verbose) cout << "\nTesting the default allocator." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < 6; ++i) {
+                mX.push_back(makeValue<bsl::string>(i));
+            }
+
+            Obj mY(X);  const Obj& Y = mY;
+            ASSERT(&defaultAllocator == Y.allocator());
+            ASSERT(X == Y);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // RANGES AND INITIALIZER LISTS
+        //
+        // Concerns:
+        //: 1 The range constructor, 'assign', and 'insert' accept input,
+        //:   forward, bidirectional, and random-access iterators, and give
+        //:   the same result for each.
+        //:
+        //: 2 A pair of integral arguments is treated as a size and a value,
+        //:   not as a range.
+        //:
+        //: 3 The overloads taking an initializer list behave as the
+        //:   corresponding range overloads.
+        //
+        // Plan:
+        //: 1 For ranges of a range of lengths drawn from a 'bsl::vector' and
+        //:   a 'bsl::list', and through an input-iterator adaptor, construct,
+        //:   assign, and insert at every position of objects of a range of
+        //:   sizes, and compare the results against 'bsl::vector'.  (C-1)
+        //:
+        //: 2 Construct, assign, and insert using pairs of 'int' arguments,
+        //:   and verify the results.  (C-2)
+        //:
+        //: 3 Use initializer lists, and verify the results.  (C-3)
+        //
+        // Testing:
+        //   SmallVector(II first, II last, bslma::Allocator * = 0);
+        //   SmallVector(initializer_list<TYPE>, bslma::Allocator * = 0);
+        //   SmallVector& operator=(initializer_list<TYPE> values);
+        //   void assign(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void assign(initializer_list<TYPE> values);
+        //   iterator insert(const_iterator pos, II first, II last);
+        //   iterator insert(const_iterator, initializer_list<TYPE>);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RANGES AND INITIALIZER LISTS" << endl
+                          << "============================" << endl;
+
+        typedef bsl::list<bsl::string>             List;
+        typedef InputIterator<Model::const_iterator> InputIter;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nTesting ranges." << endl;
+        {
+            for (int n = 0; n < 10; ++n) {
+                Model source;
+                for (int i = 0; i < n; ++i) {
+                    source.push_back(makeValue<bsl::string>(100 + i));
+                }
+                const List SOURCE_LIST(source.begin(), source.end());
+
+                {
+                    Obj mX(source.begin(), source.end(), &oa);
+                    Obj mY(SOURCE_LIST.begin(), SOURCE_LIST.end(), &oa);
+                    Obj mZ(InputIter(source.begin()),
+                           InputIter(source.end()),
+                           &oa);
+
+                    ASSERTV(n, sameValue(mX, source));
+                    ASSERTV(n, sameValue(mY, source));
+                    ASSERTV(n, sameValue(mZ, source));
+                    ASSERTV(n, (n <= 4) == mX.isInline());
+                }
+
+                for (int m = 0; m < 10; ++m) {
+                    Model initial;
+                    for (int i = 0; i < m; ++i) {
+                        initial.push_back(makeValue<bsl::string>(i));
+                    }
+
+                    for (int k = 0; k < 3; ++k) {
+                        Obj mX(initial.begin(), initial.end(), &oa);
+                        const Obj& X = mX;
+
+                        if (0 == k) {
+                            mX.assign(source.begin(), source.end());
+                        }
+                        else if (1 == k) {
+                            mX.assign(SOURCE_LIST.begin(), SOURCE_LIST.end());
+                        }
+                        else {
+                            mX.assign(InputIter(source.begin()),
+                                      InputIter(source.end()));
+                        }
+                        ASSERTV(n, m, k, sameValue(X, source));
+                        ASSERTV(n, m, k, validStorage(X, oa));
+                    }
+
+                    for (int pos = 0; pos <= m; ++pos) {
+                        Model exp(initial);
+                        exp.insert(exp.begin() + pos,
+                                   source.begin(),
+                                   source.end());
+
+                        for (int k = 0; k < 3; ++k) {
+                            Obj mX(initial.begin(), initial.end(), &oa);
+                            const Obj& X = mX;
+
+                            Obj::iterator it;
+                            if (0 == k) {
+                                it = mX.insert(X.begin() + pos,
+                                               source.begin(),
+                                               source.end());
+                            }
+                            else if (1 == k) {
+                                it = mX.insert(X.begin() + pos,
+                                               SOURCE_LIST.begin(),
+                                               SOURCE_LIST.end());
+                            }
+                            else {
+                                it = mX.insert(X.begin() + pos,
+                                               InputIter(source.begin()),
+                                               InputIter(source.end()));
+                            }
+                            ASSERTV(n, m, pos, k, X.begin() + pos == it);
+                            ASSERTV(n, m, pos, k, sameValue(X, exp));
+                            ASSERTV(n, m, pos, k, validStorage(X, oa));
+                        }
+                    }
+                }
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting integral arguments." << endl;
+        {
+            typedef bdlc::SmallVector<int, 4> IntVector;
+
+            IntVector mX(5, 7, &oa);  const IntVector& X = mX;
+            ASSERT(5 == X.size());
+            ASSERT(7 == X[0]);
+            ASSERT(7 == X[4]);
+
+            mX.assign(3, 9);
+            ASSERT(3 == X.size());
+            ASSERT(9 == X[2]);
+
+            mX.insert(X.begin(), 2, 1);
+            ASSERT(5 == X.size());
+            ASSERT(1 == X[0]);
+            ASSERT(1 == X[1]);
+            ASSERT(9 == X[2]);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        if (verbose) cout << "\nTesting initializer lists." << endl;
+        {
+            typedef bdlc::SmallVector<int, 4> IntVector;
+
+            IntVector mX({ 1, 2, 3, 4, 5 }, &oa);  const IntVector& X = mX;
+            ASSERT(5     == X.size());
+            ASSERT(5     == X.back());
+            ASSERT(false == X.isInline());
+
+            mX = { 6, 7 };
+            ASSERT(2 == X.size());
+            ASSERT(6 == X.front());
+
+            mX.assign({ 8, 9, 10 });
+            ASSERT(3  == X.size());
+            ASSERT(10 == X.back());
+
+            IntVector::iterator it = mX.insert(X.begin() + 1, { 11, 12 });
+            ASSERT(X.begin() + 1 == it);
+            ASSERT(5             == X.size());
+            ASSERT(8             == X[0]);
+            ASSERT(11            == X[1]);
+            ASSERT(12            == X[2]);
+            ASSERT(9             == X[3]);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+#endif
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INSERTION AND ERASURE
+        //
+        // Concerns:
+        //: 1 Each insertion method inserts the specified elements at the
+        //:   specified position, and returns an iterator to the first of
+        //:   them, whether or not the object moves to allocated storage.
+        //:
+        //: 2 An element of the object itself may be inserted.
+        //:
+        //: 3 Each erasure method removes the specified elements and returns
+        //:   an iterator to the position following them.
+        //:
+        //: 4 Elements that are not bitwise-movable are moved using their copy
+        //:   or move constructors.
+        //
+        // Plan:
+        //: 1 For a range of inline capacities, and for 'bsl::string',
+        //:   'SelfRef', and 'int' elements, apply a long random sequence of
+        //:   insertions and erasures to an object and to a 'bsl::vector',
+        //:   and compare them after each operation.  (C-1..4)
+        //
+        // Testing:
+        //   iterator emplace(const_iterator position, ARGS&&... args);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   iterator insert(const_iterator position, const TYPE& value);
+        //   iterator insert(const_iterator position, MovableRef<TYPE> value);
+        //   iterator insert(const_iterator pos, size_t n, const TYPE& value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INSERTION AND ERASURE" << endl
+                          << "=====================" << endl;
+
+        testRandomOperations<bsl::string,  1>();
+        testRandomOperations<bsl::string,  4>();
+        testRandomOperations<bsl::string, 16>();
+        testRandomOperations<SelfRef,      1>();
+        testRandomOperations<SelfRef,      5>();
+        testRandomOperations<int,          1>();
+        testRandomOperations<int,          8>();
+
+        ASSERT(0 == SelfRef::count());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed object is empty, holds its elements
+        //:   inline, has a capacity of the inline capacity, and uses the
+        //:   specified allocator, or the default allocator if none is
+        //:   specified.
+        //:
+        //: 2 'push_back' appends the specified element, without allocating
+        //:   while the elements fit inline, and with a single allocation per
+        //:   growth of the capacity thereafter.
+        //:
+        //: 3 'pop_back' and 'clear' remove elements without releasing the
+        //:   capacity of the object.
+        //:
+        //: 4 The accessors and iterators refer to the elements of the object,
+        //:   wherever those are stored.
+        //:
+        //: 5 The elements are created using the allocator of the object.
+        //:
+        //: 6 The destructor releases all memory.
+        //
+        // Plan:
+        //: 1 For a range of inline capacities, and for 'bsl::string',
+        //:   'SelfRef', and 'int' elements, repeatedly 'push_back' elements
+        //:   past the inline capacity, verifying all accessors against a
+        //:   'bsl::vector' after each, then 'pop_back' and 'clear' them,
+        //:   checking the memory use of the object throughout.  (C-1..6)
+        //:
+        //: 2 Default-construct an object without an allocator, and verify
+        //:   that it uses the default allocator.  (C-1)
+        //
+        // Testing:
+        //   SmallVector(bslma::Allocator *basicAllocator);
+        //   ~SmallVector();
+        //   reference operator[](size_t position);
+        //   reference back();
+        //   void clear();
+        //   TYPE *data();
+        //   reference emplace_back(ARGS&&... args);
+        //   reference front();
+        //   void pop_back();
+        //   void push_back(const TYPE& value);
+        //   void push_back(MovableRef<TYPE> value);
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   const_reference operator[](size_t position) const;
+        //   const_reference back() const;
+        //   size_t capacity() const;
+        //   const TYPE *data() const;
+        //   bool empty() const;
+        //   const_reference front() const;
+        //   bool isInline() const;
+        //   size_t size() const;
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        testPrimaryManipulators<bsl::string,  1>();
+        testPrimaryManipulators<bsl::string,  2>();
+        testPrimaryManipulators<bsl::string,  4>();
+        testPrimaryManipulators<bsl::string, 11>();
+        testPrimaryManipulators<SelfRef,      1>();
+        testPrimaryManipulators<SelfRef,      3>();
+        testPrimaryManipulators<int,          1>();
+        testPrimaryManipulators<int,          8>();
+
+        ASSERT(0 == SelfRef::count());
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(0                 == defaultAllocator.numBlocksInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, add elements past its inline capacity, and
+        //:   remove them, verifying its state throughout.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            bdlc::SmallVector<int, 2> mX(&oa);
+            const bdlc::SmallVector<int, 2>& X = mX;
+
+            ASSERT(0    == X.size());
+            ASSERT(2    == X.capacity());
+            ASSERT(true == X.isInline());
+
+            mX.push_back(1);
+            mX.push_back(2);
+            ASSERT(2    == X.size());
+            ASSERT(true == X.isInline());
+            ASSERT(0    == oa.numAllocations());
+
+            mX.push_back(3);
+            ASSERT(3     == X.size());
+            ASSERT(false == X.isInline());
+            ASSERT(1     == oa.numBlocksInUse());
+            ASSERT(1 == X[0]);
+            ASSERT(2 == X[1]);
+            ASSERT(3 == X[2]);
+
+            mX.erase(X.begin());
+            ASSERT(2 == X.size());
+            ASSERT(2 == X.front());
+
+            mX.shrink_to_fit();
+            ASSERT(true == X.isInline());
+            ASSERT(0    == oa.numBlocksInUse());
+            ASSERT(3    == X.back());
+
+            bdlc::SmallVector<int, 2> mY(X, &oa);
+            ASSERT(X == mY);
+
+            mY.insert(mY.begin(), 0);
+            ASSERT(X != mY);
+            ASSERT(mY < X);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Compare the time taken to build many small sequences in a
+        //   'bdlc::SmallVector' against that taken using a 'bsl::vector'.
+        //
+        // Concerns:
+        //: 1 A 'bdlc::SmallVector' holding no more than its inline capacity is
+        //:   substantially faster to build than a 'bsl::vector', since it
+        //:   does not allocate.
+        //
+        // Plan:
+        //: 1 Build the same sequences, of sizes uniformly distributed from 0
+        //:   to the inline capacity, in both containers, using the new-delete
+        //:   allocator as the default, and report the median times.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        bslma::NewDeleteAllocator       nda;
+        bslma::DefaultAllocatorGuard    guard(&nda);
+
+        const int NUM_VECTORS = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        bsl::vector<int> sizes;
+        bsl::srand(1);
+        for (int i = 0; i < NUM_VECTORS; ++i) {
+            sizes.push_back(bsl::rand() % 9);
+        }
+
+        const double smallTime = toDouble(
+                performanceBuild<bdlc::SmallVector<int, 8> >(sizes));
+        const double vectorTime = toDouble(
+                performanceBuild<bsl::vector<int> >(sizes));
+
+        cout << "bdlc::SmallVector<int, 8>: "
+             << smallTime / NUM_VECTORS << " ns per vector" << endl
+             << "bsl::vector<int>         : "
+             << vectorTime / NUM_VECTORS << " ns per vector" << endl
+             << "bdlc::SmallVector is "
+             << 100.0 * (vectorTime - smallTime) / vectorTime
+             << "% faster" << endl;
+
+        if (veryVerbose) {
+            P(s_antiOptimization);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -4,9 +4,9 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdldfp_decimalimputil_cpp,"$Id$ $CSID$")
 
+#include <bdldfp_decimalimputil_bid64.h>
 #include <bdldfp_uint128.h>
 
-#include <bsl_cstdio.h>
 #include <bsl_cstring.h>
 
 #include <bsls_performancehint.h>
@@ -154,53 +154,60 @@ int print(char *b, char *e, T value)
     return static_cast<int>(e - i);
 }
 
-template <class DECIMAL>
-int formatFixed(char                      *buffer,
-                int                        length,
-                DECIMAL                    value,
-                const DecimalFormatConfig& cfg)
-    // Convert the specified decimal 'value' to character string using
-    // 'e_FIXED' style and the specified 'cfg' formatting options.  Load the
-    // result into the specified 'buffer'.  If the length of resultant string
-    // exceeds the specified 'length', then the 'buffer' will be left in an
-    // unspecified state, with the returned value indicating the necessary
-    // size.  The behavior is undefined if the 'length' is negative and
-    // 'buffer' is not null.  The 'buffer' is permitted to be null if the
-    // 'length' is not  positive.  This can be used to determine the necessary
-    // buffer size.
+int printExponent(char *buffer, int exponent, int width)
+    // Load into the specified 'buffer' the sign of the specified 'exponent'
+    // followed by its absolute value, padded with leading zeros to at least
+    // the specified 'width' digits, and return the number of characters
+    // written (i.e., format 'exponent' as 'sprintf' would format it using
+    // "%+.*d" with a precision of 'width').  The behavior is undefined unless
+    // '1 <= width <= 4' and 'buffer' has room for the result.
 {
-    BSLS_ASSERT(buffer || length < 0);
+    BSLS_ASSERT(1 <= width);
+    BSLS_ASSERT(width <= 4);
 
-    typedef typename DecimalTraits<DECIMAL>::Significand SIGNIFICAND;
+    *buffer = exponent < 0 ? '-' : '+';
 
-    const DECIMAL k_ZERO = DecimalTraits<DECIMAL>::int32ToDecimal(0);
-
-    if (DecimalImpUtil::notEqual(value, k_ZERO)) {
-        value = DecimalImpUtil::round(value, cfg.precision());
-    }
+    unsigned int magnitude = exponent < 0
+                           ? 0u - static_cast<unsigned int>(exponent)
+                           : static_cast<unsigned int>(exponent);
 
-    int          sign;
-    SIGNIFICAND  s;
-    int          exponent;
-    int          cls = DecimalImpUtil::decompose(&sign, &s, &exponent, value);
-
-    BSLS_ASSERT(cls == FP_ZERO   ||
-                cls == FP_NORMAL ||
-                cls == FP_SUBNORMAL);
+    char  digits[10];
+    char *digitsEnd = digits + sizeof digits;
+    char *i         = digitsEnd;
+    do {
+        *--i = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (0 != magnitude);
 
-    (void)cls;
+    while (digitsEnd - i < width) {
+        *--i = '0';
+    }
 
-    const int k_MAX_DIGITS = DecimalTraits<DECIMAL>::k_MAX_DIGITS;
+    bsl::copy(i, digitsEnd, buffer + 1);
 
-    char significand[k_MAX_DIGITS] = { 0 };
-    int  len = print(&significand[0],
-                     &significand[k_MAX_DIGITS],
-                     s);
+    return static_cast<int>(digitsEnd - i) + 1;
+}
 
-    int pointPos     = (s != 0) ? len + exponent : 0;
+int printFixed(char                      *buffer,
+               int                        length,
+               const char                *significand,
+               int                        len,
+               int                        pointPos,
+               int                        precision,
+               const DecimalFormatConfig& cfg)
+    // Write the specified 'len' digits of the specified 'significand', having
+    // the decimal point after the specified 'pointPos' digits, to the buffer
+    // specified by 'buffer' and 'length' using 'e_FIXED' style with the
+    // specified 'precision' digits after the decimal point and the specified
+    // 'cfg' formatting options, and return the length of the result.  If the
+    // result is longer than 'length', the buffer is not modified.  Note that
+    // the digits of 'significand' after the first 'precision' digits
+    // following the decimal point are not written (i.e., 'significand' is
+    // expected to have been rounded to 'precision').
+{
     int outputLength = static_cast<int>(
         (pointPos > 0 ? pointPos : sizeof('0')) +
-        (cfg.precision() > 0 || cfg.showpoint()) + cfg.precision());
+        (precision > 0 || cfg.showpoint()) + precision);
 
     if (outputLength <= length) {
 
@@ -224,17 +231,17 @@ int formatFixed(char                      *buffer,
             }
         }
 
-        if (cfg.precision() || cfg.showpoint()) {
+        if (precision || cfg.showpoint()) {
             *oi++ = cfg.decimalPoint();
         }
 
-        if (cfg.precision()) {
+        if (precision) {
             const char *end = bsl::min(oi - pointPos, oe);
             while (oi < end) {
                 *oi++ = '0';
             }
 
-            end = bsl::min(ii + pointPos + cfg.precision(), ie);
+            end = bsl::min(ii + pointPos + precision, ie);
             if (ii < end) {
                 oi = bsl::copy(ii, end, oi);
             }
@@ -248,6 +255,116 @@ int formatFixed(char                      *buffer,
     return outputLength;
 }
 
+int printScientific(char                      *buffer,
+                    int                        length,
+                    const char                *significand,
+                    int                        len,
+                    int                        exponent,
+                    int                        precision,
+                    const DecimalFormatConfig& cfg)
+    // Write the specified 'len' digits of the specified 'significand',
+    // multiplied by 10 raised to the power of the specified 'exponent' less
+    // 'len - 1', to the buffer specified by 'buffer' and 'length' using
+    // 'e_SCIENTIFIC' style with the specified 'precision' digits after the
+    // decimal point and the specified 'cfg' formatting options, and return
+    // the length of the result.  If the result is longer than 'length', the
+    // buffer is not modified.  Note that the digits of 'significand' after
+    // the first 'precision + 1' digits are not written (i.e., 'significand'
+    // is expected to have been rounded to 'precision').
+{
+    const int k_MAX_EXPONENT_LENGTH = 6;
+    char      exp[k_MAX_EXPONENT_LENGTH];
+    int       exponentLength = printExponent(&exp[0],
+                                             exponent,
+                                             cfg.expWidth());
+
+    int outputLength = 1 + (precision > 0 || cfg.showpoint()) +
+                       precision + static_cast<int>(sizeof 'E') +
+                       exponentLength;
+
+    char *i = buffer;
+
+    if (outputLength <= length) {
+
+        const char *j = significand;
+        const char *e = significand + len;
+
+        *i++ = *j++;
+
+        if (precision || cfg.showpoint()) {
+            *i++ = cfg.decimalPoint();
+        }
+
+        if (precision) {
+            const char *end = bsl::min(j + precision, e);
+            if (j <= end) {
+                i = bsl::copy(j, end, i);
+                if (end == e) {
+                    long int n = bsl::distance(e, j + precision);
+                    bsl::fill_n(i, n, '0');
+                    i += n;
+                }
+            }
+        }
+        *i++ = cfg.exponent();
+        i    = bsl::copy(&exp[0], &exp[0] + exponentLength, i);
+    }
+
+    return outputLength;
+}
+
+template <class DECIMAL>
+int formatFixed(char                      *buffer,
+                int                        length,
+                DECIMAL                    value,
+                const DecimalFormatConfig& cfg)
+    // Convert the specified decimal 'value' to character string using
+    // 'e_FIXED' style and the specified 'cfg' formatting options.  Load the
+    // result into the specified 'buffer'.  If the length of resultant string
+    // exceeds the specified 'length', then the 'buffer' will be left in an
+    // unspecified state, with the returned value indicating the necessary
+    // size.  The behavior is undefined if the 'length' is negative and
+    // 'buffer' is not null.  The 'buffer' is permitted to be null if the
+    // 'length' is not  positive.  This can be used to determine the necessary
+    // buffer size.
+{
+    BSLS_ASSERT(buffer || length < 0);
+
+    typedef typename DecimalTraits<DECIMAL>::Significand SIGNIFICAND;
+
+    const DECIMAL k_ZERO = DecimalTraits<DECIMAL>::int32ToDecimal(0);
+
+    if (DecimalImpUtil::notEqual(value, k_ZERO)) {
+        value = DecimalImpUtil::round(value, cfg.precision());
+    }
+
+    int          sign;
+    SIGNIFICAND  s;
+    int          exponent;
+    int          cls = DecimalImpUtil::decompose(&sign, &s, &exponent, value);
+
+    BSLS_ASSERT(cls == FP_ZERO   ||
+                cls == FP_NORMAL ||
+                cls == FP_SUBNORMAL);
+
+    (void)cls;
+
+    const int k_MAX_DIGITS = DecimalTraits<DECIMAL>::k_MAX_DIGITS;
+
+    char significand[k_MAX_DIGITS] = { 0 };
+    int  len = print(&significand[0],
+                     &significand[k_MAX_DIGITS],
+                     s);
+
+    return printFixed(buffer,
+                      length,
+                      significand,
+                      len,
+                      (s != 0) ? len + exponent : 0,
+                      cfg.precision(),
+                      cfg);
+}
+
 template <class DECIMAL>
 int formatScientific(char                      *buffer,
                      int                        length,
@@ -304,46 +421,13 @@ int formatScientific(char                      *buffer,
                      &significand[k_MAX_DIGITS],
                      s);
 
-    exponent += len - 1;
-
-    const int k_MAX_EXPONENT_LENGTH = 6;
-    char      exp[k_MAX_EXPONENT_LENGTH];
-    int       exponentLength =
-        bsl::sprintf(&exp[0], "%+.*d", cfg.expWidth(), exponent);
-
-    int outputLength = 1 + (cfg.precision() > 0 || cfg.showpoint()) +
-                       cfg.precision() + static_cast<int>(sizeof 'E') +
-                       exponentLength;
-
-    char *i = buffer;
-
-    if (outputLength <= length) {
-
-        const char *j = significand;
-        const char *e = significand + len;
-
-        *i++ = *j++;
-
-        if (cfg.precision() || cfg.showpoint()) {
-            *i++ = cfg.decimalPoint();
-        }
-
-        if (cfg.precision()) {
-            const char *end = bsl::min(j + cfg.precision(), e);
-            if (j <= end) {
-                i = bsl::copy(j, end, i);
-                if (end == e) {
-                    long int n = bsl::distance(e, j + cfg.precision());
-                    bsl::fill_n(i, n, '0');
-                    i += n;
-                }
-            }
-        }
-        *i++ = cfg.exponent();
-        i    = bsl::copy(&exp[0], &exp[0] + exponentLength, i);
-    }
-
-    return outputLength;
+    return printScientific(buffer,
+                           length,
+                           significand,
+                           len,
+                           exponent + len - 1,
+                           cfg.precision(),
+                           cfg);
 }
 
 template <class DECIMAL>
@@ -492,6 +576,138 @@ int formatImpl(char                      *buffer,
     return decimalLength;
 }
 
+bool formatSimple(int                         *result,
+                  char                        *buffer,
+                  int                          length,
+                  DecimalImpUtil::ValueType64  value,
+                  const DecimalFormatConfig&   cfg)
+    // If the specified 'value' is finite and can be formatted according to
+    // the specified 'cfg' without rounding, format it into the buffer
+    // specified by 'buffer' and 'length' exactly as 'formatImpl' does, load
+    // the length of the result into the specified 'result', and return
+    // 'true'; otherwise, return 'false' with no other effect.  Note that this
+    // function decodes the BID encoding of 'value' directly, and does not
+    // call the decimal floating-point library.
+{
+    typedef DecimalImpUtil_Bid64 Bid64;
+
+    const bsls::Types::Uint64 x = value.d_raw;
+
+    bsls::Types::Uint64 s;
+    int                 exponent;
+
+    if ((x & Bid64::k_SPECIAL_ENCODING_MASK) ==
+                                             Bid64::k_SPECIAL_ENCODING_MASK) {
+        if ((x & Bid64::k_INFINITY_MASK) == Bid64::k_INFINITY_MASK) {
+            return false;                                             // RETURN
+        }
+        s = (x & Bid64::k_SMALL_COEFF_MASK) | Bid64::k_LARGE_COEFF_HIGH_BIT;
+        if (s > Bid64::k_MAX_COEFF) {
+            // non-canonical encoding of zero
+
+            return false;                                             // RETURN
+        }
+        exponent = static_cast<int>((x >> Bid64::k_EXPONENT_SHIFT_LARGE)
+                                                    & Bid64::k_EXPONENT_MASK)
+                 - Bid64::k_DECIMAL_EXPONENT_BIAS;
+    }
+    else {
+        s        = x & Bid64::k_LARGE_COEFF_MASK;
+        exponent = static_cast<int>((x >> Bid64::k_EXPONENT_SHIFT_SMALL)
+                                                    & Bid64::k_EXPONENT_MASK)
+                 - Bid64::k_DECIMAL_EXPONENT_BIAS;
+    }
+
+    const DecimalFormatConfig::Style style = cfg.style();
+
+    if (DecimalFormatConfig::e_NATURAL != style) {
+        // Normalize as 'DecimalImpUtil::normalize' does.
+
+        if (0 == s) {
+            exponent = 0;
+        }
+        else {
+            while (0 == s % 10 && exponent < Bid64::k_MAX_EXPONENT) {
+                s /= 10;
+                ++exponent;
+            }
+        }
+    }
+
+    char significand[Bid64::k_MAX_DIGITS];
+    int  len = print(&significand[0], &significand[Bid64::k_MAX_DIGITS], s);
+
+    const bool negative   = 0 != (x & Bid64::k_SIGN_MASK);
+    const int  signLength =
+               negative || DecimalFormatConfig::e_NEGATIVE_ONLY != cfg.sign()
+               ? 1
+               : 0;
+
+    char *it           = buffer + signLength;
+    int   bufferLength = length - signLength;
+    int   decimalLength;
+
+    switch (style) {
+      case DecimalFormatConfig::e_SCIENTIFIC: {
+        if (len - 1 > cfg.precision()) {
+            return false;                                             // RETURN
+        }
+        decimalLength = printScientific(it,
+                                        bufferLength,
+                                        significand,
+                                        len,
+                                        exponent + len - 1,
+                                        cfg.precision(),
+                                        cfg);
+      } break;
+      case DecimalFormatConfig::e_FIXED: {
+        if (0 != s && exponent + cfg.precision() < 0) {
+            return false;                                             // RETURN
+        }
+        decimalLength = printFixed(it,
+                                   bufferLength,
+                                   significand,
+                                   len,
+                                   (s != 0) ? len + exponent : 0,
+                                   cfg.precision(),
+                                   cfg);
+      } break;
+      case DecimalFormatConfig::e_NATURAL: {
+        const int adjustedExponent = exponent + len - 1;
+
+        if (exponent <= 0 && adjustedExponent >= -6) {
+            decimalLength = printFixed(it,
+                                       bufferLength,
+                                       significand,
+                                       len,
+                                       (s != 0) ? len + exponent : 0,
+                                       -exponent,
+                                       cfg);
+        }
+        else {
+            decimalLength = printScientific(it,
+                                            bufferLength,
+                                            significand,
+                                            len,
+                                            adjustedExponent,
+                                            len - 1,
+                                            cfg);
+        }
+      } break;
+      default: {
+        return false;                                                 // RETURN
+      }
+    }
+
+    decimalLength += signLength;
+    if (decimalLength <= length && signLength) {
+        *buffer = negative ? '-' : '+';
+    }
+
+    *result = decimalLength;
+    return true;
+}
+
 struct Properties64
     // Properties64, contains constants and member functions identifying key
     // properties of the 64-bit decimal type.
@@ -1119,6 +1335,14 @@ int DecimalImpUtil::format(char                      *buffer,
                            ValueType64                value,
                            const DecimalFormatConfig& config)
 {
+    BSLS_ASSERT(buffer || length < 0);
+    BSLS_ASSERT(config.precision() >= 0);
+
+    int result;
+    if (formatSimple(&result, buffer, length, value, config)) {
+        return result;                                                // RETURN
+    }
+
     return formatImpl(buffer, length, value, config);
 }
 
@@ -1130,6 +1354,134 @@ int DecimalImpUtil::format(char                      *buffer,
     return formatImpl(buffer, length, value, config);
 }
 
+int DecimalImpUtil::parseSimple64(ValueType64 *result, const char *input)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(input);
+
+    const bsls::Types::Uint64 k_SIGN_MASK             = 0x8000000000000000ull;
+    const bsls::Types::Uint64 k_SPECIAL_ENCODING_MASK = 0x6000000000000000ull;
+    const bsls::Types::Uint64 k_SMALL_COEFF_MASK      = 0x0007ffffffffffffull;
+    const bsls::Types::Uint64 k_LARGE_COEFF_HIGH_BIT  = 0x0020000000000000ull;
+    const int                 k_EXPONENT_SHIFT_LARGE  = 51;
+    const int                 k_EXPONENT_SHIFT_SMALL  = 53;
+    const int                 k_DECIMAL_EXPONENT_BIAS = 398;
+    const int                 k_MAX_EXPONENT          = 369;
+    const int                 k_MAX_DIGITS            = 16;
+    const int                 k_EXPONENT_LIMIT        = 1000;
+
+    const char *p        = input;
+    bool        negative = false;
+
+    if ('-' == *p || '+' == *p) {
+        negative = '-' == *p;
+        ++p;
+    }
+
+    // Accumulate the significand, skipping leading zeros, and count the
+    // significant digits and the digits following the decimal point.  Note
+    // that the significand may overflow only if there are more than
+    // 'k_MAX_DIGITS' significant digits, in which case it is discarded.
+
+    const char          *digitsBegin = p;
+    bsls::Types::Uint64  significand = 0;
+
+    while ('0' == *p) {
+        ++p;
+    }
+
+    const char *significantBegin = p;
+
+    for (; static_cast<unsigned char>(*p - '0') < 10; ++p) {
+        significand = significand * 10 + (*p - '0');
+    }
+
+    bsls::Types::IntPtr numDigits         = p - significantBegin;
+    bsls::Types::IntPtr numFractionDigits = 0;
+    bool                hasDigits         = p != digitsBegin;
+
+    if ('.' == *p) {
+        const char *fractionBegin = ++p;
+
+        if (0 == numDigits) {
+            while ('0' == *p) {
+                ++p;
+            }
+        }
+
+        significantBegin = p;
+
+        for (; static_cast<unsigned char>(*p - '0') < 10; ++p) {
+            significand = significand * 10 + (*p - '0');
+        }
+
+        numDigits         += p - significantBegin;
+        numFractionDigits  = p - fractionBegin;
+        hasDigits          = hasDigits || p != fractionBegin;
+    }
+
+    if (!hasDigits
+     || numDigits         > k_MAX_DIGITS
+     || numFractionDigits > k_EXPONENT_LIMIT) {
+        return -1;                                                    // RETURN
+    }
+
+    int exponent = 0;
+
+    if ('e' == *p || 'E' == *p) {
+        ++p;
+
+        bool negativeExponent = false;
+        if ('-' == *p || '+' == *p) {
+            negativeExponent = '-' == *p;
+            ++p;
+        }
+
+        if (static_cast<unsigned char>(*p - '0') >= 10) {
+            return -1;                                                // RETURN
+        }
+
+        for (; static_cast<unsigned char>(*p - '0') < 10; ++p) {
+            exponent = exponent * 10 + (*p - '0');
+            if (exponent > k_EXPONENT_LIMIT) {
+                return -1;                                            // RETURN
+            }
+        }
+
+        if (negativeExponent) {
+            exponent = -exponent;
+        }
+    }
+
+    if ('\0' != *p) {
+        return -1;                                                    // RETURN
+    }
+
+    exponent -= static_cast<int>(numFractionDigits);
+
+    if (exponent < -k_DECIMAL_EXPONENT_BIAS || exponent > k_MAX_EXPONENT) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsls::Types::Uint64 biasedExponent =
+                   static_cast<bsls::Types::Uint64>(exponent
+                                                   + k_DECIMAL_EXPONENT_BIAS);
+
+    bsls::Types::Uint64 bits = negative ? k_SIGN_MASK : 0;
+
+    if (significand < k_LARGE_COEFF_HIGH_BIT) {
+        bits |= (biasedExponent << k_EXPONENT_SHIFT_SMALL) | significand;
+    }
+    else {
+        bits |= k_SPECIAL_ENCODING_MASK
+              | (biasedExponent << k_EXPONENT_SHIFT_LARGE)
+              | (significand & k_SMALL_COEFF_MASK);
+    }
+
+    result->d_raw = bits;
+    return 0;
+}
+
 DecimalImpUtil::ValueType32 DecimalImpUtil::min32() BSLS_KEYWORD_NOEXCEPT
 {
 #if defined(BDLDFP_DECIMALPLATFORM_INTELDFP)
@@ -436,6 +436,10 @@ class DecimalImpUtil {
         // 'e_NATURAL' then all significand digits of the 'value' are output in
         // the buffer regardless of the value specified in configuration's
         // 'precision' attribute.
+        //
+        // Finally note that a finite 'ValueType64' value that does not need
+        // to be rounded is formatted using integer arithmetic only, without
+        // calling the underlying decimal floating-point library.
 
                         // Integer construction
 
@@ -1331,6 +1335,27 @@ class DecimalImpUtil {
         // 'parse32("1.5")      => 15e-1'
         // 'parse32("1.500")    => 1500e-3'
         // 'parse32("1.2345678) => 1234568e-6'
+        //
+        // Finally note that 'parse64' first attempts to parse 'input' using
+        // 'parseSimple64', and calls the underlying decimal floating-point
+        // library only if that fails.
+
+    static int parseSimple64(ValueType64 *result, const char *input);
+        // Load into the specified 'result' the value represented by the
+        // specified 'input' if 'input' consists of an optional sign ('+' or
+        // '-'), a non-empty sequence of decimal digits containing at most one
+        // decimal point, and an optional exponent ('e' or 'E' followed by an
+        // optionally signed non-empty sequence of decimal digits), and the
+        // value is exactly representable with the quantum given by 'input'
+        // (i.e., 'input' has at most 16 significant digits, and its exponent,
+        // adjusted for the digits following the decimal point, is in the
+        // range '[-398 .. 369]').  Return 0 on success, and a non-zero value
+        // with no effect on 'result' otherwise.  The value loaded into
+        // 'result' is the same as that returned by 'parse64(input)'.  Note
+        // that this function uses only integer arithmetic, and is
+        // substantially faster than the decimal floating-point library for
+        // the short decimal strings that are typical of prices and
+        // quantities.
 
                         // Densely Packed Conversion Functions
 
@@ -3096,6 +3121,10 @@ inline
 DecimalImpUtil::ValueType64
 DecimalImpUtil::parse64(const char *input)
 {
+    ValueType64 result;
+    if (0 == parseSimple64(&result, input)) {
+        return result;                                                // RETURN
+    }
     return Imp::parse64(input);
 }
 
@@ -18,6 +18,7 @@
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <typeinfo>
 
@@ -237,9 +238,11 @@ using bsl::atoi;
 // [30] sameQuantum(ValueType32,  ValueType32);
 // [30] sameQuantum(ValueType64,  ValueType64);
 // [30] sameQuantum(ValueType128, ValueType128);
+// [31] int parseSimple64(ValueType64 *, const char *);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 4] TEST 'notEqual' FOR 'NaN' CORRECTNESS
+// [31] PARSING AND FORMATTING FAST PATHS
 // [32] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
@@ -1358,6 +1361,7 @@ static int veryVeryVeryVerbose;
 static bslma::TestAllocator *pa;
 
 struct TestDriver {
+    static void testCase32();
     static void testCase31();
     static void testCase30();
     static void testCase29();
@@ -1391,7 +1395,7 @@ struct TestDriver {
     static void testCase1();
 };
 
-void TestDriver::testCase31()
+void TestDriver::testCase32()
 {
     // ------------------------------------------------------------------------
     // TESTING USAGE EXAMPLE
@@ -1493,6 +1497,506 @@ void TestDriver::testCase31()
 // for public consumption, or direct use in decimal arithmetic.
 }
 
+void TestDriver::testCase31()
+{
+    // ------------------------------------------------------------------------
+    // TESTING PARSING AND FORMATTING FAST PATHS
+    //
+    // Concerns:
+    //: 1 'parseSimple64' accepts a string consisting of an optional sign,
+    //:   digits with at most one decimal point, and an optional exponent,
+    //:   having at most 16 significant digits and an exponent (adjusted for
+    //:   the fraction digits) in the range '[-398 .. 369]', and rejects all
+    //:   other strings without modifying 'result'.
+    //:
+    //: 2 The value loaded by 'parseSimple64' is bit-for-bit identical to the
+    //:   value produced by the decimal floating-point library for the same
+    //:   string, including the quantum and the sign of zero, and for both
+    //:   encodings of the significand (below and above 2^53).
+    //:
+    //: 3 'parse64' produces the same value as the decimal floating-point
+    //:   library for every string, whether or not 'parseSimple64' accepts it.
+    //:
+    //: 4 'format' of a 'ValueType64' produces the same string, and returns
+    //:   the same length, as 'format' of the same value converted to
+    //:   'ValueType128' (which does not use the fast path), for every style,
+    //:   precision, sign, 'showpoint', and exponent width, for all exponents,
+    //:   and whether or not the value must be rounded.
+    //:
+    //: 5 QoI: Asserted precondition violations are detected when enabled.
+    //
+    // Plan:
+    //: 1 Using a table-based approach, verify that 'parseSimple64' accepts
+    //:   or rejects a set of hand-picked strings as expected, and that it
+    //:   does not modify 'result' on failure.  (C-1)
+    //:
+    //: 2 Exhaustively generate every string of up to 7 characters from an
+    //:   alphabet of digits, '.', 'e', 'E', '+', and '-', and compare the
+    //:   results of 'parse64' and 'parseSimple64' with the result of
+    //:   'DecimalImpUtil_IntelDfp::parse64'.  (C-1..3)
+    //:
+    //: 3 For significands of 1 to 18 digits (including leading zeros and the
+    //:   boundaries of the two encodings), with the decimal point at every
+    //:   position and with exponents at and around the limits of the
+    //:   representable range, repeat P-2.  (C-1..3)
+    //:
+    //: 4 For a set of significands, both signs, and every exponent (for a
+    //:   subset of the configurations) or a sample of exponents (for all
+    //:   configurations), compare the results of 'format' for the value as
+    //:   'ValueType64' and 'ValueType128', with a sufficient buffer and with
+    //:   a null buffer of negative length.  (C-4)
+    //:
+    //: 5 Verify that, in appropriate build modes, defensive checks are
+    //:   triggered for invalid arguments.  (C-5)
+    //
+    // Testing:
+    //   int parseSimple64(ValueType64 *, const char *);
+    //   PARSING AND FORMATTING FAST PATHS
+    // ------------------------------------------------------------------------
+
+    if (verbose) cout << endl
+                      << "TESTING PARSING AND FORMATTING FAST PATHS" << endl
+                      << "=========================================" << endl;
+
+    typedef bsls::Types::Uint64 Uint64;
+    typedef Util::ValueType64   Type;
+
+    const Uint64 k_GUARD = 0xDEADBEEFDEADBEEFull;
+
+    if (verbose) cout << "\nTesting hand-picked strings." << endl;
+    {
+        static const struct {
+            int         d_line;
+            const char *d_input;
+            bool        d_accepted;
+            long long   d_significand;
+            int         d_exponent;
+        } DATA[] = {
+            //LINE INPUT                 OK  SIGNIFICAND          EXP
+            //---- --------------------- --  -------------------  ----
+            { L_, "0",                   1,                   0,    0 },
+            { L_, "-0",                  1,                   0,    0 },
+            { L_, "0.000",               1,                   0,   -3 },
+            { L_, "1",                   1,                   1,    0 },
+            { L_, "+1",                  1,                   1,    0 },
+            { L_, "-1",                  1,                   1,    0 },
+            { L_, "1.5",                 1,                  15,   -1 },
+            { L_, "1.50",                1,                 150,   -2 },
+            { L_, "123.4567",            1,             1234567,   -4 },
+            { L_, "-0.001",              1,                   1,   -3 },
+            { L_, "00012.5",             1,                 125,   -1 },
+            { L_, "1.",                  1,                   1,    0 },
+            { L_, ".5",                  1,                   5,   -1 },
+            { L_, "1e5",                 1,                   1,    5 },
+            { L_, "1E+5",                1,                   1,    5 },
+            { L_, "2.5e-3",              1,                  25,   -4 },
+            { L_, "1e0000000005",        1,                   1,    5 },
+            { L_, "9999999999999999",    1,  9999999999999999LL,    0 },
+            { L_, "9007199254740991",    1,  9007199254740991LL,    0 },
+            { L_, "9007199254740992",    1,  9007199254740992LL,    0 },
+            { L_, "-9.999999999999999",  1,  9999999999999999LL,  -15 },
+            { L_, "0.00000000000000001", 1,                   1,  -17 },
+            { L_, "1e369",               1,                   1,  369 },
+            { L_, "1e-398",              1,                   1, -398 },
+            { L_, "0.1e-397",            1,                   1, -398 },
+
+            { L_, "",                    0,                   0,    0 },
+            { L_, "+",                   0,                   0,    0 },
+            { L_, "-",                   0,                   0,    0 },
+            { L_, ".",                   0,                   0,    0 },
+            { L_, "e5",                  0,                   0,    0 },
+            { L_, ".e5",                 0,                   0,    0 },
+            { L_, "1e",                  0,                   0,    0 },
+            { L_, "1e+",                 0,                   0,    0 },
+            { L_, "1.2.3",               0,                   0,    0 },
+            { L_, "--1",                 0,                   0,    0 },
+            { L_, " 1",                  0,                   0,    0 },
+            { L_, "1 ",                  0,                   0,    0 },
+            { L_, "0x1",                 0,                   0,    0 },
+            { L_, "nan",                 0,                   0,    0 },
+            { L_, "inf",                 0,                   0,    0 },
+            { L_, "-Infinity",           0,                   0,    0 },
+            { L_, "12345678901234567",   0,                   0,    0 },
+            { L_, "1.0000000000000000",  0,                   0,    0 },
+            { L_, "1e370",               0,                   0,    0 },
+            { L_, "1e-399",              0,                   0,    0 },
+            { L_, "1e100000000",         0,                   0,    0 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE  = DATA[ti].d_line;
+            const char *const INPUT = DATA[ti].d_input;
+            const bool        OK    = DATA[ti].d_accepted;
+
+            if (veryVerbose) { T_ P_(LINE) P_(INPUT) P(OK) }
+
+            Type mX;  const Type& X = mX;
+            mX.d_raw = k_GUARD;
+
+            const int rc = Util::parseSimple64(&mX, INPUT);
+
+            ASSERTV(LINE, INPUT, OK == (0 == rc));
+
+            const Type EXPECTED = BDEC::DecimalImpUtil_IntelDfp::parse64(
+                                                                       INPUT);
+
+            if (OK) {
+                Type exp = Util::makeDecimalRaw64(
+                       static_cast<unsigned long long>(DATA[ti].d_significand),
+                       DATA[ti].d_exponent);
+                if ('-' == INPUT[0]) {
+                    exp = Util::negate(exp);
+                }
+                const Type EXP = exp;
+
+                ASSERTV(LINE, INPUT, EXP.d_raw      == X.d_raw);
+                ASSERTV(LINE, INPUT, EXPECTED.d_raw == X.d_raw);
+            }
+            else {
+                ASSERTV(LINE, INPUT, k_GUARD == X.d_raw);
+            }
+
+            ASSERTV(LINE, INPUT, EXPECTED.d_raw == Util::parse64(INPUT).d_raw);
+        }
+    }
+
+    if (verbose) cout << "\nExhaustively testing short strings." << endl;
+    {
+        const char   ALPHABET[]    = "019.eE+-";
+        const int    ALPHABET_SIZE = static_cast<int>(sizeof ALPHABET - 1);
+        const int    MAX_LENGTH    = 7;
+
+        int numStrings  = 0;
+        int numAccepted = 0;
+
+        for (int length = 0; length <= MAX_LENGTH; ++length) {
+            int  indices[MAX_LENGTH] = { 0 };
+            char input[MAX_LENGTH + 1];
+            input[length] = '\0';
+
+            while (true) {
+                for (int i = 0; i < length; ++i) {
+                    input[i] = ALPHABET[indices[i]];
+                }
+
+                const Type EXPECTED = BDEC::DecimalImpUtil_IntelDfp::parse64(
+                                                                       input);
+
+                Type mX;  const Type& X = mX;
+                mX.d_raw = k_GUARD;
+
+                if (0 == Util::parseSimple64(&mX, input)) {
+                    ASSERTV(input, EXPECTED.d_raw == X.d_raw);
+                    ++numAccepted;
+                }
+                else {
+                    ASSERTV(input, k_GUARD == X.d_raw);
+                }
+
+                ASSERTV(input, EXPECTED.d_raw == Util::parse64(input).d_raw);
+
+                ++numStrings;
+
+                int i = length - 1;
+                while (0 <= i && ALPHABET_SIZE == ++indices[i]) {
+                    indices[i] = 0;
+                    --i;
+                }
+                if (0 > i) {
+                    break;
+                }
+            }
+        }
+
+        if (veryVerbose) { T_ P_(numStrings) P(numAccepted) }
+
+        ASSERT(0 < numAccepted);
+    }
+
+    if (verbose) cout << "\nTesting long significands and exponents."
+                      << endl;
+    {
+        const char *const SIGNIFICANDS[] = {
+            "7",
+            "10",
+            "100",
+            "0000001",
+            "1234567",
+            "100000000",
+            "123456789012",
+            "999999999999999",
+            "1000000000000000",
+            "9007199254740991",
+            "9007199254740992",
+            "9007199254740993",
+            "9999999999999999",
+            "0009999999999999999",
+            "10000000000000000",
+            "12345678901234567",
+            "123456789012345678",
+            "000000000000000000",
+        };
+        const int NUM_SIGNIFICANDS =
+                static_cast<int>(sizeof SIGNIFICANDS / sizeof *SIGNIFICANDS);
+
+        const char *const EXPONENTS[] = {
+            "",     "e0",   "e-0",  "e+0",  "e1",   "E-1",  "e-30", "e+30",
+            "e353", "e354", "e368", "e369", "e370", "e383", "e384", "e385",
+            "e400", "e-382","e-383","e-384","e-397","e-398","e-399","e-413",
+            "e-414","e-420","e-500",
+        };
+        const int NUM_EXPONENTS =
+                      static_cast<int>(sizeof EXPONENTS / sizeof *EXPONENTS);
+
+        const char *const SIGNS[] = { "", "+", "-" };
+
+        int numAccepted = 0;
+
+        for (int si = 0; si < NUM_SIGNIFICANDS; ++si) {
+            const bsl::string DIGITS(SIGNIFICANDS[si]);
+
+            for (int pi = 0; pi <= static_cast<int>(DIGITS.size()); ++pi) {
+                for (int ei = 0; ei < NUM_EXPONENTS; ++ei) {
+                    for (int gi = 0; gi < 3; ++gi) {
+                        bsl::string input(SIGNS[gi]);
+                        input += DIGITS.substr(0, pi);
+                        if (pi < static_cast<int>(DIGITS.size())) {
+                            input += '.';
+                            input += DIGITS.substr(pi);
+                        }
+                        input += EXPONENTS[ei];
+
+                        const char *const INPUT = input.c_str();
+
+                        const Type EXPECTED =
+                              BDEC::DecimalImpUtil_IntelDfp::parse64(INPUT);
+
+                        Type mX;  const Type& X = mX;
+                        mX.d_raw = k_GUARD;
+
+                        if (0 == Util::parseSimple64(&mX, INPUT)) {
+                            ASSERTV(INPUT, EXPECTED.d_raw == X.d_raw);
+                            ++numAccepted;
+                        }
+                        else {
+                            ASSERTV(INPUT, k_GUARD == X.d_raw);
+                        }
+
+                        ASSERTV(INPUT,
+                                EXPECTED.d_raw == Util::parse64(INPUT).d_raw);
+                    }
+                }
+            }
+        }
+
+        if (veryVerbose) { T_ P(numAccepted) }
+
+        ASSERT(0 < numAccepted);
+    }
+
+    if (verbose) cout << "\nTesting 'format'." << endl;
+    {
+        const long long SIGNIFICANDS[] = {
+                             0LL,
+                             1LL,
+                             5LL,
+                             9LL,
+                            10LL,
+                            25LL,
+                           100LL,
+                           123LL,
+                          1005LL,
+                         12340LL,
+                       1000000LL,
+                       1234567LL,
+                      99999999LL,
+                     123456789LL,
+                    1000000000LL,
+                  123456789000LL,
+              1000000000000000LL,
+              1234567890123456LL,
+              5000000000000001LL,
+              9007199254740991LL,
+              9007199254740992LL,
+              9999999999999999LL,
+        };
+        const int NUM_SIGNIFICANDS =
+                static_cast<int>(sizeof SIGNIFICANDS / sizeof *SIGNIFICANDS);
+
+        const Config::Style STYLES[] = {
+            Config::e_SCIENTIFIC, Config::e_FIXED, Config::e_NATURAL
+        };
+        const int PRECISIONS[] = { 0, 1, 2, 3, 6, 15, 17 };
+        const int NUM_PRECISIONS =
+                    static_cast<int>(sizeof PRECISIONS / sizeof *PRECISIONS);
+
+        bsl::vector<Config> allConfigs;
+        bsl::vector<Config> someConfigs;
+
+        for (int si = 0; si < 3; ++si) {
+            for (int pi = 0; pi < NUM_PRECISIONS; ++pi) {
+                for (int showpoint = 0; showpoint < 2; ++showpoint) {
+                    for (int width = 1; width <= 4; width += 3) {
+                        for (int sign = 0; sign < 2; ++sign) {
+                            const Config CONFIG(
+                                     PRECISIONS[pi],
+                                     STYLES[si],
+                                     sign ? Config::e_ALWAYS
+                                          : Config::e_NEGATIVE_ONLY,
+                                     "inf",
+                                     "nan",
+                                     "snan",
+                                     showpoint ? ',' : '.',
+                                     width > 1 ? 'E' : 'e',
+                                     showpoint,
+                                     width);
+
+                            allConfigs.push_back(CONFIG);
+                            if (showpoint == sign && 1 == width
+                             && (0 == pi || 3 == pi)) {
+                                someConfigs.push_back(CONFIG);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        const int SAMPLE_EXPONENTS[] = {
+            -398, -397, -396, -390, -383, -382, -30, -20, -17, -16, -15, -10,
+              -8,   -7,   -6,   -5,   -4,   -3,  -2,  -1,   0,   1,   2,   3,
+               5,   10,   15,   16,   20,  352, 353, 354, 367, 368, 369,
+        };
+        const int NUM_SAMPLE_EXPONENTS = static_cast<int>(
+                           sizeof SAMPLE_EXPONENTS / sizeof *SAMPLE_EXPONENTS);
+
+        const int k_BUFFER_SIZE = 512;
+
+        char buffer64 [k_BUFFER_SIZE];
+        char buffer128[k_BUFFER_SIZE];
+
+        int numFormats = 0;
+
+        for (int si = 0; si < NUM_SIGNIFICANDS; ++si) {
+            for (int exponent = -398; exponent <= 369; ++exponent) {
+                bool sampled = false;
+                for (int i = 0; i < NUM_SAMPLE_EXPONENTS; ++i) {
+                    sampled = sampled || SAMPLE_EXPONENTS[i] == exponent;
+                }
+
+                const bsl::vector<Config>& CONFIGS = sampled
+                                                   ? allConfigs
+                                                   : someConfigs;
+
+                for (int negative = 0; negative < 2; ++negative) {
+                    Type value = Util::makeDecimalRaw64(
+                                     static_cast<unsigned long long>(
+                                                           SIGNIFICANDS[si]),
+                                     exponent);
+                    if (negative) {
+                        value = Util::negate(value);
+                    }
+                    const Type               V64  = value;
+                    const Util::ValueType128 V128 =
+                                               Util::convertToDecimal128(V64);
+
+                    for (bsl::size_t ci = 0; ci < CONFIGS.size(); ++ci) {
+                        const Config& CONFIG = CONFIGS[ci];
+
+                        const int LEN128 = Util::format(buffer128,
+                                                        k_BUFFER_SIZE,
+                                                        V128,
+                                                        CONFIG);
+                        const int LEN64  = Util::format(buffer64,
+                                                        k_BUFFER_SIZE,
+                                                        V64,
+                                                        CONFIG);
+
+                        const bsl::string EXPECTED(buffer128, LEN128);
+                        const bsl::string RESULT(  buffer64,  LEN64);
+
+                        ASSERTV(SIGNIFICANDS[si], exponent, negative, ci,
+                                EXPECTED, RESULT, EXPECTED == RESULT);
+
+                        ASSERTV(SIGNIFICANDS[si], exponent, ci,
+                                LEN64 == Util::format(0, -1, V64, CONFIG));
+
+                        ++numFormats;
+                    }
+                }
+            }
+        }
+
+        if (veryVerbose) { T_ P(numFormats) }
+
+        if (verbose) cout << "\tTesting special values." << endl;
+
+        const Type SPECIALS[] = {
+            Util::infinity64(),
+            Util::negate(Util::infinity64()),
+            Util::quietNaN64(),
+            Util::negate(Util::quietNaN64()),
+            Util::max64(),
+            Util::min64(),
+            Util::denormMin64(),
+            Util::negate(Util::denormMin64()),
+        };
+        const int NUM_SPECIALS =
+                        static_cast<int>(sizeof SPECIALS / sizeof *SPECIALS);
+
+        for (int vi = 0; vi < NUM_SPECIALS; ++vi) {
+            const Type               V64  = SPECIALS[vi];
+            const Util::ValueType128 V128 = Util::convertToDecimal128(V64);
+
+            for (bsl::size_t ci = 0; ci < allConfigs.size(); ++ci) {
+                const Config& CONFIG = allConfigs[ci];
+
+                const int LEN128 = Util::format(buffer128,
+                                                k_BUFFER_SIZE,
+                                                V128,
+                                                CONFIG);
+                const int LEN64  = Util::format(buffer64,
+                                                k_BUFFER_SIZE,
+                                                V64,
+                                                CONFIG);
+
+                ASSERTV(vi, ci, bsl::string(buffer128, LEN128) ==
+                                              bsl::string(buffer64, LEN64));
+            }
+        }
+
+        // Conversion to 'ValueType128' quiets a signaling NaN, so it is
+        // tested separately.
+
+        for (bsl::size_t ci = 0; ci < allConfigs.size(); ++ci) {
+            const Config& CONFIG = allConfigs[ci];
+
+            const int LEN64 = Util::format(buffer64,
+                                           k_BUFFER_SIZE,
+                                           Util::signalingNaN64(),
+                                           CONFIG);
+
+            const bsl::string EXPECTED =
+                     bsl::string(Config::e_ALWAYS == CONFIG.sign() ? "+" : "")
+                   + CONFIG.sNan();
+
+            ASSERTV(ci, EXPECTED == bsl::string(buffer64, LEN64));
+        }
+    }
+
+    if (verbose) cout << "\nNegative Testing." << endl;
+    {
+        bsls::AssertTestHandlerGuard hG;
+
+        Type mX;
+
+        ASSERT_PASS(Util::parseSimple64(&mX, "1"));
+        ASSERT_FAIL(Util::parseSimple64(  0, "1"));
+        ASSERT_FAIL(Util::parseSimple64(&mX,   0));
+    }
+}
+
 void TestDriver::testCase30()
 {
     // ------------------------------------------------------------------------
@@ -15884,6 +16388,9 @@ int main(int argc, char* argv[])
     cout.precision(35);
 
     switch (test) { case 0:
+      case 32: {
+        TestDriver::testCase32();
+      } break;
       case 31: {
         TestDriver::testCase31();
       } break;
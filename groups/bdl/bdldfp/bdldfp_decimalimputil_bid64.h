@@ -0,0 +1,160 @@
+// bdldfp_decimalimputil_bid64.h                                      -*-C++-*-
+#ifndef INCLUDED_BDLDFP_DECIMALIMPUTIL_BID64
+#define INCLUDED_BDLDFP_DECIMALIMPUTIL_BID64
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$")
+
+//@PURPOSE: Provide constants describing the BID encoding of 'Decimal64'.
+//
+//@CLASSES:
+//  bdldfp::DecimalImpUtil_Bid64: namespace for BID 'Decimal64' constants
+//
+//@SEE_ALSO: bdldfp_decimalimputil, bdldfp_decimalorderutil,
+//           bdldfp_decimalutil
+//
+//@DESCRIPTION: This component, 'bdldfp::DecimalImpUtil_Bid64', is for
+// internal use only by the 'bdldfp_decimal*' components.  Direct use of any
+// names declared in this component by any other code invokes undefined
+// behavior.  In other words: this code may change, disappear, break, move
+// without notice, and no support whatsoever will ever be provided for it.
+// This component provides the masks, shifts, and limits needed to decode a
+// 'Decimal64' value directly from its 64-bit binary integer decimal (BID)
+// encoding, so that the components that do so share a single definition.
+//
+// A finite BID 'Decimal64' value is encoded in one of two forms, selected by
+// the two bits following the sign bit ('k_SPECIAL_ENCODING_MASK'):
+//
+//: o If those bits are not both set, the biased exponent occupies the 10 bits
+//:   starting at bit 'k_EXPONENT_SHIFT_SMALL' (53), and the significand (less
+//:   than '2 ** 53') is given by the 53 low-order bits
+//:   ('k_LARGE_COEFF_MASK').
+//:
+//: o Otherwise (unless the value is an infinity or NaN, as indicated by
+//:   'k_INFINITY_MASK'), the biased exponent occupies the 10 bits starting at
+//:   bit 'k_EXPONENT_SHIFT_LARGE' (51), and the significand (at least
+//:   '2 ** 53') is given by the 51 low-order bits ('k_SMALL_COEFF_MASK')
+//:   combined with the implicit high-order bits 'k_LARGE_COEFF_HIGH_BIT'.  A
+//:   significand greater than 'k_MAX_COEFF' is non-canonical, and represents
+//:   zero.
+//
+// Note that the names of the coefficient masks describe the width of the
+// masks, and are those used by 'bdldfp::DecimalImpUtil'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding the Significand of a 'Decimal64'
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have the BID encoding of a finite 'Decimal64' value, and we want
+// to obtain its significand.
+//
+// First, we define a shorthand for the struct:
+//..
+//  typedef bdldfp::DecimalImpUtil_Bid64 Bid64;
+//..
+// Then, we define the encoding of '9999999999999999', whose significand
+// requires the second form:
+//..
+//  const bsls::Types::Uint64 bits = 0x6c7386f26fc0ffffull;
+//..
+// Finally, we decode the significand:
+//..
+//  const bsls::Types::Uint64 special = Bid64::k_SPECIAL_ENCODING_MASK;
+//
+//  bsls::Types::Uint64 significand;
+//  if (special == (bits & special)) {
+//      significand = (bits & Bid64::k_SMALL_COEFF_MASK)
+//                  | Bid64::k_LARGE_COEFF_HIGH_BIT;
+//  }
+//  else {
+//      significand = bits & Bid64::k_LARGE_COEFF_MASK;
+//  }
+//  assert(9999999999999999ull == significand);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdldfp {
+
+                        // ===========================
+                        // struct DecimalImpUtil_Bid64
+                        // ===========================
+
+struct DecimalImpUtil_Bid64 {
+    // This 'struct' provides a namespace for constants describing the BID
+    // encoding of 'Decimal64' values.
+
+    // CLASS DATA
+    static const bsls::Types::Uint64 k_SIGN_MASK = 0x8000000000000000ull;
+        // sign bit
+
+    static const bsls::Types::Uint64 k_SPECIAL_ENCODING_MASK =
+                                                         0x6000000000000000ull;
+        // bits that are both set for the second (large significand) form, an
+        // infinity, or a NaN
+
+    static const bsls::Types::Uint64 k_INFINITY_MASK = 0x7800000000000000ull;
+        // bits that are all set for an infinity or a NaN
+
+    static const bsls::Types::Uint64 k_NAN_MASK = 0x7c00000000000000ull;
+        // bits that are all set for a NaN
+
+    static const bsls::Types::Uint64 k_SMALL_COEFF_MASK =
+                                                         0x0007ffffffffffffull;
+        // low-order significand bits of the second (large significand) form
+
+    static const bsls::Types::Uint64 k_LARGE_COEFF_MASK =
+                                                         0x001fffffffffffffull;
+        // significand bits of the first (small significand) form
+
+    static const bsls::Types::Uint64 k_LARGE_COEFF_HIGH_BIT =
+                                                         0x0020000000000000ull;
+        // implicit high-order significand bits of the second form
+
+    static const bsls::Types::Uint64 k_MAX_COEFF = 9999999999999999ull;
+        // greatest canonical significand
+
+    static const int k_EXPONENT_MASK = 0x3ff;
+        // mask of the biased exponent, once shifted
+
+    static const int k_EXPONENT_SHIFT_LARGE = 51;
+        // position of the biased exponent in the second form
+
+    static const int k_EXPONENT_SHIFT_SMALL = 53;
+        // position of the biased exponent in the first form
+
+    static const int k_DECIMAL_EXPONENT_BIAS = 398;
+        // bias of the exponent (i.e., the negation of the least exponent)
+
+    static const int k_MAX_EXPONENT = 369;
+        // greatest (unbiased) exponent
+
+    static const int k_MAX_DIGITS = 16;
+        // number of decimal digits in the greatest canonical significand
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
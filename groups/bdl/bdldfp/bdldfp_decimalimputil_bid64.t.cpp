@@ -0,0 +1,336 @@
+// bdldfp_decimalimputil_bid64.t.cpp                                  -*-C++-*-
+#include <bdldfp_decimalimputil_bid64.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::atoi;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides only constants describing the BID
+// encoding of 'Decimal64'.  We verify that the constants are consistent with
+// one another, and that they decode a table of encodings computed
+// independently.
+// ----------------------------------------------------------------------------
+// CLASS DATA
+// [ 1] k_SIGN_MASK
+// [ 1] k_SPECIAL_ENCODING_MASK
+// [ 1] k_INFINITY_MASK
+// [ 1] k_NAN_MASK
+// [ 1] k_SMALL_COEFF_MASK
+// [ 1] k_LARGE_COEFF_MASK
+// [ 1] k_LARGE_COEFF_HIGH_BIT
+// [ 1] k_MAX_COEFF
+// [ 1] k_EXPONENT_MASK
+// [ 1] k_EXPONENT_SHIFT_LARGE
+// [ 1] k_EXPONENT_SHIFT_SMALL
+// [ 1] k_DECIMAL_EXPONENT_BIAS
+// [ 1] k_MAX_EXPONENT
+// [ 1] k_MAX_DIGITS
+// ----------------------------------------------------------------------------
+// [ 2] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdldfp::DecimalImpUtil_Bid64 Obj;
+typedef bsls::Types::Uint64          Uint64;
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test    = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose = argc > 2;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 2: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Decoding the Significand of a 'Decimal64'
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have the BID encoding of a finite 'Decimal64' value, and we want
+// to obtain its significand.
+//
+// First, we define a shorthand for the struct:
+//..
+    typedef bdldfp::DecimalImpUtil_Bid64 Bid64;
+//..
+// Then, we define the encoding of '9999999999999999', whose significand
+// requires the second form:
+//..
+    const bsls::Types::Uint64 bits = 0x6c7386f26fc0ffffull;
+//..
+// Finally, we decode the significand:
+//..
+    const bsls::Types::Uint64 special = Bid64::k_SPECIAL_ENCODING_MASK;
+
+    bsls::Types::Uint64 significand;
+    if (special == (bits & special)) {
+        significand = (bits & Bid64::k_SMALL_COEFF_MASK)
+                    | Bid64::k_LARGE_COEFF_HIGH_BIT;
+    }
+    else {
+        significand = bits & Bid64::k_LARGE_COEFF_MASK;
+    }
+    ASSERT(9999999999999999ull == significand);
+//..
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // TESTING CLASS DATA
+        //
+        // Concerns:
+        //: 1 The masks partition the encoding as specified by IEEE 754-2008
+        //:   for the BID encoding of 'decimal64'.
+        //:
+        //: 2 The limits are those of 'decimal64'.
+        //:
+        //: 3 The constants decode the sign, significand, and exponent of
+        //:   values encoded in either form.
+        //
+        // Plan:
+        //: 1 Verify the relationships between the masks and shifts.  (C-1)
+        //:
+        //: 2 Verify the limits against their definitions.  (C-2)
+        //:
+        //: 3 Using a table of encodings computed independently, decode each
+        //:   encoding and verify the result.  (C-3)
+        //
+        // Testing:
+        //   k_SIGN_MASK
+        //   k_SPECIAL_ENCODING_MASK
+        //   k_INFINITY_MASK
+        //   k_NAN_MASK
+        //   k_SMALL_COEFF_MASK
+        //   k_LARGE_COEFF_MASK
+        //   k_LARGE_COEFF_HIGH_BIT
+        //   k_MAX_COEFF
+        //   k_EXPONENT_MASK
+        //   k_EXPONENT_SHIFT_LARGE
+        //   k_EXPONENT_SHIFT_SMALL
+        //   k_DECIMAL_EXPONENT_BIAS
+        //   k_MAX_EXPONENT
+        //   k_MAX_DIGITS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CLASS DATA" << endl
+                          << "==================" << endl;
+
+        if (verbose) cout << "\nTesting the masks and shifts." << endl;
+        {
+            const Uint64 ONE = 1;
+
+            ASSERT(ONE << 63 == Obj::k_SIGN_MASK);
+
+            ASSERT(3 * (ONE << 61) == Obj::k_SPECIAL_ENCODING_MASK);
+            ASSERT(Obj::k_SPECIAL_ENCODING_MASK ==
+                        (Obj::k_INFINITY_MASK & Obj::k_SPECIAL_ENCODING_MASK));
+            ASSERT(Obj::k_INFINITY_MASK ==
+                                     (Obj::k_NAN_MASK & Obj::k_INFINITY_MASK));
+            ASSERT(0 == (Obj::k_NAN_MASK & Obj::k_SIGN_MASK));
+
+            ASSERT((ONE << Obj::k_EXPONENT_SHIFT_SMALL) - 1 ==
+                                                     Obj::k_LARGE_COEFF_MASK);
+            ASSERT((ONE << Obj::k_EXPONENT_SHIFT_LARGE) - 1 ==
+                                                     Obj::k_SMALL_COEFF_MASK);
+            ASSERT(ONE << (Obj::k_EXPONENT_SHIFT_LARGE + 2) ==
+                                                 Obj::k_LARGE_COEFF_HIGH_BIT);
+
+            ASSERT((1 << 10) - 1 == Obj::k_EXPONENT_MASK);
+
+            // The exponent field of each form ends just below the bits that
+            // select the form.
+
+            ASSERT(61 == Obj::k_EXPONENT_SHIFT_LARGE + 10);
+            ASSERT(63 == Obj::k_EXPONENT_SHIFT_SMALL + 10);
+        }
+
+        if (verbose) cout << "\nTesting the limits." << endl;
+        {
+            Uint64 power = 1;
+            for (int i = 0; i < Obj::k_MAX_DIGITS; ++i) {
+                power *= 10;
+            }
+            ASSERT(power - 1 == Obj::k_MAX_COEFF);
+
+            ASSERT(Obj::k_MAX_COEFF >= Obj::k_LARGE_COEFF_HIGH_BIT);
+            ASSERT(Obj::k_MAX_COEFF <= (Obj::k_LARGE_COEFF_HIGH_BIT
+                                      | Obj::k_SMALL_COEFF_MASK));
+
+            ASSERT(398 == Obj::k_DECIMAL_EXPONENT_BIAS);
+            ASSERT(369 == Obj::k_MAX_EXPONENT);
+
+            // The greatest biased exponent is the greatest value of the
+            // exponent field that does not select the second form.
+
+            ASSERT(3 * 256 - 1 ==
+                      Obj::k_MAX_EXPONENT + Obj::k_DECIMAL_EXPONENT_BIAS);
+        }
+
+        if (verbose) cout << "\nTesting decoding." << endl;
+        {
+            static const struct {
+                int    d_line;
+                Uint64 d_bits;
+                bool   d_negative;
+                Uint64 d_significand;
+                int    d_exponent;
+            } DATA[] = {
+                //LINE BITS                   NEG SIGNIFICAND           EXP
+                //---- --------------------- --- -------------------- ----
+                { L_, 0x31c0000000000000ull, 0,                 0ull,    0 },
+                { L_, 0x31c0000000000001ull, 0,                 1ull,    0 },
+                { L_, 0xb1c0000000000001ull, 1,                 1ull,    0 },
+                { L_, 0x001fffffffffffffull, 0,  9007199254740991ull, -398 },
+                { L_, 0x6c7386f26fc0ffffull, 0,  9999999999999999ull,    0 },
+                { L_, 0xe00386f26fc0ffffull, 1,  9999999999999999ull, -398 },
+                { L_, 0x77f8000000000000ull, 0,  9007199254740992ull,  369 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int    LINE = DATA[ti].d_line;
+                const Uint64 BITS = DATA[ti].d_bits;
+
+                ASSERTV(LINE, Obj::k_INFINITY_MASK !=
+                                               (BITS & Obj::k_INFINITY_MASK));
+
+                const bool negative = 0 != (BITS & Obj::k_SIGN_MASK);
+
+                Uint64 significand;
+                int    exponent;
+                if (Obj::k_SPECIAL_ENCODING_MASK ==
+                                       (BITS & Obj::k_SPECIAL_ENCODING_MASK)) {
+                    significand = (BITS & Obj::k_SMALL_COEFF_MASK)
+                                | Obj::k_LARGE_COEFF_HIGH_BIT;
+                    exponent    = static_cast<int>(
+                                        BITS >> Obj::k_EXPONENT_SHIFT_LARGE)
+                                & Obj::k_EXPONENT_MASK;
+                }
+                else {
+                    significand = BITS & Obj::k_LARGE_COEFF_MASK;
+                    exponent    = static_cast<int>(
+                                        BITS >> Obj::k_EXPONENT_SHIFT_SMALL)
+                                & Obj::k_EXPONENT_MASK;
+                }
+                exponent -= Obj::k_DECIMAL_EXPONENT_BIAS;
+
+                ASSERTV(LINE, DATA[ti].d_negative    == negative);
+                ASSERTV(LINE, DATA[ti].d_significand == significand);
+                ASSERTV(LINE, DATA[ti].d_exponent    == exponent);
+            }
+
+            // Infinities and NaNs
+
+            ASSERT(Obj::k_INFINITY_MASK ==
+                         (0x7800000000000000ull & Obj::k_INFINITY_MASK));
+            ASSERT(Obj::k_NAN_MASK !=
+                         (0x7800000000000000ull & Obj::k_NAN_MASK));
+            ASSERT(Obj::k_NAN_MASK ==
+                         (0xfc00000000000000ull & Obj::k_NAN_MASK));
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
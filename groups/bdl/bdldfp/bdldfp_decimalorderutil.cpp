@@ -0,0 +1,508 @@
+// bdldfp_decimalorderutil.cpp                                        -*-C++-*-
+#include <bdldfp_decimalorderutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdldfp_decimalorderutil_cpp,"$Id$ $CSID$")
+
+#include <bdldfp_decimalimputil_bid64.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdldfp {
+
+namespace {
+
+typedef bsls::Types::Int64   Int64;
+typedef bsls::Types::Uint64  Uint64;
+typedef DecimalImpUtil_Bid64 Bid64;
+
+const Uint64 k_SMALL_EXPONENT_FIELD  = 0x7fe0000000000000ull;
+    // exponent field of a value whose significand is less than '2 ** 53'
+
+const Int64  k_KEY_SCALE             = 9000000000000000ll;
+    // difference between the order keys of the values having a 16-digit
+    // significand and consecutive exponents
+
+const Int64  k_INFINITY_KEY          = 6913000000000000000ll;
+    // order key of positive infinity
+
+const Uint64 k_POWERS_OF_TEN[] = {
+    1ull,
+    10ull,
+    100ull,
+    1000ull,
+    10000ull,
+    100000ull,
+    1000000ull,
+    10000000ull,
+    100000000ull,
+    1000000000ull,
+    10000000000ull,
+    100000000000ull,
+    1000000000000ull,
+    10000000000000ull,
+    100000000000000ull,
+    1000000000000000ull,
+    10000000000000000ull
+};
+
+const bsl::size_t k_INSERTION_SORT_THRESHOLD = 32;
+    // number of values below which 'sort' uses an insertion sort
+
+inline
+Uint64 bitsOf(const Decimal64& value)
+    // Return the BID encoding of the specified 'value'.
+{
+    return value.data()->d_raw;
+}
+
+inline
+bool isNanBits(Uint64 bits)
+    // Return 'true' if the specified 'bits' encode a NaN, and 'false'
+    // otherwise.
+{
+    return Bid64::k_NAN_MASK == (bits & Bid64::k_NAN_MASK);
+}
+
+inline
+bool isSmallForm(Uint64 bits)
+    // Return 'true' if the specified 'bits' encode a finite value whose
+    // significand is held in the 53 low-order bits (i.e., a significand less
+    // than '2 ** 53'), and 'false' otherwise.
+{
+    return Bid64::k_SPECIAL_ENCODING_MASK !=
+                                      (bits & Bid64::k_SPECIAL_ENCODING_MASK);
+}
+
+inline
+Int64 signedSignificand(Uint64 bits)
+    // Return the significand of the value encoded by the specified 'bits',
+    // negated if the value is negative.  The behavior is undefined unless
+    // 'isSmallForm(bits)'.
+{
+    const Int64 significand =
+                          static_cast<Int64>(bits & Bid64::k_LARGE_COEFF_MASK);
+    const Int64 mask        = -static_cast<Int64>(bits >> 63);
+
+    return (significand ^ mask) - mask;
+}
+
+inline
+Int64 keyFromBits(Uint64 bits)
+    // Return the order key of the value encoded by the specified 'bits'.  The
+    // behavior is undefined if 'bits' encode a NaN.
+{
+    Int64 magnitude;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(isSmallForm(bits))) {
+        Uint64 significand    = bits & Bid64::k_LARGE_COEFF_MASK;
+        int    biasedExponent =
+                       static_cast<int>(bits >> Bid64::k_EXPONENT_SHIFT_SMALL)
+                     & Bid64::k_EXPONENT_MASK;
+
+        magnitude = 0;
+        if (significand) {
+            // Normalize the significand to 16 digits, or the exponent to its
+            // least value.  Note that 't = bitLength * 1233 >> 12' is
+            // 'floor(log10(2 ** bitLength))', so that the number of digits is
+            // 't' or 't + 1'.
+
+            const int bitLength = 64 - bdlb::BitUtil::numLeadingUnsetBits(
+                                           static_cast<bsl::uint64_t>(
+                                                                significand));
+            int       numDigits = (bitLength * 1233) >> 12;
+            numDigits += significand >= k_POWERS_OF_TEN[numDigits];
+
+            int shift = Bid64::k_MAX_DIGITS - numDigits;
+            if (shift > biasedExponent) {
+                shift = biasedExponent;
+            }
+            significand    *= k_POWERS_OF_TEN[shift];
+            biasedExponent -= shift;
+
+            magnitude = biasedExponent * k_KEY_SCALE
+                      + static_cast<Int64>(significand);
+        }
+    }
+    else if (Bid64::k_INFINITY_MASK == (bits & Bid64::k_INFINITY_MASK)) {
+        BSLS_ASSERT_SAFE(!isNanBits(bits));
+
+        magnitude = k_INFINITY_KEY;
+    }
+    else {
+        // A significand of 2 ** 53 or more has 16 digits, unless it is
+        // non-canonical, in which case it is zero.
+
+        const Uint64 significand = (bits & Bid64::k_SMALL_COEFF_MASK)
+                                 | Bid64::k_LARGE_COEFF_HIGH_BIT;
+        const int    biasedExponent =
+                       static_cast<int>(bits >> Bid64::k_EXPONENT_SHIFT_LARGE)
+                     & Bid64::k_EXPONENT_MASK;
+
+        magnitude = significand > Bid64::k_MAX_COEFF
+                  ? 0
+                  : biasedExponent * k_KEY_SCALE
+                                             + static_cast<Int64>(significand);
+    }
+
+    const Int64 mask = -static_cast<Int64>(bits >> 63);
+
+    return (magnitude ^ mask) - mask;
+}
+
+bool haveSameExponent(const Decimal64 *values, bsl::size_t numValues)
+    // Return 'true' if each of the specified 'numValues' elements of the
+    // specified 'values' array is finite, has a significand less than
+    // '2 ** 53', and has the same exponent, and 'false' otherwise.  The
+    // behavior is undefined unless '0 < numValues'.
+{
+    BSLS_ASSERT(0 < numValues);
+
+    const Uint64 first = bitsOf(values[0]);
+
+    if (!isSmallForm(first)) {
+        return false;                                                 // RETURN
+    }
+
+    // The exponent field of a value having a small significand occupies the
+    // bits of 'k_SMALL_EXPONENT_FIELD', which also identify the other
+    // encodings, so that the values match if they agree on those bits.
+
+    Uint64 differences = 0;
+    for (bsl::size_t i = 1; i < numValues; ++i) {
+        differences |= (bitsOf(values[i]) ^ first) & k_SMALL_EXPONENT_FIELD;
+    }
+    return 0 == differences;
+}
+
+template <class COMPARE>
+bsl::size_t findExtreme(const Decimal64 *values,
+                        bsl::size_t      numValues,
+                        COMPARE          compare)
+    // Return the index of the first of the elements of the specified
+    // 'values' array of the specified 'numValues' elements that are not NaN
+    // and for which no other such element is ordered before it by the
+    // specified 'compare' predicate on 'Int64' keys, or 'numValues' if every
+    // element is NaN.
+{
+    if (0 == numValues) {
+        return 0;                                                     // RETURN
+    }
+
+    if (haveSameExponent(values, numValues)) {
+        // Find the extreme significand, and then its first occurrence.  The
+        // first loop does not depend on the index, so that it may be
+        // vectorized.
+
+        Int64 extreme = signedSignificand(bitsOf(values[0]));
+        for (bsl::size_t i = 1; i < numValues; ++i) {
+            const Int64 key = signedSignificand(bitsOf(values[i]));
+            extreme = compare(key, extreme) ? key : extreme;
+        }
+
+        bsl::size_t index = 0;
+        while (signedSignificand(bitsOf(values[index])) != extreme) {
+            ++index;
+        }
+        return index;                                                 // RETURN
+    }
+
+    bsl::size_t index   = numValues;
+    Int64       extreme = 0;
+
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        const Uint64 bits = bitsOf(values[i]);
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(isNanBits(bits))) {
+            continue;                                               // CONTINUE
+        }
+
+        const Int64 key = keyFromBits(bits);
+
+        if (numValues == index || compare(key, extreme)) {
+            index   = i;
+            extreme = key;
+        }
+    }
+    return index;
+}
+
+struct Less {
+    // This 'struct' provides a predicate ordering 'Int64' keys ascending.
+
+    bool operator()(Int64 lhs, Int64 rhs) const
+        // Return 'true' if the specified 'lhs' is less than the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs < rhs;
+    }
+};
+
+struct Greater {
+    // This 'struct' provides a predicate ordering 'Int64' keys descending.
+
+    bool operator()(Int64 lhs, Int64 rhs) const
+        // Return 'true' if the specified 'lhs' is greater than the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs > rhs;
+    }
+};
+
+void insertionSort(Uint64 *keys, Decimal64 *values, bsl::size_t numValues)
+    // Sort the specified 'numValues' elements of the specified 'keys' array
+    // into ascending order, applying the same permutation to the elements of
+    // the specified 'values' array.  The sort is stable.
+{
+    for (bsl::size_t i = 1; i < numValues; ++i) {
+        const Uint64    key   = keys[i];
+        const Decimal64 value = values[i];
+
+        bsl::size_t j = i;
+        for (; j > 0 && keys[j - 1] > key; --j) {
+            keys[j]   = keys[j - 1];
+            values[j] = values[j - 1];
+        }
+        keys[j]   = key;
+        values[j] = value;
+    }
+}
+
+void radixSort(Uint64      *keys,
+               Decimal64   *values,
+               Uint64      *keysBuffer,
+               Decimal64   *valuesBuffer,
+               bsl::size_t  numValues)
+    // Sort the specified 'numValues' elements of the specified 'keys' array
+    // into ascending order, applying the same permutation to the elements of
+    // the specified 'values' array, using the specified 'keysBuffer' and
+    // 'valuesBuffer' arrays of 'numValues' elements as scratch space.  The
+    // sort is stable.
+{
+    const int k_RADIX_BITS = 8;
+    const int k_RADIX      = 1 << k_RADIX_BITS;
+    const int k_NUM_PASSES = 64 / k_RADIX_BITS;
+
+    bsl::size_t counts[k_NUM_PASSES][k_RADIX];
+    bsl::memset(counts, 0, sizeof counts);
+
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        const Uint64 key = keys[i];
+        for (int pass = 0; pass < k_NUM_PASSES; ++pass) {
+            ++counts[pass][(key >> (pass * k_RADIX_BITS)) & (k_RADIX - 1)];
+        }
+    }
+
+    Uint64    *srcKeys   = keys;
+    Decimal64 *srcValues = values;
+    Uint64    *dstKeys   = keysBuffer;
+    Decimal64 *dstValues = valuesBuffer;
+
+    for (int pass = 0; pass < k_NUM_PASSES; ++pass) {
+        const int    shift  = pass * k_RADIX_BITS;
+        bsl::size_t *count  = counts[pass];
+
+        if (numValues == count[(srcKeys[0] >> shift) & (k_RADIX - 1)]) {
+            // Every key has the same digit in this pass.
+
+            continue;                                               // CONTINUE
+        }
+
+        bsl::size_t offset = 0;
+        for (int digit = 0; digit < k_RADIX; ++digit) {
+            const bsl::size_t n = count[digit];
+            count[digit] = offset;
+            offset      += n;
+        }
+
+        for (bsl::size_t i = 0; i < numValues; ++i) {
+            const Uint64      key      = srcKeys[i];
+            const bsl::size_t position =
+                                       count[(key >> shift) & (k_RADIX - 1)]++;
+
+            dstKeys[position]   = key;
+            dstValues[position] = srcValues[i];
+        }
+
+        Uint64    *tmpKeys   = srcKeys;
+        Decimal64 *tmpValues = srcValues;
+        srcKeys   = dstKeys;
+        srcValues = dstValues;
+        dstKeys   = tmpKeys;
+        dstValues = tmpValues;
+    }
+
+    if (srcValues != values) {
+        bsl::memcpy(values, srcValues, numValues * sizeof *values);
+    }
+}
+
+}  // close unnamed namespace
+
+                           // -----------------------
+                           // struct DecimalOrderUtil
+                           // -----------------------
+
+// CLASS METHODS
+bsl::size_t DecimalOrderUtil::findMax(const Decimal64 *values,
+                                      bsl::size_t      numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    return findExtreme(values, numValues, Greater());
+}
+
+bsl::size_t DecimalOrderUtil::findMin(const Decimal64 *values,
+                                      bsl::size_t      numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    return findExtreme(values, numValues, Less());
+}
+
+void DecimalOrderUtil::lessThan(bool            *results,
+                                const Decimal64 *lhs,
+                                const Decimal64 *rhs,
+                                bsl::size_t      numValues)
+{
+    BSLS_ASSERT(results || 0 == numValues);
+    BSLS_ASSERT(lhs     || 0 == numValues);
+    BSLS_ASSERT(rhs     || 0 == numValues);
+
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        const Uint64 x = bitsOf(lhs[i]);
+        const Uint64 y = bitsOf(rhs[i]);
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                              0 == ((x ^ y) & k_SMALL_EXPONENT_FIELD)
+                           && isSmallForm(x))) {
+            // Same exponent: compare the signed significands.
+
+            results[i] = signedSignificand(x) < signedSignificand(y);
+        }
+        else if (isNanBits(x) || isNanBits(y)) {
+            results[i] = false;
+        }
+        else {
+            results[i] = keyFromBits(x) < keyFromBits(y);
+        }
+    }
+}
+
+bsls::Types::Int64 DecimalOrderUtil::orderKey(Decimal64 value)
+{
+    BSLS_ASSERT(!isNanBits(bitsOf(value)));
+
+    return keyFromBits(bitsOf(value));
+}
+
+void DecimalOrderUtil::orderKeys(bsls::Types::Int64 *keys,
+                                 const Decimal64    *values,
+                                 bsl::size_t         numValues)
+{
+    BSLS_ASSERT(keys   || 0 == numValues);
+    BSLS_ASSERT(values || 0 == numValues);
+
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        BSLS_ASSERT_SAFE(!isNanBits(bitsOf(values[i])));
+
+        keys[i] = keyFromBits(bitsOf(values[i]));
+    }
+}
+
+void DecimalOrderUtil::sort(Decimal64        *values,
+                            bsl::size_t       numValues,
+                            bslma::Allocator *basicAllocator)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    if (numValues < 2) {
+        return;                                                       // RETURN
+    }
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+
+    // Compute the keys, offset so that they sort as unsigned integers, and
+    // move the NaNs (if any) to the end of the array.  If the values have the
+    // same exponent, their significands serve as keys.
+
+    bsl::vector<Uint64> keys(allocator);
+    keys.resize(2 * numValues);
+
+    bsl::size_t numOrdered = 0;
+
+    if (haveSameExponent(values, numValues)) {
+        for (bsl::size_t i = 0; i < numValues; ++i) {
+            keys[i] = static_cast<Uint64>(signedSignificand(bitsOf(values[i])))
+                    ^ Bid64::k_SIGN_MASK;
+        }
+        numOrdered = numValues;
+    }
+    else {
+        bsl::vector<Decimal64> nans(allocator);
+
+        for (bsl::size_t i = 0; i < numValues; ++i) {
+            const Uint64 bits = bitsOf(values[i]);
+
+            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(isNanBits(bits))) {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+                nans.push_back(values[i]);
+                continue;                                           // CONTINUE
+            }
+
+            keys[numOrdered]   = static_cast<Uint64>(keyFromBits(bits))
+                               ^ Bid64::k_SIGN_MASK;
+            values[numOrdered] = values[i];
+            ++numOrdered;
+        }
+
+        for (bsl::size_t i = 0; i < nans.size(); ++i) {
+            values[numOrdered + i] = nans[i];
+        }
+    }
+
+    if (numOrdered < k_INSERTION_SORT_THRESHOLD) {
+        insertionSort(keys.data(), values, numOrdered);
+    }
+    else {
+        bsl::vector<Decimal64> valuesBuffer(numOrdered,
+                                            Decimal64(),
+                                            allocator);
+
+        radixSort(keys.data(),
+                  values,
+                  keys.data() + numValues,
+                  valuesBuffer.data(),
+                  numOrdered);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
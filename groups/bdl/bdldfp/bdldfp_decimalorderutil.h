@@ -0,0 +1,196 @@
+// bdldfp_decimalorderutil.h                                          -*-C++-*-
+#ifndef INCLUDED_BDLDFP_DECIMALORDERUTIL
+#define INCLUDED_BDLDFP_DECIMALORDERUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$")
+
+//@PURPOSE: Provide integer order keys, comparison, and sorting for decimals.
+//
+//@CLASSES:
+//  bdldfp::DecimalOrderUtil: namespace for ordering 'Decimal64' values
+//
+//@SEE_ALSO: bdldfp_decimal, bdldfp_decimalutil
+//
+//@DESCRIPTION: This component provides a namespace,
+// 'bdldfp::DecimalOrderUtil', containing functions that compare, find the
+// extremes of, and sort arrays of 'bdldfp::Decimal64' values using integer
+// arithmetic, rather than calling the decimal floating-point library for each
+// comparison.
+//
+///Order Keys
+///----------
+// Every 'Decimal64' value that is not a NaN is mapped by 'orderKey' to a
+// 64-bit signed integer, its *order* *key*, such that for any two such values
+// 'x' and 'y':
+//..
+//  x <  y  if and only if  orderKey(x) <  orderKey(y)
+//  x == y  if and only if  orderKey(x) == orderKey(y)
+//..
+// In particular, all of the members of a cohort (e.g., '1.0' and '1.00'), and
+// positive and negative zero, have the same order key.  Order keys may
+// therefore be stored, compared, hashed, and sorted in place of the values
+// from which they were computed (e.g., to bucket prices into a histogram).
+//
+// The order key of a finite value is computed by normalizing the value to a
+// 16-digit significand 'c' (or, for the smallest values, to the least
+// exponent) having a biased exponent 'b' (in the range '[0 .. 767]'), and
+// forming 'b * 9 * 10 ** 15 + c', which is then negated for negative values.
+// The order keys of finite values thus lie in the range
+// '[-6912999999999999999 .. 6912999999999999999]', and positive and negative
+// infinity have the order keys '6913000000000000000' and
+// '-6913000000000000000', respectively.  NaNs are unordered, and have no order
+// key.
+//
+///Batch Operations
+///----------------
+// 'lessThan', 'findMin', 'findMax', and 'sort' operate on arrays of values.
+// Where all of the values involved have the same exponent (e.g., prices
+// quoted to a fixed number of decimal places), they are compared using their
+// signed significands directly; otherwise, they are compared using their
+// order keys.  The loops are written so that the compiler may vectorize them.
+//
+// 'sort' is a stable least-significant-digit radix sort on the order keys,
+// whose passes are skipped for the bytes that all of the keys have in common
+// (so that, e.g., prices having few distinct significant digits are sorted in
+// few passes).  NaNs are placed after all other values.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sorting the Levels of an Order Book
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have received a snapshot of the bid prices of an order
+// book, in no particular order:
+//..
+//  bdldfp::Decimal64 prices[] = { BDLDFP_DECIMAL_DD(100.25),
+//                                 BDLDFP_DECIMAL_DD(99.75),
+//                                 BDLDFP_DECIMAL_DD(100.5),
+//                                 BDLDFP_DECIMAL_DD(100.00),
+//                                 BDLDFP_DECIMAL_DD(99.5) };
+//  const bsl::size_t numPrices = sizeof prices / sizeof *prices;
+//..
+// First, we find the best (highest) bid:
+//..
+//  bsl::size_t best = bdldfp::DecimalOrderUtil::findMax(prices, numPrices);
+//  assert(BDLDFP_DECIMAL_DD(100.5) == prices[best]);
+//..
+// Then, we sort the prices into ascending order:
+//..
+//  bdldfp::DecimalOrderUtil::sort(prices, numPrices);
+//
+//  assert(BDLDFP_DECIMAL_DD(99.5)   == prices[0]);
+//  assert(BDLDFP_DECIMAL_DD(99.75)  == prices[1]);
+//  assert(BDLDFP_DECIMAL_DD(100.00) == prices[2]);
+//  assert(BDLDFP_DECIMAL_DD(100.25) == prices[3]);
+//  assert(BDLDFP_DECIMAL_DD(100.5)  == prices[4]);
+//..
+// Finally, we compute the order keys of the prices, which we can use, e.g.,
+// as the keys of a hash table that aggregates quantities by price level,
+// without regard to the number of decimal places with which each price was
+// quoted:
+//..
+//  assert(bdldfp::DecimalOrderUtil::orderKey(BDLDFP_DECIMAL_DD(100.0))
+//      == bdldfp::DecimalOrderUtil::orderKey(BDLDFP_DECIMAL_DD(100.00)));
+//  assert(bdldfp::DecimalOrderUtil::orderKey(prices[0])
+//       < bdldfp::DecimalOrderUtil::orderKey(prices[1]));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdldfp_decimal.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdldfp {
+
+                           // =======================
+                           // struct DecimalOrderUtil
+                           // =======================
+
+struct DecimalOrderUtil {
+    // This 'struct' provides a namespace for functions that order
+    // 'Decimal64' values using integer arithmetic.
+
+    // CLASS METHODS
+    static bsl::size_t findMax(const Decimal64 *values,
+                               bsl::size_t      numValues);
+        // Return the index of the first of the greatest of the specified
+        // 'numValues' elements of the specified 'values' array that are not
+        // NaN, or 'numValues' if every element is NaN (or 'numValues' is 0).
+        // The behavior is undefined unless 'values' refers to an array of at
+        // least 'numValues' elements.
+
+    static bsl::size_t findMin(const Decimal64 *values,
+                               bsl::size_t      numValues);
+        // Return the index of the first of the least of the specified
+        // 'numValues' elements of the specified 'values' array that are not
+        // NaN, or 'numValues' if every element is NaN (or 'numValues' is 0).
+        // The behavior is undefined unless 'values' refers to an array of at
+        // least 'numValues' elements.
+
+    static void lessThan(bool            *results,
+                         const Decimal64 *lhs,
+                         const Decimal64 *rhs,
+                         bsl::size_t      numValues);
+        // Load into each of the specified 'numValues' elements of the
+        // specified 'results' array the result of comparing the corresponding
+        // elements of the specified 'lhs' and 'rhs' arrays using
+        // 'operator<', i.e., 'true' if the element of 'lhs' is less than that
+        // of 'rhs', and 'false' otherwise (in particular, if either is NaN).
+        // The behavior is undefined unless 'results', 'lhs', and 'rhs' each
+        // refer to an array of at least 'numValues' elements.
+
+    static bsls::Types::Int64 orderKey(Decimal64 value);
+        // Return the order key of the specified 'value'.  The behavior is
+        // undefined if 'value' is NaN.  See {Order Keys}.
+
+    static void orderKeys(bsls::Types::Int64 *keys,
+                          const Decimal64    *values,
+                          bsl::size_t         numValues);
+        // Load into each of the specified 'numValues' elements of the
+        // specified 'keys' array the order key of the corresponding element
+        // of the specified 'values' array.  The behavior is undefined unless
+        // 'keys' and 'values' each refer to an array of at least 'numValues'
+        // elements, and no element of 'values' is NaN.
+
+    static void sort(Decimal64        *values,
+                     bsl::size_t       numValues,
+                     bslma::Allocator *basicAllocator = 0);
+        // Sort the specified 'numValues' elements of the specified 'values'
+        // array into ascending order, as defined by 'operator<', placing any
+        // NaNs after all of the other elements.  The sort is stable: equal
+        // elements (e.g., members of the same cohort, or positive and
+        // negative zero), and NaNs, retain their relative order.  Optionally
+        // specify a 'basicAllocator' used to supply temporary memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'values' refers to an array
+        // of at least 'numValues' elements.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
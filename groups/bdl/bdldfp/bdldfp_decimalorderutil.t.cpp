@@ -0,0 +1,1098 @@
+// bdldfp_decimalorderutil.t.cpp                                      -*-C++-*-
+#include <bdldfp_decimalorderutil.h>
+
+#include <bdldfp_decimal.h>
+#include <bdldfp_decimalutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::atoi;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a utility whose functions order 'Decimal64'
+// values using integer arithmetic.  Each function is tested by comparing its
+// results with those of the comparison operators of 'Decimal64' (which are
+// implemented by the decimal floating-point library) for tables of chosen
+// values, and for pseudo-random values covering cohorts, zeros, subnormal
+// values, significands that do not fit in 53 bits, and special values.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 5] size_t findMax(const Decimal64 *, size_t);
+// [ 5] size_t findMin(const Decimal64 *, size_t);
+// [ 4] void lessThan(bool *, const Decimal64 *, const Decimal64 *, size_t);
+// [ 2] Int64 orderKey(Decimal64);
+// [ 3] void orderKeys(Int64 *, const Decimal64 *, size_t);
+// [ 6] void sort(Decimal64 *, size_t, bslma::Allocator * = 0);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdldfp::DecimalOrderUtil Obj;
+typedef bdldfp::Decimal64        Decimal64;
+typedef bdldfp::DecimalUtil      DecUtil;
+typedef bsls::Types::Int64       Int64;
+typedef bsls::Types::Uint64      Uint64;
+
+typedef bsl::numeric_limits<Decimal64> Limits;
+
+// ============================================================================
+//              GLOBAL HELPER FUNCTIONS AND CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+unsigned int nextRandom(Uint64 *seed)
+    // Return the next pseudo-random number generated from the specified
+    // 'seed', and update 'seed'.
+{
+    *seed = *seed * 6364136223846793005ull + 1442695040888963407ull;
+    return static_cast<unsigned int>(*seed >> 33);
+}
+
+Decimal64 randomDecimal64(Uint64 *seed,
+                          int     maxDigits,
+                          int     minExponent,
+                          int     maxExponent)
+    // Return a pseudo-random 'Decimal64' value, generated from the specified
+    // 'seed', having a random sign, a significand of at most the specified
+    // 'maxDigits' decimal digits, and an exponent in the range specified by
+    // 'minExponent' and 'maxExponent'.  Update 'seed'.
+{
+    long long significand = 0;
+    const int numDigits   = nextRandom(seed) % (maxDigits + 1);
+    for (int i = 0; i < numDigits; ++i) {
+        significand = significand * 10 + nextRandom(seed) % 10;
+    }
+    if (nextRandom(seed) & 1) {
+        significand = -significand;
+    }
+
+    const int exponent = minExponent
+                      + nextRandom(seed) % (maxExponent - minExponent + 1);
+
+    return DecUtil::makeDecimalRaw64(significand, exponent);
+}
+
+Decimal64 randomOrderTestValue(Uint64 *seed, bool withNaNs)
+    // Return a pseudo-random 'Decimal64' value, generated from the specified
+    // 'seed', that is drawn from a mixture of distributions chosen to produce
+    // equal values having different encodings, values near the extremes of
+    // the exponent range, values having significands of 16 digits, and
+    // infinities, and (if the specified 'withNaNs' is 'true') NaNs.  Update
+    // 'seed'.
+{
+    switch (nextRandom(seed) % 8) {
+      case 0: {
+        return randomDecimal64(seed, 16, -398, 369);                  // RETURN
+      }
+      case 1: {
+        return randomDecimal64(seed, 16, -398, -380);                 // RETURN
+      }
+      case 2: {
+        return randomDecimal64(seed, 16, 350, 369);                   // RETURN
+      }
+      case 3: {
+        // Members of the cohorts of a few small values.
+
+        static const int k_BASES[] = { 0, 1, 5, 25, 100, 9999 };
+        const int base  = k_BASES[nextRandom(seed) % 6];
+        const int scale = nextRandom(seed) % 10;
+
+        long long significand = base;
+        for (int i = 0; i < scale; ++i) {
+            significand *= 10;
+        }
+        if (nextRandom(seed) & 1) {
+            significand = -significand;
+        }
+        const int exponent = static_cast<int>(nextRandom(seed) % 3) - scale;
+
+        return DecUtil::makeDecimalRaw64(significand, exponent);      // RETURN
+      }
+      case 4: {
+        // 16-digit significands at least '2 ** 53'.
+
+        const long long high   = nextRandom(seed);
+        const long long offset = ((high << 20) | nextRandom(seed) % (1 << 20))
+                               % 992800745259008ll;
+        const int exponent = static_cast<int>(nextRandom(seed) % 768) - 398;
+        const Decimal64 value = DecUtil::makeDecimalRaw64(
+                                                  9007199254740992ll + offset,
+                                                  exponent);
+        return nextRandom(seed) & 1 ? value : -value;                 // RETURN
+      }
+      case 5: {
+        if (withNaNs && 0 == nextRandom(seed) % 4) {
+            return Limits::quiet_NaN();                               // RETURN
+        }
+        return nextRandom(seed) & 1 ? Limits::infinity()
+                                    : -Limits::infinity();            // RETURN
+      }
+      default: {
+        return randomDecimal64(seed, 4, -3, 3);                       // RETURN
+      }
+    }
+}
+
+Decimal64 fromBits(Uint64 bits)
+    // Return the 'Decimal64' value having the specified 'bits' as its BID
+    // encoding.
+{
+    Decimal64 result;
+    result.data()->d_raw = bits;
+    return result;
+}
+
+bool isNan(Decimal64 value)
+    // Return 'true' if the specified 'value' is NaN, and 'false' otherwise.
+{
+    return value != value;
+}
+
+bool nanLastLess(Decimal64 lhs, Decimal64 rhs)
+    // Return 'true' if the specified 'lhs' is ordered before the specified
+    // 'rhs' when NaNs are ordered after all other values, and 'false'
+    // otherwise.
+{
+    return !isNan(lhs) && (isNan(rhs) || lhs < rhs);
+}
+
+bool isIdentical(Decimal64 lhs, Decimal64 rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same encoding,
+    // and 'false' otherwise.
+{
+    return lhs.data()->d_raw == rhs.data()->d_raw;
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard guard(&ta);
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sorting the Levels of an Order Book
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have received a snapshot of the bid prices of an order
+// book, in no particular order:
+//..
+    bdldfp::Decimal64 prices[] = { BDLDFP_DECIMAL_DD(100.25),
+                                   BDLDFP_DECIMAL_DD(99.75),
+                                   BDLDFP_DECIMAL_DD(100.5),
+                                   BDLDFP_DECIMAL_DD(100.00),
+                                   BDLDFP_DECIMAL_DD(99.5) };
+    const bsl::size_t numPrices = sizeof prices / sizeof *prices;
+//..
+// First, we find the best (highest) bid:
+//..
+    bsl::size_t best = bdldfp::DecimalOrderUtil::findMax(prices, numPrices);
+    ASSERT(BDLDFP_DECIMAL_DD(100.5) == prices[best]);
+//..
+// Then, we sort the prices into ascending order:
+//..
+    bdldfp::DecimalOrderUtil::sort(prices, numPrices);
+
+    ASSERT(BDLDFP_DECIMAL_DD(99.5)   == prices[0]);
+    ASSERT(BDLDFP_DECIMAL_DD(99.75)  == prices[1]);
+    ASSERT(BDLDFP_DECIMAL_DD(100.00) == prices[2]);
+    ASSERT(BDLDFP_DECIMAL_DD(100.25) == prices[3]);
+    ASSERT(BDLDFP_DECIMAL_DD(100.5)  == prices[4]);
+//..
+// Finally, we compute the order keys of the prices, which we can use, e.g.,
+// as the keys of a hash table that aggregates quantities by price level,
+// without regard to the number of decimal places with which each price was
+// quoted:
+//..
+    ASSERT(bdldfp::DecimalOrderUtil::orderKey(BDLDFP_DECIMAL_DD(100.0))
+        == bdldfp::DecimalOrderUtil::orderKey(BDLDFP_DECIMAL_DD(100.00)));
+    ASSERT(bdldfp::DecimalOrderUtil::orderKey(prices[0])
+         < bdldfp::DecimalOrderUtil::orderKey(prices[1]));
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'sort'
+        //
+        // Concerns:
+        //: 1 'sort' orders the values as 'operator<' does, placing NaNs after
+        //:   all other values.
+        //:
+        //: 2 The sort is stable: equal values having different encodings, and
+        //:   NaNs, retain their relative order.
+        //:
+        //: 3 Both the insertion sort used for few values and the radix sort
+        //:   used for many values, and both the same-exponent and the general
+        //:   keys, are correct.
+        //:
+        //: 4 Temporary memory is supplied by the specified allocator (or the
+        //:   default allocator if none is specified), and is released.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For arrays of several lengths, including lengths on either side
+        //:   of the insertion-sort threshold, of pseudo-random values drawn
+        //:   from several distributions (including distributions of values
+        //:   having the same exponent, and of values having few distinct
+        //:   significant digits), verify that the result of 'sort' is
+        //:   identical, encoding by encoding, to that of 'bsl::stable_sort'
+        //:   using 'operator<' with NaNs ordered last.  (C-1..3)
+        //:
+        //: 2 Use test allocators to verify that memory is taken from the
+        //:   specified (or default) allocator, and that all of it is
+        //:   released.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   void sort(Decimal64 *, size_t, bslma::Allocator * = 0);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'sort'" << endl
+                          << "==============" << endl;
+
+        static const int k_LENGTHS[] = {
+            0, 1, 2, 3, 5, 16, 31, 32, 33, 64, 100, 257, 1000, 4096
+        };
+        const int NUM_LENGTHS = static_cast<int>(sizeof k_LENGTHS
+                                               / sizeof *k_LENGTHS);
+
+        const int NUM_DISTRIBUTIONS = 4;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        Uint64 seed = 48;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LENGTH = k_LENGTHS[ti];
+
+            for (int di = 0; di < NUM_DISTRIBUTIONS; ++di) {
+                if (veryVerbose) { P_(LENGTH) P(di) }
+
+                bsl::vector<Decimal64> values(&ta);
+                for (int i = 0; i < LENGTH; ++i) {
+                    switch (di) {
+                      case 0: {
+                        values.push_back(randomOrderTestValue(&seed, true));
+                      } break;
+                      case 1: {
+                        values.push_back(randomOrderTestValue(&seed, false));
+                      } break;
+                      case 2: {
+                        // Prices quoted to four decimal places.
+
+                        values.push_back(DecUtil::makeDecimalRaw64(
+                                 static_cast<int>(nextRandom(&seed) % 2000000)
+                                                                    - 1000000,
+                                 -4));
+                      } break;
+                      default: {
+                        // Few distinct values, in many cohorts.
+
+                        values.push_back(randomDecimal64(&seed, 2, -2, 2));
+                      } break;
+                    }
+                }
+
+                bsl::vector<Decimal64> expected(values, &ta);
+                bsl::stable_sort(expected.begin(),
+                                 expected.end(),
+                                 &nanLastLess);
+
+                const Int64 numBlocks      = ta.numBlocksTotal();
+                const Int64 numBlocksInUse = ta.numBlocksInUse();
+
+                Obj::sort(values.data(), values.size(), &ta);
+
+                ASSERTV(LENGTH, di, numBlocksInUse == ta.numBlocksInUse());
+                ASSERTV(LENGTH, di, 0 == defaultAllocator.numBlocksTotal());
+                if (LENGTH < 2) {
+                    ASSERTV(LENGTH, di, numBlocks == ta.numBlocksTotal());
+                }
+
+                for (int i = 0; i < LENGTH; ++i) {
+                    ASSERTV(LENGTH, di, i, isIdentical(expected[i],
+                                                       values[i]));
+                }
+            }
+        }
+
+        if (verbose) cout << "\tDefault allocator." << endl;
+        {
+            bsl::vector<Decimal64> values(&ta);
+            for (int i = 0; i < 100; ++i) {
+                values.push_back(randomOrderTestValue(&seed, true));
+            }
+            bsl::vector<Decimal64> expected(values, &ta);
+            bsl::stable_sort(expected.begin(), expected.end(), &nanLastLess);
+
+            bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard guard(&da);
+
+            Obj::sort(values.data(), values.size());
+
+            ASSERT(0 <  da.numBlocksTotal());
+            ASSERT(0 == da.numBlocksInUse());
+
+            for (int i = 0; i < 100; ++i) {
+                ASSERTV(i, isIdentical(expected[i], values[i]));
+            }
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Decimal64 value;
+
+            ASSERT_PASS(Obj::sort(0, 0, &ta));
+            ASSERT_PASS(Obj::sort(&value, 1, &ta));
+            ASSERT_FAIL(Obj::sort(0, 1, &ta));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'findMin' AND 'findMax'
+        //
+        // Concerns:
+        //: 1 'findMin' and 'findMax' return the index of the first of the
+        //:   least (or greatest) values, as defined by 'operator<', ignoring
+        //:   NaNs.
+        //:
+        //: 2 If there are no values, or every value is NaN, the number of
+        //:   values is returned.
+        //:
+        //: 3 Both the same-exponent and the general paths are correct.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a table of arrays having chosen values, verify the results.
+        //:   (C-1..2)
+        //:
+        //: 2 For arrays of pseudo-random values of several lengths and
+        //:   distributions, compare the results with those of a loop using
+        //:   'operator<'.  (C-1, 3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   size_t findMax(const Decimal64 *, size_t);
+        //   size_t findMin(const Decimal64 *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'findMin' AND 'findMax'" << endl
+                          << "===============================" << endl;
+
+        const Decimal64 NAN_VALUE = Limits::quiet_NaN();
+        const Decimal64 INF       = Limits::infinity();
+
+        if (verbose) cout << "\tChosen values." << endl;
+        {
+            const Decimal64 ONE      = DecUtil::makeDecimalRaw64(1, 0);
+            const Decimal64 ONE_0    = DecUtil::makeDecimalRaw64(10, -1);
+            const Decimal64 TWO      = DecUtil::makeDecimalRaw64(2, 0);
+            const Decimal64 ZERO     = DecUtil::makeDecimalRaw64(0, 0);
+            const Decimal64 NEG_ZERO = -ZERO;
+
+            const Decimal64 A1[] = { ONE, ONE_0, ONE };
+            ASSERT(0 == Obj::findMin(A1, 3));
+            ASSERT(0 == Obj::findMax(A1, 3));
+
+            const Decimal64 A2[] = { ONE_0, TWO, ONE, TWO };
+            ASSERT(0 == Obj::findMin(A2, 4));
+            ASSERT(1 == Obj::findMax(A2, 4));
+
+            const Decimal64 A3[] = { NAN_VALUE, NAN_VALUE };
+            ASSERT(2 == Obj::findMin(A3, 2));
+            ASSERT(2 == Obj::findMax(A3, 2));
+
+            const Decimal64 A4[] = { NAN_VALUE, ONE, -INF, NAN_VALUE, INF };
+            ASSERT(2 == Obj::findMin(A4, 5));
+            ASSERT(4 == Obj::findMax(A4, 5));
+
+            const Decimal64 A5[] = { NEG_ZERO, ZERO, NEG_ZERO };
+            ASSERT(0 == Obj::findMin(A5, 3));
+            ASSERT(0 == Obj::findMax(A5, 3));
+
+            const Decimal64 A6[] = { ZERO, -ONE, ONE, -ONE, ONE };
+            ASSERT(1 == Obj::findMin(A6, 5));
+            ASSERT(2 == Obj::findMax(A6, 5));
+
+            ASSERT(0 == Obj::findMin(A1, 0));
+            ASSERT(0 == Obj::findMax(A1, 0));
+        }
+
+        if (verbose) cout << "\tPseudo-random values." << endl;
+        {
+            bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+            Uint64 seed = 5;
+
+            for (int length = 1; length <= 200; length += 1 + length / 4) {
+                for (int iter = 0; iter < 50; ++iter) {
+                    const bool SAME_EXPONENT = iter & 1;
+
+                    bsl::vector<Decimal64> values(&ta);
+                    for (int i = 0; i < length; ++i) {
+                        values.push_back(SAME_EXPONENT
+                                         ? DecUtil::makeDecimalRaw64(
+                                               static_cast<int>(
+                                                  nextRandom(&seed) % 20) - 10,
+                                               -2)
+                                         : randomOrderTestValue(&seed, true));
+                    }
+
+                    bsl::size_t expMin = length;
+                    bsl::size_t expMax = length;
+                    for (int i = 0; i < length; ++i) {
+                        if (isNan(values[i])) {
+                            continue;                               // CONTINUE
+                        }
+                        if (static_cast<bsl::size_t>(length) == expMin
+                         || values[i] < values[expMin]) {
+                            expMin = i;
+                        }
+                        if (static_cast<bsl::size_t>(length) == expMax
+                         || values[i] > values[expMax]) {
+                            expMax = i;
+                        }
+                    }
+
+                    ASSERTV(length, iter,
+                            expMin == Obj::findMin(values.data(), length));
+                    ASSERTV(length, iter,
+                            expMax == Obj::findMax(values.data(), length));
+                }
+            }
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj::findMin(0, 0));
+            ASSERT_FAIL(Obj::findMin(0, 1));
+            ASSERT_PASS(Obj::findMax(0, 0));
+            ASSERT_FAIL(Obj::findMax(0, 1));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'lessThan'
+        //
+        // Concerns:
+        //: 1 Each result is that of 'operator<' applied to the corresponding
+        //:   elements, and in particular is 'false' if either is NaN.
+        //:
+        //: 2 Both the same-exponent and the general paths are correct.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For arrays of pairs of pseudo-random values, some pairs having
+        //:   the same exponent, compare the results with those of
+        //:   'operator<'.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   void lessThan(bool*, const Decimal64*, const Decimal64*, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'lessThan'" << endl
+                          << "==================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        const int NUM_VALUES = 10000;
+
+        Uint64 seed = 4;
+
+        bsl::vector<Decimal64> lhs(&ta);
+        bsl::vector<Decimal64> rhs(&ta);
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            if (i & 1) {
+                const int exponent = static_cast<int>(nextRandom(&seed) % 768)
+                                   - 398;
+                lhs.push_back(randomDecimal64(&seed, 15, exponent, exponent));
+                rhs.push_back(randomDecimal64(&seed, 15, exponent, exponent));
+            }
+            else {
+                lhs.push_back(randomOrderTestValue(&seed, true));
+                rhs.push_back(randomOrderTestValue(&seed, true));
+            }
+        }
+
+        bsl::vector<char> results(NUM_VALUES + 1, 'x', &ta);
+        bool *RESULTS = reinterpret_cast<bool *>(results.data());
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            RESULTS[i] = !(lhs[i] < rhs[i]);
+        }
+
+        Obj::lessThan(RESULTS, lhs.data(), rhs.data(), NUM_VALUES);
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            ASSERTV(i, (lhs[i] < rhs[i]) == RESULTS[i]);
+        }
+        ASSERT('x' == results[NUM_VALUES]);
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bool      result;
+            Decimal64 value;
+
+            ASSERT_PASS(Obj::lessThan(0, 0, 0, 0));
+            ASSERT_PASS(Obj::lessThan(&result, &value, &value, 1));
+            ASSERT_FAIL(Obj::lessThan(0, &value, &value, 1));
+            ASSERT_FAIL(Obj::lessThan(&result, 0, &value, 1));
+            ASSERT_FAIL(Obj::lessThan(&result, &value, 0, 1));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'orderKeys'
+        //
+        // Concerns:
+        //: 1 Each key loaded is the order key of the corresponding value.
+        //:
+        //: 2 No element beyond the specified number is modified.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For arrays of pseudo-random values of several lengths, compare
+        //:   the keys with those returned by 'orderKey', and verify that the
+        //:   element following the last is unchanged.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   void orderKeys(Int64 *, const Decimal64 *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'orderKeys'" << endl
+                          << "===================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        Uint64 seed = 3;
+
+        for (int length = 0; length <= 100; ++length) {
+            bsl::vector<Decimal64> values(&ta);
+            for (int i = 0; i < length; ++i) {
+                values.push_back(randomOrderTestValue(&seed, false));
+            }
+
+            bsl::vector<Int64> keys(length + 1, -1, &ta);
+
+            Obj::orderKeys(keys.data(), values.data(), length);
+
+            for (int i = 0; i < length; ++i) {
+                ASSERTV(length, i, Obj::orderKey(values[i]) == keys[i]);
+            }
+            ASSERTV(length, -1 == keys[length]);
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Int64           key;
+            const Decimal64 VALUES[] = { DecUtil::makeDecimalRaw64(1, 0),
+                                         Limits::quiet_NaN() };
+
+            ASSERT_PASS(Obj::orderKeys(0, 0, 0));
+            ASSERT_PASS(Obj::orderKeys(&key, VALUES, 1));
+            ASSERT_FAIL(Obj::orderKeys(0, VALUES, 1));
+            ASSERT_FAIL(Obj::orderKeys(&key, 0, 1));
+            ASSERT_SAFE_FAIL(Obj::orderKeys(&key, VALUES + 1, 1));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'orderKey'
+        //
+        // Concerns:
+        //: 1 The order key of a value is that documented in {Order Keys}.
+        //:
+        //: 2 The order keys of two values compare as the values do: the
+        //:   members of a cohort, and positive and negative zero, have the
+        //:   same order key.
+        //:
+        //: 3 Subnormal values, values whose significands do not fit in 53
+        //:   bits, non-canonical encodings, and infinities are handled.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a table of chosen values, verify the order keys.  (C-1, 3)
+        //:
+        //: 2 For every pair of a set of pseudo-random values, verify that
+        //:   'operator<' and 'operator==' agree with the comparison of the
+        //:   order keys.  (C-2..3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   Int64 orderKey(Decimal64);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'orderKey'" << endl
+                          << "==================" << endl;
+
+        if (verbose) cout << "\tChosen values." << endl;
+        {
+            static const struct {
+                int       d_line;
+                long long d_significand;
+                int       d_exponent;
+                Int64     d_key;
+            } DATA[] = {
+                //LINE  SIGNIFICAND           EXP   KEY
+                //----  -------------------   ----  --------------------
+                { L_,                     0,     0,                     0 },
+                { L_,                     0,  -398,                     0 },
+                { L_,                     0,   369,                     0 },
+                { L_,                     1,  -398,                     1 },
+                { L_,                    -1,  -398,                    -1 },
+                { L_,                 12345,  -398,                 12345 },
+                { L_,                 12345,  -390,         1234500000000 },
+                { L_,                     1,  -383,  1000000000000000ll    },
+                { L_,                     1,  -382, 10000000000000000ll    },
+                { L_,                     1,     0,  3448000000000000000ll },
+                { L_,                    -1,     0, -3448000000000000000ll },
+                { L_,                    10,    -1,  3448000000000000000ll },
+                { L_,      1000000000000000,   -15,  3448000000000000000ll },
+                { L_,                    10,     0,  3457000000000000000ll },
+                { L_,                     1,     1,  3457000000000000000ll },
+                { L_,      9999999999999999,     0,  3591999999999999999ll },
+                { L_,      1000000000000000,     1,  3592000000000000000ll },
+                { L_,      9007199254740992,     0,  3591007199254740992ll },
+                { L_,     -9007199254740991,     0, -3591007199254740991ll },
+                { L_,      9999999999999999,   369,  6912999999999999999ll },
+                { L_,     -9999999999999999,   369, -6912999999999999999ll },
+                { L_,                     1,   369,  6769000000000000000ll },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int       LINE        = DATA[ti].d_line;
+                const long long SIGNIFICAND = DATA[ti].d_significand;
+                const int       EXPONENT    = DATA[ti].d_exponent;
+                const Int64     KEY         = DATA[ti].d_key;
+
+                const Decimal64 VALUE = DecUtil::makeDecimalRaw64(SIGNIFICAND,
+                                                                  EXPONENT);
+
+                ASSERTV(LINE, KEY, Obj::orderKey(VALUE),
+                        KEY == Obj::orderKey(VALUE));
+                ASSERTV(LINE, -KEY == Obj::orderKey(-VALUE));
+            }
+
+            ASSERT( 6913000000000000000ll ==
+                                           Obj::orderKey(Limits::infinity()));
+            ASSERT(-6913000000000000000ll ==
+                                          Obj::orderKey(-Limits::infinity()));
+
+            // A non-canonical significand (greater than 9999999999999999) is
+            // zero.
+
+            const Decimal64 NON_CANONICAL = fromBits(0x6000000000000000ull
+                                                   | (400ull << 51)
+                                                   | 0x0007ffffffffffffull);
+            ASSERT(DecUtil::makeDecimalRaw64(0, 0) == NON_CANONICAL);
+            ASSERT(0 == Obj::orderKey(NON_CANONICAL));
+            ASSERT(0 == Obj::orderKey(-NON_CANONICAL));
+        }
+
+        if (verbose) cout << "\tPseudo-random values." << endl;
+        {
+            bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+            const int NUM_VALUES = 600;
+
+            Uint64 seed = 2;
+
+            bsl::vector<Decimal64> values(&ta);
+            bsl::vector<Int64>     keys(&ta);
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                values.push_back(randomOrderTestValue(&seed, false));
+                keys.push_back(Obj::orderKey(values.back()));
+
+                ASSERTV(i, -6913000000000000000ll <= keys.back());
+                ASSERTV(i,  6913000000000000000ll >= keys.back());
+            }
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                for (int j = 0; j < NUM_VALUES; ++j) {
+                    ASSERTV(i, j, (values[i] <  values[j])
+                               == (keys[i]   <  keys[j]));
+                    ASSERTV(i, j, (values[i] == values[j])
+                               == (keys[i]   == keys[j]));
+                }
+            }
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj::orderKey(Limits::infinity()));
+            ASSERT_FAIL(Obj::orderKey(Limits::quiet_NaN()));
+            ASSERT_FAIL(Obj::orderKey(-Limits::signaling_NaN()));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Order a few values using each function.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        Decimal64 values[] = { DecUtil::makeDecimalRaw64(  3, -1),
+                               DecUtil::makeDecimalRaw64( -2,  0),
+                               DecUtil::makeDecimalRaw64(300, -3),
+                               DecUtil::makeDecimalRaw64(  1,  2) };
+
+        ASSERT(Obj::orderKey(values[0]) == Obj::orderKey(values[2]));
+        ASSERT(Obj::orderKey(values[1]) <  Obj::orderKey(values[0]));
+        ASSERT(Obj::orderKey(values[0]) <  Obj::orderKey(values[3]));
+
+        ASSERT(1 == Obj::findMin(values, 4));
+        ASSERT(3 == Obj::findMax(values, 4));
+
+        bool results[3];
+        Obj::lessThan(results, values, values + 1, 3);
+        ASSERT(!results[0]);
+        ASSERT( results[1]);
+        ASSERT( results[2]);
+
+        Obj::sort(values, 4, &ta);
+
+        ASSERT(DecUtil::makeDecimalRaw64( -2,  0) == values[0]);
+        ASSERT(isIdentical(DecUtil::makeDecimalRaw64(  3, -1), values[1]));
+        ASSERT(isIdentical(DecUtil::makeDecimalRaw64(300, -3), values[2]));
+        ASSERT(DecUtil::makeDecimalRaw64(  1,  2) == values[3]);
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Compare the performance of 'sort', 'findMax', and 'lessThan' with
+        // that of 'bsl::sort', a loop, and a loop, respectively, using the
+        // comparison operators of 'Decimal64', for arrays of prices quoted to
+        // four decimal places and for arrays of values having mixed
+        // exponents.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_VALUES     = 1000000;
+        const int NUM_ITERATIONS = 10;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        Uint64 seed = 1;
+
+        for (int mixed = 0; mixed < 2; ++mixed) {
+            bsl::vector<Decimal64> values(&ta);
+            bsl::vector<Decimal64> others(&ta);
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                values.push_back(mixed
+                                 ? randomDecimal64(&seed, 8, -8, 0)
+                                 : DecUtil::makeDecimalRaw64(
+                                       static_cast<int>(nextRandom(&seed)
+                                                                 % 1000000),
+                                       -4));
+                others.push_back(mixed
+                                 ? randomDecimal64(&seed, 8, -8, 0)
+                                 : DecUtil::makeDecimalRaw64(
+                                       static_cast<int>(nextRandom(&seed)
+                                                                 % 1000000),
+                                       -4));
+            }
+
+            cout << (mixed ? "Mixed exponents:" : "Same exponent:") << endl;
+
+            const double numOperations = 1.0 * NUM_VALUES * NUM_ITERATIONS;
+
+            bsls::Stopwatch s;
+            double          elapsed;
+
+            s.start();
+            for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+                bsl::vector<Decimal64> copy(values, &ta);
+                bsl::sort(copy.begin(), copy.end());
+            }
+            elapsed = s.accumulatedWallTime();
+            cout << "\tbsl::sort:           "
+                 << static_cast<int>(elapsed * 1e9 / numOperations)
+                 << " ns/element" << endl;
+
+            s.reset();
+            s.start();
+            for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+                bsl::vector<Decimal64> copy(values, &ta);
+                Obj::sort(copy.data(), copy.size(), &ta);
+            }
+            elapsed = s.accumulatedWallTime();
+            cout << "\tDecimalOrderUtil::sort: "
+                 << static_cast<int>(elapsed * 1e9 / numOperations)
+                 << " ns/element" << endl;
+
+            bsl::size_t checksum = 0;
+
+            s.reset();
+            s.start();
+            for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+                bsl::size_t best = 0;
+                for (int i = 1; i < NUM_VALUES; ++i) {
+                    if (values[best] < values[i]) {
+                        best = i;
+                    }
+                }
+                checksum += best;
+            }
+            elapsed = s.accumulatedWallTime();
+            cout << "\toperator< max:       "
+                 << static_cast<int>(elapsed * 1e9 / numOperations)
+                 << " ns/element" << endl;
+
+            s.reset();
+            s.start();
+            for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+                checksum += Obj::findMax(values.data(), NUM_VALUES);
+            }
+            elapsed = s.accumulatedWallTime();
+            cout << "\tDecimalOrderUtil::findMax: "
+                 << static_cast<int>(elapsed * 1e9 / numOperations)
+                 << " ns/element" << endl;
+
+            bsl::vector<char> results(NUM_VALUES, 0, &ta);
+            bool *RESULTS = reinterpret_cast<bool *>(results.data());
+
+            s.reset();
+            s.start();
+            for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    RESULTS[i] = values[i] < others[i];
+                }
+                checksum += RESULTS[iter];
+            }
+            elapsed = s.accumulatedWallTime();
+            cout << "\toperator<:           "
+                 << static_cast<int>(elapsed * 1e9 / numOperations)
+                 << " ns/element" << endl;
+
+            s.reset();
+            s.start();
+            for (int iter = 0; iter < NUM_ITERATIONS; ++iter) {
+                Obj::lessThan(RESULTS,
+                              values.data(),
+                              others.data(),
+                              NUM_VALUES);
+                checksum += RESULTS[iter];
+            }
+            elapsed = s.accumulatedWallTime();
+            cout << "\tDecimalOrderUtil::lessThan: "
+                 << static_cast<int>(elapsed * 1e9 / numOperations)
+                 << " ns/element" << endl;
+
+            cout << "\tChecksum: " << checksum << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: No memory came from the global or default allocator.
+
+    LOOP2_ASSERT(test, globalAllocator.numBlocksTotal(),
+                 0 == globalAllocator.numBlocksTotal());
+    LOOP2_ASSERT(test, defaultAllocator.numBlocksTotal(),
+                 0 == defaultAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -6,14 +6,19 @@ BSLS_IDENT_RCSID(bdldfp_decimalutil_cpp,"$Id$ $CSID$")
 
 #include <bdldfp_decimalplatform.h>
 #include <bdldfp_decimalimputil.h>
+#include <bdldfp_decimalimputil_bid64.h>
+#include <bdldfp_uint128.h>
 
 #include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
 #include <bslmf_assert.h>
 
 #include <bsl_c_errno.h>
 #include <bsl_cmath.h>
 #include <bsl_cstdio.h>
 #include <bsl_cstring.h>
+#include <bsl_limits.h>
 #include <errno.h>
 #include <math.h>  // For the  FP_* macros
 
@@ -64,6 +69,470 @@ bool isNanString(const char *str) {
             (str[2] | ' ') == 'n');
 }
 
+
+                         // Exact accumulation of 'Decimal64'
+
+typedef DecimalImpUtil_Bid64 Bid64;
+
+inline
+bool isSpecial(bsls::Types::Uint64 bits)
+    // Return 'true' if the specified 'bits' encode an infinity or a NaN in the
+    // BID format of 'Decimal64', and 'false' otherwise.
+{
+    return Bid64::k_INFINITY_MASK == (bits & Bid64::k_INFINITY_MASK);
+}
+
+inline
+bool isNanBits(bsls::Types::Uint64 bits)
+    // Return 'true' if the specified 'bits' encode a NaN in the BID format of
+    // 'Decimal64', and 'false' otherwise.
+{
+    return Bid64::k_NAN_MASK == (bits & Bid64::k_NAN_MASK);
+}
+
+inline
+void decodeFinite(bsls::Types::Uint64 *significand,
+                  int                 *biasedExponent,
+                  bsls::Types::Uint64  bits)
+    // Load into the specified 'significand' and 'biasedExponent' the
+    // significand and the biased exponent of the finite 'Decimal64' value
+    // encoded in the BID format by the specified 'bits'.  The behavior is
+    // undefined if 'bits' encode an infinity or a NaN.  Note that a
+    // non-canonical significand is decoded as zero.
+{
+    if (Bid64::k_SPECIAL_ENCODING_MASK ==
+                                     (bits & Bid64::k_SPECIAL_ENCODING_MASK)) {
+        const bsls::Types::Uint64 s = (bits & Bid64::k_SMALL_COEFF_MASK)
+                                    | Bid64::k_LARGE_COEFF_HIGH_BIT;
+
+        *significand    = s > Bid64::k_MAX_COEFF ? 0 : s;
+        *biasedExponent =
+                       static_cast<int>(bits >> Bid64::k_EXPONENT_SHIFT_LARGE)
+                     & Bid64::k_EXPONENT_MASK;
+    }
+    else {
+        *significand    = bits & Bid64::k_LARGE_COEFF_MASK;
+        *biasedExponent =
+                       static_cast<int>(bits >> Bid64::k_EXPONENT_SHIFT_SMALL)
+                     & Bid64::k_EXPONENT_MASK;
+    }
+}
+
+inline
+Uint128 multiply(bsls::Types::Uint64 lhs, bsls::Types::Uint64 rhs)
+    // Return the 128-bit product of the specified 'lhs' and 'rhs'.
+{
+#if defined(__SIZEOF_INT128__)
+    const __uint128_t product = static_cast<__uint128_t>(lhs) * rhs;
+
+    return Uint128(static_cast<bsls::Types::Uint64>(product >> 64),
+                   static_cast<bsls::Types::Uint64>(product));
+#else
+    const bsls::Types::Uint64 k_LOW_MASK = 0xffffffffull;
+
+    const bsls::Types::Uint64 ll = (lhs & k_LOW_MASK) * (rhs & k_LOW_MASK);
+    const bsls::Types::Uint64 lh = (lhs & k_LOW_MASK) * (rhs >> 32);
+    const bsls::Types::Uint64 hl = (lhs >> 32)        * (rhs & k_LOW_MASK);
+    const bsls::Types::Uint64 hh = (lhs >> 32)        * (rhs >> 32);
+
+    const bsls::Types::Uint64 middle = (ll >> 32)
+                                     + (lh & k_LOW_MASK)
+                                     + (hl & k_LOW_MASK);
+
+    return Uint128(hh + (lh >> 32) + (hl >> 32) + (middle >> 32),
+                   (middle << 32) | (ll & k_LOW_MASK));
+#endif
+}
+
+                          // ======================
+                          // class ExactAccumulator
+                          // ======================
+
+class ExactAccumulator {
+    // This mechanism accumulates, without rounding, a sum of terms of the form
+    // 'c * 10 ** e', where 'c' is an integer having an absolute value less
+    // than '2 ** 128', and 'e' is in the range of the exponents of the
+    // products of two 'Decimal64' values.  The terms are grouped by exponent,
+    // the terms of each group being summed in a 192-bit two's-complement
+    // integer, so that the sum of up to '2 ** 63' terms is exact.  The groups
+    // are initialized lazily, so that only those between the least and the
+    // greatest exponents added are touched.  Infinities and NaNs are tracked
+    // separately, and 'result' returns the accumulated sum rounded to the
+    // nearest 'Decimal64' value.
+    //
+    // Note that the groups are held as arrays of 64-bit words, rather than as
+    // 'Uint128' objects, as 'Uint128' initializes its value on construction.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_MIN_EXPONENT = -2 * Bid64::k_DECIMAL_EXPONENT_BIAS,
+            // exponent of the term in the first group
+
+        k_NUM_GROUPS   = 2 * (Bid64::k_DECIMAL_EXPONENT_BIAS
+                            + Bid64::k_MAX_EXPONENT) + 1
+            // number of groups, one per exponent
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct Word192 {
+        // 192-bit two's-complement integer, least significant word first
+        bsls::Types::Uint64 d_word[3];
+    };
+
+    // DATA
+    Word192 d_groups[k_NUM_GROUPS];  // sums of the terms, by exponent
+    int     d_minIndex;              // index of the first initialized group
+    int     d_maxIndex;              // index of the last initialized group
+    bool    d_allNegative;           // 'true' if no term is non-negative
+    bool    d_hasNan;                // 'true' if a NaN was added
+    bool    d_hasPositiveInfinity;   // 'true' if +infinity was added
+    bool    d_hasNegativeInfinity;   // 'true' if -infinity was added
+
+    // NOT IMPLEMENTED
+    ExactAccumulator(const ExactAccumulator&);
+    ExactAccumulator& operator=(const ExactAccumulator&);
+
+    // PRIVATE CLASS METHODS
+    static int floorDivMod10(Word192 *value);
+        // Load into the specified 'value' its value divided by 10 and rounded
+        // toward negative infinity, and return the (non-negative) remainder.
+
+    static void negate(Word192 *value);
+        // Load into the specified 'value' its negation.
+
+    // PRIVATE MANIPULATORS
+    void initializeGroup(int index);
+        // Extend the range of initialized groups to include the group having
+        // the specified 'index'.
+
+  public:
+    // CREATORS
+    ExactAccumulator();
+        // Create an accumulator having a sum of zero.
+
+    // MANIPULATORS
+    void add(const Uint128& magnitude, bool negative, int index);
+        // Add to the sum the term having the specified 'magnitude', that is
+        // negative if the specified 'negative' is 'true', and the exponent
+        // 'k_MIN_EXPONENT + index' for the specified 'index'.  The behavior
+        // is undefined unless '0 <= index < k_NUM_GROUPS'.
+
+    void addInfinity(bool negative);
+        // Add to the sum an infinity that is negative if the specified
+        // 'negative' is 'true', and positive otherwise.
+
+    void addNan();
+        // Add a NaN to the sum.
+
+    // ACCESSORS
+    Decimal64 result() const;
+        // Return the accumulated sum rounded to the nearest 'Decimal64' value
+        // (with ties rounded to even).
+};
+
+                          // ----------------------
+                          // class ExactAccumulator
+                          // ----------------------
+
+// PRIVATE CLASS METHODS
+int ExactAccumulator::floorDivMod10(Word192 *value)
+{
+    BSLS_ASSERT(value);
+
+    const bool negative = value->d_word[2] >> 63;
+
+    if (negative) {
+        negate(value);
+    }
+
+    // Divide word by word, starting from the most significant.  Let
+    // 'K = 0x1999999999999999', so that '2 ** 64 == 10 * K + 6'.  Then, for a
+    // remainder 'r < 10' from the preceding word and the word 'w',
+    // '(r * 2 ** 64 + w) / 10 == r * K + w / 10 + (6 * r + w % 10) / 10'.
+
+    bsls::Types::Uint64 remainder = 0;
+
+    for (int i = 2; i >= 0; --i) {
+        const bsls::Types::Uint64 w = value->d_word[i];
+        const bsls::Types::Uint64 t = 6 * remainder + w % 10;
+
+        value->d_word[i] = w / 10 + 0x1999999999999999ull * remainder + t / 10;
+        remainder        = t % 10;
+    }
+
+    if (negative) {
+        negate(value);
+
+        if (remainder) {
+            // Round the quotient toward negative infinity.
+
+            for (int i = 0; i < 3; ++i) {
+                if (0 != value->d_word[i]--) {
+                    break;
+                }
+            }
+            remainder = 10 - remainder;
+        }
+    }
+
+    return static_cast<int>(remainder);
+}
+
+void ExactAccumulator::negate(Word192 *value)
+{
+    BSLS_ASSERT(value);
+
+    bsls::Types::Uint64 carry = 1;
+
+    for (int i = 0; i < 3; ++i) {
+        value->d_word[i] = ~value->d_word[i] + carry;
+        carry            = carry && 0 == value->d_word[i];
+    }
+}
+
+// PRIVATE MANIPULATORS
+void ExactAccumulator::initializeGroup(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(     index < k_NUM_GROUPS);
+
+    if (d_minIndex > d_maxIndex) {
+        d_minIndex = index;
+        d_maxIndex = index;
+        bsl::memset(&d_groups[index], 0, sizeof(Word192));
+    }
+    else if (index < d_minIndex) {
+        bsl::memset(&d_groups[index],
+                    0,
+                    (d_minIndex - index) * sizeof(Word192));
+        d_minIndex = index;
+    }
+    else if (index > d_maxIndex) {
+        bsl::memset(&d_groups[d_maxIndex + 1],
+                    0,
+                    (index - d_maxIndex) * sizeof(Word192));
+        d_maxIndex = index;
+    }
+}
+
+// CREATORS
+ExactAccumulator::ExactAccumulator()
+: d_minIndex(k_NUM_GROUPS)
+, d_maxIndex(-1)
+, d_allNegative(true)
+, d_hasNan(false)
+, d_hasPositiveInfinity(false)
+, d_hasNegativeInfinity(false)
+{
+}
+
+// MANIPULATORS
+inline
+void ExactAccumulator::add(const Uint128& magnitude, bool negative, int index)
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(     index < k_NUM_GROUPS);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(index < d_minIndex
+                                           || index > d_maxIndex)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        initializeGroup(index);
+    }
+
+    d_allNegative &= negative;
+
+    // Form the two's complement of the term without branching on its sign
+    // (which is typically unpredictable), and add it to the group.
+
+    const bsls::Types::Uint64 low  = magnitude.low();
+    const bsls::Types::Uint64 high = magnitude.high();
+    const bsls::Types::Uint64 mask =
+                              0 - (static_cast<bsls::Types::Uint64>(negative)
+                                 & static_cast<bsls::Types::Uint64>(
+                                                          0 != (low | high)));
+
+    const bsls::Types::Uint64 term0 = (low ^ mask) - mask;
+    const bsls::Types::Uint64 term1 = (high ^ mask)
+                                    + (mask & static_cast<bsls::Types::Uint64>(
+                                                                   0 == low));
+
+    bsls::Types::Uint64 *words = d_groups[index].d_word;
+
+    words[0] += term0;
+    const bsls::Types::Uint64 carry0 = words[0] < term0;
+
+    words[1] += term1;
+    bsls::Types::Uint64 carry1 = words[1] < term1;
+    words[1] += carry0;
+    carry1   |= words[1] < carry0;
+
+    words[2] += mask + carry1;
+}
+
+void ExactAccumulator::addInfinity(bool negative)
+{
+    if (negative) {
+        d_hasNegativeInfinity = true;
+    }
+    else {
+        d_hasPositiveInfinity = true;
+    }
+}
+
+void ExactAccumulator::addNan()
+{
+    d_hasNan = true;
+}
+
+// ACCESSORS
+Decimal64 ExactAccumulator::result() const
+{
+    typedef bsl::numeric_limits<Decimal64> Limits;
+
+    if (d_hasNan || (d_hasPositiveInfinity && d_hasNegativeInfinity)) {
+        return Limits::quiet_NaN();                                   // RETURN
+    }
+    if (d_hasPositiveInfinity) {
+        return Limits::infinity();                                    // RETURN
+    }
+    if (d_hasNegativeInfinity) {
+        return -Limits::infinity();                                   // RETURN
+    }
+    if (d_minIndex > d_maxIndex) {
+        return DecimalImpUtil::makeDecimalRaw64(0, 0);                // RETURN
+    }
+
+    // Convert the sum to decimal digits, least significant first, by
+    // propagating the carry from each group to the next.  Once the groups are
+    // exhausted, the carry (of at most 58 decimal digits) is either 0, or -1
+    // if the sum is negative.
+
+    const int k_MAX_CARRY_DIGITS = 60;
+
+    char    digits[k_NUM_GROUPS + k_MAX_CARRY_DIGITS];
+    int     numDigits = 0;
+    Word192 carry     = { { 0, 0, 0 } };
+
+    for (int i = d_minIndex; i <= d_maxIndex; ++i) {
+        const bsls::Types::Uint64 *words = d_groups[i].d_word;
+
+        bsls::Types::Uint64 c = 0;
+        for (int j = 0; j < 3; ++j) {
+            const bsls::Types::Uint64 w = carry.d_word[j] + c;
+
+            c                = w < c;
+            carry.d_word[j]  = w + words[j];
+            c               |= carry.d_word[j] < w;
+        }
+        digits[numDigits++] = static_cast<char>(floorDivMod10(&carry));
+    }
+
+    const bsls::Types::Uint64 k_ALL_ONES = ~0ull;
+
+    while ((carry.d_word[0] | carry.d_word[1] | carry.d_word[2])
+        && (carry.d_word[0] & carry.d_word[1] & carry.d_word[2])
+                                                              != k_ALL_ONES) {
+        digits[numDigits++] = static_cast<char>(floorDivMod10(&carry));
+    }
+
+    const bool negative = 0 != carry.d_word[2];
+
+    if (negative) {
+        // The sum is '-10 ** numDigits + D', where 'D' is the value of the
+        // digits, so its magnitude is the ten's complement of 'D'.
+
+        int i = 0;
+        while (i < numDigits && 0 == digits[i]) {
+            ++i;
+        }
+        if (i == numDigits) {
+            digits[numDigits++] = 1;
+        }
+        else {
+            digits[i] = static_cast<char>(10 - digits[i]);
+            for (++i; i < numDigits; ++i) {
+                digits[i] = static_cast<char>(9 - digits[i]);
+            }
+        }
+    }
+
+    while (numDigits > 0 && 0 == digits[numDigits - 1]) {
+        --numDigits;
+    }
+
+    const int baseExponent = k_MIN_EXPONENT + d_minIndex;
+
+    if (0 == numDigits) {
+        int exponent = baseExponent;
+        if (exponent < -Bid64::k_DECIMAL_EXPONENT_BIAS) {
+            exponent = -Bid64::k_DECIMAL_EXPONENT_BIAS;
+        }
+        else if (exponent > Bid64::k_MAX_EXPONENT) {
+            exponent = Bid64::k_MAX_EXPONENT;
+        }
+
+        const Decimal64 zero = DecimalImpUtil::makeDecimalRaw64(0, exponent);
+
+        return d_allNegative ? -zero : zero;                          // RETURN
+    }
+
+    // Discard the digits that do not fit in the significand, or that lie
+    // below the least exponent, and round the remaining digits.
+
+    int cut = numDigits - Bid64::k_MAX_DIGITS;
+    if (cut < -Bid64::k_DECIMAL_EXPONENT_BIAS - baseExponent) {
+        cut = -Bid64::k_DECIMAL_EXPONENT_BIAS - baseExponent;
+    }
+    if (cut < 0) {
+        cut = 0;
+    }
+
+    bsls::Types::Uint64 significand = 0;
+
+    for (int i = numDigits - 1; i >= cut; --i) {
+        significand = significand * 10 + digits[i];
+    }
+
+    if (0 < cut && cut <= numDigits) {
+        const int roundingDigit = digits[cut - 1];
+
+        bool sticky = false;
+        for (int i = 0; i < cut - 1 && !sticky; ++i) {
+            sticky = 0 != digits[i];
+        }
+
+        if (roundingDigit > 5
+         || (5 == roundingDigit && (sticky || (significand & 1)))) {
+            ++significand;
+        }
+    }
+
+    int exponent = baseExponent + cut;
+
+    if (significand > Bid64::k_MAX_COEFF) {
+        significand /= 10;
+        ++exponent;
+    }
+
+    while (exponent    >  Bid64::k_MAX_EXPONENT
+        && significand <= Bid64::k_MAX_COEFF / 10) {
+        significand *= 10;
+        --exponent;
+    }
+
+    if (exponent > Bid64::k_MAX_EXPONENT) {
+        return negative ? -Limits::infinity() : Limits::infinity();   // RETURN
+    }
+
+    const Decimal64 value = DecimalImpUtil::makeDecimalRaw64(significand,
+                                                             exponent);
+
+    return negative ? -value : value;
+}
+
 }  // close unnamed namespace
 
 
@@ -87,6 +556,10 @@ int DecimalUtil::parseDecimal64(Decimal64 *out, const char *str)
     BSLS_ASSERT(out != 0);
     BSLS_ASSERT(str != 0);
 
+    if (0 == DecimalImpUtil::parseSimple64(out->data(), str)) {
+        return 0;                                                     // RETURN
+    }
+
     Decimal64 d = DecimalImpUtil::parse64(str);
     if (isNan(d) && !isNanString(str)) {
         return -1;
@@ -266,6 +739,107 @@ int DecimalUtil::decompose(int                 *sign,
 
 }
 
+                        // Batch arithmetic functions
+
+Decimal64 DecimalUtil::dotProduct(const Decimal64 *lhs,
+                                  const Decimal64 *rhs,
+                                  bsl::size_t      numValues)
+{
+    BSLS_ASSERT(lhs || 0 == numValues);
+    BSLS_ASSERT(rhs || 0 == numValues);
+
+    ExactAccumulator accumulator;
+
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        const bsls::Types::Uint64 x = lhs[i].data()->d_raw;
+        const bsls::Types::Uint64 y = rhs[i].data()->d_raw;
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(isSpecial(x | y))) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            // Note that 'isSpecial(x | y)' may be 'true' for finite 'x' and
+            // 'y' having large significands, which are handled below.
+
+            if (isNanBits(x) || isNanBits(y)) {
+                accumulator.addNan();
+                continue;                                           // CONTINUE
+            }
+            if (isSpecial(x) || isSpecial(y)) {
+                bsls::Types::Uint64 significand = 1;
+                int                 exponent    = 0;
+
+                if (!isSpecial(x)) {
+                    decodeFinite(&significand, &exponent, x);
+                }
+                else if (!isSpecial(y)) {
+                    decodeFinite(&significand, &exponent, y);
+                }
+
+                if (0 == significand) {
+                    accumulator.addNan();
+                }
+                else {
+                    accumulator.addInfinity(
+                                         0 != ((x ^ y) & Bid64::k_SIGN_MASK));
+                }
+                continue;                                           // CONTINUE
+            }
+        }
+
+        bsls::Types::Uint64 xSignificand;
+        bsls::Types::Uint64 ySignificand;
+        int                 xExponent;
+        int                 yExponent;
+
+        decodeFinite(&xSignificand, &xExponent, x);
+        decodeFinite(&ySignificand, &yExponent, y);
+
+        accumulator.add(multiply(xSignificand, ySignificand),
+                        0 != ((x ^ y) & Bid64::k_SIGN_MASK),
+                        xExponent + yExponent);
+    }
+
+    return accumulator.result();
+}
+
+Decimal64 DecimalUtil::sum(const Decimal64 *values, bsl::size_t numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    ExactAccumulator accumulator;
+
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        const bsls::Types::Uint64 x = values[i].data()->d_raw;
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(isSpecial(x))) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            if (isNanBits(x)) {
+                accumulator.addNan();
+            }
+            else {
+                accumulator.addInfinity(0 != (x & Bid64::k_SIGN_MASK));
+            }
+            continue;                                               // CONTINUE
+        }
+
+        bsls::Types::Uint64 significand;
+        int                 exponent;
+
+        decodeFinite(&significand, &exponent, x);
+
+        // The index of the group for exponent 'e' is
+        // 'e - ExactAccumulator::k_MIN_EXPONENT', i.e., the biased exponent
+        // plus the bias.
+
+        accumulator.add(Uint128(significand),
+                        0 != (x & Bid64::k_SIGN_MASK),
+                        exponent + Bid64::k_DECIMAL_EXPONENT_BIAS);
+    }
+
+    return accumulator.result();
+}
+
 int DecimalUtil::format(char                      *buffer,
                         int                        length,
                         Decimal32                  value,
@@ -36,6 +36,9 @@ BSLS_IDENT("$Id$")
 //: o 'fma', 'fabs', 'ceil', 'floor', 'trunc', 'round' - math functions
 //:
 //: o 'classify' and the 'isXxxx' floating-point value classification functions
+//:
+//: o 'sum' and 'dotProduct', exactly rounded arithmetic on arrays of
+//:   'Decimal64' values
 //
 // The 'FP_XXX' C99 floating-point classification macros may also be provided
 // by this header for platforms where C99 support is still not provided.
@@ -61,6 +64,26 @@ BSLS_IDENT("$Id$")
 //  assert(BDLDFP_DECIMAL_DD(4.2) == d64);
 //  assert(BDLDFP_DECIMAL_DL(4.2) == d128);
 //..
+//
+///Example 2: Summing an Array of Decimals Exactly
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Adding the elements of an array in sequence using 'operator+' rounds the
+// intermediate result after each addition, so that the total may depend on
+// the order of the elements, and small elements may be lost entirely.  'sum'
+// instead computes the exact total and rounds it once:
+//..
+//  const Decimal64 values[] = { BDLDFP_DECIMAL_DD(1e300),
+//                               BDLDFP_DECIMAL_DD(1.0),
+//                               BDLDFP_DECIMAL_DD(-1e300) };
+//
+//  Decimal64 total = values[0] + values[1] + values[2];
+//  assert(BDLDFP_DECIMAL_DD(0.0) == total);
+//
+//  total = DecimalUtil::sum(values, 3);
+//  assert(BDLDFP_DECIMAL_DD(1.0) == total);
+//..
+// Similarly, 'dotProduct' computes the exact sum of the products of the
+// elements of two arrays (e.g., of quantities and prices), and rounds it once.
 
 // TODO TBD Priority description:
 //
@@ -81,6 +104,7 @@ BSLS_IDENT("$Id$")
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_optional.h>
 #include <bsl_string.h>
 
@@ -657,6 +681,48 @@ struct DecimalUtil {
         // reflect the encoded representation of 'value' (i.e., they
         // reflect the 'quantum' of 'value').
 
+                        // Batch arithmetic functions
+
+    static Decimal64 dotProduct(const Decimal64 *lhs,
+                                const Decimal64 *rhs,
+                                bsl::size_t      numValues);
+        // Return the sum of the products of the corresponding elements of the
+        // specified 'lhs' and 'rhs' arrays of the specified 'numValues'
+        // elements each, computed exactly and rounded once to the nearest
+        // representable value (with ties rounded to even).  If 'numValues' is
+        // 0, return positive zero.  Return a quiet NaN if any element is NaN,
+        // if any product is of infinity and zero, or if the products include
+        // infinities of both signs; otherwise, if any product is infinite,
+        // return that infinity.  The exponent of the result is as close as
+        // possible to the least sum of the exponents of corresponding
+        // elements.  The behavior is undefined unless 'lhs' and 'rhs' each
+        // refer to an array of at least 'numValues' elements.  Note that the
+        // products are not rounded, and may lie outside the range of
+        // 'Decimal64' without causing overflow or underflow provided that the
+        // result is within range.
+
+    static Decimal64 sum(const Decimal64 *values, bsl::size_t numValues);
+        // Return the sum of the specified 'numValues' elements of the
+        // specified 'values' array, computed exactly and rounded once to the
+        // nearest representable value (with ties rounded to even).  If
+        // 'numValues' is 0, return positive zero.  Return a quiet NaN if any
+        // element is NaN or if the elements include infinities of both signs;
+        // otherwise, if any element is infinite, return that infinity.  The
+        // exponent of the result is as close as possible to the least
+        // exponent of the elements (i.e., if the exact sum is representable,
+        // the result has the quantum that a sequence of additions using
+        // 'operator+' would produce).  A zero result is negative only if
+        // every element is negative zero, and a result too large to be
+        // represented is infinity of the appropriate sign.  The behavior is
+        // undefined unless 'values' refers to an array of at least
+        // 'numValues' elements.  Note that the result does not depend on the
+        // order of the elements, and may differ from (but is never less
+        // accurate than) the result of adding the elements in sequence.  Also
+        // note that this function, like 'dotProduct', accumulates the
+        // elements in integer arithmetic without calling the decimal
+        // floating-point library, which makes it several times faster than
+        // the equivalent sequence of additions.
+
                          // Format functions
 
     static
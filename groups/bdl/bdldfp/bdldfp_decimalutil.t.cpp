@@ -19,6 +19,7 @@
 #include <bsl_climits.h>
 #include <bsl_cmath.h>
 #include <bsl_cstdint.h>
+#include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
 #include <bsl_fstream.h>
 #include <bsl_limits.h>
@@ -53,6 +54,8 @@ using bsl::atoi;
 //
 // TRAITS
 // ----------------------------------------------------------------------------
+// [16] Decimal64 dotProduct(const Decimal64 *, const Decimal64 *, size_t);
+// [16] Decimal64 sum(const Decimal64 *, bsl::size_t);
 // [ 1] BREATHING TEST
 // [  ] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -339,6 +342,89 @@ bsl::wstring& decLower(bsl::wstring& s)
     return s;
 }
 
+unsigned int nextRandom(bsls::Types::Uint64 *seed)
+    // Return the next pseudo-random number generated from the specified
+    // 'seed', and update 'seed'.
+{
+    *seed = *seed * 6364136223846793005ull + 1442695040888963407ull;
+    return static_cast<unsigned int>(*seed >> 33);
+}
+
+BDEC::Decimal64 randomDecimal64(bsls::Types::Uint64 *seed,
+                                int                  maxDigits,
+                                int                  minExponent,
+                                int                  maxExponent)
+    // Return a pseudo-random 'Decimal64' value, generated from the specified
+    // 'seed', having a random sign, a significand of at most the specified
+    // 'maxDigits' decimal digits, and an exponent in the range specified by
+    // 'minExponent' and 'maxExponent'.  Update 'seed'.
+{
+    long long significand = 0;
+    const int numDigits   = nextRandom(seed) % (maxDigits + 1);
+    for (int i = 0; i < numDigits; ++i) {
+        significand = significand * 10 + nextRandom(seed) % 10;
+    }
+    if (nextRandom(seed) & 1) {
+        significand = -significand;
+    }
+
+    const int exponent = minExponent
+                      + nextRandom(seed) % (maxExponent - minExponent + 1);
+
+    return BDEC::DecimalUtil::makeDecimalRaw64(significand, exponent);
+}
+
+BDEC::Decimal64 referenceSum(const BDEC::Decimal64 *values, int numValues)
+    // Return the sum of the specified 'numValues' elements of the specified
+    // 'values', obtained by adding them in sequence as 'Decimal128' values and
+    // converting the total to 'Decimal64'.  Note that the result is the
+    // exactly rounded sum provided that none of the 'Decimal128' additions
+    // rounds.
+{
+    if (0 == numValues) {
+        return BDEC::DecimalUtil::makeDecimalRaw64(0, 0);             // RETURN
+    }
+
+    BDEC::Decimal128 total(values[0]);
+    for (int i = 1; i < numValues; ++i) {
+        total += BDEC::Decimal128(values[i]);
+    }
+    return BDEC::Decimal64(total);
+}
+
+BDEC::Decimal64 referenceDotProduct(const BDEC::Decimal64 *lhs,
+                                    const BDEC::Decimal64 *rhs,
+                                    int                    numValues)
+    // Return the sum of the products of the corresponding elements of the
+    // specified 'lhs' and 'rhs' arrays of the specified 'numValues' elements,
+    // obtained by multiplying and adding in sequence as 'Decimal128' values
+    // and converting the total to 'Decimal64'.  Note that the result is the
+    // exactly rounded sum of products provided that none of the 'Decimal128'
+    // operations rounds.
+{
+    if (0 == numValues) {
+        return BDEC::DecimalUtil::makeDecimalRaw64(0, 0);             // RETURN
+    }
+
+    BDEC::Decimal128 total = BDEC::Decimal128(lhs[0])
+                           * BDEC::Decimal128(rhs[0]);
+    for (int i = 1; i < numValues; ++i) {
+        total += BDEC::Decimal128(lhs[i]) * BDEC::Decimal128(rhs[i]);
+    }
+    return BDEC::Decimal64(total);
+}
+
+bool isIdentical(BDEC::Decimal64 lhs, BDEC::Decimal64 rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same encoding,
+    // or are both NaN, and 'false' otherwise.
+{
+    if (BDEC::DecimalUtil::isNan(lhs) || BDEC::DecimalUtil::isNan(rhs)) {
+        return BDEC::DecimalUtil::isNan(lhs) && BDEC::DecimalUtil::isNan(rhs);
+                                                                      // RETURN
+    }
+    return lhs.data()->d_raw == rhs.data()->d_raw;
+}
+
 //-----------------------------------------------------------------------------
 
 
@@ -469,6 +555,365 @@ int main(int argc, char* argv[])
 
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING 'sum' AND 'dotProduct'
+        //
+        // Concerns:
+        //: 1 'sum' and 'dotProduct' return the exact result rounded once to
+        //:   the nearest 'Decimal64' value, with ties rounded to even, even
+        //:   where intermediate results would overflow or underflow.
+        //:
+        //: 2 The exponent of the result is as close as possible to the least
+        //:   exponent of the elements (or of the products), and a zero result
+        //:   is negative only if every element (or product) is negative.
+        //:
+        //: 3 The results do not depend on the order of the elements.
+        //:
+        //: 4 NaNs and infinities are handled as by a sequence of additions
+        //:   (and multiplications).
+        //:
+        //: 5 A result too large to be represented is infinity, and a result
+        //:   too small to be represented is rounded to zero or to a subnormal
+        //:   value.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, compare the results for sets
+        //:   of values chosen to exercise rounding, cancellation, quanta,
+        //:   signed zeros, overflow, underflow, and special values with the
+        //:   expected results.  (C-1..2, 4..5)
+        //:
+        //: 2 For many pseudo-random arrays of values having exponents in a
+        //:   narrow range (so that the sums can be computed exactly using
+        //:   'Decimal128'), compare the results with the exactly rounded sums
+        //:   computed using 'Decimal128', for the arrays and for the arrays
+        //:   in reverse order.  (C-1..3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null arrays having elements.  (C-6)
+        //
+        // Testing:
+        //   Decimal64 dotProduct(const Decimal64 *, const Decimal64 *, ...);
+        //   Decimal64 sum(const Decimal64 *, bsl::size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'sum' AND 'dotProduct'" << endl
+                          << "==============================" << endl;
+
+        typedef BDEC::Decimal64 Type;
+
+        if (verbose) cout << "\nTesting 'sum' with chosen values." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_values[3];
+                int         d_numValues;
+                const char *d_expected;
+            } DATA[] = {
+                //LINE  VALUES                                  N  EXPECTED
+                //----  --------------------------------------  -  ----------
+                { L_,   { "",      "",     ""               },  0, "0"      },
+                { L_,   { "1",     "",     ""               },  1, "1"      },
+                { L_,   { "1.00",  "2.0",  ""               },  2, "3.00"   },
+                { L_,   { "1e300", "1",    "-1e300"         },  3, "1"      },
+                { L_,   { "1e-398", "1e-398", "-3e-398"     },  3, "-1e-398"},
+                { L_,   { "5",     "-5",   ""               },  2, "0"      },
+                { L_,   { "5.0",   "-5",   ""               },  2, "0.0"    },
+                { L_,   { "-0",    "-0",   ""               },  2, "-0"     },
+                { L_,   { "-0",    "0",    ""               },  2, "0"      },
+                { L_,   { "-0",    "-0.00", ""              },  2, "-0.00"  },
+                { L_,   { "9999999999999999", "0.5", ""     },  2,
+                                                       "1000000000000000e1" },
+                { L_,   { "9999999999999998", "0.5", ""     },  2,
+                                                         "9999999999999998" },
+                { L_,   { "9999999999999998", "0.5", "1e-300" },  3,
+                                                         "9999999999999999" },
+                { L_,   { "9999999999999998", "0.5", "-1e-300" },  3,
+                                                         "9999999999999998" },
+                { L_,   { "-9999999999999999", "-0.5", ""   },  2,
+                                                      "-1000000000000000e1" },
+                { L_,   { "1234567890123456", "1e20", ""    },  2,
+                                                       "1000012345678901e5" },
+                { L_,   { "1e20", "-1", ""                  },  2,
+                                                       "1000000000000000e5" },
+                { L_,   { "9.999999999999999e384",
+                          "0.000000000000001e384", ""       },  2, "Inf"    },
+                { L_,   { "-9.999999999999999e384",
+                          "-9.999999999999999e384", ""      },  2, "-Inf"   },
+                { L_,   { "9.999999999999999e384",
+                          "9.999999999999999e384",
+                          "-9.999999999999999e384"          },  3,
+                                                    "9.999999999999999e384" },
+                { L_,   { "1e369", "1e369", ""              },  2, "2e369"  },
+                { L_,   { "1",     "Inf",  "-5"             },  3, "Inf"    },
+                { L_,   { "-Inf",  "-Inf", ""               },  2, "-Inf"   },
+                { L_,   { "Inf",   "-Inf", ""               },  2, "NaN"    },
+                { L_,   { "1",     "NaN",  "Inf"            },  3, "NaN"    },
+                { L_,   { "sNaN",  "1",    ""               },  2, "NaN"    },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE = DATA[ti].d_line;
+                const int N    = DATA[ti].d_numValues;
+
+                Type values[3];
+                for (int i = 0; i < N; ++i) {
+                    ASSERTV(LINE, i, 0 == Util::parseDecimal64(
+                                                      &values[i],
+                                                      DATA[ti].d_values[i]));
+                }
+
+                Type expected;
+                ASSERTV(LINE, 0 == Util::parseDecimal64(&expected,
+                                                        DATA[ti].d_expected));
+
+                const Type RESULT = Util::sum(N ? values : 0, N);
+
+                ASSERTV(LINE, RESULT, expected, isIdentical(RESULT, expected));
+
+                bsl::reverse(values, values + N);
+
+                const Type REVERSED = Util::sum(values, N);
+
+                ASSERTV(LINE, REVERSED, expected,
+                        isIdentical(REVERSED, expected));
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'dotProduct' with chosen values."
+                          << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_lhs[3];
+                const char *d_rhs[3];
+                int         d_numValues;
+                const char *d_expected;
+            } DATA[] = {
+                //LINE  LHS, RHS                             N  EXPECTED
+                //----  -----------------------------------  -  -------------
+                { L_,   { "",      "",     ""        },
+                        { "",      "",     ""        },      0, "0"          },
+                { L_,   { "1.5",   "",     ""        },
+                        { "2.0",   "",     ""        },      1, "3.00"       },
+                { L_,   { "2",     "3",    "-4"      },
+                        { "1.25",  "10",   "0.5"     },      3, "30.50"      },
+                { L_,   { "1e200", "1",    "-1e200"  },
+                        { "1e200", "7",    "1e200"   },      3, "7"          },
+                { L_,   { "1e-398", "",    ""        },
+                        { "1e-398", "",    ""        },      1, "0e-398"     },
+                { L_,   { "-1e-398", "",   ""        },
+                        { "1e-398", "",    ""        },      1, "-0e-398"    },
+                { L_,   { "5e-200", "",    ""        },
+                        { "1e-199", "",    ""        },      1, "0e-398"     },
+                { L_,   { "6e-200", "",    ""        },
+                        { "1e-199", "",    ""        },      1, "1e-398"     },
+                { L_,   { "15e-200", "",   ""        },
+                        { "1e-199", "",    ""        },      1, "2e-398"     },
+                { L_,   { "1e369", "",     ""        },
+                        { "1e369", "",     ""        },      1, "Inf"        },
+                { L_,   { "1e300", "",     ""        },
+                        { "1e-300", "",    ""        },      1, "1"          },
+                { L_,   { "1e369", "",     ""        },
+                        { "1e10",  "",     ""        },      1,
+                                                        "10000000000e369" },
+                { L_,   { "0e369", "",     ""        },
+                        { "0e369", "",     ""        },      1, "0e369"      },
+                { L_,   { "-0",    "0",    ""        },
+                        { "5",     "5",    ""        },      2, "0"          },
+                { L_,   { "-0",    "0",    ""        },
+                        { "5",     "-5",   ""        },      2, "-0"         },
+                { L_,   { "9999999999999999", "",   "" },
+                        { "9999999999999999", "",   "" },    1,
+                                                   "9999999999999998e16" },
+                { L_,   { "Inf",   "",     ""        },
+                        { "-2",    "",     ""        },      1, "-Inf"       },
+                { L_,   { "Inf",   "",     ""        },
+                        { "-0",    "",     ""        },      1, "NaN"        },
+                { L_,   { "Inf",   "1",    ""        },
+                        { "Inf",   "-Inf", ""        },      2, "NaN"        },
+                { L_,   { "-Inf",  "1",    ""        },
+                        { "-Inf",  "2",    ""        },      2, "Inf"        },
+                { L_,   { "NaN",   "",     ""        },
+                        { "0",     "",     ""        },      1, "NaN"        },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE = DATA[ti].d_line;
+                const int N    = DATA[ti].d_numValues;
+
+                Type lhs[3];
+                Type rhs[3];
+                for (int i = 0; i < N; ++i) {
+                    ASSERTV(LINE, i, 0 == Util::parseDecimal64(
+                                                         &lhs[i],
+                                                         DATA[ti].d_lhs[i]));
+                    ASSERTV(LINE, i, 0 == Util::parseDecimal64(
+                                                         &rhs[i],
+                                                         DATA[ti].d_rhs[i]));
+                }
+
+                Type expected;
+                ASSERTV(LINE, 0 == Util::parseDecimal64(&expected,
+                                                        DATA[ti].d_expected));
+
+                const Type RESULT = Util::dotProduct(N ? lhs : 0,
+                                                     N ? rhs : 0,
+                                                     N);
+
+                ASSERTV(LINE, RESULT, expected, isIdentical(RESULT, expected));
+
+                // The product is commutative.
+
+                const Type SWAPPED = Util::dotProduct(rhs, lhs, N);
+
+                ASSERTV(LINE, SWAPPED, expected,
+                        isIdentical(SWAPPED, expected));
+            }
+        }
+
+        if (verbose) cout << "\nComparing with 'Decimal128' arithmetic."
+                          << endl;
+        {
+            // Each configuration bounds the digits of the significands and
+            // the range of the exponents so that the 'Decimal128' reference
+            // computations (of up to 'k_MAX_VALUES' elements) are exact.
+
+            const int k_MAX_VALUES = 50;
+
+            static const struct {
+                int d_line;
+                int d_maxDigits;
+                int d_minExponent;
+                int d_maxExponent;
+            } CONFIGS[] = {
+                //LINE  DIGITS  MIN EXP  MAX EXP
+                //----  ------  -------  -------
+                { L_,       16,       0,       0 },
+                { L_,       16,      -6,      10 },
+                { L_,        8,     -20,     -10 },
+                { L_,       16,    -398,    -382 },
+                { L_,       16,     353,     369 },
+                { L_,        2,    -398,    -398 },
+            };
+            const int NUM_CONFIGS = static_cast<int>(sizeof  CONFIGS
+                                                   / sizeof *CONFIGS);
+
+            bsls::Types::Uint64 seed = 12345;
+
+            for (int ci = 0; ci < NUM_CONFIGS; ++ci) {
+                const int LINE    = CONFIGS[ci].d_line;
+                const int DIGITS  = CONFIGS[ci].d_maxDigits;
+                const int MIN_EXP = CONFIGS[ci].d_minExponent;
+                const int MAX_EXP = CONFIGS[ci].d_maxExponent;
+
+                for (int iteration = 0; iteration < 2000; ++iteration) {
+                    Type values[k_MAX_VALUES];
+                    const int N = nextRandom(&seed) % (k_MAX_VALUES + 1);
+
+                    for (int i = 0; i < N; ++i) {
+                        values[i] = randomDecimal64(&seed,
+                                                    DIGITS,
+                                                    MIN_EXP,
+                                                    MAX_EXP);
+                    }
+
+                    const Type EXPECTED = referenceSum(values, N);
+                    const Type RESULT   = Util::sum(values, N);
+
+                    ASSERTV(LINE, N, RESULT, EXPECTED,
+                            isIdentical(RESULT, EXPECTED));
+
+                    bsl::reverse(values, values + N);
+
+                    const Type REVERSED = Util::sum(values, N);
+
+                    ASSERTV(LINE, N, REVERSED, EXPECTED,
+                            isIdentical(REVERSED, EXPECTED));
+                }
+            }
+
+            // The products of significands of 16 digits each have 32 digits,
+            // so the exponents must be equal for the reference to be exact.
+
+            static const struct {
+                int d_line;
+                int d_maxDigits;
+                int d_minExponent;
+                int d_maxExponent;
+            } DOT_CONFIGS[] = {
+                //LINE  DIGITS  MIN EXP  MAX EXP
+                //----  ------  -------  -------
+                { L_,       16,       0,       0 },
+                { L_,       16,     -10,     -10 },
+                { L_,        8,      -4,       4 },
+                { L_,        4,    -398,    -390 },
+                { L_,        4,     175,     190 },
+                { L_,        4,    -205,    -195 },
+            };
+            const int NUM_DOT_CONFIGS = static_cast<int>(sizeof  DOT_CONFIGS
+                                                       / sizeof *DOT_CONFIGS);
+
+            for (int ci = 0; ci < NUM_DOT_CONFIGS; ++ci) {
+                const int LINE    = DOT_CONFIGS[ci].d_line;
+                const int DIGITS  = DOT_CONFIGS[ci].d_maxDigits;
+                const int MIN_EXP = DOT_CONFIGS[ci].d_minExponent;
+                const int MAX_EXP = DOT_CONFIGS[ci].d_maxExponent;
+
+                for (int iteration = 0; iteration < 2000; ++iteration) {
+                    Type lhs[k_MAX_VALUES];
+                    Type rhs[k_MAX_VALUES];
+                    const int N = nextRandom(&seed) % (k_MAX_VALUES + 1);
+
+                    for (int i = 0; i < N; ++i) {
+                        lhs[i] = randomDecimal64(&seed,
+                                                 DIGITS,
+                                                 MIN_EXP,
+                                                 MAX_EXP);
+                        rhs[i] = randomDecimal64(&seed,
+                                                 DIGITS,
+                                                 MIN_EXP,
+                                                 MAX_EXP);
+                    }
+
+                    const Type EXPECTED = referenceDotProduct(lhs, rhs, N);
+                    const Type RESULT   = Util::dotProduct(lhs, rhs, N);
+
+                    ASSERTV(LINE, N, RESULT, EXPECTED,
+                            isIdentical(RESULT, EXPECTED));
+
+                    bsl::reverse(lhs, lhs + N);
+                    bsl::reverse(rhs, rhs + N);
+
+                    const Type REVERSED = Util::dotProduct(lhs, rhs, N);
+
+                    ASSERTV(LINE, N, REVERSED, EXPECTED,
+                            isIdentical(REVERSED, EXPECTED));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const Type VALUE = BDLDFP_DECIMAL_DD(1.0);
+
+            ASSERT_PASS(Util::sum(0, 0));
+            ASSERT_FAIL(Util::sum(0, 1));
+            ASSERT_PASS(Util::sum(&VALUE, 1));
+
+            ASSERT_PASS(Util::dotProduct(0, 0, 0));
+            ASSERT_FAIL(Util::dotProduct(0, &VALUE, 1));
+            ASSERT_FAIL(Util::dotProduct(&VALUE, 0, 1));
+            ASSERT_PASS(Util::dotProduct(&VALUE, &VALUE, 1));
+        }
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // TESTING 'format'
@@ -6675,6 +7120,217 @@ int main(int argc, char* argv[])
         bsl::cout << "Total time: " << totalTime << " seconds." << bsl::endl;
 
     } break;
+    case -10: {
+        // --------------------------------------------------------------------
+        // TESTING: Performance test of 'parseDecimal64' and 'format'.
+        //
+        // Test the performance of parsing and formatting short decimal
+        // strings typical of prices, which 'parseDecimal64' and
+        // 'DecimalImpUtil::format' handle without calling the decimal
+        // floating-point library.  For comparison, the same strings are
+        // parsed by the library directly, and the same values are formatted
+        // as 'Decimal128' (which is always formatted using the library).
+        // --------------------------------------------------------------------
+
+        const int numStrings    = 1000;
+        const int numIterations = 1000;
+        const int numOperations = numStrings * numIterations;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        bsl::vector<bsl::string> strings(&ta);
+        for (int i = 0; i < numStrings; ++i) {
+            char buffer[32];
+            bsl::sprintf(buffer, "%d.%04d", rand() % 10000, rand() % 10000);
+            strings.push_back(buffer);
+        }
+
+        bsl::vector<BDEC::Decimal64> values(numStrings, &ta);
+
+        double checksum = 0;
+
+        {
+            bsls::Stopwatch s;
+            s.start();
+
+            for (int iter = 0; iter < numIterations; ++iter) {
+                for (int i = 0; i < numStrings; ++i) {
+                    Util::parseDecimal64(&values[i], strings[i].c_str());
+                }
+            }
+
+            const double totalTime = s.accumulatedWallTime();
+            bsl::cout << "parseDecimal64:            "
+                      << static_cast<int>(totalTime * 1e9 / numOperations)
+                      << " ns/op" << bsl::endl;
+        }
+        {
+            bsls::Stopwatch s;
+            s.start();
+
+            for (int iter = 0; iter < numIterations; ++iter) {
+                for (int i = 0; i < numStrings; ++i) {
+                    ImpUtil::ValueType64 value =
+                         bdldfp::DecimalImpUtil_IntelDfp::parse64(
+                                                        strings[i].c_str());
+                    checksum += static_cast<double>(value.d_raw & 1);
+                }
+            }
+
+            const double totalTime = s.accumulatedWallTime();
+            bsl::cout << "library parse64:           "
+                      << static_cast<int>(totalTime * 1e9 / numOperations)
+                      << " ns/op" << bsl::endl;
+        }
+
+        const Config::Style styles[]     = { Config::e_NATURAL,
+                                             Config::e_FIXED };
+        const char *const   styleNames[] = { "natural", "fixed  " };
+
+        for (int si = 0; si < 2; ++si) {
+            const Config config(4, styles[si]);
+
+            char buffer[64];
+
+            {
+                bsls::Stopwatch s;
+                s.start();
+
+                for (int iter = 0; iter < numIterations; ++iter) {
+                    for (int i = 0; i < numStrings; ++i) {
+                        checksum += ImpUtil::format(buffer,
+                                                    sizeof buffer,
+                                                    *values[i].data(),
+                                                    config);
+                    }
+                }
+
+                const double totalTime = s.accumulatedWallTime();
+                bsl::cout << "format Decimal64  " << styleNames[si] << ": "
+                          << static_cast<int>(totalTime * 1e9 / numOperations)
+                          << " ns/op" << bsl::endl;
+            }
+            {
+                bsl::vector<ImpUtil::ValueType128> wide(numStrings, &ta);
+                for (int i = 0; i < numStrings; ++i) {
+                    wide[i] = ImpUtil::convertToDecimal128(*values[i].data());
+                }
+
+                bsls::Stopwatch s;
+                s.start();
+
+                for (int iter = 0; iter < numIterations; ++iter) {
+                    for (int i = 0; i < numStrings; ++i) {
+                        checksum += ImpUtil::format(buffer,
+                                                    sizeof buffer,
+                                                    wide[i],
+                                                    config);
+                    }
+                }
+
+                const double totalTime = s.accumulatedWallTime();
+                bsl::cout << "format Decimal128 " << styleNames[si] << ": "
+                          << static_cast<int>(totalTime * 1e9 / numOperations)
+                          << " ns/op" << bsl::endl;
+            }
+        }
+
+        bsl::cout << "Checksum: " << checksum << bsl::endl;
+    } break;
+    case -11: {
+        // --------------------------------------------------------------------
+        // TESTING: Performance test of 'sum' and 'dotProduct'.
+        //
+        // Compare the performance of 'sum' and 'dotProduct' with that of
+        // accumulating the same arrays of prices and quantities element by
+        // element using 'operator+' and 'operator*'.
+        // --------------------------------------------------------------------
+
+        const int numValues     = 10000;
+        const int numIterations = 1000;
+        const int numOperations = numValues * numIterations;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        bsl::vector<BDEC::Decimal64> prices(&ta);
+        bsl::vector<BDEC::Decimal64> quantities(&ta);
+        for (int i = 0; i < numValues; ++i) {
+            prices.push_back(Util::makeDecimalRaw64(rand() % 1000000, -4));
+            quantities.push_back(Util::makeDecimalRaw64(rand() % 2000 - 1000,
+                                                        0));
+        }
+
+        BDEC::Decimal64 checksum(0);
+
+        {
+            bsls::Stopwatch s;
+            s.start();
+
+            for (int iter = 0; iter < numIterations; ++iter) {
+                BDEC::Decimal64 total(0);
+                for (int i = 0; i < numValues; ++i) {
+                    total += prices[i];
+                }
+                checksum += total;
+            }
+
+            const double totalTime = s.accumulatedWallTime();
+            bsl::cout << "operator+:  "
+                      << static_cast<int>(totalTime * 1e9 / numOperations)
+                      << " ns/element" << bsl::endl;
+        }
+        {
+            bsls::Stopwatch s;
+            s.start();
+
+            for (int iter = 0; iter < numIterations; ++iter) {
+                checksum += Util::sum(prices.data(), numValues);
+            }
+
+            const double totalTime = s.accumulatedWallTime();
+            bsl::cout << "sum:        "
+                      << static_cast<int>(totalTime * 1e9 / numOperations)
+                      << " ns/element" << bsl::endl;
+        }
+        {
+            bsls::Stopwatch s;
+            s.start();
+
+            for (int iter = 0; iter < numIterations; ++iter) {
+                BDEC::Decimal64 total(0);
+                for (int i = 0; i < numValues; ++i) {
+                    total += prices[i] * quantities[i];
+                }
+                checksum += total;
+            }
+
+            const double totalTime = s.accumulatedWallTime();
+            bsl::cout << "operator*+: "
+                      << static_cast<int>(totalTime * 1e9 / numOperations)
+                      << " ns/element" << bsl::endl;
+        }
+        {
+            bsls::Stopwatch s;
+            s.start();
+
+            for (int iter = 0; iter < numIterations; ++iter) {
+                checksum += Util::dotProduct(prices.data(),
+                                             quantities.data(),
+                                             numValues);
+            }
+
+            const double totalTime = s.accumulatedWallTime();
+            bsl::cout << "dotProduct: "
+                      << static_cast<int>(totalTime * 1e9 / numOperations)
+                      << " ns/element" << bsl::endl;
+        }
+
+        char      buffer[64];
+        const int length = Util::format(buffer, sizeof buffer, checksum);
+
+        bsl::cout << "Checksum: " << bsl::string(buffer, length, &ta)
+                  << bsl::endl;
+    } break;
     default: {
         cerr << "WARNING: CASE '" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -0,0 +1,391 @@
+// bdlma_hugepageallocator.cpp                                        -*-C++-*-
+#include <bdlma_hugepageallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_hugepageallocator_cpp,"$Id$ $CSID$")
+
+#include <bslmt_lockguard.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>      // 'BSLS_THROW'
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_new.h>                 // 'bsl::bad_alloc'
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+#include <windows.h>   // 'VirtualAlloc', 'VirtualFree', 'VirtualQuery'
+
+#else
+
+#include <sys/mman.h>  // 'madvise', 'mmap', 'munmap'
+
+#endif
+
+namespace BloombergLP {
+namespace {
+
+typedef bsls::Types::size_type size_type;
+
+const size_type k_HUGE_PAGE_SIZE = bdlma::HugePageAllocator::k_HUGE_PAGE_SIZE;
+
+const size_type k_HEADER_SIZE    = 2 * bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+    // size (in bytes) reserved for the header at the start of each region,
+    // leaving the memory that follows it maximally aligned
+
+// HELPER FUNCTIONS
+
+size_type roundUpToHugePageSize(size_type size)
+    // Return the specified 'size' rounded up to the least multiple of
+    // 'k_HUGE_PAGE_SIZE'.
+{
+    return (size + k_HUGE_PAGE_SIZE - 1) & ~(k_HUGE_PAGE_SIZE - 1);
+}
+
+void *systemMap(size_type                               size,
+                bdlma::HugePageAllocator::HugePageMode  mode,
+                bool                                   *isHugePageBacked)
+    // Map a block of memory of the specified 'size' (in bytes), aligned to
+    // 'k_HUGE_PAGE_SIZE', from the source of huge pages indicated by the
+    // specified 'mode', load into the specified 'isHugePageBacked' whether
+    // the operating system accepted the request for huge pages, and return
+    // the address of the block.  Return 0 if the block cannot be mapped.  The
+    // behavior is undefined unless 'size' is a positive multiple of
+    // 'k_HUGE_PAGE_SIZE'.
+{
+    BSLS_ASSERT(0 < size);
+    BSLS_ASSERT(0 == size % k_HUGE_PAGE_SIZE);
+
+    *isHugePageBacked = false;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    // Large pages require the 'SeLockMemoryPrivilege' privilege on Windows,
+    // which a process rarely holds, so ordinary pages are used.  The
+    // allocation granularity of 'VirtualAlloc' (64KB) is smaller than
+    // 'k_HUGE_PAGE_SIZE', so reserve an additional huge page of address
+    // space, and commit only the block of 'size' bytes aligned to
+    // 'k_HUGE_PAGE_SIZE' within it.  'systemUnmap' releases the entire
+    // reservation.
+
+    (void)mode;
+
+    char *reserved = static_cast<char *>(VirtualAlloc(0,
+                                                      size + k_HUGE_PAGE_SIZE,
+                                                      MEM_RESERVE,
+                                                      PAGE_NOACCESS));
+
+    if (!reserved) {
+        return 0;                                                     // RETURN
+    }
+
+    char *address = reinterpret_cast<char *>(
+               roundUpToHugePageSize(reinterpret_cast<bsls::Types::UintPtr>(
+                                                                  reserved)));
+
+    if (!VirtualAlloc(address, size, MEM_COMMIT, PAGE_READWRITE)) {
+        VirtualFree(reserved, 0, MEM_RELEASE);
+        return 0;                                                     // RETURN
+    }
+
+    return address;                                                   // RETURN
+
+#else
+
+#ifdef MAP_HUGETLB
+    if (bdlma::HugePageAllocator::e_RESERVED == mode) {
+        void *address = mmap(0,
+                             size,
+                             PROT_READ | PROT_WRITE,
+                             MAP_ANON | MAP_PRIVATE | MAP_HUGETLB,
+                             -1,
+                             0);
+
+        if (MAP_FAILED != address) {
+            *isHugePageBacked = true;
+            return address;                                           // RETURN
+        }
+    }
+#else
+    (void)mode;
+#endif
+
+    // Map an additional huge page, so that the mapping contains a block of
+    // 'size' bytes aligned to 'k_HUGE_PAGE_SIZE', and unmap the excess at
+    // either end.
+
+    const size_type mappedSize = size + k_HUGE_PAGE_SIZE;
+
+    void *mapped = mmap(0,
+                        mappedSize,
+                        PROT_READ | PROT_WRITE,
+                        MAP_ANON | MAP_PRIVATE,
+                        -1,
+                        0);
+
+    if (MAP_FAILED == mapped) {
+        return 0;                                                     // RETURN
+    }
+
+    // On some of our platforms, 'munmap' and 'madvise' take a 'char*'
+    // argument, while on others they take a 'void*'.  Casting to 'char*'
+    // works in both cases.
+
+    char *begin   = static_cast<char *>(mapped);
+    char *end     = begin + mappedSize;
+    char *address = reinterpret_cast<char *>(
+               roundUpToHugePageSize(reinterpret_cast<bsls::Types::UintPtr>(
+                                                                     begin)));
+
+    if (begin != address) {
+        munmap(begin, address - begin);
+    }
+    if (address + size != end) {
+        munmap(address + size, end - (address + size));
+    }
+
+#ifdef MADV_HUGEPAGE
+    *isHugePageBacked = 0 == madvise(address, size, MADV_HUGEPAGE);
+#endif
+
+    return address;                                                   // RETURN
+
+#endif
+}
+
+void systemUnmap(void *address, size_type size)
+    // Return the block of memory of the specified 'size' (in bytes) at the
+    // specified 'address' to the operating system.  The behavior is undefined
+    // unless 'address' and 'size' describe a block returned by 'systemMap'
+    // that has not already been unmapped.
+{
+    BSLS_ASSERT(address);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    // 'address' may follow the start of the reservation made by 'systemMap',
+    // which must be released as a whole.
+
+    MEMORY_BASIC_INFORMATION info;
+
+    VirtualQuery(address, &info, sizeof info);
+    VirtualFree(info.AllocationBase, 0, MEM_RELEASE);
+    (void)size;
+
+#else
+
+    munmap(static_cast<char *>(address), size);
+
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                     // ================================
+                     // struct HugePageAllocator::Region
+                     // ================================
+
+struct HugePageAllocator::Region {
+    // This 'struct' defines the header of a region mapped by a
+    // 'HugePageAllocator', located at the start of the region.  The memory
+    // supplied by the allocator follows the header.
+
+    // DATA
+    Region    *d_next_p;  // region mapped before this one, or 0
+
+    size_type  d_size;    // size (in bytes) of this region
+};
+
+                          // -----------------------
+                          // class HugePageAllocator
+                          // -----------------------
+
+// PRIVATE MANIPULATORS
+HugePageAllocator::Region *HugePageAllocator::mapRegion(size_type size)
+{
+    BSLMF_ASSERT(sizeof(Region) <= k_HEADER_SIZE);
+
+    BSLS_ASSERT(0 == size % k_HUGE_PAGE_SIZE);
+
+    bool  isHugePageBacked;
+    void *address = systemMap(size, d_mode, &isHugePageBacked);
+
+    if (!address) {
+        return 0;                                                     // RETURN
+    }
+
+    Region *region = static_cast<Region *>(address);
+
+    region->d_next_p = d_regions_p;
+    region->d_size   = size;
+
+    d_regions_p = region;
+
+    ++d_numRegions;
+    d_numHugePageRegions += isHugePageBacked;
+    d_numBytesMapped     += size;
+
+    return region;
+}
+
+// CREATORS
+HugePageAllocator::HugePageAllocator(HugePageMode mode)
+: d_regions_p(0)
+, d_cursor_p(0)
+, d_end_p(0)
+, d_regionSize(k_HUGE_PAGE_SIZE)
+, d_mode(mode)
+, d_numRegions(0)
+, d_numHugePageRegions(0)
+, d_numBytesMapped(0)
+{
+}
+
+HugePageAllocator::HugePageAllocator(size_type    regionSize,
+                                     HugePageMode mode)
+: d_regions_p(0)
+, d_cursor_p(0)
+, d_end_p(0)
+, d_regionSize(roundUpToHugePageSize(regionSize))
+, d_mode(mode)
+, d_numRegions(0)
+, d_numHugePageRegions(0)
+, d_numBytesMapped(0)
+{
+    BSLS_ASSERT(0 < regionSize);
+}
+
+HugePageAllocator::~HugePageAllocator()
+{
+    release();
+}
+
+// MANIPULATORS
+void *HugePageAllocator::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    const size_type paddedSize =
+                          bsls::AlignmentUtil::roundUpToMaximalAlignment(size);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    // 'd_cursor_p' is always maximally aligned.
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                       paddedSize <= static_cast<size_type>(d_end_p -
+                                                            d_cursor_p))) {
+        void *address = d_cursor_p;
+        d_cursor_p += paddedSize;
+        return address;                                               // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    if (paddedSize > d_regionSize / 2) {
+        // Satisfy the request from a region of its own, leaving the current
+        // region undisturbed.
+
+        Region *region = mapRegion(roundUpToHugePageSize(k_HEADER_SIZE +
+                                                         paddedSize));
+        if (!region) {
+#ifdef BDE_BUILD_TARGET_EXC
+            BSLS_THROW(bsl::bad_alloc());
+#else
+            return 0;                                                 // RETURN
+#endif
+        }
+
+        return reinterpret_cast<char *>(region) + k_HEADER_SIZE;      // RETURN
+    }
+
+    Region *region = mapRegion(d_regionSize);
+    if (!region) {
+#ifdef BDE_BUILD_TARGET_EXC
+        BSLS_THROW(bsl::bad_alloc());
+#else
+        return 0;                                                     // RETURN
+#endif
+    }
+
+    char *address = reinterpret_cast<char *>(region) + k_HEADER_SIZE;
+
+    d_cursor_p = address + paddedSize;
+    d_end_p    = reinterpret_cast<char *>(region) + d_regionSize;
+
+    return address;
+}
+
+void HugePageAllocator::deallocate(void *)
+{
+}
+
+void HugePageAllocator::release()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    Region *region = d_regions_p;
+    while (region) {
+        Region *next = region->d_next_p;
+        systemUnmap(region, region->d_size);
+        region = next;
+    }
+
+    d_regions_p          = 0;
+    d_cursor_p           = 0;
+    d_end_p              = 0;
+    d_numRegions         = 0;
+    d_numHugePageRegions = 0;
+    d_numBytesMapped     = 0;
+}
+
+// ACCESSORS
+bsls::Types::Int64 HugePageAllocator::numBytesMapped() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numBytesMapped;
+}
+
+int HugePageAllocator::numHugePageRegions() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numHugePageRegions;
+}
+
+int HugePageAllocator::numRegions() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numRegions;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
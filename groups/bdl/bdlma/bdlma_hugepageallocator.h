@@ -0,0 +1,337 @@
+// bdlma_hugepageallocator.h                                          -*-C++-*-
+#ifndef INCLUDED_BDLMA_HUGEPAGEALLOCATOR
+#define INCLUDED_BDLMA_HUGEPAGEALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a managed allocator supplying memory from huge pages.
+//
+//@CLASSES:
+//  bdlma::HugePageAllocator: managed allocator of huge-page-backed memory
+//
+//@SEE_ALSO: bdlma_managedallocator, bdlma_infrequentdeleteblocklist
+//
+//@DESCRIPTION: This component provides a concrete allocation mechanism,
+// 'bdlma::HugePageAllocator', that implements the 'bdlma::ManagedAllocator'
+// protocol and supplies memory from large regions obtained directly from the
+// operating system, aligned to, and sized in multiples of, the huge-page size
+// ('HugePageAllocator::k_HUGE_PAGE_SIZE', 2MB), and backed, where the platform
+// permits, by huge pages:
+//..
+//   ,------------------------.
+//  ( bdlma::HugePageAllocator )
+//   `------------------------'
+//               |         ctor/dtor
+//               |         mode
+//               |         numBytesMapped
+//               |         numHugePageRegions
+//               |         numRegions
+//               |         regionSize
+//               V
+//   ,-----------------------.
+//  ( bdlma::ManagedAllocator )
+//   `-----------------------'
+//               |         release
+//               V
+//      ,----------------.
+//     ( bslma::Allocator )
+//      `----------------'
+//                         allocate
+//                         deallocate
+//..
+// A program whose working set is spread over a large population of small
+// objects (e.g., the nodes of a large tree or hash table) typically incurs a
+// translation lookaside buffer (TLB) miss on most accesses when that memory is
+// backed by 4KB pages.  Backing the same memory by 2MB pages reduces the
+// number of TLB entries the working set requires by a factor of 512.
+//
+// This allocator is intended to serve as the *block source* of components
+// that obtain a few large blocks from the allocator supplied at construction
+// and carve them into objects (e.g., 'bdlma::InfrequentDeleteBlockList'), or
+// to be used directly as an arena supplying a large population of small
+// objects that share a lifetime:
+//..
+//  bdlma::HugePageAllocator         hugePageAllocator;
+//  bdlma::InfrequentDeleteBlockList blockList(&hugePageAllocator);
+//..
+// Requests are satisfied sequentially from the most recently mapped region,
+// and 'deallocate' has no effect: memory is returned to the operating system
+// only by 'release' or on destruction.  A request that does not fit in the
+// remainder of the current region is satisfied from a newly-mapped region,
+// which becomes the current region unless the request exceeds half of the
+// region size, in which case the new region is mapped for that request alone.
+// Consequently, this allocator is *not* suited for general-purpose use, in
+// which blocks are frequently allocated and deallocated.
+//
+///Obtaining Huge Pages
+///--------------------
+// On Linux, each region is obtained according to the 'HugePageMode' supplied
+// at construction:
+//
+//: 'e_TRANSPARENT' (the default):
+//:   The region is mapped with 'mmap', aligned to 'k_HUGE_PAGE_SIZE', and the
+//:   kernel is advised (using 'madvise(MADV_HUGEPAGE)') to back the region by
+//:   transparent huge pages.  Whether, and how soon, the kernel does so
+//:   depends on the system configuration (see
+//:   '/sys/kernel/mm/transparent_hugepage/enabled').
+//:
+//: 'e_RESERVED':
+//:   The region is first requested from the pool of huge pages reserved by
+//:   the system administrator (using 'mmap' with 'MAP_HUGETLB').  If that
+//:   pool is exhausted or empty, the region is obtained as for
+//:   'e_TRANSPARENT'.
+//
+// If neither kind of huge page is available, the region is backed by ordinary
+// pages, and the allocator remains fully functional.  On other platforms,
+// regions are always backed by ordinary pages, but are still aligned to
+// 'k_HUGE_PAGE_SIZE' (on Windows, by reserving, but not committing, an
+// additional huge page of address space for each region).  The
+// 'numHugePageRegions' accessor reports the number of regions for which the
+// request for huge pages was accepted by the operating system; note that, for
+// 'e_TRANSPARENT', acceptance of the advice does not guarantee that the kernel
+// will find contiguous physical memory for every huge page.
+//
+///Thread Safety
+///-------------
+// The 'bdlma::HugePageAllocator' class is fully thread-safe (see
+// 'bsldoc_glossary').
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Supplying a Large Index from Huge Pages
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we maintain a large index of fixed-size records that we access
+// in an unpredictable order, and that profiling shows the lookups to be
+// dominated by TLB misses.  The records are created together and discarded
+// together, so we supply them from a 'bdlma::HugePageAllocator'.
+//
+// First, we define the record type:
+//..
+//  struct Record {
+//      // This 'struct' holds a record of the index.
+//
+//      Record *d_next_p;   // next record in the chain
+//      int     d_key;      // key of the record
+//      int     d_payload;  // payload of the record
+//  };
+//..
+// Then, we create the huge-page allocator:
+//..
+//  bdlma::HugePageAllocator hugePageAllocator;
+//..
+// Next, we create a chain of records supplied by the allocator:
+//..
+//  Record *head = 0;
+//  for (int i = 0; i < 10000; ++i) {
+//      Record *record = static_cast<Record *>(
+//                                hugePageAllocator.allocate(sizeof(Record)));
+//
+//      record->d_next_p  = head;
+//      record->d_key     = i;
+//      record->d_payload = 2 * i;
+//
+//      head = record;
+//  }
+//..
+// Now, we observe that the records lie in a single region, mapped by the
+// allocator in a multiple of the huge-page size:
+//..
+//  typedef bdlma::HugePageAllocator HPA;
+//
+//  assert(1 == hugePageAllocator.numRegions());
+//  assert(0 == hugePageAllocator.numBytesMapped() % HPA::k_HUGE_PAGE_SIZE);
+//..
+// Finally, we discard the records by releasing the allocator:
+//..
+//  hugePageAllocator.release();
+//
+//  assert(0 == hugePageAllocator.numRegions());
+//  assert(0 == hugePageAllocator.numBytesMapped());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_managedallocator.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                          // =======================
+                          // class HugePageAllocator
+                          // =======================
+
+class HugePageAllocator : public ManagedAllocator {
+    // This class defines a concrete thread-safe managed allocator that
+    // supplies memory sequentially from regions obtained from the operating
+    // system, each aligned to, and sized in a multiple of, the huge-page size,
+    // and backed by huge pages where the platform permits.  'deallocate' has
+    // no effect; all memory is returned to the operating system by 'release'
+    // and on destruction.
+
+  public:
+    // TYPES
+    enum HugePageMode {
+        // Enumerate the sources of huge pages that 'HugePageAllocator' may use
+        // (see {Obtaining Huge Pages}).
+
+        e_TRANSPARENT,  // advise the kernel to use transparent huge pages
+        e_RESERVED      // use the reserved huge-page pool, or else as for
+                        // 'e_TRANSPARENT'
+    };
+
+    enum {
+        k_HUGE_PAGE_SIZE = 2 * 1024 * 1024  // size (in bytes) of a huge page,
+                                            // and the alignment and size
+                                            // granularity of every region
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct Region;
+        // header, located at the start of each mapped region, linking the
+        // regions mapped by an allocator
+
+    // DATA
+    Region                 *d_regions_p;          // most recently mapped
+                                                  // region, or 0
+
+    char                   *d_cursor_p;           // next free byte of the
+                                                  // current region
+
+    char                   *d_end_p;              // end of the current region
+
+    bsls::Types::size_type  d_regionSize;         // size (in bytes) of a
+                                                  // region shared by requests
+
+    HugePageMode            d_mode;               // source of huge pages
+
+    int                     d_numRegions;         // number of mapped regions
+
+    int                     d_numHugePageRegions; // number of mapped regions
+                                                  // backed by huge pages
+
+    bsls::Types::Int64      d_numBytesMapped;     // total size of the mapped
+                                                  // regions
+
+    mutable bslmt::Mutex    d_mutex;              // protects all data members
+
+  private:
+    // NOT IMPLEMENTED
+    HugePageAllocator(const HugePageAllocator&);
+    HugePageAllocator& operator=(const HugePageAllocator&);
+
+    // PRIVATE MANIPULATORS
+    Region *mapRegion(bsls::Types::size_type size);
+        // Map a region of the specified 'size' (in bytes), link it into the
+        // list of regions of this allocator, and return its address.  Return
+        // 0, with no effect, if the region cannot be mapped.  The behavior is
+        // undefined unless 'size' is a multiple of 'k_HUGE_PAGE_SIZE', and
+        // 'd_mutex' is locked.
+
+  public:
+    // CREATORS
+    explicit
+    HugePageAllocator(HugePageMode mode = e_TRANSPARENT);
+        // Create a huge-page allocator mapping regions of 'k_HUGE_PAGE_SIZE'
+        // bytes.  Optionally specify a 'mode' indicating the source of huge
+        // pages.  If 'mode' is not specified, 'e_TRANSPARENT' is used.
+
+    explicit
+    HugePageAllocator(bsls::Types::size_type regionSize,
+                      HugePageMode           mode = e_TRANSPARENT);
+        // Create a huge-page allocator mapping regions of the specified
+        // 'regionSize' (in bytes), rounded up to a multiple of
+        // 'k_HUGE_PAGE_SIZE'.  Optionally specify a 'mode' indicating the
+        // source of huge pages.  If 'mode' is not specified, 'e_TRANSPARENT'
+        // is used.  The behavior is undefined unless '0 < regionSize'.
+
+    virtual ~HugePageAllocator();
+        // Destroy this allocator, returning all memory it has mapped to the
+        // operating system.
+
+    // MANIPULATORS
+    virtual void *allocate(bsls::Types::size_type size) BSLS_KEYWORD_OVERRIDE;
+        // Return a newly-allocated maximally-aligned block of memory of the
+        // specified 'size' (in bytes).  If 'size' is 0, no memory is
+        // allocated and 0 is returned.  If a region must be mapped to satisfy
+        // the request and the operating system cannot supply one, throw
+        // 'bsl::bad_alloc' (or return 0 if exceptions are disabled).
+
+    virtual void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
+        // This method has no effect.  The memory block at the specified
+        // 'address' is returned to the operating system by 'release', or on
+        // destruction of this allocator.
+
+    virtual void release() BSLS_KEYWORD_OVERRIDE;
+        // Return all memory mapped by this allocator to the operating system,
+        // invalidating every block it has allocated.
+
+    // ACCESSORS
+    HugePageMode mode() const;
+        // Return the source of huge pages of this allocator.
+
+    bsls::Types::Int64 numBytesMapped() const;
+        // Return the total size (in bytes) of the regions currently mapped by
+        // this allocator.
+
+    int numHugePageRegions() const;
+        // Return the number of regions currently mapped by this allocator for
+        // which the operating system accepted the request for huge pages.
+
+    int numRegions() const;
+        // Return the number of regions currently mapped by this allocator.
+
+    bsls::Types::size_type regionSize() const;
+        // Return the size (in bytes) of the regions mapped by this allocator
+        // to be shared by requests not exceeding half that size.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class HugePageAllocator
+                          // -----------------------
+
+// ACCESSORS
+inline
+HugePageAllocator::HugePageMode HugePageAllocator::mode() const
+{
+    return d_mode;
+}
+
+inline
+bsls::Types::size_type HugePageAllocator::regionSize() const
+{
+    return d_regionSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
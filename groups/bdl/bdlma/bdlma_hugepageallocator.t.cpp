@@ -0,0 +1,878 @@
+// bdlma_hugepageallocator.t.cpp                                      -*-C++-*-
+#include <bdlma_hugepageallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::HugePageAllocator' is a managed allocator that supplies memory
+// sequentially from large regions mapped directly from the operating system.
+// The primary concerns are that the blocks it returns are maximally aligned,
+// usable, and disjoint, that the regions are sized and aligned in multiples of
+// the huge-page size, that requests are satisfied from the current region or
+// from new regions as documented, and that 'release' and the destructor
+// return every region to the operating system.  Whether the operating system
+// honors a request for huge pages depends on the system configuration, so the
+// tests verify only that the allocator is fully functional in either case.
+// Note that since the 'bdlma::HugePageAllocator' constructor does not accept
+// an optional allocator argument, there is scant opportunity to use
+// 'bslma::TestAllocator' in this test driver.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] HugePageAllocator(HugePageMode mode = e_TRANSPARENT);
+// [ 2] HugePageAllocator(size_type regionSize, HugePageMode mode = ...);
+// [ 2] ~HugePageAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(bsls::Types::size_type size);
+// [ 3] void deallocate(void *address);
+// [ 3] void release();
+//
+// ACCESSORS
+// [ 2] HugePageMode mode() const;
+// [ 3] bsls::Types::Int64 numBytesMapped() const;
+// [ 3] int numHugePageRegions() const;
+// [ 3] int numRegions() const;
+// [ 2] bsls::Types::size_type regionSize() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+// [ *] CONCERN: In no case does memory come from the global allocator.
+// [ 4] CONCERN: The 'allocate' method is thread-safe.
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::HugePageAllocator Obj;
+typedef bsls::Types::size_type   size_type;
+typedef bsls::Types::UintPtr     UintPtr;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+const size_type k_HUGE_PAGE_SIZE = Obj::k_HUGE_PAGE_SIZE;
+const int       k_MAX_ALIGNMENT  = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool isDisjoint(const bsl::vector<bsl::pair<char *, size_type> >& blocks)
+    // Return 'true' if no two of the specified 'blocks', each described by
+    // its address and size (in bytes), overlap, and 'false' otherwise.
+{
+    bsl::vector<bsl::pair<char *, size_type> > sorted(blocks);
+    bsl::sort(sorted.begin(), sorted.end());
+
+    for (bsl::size_t i = 1; i < sorted.size(); ++i) {
+        if (sorted[i - 1].first + sorted[i - 1].second > sorted[i].first) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+void fillBlock(char *address, size_type size, char value)
+    // Write the specified 'value' to the first, middle, and last bytes of the
+    // block of the specified 'size' (in bytes) at the specified 'address'.
+{
+    address[0]        = value;
+    address[size / 2] = value;
+    address[size - 1] = value;
+}
+
+bool isFilled(const char *address, size_type size, char value)
+    // Return 'true' if the first, middle, and last bytes of the block of the
+    // specified 'size' (in bytes) at the specified 'address' have the
+    // specified 'value', and 'false' otherwise.
+{
+    return value == address[0]
+        && value == address[size / 2]
+        && value == address[size - 1];
+}
+
+                            // ==================
+                            // ConcurrencyTestArg
+                            // ==================
+
+enum { k_NUM_THREADS = 4, k_NUM_ALLOCATIONS = 20000 };
+
+struct ConcurrencyTestArg {
+    // This 'struct' holds the arguments of a thread of the concurrency test.
+
+    Obj              *d_allocator_p;  // allocator under test
+    bslmt::Barrier   *d_barrier_p;    // barrier synchronizing the threads
+    char            **d_blocks_p;     // blocks allocated by the thread
+    int               d_id;           // index of the thread
+};
+
+extern "C"
+void *concurrencyTestThread(void *arg)
+    // Allocate 'k_NUM_ALLOCATIONS' blocks from the allocator described by the
+    // specified 'arg', which must address a 'ConcurrencyTestArg', record each
+    // in the block array described by 'arg', and mark each with the index of
+    // the thread.
+{
+    ConcurrencyTestArg *args = static_cast<ConcurrencyTestArg *>(arg);
+
+    args->d_barrier_p->wait();
+
+    for (int i = 0; i < k_NUM_ALLOCATIONS; ++i) {
+        const size_type size = 1 + i % 200;
+
+        char *block = static_cast<char *>(args->d_allocator_p->allocate(size));
+
+        bsl::memset(block, args->d_id, size);
+        args->d_blocks_p[i] = block;
+    }
+    return arg;
+}
+
+                            // ================
+                            // PERFORMANCE TEST
+                            // ================
+
+struct Node {
+    // This 'struct' defines a node of a randomly-ordered cyclic list, padded
+    // to the size of a cache line.
+
+    Node *d_next_p;     // next node
+    char  d_pad[56];    // padding
+};
+
+static UintPtr s_antiOptimization = 0;
+
+double toDouble(const bsls::TimeInterval& duration)
+    // Return the specified 'duration' in nanoseconds.
+{
+    return static_cast<double>(duration.totalNanoseconds());
+}
+
+bsls::TimeInterval chaseNodes(bslma::Allocator *allocator,
+                              int               numNodes,
+                              int               numSteps)
+    // Create the specified 'numNodes' nodes using the specified 'allocator',
+    // link them into a randomly-ordered cycle, and return the median time
+    // taken to follow the specified 'numSteps' links of the cycle.
+{
+    bsl::vector<Node *> nodes;
+    nodes.reserve(numNodes);
+    for (int i = 0; i < numNodes; ++i) {
+        nodes.push_back(static_cast<Node *>(allocator->allocate(
+                                                               sizeof(Node))));
+    }
+
+    bsl::srand(1);
+    for (int i = numNodes - 1; 0 < i; --i) {
+        const int j = static_cast<int>(
+                      ((static_cast<unsigned int>(bsl::rand()) << 15) ^
+                        static_cast<unsigned int>(bsl::rand())) % (i + 1));
+        bsl::swap(nodes[i], nodes[j]);
+    }
+    for (int i = 0; i < numNodes; ++i) {
+        nodes[i]->d_next_p = nodes[(i + 1) % numNodes];
+    }
+
+    const int NUM_TRIAL = 11;
+
+    bsl::vector<bsls::TimeInterval> results;
+    for (int trial = 0; trial < NUM_TRIAL; ++trial) {
+        const Node *node = nodes[0];
+
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+        for (int i = 0; i < numSteps; ++i) {
+            node = node->d_next_p;
+        }
+
+        results.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+
+        s_antiOptimization += reinterpret_cast<UintPtr>(node);
+    }
+
+    for (int i = 0; i < numNodes; ++i) {
+        allocator->deallocate(nodes[i]);
+    }
+
+    bsl::sort(results.begin(), results.end());
+
+    return results[NUM_TRIAL / 2];
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Supplying a Large Index from Huge Pages
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we maintain a large index of fixed-size records that we access
+// in an unpredictable order, and that profiling shows the lookups to be
+// dominated by TLB misses.  The records are created together and discarded
+// together, so we supply them from a 'bdlma::HugePageAllocator'.
+//
+// First, we define the record type:
+//..
+    struct Record {
+        // This 'struct' holds a record of the index.
+
+        Record *d_next_p;   // next record in the chain
+        int     d_key;      // key of the record
+        int     d_payload;  // payload of the record
+    };
+//..
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator(veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create the huge-page allocator:
+//..
+    bdlma::HugePageAllocator hugePageAllocator;
+//..
+// Next, we create a chain of records supplied by the allocator:
+//..
+    Record *head = 0;
+    for (int i = 0; i < 10000; ++i) {
+        Record *record = static_cast<Record *>(
+                                  hugePageAllocator.allocate(sizeof(Record)));
+
+        record->d_next_p  = head;
+        record->d_key     = i;
+        record->d_payload = 2 * i;
+
+        head = record;
+    }
+//..
+// Now, we observe that the records lie in a single region, mapped by the
+// allocator in a multiple of the huge-page size:
+//..
+    typedef bdlma::HugePageAllocator HPA;
+
+    ASSERT(1 == hugePageAllocator.numRegions());
+    ASSERT(0 == hugePageAllocator.numBytesMapped() % HPA::k_HUGE_PAGE_SIZE);
+//..
+// Finally, we discard the records by releasing the allocator:
+//..
+    hugePageAllocator.release();
+
+    ASSERT(0 == hugePageAllocator.numRegions());
+    ASSERT(0 == hugePageAllocator.numBytesMapped());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Blocks allocated concurrently by several threads are disjoint.
+        //
+        // Plan:
+        //: 1 Allocate many blocks of varying sizes concurrently from several
+        //:   threads, each of which fills its blocks with its own index.
+        //:   Once the threads are joined, verify that every block still holds
+        //:   the index of the thread that allocated it, and that the counts
+        //:   of mapped memory are consistent.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: The 'allocate' method is thread-safe.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        Obj mX;  const Obj& X = mX;
+
+        bslmt::Barrier barrier(k_NUM_THREADS);
+
+        bsl::vector<bsl::vector<char *> > blocks(
+                               k_NUM_THREADS,
+                               bsl::vector<char *>(k_NUM_ALLOCATIONS, 0, &ta),
+                               &ta);
+
+        ConcurrencyTestArg        args[k_NUM_THREADS];
+        bslmt::ThreadUtil::Handle threads[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            args[i].d_allocator_p = &mX;
+            args[i].d_barrier_p   = &barrier;
+            args[i].d_blocks_p    = blocks[i].data();
+            args[i].d_id          = i + 1;
+
+            int rc = bslmt::ThreadUtil::create(&threads[i],
+                                               concurrencyTestThread,
+                                               &args[i]);
+            LOOP_ASSERT(i, 0 == rc);
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            int rc = bslmt::ThreadUtil::join(threads[i]);
+            LOOP_ASSERT(i, 0 == rc);
+        }
+
+        for (int t = 0; t < k_NUM_THREADS; ++t) {
+            for (int i = 0; i < k_NUM_ALLOCATIONS; ++i) {
+                const size_type size  = 1 + i % 200;
+                const char     *block = blocks[t][i];
+
+                for (size_type j = 0; j < size; ++j) {
+                    if (t + 1 != block[j]) {
+                        ASSERTV(t, i, j, t + 1 == block[j]);
+                        break;
+                    }
+                }
+            }
+        }
+
+        ASSERT(0 < X.numRegions());
+        ASSERT(X.numBytesMapped() ==
+                       static_cast<bsls::Types::Int64>(X.numRegions()) *
+                                     static_cast<bsls::Types::Int64>(
+                                                           X.regionSize()));
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'allocate', 'deallocate', AND 'release'
+        //
+        // Concerns:
+        //: 1 'allocate' returns 0 for a request of 0 bytes, and otherwise a
+        //:   maximally-aligned block of the requested size, disjoint from
+        //:   every other block.
+        //:
+        //: 2 Requests are satisfied from the current region until it is
+        //:   exhausted, and then from a newly-mapped region.
+        //:
+        //: 3 A request exceeding half of the region size that does not fit
+        //:   in the current region is satisfied from a region of its own,
+        //:   sized in a multiple of the huge-page size, without disturbing
+        //:   the current region.
+        //:
+        //: 4 Every region is aligned to the huge-page size.
+        //:
+        //: 5 'deallocate' has no effect.
+        //:
+        //: 6 'release' returns every region, resets the counts, and leaves
+        //:   the allocator usable.
+        //:
+        //: 7 Every huge-page mode is fully functional, whether or not the
+        //:   operating system supplies huge pages.
+        //
+        // Plan:
+        //: 1 For each huge-page mode, allocate a sequence of blocks of
+        //:   varying sizes, including sizes exceeding half of the region
+        //:   size, write to each block, and verify the alignment and
+        //:   disjointness of the blocks, their contents, and the counts of
+        //:   mapped regions after each request.  (C-1..5, 7)
+        //:
+        //: 2 Call 'release', verify the counts, and allocate again.  (C-6)
+        //
+        // Testing:
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        //   void release();
+        //   bsls::Types::Int64 numBytesMapped() const;
+        //   int numHugePageRegions() const;
+        //   int numRegions() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'allocate', 'deallocate', AND 'release'" << endl
+                          << "=======================================" << endl;
+
+        const Obj::HugePageMode MODES[] = { Obj::e_TRANSPARENT,
+                                            Obj::e_RESERVED };
+        const int NUM_MODES = static_cast<int>(sizeof MODES / sizeof *MODES);
+
+        for (int m = 0; m < NUM_MODES; ++m) {
+            const Obj::HugePageMode MODE = MODES[m];
+
+            Obj mX(MODE);  const Obj& X = mX;
+
+            ASSERTV(m, 0 == mX.allocate(0));
+            ASSERTV(m, 0 == X.numRegions());
+
+            typedef bsl::pair<char *, size_type> Block;
+
+            bsl::vector<Block> blocks;
+
+            char *first = static_cast<char *>(mX.allocate(1));
+            fillBlock(first, 1, 1);
+            blocks.push_back(Block(first, 1));
+
+            ASSERTV(m, 1 == X.numRegions());
+            ASSERTV(m, static_cast<bsls::Types::Int64>(k_HUGE_PAGE_SIZE) ==
+                                                          X.numBytesMapped());
+            ASSERTV(m, X.numHugePageRegions() <= X.numRegions());
+
+            const UintPtr REGION = reinterpret_cast<UintPtr>(first) &
+                                                      ~(k_HUGE_PAGE_SIZE - 1);
+            ASSERTV(m, REGION + 2 * k_MAX_ALIGNMENT ==
+                                           reinterpret_cast<UintPtr>(first));
+
+            if (veryVerbose) {
+                P_(MODE) P(X.numHugePageRegions());
+            }
+
+            // Fill the first region with small blocks.
+
+            int numSmall = 1;
+            while (1 == X.numRegions()) {
+                const size_type size  = 1 + (numSmall * 37) % 1000;
+                char           *block = static_cast<char *>(
+                                                           mX.allocate(size));
+
+                ASSERTV(m, numSmall, 0 == reinterpret_cast<UintPtr>(block) %
+                                                              k_MAX_ALIGNMENT);
+
+                fillBlock(block, size, static_cast<char>(numSmall));
+                blocks.push_back(Block(block, size));
+                ++numSmall;
+            }
+            ASSERTV(m, 2 == X.numRegions());
+            ASSERTV(m, numSmall, 2000 < numSmall);
+
+            // Allocate a block larger than half of the region size that does
+            // not fit in the remainder of the current region.
+
+            const size_type LARGE = k_HUGE_PAGE_SIZE - 2 * k_MAX_ALIGNMENT;
+
+            char *large = static_cast<char *>(mX.allocate(LARGE));
+            fillBlock(large, LARGE, 'L');
+            blocks.push_back(Block(large, LARGE));
+
+            ASSERTV(m, 3 == X.numRegions());
+            ASSERTV(m, static_cast<bsls::Types::Int64>(3 * k_HUGE_PAGE_SIZE) ==
+                                                          X.numBytesMapped());
+
+            // The current region is undisturbed by the large request.
+
+            char *small = static_cast<char *>(mX.allocate(8));
+            fillBlock(small, 8, 'S');
+            blocks.push_back(Block(small, 8));
+            ASSERTV(m, 3 == X.numRegions());
+
+            // A request larger than a huge page spans several.
+
+            const size_type VERY_LARGE = 3 * k_HUGE_PAGE_SIZE;
+
+            char *huge = static_cast<char *>(mX.allocate(VERY_LARGE));
+            fillBlock(huge, VERY_LARGE, 'H');
+            blocks.push_back(Block(huge, VERY_LARGE));
+
+            ASSERTV(m, 4 == X.numRegions());
+            ASSERTV(m, static_cast<bsls::Types::Int64>(7 * k_HUGE_PAGE_SIZE) ==
+                                                          X.numBytesMapped());
+
+            mX.deallocate(0);
+            mX.deallocate(large);
+            ASSERTV(m, 4 == X.numRegions());
+
+            ASSERTV(m, isDisjoint(blocks));
+
+            ASSERTV(m, isFilled(first, 1, 1));
+            for (int i = 1; i < numSmall; ++i) {
+                ASSERTV(m, i, isFilled(blocks[i].first,
+                                       blocks[i].second,
+                                       static_cast<char>(i)));
+            }
+            ASSERTV(m, isFilled(large, LARGE, 'L'));
+            ASSERTV(m, isFilled(small, 8,     'S'));
+            ASSERTV(m, isFilled(huge,  VERY_LARGE,  'H'));
+
+            mX.release();
+            ASSERTV(m, 0 == X.numRegions());
+            ASSERTV(m, 0 == X.numHugePageRegions());
+            ASSERTV(m, 0 == X.numBytesMapped());
+
+            mX.release();
+            ASSERTV(m, 0 == X.numRegions());
+
+            char *again = static_cast<char *>(mX.allocate(100));
+            fillBlock(again, 100, 'A');
+            ASSERTV(m, isFilled(again, 100, 'A'));
+            ASSERTV(m, 1 == X.numRegions());
+        }
+
+        if (verbose) cout << "\nTesting a larger region size." << endl;
+        {
+            Obj mX(3 * k_HUGE_PAGE_SIZE);  const Obj& X = mX;
+
+            char *block = static_cast<char *>(mX.allocate(k_HUGE_PAGE_SIZE));
+            fillBlock(block, k_HUGE_PAGE_SIZE, 'B');
+
+            ASSERT(1 == X.numRegions());
+
+            for (int i = 0; i < 8; ++i) {
+                mX.allocate(k_HUGE_PAGE_SIZE / 8);
+            }
+            ASSERT(1 == X.numRegions());
+            ASSERT(isFilled(block, k_HUGE_PAGE_SIZE, 'B'));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The default region size is the huge-page size, and a specified
+        //:   region size is rounded up to a multiple of the huge-page size.
+        //:
+        //: 2 The default mode is 'e_TRANSPARENT', and a specified mode is
+        //:   retained.
+        //:
+        //: 3 A newly-created allocator has mapped no memory.
+        //:
+        //: 4 The destructor returns all mapped memory.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create allocators using each constructor, with and without a
+        //:   mode, and verify the accessors.  (C-1..3)
+        //:
+        //: 2 Create allocators that map many regions in a loop; the test
+        //:   would exhaust the address space if the destructor leaked them.
+        //:   (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   HugePageAllocator(HugePageMode mode = e_TRANSPARENT);
+        //   HugePageAllocator(size_type regionSize, HugePageMode mode = ...);
+        //   ~HugePageAllocator();
+        //   HugePageMode mode() const;
+        //   bsls::Types::size_type regionSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        {
+            const Obj X;
+
+            ASSERT(Obj::e_TRANSPARENT == X.mode());
+            ASSERT(k_HUGE_PAGE_SIZE   == X.regionSize());
+            ASSERT(0                  == X.numRegions());
+            ASSERT(0                  == X.numHugePageRegions());
+            ASSERT(0                  == X.numBytesMapped());
+        }
+        {
+            const Obj X(Obj::e_RESERVED);
+
+            ASSERT(Obj::e_RESERVED == X.mode());
+            ASSERT(k_HUGE_PAGE_SIZE == X.regionSize());
+        }
+
+        static const struct {
+            int       d_line;      // source line number
+            size_type d_size;      // specified region size
+            size_type d_expected;  // expected region size
+        } DATA[] = {
+            //LINE  SIZE                      EXPECTED
+            //----  ------------------------  --------------------
+            { L_,   1,                        k_HUGE_PAGE_SIZE     },
+            { L_,   4096,                     k_HUGE_PAGE_SIZE     },
+            { L_,   k_HUGE_PAGE_SIZE - 1,     k_HUGE_PAGE_SIZE     },
+            { L_,   k_HUGE_PAGE_SIZE,         k_HUGE_PAGE_SIZE     },
+            { L_,   k_HUGE_PAGE_SIZE + 1,     2 * k_HUGE_PAGE_SIZE },
+            { L_,   8 * k_HUGE_PAGE_SIZE,     8 * k_HUGE_PAGE_SIZE },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int       LINE     = DATA[ti].d_line;
+            const size_type SIZE     = DATA[ti].d_size;
+            const size_type EXPECTED = DATA[ti].d_expected;
+
+            const Obj X(SIZE);
+            const Obj Y(SIZE, Obj::e_RESERVED);
+
+            ASSERTV(LINE, EXPECTED           == X.regionSize());
+            ASSERTV(LINE, Obj::e_TRANSPARENT == X.mode());
+            ASSERTV(LINE, EXPECTED           == Y.regionSize());
+            ASSERTV(LINE, Obj::e_RESERVED    == Y.mode());
+        }
+
+        if (verbose) cout << "\nTesting the destructor." << endl;
+        {
+            for (int i = 0; i < 1000; ++i) {
+                Obj mX(64 * k_HUGE_PAGE_SIZE);
+
+                ASSERTV(i, 0 != mX.allocate(1));
+                ASSERTV(i, 0 != mX.allocate(64 * k_HUGE_PAGE_SIZE));
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Obj(0));
+            ASSERT_PASS(Obj(1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an allocator, allocate and write to a few blocks, and
+        //:   release them.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        char *a = static_cast<char *>(mX.allocate(100));
+        char *b = static_cast<char *>(mX.allocate(200));
+
+        bsl::memset(a, 'a', 100);
+        bsl::memset(b, 'b', 200);
+
+        ASSERT(a + 100 <= b);
+        ASSERT('a' == a[99]);
+        ASSERT(1   == X.numRegions());
+
+        if (verbose) {
+            P(X.numHugePageRegions());
+        }
+
+        mX.deallocate(a);
+        mX.release();
+
+        ASSERT(0 == X.numRegions());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Measure the effect of huge pages on a TLB-bound workload.
+        //
+        // Concerns:
+        //: 1 Following the links of a large randomly-ordered list is faster
+        //:   when its nodes are supplied by a 'bdlma::HugePageAllocator' than
+        //:   by the new-delete allocator.
+        //
+        // Plan:
+        //: 1 Create a randomly-ordered cyclic list of cache-line-sized nodes,
+        //:   whose working set exceeds the reach of the TLB, and time
+        //:   following its links, with the nodes supplied by the new-delete
+        //:   allocator, and by a 'bdlma::HugePageAllocator' in each mode.
+        //:   The number of nodes may be specified as the second argument of
+        //:   the test driver.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int ARG       = argc > 2 ? atoi(argv[2]) : 0;
+        const int NUM_NODES = 0 < ARG ? ARG : 4 * 1024 * 1024;
+        const int NUM_STEPS = 10 * 1000 * 1000;
+
+        bslma::NewDeleteAllocator ndAllocator;
+        Obj                       transparentAllocator(Obj::e_TRANSPARENT);
+        Obj                       reservedAllocator(Obj::e_RESERVED);
+
+        const double baseTime = toDouble(chaseNodes(&ndAllocator,
+                                                    NUM_NODES,
+                                                    NUM_STEPS));
+        const double transparentTime = toDouble(
+                                           chaseNodes(&transparentAllocator,
+                                                      NUM_NODES,
+                                                      NUM_STEPS));
+        const double reservedTime = toDouble(chaseNodes(&reservedAllocator,
+                                                        NUM_NODES,
+                                                        NUM_STEPS));
+
+        cout << "nodes: " << NUM_NODES
+             << " (" << (static_cast<double>(NUM_NODES) * sizeof(Node) /
+                                                             (1024 * 1024))
+             << "MB)" << endl
+             << "bslma::NewDeleteAllocator      : "
+             << baseTime / NUM_STEPS << " ns per step" << endl
+             << "HugePageAllocator e_TRANSPARENT: "
+             << transparentTime / NUM_STEPS << " ns per step, "
+             << 100.0 * (baseTime - transparentTime) / baseTime
+             << "% faster (" << transparentAllocator.numHugePageRegions()
+             << " of " << transparentAllocator.numRegions()
+             << " regions huge-page backed)" << endl
+             << "HugePageAllocator e_RESERVED   : "
+             << reservedTime / NUM_STEPS << " ns per step, "
+             << 100.0 * (baseTime - reservedTime) / baseTime
+             << "% faster (" << reservedAllocator.numHugePageRegions()
+             << " of " << reservedAllocator.numRegions()
+             << " regions huge-page backed)" << endl;
+
+        if (veryVerbose) {
+            P(s_antiOptimization);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
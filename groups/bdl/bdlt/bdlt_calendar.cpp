@@ -7,6 +7,8 @@ BSLS_IDENT_RCSID(bdlt_calendar_cpp,"$Id$ $CSID$")
 #include <bslma_default.h>
 #include <bsls_assert.h>
 
+#include <bsl_algorithm.h>
+#include <bsl_cstdint.h>
 #include <bsl_ostream.h>
 
 namespace BloombergLP {
@@ -21,6 +23,41 @@ BSLMF_ASSERT(-1 == static_cast<int>(bdlc::BitArray::k_INVALID_INDEX));
                               // --------------
 
 // PRIVATE MANIPULATORS
+void Calendar::reserveCacheCapacity(int numDays)
+{
+    d_nonBusinessDays.reserveCapacity(numDays);
+    d_businessDayIndex.reserve(
+                         numDays / bdlc::BitArray::k_BITS_PER_UINT64 + 2);
+}
+
+void Calendar::synchronizeBusinessDayIndex()
+{
+    const int length = static_cast<int>(d_nonBusinessDays.length());
+    if (0 == length) {
+        d_businessDayIndex.clear();
+        return;                                                       // RETURN
+    }
+
+    const int numBlocks = (length + bdlc::BitArray::k_BITS_PER_UINT64 - 1)
+                        / bdlc::BitArray::k_BITS_PER_UINT64;
+
+    d_businessDayIndex.resize(numBlocks + 1);
+
+    int count = 0;
+    for (int block = 0; block < numBlocks; ++block) {
+        const int offset  = block * bdlc::BitArray::k_BITS_PER_UINT64;
+        const int numBits = bsl::min(
+                                  static_cast<int>(
+                                          bdlc::BitArray::k_BITS_PER_UINT64),
+                                  length - offset);
+
+        d_businessDayIndex[block] = count;
+        count += numBits - bdlb::BitUtil::numBitsSet(
+                                   d_nonBusinessDays.bits(offset, numBits));
+    }
+    d_businessDayIndex[numBlocks] = count;
+}
+
 void Calendar::synchronizeCache()
 {
     const int length = d_packedCalendar.length();
@@ -87,6 +124,8 @@ void Calendar::synchronizeCache()
             }
         }
     }
+
+    synchronizeBusinessDayIndex();
 }
 
 // PRIVATE ACCESSORS
@@ -98,7 +137,25 @@ bool Calendar::isCacheSynchronized() const
     }
 
     if (0 == d_packedCalendar.length()) {
-        return true;                                                  // RETURN
+        return d_businessDayIndex.empty();                            // RETURN
+    }
+
+    const int numBlocks = static_cast<int>(d_businessDayIndex.size()) - 1;
+    if (numBlocks * bdlc::BitArray::k_BITS_PER_UINT64 <
+                                                   d_packedCalendar.length()
+     || (numBlocks - 1) * bdlc::BitArray::k_BITS_PER_UINT64 >=
+                                                 d_packedCalendar.length()) {
+        return false;                                                 // RETURN
+    }
+
+    for (int block = 0; block <= numBlocks; ++block) {
+        const int offset = bsl::min(
+                              block * bdlc::BitArray::k_BITS_PER_UINT64,
+                              d_packedCalendar.length());
+        if (d_businessDayIndex[block] !=
+                    static_cast<int>(d_nonBusinessDays.num0(0, offset))) {
+            return false;                                             // RETURN
+        }
     }
 
     PackedCalendar::BusinessDayConstIterator iter =
@@ -123,6 +180,7 @@ bool Calendar::isCacheSynchronized() const
 Calendar::Calendar(bslma::Allocator *basicAllocator)
 : d_packedCalendar(basicAllocator)
 , d_nonBusinessDays(basicAllocator)
+, d_businessDayIndex(basicAllocator)
 {
 }
 
@@ -131,14 +189,17 @@ Calendar::Calendar(const Date&       firstDate,
                    bslma::Allocator *basicAllocator)
 : d_packedCalendar(firstDate, lastDate, basicAllocator)
 , d_nonBusinessDays(basicAllocator)
+, d_businessDayIndex(basicAllocator)
 {
     d_nonBusinessDays.setLength(d_packedCalendar.length(), 0);
+    synchronizeBusinessDayIndex();
 }
 
 Calendar::Calendar(const PackedCalendar&  packedCalendar,
                    bslma::Allocator      *basicAllocator)
 : d_packedCalendar(packedCalendar, basicAllocator)
 , d_nonBusinessDays(basicAllocator)
+, d_businessDayIndex(basicAllocator)
 {
     synchronizeCache();
 }
@@ -146,6 +207,7 @@ Calendar::Calendar(const PackedCalendar&  packedCalendar,
 Calendar::Calendar(const Calendar& original, bslma::Allocator *basicAllocator)
 : d_packedCalendar(original.d_packedCalendar, basicAllocator)
 , d_nonBusinessDays(original.d_nonBusinessDays, basicAllocator)
+, d_businessDayIndex(original.d_businessDayIndex, basicAllocator)
 {
 }
 
@@ -171,21 +233,19 @@ void Calendar::addDay(const Date& date)
 void Calendar::addHoliday(const Date& date)
 {
     if (0 == length()) {
-        d_nonBusinessDays.reserveCapacity(1);
+        reserveCacheCapacity(1);
         reserveHolidayCapacity(1);
         d_packedCalendar.addHoliday(date);
         synchronizeCache();
     }
     else if (date < d_packedCalendar.firstDate()) {
-        d_nonBusinessDays.reserveCapacity(
-                                       d_packedCalendar.lastDate() - date + 1);
+        reserveCacheCapacity(d_packedCalendar.lastDate() - date + 1);
         reserveHolidayCapacity(numHolidays() + 1);
         d_packedCalendar.addHoliday(date);
         synchronizeCache();
     }
     else if (date > d_packedCalendar.lastDate()) {
-        d_nonBusinessDays.reserveCapacity(
-                                      date - d_packedCalendar.firstDate() + 1);
+        reserveCacheCapacity(date - d_packedCalendar.firstDate() + 1);
         reserveHolidayCapacity(numHolidays() + 1);
         d_packedCalendar.addHoliday(date);
         synchronizeCache();
@@ -193,30 +253,33 @@ void Calendar::addHoliday(const Date& date)
     else {
         reserveHolidayCapacity(numHolidays() + 1);
         d_packedCalendar.addHoliday(date);
-        d_nonBusinessDays.assign1(date - d_packedCalendar.firstDate());
+
+        const int offset = date - d_packedCalendar.firstDate();
+        if (!d_nonBusinessDays[offset]) {
+            d_nonBusinessDays.assign1(offset);
+            adjustBusinessDayIndex(offset, -1);
+        }
     }
 }
 
 void Calendar::addHolidayCode(const Date& date, int holidayCode)
 {
     if (0 == length()) {
-        d_nonBusinessDays.reserveCapacity(1);
+        reserveCacheCapacity(1);
         reserveHolidayCapacity(1);
         reserveHolidayCodeCapacity(1);
         d_packedCalendar.addHolidayCode(date, holidayCode);
         synchronizeCache();
     }
     else if (date < d_packedCalendar.firstDate()) {
-        d_nonBusinessDays.reserveCapacity(
-                                       d_packedCalendar.lastDate() - date + 1);
+        reserveCacheCapacity(d_packedCalendar.lastDate() - date + 1);
         reserveHolidayCapacity(numHolidays() + 1);
         reserveHolidayCodeCapacity(numHolidayCodesTotal() + 1);
         d_packedCalendar.addHolidayCode(date, holidayCode);
         synchronizeCache();
     }
     else if (date > d_packedCalendar.lastDate()) {
-        d_nonBusinessDays.reserveCapacity(
-                                      date - d_packedCalendar.firstDate() + 1);
+        reserveCacheCapacity(date - d_packedCalendar.firstDate() + 1);
         reserveHolidayCapacity(numHolidays() + 1);
         reserveHolidayCodeCapacity(numHolidayCodesTotal() + 1);
         d_packedCalendar.addHolidayCode(date, holidayCode);
@@ -226,7 +289,12 @@ void Calendar::addHolidayCode(const Date& date, int holidayCode)
         reserveHolidayCapacity(numHolidays() + 1);
         reserveHolidayCodeCapacity(numHolidayCodesTotal() + 1);
         d_packedCalendar.addHolidayCode(date, holidayCode);
-        d_nonBusinessDays.assign1(date - d_packedCalendar.firstDate());
+
+        const int offset = date - d_packedCalendar.firstDate();
+        if (!d_nonBusinessDays[offset]) {
+            d_nonBusinessDays.assign1(offset);
+            adjustBusinessDayIndex(offset, -1);
+        }
     }
 }
 
@@ -244,6 +312,7 @@ void Calendar::addWeekendDay(DayOfWeek::Enum weekendDay)
             d_nonBusinessDays.assign1(weekendDayIndex);
             weekendDayIndex += 7;
         }
+        synchronizeBusinessDayIndex();
     }
 }
 
@@ -277,7 +346,7 @@ void Calendar::unionBusinessDays(const PackedCalendar& other)
         newLength = length() + other.length();
     }
 
-    d_nonBusinessDays.reserveCapacity(newLength);
+    reserveCacheCapacity(newLength);
     d_packedCalendar.unionBusinessDays(other);
     synchronizeCache();
 }
@@ -298,12 +367,47 @@ void Calendar::unionNonBusinessDays(const PackedCalendar& other)
         newLength = length() + other.length();
     }
 
-    d_nonBusinessDays.reserveCapacity(newLength);
+    reserveCacheCapacity(newLength);
     d_packedCalendar.unionNonBusinessDays(other);
     synchronizeCache();
 }
 
 // ACCESSORS
+Date Calendar::businessDay(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < numBusinessDays());
+
+    // Locate the block containing the business day, then select the
+    // appropriate unset bit within that block.  The block is the last one
+    // preceded by at most 'index' business days; blocks having no business
+    // days share their count with the following block, and so are skipped.
+
+    const int block = static_cast<int>(
+                            bsl::upper_bound(d_businessDayIndex.begin(),
+                                             d_businessDayIndex.end(),
+                                             index)
+                          - d_businessDayIndex.begin()) - 1;
+
+    BSLS_ASSERT_SAFE(d_businessDayIndex[block]     <= index);
+    BSLS_ASSERT_SAFE(d_businessDayIndex[block + 1] >  index);
+
+    const int offset  = block * bdlc::BitArray::k_BITS_PER_UINT64;
+    const int numBits = bsl::min(
+                          static_cast<int>(bdlc::BitArray::k_BITS_PER_UINT64),
+                          length() - offset);
+
+    // Note that the bits of 'word' beyond 'numBits' are set, but are never
+    // selected, since 'index < numBusinessDays()'.
+
+    bsl::uint64_t word = ~d_nonBusinessDays.bits(offset, numBits);
+    for (int i = d_businessDayIndex[block]; i < index; ++i) {
+        word &= word - 1;  // clear the lowest set bit
+    }
+
+    return firstDate() + offset + bdlb::BitUtil::numTrailingUnsetBits(word);
+}
+
 int Calendar::getNextBusinessDay(Date        *nextBusinessDay,
                                  const Date&  date,
                                  int          nth) const
@@ -315,16 +419,14 @@ int Calendar::getNextBusinessDay(Date        *nextBusinessDay,
 
     enum { e_SUCCESS = 0, e_FAILURE = 1 };
 
-    int offset = date - firstDate();
-    while (nth) {
-        offset = static_cast<int>(
-                                d_nonBusinessDays.find0AtMinIndex(offset + 1));
-        if (0 > offset) {
-            return e_FAILURE;                                         // RETURN
-        }
-        --nth;
+    // The 'nth' business day after 'date' is the business day whose index is
+    // 'nth - 1' greater than the number of business days on or before 'date'.
+
+    const int numBefore = businessDayRank(date - firstDate() + 1);
+    if (nth > numBusinessDays() - numBefore) {
+        return e_FAILURE;                                             // RETURN
     }
-    *nextBusinessDay = firstDate() + offset;
+    *nextBusinessDay = businessDay(numBefore + nth - 1);
 
     return e_SUCCESS;
 }
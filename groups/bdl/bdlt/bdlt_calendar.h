@@ -30,7 +30,11 @@ BSLS_IDENT("$Id: $")
 // whether a given 'bdlt::Date' is a business day, as opposed to a weekend or
 // holiday, consists of only a few constant-time operations, compared to a
 // binary search in a 'bdlt::PackedCalendar' representing the same calendar
-// value.
+// value.  Likewise, 'numBusinessDays(beginDate, endDate)' runs in constant
+// time, and 'businessDay' and 'getNextBusinessDay' (locating the 'n'th
+// business day) run in time logarithmic in the length of the valid range, and
+// independent of the number of days skipped, by binary searching a cached
+// count of the business days preceding each 64-day block of the valid range.
 //
 // Default-constructed calendars are empty, and have an empty valid range.
 // Calendars can also be constructed with an initial (non-empty) valid range,
@@ -465,6 +469,8 @@ BSLS_IDENT("$Id: $")
 #include <bdlt_dayofweekset.h>
 #include <bdlt_packedcalendar.h>
 
+#include <bdlb_bitutil.h>
+
 #include <bdlc_bitarray.h>
 
 #include <bslalg_swaputil.h>
@@ -481,6 +487,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bsl_iosfwd.h>
 #include <bsl_iterator.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace bdlt {
@@ -519,6 +526,13 @@ class Calendar {
                                // of the valid range is defined by
                                // 'd_packedCalendar.firstDate() + length() - 1'
 
+    bsl::vector<int>  d_businessDayIndex;
+                               // cache of business-day counts, where element
+                               // 'i' is the number of business days in the
+                               // first '64 * i' days of the valid range, and
+                               // the last element is 'numBusinessDays()';
+                               // empty if 'd_nonBusinessDays' is empty
+
     // FRIENDS
     friend bool operator==(const Calendar&, const Calendar&);
     friend bool operator!=(const Calendar&, const Calendar&);
@@ -527,6 +541,22 @@ class Calendar {
 
   private:
     // PRIVATE MANIPULATORS
+    void adjustBusinessDayIndex(int offset, int delta);
+        // Add the specified 'delta' to the number of business days recorded
+        // in this calendar's business-day index for every block that follows
+        // the specified 'offset' (from 'firstDate()').  The behavior is
+        // undefined unless '0 <= offset < length()'.
+
+    void reserveCacheCapacity(int numDays);
+        // Reserve sufficient memory for this calendar's caches to represent a
+        // valid range of the specified 'numDays' without further allocation.
+
+    void synchronizeBusinessDayIndex();
+        // Recompute this calendar's business-day index from the current
+        // contents of 'd_nonBusinessDays'.  Note that this method is only
+        // *exception*-*neutral*; exception safety and rollback must be
+        // handled by the caller.
+
     void synchronizeCache();
         // Synchronize this calendar's cache by first clearing the cache, then
         // repopulating it with the holiday and weekend information from this
@@ -535,6 +565,11 @@ class Calendar {
         // handled by the caller.
 
     // PRIVATE ACCESSORS
+    int businessDayRank(int offset) const;
+        // Return the number of business days among the first specified
+        // 'offset' days of the valid range of this calendar.  The behavior is
+        // undefined unless '0 <= offset <= length()'.
+
     bool isCacheSynchronized() const;
         // Return 'true' if this calendar's cache correctly represents the
         // holiday and weekend information stored in this calendar's
@@ -870,6 +905,18 @@ class Calendar {
         // calendar has no weekend-days transitions, the returned iterator has
         // the same value as that returned by 'endWeekendDaysTransitions()'.
 
+    Date businessDay(int index) const;
+        // Return the business day at the specified 'index' in this calendar.
+        // For all 'index' values from 0 to 'numBusinessDays() - 1'
+        // (inclusive), a unique business day is returned, in chronological
+        // order.  The mapping of 'index' to business day is invalidated when
+        // the valid range, weekend days, or holidays of this calendar are
+        // modified.  The behavior is undefined unless
+        // '0 <= index < numBusinessDays()'.  Note that this method locates
+        // the business day by binary searching a cached count of business
+        // days per 64-day block, rather than by iteration, and so runs in time
+        // logarithmic in 'length()'.
+
     BusinessDayConstIterator endBusinessDays() const;
         // Return an iterator providing non-modifiable access to the
         // past-the-end business day in this calendar.
@@ -1026,7 +1073,8 @@ class Calendar {
         // '[beginDate .. endDate]' of this calendar that are considered
         // business days -- i.e., are neither holidays nor weekend days.  The
         // behavior is undefined unless 'beginDate' and 'endDate' are within
-        // the valid range of this calendar, and 'beginDate <= endDate'.
+        // the valid range of this calendar, and 'beginDate <= endDate'.  Note
+        // that this method runs in constant time.
 
     int numHolidayCodes(const Date& date) const;
         // Return the number of (unique) holiday codes associated with the
@@ -1405,6 +1453,21 @@ int Calendar::maxSupportedBdexVersion(int versionSelector)
     return PackedCalendar::maxSupportedBdexVersion(versionSelector);
 }
 
+// PRIVATE MANIPULATORS
+inline
+void Calendar::adjustBusinessDayIndex(int offset, int delta)
+{
+    BSLS_ASSERT_SAFE(0 <= offset);
+    BSLS_ASSERT_SAFE(offset < length());
+
+    const bsl::size_t numEntries = d_businessDayIndex.size();
+    for (bsl::size_t i = offset / bdlc::BitArray::k_BITS_PER_UINT64 + 1;
+         i < numEntries;
+         ++i) {
+        d_businessDayIndex[i] += delta;
+    }
+}
+
 // MANIPULATORS
 inline
 Calendar& Calendar::operator=(const Calendar& rhs)
@@ -1479,6 +1542,7 @@ void Calendar::removeAll()
 {
     d_packedCalendar.removeAll();
     d_nonBusinessDays.removeAll();
+    d_businessDayIndex.clear();
 }
 
 inline
@@ -1487,7 +1551,11 @@ void Calendar::removeHoliday(const Date& date)
     d_packedCalendar.removeHoliday(date);
 
     if (true == isInRange(date) && false == isWeekendDay(date)) {
-        d_nonBusinessDays.assign0(date - firstDate());
+        const int offset = date - firstDate();
+        if (d_nonBusinessDays[offset]) {
+            d_nonBusinessDays.assign0(offset);
+            adjustBusinessDayIndex(offset, 1);
+        }
     }
 }
 
@@ -1518,7 +1586,7 @@ void Calendar::setValidRange(const Date& firstDate, const Date& lastDate)
         // For backwards compatibility, 'firstDate > lastDate' results in an
         // empty calendar (when asserts are not enabled).
 
-        d_nonBusinessDays.reserveCapacity(lastDate - firstDate + 1);
+        reserveCacheCapacity(lastDate - firstDate + 1);
     }
 
     d_packedCalendar.setValidRange(firstDate, lastDate);
@@ -1549,7 +1617,7 @@ STREAM& Calendar::bdexStreamIn(STREAM& stream, int version)
         if (!stream) {
             return stream;                                            // RETURN
         }
-        d_nonBusinessDays.reserveCapacity(inCal.length());
+        reserveCacheCapacity(inCal.length());
         d_packedCalendar.swap(inCal);
         synchronizeCache();
     }
@@ -1566,6 +1634,26 @@ void Calendar::swap(Calendar& other)
 
     bslalg::SwapUtil::swap(&d_packedCalendar,  &other.d_packedCalendar);
     bslalg::SwapUtil::swap(&d_nonBusinessDays, &other.d_nonBusinessDays);
+    bslalg::SwapUtil::swap(&d_businessDayIndex,
+                           &other.d_businessDayIndex);
+}
+
+// PRIVATE ACCESSORS
+inline
+int Calendar::businessDayRank(int offset) const
+{
+    BSLS_ASSERT_SAFE(0 <= offset);
+    BSLS_ASSERT_SAFE(offset <= length());
+
+    const int block = offset / bdlc::BitArray::k_BITS_PER_UINT64;
+    const int bit   = offset % bdlc::BitArray::k_BITS_PER_UINT64;
+
+    if (0 == bit) {
+        return 0 == offset ? 0 : d_businessDayIndex[block];           // RETURN
+    }
+
+    return d_businessDayIndex[block] + bit - bdlb::BitUtil::numBitsSet(
+                                   d_nonBusinessDays.bits(offset - bit, bit));
 }
 
 // ACCESSORS
@@ -1778,7 +1866,7 @@ int Calendar::length() const
 inline
 int Calendar::numBusinessDays() const
 {
-    return static_cast<int>(d_nonBusinessDays.num0());
+    return d_businessDayIndex.empty() ? 0 : d_businessDayIndex.back();
 }
 
 inline
@@ -1788,8 +1876,8 @@ int Calendar::numBusinessDays(const Date& beginDate, const Date& endDate) const
     BSLS_ASSERT_SAFE(isInRange(endDate));
     BSLS_ASSERT_SAFE(beginDate <= endDate);
 
-    return static_cast<int>(d_nonBusinessDays.num0(beginDate - firstDate(),
-                                                   endDate - firstDate() + 1));
+    return businessDayRank(endDate - firstDate() + 1)
+         - businessDayRank(beginDate - firstDate());
 }
 
 inline
@@ -15,6 +15,8 @@
 
 #include <bsls_asserttest.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
 
 #include <bslx_byteinstream.h>
 #include <bslx_byteoutstream.h>
@@ -109,6 +111,7 @@ using namespace bsl;
 // ACCESSORS
 // [23] BusinessDayConstIterator beginBusinessDays() const;
 // [23] BusinessDayConstIterator beginBusinessDays(const Date&) const;
+// [31] bdlt::Date businessDay(int index) const;
 // [21] HolidayCodeConstIterator beginHolidayCodes(const Date&) const;
 // [21] HolidayCodeConstIterator beginHolidayCodes(const HCI&) const;
 // [19] HolidayConstIterator beginHolidays() const;
@@ -181,7 +184,9 @@ using namespace bsl;
 // [ 8] void swap(Calendar& a, Calendar& b);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [31] USAGE EXAMPLE
+// [31] BUSINESS-DAY INDEX
+// [32] USAGE EXAMPLE
+// [-1] PERFORMANCE: BUSINESS-DAY COUNTING AND SELECTION
 // [ 3] CALENDAR& gg(CALENDAR *o, const char *s);
 // [ 3] int ggg(CALENDAR *obj, const char *spec, bool vF);
 // ============================================================================
@@ -334,6 +339,80 @@ bool sameWeekendDaysTransition(const Obj::WeekendDaysTransition&  transition,
     return Obj::WeekendDaysTransition(date, wdSet) == transition;
 }
 
+void verifyBusinessDayIndex(const Obj& X, int line)
+    // Verify, using 'isBusinessDay' and the business-day iterators, that
+    // 'numBusinessDays', 'businessDay', and 'getNextBusinessDay' of the
+    // specified calendar 'X' are consistent with its business days, and report
+    // failures using the specified 'line'.
+{
+    const int LENGTH = X.length();
+
+    int count = 0;
+    for (int i = 0; i < LENGTH; ++i) {
+        count += X.isBusinessDay(X.firstDate() + i);
+    }
+    ASSERTV(line, count, X.numBusinessDays(), count == X.numBusinessDays());
+
+    int index = 0;
+    for (Obj::BusinessDayConstIterator it = X.beginBusinessDays();
+         it != X.endBusinessDays();
+         ++it, ++index) {
+        ASSERTV(line, index, *it, X.businessDay(index),
+                *it == X.businessDay(index));
+    }
+    ASSERTV(line, index, count, index == count);
+
+    if (0 == LENGTH) {
+        return;                                                       // RETURN
+    }
+
+    // Check every prefix and suffix range, and a sample of interior ranges.
+
+    int prefix = 0;
+    for (int i = 0; i < LENGTH; ++i) {
+        const bdlt::Date date = X.firstDate() + i;
+
+        prefix += X.isBusinessDay(date);
+        ASSERTV(line, i, prefix == X.numBusinessDays(X.firstDate(), date));
+        ASSERTV(line, i, count - prefix + X.isBusinessDay(date)
+                              == X.numBusinessDays(date, X.lastDate()));
+    }
+
+    for (int i = 0; i < LENGTH; i += 7) {
+        for (int j = i; j < LENGTH; j += 13) {
+            int expected = 0;
+            for (int k = i; k <= j; ++k) {
+                expected += X.isBusinessDay(X.firstDate() + k);
+            }
+            ASSERTV(line, i, j, expected == X.numBusinessDays(
+                                                         X.firstDate() + i,
+                                                         X.firstDate() + j));
+        }
+    }
+
+    // Check 'getNextBusinessDay' against a linear search.
+
+    for (int i = 0; i < LENGTH - 1; i += 3) {
+        const bdlt::Date date = X.firstDate() + i;
+        for (int nth = 1; nth <= 70; nth += 23) {
+            bdlt::Date expected;
+            int        remaining = nth;
+            for (int k = i + 1; k < LENGTH && remaining; ++k) {
+                if (X.isBusinessDay(X.firstDate() + k) && 0 == --remaining) {
+                    expected = X.firstDate() + k;
+                }
+            }
+
+            bdlt::Date result;
+            const int  rc = X.getNextBusinessDay(&result, date, nth);
+            ASSERTV(line, i, nth, (0 == remaining) == (0 == rc));
+            if (0 == rc) {
+                ASSERTV(line, i, nth, expected, result, expected == result);
+            }
+        }
+    }
+}
+
 }  // close unnamed namespace
 
 int VA = 0, VB = 1, VC = 2, VD = 100, VE = 1000; // Holiday codes.
@@ -1167,7 +1246,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 31: {
+      case 32: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1236,6 +1315,255 @@ int main(int argc, char *argv[])
                          MyCalendarUtil::modifiedFollowing(31, 7, 2015, cal2));
 //..
       } break;
+      case 31: {
+        // --------------------------------------------------------------------
+        // BUSINESS-DAY INDEX
+        //   Ensure that the cached business-day counts used by
+        //   'numBusinessDays', 'businessDay', and 'getNextBusinessDay' remain
+        //   consistent with the non-business days of a calendar across all
+        //   manipulators.
+        //
+        // Concerns:
+        //: 1 'businessDay(i)' returns the 'i'th business day in chronological
+        //:   order.
+        //:
+        //: 2 'numBusinessDays' (both overloads) and 'getNextBusinessDay'
+        //:   return the values obtained by linear iteration, including for
+        //:   ranges that start or end on a 64-day block boundary and for
+        //:   valid ranges whose length is not a multiple of 64.
+        //:
+        //: 3 The results are correct after every manipulator, whether the
+        //:   manipulator updates the cached counts incrementally (e.g.,
+        //:   adding or removing a holiday within the valid range) or rebuilds
+        //:   them (e.g., changing the valid range or the weekend days).
+        //:
+        //: 4 Copy construction, assignment, and 'swap' carry the cached
+        //:   counts along with the calendar value.
+        //:
+        //: 5 The results are correct for calendars whose business days are
+        //:   concentrated in a small part of a long valid range.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a set of valid-range lengths around multiples of 64, apply a
+        //:   pseudo-random sequence of manipulators to a calendar and, after
+        //:   each one, verify the accessors against 'isBusinessDay' and the
+        //:   business-day iterators.  (C-1..3)
+        //:
+        //: 2 Copy, assign, and swap the resulting calendars and repeat the
+        //:   verification on the results.  (C-4)
+        //:
+        //: 3 Using weekend-days transitions, create calendars spanning two
+        //:   centuries whose only business days fall in a short stretch at the
+        //:   end, at the start, or in the middle of the valid range, and
+        //:   verify the accessors.  (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid 'index' values.  (C-6)
+        //
+        // Testing:
+        //   bdlt::Date businessDay(int index) const;
+        //   BUSINESS-DAY INDEX
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BUSINESS-DAY INDEX" << endl
+                          << "==================" << endl;
+
+        static const int LENGTHS[] = { 1, 2, 7, 63, 64, 65, 127, 128, 129,
+                                       200, 366 };
+        const int NUM_LENGTHS = static_cast<int>(sizeof LENGTHS
+                                                 / sizeof *LENGTHS);
+
+        const bdlt::Date START(2019, 12, 30);
+
+        unsigned int seed = 12345;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+
+            if (veryVerbose) { T_ P(LENGTH) }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(START, START + LENGTH - 1, &oa);  const Obj& X = mX;
+            verifyBusinessDayIndex(X, L_);
+
+            for (int step = 0; step < 60; ++step) {
+                seed = seed * 1103515245 + 12345;
+                const int r      = static_cast<int>((seed >> 8) & 0xffff);
+                const int offset = r % (X.length() + 10) - 5;
+                const bdlt::Date date = X.firstDate() + offset;
+
+                switch (r % 10) {
+                  case 0:
+                  case 1:
+                  case 2: {
+                    mX.addHoliday(date);
+                  } break;
+                  case 3: {
+                    mX.addHolidayCode(date, r % 5);
+                  } break;
+                  case 4:
+                  case 5: {
+                    if (X.length() && X.numHolidays()) {
+                        mX.removeHoliday(X.holiday(r % X.numHolidays()));
+                    }
+                  } break;
+                  case 6: {
+                    // 'addWeekendDay' requires that the only weekend-days
+                    // transition, if any, is at January 1, 0001.
+
+                    if (0 == X.numWeekendDaysTransitions()
+                     || (1 == X.numWeekendDaysTransitions()
+                      && bdlt::Date(1, 1, 1) ==
+                                    X.beginWeekendDaysTransitions()->first)) {
+                        mX.addWeekendDay(static_cast<bdlt::DayOfWeek::Enum>(
+                                                                r % 7 + 1));
+                    }
+                  } break;
+                  case 7: {
+                    bdlt::DayOfWeekSet weekendDays;
+                    weekendDays.add(static_cast<bdlt::DayOfWeek::Enum>(
+                                                          (r >> 3) % 7 + 1));
+                    mX.addWeekendDaysTransition(date, weekendDays);
+                  } break;
+                  case 8: {
+                    mX.setValidRange(START + r % 10,
+                                     START + r % 10 + LENGTH - 1);
+                  } break;
+                  case 9: {
+                    Obj mY(START + 32, START + 32 + LENGTH, &oa);
+                    mY.addWeekendDay(bdlt::DayOfWeek::e_WED);
+                    if (r & 1) {
+                        mX.unionNonBusinessDays(mY);
+                    }
+                    else {
+                        mX.intersectBusinessDays(mY);
+                    }
+                  } break;
+                }
+
+                if (veryVeryVerbose) { T_ T_ P_(step) P(X) }
+
+                verifyBusinessDayIndex(X, L_);
+            }
+
+            Obj mY(X, &oa);  const Obj& Y = mY;
+            verifyBusinessDayIndex(Y, L_);
+
+            Obj mZ(&oa);  const Obj& Z = mZ;
+            mZ = X;
+            verifyBusinessDayIndex(Z, L_);
+
+            Obj mW(START, START + 2 * LENGTH, &oa);  const Obj& W = mW;
+            mW.addWeekendDay(bdlt::DayOfWeek::e_SUN);
+            mW.swap(mZ);
+            verifyBusinessDayIndex(W, L_);
+            verifyBusinessDayIndex(Z, L_);
+
+            mY.removeAll();
+            verifyBusinessDayIndex(Y, L_);
+            ASSERT(0 == Y.numBusinessDays());
+        }
+
+        if (verbose) cout << "\nTesting skewed calendars." << endl;
+        {
+            // Every day is a weekend day, except for the days from 'BEGIN' up
+            // to (but not including) 'END', on which only Saturday and Sunday
+            // are weekend days.
+
+            const bdlt::Date FIRST(1900,  1,  1);
+            const bdlt::Date LAST (2099, 12, 31);
+
+            static const struct {
+                int d_line;
+                int d_beginYear;
+                int d_endYear;   // 0 if the stretch extends to 'LAST'
+            } DATA[] = {
+                //LINE  BEGIN  END
+                //----  -----  ----
+                { L_,   2099,     0 },
+                { L_,   1900,  1901 },
+                { L_,   1999,  2000 },
+                { L_,   1900,     0 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            bdlt::DayOfWeekSet allDays;
+            bdlt::DayOfWeekSet weekend;
+            for (int d = 1; d <= 7; ++d) {
+                allDays.add(static_cast<bdlt::DayOfWeek::Enum>(d));
+            }
+            weekend.add(bdlt::DayOfWeek::e_SAT);
+            weekend.add(bdlt::DayOfWeek::e_SUN);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE = DATA[ti].d_line;
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                Obj mX(FIRST, LAST, &oa);  const Obj& X = mX;
+
+                mX.addWeekendDaysTransition(bdlt::Date(1, 1, 1), allDays);
+                mX.addWeekendDaysTransition(
+                                      bdlt::Date(DATA[ti].d_beginYear, 1, 1),
+                                      weekend);
+                if (DATA[ti].d_endYear) {
+                    mX.addWeekendDaysTransition(
+                                        bdlt::Date(DATA[ti].d_endYear, 1, 1),
+                                        allDays);
+                }
+
+                ASSERTV(LINE, X.numBusinessDays(), 0 < X.numBusinessDays());
+
+                // 'verifyBusinessDayIndex' is too slow for a calendar of this
+                // length, so verify 'businessDay' against the business-day
+                // iterators instead.
+
+                bdlt::Date expected(DATA[ti].d_beginYear, 1, 1);
+                while (weekend.isMember(expected.dayOfWeek())) {
+                    ++expected;
+                }
+                ASSERTV(LINE, X.businessDay(0), expected == X.businessDay(0));
+
+                const bdlt::Date EXP_NEXT = FIRST < expected
+                                          ? expected
+                                          : X.businessDay(1);
+
+                bdlt::Date result;
+                ASSERTV(LINE, 0 == X.getNextBusinessDay(&result, FIRST));
+                ASSERTV(LINE, result, EXP_NEXT == result);
+
+                int index = 0;
+                for (Obj::BusinessDayConstIterator it = X.beginBusinessDays();
+                                                   it != X.endBusinessDays();
+                                                   ++it, ++index) {
+                    ASSERTV(LINE, index, *it == X.businessDay(index));
+                }
+                ASSERTV(LINE, index, X.numBusinessDays(),
+                        index == X.numBusinessDays());
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(bdlt::Date(2020, 1, 1), bdlt::Date(2020, 1, 10));
+            const Obj& X = mX;
+            mX.addHoliday(bdlt::Date(2020, 1, 2));
+
+            ASSERT_FAIL(X.businessDay(-1));
+            ASSERT_PASS(X.businessDay( 0));
+            ASSERT_PASS(X.businessDay( 8));
+            ASSERT_FAIL(X.businessDay( 9));
+
+            const Obj Y;
+            ASSERT_FAIL(Y.businessDay(0));
+        }
+      } break;
       case 30: {
         // --------------------------------------------------------------------
         // TESTING: hashAppend
@@ -9833,6 +10161,77 @@ int main(int argc, char *argv[])
         ASSERT( 0 == cal.numHolidayCodes( bdlt::Date(2000, 1, 3)));
         ASSERT( 0 == cal.numHolidayCodes( bdlt::Date(2000, 1, 4)));
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: BUSINESS-DAY COUNTING AND SELECTION
+        //   Measure the cost of counting business days over long ranges and of
+        //   selecting the 'n'th business day after a date.
+        //
+        // Concerns:
+        //: 1 'numBusinessDays(beginDate, endDate)' and 'getNextBusinessDay'
+        //:   run in time independent of the distance between their dates.
+        //
+        // Plan:
+        //: 1 Over a thirty-year calendar with weekends and holidays, time
+        //:   repeated calls to both accessors with short and long spans, and
+        //:   report the average cost per call.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: BUSINESS-DAY COUNTING AND SELECTION
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: BUSINESS-DAY COUNTING AND SELECTION" << endl
+             << "================================================" << endl;
+
+        const bdlt::Date FIRST(2000, 1, 1);
+        const bdlt::Date LAST(2029, 12, 31);
+
+        Obj mX(FIRST, LAST);  const Obj& X = mX;
+        mX.addWeekendDay(bdlt::DayOfWeek::e_SAT);
+        mX.addWeekendDay(bdlt::DayOfWeek::e_SUN);
+        for (bdlt::Date date = FIRST; date <= LAST; date += 37) {
+            mX.addHoliday(date);
+        }
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 1000000;
+        static const int SPANS[] = { 30, 365, 3650, 10000 };
+
+        for (int si = 0; si < static_cast<int>(sizeof SPANS / sizeof *SPANS);
+             ++si) {
+            const int SPAN = SPANS[si];
+            const int RANGE = X.length() - SPAN - 1;
+
+            bsls::Stopwatch timer;
+            timer.start();
+            bsls::Types::Int64 total = 0;
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                const bdlt::Date begin = FIRST + (i % RANGE) * 7919 % RANGE;
+                total += X.numBusinessDays(begin, begin + SPAN);
+            }
+            timer.stop();
+            const double countTime = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            const int NTH = SPAN * 5 / 7 / 2 + 1;
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                const bdlt::Date begin = FIRST + (i % RANGE) * 7919 % RANGE;
+                bdlt::Date       result;
+                if (0 == X.getNextBusinessDay(&result, begin, NTH)) {
+                    total += result - begin;
+                }
+            }
+            timer.stop();
+            const double nextTime = timer.elapsedTime();
+
+            cout << "span " << SPAN << " days: numBusinessDays "
+                 << countTime * 1.0e9 / NUM_ITERATIONS
+                 << " ns, getNextBusinessDay "
+                 << nextTime * 1.0e9 / NUM_ITERATIONS
+                 << " ns (checksum " << total << ")" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -5,20 +5,224 @@
 BSLS_IDENT_RCSID(bdlt_calendarcache_cpp,"$Id$ $CSID$")
 
 #include <bdlt_calendarloader.h>
-#include <bdlt_currenttime.h>
 #include <bdlt_date.h>            // for testing only
 #include <bdlt_packedcalendar.h>
 
+#include <bdlb_cstringhash.h>
+
 #include <bslma_default.h>
+#include <bslma_rawdeleterproctor.h>
 
 #include <bslmt_lockguard.h>
 
 #include <bsls_assert.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_climits.h>      // 'INT_MAX'
+#include <bsl_cstring.h>
 
 namespace BloombergLP {
 namespace bdlt {
+namespace {
+
+template <class ENTRY>
+struct NameLess {
+    // This 'struct' orders an 'ENTRY', a 'bsl::pair' whose 'first' member is
+    // a 'bsl::string', against a C-style string by name.
+
+    bool operator()(const ENTRY& entry, const char *name) const
+        // Return 'true' if the name of the specified 'entry' is ordered before
+        // the specified 'name', and 'false' otherwise.
+    {
+        return bsl::strcmp(entry.first.c_str(), name) < 0;
+    }
+};
+
+}  // close unnamed namespace
+
+                     // -------------------------------
+                     // struct CalendarCache_Entry::Rep
+                     // -------------------------------
+
+struct CalendarCache_Entry::Rep {
+    // This 'struct' holds a cached calendar along with the flag recording
+    // whether it is still current, so that both are obtained by a single
+    // allocation.
+
+    // DATA
+    Calendar         d_calendar;  // cached calendar
+    bsls::AtomicBool d_retired;   // 'true' once 'd_calendar' is no longer in
+                                  // the cache
+
+    // CREATORS
+    Rep(const PackedCalendar& calendar, bslma::Allocator *basicAllocator)
+        // Create a representation holding a calendar having the value of the
+        // specified 'calendar' that is current, using the specified
+        // 'basicAllocator' to supply memory.
+    : d_calendar(calendar, basicAllocator)
+    , d_retired(false)
+    {
+    }
+};
+
+                       // ---------------------------
+                       // struct CalendarCache::Index
+                       // ---------------------------
+
+struct CalendarCache::Index {
+    // This 'struct' holds a hash table of the calendars in a cache.  The list
+    // of each bucket is immutable once published, so that a lookup can search
+    // it without locking; a modification replaces the list of the bucket it
+    // affects.
+
+    // TYPES
+    struct Node {
+        // This 'struct' holds a calendar name, the cached calendar having
+        // that name, and the next node in the list of a bucket.
+
+        // DATA
+        bsl::string          d_name;    // calendar name
+        CalendarCache_Entry  d_entry;   // cached calendar
+        Node                *d_next_p;  // next node in the list, or 0 if last
+
+        // CREATORS
+        Node(const char                 *name,
+             const CalendarCache_Entry&  entry,
+             Node                       *next,
+             bslma::Allocator           *basicAllocator)
+            // Create a node holding the specified 'name' and 'entry' that
+            // precedes the specified 'next' node, using the specified
+            // 'basicAllocator' to supply memory.
+        : d_name(name, basicAllocator)
+        , d_entry(entry)
+        , d_next_p(next)
+        {
+        }
+    };
+
+    typedef bsls::AtomicPointer<Node> Bucket;
+        // Head of the list of a bucket.
+
+    class ListProctor {
+        // This class destroys a list of nodes on destruction unless it has
+        // been released.
+
+        // DATA
+        Node             *d_list_p;       // list being built (owned)
+        bslma::Allocator *d_allocator_p;  // allocator of the nodes (held)
+
+      public:
+        // CREATORS
+        explicit ListProctor(bslma::Allocator *allocator)
+            // Create a proctor of an empty list of nodes allocated using the
+            // specified 'allocator'.
+        : d_list_p(0)
+        , d_allocator_p(allocator)
+        {
+        }
+
+        ~ListProctor()
+            // Destroy the list managed by this proctor.
+        {
+            Index::deleteList(d_list_p, d_allocator_p);
+        }
+
+        // MANIPULATORS
+        void push(const char *name, const CalendarCache_Entry& entry)
+            // Prepend to the managed list a node holding the specified 'name'
+            // and 'entry'.
+        {
+            d_list_p = new (*d_allocator_p) Node(name,
+                                                 entry,
+                                                 d_list_p,
+                                                 d_allocator_p);
+        }
+
+        Node *release()
+            // Return the managed list, and release it from management.
+        {
+            Node *list = d_list_p;
+            d_list_p   = 0;
+            return list;
+        }
+    };
+
+    // CLASS METHODS
+    static void deleteList(Node *list, bslma::Allocator *allocator)
+        // Destroy the specified 'list' of nodes allocated using the specified
+        // 'allocator'.
+    {
+        while (list) {
+            Node *next = list->d_next_p;
+            allocator->deleteObject(list);
+            list = next;
+        }
+    }
+
+    // DATA
+    Bucket           *d_buckets_p;    // list of each bucket (owned)
+    bsl::size_t       d_numBuckets;   // number of buckets, a power of 2
+    bsl::size_t       d_numEntries;   // number of calendars, used only under
+                                      // the lock of the cache
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    Index(const Index&);
+    Index& operator=(const Index&);
+
+  public:
+    // CREATORS
+    Index(bsl::size_t numBuckets, bslma::Allocator *basicAllocator)
+        // Create an empty index having the specified 'numBuckets' buckets,
+        // using the specified 'basicAllocator' to supply memory.  The
+        // behavior is undefined unless 'numBuckets' is a power of 2.
+    : d_buckets_p(static_cast<Bucket *>(
+                       basicAllocator->allocate(numBuckets * sizeof(Bucket))))
+    , d_numBuckets(numBuckets)
+    , d_numEntries(0)
+    , d_allocator_p(basicAllocator)
+    {
+        BSLS_ASSERT(0 == (numBuckets & (numBuckets - 1)));
+
+        for (bsl::size_t i = 0; i < numBuckets; ++i) {
+            new (d_buckets_p + i) Bucket(0);
+        }
+    }
+
+    ~Index()
+        // Destroy this index and the nodes it holds.
+    {
+        for (bsl::size_t i = 0; i < d_numBuckets; ++i) {
+            deleteList(d_buckets_p[i].loadRelaxed(), d_allocator_p);
+        }
+        d_allocator_p->deallocate(d_buckets_p);
+    }
+
+    // ACCESSORS
+    Bucket& bucket(const char *calendarName) const
+        // Return a reference providing modifiable access to the head of the
+        // list of the bucket for the specified 'calendarName'.
+    {
+        return d_buckets_p[bdlb::CStringHash()(calendarName)
+                                                        & (d_numBuckets - 1)];
+    }
+
+    CalendarCache_Entry *find(const char *calendarName) const
+        // Return the address of the entry in the most recently published
+        // list of the bucket for the specified 'calendarName' for the calendar
+        // having that name, or 0 if there is none.
+    {
+        for (Node *node = bucket(calendarName).loadAcquire();
+             node;
+             node = node->d_next_p) {
+            if (0 == bsl::strcmp(node->d_name.c_str(), calendarName)) {
+                return &node->d_entry;                                // RETURN
+            }
+        }
+        return 0;
+    }
+};
 
                         // -------------------------
                         // class CalendarCache_Entry
@@ -28,22 +232,34 @@ namespace bdlt {
 CalendarCache_Entry::CalendarCache_Entry()
 : d_ptr()
 , d_loadTime()
+, d_retired_p(0)
 {
 }
 
-CalendarCache_Entry::CalendarCache_Entry(Calendar         *calendar,
-                                         const Datetime&   loadTime,
-                                         bslma::Allocator *allocator)
-: d_ptr(calendar, allocator)
+CalendarCache_Entry::CalendarCache_Entry(const PackedCalendar&  calendar,
+                                         const Datetime&        loadTime,
+                                         bslma::Allocator      *allocator)
+: d_ptr()
 , d_loadTime(loadTime)
+, d_retired_p(0)
 {
-    BSLS_ASSERT(calendar);
     BSLS_ASSERT(allocator);
+
+    Rep *rep = new (*allocator) Rep(calendar, allocator);
+
+    bsl::shared_ptr<Rep> repPtr(rep, allocator);
+
+    // The shared pointer to the calendar shares ownership of the entire
+    // representation.
+
+    d_ptr.reset(repPtr, &rep->d_calendar);
+    d_retired_p = &rep->d_retired;
 }
 
 CalendarCache_Entry::CalendarCache_Entry(const CalendarCache_Entry& original)
 : d_ptr(original.d_ptr)
 , d_loadTime(original.d_loadTime)
+, d_retired_p(original.d_retired_p)
 {
 }
 
@@ -55,18 +271,31 @@ CalendarCache_Entry::~CalendarCache_Entry()
 CalendarCache_Entry& CalendarCache_Entry::operator=(
                                                 const CalendarCache_Entry& rhs)
 {
-    d_ptr      = rhs.d_ptr;
-    d_loadTime = rhs.d_loadTime;
+    d_ptr       = rhs.d_ptr;
+    d_loadTime  = rhs.d_loadTime;
+    d_retired_p = rhs.d_retired_p;
 
     return *this;
 }
 
+void CalendarCache_Entry::retire()
+{
+    BSLS_ASSERT(d_retired_p);
+
+    d_retired_p->storeRelease(true);
+}
+
 // ACCESSORS
-bsl::shared_ptr<const Calendar> CalendarCache_Entry::get() const
+const bsl::shared_ptr<const Calendar>& CalendarCache_Entry::get() const
 {
     return d_ptr;
 }
 
+bool CalendarCache_Entry::isCurrent() const
+{
+    return d_retired_p && !d_retired_p->loadAcquire();
+}
+
 Datetime CalendarCache_Entry::loadTime() const
 {
     return d_loadTime;
@@ -79,7 +308,8 @@ Datetime CalendarCache_Entry::loadTime() const
 // CREATORS
 CalendarCache::CalendarCache(CalendarLoader   *loader,
                              bslma::Allocator *basicAllocator)
-: d_cache(basicAllocator)
+: d_index_p(0)
+, d_gracePeriod()
 , d_loader_p(loader)
 , d_timeOut(0)
 , d_hasTimeOutFlag(false)
@@ -92,7 +322,8 @@ CalendarCache::CalendarCache(CalendarLoader   *loader,
 CalendarCache::CalendarCache(CalendarLoader            *loader,
                              const bsls::TimeInterval&  timeout,
                              bslma::Allocator          *basicAllocator)
-: d_cache(basicAllocator)
+: d_index_p(0)
+, d_gracePeriod()
 , d_loader_p(loader)
 , d_timeOut(0, 0, 0, 0, timeout.totalMilliseconds())
 , d_hasTimeOutFlag(true)
@@ -106,28 +337,62 @@ CalendarCache::CalendarCache(CalendarLoader            *loader,
 
 CalendarCache::~CalendarCache()
 {
+    d_allocator_p->deleteObject(d_index_p.loadRelaxed());
 }
 
-// MANIPULATORS
-bsl::shared_ptr<const Calendar>
-CalendarCache::getCalendar(const char *calendarName)
+// PRIVATE MANIPULATORS
+void CalendarCache::grow() const
 {
-    BSLS_ASSERT(calendarName);
+    enum { k_INITIAL_NUM_BUCKETS = 8 };
 
-    {
-        bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
+    const Index *current = d_index_p.loadRelaxed();
 
-        CacheIterator iter = d_cache.find(calendarName);
+    Index *index = new (*d_allocator_p) Index(
+                                       current
+                                       ? 2 * current->d_numBuckets
+                                       : bsl::size_t(k_INITIAL_NUM_BUCKETS),
+                                       d_allocator_p);
 
-        if (iter != d_cache.end()) {
-            if (   !d_hasTimeOutFlag
-                || d_timeOut > CurrentTime::utc() - iter->second.loadTime()) {
-                return iter->second.get();                            // RETURN
-            }
-            else {
-                d_cache.erase(iter);
+    bslma::RawDeleterProctor<Index, bslma::Allocator> proctor(index,
+                                                              d_allocator_p);
+
+    if (current) {
+        for (bsl::size_t i = 0; i < current->d_numBuckets; ++i) {
+            const Index::Node *node = current->d_buckets_p[i].loadRelaxed();
+
+            for (; node; node = node->d_next_p) {
+                Index::Bucket& head = index->bucket(node->d_name.c_str());
+
+                head.storeRelaxed(new (*d_allocator_p) Index::Node(
+                                                          node->d_name.c_str(),
+                                                          node->d_entry,
+                                                          head.loadRelaxed(),
+                                                          d_allocator_p));
             }
         }
+        index->d_numEntries = current->d_numEntries;
+    }
+
+    proctor.release();
+
+    publish(index);
+}
+
+void CalendarCache::loadCalendar(CalendarCache_Entry *entry,
+                                 const char          *calendarName)
+{
+    BSLS_ASSERT(entry);
+    BSLS_ASSERT(calendarName);
+
+    *entry = CalendarCache_Entry();
+
+    if (lookupEntry(entry, calendarName)) {
+        if (!isExpired(entry->loadTime())) {
+            return;                                                   // RETURN
+        }
+
+        *entry = CalendarCache_Entry();
+        removeExpired(calendarName);
     }
 
     // Load calendar identified by 'calendarName'.
@@ -137,33 +402,155 @@ CalendarCache::getCalendar(const char *calendarName)
     const Datetime timestamp = CurrentTime::utc();
 
     if (d_loader_p->load(&packedCalendar, calendarName)) {
-        return bsl::shared_ptr<const Calendar>();                     // RETURN
+        return;                                                       // RETURN
     }
 
     // Create out-of-place calendar that will be managed by 'bsl::shared_ptr'.
 
-    Calendar *calendarPtr = new (*d_allocator_p) Calendar(packedCalendar,
-                                                          d_allocator_p);
-
-    CalendarCache_Entry entry(calendarPtr, timestamp, d_allocator_p);
+    CalendarCache_Entry loaded(packedCalendar, timestamp, d_allocator_p);
 
     // Insert newly-loaded calendar into cache if another thread hasn't done so
     // already.
 
     bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
 
-    ConstCacheIterator iter = d_cache.find(calendarName);
+    const Index               *index   = d_index_p.loadRelaxed();
+    const CalendarCache_Entry *current = index ? index->find(calendarName) : 0;
 
     // Here, we assume that the time elapsed between the last check and the
     // loading of the calendar is insignificant compared to the timeout, so we
     // will simply return the entry in the cache if it has been inserted by
     // another thread.
 
-    if (iter != d_cache.end()) {
-        return iter->second.get();                                    // RETURN
+    if (current) {
+        *entry = *current;
+
+        return;                                                       // RETURN
+    }
+
+    update(calendarName, &loaded);
+
+    *entry = loaded;
+}
+
+// PRIVATE ACCESSORS
+bool CalendarCache::lookupEntry(CalendarCache_Entry *entry,
+                                const char          *calendarName) const
+{
+    BSLS_ASSERT(entry);
+    BSLS_ASSERT(calendarName);
+
+    // The index, and the list of a bucket, are loaded after entering the
+    // grace period, so that a modification that replaces either, and then
+    // synchronizes with the grace period, can safely destroy it.
+
+    bslmt::GracePeriodReadGuard guard(&d_gracePeriod);
+
+    const Index               *index = d_index_p.load();
+    const CalendarCache_Entry *found = index ? index->find(calendarName) : 0;
+
+    if (found) {
+        *entry = *found;
+    }
+
+    return 0 != found;
+}
+
+void CalendarCache::publish(Index *index) const
+{
+    const Index *previous = d_index_p.swap(index);
+
+    // Every lookup that starts from now on observes 'index' (or a later one),
+    // so 'previous' is no longer in use once the lookups now in progress have
+    // completed.
+
+    if (previous) {
+        d_gracePeriod.synchronize();
+
+        d_allocator_p->deleteObject(previous);
+    }
+}
+
+void CalendarCache::removeExpired(const char *calendarName) const
+{
+    bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
+
+    const Index               *index = d_index_p.loadRelaxed();
+    const CalendarCache_Entry *entry = index ? index->find(calendarName) : 0;
+
+    if (entry && isExpired(entry->loadTime())) {
+        update(calendarName, 0);
     }
+}
+
+void CalendarCache::update(const char                *calendarName,
+                           const CalendarCache_Entry *entry) const
+{
+    BSLS_ASSERT(calendarName);
 
-    d_cache[calendarName] = entry;
+    Index *index = d_index_p.loadRelaxed();
+
+    if (entry && (!index || index->d_numBuckets <= index->d_numEntries)) {
+        grow();
+
+        index = d_index_p.loadRelaxed();
+    }
+
+    if (!index) {
+        return;                                                       // RETURN
+    }
+
+    // Copy the list of the bucket for 'calendarName', omitting the node (if
+    // any) for that name, and prepend a node for 'entry'.
+
+    Index::Bucket&  head     = index->bucket(calendarName);
+    Index::Node    *previous = head.loadRelaxed();
+    Index::Node    *replaced = 0;
+
+    Index::ListProctor proctor(d_allocator_p);
+
+    for (Index::Node *node = previous; node; node = node->d_next_p) {
+        if (0 == bsl::strcmp(node->d_name.c_str(), calendarName)) {
+            replaced = node;
+        }
+        else {
+            proctor.push(node->d_name.c_str(), node->d_entry);
+        }
+    }
+
+    if (entry) {
+        proctor.push(calendarName, *entry);
+        ++index->d_numEntries;
+    }
+
+    // The replaced entry is retired before the list is published, so that it
+    // is no longer current by the time any lookup can observe 'entry'.
+
+    if (replaced) {
+        replaced->d_entry.retire();
+        --index->d_numEntries;
+    }
+
+    head.storeRelease(proctor.release());
+
+    // Every lookup that starts from now on observes the new list, so
+    // 'previous' is no longer in use once the lookups now in progress have
+    // completed.
+
+    d_gracePeriod.synchronize();
+
+    Index::deleteList(previous, d_allocator_p);
+}
+
+// MANIPULATORS
+bsl::shared_ptr<const Calendar>
+CalendarCache::getCalendar(const char *calendarName)
+{
+    BSLS_ASSERT(calendarName);
+
+    CalendarCache_Entry entry;
+
+    loadCalendar(&entry, calendarName);
 
     return entry.get();
 }
@@ -174,10 +561,10 @@ int CalendarCache::invalidate(const char *calendarName)
 
     bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
 
-    CacheIterator iter = d_cache.find(calendarName);
+    const Index *index = d_index_p.loadRelaxed();
 
-    if (iter != d_cache.end()) {
-        d_cache.erase(iter);
+    if (index && index->find(calendarName)) {
+        update(calendarName, 0);
 
         return 1;                                                     // RETURN
     }
@@ -189,9 +576,26 @@ int CalendarCache::invalidateAll()
 {
     bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
 
-    const int numInvalidated = static_cast<int>(d_cache.size());
+    const Index *current = d_index_p.loadRelaxed();
+
+    if (!current || 0 == current->d_numEntries) {
+        return 0;                                                     // RETURN
+    }
 
-    d_cache.clear();
+    const int numInvalidated = static_cast<int>(current->d_numEntries);
+
+    Index *index = new (*d_allocator_p) Index(current->d_numBuckets,
+                                              d_allocator_p);
+
+    for (bsl::size_t i = 0; i < current->d_numBuckets; ++i) {
+        for (Index::Node *node = current->d_buckets_p[i].loadRelaxed();
+             node;
+             node = node->d_next_p) {
+            node->d_entry.retire();
+        }
+    }
+
+    publish(index);
 
     return numInvalidated;
 }
@@ -202,42 +606,95 @@ CalendarCache::lookupCalendar(const char *calendarName) const
 {
     BSLS_ASSERT(calendarName);
 
-    bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
+    CalendarCache_Entry entry;
 
-    CacheIterator iter = d_cache.find(calendarName);
+    if (lookupEntry(&entry, calendarName) && isExpired(entry.loadTime())) {
+        removeExpired(calendarName);
 
-    if (iter != d_cache.end()) {
-        if (   !d_hasTimeOutFlag
-            || d_timeOut > CurrentTime::utc() - iter->second.loadTime()) {
-            return iter->second.get();                                // RETURN
-        }
-        else {
-            d_cache.erase(iter);
-        }
+        return bsl::shared_ptr<const Calendar>();                     // RETURN
     }
 
-    return bsl::shared_ptr<const Calendar>();
+    return entry.get();
 }
 
 Datetime CalendarCache::lookupLoadTime(const char *calendarName) const
 {
     BSLS_ASSERT(calendarName);
 
-    bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
+    CalendarCache_Entry entry;
+
+    if (lookupEntry(&entry, calendarName) && isExpired(entry.loadTime())) {
+        removeExpired(calendarName);
+
+        return Datetime();                                            // RETURN
+    }
+
+    return entry.loadTime();
+}
+
+                        // -------------------------
+                        // class CalendarCacheHandle
+                        // -------------------------
+
+// CREATORS
+CalendarCacheHandle::CalendarCacheHandle(CalendarCache    *cache,
+                                         bslma::Allocator *basicAllocator)
+: d_entries(basicAllocator)
+, d_cache_p(cache)
+{
+    BSLS_ASSERT(cache);
+}
+
+CalendarCacheHandle::~CalendarCacheHandle()
+{
+}
+
+// MANIPULATORS
+void CalendarCacheHandle::clear()
+{
+    d_entries.clear();
+}
+
+const Calendar *CalendarCacheHandle::getCalendar(const char *calendarName)
+{
+    BSLS_ASSERT(calendarName);
+
+    bsl::vector<Entry>::iterator it = bsl::lower_bound(d_entries.begin(),
+                                                       d_entries.end(),
+                                                       calendarName,
+                                                       NameLess<Entry>());
 
-    CacheIterator iter = d_cache.find(calendarName);
+    if (d_entries.end() != it && 0 == bsl::strcmp(it->first.c_str(),
+                                                  calendarName)) {
+        CalendarCache_Entry& slot = it->second;
 
-    if (iter != d_cache.end()) {
-        if (   !d_hasTimeOutFlag
-            || d_timeOut > CurrentTime::utc() - iter->second.loadTime()) {
-            return iter->second.loadTime();                           // RETURN
+        if (slot.isCurrent() && !d_cache_p->isExpired(slot.loadTime())) {
+            return slot.get().get();                                  // RETURN
         }
-        else {
-            d_cache.erase(iter);
+
+        d_cache_p->loadCalendar(&slot, calendarName);
+
+        if (!slot.get()) {
+            d_entries.erase(it);
+            return 0;                                                 // RETURN
         }
+
+        return slot.get().get();                                      // RETURN
     }
 
-    return Datetime();
+    CalendarCache_Entry slot;
+
+    d_cache_p->loadCalendar(&slot, calendarName);
+
+    if (!slot.get()) {
+        return 0;                                                     // RETURN
+    }
+
+    it = d_entries.insert(it, Entry());
+    it->first.assign(calendarName);
+    it->second = slot;
+
+    return it->second.get().get();
 }
 
 }  // close package namespace
@@ -9,6 +9,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 // bdlt::CalendarCache: cache for read-only calendars that are loaded on demand
+// bdlt::CalendarCacheHandle: per-thread handle for repeated cache access
 //
 //@SEE_ALSO: bdlt_calendar, bdlt_calendarloader
 //
@@ -54,6 +55,42 @@ BSLS_IDENT("$Id: $")
 // 'bsl::shared_ptr<const bdlt::Calendar>' is returned if the requested
 // calendar is found to have expired.
 //
+///Lock-Free Lookup
+///----------------
+// Retrieving a calendar that is present in the cache (and has not expired),
+// using either 'getCalendar' or 'lookupCalendar', does not acquire a lock.
+// The cache indexes its calendars by name in a hash table whose buckets are
+// immutable lists published through atomic pointers, and a lookup searches
+// the most recently published list of the bucket for the requested name.
+// Loading and invalidating calendars are serialized by a mutex, and each
+// publishes a replacement list for the one bucket it affects (or, when the
+// table grows, a replacement table).  Because a lookup may still be searching
+// a replaced list, the modification then waits (see 'bslmt_graceperiod')
+// until every lookup that was in progress when the replacement was published
+// has finished, and destroys the replaced list along with the references it
+// holds to calendars.  A modification does not wait for lookups that start
+// after the replacement is published, so it completes however steadily
+// lookups arrive, and no replaced list outlives the modification that
+// replaced it.  Note that the cost of a modification does not depend on the
+// number of calendars in the cache, except when the table doubles in size.
+//
+///Per-Thread Handles
+///------------------
+// A calendar returned by the cache is returned by 'bsl::shared_ptr', whose
+// reference count is shared by every thread using that calendar.  A thread
+// that repeatedly resolves calendars by name can avoid updating that count by
+// using a 'bdlt::CalendarCacheHandle'.  A handle holds its own references to
+// the calendars it has obtained from a cache.  Each calendar loaded into the
+// cache carries a flag, allocated along with the calendar, that the cache
+// sets when the calendar is replaced in, or removed from, the cache.  A
+// request through the handle is satisfied by the address of the calendar it
+// holds provided that this flag is not set and the calendar has not expired;
+// otherwise, the handle obtains the calendar from the cache anew, exactly as
+// 'getCalendar' would.  Loading or invalidating calendars having other names
+// does not affect the calendars held by a handle.  Note that, therefore,
+// invalidation and timeouts have the same effect on requests made through a
+// handle as on requests made directly through the cache.
+//
 ///Thread Safety
 ///-------------
 // The 'bdlt::CalendarCache' class is fully thread-safe (see 'bsldoc_glossary')
@@ -61,6 +98,10 @@ BSLS_IDENT("$Id: $")
 // allocator in effect during the lifetime of cache objects are both fully
 // thread-safe.
 //
+// The 'bdlt::CalendarCacheHandle' class is *not* thread-safe: each handle is
+// intended to be used by a single thread, although any number of handles may
+// refer to the same cache.
+//
 ///Usage
 ///-----
 // The following example illustrates how to use a 'bdlt::CalendarCache'.
@@ -243,10 +284,58 @@ BSLS_IDENT("$Id: $")
 //
 //                            assert(!frC.get());
 //..
+//
+///Example 3: Using a Per-Thread Handle
+/// - - - - - - - - - - - - - - - - - -
+// This third example shows how a thread that repeatedly resolves calendars by
+// name can use a 'bdlt::CalendarCacheHandle' to do so efficiently.
+//
+// First, we create a calendar loader and a calendar cache, which would
+// typically be shared by many threads:
+//..
+//  MyCalendarLoader    loader;
+//  bdlt::CalendarCache cache(&loader);
+//..
+// Then, in each thread, we create a handle referring to the cache:
+//..
+//  bdlt::CalendarCacheHandle handle(&cache);
+//..
+// Next, we obtain the "US" calendar through the handle, which loads the
+// calendar into the cache:
+//..
+//  const bdlt::Calendar *usA = handle.getCalendar("US");
+//
+//                            assert( usA);
+//                            assert( usA->isHoliday(bdlt::Date(2011, 7,  4)));
+//                            assert(usA == cache.lookupCalendar("US").get());
+//..
+// Then, we obtain the "US" calendar through the handle again.  This request
+// is satisfied by the handle itself, without acquiring a lock or updating a
+// reference count:
+//..
+//  const bdlt::Calendar *usB = handle.getCalendar("US");
+//
+//                            assert(usA == usB);
+//..
+// Finally, we invalidate the "US" calendar in the cache, and observe that the
+// next request through the handle obtains the reloaded calendar.  Note that
+// 'usA' and 'usB' must not be used once the handle has replaced the calendar
+// to which they refer:
+//..
+//  int numInvalidated = cache.invalidate("US");
+//                            assert(1 == numInvalidated);
+//
+//  const bdlt::Calendar *usC = handle.getCalendar("US");
+//
+//                            assert( usC);
+//                            assert( usC->isHoliday(bdlt::Date(2011, 7,  4)));
+//                            assert(usC == cache.lookupCalendar("US").get());
+//..
 
 #include <bdlscm_version.h>
 
 #include <bdlt_calendar.h>
+#include <bdlt_currenttime.h>
 #include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
 
@@ -255,13 +344,18 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_integralconstant.h>
 
+#include <bslmt_graceperiod.h>
 #include <bslmt_mutex.h>
 
+#include <bsls_atomic.h>
 #include <bsls_timeinterval.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_map.h>
 #include <bsl_memory.h>  // 'bsl::shared_ptr'
 #include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
 
 #ifndef BDE_DONT_ALLOW_TRANSITIVE_INCLUDES
 #include <bslalg_typetraits.h>
@@ -273,31 +367,45 @@ namespace bdlt {
 
 class CalendarLoader;
 class CalendarCache_Entry;
+class PackedCalendar;
+class CalendarCacheHandle;
 
                         // =========================
                         // class CalendarCache_Entry
                         // =========================
 
-// IMPLEMENTATION NOTE: The Sun Studio 12.3 compiler does not support 'map's
-// holding types that are incomplete at the point of declaration of a data
-// member.  Other compilers allow us to complete 'CalendarCache_Entry' at a
-// later point in the code, but before any operation (such as 'insert') that
-// would require the type to be complete.  If we did not have to support this
-// compiler, this whole class could be defined in the .cpp file; as it stands,
-// it *must* be defined before class 'CalendarCache'.
+// IMPLEMENTATION NOTE: The Sun Studio 12.3 compiler does not support
+// containers holding types that are incomplete at the point of declaration of
+// a data member.  Other compilers allow us to complete 'CalendarCache_Entry'
+// at a later point in the code, but before any operation (such as 'insert')
+// that would require the type to be complete.  If we did not have to support
+// this compiler, this whole class could be defined in the .cpp file; as it
+// stands, it *must* be defined before class 'CalendarCacheHandle'.
 
 class CalendarCache_Entry {
     // This class defines the type of objects that are inserted into the
     // calendar cache.  Each entry contains a shared pointer to a read-only
-    // calendar and the time at which that calendar was loaded.  Note that an
-    // explicit allocator is *required* to create an entry object.
+    // calendar, the time at which that calendar was loaded, and the address
+    // of a flag, allocated along with the calendar, that is set once the
+    // calendar has been replaced in, or removed from, the cache.  Note that
+    // an explicit allocator is *required* to create an entry object.
+
+    // PRIVATE TYPES
+    struct Rep;
+        // Calendar and retirement flag managed by the shared pointer of an
+        // entry (defined in the implementation).
 
     // DATA
-    bsl::shared_ptr<const Calendar> d_ptr;       // shared pointer to
-                                                 // out-of-place instance
+    bsl::shared_ptr<const Calendar>  d_ptr;        // shared pointer to
+                                                   // out-of-place instance
+
+    Datetime                         d_loadTime;   // time when calendar was
+                                                   // loaded
 
-    Datetime                        d_loadTime;  // time when calendar was
-                                                 // loaded
+    bsls::AtomicBool                *d_retired_p;  // 'true' once the calendar
+                                                   // is no longer in the
+                                                   // cache, or 0 if empty
+                                                   // (held, not owned)
 
   public:
     // CREATORS
@@ -305,13 +413,12 @@ class CalendarCache_Entry {
         // Create an empty cache entry object.  Note that an empty cache entry
         // is never actually inserted into the cache.
 
-    CalendarCache_Entry(Calendar         *calendar,
-                        const Datetime&   loadTime,
-                        bslma::Allocator *allocator);
-        // Create a cache entry object for managing the specified 'calendar'
-        // that was loaded at the specified 'loadTime' using the specified
-        // 'allocator'.  The behavior is undefined unless 'calendar' uses
-        // 'allocator' to obtain memory.
+    CalendarCache_Entry(const PackedCalendar&  calendar,
+                        const Datetime&        loadTime,
+                        bslma::Allocator      *allocator);
+        // Create a cache entry object for managing a calendar having the
+        // value of the specified 'calendar' that was loaded at the specified
+        // 'loadTime' using the specified 'allocator' to supply memory.
 
     CalendarCache_Entry(const CalendarCache_Entry& original);
         // Create a cache entry object having the value of the specified
@@ -326,10 +433,21 @@ class CalendarCache_Entry {
         // object, and return a reference providing modifiable access to this
         // object.
 
+    void retire();
+        // Record that the calendar referred to by this cache entry object is
+        // no longer current.  The behavior is undefined if this entry is
+        // empty.  Note that the calendar is no longer current for every entry
+        // referring to it.
+
     // ACCESSORS
-    bsl::shared_ptr<const Calendar> get() const;
-        // Return a shared pointer providing non-modifiable access to the
-        // calendar referred to by this cache entry object.
+    const bsl::shared_ptr<const Calendar>& get() const;
+        // Return a reference providing non-modifiable access to the shared
+        // pointer to the calendar referred to by this cache entry object.
+
+    bool isCurrent() const;
+        // Return 'true' if this cache entry object is not empty and 'retire'
+        // has not been called for the calendar it refers to, and 'false'
+        // otherwise.
 
     Datetime loadTime() const;
         // Return the time at which the calendar referred to by this cache
@@ -360,37 +478,93 @@ class CalendarCache {
     //
     // This class is fully thread-safe (see 'bsldoc_glossary').
 
+    // PRIVATE TYPES
+    struct Index;
+        // Hash table of the cached calendars, searched by lookups without
+        // locking (defined in the implementation).
+
     // DATA
-    mutable bsl::map<bsl::string, CalendarCache_Entry>
-                            d_cache;           // cache of (name, handle) pairs
+    mutable bsls::AtomicPointer<Index>
+                                  d_index_p;         // most recently published
+                                                     // index of the cache, or
+                                                     // 0 if no calendar has
+                                                     // been loaded (owned)
 
-    CalendarLoader         *d_loader_p;        // calendar loader (held, not
-                                               // owned)
+    mutable bslmt::GracePeriod    d_gracePeriod;     // lookups of 'd_index_p'
+                                                     // in progress
 
-    DatetimeInterval        d_timeOut;         // timeout value; ignored unless
-                                               // 'd_hasTimeOutFlag' is 'true'
+    CalendarLoader               *d_loader_p;        // calendar loader (held,
+                                                     // not owned)
 
-    bool                    d_hasTimeOutFlag;  // 'true' if this cache has a
-                                               // timeout value and 'false'
-                                               // otherwise
+    DatetimeInterval              d_timeOut;         // timeout value; ignored
+                                                     // unless
+                                                     // 'd_hasTimeOutFlag' is
+                                                     // 'true'
 
-    mutable bslmt::Mutex    d_lock;            // guard access to cache
+    bool                          d_hasTimeOutFlag;  // 'true' if this cache
+                                                     // has a timeout value and
+                                                     // 'false' otherwise
 
-    bslma::Allocator       *d_allocator_p;     // memory allocator (held, not
-                                               // owned)
+    mutable bslmt::Mutex          d_lock;            // serializes modification
+                                                     // of the cache
 
-  private:
-    // PRIVATE TYPES
-    typedef bsl::map<bsl::string, CalendarCache_Entry>::iterator CacheIterator;
+    bslma::Allocator             *d_allocator_p;     // memory allocator (held,
+                                                     // not owned)
 
-    typedef bsl::map<bsl::string, CalendarCache_Entry>::const_iterator
-                                                            ConstCacheIterator;
+    // FRIENDS
+    friend class CalendarCacheHandle;
 
   private:
     // NOT IMPLEMENTED
     CalendarCache(const CalendarCache&);
     CalendarCache& operator=(const CalendarCache&);
 
+    // PRIVATE MANIPULATORS
+    void grow() const;
+        // Publish an index of this cache having twice the number of buckets
+        // of the current one (or an initial number of buckets if there is
+        // none), wait until no lookup can refer to the index it replaces, and
+        // destroy that index.  The behavior is undefined unless 'd_lock' is
+        // held by the calling thread.
+
+    void loadCalendar(CalendarCache_Entry *entry, const char *calendarName);
+        // Load, into the specified 'entry', the entry for the calendar having
+        // the specified 'calendarName' in this cache, loading the calendar
+        // into the cache if it is not present or has expired.  If the loader
+        // fails, reset 'entry' to the empty entry.
+
+    // PRIVATE ACCESSORS
+    bool isExpired(const Datetime& loadTime) const;
+        // Return 'true' if a calendar loaded into this cache at the specified
+        // 'loadTime' has expired, and 'false' otherwise.
+
+    bool lookupEntry(CalendarCache_Entry *entry,
+                     const char          *calendarName) const;
+        // Load, into the specified 'entry', the entry for the calendar having
+        // the specified 'calendarName' in the most recently published
+        // index of this cache, whether or not it has expired, without
+        // acquiring a lock.  Return 'true' if the calendar was found, and
+        // 'false' otherwise (in which case 'entry' is unchanged).
+
+    void publish(Index *index) const;
+        // Publish the specified 'index', transferring its ownership to this
+        // cache, wait until no lookup can refer to the index it replaces, and
+        // destroy that index.  The behavior is undefined unless 'd_lock' is
+        // held by the calling thread.
+
+    void removeExpired(const char *calendarName) const;
+        // Remove the calendar having the specified 'calendarName' from this
+        // cache if it is present and has expired.
+
+    void update(const char                *calendarName,
+                const CalendarCache_Entry *entry) const;
+        // Publish, in the index of this cache, a list for the bucket of the
+        // specified 'calendarName' in which the calendar having that name is
+        // that of the specified 'entry', or is absent if 'entry' is 0,
+        // retiring the entry it replaces (if any), wait until no lookup can
+        // refer to the list it replaces, and destroy that list.  The behavior
+        // is undefined unless 'd_lock' is held by the calling thread.
+
   public:
     // CREATORS
     explicit
@@ -471,10 +645,119 @@ class CalendarCache {
         // timeout optionally supplied at construction), return 'Datetime()'.
 };
 
+                        // =========================
+                        // class CalendarCacheHandle
+                        // =========================
+
+class CalendarCacheHandle {
+    // This class provides a handle through which a single thread obtains
+    // calendars from a 'CalendarCache' supplied at construction.  The handle
+    // holds references to the calendars obtained through it, and satisfies a
+    // subsequent request for one of them, without locking or updating a
+    // shared reference count, unless the calendar has been reloaded into, or
+    // removed from, the cache, or has expired, since it was obtained.
+    //
+    // This class is *not* thread-safe.
+
+    // PRIVATE TYPES
+    typedef bsl::pair<bsl::string, CalendarCache_Entry> Entry;
+        // Name of a calendar and the calendar obtained through the handle.
+
+    // DATA
+    bsl::vector<Entry>  d_entries;  // calendars obtained through this handle,
+                                    // sorted by name
+
+    CalendarCache      *d_cache_p;  // cache from which calendars are obtained
+                                    // (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    CalendarCacheHandle(const CalendarCacheHandle&);
+    CalendarCacheHandle& operator=(const CalendarCacheHandle&);
+
+  public:
+    // CREATORS
+    explicit
+    CalendarCacheHandle(CalendarCache    *cache,
+                        bslma::Allocator *basicAllocator = 0);
+        // Create a handle that obtains calendars from the specified 'cache'
+        // and holds none.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless 'cache'
+        // remains valid throughout the lifetime of this handle.
+
+    ~CalendarCacheHandle();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Release the references to all calendars held by this handle.
+
+    const Calendar *getCalendar(const char *calendarName);
+        // Return the address providing non-modifiable access to the calendar
+        // having the specified 'calendarName' in the cache supplied at
+        // construction, obtaining the calendar as if by the 'getCalendar'
+        // method of the cache unless the calendar held by this handle is
+        // current.  If the loader of the cache fails, return 0.  The returned
+        // address remains valid until the next invocation of a manipulator on
+        // this handle, or until this handle is destroyed.
+
+    // ACCESSORS
+    CalendarCache *cache() const;
+        // Return the address of the cache from which this handle obtains
+        // calendars.
+
+    bsl::size_t numCalendars() const;
+        // Return the number of calendars held by this handle.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this handle to supply memory.
+};
+
 // ============================================================================
 //                             INLINE DEFINITIONS
 // ============================================================================
 
+                           // -------------------
+                           // class CalendarCache
+                           // -------------------
+
+// PRIVATE ACCESSORS
+inline
+bool CalendarCache::isExpired(const Datetime& loadTime) const
+{
+    // The clock is consulted only if this cache has a timeout.
+
+    return d_hasTimeOutFlag && d_timeOut <= CurrentTime::utc() - loadTime;
+}
+
+                        // -------------------------
+                        // class CalendarCacheHandle
+                        // -------------------------
+
+// ACCESSORS
+inline
+CalendarCache *CalendarCacheHandle::cache() const
+{
+    return d_cache_p;
+}
+
+inline
+bsl::size_t CalendarCacheHandle::numCalendars() const
+{
+    return d_entries.size();
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *CalendarCacheHandle::allocator() const
+{
+    return d_entries.get_allocator().mechanism();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -486,6 +769,9 @@ namespace bslma {
 template <>
 struct UsesBslmaAllocator<bdlt::CalendarCache> : bsl::true_type {};
 
+template <>
+struct UsesBslmaAllocator<bdlt::CalendarCacheHandle> : bsl::true_type {};
+
 }  // close namespace bslma
 }  // close enterprise namespace
 
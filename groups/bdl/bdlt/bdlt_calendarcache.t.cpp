@@ -19,11 +19,13 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_atomic.h>
 #include <bsls_platform.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
 
 #include <bsl_climits.h>    // 'INT_MAX'
+#include <bsl_cstdio.h>     // 'sprintf'
 #include <bsl_cstdlib.h>    // 'atoi'
 #include <bsl_cstring.h>    // 'strcmp'
 #include <bsl_iostream.h>
@@ -78,14 +80,26 @@ using namespace bsl;
 // [ 4] int invalidateAll();
 // [ 3] shared_ptr<const Calendar> lookupCalendar(const char *name) const;
 // [ 3] Datetime lookupLoadTime(const char *name) const;
+//
+// 'CalendarCacheHandle' class:
+// [ 7] CalendarCacheHandle(CalendarCache *cache, Allocator *ba = 0);
+// [ 7] ~CalendarCacheHandle();
+// [ 7] void clear();
+// [ 7] const Calendar *getCalendar(const char *name);
+// [ 7] CalendarCache *cache() const;
+// [ 7] bsl::size_t numCalendars() const;
+// [ 7] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [ *] CONCERN: Precondition violations are detected when enabled.
 // [ 5] CONCERN: All memory allocation is exception neutral.
 // [ 6] CONCERN: All manipulators and accessors are thread-safe.
+// [ 8] CONCERN: Lookups and handles are safe during modification.
 // [-1] CONCERN: A non-trivial timeout is processed correctly.
+// [-2] PERFORMANCE: 'lookupCalendar' AND 'CalendarCacheHandle'
+// [-3] PERFORMANCE: LOADING AND INVALIDATING MANY CALENDARS
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -154,6 +168,7 @@ void aSsErT(bool condition, const char *message, int line)
 // ----------------------------------------------------------------------------
 
 typedef bdlt::CalendarCache                   Obj;
+typedef bdlt::CalendarCacheHandle             Handle;
 typedef bsl::shared_ptr<const bdlt::Calendar> Entry;
 
 typedef bsls::TimeInterval                    Interval;
@@ -176,6 +191,7 @@ bdlt::DatetimeInterval                        OneSecond(0, 0, 0, 1);
 // ----------------------------------------------------------------------------
 
 BSLMF_ASSERT((bslma::UsesBslmaAllocator<Obj>::VALUE));
+BSLMF_ASSERT((bslma::UsesBslmaAllocator<Handle>::VALUE));
 
 // ============================================================================
 //                  HELPER CLASSES AND FUNCTIONS FOR TESTING
@@ -191,9 +207,12 @@ static const int        gHolidayOffset = 38;
 
 class TestLoader : public bdlt::CalendarLoader {
     // This concrete calendar loader successfully loads calendars named
-    // "CAL-1", "CAL-2", and "CAL-3" only.  An attempt to load a calendar by
-    // any other name results in a non-zero result status being returned from
-    // the 'load' method.
+    // "CAL-1", "CAL-2", and "CAL-3" only, unless it has been set to fail.  An
+    // attempt to load a calendar by any other name results in a non-zero
+    // result status being returned from the 'load' method.
+
+    // DATA
+    bool d_failFlag;  // 'true' if every load fails
 
   private:
     // NOT IMPLEMENTED
@@ -213,11 +232,16 @@ class TestLoader : public bdlt::CalendarLoader {
         // Load, into the specified 'result', the calendar identified by the
         // specified 'calendarName'.  Return 0 on success, and a non-zero value
         // otherwise.
+
+    void setFail(bool failFlag);
+        // Make every subsequent 'load' fail if the specified 'failFlag' is
+        // 'true', and succeed for the recognized calendars otherwise.
 };
 
 // CREATORS
 inline
 TestLoader::TestLoader()
+: d_failFlag(false)
 {
 }
 
@@ -230,6 +254,10 @@ int TestLoader::load(bdlt::PackedCalendar *result, const char *calendarName)
     BSLS_ASSERT(result);
     BSLS_ASSERT(calendarName);
 
+    if (d_failFlag) {
+        return -1;                                                    // RETURN
+    }
+
     if (0 == bsl::strcmp("CAL-1", calendarName)
      || 0 == bsl::strcmp("CAL-2", calendarName)
      || 0 == bsl::strcmp("CAL-3", calendarName)) {
@@ -270,6 +298,46 @@ int TestLoader::load(bdlt::PackedCalendar *result, const char *calendarName)
     return 1;
 }
 
+void TestLoader::setFail(bool failFlag)
+{
+    d_failFlag = failFlag;
+}
+
+class NumberedLoader : public bdlt::CalendarLoader {
+    // This concrete calendar loader successfully loads a calendar having any
+    // name of the form "NUM-<n>", where '<n>' is a non-negative integer, whose
+    // first date is '<n> % 1000' days after that of the "CAL-1" calendar, and
+    // whose last date is 365 days after its first date.  An attempt to load a
+    // calendar by any other name results in a non-zero result status being
+    // returned from the 'load' method.
+
+  public:
+    // MANIPULATORS
+    int load(bdlt::PackedCalendar *result, const char *calendarName);
+        // Load, into the specified 'result', the calendar identified by the
+        // specified 'calendarName'.  Return 0 on success, and a non-zero value
+        // otherwise.
+};
+
+int NumberedLoader::load(bdlt::PackedCalendar *result,
+                         const char           *calendarName)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(calendarName);
+
+    if (0 != bsl::strncmp("NUM-", calendarName, 4)) {
+        return 1;                                                     // RETURN
+    }
+
+    const int        n         = bsl::atoi(calendarName + 4);
+    const bdlt::Date firstDate = gFirstDate1 + n % 1000;
+
+    result->removeAll();
+    result->setValidRange(firstDate, firstDate + 365);
+
+    return 0;
+}
+
 static
 bool providesNonModifiableAccessOnly(bdlt::Calendar *)
     // Return 'false'.
@@ -652,6 +720,98 @@ extern "C" void *threadFunction3(void *arg)
 
 }  // close namespace TestCase6
 
+namespace TestCase8 {
+
+struct ThreadInfo {
+    int  d_numIterations;
+    Obj *d_cache_p;
+    int  d_id;
+};
+
+extern "C" void *readerFunction(void *arg)
+    // Repeatedly obtain calendars from the cache described by the specified
+    // 'arg', through a handle and through the cache, and verify them.
+{
+    ThreadInfo *info = (ThreadInfo *)arg;
+
+    const Obj& X = *info->d_cache_p;
+
+    bslma::TestAllocator ha("handle");
+
+    Handle mH(info->d_cache_p, &ha);
+
+    static const char       *NAMES[] = { "CAL-1", "CAL-2", "CAL-3" };
+    static const bdlt::Date *DATES[] = { &gFirstDate1,
+                                         &gFirstDate2,
+                                         &gFirstDate3 };
+
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        const int j = (i + info->d_id) % 3;
+        const int k = (j + 1) % 3;
+
+        const bdlt::Calendar *calendar = mH.getCalendar(NAMES[j]);
+
+        ASSERT(calendar);
+        if (calendar) {
+            ASSERT(calendar->firstDate() == *DATES[j]);
+        }
+
+        Entry e = X.lookupCalendar(NAMES[k]);
+        if (e.get()) {
+            ASSERT(e->firstDate() == *DATES[k]);
+        }
+    }
+
+    return arg;
+}
+
+extern "C" void *writerFunction(void *arg)
+    // Repeatedly invalidate and reload calendars in the cache described by
+    // the specified 'arg'.
+{
+    ThreadInfo *info = (ThreadInfo *)arg;
+
+    Obj& mX = *info->d_cache_p;
+
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        if (0 == i % 4) {
+            mX.invalidateAll();
+        }
+        else {
+            mX.invalidate(0 == i % 2 ? "CAL-1" : "CAL-2");
+        }
+
+        Entry e = mX.getCalendar("CAL-3");
+        ASSERT(e.get());
+    }
+
+    return arg;
+}
+
+struct LookupInfo {
+    const Obj       *d_cache_p;
+    bsls::AtomicInt *d_isDone_p;
+};
+
+extern "C" void *lookupFunction(void *arg)
+    // Repeatedly look up the "CAL-1" calendar, which must be present, and the
+    // "CAL-3" calendar, which must be absent, in the cache described by the
+    // specified 'arg', until it is done.
+{
+    LookupInfo *info = (LookupInfo *)arg;
+
+    const Obj& X = *info->d_cache_p;
+
+    while (!info->d_isDone_p->load()) {
+        ASSERT(X.lookupCalendar("CAL-1").get());
+        ASSERT(X.lookupLoadTime("CAL-3") == bdlt::Datetime());
+    }
+
+    return arg;
+}
+
+}  // close namespace TestCase8
+
 // ============================================================================
 //                                USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -737,7 +897,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -951,6 +1111,608 @@ int main(int argc, char *argv[])
 //..
         }
 
+        if (verbose) cout << "Example 3: Using a Per-Thread Handle" << endl;
+        {
+///Example 3: Using a Per-Thread Handle
+/// - - - - - - - - - - - - - - - - - -
+// This third example shows how a thread that repeatedly resolves calendars by
+// name can use a 'bdlt::CalendarCacheHandle' to do so efficiently.
+//
+// First, we create a calendar loader and a calendar cache, which would
+// typically be shared by many threads:
+//..
+    MyCalendarLoader    loader;
+    bdlt::CalendarCache cache(&loader);
+//..
+// Then, in each thread, we create a handle referring to the cache:
+//..
+    bdlt::CalendarCacheHandle handle(&cache);
+//..
+// Next, we obtain the "US" calendar through the handle, which loads the
+// calendar into the cache:
+//..
+    const bdlt::Calendar *usA = handle.getCalendar("US");
+
+                              ASSERT( usA);
+                              ASSERT( usA->isHoliday(bdlt::Date(2011, 7,  4)));
+                              ASSERT(usA == cache.lookupCalendar("US").get());
+//..
+// Then, we obtain the "US" calendar through the handle again.  This request
+// is satisfied by the handle itself, without acquiring a lock or updating a
+// reference count:
+//..
+    const bdlt::Calendar *usB = handle.getCalendar("US");
+
+                              ASSERT(usA == usB);
+//..
+// Finally, we invalidate the "US" calendar in the cache, and observe that the
+// next request through the handle obtains the reloaded calendar.  Note that
+// 'usA' and 'usB' must not be used once the handle has replaced the calendar
+// to which they refer:
+//..
+    int numInvalidated = cache.invalidate("US");
+                              ASSERT(1 == numInvalidated);
+
+    const bdlt::Calendar *usC = handle.getCalendar("US");
+
+                              ASSERT( usC);
+                              ASSERT( usC->isHoliday(bdlt::Date(2011, 7,  4)));
+                              ASSERT(usC == cache.lookupCalendar("US").get());
+//..
+        }
+
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCURRENT LOOKUP AND RECLAMATION
+        //   Ensure that lookups and handles are safe during modification.
+        //
+        // Concerns:
+        //: 1 Lookups that do not acquire a lock, whether made through the
+        //:   cache or through a handle, return correct calendars while other
+        //:   threads load and invalidate calendars.
+        //:
+        //: 2 A handle observes the invalidation of a calendar by another
+        //:   client of the cache.
+        //:
+        //: 3 A replaced index, or list of a bucket, and the calendars it
+        //:   holds, are reclaimed by the modification that replaces it, even
+        //:   while lookups are continually in progress.
+        //:
+        //: 4 The cache retains every calendar loaded into it, and a handle
+        //:   every calendar it holds that is current, as the index of the
+        //:   cache grows.
+        //
+        // Plan:
+        //: 1 Invalidate a calendar held by a handle, and verify that the
+        //:   handle obtains the reloaded calendar.  (C-2)
+        //:
+        //: 2 Create several threads that obtain calendars through their own
+        //:   handles and through the cache, and a thread that repeatedly
+        //:   invalidates and reloads calendars, and verify each calendar
+        //:   obtained.  (C-1)
+        //:
+        //: 3 Verify that the memory in use after the threads run is that in
+        //:   use before they ran.  (C-3)
+        //:
+        //: 4 Create several threads that continually look up a calendar that
+        //:   remains in the cache, and repeatedly load and invalidate another
+        //:   calendar, verifying after each modification that the memory in
+        //:   use is unchanged.  (C-3)
+        //:
+        //: 5 Load many calendars through a handle, and verify that each is
+        //:   found in the cache, and is current for the handle, both before
+        //:   and after some are invalidated.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: Lookups and handles are safe during modification.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT LOOKUP AND RECLAMATION" << endl
+                          << "=================================" << endl;
+
+        using namespace TestCase8;
+
+        TestLoader loader;
+
+        bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\nTesting invalidation observed by handle."
+                          << endl;
+        {
+            Obj mX(&loader, &sa);
+
+            Handle mH(&mX, &sa);
+
+            const bdlt::Calendar *c1 = mH.getCalendar("CAL-1");
+            ASSERT(c1);
+
+            // Loading another calendar does not retire "CAL-1", so the handle
+            // continues to hold the same calendar.
+
+            Entry e2 = mX.getCalendar("CAL-2");
+            ASSERT(c1 == mH.getCalendar("CAL-1"));
+
+            // Hold a reference, so that the address cannot be reused.
+
+            Entry e1 = mX.lookupCalendar("CAL-1");
+            ASSERT(c1 == e1.get());
+
+            ASSERT(1 == mX.invalidate("CAL-1"));
+
+            const bdlt::Calendar *c2 = mH.getCalendar("CAL-1");
+            ASSERT(c2);
+            ASSERT(c2 != c1);
+            ASSERT(c2 == mX.lookupCalendar("CAL-1").get());
+        }
+        LOOP_ASSERT(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting concurrent lookup." << endl;
+        {
+            Obj mX(&loader, &sa);
+
+            // Load each calendar once, so that the index of the cache is
+            // allocated before the memory in use is measured.
+
+            mX.getCalendar("CAL-1");
+            mX.getCalendar("CAL-2");
+            mX.getCalendar("CAL-3");
+            mX.invalidateAll();
+
+            const bsls::Types::Int64 saLastNumBlocksInUse =
+                                                           sa.numBlocksInUse();
+
+            enum { k_NUM_READERS = 4 };
+
+            const int NUM_TEST_ITERATIONS   =   10;
+            const int NUM_THREAD_ITERATIONS = 2000;
+
+            ThreadInfo readerInfo[k_NUM_READERS];
+            ThreadInfo writerInfo = { NUM_THREAD_ITERATIONS / 10, &mX, 0 };
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                ThreadInfo info = { NUM_THREAD_ITERATIONS, &mX, i };
+                readerInfo[i] = info;
+            }
+
+            for (int ti = 0; ti < NUM_TEST_ITERATIONS; ++ti) {
+
+                if (veryVerbose) P(ti);
+
+                ThreadId ids[k_NUM_READERS];
+
+                for (int i = 0; i < k_NUM_READERS; ++i) {
+                    ids[i] = createThread(&readerFunction, &readerInfo[i]);
+                }
+
+                ThreadId writerId = createThread(&writerFunction,
+                                                 &writerInfo);
+
+                for (int i = 0; i < k_NUM_READERS; ++i) {
+                    joinThread(ids[i]);
+                }
+                joinThread(writerId);
+            }
+
+            mX.invalidateAll();
+
+            LOOP2_ASSERT(saLastNumBlocksInUse, sa.numBlocksInUse(),
+                         saLastNumBlocksInUse == sa.numBlocksInUse());
+        }
+        LOOP_ASSERT(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        LOOP_ASSERT(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting reclamation during lookups." << endl;
+        {
+            Obj mX(&loader, &sa);
+
+            // Load "CAL-2" once, so that the index of the cache is allocated
+            // before the memory in use is measured.
+
+            mX.getCalendar("CAL-2");
+            mX.invalidate("CAL-2");
+            mX.getCalendar("CAL-1");
+
+            const bsls::Types::Int64 saLastNumBlocksInUse =
+                                                           sa.numBlocksInUse();
+
+            enum { k_NUM_READERS = 4, k_NUM_MODIFICATIONS = 500 };
+
+            bsls::AtomicInt isDone(0);
+            LookupInfo      info = { &mX, &isDone };
+
+            ThreadId ids[k_NUM_READERS];
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                ids[i] = createThread(&lookupFunction, &info);
+            }
+
+            for (int i = 0; i < k_NUM_MODIFICATIONS; ++i) {
+                ASSERT(mX.getCalendar("CAL-2"));
+                ASSERT(1 == mX.invalidate("CAL-2"));
+
+                LOOP3_ASSERT(i, saLastNumBlocksInUse, sa.numBlocksInUse(),
+                             saLastNumBlocksInUse == sa.numBlocksInUse());
+            }
+
+            isDone = 1;
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                joinThread(ids[i]);
+            }
+        }
+        LOOP_ASSERT(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        LOOP_ASSERT(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting growth of the index." << endl;
+        {
+            NumberedLoader numberedLoader;
+
+            Obj mX(&numberedLoader, &sa);  const Obj& X = mX;
+
+            Handle mH(&mX, &sa);
+
+            enum { k_NUM_CALENDARS = 1000 };
+
+            char name[32];
+
+            for (int i = 0; i < k_NUM_CALENDARS; ++i) {
+                bsl::sprintf(name, "NUM-%d", i);
+
+                const bdlt::Calendar *calendar = mH.getCalendar(name);
+
+                LOOP_ASSERT(i, calendar);
+                if (calendar) {
+                    LOOP_ASSERT(i, gFirstDate1 + i == calendar->firstDate());
+                }
+            }
+
+            for (int i = 0; i < k_NUM_CALENDARS; ++i) {
+                bsl::sprintf(name, "NUM-%d", i);
+
+                Entry e = X.lookupCalendar(name);
+
+                LOOP_ASSERT(i, e.get());
+                LOOP_ASSERT(i, e.get() == mH.getCalendar(name));
+            }
+
+            for (int i = 1; i < k_NUM_CALENDARS; i += 2) {
+                bsl::sprintf(name, "NUM-%d", i);
+
+                LOOP_ASSERT(i, 1 == mX.invalidate(name));
+            }
+
+            for (int i = 0; i < k_NUM_CALENDARS; ++i) {
+                bsl::sprintf(name, "NUM-%d", i);
+
+                Entry e = X.lookupCalendar(name);
+
+                LOOP_ASSERT(i, (0 == i % 2) == (0 != e.get()));
+                if (e.get()) {
+                    LOOP_ASSERT(i, e.get() == mH.getCalendar(name));
+                }
+            }
+
+            ASSERT(k_NUM_CALENDARS / 2 == mX.invalidateAll());
+            ASSERT(0                   == mX.invalidateAll());
+
+            ASSERT(!X.lookupCalendar("NUM-0"));
+        }
+        LOOP_ASSERT(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        LOOP_ASSERT(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // 'CalendarCacheHandle'
+        //   Ensure that a handle obtains current calendars from its cache.
+        //
+        // Concerns:
+        //: 1 A handle is created holding no calendars, and refers to the cache
+        //:   and uses the allocator supplied at construction (or the default
+        //:   allocator if none is supplied).
+        //:
+        //: 2 'getCalendar' returns the calendar in the cache, loading it into
+        //:   the cache if necessary, and returns 0 if the loader fails.
+        //:
+        //: 3 A repeated request for a calendar that is current returns the
+        //:   same calendar and allocates no memory.
+        //:
+        //: 4 A request for a calendar that has been invalidated or reloaded in
+        //:   the cache, or that has expired, returns the calendar currently
+        //:   in the cache.
+        //:
+        //: 5 Invalidating or loading a calendar does not affect the other
+        //:   calendars held by the handle.
+        //:
+        //: 6 A request for a calendar that has been invalidated, or that has
+        //:   expired, returns 0 if the loader fails, and the handle no longer
+        //:   holds the calendar.
+        //:
+        //: 7 'clear' releases the calendars held by the handle.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create handles with and without an allocator, and verify the
+        //:   accessors.  (C-1)
+        //:
+        //: 2 Using a cache without a timeout, obtain calendars through a
+        //:   handle, and compare them with those returned by the cache,
+        //:   monitoring memory use.  (C-2..3)
+        //:
+        //: 3 Invalidate and reload calendars through the cache, and verify the
+        //:   calendars subsequently obtained through the handle, and that
+        //:   requests for the other calendars allocate no memory.  (C-4..5)
+        //:
+        //: 4 Using a cache having a timeout of 0, verify that each request
+        //:   through a handle reloads the calendar.  (C-4)
+        //:
+        //: 5 Set the loader to fail, invalidate a calendar held by a handle
+        //:   (or let it expire), and verify that requesting it through the
+        //:   handle returns 0 and removes it from the handle.  (C-6)
+        //:
+        //: 6 Clear the handle, and verify the number of calendars it holds and
+        //:   that invalidating the cache then releases memory.  (C-7)
+        //:
+        //: 7 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for argument values.  (C-8)
+        //
+        // Testing:
+        //   CalendarCacheHandle(CalendarCache *cache, Allocator *ba = 0);
+        //   ~CalendarCacheHandle();
+        //   void clear();
+        //   const Calendar *getCalendar(const char *name);
+        //   CalendarCache *cache() const;
+        //   bsl::size_t numCalendars() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'CalendarCacheHandle'" << endl
+                          << "=====================" << endl;
+
+        TestLoader loader;
+
+        bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+        bslma::TestAllocator ha("handle",   veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\nTesting creators and accessors." << endl;
+        {
+            Obj mX(&loader, &sa);
+
+            const Handle H(&mX);
+
+            ASSERT(&mX == H.cache());
+            ASSERT(0   == H.numCalendars());
+            ASSERT(&da == H.allocator());
+
+            const Handle G(&mX, &ha);
+
+            ASSERT(&mX == G.cache());
+            ASSERT(0   == G.numCalendars());
+            ASSERT(&ha == G.allocator());
+        }
+        LOOP_ASSERT(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+        LOOP_ASSERT(sa.numBlocksTotal(), 0 == sa.numBlocksTotal());
+        LOOP_ASSERT(ha.numBlocksTotal(), 0 == ha.numBlocksTotal());
+
+        if (verbose) cout << "\nTesting without a timeout." << endl;
+        {
+            Obj mX(&loader, &sa);  const Obj& X = mX;
+
+            Handle mH(&mX, &ha);  const Handle& H = mH;
+
+            ASSERT(0 == mH.getCalendar("ERROR"));
+            ASSERT(0 == mH.getCalendar("CAL-Z"));
+            ASSERT(0 == H.numCalendars());
+
+            const bdlt::Calendar *c1 = mH.getCalendar("CAL-1");
+
+            ASSERT(c1);
+            ASSERT(c1->firstDate() == gFirstDate1);
+            ASSERT(c1 == X.lookupCalendar("CAL-1").get());
+            ASSERT(1  == H.numCalendars());
+
+            LOOP_ASSERT(ha.numBlocksInUse(), 0 < ha.numBlocksInUse());
+
+            const bdlt::Calendar *c3 = mH.getCalendar("CAL-3");
+            const bdlt::Calendar *c2 = mH.getCalendar("CAL-2");
+
+            ASSERT(c2);
+            ASSERT(c2->firstDate() == gFirstDate2);
+            ASSERT(c3);
+            ASSERT(c3->firstDate() == gFirstDate3);
+            ASSERT(3  == H.numCalendars());
+
+            // Repeated requests.
+
+            const bsls::Types::Int64 saLastNumBlocksTotal =
+                                                           sa.numBlocksTotal();
+            const bsls::Types::Int64 haLastNumBlocksTotal =
+                                                           ha.numBlocksTotal();
+
+            for (int i = 0; i < 3; ++i) {
+                ASSERT(c1 == mH.getCalendar("CAL-1"));
+                ASSERT(c2 == mH.getCalendar("CAL-2"));
+                ASSERT(c3 == mH.getCalendar("CAL-3"));
+            }
+            ASSERT(0 == mH.getCalendar("CAL-Z"));
+            ASSERT(3 == H.numCalendars());
+
+            LOOP2_ASSERT(saLastNumBlocksTotal, sa.numBlocksTotal(),
+                         saLastNumBlocksTotal == sa.numBlocksTotal());
+            LOOP2_ASSERT(haLastNumBlocksTotal, ha.numBlocksTotal(),
+                         haLastNumBlocksTotal == ha.numBlocksTotal());
+
+            // Invalidation.  References are held so that the addresses of the
+            // invalidated calendars cannot be reused.
+
+            Entry e1 = X.lookupCalendar("CAL-1");
+            Entry e2 = X.lookupCalendar("CAL-2");
+
+            ASSERT(1 == mX.invalidate("CAL-2"));
+
+            {
+                const bsls::Types::Int64 saLastNumBlocksTotal =
+                                                           sa.numBlocksTotal();
+                const bsls::Types::Int64 haLastNumBlocksTotal =
+                                                           ha.numBlocksTotal();
+
+                ASSERT(c1 == mH.getCalendar("CAL-1"));
+                ASSERT(c3 == mH.getCalendar("CAL-3"));
+
+                LOOP2_ASSERT(saLastNumBlocksTotal, sa.numBlocksTotal(),
+                             saLastNumBlocksTotal == sa.numBlocksTotal());
+                LOOP2_ASSERT(haLastNumBlocksTotal, ha.numBlocksTotal(),
+                             haLastNumBlocksTotal == ha.numBlocksTotal());
+            }
+
+            const bdlt::Calendar *c2b = mH.getCalendar("CAL-2");
+
+            ASSERT(c2b);
+            ASSERT(c2b != c2);
+            ASSERT(c2b == X.lookupCalendar("CAL-2").get());
+
+            // A calendar reloaded through the cache is observed.
+
+            ASSERT(3 == mX.invalidateAll());
+
+            Entry e1b = mX.getCalendar("CAL-1");
+
+            ASSERT(e1b.get() != c1);
+            ASSERT(e1b.get() == mH.getCalendar("CAL-1"));
+            ASSERT(3 == H.numCalendars());
+
+            // Clearing.
+
+            mH.clear();
+            ASSERT(0 == H.numCalendars());
+
+            e1.reset();
+            e2.reset();
+            e1b.reset();
+
+            const bsls::Types::Int64 saLastNumBlocksInUse =
+                                                           sa.numBlocksInUse();
+
+            ASSERT(1 == mX.invalidateAll());
+
+            LOOP2_ASSERT(saLastNumBlocksInUse, sa.numBlocksInUse(),
+                         saLastNumBlocksInUse > sa.numBlocksInUse());
+
+            ASSERT(mH.getCalendar("CAL-2"));
+            ASSERT(1 == H.numCalendars());
+        }
+        LOOP_ASSERT(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        LOOP_ASSERT(ha.numBlocksInUse(), 0 == ha.numBlocksInUse());
+        LOOP_ASSERT(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting with a timeout." << endl;
+        {
+            Obj mX(&loader, Interval(0, 0), &sa);
+
+            Handle mH(&mX, &ha);
+
+            ASSERT(mH.getCalendar("CAL-1"));
+
+            for (int i = 0; i < 3; ++i) {
+                const bsls::Types::Int64 saLastNumBlocksTotal =
+                                                           sa.numBlocksTotal();
+
+                const bdlt::Calendar *c = mH.getCalendar("CAL-1");
+
+                ASSERT(c);
+                ASSERT(c->firstDate() == gFirstDate1);
+
+                LOOP2_ASSERT(saLastNumBlocksTotal, sa.numBlocksTotal(),
+                             saLastNumBlocksTotal < sa.numBlocksTotal());
+            }
+        }
+        {
+            Obj mX(&loader, Interval(60, 0), &sa);
+
+            Handle mH(&mX, &ha);
+
+            const bdlt::Calendar *c = mH.getCalendar("CAL-1");
+
+            const bsls::Types::Int64 saLastNumBlocksTotal =
+                                                           sa.numBlocksTotal();
+
+            ASSERT(c == mH.getCalendar("CAL-1"));
+
+            LOOP2_ASSERT(saLastNumBlocksTotal, sa.numBlocksTotal(),
+                         saLastNumBlocksTotal == sa.numBlocksTotal());
+        }
+        LOOP_ASSERT(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        LOOP_ASSERT(ha.numBlocksInUse(), 0 == ha.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting failed reload." << endl;
+        {
+            Obj mX(&loader, &sa);
+
+            Handle mH(&mX, &ha);  const Handle& H = mH;
+
+            ASSERT(mH.getCalendar("CAL-1"));
+            ASSERT(mH.getCalendar("CAL-2"));
+            ASSERT(2 == H.numCalendars());
+
+            loader.setFail(true);
+
+            ASSERT(1 == mX.invalidate("CAL-1"));
+
+            ASSERT(0 == mH.getCalendar("CAL-1"));
+            ASSERT(1 == H.numCalendars());
+            ASSERT(0 == mH.getCalendar("CAL-1"));
+            ASSERT(mH.getCalendar("CAL-2"));
+
+            loader.setFail(false);
+
+            const bdlt::Calendar *c1 = mH.getCalendar("CAL-1");
+
+            ASSERT(c1);
+            ASSERT(c1 == mX.lookupCalendar("CAL-1").get());
+            ASSERT(2  == H.numCalendars());
+        }
+        {
+            Obj mX(&loader, Interval(0, 0), &sa);
+
+            Handle mH(&mX, &ha);  const Handle& H = mH;
+
+            ASSERT(mH.getCalendar("CAL-1"));
+
+            loader.setFail(true);
+
+            ASSERT(0 == mH.getCalendar("CAL-1"));
+            ASSERT(0 == H.numCalendars());
+
+            loader.setFail(false);
+        }
+        LOOP_ASSERT(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        LOOP_ASSERT(ha.numBlocksInUse(), 0 == ha.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&loader, &sa);
+
+            ASSERT_PASS(Handle(&mX, &ha));
+            ASSERT_FAIL(Handle(  0, &ha));
+
+            Handle mH(&mX, &ha);
+
+            ASSERT_PASS(mH.getCalendar("CAL-1"));
+            ASSERT_FAIL(mH.getCalendar(0));
+        }
+
       } break;
       case 6: {
         // --------------------------------------------------------------------
@@ -2307,6 +3069,133 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'lookupCalendar' AND 'CalendarCacheHandle'
+        //
+        // Concerns:
+        //: 1 Obtaining a cached calendar through a handle is cheaper than
+        //:   obtaining it through the cache.
+        //
+        // Plan:
+        //: 1 Time repeated requests for cached calendars through
+        //:   'getCalendar', 'lookupCalendar', and a handle, and report the
+        //:   average time per request.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: 'lookupCalendar' AND 'CalendarCacheHandle'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "PERFORMANCE: 'lookupCalendar' AND 'CalendarCacheHandle'"
+                 << endl
+                 << "======================================================="
+                 << endl;
+
+        TestLoader loader;
+
+        Obj mX(&loader);  const Obj& X = mX;
+
+        Handle mH(&mX);
+
+        static const char *NAMES[] = { "CAL-1", "CAL-2", "CAL-3" };
+
+        const int NUM_ITERATIONS = 3000000;
+
+        for (int i = 0; i < 3; ++i) {
+            ASSERT(mX.getCalendar(NAMES[i]).get());
+        }
+
+        bsls::Types::Int64 sum = 0;
+
+        Datetime start = bdlt::CurrentTime::utc();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            sum += mX.getCalendar(NAMES[i % 3])->length();
+        }
+        const double getNs    = (bdlt::CurrentTime::utc() - start)
+                                                        .totalSecondsAsDouble()
+                                * 1e9 / NUM_ITERATIONS;
+
+        start = bdlt::CurrentTime::utc();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            sum += X.lookupCalendar(NAMES[i % 3])->length();
+        }
+        const double lookupNs = (bdlt::CurrentTime::utc() - start)
+                                                        .totalSecondsAsDouble()
+                                * 1e9 / NUM_ITERATIONS;
+
+        start = bdlt::CurrentTime::utc();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            sum += mH.getCalendar(NAMES[i % 3])->length();
+        }
+        const double handleNs = (bdlt::CurrentTime::utc() - start)
+                                                        .totalSecondsAsDouble()
+                                * 1e9 / NUM_ITERATIONS;
+
+        ASSERT(0 < sum);
+
+        cout << "getCalendar:    " << getNs    << " ns" << endl
+             << "lookupCalendar: " << lookupNs << " ns" << endl
+             << "handle:         " << handleNs << " ns" << endl;
+      } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: LOADING AND INVALIDATING MANY CALENDARS
+        //
+        // Concerns:
+        //: 1 The cost of loading a calendar into, or invalidating a calendar
+        //:   in, the cache does not grow with the number of calendars in the
+        //:   cache.
+        //
+        // Plan:
+        //: 1 For increasing numbers of calendars, time loading each calendar
+        //:   into an empty cache, and then invalidating each calendar, and
+        //:   report the average time per calendar.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: LOADING AND INVALIDATING MANY CALENDARS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "PERFORMANCE: LOADING AND INVALIDATING MANY CALENDARS"
+                 << endl
+                 << "===================================================="
+                 << endl;
+
+        NumberedLoader loader;
+
+        static const int NUM_CALENDARS[] = { 1000, 10000, 100000 };
+
+        char name[32];
+
+        for (int ti = 0; ti < 3; ++ti) {
+            const int N = NUM_CALENDARS[ti];
+
+            Obj mX(&loader);
+
+            Datetime start = bdlt::CurrentTime::utc();
+            for (int i = 0; i < N; ++i) {
+                bsl::sprintf(name, "NUM-%d", i);
+                ASSERT(mX.getCalendar(name).get());
+            }
+            const double loadNs = (bdlt::CurrentTime::utc() - start)
+                                                        .totalSecondsAsDouble()
+                                  * 1e9 / N;
+
+            start = bdlt::CurrentTime::utc();
+            for (int i = 0; i < N; ++i) {
+                bsl::sprintf(name, "NUM-%d", i);
+                ASSERT(1 == mX.invalidate(name));
+            }
+            const double invalidateNs = (bdlt::CurrentTime::utc() - start)
+                                                        .totalSecondsAsDouble()
+                                        * 1e9 / N;
+
+            cout << N << " calendars:" << endl
+                 << "  getCalendar: " << loadNs       << " ns" << endl
+                 << "  invalidate:  " << invalidateNs << " ns" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
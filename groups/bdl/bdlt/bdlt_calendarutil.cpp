@@ -32,43 +32,39 @@ int CalendarUtil::addBusinessDaysIfValid(
                                ? numBusinessDays
                                : -numBusinessDays;
 
-    // declare forward and reverse iterators
+    // Rather than stepping through the business days one at a time, compute
+    // the index of the resulting business day within 'calendar' and select it
+    // directly.  The starting business day (the one on or after 'original'
+    // when moving forward, or on or before 'original' when moving backward)
+    // counts as the first step if 'original' is not a business day.
 
-    unsigned int count = calendar.isBusinessDay(original) ? 0 : 1;
+    const bool         isBusinessDay = calendar.isBusinessDay(original);
+    const unsigned int count         = isBusinessDay ? 0 : 1;
+    const unsigned int numSteps      = absNumBusDays > count
+                                     ? absNumBusDays - count
+                                     : 0;
 
-    if (numBusinessDays < 0) {
-        // an iterator to the business day on or before original
+    // number of business days on or before 'original'
 
-        bdlt::Calendar::BusinessDayConstReverseIterator rit =
-                                         calendar.rbeginBusinessDays(original);
+    const int numOnOrBefore = calendar.numBusinessDays(calendar.firstDate(),
+                                                       original);
 
-        while (rit != calendar.rendBusinessDays() && count < absNumBusDays) {
-            ++rit;
-            ++count;
-        }
-
-        if (rit == calendar.rendBusinessDays()) {
+    if (numBusinessDays < 0) {
+        if (numSteps >= static_cast<unsigned int>(numOnOrBefore)) {
             return e_OUT_OF_RANGE;                                    // RETURN
         }
 
-        *result = *rit;
+        *result = calendar.businessDay(numOnOrBefore - 1 - numSteps);
     }
     else {
-        // an iterator to the business day on or after 'original'
+        const int numBefore = numOnOrBefore - (isBusinessDay ? 1 : 0);
 
-        bdlt::Calendar::BusinessDayConstIterator fit =
-                                          calendar.beginBusinessDays(original);
-
-        while (fit != calendar.endBusinessDays() && count < absNumBusDays) {
-            ++fit;
-            ++count;
-        }
-
-        if (fit == calendar.endBusinessDays()) {
+        if (numSteps >= static_cast<unsigned int>(
+                                  calendar.numBusinessDays() - numBefore)) {
             return e_OUT_OF_RANGE;                                    // RETURN
         }
 
-        *result = *fit;
+        *result = calendar.businessDay(numBefore + numSteps);
     }
 
     return e_SUCCESS;
@@ -360,43 +356,35 @@ int CalendarUtil::subtractBusinessDaysIfValid(
                                ? numBusinessDays
                                : -numBusinessDays;
 
-    // declare forward and reverse iterators
+    // See 'addBusinessDaysIfValid' for a description of the approach.
 
-    unsigned int count = calendar.isBusinessDay(original) ? 0 : 1;
+    const bool         isBusinessDay = calendar.isBusinessDay(original);
+    const unsigned int count         = isBusinessDay ? 0 : 1;
+    const unsigned int numSteps      = absNumBusDays > count
+                                     ? absNumBusDays - count
+                                     : 0;
 
-    if (numBusinessDays >= 0) {
-        // an iterator to the business day on or before original
+    // number of business days on or before 'original'
 
-        bdlt::Calendar::BusinessDayConstReverseIterator rit =
-                                         calendar.rbeginBusinessDays(original);
+    const int numOnOrBefore = calendar.numBusinessDays(calendar.firstDate(),
+                                                       original);
 
-        while (rit != calendar.rendBusinessDays() && count < absNumBusDays) {
-            ++rit;
-            ++count;
-        }
-
-        if (rit == calendar.rendBusinessDays()) {
+    if (numBusinessDays >= 0) {
+        if (numSteps >= static_cast<unsigned int>(numOnOrBefore)) {
             return e_OUT_OF_RANGE;                                    // RETURN
         }
 
-        *result = *rit;
+        *result = calendar.businessDay(numOnOrBefore - 1 - numSteps);
     }
     else {
-        // an iterator to the business day on or after 'original'
+        const int numBefore = numOnOrBefore - (isBusinessDay ? 1 : 0);
 
-        bdlt::Calendar::BusinessDayConstIterator fit =
-                                          calendar.beginBusinessDays(original);
-
-        while (fit != calendar.endBusinessDays() && count < absNumBusDays) {
-            ++fit;
-            ++count;
-        }
-
-        if (fit == calendar.endBusinessDays()) {
+        if (numSteps >= static_cast<unsigned int>(
+                                  calendar.numBusinessDays() - numBefore)) {
             return e_OUT_OF_RANGE;                                    // RETURN
         }
 
-        *result = *fit;
+        *result = calendar.businessDay(numBefore + numSteps);
     }
 
     return e_SUCCESS;
@@ -15,6 +15,7 @@
 #include <bsls_asserttest.h>
 #include <bsls_review.h>
 
+#include <bsl_climits.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
@@ -231,6 +232,51 @@ int getStartDate(const char *input)
     return 999;
 }
 
+int addBusinessDaysByIteration(bdlt::Date            *result,
+                               const bdlt::Date&      original,
+                               const bdlt::Calendar&  calendar,
+                               int                    numBusinessDays)
+    // Load, into the specified 'result', the date that is the specified
+    // 'numBusinessDays' after the specified 'original' date according to the
+    // specified 'calendar', as documented for 'addBusinessDaysIfValid', by
+    // stepping through the business days of 'calendar' one at a time.  Return
+    // 0 on success, and a non-zero value, without modifying '*result',
+    // otherwise.
+{
+    if (!calendar.isInRange(original)) {
+        return 1;                                                     // RETURN
+    }
+
+    int count = calendar.isBusinessDay(original) ? 0 : 1;
+    int limit = numBusinessDays >= 0 ? numBusinessDays : -numBusinessDays;
+
+    if (numBusinessDays < 0) {
+        bdlt::Calendar::BusinessDayConstReverseIterator rit =
+                                         calendar.rbeginBusinessDays(original);
+        while (rit != calendar.rendBusinessDays() && count < limit) {
+            ++rit;
+            ++count;
+        }
+        if (rit == calendar.rendBusinessDays()) {
+            return 1;                                                 // RETURN
+        }
+        *result = *rit;
+    }
+    else {
+        bdlt::Calendar::BusinessDayConstIterator fit =
+                                          calendar.beginBusinessDays(original);
+        while (fit != calendar.endBusinessDays() && count < limit) {
+            ++fit;
+            ++count;
+        }
+        if (fit == calendar.endBusinessDays()) {
+            return 1;                                                 // RETURN
+        }
+        *result = *fit;
+    }
+    return 0;
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -329,6 +375,10 @@ int main(int argc, char *argv[])
         //:   result and success indicated in return value.
         //:
         //: 2 QoI: Asserted precondition violations are detected when enabled.
+        //:
+        //: 3 The result is that obtained by stepping through the business days
+        //:   of the calendar one at a time, for every 'original' date and for
+        //:   shifts that span many 64-day blocks of the calendar's cache.
         //
         // Plan:
         //: 1 Use the table-driven approach, define a representative set of
@@ -336,6 +386,11 @@ int main(int argc, char *argv[])
         //:
         //: 2 Verify that, in appropriate build modes, defensive checks are
         //:   triggered for argument values.  (C-2)
+        //:
+        //: 3 For a calendar of several hundred days having weekends and
+        //:   holidays, compare the results for every 'original' date and a
+        //:   range of 'numBusinessDays' against a reference implementation
+        //:   that iterates over business days.  (C-3)
         //
         // Testing:
         //   int addBusinessDays(bdlt::Date *result, orig, cdr, num);
@@ -510,6 +565,64 @@ int main(int argc, char *argv[])
             }
         }
 
+        if (verbose) cout << "\nComparison with iteration." << endl;
+        {
+            const bdlt::Date FIRST(2019, 12, 2);
+            const bdlt::Date LAST(2020, 9, 7);
+
+            bdlt::Calendar calendar(FIRST, LAST);
+            calendar.addWeekendDay(bdlt::DayOfWeek::e_SAT);
+            calendar.addWeekendDay(bdlt::DayOfWeek::e_SUN);
+            for (bdlt::Date date = FIRST + 3; date <= LAST; date += 11) {
+                calendar.addHoliday(date);
+            }
+
+            // A run of non-business days spanning a 64-day block boundary.
+
+            for (int i = 60; i < 75; ++i) {
+                calendar.addHoliday(FIRST + i);
+            }
+
+            static const int EXTREMES[] = { INT_MAX, INT_MAX - 1,
+                                            -INT_MAX, -INT_MAX + 1 };
+
+            for (bdlt::Date original = FIRST - 1;
+                 original <= LAST + 1;
+                 ++original) {
+                for (int n = -220; n <= 220 + 4; ++n) {
+                    const int NUMDAYS = n <= 220 ? n : EXTREMES[n - 221];
+
+                    bdlt::Date expected(1, 1, 1);
+                    const int  expRet = addBusinessDaysByIteration(&expected,
+                                                                   original,
+                                                                   calendar,
+                                                                   NUMDAYS);
+
+                    bdlt::Date result(1, 1, 1);
+                    int        rc = Util::addBusinessDaysIfValid(&result,
+                                                                 original,
+                                                                 calendar,
+                                                                 NUMDAYS);
+                    ASSERTV(original, NUMDAYS, expRet, rc,
+                            (0 == expRet) == (0 == rc));
+                    ASSERTV(original, NUMDAYS, expected, result,
+                            expected == result);
+
+                    if (0 != NUMDAYS) {
+                        result = bdlt::Date(1, 1, 1);
+                        rc     = Util::subtractBusinessDaysIfValid(&result,
+                                                                   original,
+                                                                   calendar,
+                                                                   -NUMDAYS);
+                        ASSERTV(original, NUMDAYS, expRet, rc,
+                                (0 == expRet) == (0 == rc));
+                        ASSERTV(original, NUMDAYS, expected, result,
+                                expected == result);
+                    }
+                }
+            }
+        }
+
         // negative tests
         if (verbose) cout << "\nNegative Testing." << endl;
         {
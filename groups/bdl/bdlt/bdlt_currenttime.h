@@ -10,7 +10,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //   bdlt::CurrentTime: namespace for current-time procedures
 //
-//@SEE_ALSO: bsls_timeinterval, bdlt_systemtimeutil
+//@SEE_ALSO: bsls_timeinterval, bdlt_systemtimeutil, bsls_tscclock
 //
 //@DESCRIPTION: This component, 'bdlt::CurrentTime', provides static methods
 // for retrieving the current time in Coordinated Universal Time (UTC) and in
@@ -24,6 +24,22 @@ BSLS_IDENT("$Id: $")
 // set and retrieve the callback function.  In addition, user-supplied callback
 // functions must be *thread-safe*.
 //
+///Reading the Time-Stamp Counter
+///------------------------------
+// By default, the current time is obtained from the system realtime clock
+// (see 'bsls::SystemTime::nowRealtimeClock'), which involves a call to the
+// operating system.  Where the current time is retrieved at a high rate, the
+// cost of that call can be avoided by installing 'bsls::TscClock::now', which
+// derives the realtime clock from the CPU time-stamp counter, as the
+// current-time callback:
+//..
+//  bsls::TscClock::initialize();
+//  bdlt::CurrentTime::setCurrentTimeCallback(&bsls::TscClock::now);
+//..
+// 'bsls::TscClock::now' is periodically recalibrated against the system
+// realtime clock, and falls back on it where the time-stamp counter is
+// unavailable or unreliable (see 'bsls_tscclock').
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
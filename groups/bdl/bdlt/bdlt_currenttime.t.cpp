@@ -14,6 +14,7 @@
 #include <bsl_ostream.h>
 
 #include <bsls_systemtime.h>
+#include <bsls_tscclock.h>
 
 #ifdef BSLS_PLATFORM_OS_WINDOWS
 #include <windows.h>
@@ -947,6 +948,8 @@ int main(int argc, char *argv[])
         //:   with which it was called.
         //:
         //: 4 These methods are thread-safe.
+        //:
+        //: 5 'bsls::TscClock::now' can be installed as the callback function.
         //
         // Plan:
         //: 1 Set and retrieve callback functions using the two methods.
@@ -957,6 +960,10 @@ int main(int argc, char *argv[])
         //: 2 Start multiple threads which repeatedly install one of two
         //:   callback functions and verify that the only those functions are
         //:   ever returned by the methods.
+        //:
+        //: 3 Install 'bsls::TscClock::now', and verify that 'now' agrees with
+        //:   readings of 'bsls::SystemTime::nowRealtimeClock' bracketing it
+        //:   to within one millisecond.  (C-5)
         //
         // Testing:
         //   CurrentTimeCallback currentTimeCallback()
@@ -1026,6 +1033,32 @@ int main(int argc, char *argv[])
                 joinThread(IDS[i]);
             }
         }
+
+        if (verbose) {
+            cout << "Testing with 'bsls::TscClock::now'" << endl;
+        }
+        {
+            bsls::TscClock::initialize();
+
+            const Util::CurrentTimeCallback previous =
+                         Util::setCurrentTimeCallback(&bsls::TscClock::now);
+            ASSERT(&bsls::TscClock::now == Util::currentTimeCallback());
+
+            const bsls::TimeInterval TOLERANCE(0, 1000 * 1000);
+
+            for (int i = 0; i < 1000; ++i) {
+                const bsls::TimeInterval before =
+                                          bsls::SystemTime::nowRealtimeClock();
+                const bsls::TimeInterval now    = Util::now();
+                const bsls::TimeInterval after  =
+                                          bsls::SystemTime::nowRealtimeClock();
+
+                ASSERTV(i, before, now, before - TOLERANCE <= now);
+                ASSERTV(i, after,  now, now <= after + TOLERANCE);
+            }
+
+            Util::setCurrentTimeCallback(previous);
+        }
       } break;
       case 1: {
         // --------------------------------------------------------------------
@@ -15,10 +15,16 @@ BSLS_IDENT_RCSID(bdlt_fixutil_cpp,"$Id$ $CSID$")
 #include <bslmf_assert.h>
 #include <bslmf_issame.h>
 
+#include <bsls_platform.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_cctype.h>
 #include <bsl_cstring.h>
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
 namespace {
 namespace u {
 
@@ -563,6 +569,199 @@ int parseTime(const char **nextPos,
 
     *nextPos = p;
 
+    return 0;
+}
+
+                        // ---------------------------
+                        // Canonical DatetimeTz Layout
+                        // ---------------------------
+
+// FIX timestamps are almost always sent with seconds, at most microsecond
+// precision, and either no timezone offset or one of the forms 'Z', '+hh', or
+// '+hh:mm' (or with '-').  A string having that layout is expanded into the
+// fixed layout "YYYYMMDD-hh:mm:ss.ssssss+hh:mm" in a local buffer, validated
+// 16 characters at a time (using SSE2 when available), and converted by
+// reading its digits at fixed positions.  Anything else, including leap
+// seconds, is left to the general parser.
+
+const char k_CANONICAL_LAYOUT[32] = "DDDDDDDD-DD:DD:DD.DDDDDD+DD:DD";
+    // 'D' denotes a decimal digit; every other character, including the two
+    // null characters padding the layout to 32 characters, must match
+    // exactly.
+
+enum {
+    k_BUFFER_LENGTH    = sizeof k_CANONICAL_LAYOUT,
+    k_FRACTION_OFFSET  = sizeof "YYYYMMDD-hh:mm:ss" - 1,
+    k_ZONE_OFFSET      = sizeof "YYYYMMDD-hh:mm:ss.ssssss" - 1,
+    k_ZONE_LENGTH      = sizeof "+hh:mm" - 1,
+    k_CANONICAL_LENGTH = k_ZONE_OFFSET + k_ZONE_LENGTH
+};
+
+inline
+int twoDigitsToInt(const char *digits)
+    // Return the value of the two decimal digits at the specified 'digits'.
+{
+    return (digits[0] - '0') * 10 + (digits[1] - '0');
+}
+
+bool matchesCanonicalLayout(const char *buffer)
+    // Return 'true' if each of the 'k_BUFFER_LENGTH' characters in the
+    // specified 'buffer' is a decimal digit where 'k_CANONICAL_LAYOUT' has a
+    // 'D', and is the character of 'k_CANONICAL_LAYOUT' at the same position
+    // otherwise, and 'false' otherwise.
+{
+    BSLMF_ASSERT(32 == k_BUFFER_LENGTH);
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    const __m128i zero  = _mm_set1_epi8('0');
+    const __m128i nine  = _mm_set1_epi8(9);
+    const __m128i digit = _mm_set1_epi8('D');
+
+    int mismatch = 0;
+    for (int offset = 0; offset < k_BUFFER_LENGTH; offset += 16) {
+        const __m128i *textPtr   = reinterpret_cast<const __m128i *>(
+                                                             buffer + offset);
+        const __m128i *layoutPtr = reinterpret_cast<const __m128i *>(
+                                                 k_CANONICAL_LAYOUT + offset);
+
+        const __m128i text   = _mm_loadu_si128(textPtr);
+        const __m128i layout = _mm_loadu_si128(layoutPtr);
+
+        // Subtracting '0' maps the digits, and only the digits, to [0 .. 9]
+        // as unsigned bytes.
+
+        const __m128i value      = _mm_sub_epi8(text, zero);
+        const __m128i isDigit    = _mm_cmpeq_epi8(_mm_max_epu8(value, nine),
+                                                  nine);
+        const __m128i isEqual    = _mm_cmpeq_epi8(text, layout);
+        const __m128i wantsDigit = _mm_cmpeq_epi8(layout, digit);
+
+        const __m128i isValid    = _mm_or_si128(
+                                    _mm_and_si128(wantsDigit, isDigit),
+                                    _mm_andnot_si128(wantsDigit, isEqual));
+
+        mismatch |= 0xFFFF ^ _mm_movemask_epi8(isValid);
+    }
+    return 0 == mismatch;
+#else
+    bool isValid = true;
+    for (int i = 0; i < k_BUFFER_LENGTH; ++i) {
+        const char expected = k_CANONICAL_LAYOUT[i];
+        isValid &= 'D' == expected
+                 ? static_cast<unsigned char>(buffer[i] - '0') <= 9
+                 : expected == buffer[i];
+    }
+    return isValid;
+#endif
+}
+
+int parseCanonicalDatetimeTz(Datetime   *localDatetime,
+                             int        *tzOffset,
+                             const char *string,
+                             int         length)
+    // Load, into the specified 'localDatetime' and 'tzOffset', the local
+    // datetime and timezone offset (in minutes) represented by the specified
+    // 'string' having the specified 'length' if 'string' has the layout
+    // described above, does not have a leap second, and represents a valid
+    // datetime.  Return 0 on success, and a non-zero value (with no effect)
+    // otherwise.  Note that a non-zero result leaves the validity of 'string'
+    // to be decided by the general parser.
+{
+    BSLS_ASSERT(localDatetime);
+    BSLS_ASSERT(tzOffset);
+    BSLS_ASSERT(string);
+
+    if (length < k_FRACTION_OFFSET || length > k_CANONICAL_LENGTH) {
+        return -1;                                                    // RETURN
+    }
+
+    const char *end        = string + length;
+    int         zoneLength = 0;
+
+    if ('Z' == end[-1]) {
+        zoneLength = 1;
+    }
+    else if (length >= k_FRACTION_OFFSET + k_ZONE_LENGTH
+          && ('+' == end[-k_ZONE_LENGTH] || '-' == end[-k_ZONE_LENGTH])) {
+        zoneLength = k_ZONE_LENGTH;
+    }
+    else if (length >= k_FRACTION_OFFSET + 3
+          && ('+' == end[-3] || '-' == end[-3])) {
+        zoneLength = 3;
+    }
+
+    const int fractionLength = length - k_FRACTION_OFFSET - zoneLength;
+                                          // including the leading '.', if any
+
+    if (fractionLength < 0
+     || 1 == fractionLength
+     || fractionLength > k_ZONE_OFFSET - k_FRACTION_OFFSET) {
+        return -1;                                                    // RETURN
+    }
+
+    char buffer[k_BUFFER_LENGTH];
+
+    bsl::memcpy(buffer, string, k_FRACTION_OFFSET + fractionLength);
+    if (0 == fractionLength) {
+        buffer[k_FRACTION_OFFSET] = '.';
+        bsl::memset(buffer + k_FRACTION_OFFSET + 1,
+                    '0',
+                    k_ZONE_OFFSET - k_FRACTION_OFFSET - 1);
+    }
+    else {
+        bsl::memset(buffer + k_FRACTION_OFFSET + fractionLength,
+                    '0',
+                    k_ZONE_OFFSET - k_FRACTION_OFFSET - fractionLength);
+    }
+
+    bsl::memcpy(buffer + k_ZONE_OFFSET, "+00:00", k_ZONE_LENGTH);
+    bsl::memset(buffer + k_CANONICAL_LENGTH,
+                0,
+                k_BUFFER_LENGTH - k_CANONICAL_LENGTH);
+
+    bool isNegativeOffset = false;
+    if (3 <= zoneLength) {
+        bsl::memcpy(buffer + k_ZONE_OFFSET, end - zoneLength, zoneLength);
+        isNegativeOffset      = '-' == buffer[k_ZONE_OFFSET];
+        buffer[k_ZONE_OFFSET] = '+';
+    }
+
+    if (!matchesCanonicalLayout(buffer)) {
+        return -1;                                                    // RETURN
+    }
+
+    const int year        = twoDigitsToInt(buffer)     * 100
+                          + twoDigitsToInt(buffer + 2);
+    const int month       = twoDigitsToInt(buffer + 4);
+    const int day         = twoDigitsToInt(buffer + 6);
+    const int hour        = twoDigitsToInt(buffer + 9);
+    const int minute      = twoDigitsToInt(buffer + 12);
+    const int second      = twoDigitsToInt(buffer + 15);
+    const int microsecond = twoDigitsToInt(buffer + 18) * 10000
+                          + twoDigitsToInt(buffer + 20) * 100
+                          + twoDigitsToInt(buffer + 22);
+    const int offsetHour   = twoDigitsToInt(buffer + 25);
+    const int offsetMinute = twoDigitsToInt(buffer + 28);
+
+    if (hour >= 24 || second >= 60 || offsetHour >= 24 || offsetMinute > 59) {
+        return -1;                                                    // RETURN
+    }
+
+    if (0 != localDatetime->setDatetimeIfValid(year,
+                                               month,
+                                               day,
+                                               hour,
+                                               minute,
+                                               second,
+                                               microsecond / 1000,
+                                               microsecond % 1000)) {
+        return -1;                                                    // RETURN
+    }
+
+    const int offset = offsetHour * 60 + offsetMinute;
+
+    *tzOffset = isNegativeOffset ? -offset : offset;
+
     return 0;
 }
 
@@ -1478,6 +1677,22 @@ int FixUtil::parse(DatetimeTz *result, const char *string, int length)
     //
     // The fractional second and timezone offset are independently optional.
 
+    // Take the fast path for strings having the canonical layout.
+
+    {
+        Datetime localDatetime;
+        int      tzOffset;
+
+        if (0 == u::parseCanonicalDatetimeTz(&localDatetime,
+                                             &tzOffset,
+                                             string,
+                                             length)) {
+            result->setDatetimeTz(localDatetime, tzOffset);
+
+            return 0;                                                 // RETURN
+        }
+    }
+
     enum { k_MINIMUM_LENGTH = sizeof "YYYYMMDD-hh:mm" - 1 };
 
     if (length < k_MINIMUM_LENGTH) {
@@ -1511,6 +1726,44 @@ int FixUtil::parse(DatetimeTz *result, const char *string, int length)
     return 0;
 }
 
+int FixUtil::parseAll(Datetime               *results,
+                      const bsl::string_view *strings,
+                      int                     numStrings)
+{
+    BSLS_ASSERT(0 <= numStrings);
+    BSLS_ASSERT(results || 0 == numStrings);
+    BSLS_ASSERT(strings || 0 == numStrings);
+
+    int numFailures = 0;
+
+    for (int i = 0; i < numStrings; ++i) {
+        if (0 != parse(results + i, strings[i])) {
+            ++numFailures;
+        }
+    }
+
+    return numFailures;
+}
+
+int FixUtil::parseAll(DatetimeTz             *results,
+                      const bsl::string_view *strings,
+                      int                     numStrings)
+{
+    BSLS_ASSERT(0 <= numStrings);
+    BSLS_ASSERT(results || 0 == numStrings);
+    BSLS_ASSERT(strings || 0 == numStrings);
+
+    int numFailures = 0;
+
+    for (int i = 0; i < numStrings; ++i) {
+        if (0 != parse(results + i, strings[i])) {
+            ++numFailures;
+        }
+    }
+
+    return numFailures;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -139,6 +139,20 @@ BSLS_IDENT("$Id: $")
 // specified in all types, which is in contradiction to some of the types in
 // the referenced FIX protocol specification.
 //
+///Parsing Many Datetimes
+/// - - - - - - - - - - -
+// The 'Datetime' and 'DatetimeTz' parse functions first try to match the
+// string against the layout of nearly all FIX timestamps seen in practice:
+//..
+//  YYYYMMDD-hh:mm:ss{.s{s{s{s{s{s}}}}}}{(+|-)hh{:mm}|Z}
+//..
+// A string having that layout is validated as a whole (16 characters at a
+// time using SIMD instructions where available) and its fields are read at
+// fixed positions.  Other strings (e.g., those omitting the seconds or having
+// more than six fractional digits) fall back to the general parser, which
+// produces the same result that the fast path would.  The 'parseAll'
+// functions parse an array of datetime strings in one call.
+//
 ///Timezone Offsets
 /// - - - - - - - -
 // The timezone offset is optional, and can be present when parsing for *any*
@@ -959,6 +973,23 @@ struct FixUtil {
         // attribute is taken to be 59, then an additional second is added to
         // 'result' at the end.  The behavior is undefined unless
         // 'string.data()' is non-null.
+
+    static int parseAll(Datetime               *results,
+                        const bsl::string_view *strings,
+                        int                     numStrings);
+    static int parseAll(DatetimeTz             *results,
+                        const bsl::string_view *strings,
+                        int                     numStrings);
+        // Parse each of the specified 'numStrings' elements of the specified
+        // 'strings' array as a FIX datetime, as described for the
+        // corresponding 'parse' function, and load the value into the
+        // corresponding element of the specified 'results' array.  Return the
+        // number of elements of 'strings' that could not be parsed; the
+        // elements of 'results' corresponding to those strings are unchanged.
+        // The behavior is undefined unless '0 <= numStrings', each of
+        // 'results' and 'strings' refers to an array of at least 'numStrings'
+        // elements, and 'data()' is non-null for each of those elements of
+        // 'strings'.
 };
 
 // ============================================================================
@@ -12,10 +12,16 @@ BSLS_IDENT_RCSID(bdlt_iso8601util_cpp,"$Id$ $CSID$")
 #include <bdlt_time.h>
 #include <bdlt_timetz.h>
 
+#include <bsls_platform.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_cctype.h>
 #include <bsl_cstring.h>
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
 namespace {
 namespace u {
 
@@ -603,6 +609,194 @@ int parseZoneDesignator(const char **nextPos,
 
     *nextPos = p;
 
+    return 0;
+}
+
+                        // ---------------------------
+                        // Canonical DatetimeTz Layout
+                        // ---------------------------
+
+// Most ISO 8601 datetime strings exchanged between systems have the fixed
+// layout "YYYY-MM-DDThh:mm:ss{.s{s{s{s{s{s}}}}}}{(+|-)hh:mm|Z}".  A string
+// having that layout is copied into a 32-character buffer in which the
+// optional parts are expanded to their full width (i.e., the canonical layout
+// "YYYY-MM-DDThh:mm:ss.ssssss+hh:mm"), validated in one pass over the buffer,
+// and converted by reading its digits at fixed positions.  Strings having any
+// other layout, and strings requiring the special handling of leap seconds or
+// 24:00, are left to the general parser.
+
+const char k_CANONICAL_LAYOUT[] = "DDDD-DD-DDTDD:DD:DD.DDDDDD+DD:DD";
+    // 'D' denotes a decimal digit; every other character must match exactly.
+
+enum {
+    k_CANONICAL_LENGTH = sizeof k_CANONICAL_LAYOUT - 1,
+    k_FRACTION_OFFSET  = sizeof "YYYY-MM-DDThh:mm:ss" - 1,
+    k_ZONE_OFFSET      = sizeof "YYYY-MM-DDThh:mm:ss.ssssss" - 1,
+    k_ZONE_LENGTH      = sizeof "+hh:mm" - 1
+};
+
+inline
+int twoDigitsToInt(const char *digits)
+    // Return the value of the two decimal digits at the specified 'digits'.
+{
+    return (digits[0] - '0') * 10 + (digits[1] - '0');
+}
+
+bool matchesCanonicalLayout(const char *buffer)
+    // Return 'true' if every character in the specified 'buffer' of
+    // 'k_CANONICAL_LENGTH' characters is a decimal digit where the
+    // corresponding character of 'k_CANONICAL_LAYOUT' is 'D' and is equal to
+    // the corresponding character of 'k_CANONICAL_LAYOUT' otherwise, and
+    // 'false' otherwise.
+{
+    BSLMF_ASSERT(32 == k_CANONICAL_LENGTH);
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    const __m128i zero  = _mm_set1_epi8('0');
+    const __m128i nine  = _mm_set1_epi8(9);
+    const __m128i digit = _mm_set1_epi8('D');
+
+    int mismatch = 0;
+    for (int offset = 0; offset < k_CANONICAL_LENGTH; offset += 16) {
+        const __m128i *textPtr   = reinterpret_cast<const __m128i *>(
+                                                             buffer + offset);
+        const __m128i *layoutPtr = reinterpret_cast<const __m128i *>(
+                                                 k_CANONICAL_LAYOUT + offset);
+
+        const __m128i text   = _mm_loadu_si128(textPtr);
+        const __m128i layout = _mm_loadu_si128(layoutPtr);
+
+        // A character is a digit if subtracting '0' (modulo 256) yields a
+        // value no greater than 9.
+
+        const __m128i value      = _mm_sub_epi8(text, zero);
+        const __m128i isDigit    = _mm_cmpeq_epi8(_mm_max_epu8(value, nine),
+                                                  nine);
+        const __m128i isEqual    = _mm_cmpeq_epi8(text, layout);
+        const __m128i wantsDigit = _mm_cmpeq_epi8(layout, digit);
+
+        const __m128i isValid    = _mm_or_si128(
+                                    _mm_and_si128(wantsDigit, isDigit),
+                                    _mm_andnot_si128(wantsDigit, isEqual));
+
+        mismatch |= 0xFFFF ^ _mm_movemask_epi8(isValid);
+    }
+    return 0 == mismatch;
+#else
+    bool isValid = true;
+    for (int i = 0; i < k_CANONICAL_LENGTH; ++i) {
+        const char expected = k_CANONICAL_LAYOUT[i];
+        isValid &= 'D' == expected
+                 ? static_cast<unsigned char>(buffer[i] - '0') <= 9
+                 : expected == buffer[i];
+    }
+    return isValid;
+#endif
+}
+
+int parseCanonicalDatetimeTz(Datetime   *localDatetime,
+                             int        *tzOffset,
+                             const char *string,
+                             int         length)
+    // Load, into the specified 'localDatetime' and 'tzOffset', the local
+    // datetime and offset from UTC (in minutes) represented by the specified
+    // 'string' having the specified 'length' if 'string' has the canonical
+    // layout described above, has an hour less than 24 and a second less than
+    // 60, and represents a valid datetime.  Return 0 on success, and a
+    // non-zero value (with no effect) otherwise.  Note that a non-zero result
+    // does not imply that 'string' is invalid, only that it must be parsed by
+    // the general parser.
+{
+    BSLS_ASSERT(localDatetime);
+    BSLS_ASSERT(tzOffset);
+    BSLS_ASSERT(string);
+
+    if (length < k_FRACTION_OFFSET || length > k_CANONICAL_LENGTH) {
+        return -1;                                                    // RETURN
+    }
+
+    const char *zone       = string + length;
+    int         zoneLength = 0;
+
+    if ('Z' == zone[-1]) {
+        zoneLength = 1;
+    }
+    else if (length >= k_FRACTION_OFFSET + k_ZONE_LENGTH
+          && ('+' == zone[-k_ZONE_LENGTH] || '-' == zone[-k_ZONE_LENGTH])) {
+        zoneLength = k_ZONE_LENGTH;
+    }
+    zone -= zoneLength;
+
+    const int fractionLength = length - k_FRACTION_OFFSET - zoneLength;
+                                          // including the leading '.', if any
+
+    if (fractionLength < 0
+     || 1 == fractionLength
+     || fractionLength > k_ZONE_OFFSET - k_FRACTION_OFFSET) {
+        return -1;                                                    // RETURN
+    }
+
+    char buffer[k_CANONICAL_LENGTH];
+
+    bsl::memcpy(buffer, string, k_FRACTION_OFFSET + fractionLength);
+    if (0 == fractionLength) {
+        buffer[k_FRACTION_OFFSET] = '.';
+        bsl::memset(buffer + k_FRACTION_OFFSET + 1,
+                    '0',
+                    k_ZONE_OFFSET - k_FRACTION_OFFSET - 1);
+    }
+    else {
+        bsl::memset(buffer + k_FRACTION_OFFSET + fractionLength,
+                    '0',
+                    k_ZONE_OFFSET - k_FRACTION_OFFSET - fractionLength);
+    }
+
+    bool isNegativeOffset = false;
+    if (k_ZONE_LENGTH == zoneLength) {
+        bsl::memcpy(buffer + k_ZONE_OFFSET, zone, k_ZONE_LENGTH);
+        isNegativeOffset      = '-' == buffer[k_ZONE_OFFSET];
+        buffer[k_ZONE_OFFSET] = '+';
+    }
+    else {
+        bsl::memcpy(buffer + k_ZONE_OFFSET, "+00:00", k_ZONE_LENGTH);
+    }
+
+    if (!matchesCanonicalLayout(buffer)) {
+        return -1;                                                    // RETURN
+    }
+
+    const int year        = twoDigitsToInt(buffer)     * 100
+                          + twoDigitsToInt(buffer + 2);
+    const int month       = twoDigitsToInt(buffer + 5);
+    const int day         = twoDigitsToInt(buffer + 8);
+    const int hour        = twoDigitsToInt(buffer + 11);
+    const int minute      = twoDigitsToInt(buffer + 14);
+    const int second      = twoDigitsToInt(buffer + 17);
+    const int microsecond = twoDigitsToInt(buffer + 20) * 10000
+                          + twoDigitsToInt(buffer + 22) * 100
+                          + twoDigitsToInt(buffer + 24);
+    const int offsetHour   = twoDigitsToInt(buffer + 27);
+    const int offsetMinute = twoDigitsToInt(buffer + 30);
+
+    if (hour >= 24 || second >= 60 || offsetHour >= 24 || offsetMinute > 59) {
+        return -1;                                                    // RETURN
+    }
+
+    if (0 != localDatetime->setDatetimeIfValid(year,
+                                               month,
+                                               day,
+                                               hour,
+                                               minute,
+                                               second,
+                                               microsecond / 1000,
+                                               microsecond % 1000)) {
+        return -1;                                                    // RETURN
+    }
+
+    const int offset = offsetHour * 60 + offsetMinute;
+
+    *tzOffset = isNegativeOffset ? -offset : offset;
+
     return 0;
 }
 
@@ -1956,6 +2150,22 @@ int Iso8601Util::parse(DatetimeTz *result, const char *string, int length)
     //
     // The fractional second and zone designator are independently optional.
 
+    // 0. Take the fast path for strings having the canonical layout.
+
+    {
+        Datetime localDatetime;
+        int      tzOffset;
+
+        if (0 == u::parseCanonicalDatetimeTz(&localDatetime,
+                                             &tzOffset,
+                                             string,
+                                             length)) {
+            result->setDatetimeTz(localDatetime, tzOffset);
+
+            return 0;                                                 // RETURN
+        }
+    }
+
     enum { k_MINIMUM_LENGTH = sizeof "YYYY-MM-DDThh:mm:ss" - 1 };
 
     if (length < k_MINIMUM_LENGTH) {
@@ -2082,6 +2292,44 @@ int Iso8601Util::parse(DatetimeTz *result, const char *string, int length)
     return 0;
 }
 
+int Iso8601Util::parseAll(Datetime               *results,
+                          const bsl::string_view *strings,
+                          int                     numStrings)
+{
+    BSLS_ASSERT(0 <= numStrings);
+    BSLS_ASSERT(results || 0 == numStrings);
+    BSLS_ASSERT(strings || 0 == numStrings);
+
+    int numFailures = 0;
+
+    for (int i = 0; i < numStrings; ++i) {
+        if (0 != parse(results + i, strings[i])) {
+            ++numFailures;
+        }
+    }
+
+    return numFailures;
+}
+
+int Iso8601Util::parseAll(DatetimeTz             *results,
+                          const bsl::string_view *strings,
+                          int                     numStrings)
+{
+    BSLS_ASSERT(0 <= numStrings);
+    BSLS_ASSERT(results || 0 == numStrings);
+    BSLS_ASSERT(strings || 0 == numStrings);
+
+    int numFailures = 0;
+
+    for (int i = 0; i < numStrings; ++i) {
+        if (0 != parse(results + i, strings[i])) {
+            ++numFailures;
+        }
+    }
+
+    return numFailures;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
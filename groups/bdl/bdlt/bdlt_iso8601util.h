@@ -145,6 +145,25 @@ BSLS_IDENT("$Id: $")
 // and treat '+00:00', '+0000', 'Z', and 'z' as equivalent zone designators
 // (all denoting UTC).
 //
+///Parsing Many Datetimes
+/// - - - - - - - - - - -
+// Datetime strings having the layout that is most common in data exchanged
+// between systems, namely:
+//..
+//  YYYY-MM-DDThh:mm:ss{.s{s{s{s{s{s}}}}}}{(+|-)hh:mm|Z}
+//..
+// (i.e., an uppercase 'T', '.' as the decimal sign, at most six digits in the
+// fractional second, and a zone designator, if any, that is either 'Z' or
+// includes the ':'), are recognized by the 'Datetime' and 'DatetimeTz' parse
+// functions ahead of the general parser, and are validated and converted
+// without examining their characters one at a time (using SIMD instructions
+// where available).  All other strings are handled by the general parser;
+// the results are the same either way.
+//
+// The 'parseAll' functions parse an array of datetime strings in one call,
+// which is convenient when converting the timestamps of many records (e.g.,
+// when replaying recorded market data).
+//
 ///Zone Designators
 /// - - - - - - - -
 // The zone designator is optional, and can be present when parsing for *any*
@@ -1197,6 +1216,23 @@ struct Iso8601Util {
         // zone designator must be absent or indicate UTC.  The behavior is
         // undefined unless 'string.data()' is non-null.
 
+    static int parseAll(Datetime               *results,
+                        const bsl::string_view *strings,
+                        int                     numStrings);
+    static int parseAll(DatetimeTz             *results,
+                        const bsl::string_view *strings,
+                        int                     numStrings);
+        // Parse each of the specified 'numStrings' elements of the specified
+        // 'strings' array as an ISO 8601 datetime, as described for the
+        // corresponding 'parse' function, and load the value into the
+        // corresponding element of the specified 'results' array.  Return the
+        // number of elements of 'strings' that could not be parsed; the
+        // elements of 'results' corresponding to those strings are unchanged.
+        // The behavior is undefined unless '0 <= numStrings', each of
+        // 'results' and 'strings' refers to an array of at least 'numStrings'
+        // elements, and 'data()' is non-null for each of those elements of
+        // 'strings'.
+
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
     static int generate(char              *buffer,
                         const Date&        object,
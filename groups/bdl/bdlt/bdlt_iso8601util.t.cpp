@@ -12,13 +12,16 @@
 
 #include <bsls_asserttest.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_cctype.h>      // 'isdigit'
+#include <bsl_cstdio.h>       // 'snprintf'
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #undef SEC
 
@@ -116,6 +119,8 @@ using namespace bsl;
 // [ 9] int parse(DateTz *result, const StringRef& string);
 // [10] int parse(TimeTz *result, const StringRef& string);
 // [11] int parse(DatetimeTz *result, const StringRef& string);
+// [12] int parseAll(Datetime *, const StringRef *, int);
+// [12] int parseAll(DatetimeTz *, const StringRef *, int);
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
 // [ 2] int generate(char *, const Date&, int);
 // [ 3] int generate(char *, const Time&, int);
@@ -134,7 +139,9 @@ using namespace bsl;
 // [ 7] int generateRaw(char *, const DatetimeTz&, bool useZ);
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
 //-----------------------------------------------------------------------------
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
+// [12] CONCERN: canonical datetimes parse as the general parser would
+// [-1] PERFORMANCE: PARSING DATETIMES
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -772,6 +779,104 @@ bool containsOnlyDigits(const char *string)
     return true;
 }
 
+static
+int nextRandom(unsigned int *seed, int limit)
+    // Advance the specified '*seed' and return a pseudo-random value in the
+    // range '[0 .. limit - 1]'.
+{
+    *seed = *seed * 1103515245 + 12345;
+    return static_cast<int>((*seed >> 8) % limit);
+}
+
+static
+bsl::string randomCanonicalDatetime(unsigned int *seed,
+                                    bool          validFieldsOnly)
+    // Return a pseudo-random datetime string, generated from the specified
+    // '*seed', having the layout
+    // "YYYY-MM-DDThh:mm:ss{.s{s{s{s{s{s}}}}}}{(+|-)hh:mm|Z}".  If the
+    // specified 'validFieldsOnly' is 'true', each field is in the range of its
+    // valid values and the date follows the September 1752 gap of the Unix
+    // calendar; otherwise, fields are occasionally out of range (e.g., hour
+    // 24, second 60, or day 31 in a 30-day month).
+{
+    const bool V = validFieldsOnly;
+
+    const int year   = V ? 1753 + nextRandom(seed, 9999 - 1752)
+                         :    1 + nextRandom(seed, 9999);
+    const int month  = V ? 1 + nextRandom(seed, 12) : nextRandom(seed, 14);
+    const int day    = V ? 1 + nextRandom(seed, 28) : nextRandom(seed, 33);
+    const int hour   = nextRandom(seed, V ? 24 : 25);
+    const int minute = nextRandom(seed, V ? 60 : 61);
+    const int second = nextRandom(seed, V ? 60 : 61);
+
+    char buffer[64];
+    int  length = snprintf(buffer,
+                           sizeof buffer,
+                           "%04d-%02d-%02dT%02d:%02d:%02d",
+                           year,
+                           month,
+                           day,
+                           hour,
+                           minute,
+                           second);
+
+    const int numDigits = V ? 6 : nextRandom(seed, 7);
+    if (0 < numDigits) {
+        buffer[length++] = '.';
+        for (int i = 0; i < numDigits; ++i) {
+            buffer[length++] = static_cast<char>('0' + nextRandom(seed, 10));
+        }
+    }
+
+    switch (nextRandom(seed, 4)) {
+      case 0: {
+      } break;
+      case 1: {
+        buffer[length++] = 'Z';
+      } break;
+      default: {
+        const int offsetHour   = nextRandom(seed, V ? 24 : 25);
+        const int offsetMinute = nextRandom(seed, V ? 60 : 61);
+        length += snprintf(buffer + length,
+                           sizeof buffer - length,
+                           "%c%02d:%02d",
+                           nextRandom(seed, 2) ? '+' : '-',
+                           offsetHour,
+                           offsetMinute);
+      } break;
+    }
+
+    return bsl::string(buffer, length);
+}
+
+static
+void verifySameParse(int                line,
+                     const bsl::string& string,
+                     const bsl::string& reference)
+    // Verify that parsing the specified 'string' as a 'Datetime' and as a
+    // 'DatetimeTz' has the same outcome (status and value) as parsing the
+    // specified 'reference', reporting failures with the specified 'line'.
+{
+    const bdlt::Datetime   INITIAL(1234, 5, 6, 7, 8, 9, 10, 11);
+    const bdlt::DatetimeTz INITIAL_TZ(INITIAL, -123);
+
+    bdlt::Datetime   mX(INITIAL);      const bdlt::Datetime&   X  = mX;
+    bdlt::Datetime   mY(INITIAL);      const bdlt::Datetime&   Y  = mY;
+    bdlt::DatetimeTz mXZ(INITIAL_TZ);  const bdlt::DatetimeTz& XZ = mXZ;
+    bdlt::DatetimeTz mYZ(INITIAL_TZ);  const bdlt::DatetimeTz& YZ = mYZ;
+
+    const int RC     = Util::parse(&mX,  string);
+    const int EXP_RC = Util::parse(&mY,  reference);
+    ASSERTV(line, string, reference, RC, EXP_RC, (0 == RC) == (0 == EXP_RC));
+    ASSERTV(line, string, reference, X, Y, X == Y);
+
+    const int RC_TZ     = Util::parse(&mXZ, string);
+    const int EXP_RC_TZ = Util::parse(&mYZ, reference);
+    ASSERTV(line, string, reference, RC_TZ, EXP_RC_TZ,
+            (0 == RC_TZ) == (0 == EXP_RC_TZ));
+    ASSERTV(line, string, reference, XZ, YZ, XZ == YZ);
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -793,7 +898,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -990,6 +1095,284 @@ if (veryVerbose)
 //..
 
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // CONCERN: CANONICAL DATETIMES PARSE AS THE GENERAL PARSER WOULD
+        //   Datetime strings having the canonical layout are parsed by a
+        //   separate fast path.  Ensure that path is indistinguishable from
+        //   the general parser, and test the 'parseAll' functions.
+        //
+        // Concerns:
+        //: 1 A string having the canonical layout
+        //:   "YYYY-MM-DDThh:mm:ss{.s{s{s{s{s{s}}}}}}{(+|-)hh:mm|Z}" is parsed
+        //:   to the expected 'Datetime' and 'DatetimeTz' values.
+        //:
+        //: 2 Whether or not its field values are valid, a string having the
+        //:   canonical layout is parsed with the same status and value as the
+        //:   equivalent string using 't' in place of 'T' (which is always
+        //:   handled by the general parser).
+        //:
+        //: 3 A string that differs from a canonical string in any one
+        //:   character is parsed as the general parser would parse it.
+        //:
+        //: 4 'parseAll' loads each element as 'parse' would, leaves the
+        //:   elements corresponding to invalid strings unchanged, and returns
+        //:   the number of invalid strings.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, parse a set of canonical
+        //:   strings, including boundary values, and verify the results.
+        //:   (C-1)
+        //:
+        //: 2 Generate pseudo-random canonical strings, both with valid and
+        //:   with occasionally out-of-range fields, and verify each parses as
+        //:   its 't' counterpart.  (C-2)
+        //:
+        //: 3 For a subset of those strings, replace each character (except
+        //:   the 'T') in turn by each of a set of characters, make the same
+        //:   replacement in the 't' counterpart, and verify that the two
+        //:   strings parse identically.  (C-3)
+        //:
+        //: 4 Call 'parseAll' on an array mixing canonical, non-canonical, and
+        //:   invalid strings, and compare against 'parse'.  (C-4)
+        //:
+        //: 5 Verify defensive checks are triggered for invalid values.  (C-5)
+        //
+        // Testing:
+        //   int parseAll(Datetime *, const StringRef *, int);
+        //   int parseAll(DatetimeTz *, const StringRef *, int);
+        //   CONCERN: canonical datetimes parse as the general parser would
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                 << endl
+                 << "CONCERN: CANONICAL DATETIMES PARSE AS THE GENERAL PARSER"
+                 << endl
+                 << "========================================================"
+                 << endl;
+
+        if (verbose) cout << "\nTesting canonical strings." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_input;
+                int         d_year;
+                int         d_month;
+                int         d_day;
+                int         d_hour;
+                int         d_minute;
+                int         d_second;
+                int         d_millisecond;
+                int         d_microsecond;
+                int         d_offset;
+            } DATA[] = {
+                //LINE INPUT
+                //---- -----
+                //     YEAR MON DAY  HR MIN SEC  MS  US  OFFSET
+                //     ---- --- ---  -- --- ---  --  --  ------
+                { L_,  "2005-01-31T08:59:59",
+                       2005,  1, 31,  8, 59, 59,   0,   0,     0 },
+                { L_,  "2005-01-31T08:59:59Z",
+                       2005,  1, 31,  8, 59, 59,   0,   0,     0 },
+                { L_,  "2005-01-31T08:59:59.1",
+                       2005,  1, 31,  8, 59, 59, 100,   0,     0 },
+                { L_,  "2005-01-31T08:59:59.12345",
+                       2005,  1, 31,  8, 59, 59, 123, 450,     0 },
+                { L_,  "2005-01-31T08:59:59.123456",
+                       2005,  1, 31,  8, 59, 59, 123, 456,     0 },
+                { L_,  "2005-01-31T08:59:59.123Z",
+                       2005,  1, 31,  8, 59, 59, 123,   0,     0 },
+                { L_,  "2005-01-31T08:59:59+04:30",
+                       2005,  1, 31,  8, 59, 59,   0,   0,   270 },
+                { L_,  "2005-01-31T08:59:59.999999-04:00",
+                       2005,  1, 31,  8, 59, 59, 999, 999,  -240 },
+                { L_,  "2005-01-31T08:59:59-00:00",
+                       2005,  1, 31,  8, 59, 59,   0,   0,     0 },
+                { L_,  "0001-01-01T00:00:00.000000+23:59",
+                          1,  1,  1,  0,  0,  0,   0,   0,  1439 },
+                { L_,  "9999-12-31T23:59:59.999999-23:59",
+                       9999, 12, 31, 23, 59, 59, 999, 999, -1439 },
+                { L_,  "2004-02-29T12:00:00",
+                       2004,  2, 29, 12,  0,  0,   0,   0,     0 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE  = DATA[ti].d_line;
+                const char *INPUT = DATA[ti].d_input;
+
+                const bdlt::Datetime   LOCAL(DATA[ti].d_year,
+                                             DATA[ti].d_month,
+                                             DATA[ti].d_day,
+                                             DATA[ti].d_hour,
+                                             DATA[ti].d_minute,
+                                             DATA[ti].d_second,
+                                             DATA[ti].d_millisecond,
+                                             DATA[ti].d_microsecond);
+                const bdlt::DatetimeTz EXPECTED(LOCAL, DATA[ti].d_offset);
+
+                if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+                bdlt::DatetimeTz mX;  const bdlt::DatetimeTz& X = mX;
+
+                ASSERTV(LINE, INPUT, 0 == Util::parse(&mX, INPUT));
+                ASSERTV(LINE, INPUT, EXPECTED, X, EXPECTED == X);
+
+                bsl::string general(INPUT);
+                general[10] = 't';
+
+                verifySameParse(LINE, INPUT, general);
+            }
+        }
+
+        if (verbose) cout << "\nTesting pseudo-random canonical strings."
+                          << endl;
+
+        static const char REPLACEMENTS[] = "0159-:.,+tTzZ /";
+        const int         NUM_REPLACEMENTS =
+                              static_cast<int>(sizeof REPLACEMENTS - 1) + 2;
+                                             // also '\0' and a non-ASCII value
+
+        unsigned int seed = 8601;
+
+        for (int ti = 0; ti < 20000; ++ti) {
+            const bool        VALID     = 0 == ti % 2;
+            const bsl::string CANONICAL = randomCanonicalDatetime(&seed,
+                                                                  VALID);
+
+            bsl::string general(CANONICAL);
+            general[10] = 't';
+
+            if (veryVeryVerbose) { T_ P_(ti) P(CANONICAL) }
+
+            verifySameParse(L_, CANONICAL, general);
+
+            if (0 != ti % 10) {
+                continue;
+            }
+
+            for (bsl::size_t i = 0; i < CANONICAL.length(); ++i) {
+                if (10 == i) {
+                    continue;
+                }
+
+                for (int ri = 0; ri < NUM_REPLACEMENTS; ++ri) {
+                    const char REPLACEMENT =
+                                 ri < NUM_REPLACEMENTS - 2 ? REPLACEMENTS[ri]
+                               : ri < NUM_REPLACEMENTS - 1 ? '\0'
+                               :                             '\xb0';
+
+                    bsl::string mutatedCanonical(CANONICAL);
+                    bsl::string mutatedGeneral(general);
+
+                    mutatedCanonical[i] = REPLACEMENT;
+                    mutatedGeneral[i]   = REPLACEMENT;
+
+                    verifySameParse(L_, mutatedCanonical, mutatedGeneral);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'parseAll'." << endl;
+        {
+            static const char *INPUTS[] = {
+                "2005-01-31T08:59:59.123456-04:00",
+                "2005-01-31t08:59:59,123456-0400",
+                "2005-01-31T08:59:59.123456+24:00",       // invalid
+                "2005-01-31T24:00:00",
+                "2005-02-31T08:59:59",                    // invalid
+                "2005-01-31T08:59:60.999999Z",
+                "2005-01-31T08:59:59.1234567",
+                "",                                       // invalid
+                "9999-12-31T23:59:59.999999-01:00",       // 'Datetime' only
+            };
+            const int NUM_INPUTS = static_cast<int>(sizeof INPUTS
+                                                    / sizeof *INPUTS);
+
+            bsl::vector<StrView> strings;
+            for (int i = 0; i < NUM_INPUTS; ++i) {
+                strings.push_back(StrView(INPUTS[i]));
+            }
+
+            for (int n = 0; n <= NUM_INPUTS; ++n) {
+                const bdlt::Datetime   INITIAL(1234, 5, 6, 7, 8, 9, 10, 11);
+                const bdlt::DatetimeTz INITIAL_TZ(INITIAL, -123);
+
+                bsl::vector<bdlt::Datetime>   results(NUM_INPUTS, INITIAL);
+                bsl::vector<bdlt::DatetimeTz> resultsTz(NUM_INPUTS,
+                                                        INITIAL_TZ);
+
+                const int NUM_FAILURES    = Util::parseAll(results.data(),
+                                                           strings.data(),
+                                                           n);
+                const int NUM_FAILURES_TZ = Util::parseAll(resultsTz.data(),
+                                                           strings.data(),
+                                                           n);
+
+                int expFailures   = 0;
+                int expFailuresTz = 0;
+
+                for (int i = 0; i < NUM_INPUTS; ++i) {
+                    bdlt::Datetime   expected(INITIAL);
+                    bdlt::DatetimeTz expectedTz(INITIAL_TZ);
+
+                    if (i < n) {
+                        expFailures   += 0 != Util::parse(&expected,
+                                                          strings[i]);
+                        expFailuresTz += 0 != Util::parse(&expectedTz,
+                                                          strings[i]);
+                    }
+
+                    ASSERTV(n, i, expected, results[i],
+                            expected == results[i]);
+                    ASSERTV(n, i, expectedTz, resultsTz[i],
+                            expectedTz == resultsTz[i]);
+                }
+
+                ASSERTV(n, expFailures, NUM_FAILURES,
+                        expFailures == NUM_FAILURES);
+                ASSERTV(n, expFailuresTz, NUM_FAILURES_TZ,
+                        expFailuresTz == NUM_FAILURES_TZ);
+            }
+
+            bdlt::Datetime   result;
+            bdlt::DatetimeTz resultTz;
+
+            ASSERT(0 == Util::parseAll(&result,   strings.data(), 1));
+            ASSERT(0 == Util::parseAll(&resultTz, strings.data(), 1));
+            ASSERT(bdlt::DatetimeTz(bdlt::Datetime(2005, 1, 31,
+                                                   8, 59, 59, 123, 456),
+                                    -240) == resultTz);
+            ASSERT(resultTz.utcDatetime() == result);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlt::Datetime   result;
+            bdlt::DatetimeTz resultTz;
+            const StrView    STRING("2005-01-31T08:59:59");
+
+            ASSERT_PASS(Util::parseAll(&result,   &STRING,  1));
+            ASSERT_PASS(Util::parseAll(&resultTz, &STRING,  1));
+            ASSERT_PASS(Util::parseAll(
+                               static_cast<bdlt::Datetime *>(0), 0, 0));
+            ASSERT_PASS(Util::parseAll(
+                               static_cast<bdlt::DatetimeTz *>(0), 0, 0));
+
+            ASSERT_FAIL(Util::parseAll(&result,   &STRING, -1));
+            ASSERT_FAIL(Util::parseAll(&resultTz, &STRING, -1));
+            ASSERT_FAIL(Util::parseAll(&result,   0,        1));
+            ASSERT_FAIL(Util::parseAll(&resultTz, 0,        1));
+            ASSERT_FAIL(Util::parseAll(
+                          static_cast<bdlt::Datetime *>(0), &STRING, 1));
+            ASSERT_FAIL(Util::parseAll(
+                          static_cast<bdlt::DatetimeTz *>(0), &STRING, 1));
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // PARSE: DATETIME & DATETIMETZ
@@ -6130,6 +6513,86 @@ if (veryVerbose)
         }
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: PARSING DATETIMES
+        //   Measure the cost of parsing datetime strings having the canonical
+        //   layout, both one at a time and with 'parseAll', compared with
+        //   strings that must be handled by the general parser.
+        //
+        // Concerns:
+        //: 1 Canonical strings are parsed substantially faster than
+        //:   equivalent non-canonical strings.
+        //
+        // Plan:
+        //: 1 Generate canonical strings and their 't' counterparts, time
+        //:   parsing each set repeatedly, and report the average cost per
+        //:   string.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: PARSING DATETIMES
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: PARSING DATETIMES" << endl
+             << "==============================" << endl;
+
+        const int NUM_STRINGS    = 100000;
+        const int NUM_ITERATIONS = 10;
+
+        bsl::vector<bsl::string> canonical;
+        bsl::vector<bsl::string> general;
+        unsigned int             seed = 8601;
+
+        for (int i = 0; i < NUM_STRINGS; ++i) {
+            canonical.push_back(randomCanonicalDatetime(&seed, true));
+            general.push_back(canonical.back());
+            general.back()[10] = 't';
+        }
+
+        bsl::vector<StrView> canonicalViews(canonical.begin(),
+                                            canonical.end());
+
+        bsl::vector<bdlt::DatetimeTz> results(NUM_STRINGS);
+        int                           numFailures = 0;
+        bsls::Stopwatch               timer;
+
+        const double SCALE = 1.0e9 / NUM_ITERATIONS / NUM_STRINGS;
+
+        timer.start();
+        for (int j = 0; j < NUM_ITERATIONS; ++j) {
+            for (int i = 0; i < NUM_STRINGS; ++i) {
+                numFailures += 0 != Util::parse(&results[i], general[i]);
+            }
+        }
+        timer.stop();
+        cout << "general parser   (ns/string): "
+             << timer.elapsedTime() * SCALE << endl;
+
+        timer.reset();
+        timer.start();
+        for (int j = 0; j < NUM_ITERATIONS; ++j) {
+            for (int i = 0; i < NUM_STRINGS; ++i) {
+                numFailures += 0 != Util::parse(&results[i], canonical[i]);
+            }
+        }
+        timer.stop();
+        cout << "canonical layout (ns/string): "
+             << timer.elapsedTime() * SCALE << endl;
+
+        timer.reset();
+        timer.start();
+        for (int j = 0; j < NUM_ITERATIONS; ++j) {
+            numFailures += Util::parseAll(results.data(),
+                                          canonicalViews.data(),
+                                          NUM_STRINGS);
+        }
+        timer.stop();
+        cout << "'parseAll'       (ns/string): "
+             << timer.elapsedTime() * SCALE << endl;
+
+        ASSERTV(numFailures, 0 == numFailures);
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -5,46 +5,265 @@
 BSLS_IDENT_RCSID(bdlt_timetablecache_cpp,"$Id$ $CSID$")
 
 #include <bdlt_timetableloader.h>
-#include <bdlt_currenttime.h>
 #include <bdlt_date.h>            // for testing only
 #include <bdlt_timetable.h>
 
+#include <bdlb_cstringhash.h>
+
 #include <bslma_default.h>
+#include <bslma_rawdeleterproctor.h>
 
 #include <bslmt_lockguard.h>
 
 #include <bsls_assert.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_climits.h>      // 'INT_MAX'
+#include <bsl_cstring.h>
 
 namespace BloombergLP {
 namespace bdlt {
+namespace {
 
-                        // --------------------------
+template <class ENTRY>
+struct NameLess {
+    // This 'struct' orders an 'ENTRY', a 'bsl::pair' whose 'first' member is
+    // a 'bsl::string', against a C-style string by name.
+
+    bool operator()(const ENTRY& entry, const char *name) const
+        // Return 'true' if the name of the specified 'entry' is ordered before
+        // the specified 'name', and 'false' otherwise.
+    {
+        return bsl::strcmp(entry.first.c_str(), name) < 0;
+    }
+};
+
+}  // close unnamed namespace
+
+                     // --------------------------------
+                     // struct TimetableCache_Entry::Rep
+                     // --------------------------------
+
+struct TimetableCache_Entry::Rep {
+    // This 'struct' holds a cached timetable along with the flag recording
+    // whether it is still current, so that both are obtained by a single
+    // allocation.
+
+    // DATA
+    Timetable        d_timetable;  // cached timetable
+    bsls::AtomicBool d_retired;    // 'true' once 'd_timetable' is no longer
+                                   // in the cache
+
+    // CREATORS
+    Rep(Timetable *timetable, bslma::Allocator *basicAllocator)
+        // Create a representation holding a timetable having the value of the
+        // specified 'timetable' that is current, using the specified
+        // 'basicAllocator' to supply memory, and leave 'timetable' in a valid
+        // but unspecified state.
+    : d_timetable(basicAllocator)
+    , d_retired(false)
+    {
+        d_timetable.swap(*timetable);
+    }
+};
+
+                       // ----------------------------
+                       // struct TimetableCache::Index
+                       // ----------------------------
+
+struct TimetableCache::Index {
+    // This 'struct' holds a hash table of the timetables in a cache.  The list
+    // of each bucket is immutable once published, so that a lookup can search
+    // it without locking; a modification replaces the list of the bucket it
+    // affects.
+
+    // TYPES
+    struct Node {
+        // This 'struct' holds a timetable name, the cached timetable having
+        // that name, and the next node in the list of a bucket.
+
+        // DATA
+        bsl::string           d_name;    // timetable name
+        TimetableCache_Entry  d_entry;   // cached timetable
+        Node                 *d_next_p;  // next node in the list, or 0 if last
+
+        // CREATORS
+        Node(const char                  *name,
+             const TimetableCache_Entry&  entry,
+             Node                        *next,
+             bslma::Allocator            *basicAllocator)
+            // Create a node holding the specified 'name' and 'entry' that
+            // precedes the specified 'next' node, using the specified
+            // 'basicAllocator' to supply memory.
+        : d_name(name, basicAllocator)
+        , d_entry(entry)
+        , d_next_p(next)
+        {
+        }
+    };
+
+    typedef bsls::AtomicPointer<Node> Bucket;
+        // Head of the list of a bucket.
+
+    class ListProctor {
+        // This class destroys a list of nodes on destruction unless it has
+        // been released.
+
+        // DATA
+        Node             *d_list_p;       // list being built (owned)
+        bslma::Allocator *d_allocator_p;  // allocator of the nodes (held)
+
+      public:
+        // CREATORS
+        explicit ListProctor(bslma::Allocator *allocator)
+            // Create a proctor of an empty list of nodes allocated using the
+            // specified 'allocator'.
+        : d_list_p(0)
+        , d_allocator_p(allocator)
+        {
+        }
+
+        ~ListProctor()
+            // Destroy the list managed by this proctor.
+        {
+            Index::deleteList(d_list_p, d_allocator_p);
+        }
+
+        // MANIPULATORS
+        void push(const char *name, const TimetableCache_Entry& entry)
+            // Prepend to the managed list a node holding the specified 'name'
+            // and 'entry'.
+        {
+            d_list_p = new (*d_allocator_p) Node(name,
+                                                 entry,
+                                                 d_list_p,
+                                                 d_allocator_p);
+        }
+
+        Node *release()
+            // Return the managed list, and release it from management.
+        {
+            Node *list = d_list_p;
+            d_list_p   = 0;
+            return list;
+        }
+    };
+
+    // CLASS METHODS
+    static void deleteList(Node *list, bslma::Allocator *allocator)
+        // Destroy the specified 'list' of nodes allocated using the specified
+        // 'allocator'.
+    {
+        while (list) {
+            Node *next = list->d_next_p;
+            allocator->deleteObject(list);
+            list = next;
+        }
+    }
+
+    // DATA
+    Bucket           *d_buckets_p;    // list of each bucket (owned)
+    bsl::size_t       d_numBuckets;   // number of buckets, a power of 2
+    bsl::size_t       d_numEntries;   // number of timetables, used only under
+                                      // the lock of the cache
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    Index(const Index&);
+    Index& operator=(const Index&);
+
+  public:
+    // CREATORS
+    Index(bsl::size_t numBuckets, bslma::Allocator *basicAllocator)
+        // Create an empty index having the specified 'numBuckets' buckets,
+        // using the specified 'basicAllocator' to supply memory.  The
+        // behavior is undefined unless 'numBuckets' is a power of 2.
+    : d_buckets_p(static_cast<Bucket *>(
+                       basicAllocator->allocate(numBuckets * sizeof(Bucket))))
+    , d_numBuckets(numBuckets)
+    , d_numEntries(0)
+    , d_allocator_p(basicAllocator)
+    {
+        BSLS_ASSERT(0 == (numBuckets & (numBuckets - 1)));
+
+        for (bsl::size_t i = 0; i < numBuckets; ++i) {
+            new (d_buckets_p + i) Bucket(0);
+        }
+    }
+
+    ~Index()
+        // Destroy this index and the nodes it holds.
+    {
+        for (bsl::size_t i = 0; i < d_numBuckets; ++i) {
+            deleteList(d_buckets_p[i].loadRelaxed(), d_allocator_p);
+        }
+        d_allocator_p->deallocate(d_buckets_p);
+    }
+
+    // ACCESSORS
+    Bucket& bucket(const char *timetableName) const
+        // Return a reference providing modifiable access to the head of the
+        // list of the bucket for the specified 'timetableName'.
+    {
+        return d_buckets_p[bdlb::CStringHash()(timetableName)
+                                                        & (d_numBuckets - 1)];
+    }
+
+    TimetableCache_Entry *find(const char *timetableName) const
+        // Return the address of the entry in the most recently published
+        // list of the bucket for the specified 'timetableName' for the
+        // timetable having that name, or 0 if there is none.
+    {
+        for (Node *node = bucket(timetableName).loadAcquire();
+             node;
+             node = node->d_next_p) {
+            if (0 == bsl::strcmp(node->d_name.c_str(), timetableName)) {
+                return &node->d_entry;                                // RETURN
+            }
+        }
+        return 0;
+    }
+};
+
+                        // -------------------------
                         // class TimetableCache_Entry
-                        // --------------------------
+                        // -------------------------
 
 // CREATORS
 TimetableCache_Entry::TimetableCache_Entry()
 : d_ptr()
 , d_loadTime()
+, d_retired_p(0)
 {
 }
 
 TimetableCache_Entry::TimetableCache_Entry(Timetable        *timetable,
                                            const Datetime&   loadTime,
                                            bslma::Allocator *allocator)
-: d_ptr(timetable, allocator)
+: d_ptr()
 , d_loadTime(loadTime)
+, d_retired_p(0)
 {
     BSLS_ASSERT(timetable);
     BSLS_ASSERT(allocator);
+
+    Rep *rep = new (*allocator) Rep(timetable, allocator);
+
+    bsl::shared_ptr<Rep> repPtr(rep, allocator);
+
+    // The shared pointer to the timetable shares ownership of the entire
+    // representation.
+
+    d_ptr.reset(repPtr, &rep->d_timetable);
+    d_retired_p = &rep->d_retired;
 }
 
 TimetableCache_Entry::TimetableCache_Entry(
                                           const TimetableCache_Entry& original)
 : d_ptr(original.d_ptr)
 , d_loadTime(original.d_loadTime)
+, d_retired_p(original.d_retired_p)
 {
 }
 
@@ -56,31 +275,45 @@ TimetableCache_Entry::~TimetableCache_Entry()
 TimetableCache_Entry& TimetableCache_Entry::operator=(
                                                const TimetableCache_Entry& rhs)
 {
-    d_ptr      = rhs.d_ptr;
-    d_loadTime = rhs.d_loadTime;
+    d_ptr       = rhs.d_ptr;
+    d_loadTime  = rhs.d_loadTime;
+    d_retired_p = rhs.d_retired_p;
 
     return *this;
 }
 
+void TimetableCache_Entry::retire()
+{
+    BSLS_ASSERT(d_retired_p);
+
+    d_retired_p->storeRelease(true);
+}
+
 // ACCESSORS
-bsl::shared_ptr<const Timetable> TimetableCache_Entry::get() const
+const bsl::shared_ptr<const Timetable>& TimetableCache_Entry::get() const
 {
     return d_ptr;
 }
 
+bool TimetableCache_Entry::isCurrent() const
+{
+    return d_retired_p && !d_retired_p->loadAcquire();
+}
+
 Datetime TimetableCache_Entry::loadTime() const
 {
     return d_loadTime;
 }
 
-                           // --------------------
+                           // -------------------
                            // class TimetableCache
-                           // --------------------
+                           // -------------------
 
 // CREATORS
 TimetableCache::TimetableCache(TimetableLoader  *loader,
                                bslma::Allocator *basicAllocator)
-: d_cache(basicAllocator)
+: d_index_p(0)
+, d_gracePeriod()
 , d_loader_p(loader)
 , d_timeOut(0)
 , d_hasTimeOutFlag(false)
@@ -93,7 +326,8 @@ TimetableCache::TimetableCache(TimetableLoader  *loader,
 TimetableCache::TimetableCache(TimetableLoader           *loader,
                                const bsls::TimeInterval&  timeout,
                                bslma::Allocator          *basicAllocator)
-: d_cache(basicAllocator)
+: d_index_p(0)
+, d_gracePeriod()
 , d_loader_p(loader)
 , d_timeOut(0, 0, 0, 0, timeout.totalMilliseconds())
 , d_hasTimeOutFlag(true)
@@ -107,61 +341,222 @@ TimetableCache::TimetableCache(TimetableLoader           *loader,
 
 TimetableCache::~TimetableCache()
 {
+    d_allocator_p->deleteObject(d_index_p.loadRelaxed());
 }
 
-// MANIPULATORS
-bsl::shared_ptr<const Timetable>
-TimetableCache::getTimetable(const char *timetableName)
+// PRIVATE MANIPULATORS
+void TimetableCache::grow() const
 {
-    BSLS_ASSERT(timetableName);
+    enum { k_INITIAL_NUM_BUCKETS = 8 };
 
-    {
-        bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
+    const Index *current = d_index_p.loadRelaxed();
 
-        CacheIterator iter = d_cache.find(timetableName);
+    Index *index = new (*d_allocator_p) Index(
+                                       current
+                                       ? 2 * current->d_numBuckets
+                                       : bsl::size_t(k_INITIAL_NUM_BUCKETS),
+                                       d_allocator_p);
 
-        if (iter != d_cache.end()) {
-            if (   !d_hasTimeOutFlag
-                || d_timeOut > CurrentTime::utc() - iter->second.loadTime()) {
-                return iter->second.get();                            // RETURN
-            }
-            else {
-                d_cache.erase(iter);
+    bslma::RawDeleterProctor<Index, bslma::Allocator> proctor(index,
+                                                              d_allocator_p);
+
+    if (current) {
+        for (bsl::size_t i = 0; i < current->d_numBuckets; ++i) {
+            const Index::Node *node = current->d_buckets_p[i].loadRelaxed();
+
+            for (; node; node = node->d_next_p) {
+                Index::Bucket& head = index->bucket(node->d_name.c_str());
+
+                head.storeRelaxed(new (*d_allocator_p) Index::Node(
+                                                          node->d_name.c_str(),
+                                                          node->d_entry,
+                                                          head.loadRelaxed(),
+                                                          d_allocator_p));
             }
         }
+        index->d_numEntries = current->d_numEntries;
     }
 
-    // Create out-of-place timetable that will be managed by 'bsl::shared_ptr'.
+    proctor.release();
 
-    Timetable *timetablePtr = new (*d_allocator_p) Timetable(d_allocator_p);
+    publish(index);
+}
 
-    const Datetime timestamp = CurrentTime::utc();
+void TimetableCache::loadTimetable(TimetableCache_Entry *entry,
+                                   const char           *timetableName)
+{
+    BSLS_ASSERT(entry);
+    BSLS_ASSERT(timetableName);
 
-    TimetableCache_Entry entry(timetablePtr, timestamp, d_allocator_p);
+    *entry = TimetableCache_Entry();
+
+    if (lookupEntry(entry, timetableName)) {
+        if (!isExpired(entry->loadTime())) {
+            return;                                                   // RETURN
+        }
+
+        *entry = TimetableCache_Entry();
+        removeExpired(timetableName);
+    }
 
     // Load timetable identified by 'timetableName'.
 
-    if (d_loader_p->load(timetablePtr, timetableName)) {
-        return bsl::shared_ptr<const Timetable>();                    // RETURN
+    Timetable timetable(d_allocator_p);
+
+    const Datetime timestamp = CurrentTime::utc();
+
+    if (d_loader_p->load(&timetable, timetableName)) {
+        return;                                                       // RETURN
     }
 
+    // Create out-of-place timetable that will be managed by 'bsl::shared_ptr'.
+
+    TimetableCache_Entry loaded(&timetable, timestamp, d_allocator_p);
+
     // Insert newly-loaded timetable into cache if another thread hasn't done
     // so already.
 
     bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
 
-    ConstCacheIterator iter = d_cache.find(timetableName);
+    const Index                *index   = d_index_p.loadRelaxed();
+    const TimetableCache_Entry *current = index
+                                        ? index->find(timetableName)
+                                        : 0;
 
     // Here, we assume that the time elapsed between the last check and the
     // loading of the timetable is insignificant compared to the timeout, so we
     // will simply return the entry in the cache if it has been inserted by
     // another thread.
 
-    if (iter != d_cache.end()) {
-        return iter->second.get();                                    // RETURN
+    if (current) {
+        *entry = *current;
+
+        return;                                                       // RETURN
     }
 
-    d_cache[timetableName] = entry;
+    update(timetableName, &loaded);
+
+    *entry = loaded;
+}
+
+// PRIVATE ACCESSORS
+bool TimetableCache::lookupEntry(TimetableCache_Entry *entry,
+                                 const char           *timetableName) const
+{
+    BSLS_ASSERT(entry);
+    BSLS_ASSERT(timetableName);
+
+    // The index, and the list of a bucket, are loaded after entering the
+    // grace period, so that a modification that replaces either, and then
+    // synchronizes with the grace period, can safely destroy it.
+
+    bslmt::GracePeriodReadGuard guard(&d_gracePeriod);
+
+    const Index                *index = d_index_p.load();
+    const TimetableCache_Entry *found = index ? index->find(timetableName) : 0;
+
+    if (found) {
+        *entry = *found;
+    }
+
+    return 0 != found;
+}
+
+void TimetableCache::publish(Index *index) const
+{
+    const Index *previous = d_index_p.swap(index);
+
+    // Every lookup that starts from now on observes 'index' (or a later one),
+    // so 'previous' is no longer in use once the lookups now in progress have
+    // completed.
+
+    if (previous) {
+        d_gracePeriod.synchronize();
+
+        d_allocator_p->deleteObject(previous);
+    }
+}
+
+void TimetableCache::removeExpired(const char *timetableName) const
+{
+    bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
+
+    const Index                *index = d_index_p.loadRelaxed();
+    const TimetableCache_Entry *entry = index ? index->find(timetableName) : 0;
+
+    if (entry && isExpired(entry->loadTime())) {
+        update(timetableName, 0);
+    }
+}
+
+void TimetableCache::update(const char                 *timetableName,
+                            const TimetableCache_Entry *entry) const
+{
+    BSLS_ASSERT(timetableName);
+
+    Index *index = d_index_p.loadRelaxed();
+
+    if (entry && (!index || index->d_numBuckets <= index->d_numEntries)) {
+        grow();
+
+        index = d_index_p.loadRelaxed();
+    }
+
+    if (!index) {
+        return;                                                       // RETURN
+    }
+
+    // Copy the list of the bucket for 'timetableName', omitting the node (if
+    // any) for that name, and prepend a node for 'entry'.
+
+    Index::Bucket&  head     = index->bucket(timetableName);
+    Index::Node    *previous = head.loadRelaxed();
+    Index::Node    *replaced = 0;
+
+    Index::ListProctor proctor(d_allocator_p);
+
+    for (Index::Node *node = previous; node; node = node->d_next_p) {
+        if (0 == bsl::strcmp(node->d_name.c_str(), timetableName)) {
+            replaced = node;
+        }
+        else {
+            proctor.push(node->d_name.c_str(), node->d_entry);
+        }
+    }
+
+    if (entry) {
+        proctor.push(timetableName, *entry);
+        ++index->d_numEntries;
+    }
+
+    // The replaced entry is retired before the list is published, so that it
+    // is no longer current by the time any lookup can observe 'entry'.
+
+    if (replaced) {
+        replaced->d_entry.retire();
+        --index->d_numEntries;
+    }
+
+    head.storeRelease(proctor.release());
+
+    // Every lookup that starts from now on observes the new list, so
+    // 'previous' is no longer in use once the lookups now in progress have
+    // completed.
+
+    d_gracePeriod.synchronize();
+
+    Index::deleteList(previous, d_allocator_p);
+}
+
+// MANIPULATORS
+bsl::shared_ptr<const Timetable>
+TimetableCache::getTimetable(const char *timetableName)
+{
+    BSLS_ASSERT(timetableName);
+
+    TimetableCache_Entry entry;
+
+    loadTimetable(&entry, timetableName);
 
     return entry.get();
 }
@@ -172,10 +567,10 @@ int TimetableCache::invalidate(const char *timetableName)
 
     bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
 
-    CacheIterator iter = d_cache.find(timetableName);
+    const Index *index = d_index_p.loadRelaxed();
 
-    if (iter != d_cache.end()) {
-        d_cache.erase(iter);
+    if (index && index->find(timetableName)) {
+        update(timetableName, 0);
 
         return 1;                                                     // RETURN
     }
@@ -187,9 +582,26 @@ int TimetableCache::invalidateAll()
 {
     bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
 
-    const int numInvalidated = static_cast<int>(d_cache.size());
+    const Index *current = d_index_p.loadRelaxed();
 
-    d_cache.clear();
+    if (!current || 0 == current->d_numEntries) {
+        return 0;                                                     // RETURN
+    }
+
+    const int numInvalidated = static_cast<int>(current->d_numEntries);
+
+    Index *index = new (*d_allocator_p) Index(current->d_numBuckets,
+                                              d_allocator_p);
+
+    for (bsl::size_t i = 0; i < current->d_numBuckets; ++i) {
+        for (Index::Node *node = current->d_buckets_p[i].loadRelaxed();
+             node;
+             node = node->d_next_p) {
+            node->d_entry.retire();
+        }
+    }
+
+    publish(index);
 
     return numInvalidated;
 }
@@ -200,42 +612,96 @@ TimetableCache::lookupTimetable(const char *timetableName) const
 {
     BSLS_ASSERT(timetableName);
 
-    bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
+    TimetableCache_Entry entry;
 
-    CacheIterator iter = d_cache.find(timetableName);
+    if (lookupEntry(&entry, timetableName) && isExpired(entry.loadTime())) {
+        removeExpired(timetableName);
 
-    if (iter != d_cache.end()) {
-        if (   !d_hasTimeOutFlag
-            || d_timeOut > CurrentTime::utc() - iter->second.loadTime()) {
-            return iter->second.get();                                // RETURN
-        }
-        else {
-            d_cache.erase(iter);
-        }
+        return bsl::shared_ptr<const Timetable>();                    // RETURN
     }
 
-    return bsl::shared_ptr<const Timetable>();
+    return entry.get();
 }
 
 Datetime TimetableCache::lookupLoadTime(const char *timetableName) const
 {
     BSLS_ASSERT(timetableName);
 
-    bslmt::LockGuard<bslmt::Mutex> lockGuard(&d_lock);
+    TimetableCache_Entry entry;
+
+    if (lookupEntry(&entry, timetableName) && isExpired(entry.loadTime())) {
+        removeExpired(timetableName);
+
+        return Datetime();                                            // RETURN
+    }
 
-    CacheIterator iter = d_cache.find(timetableName);
+    return entry.loadTime();
+}
 
-    if (iter != d_cache.end()) {
-        if (   !d_hasTimeOutFlag
-            || d_timeOut > CurrentTime::utc() - iter->second.loadTime()) {
-            return iter->second.loadTime();                           // RETURN
+                        // --------------------------
+                        // class TimetableCacheHandle
+                        // --------------------------
+
+// CREATORS
+TimetableCacheHandle::TimetableCacheHandle(
+                                              TimetableCache   *cache,
+                                              bslma::Allocator *basicAllocator)
+: d_entries(basicAllocator)
+, d_cache_p(cache)
+{
+    BSLS_ASSERT(cache);
+}
+
+TimetableCacheHandle::~TimetableCacheHandle()
+{
+}
+
+// MANIPULATORS
+void TimetableCacheHandle::clear()
+{
+    d_entries.clear();
+}
+
+const Timetable *TimetableCacheHandle::getTimetable(const char *timetableName)
+{
+    BSLS_ASSERT(timetableName);
+
+    bsl::vector<Entry>::iterator it = bsl::lower_bound(d_entries.begin(),
+                                                       d_entries.end(),
+                                                       timetableName,
+                                                       NameLess<Entry>());
+
+    if (d_entries.end() != it && 0 == bsl::strcmp(it->first.c_str(),
+                                                  timetableName)) {
+        TimetableCache_Entry& slot = it->second;
+
+        if (slot.isCurrent() && !d_cache_p->isExpired(slot.loadTime())) {
+            return slot.get().get();                                  // RETURN
         }
-        else {
-            d_cache.erase(iter);
+
+        d_cache_p->loadTimetable(&slot, timetableName);
+
+        if (!slot.get()) {
+            d_entries.erase(it);
+            return 0;                                                 // RETURN
         }
+
+        return slot.get().get();                                      // RETURN
     }
 
-    return Datetime();
+    TimetableCache_Entry slot;
+
+    d_cache_p->loadTimetable(&slot, timetableName);
+
+    if (!slot.get()) {
+        return 0;                                                     // RETURN
+    }
+
+    it = d_entries.insert(it, Entry());
+    it->first.assign(timetableName);
+    it->second = slot;
+
+    return it->second.get().get();
 }
 
 }  // close package namespace
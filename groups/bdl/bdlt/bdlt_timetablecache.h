@@ -9,6 +9,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 // bdlt::TimetableCache: cache for read-only timetables loaded on demand
+// bdlt::TimetableCacheHandle: per-thread handle for repeated cache access
 //
 //@SEE_ALSO: bdlt_timetable, bdlt_timetableloader
 //
@@ -54,6 +55,42 @@ BSLS_IDENT("$Id: $")
 // an empty 'bsl::shared_ptr<const bdlt::Timetable>' is returned if the
 // requested timetable is found to have expired.
 //
+///Lock-Free Lookup
+///----------------
+// Retrieving a timetable that is present in the cache (and has not expired),
+// using either 'getTimetable' or 'lookupTimetable', does not acquire a lock.
+// The cache indexes its timetables by name in a hash table whose buckets are
+// immutable lists published through atomic pointers, and a lookup searches
+// the most recently published list of the bucket for the requested name.
+// Loading and invalidating timetables are serialized by a mutex, and each
+// publishes a replacement list for the one bucket it affects (or, when the
+// table grows, a replacement table).  Because a lookup may still be searching
+// a replaced list, the modification then waits (see 'bslmt_graceperiod')
+// until every lookup that was in progress when the replacement was published
+// has finished, and destroys the replaced list along with the references it
+// holds to timetables.  A modification does not wait for lookups that start
+// after the replacement is published, so it completes however steadily
+// lookups arrive, and no replaced list outlives the modification that
+// replaced it.  Note that the cost of a modification does not depend on the
+// number of timetables in the cache, except when the table doubles in size.
+//
+///Per-Thread Handles
+///------------------
+// A timetable returned by the cache is returned by 'bsl::shared_ptr', whose
+// reference count is shared by every thread using that timetable.  A thread
+// that repeatedly resolves timetables by name can avoid updating that count by
+// using a 'bdlt::TimetableCacheHandle'.  A handle holds its own references to
+// the timetables it has obtained from a cache.  Each timetable loaded into the
+// cache carries a flag, allocated along with the timetable, that the cache
+// sets when the timetable is replaced in, or removed from, the cache.  A
+// request through the handle is satisfied by the address of the timetable it
+// holds provided that this flag is not set and the timetable has not expired;
+// otherwise, the handle obtains the timetable from the cache anew, exactly as
+// 'getTimetable' would.  Loading or invalidating timetables having other names
+// does not affect the timetables held by a handle.  Note that, therefore,
+// invalidation and timeouts have the same effect on requests made through a
+// handle as on requests made directly through the cache.
+//
 ///Thread Safety
 ///-------------
 // The 'bdlt::TimetableCache' class is fully thread-safe (see
@@ -61,6 +98,10 @@ BSLS_IDENT("$Id: $")
 // the default allocator in effect during the lifetime of cache objects are
 // both fully thread-safe.
 //
+// The 'bdlt::TimetableCacheHandle' class is *not* thread-safe: each handle is
+// intended to be used by a single thread, although any number of handles may
+// refer to the same cache.
+//
 ///Usage
 ///-----
 // The following example illustrates how to use a 'bdlt::TimetableCache'.
@@ -229,10 +270,58 @@ BSLS_IDENT("$Id: $")
 //
 //  assert(!oneC.get());
 //..
+//
+///Example 3: Using a Per-Thread Handle
+/// - - - - - - - - - - - - - - - - - -
+// This third example shows how a thread that repeatedly resolves timetables by
+// name can use a 'bdlt::TimetableCacheHandle' to do so efficiently.
+//
+// First, we create a timetable loader and a timetable cache, which would
+// typically be shared by many threads:
+//..
+//  MyTimetableLoader    loader;
+//  bdlt::TimetableCache cache(&loader);
+//..
+// Then, in each thread, we create a handle referring to the cache:
+//..
+//  bdlt::TimetableCacheHandle handle(&cache);
+//..
+// Next, we obtain the "ONE" timetable through the handle, which loads the
+// timetable into the cache:
+//..
+//  const bdlt::Timetable *oneA = handle.getTimetable("ONE");
+//
+//  assert(oneA);
+//  assert(1 == oneA->initialTransitionCode());
+//  assert(oneA == cache.lookupTimetable("ONE").get());
+//..
+// Then, we obtain the "ONE" timetable through the handle again.  This request
+// is satisfied by the handle itself, without acquiring a lock or updating a
+// reference count:
+//..
+//  const bdlt::Timetable *oneB = handle.getTimetable("ONE");
+//
+//  assert(oneA == oneB);
+//..
+// Finally, we invalidate the "ONE" timetable in the cache, and observe that
+// the next request through the handle obtains the reloaded timetable.  Note
+// that 'oneA' and 'oneB' must not be used once the handle has replaced the
+// timetable to which they refer:
+//..
+//  int numInvalidated = cache.invalidate("ONE");
+//  assert(1 == numInvalidated);
+//
+//  const bdlt::Timetable *oneC = handle.getTimetable("ONE");
+//
+//  assert(oneC);
+//  assert(1 == oneC->initialTransitionCode());
+//  assert(oneC == cache.lookupTimetable("ONE").get());
+//..
 
 #include <bdlscm_version.h>
 
 #include <bdlt_timetable.h>
+#include <bdlt_currenttime.h>
 #include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
 
@@ -241,44 +330,62 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_integralconstant.h>
 
+#include <bslmt_graceperiod.h>
 #include <bslmt_mutex.h>
 
+#include <bsls_atomic.h>
 #include <bsls_timeinterval.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_map.h>
 #include <bsl_memory.h>  // 'bsl::shared_ptr'
 #include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace bdlt {
 
 class TimetableLoader;
 class TimetableCache_Entry;
+class TimetableCacheHandle;
 
                         // ==========================
                         // class TimetableCache_Entry
                         // ==========================
 
-// IMPLEMENTATION NOTE: The Sun Studio 12.3 compiler does not support 'map's
-// holding types that are incomplete at the point of declaration of a data
-// member.  Other compilers allow us to complete 'TimetableCache_Entry' at a
-// later point in the code, but before any operation (such as 'insert') that
-// would require the type to be complete.  If we did not have to support this
-// compiler, this whole class could be defined in the .cpp file; as it stands,
-// it *must* be defined before class 'TimetableCache'.
+// IMPLEMENTATION NOTE: The Sun Studio 12.3 compiler does not support
+// containers holding types that are incomplete at the point of declaration of
+// a data member.  Other compilers allow us to complete 'TimetableCache_Entry'
+// at a later point in the code, but before any operation (such as 'insert')
+// that would require the type to be complete.  If we did not have to support
+// this compiler, this whole class could be defined in the .cpp file; as it
+// stands, it *must* be defined before class 'TimetableCacheHandle'.
 
 class TimetableCache_Entry {
     // This class defines the type of objects that are inserted into the
     // timetable cache.  Each entry contains a shared pointer to a read-only
-    // timetable and the time at which that timetable was loaded.  Note that an
-    // explicit allocator is *required* to create an entry object.
+    // timetable, the time at which that timetable was loaded, and the address
+    // of a flag, allocated along with the timetable, that is set once the
+    // timetable has been replaced in, or removed from, the cache.  Note that
+    // an explicit allocator is *required* to create an entry object.
+
+    // PRIVATE TYPES
+    struct Rep;
+        // Timetable and retirement flag managed by the shared pointer of an
+        // entry (defined in the implementation).
 
     // DATA
-    bsl::shared_ptr<const Timetable> d_ptr;       // shared pointer to
-                                                  // out-of-place instance
+    bsl::shared_ptr<const Timetable>  d_ptr;        // shared pointer to
+                                                    // out-of-place instance
+
+    Datetime                          d_loadTime;   // time when timetable was
+                                                    // loaded
 
-    Datetime                         d_loadTime;  // time when timetable was
-                                                  // loaded
+    bsls::AtomicBool                 *d_retired_p;  // 'true' once the
+                                                    // timetable is no longer
+                                                    // in the cache, or 0 if
+                                                    // empty (held, not owned)
 
   public:
     // CREATORS
@@ -289,10 +396,11 @@ class TimetableCache_Entry {
     TimetableCache_Entry(Timetable        *timetable,
                          const Datetime&   loadTime,
                          bslma::Allocator *allocator);
-        // Create a cache entry object for managing the specified 'timetable'
-        // that was loaded at the specified 'loadTime' using the specified
-        // 'allocator'.  The behavior is undefined unless 'timetable' uses
-        // 'allocator' to obtain memory.
+        // Create a cache entry object for managing a timetable having the
+        // value of the specified 'timetable' that was loaded at the specified
+        // 'loadTime' using the specified 'allocator' to supply memory, and
+        // leave 'timetable' in a valid but unspecified state.  The behavior
+        // is undefined unless 'timetable' uses 'allocator' to obtain memory.
 
     TimetableCache_Entry(const TimetableCache_Entry& original);
         // Create a cache entry object having the value of the specified
@@ -307,10 +415,21 @@ class TimetableCache_Entry {
         // object, and return a reference providing modifiable access to this
         // object.
 
+    void retire();
+        // Record that the timetable referred to by this cache entry object is
+        // no longer current.  The behavior is undefined if this entry is
+        // empty.  Note that the timetable is no longer current for every entry
+        // referring to it.
+
     // ACCESSORS
-    bsl::shared_ptr<const Timetable> get() const;
-        // Return a shared pointer providing non-modifiable access to the
-        // timetable referred to by this cache entry object.
+    const bsl::shared_ptr<const Timetable>& get() const;
+        // Return a reference providing non-modifiable access to the shared
+        // pointer to the timetable referred to by this cache entry object.
+
+    bool isCurrent() const;
+        // Return 'true' if this cache entry object is not empty and 'retire'
+        // has not been called for the timetable it refers to, and 'false'
+        // otherwise.
 
     Datetime loadTime() const;
         // Return the time at which the timetable referred to by this cache
@@ -341,38 +460,94 @@ class TimetableCache {
     //
     // This class is fully thread-safe (see 'bsldoc_glossary').
 
+    // PRIVATE TYPES
+    struct Index;
+        // Hash table of the cached timetables, searched by lookups without
+        // locking (defined in the implementation).
+
     // DATA
-    mutable bsl::map<bsl::string, TimetableCache_Entry>
-                           d_cache;           // cache of (name, handle) pairs
+    mutable bsls::AtomicPointer<Index>
+                                  d_index_p;         // most recently published
+                                                     // index of the cache, or
+                                                     // 0 if no timetable has
+                                                     // been loaded (owned)
 
-    TimetableLoader       *d_loader_p;        // timetable loader (held, not
-                                              // owned)
+    mutable bslmt::GracePeriod    d_gracePeriod;     // lookups of 'd_index_p'
+                                                     // in progress
 
-    DatetimeInterval       d_timeOut;         // timeout value; ignored unless
-                                              // 'd_hasTimeOutFlag' is 'true'
+    TimetableLoader              *d_loader_p;        // timetable loader (held,
+                                                     // not owned)
 
-    bool                   d_hasTimeOutFlag;  // 'true' if this cache has a
-                                              // timeout value and 'false'
-                                              // otherwise
+    DatetimeInterval              d_timeOut;         // timeout value; ignored
+                                                     // unless
+                                                     // 'd_hasTimeOutFlag' is
+                                                     // 'true'
 
-    mutable bslmt::Mutex   d_lock;            // guard access to cache
+    bool                          d_hasTimeOutFlag;  // 'true' if this cache
+                                                     // has a timeout value and
+                                                     // 'false' otherwise
 
-    bslma::Allocator      *d_allocator_p;     // memory allocator (held, not
-                                              // owned)
+    mutable bslmt::Mutex          d_lock;            // serializes modification
+                                                     // of the cache
 
-  private:
-    // PRIVATE TYPES
-    typedef bsl::map<bsl::string, TimetableCache_Entry>::iterator
-                                                                 CacheIterator;
+    bslma::Allocator             *d_allocator_p;     // memory allocator (held,
+                                                     // not owned)
 
-    typedef bsl::map<bsl::string, TimetableCache_Entry>::const_iterator
-                                                            ConstCacheIterator;
+    // FRIENDS
+    friend class TimetableCacheHandle;
 
   private:
     // NOT IMPLEMENTED
     TimetableCache(const TimetableCache&);
     TimetableCache& operator=(const TimetableCache&);
 
+    // PRIVATE MANIPULATORS
+    void grow() const;
+        // Publish an index of this cache having twice the number of buckets
+        // of the current one (or an initial number of buckets if there is
+        // none), wait until no lookup can refer to the index it replaces, and
+        // destroy that index.  The behavior is undefined unless 'd_lock' is
+        // held by the calling thread.
+
+    void loadTimetable(TimetableCache_Entry *entry,
+                       const char           *timetableName);
+        // Load, into the specified 'entry', the entry for the timetable having
+        // the specified 'timetableName' in this cache, loading the timetable
+        // into the cache if it is not present or has expired.  If the loader
+        // fails, reset 'entry' to the empty entry.
+
+    // PRIVATE ACCESSORS
+    bool isExpired(const Datetime& loadTime) const;
+        // Return 'true' if a timetable loaded into this cache at the specified
+        // 'loadTime' has expired, and 'false' otherwise.
+
+    bool lookupEntry(TimetableCache_Entry *entry,
+                     const char           *timetableName) const;
+        // Load, into the specified 'entry', the entry for the timetable having
+        // the specified 'timetableName' in the most recently published
+        // index of this cache, whether or not it has expired, without
+        // acquiring a lock.  Return 'true' if the timetable was found, and
+        // 'false' otherwise (in which case 'entry' is unchanged).
+
+    void publish(Index *index) const;
+        // Publish the specified 'index', transferring its ownership to this
+        // cache, wait until no lookup can refer to the index it replaces, and
+        // destroy that index.  The behavior is undefined unless 'd_lock' is
+        // held by the calling thread.
+
+    void removeExpired(const char *timetableName) const;
+        // Remove the timetable having the specified 'timetableName' from this
+        // cache if it is present and has expired.
+
+    void update(const char                 *timetableName,
+                const TimetableCache_Entry *entry) const;
+        // Publish, in the index of this cache, a list for the bucket of the
+        // specified 'timetableName' in which the timetable having that name
+        // is that of the specified 'entry', or is absent if 'entry' is 0,
+        // retiring the entry it replaces (if any), wait until no lookup can
+        // refer to the list it replaces, and destroy that list.  The behavior
+        // is undefined unless 'd_lock' is held by the calling thread.
+
   public:
     // CREATORS
     explicit
@@ -454,10 +629,119 @@ class TimetableCache {
         // timeout optionally supplied at construction), return 'Datetime()'.
 };
 
+                        // ==========================
+                        // class TimetableCacheHandle
+                        // ==========================
+
+class TimetableCacheHandle {
+    // This class provides a handle through which a single thread obtains
+    // timetables from a 'TimetableCache' supplied at construction.  The handle
+    // holds references to the timetables obtained through it, and satisfies a
+    // subsequent request for one of them, without locking or updating a
+    // shared reference count, unless the timetable has been reloaded into, or
+    // removed from, the cache, or has expired, since it was obtained.
+    //
+    // This class is *not* thread-safe.
+
+    // PRIVATE TYPES
+    typedef bsl::pair<bsl::string, TimetableCache_Entry> Entry;
+        // Name of a timetable and the timetable obtained through the handle.
+
+    // DATA
+    bsl::vector<Entry>  d_entries;  // timetables obtained through this
+                                    // handle, sorted by name
+
+    TimetableCache     *d_cache_p;  // cache from which timetables are
+                                    // obtained (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    TimetableCacheHandle(const TimetableCacheHandle&);
+    TimetableCacheHandle& operator=(const TimetableCacheHandle&);
+
+  public:
+    // CREATORS
+    explicit
+    TimetableCacheHandle(TimetableCache   *cache,
+                         bslma::Allocator *basicAllocator = 0);
+        // Create a handle that obtains timetables from the specified 'cache'
+        // and holds none.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless 'cache'
+        // remains valid throughout the lifetime of this handle.
+
+    ~TimetableCacheHandle();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Release the references to all timetables held by this handle.
+
+    const Timetable *getTimetable(const char *timetableName);
+        // Return the address providing non-modifiable access to the timetable
+        // having the specified 'timetableName' in the cache supplied at
+        // construction, obtaining the timetable as if by the 'getTimetable'
+        // method of the cache unless the timetable held by this handle is
+        // current.  If the loader of the cache fails, return 0.  The returned
+        // address remains valid until the next invocation of a manipulator on
+        // this handle, or until this handle is destroyed.
+
+    // ACCESSORS
+    TimetableCache *cache() const;
+        // Return the address of the cache from which this handle obtains
+        // timetables.
+
+    bsl::size_t numTimetables() const;
+        // Return the number of timetables held by this handle.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this handle to supply memory.
+};
+
 // ============================================================================
 //                             INLINE DEFINITIONS
 // ============================================================================
 
+                           // --------------------
+                           // class TimetableCache
+                           // --------------------
+
+// PRIVATE ACCESSORS
+inline
+bool TimetableCache::isExpired(const Datetime& loadTime) const
+{
+    // The clock is consulted only if this cache has a timeout.
+
+    return d_hasTimeOutFlag && d_timeOut <= CurrentTime::utc() - loadTime;
+}
+
+                        // --------------------------
+                        // class TimetableCacheHandle
+                        // --------------------------
+
+// ACCESSORS
+inline
+TimetableCache *TimetableCacheHandle::cache() const
+{
+    return d_cache_p;
+}
+
+inline
+bsl::size_t TimetableCacheHandle::numTimetables() const
+{
+    return d_entries.size();
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *TimetableCacheHandle::allocator() const
+{
+    return d_entries.get_allocator().mechanism();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -469,6 +753,9 @@ namespace bslma {
 template <>
 struct UsesBslmaAllocator<bdlt::TimetableCache> : bsl::true_type {};
 
+template <>
+struct UsesBslmaAllocator<bdlt::TimetableCacheHandle> : bsl::true_type {};
+
 }  // close namespace bslma
 }  // close enterprise namespace
 
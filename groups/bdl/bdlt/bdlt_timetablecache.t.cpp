@@ -19,11 +19,13 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_atomic.h>
 #include <bsls_platform.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
 
 #include <bsl_climits.h>    // 'INT_MAX'
+#include <bsl_cstdio.h>     // 'sprintf'
 #include <bsl_cstdlib.h>    // 'atoi'
 #include <bsl_cstring.h>    // 'strcmp'
 #include <bsl_iostream.h>
@@ -78,14 +80,26 @@ using namespace bsl;
 // [ 4] int invalidateAll();
 // [ 3] shared_ptr<const Timetable> lookupTimetable(const char *n) const;
 // [ 3] Datetime lookupLoadTime(const char *name) const;
+//
+// 'TimetableCacheHandle' class:
+// [ 7] TimetableCacheHandle(TimetableCache *cache, Allocator *ba = 0);
+// [ 7] ~TimetableCacheHandle();
+// [ 7] void clear();
+// [ 7] const Timetable *getTimetable(const char *name);
+// [ 7] TimetableCache *cache() const;
+// [ 7] bsl::size_t numTimetables() const;
+// [ 7] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [ *] CONCERN: Precondition violations are detected when enabled.
 // [ 5] CONCERN: All memory allocation is exception neutral.
 // [ 6] CONCERN: All manipulators and accessors are thread-safe.
+// [ 8] CONCERN: Lookups and handles are safe during modification.
 // [-1] CONCERN: A non-trivial timeout is processed correctly.
+// [-2] PERFORMANCE: 'lookupTimetable' AND 'TimetableCacheHandle'
+// [-3] PERFORMANCE: LOADING AND INVALIDATING MANY TIMETABLES
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -154,6 +168,7 @@ void aSsErT(bool condition, const char *message, int line)
 // ----------------------------------------------------------------------------
 
 typedef bdlt::TimetableCache                   Obj;
+typedef bdlt::TimetableCacheHandle             Handle;
 typedef bsl::shared_ptr<const bdlt::Timetable> Entry;
 
 typedef bsls::TimeInterval                     Interval;
@@ -176,6 +191,7 @@ bdlt::DatetimeInterval                         OneSecond(0, 0, 0, 1);
 // ----------------------------------------------------------------------------
 
 BSLMF_ASSERT((bslma::UsesBslmaAllocator<Obj>::VALUE));
+BSLMF_ASSERT((bslma::UsesBslmaAllocator<Handle>::VALUE));
 
 // ============================================================================
 //                  HELPER CLASSES AND FUNCTIONS FOR TESTING
@@ -189,9 +205,12 @@ static const bdlt::Date gLastDate(2020, 12, 31);
 
 class TestLoader : public bdlt::TimetableLoader {
     // This concrete timetable loader successfully loads timetables named
-    // "CAL-1", "CAL-2", and "CAL-3" only.  An attempt to load a timetable by
-    // any other name results in a non-zero result status being returned from
-    // the 'load' method.
+    // "CAL-1", "CAL-2", and "CAL-3" only, unless it has been set to fail.  An
+    // attempt to load a timetable by any other name results in a non-zero
+    // result status being returned from the 'load' method.
+
+    // DATA
+    bool d_failFlag;  // 'true' if every load fails
 
   private:
     // NOT IMPLEMENTED
@@ -211,11 +230,16 @@ class TestLoader : public bdlt::TimetableLoader {
         // Load, into the specified 'result', the timetable identified by the
         // specified 'timetableName'.  Return 0 on success, and a non-zero
         // value otherwise.
+
+    void setFail(bool failFlag);
+        // Make every subsequent 'load' fail if the specified 'failFlag' is
+        // 'true', and succeed for the recognized timetables otherwise.
 };
 
 // CREATORS
 inline
 TestLoader::TestLoader()
+: d_failFlag(false)
 {
 }
 
@@ -228,6 +252,10 @@ int TestLoader::load(bdlt::Timetable *result, const char *timetableName)
     BSLS_ASSERT(result);
     BSLS_ASSERT(timetableName);
 
+    if (d_failFlag) {
+        return -1;                                                    // RETURN
+    }
+
     if (0 == bsl::strcmp("CAL-1", timetableName)
      || 0 == bsl::strcmp("CAL-2", timetableName)
      || 0 == bsl::strcmp("CAL-3", timetableName)) {
@@ -268,6 +296,45 @@ int TestLoader::load(bdlt::Timetable *result, const char *timetableName)
     return 1;
 }
 
+void TestLoader::setFail(bool failFlag)
+{
+    d_failFlag = failFlag;
+}
+
+class NumberedLoader : public bdlt::TimetableLoader {
+    // This concrete timetable loader successfully loads a timetable having
+    // any name of the form "NUM-<n>", where '<n>' is a non-negative integer,
+    // whose first date is '<n> % 1000' days after that of the "CAL-1"
+    // timetable, and whose last date is 365 days after its first date.  An
+    // attempt to load a timetable by any other name results in a non-zero
+    // result status being returned from the 'load' method.
+
+  public:
+    // MANIPULATORS
+    int load(bdlt::Timetable *result, const char *timetableName);
+        // Load, into the specified 'result', the timetable identified by the
+        // specified 'timetableName'.  Return 0 on success, and a non-zero
+        // value otherwise.
+};
+
+int NumberedLoader::load(bdlt::Timetable *result, const char *timetableName)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(timetableName);
+
+    if (0 != bsl::strncmp("NUM-", timetableName, 4)) {
+        return 1;                                                     // RETURN
+    }
+
+    const int        n         = bsl::atoi(timetableName + 4);
+    const bdlt::Date firstDate = gFirstDate1 + n % 1000;
+
+    result->reset();
+    result->setValidRange(firstDate, firstDate + 365);
+
+    return 0;
+}
+
 static
 bool providesNonModifiableAccessOnly(bdlt::Timetable *)
     // Return 'false'.
@@ -650,6 +717,98 @@ extern "C" void *threadFunction3(void *arg)
 
 }  // close namespace TestCase6
 
+namespace TestCase8 {
+
+struct ThreadInfo {
+    int  d_numIterations;
+    Obj *d_cache_p;
+    int  d_id;
+};
+
+extern "C" void *readerFunction(void *arg)
+    // Repeatedly obtain timetables from the cache described by the specified
+    // 'arg', through a handle and through the cache, and verify them.
+{
+    ThreadInfo *info = (ThreadInfo *)arg;
+
+    const Obj& X = *info->d_cache_p;
+
+    bslma::TestAllocator ha("handle");
+
+    Handle mH(info->d_cache_p, &ha);
+
+    static const char       *NAMES[] = { "CAL-1", "CAL-2", "CAL-3" };
+    static const bdlt::Date *DATES[] = { &gFirstDate1,
+                                         &gFirstDate2,
+                                         &gFirstDate3 };
+
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        const int j = (i + info->d_id) % 3;
+        const int k = (j + 1) % 3;
+
+        const bdlt::Timetable *timetable = mH.getTimetable(NAMES[j]);
+
+        ASSERT(timetable);
+        if (timetable) {
+            ASSERT(timetable->firstDate() == *DATES[j]);
+        }
+
+        Entry e = X.lookupTimetable(NAMES[k]);
+        if (e.get()) {
+            ASSERT(e->firstDate() == *DATES[k]);
+        }
+    }
+
+    return arg;
+}
+
+extern "C" void *writerFunction(void *arg)
+    // Repeatedly invalidate and reload timetables in the cache described by
+    // the specified 'arg'.
+{
+    ThreadInfo *info = (ThreadInfo *)arg;
+
+    Obj& mX = *info->d_cache_p;
+
+    for (int i = 0; i < info->d_numIterations; ++i) {
+        if (0 == i % 4) {
+            mX.invalidateAll();
+        }
+        else {
+            mX.invalidate(0 == i % 2 ? "CAL-1" : "CAL-2");
+        }
+
+        Entry e = mX.getTimetable("CAL-3");
+        ASSERT(e.get());
+    }
+
+    return arg;
+}
+
+struct LookupInfo {
+    const Obj       *d_cache_p;
+    bsls::AtomicInt *d_isDone_p;
+};
+
+extern "C" void *lookupFunction(void *arg)
+    // Repeatedly look up the "CAL-1" timetable, which must be present, and the
+    // "CAL-3" timetable, which must be absent, in the cache described by the
+    // specified 'arg', until it is done.
+{
+    LookupInfo *info = (LookupInfo *)arg;
+
+    const Obj& X = *info->d_cache_p;
+
+    while (!info->d_isDone_p->load()) {
+        ASSERT(X.lookupTimetable("CAL-1").get());
+        ASSERT(X.lookupLoadTime("CAL-3") == bdlt::Datetime());
+    }
+
+    return arg;
+}
+
+}  // close namespace TestCase8
+
 // ============================================================================
 //                                USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -736,7 +895,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -936,6 +1095,613 @@ int main(int argc, char *argv[])
 //..
         }
 
+        if (verbose) cout << "Example 3: Using a Per-Thread Handle" << endl;
+        {
+///Example 3: Using a Per-Thread Handle
+/// - - - - - - - - - - - - - - - - - -
+// This third example shows how a thread that repeatedly resolves timetables by
+// name can use a 'bdlt::TimetableCacheHandle' to do so efficiently.
+//
+// First, we create a timetable loader and a timetable cache, which would
+// typically be shared by many threads:
+//..
+    MyTimetableLoader    loader;
+    bdlt::TimetableCache cache(&loader);
+//..
+// Then, in each thread, we create a handle referring to the cache:
+//..
+    bdlt::TimetableCacheHandle handle(&cache);
+//..
+// Next, we obtain the "ONE" timetable through the handle, which loads the
+// timetable into the cache:
+//..
+    const bdlt::Timetable *oneA = handle.getTimetable("ONE");
+
+    ASSERT(oneA);
+    ASSERT(1 == oneA->initialTransitionCode());
+    ASSERT(oneA == cache.lookupTimetable("ONE").get());
+//..
+// Then, we obtain the "ONE" timetable through the handle again.  This request
+// is satisfied by the handle itself, without acquiring a lock or updating a
+// reference count:
+//..
+    const bdlt::Timetable *oneB = handle.getTimetable("ONE");
+
+    ASSERT(oneA == oneB);
+//..
+// Finally, we invalidate the "ONE" timetable in the cache, and observe that
+// the next request through the handle obtains the reloaded timetable.  Note
+// that 'oneA' and 'oneB' must not be used once the handle has replaced the
+// timetable to which they refer:
+//..
+    int numInvalidated = cache.invalidate("ONE");
+    ASSERT(1 == numInvalidated);
+
+    const bdlt::Timetable *oneC = handle.getTimetable("ONE");
+
+    ASSERT(oneC);
+    ASSERT(1 == oneC->initialTransitionCode());
+    ASSERT(oneC == cache.lookupTimetable("ONE").get());
+//..
+        }
+
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCURRENT LOOKUP AND RECLAMATION
+        //   Ensure that lookups and handles are safe during modification.
+        //
+        // Concerns:
+        //: 1 Lookups that do not acquire a lock, whether made through the
+        //:   cache or through a handle, return correct timetables while other
+        //:   threads load and invalidate timetables.
+        //:
+        //: 2 A handle observes the invalidation of a timetable by another
+        //:   client of the cache.
+        //:
+        //: 3 A replaced index, or list of a bucket, and the timetables it
+        //:   holds, are reclaimed by the modification that replaces it, even
+        //:   while lookups are continually in progress.
+        //:
+        //: 4 The cache retains every timetable loaded into it, and a handle
+        //:   every timetable it holds that is current, as the index of the
+        //:   cache grows.
+        //
+        // Plan:
+        //: 1 Invalidate a timetable held by a handle, and verify that the
+        //:   handle obtains the reloaded timetable.  (C-2)
+        //:
+        //: 2 Create several threads that obtain timetables through their own
+        //:   handles and through the cache, and a thread that repeatedly
+        //:   invalidates and reloads timetables, and verify each timetable
+        //:   obtained.  (C-1)
+        //:
+        //: 3 Verify that the memory in use after the threads run is that in
+        //:   use before they ran.  (C-3)
+        //:
+        //: 4 Create several threads that continually look up a timetable that
+        //:   remains in the cache, and repeatedly load and invalidate another
+        //:   timetable, verifying after each modification that the memory in
+        //:   use is unchanged.  (C-3)
+        //:
+        //: 5 Load many timetables through a handle, and verify that each is
+        //:   found in the cache, and is current for the handle, both before
+        //:   and after some are invalidated.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: Lookups and handles are safe during modification.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT LOOKUP AND RECLAMATION" << endl
+                          << "=================================" << endl;
+
+        using namespace TestCase8;
+
+        TestLoader loader;
+
+        bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\nTesting invalidation observed by handle."
+                          << endl;
+        {
+            Obj mX(&loader, &sa);
+
+            Handle mH(&mX, &sa);
+
+            const bdlt::Timetable *c1 = mH.getTimetable("CAL-1");
+            ASSERT(c1);
+
+            // Loading another timetable does not retire "CAL-1", so the handle
+            // continues to hold the same timetable.
+
+            Entry e2 = mX.getTimetable("CAL-2");
+            ASSERT(c1 == mH.getTimetable("CAL-1"));
+
+            // Hold a reference, so that the address cannot be reused.
+
+            Entry e1 = mX.lookupTimetable("CAL-1");
+            ASSERT(c1 == e1.get());
+
+            ASSERT(1 == mX.invalidate("CAL-1"));
+
+            const bdlt::Timetable *c2 = mH.getTimetable("CAL-1");
+            ASSERT(c2);
+            ASSERT(c2 != c1);
+            ASSERT(c2 == mX.lookupTimetable("CAL-1").get());
+        }
+        LOOP_ASSERT(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting concurrent lookup." << endl;
+        {
+            Obj mX(&loader, &sa);
+
+            // Load each timetable once, so that the index of the cache is
+            // allocated before the memory in use is measured.
+
+            mX.getTimetable("CAL-1");
+            mX.getTimetable("CAL-2");
+            mX.getTimetable("CAL-3");
+            mX.invalidateAll();
+
+            const bsls::Types::Int64 saLastNumBlocksInUse =
+                                                           sa.numBlocksInUse();
+
+            enum { k_NUM_READERS = 4 };
+
+            const int NUM_TEST_ITERATIONS   =   10;
+            const int NUM_THREAD_ITERATIONS = 2000;
+
+            ThreadInfo readerInfo[k_NUM_READERS];
+            ThreadInfo writerInfo = { NUM_THREAD_ITERATIONS / 10, &mX, 0 };
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                ThreadInfo info = { NUM_THREAD_ITERATIONS, &mX, i };
+                readerInfo[i] = info;
+            }
+
+            for (int ti = 0; ti < NUM_TEST_ITERATIONS; ++ti) {
+
+                if (veryVerbose) P(ti);
+
+                ThreadId ids[k_NUM_READERS];
+
+                for (int i = 0; i < k_NUM_READERS; ++i) {
+                    ids[i] = createThread(&readerFunction, &readerInfo[i]);
+                }
+
+                ThreadId writerId = createThread(&writerFunction,
+                                                 &writerInfo);
+
+                for (int i = 0; i < k_NUM_READERS; ++i) {
+                    joinThread(ids[i]);
+                }
+                joinThread(writerId);
+            }
+
+            mX.invalidateAll();
+
+            LOOP2_ASSERT(saLastNumBlocksInUse, sa.numBlocksInUse(),
+                         saLastNumBlocksInUse == sa.numBlocksInUse());
+        }
+        LOOP_ASSERT(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        LOOP_ASSERT(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting reclamation during lookups." << endl;
+        {
+            Obj mX(&loader, &sa);
+
+            // Load "CAL-2" once, so that the index of the cache is allocated
+            // before the memory in use is measured.
+
+            mX.getTimetable("CAL-2");
+            mX.invalidate("CAL-2");
+            mX.getTimetable("CAL-1");
+
+            const bsls::Types::Int64 saLastNumBlocksInUse =
+                                                           sa.numBlocksInUse();
+
+            enum { k_NUM_READERS = 4, k_NUM_MODIFICATIONS = 500 };
+
+            bsls::AtomicInt isDone(0);
+            LookupInfo      info = { &mX, &isDone };
+
+            ThreadId ids[k_NUM_READERS];
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                ids[i] = createThread(&lookupFunction, &info);
+            }
+
+            for (int i = 0; i < k_NUM_MODIFICATIONS; ++i) {
+                ASSERT(mX.getTimetable("CAL-2"));
+                ASSERT(1 == mX.invalidate("CAL-2"));
+
+                LOOP3_ASSERT(i, saLastNumBlocksInUse, sa.numBlocksInUse(),
+                             saLastNumBlocksInUse == sa.numBlocksInUse());
+            }
+
+            isDone = 1;
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                joinThread(ids[i]);
+            }
+        }
+        LOOP_ASSERT(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        LOOP_ASSERT(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting growth of the index." << endl;
+        {
+            NumberedLoader numberedLoader;
+
+            Obj mX(&numberedLoader, &sa);  const Obj& X = mX;
+
+            Handle mH(&mX, &sa);
+
+            enum { k_NUM_TIMETABLES = 1000 };
+
+            char name[32];
+
+            for (int i = 0; i < k_NUM_TIMETABLES; ++i) {
+                bsl::sprintf(name, "NUM-%d", i);
+
+                const bdlt::Timetable *timetable = mH.getTimetable(name);
+
+                LOOP_ASSERT(i, timetable);
+                if (timetable) {
+                    LOOP_ASSERT(i, gFirstDate1 + i == timetable->firstDate());
+                }
+            }
+
+            for (int i = 0; i < k_NUM_TIMETABLES; ++i) {
+                bsl::sprintf(name, "NUM-%d", i);
+
+                Entry e = X.lookupTimetable(name);
+
+                LOOP_ASSERT(i, e.get());
+                LOOP_ASSERT(i, e.get() == mH.getTimetable(name));
+            }
+
+            for (int i = 1; i < k_NUM_TIMETABLES; i += 2) {
+                bsl::sprintf(name, "NUM-%d", i);
+
+                LOOP_ASSERT(i, 1 == mX.invalidate(name));
+            }
+
+            for (int i = 0; i < k_NUM_TIMETABLES; ++i) {
+                bsl::sprintf(name, "NUM-%d", i);
+
+                Entry e = X.lookupTimetable(name);
+
+                LOOP_ASSERT(i, (0 == i % 2) == (0 != e.get()));
+                if (e.get()) {
+                    LOOP_ASSERT(i, e.get() == mH.getTimetable(name));
+                }
+            }
+
+            ASSERT(k_NUM_TIMETABLES / 2 == mX.invalidateAll());
+            ASSERT(0                    == mX.invalidateAll());
+
+            ASSERT(!X.lookupTimetable("NUM-0"));
+        }
+        LOOP_ASSERT(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        LOOP_ASSERT(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // 'TimetableCacheHandle'
+        //   Ensure that a handle obtains current timetables from its cache.
+        //
+        // Concerns:
+        //: 1 A handle is created holding no timetables, and refers to the
+        //:   cache and uses the allocator supplied at construction (or the
+        //:   default allocator if none is supplied).
+        //:
+        //: 2 'getTimetable' returns the timetable in the cache, loading it
+        //:   into the cache if necessary, and returns 0 if the loader fails.
+        //:
+        //: 3 A repeated request for a timetable that is current returns the
+        //:   same timetable and allocates no memory.
+        //:
+        //: 4 A request for a timetable that has been invalidated or reloaded
+        //:   in the cache, or that has expired, returns the timetable
+        //:   currently in the cache.
+        //:
+        //: 5 Invalidating or loading a timetable does not affect the other
+        //:   timetables held by the handle.
+        //:
+        //: 6 A request for a timetable that has been invalidated, or that has
+        //:   expired, returns 0 if the loader fails, and the handle no longer
+        //:   holds the timetable.
+        //:
+        //: 7 'clear' releases the timetables held by the handle.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create handles with and without an allocator, and verify the
+        //:   accessors.  (C-1)
+        //:
+        //: 2 Using a cache without a timeout, obtain timetables through a
+        //:   handle, and compare them with those returned by the cache,
+        //:   monitoring memory use.  (C-2..3)
+        //:
+        //: 3 Invalidate and reload timetables through the cache, and verify
+        //:   the timetables subsequently obtained through the handle, and that
+        //:   requests for the other timetables allocate no memory.  (C-4..5)
+        //:
+        //: 4 Using a cache having a timeout of 0, verify that each request
+        //:   through a handle reloads the timetable.  (C-4)
+        //:
+        //: 5 Set the loader to fail, invalidate a timetable held by a handle
+        //:   (or let it expire), and verify that requesting it through the
+        //:   handle returns 0 and removes it from the handle.  (C-6)
+        //:
+        //: 6 Clear the handle, and verify the number of timetables it holds
+        //:   and that invalidating the cache then releases memory.  (C-7)
+        //:
+        //: 7 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for argument values.  (C-8)
+        //
+        // Testing:
+        //   TimetableCacheHandle(TimetableCache *cache, Allocator *ba = 0);
+        //   ~TimetableCacheHandle();
+        //   void clear();
+        //   const Timetable *getTimetable(const char *name);
+        //   TimetableCache *cache() const;
+        //   bsl::size_t numTimetables() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'TimetableCacheHandle'" << endl
+                          << "======================" << endl;
+
+        TestLoader loader;
+
+        bslma::TestAllocator da("default",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+        bslma::TestAllocator ha("handle",   veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\nTesting creators and accessors." << endl;
+        {
+            Obj mX(&loader, &sa);
+
+            const Handle H(&mX);
+
+            ASSERT(&mX == H.cache());
+            ASSERT(0   == H.numTimetables());
+            ASSERT(&da == H.allocator());
+
+            const Handle G(&mX, &ha);
+
+            ASSERT(&mX == G.cache());
+            ASSERT(0   == G.numTimetables());
+            ASSERT(&ha == G.allocator());
+        }
+        LOOP_ASSERT(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+        LOOP_ASSERT(sa.numBlocksTotal(), 0 == sa.numBlocksTotal());
+        LOOP_ASSERT(ha.numBlocksTotal(), 0 == ha.numBlocksTotal());
+
+        if (verbose) cout << "\nTesting without a timeout." << endl;
+        {
+            Obj mX(&loader, &sa);  const Obj& X = mX;
+
+            Handle mH(&mX, &ha);  const Handle& H = mH;
+
+            ASSERT(0 == mH.getTimetable("ERROR"));
+            ASSERT(0 == mH.getTimetable("CAL-Z"));
+            ASSERT(0 == H.numTimetables());
+
+            const bdlt::Timetable *c1 = mH.getTimetable("CAL-1");
+
+            ASSERT(c1);
+            ASSERT(c1->firstDate() == gFirstDate1);
+            ASSERT(c1 == X.lookupTimetable("CAL-1").get());
+            ASSERT(1  == H.numTimetables());
+
+            LOOP_ASSERT(ha.numBlocksInUse(), 0 < ha.numBlocksInUse());
+
+            const bdlt::Timetable *c3 = mH.getTimetable("CAL-3");
+            const bdlt::Timetable *c2 = mH.getTimetable("CAL-2");
+
+            ASSERT(c2);
+            ASSERT(c2->firstDate() == gFirstDate2);
+            ASSERT(c3);
+            ASSERT(c3->firstDate() == gFirstDate3);
+            ASSERT(3  == H.numTimetables());
+
+            // Repeated requests.
+
+            const bsls::Types::Int64 saLastNumBlocksTotal =
+                                                           sa.numBlocksTotal();
+            const bsls::Types::Int64 haLastNumBlocksTotal =
+                                                           ha.numBlocksTotal();
+
+            for (int i = 0; i < 3; ++i) {
+                ASSERT(c1 == mH.getTimetable("CAL-1"));
+                ASSERT(c2 == mH.getTimetable("CAL-2"));
+                ASSERT(c3 == mH.getTimetable("CAL-3"));
+            }
+            ASSERT(3 == H.numTimetables());
+
+            LOOP2_ASSERT(saLastNumBlocksTotal, sa.numBlocksTotal(),
+                         saLastNumBlocksTotal == sa.numBlocksTotal());
+            LOOP2_ASSERT(haLastNumBlocksTotal, ha.numBlocksTotal(),
+                         haLastNumBlocksTotal == ha.numBlocksTotal());
+
+            // A failed load is not held by the handle.  Note that the cache
+            // allocates the timetable before invoking the loader.
+
+            ASSERT(0 == mH.getTimetable("CAL-Z"));
+            ASSERT(3 == H.numTimetables());
+
+            // Invalidation.  References are held so that the addresses of the
+            // invalidated timetables cannot be reused.
+
+            Entry e1 = X.lookupTimetable("CAL-1");
+            Entry e2 = X.lookupTimetable("CAL-2");
+
+            ASSERT(1 == mX.invalidate("CAL-2"));
+
+            {
+                const bsls::Types::Int64 saLastNumBlocksTotal =
+                                                           sa.numBlocksTotal();
+                const bsls::Types::Int64 haLastNumBlocksTotal =
+                                                           ha.numBlocksTotal();
+
+                ASSERT(c1 == mH.getTimetable("CAL-1"));
+                ASSERT(c3 == mH.getTimetable("CAL-3"));
+
+                LOOP2_ASSERT(saLastNumBlocksTotal, sa.numBlocksTotal(),
+                             saLastNumBlocksTotal == sa.numBlocksTotal());
+                LOOP2_ASSERT(haLastNumBlocksTotal, ha.numBlocksTotal(),
+                             haLastNumBlocksTotal == ha.numBlocksTotal());
+            }
+
+            const bdlt::Timetable *c2b = mH.getTimetable("CAL-2");
+
+            ASSERT(c2b);
+            ASSERT(c2b != c2);
+            ASSERT(c2b == X.lookupTimetable("CAL-2").get());
+
+            // A timetable reloaded through the cache is observed.
+
+            ASSERT(3 == mX.invalidateAll());
+
+            Entry e1b = mX.getTimetable("CAL-1");
+
+            ASSERT(e1b.get() != c1);
+            ASSERT(e1b.get() == mH.getTimetable("CAL-1"));
+            ASSERT(3 == H.numTimetables());
+
+            // Clearing.
+
+            mH.clear();
+            ASSERT(0 == H.numTimetables());
+
+            e1.reset();
+            e2.reset();
+            e1b.reset();
+
+            const bsls::Types::Int64 saLastNumBlocksInUse =
+                                                           sa.numBlocksInUse();
+
+            ASSERT(1 == mX.invalidateAll());
+
+            LOOP2_ASSERT(saLastNumBlocksInUse, sa.numBlocksInUse(),
+                         saLastNumBlocksInUse > sa.numBlocksInUse());
+
+            ASSERT(mH.getTimetable("CAL-2"));
+            ASSERT(1 == H.numTimetables());
+        }
+        LOOP_ASSERT(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        LOOP_ASSERT(ha.numBlocksInUse(), 0 == ha.numBlocksInUse());
+        LOOP_ASSERT(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting with a timeout." << endl;
+        {
+            Obj mX(&loader, Interval(0, 0), &sa);
+
+            Handle mH(&mX, &ha);
+
+            ASSERT(mH.getTimetable("CAL-1"));
+
+            for (int i = 0; i < 3; ++i) {
+                const bsls::Types::Int64 saLastNumBlocksTotal =
+                                                           sa.numBlocksTotal();
+
+                const bdlt::Timetable *c = mH.getTimetable("CAL-1");
+
+                ASSERT(c);
+                ASSERT(c->firstDate() == gFirstDate1);
+
+                LOOP2_ASSERT(saLastNumBlocksTotal, sa.numBlocksTotal(),
+                             saLastNumBlocksTotal < sa.numBlocksTotal());
+            }
+        }
+        {
+            Obj mX(&loader, Interval(60, 0), &sa);
+
+            Handle mH(&mX, &ha);
+
+            const bdlt::Timetable *c = mH.getTimetable("CAL-1");
+
+            const bsls::Types::Int64 saLastNumBlocksTotal =
+                                                           sa.numBlocksTotal();
+
+            ASSERT(c == mH.getTimetable("CAL-1"));
+
+            LOOP2_ASSERT(saLastNumBlocksTotal, sa.numBlocksTotal(),
+                         saLastNumBlocksTotal == sa.numBlocksTotal());
+        }
+        LOOP_ASSERT(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        LOOP_ASSERT(ha.numBlocksInUse(), 0 == ha.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting failed reload." << endl;
+        {
+            Obj mX(&loader, &sa);
+
+            Handle mH(&mX, &ha);  const Handle& H = mH;
+
+            ASSERT(mH.getTimetable("CAL-1"));
+            ASSERT(mH.getTimetable("CAL-2"));
+            ASSERT(2 == H.numTimetables());
+
+            loader.setFail(true);
+
+            ASSERT(1 == mX.invalidate("CAL-1"));
+
+            ASSERT(0 == mH.getTimetable("CAL-1"));
+            ASSERT(1 == H.numTimetables());
+            ASSERT(0 == mH.getTimetable("CAL-1"));
+            ASSERT(mH.getTimetable("CAL-2"));
+
+            loader.setFail(false);
+
+            const bdlt::Timetable *c1 = mH.getTimetable("CAL-1");
+
+            ASSERT(c1);
+            ASSERT(c1 == mX.lookupTimetable("CAL-1").get());
+            ASSERT(2  == H.numTimetables());
+        }
+        {
+            Obj mX(&loader, Interval(0, 0), &sa);
+
+            Handle mH(&mX, &ha);  const Handle& H = mH;
+
+            ASSERT(mH.getTimetable("CAL-1"));
+
+            loader.setFail(true);
+
+            ASSERT(0 == mH.getTimetable("CAL-1"));
+            ASSERT(0 == H.numTimetables());
+
+            loader.setFail(false);
+        }
+        LOOP_ASSERT(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+        LOOP_ASSERT(ha.numBlocksInUse(), 0 == ha.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&loader, &sa);
+
+            ASSERT_PASS(Handle(&mX, &ha));
+            ASSERT_FAIL(Handle(  0, &ha));
+
+            Handle mH(&mX, &ha);
+
+            ASSERT_PASS(mH.getTimetable("CAL-1"));
+            ASSERT_FAIL(mH.getTimetable(0));
+        }
+
       } break;
       case 6: {
         // --------------------------------------------------------------------
@@ -1532,22 +2298,22 @@ int main(int argc, char *argv[])
                 e = mX.getTimetable("ERROR");      ASSERT(!e.get());
 
                 LOOP_ASSERT(da.numBlocksTotal(), 0 == da.numBlocksTotal());
-                LOOP_ASSERT(sa.numBlocksTotal(), 0 <  sa.numBlocksTotal());
+                LOOP_ASSERT(sa.numBlocksTotal(), 0 == sa.numBlocksTotal());
 
                 e = mX.getTimetable("CAL-Z");      ASSERT(!e.get());
 
                 LOOP_ASSERT(da.numBlocksTotal(), 0 == da.numBlocksTotal());
-                LOOP_ASSERT(sa.numBlocksTotal(), 0 <  sa.numBlocksTotal());
+                LOOP_ASSERT(sa.numBlocksTotal(), 0 == sa.numBlocksTotal());
 
                 e = X.lookupTimetable("CAL-Z");    ASSERT(!e.get());
 
                 LOOP_ASSERT(da.numBlocksTotal(), 0 == da.numBlocksTotal());
-                LOOP_ASSERT(sa.numBlocksTotal(), 0 <  sa.numBlocksTotal());
+                LOOP_ASSERT(sa.numBlocksTotal(), 0 == sa.numBlocksTotal());
 
                 d = X.lookupLoadTime("CAL-Z");    ASSERT(d == Datetime());
 
                 LOOP_ASSERT(da.numBlocksTotal(), 0 == da.numBlocksTotal());
-                LOOP_ASSERT(sa.numBlocksTotal(), 0 <  sa.numBlocksTotal());
+                LOOP_ASSERT(sa.numBlocksTotal(), 0 == sa.numBlocksTotal());
             }
 
             bsls::Types::Int64 daLastNumBlocksTotal, saLastNumBlocksTotal;
@@ -1612,7 +2378,7 @@ int main(int argc, char *argv[])
                 LOOP2_ASSERT(daLastNumBlocksTotal, da.numBlocksTotal(),
                              daLastNumBlocksTotal == da.numBlocksTotal());
                 LOOP2_ASSERT(saLastNumBlocksTotal, sa.numBlocksTotal(),
-                             saLastNumBlocksTotal <  sa.numBlocksTotal());
+                             saLastNumBlocksTotal == sa.numBlocksTotal());
             }
 
             // Cache with two entries.
@@ -2292,6 +3058,133 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'lookupTimetable' AND 'TimetableCacheHandle'
+        //
+        // Concerns:
+        //: 1 Obtaining a cached timetable through a handle is cheaper than
+        //:   obtaining it through the cache.
+        //
+        // Plan:
+        //: 1 Time repeated requests for cached timetables through
+        //:   'getTimetable', 'lookupTimetable', and a handle, and report the
+        //:   average time per request.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: 'lookupTimetable' AND 'TimetableCacheHandle'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "PERFORMANCE: 'lookupTimetable' AND 'TimetableCacheHandle'"
+                 << endl
+                 << "========================================================="
+                 << endl;
+
+        TestLoader loader;
+
+        Obj mX(&loader);  const Obj& X = mX;
+
+        Handle mH(&mX);
+
+        static const char *NAMES[] = { "CAL-1", "CAL-2", "CAL-3" };
+
+        const int NUM_ITERATIONS = 3000000;
+
+        for (int i = 0; i < 3; ++i) {
+            ASSERT(mX.getTimetable(NAMES[i]).get());
+        }
+
+        bsls::Types::Int64 sum = 0;
+
+        Datetime start = bdlt::CurrentTime::utc();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            sum += mX.getTimetable(NAMES[i % 3])->length();
+        }
+        const double getNs    = (bdlt::CurrentTime::utc() - start)
+                                                        .totalSecondsAsDouble()
+                                * 1e9 / NUM_ITERATIONS;
+
+        start = bdlt::CurrentTime::utc();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            sum += X.lookupTimetable(NAMES[i % 3])->length();
+        }
+        const double lookupNs = (bdlt::CurrentTime::utc() - start)
+                                                        .totalSecondsAsDouble()
+                                * 1e9 / NUM_ITERATIONS;
+
+        start = bdlt::CurrentTime::utc();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            sum += mH.getTimetable(NAMES[i % 3])->length();
+        }
+        const double handleNs = (bdlt::CurrentTime::utc() - start)
+                                                        .totalSecondsAsDouble()
+                                * 1e9 / NUM_ITERATIONS;
+
+        ASSERT(0 < sum);
+
+        cout << "getTimetable:    " << getNs    << " ns" << endl
+             << "lookupTimetable: " << lookupNs << " ns" << endl
+             << "handle:          " << handleNs << " ns" << endl;
+      } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: LOADING AND INVALIDATING MANY TIMETABLES
+        //
+        // Concerns:
+        //: 1 The cost of loading a timetable into, or invalidating a timetable
+        //:   in, the cache does not grow with the number of timetables in the
+        //:   cache.
+        //
+        // Plan:
+        //: 1 For increasing numbers of timetables, time loading each timetable
+        //:   into an empty cache, and then invalidating each timetable, and
+        //:   report the average time per timetable.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: LOADING AND INVALIDATING MANY TIMETABLES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "PERFORMANCE: LOADING AND INVALIDATING MANY TIMETABLES"
+                 << endl
+                 << "====================================================="
+                 << endl;
+
+        NumberedLoader loader;
+
+        static const int NUM_TIMETABLES[] = { 1000, 10000, 100000 };
+
+        char name[32];
+
+        for (int ti = 0; ti < 3; ++ti) {
+            const int N = NUM_TIMETABLES[ti];
+
+            Obj mX(&loader);
+
+            Datetime start = bdlt::CurrentTime::utc();
+            for (int i = 0; i < N; ++i) {
+                bsl::sprintf(name, "NUM-%d", i);
+                ASSERT(mX.getTimetable(name).get());
+            }
+            const double loadNs = (bdlt::CurrentTime::utc() - start)
+                                                        .totalSecondsAsDouble()
+                                  * 1e9 / N;
+
+            start = bdlt::CurrentTime::utc();
+            for (int i = 0; i < N; ++i) {
+                bsl::sprintf(name, "NUM-%d", i);
+                ASSERT(1 == mX.invalidate(name));
+            }
+            const double invalidateNs = (bdlt::CurrentTime::utc() - start)
+                                                        .totalSecondsAsDouble()
+                                        * 1e9 / N;
+
+            cout << N << " timetables:" << endl
+                 << "  getTimetable: " << loadNs       << " ns" << endl
+                 << "  invalidate:   " << invalidateNs << " ns" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -0,0 +1,88 @@
+// bslmt_graceperiod.cpp                                              -*-C++-*-
+#include <bslmt_graceperiod.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bslmt_graceperiod_cpp,"$Id$ $CSID$")
+
+#include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
+
+// IMPLEMENTATION NOTES
+// --------------------
+// This is the "left-right" grace-period algorithm.  Suppose that a reader 'R'
+// loaded the pointer to an object replaced before the writer called
+// 'synchronize'.  'R' incremented the counter of the phase it observed before
+// loading the pointer, and hence before the writer replaced it.  If 'R'
+// observed the phase active when 'synchronize' was called, the second wait
+// (for that counter to drain) waits for 'R'.  Otherwise, 'R' observed the
+// phase that is about to be activated, and the first wait (for that counter
+// to drain, which no reader entering during the first wait increments) waits
+// for 'R'.  All operations on 'd_phase' and 'd_numReaders' are sequentially
+// consistent.
+
+namespace BloombergLP {
+namespace bslmt {
+namespace {
+
+void waitUntilDrained(const bsls::AtomicInt& numReaders)
+    // Block until the specified 'numReaders' is 0, yielding the processor
+    // while it is not.
+{
+    while (0 != numReaders.load()) {
+        ThreadUtil::yield();
+    }
+}
+
+}  // close unnamed namespace
+
+                            // -----------------
+                            // class GracePeriod
+                            // -----------------
+
+// CREATORS
+GracePeriod::GracePeriod()
+: d_phase(0)
+, d_synchronizeLock()
+{
+    d_numReaders[0] = 0;
+    d_numReaders[1] = 0;
+}
+
+GracePeriod::~GracePeriod()
+{
+    BSLS_ASSERT(0 == numReaders());
+}
+
+// MANIPULATORS
+void GracePeriod::synchronize()
+{
+    LockGuard<Mutex> guard(&d_synchronizeLock);
+
+    const int previous = d_phase.loadRelaxed();
+    const int next     = 1 - previous;
+
+    waitUntilDrained(d_numReaders[next]);
+
+    d_phase = next;
+
+    waitUntilDrained(d_numReaders[previous]);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,299 @@
+// bslmt_graceperiod.h                                                -*-C++-*-
+#ifndef INCLUDED_BSLMT_GRACEPERIOD
+#define INCLUDED_BSLMT_GRACEPERIOD
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a mechanism to wait for lock-free readers to finish.
+//
+//@CLASSES:
+//  bslmt::GracePeriod: tracks readers, and waits for those in progress
+//  bslmt::GracePeriodReadGuard: scoped guard for a reader of a 'GracePeriod'
+//
+//@SEE_ALSO: bslmt_readerwritermutex
+//
+//@DESCRIPTION: This component defines a mechanism, 'bslmt::GracePeriod', that
+// allows an object published through an atomic pointer to be read without
+// locking, and to be destroyed safely once it has been replaced.  A reader
+// brackets its use of the published object with calls to 'enterReader' and
+// 'leaveReader' (or with a 'bslmt::GracePeriodReadGuard').  A writer that has
+// replaced the published object calls 'synchronize', which blocks until every
+// reader that was in progress when 'synchronize' was called has finished; no
+// reader can then refer to the replaced object, which the writer may destroy.
+//
+// 'synchronize' does not wait for readers that start after it is called, so a
+// writer makes progress however steadily readers arrive, and at most one
+// replaced object exists at any time for each writer.  The readers are
+// counted in one of two counters, selected by a *phase* that 'synchronize'
+// toggles: 'synchronize' first waits for the counter of the inactive phase to
+// drain, then directs new readers to that counter, and then waits for the
+// counter of the previously active phase to drain.
+//
+// Entering and leaving are each a single atomic read-modify-write operation
+// on a counter shared by all readers, and neither blocks.  'synchronize' may
+// block, yielding the processor, for as long as the longest reader in
+// progress, so a reader should hold the published object only briefly, and
+// must not call 'synchronize' itself.
+//
+///Memory Ordering
+///---------------
+// A reader must load the published pointer *after* 'enterReader' returns,
+// and the writer must store the replacement pointer *before* calling
+// 'synchronize', both using sequentially consistent operations (e.g.,
+// 'bsls::AtomicPointer::load' and 'bsls::AtomicPointer::swap').
+//
+///Thread Safety
+///-------------
+// 'bslmt::GracePeriod' is fully thread-safe (see 'bsldoc_glossary'): any
+// number of threads may enter and leave as readers while any number of
+// threads call 'synchronize' (calls to 'synchronize' are serialized).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Replacing a Published Configuration
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server reads a configuration on every request, and that the
+// configuration is occasionally replaced.  We publish the configuration
+// through an atomic pointer, so that requests read it without locking.
+//
+// First, we define the configuration and a class that publishes it:
+//..
+//  struct Config {
+//      int d_maxConnections;
+//  };
+//
+//  class ConfigPublisher {
+//      // This class publishes a configuration that may be read without
+//      // locking.
+//
+//      // DATA
+//      bsls::AtomicPointer<Config> d_config_p;     // current configuration
+//                                                  // (owned)
+//
+//      bslmt::GracePeriod          d_gracePeriod;  // readers of
+//                                                  // 'd_config_p'
+//
+//    public:
+//      // CREATORS
+//      explicit ConfigPublisher(int maxConnections)
+//          // Create a publisher of a configuration having the specified
+//          // 'maxConnections'.
+//      : d_config_p(new Config())
+//      {
+//          d_config_p.load()->d_maxConnections = maxConnections;
+//      }
+//
+//      ~ConfigPublisher()
+//          // Destroy this object.
+//      {
+//          delete d_config_p.load();
+//      }
+//
+//      // MANIPULATORS
+//      int maxConnections()
+//          // Return the maximum number of connections of the current
+//          // configuration.
+//      {
+//          bslmt::GracePeriodReadGuard guard(&d_gracePeriod);
+//
+//          return d_config_p.load()->d_maxConnections;
+//      }
+//..
+// Then, we define the method that replaces the configuration.  Once the new
+// configuration is published, 'synchronize' waits for the readers that may
+// still be reading the previous one, which can then be destroyed:
+//..
+//      void setMaxConnections(int maxConnections)
+//          // Publish a configuration having the specified 'maxConnections'.
+//      {
+//          Config *config = new Config();
+//          config->d_maxConnections = maxConnections;
+//
+//          Config *previous = d_config_p.swap(config);
+//
+//          d_gracePeriod.synchronize();
+//
+//          delete previous;
+//      }
+//  };
+//..
+// Finally, we use the publisher:
+//..
+//  ConfigPublisher publisher(10);
+//  assert(10 == publisher.maxConnections());
+//
+//  publisher.setMaxConnections(20);
+//  assert(20 == publisher.maxConnections());
+//..
+
+#include <bslscm_version.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+
+namespace BloombergLP {
+namespace bslmt {
+
+                            // =================
+                            // class GracePeriod
+                            // =================
+
+class GracePeriod {
+    // This class tracks the readers of an object published without locking,
+    // and waits for the readers in progress to finish so that a replaced
+    // object may be destroyed.
+
+    // DATA
+    bsls::AtomicInt d_phase;           // index of the counter incremented by
+                                       // entering readers
+
+    bsls::AtomicInt d_numReaders[2];   // number of readers in progress, by
+                                       // the phase at which they entered
+
+    Mutex           d_synchronizeLock; // serializes 'synchronize'
+
+  private:
+    // NOT IMPLEMENTED
+    GracePeriod(const GracePeriod&);
+    GracePeriod& operator=(const GracePeriod&);
+
+  public:
+    // CREATORS
+    GracePeriod();
+        // Create an object having no readers in progress.
+
+    ~GracePeriod();
+        // Destroy this object.  The behavior is undefined unless no reader is
+        // in progress and no thread is calling 'synchronize'.
+
+    // MANIPULATORS
+    int enterReader();
+        // Record that the calling thread has started reading, and return the
+        // token that must be supplied to the 'leaveReader' call that records
+        // that the read has finished.  This method does not block.
+
+    void leaveReader(int token);
+        // Record that the calling thread has finished the read that was
+        // started by the 'enterReader' call that returned the specified
+        // 'token'.  This method does not block.  The behavior is undefined
+        // unless 'token' was returned by an 'enterReader' call on this object
+        // for which 'leaveReader' has not been called.
+
+    void synchronize();
+        // Block until every reader that was in progress when this method was
+        // called has finished.  The behavior is undefined if the calling
+        // thread is a reader in progress of this object.
+
+    // ACCESSORS
+    int numReaders() const;
+        // Return the number of readers in progress.  Note that this method is
+        // provided primarily for debugging purposes, and that its result may
+        // be out of date by the time it is returned.
+};
+
+                        // ==========================
+                        // class GracePeriodReadGuard
+                        // ==========================
+
+class GracePeriodReadGuard {
+    // This class implements a scoped guard that records a reader of a
+    // 'GracePeriod' for the lifetime of the guard.
+
+    // DATA
+    GracePeriod *d_gracePeriod_p;  // tracked grace period (held, not owned)
+
+    int          d_token;          // token returned by 'enterReader'
+
+  private:
+    // NOT IMPLEMENTED
+    GracePeriodReadGuard(const GracePeriodReadGuard&);
+    GracePeriodReadGuard& operator=(const GracePeriodReadGuard&);
+
+  public:
+    // CREATORS
+    explicit GracePeriodReadGuard(GracePeriod *gracePeriod);
+        // Create a guard that records the calling thread as a reader of the
+        // specified 'gracePeriod' until this guard is destroyed.
+
+    ~GracePeriodReadGuard();
+        // Record that the read recorded by this guard has finished, and
+        // destroy this guard.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                            // -----------------
+                            // class GracePeriod
+                            // -----------------
+
+// MANIPULATORS
+inline
+int GracePeriod::enterReader()
+{
+    const int token = d_phase.load();
+
+    ++d_numReaders[token];
+
+    return token;
+}
+
+inline
+void GracePeriod::leaveReader(int token)
+{
+    BSLS_ASSERT_SAFE(0 == token || 1 == token);
+
+    --d_numReaders[token];
+}
+
+// ACCESSORS
+inline
+int GracePeriod::numReaders() const
+{
+    return d_numReaders[0].load() + d_numReaders[1].load();
+}
+
+                        // --------------------------
+                        // class GracePeriodReadGuard
+                        // --------------------------
+
+// CREATORS
+inline
+GracePeriodReadGuard::GracePeriodReadGuard(GracePeriod *gracePeriod)
+: d_gracePeriod_p(gracePeriod)
+, d_token(gracePeriod->enterReader())
+{
+}
+
+inline
+GracePeriodReadGuard::~GracePeriodReadGuard()
+{
+    d_gracePeriod_p->leaveReader(d_token);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,646 @@
+// bslmt_graceperiod.t.cpp                                            -*-C++-*-
+#include <bslmt_graceperiod.h>
+
+#include <bslmt_threadgroup.h>    // for testing only
+#include <bslmt_threadutil.h>     // for testing only
+
+#include <bslim_testutil.h>
+
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bslmt::GracePeriod' counts the readers in progress, and 'synchronize' waits
+// for those that were in progress when it was called.  We first test the
+// counting, through the manipulators and through the guard, in a single
+// thread.  We then test that 'synchronize' waits for a reader in progress but
+// not for a reader that entered after 'synchronize' was called.  Finally, we
+// replace and destroy an object repeatedly while many threads read it without
+// locking, and verify that no reader observes a destroyed object, that the
+// writer makes progress although readers are always in progress, and that at
+// most one replaced object is alive at any time.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] GracePeriod();
+// [ 1] ~GracePeriod();
+// [ 2] GracePeriodReadGuard(GracePeriod *gracePeriod);
+// [ 2] ~GracePeriodReadGuard();
+//
+// MANIPULATORS
+// [ 1] int enterReader();
+// [ 1] void leaveReader(int token);
+// [ 3] void synchronize();
+//
+// ACCESSORS
+// [ 1] int numReaders() const;
+// ----------------------------------------------------------------------------
+// [ 4] CONCURRENCY: READERS AND REPLACEMENT
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bslmt::GracePeriod          Obj;
+typedef bslmt::GracePeriodReadGuard Guard;
+
+bool verbose             = false;
+bool veryVerbose         = false;
+bool veryVeryVerbose     = false;
+bool veryVeryVeryVerbose = false;
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace TestCase3 {
+
+class SynchronizeJob {
+    // This class provides a functor that calls 'synchronize' on a grace
+    // period, then sets a flag.
+
+    // DATA
+    Obj             *d_gracePeriod_p;  // grace period (held, not owned)
+    bsls::AtomicInt *d_isDone_p;       // flag set on return (held, not owned)
+
+  public:
+    // CREATORS
+    SynchronizeJob(Obj *gracePeriod, bsls::AtomicInt *isDone)
+        // Create a functor that calls 'synchronize' on the specified
+        // 'gracePeriod', then sets the specified 'isDone' to 1.
+    : d_gracePeriod_p(gracePeriod)
+    , d_isDone_p(isDone)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Call 'synchronize', then set the flag.
+    {
+        d_gracePeriod_p->synchronize();
+
+        *d_isDone_p = 1;
+    }
+};
+
+}  // close namespace TestCase3
+
+namespace TestCase4 {
+
+enum { k_ALIVE = 0x600D, k_DEAD = 0xDEAD };
+
+struct Value {
+    // This 'struct' is the object published by the writer of this test case.
+
+    int d_state;  // 'k_ALIVE' until the object is about to be destroyed
+};
+
+struct Shared {
+    // This 'struct' holds the state shared by the threads of this test case.
+
+    Obj                        d_gracePeriod;  // readers of 'd_value_p'
+
+    bsls::AtomicPointer<Value> d_value_p;      // published object (owned)
+
+    bsls::AtomicInt            d_isDone;       // 1 once the writer is done
+
+    bsls::AtomicInt            d_numReads;     // reads by all readers
+
+    bslma::TestAllocator      *d_allocator_p;  // allocator of 'Value's
+};
+
+class ReaderJob {
+    // This class provides a functor that reads the published value without
+    // locking until the writer is done, checking that the value has not been
+    // destroyed.
+
+    // DATA
+    Shared *d_shared_p;  // shared state (held, not owned)
+
+  public:
+    // CREATORS
+    explicit ReaderJob(Shared *shared)
+        // Create a functor that reads the value published in the specified
+        // 'shared'.
+    : d_shared_p(shared)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Read the published value until the writer is done.
+    {
+        while (!d_shared_p->d_isDone.load()) {
+            Guard guard(&d_shared_p->d_gracePeriod);
+
+            const Value *value = d_shared_p->d_value_p.load();
+
+            ASSERTV(value->d_state, k_ALIVE == value->d_state);
+
+            bslmt::ThreadUtil::yield();
+
+            ASSERTV(value->d_state, k_ALIVE == value->d_state);
+
+            ++d_shared_p->d_numReads;
+        }
+    }
+};
+
+void writerThread(Shared *shared, int numReplacements)
+    // Replace the value published in the specified 'shared' the specified
+    // 'numReplacements' times, destroying each replaced value once no reader
+    // can refer to it, and checking that at most one value is then allocated.
+{
+    bslma::TestAllocator *allocator = shared->d_allocator_p;
+
+    for (int i = 0; i < numReplacements; ++i) {
+        Value *value = new (*allocator) Value();
+        value->d_state = k_ALIVE;
+
+        Value *previous = shared->d_value_p.swap(value);
+
+        shared->d_gracePeriod.synchronize();
+
+        previous->d_state = k_DEAD;
+        allocator->deleteObject(previous);
+
+        ASSERTV(i, allocator->numBlocksInUse(),
+                1 == allocator->numBlocksInUse());
+    }
+
+    shared->d_isDone = 1;
+}
+
+}  // close namespace TestCase4
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace BSLMT_USAGE_EXAMPLE_1 {
+
+///Example 1: Replacing a Published Configuration
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server reads a configuration on every request, and that the
+// configuration is occasionally replaced.  We publish the configuration
+// through an atomic pointer, so that requests read it without locking.
+//
+// First, we define the configuration and a class that publishes it:
+//..
+    struct Config {
+        int d_maxConnections;
+    };
+
+    class ConfigPublisher {
+        // This class publishes a configuration that may be read without
+        // locking.
+
+        // DATA
+        bsls::AtomicPointer<Config> d_config_p;     // current configuration
+                                                    // (owned)
+
+        bslmt::GracePeriod          d_gracePeriod;  // readers of
+                                                    // 'd_config_p'
+
+      public:
+        // CREATORS
+        explicit ConfigPublisher(int maxConnections)
+            // Create a publisher of a configuration having the specified
+            // 'maxConnections'.
+        : d_config_p(new Config())
+        {
+            d_config_p.load()->d_maxConnections = maxConnections;
+        }
+
+        ~ConfigPublisher()
+            // Destroy this object.
+        {
+            delete d_config_p.load();
+        }
+
+        // MANIPULATORS
+        int maxConnections()
+            // Return the maximum number of connections of the current
+            // configuration.
+        {
+            bslmt::GracePeriodReadGuard guard(&d_gracePeriod);
+
+            return d_config_p.load()->d_maxConnections;
+        }
+//..
+// Then, we define the method that replaces the configuration.  Once the new
+// configuration is published, 'synchronize' waits for the readers that may
+// still be reading the previous one, which can then be destroyed:
+//..
+        void setMaxConnections(int maxConnections)
+            // Publish a configuration having the specified 'maxConnections'.
+        {
+            Config *config = new Config();
+            config->d_maxConnections = maxConnections;
+
+            Config *previous = d_config_p.swap(config);
+
+            d_gracePeriod.synchronize();
+
+            delete previous;
+        }
+    };
+//..
+
+}  // close namespace BSLMT_USAGE_EXAMPLE_1
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace BSLMT_USAGE_EXAMPLE_1;
+
+// Finally, we use the publisher:
+//..
+    ConfigPublisher publisher(10);
+    ASSERT(10 == publisher.maxConnections());
+
+    publisher.setMaxConnections(20);
+    ASSERT(20 == publisher.maxConnections());
+//..
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY: READERS AND REPLACEMENT
+        //
+        // Concerns:
+        //: 1 No reader observes an object destroyed by the writer after
+        //:   'synchronize' returns.
+        //:
+        //: 2 'synchronize' returns although readers are continually in
+        //:   progress.
+        //:
+        //: 3 Once 'synchronize' returns and the replaced object is destroyed,
+        //:   only the published object is allocated.
+        //
+        // Plan:
+        //: 1 Start several reader threads that repeatedly load the published
+        //:   object within a guard, verify that it has not been destroyed,
+        //:   yield, and verify again, until the writer is done.  (C-1)
+        //:
+        //: 2 Start a writer thread that repeatedly publishes a new object,
+        //:   calls 'synchronize', marks the replaced object as destroyed and
+        //:   deallocates it, and verifies that a single block is allocated
+        //:   from the test allocator.  The test completes only if every call
+        //:   to 'synchronize' returns.  (C-1..3)
+        //
+        // Testing:
+        //   CONCURRENCY: READERS AND REPLACEMENT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY: READERS AND REPLACEMENT" << endl
+                          << "====================================" << endl;
+
+        using namespace TestCase4;
+
+        enum { k_NUM_READERS = 8, k_NUM_REPLACEMENTS = 2000 };
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        {
+            Shared shared;
+            shared.d_allocator_p = &ta;
+
+            Value *initial = new (ta) Value();
+            initial->d_state = k_ALIVE;
+            shared.d_value_p = initial;
+
+            bslmt::ThreadGroup readers;
+            ASSERT(k_NUM_READERS == readers.addThreads(ReaderJob(&shared),
+                                                       k_NUM_READERS));
+
+            writerThread(&shared, k_NUM_REPLACEMENTS);
+
+            readers.joinAll();
+
+            if (verbose) { P(shared.d_numReads); }
+
+            ASSERT(0 == shared.d_gracePeriod.numReaders());
+
+            ta.deleteObject(shared.d_value_p.load());
+        }
+
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SYNCHRONIZE
+        //
+        // Concerns:
+        //: 1 'synchronize' returns immediately if no reader is in progress.
+        //:
+        //: 2 'synchronize' does not return while a reader that was in progress
+        //:   when it was called has not finished.
+        //:
+        //: 3 'synchronize' does not wait for a reader that entered after it
+        //:   was called.
+        //
+        // Plan:
+        //: 1 Call 'synchronize' with no reader in progress.  (C-1)
+        //:
+        //: 2 Enter as a reader, and call 'synchronize' in another thread.
+        //:   Verify that the thread has not returned from 'synchronize' after
+        //:   a delay; enter as a second reader, leave as the first reader, and
+        //:   verify that the thread returns from 'synchronize' while the
+        //:   second reader is in progress.  (C-2..3)
+        //
+        // Testing:
+        //   void synchronize();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SYNCHRONIZE" << endl
+                          << "===========" << endl;
+
+        using namespace TestCase3;
+
+        Obj mX;  const Obj& X = mX;
+
+        mX.synchronize();
+        mX.synchronize();
+
+        for (int i = 0; i < 4; ++i) {
+            bsls::AtomicInt isDone(0);
+
+            const int first = mX.enterReader();
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                             &handle,
+                                             SynchronizeJob(&mX, &isDone)));
+
+            bslmt::ThreadUtil::microSleep(100 * 1000);
+
+            ASSERTV(i, 0 == isDone.load());
+
+            const int second = mX.enterReader();
+
+            mX.leaveReader(first);
+
+            while (!isDone.load()) {
+                bslmt::ThreadUtil::yield();
+            }
+
+            ASSERTV(i, 1 == X.numReaders());
+
+            mX.leaveReader(second);
+
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            ASSERTV(i, 0 == X.numReaders());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // READ GUARD
+        //
+        // Concerns:
+        //: 1 A guard records a reader for its lifetime.
+        //:
+        //: 2 Guards may be nested.
+        //
+        // Plan:
+        //: 1 Create nested guards, and verify 'numReaders' as each is created
+        //:   and destroyed.  (C-1..2)
+        //
+        // Testing:
+        //   GracePeriodReadGuard(GracePeriod *gracePeriod);
+        //   ~GracePeriodReadGuard();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "READ GUARD" << endl
+                          << "==========" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        ASSERT(0 == X.numReaders());
+        {
+            Guard outer(&mX);
+
+            ASSERT(1 == X.numReaders());
+            {
+                Guard inner(&mX);
+
+                ASSERT(2 == X.numReaders());
+            }
+            ASSERT(1 == X.numReaders());
+        }
+        ASSERT(0 == X.numReaders());
+
+        mX.synchronize();
+        {
+            Guard guard(&mX);
+
+            ASSERT(1 == X.numReaders());
+        }
+        ASSERT(0 == X.numReaders());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //:
+        //: 2 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Enter and leave as readers, calling 'synchronize' in between, and
+        //:   verify 'numReaders'.  (C-1)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid tokens (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-2)
+        //
+        // Testing:
+        //   GracePeriod();
+        //   ~GracePeriod();
+        //   int enterReader();
+        //   void leaveReader(int token);
+        //   int numReaders() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == X.numReaders());
+
+            const int t1 = mX.enterReader();
+            ASSERT(1 == X.numReaders());
+
+            const int t2 = mX.enterReader();
+            ASSERT(2 == X.numReaders());
+
+            mX.leaveReader(t1);
+            ASSERT(1 == X.numReaders());
+
+            mX.leaveReader(t2);
+            ASSERT(0 == X.numReaders());
+
+            for (int i = 0; i < 3; ++i) {
+                mX.synchronize();
+
+                const int token = mX.enterReader();
+                ASSERTV(i, token, 0 == token || 1 == token);
+                ASSERT(1 == X.numReaders());
+
+                mX.leaveReader(token);
+                ASSERT(0 == X.numReaders());
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;
+
+            const int token = mX.enterReader();
+
+            ASSERT_SAFE_FAIL(mX.leaveReader(-1));
+            ASSERT_SAFE_FAIL(mX.leaveReader( 2));
+            ASSERT_SAFE_PASS(mX.leaveReader(token));
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
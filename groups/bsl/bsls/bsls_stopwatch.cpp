@@ -18,12 +18,23 @@ namespace bsls {
 // CLASS DATA
 const double Stopwatch::s_nanosecondsPerSecond = 1.0E9;
 
+AtomicOperations::AtomicTypes::Int Stopwatch::s_useTscClock = {0};
+
+// CLASS METHODS
+void Stopwatch::setUseTscClock(bool value)
+{
+    if (value) {
+        TscClock::initialize();
+    }
+    AtomicOperations::setIntRelaxed(&s_useTscClock, value);
+}
+
 // PRIVATE MANIPULATORS
 void Stopwatch::updateTimes()
 {
     Types::Int64 systemTime;
     Types::Int64 userTime;
-    TimeUtil::OpaqueNativeTime wallTime;
+    RawWallTime  wallTime;
     accumulatedTimesRaw(&systemTime, &userTime, &wallTime);
 
     d_accumulatedSystemTime += systemTime - d_startSystemTime;
@@ -39,7 +50,7 @@ void Stopwatch::accumulatedTimes(double *systemTime,
     if (d_isRunning) {
         Types::Int64 rawSystemTime;
         Types::Int64 rawUserTime;
-        TimeUtil::OpaqueNativeTime rawWallTime;
+        RawWallTime  rawWallTime;
         accumulatedTimesRaw(&rawSystemTime, &rawUserTime, &rawWallTime);
 
         *systemTime = static_cast<double>(
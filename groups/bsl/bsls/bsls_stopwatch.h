@@ -33,6 +33,20 @@ BSLS_IDENT("$Id: $")
 // 'bsls::Stopwatch' may be slow or inconsistent on some Windows machines.  See
 // the 'Accuracy and Precision' section of 'bsls_timeutil.h'.
 //
+///Measuring Wall Time with the Time-Stamp Counter
+///-----------------------------------------------
+// By default, a 'bsls::Stopwatch' measures wall time using
+// 'bsls::TimeUtil::getTimerRaw', which, on most platforms, calls the
+// operating system.  Calling 'bsls::Stopwatch::setUseTscClock(true)' makes
+// all stopwatches subsequently started measure wall time using
+// 'bsls::TscClock' instead, which reads the CPU time-stamp counter and is
+// substantially cheaper (see 'bsls_tscclock').  This is a process-wide
+// setting, intended to be made once at startup, that also applies to the
+// 'balm::StopwatchScopedGuard' objects and 'balm' stopwatch macros built on
+// 'bsls::Stopwatch'.  A stopwatch that is running when the setting is changed
+// continues to use the clock with which it was started.  Note that the
+// measurement of system and user times is unaffected.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate basic use of a 'bsls::Stopwatch'
@@ -78,8 +92,10 @@ BSLS_IDENT("$Id: $")
 //  const double t5w = s.accumulatedWallTime();    assert(0.0 == t5w);
 //..
 
+#include <bsls_atomicoperations.h>
 #include <bsls_keyword.h>
 #include <bsls_timeutil.h>
+#include <bsls_tscclock.h>
 #include <bsls_types.h>
 
 #include <string.h>
@@ -104,6 +120,15 @@ class Stopwatch {
     // The accumulated times can be accessed at any time and in either state
     // (RUNNING or STOPPED).
 
+    // PRIVATE TYPES
+    struct RawWallTime {
+        // This 'struct' holds a wall time as provided by the clock in use by
+        // a stopwatch: 'TimeUtil::getTimerRaw', or 'TscClock::getTimer'.
+
+        TimeUtil::OpaqueNativeTime d_native;  // from 'TimeUtil'
+        Types::Int64               d_tsc;     // from 'TscClock' (nanoseconds)
+    };
+
     // DATA
     Types::Int64 d_startSystemTime;        // system time when started
                                            // (nanoseconds)
@@ -111,9 +136,7 @@ class Stopwatch {
     Types::Int64 d_startUserTime;          // user time when started
                                            // (nanoseconds)
 
-    TimeUtil::OpaqueNativeTime d_startWallTime;
-                                           // wall time when started
-                                           // (nanoseconds)
+    RawWallTime  d_startWallTime;          // wall time when started
 
     Types::Int64 d_accumulatedSystemTime;  // accumulated system time
                                            // (nanoseconds)
@@ -130,11 +153,19 @@ class Stopwatch {
     bool         d_collectCpuTimesFlag;    // 'true' if cpu times are being
                                            // collected
 
+    bool         d_useTscClockFlag;        // 'true' if wall time is being
+                                           // measured using 'TscClock'
+
     // CLASS DATA
     static const double      s_nanosecondsPerSecond;   // conversion factor
                                                        // (for nanoseconds to
                                                        // seconds)
 
+    static AtomicOperations::AtomicTypes::Int
+                             s_useTscClock;            // 'true' if started
+                                                       // stopwatches use
+                                                       // 'TscClock'
+
   private:
     // NOT IMPLEMENTED
     Stopwatch& operator=(const Stopwatch&) BSLS_KEYWORD_DELETED;
@@ -145,18 +176,37 @@ class Stopwatch {
         // Update the CPU times accumulated but this stopwatch.
 
     // PRIVATE ACCESSORS
-    void accumulatedTimesRaw(Types::Int64               *systemTime,
-                             Types::Int64               *userTime,
-                             TimeUtil::OpaqueNativeTime *wallTime) const;
+    void accumulatedTimesRaw(Types::Int64 *systemTime,
+                             Types::Int64 *userTime,
+                             RawWallTime  *wallTime) const;
         // Load into the specified 'systemTime', 'userTime', and 'wallTime' the
         // values of the system time, user time, and wall time (in
-        // nanoseconds), respectively, as provided by 'TimeUtil'.
+        // nanoseconds), respectively, as provided by 'TimeUtil' (and, for the
+        // wall time, by 'TscClock' if 'd_useTscClockFlag' is 'true').
 
-    Types::Int64 elapsedWallTime(TimeUtil::OpaqueNativeTime rawWallTime) const;
+    Types::Int64 elapsedWallTime(const RawWallTime& rawWallTime) const;
         // Return the elapsed time, in nanoseconds, between the current
         // 'd_startWallTime' and the specified 'rawWallTime'.
 
+    void getWallTimeRaw(RawWallTime *wallTime) const;
+        // Load into the specified 'wallTime' the current wall time, as
+        // provided by 'TscClock' if 'd_useTscClockFlag' is 'true', and by
+        // 'TimeUtil' otherwise.
+
   public:
+    // CLASS METHODS
+    static void setUseTscClock(bool value);
+        // Set whether stopwatches subsequently started measure wall time using
+        // 'TscClock', rather than 'TimeUtil', to the specified 'value'.  If
+        // 'value' is 'true', initialize 'TscClock'.  Note that a stopwatch
+        // that is running when this method is called continues to use the
+        // clock with which it was started, and that 'TscClock' falls back on
+        // the system clock where the time-stamp counter is unavailable.
+
+    static bool useTscClock();
+        // Return 'true' if stopwatches subsequently started measure wall time
+        // using 'TscClock', and 'false' otherwise.
+
     // CREATORS
     Stopwatch();
         // Create a stopwatch in the STOPPED state having total accumulated
@@ -235,20 +285,40 @@ class Stopwatch {
 
 // PRIVATE ACCESSORS
 inline
-void Stopwatch::accumulatedTimesRaw(Types::Int64               *systemTime,
-                                    Types::Int64               *userTime,
-                                    TimeUtil::OpaqueNativeTime *wallTime) const
+void Stopwatch::accumulatedTimesRaw(Types::Int64 *systemTime,
+                                    Types::Int64 *userTime,
+                                    RawWallTime  *wallTime) const
 {
     TimeUtil::getProcessTimers(systemTime, userTime);
-    TimeUtil::getTimerRaw(wallTime);
+    getWallTimeRaw(wallTime);
+}
+
+inline
+Types::Int64 Stopwatch::elapsedWallTime(const RawWallTime& rawWallTime) const
+{
+    if (d_useTscClockFlag) {
+        return rawWallTime.d_tsc - d_startWallTime.d_tsc;             // RETURN
+    }
+    return TimeUtil::convertRawTime(rawWallTime.d_native)
+         - TimeUtil::convertRawTime(d_startWallTime.d_native);
+}
+
+inline
+void Stopwatch::getWallTimeRaw(RawWallTime *wallTime) const
+{
+    if (d_useTscClockFlag) {
+        wallTime->d_tsc = TscClock::getTimer();
+    }
+    else {
+        TimeUtil::getTimerRaw(&wallTime->d_native);
+    }
 }
 
+// CLASS METHODS
 inline
-Types::Int64 Stopwatch::elapsedWallTime(
-                                  TimeUtil::OpaqueNativeTime rawWallTime) const
+bool Stopwatch::useTscClock()
 {
-    return TimeUtil::convertRawTime(rawWallTime)
-         - TimeUtil::convertRawTime(d_startWallTime);
+    return AtomicOperations::getIntRelaxed(&s_useTscClock);
 }
 
 // CREATORS
@@ -262,6 +332,7 @@ Stopwatch::Stopwatch()
 , d_accumulatedWallTime(0)
 , d_isRunning(false)
 , d_collectCpuTimesFlag(false)
+, d_useTscClockFlag(false)
 {
     TimeUtil::initialize();
     memset(&d_startWallTime, 0, sizeof(d_startWallTime));
@@ -282,13 +353,14 @@ void Stopwatch::start(bool collectCpuTimes)
 {
     if (!d_isRunning) {
         d_collectCpuTimesFlag = collectCpuTimes;
+        d_useTscClockFlag     = useTscClock();
         if (d_collectCpuTimesFlag) {
             accumulatedTimesRaw(&d_startSystemTime,
                                 &d_startUserTime,
                                 &d_startWallTime);
         }
         else {
-            TimeUtil::getTimerRaw(&d_startWallTime);
+            getWallTimeRaw(&d_startWallTime);
         }
         d_isRunning = true;
     }
@@ -302,8 +374,8 @@ void Stopwatch::stop()
             updateTimes();
         }
         else {
-            TimeUtil::OpaqueNativeTime now;
-            TimeUtil::getTimerRaw(&now);
+            RawWallTime now;
+            getWallTimeRaw(&now);
             d_accumulatedWallTime += elapsedWallTime(now);
         }
         d_isRunning = false;
@@ -347,8 +419,8 @@ inline
 double Stopwatch::accumulatedWallTime() const
 {
     if (d_isRunning) {
-        TimeUtil::OpaqueNativeTime now;
-        TimeUtil::getTimerRaw(&now);
+        RawWallTime now;
+        getWallTimeRaw(&now);
         return (double)(d_accumulatedWallTime + elapsedWallTime(now))
                                                       / s_nanosecondsPerSecond;
                                                                       // RETURN
@@ -44,10 +44,12 @@ using namespace BloombergLP;
 // [ 4] double accumulatedWallTime() const;
 // [ 5] void accumulatedTimes(double*, double*, double*) const;
 // [ 4] double elapsedTime() const;
+// [ 7] static void setUseTscClock(bool value);
+// [ 7] static bool useTscClock();
 //-----------------------------------------------------------------------------
 // [ 1] Breathing Test
 // [ 2] State Transitions
-// [ 7] USAGE Example
+// [ 8] USAGE Example
 // [ 6] Reproduce bug from test case
 //-----------------------------------------------------------------------------
 
@@ -319,7 +321,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -365,6 +367,94 @@ int main(int argc, char *argv[])
         const double t5u = s.accumulatedUserTime();    ASSERT(0.0 == t5u);
         const double t5w = s.accumulatedWallTime();    ASSERT(0.0 == t5w);
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'setUseTscClock' and 'useTscClock':
+        //   Stopwatches started after 'setUseTscClock(true)' measure wall
+        //   time using 'bsls::TscClock', consistently with stopwatches using
+        //   'bsls::TimeUtil', and running stopwatches are unaffected by a
+        //   change of the setting.
+        //
+        // Plan:
+        //   Verify the initial setting, set it, and verify that
+        //   'bsls::TscClock' is initialized.  Start stopwatches before and
+        //   after setting it, with and without CPU times, and verify that the
+        //   wall times they accumulate over a fixed delay are consistent with
+        //   each other and with readings of 'bsls::TimeUtil::getTimer'
+        //   bracketing them.
+        //   Copy a running stopwatch, change the setting, and verify that the
+        //   running stopwatch and its copy continue to accumulate wall time
+        //   consistently.
+        //
+        // Testing:
+        //   static void setUseTscClock(bool value);
+        //   static bool useTscClock();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTesting 'setUseTscClock' and 'useTscClock'"
+                            "\n==========================================\n");
+
+        const double DELAY_TIME = 0.05;
+        const double TOLERANCE  = 0.01;
+
+        ASSERT(false == Obj::useTscClock());
+        ASSERT(false == bsls::TscClock::isActive());
+
+        Obj mA;  const Obj& A = mA;  // started using 'TimeUtil'
+        mA.start();
+
+        Obj::setUseTscClock(true);
+
+        ASSERT(true  == Obj::useTscClock());
+        ASSERT(bsls::TscClock::isAvailable() == bsls::TscClock::isActive());
+
+        Obj mB;  const Obj& B = mB;  // started using 'TscClock'
+        Obj mC;  const Obj& C = mC;  // ditto, collecting CPU times
+
+        const Int64 START = TU::getTimer();
+        mB.start();
+        mC.start(true);
+
+        delayWall(DELAY_TIME);
+
+        mC.stop();
+        mB.stop();
+        const Int64 STOP  = TU::getTimer();
+        mA.stop();
+
+        const double ELAPSED = static_cast<double>(STOP - START) / 1.0e9;
+
+        if (veryVerbose) {
+            T_;  P_(ELAPSED);  P_(A.elapsedTime());  P_(B.elapsedTime());
+            P(C.elapsedTime());
+        }
+
+        ASSERTV(B.elapsedTime(), DELAY_TIME <= B.elapsedTime());
+        ASSERTV(C.elapsedTime(), DELAY_TIME <= C.elapsedTime());
+        ASSERTV(ELAPSED, B.elapsedTime(), B.elapsedTime() <= ELAPSED);
+        ASSERTV(ELAPSED, C.elapsedTime(), C.elapsedTime() <= ELAPSED);
+        ASSERTV(ELAPSED, A.elapsedTime(), ELAPSED <= A.elapsedTime());
+        ASSERTV(C.accumulatedUserTime(), 0 <= C.accumulatedUserTime());
+
+        mB.start();
+        delayWall(DELAY_TIME);
+        const Obj D(B);  // running copy
+
+        Obj::setUseTscClock(false);
+
+        ASSERT(false == Obj::useTscClock());
+
+        delayWall(DELAY_TIME);
+
+        const double T1 = B.elapsedTime();
+        const double T2 = D.elapsedTime();
+
+        if (veryVerbose) { T_;  P_(T1);  P(T2); }
+
+        ASSERTV(T1, 3 * DELAY_TIME <= T1);
+        ASSERTV(T1, T2, T1 <= T2 + TOLERANCE);
+        ASSERTV(T1, T2, T2 - T1 < TOLERANCE);
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // ATTEMPT TO REPRODUCE BUG PRODUCING NEGATIVE TIMES
@@ -0,0 +1,476 @@
+// bsls_tscclock.cpp                                                  -*-C++-*-
+#include <bsls_tscclock.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_bslonce.h>
+#include <bsls_bsltestutil.h>  // for testing only
+#include <bsls_platform.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeutil.h>
+
+#include <string.h>  // 'memcpy'
+
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+    #if defined(BSLS_PLATFORM_CMP_MSVC)
+        #include <intrin.h>      // '__cpuid', '__rdtsc'
+        #define U_TSC_SUPPORTED 1
+    #elif defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+        #include <cpuid.h>       // '__get_cpuid'
+        #include <x86intrin.h>   // '__rdtsc'
+        #define U_TSC_SUPPORTED 1
+    #endif
+#endif
+
+namespace BloombergLP {
+namespace {
+namespace u {
+
+typedef bsls::AtomicOperations              AtomicOps;
+typedef bsls::AtomicOperations::AtomicTypes AtomicTypes;
+typedef bsls::Types::Int64                  Int64;
+
+enum State {
+    // Enumerate the states of the clock.
+
+    e_UNINITIALIZED = 0,  // 'initialize' has not completed
+    e_ACTIVE,             // the clock is derived from the TSC
+    e_INACTIVE            // the clock forwards to the system clocks
+};
+
+const Int64  k_CALIBRATION_PERIOD = 10 * 1000 * 1000;
+    // minimum period, in nanoseconds, over which the rate of the TSC is
+    // measured
+
+const Int64  k_DEFAULT_INTERVAL   = 1000 * 1000 * 1000;
+    // default recalibration interval, in nanoseconds
+
+const double k_MAX_RATE_CHANGE    = 1.0e-3;
+    // maximum relative change in the measured rate of the TSC between two
+    // calibrations before the TSC is deemed unreliable
+
+const double k_MAX_SLEW           = 1.0e-3;
+    // maximum relative adjustment of the rate of the clock made to correct
+    // drift
+
+const int    k_NUM_SAMPLES        = 5;
+    // number of attempts made to take each calibration sample, of which the
+    // one bracketed most tightly by TSC readings is used, when initializing
+    // or explicitly recalibrating the clock
+
+const int    k_NUM_QUICK_SAMPLES  = 1;
+    // number of attempts made to take each calibration sample when the clock
+    // is recalibrated by the reader that observes the recalibration deadline
+
+// The clock parameters below are published by 'publish' and read by
+// 'readClock' using a sequence lock: 's_sequence' is odd while the
+// parameters are being written.  Only one thread writes the parameters at a
+// time, namely the thread initializing the clock (serialized by 'BslOnce') or
+// the thread that set 's_recalibrating'.
+
+AtomicTypes::Int   s_state;           // 'State' of the clock
+AtomicTypes::Int   s_sequence;        // sequence number of the parameters
+AtomicTypes::Int   s_recalibrating;   // 1 while a thread is recalibrating
+AtomicTypes::Int64 s_interval;        // recalibration interval (0: default)
+
+AtomicTypes::Int64 s_baseTsc;         // TSC value at the last calibration
+AtomicTypes::Int64 s_baseNanoseconds; // clock value at 's_baseTsc'
+AtomicTypes::Int64 s_rate;            // nanoseconds per tick ('double' bits)
+AtomicTypes::Int64 s_realtimeOffset;  // realtime minus monotonic clock
+AtomicTypes::Int64 s_deadlineTsc;     // TSC value at which to recalibrate
+
+// The following measurement state is accessed only by the writing thread.
+
+Int64  s_sampleTsc;          // TSC value at the start of the rate measurement
+Int64  s_sampleNanoseconds;  // monotonic time at 's_sampleTsc'
+double s_measuredRate;       // last measured nanoseconds per tick
+
+inline
+Int64 readTsc()
+    // Return the current value of the time-stamp counter, or 0 if reading
+    // the time-stamp counter is not supported on this platform.
+{
+#if defined(U_TSC_SUPPORTED)
+    return static_cast<Int64>(__rdtsc());
+#else
+    return 0;
+#endif
+}
+
+inline
+Int64 rateToBits(double rate)
+    // Return the bits of the specified 'rate'.
+{
+    Int64 bits;
+    memcpy(&bits, &rate, sizeof bits);
+    return bits;
+}
+
+inline
+double bitsToRate(Int64 bits)
+    // Return the 'double' having the specified 'bits'.
+{
+    double rate;
+    memcpy(&rate, &bits, sizeof rate);
+    return rate;
+}
+
+inline
+Int64 interval()
+    // Return the recalibration interval in nanoseconds.
+{
+    const Int64 value = AtomicOps::getInt64Relaxed(&s_interval);
+    return 0 == value ? k_DEFAULT_INTERVAL : value;
+}
+
+void sampleTsc(Int64 *tsc, Int64 *nanoseconds, int numSamples)
+    // Load into the specified 'tsc' and 'nanoseconds' simultaneous readings
+    // of the time-stamp counter and of 'TimeUtil::getTimer', taking the
+    // tightest of the specified 'numSamples' attempts.  The behavior is
+    // undefined unless '1 <= numSamples'.
+{
+    Int64 bestWidth = -1;
+    for (int i = 0; i < numSamples; ++i) {
+        const Int64 before = readTsc();
+        const Int64 timer  = bsls::TimeUtil::getTimer();
+        const Int64 after  = readTsc();
+        const Int64 width  = after - before;
+
+        if (bestWidth < 0 || width < bestWidth) {
+            bestWidth    = width;
+            *tsc         = before + width / 2;
+            *nanoseconds = timer;
+        }
+    }
+}
+
+Int64 sampleRealtimeOffset(int numSamples)
+    // Return the offset, in nanoseconds, of 'SystemTime::nowRealtimeClock'
+    // from 'TimeUtil::getTimer', taking the tightest of the specified
+    // 'numSamples' attempts.  The behavior is undefined unless
+    // '1 <= numSamples'.
+{
+    Int64 bestWidth = -1;
+    Int64 offset    = 0;
+    for (int i = 0; i < numSamples; ++i) {
+        const Int64 before   = bsls::TimeUtil::getTimer();
+        const Int64 realtime =
+                      bsls::SystemTime::nowRealtimeClock().totalNanoseconds();
+        const Int64 after    = bsls::TimeUtil::getTimer();
+        const Int64 width    = after - before;
+
+        if (bestWidth < 0 || width < bestWidth) {
+            bestWidth = width;
+            offset    = realtime - (before + width / 2);
+        }
+    }
+    return offset;
+}
+
+void publish(Int64  baseTsc,
+             Int64  baseNanoseconds,
+             double rate,
+             Int64  realtimeOffset)
+    // Publish the specified 'baseTsc', 'baseNanoseconds', 'rate', and
+    // 'realtimeOffset' as the parameters of the clock, and schedule the next
+    // recalibration.  The behavior is undefined unless the calling thread is
+    // the only thread writing the parameters.
+{
+    const int   sequence = AtomicOps::getIntRelaxed(&s_sequence);
+    const Int64 deadline = baseTsc + static_cast<Int64>(interval() / rate);
+
+    AtomicOps::setIntRelease(&s_sequence, sequence + 1);
+    AtomicOps::setInt64Release(&s_baseTsc,         baseTsc);
+    AtomicOps::setInt64Release(&s_baseNanoseconds, baseNanoseconds);
+    AtomicOps::setInt64Release(&s_rate,            rateToBits(rate));
+    AtomicOps::setInt64Release(&s_realtimeOffset,  realtimeOffset);
+    AtomicOps::setInt64Release(&s_deadlineTsc,     deadline);
+    AtomicOps::setIntRelease(&s_sequence, sequence + 2);
+}
+
+void calibrate(int numSamples)
+    // Remeasure the rate of the time-stamp counter and the offset of the
+    // realtime clock, taking the tightest of the specified 'numSamples'
+    // attempts for each reading, correct the drift of the clock from
+    // 'TimeUtil::getTimer', and publish the new parameters; or, if the
+    // time-stamp counter is found to be unreliable, stop using it.  The
+    // behavior is undefined unless '1 <= numSamples', the clock is active,
+    // and the calling thread is the only thread writing the parameters.
+{
+    Int64 tsc;
+    Int64 nanoseconds;
+    sampleTsc(&tsc, &nanoseconds, numSamples);
+
+    const Int64 offset       = sampleRealtimeOffset(numSamples);
+    const Int64 elapsedTicks = tsc - s_sampleTsc;
+    const Int64 elapsed      = nanoseconds - s_sampleNanoseconds;
+
+    if (elapsedTicks <= 0) {
+        AtomicOps::setIntRelease(&s_state, e_INACTIVE);
+        return;                                                       // RETURN
+    }
+
+    if (k_CALIBRATION_PERIOD <= elapsed) {
+        // The rate is remeasured only over a period long enough for the
+        // sampling error to be negligible.
+
+        const double rate   = static_cast<double>(elapsed)
+                            / static_cast<double>(elapsedTicks);
+        const double change = rate - s_measuredRate;
+
+        if (change >  s_measuredRate * k_MAX_RATE_CHANGE
+         || change < -s_measuredRate * k_MAX_RATE_CHANGE) {
+            AtomicOps::setIntRelease(&s_state, e_INACTIVE);
+            return;                                                   // RETURN
+        }
+
+        s_sampleTsc         = tsc;
+        s_sampleNanoseconds = nanoseconds;
+        s_measuredRate      = rate;
+    }
+
+    // Continue the clock from its current value, and slew its rate so that
+    // its error is absorbed over the next interval.
+
+    const Int64  baseTsc   = AtomicOps::getInt64Relaxed(&s_baseTsc);
+    const Int64  baseNanoseconds =
+                               AtomicOps::getInt64Relaxed(&s_baseNanoseconds);
+    const double baseRate  = bitsToRate(AtomicOps::getInt64Relaxed(&s_rate));
+    const Int64  clock     = baseNanoseconds
+                  + static_cast<Int64>(static_cast<double>(tsc - baseTsc)
+                                                                 * baseRate);
+    const Int64  period    = interval();
+    const Int64  maxError  = static_cast<Int64>(period * k_MAX_SLEW);
+
+    Int64 error = nanoseconds - clock;
+    if (error > maxError) {
+        error = maxError;
+    }
+    else if (error < -maxError) {
+        error = -maxError;
+    }
+
+    publish(tsc,
+            clock,
+            s_measuredRate * (1.0 + static_cast<double>(error)
+                                               / static_cast<double>(period)),
+            offset);
+}
+
+bool tryRecalibrate(int numSamples)
+    // Recalibrate the clock, taking the tightest of the specified
+    // 'numSamples' attempts for each reading, and return 'true' unless
+    // another thread is recalibrating it, in which case return 'false' with
+    // no effect.  The behavior is undefined unless '1 <= numSamples' and the
+    // clock is initialized.
+{
+    if (0 != AtomicOps::testAndSwapIntAcqRel(&s_recalibrating, 0, 1)) {
+        return false;                                                 // RETURN
+    }
+    if (e_ACTIVE == AtomicOps::getIntAcquire(&s_state)) {
+        calibrate(numSamples);
+    }
+    AtomicOps::setIntRelease(&s_recalibrating, 0);
+    return true;
+}
+
+bool readClock(Int64 *nanoseconds, Int64 *realtimeOffset)
+    // Load into the specified 'nanoseconds' the current value of the
+    // monotonic clock derived from the time-stamp counter, and into the
+    // specified 'realtimeOffset' the offset of the realtime clock from it,
+    // recalibrating the clock if it is due, and return 'true'; or, if the
+    // time-stamp counter is not in use, return 'false' with no other effect.
+    // Initialize the clock if it is not initialized.
+{
+    int state = AtomicOps::getIntAcquire(&s_state);
+    if (e_UNINITIALIZED == state) {
+        bsls::TscClock::initialize();
+        state = AtomicOps::getIntAcquire(&s_state);
+    }
+
+    while (e_ACTIVE == state) {
+        const int    sequence  = AtomicOps::getIntAcquire(&s_sequence);
+        const Int64  baseTsc   = AtomicOps::getInt64Acquire(&s_baseTsc);
+        const Int64  baseNanoseconds =
+                               AtomicOps::getInt64Acquire(&s_baseNanoseconds);
+        const double rate      = bitsToRate(
+                                       AtomicOps::getInt64Acquire(&s_rate));
+        const Int64  offset    = AtomicOps::getInt64Acquire(&s_realtimeOffset);
+        const Int64  deadline  = AtomicOps::getInt64Acquire(&s_deadlineTsc);
+        const Int64  tsc       = readTsc();
+
+        if ((sequence & 1)
+         || sequence != AtomicOps::getIntAcquire(&s_sequence)) {
+            continue;  // the parameters were being written
+        }
+
+        // The reader that observes the deadline recalibrates the clock using
+        // a single sample of each reading, so as to add only a few clock
+        // reads to its own latency.  The rate is measured over the whole
+        // interval, so the error of a single sample is negligible.
+
+        if (tsc - deadline >= 0 && tryRecalibrate(k_NUM_QUICK_SAMPLES)) {
+            state = AtomicOps::getIntAcquire(&s_state);
+            continue;
+        }
+
+        *nanoseconds    = baseNanoseconds
+              + static_cast<Int64>(static_cast<double>(tsc - baseTsc) * rate);
+        *realtimeOffset = offset;
+        return true;                                                  // RETURN
+    }
+    return false;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+namespace bsls {
+
+                              // ---------------
+                              // struct TscClock
+                              // ---------------
+
+// CLASS METHODS
+Types::Int64 TscClock::getTimer()
+{
+    Types::Int64 nanoseconds;
+    Types::Int64 offset;
+    if (u::readClock(&nanoseconds, &offset)) {
+        return nanoseconds;                                           // RETURN
+    }
+    return TimeUtil::getTimer();
+}
+
+bool TscClock::initialize()
+{
+    static BslOnce once = BSLS_BSLONCE_INITIALIZER;
+
+    BslOnceGuard onceGuard;
+    if (onceGuard.enter(&once)) {
+        int state = u::e_INACTIVE;
+
+        if (isAvailable()) {
+            TimeUtil::initialize();
+
+            Types::Int64 startTsc;
+            Types::Int64 start;
+            u::sampleTsc(&startTsc, &start, u::k_NUM_SAMPLES);
+
+            Types::Int64 endTsc;
+            Types::Int64 end;
+            do {
+                u::sampleTsc(&endTsc, &end, u::k_NUM_SAMPLES);
+            } while (end - start < u::k_CALIBRATION_PERIOD);
+
+            if (endTsc > startTsc) {
+                u::s_sampleTsc         = endTsc;
+                u::s_sampleNanoseconds = end;
+                u::s_measuredRate      =
+                                      static_cast<double>(end - start)
+                                    / static_cast<double>(endTsc - startTsc);
+
+                u::publish(endTsc,
+                           end,
+                           u::s_measuredRate,
+                           u::sampleRealtimeOffset(u::k_NUM_SAMPLES));
+
+                state = u::e_ACTIVE;
+            }
+        }
+
+        AtomicOperations::setIntRelease(&u::s_state, state);
+    }
+    return isActive();
+}
+
+bool TscClock::isActive()
+{
+    return u::e_ACTIVE == AtomicOperations::getIntAcquire(&u::s_state);
+}
+
+bool TscClock::isAvailable()
+{
+#if defined(U_TSC_SUPPORTED)
+    // The invariant TSC is reported by bit 8 of 'EDX' for CPUID leaf
+    // '0x80000007', which exists if the maximum extended leaf (reported in
+    // 'EAX' for leaf '0x80000000') is at least '0x80000007'.
+
+    const unsigned int k_EXTENDED_LEAF  = 0x80000000u;
+    const unsigned int k_POWER_LEAF     = 0x80000007u;
+    const unsigned int k_INVARIANT_TSC  = 1u << 8;
+
+#if defined(BSLS_PLATFORM_CMP_MSVC)
+    int info[4];
+    __cpuid(info, static_cast<int>(k_EXTENDED_LEAF));
+    if (static_cast<unsigned int>(info[0]) < k_POWER_LEAF) {
+        return false;                                                 // RETURN
+    }
+    __cpuid(info, static_cast<int>(k_POWER_LEAF));
+    return 0 != (static_cast<unsigned int>(info[3]) & k_INVARIANT_TSC);
+#else
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(k_EXTENDED_LEAF, &eax, &ebx, &ecx, &edx)
+     || eax < k_POWER_LEAF) {
+        return false;                                                 // RETURN
+    }
+    __get_cpuid(k_POWER_LEAF, &eax, &ebx, &ecx, &edx);
+    return 0 != (edx & k_INVARIANT_TSC);
+#endif
+#else
+    return false;
+#endif
+}
+
+TimeInterval TscClock::now()
+{
+    Types::Int64 nanoseconds;
+    Types::Int64 offset;
+    if (u::readClock(&nanoseconds, &offset)) {
+        TimeInterval result;
+        result.setTotalNanoseconds(nanoseconds + offset);
+        return result;                                                // RETURN
+    }
+    return SystemTime::nowRealtimeClock();
+}
+
+void TscClock::recalibrate()
+{
+    if (isActive()) {
+        u::tryRecalibrate(u::k_NUM_SAMPLES);
+    }
+}
+
+Types::Int64 TscClock::recalibrationInterval()
+{
+    return u::interval();
+}
+
+void TscClock::setRecalibrationInterval(Types::Int64 nanoseconds)
+{
+    BSLS_ASSERT(u::k_CALIBRATION_PERIOD <= nanoseconds);
+
+    AtomicOperations::setInt64Relaxed(&u::s_interval, nanoseconds);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,241 @@
+// bsls_tscclock.h                                                    -*-C++-*-
+#ifndef INCLUDED_BSLS_TSCCLOCK
+#define INCLUDED_BSLS_TSCCLOCK
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a calibrated clock based on the CPU time-stamp counter.
+//
+//@CLASSES:
+//  bsls::TscClock: namespace for a time-stamp-counter-based clock
+//
+//@SEE_ALSO: bsls_timeutil, bsls_systemtime, bsls_stopwatch, bdlt_currenttime
+//
+//@DESCRIPTION: This component provides a 'struct', 'bsls::TscClock', that
+// provides a process-wide clock derived from the time-stamp counter (TSC) of
+// x86 processors.  Reading the TSC takes a single instruction and does not
+// enter the operating system, so 'bsls::TscClock::getTimer' and
+// 'bsls::TscClock::now' are several times faster than
+// 'bsls::TimeUtil::getTimer' and 'bsls::SystemTime::nowRealtimeClock', which
+// they are designed to replace where timestamps are taken at a high rate
+// (e.g., several latency stamps per message).
+//
+// 'getTimer' returns nanoseconds referenced to the same origin as
+// 'bsls::TimeUtil::getTimer', and 'now' returns the same kind of value as
+// 'bsls::SystemTime::nowRealtimeClock' (the time elapsed since the Unix
+// epoch), so the clock can be substituted for either without any change in
+// the interpretation of its results.  In particular, 'now' has the signature
+// of a 'bdlt::CurrentTime' callback, and may be installed with
+// 'bdlt::CurrentTime::setCurrentTimeCallback' (see {Example 2}); a
+// 'bsls::Stopwatch' measures wall time using this clock once
+// 'bsls::Stopwatch::setUseTscClock(true)' has been called (and therefore so
+// do the 'balm::StopwatchScopedGuard' objects and 'balm' stopwatch macros
+// built on 'bsls::Stopwatch').
+//
+///Availability
+///------------
+// The clock is used only on x86 processors that report an *invariant* TSC
+// (CPUID leaf '0x80000007', bit 8 of 'EDX'), i.e., a TSC that ticks at a
+// constant rate regardless of frequency scaling and sleep states, and only
+// with compilers providing the necessary intrinsics (GCC, Clang, and MSVC).
+// Where the clock is not available, or once it is found to be unreliable (see
+// {Calibration}), 'getTimer' and 'now' simply forward to
+// 'bsls::TimeUtil::getTimer' and 'bsls::SystemTime::nowRealtimeClock', so
+// that code written against this component works correctly everywhere.
+// 'isActive' indicates whether the TSC is currently in use.
+//
+///Calibration
+///-----------
+// The rate of the TSC is not known in advance, so 'initialize' measures it
+// against 'bsls::TimeUtil::getTimer' (i.e., 'CLOCK_MONOTONIC' on Linux) over
+// a period of 10 milliseconds, during which the calling thread spins, and
+// measures the offset of 'bsls::SystemTime::nowRealtimeClock' (i.e.,
+// 'CLOCK_REALTIME') from 'bsls::TimeUtil::getTimer'.  'initialize' is called
+// implicitly by the first call to 'getTimer' or 'now', but should be called
+// explicitly at startup so that the cost of calibration is not borne by the
+// first timestamp.
+//
+// The calibration is repeated periodically (by default, once per second; see
+// 'setRecalibrationInterval'), by the first caller of 'getTimer' or 'now' to
+// observe that the interval has elapsed.  That caller takes a single sample of
+// each reading, adding only a few clock reads to its latency, whereas
+// 'initialize' and 'recalibrate' take the tightest of several samples.
+// Recalibration does not block other readers, which continue to use the
+// previous parameters until the new ones are published.  Each recalibration:
+//
+//: o Re-measures the TSC rate over the whole interval since the previous
+//:   calibration, which tracks the slewing of the system clocks by NTP.
+//:
+//: o Corrects drift: the difference between the clock and
+//:   'bsls::TimeUtil::getTimer' is absorbed by adjusting the rate used for
+//:   the next interval, so that the clock converges on the system clock
+//:   without jumping backwards.
+//:
+//: o Re-measures the offset of the realtime clock, so that steps in the
+//:   system time (e.g., by 'settimeofday') are reflected by 'now' within one
+//:   interval.
+//:
+//: o Checks that the TSC is reliable.  If the TSC did not advance, or if its
+//:   measured rate differs from the previous measurement by more than 0.1%
+//:   (which exceeds the maximum NTP slew rate, but is typical of a TSC that
+//:   is not invariant or of a virtual machine migrated between hosts), the
+//:   TSC is abandoned for the remainder of the process and the clock falls
+//:   back on the system clocks.
+//
+///Accuracy and Monotonicity
+///-------------------------
+// Between calibrations, the clock advances at the measured rate of the TSC.
+// Its difference from 'bsls::TimeUtil::getTimer' is typically well below a
+// microsecond, and is bounded by the error of the rate measurement multiplied
+// by the recalibration interval.  Calibration preserves the continuity of the
+// clock, and successive values returned to a thread do not decrease (except
+// possibly by a nanosecond or so when a recalibration is published).
+//
+// The invariant TSCs of the cores of a processor, and of the processors of
+// most contemporary multi-socket systems, are synchronized by the hardware;
+// this component assumes such synchronization, as does the Linux kernel when
+// it selects the TSC as its clock source.  Test case -1 of the test driver of
+// this component measures the accuracy and the cost of the clock on a given
+// machine.
+//
+///Thread Safety
+///-------------
+// All of the functions of 'bsls::TscClock' are thread-safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Taking Latency Timestamps
+/// - - - - - - - - - - - - - - - - - -
+// Suppose that we are processing messages, and need to measure the latency of
+// each stage of processing.  First, at startup, we calibrate the clock:
+//..
+//  bsls::TscClock::initialize();
+//..
+// Then, we take timestamps as each message passes from one stage to the next:
+//..
+//  bsls::Types::Int64 received  = bsls::TscClock::getTimer();
+//
+//  // ... decode the message
+//
+//  bsls::Types::Int64 decoded   = bsls::TscClock::getTimer();
+//
+//  // ... process the message
+//
+//  bsls::Types::Int64 processed = bsls::TscClock::getTimer();
+//..
+// Finally, we compute the latencies, which are in nanoseconds:
+//..
+//  assert(received <= decoded);
+//  assert(decoded  <= processed);
+//
+//  bsls::Types::Int64 decodeLatency  = decoded   - received;
+//  bsls::Types::Int64 processLatency = processed - decoded;
+//..
+//
+///Example 2: Installing the Clock as the Current-Time Callback
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// 'bsls::TscClock::now' can be installed as the callback that
+// 'bdlt::CurrentTime' uses to obtain the current time, so that all of the
+// timestamps obtained by 'bdlt::CurrentTime' (and, e.g., by the 'ball'
+// logger) are taken from the TSC:
+//..
+//  bsls::TscClock::initialize();
+//
+//  bdlt::CurrentTime::CurrentTimeCallback previousCallback =
+//         bdlt::CurrentTime::setCurrentTimeCallback(&bsls::TscClock::now);
+//..
+// Note that 'bdlt' is a higher-level package than 'bsls', so this example is
+// not part of the test driver of this component; the equivalent test is in
+// the test driver of 'bdlt_currenttime'.
+
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bsls {
+
+                              // ===============
+                              // struct TscClock
+                              // ===============
+
+struct TscClock {
+    // This 'struct' provides a namespace for functions that read a
+    // process-wide clock derived from the CPU time-stamp counter, calibrated
+    // against the monotonic and realtime system clocks, and falling back on
+    // those clocks where the time-stamp counter is unavailable or unreliable.
+
+    // CLASS METHODS
+    static Types::Int64 getTimer();
+        // Return the current value of the monotonic clock, in nanoseconds
+        // referenced to the same origin as 'TimeUtil::getTimer'.  Initialize
+        // the clock if 'initialize' has not been called.  If the time-stamp
+        // counter is not in use (see 'isActive'), return
+        // 'TimeUtil::getTimer()'.
+
+    static bool initialize();
+        // Calibrate the clock if this method has not been called before.
+        // Return 'true' if the time-stamp counter is in use (see 'isActive'),
+        // and 'false' otherwise.  Note that the first call to this method
+        // spins the calling thread for approximately 10 milliseconds, and
+        // that subsequent calls return immediately.
+
+    static bool isActive();
+        // Return 'true' if 'initialize' has been called and the clock is
+        // derived from the time-stamp counter, and 'false' otherwise (i.e.,
+        // if 'initialize' has not been called, the time-stamp counter is not
+        // available, or it has been found to be unreliable).
+
+    static bool isAvailable();
+        // Return 'true' if the processor provides an invariant time-stamp
+        // counter and this component supports reading it on the current
+        // platform, and 'false' otherwise.
+
+    static TimeInterval now();
+        // Return the current value of the realtime clock, as the time elapsed
+        // since the Unix epoch.  Initialize the clock if 'initialize' has not
+        // been called.  If the time-stamp counter is not in use (see
+        // 'isActive'), return 'SystemTime::nowRealtimeClock()'.  Note that
+        // this function may be installed as the current-time callback of
+        // 'bdlt::CurrentTime'.
+
+    static void recalibrate();
+        // Recalibrate the clock now, rather than when the recalibration
+        // interval next elapses.  This method has no effect if the
+        // time-stamp counter is not in use, or if another thread is
+        // recalibrating the clock.  Note that it is not necessary to call
+        // this method, as the clock is recalibrated automatically.
+
+    static Types::Int64 recalibrationInterval();
+        // Return the interval, in nanoseconds, at which the clock is
+        // recalibrated.  The interval is initially 1 second.
+
+    static void setRecalibrationInterval(Types::Int64 nanoseconds);
+        // Set the interval at which the clock is recalibrated to the
+        // specified 'nanoseconds', effective from the next recalibration.
+        // The behavior is undefined unless '10000000 <= nanoseconds' (i.e.,
+        // the interval is at least 10 milliseconds).
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,733 @@
+// bsls_tscclock.t.cpp                                                -*-C++-*-
+
+#include <bsls_tscclock.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'bsls::TscClock' provides a process-wide clock whose state is established
+// by 'initialize' and by periodic recalibration, so each test case (which
+// runs in its own process) examines the state of the clock from the outset.
+// The results of the clock are verified against the system clocks it is
+// calibrated against, 'bsls::TimeUtil::getTimer' and
+// 'bsls::SystemTime::nowRealtimeClock', with a tolerance that accommodates
+// preemption of the test process.  Where the time-stamp counter is not
+// available, the same tests verify that the clock forwards to the system
+// clocks.  A negative test case measures the accuracy and the cost of the
+// clock.
+//-----------------------------------------------------------------------------
+// [ 3] Int64 getTimer();
+// [ 2] bool initialize();
+// [ 2] bool isActive();
+// [ 2] bool isAvailable();
+// [ 4] TimeInterval now();
+// [ 5] void recalibrate();
+// [ 5] Int64 recalibrationInterval();
+// [ 5] void setRecalibrationInterval(Int64 nanoseconds);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: ACCURACY AND OVERHEAD
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                        GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bsls::TscClock     Obj;
+typedef bsls::Types::Int64 Int64;
+
+// ============================================================================
+//                      HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+const Int64 k_TOLERANCE = 1000 * 1000;
+    // Maximum difference, in nanoseconds, between the clock and the system
+    // clock tolerated by the tests (generous, to accommodate preemption).
+
+Int64 timerDifference()
+    // Return the difference, in nanoseconds, between 'Obj::getTimer' and the
+    // closer of two readings of 'bsls::TimeUtil::getTimer' bracketing it, or
+    // 0 if 'Obj::getTimer' lies between the two readings.
+{
+    const Int64 before = bsls::TimeUtil::getTimer();
+    const Int64 timer  = Obj::getTimer();
+    const Int64 after  = bsls::TimeUtil::getTimer();
+
+    return timer < before ? timer - before
+         : timer > after  ? timer - after
+         :                  0;
+}
+
+Int64 realtimeDifference()
+    // Return the difference, in nanoseconds, between 'Obj::now' and the
+    // closer of two readings of 'bsls::SystemTime::nowRealtimeClock'
+    // bracketing it, or 0 if 'Obj::now' lies between the two readings.
+{
+    const Int64 before = bsls::SystemTime::nowRealtimeClock().
+                                                            totalNanoseconds();
+    const Int64 now    = Obj::now().totalNanoseconds();
+    const Int64 after  = bsls::SystemTime::nowRealtimeClock().
+                                                            totalNanoseconds();
+
+    return now < before ? now - before
+         : now > after  ? now - after
+         :                0;
+}
+
+Int64 absolute(Int64 value)
+    // Return the absolute value of the specified 'value'.
+{
+    return value < 0 ? -value : value;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void)     veryVeryVerbose;
+    (void) veryVeryVeryVerbose;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file must
+        //:   compile, link, and run as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example 1 from header into test driver,
+        //:   replace leading comment characters with spaces, and replace
+        //:   'assert' with 'ASSERT'.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Taking Latency Timestamps
+/// - - - - - - - - - - - - - - - - - -
+// Suppose that we are processing messages, and need to measure the latency of
+// each stage of processing.  First, at startup, we calibrate the clock:
+//..
+    bsls::TscClock::initialize();
+//..
+// Then, we take timestamps as each message passes from one stage to the next:
+//..
+    bsls::Types::Int64 received  = bsls::TscClock::getTimer();
+//
+    // ... decode the message
+//
+    bsls::Types::Int64 decoded   = bsls::TscClock::getTimer();
+//
+    // ... process the message
+//
+    bsls::Types::Int64 processed = bsls::TscClock::getTimer();
+//..
+// Finally, we compute the latencies, which are in nanoseconds:
+//..
+    ASSERT(received <= decoded);
+    ASSERT(decoded  <= processed);
+//
+    bsls::Types::Int64 decodeLatency  = decoded   - received;
+    bsls::Types::Int64 processLatency = processed - decoded;
+//..
+
+        (void) decodeLatency;
+        (void) processLatency;
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // RECALIBRATION
+        //   Ensure that recalibration preserves the continuity and the
+        //   accuracy of the clock.
+        //
+        // Concerns:
+        //: 1 The recalibration interval is initially 1 second, and
+        //:   'setRecalibrationInterval' sets it.
+        //:
+        //: 2 'recalibrate' does not cause the clock to go backwards, nor to
+        //:   jump forwards.
+        //:
+        //: 3 Over a period spanning many automatic recalibrations, the clock
+        //:   does not go backwards, remains within the tolerance of
+        //:   'bsls::TimeUtil::getTimer' and, if the time-stamp counter is in
+        //:   use, remains in use.
+        //:
+        //: 4 'recalibrate' has no effect if the clock is not in use.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Verify the initial interval, set it to 10 milliseconds, and
+        //:   verify the new value.  (C-1)
+        //:
+        //: 2 Call 'recalibrate' repeatedly between readings of the clock, and
+        //:   verify that the readings are non-decreasing and close together.
+        //:   (C-2)
+        //:
+        //: 3 Read the clock continuously for 300 milliseconds, verifying that
+        //:   it is non-decreasing, periodically comparing it against
+        //:   'bsls::TimeUtil::getTimer', and verify 'isActive' at the end.
+        //:   (C-3)
+        //:
+        //: 4 Call 'recalibrate' before 'initialize', and verify that the
+        //:   clock is not initialized.  (C-4)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for an interval shorter than 10 milliseconds.  (C-5)
+        //
+        // Testing:
+        //   void recalibrate();
+        //   Int64 recalibrationInterval();
+        //   void setRecalibrationInterval(Int64 nanoseconds);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nRECALIBRATION"
+                            "\n=============\n");
+
+        const Int64 k_MILLISECOND = 1000 * 1000;
+
+        if (verbose) printf("\nTesting 'recalibrate' before 'initialize'.\n");
+        {
+            Obj::recalibrate();
+            ASSERT(false == Obj::isActive());
+        }
+
+        if (verbose) printf("\nTesting the recalibration interval.\n");
+        {
+            ASSERT(1000 * k_MILLISECOND == Obj::recalibrationInterval());
+
+            Obj::setRecalibrationInterval(10 * k_MILLISECOND);
+            ASSERT(  10 * k_MILLISECOND == Obj::recalibrationInterval());
+        }
+
+        const bool ACTIVE = Obj::initialize();
+
+        if (verbose) printf("\nTesting 'recalibrate'.\n");
+        {
+            for (int i = 0; i < 100; ++i) {
+                const Int64 before = Obj::getTimer();
+                Obj::recalibrate();
+                const Int64 after  = Obj::getTimer();
+
+                ASSERTV(i, before, after, before <= after);
+                ASSERTV(i, before, after, after - before < k_TOLERANCE);
+                ASSERTV(i, ACTIVE == Obj::isActive());
+            }
+        }
+
+        if (verbose) printf("\nTesting automatic recalibration.\n");
+        {
+            const Int64 end      = Obj::getTimer() + 300 * k_MILLISECOND;
+            Int64       previous = Obj::getTimer();
+            Int64       maxError = 0;
+            int         numReads = 0;
+
+            while (previous < end) {
+                const Int64 timer = Obj::getTimer();
+                ASSERTV(previous, timer, previous <= timer);
+                previous = timer;
+
+                if (0 == ++numReads % 1000) {
+                    const Int64 error = absolute(timerDifference());
+                    if (maxError < error) {
+                        maxError = error;
+                    }
+                }
+            }
+
+            if (veryVerbose) { P_(numReads) P(maxError) }
+
+            ASSERTV(maxError, maxError < k_TOLERANCE);
+            ASSERTV(ACTIVE == Obj::isActive());
+        }
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj::setRecalibrationInterval(10 * k_MILLISECOND));
+            ASSERT_FAIL(Obj::setRecalibrationInterval(10 * k_MILLISECOND - 1));
+            ASSERT_FAIL(Obj::setRecalibrationInterval(0));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'now'
+        //   Ensure that 'now' returns the realtime clock.
+        //
+        // Concerns:
+        //: 1 The first call to 'now' initializes the clock.
+        //:
+        //: 2 'now' is within the tolerance of
+        //:   'bsls::SystemTime::nowRealtimeClock'.
+        //:
+        //: 3 'now' is consistent with 'getTimer'.
+        //
+        // Plan:
+        //: 1 Call 'now' before 'initialize', and verify 'isActive'.  (C-1)
+        //:
+        //: 2 Compare 'now' against readings of
+        //:   'bsls::SystemTime::nowRealtimeClock' bracketing it, repeatedly
+        //:   for 100 milliseconds.  (C-2)
+        //:
+        //: 3 Verify that the intervals between successive calls to 'now' and
+        //:   between successive calls to 'getTimer' are consistent.  (C-3)
+        //
+        // Testing:
+        //   TimeInterval now();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'now'"
+                            "\n=====\n");
+
+        if (verbose) printf("\nTesting implicit initialization.\n");
+        {
+            ASSERT(false == Obj::isActive());
+
+            const bsls::TimeInterval NOW = Obj::now();
+
+            ASSERT(Obj::isAvailable() == Obj::isActive());
+            ASSERT(bsls::TimeInterval() < NOW);
+
+            if (veryVerbose) { P(Obj::isActive()) }
+        }
+
+        if (verbose) printf("\nComparing with the realtime clock.\n");
+        {
+            const Int64 end      = bsls::TimeUtil::getTimer()
+                                 + 100 * 1000 * 1000;
+            Int64       maxError = 0;
+
+            while (bsls::TimeUtil::getTimer() < end) {
+                const Int64 error = absolute(realtimeDifference());
+                if (maxError < error) {
+                    maxError = error;
+                }
+            }
+
+            if (veryVerbose) { P(maxError) }
+
+            ASSERTV(maxError, maxError < k_TOLERANCE);
+        }
+
+        if (verbose) printf("\nComparing with 'getTimer'.\n");
+        {
+            for (int i = 0; i < 100; ++i) {
+                const Int64 now1   = Obj::now().totalNanoseconds();
+                const Int64 timer1 = Obj::getTimer();
+                const Int64 now2   = Obj::now().totalNanoseconds();
+                const Int64 timer2 = Obj::getTimer();
+
+                ASSERTV(i, now1 <= now2);
+                ASSERTV(i, timer1 <= timer2);
+                ASSERTV(i, absolute((now2 - now1) - (timer2 - timer1))
+                                                             < k_TOLERANCE);
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'getTimer'
+        //   Ensure that 'getTimer' returns the monotonic clock.
+        //
+        // Concerns:
+        //: 1 The first call to 'getTimer' initializes the clock.
+        //:
+        //: 2 'getTimer' has the same origin as 'bsls::TimeUtil::getTimer',
+        //:   and is within the tolerance of it.
+        //:
+        //: 3 Successive calls to 'getTimer' return non-decreasing values.
+        //
+        // Plan:
+        //: 1 Call 'getTimer' before 'initialize', and verify 'isActive'.
+        //:   (C-1)
+        //:
+        //: 2 Compare 'getTimer' against readings of
+        //:   'bsls::TimeUtil::getTimer' bracketing it, repeatedly for 100
+        //:   milliseconds.  (C-2)
+        //:
+        //: 3 Call 'getTimer' one million times, and verify that the results
+        //:   do not decrease.  (C-3)
+        //
+        // Testing:
+        //   Int64 getTimer();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'getTimer'"
+                            "\n==========\n");
+
+        if (verbose) printf("\nTesting implicit initialization.\n");
+        {
+            ASSERT(false == Obj::isActive());
+
+            const Int64 TIMER = Obj::getTimer();
+
+            ASSERT(Obj::isAvailable() == Obj::isActive());
+            ASSERT(0 < TIMER);
+
+            if (veryVerbose) { P(Obj::isActive()) }
+        }
+
+        if (verbose) printf("\nComparing with 'bsls::TimeUtil::getTimer'.\n");
+        {
+            const Int64 end      = bsls::TimeUtil::getTimer()
+                                 + 100 * 1000 * 1000;
+            Int64       maxError = 0;
+
+            while (bsls::TimeUtil::getTimer() < end) {
+                const Int64 error = absolute(timerDifference());
+                if (maxError < error) {
+                    maxError = error;
+                }
+            }
+
+            if (veryVerbose) { P(maxError) }
+
+            ASSERTV(maxError, maxError < k_TOLERANCE);
+        }
+
+        if (verbose) printf("\nTesting monotonicity.\n");
+        {
+            Int64 previous = Obj::getTimer();
+            for (int i = 0; i < 1000 * 1000; ++i) {
+                const Int64 timer = Obj::getTimer();
+                if (timer < previous) {
+                    ASSERTV(i, previous, timer, previous <= timer);
+                }
+                previous = timer;
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'initialize', 'isActive', AND 'isAvailable'
+        //   Ensure that the clock is initialized as documented.
+        //
+        // Concerns:
+        //: 1 The clock is not active before 'initialize' is called.
+        //:
+        //: 2 'initialize' activates the clock if and only if the time-stamp
+        //:   counter is available, and returns 'isActive()'.
+        //:
+        //: 3 'isAvailable' returns the same value on every call.
+        //:
+        //: 4 Subsequent calls to 'initialize' have no effect, and return
+        //:   promptly.
+        //
+        // Plan:
+        //: 1 Verify 'isActive' before calling 'initialize'.  (C-1)
+        //:
+        //: 2 Call 'initialize', and verify its result against 'isActive' and
+        //:   'isAvailable'.  (C-2..3)
+        //:
+        //: 3 Call 'initialize' again, timing the call, and verify its result.
+        //:   (C-4)
+        //
+        // Testing:
+        //   bool initialize();
+        //   bool isActive();
+        //   bool isAvailable();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'initialize', 'isActive', AND 'isAvailable'"
+                            "\n===========================================\n");
+
+        const bool AVAILABLE = Obj::isAvailable();
+
+        if (veryVerbose) { P(AVAILABLE) }
+
+        ASSERT(false     == Obj::isActive());
+        ASSERT(AVAILABLE == Obj::isAvailable());
+
+        const Int64 start  = bsls::TimeUtil::getTimer();
+        const bool  ACTIVE = Obj::initialize();
+        const Int64 end    = bsls::TimeUtil::getTimer();
+
+        if (veryVerbose) { P_(ACTIVE) P(end - start) }
+
+        ASSERT(AVAILABLE == ACTIVE);
+        ASSERT(ACTIVE    == Obj::isActive());
+        ASSERT(AVAILABLE == Obj::isAvailable());
+
+        if (ACTIVE) {
+            ASSERTV(end - start, 10 * 1000 * 1000 <= end - start);
+        }
+
+        for (int i = 0; i < 10; ++i) {
+            const Int64 start = bsls::TimeUtil::getTimer();
+            ASSERTV(i, ACTIVE == Obj::initialize());
+            const Int64 end   = bsls::TimeUtil::getTimer();
+
+            ASSERTV(i, end - start, end - start < k_TOLERANCE);
+            ASSERTV(i, ACTIVE == Obj::isActive());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Initialize the clock, read it, and compare the readings with the
+        //:   system clocks.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        const bool ACTIVE = Obj::initialize();
+
+        if (veryVerbose) { P_(Obj::isAvailable()) P(ACTIVE) }
+
+        ASSERT(ACTIVE == Obj::isActive());
+
+        const Int64 timer1 = Obj::getTimer();
+        const Int64 timer2 = Obj::getTimer();
+
+        ASSERTV(timer1, timer2, timer1 <= timer2);
+        ASSERTV(absolute(timerDifference()) < k_TOLERANCE);
+        ASSERTV(absolute(realtimeDifference()) < k_TOLERANCE);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: ACCURACY AND OVERHEAD
+        //   Measure the cost of reading the clock, compared with the system
+        //   clocks, and its accuracy over time.
+        //
+        // Concerns:
+        //: 1 Reading the clock is substantially cheaper than reading the
+        //:   system clocks.
+        //:
+        //: 2 The clock remains close to the system clocks over a long period.
+        //
+        // Plan:
+        //: 1 Time ten million calls to each of 'getTimer',
+        //:   'bsls::TimeUtil::getTimer', 'now', and
+        //:   'bsls::SystemTime::nowRealtimeClock', and report the average
+        //:   cost per call.  (C-1)
+        //:
+        //: 2 For a number of seconds (10, unless specified as the second
+        //:   argument), compare the clock every millisecond with the midpoint
+        //:   of two readings of the system clock bracketing it, and report
+        //:   the mean and maximum absolute differences.  (C-2)
+        //
+        // Testing:
+        //   PERFORMANCE: ACCURACY AND OVERHEAD
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE: ACCURACY AND OVERHEAD"
+               "\n==================================\n");
+
+        const int NUM_CALLS   = 10 * 1000 * 1000;
+        const int NUM_SECONDS = argc > 2 ? atoi(argv[2]) : 10;
+
+        printf("time-stamp counter available: %d, in use: %d\n",
+               static_cast<int>(Obj::isAvailable()),
+               static_cast<int>(Obj::initialize()));
+
+        Int64 checksum = 0;
+        Int64 start;
+
+        printf("\nOverhead (ns/call):\n");
+
+        start = bsls::TimeUtil::getTimer();
+        for (int i = 0; i < NUM_CALLS; ++i) {
+            checksum += Obj::getTimer();
+        }
+        printf("  bsls::TscClock::getTimer            %6.1f\n",
+               static_cast<double>(bsls::TimeUtil::getTimer() - start)
+                                                                / NUM_CALLS);
+
+        start = bsls::TimeUtil::getTimer();
+        for (int i = 0; i < NUM_CALLS; ++i) {
+            checksum += bsls::TimeUtil::getTimer();
+        }
+        printf("  bsls::TimeUtil::getTimer            %6.1f\n",
+               static_cast<double>(bsls::TimeUtil::getTimer() - start)
+                                                                / NUM_CALLS);
+
+        start = bsls::TimeUtil::getTimer();
+        for (int i = 0; i < NUM_CALLS; ++i) {
+            checksum += Obj::now().nanoseconds();
+        }
+        printf("  bsls::TscClock::now                 %6.1f\n",
+               static_cast<double>(bsls::TimeUtil::getTimer() - start)
+                                                                / NUM_CALLS);
+
+        start = bsls::TimeUtil::getTimer();
+        for (int i = 0; i < NUM_CALLS; ++i) {
+            checksum += bsls::SystemTime::nowRealtimeClock().nanoseconds();
+        }
+        printf("  bsls::SystemTime::nowRealtimeClock  %6.1f\n",
+               static_cast<double>(bsls::TimeUtil::getTimer() - start)
+                                                                / NUM_CALLS);
+
+        printf("\nAccuracy over %d seconds (ns):\n", NUM_SECONDS);
+
+        const Int64 k_MILLISECOND = 1000 * 1000;
+        const Int64 end           = bsls::TimeUtil::getTimer()
+                                  + NUM_SECONDS * 1000 * k_MILLISECOND;
+        Int64       next          = bsls::TimeUtil::getTimer();
+        Int64       maxTimerError = 0;
+        Int64       maxNowError   = 0;
+        double      sumTimerError = 0;
+        double      sumNowError   = 0;
+        int         numSamples    = 0;
+
+        while (next < end) {
+            // Measure the error against the midpoint of the system clock
+            // readings bracketing each reading of this clock.
+
+            const Int64 before     = bsls::TimeUtil::getTimer();
+            const Int64 timer      = Obj::getTimer();
+            const Int64 after      = bsls::TimeUtil::getTimer();
+            const Int64 realBefore = bsls::SystemTime::nowRealtimeClock().
+                                                            totalNanoseconds();
+            const Int64 now        = Obj::now().totalNanoseconds();
+            const Int64 realAfter  = bsls::SystemTime::nowRealtimeClock().
+                                                            totalNanoseconds();
+
+            const Int64 timerError = absolute(timer
+                                            - (before + (after - before) / 2));
+            const Int64 nowError   = absolute(now
+                                - (realBefore + (realAfter - realBefore) / 2));
+
+            maxTimerError  = maxTimerError < timerError ? timerError
+                                                        : maxTimerError;
+            maxNowError    = maxNowError   < nowError   ? nowError
+                                                        : maxNowError;
+            sumTimerError += static_cast<double>(timerError);
+            sumNowError   += static_cast<double>(nowError);
+            ++numSamples;
+
+            next += k_MILLISECOND;
+            while (bsls::TimeUtil::getTimer() < next) {
+                checksum += Obj::getTimer();
+            }
+        }
+
+        printf("  'getTimer' vs. 'bsls::TimeUtil::getTimer': "
+               "mean %8.1f  max %8lld\n",
+               sumTimerError / numSamples,
+               static_cast<long long>(maxTimerError));
+        printf("  'now' vs. 'nowRealtimeClock':              "
+               "mean %8.1f  max %8lld\n",
+               sumNowError / numSamples,
+               static_cast<long long>(maxNowError));
+        printf("  still in use: %d  (checksum %lld)\n",
+               static_cast<int>(Obj::isActive()),
+               static_cast<long long>(checksum));
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
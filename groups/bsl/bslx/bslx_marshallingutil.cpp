@@ -4,7 +4,317 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bslx_marshallingutil_cpp,"$Id$ $CSID$")
 
+#include <bslmf_assert.h>
+
+#include <bsls_atomicoperations.h>
+#include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
+
+// Compiler-specific and platform-specific
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define BSLX_MARSHALLINGUTIL_X86_GCC
+#endif
+#endif
+
+#if defined(BSLX_MARSHALLINGUTIL_X86_GCC)
+#include <immintrin.h>
+#endif
+
+// IMPLEMENTATION NOTES
+// --------------------
+// Arrays of 16-, 32- and 64-bit integers and of 'float' and 'double' values
+// are marshalled by reversing the bytes of each element, which on
+// little-endian platforms is done in bulk by one of several kernels.  On x86
+// platforms built with GCC or Clang, a kernel using the AVX2 or SSSE3 byte
+// shuffle instruction is selected at run-time according to the capabilities
+// of the CPU, and a portable kernel built on 'bsls::ByteOrderUtil' is used
+// otherwise.  On big-endian platforms the marshalled representation matches
+// the in-memory representation, and the arrays are simply copied.
+
 namespace BloombergLP {
+namespace {
+namespace u {
+
+BSLMF_ASSERT(2 == sizeof(short));
+BSLMF_ASSERT(4 == sizeof(int));
+BSLMF_ASSERT(8 == sizeof(bsls::Types::Int64));
+BSLMF_ASSERT(4 == sizeof(float));
+BSLMF_ASSERT(8 == sizeof(double));
+
+typedef void (*ReverseFunction)(char        *destination,
+                                const char  *source,
+                                bsl::size_t  numElements);
+    // Load into the specified 'destination' the specified 'numElements'
+    // elements at the specified 'source', reversing the order of the bytes of
+    // each element.  The element size is fixed by the function.
+
+struct Kernels {
+    // This 'struct' holds the byte-reversing functions for each element size.
+
+    ReverseFunction d_reverse16;  // reverses 2-byte elements
+    ReverseFunction d_reverse32;  // reverses 4-byte elements
+    ReverseFunction d_reverse64;  // reverses 8-byte elements
+};
+
+template <class UINT>
+void reversePortable(char        *destination,
+                     const char  *source,
+                     bsl::size_t  numElements)
+    // Load into the specified 'destination' the specified 'numElements'
+    // elements of (template parameter) 'UINT' size at the specified 'source',
+    // reversing the order of the bytes of each element.
+{
+    const char *end = source + numElements * sizeof(UINT);
+    for (; source != end; source += sizeof(UINT)) {
+        UINT value;
+        bsl::memcpy(&value, source, sizeof value);
+        value = bsls::ByteOrderUtil::swapBytes(value);
+        bsl::memcpy(destination, &value, sizeof value);
+        destination += sizeof(UINT);
+    }
+}
+
+const Kernels k_PORTABLE_KERNELS = {
+    &reversePortable<unsigned short>,
+    &reversePortable<unsigned int>,
+    &reversePortable<bsls::Types::Uint64>
+};
+
+#if defined(BSLX_MARSHALLINGUTIL_X86_GCC)
+
+template <class UINT>
+struct ShuffleMask {
+    // This 'struct' provides the 'pshufb' control bytes that reverse the bytes
+    // of each (template parameter) 'UINT' element in a 32-byte block.
+
+    // CLASS DATA
+    static const char k_BYTES[32];
+};
+
+template <>
+const char ShuffleMask<unsigned short>::k_BYTES[32] = {
+     1,  0,  3,  2,  5,  4,  7,  6,  9,  8, 11, 10, 13, 12, 15, 14,
+     1,  0,  3,  2,  5,  4,  7,  6,  9,  8, 11, 10, 13, 12, 15, 14
+};
+
+template <>
+const char ShuffleMask<unsigned int>::k_BYTES[32] = {
+     3,  2,  1,  0,  7,  6,  5,  4, 11, 10,  9,  8, 15, 14, 13, 12,
+     3,  2,  1,  0,  7,  6,  5,  4, 11, 10,  9,  8, 15, 14, 13, 12
+};
+
+template <>
+const char ShuffleMask<bsls::Types::Uint64>::k_BYTES[32] = {
+     7,  6,  5,  4,  3,  2,  1,  0, 15, 14, 13, 12, 11, 10,  9,  8,
+     7,  6,  5,  4,  3,  2,  1,  0, 15, 14, 13, 12, 11, 10,  9,  8
+};
+
+template <class UINT>
+__attribute__((target("ssse3")))
+void reverseSsse3(char        *destination,
+                  const char  *source,
+                  bsl::size_t  numElements)
+    // Load into the specified 'destination' the specified 'numElements'
+    // elements of (template parameter) 'UINT' size at the specified 'source',
+    // reversing the order of the bytes of each element 16 bytes at a time.
+    // The behavior is undefined unless the CPU supports SSSE3.
+{
+    const char    *maskBytes = ShuffleMask<UINT>::k_BYTES;
+    const __m128i  mask      = _mm_loadu_si128(
+                                 reinterpret_cast<const __m128i *>(maskBytes));
+
+    bsl::size_t numBytes = numElements * sizeof(UINT);
+    for (; numBytes >= 16; numBytes -= 16) {
+        const __m128i block =
+                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(source));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(destination),
+                         _mm_shuffle_epi8(block, mask));
+        source      += 16;
+        destination += 16;
+    }
+    reversePortable<UINT>(destination, source, numBytes / sizeof(UINT));
+}
+
+template <class UINT>
+__attribute__((target("avx2")))
+void reverseAvx2(char        *destination,
+                 const char  *source,
+                 bsl::size_t  numElements)
+    // Load into the specified 'destination' the specified 'numElements'
+    // elements of (template parameter) 'UINT' size at the specified 'source',
+    // reversing the order of the bytes of each element 32 bytes at a time.
+    // The behavior is undefined unless the CPU supports AVX2.
+{
+    const char    *maskBytes = ShuffleMask<UINT>::k_BYTES;
+    const __m256i  mask      = _mm256_loadu_si256(
+                                 reinterpret_cast<const __m256i *>(maskBytes));
+
+    bsl::size_t numBytes = numElements * sizeof(UINT);
+    for (; numBytes >= 32; numBytes -= 32) {
+        const __m256i block =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination),
+                            _mm256_shuffle_epi8(block, mask));
+        source      += 32;
+        destination += 32;
+    }
+    reversePortable<UINT>(destination, source, numBytes / sizeof(UINT));
+}
+
+const Kernels k_SSSE3_KERNELS = {
+    &reverseSsse3<unsigned short>,
+    &reverseSsse3<unsigned int>,
+    &reverseSsse3<bsls::Types::Uint64>
+};
+
+const Kernels k_AVX2_KERNELS = {
+    &reverseAvx2<unsigned short>,
+    &reverseAvx2<unsigned int>,
+    &reverseAvx2<bsls::Types::Uint64>
+};
+
+#endif  // BSLX_MARSHALLINGUTIL_X86_GCC
+
+typedef bslx::MarshallingUtil_ImpUtil ImpUtil;
+
+bool isSupported(ImpUtil::Kernel kernel)
+    // Return 'true' if the specified 'kernel' is built for this platform and
+    // supported by the CPU, and 'false' otherwise.
+{
+    switch (kernel) {
+      case ImpUtil::e_PORTABLE: {
+        return true;                                                  // RETURN
+      }
+#if defined(BSLX_MARSHALLINGUTIL_X86_GCC)
+      case ImpUtil::e_SSSE3: {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("ssse3");                       // RETURN
+      }
+      case ImpUtil::e_AVX2: {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");                        // RETURN
+      }
+#endif
+      default: {
+        return false;                                                 // RETURN
+      }
+    }
+}
+
+const Kernels *kernelTable(ImpUtil::Kernel kernel)
+    // Return the address of the byte-reversing functions of the specified
+    // 'kernel'.  The behavior is undefined unless 'isSupported(kernel)'.
+{
+    BSLS_ASSERT(isSupported(kernel));
+
+    switch (kernel) {
+#if defined(BSLX_MARSHALLINGUTIL_X86_GCC)
+      case ImpUtil::e_SSSE3: {
+        return &k_SSSE3_KERNELS;                                      // RETURN
+      }
+      case ImpUtil::e_AVX2: {
+        return &k_AVX2_KERNELS;                                       // RETURN
+      }
+#endif
+      default: {
+        return &k_PORTABLE_KERNELS;                                   // RETURN
+      }
+    }
+}
+
+#undef BSLX_MARSHALLINGUTIL_X86_GCC
+
+ImpUtil::Kernel defaultKernel()
+    // Return the kernel best suited to the CPU.
+{
+    if (isSupported(ImpUtil::e_AVX2)) {
+        return ImpUtil::e_AVX2;                                       // RETURN
+    }
+    if (isSupported(ImpUtil::e_SSSE3)) {
+        return ImpUtil::e_SSSE3;                                      // RETURN
+    }
+    return ImpUtil::e_PORTABLE;
+}
+
+bsls::AtomicOperations::AtomicTypes::Pointer g_kernels = { 0 };
+    // the kernels in use, or 0 if not yet selected
+
+void setKernels(const Kernels *kernels)
+    // Make the bulk array functions use the specified 'kernels'.
+{
+    bsls::AtomicOperations::setPtrRelease(&g_kernels,
+                                          const_cast<Kernels *>(kernels));
+}
+
+const Kernels& kernels()
+    // Return a reference to the byte-reversing kernels in use, selecting
+    // those best suited to the CPU on first use.
+{
+    const Kernels *result = static_cast<const Kernels *>(
+                            bsls::AtomicOperations::getPtrAcquire(&g_kernels));
+
+    if (!result) {
+        // Selection is idempotent, so concurrent first calls are benign.
+
+        result = kernelTable(defaultKernel());
+        setKernels(result);
+    }
+    return *result;
+}
+
+inline
+void reverse16(void *destination, const void *source, int numElements)
+    // Load into the specified 'destination' the marshalled or unmarshalled
+    // representation of the specified 'numElements' 2-byte elements at the
+    // specified 'source'.
+{
+#if BSLS_PLATFORM_IS_LITTLE_ENDIAN
+    kernels().d_reverse16(static_cast<char *>(destination),
+                          static_cast<const char *>(source),
+                          numElements);
+#else
+    bsl::memcpy(destination, source, numElements * 2);
+#endif
+}
+
+inline
+void reverse32(void *destination, const void *source, int numElements)
+    // Load into the specified 'destination' the marshalled or unmarshalled
+    // representation of the specified 'numElements' 4-byte elements at the
+    // specified 'source'.
+{
+#if BSLS_PLATFORM_IS_LITTLE_ENDIAN
+    kernels().d_reverse32(static_cast<char *>(destination),
+                          static_cast<const char *>(source),
+                          numElements);
+#else
+    bsl::memcpy(destination, source, numElements * 4);
+#endif
+}
+
+inline
+void reverse64(void *destination, const void *source, int numElements)
+    // Load into the specified 'destination' the marshalled or unmarshalled
+    // representation of the specified 'numElements' 8-byte elements at the
+    // specified 'source'.
+{
+#if BSLS_PLATFORM_IS_LITTLE_ENDIAN
+    kernels().d_reverse64(static_cast<char *>(destination),
+                          static_cast<const char *>(source),
+                          numElements);
+#else
+    bsl::memcpy(destination, source, numElements * 8);
+#endif
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
 namespace bslx {
 
                         // ----------------------
@@ -23,11 +333,7 @@ void MarshallingUtil::putArrayInt64(char                     *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
-    const bsls::Types::Int64 *end = values + numValues;
-    for (; values != end; ++values) {
-        putInt64(buffer, *values);
-        buffer += k_SIZEOF_INT64;
-    }
+    u::reverse64(buffer, values, numValues);
 }
 
 void MarshallingUtil::putArrayInt64(char                      *buffer,
@@ -38,11 +344,7 @@ void MarshallingUtil::putArrayInt64(char                      *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
-    const bsls::Types::Uint64 *end = values + numValues;
-    for (; values != end; ++values) {
-        putInt64(buffer, *values);
-        buffer += k_SIZEOF_INT64;
-    }
+    u::reverse64(buffer, values, numValues);
 }
 
 void MarshallingUtil::putArrayInt56(char                     *buffer,
@@ -143,11 +445,7 @@ void MarshallingUtil::putArrayInt32(char      *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
-    const int *end = values + numValues;
-    for (; values != end; ++values) {
-        putInt32(buffer, *values);
-        buffer += k_SIZEOF_INT32;
-    }
+    u::reverse32(buffer, values, numValues);
 }
 
 void MarshallingUtil::putArrayInt32(char               *buffer,
@@ -158,11 +456,7 @@ void MarshallingUtil::putArrayInt32(char               *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
-    const unsigned int *end = values + numValues;
-    for (; values != end; ++values) {
-        putInt32(buffer, *values);
-        buffer += k_SIZEOF_INT32;
-    }
+    u::reverse32(buffer, values, numValues);
 }
 
 void MarshallingUtil::putArrayInt24(char      *buffer,
@@ -203,11 +497,7 @@ void MarshallingUtil::putArrayInt16(char        *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
-    const short *end = values + numValues;
-    for (; values != end; ++values) {
-        putInt16(buffer, *values);
-        buffer += k_SIZEOF_INT16;
-    }
+    u::reverse16(buffer, values, numValues);
 }
 
 void MarshallingUtil::putArrayInt16(char                 *buffer,
@@ -218,11 +508,7 @@ void MarshallingUtil::putArrayInt16(char                 *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
-    const unsigned short *end = values + numValues;
-    for (; values != end; ++values) {
-        putInt16(buffer, *values);
-        buffer += k_SIZEOF_INT16;
-    }
+    u::reverse16(buffer, values, numValues);
 }
 
                         // *** put arrays of floating-point values ***
@@ -235,11 +521,7 @@ void MarshallingUtil::putArrayFloat64(char         *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
-    const double *end = values + numValues;
-    for (; values < end; ++values) {
-        putFloat64(buffer, *values);
-        buffer += k_SIZEOF_FLOAT64;
-    }
+    u::reverse64(buffer, values, numValues);
 }
 
 void MarshallingUtil::putArrayFloat32(char        *buffer,
@@ -250,11 +532,7 @@ void MarshallingUtil::putArrayFloat32(char        *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
-    const float *end = values + numValues;
-    for (; values < end; ++values) {
-        putFloat32(buffer, *values);
-        buffer += k_SIZEOF_FLOAT32;
-    }
+    u::reverse32(buffer, values, numValues);
 }
 
                         // *** get arrays of integral values ***
@@ -267,11 +545,7 @@ void MarshallingUtil::getArrayInt64(bsls::Types::Int64 *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
-    const bsls::Types::Int64 *end = variables + numVariables;
-    for (; variables != end; ++variables) {
-        getInt64(variables, buffer);
-        buffer += k_SIZEOF_INT64;
-    }
+    u::reverse64(variables, buffer, numVariables);
 }
 
 void MarshallingUtil::getArrayUint64(bsls::Types::Uint64 *variables,
@@ -282,11 +556,7 @@ void MarshallingUtil::getArrayUint64(bsls::Types::Uint64 *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
-    const bsls::Types::Uint64 *end = variables + numVariables;
-    for (; variables != end; ++variables) {
-        getUint64(variables, buffer);
-        buffer += k_SIZEOF_INT64;
-    }
+    u::reverse64(variables, buffer, numVariables);
 }
 
 void MarshallingUtil::getArrayInt56(bsls::Types::Int64 *variables,
@@ -387,11 +657,7 @@ void MarshallingUtil::getArrayInt32(int        *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
-    const int *end = variables + numVariables;
-    for (; variables != end; ++variables) {
-        getInt32(variables, buffer);
-        buffer += k_SIZEOF_INT32;
-    }
+    u::reverse32(variables, buffer, numVariables);
 }
 
 void MarshallingUtil::getArrayUint32(unsigned int *variables,
@@ -402,11 +668,7 @@ void MarshallingUtil::getArrayUint32(unsigned int *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
-    const unsigned int *end = variables + numVariables;
-    for (; variables != end; ++variables) {
-        getUint32(variables, buffer);
-        buffer += k_SIZEOF_INT32;
-    }
+    u::reverse32(variables, buffer, numVariables);
 }
 
 void MarshallingUtil::getArrayInt24(int        *variables,
@@ -447,11 +709,7 @@ void MarshallingUtil::getArrayInt16(short      *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
-    const short *end = variables + numVariables;
-    for (; variables != end; ++variables) {
-        getInt16(variables, buffer);
-        buffer += k_SIZEOF_INT16;
-    }
+    u::reverse16(variables, buffer, numVariables);
 }
 
 void MarshallingUtil::getArrayUint16(unsigned short *variables,
@@ -462,11 +720,7 @@ void MarshallingUtil::getArrayUint16(unsigned short *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
-    const unsigned short *end = variables + numVariables;
-    for (; variables != end; ++variables) {
-        getUint16(variables, buffer);
-        buffer += k_SIZEOF_INT16;
-    }
+    u::reverse16(variables, buffer, numVariables);
 }
 
                         // *** get arrays of floating-point variables ***
@@ -479,11 +733,7 @@ void MarshallingUtil::getArrayFloat64(double     *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
-    const double *end = variables + numVariables;
-    for (; variables != end; ++variables) {
-        getFloat64(variables, buffer);
-        buffer += k_SIZEOF_FLOAT64;
-    }
+    u::reverse64(variables, buffer, numVariables);
 }
 
 void MarshallingUtil::getArrayFloat32(float      *variables,
@@ -494,11 +744,29 @@ void MarshallingUtil::getArrayFloat32(float      *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
-    const float *end = variables + numVariables;
-    for (; variables != end; ++variables) {
-        getFloat32(variables, buffer);
-        buffer += k_SIZEOF_INT32;
-    }
+    u::reverse32(variables, buffer, numVariables);
+}
+
+                     // ------------------------------
+                     // struct MarshallingUtil_ImpUtil
+                     // ------------------------------
+
+// CLASS METHODS
+MarshallingUtil_ImpUtil::Kernel MarshallingUtil_ImpUtil::defaultKernel()
+{
+    return u::defaultKernel();
+}
+
+bool MarshallingUtil_ImpUtil::isSupported(Kernel kernel)
+{
+    return u::isSupported(kernel);
+}
+
+void MarshallingUtil_ImpUtil::setKernel(Kernel kernel)
+{
+    BSLS_ASSERT(u::isSupported(kernel));
+
+    u::setKernels(u::kernelTable(kernel));
 }
 
 }  // close package namespace
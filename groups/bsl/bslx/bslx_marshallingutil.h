@@ -121,6 +121,10 @@ BSLS_IDENT("$Id: $")
 //                   values,        const float *                NN=32
 //                   numValues)
 //..
+// The 'putArray...' and 'getArray...' functions for 16-, 32-, and 64-bit
+// integers and for floating-point values convert entire arrays in bulk.  On
+// x86 platforms, they use SSSE3 or AVX2 byte-shuffle instructions when the
+// CPU supports them, as determined at run-time.
 //
 ///IEEE 754 Double-Precision Format
 ///--------------------------------
@@ -776,6 +780,46 @@ struct MarshallingUtil {
 
 };
 
+                     // ==============================
+                     // struct MarshallingUtil_ImpUtil
+                     // ==============================
+
+struct MarshallingUtil_ImpUtil {
+    // [!PRIVATE!] This 'struct' provides a namespace for functions that
+    // select the kernel used by the bulk array functions of
+    // 'MarshallingUtil' to reverse the bytes of 16-, 32-, and 64-bit
+    // elements, so that the test driver can verify each kernel that the CPU
+    // supports.  These functions are not thread-safe with respect to the
+    // array functions of 'MarshallingUtil', and must not be used outside of
+    // this component.
+
+    // TYPES
+    enum Kernel {
+        // Enumerate the byte-reversing kernels.
+
+        e_PORTABLE,  // element by element, using 'bsls::ByteOrderUtil'
+        e_SSSE3,     // 16 bytes at a time, using SSSE3 'pshufb'
+        e_AVX2       // 32 bytes at a time, using AVX2 'vpshufb'
+    };
+
+    enum { k_NUM_KERNELS = e_AVX2 + 1 };
+
+    // CLASS METHODS
+    static Kernel defaultKernel();
+        // Return the kernel best suited to the CPU, which the bulk array
+        // functions use unless 'setKernel' has been called.
+
+    static bool isSupported(Kernel kernel);
+        // Return 'true' if the specified 'kernel' is built for this platform
+        // and supported by the CPU, and 'false' otherwise.
+
+    static void setKernel(Kernel kernel);
+        // Make the bulk array functions use the specified 'kernel'.  The
+        // behavior is undefined unless 'isSupported(kernel)', and no other
+        // thread is calling this method or a bulk array function of
+        // 'MarshallingUtil'.
+};
+
 // ============================================================================
 //                           INLINE DEFINITIONS
 // ============================================================================
@@ -6,12 +6,15 @@
 #include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
 
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iomanip.h>
 #include <bsl_ios.h>
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -115,7 +118,9 @@ using namespace bslx;
 // [ 2] EXPLORE DOUBLE FORMAT -- make sure format is IEEE-COMPLIANT
 // [ 3] EXPLORE FLOAT FORMAT -- make sure format is IEEE-COMPLIANT
 // [24] STRESS TEST - Used to determine performance characteristics.
-// [25] USAGE EXAMPLE
+// [25] BULK ARRAY CONVERSION
+// [26] USAGE EXAMPLE
+// [-1] ARRAY THROUGHPUT BENCHMARK
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -322,6 +327,120 @@ static void printFloat(ostream& stream, float number)
     printFloatBits(stream, number) << ": " << number << endl;
 }
 
+// ============================================================================
+//                      FUNCTIONS TO TEST BULK ARRAY CONVERSION
+// ----------------------------------------------------------------------------
+
+template <class TYPE, class PUT_TYPE>
+void testBulkArray(int   line,
+                   void (*putArray)(char *, const TYPE *, int),
+                   void (*getArray)(TYPE *, const char *, int),
+                   void (*put)(char *, PUT_TYPE),
+                   void (*get)(TYPE *, const char *))
+    // Verify, for a range of array lengths and buffer alignments, that the
+    // specified 'putArray' produces the same bytes as applying the specified
+    // 'put' to each element, that the specified 'getArray' produces the same
+    // values as applying the specified 'get' to each element, that neither
+    // modifies memory beyond the array, and that the round trip restores the
+    // original bit patterns.  Report failures using the specified 'line'.
+{
+    enum { k_MAX_LENGTH = 80, k_MAX_OFFSET = 4, k_GUARD = 0x5A };
+
+    const int SIZE = static_cast<int>(sizeof(TYPE));
+
+    TYPE          values[k_MAX_LENGTH];
+    unsigned char seed = 17;
+    for (int i = 0; i < k_MAX_LENGTH; ++i) {
+        char *bytes = reinterpret_cast<char *>(values + i);
+        for (int j = 0; j < SIZE; ++j) {
+            seed     = static_cast<unsigned char>(seed * 37 + 11);
+            bytes[j] = static_cast<char>(seed);
+        }
+    }
+
+    for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+        for (int offset = 0; offset < k_MAX_OFFSET; ++offset) {
+            char buffer[(k_MAX_LENGTH + 1) * sizeof(TYPE) + k_MAX_OFFSET];
+            char expected[sizeof buffer];
+            bsl::memset(buffer,   k_GUARD, sizeof buffer);
+            bsl::memset(expected, k_GUARD, sizeof expected);
+
+            putArray(buffer + offset, values, length);
+            for (int i = 0; i < length; ++i) {
+                put(expected + offset + i * SIZE, values[i]);
+            }
+            ASSERTV(line, length, offset,
+                    0 == bsl::memcmp(buffer, expected, sizeof buffer));
+
+            TYPE variables[k_MAX_LENGTH + 1];
+            TYPE scalarVariables[k_MAX_LENGTH + 1];
+            bsl::memset(variables,       k_GUARD, sizeof variables);
+            bsl::memset(scalarVariables, k_GUARD, sizeof scalarVariables);
+
+            getArray(variables, buffer + offset, length);
+            for (int i = 0; i < length; ++i) {
+                get(scalarVariables + i, buffer + offset + i * SIZE);
+            }
+            ASSERTV(line, length, offset,
+                    0 == bsl::memcmp(variables,
+                                     scalarVariables,
+                                     sizeof variables));
+            ASSERTV(line, length, offset,
+                    0 == bsl::memcmp(variables, values, length * SIZE));
+        }
+    }
+}
+
+template <class TYPE>
+double timeArray(void (*putArray)(char *, const TYPE *, int),
+                 void (*getArray)(TYPE *, const char *, int),
+                 int   numElements,
+                 int   numIterations)
+    // Return the number of seconds taken to marshal and unmarshal an array of
+    // the specified 'numElements' values using the specified 'putArray' and
+    // 'getArray' the specified 'numIterations' times.
+{
+    bsl::vector<TYPE> values(numElements, TYPE(1));
+    bsl::vector<char> buffer(numElements * sizeof(TYPE));
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int i = 0; i < numIterations; ++i) {
+        putArray(buffer.data(), values.data(), numElements);
+        getArray(values.data(), buffer.data(), numElements);
+    }
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+template <class TYPE, class PUT_TYPE>
+double timeElements(void (*put)(char *, PUT_TYPE),
+                    void (*get)(TYPE *, const char *),
+                    int   numElements,
+                    int   numIterations)
+    // Return the number of seconds taken to marshal and unmarshal an array of
+    // the specified 'numElements' values one element at a time using the
+    // specified 'put' and 'get' the specified 'numIterations' times.
+{
+    const int SIZE = static_cast<int>(sizeof(TYPE));
+
+    bsl::vector<TYPE> values(numElements, TYPE(1));
+    bsl::vector<char> buffer(numElements * sizeof(TYPE));
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int i = 0; i < numIterations; ++i) {
+        for (int j = 0; j < numElements; ++j) {
+            put(buffer.data() + j * SIZE, values[j]);
+        }
+        for (int j = 0; j < numElements; ++j) {
+            get(values.data() + j, buffer.data() + j * SIZE);
+        }
+    }
+    timer.stop();
+    return timer.elapsedTime();
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -335,7 +454,7 @@ int main(int argc, char *argv[]) {
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 25: {
+      case 26: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -397,6 +516,110 @@ int main(int argc, char *argv[]) {
 //..
 
       } break;
+      case 25: {
+        // --------------------------------------------------------------------
+        // BULK ARRAY CONVERSION
+        //   The array functions for 16-, 32- and 64-bit integers and for
+        //   floating-point values convert in bulk, using vector byte shuffles
+        //   where the CPU supports them.
+        //
+        // Concerns:
+        //: 1 The bulk array functions produce exactly the encoding (and
+        //:   decoding) of the corresponding scalar functions applied to each
+        //:   element, for arrays shorter than, equal to and longer than the
+        //:   vector block sizes, and for unaligned buffers.
+        //:
+        //: 2 No bytes beyond the end of the array are written.
+        //:
+        //: 3 Arbitrary bit patterns (including floating-point NaNs) survive
+        //:   the round trip unchanged.
+        //:
+        //: 4 Concerns 1..3 hold for every byte-reversing kernel that the CPU
+        //:   supports, not only for the one selected by default.
+        //
+        // Plan:
+        //: 1 For each kernel that 'MarshallingUtil_ImpUtil::isSupported'
+        //:   reports, select the kernel using 'setKernel', and, for each bulk
+        //:   array function pair, use 'testBulkArray' to compare against the
+        //:   scalar functions for every length up to 80 and buffer offsets 0
+        //:   to 3, with guard bytes around the output.  (C-1..4)
+        //:
+        //: 2 Restore the default kernel.
+        //
+        // Testing:
+        //   BULK ARRAY CONVERSION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BULK ARRAY CONVERSION" << endl
+                          << "=====================" << endl;
+
+        typedef bsls::Types::Int64      Int64;
+        typedef bsls::Types::Uint64     Uint64;
+        typedef MarshallingUtil         Util;
+        typedef MarshallingUtil_ImpUtil ImpUtil;
+
+        const ImpUtil::Kernel DEFAULT_KERNEL = ImpUtil::defaultKernel();
+
+        ASSERT(ImpUtil::isSupported(ImpUtil::e_PORTABLE));
+        ASSERT(ImpUtil::isSupported(DEFAULT_KERNEL));
+
+        for (int k = 0; k < ImpUtil::k_NUM_KERNELS; ++k) {
+            const ImpUtil::Kernel KERNEL = static_cast<ImpUtil::Kernel>(k);
+
+            if (!ImpUtil::isSupported(KERNEL)) {
+                if (verbose) cout << "\tKernel " << k << " not supported."
+                                  << endl;
+                continue;
+            }
+            if (verbose) cout << "\tTesting kernel " << k << "." << endl;
+
+            ImpUtil::setKernel(KERNEL);
+
+            testBulkArray<Int64>(L_,
+                                 &Util::putArrayInt64,
+                                 &Util::getArrayInt64,
+                                 &Util::putInt64,
+                                 &Util::getInt64);
+            testBulkArray<Uint64>(L_,
+                                  &Util::putArrayInt64,
+                                  &Util::getArrayUint64,
+                                  &Util::putInt64,
+                                  &Util::getUint64);
+            testBulkArray<int>(L_,
+                               &Util::putArrayInt32,
+                               &Util::getArrayInt32,
+                               &Util::putInt32,
+                               &Util::getInt32);
+            testBulkArray<unsigned int>(L_,
+                                        &Util::putArrayInt32,
+                                        &Util::getArrayUint32,
+                                        &Util::putInt32,
+                                        &Util::getUint32);
+            testBulkArray<short>(L_,
+                                 &Util::putArrayInt16,
+                                 &Util::getArrayInt16,
+                                 &Util::putInt16,
+                                 &Util::getInt16);
+            testBulkArray<unsigned short>(L_,
+                                          &Util::putArrayInt16,
+                                          &Util::getArrayUint16,
+                                          &Util::putInt16,
+                                          &Util::getUint16);
+            testBulkArray<double>(L_,
+                                  &Util::putArrayFloat64,
+                                  &Util::getArrayFloat64,
+                                  &Util::putFloat64,
+                                  &Util::getFloat64);
+            testBulkArray<float>(L_,
+                                 &Util::putArrayFloat32,
+                                 &Util::getArrayFloat32,
+                                 &Util::putFloat32,
+                                 &Util::getFloat32);
+        }
+
+        ImpUtil::setKernel(DEFAULT_KERNEL);
+      } break;
       case 24: {
         // --------------------------------------------------------------------
         // STRESS TEST
@@ -4981,6 +5204,67 @@ int main(int argc, char *argv[]) {
         }
 
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // ARRAY THROUGHPUT BENCHMARK
+        //
+        // Concerns:
+        //: 1 Report the speed of the bulk array functions relative to
+        //:   marshalling the same arrays one element at a time.
+        //
+        // Plan:
+        //: 1 For 'Int64', 'int' and 'double' arrays of 10,000 elements, time
+        //:   round trips through the array functions and through the scalar
+        //:   functions, and report the rate of each in MB/s.  (C-1)
+        //
+        // Testing:
+        //   ARRAY THROUGHPUT BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ARRAY THROUGHPUT BENCHMARK" << endl
+                          << "==========================" << endl;
+
+        typedef bsls::Types::Int64 Int64;
+        typedef MarshallingUtil    Util;
+
+        const int    NUM_ELEMENTS   = 10000;
+        const int    NUM_ITERATIONS = 2000;
+        const double MB             = 2.0 * NUM_ELEMENTS * NUM_ITERATIONS
+                                                                    / 1.0e6;
+
+        const double INT64_BULK = timeArray<Int64>(&Util::putArrayInt64,
+                                                   &Util::getArrayInt64,
+                                                   NUM_ELEMENTS,
+                                                   NUM_ITERATIONS);
+        const double INT64_EACH = timeElements<Int64>(&Util::putInt64,
+                                                      &Util::getInt64,
+                                                      NUM_ELEMENTS,
+                                                      NUM_ITERATIONS);
+        const double INT32_BULK = timeArray<int>(&Util::putArrayInt32,
+                                                 &Util::getArrayInt32,
+                                                 NUM_ELEMENTS,
+                                                 NUM_ITERATIONS);
+        const double INT32_EACH = timeElements<int>(&Util::putInt32,
+                                                    &Util::getInt32,
+                                                    NUM_ELEMENTS,
+                                                    NUM_ITERATIONS);
+        const double FLOAT64_BULK = timeArray<double>(&Util::putArrayFloat64,
+                                                      &Util::getArrayFloat64,
+                                                      NUM_ELEMENTS,
+                                                      NUM_ITERATIONS);
+        const double FLOAT64_EACH = timeElements<double>(&Util::putFloat64,
+                                                         &Util::getFloat64,
+                                                         NUM_ELEMENTS,
+                                                         NUM_ITERATIONS);
+
+        cout << "Int64   array: " << MB * 8 / INT64_BULK   << " MB/s, "
+             << "per element: "   << MB * 8 / INT64_EACH   << " MB/s" << endl
+             << "int     array: " << MB * 4 / INT32_BULK   << " MB/s, "
+             << "per element: "   << MB * 4 / INT32_EACH   << " MB/s" << endl
+             << "double  array: " << MB * 8 / FLOAT64_BULK << " MB/s, "
+             << "per element: "   << MB * 8 / FLOAT64_EACH << " MB/s" << endl;
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;